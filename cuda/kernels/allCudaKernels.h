@@ -2,5 +2,5 @@
 #include "bandWidth.h"
 #include "basicAdd.h"
 #include "kernelSwitchTest.h"
-#include "basicValueIteration.h"
+#include "deviceValueIteration.h"
 #include "version.h"
\ No newline at end of file
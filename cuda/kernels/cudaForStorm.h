@@ -5,8 +5,8 @@
  * List of exported functions in this library
  */
 
-// TopologicalValueIteration
-#include "basicValueIteration.h"
+// Value iteration with the matrix resident in device memory
+#include "deviceValueIteration.h"
 
 // Utility Functions
 #include "utility.h"
@@ -0,0 +1,264 @@
+#include "deviceValueIteration.h"
+
+#include <iostream>
+#include <utility>
+
+#include <cuda_runtime.h>
+
+#include "storm-cudaplugin-config.h"
+
+// The kernels only use the CUDA runtime API and warp shuffles, so they can be translated to HIP (with hipify) if the warp size is adjusted.
+#define STORM_CUDA_WARP_SIZE 32
+#define STORM_CUDA_BLOCK_SIZE 256
+
+#define STORM_CUDA_CHECK(call) do { cudaError_t const storm_cuda_error = (call); if (storm_cuda_error != cudaSuccess) { reportCudaError(storm_cuda_error, __LINE__); return false; } } while (false)
+
+struct DeviceSparseMatrix {
+	size_t rowCount;
+	size_t columnCount;
+	size_t rowGroupCount;
+	size_t nnzCount;
+
+	// The matrix itself.
+	uint64_t* rowIndications;
+	uint32_t* columns;
+	double* values;
+	uint64_t* rowGroupIndices;
+
+	// Auxiliary storage that is allocated once together with the matrix.
+	double* x;
+	double* xSwap;
+	double* b;
+	double* rowValues;
+	uint64_t* choices;
+	int* notConverged;
+};
+
+namespace {
+	void reportCudaError(cudaError_t const error, int const line) {
+		std::cerr << "(DLL) CUDA error: " << cudaGetErrorString(error) << " (Code: " << error << ") in Line " << line << std::endl;
+	}
+
+	unsigned int getBlockCount(size_t const threadCount) {
+		return static_cast<unsigned int>((threadCount + STORM_CUDA_BLOCK_SIZE - 1) / STORM_CUDA_BLOCK_SIZE);
+	}
+
+	/*
+	 * Computes the value of every row with one warp per row. Since the block size is a multiple of the warp size, all threads of a warp
+	 * work on the same row and leave the kernel together.
+	 */
+	__global__ void multiplyRowsKernel(size_t const rowCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values, double const* x, double const* b, double* result) {
+		size_t const thread = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+		size_t const row = thread / STORM_CUDA_WARP_SIZE;
+		unsigned int const lane = threadIdx.x % STORM_CUDA_WARP_SIZE;
+		if (row >= rowCount) {
+			return;
+		}
+
+		double sum = 0.0;
+		uint64_t const rowEnd = rowIndications[row + 1];
+		for (uint64_t entry = rowIndications[row] + lane; entry < rowEnd; entry += STORM_CUDA_WARP_SIZE) {
+			sum += values[entry] * x[columns[entry]];
+		}
+		for (unsigned int offset = STORM_CUDA_WARP_SIZE / 2; offset > 0; offset /= 2) {
+			sum += __shfl_down_sync(0xffffffffu, sum, offset);
+		}
+		if (lane == 0) {
+			result[row] = (b != nullptr ? b[row] : 0.0) + sum;
+		}
+	}
+
+	/*
+	 * Reduces every (non-empty) row group to its best row with one thread per row group. Empty row groups leave the result untouched.
+	 */
+	template<bool Minimize>
+	__global__ void reduceRowGroupsKernel(size_t const rowGroupCount, uint64_t const* rowGroupIndices, double const* rowValues, double* result, uint64_t* choices) {
+		size_t const group = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+		if (group >= rowGroupCount) {
+			return;
+		}
+
+		uint64_t const groupStart = rowGroupIndices[group];
+		uint64_t const groupEnd = rowGroupIndices[group + 1];
+		if (groupStart == groupEnd) {
+			return;
+		}
+
+		uint64_t bestRow = groupStart;
+		for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+			if (Minimize ? rowValues[row] < rowValues[bestRow] : rowValues[row] > rowValues[bestRow]) {
+				bestRow = row;
+			}
+		}
+		if (choices != nullptr) {
+			uint64_t const currentRow = groupStart + choices[group];
+			if (Minimize ? rowValues[bestRow] < rowValues[currentRow] : rowValues[bestRow] > rowValues[currentRow]) {
+				choices[group] = bestRow - groupStart;
+			}
+		}
+		result[group] = rowValues[bestRow];
+	}
+
+	/*
+	 * Sets the flag if the given vectors differ by more than the precision at some position.
+	 */
+	template<bool Relative>
+	__global__ void checkConvergenceKernel(size_t const count, double const* oldValues, double const* newValues, double const precision, int* notConverged) {
+		size_t const index = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+		if (index >= count) {
+			return;
+		}
+
+		double difference = fabs(newValues[index] - oldValues[index]);
+		if (Relative && oldValues[index] != 0.0) {
+			difference /= fabs(oldValues[index]);
+		}
+		if (difference > precision) {
+			*notConverged = 1;
+		}
+	}
+
+	bool launchMultiplyRows(DeviceSparseMatrix const& matrix, double const* x, double const* b, double* result) {
+		if (matrix.rowCount == 0) {
+			return true;
+		}
+		multiplyRowsKernel<<<getBlockCount(matrix.rowCount * STORM_CUDA_WARP_SIZE), STORM_CUDA_BLOCK_SIZE>>>(matrix.rowCount, matrix.rowIndications, matrix.columns, matrix.values, x, b, result);
+		STORM_CUDA_CHECK(cudaGetLastError());
+		return true;
+	}
+
+	bool launchReduceRowGroups(DeviceSparseMatrix const& matrix, bool const minimize, double* result, uint64_t* choices) {
+		if (matrix.rowGroupCount == 0) {
+			return true;
+		}
+		if (minimize) {
+			reduceRowGroupsKernel<true><<<getBlockCount(matrix.rowGroupCount), STORM_CUDA_BLOCK_SIZE>>>(matrix.rowGroupCount, matrix.rowGroupIndices, matrix.rowValues, result, choices);
+		} else {
+			reduceRowGroupsKernel<false><<<getBlockCount(matrix.rowGroupCount), STORM_CUDA_BLOCK_SIZE>>>(matrix.rowGroupCount, matrix.rowGroupIndices, matrix.rowValues, result, choices);
+		}
+		STORM_CUDA_CHECK(cudaGetLastError());
+		return true;
+	}
+
+	template<typename T>
+	bool allocateAndUpload(T*& target, T const* source, size_t const count) {
+		STORM_CUDA_CHECK(cudaMalloc(reinterpret_cast<void**>(&target), sizeof(T) * (count > 0 ? count : 1)));
+		if (source != nullptr && count > 0) {
+			STORM_CUDA_CHECK(cudaMemcpy(target, source, sizeof(T) * count, cudaMemcpyHostToDevice));
+		}
+		return true;
+	}
+}
+
+size_t deviceValueIteration_calculateMemorySize(size_t const rowCount, size_t const rowGroupCount, size_t const nnzCount) {
+	size_t const sizeOfMatrix = sizeof(uint64_t) * (rowCount + 1) + (sizeof(uint32_t) + sizeof(double)) * nnzCount + sizeof(uint64_t) * (rowGroupCount + 1);
+	size_t const sizeOfVectors = sizeof(double) * 2 * rowGroupCount + sizeof(double) * 2 * rowCount + sizeof(uint64_t) * rowGroupCount + sizeof(int);
+	return sizeOfMatrix + sizeOfVectors;
+}
+
+DeviceSparseMatrix* deviceValueIteration_createMatrix(size_t const rowCount, size_t const columnCount, size_t const rowGroupCount, size_t const nnzCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values, uint64_t const* rowGroupIndices) {
+	DeviceSparseMatrix* matrix = new DeviceSparseMatrix{rowCount, columnCount, rowGroupCount, nnzCount, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+	size_t const vectorSize = columnCount > rowGroupCount ? columnCount : rowGroupCount;
+	bool const success = allocateAndUpload(matrix->rowIndications, rowIndications, rowCount + 1) && allocateAndUpload(matrix->columns, columns, nnzCount) &&
+		allocateAndUpload(matrix->values, values, nnzCount) && allocateAndUpload(matrix->rowGroupIndices, rowGroupIndices, rowGroupCount + 1) &&
+		allocateAndUpload<double>(matrix->x, nullptr, vectorSize) && allocateAndUpload<double>(matrix->xSwap, nullptr, vectorSize) &&
+		allocateAndUpload<double>(matrix->b, nullptr, rowCount) && allocateAndUpload<double>(matrix->rowValues, nullptr, rowCount) &&
+		allocateAndUpload<uint64_t>(matrix->choices, nullptr, rowGroupCount) && allocateAndUpload<int>(matrix->notConverged, nullptr, 1);
+	if (!success) {
+		deviceValueIteration_destroyMatrix(matrix);
+		return nullptr;
+	}
+	return matrix;
+}
+
+void deviceValueIteration_destroyMatrix(DeviceSparseMatrix* matrix) {
+	if (matrix == nullptr) {
+		return;
+	}
+	// Freeing a null pointer is a no-op, so partially created matrices are handled as well.
+	cudaFree(matrix->rowIndications);
+	cudaFree(matrix->columns);
+	cudaFree(matrix->values);
+	cudaFree(matrix->rowGroupIndices);
+	cudaFree(matrix->x);
+	cudaFree(matrix->xSwap);
+	cudaFree(matrix->b);
+	cudaFree(matrix->rowValues);
+	cudaFree(matrix->choices);
+	cudaFree(matrix->notConverged);
+	delete matrix;
+}
+
+bool deviceValueIteration_multiply(DeviceSparseMatrix* matrix, double const* x, double const* b, double* result) {
+	STORM_CUDA_CHECK(cudaMemcpy(matrix->x, x, sizeof(double) * matrix->columnCount, cudaMemcpyHostToDevice));
+	if (b != nullptr) {
+		STORM_CUDA_CHECK(cudaMemcpy(matrix->b, b, sizeof(double) * matrix->rowCount, cudaMemcpyHostToDevice));
+	}
+	if (!launchMultiplyRows(*matrix, matrix->x, b != nullptr ? matrix->b : nullptr, matrix->rowValues)) {
+		return false;
+	}
+	STORM_CUDA_CHECK(cudaMemcpy(result, matrix->rowValues, sizeof(double) * matrix->rowCount, cudaMemcpyDeviceToHost));
+	return true;
+}
+
+bool deviceValueIteration_multiplyAndReduce(DeviceSparseMatrix* matrix, bool const minimize, double const* x, double const* b, double* result, uint64_t* choices) {
+	STORM_CUDA_CHECK(cudaMemcpy(matrix->x, x, sizeof(double) * matrix->columnCount, cudaMemcpyHostToDevice));
+	if (b != nullptr) {
+		STORM_CUDA_CHECK(cudaMemcpy(matrix->b, b, sizeof(double) * matrix->rowCount, cudaMemcpyHostToDevice));
+	}
+	// Empty row groups keep their previous result.
+	STORM_CUDA_CHECK(cudaMemcpy(matrix->xSwap, result, sizeof(double) * matrix->rowGroupCount, cudaMemcpyHostToDevice));
+	if (choices != nullptr) {
+		STORM_CUDA_CHECK(cudaMemcpy(matrix->choices, choices, sizeof(uint64_t) * matrix->rowGroupCount, cudaMemcpyHostToDevice));
+	}
+	if (!launchMultiplyRows(*matrix, matrix->x, b != nullptr ? matrix->b : nullptr, matrix->rowValues) ||
+		!launchReduceRowGroups(*matrix, minimize, matrix->xSwap, choices != nullptr ? matrix->choices : nullptr)) {
+		return false;
+	}
+	STORM_CUDA_CHECK(cudaMemcpy(result, matrix->xSwap, sizeof(double) * matrix->rowGroupCount, cudaMemcpyDeviceToHost));
+	if (choices != nullptr) {
+		STORM_CUDA_CHECK(cudaMemcpy(choices, matrix->choices, sizeof(uint64_t) * matrix->rowGroupCount, cudaMemcpyDeviceToHost));
+	}
+	return true;
+}
+
+bool deviceValueIteration_solve(DeviceSparseMatrix* matrix, bool const minimize, size_t const maxIterationCount, double const precision, bool const relativePrecisionCheck, double* x, double const* b, size_t& iterationCount, bool& converged) {
+	iterationCount = 0;
+	converged = false;
+	if (matrix->columnCount != matrix->rowGroupCount) {
+		std::cerr << "(DLL) Value iteration requires a matrix whose number of columns matches the number of row groups." << std::endl;
+		return false;
+	}
+
+	STORM_CUDA_CHECK(cudaMemcpy(matrix->x, x, sizeof(double) * matrix->rowGroupCount, cudaMemcpyHostToDevice));
+	// Empty row groups are never written, so both buffers need to hold their initial value.
+	STORM_CUDA_CHECK(cudaMemcpy(matrix->xSwap, matrix->x, sizeof(double) * matrix->rowGroupCount, cudaMemcpyDeviceToDevice));
+	STORM_CUDA_CHECK(cudaMemcpy(matrix->b, b, sizeof(double) * matrix->rowCount, cudaMemcpyHostToDevice));
+
+	double* currentX = matrix->x;
+	double* newX = matrix->xSwap;
+	while (!converged && iterationCount < maxIterationCount) {
+		if (!launchMultiplyRows(*matrix, currentX, matrix->b, matrix->rowValues) || !launchReduceRowGroups(*matrix, minimize, newX, nullptr)) {
+			return false;
+		}
+
+		int notConverged = 0;
+		STORM_CUDA_CHECK(cudaMemset(matrix->notConverged, 0, sizeof(int)));
+		if (matrix->rowGroupCount > 0) {
+			if (relativePrecisionCheck) {
+				checkConvergenceKernel<true><<<getBlockCount(matrix->rowGroupCount), STORM_CUDA_BLOCK_SIZE>>>(matrix->rowGroupCount, currentX, newX, precision, matrix->notConverged);
+			} else {
+				checkConvergenceKernel<false><<<getBlockCount(matrix->rowGroupCount), STORM_CUDA_BLOCK_SIZE>>>(matrix->rowGroupCount, currentX, newX, precision, matrix->notConverged);
+			}
+			STORM_CUDA_CHECK(cudaGetLastError());
+		}
+		STORM_CUDA_CHECK(cudaMemcpy(&notConverged, matrix->notConverged, sizeof(int), cudaMemcpyDeviceToHost));
+
+		std::swap(currentX, newX);
+		++iterationCount;
+		converged = (notConverged == 0);
+	}
+
+	STORM_CUDA_CHECK(cudaMemcpy(x, currentX, sizeof(double) * matrix->rowGroupCount, cudaMemcpyDeviceToHost));
+	return true;
+}
@@ -0,0 +1,74 @@
+#ifndef STORM_CUDAFORSTORM_DEVICEVALUEITERATION_H_
+#define STORM_CUDAFORSTORM_DEVICEVALUEITERATION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+// Library exports
+#include "cudaForStorm.h"
+
+/*
+ * A sparse matrix with row groups that resides in device memory. The entries are stored as two separate arrays of
+ * 32-bit column indices and values (i.e., in the structure-of-arrays layout), which is what the kernels expect for
+ * coalesced loads. The matrix is uploaded once and can then be multiplied with arbitrary vectors.
+ */
+struct DeviceSparseMatrix;
+
+/*!
+ * Retrieves the number of bytes of device memory needed to hold a matrix with the given dimensions together with all
+ * vectors needed to perform value iteration on it.
+ */
+size_t deviceValueIteration_calculateMemorySize(size_t const rowCount, size_t const rowGroupCount, size_t const nnzCount);
+
+/*!
+ * Uploads the given matrix to the device. The arrays are only read during the call.
+ *
+ * @param rowIndications The (rowCount + 1) indices of the first entry of each row.
+ * @param columns The column of each entry.
+ * @param values The value of each entry.
+ * @param rowGroupIndices The (rowGroupCount + 1) indices of the first row of each row group.
+ * @return The matrix or nullptr if it could not be created (e.g., because there is not enough device memory).
+ */
+DeviceSparseMatrix* deviceValueIteration_createMatrix(size_t const rowCount, size_t const columnCount, size_t const rowGroupCount, size_t const nnzCount, uint64_t const* rowIndications, uint32_t const* columns, double const* values, uint64_t const* rowGroupIndices);
+
+/*!
+ * Frees all device memory occupied by the given matrix.
+ */
+void deviceValueIteration_destroyMatrix(DeviceSparseMatrix* matrix);
+
+/*!
+ * Computes result = A * x + b.
+ *
+ * @param x The columnCount values to multiply with.
+ * @param b The rowCount summands or nullptr.
+ * @param result The rowCount result values. May not alias x.
+ * @return True iff no error occurred.
+ */
+bool deviceValueIteration_multiply(DeviceSparseMatrix* matrix, double const* x, double const* b, double* result);
+
+/*!
+ * Computes A * x + b and reduces every row group to its minimum or maximum.
+ *
+ * @param x The columnCount values to multiply with.
+ * @param b The rowCount summands or nullptr.
+ * @param result The rowGroupCount result values. May alias x.
+ * @param choices If not nullptr, the (local) choice of each row group. A choice is only replaced if another choice
+ * yields a strictly better value. Among equally good choices, the first one is taken.
+ * @return True iff no error occurred.
+ */
+bool deviceValueIteration_multiplyAndReduce(DeviceSparseMatrix* matrix, bool const minimize, double const* x, double const* b, double* result, uint64_t* choices);
+
+/*!
+ * Performs value iteration (x' = min/max(A * x + b)) until two consecutive iterates are equal modulo the precision
+ * or the maximal number of iterations is reached. All iterates stay on the device. Requires that the number of
+ * columns and row groups coincide.
+ *
+ * @param x The initial values. Will contain the final values when the function returns.
+ * @param b The rowCount summands.
+ * @param iterationCount Will contain the number of performed iterations.
+ * @param converged Will contain whether the iteration converged.
+ * @return True iff no error occurred.
+ */
+bool deviceValueIteration_solve(DeviceSparseMatrix* matrix, bool const minimize, size_t const maxIterationCount, double const precision, bool const relativePrecisionCheck, double* x, double const* b, size_t& iterationCount, bool& converged);
+
+#endif // STORM_CUDAFORSTORM_DEVICEVALUEITERATION_H_
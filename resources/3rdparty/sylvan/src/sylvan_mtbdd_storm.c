@@ -1,6 +1,7 @@
 #include <stdint.h>
 #include <math.h>
 #include "sylvan_int.h"
+#include "sylvan_refs.h"
 
 #include "storm_wrapper.h"
 
@@ -8,6 +9,9 @@
 extern uint32_t srn_type;
 extern uint32_t srf_type;
 
+// The table of protected MTBDDs, implemented in sylvan_mtbdd.c.
+extern refs_table_t mtbdd_protected;
+
 // Forward declare gcd here,
 // as we don't want to mess with sylvans internal api too much
 // Implemented in sylvan_mtbdd.c
@@ -1106,3 +1110,51 @@ TASK_IMPL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, dd, mtbdd_uapply_op, op, size_t,
     // Caching would be done here, but is omitted (as this is the purpose of this function).
     return result;
 }
+
+VOID_TASK_2(mtbdd_compose_in_place, MTBDD*, dd, MTBDDMAP, map)
+{
+    *dd = CALL(mtbdd_compose, *dd, map);
+}
+
+VOID_TASK_IMPL_3(mtbdd_permute_protected, const uint32_t*, from, const uint32_t*, to, size_t, count)
+{
+    /* Create the map, which must not be permuted itself */
+    MTBDDMAP map = mtbdd_map_empty();
+    mtbdd_protect(&map);
+    for (size_t i = 0; i < count; i++) {
+        MTBDD var = mtbdd_refs_push(mtbdd_ithvar(to[i]));
+        map = mtbdd_map_add(map, from[i], var);
+        mtbdd_refs_pop(1);
+    }
+
+    /* Compose all other protected MTBDDs with the map */
+    size_t spawned = 0;
+    uint64_t *it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL) {
+        MTBDD *dd = (MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+        if (dd != &map) {
+            SPAWN(mtbdd_compose_in_place, dd, map);
+            spawned++;
+        }
+    }
+    while (spawned--) {
+        SYNC(mtbdd_compose_in_place);
+    }
+
+    mtbdd_unprotect(&map);
+}
+
+size_t
+mtbdd_protected_nodecount(void)
+{
+    size_t count = protect_count(&mtbdd_protected);
+    MTBDD *dds = (MTBDD*)malloc(sizeof(MTBDD) * (count + 1));
+    size_t found = 0;
+    uint64_t *it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL && found < count) {
+        dds[found++] = *(MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+    }
+    size_t result = mtbdd_nodecount_more(dds, found);
+    free(dds);
+    return result;
+}
@@ -182,6 +182,20 @@ TASK_DECL_3(BDD, mtbdd_max_abstract_representative, MTBDD, MTBDD, uint32_t);
 TASK_DECL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, mtbdd_uapply_op, size_t);
 #define mtbdd_uapply_nocache(dd, op, param) (RUN(mtbdd_uapply_nocache, dd, op, param))
 
+/**
+ * Replaces every protected MTBDD (see mtbdd_protect) by the MTBDD in which each variable <from>[i] is replaced by the variable <to>[i].
+ * As the variable index of a node is also its level, this changes the variable order of all protected MTBDDs at once. The MTBDDs are
+ * composed in parallel. Must not be called while other operations are running or when protected MTBDDs hold a map or a variable set that
+ * must not be changed.
+ */
+VOID_TASK_DECL_3(mtbdd_permute_protected, const uint32_t*, const uint32_t*, size_t);
+#define mtbdd_permute_protected(from, to, count) (RUN(mtbdd_permute_protected, from, to, count))
+
+/**
+ * Counts the number of nodes of all protected MTBDDs, where nodes that are shared between MTBDDs are counted once.
+ */
+size_t mtbdd_protected_nodecount(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,284 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/initialize.h"
+
+namespace storm {
+namespace bench {
+
+/*!
+ * The input of a benchmark: a row-grouped transition matrix together with a set of target states.
+ */
+struct Input {
+    storm::storage::SparseMatrix<double> transitionMatrix;
+    storm::storage::SparseMatrix<double> backwardTransitions;
+    storm::storage::BitVector targetStates;
+};
+
+/*!
+ * Creates a random (but reproducible) MDP-like matrix with the given number of states in which each state has the given number of choices with the
+ * given number of successors each. Successors are mostly local to mimic the locality of matrices produced by the explicit model builder.
+ */
+Input createSyntheticInput(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice) {
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates * choicesPerState, numberOfStates, numberOfStates * choicesPerState * successorsPerChoice,
+                                                        false, true, numberOfStates);
+    uint64_t seed = 42;
+    auto next = [&seed]() {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        return seed >> 33;
+    };
+    uint64_t row = 0;
+    double const probability = 1.0 / successorsPerChoice;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < choicesPerState; ++choice, ++row) {
+            std::vector<uint64_t> successors;
+            for (uint64_t i = 0; i < successorsPerChoice; ++i) {
+                // One in eight successors is a long-distance jump, all others stay close to the current state.
+                uint64_t successor = (next() % 8 == 0) ? next() % numberOfStates : (state + next() % 64) % numberOfStates;
+                successors.push_back(successor);
+            }
+            std::sort(successors.begin(), successors.end());
+            for (auto successor : successors) {
+                builder.addNextValue(row, successor, probability);
+            }
+        }
+    }
+
+    Input result;
+    result.transitionMatrix = builder.build();
+    result.backwardTransitions = result.transitionMatrix.transpose(true);
+    result.targetStates = storm::storage::BitVector(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; state += 1000) {
+        result.targetStates.set(state);
+    }
+    return result;
+}
+
+/*!
+ * Builds the given instance of the given QVBS model. The states labelled with the given label are used as target states.
+ */
+Input createQvbsInput(std::string const& modelName, uint64_t instanceIndex, std::string const& targetLabel) {
+    storm::storage::QvbsBenchmark benchmark(modelName);
+    auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(instanceIndex));
+    storm::storage::SymbolicModelDescription description(janiInput.first);
+    description = description.preprocess(description.parseConstantDefinitions(benchmark.getConstantDefinition(instanceIndex)));
+    storm::builder::BuilderOptions options;
+    options.setBuildAllLabels();
+    auto model = storm::api::buildSparseModel<double>(description, options);
+
+    Input result;
+    result.transitionMatrix = model->getTransitionMatrix();
+    result.backwardTransitions = model->getBackwardTransitions();
+    if (model->hasLabel(targetLabel)) {
+        result.targetStates = model->getStates(targetLabel);
+    } else {
+        std::cerr << "Model has no label '" << targetLabel << "', using the initial states as target states.\n";
+        result.targetStates = model->getInitialStates();
+    }
+    return result;
+}
+
+std::vector<double> createVector(uint64_t size) {
+    std::vector<double> result(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        result[i] = static_cast<double>(i % 97) / 97.0;
+    }
+    return result;
+}
+
+void benchMultiplyWithVector(benchmark::State& state, Input const& input) {
+    auto const& matrix = input.transitionMatrix;
+    std::vector<double> x = createVector(matrix.getColumnCount());
+    std::vector<double> result(matrix.getRowCount());
+    for (auto _ : state) {
+        matrix.multiplyWithVector(x, result);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+
+void benchMultiplyAndReduce(benchmark::State& state, Input const& input) {
+    auto const& matrix = input.transitionMatrix;
+    std::vector<double> x = createVector(matrix.getColumnCount());
+    std::vector<double> b(matrix.getRowCount(), 0.5);
+    std::vector<double> result(matrix.getRowGroupCount());
+    for (auto _ : state) {
+        matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, result, nullptr);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+
+void benchSccDecomposition(benchmark::State& state, Input const& input) {
+    for (auto _ : state) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(input.transitionMatrix);
+        benchmark::DoNotOptimize(decomposition.size());
+    }
+    state.SetItemsProcessed(state.iterations() * input.transitionMatrix.getRowGroupCount());
+}
+
+void benchMecDecomposition(benchmark::State& state, Input const& input) {
+    for (auto _ : state) {
+        storm::storage::MaximalEndComponentDecomposition<double> decomposition(input.transitionMatrix, input.backwardTransitions);
+        benchmark::DoNotOptimize(decomposition.size());
+    }
+    state.SetItemsProcessed(state.iterations() * input.transitionMatrix.getRowGroupCount());
+}
+
+void benchProb01Max(benchmark::State& state, Input const& input) {
+    storm::storage::BitVector phiStates(input.transitionMatrix.getRowGroupCount(), true);
+    for (auto _ : state) {
+        auto result = storm::utility::graph::performProb01Max(input.transitionMatrix, input.transitionMatrix.getRowGroupIndices(), input.backwardTransitions,
+                                                              phiStates, input.targetStates);
+        benchmark::DoNotOptimize(result.first.getNumberOfSetBits());
+    }
+    state.SetItemsProcessed(state.iterations() * input.transitionMatrix.getRowGroupCount());
+}
+
+storm::storage::BitVector createBitVector(uint64_t size, uint64_t stride) {
+    storm::storage::BitVector result(size);
+    for (uint64_t i = 0; i < size; i += stride) {
+        result.set(i);
+    }
+    return result;
+}
+
+void benchBitVectorOperations(benchmark::State& state) {
+    uint64_t size = state.range(0);
+    storm::storage::BitVector first = createBitVector(size, 3);
+    storm::storage::BitVector second = createBitVector(size, 5);
+    for (auto _ : state) {
+        storm::storage::BitVector result = first & second;
+        result |= ~first;
+        benchmark::DoNotOptimize(result.getNumberOfSetBits());
+    }
+    state.SetBytesProcessed(state.iterations() * 3 * size / 8);
+}
+
+void benchBitVectorIteration(benchmark::State& state) {
+    storm::storage::BitVector vector = createBitVector(state.range(0), 7);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (auto index : vector) {
+            sum += index;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * vector.getNumberOfSetBits());
+}
+
+void benchBitVectorHashMapFindOrAdd(benchmark::State& state) {
+    uint64_t const numberOfKeys = state.range(0);
+    uint64_t const bitsPerKey = 96;
+    std::vector<storm::storage::BitVector> keys;
+    keys.reserve(numberOfKeys);
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        storm::storage::BitVector key(bitsPerKey);
+        key.setFromInt(0, 64, i * 0x9E3779B97F4A7C15ull);
+        key.setFromInt(64, 32, i & 0xFFFFFFFFull);
+        keys.push_back(std::move(key));
+    }
+    for (auto _ : state) {
+        storm::storage::BitVectorHashMap<uint64_t> map(bitsPerKey, 1000);
+        // Every key is looked up twice, so both the insertion and the lookup path are exercised.
+        for (uint64_t i = 0; i < numberOfKeys; ++i) {
+            benchmark::DoNotOptimize(map.findOrAdd(keys[i], i));
+            benchmark::DoNotOptimize(map.findOrAdd(keys[i / 2], i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * numberOfKeys);
+}
+
+void registerInputBenchmarks(std::string const& inputName, std::shared_ptr<Input const> input) {
+    auto registerBenchmark = [&inputName, &input](std::string const& name, void (*function)(benchmark::State&, Input const&)) {
+        benchmark::RegisterBenchmark((name + "/" + inputName).c_str(), [input, function](benchmark::State& state) { function(state, *input); })
+            ->Unit(benchmark::kMillisecond);
+    };
+    registerBenchmark("SparseMatrix_multiplyWithVector", benchMultiplyWithVector);
+    registerBenchmark("SparseMatrix_multiplyAndReduce", benchMultiplyAndReduce);
+    registerBenchmark("SccDecomposition", benchSccDecomposition);
+    registerBenchmark("MecDecomposition", benchMecDecomposition);
+    registerBenchmark("performProb01Max", benchProb01Max);
+}
+
+void registerBenchmarks(std::vector<std::string> const& qvbsInputs, std::string const& targetLabel) {
+    benchmark::RegisterBenchmark("BitVector_operations", benchBitVectorOperations)->Range(1 << 12, 1 << 24);
+    benchmark::RegisterBenchmark("BitVector_iteration", benchBitVectorIteration)->Range(1 << 12, 1 << 24);
+    benchmark::RegisterBenchmark("BitVectorHashMap_findOrAdd", benchBitVectorHashMapFindOrAdd)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+
+    registerInputBenchmarks("synthetic_100k", std::make_shared<Input const>(createSyntheticInput(100000, 2, 4)));
+    registerInputBenchmarks("synthetic_1M", std::make_shared<Input const>(createSyntheticInput(1000000, 3, 3)));
+
+    for (auto const& qvbsInput : qvbsInputs) {
+        // Inputs are given as <model name>[:<instance index>].
+        auto separator = qvbsInput.find(':');
+        std::string modelName = qvbsInput.substr(0, separator);
+        uint64_t instanceIndex = separator == std::string::npos ? 0 : std::stoull(qvbsInput.substr(separator + 1));
+        registerInputBenchmarks("qvbs_" + modelName + "_" + std::to_string(instanceIndex),
+                                std::make_shared<Input const>(createQvbsInput(modelName, instanceIndex, targetLabel)));
+    }
+}
+
+}  // namespace bench
+}  // namespace storm
+
+/*!
+ * Runs the microbenchmarks. Besides the flags of google benchmark (e.g. --benchmark_filter), the following arguments are supported:
+ *   --qvbs <model>[:<instance>]  additionally runs the matrix and graph benchmarks on the given QVBS instance (may be given multiple times)
+ *   --target <label>             the label of the target states for QVBS inputs (default: 'goal')
+ */
+int main(int argc, char** argv) {
+    storm::utility::setUp();
+    storm::settings::initializeAll("Storm-bench", "storm-bench");
+    storm::utility::setLogLevel(l3pp::LogLevel::ERR);
+
+    benchmark::Initialize(&argc, argv);
+    std::vector<std::string> qvbsInputs;
+    std::string targetLabel = "goal";
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--qvbs" && i + 1 < argc) {
+            qvbsInputs.emplace_back(argv[++i]);
+        } else if (argument == "--target" && i + 1 < argc) {
+            targetLabel = argv[++i];
+        } else {
+            std::cerr << "Unknown argument '" << argument << "'.\n";
+            return 1;
+        }
+    }
+#ifndef STORM_HAVE_QVBS
+    if (!qvbsInputs.empty()) {
+        std::cerr << "Storm was configured without QVBS (see STORM_LOAD_QVBS and STORM_QVBS_ROOT), QVBS inputs are not available.\n";
+        return 1;
+    }
+#endif
+
+    storm::bench::registerBenchmarks(qvbsInputs, targetLabel);
+    benchmark::RunSpecifiedBenchmarks();
+    storm::utility::cleanUp();
+    return 0;
+}
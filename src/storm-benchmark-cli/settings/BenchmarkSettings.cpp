@@ -0,0 +1,21 @@
+#include "storm-benchmark-cli/settings/BenchmarkSettings.h"
+
+#include "storm-benchmark-cli/settings/modules/BenchmarkRunnerSettings.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/IOSettings.h"
+
+namespace storm {
+namespace settings {
+
+void initializeBenchmarkSettings(std::string const& name, std::string const& executableName) {
+    storm::settings::mutableManager().setName(name, executableName);
+
+    // Register relevant settings modules.
+    storm::settings::addModule<storm::settings::modules::GeneralSettings>();
+    storm::settings::addModule<storm::settings::modules::IOSettings>();
+    storm::settings::addModule<storm::settings::modules::BenchmarkRunnerSettings>();
+}
+
+}  // namespace settings
+}  // namespace storm
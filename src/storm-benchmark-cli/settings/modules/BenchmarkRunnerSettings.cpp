@@ -0,0 +1,159 @@
+#include "storm-benchmark-cli/settings/modules/BenchmarkRunnerSettings.h"
+
+#include "storm/parser/CSVParser.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string BenchmarkRunnerSettings::moduleName = "benchmark";
+const std::string BenchmarkRunnerSettings::suiteOptionName = "suite";
+const std::string BenchmarkRunnerSettings::benchmarksOptionName = "benchmarks";
+const std::string BenchmarkRunnerSettings::enginesOptionName = "engines";
+const std::string BenchmarkRunnerSettings::methodsOptionName = "methods";
+const std::string BenchmarkRunnerSettings::repetitionsOptionName = "repetitions";
+const std::string BenchmarkRunnerSettings::timeoutOptionName = "timeout";
+const std::string BenchmarkRunnerSettings::stormBinaryOptionName = "storm";
+const std::string BenchmarkRunnerSettings::outputOptionName = "output";
+const std::string BenchmarkRunnerSettings::baselineOptionName = "baseline";
+const std::string BenchmarkRunnerSettings::thresholdOptionName = "threshold";
+
+BenchmarkRunnerSettings::BenchmarkRunnerSettings() : ModuleSettings(moduleName) {
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, suiteOptionName, false,
+                                       "Loads the benchmarks and configurations (and optionally the repetitions and the timeout) from a JSON file.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the suite file.")
+                             .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                             .build())
+            .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, benchmarksOptionName, false, "Selects benchmarks from the Quantitative Verification Benchmark Set.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "benchmarks", "The comma separated list of benchmarks model[:instance-index]. Omit the index to run all instances.")
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, enginesOptionName, false, "Runs each benchmark with each of the given engines.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("engines", "The comma separated list of engines.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, methodsOptionName, false, "Runs each benchmark with each of the given min-max methods.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("methods", "The comma separated list of min-max methods.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, repetitionsOptionName, false, "Sets how often each run is repeated.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of repetitions.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "Sets the timeout of each run.")
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "Seconds after which a run is aborted (0 for none).")
+                             .setDefaultValueUnsignedInteger(0)
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, stormBinaryOptionName, false,
+                                                   "Sets the storm binary that performs the runs. Defaults to the one next to this binary.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The path of the storm binary.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, outputOptionName, false, "Sets the JSON file to which the results are written.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the result file.")
+                                         .setDefaultValueString("benchmark-results.json")
+                                         .addValidatorString(ArgumentValidatorFactory::createWritableFileValidator())
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, baselineOptionName, false,
+                                                   "Compares the results with the given results of an earlier run and reports regressions.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file with the baseline results.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, thresholdOptionName, false,
+                                                   "Sets the factor by which the time or memory may exceed the baseline before it is reported as a regression.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("factor", "The factor.")
+                                         .setDefaultValueDouble(1.2)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(1.0))
+                                         .build())
+                        .build());
+}
+
+bool BenchmarkRunnerSettings::isSuiteSet() const {
+    return this->getOption(suiteOptionName).getHasOptionBeenSet();
+}
+
+std::string BenchmarkRunnerSettings::getSuiteFilename() const {
+    return this->getOption(suiteOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool BenchmarkRunnerSettings::isBenchmarksSet() const {
+    return this->getOption(benchmarksOptionName).getHasOptionBeenSet();
+}
+
+std::vector<std::string> BenchmarkRunnerSettings::getBenchmarks() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(benchmarksOptionName).getArgumentByName("benchmarks").getValueAsString());
+}
+
+bool BenchmarkRunnerSettings::isEnginesSet() const {
+    return this->getOption(enginesOptionName).getHasOptionBeenSet();
+}
+
+std::vector<std::string> BenchmarkRunnerSettings::getEngines() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(enginesOptionName).getArgumentByName("engines").getValueAsString());
+}
+
+bool BenchmarkRunnerSettings::isMethodsSet() const {
+    return this->getOption(methodsOptionName).getHasOptionBeenSet();
+}
+
+std::vector<std::string> BenchmarkRunnerSettings::getMethods() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(methodsOptionName).getArgumentByName("methods").getValueAsString());
+}
+
+bool BenchmarkRunnerSettings::isRepetitionsSet() const {
+    return this->getOption(repetitionsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BenchmarkRunnerSettings::getRepetitions() const {
+    return this->getOption(repetitionsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BenchmarkRunnerSettings::isTimeoutSet() const {
+    return this->getOption(timeoutOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BenchmarkRunnerSettings::getTimeout() const {
+    return this->getOption(timeoutOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
+}
+
+bool BenchmarkRunnerSettings::isStormBinarySet() const {
+    return this->getOption(stormBinaryOptionName).getHasOptionBeenSet();
+}
+
+std::string BenchmarkRunnerSettings::getStormBinary() const {
+    return this->getOption(stormBinaryOptionName).getArgumentByName("path").getValueAsString();
+}
+
+std::string BenchmarkRunnerSettings::getOutputFilename() const {
+    return this->getOption(outputOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool BenchmarkRunnerSettings::isBaselineSet() const {
+    return this->getOption(baselineOptionName).getHasOptionBeenSet();
+}
+
+std::string BenchmarkRunnerSettings::getBaselineFilename() const {
+    return this->getOption(baselineOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+double BenchmarkRunnerSettings::getRegressionThreshold() const {
+    return this->getOption(thresholdOptionName).getArgumentByName("factor").getValueAsDouble();
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
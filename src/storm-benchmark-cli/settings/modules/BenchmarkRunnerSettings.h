@@ -0,0 +1,128 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * The settings of the benchmark runner, i.e., which benchmarks are run with which configurations and where the results are written to.
+ */
+class BenchmarkRunnerSettings : public ModuleSettings {
+   public:
+    BenchmarkRunnerSettings();
+
+    /*!
+     * Retrieves whether a suite file was given.
+     */
+    bool isSuiteSet() const;
+
+    /*!
+     * Retrieves the name of the JSON file that describes the benchmarks and configurations of the suite.
+     */
+    std::string getSuiteFilename() const;
+
+    /*!
+     * Retrieves whether benchmarks were given on the command line.
+     */
+    bool isBenchmarksSet() const;
+
+    /*!
+     * Retrieves the benchmarks given on the command line. Each benchmark is of the form model[:instance-index].
+     */
+    std::vector<std::string> getBenchmarks() const;
+
+    /*!
+     * Retrieves whether engines were given on the command line.
+     */
+    bool isEnginesSet() const;
+
+    /*!
+     * Retrieves the engines with which each benchmark is run.
+     */
+    std::vector<std::string> getEngines() const;
+
+    /*!
+     * Retrieves whether min-max methods were given on the command line.
+     */
+    bool isMethodsSet() const;
+
+    /*!
+     * Retrieves the min-max methods with which each benchmark is run.
+     */
+    std::vector<std::string> getMethods() const;
+
+    /*!
+     * Retrieves whether the number of repetitions was set explicitly.
+     */
+    bool isRepetitionsSet() const;
+
+    /*!
+     * Retrieves how often each run is repeated.
+     */
+    uint64_t getRepetitions() const;
+
+    /*!
+     * Retrieves whether the timeout was set explicitly.
+     */
+    bool isTimeoutSet() const;
+
+    /*!
+     * Retrieves the timeout (in seconds) of each run, where zero means that there is no timeout.
+     */
+    uint64_t getTimeout() const;
+
+    /*!
+     * Retrieves whether the storm binary was given explicitly.
+     */
+    bool isStormBinarySet() const;
+
+    /*!
+     * Retrieves the path of the storm binary that performs the runs.
+     */
+    std::string getStormBinary() const;
+
+    /*!
+     * Retrieves the name of the file to which the results are written.
+     */
+    std::string getOutputFilename() const;
+
+    /*!
+     * Retrieves whether a baseline was given.
+     */
+    bool isBaselineSet() const;
+
+    /*!
+     * Retrieves the name of the file containing the results with which the results of this suite are compared.
+     */
+    std::string getBaselineFilename() const;
+
+    /*!
+     * Retrieves the factor by which the time or the memory of a run may exceed the baseline before it is reported as a regression.
+     */
+    double getRegressionThreshold() const;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string suiteOptionName;
+    static const std::string benchmarksOptionName;
+    static const std::string enginesOptionName;
+    static const std::string methodsOptionName;
+    static const std::string repetitionsOptionName;
+    static const std::string timeoutOptionName;
+    static const std::string stormBinaryOptionName;
+    static const std::string outputOptionName;
+    static const std::string baselineOptionName;
+    static const std::string thresholdOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
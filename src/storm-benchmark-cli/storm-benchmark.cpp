@@ -0,0 +1,507 @@
+#include "storm-benchmark-cli/settings/BenchmarkSettings.h"
+#include "storm-benchmark-cli/settings/modules/BenchmarkRunnerSettings.h"
+
+#include "storm-cli-utilities/cli.h"
+#include "storm-cli-utilities/resources.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/OptionParserException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/IOSettings.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <sstream>
+
+namespace storm {
+namespace benchmark {
+
+typedef storm::json<double> Json;
+
+/*!
+ * An instance of a model of the Quantitative Verification Benchmark Set.
+ */
+struct Benchmark {
+    std::string model;
+    uint64_t instance;
+    // The comma separated list of properties to check (or none to check all properties).
+    boost::optional<std::string> propertyFilter;
+
+    std::string getName() const {
+        return model + "." + std::to_string(instance);
+    }
+};
+
+/*!
+ * The command line arguments with which storm is invoked on a benchmark.
+ */
+struct Configuration {
+    std::string name;
+    std::vector<std::string> arguments;
+};
+
+struct Suite {
+    std::vector<Benchmark> benchmarks;
+    std::vector<Configuration> configurations;
+    uint64_t repetitions = 1;
+    uint64_t timeout = 0;
+};
+
+/*!
+ * The outcome of a single invocation of storm.
+ */
+struct RunResult {
+    int exitCode;
+    double wallclockTime;
+    uint64_t peakMemoryKilobytes;
+};
+
+std::vector<std::string> splitArguments(std::string const& arguments) {
+    std::vector<std::string> result;
+    std::istringstream stream(arguments);
+    std::string argument;
+    while (stream >> argument) {
+        result.push_back(argument);
+    }
+    return result;
+}
+
+void addBenchmarks(std::string const& model, boost::optional<uint64_t> const& instance, boost::optional<std::string> const& propertyFilter,
+                   std::vector<Benchmark>& benchmarks) {
+    if (instance) {
+        benchmarks.push_back({model, instance.get(), propertyFilter});
+    } else {
+        // Take all instances of the model.
+        uint64_t numberOfInstances = storm::storage::QvbsBenchmark(model).getNumberOfInstances();
+        for (uint64_t i = 0; i < numberOfInstances; ++i) {
+            benchmarks.push_back({model, i, propertyFilter});
+        }
+    }
+}
+
+void addBenchmark(std::string const& description, std::vector<Benchmark>& benchmarks) {
+    auto separatorPosition = description.find(':');
+    if (separatorPosition == std::string::npos) {
+        addBenchmarks(description, boost::none, boost::none, benchmarks);
+    } else {
+        std::string index = description.substr(separatorPosition + 1);
+        STORM_LOG_THROW(!index.empty() && std::all_of(index.begin(), index.end(), ::isdigit), storm::exceptions::InvalidArgumentException,
+                        "Invalid instance index in benchmark '" << description << "'.");
+        addBenchmarks(description.substr(0, separatorPosition), std::stoull(index), boost::none, benchmarks);
+    }
+}
+
+std::vector<std::string> getArguments(Json const& structure, std::string const& errorInfo) {
+    if (structure.is_string()) {
+        return splitArguments(structure.get<std::string>());
+    }
+    STORM_LOG_THROW(structure.is_array(), storm::exceptions::WrongFormatException, "Expected a string or an array of strings " << errorInfo << ".");
+    std::vector<std::string> result;
+    for (auto const& argument : structure) {
+        STORM_LOG_THROW(argument.is_string(), storm::exceptions::WrongFormatException, "Expected a string, got '" << argument.dump() << "' " << errorInfo);
+        result.push_back(argument.get<std::string>());
+    }
+    return result;
+}
+
+Json readJsonFile(std::string const& filename) {
+    Json result;
+    std::ifstream file;
+    storm::utility::openFile(filename, file);
+    result << file;
+    storm::utility::closeFile(file);
+    return result;
+}
+
+/*!
+ * Loads a suite file of the form
+ * {"benchmarks": ["model:instance-index" | {"model": ..., "instance": ..., "properties": ...}, ...],
+ *  "configurations": [{"name": ..., "arguments": "..." | [...]}, ...], "repetitions": ..., "timeout": ...}
+ */
+void loadSuiteFile(std::string const& filename, Suite& suite) {
+    Json structure = readJsonFile(filename);
+    STORM_LOG_THROW(structure.is_object(), storm::exceptions::WrongFormatException, "Expected an object in suite file " << filename << ".");
+    if (structure.count("benchmarks") > 0) {
+        for (auto const& entry : structure.at("benchmarks")) {
+            if (entry.is_string()) {
+                addBenchmark(entry.get<std::string>(), suite.benchmarks);
+            } else {
+                STORM_LOG_THROW(entry.is_object() && entry.count("model") > 0, storm::exceptions::WrongFormatException,
+                                "Expected a benchmark with a model, got '" << entry.dump() << "' in suite file " << filename << ".");
+                boost::optional<uint64_t> instance;
+                if (entry.count("instance") > 0) {
+                    instance = entry.at("instance").get<uint64_t>();
+                }
+                boost::optional<std::string> propertyFilter;
+                if (entry.count("properties") > 0) {
+                    auto const& properties = entry.at("properties");
+                    propertyFilter = properties.is_string() ? properties.get<std::string>() : "";
+                    if (properties.is_array()) {
+                        for (auto const& property : properties) {
+                            propertyFilter.get() += (propertyFilter->empty() ? "" : ",") + property.get<std::string>();
+                        }
+                    }
+                }
+                addBenchmarks(entry.at("model").get<std::string>(), instance, propertyFilter, suite.benchmarks);
+            }
+        }
+    }
+    if (structure.count("configurations") > 0) {
+        for (auto const& entry : structure.at("configurations")) {
+            STORM_LOG_THROW(entry.is_object() && entry.count("name") > 0, storm::exceptions::WrongFormatException,
+                            "Expected a configuration with a name, got '" << entry.dump() << "' in suite file " << filename << ".");
+            std::string name = entry.at("name").get<std::string>();
+            std::vector<std::string> arguments;
+            if (entry.count("arguments") > 0) {
+                arguments = getArguments(entry.at("arguments"), "for the arguments of configuration " + name);
+            }
+            suite.configurations.push_back({name, arguments});
+        }
+    }
+    if (structure.count("repetitions") > 0) {
+        suite.repetitions = structure.at("repetitions").get<uint64_t>();
+        STORM_LOG_THROW(suite.repetitions > 0, storm::exceptions::WrongFormatException, "The number of repetitions needs to be positive.");
+    }
+    if (structure.count("timeout") > 0) {
+        suite.timeout = structure.at("timeout").get<uint64_t>();
+    }
+}
+
+Suite loadSuite() {
+    auto const& settings = storm::settings::getModule<storm::settings::modules::BenchmarkRunnerSettings>();
+    Suite suite;
+    if (settings.isSuiteSet()) {
+        loadSuiteFile(settings.getSuiteFilename(), suite);
+    }
+    if (settings.isBenchmarksSet()) {
+        for (auto const& description : settings.getBenchmarks()) {
+            addBenchmark(description, suite.benchmarks);
+        }
+    }
+    STORM_LOG_THROW(!suite.benchmarks.empty(), storm::exceptions::InvalidArgumentException,
+                    "No benchmarks were selected. Use --" << storm::settings::modules::BenchmarkRunnerSettings::moduleName << ":suite or --"
+                                                          << storm::settings::modules::BenchmarkRunnerSettings::moduleName << ":benchmarks.");
+
+    // Engines and methods given on the command line span all their combinations.
+    if (settings.isEnginesSet() || settings.isMethodsSet()) {
+        std::vector<std::string> engines = settings.isEnginesSet() ? settings.getEngines() : std::vector<std::string>({""});
+        std::vector<std::string> methods = settings.isMethodsSet() ? settings.getMethods() : std::vector<std::string>({""});
+        for (auto const& engine : engines) {
+            for (auto const& method : methods) {
+                Configuration configuration;
+                if (!engine.empty()) {
+                    configuration.name = engine;
+                    configuration.arguments.insert(configuration.arguments.end(), {"--engine", engine});
+                }
+                if (!method.empty()) {
+                    configuration.name += (configuration.name.empty() ? "" : "-") + method;
+                    configuration.arguments.insert(configuration.arguments.end(), {"--minmax:method", method});
+                }
+                suite.configurations.push_back(std::move(configuration));
+            }
+        }
+    }
+    if (suite.configurations.empty()) {
+        suite.configurations.push_back({"default", {}});
+    }
+    if (settings.isRepetitionsSet()) {
+        suite.repetitions = settings.getRepetitions();
+    }
+    if (settings.isTimeoutSet()) {
+        suite.timeout = settings.getTimeout();
+    }
+    return suite;
+}
+
+/*!
+ * Invokes storm with the given arguments and waits for it to terminate. The output of storm is written to the given log file.
+ */
+RunResult runStorm(std::string const& stormBinary, std::vector<std::string> const& arguments, std::string const& logFilename) {
+    std::vector<char*> argv;
+    argv.push_back(const_cast<char*>(stormBinary.c_str()));
+    for (auto const& argument : arguments) {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    storm::utility::Stopwatch wallclockTimer(true);
+    pid_t pid = fork();
+    STORM_LOG_THROW(pid >= 0, storm::exceptions::FileIoException, "Could not run " << stormBinary << ", fork failed.");
+    if (pid == 0) {
+        // We are in the child process.
+        if (freopen(logFilename.c_str(), "w", stdout) == nullptr || dup2(fileno(stdout), STDERR_FILENO) < 0) {
+            std::cerr << "ERROR: could not redirect the output to " << logFilename << ": " << strerror(errno) << '\n';
+            _exit(127);
+        }
+        execvp(argv[0], argv.data());
+        std::cerr << "ERROR: exec failed: " << strerror(errno) << '\n';
+        _exit(127);
+    }
+
+    // The resource usage of the child is only available as long as it is waited for directly.
+    int status;
+    struct rusage ru;
+    while (wait4(pid, &status, 0, &ru) < 0) {
+        STORM_LOG_THROW(errno == EINTR, storm::exceptions::FileIoException, "Could not wait for " << stormBinary << ": " << strerror(errno));
+    }
+    wallclockTimer.stop();
+
+    RunResult result;
+    result.exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+    result.wallclockTime = static_cast<double>(wallclockTimer.getTimeInMilliseconds()) / 1000.0;
+    result.peakMemoryKilobytes = storm::utility::resources::getPeakMemoryUsage(ru);
+    return result;
+}
+
+template<typename T>
+T getMedian(std::vector<T> values) {
+    STORM_LOG_ASSERT(!values.empty(), "Expected at least one value.");
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+std::string getSummaryKey(Json const& summary) {
+    return summary.at("benchmark").get<std::string>() + "|" + summary.at("configuration").get<std::string>();
+}
+
+/*!
+ * Compares the summaries of the given results with the ones of the baseline.
+ * @return the regressions, i.e., the summaries whose runs failed or whose time or memory exceeds the baseline by more than the given factor.
+ */
+Json findRegressions(Json const& results, Json const& baseline, double threshold) {
+    std::map<std::string, Json const*> baselineSummaries;
+    if (baseline.count("summary") > 0) {
+        for (auto const& summary : baseline.at("summary")) {
+            baselineSummaries.emplace(getSummaryKey(summary), &summary);
+        }
+    }
+
+    Json regressions = Json::array();
+    for (auto const& summary : results.at("summary")) {
+        auto baselineIt = baselineSummaries.find(getSummaryKey(summary));
+        if (baselineIt == baselineSummaries.end() || baselineIt->second->at("successful-runs").get<uint64_t>() == 0) {
+            continue;
+        }
+        Json const& baselineSummary = *baselineIt->second;
+        Json regression;
+        if (summary.at("successful-runs").get<uint64_t>() == 0) {
+            regression["reason"] = "failed";
+        } else {
+            for (std::string const& measure : {"wallclock-time", "peak-memory-kilobytes"}) {
+                double value = summary.at(measure).get<double>();
+                double baselineValue = baselineSummary.at(measure).get<double>();
+                if (value > threshold * baselineValue) {
+                    regression["reason"] = measure;
+                    regression["value"] = value;
+                    regression["baseline"] = baselineValue;
+                    break;
+                }
+            }
+        }
+        if (!regression.is_null()) {
+            regression["benchmark"] = summary.at("benchmark");
+            regression["configuration"] = summary.at("configuration");
+            regressions.push_back(std::move(regression));
+        }
+    }
+    return regressions;
+}
+
+std::string getDefaultStormBinary(std::string const& executable) {
+    auto separatorPosition = executable.rfind('/');
+    if (separatorPosition == std::string::npos) {
+        // The binary is looked up in the path.
+        return "storm";
+    }
+    return executable.substr(0, separatorPosition + 1) + "storm";
+}
+
+int processOptions(std::string const& executable) {
+    auto const& settings = storm::settings::getModule<storm::settings::modules::BenchmarkRunnerSettings>();
+    std::string qvbsRoot = storm::settings::getModule<storm::settings::modules::IOSettings>().getQvbsRoot();
+    Suite suite = loadSuite();
+    std::string stormBinary = settings.isStormBinarySet() ? settings.getStormBinary() : getDefaultStormBinary(executable);
+
+    // The logs and the instrumentation of the individual runs are kept next to the results.
+    std::string outputFilename = settings.getOutputFilename();
+    std::string runDirectory = outputFilename + ".runs";
+    std::error_code error;
+    std::filesystem::create_directories(runDirectory, error);
+    STORM_LOG_THROW(!error, storm::exceptions::FileIoException, "Could not create directory " << runDirectory << ": " << error.message());
+
+    Json results;
+    results["storm"] = stormBinary;
+    results["repetitions"] = suite.repetitions;
+    results["timeout"] = suite.timeout;
+    results["runs"] = Json::array();
+    results["summary"] = Json::array();
+    uint64_t numberOfRuns = suite.benchmarks.size() * suite.configurations.size() * suite.repetitions;
+    uint64_t runIndex = 0;
+    for (auto const& benchmark : suite.benchmarks) {
+        for (auto const& configuration : suite.configurations) {
+            std::vector<double> wallclockTimes;
+            std::vector<double> peakMemories;
+            for (uint64_t repetition = 0; repetition < suite.repetitions; ++repetition) {
+                ++runIndex;
+                std::string runName = benchmark.getName() + "." + configuration.name + "." + std::to_string(repetition);
+                std::string instrumentationFilename = runDirectory + "/" + runName + ".instrumentation.json";
+                std::string logFilename = runDirectory + "/" + runName + ".log";
+                std::remove(instrumentationFilename.c_str());
+
+                std::vector<std::string> arguments = {"--qvbs", benchmark.model, std::to_string(benchmark.instance)};
+                if (benchmark.propertyFilter) {
+                    arguments.push_back(benchmark.propertyFilter.get());
+                }
+                if (!qvbsRoot.empty()) {
+                    arguments.insert(arguments.end(), {"--qvbsroot", qvbsRoot});
+                }
+                arguments.insert(arguments.end(), configuration.arguments.begin(), configuration.arguments.end());
+                arguments.insert(arguments.end(), {"--exportinstrumentation", instrumentationFilename});
+                if (suite.timeout > 0) {
+                    arguments.insert(arguments.end(), {"--timeout", std::to_string(suite.timeout)});
+                }
+
+                STORM_PRINT("Run " << runIndex << "/" << numberOfRuns << ": " << benchmark.getName() << " with " << configuration.name << " ...");
+                RunResult runResult = runStorm(stormBinary, arguments, logFilename);
+                STORM_PRINT(" " << (runResult.exitCode == 0 ? "done" : "failed (exit code " + std::to_string(runResult.exitCode) + ")") << ". ("
+                                << runResult.wallclockTime << " seconds, " << (runResult.peakMemoryKilobytes / 1024) << "MB).\n");
+
+                Json run;
+                run["benchmark"] = benchmark.getName();
+                run["model"] = benchmark.model;
+                run["instance"] = benchmark.instance;
+                run["configuration"] = configuration.name;
+                run["arguments"] = arguments;
+                run["repetition"] = repetition;
+                run["exit-code"] = runResult.exitCode;
+                run["wallclock-time"] = runResult.wallclockTime;
+                run["peak-memory-kilobytes"] = runResult.peakMemoryKilobytes;
+                run["log"] = logFilename;
+                if (storm::utility::fileExistsAndIsReadable(instrumentationFilename)) {
+                    run["instrumentation"] = readJsonFile(instrumentationFilename);
+                }
+                results["runs"].push_back(std::move(run));
+
+                if (runResult.exitCode == 0) {
+                    wallclockTimes.push_back(runResult.wallclockTime);
+                    peakMemories.push_back(static_cast<double>(runResult.peakMemoryKilobytes));
+                }
+            }
+
+            // Summarize the repetitions by their median, which is robust against outliers.
+            Json summary;
+            summary["benchmark"] = benchmark.getName();
+            summary["configuration"] = configuration.name;
+            summary["successful-runs"] = wallclockTimes.size();
+            if (!wallclockTimes.empty()) {
+                summary["wallclock-time"] = getMedian(wallclockTimes);
+                summary["peak-memory-kilobytes"] = getMedian(peakMemories);
+            }
+            results["summary"].push_back(std::move(summary));
+        }
+    }
+
+    int result = 0;
+    if (settings.isBaselineSet()) {
+        Json regressions = findRegressions(results, readJsonFile(settings.getBaselineFilename()), settings.getRegressionThreshold());
+        for (auto const& regression : regressions) {
+            STORM_PRINT("Regression of " << regression.at("benchmark").get<std::string>() << " with " << regression.at("configuration").get<std::string>()
+                                         << ": " << regression.at("reason").get<std::string>());
+            if (regression.count("value") > 0) {
+                STORM_PRINT(" (" << regression.at("value").get<double>() << " instead of " << regression.at("baseline").get<double>() << ")");
+            }
+            STORM_PRINT(".\n");
+        }
+        STORM_PRINT(regressions.size() << " regression(s) w.r.t. baseline " << settings.getBaselineFilename() << ".\n");
+        results["regressions"] = std::move(regressions);
+        result = results["regressions"].empty() ? 0 : 3;
+    }
+
+    std::ofstream stream;
+    storm::utility::openFile(outputFilename, stream);
+    stream << results.dump(4) << '\n';
+    storm::utility::closeFile(stream);
+    STORM_PRINT("Results written to " << outputFilename << ".\n");
+    return result;
+}
+
+bool parseOptions(const int argc, const char* argv[]) {
+    try {
+        storm::settings::mutableManager().setFromCommandLine(argc, argv);
+    } catch (storm::exceptions::OptionParserException& e) {
+        STORM_LOG_ERROR("Unable to parse command line options. Type '" + std::string(argv[0]) + " --help' or '" + std::string(argv[0]) +
+                        " --help all' for help.");
+        return false;
+    }
+
+    auto const& general = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
+
+    // Set options from config file (if given)
+    if (general.isConfigSet()) {
+        storm::settings::mutableManager().setFromConfigurationFile(general.getConfigFilename());
+    }
+
+    bool result = true;
+    if (general.isHelpSet()) {
+        storm::settings::manager().printHelp(general.getHelpFilterExpression());
+        result = false;
+    }
+
+    if (general.isVersionSet()) {
+        storm::cli::printVersion("storm-benchmark");
+        result = false;
+    }
+
+    if (general.isVerboseSet()) {
+        storm::utility::setLogLevel(l3pp::LogLevel::INFO);
+    }
+
+    return result;
+}
+
+}  // namespace benchmark
+}  // namespace storm
+
+/*!
+ * Main entry point of the executable storm-benchmark, which runs storm on benchmarks of the Quantitative Verification Benchmark Set with several
+ * configurations and collects the measured times and the memory consumption in a JSON file that can be compared with the results of earlier runs.
+ *
+ * @param argc The argc argument of main().
+ * @param argv The argv argument of main().
+ * @return 0 iff the benchmarks were run (without regressions w.r.t. the baseline, if given), 3 if there are regressions.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::cli::printHeader("Storm-benchmark", argc, argv);
+        storm::settings::initializeBenchmarkSettings("Storm-benchmark", "storm-benchmark");
+        if (!storm::benchmark::parseOptions(argc, argv)) {
+            return -1;
+        }
+
+        int result = storm::benchmark::processOptions(argv[0]);
+
+        storm::utility::cleanUp();
+        return result;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-benchmark to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-benchmark to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -1,8 +1,12 @@
 #include "cli.h"
 
 #include "storm-cli-utilities/resources.h"
+#include "storm-cli-utilities/server.h"
 #include "storm-version-info/storm-version.h"
+#include "storm/adapters/JsonAdapter.h"
 #include "storm/io/file.h"
+#include "storm/utility/Instrumentation.h"
+#include "storm/utility/LargeArray.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
@@ -42,6 +46,8 @@ namespace storm {
 namespace cli {
 
 int64_t process(const int argc, const char** argv) {
+    // The startup (i.e. the initialization and the parsing of the options) is tracked separately, as it dominates the runtime for small inputs.
+    storm::utility::Stopwatch startupTimer(true);
     storm::utility::setUp();
     storm::cli::printHeader("Storm", argc, argv);
     storm::settings::initializeAll("Storm", "storm");
@@ -52,13 +58,16 @@ int64_t process(const int argc, const char** argv) {
     if (!storm::cli::parseOptions(argc, argv)) {
         return -1;
     }
+    startupTimer.stop();
 
     processOptions();
 
     totalTimer.stop();
+    storm::utility::addMeasurement(storm::utility::Instrumentation::instance().getTimer("startup"), startupTimer.getTimeInNanoseconds());
     if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
-        storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
+        storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds(), startupTimer.getTimeInMilliseconds());
     }
+    storm::cli::printAndExportInstrumentation();
 
     storm::utility::cleanUp();
     return 0;
@@ -209,6 +218,16 @@ void setResourceLimits() {
         storm::utility::resources::setTimeoutAlarm(resources.getTimeoutInSeconds());
     }
 
+    // Set up the allocation of large arrays before the model is built.
+    storm::utility::LargeArrayOptions largeArrayOptions;
+    largeArrayOptions.threshold = resources.getLargeArrayThreshold();
+    largeArrayOptions.hugePages = resources.isHugePagesSet();
+    largeArrayOptions.interleave = resources.isNumaInterleaveSet();
+    if (resources.isLargeArrayDirectorySet()) {
+        largeArrayOptions.backingDirectory = resources.getLargeArrayDirectory();
+    }
+    storm::utility::LargeArray::setOptions(largeArrayOptions);
+
     // register signal handler to handle aborts
     storm::utility::resources::installSignalHandler(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getSignalWaitingTimeInSeconds());
 }
@@ -242,12 +261,19 @@ void setUrgentOptions() {
     setFileLogging();
     // Set output precision
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    storm::utility::Instrumentation::setEnabled(storm::settings::getModule<storm::settings::modules::ResourceSettings>().isInstrumentationSet());
 }
 
 void processOptions() {
     // Start by setting some urgent options (log levels, resources, etc.)
     setUrgentOptions();
 
+    // In server mode, the input is given by the requests.
+    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isServerSet()) {
+        runServer();
+        return;
+    }
+
     // Parse symbolic input (PRISM, JANI, properties, etc.)
     SymbolicInput symbolicInput = parseSymbolicInput();
 
@@ -283,27 +309,41 @@ void processOptions() {
 #endif
 }
 
-void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
+void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds, uint64_t startupMilliseconds) {
     struct rusage ru;
     getrusage(RUSAGE_SELF, &ru);
 
     std::cout << "\nPerformance statistics:\n";
-#ifdef MACOS
-    // For Mac OS, this is returned in bytes.
-    uint64_t maximumResidentSizeInMegabytes = ru.ru_maxrss / 1024 / 1024;
-#endif
-#ifdef LINUX
-    // For Linux, this is returned in kilobytes.
-    uint64_t maximumResidentSizeInMegabytes = ru.ru_maxrss / 1024;
-#endif
+    uint64_t maximumResidentSizeInMegabytes = storm::utility::resources::getPeakMemoryUsage(ru) / 1024;
     std::cout << "  * peak memory usage: " << maximumResidentSizeInMegabytes << "MB\n";
     char oldFillChar = std::cout.fill('0');
     std::cout << "  * CPU time: " << ru.ru_utime.tv_sec << "." << std::setw(3) << ru.ru_utime.tv_usec / 1000 << "s\n";
     if (wallclockMilliseconds != 0) {
         std::cout << "  * wallclock time: " << (wallclockMilliseconds / 1000) << "." << std::setw(3) << (wallclockMilliseconds % 1000) << "s\n";
     }
+    if (startupMilliseconds != 0) {
+        std::cout << "  * startup time: " << (startupMilliseconds / 1000) << "." << std::setw(3) << (startupMilliseconds % 1000) << "s\n";
+    }
     std::cout.fill(oldFillChar);
 }
 
+void printAndExportInstrumentation() {
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    // The peak memory usage is recorded along with the timers so that exported measurements of different runs can be compared.
+    static auto& peakMemoryCounter = storm::utility::Instrumentation::instance().getCounter("memory.peak-kilobytes");
+    if (storm::utility::Instrumentation::isEnabled()) {
+        peakMemoryCounter.store(storm::utility::resources::getPeakMemoryUsage());
+    }
+    if (resourceSettings.isPrintInstrumentationSet()) {
+        storm::utility::Instrumentation::instance().printToStream(std::cout);
+    }
+    if (resourceSettings.isExportInstrumentationSet()) {
+        std::ofstream stream;
+        storm::utility::openFile(resourceSettings.getExportInstrumentationFilename(), stream);
+        stream << storm::utility::Instrumentation::instance().toJson().dump(4) << '\n';
+        storm::utility::closeFile(stream);
+    }
+}
+
 }  // namespace cli
 }  // namespace storm
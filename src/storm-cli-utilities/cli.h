@@ -22,7 +22,15 @@ void printHeader(std::string const& name, const int argc, const char** argv);
 
 void printVersion(std::string const& name);
 
-void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds = 0);
+/*!
+ * Prints the CPU time and the peak memory usage as well as the given wallclock and startup times (if non-zero).
+ */
+void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds = 0, uint64_t startupMilliseconds = 0);
+
+/*!
+ * Prints and/or exports the instrumentation timers and counters (if requested).
+ */
+void printAndExportInstrumentation();
 
 /*!
  * Parses the given command line arguments.
@@ -0,0 +1,152 @@
+#include "storm-cli-utilities/model-cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/modules/ModuleSettings.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace cli {
+
+namespace {
+
+static const uint64_t FnvOffsetBasis = 14695981039346656037ull;
+static const uint64_t FnvPrime = 1099511628211ull;
+
+uint64_t addToHash(uint64_t hash, char const* data, uint64_t size) {
+    for (uint64_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= FnvPrime;
+    }
+    return hash;
+}
+
+uint64_t addSizeToHash(uint64_t hash, uint64_t size) {
+    // The sizes separate the components of the key, i.e. "ab" + "c" and "a" + "bc" yield different keys.
+    char bytes[sizeof(uint64_t)];
+    for (uint64_t i = 0; i < sizeof(uint64_t); ++i) {
+        bytes[i] = static_cast<char>(size >> (8 * i));
+    }
+    return addToHash(hash, bytes, sizeof(uint64_t));
+}
+
+}  // namespace
+
+ModelCache::ModelCache(std::string const& directory) : directory(directory), hash(FnvOffsetBasis) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    STORM_LOG_THROW(!error, storm::exceptions::FileIoException, "Could not create the model cache directory " << directory << ": " << error.message() << ".");
+}
+
+void ModelCache::addToKey(std::string const& component) {
+    hash = addSizeToHash(hash, component.size());
+    hash = addToHash(hash, component.data(), component.size());
+}
+
+void ModelCache::addFileToKey(std::string const& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    std::vector<char> buffer(1 << 16);
+    uint64_t size = 0;
+    while (file) {
+        file.read(buffer.data(), buffer.size());
+        hash = addToHash(hash, buffer.data(), file.gcount());
+        size += file.gcount();
+    }
+    hash = addSizeToHash(hash, size);
+}
+
+void ModelCache::addSettingsToKey(storm::settings::modules::ModuleSettings const& settings) {
+    addToKey(settings.getModuleName());
+    for (auto const& option : settings.getOptions()) {
+        if (option->getHasOptionBeenSet()) {
+            addToKey(option->getLongName());
+            for (uint_fast64_t argument = 0; argument < option->getArgumentCount(); ++argument) {
+                addToKey(option->getArgument(argument).getValueAsString());
+            }
+        }
+    }
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> ModelCache::load() const {
+    std::string filename = getFilename();
+    if (!std::filesystem::exists(filename)) {
+        STORM_LOG_INFO("No cached model found in " << filename << ".");
+        return nullptr;
+    }
+    try {
+        return storm::parser::BinaryEncodingParser<double>::parseModel(filename);
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("Could not load the cached model from " << filename << ": " << e.what() << " The model is built again.");
+        return nullptr;
+    }
+}
+
+bool ModelCache::store(std::shared_ptr<storm::models::sparse::Model<double>> const& model) const {
+    if (!isCacheable(*model)) {
+        STORM_LOG_WARN("The model is not cached as the cache does not support state valuations, choice origins and transition rewards.");
+        return false;
+    }
+    // Write to a temporary file first such that concurrent runs never read incomplete models.
+    std::string filename = getFilename();
+    std::string temporaryFilename = filename + "." + std::to_string(std::random_device()()) + ".tmp";
+    try {
+        storm::exporter::binaryExportSparseModel(temporaryFilename, model);
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("Could not store the model in the cache: " << e.what());
+        std::filesystem::remove(temporaryFilename);
+        return false;
+    }
+    std::error_code error;
+    std::filesystem::rename(temporaryFilename, filename, error);
+    if (error) {
+        STORM_LOG_WARN("Could not store the model in the cache: " << error.message() << ".");
+        std::filesystem::remove(temporaryFilename, error);
+        return false;
+    }
+    STORM_LOG_INFO("Stored the model in the cache as " << filename << ".");
+    return true;
+}
+
+bool ModelCache::isCacheable(storm::models::sparse::Model<double> const& model) {
+    switch (model.getType()) {
+        case storm::models::ModelType::Dtmc:
+        case storm::models::ModelType::Ctmc:
+        case storm::models::ModelType::Mdp:
+        case storm::models::ModelType::MarkovAutomaton:
+        case storm::models::ModelType::Pomdp:
+            break;
+        default:
+            return false;
+    }
+    if (model.hasStateValuations() || model.hasChoiceOrigins()) {
+        return false;
+    }
+    for (auto const& rewardModel : model.getRewardModels()) {
+        if (rewardModel.second.hasTransitionRewards()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string ModelCache::getFilename() const {
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+    return (std::filesystem::path(directory) / name.str()).string();
+}
+
+}  // namespace cli
+}  // namespace storm
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+class ModuleSettings;
+}
+}  // namespace settings
+
+namespace cli {
+
+/*!
+ * A cache for sparse models built from symbolic input. The models are stored in the binary format in a directory, under a name that is derived from
+ * a hash of everything that influences the built model (see the addToKey functions). Loading a cached model avoids the state space exploration.
+ */
+class ModelCache {
+   public:
+    /*!
+     * Creates a cache that stores its models in the given directory. The directory is created if necessary.
+     *
+     * @param directory The directory of the cache.
+     */
+    explicit ModelCache(std::string const& directory);
+
+    /*!
+     * Adds the given string to the key of the cached model.
+     */
+    void addToKey(std::string const& component);
+
+    /*!
+     * Adds the content of the given file to the key of the cached model.
+     */
+    void addFileToKey(std::string const& filename);
+
+    /*!
+     * Adds all options of the given settings module that were set (together with the values of their arguments) to the key of the cached model.
+     */
+    void addSettingsToKey(storm::settings::modules::ModuleSettings const& settings);
+
+    /*!
+     * Loads the model for the current key.
+     *
+     * @return The cached model or nullptr if there is no (readable) cached model for the key.
+     */
+    std::shared_ptr<storm::models::sparse::Model<double>> load() const;
+
+    /*!
+     * Stores the given model for the current key if the binary format supports all of its components.
+     *
+     * @return True iff the model was stored.
+     */
+    bool store(std::shared_ptr<storm::models::sparse::Model<double>> const& model) const;
+
+    /*!
+     * Retrieves whether the binary format supports all components of the given model, i.e. whether the model can be restored from the cache.
+     */
+    static bool isCacheable(storm::models::sparse::Model<double> const& model);
+
+   private:
+    std::string getFilename() const;
+
+    std::string directory;
+
+    // The (64 bit FNV-1a) hash of all components of the key.
+    uint64_t hash;
+};
+
+}  // namespace cli
+}  // namespace storm
@@ -2,25 +2,32 @@
 
 #include "storm/api/storm.h"
 
+#include "storm-cli-utilities/model-cache.h"
 #include "storm-counterexamples/api/counterexamples.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm-version-info/storm-version.h"
 
 #include "storm/io/file.h"
 #include "storm/utility/AutomaticSettings.h"
 #include "storm/utility/Engine.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/SparseSolverPortfolio.h"
 #include "storm/utility/macros.h"
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <atomic>
+#include <thread>
 #include <type_traits>
 
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/CompositionalBisimulationBuilder.h"
 
 #include "storm/models/ModelBase.h"
 
@@ -28,6 +35,10 @@
 
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
+#include "storm/modelchecker/hints/ExplicitSolutionCache.h"
+#include "storm/modelchecker/propositional/StateFormulaCache.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -43,6 +54,7 @@
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/SimulationSettings.h"
 #include "storm/settings/modules/TransformationSettings.h"
 #include "storm/storage/Qvbs.h"
 #include "storm/storage/jani/localeliminator/AutomaticAction.h"
@@ -65,6 +77,7 @@ struct SymbolicInput {
 };
 
 void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input) {
+    storm::utility::InstrumentationTimer instrumentationTimer("parsing.model");
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
     if (ioSettings.isPrismOrJaniInputSet()) {
         storm::utility::Stopwatch modelParsingWatch(true);
@@ -95,6 +108,7 @@ void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& i
 
 void parseProperties(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input,
                      boost::optional<std::set<std::string>> const& propertyFilter) {
+    storm::utility::InstrumentationTimer instrumentationTimer("parsing.properties");
     if (ioSettings.isPropertySet()) {
         std::vector<storm::jani::Property> newProperties;
         if (input.model) {
@@ -134,6 +148,7 @@ SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings const&
 }
 
 SymbolicInput parseSymbolicInput() {
+    storm::utility::InstrumentationTimer instrumentationTimer("parsing");
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (ioSettings.isQvbsInputSet()) {
         return parseSymbolicInputQvbs(ioSettings);
@@ -326,6 +341,10 @@ ModelProcessingInformation getModelProcessingInformation(SymbolicInput const& in
               mpi.verificationValueType == ModelProcessingInformation::ValueType::FinitePrecision)) {
             STORM_LOG_INFO("Switching to DD library sylvan to allow for rational arithmetic.");
             mpi.ddType = storm::dd::DdType::Sylvan;
+        } else if (mpi.applyBisimulation && storm::utility::getBuilderType(mpi.engine) == storm::builder::BuilderType::Dd) {
+            // The signature computation and refinement of sylvan run in parallel whereas CUDD only supports a single thread.
+            STORM_LOG_INFO("Switching to DD library sylvan to allow for parallel symbolic bisimulation.");
+            mpi.ddType = storm::dd::DdType::Sylvan;
         }
     }
     return mpi;
@@ -437,11 +456,39 @@ std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& inpu
                                                              !buildSettings.isApplyNoMaximumProgressAssumptionSet());
 }
 
+std::shared_ptr<storm::models::ModelBase> buildModelSparseCached(SymbolicInput const& input, storm::builder::BuilderOptions const& options,
+                                                                storm::settings::modules::BuildSettings const& buildSettings) {
+    if (options.isBuildStateValuationsSet() || options.isBuildObservationValuationsSet() || options.isBuildChoiceOriginsSet()) {
+        STORM_LOG_WARN("The model cache is not used as it does not support state valuations and choice origins.");
+        return storm::api::buildSparseModel<double>(input.model.get(), options);
+    }
+
+    // The key consists of everything that influences the built model. The preprocessed model description includes the constant definitions.
+    storm::cli::ModelCache cache(storm::settings::getModule<storm::settings::modules::IOSettings>().getModelCacheDirectory());
+    cache.addToKey(storm::StormVersion::longVersionString());
+    std::stringstream modelDescription;
+    modelDescription << input.model.get();
+    cache.addToKey(modelDescription.str());
+    for (auto const& formula : createFormulasToRespect(input.properties)) {
+        cache.addToKey(formula->toString());
+    }
+    cache.addSettingsToKey(buildSettings);
+
+    if (auto model = cache.load()) {
+        STORM_PRINT_AND_LOG("Loaded the model from the model cache.\n");
+        return model;
+    }
+    auto model = storm::api::buildSparseModel<double>(input.model.get(), options);
+    cache.store(model);
+    return model;
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
     storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
     options.setBuildChoiceLabels(options.isBuildChoiceLabelsSet() || buildSettings.isBuildChoiceLabelsSet());
     options.setBuildStateValuations(options.isBuildStateValuationsSet() || buildSettings.isBuildStateValuationsSet());
+    options.setBuildStateValuationsLazily(buildSettings.isBuildStateValuationsLazilySet());
     options.setBuildAllLabels(options.isBuildAllLabelsSet() || buildSettings.isBuildAllLabelsSet());
     bool buildChoiceOrigins = options.isBuildChoiceOriginsSet() || buildSettings.isBuildChoiceOriginsSet();
     if (storm::settings::manager().hasModule(storm::settings::modules::CounterexampleGeneratorSettings::moduleName)) {
@@ -473,9 +520,48 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
         options.setAddOverlappingGuardsLabel(true);
     }
 
+    if (buildSettings.isPartialOrderReductionSet()) {
+        options.setPartialOrderReduction(true);
+    }
+
+    if (buildSettings.isSymmetryReductionSet()) {
+        options.setSymmetryReduction(true);
+    }
+
+    if (buildSettings.isCompressLabelsSet()) {
+        options.setCompressStateLabeling(true);
+    }
+
+    if (buildSettings.isNativeExpressionsSet()) {
+        options.setNativeExpressionCompilation(true);
+    }
+
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isModelCacheSet()) {
+            return buildModelSparseCached(input, options, buildSettings);
+        }
+    }
     return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::ModelBase> buildModelSparseCompositional(SymbolicInput const& input,
+                                                                       storm::settings::modules::BisimulationSettings const& bisimulationSettings) {
+    if (!input.model->isPrismProgram() || !storm::builder::CompositionalBisimulationBuilder<ValueType>::canHandle(input.model->asPrismProgram())) {
+        STORM_LOG_WARN("Compositional bisimulation minimization is only supported for PRISM CTMCs whose modules neither synchronize nor share "
+                       "variables. Building the full model instead.");
+        return nullptr;
+    }
+
+    storm::storage::BisimulationType bisimType = storm::storage::BisimulationType::Strong;
+    if (bisimulationSettings.isWeakBisimulationSet()) {
+        bisimType = storm::storage::BisimulationType::Weak;
+    }
+    STORM_LOG_INFO("Building the model with compositional bisimulation minimization...");
+    return storm::builder::CompositionalBisimulationBuilder<ValueType>::build(input.model->asPrismProgram(), createFormulasToRespect(input.properties),
+                                                                              bisimType);
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::modules::IOSettings const& ioSettings,
                                                              storm::settings::modules::BuildSettings const& buildSettings) {
@@ -490,6 +576,8 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitBinarySet()) {
+        result = storm::api::buildExplicitBinaryModel<ValueType>(ioSettings.getExplicitBinaryFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -509,9 +597,15 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
         if (builderType == storm::builder::BuilderType::Dd) {
             result = buildModelDd<DdType, ValueType>(input);
         } else if (builderType == storm::builder::BuilderType::Explicit) {
-            result = buildModelSparse<ValueType>(input, buildSettings);
+            auto bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+            if (mpi.applyBisimulation && bisimulationSettings.isCompositionalSet()) {
+                result = buildModelSparseCompositional<ValueType>(input, bisimulationSettings);
+            }
+            if (!result) {
+                result = buildModelSparse<ValueType>(input, buildSettings);
+            }
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitBinarySet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
@@ -561,7 +655,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> preprocessSparseModelBi
     }
 
     STORM_LOG_INFO("Performing bisimulation minimization...");
-    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType,
+                                                                  bisimulationSettings.getSparseRefinementMethod());
 }
 
 template<typename ValueType>
@@ -570,6 +665,7 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
     auto bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+    auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
 
     std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> result = std::make_pair(model, false);
 
@@ -599,6 +695,12 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
         result.second = true;
     }
 
+    if (buildSettings.isReorderStatesSet()) {
+        STORM_LOG_INFO("Reordering the states of the model...");
+        result.first = storm::api::reorderSparseModelStates(result.first, buildSettings.getStateOrdering());
+        result.second = true;
+    }
+
     return result;
 }
 
@@ -619,6 +721,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
+            case storm::exporter::ModelExportFormat::Binary:
+                storm::api::exportSparseModelAsBinary(model, ioSettings.getExportBuildFilename());
+                break;
             default:
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
                                 "Exporting sparse models in " << storm::exporter::toString(ioSettings.getExportBuildFormat()) << " format is not supported.");
@@ -761,6 +866,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    storm::utility::InstrumentationTimer instrumentationTimer("preprocessing");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -954,38 +1060,129 @@ void verifyProperties(
     SymbolicInput const& input,
     std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula,
                                                                     std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback,
-    std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
+    std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity(),
+    uint64_t numberOfThreads = 1) {
     auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
     auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
-    for (auto const& property : properties) {
-        printModelCheckingProperty(property);
-        bool ignored = false;
-        storm::utility::Stopwatch watch(true);
-        std::unique_ptr<storm::modelchecker::CheckResult> result;
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(properties.size());
+    std::vector<storm::utility::Stopwatch> watches(properties.size());
+    // Not a vector of bools as the entries are set concurrently.
+    std::vector<uint8_t> ignored(properties.size(), false);
+
+    auto checkProperty = [&](uint64_t index) {
+        auto const& property = properties[index];
+        storm::utility::InstrumentationTimer instrumentationTimer("modelchecking");
+        watches[index].start();
         try {
             auto rawFormula = property.getRawFormula();
             if (transformationSettings.isChainEliminationSet() && !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
                 STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
-                ignored = true;
+                ignored[index] = true;
             } else if (transformationSettings.isToDiscreteTimeModelSet()) {
                 auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
                 auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
                 if (propertyFormula && filterFormula) {
-                    result = verificationCallback(propertyFormula, filterFormula);
+                    results[index] = verificationCallback(propertyFormula, filterFormula);
                 } else {
-                    ignored = true;
+                    ignored[index] = true;
                 }
             } else {
-                result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
+                results[index] = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
             }
         } catch (storm::exceptions::BaseException const& ex) {
             STORM_LOG_WARN("Cannot handle property: " << ex.what());
         }
-        watch.stop();
-        if (!ignored) {
-            postprocessingCallback(result);
-            printResult<ValueType>(result, property, &watch);
+        watches[index].stop();
+    };
+    auto printProperty = [&](uint64_t index) {
+        if (!ignored[index]) {
+            postprocessingCallback(results[index]);
+            printResult<ValueType>(results[index], properties[index], &watches[index]);
+        }
+    };
+
+    if (numberOfThreads <= 1) {
+        for (uint64_t index = 0; index < properties.size(); ++index) {
+            printModelCheckingProperty(properties[index]);
+            checkProperty(index);
+            printProperty(index);
         }
+        return;
+    }
+
+    // The properties are distributed dynamically among the threads as their checking times typically differ a lot. The results are printed in the
+    // original order once all properties are checked.
+    std::atomic<uint64_t> nextProperty(0);
+    auto checkProperties = [&]() {
+        for (uint64_t index = nextProperty++; index < properties.size(); index = nextProperty++) {
+            checkProperty(index);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < std::min<uint64_t>(numberOfThreads, properties.size()); ++thread) {
+        threads.emplace_back(checkProperties);
+    }
+    checkProperties();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (uint64_t index = 0; index < properties.size(); ++index) {
+        printModelCheckingProperty(properties[index]);
+        printProperty(index);
+    }
+}
+
+template<typename ValueType>
+void verifyPropertiesInBatch(
+    SymbolicInput const& input, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, storm::Environment const& env,
+    std::function<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>(std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                                   bool onlyInitialStatesRelevant)> const& taskCallback,
+    std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback) {
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> tasks;
+    for (auto const& property : properties) {
+        tasks.push_back(taskCallback(property.getRawFormula(), property.getFilter().getStatesFormula()->isInitialFormula()));
+    }
+
+    // The filters are checked with the same state formula cache as the properties.
+    storm::Environment batchEnv = env;
+    batchEnv.modelchecker().setStateFormulaCache(std::make_shared<storm::modelchecker::StateFormulaCache>());
+    uint64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getBatchVerificationThreadCount();
+    storm::utility::Stopwatch watch(true);
+    std::vector<std::exception_ptr> errors;
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+    {
+        storm::utility::InstrumentationTimer instrumentationTimer("modelchecking");
+        results = storm::api::verifyWithSparseEngine<ValueType>(batchEnv, sparseModel, tasks, numberOfThreads, &errors);
+    }
+    watch.stop();
+    STORM_PRINT("\nTime for model checking " << properties.size() << " properties as a batch with " << numberOfThreads << " thread(s): " << watch
+                                             << ".\n");
+
+    for (uint64_t index = 0; index < properties.size(); ++index) {
+        auto const& property = properties[index];
+        printModelCheckingProperty(property);
+        std::unique_ptr<storm::modelchecker::CheckResult>& result = results[index];
+        try {
+            if (errors[index]) {
+                std::rethrow_exception(errors[index]);
+            }
+            std::unique_ptr<storm::modelchecker::CheckResult> filter;
+            if (property.getFilter().getStatesFormula()->isInitialFormula()) {
+                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+            } else {
+                filter = storm::api::verifyWithSparseEngine<ValueType>(batchEnv, sparseModel,
+                                                                       storm::api::createTask<ValueType>(property.getFilter().getStatesFormula(), false));
+            }
+            if (result && filter) {
+                result->filter(filter->asQualitativeCheckResult());
+            }
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_WARN("Cannot handle property: " << ex.what());
+            result.reset();
+        }
+        postprocessingCallback(result);
+        printResult<ValueType>(result, property);
     }
 }
 
@@ -1090,24 +1287,141 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithSimulationEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Simulation does not support other data-types than floating points.");
+    auto simulationSettings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+    storm::expressions::Expression importanceFunction;
+    if (simulationSettings.isImportanceFunctionSet() && input.model->isPrismProgram()) {
+        storm::expressions::ExpressionManager const& expressionManager = input.model->asPrismProgram().getManager();
+        storm::parser::ExpressionParser expressionParser(expressionManager);
+        std::unordered_map<std::string, storm::expressions::Expression> variableMapping;
+        for (auto const& variableTypePair : expressionManager) {
+            variableMapping[variableTypePair.first.getName()] = variableTypePair.first;
+        }
+        expressionParser.setIdentifierMapping(variableMapping);
+        importanceFunction = expressionParser.parseFromString(simulationSettings.getImportanceFunction());
+    }
+    verifyProperties<ValueType>(input, [&input, &mpi, &importanceFunction](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                           std::shared_ptr<storm::logic::Formula const> const& states) {
+        STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Simulation can only filter initial states.");
+        return storm::api::verifyWithSimulationEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true),
+                                                                 importanceFunction);
+    });
+}
+
+template<typename ValueType>
+void verifyPropertiesForTimePoints(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, SymbolicInput const& input,
+                                   ModelProcessingInformation const& mpi, std::vector<double> const& timePoints) {
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    for (auto const& property : properties) {
+        printModelCheckingProperty(property);
+        storm::utility::Stopwatch watch(true);
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+        try {
+            auto const& states = property.getFilter().getStatesFormula();
+            bool filterForInitialStates = states->isInitialFormula();
+            auto task = storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates);
+            results = storm::api::computeBoundedUntilProbabilitiesForTimePointsWithSparseEngine<ValueType>(mpi.env, sparseModel, task, timePoints);
+
+            std::unique_ptr<storm::modelchecker::CheckResult> filter;
+            if (filterForInitialStates) {
+                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+            } else {
+                filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            }
+            for (auto& result : results) {
+                result->filter(filter->asQualitativeCheckResult());
+            }
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_WARN("Cannot handle property: " << ex.what());
+            results.clear();
+        }
+        watch.stop();
+        if (results.empty()) {
+            STORM_LOG_ERROR("Property is unsupported by selected engine/settings.\n");
+            continue;
+        }
+        for (uint64_t i = 0; i < results.size(); ++i) {
+            STORM_PRINT((storm::utility::resources::isTerminate() ? "Result till abort" : "Result") << " for time point " << timePoints[i] << ": ");
+            printFilteredResult<ValueType>(results[i], property.getFilter().getFilterType());
+        }
+        STORM_PRINT("Time for model checking: " << watch << ".\n");
+    }
+}
+
+template<typename ValueType>
+void applySolverPortfolio(storm::models::sparse::Model<ValueType> const& model, storm::Environment& env) {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_WARN("The solver portfolio does not support parametric models.");
+    } else {
+        storm::utility::SparseSolverPortfolio portfolio;
+        portfolio.predict(model, env);
+        portfolio.applyTo(env, storm::settings::getModule<storm::settings::modules::CoreSettings>().isSolverPortfolioRaceSet());
+        STORM_PRINT_AND_LOG("Solver portfolio picked the following settings: \n\t" << portfolio.toString() << '\n');
+    }
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
+    storm::Environment env = mpi.env;
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isSolverPortfolioSet()) {
+        applySolverPortfolio(*sparseModel, env);
+    }
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
-        bool filterForInitialStates = states->isInitialFormula();
-        auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+    std::shared_ptr<storm::modelchecker::ExplicitSolutionCache<ValueType>> solutionCache;
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isReuseSolutionsSet()) {
+        solutionCache = std::make_shared<storm::modelchecker::ExplicitSolutionCache<ValueType>>();
+    }
+    std::shared_ptr<storm::modelchecker::ExplicitPrecomputationCache> precomputationCache;
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isReusePrecomputationsSet()) {
+        precomputationCache = std::make_shared<storm::modelchecker::ExplicitPrecomputationCache>();
+    }
+    auto const& mcSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+    auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+    bool checkInBatch = mcSettings.isBatchVerificationSet() && !ioSettings.isTimePointsSet();
+    if (checkInBatch && (transformationSettings.isChainEliminationSet() || transformationSettings.isToDiscreteTimeModelSet())) {
+        STORM_LOG_WARN("Properties are not checked as a batch as the model was transformed.");
+        checkInBatch = false;
+    }
+    if (checkInBatch && solutionCache && !precomputationCache) {
+        // The hints for reusing solutions would otherwise hide the qualitative analyses of the batch from each other.
+        precomputationCache = std::make_shared<storm::modelchecker::ExplicitPrecomputationCache>();
+    }
+    auto createTask = [&ioSettings, &solutionCache, &precomputationCache](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                             bool onlyInitialStatesRelevant) {
+        auto task = storm::api::createTask<ValueType>(formula, onlyInitialStatesRelevant);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        if (solutionCache || precomputationCache) {
+            auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+            hint->setSolutionCache(solutionCache);
+            hint->setPrecomputationCache(precomputationCache);
+            task.setHint(hint);
+        }
+        return task;
+    };
+    uint64_t propertyThreads = checkInBatch || ioSettings.isTimePointsSet() ? 1 : mcSettings.getPropertyThreadCount();
+    if (propertyThreads > 1) {
+        sparseModel->prepareForConcurrentAccess();
+    }
+    auto verificationCallback = [&sparseModel, &env, &createTask](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+        // Every property gets its own environment, such that properties can be checked concurrently.
+        storm::Environment propertyEnv = env;
+        bool filterForInitialStates = states->isInitialFormula();
+        auto task = createTask(formula, filterForInitialStates);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(propertyEnv, sparseModel, task);
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
             filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
         } else {
-            filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            filter = storm::api::verifyWithSparseEngine<ValueType>(propertyEnv, sparseModel, storm::api::createTask<ValueType>(states, false));
         }
         if (result && filter) {
             result->filter(filter->asQualitativeCheckResult());
@@ -1149,12 +1463,18 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
                                 "No information of state valuations available. The result output will use internal state ids. You might be interested in "
                                 "building the model with state valuations using --buildstateval.");
             STORM_LOG_WARN_COND(exportCount == 0, "Prepending " << exportCount << " to file name for this property because there are multiple properties.");
-            storm::api::exportCheckResultToJson(sparseModel, result,
-                                                (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportCheckResultFilename());
+            storm::api::exportCheckResult(sparseModel, result,
+                                          (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportCheckResultFilename());
         }
         ++exportCount;
     };
-    verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+    if (ioSettings.isTimePointsSet()) {
+        verifyPropertiesForTimePoints<ValueType>(sparseModel, input, mpi, ioSettings.getTimePoints());
+    } else if (checkInBatch) {
+        verifyPropertiesInBatch<ValueType>(input, sparseModel, env, createTask, postprocessingCallback);
+    } else {
+        verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback, propertyThreads);
+    }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
         storm::utility::Stopwatch watch(true);
         std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1316,6 +1636,8 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Simulation) {
+        verifyWithSimulationEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
@@ -19,6 +19,30 @@ inline std::size_t usedCPU() {
     return std::size_t(clock()) / CLOCKS_PER_SEC;
 }
 
+/*!
+ * Get the peak memory usage (i.e. the maximum resident set size) from the given resource usage.
+ * @return Peak memory usage in KB.
+ */
+inline uint64_t getPeakMemoryUsage(struct rusage const& ru) {
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss / 1024;
+#else
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss;
+#endif
+}
+
+/*!
+ * Get the peak memory usage of this process.
+ * @return Peak memory usage in KB.
+ */
+inline uint64_t getPeakMemoryUsage() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return getPeakMemoryUsage(ru);
+}
+
 /*!
  * Get memory limit.
  * @return Memory limit in MB.
@@ -0,0 +1,300 @@
+#include "storm-cli-utilities/server.h"
+
+#include <iostream>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/builder/ConstantSweepModelBuilder.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
+#include "storm/modelchecker/hints/ExplicitSolutionCache.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace cli {
+
+namespace detail {
+// The error codes defined by JSON-RPC 2.0 (and one for errors that occur while model checking).
+int64_t const parseErrorCode = -32700;
+int64_t const invalidRequestCode = -32600;
+int64_t const methodNotFoundCode = -32601;
+int64_t const invalidParamsCode = -32602;
+int64_t const internalErrorCode = -32603;
+int64_t const stormErrorCode = -32000;
+
+storm::json<double> createError(int64_t code, std::string const& message) {
+    storm::json<double> error;
+    error["code"] = code;
+    error["message"] = message;
+    return error;
+}
+
+std::string getStringParameter(storm::json<double> const& params, std::string const& name) {
+    STORM_LOG_THROW(params.is_object() && params.count(name) > 0 && params[name].is_string(), storm::exceptions::InvalidArgumentException,
+                    "Expected the string parameter '" << name << "'.");
+    return params[name].get<std::string>();
+}
+
+std::string getStringParameter(storm::json<double> const& params, std::string const& name, std::string const& defaultValue) {
+    if (!params.is_object() || params.count(name) == 0) {
+        return defaultValue;
+    }
+    return getStringParameter(params, name);
+}
+
+uint64_t getUnsignedParameter(storm::json<double> const& params, std::string const& name) {
+    STORM_LOG_THROW(params.is_object() && params.count(name) > 0 && params[name].is_number_unsigned(), storm::exceptions::InvalidArgumentException,
+                    "Expected the non-negative integer parameter '" << name << "'.");
+    return params[name].get<uint64_t>();
+}
+
+storm::json<double> toJson(storm::modelchecker::CheckResult const& result) {
+    if (result.isExplicitQuantitativeCheckResult()) {
+        return result.asExplicitQuantitativeCheckResult<double>().toJson();
+    } else if (result.isExplicitQualitativeCheckResult()) {
+        return result.asExplicitQualitativeCheckResult().toJson<double>();
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The result can not be converted to JSON.");
+}
+}  // namespace detail
+
+ModelCheckingServer::ModelCheckingServer() : nextResultId(0), shutdownRequested(false) {
+    // Intentionally left empty.
+}
+
+ModelCheckingServer::~ModelCheckingServer() = default;
+
+void ModelCheckingServer::run(std::istream& in, std::ostream& out) {
+    std::string line;
+    while (!shutdownRequested && std::getline(in, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        std::string response = handleRequest(line);
+        if (!response.empty()) {
+            // Flush every response, since the client waits for it before sending the next request.
+            out << response << std::endl;
+        }
+    }
+}
+
+std::string ModelCheckingServer::handleRequest(std::string const& request) {
+    storm::json<double> response;
+    response["jsonrpc"] = "2.0";
+    response["id"] = nullptr;
+
+    storm::json<double> parsedRequest;
+    try {
+        parsedRequest = storm::json<double>::parse(request);
+    } catch (std::exception const& e) {
+        response["error"] = detail::createError(detail::parseErrorCode, std::string("Unable to parse the request: ") + e.what());
+        return response.dump();
+    }
+    if (!parsedRequest.is_object() || parsedRequest.count("method") == 0 || !parsedRequest["method"].is_string()) {
+        response["error"] = detail::createError(detail::invalidRequestCode, "The request is not a JSON-RPC request.");
+        return response.dump();
+    }
+
+    bool isNotification = parsedRequest.count("id") == 0;
+    if (!isNotification) {
+        response["id"] = parsedRequest["id"];
+    }
+    std::string method = parsedRequest["method"].get<std::string>();
+    storm::json<double> params = parsedRequest.count("params") > 0 ? parsedRequest["params"] : storm::json<double>::object();
+
+    try {
+        if (method == "load") {
+            response["result"] = load(params);
+        } else if (method == "unload") {
+            response["result"] = unload(params);
+        } else if (method == "models") {
+            response["result"] = listModels();
+        } else if (method == "check") {
+            response["result"] = check(params);
+        } else if (method == "result") {
+            response["result"] = getResult(params);
+        } else if (method == "release") {
+            response["result"] = release(params);
+        } else if (method == "shutdown") {
+            shutdownRequested = true;
+            response["result"] = true;
+        } else {
+            response["error"] = detail::createError(detail::methodNotFoundCode, "Unknown method '" + method + "'.");
+        }
+    } catch (storm::exceptions::InvalidArgumentException const& e) {
+        response["error"] = detail::createError(detail::invalidParamsCode, e.what());
+    } catch (storm::exceptions::BaseException const& e) {
+        response["error"] = detail::createError(detail::stormErrorCode, e.what());
+    } catch (std::exception const& e) {
+        response["error"] = detail::createError(detail::internalErrorCode, e.what());
+    }
+    return isNotification ? "" : response.dump();
+}
+
+bool ModelCheckingServer::isShutdownRequested() const {
+    return shutdownRequested;
+}
+
+storm::json<double> ModelCheckingServer::load(storm::json<double> const& params) {
+    std::string id = detail::getStringParameter(params, "id");
+    std::string file = detail::getStringParameter(params, "file");
+    bool isJani = file.size() >= 5 && file.compare(file.size() - 5, 5, ".jani") == 0;
+    std::string format = detail::getStringParameter(params, "format", isJani ? "jani" : "prism");
+    STORM_LOG_THROW(format == "prism" || format == "jani", storm::exceptions::InvalidArgumentException, "Unknown model format '" << format << "'.");
+
+    LoadedModel loadedModel;
+    if (format == "jani") {
+        loadedModel.description = storm::api::parseJaniModel(file).first;
+    } else {
+        loadedModel.description = storm::api::parseProgram(file);
+        loadedModel.sweepBuilder = std::make_shared<storm::builder::ConstantSweepModelBuilder<double>>(loadedModel.description.asPrismProgram(),
+                                                                                                        storm::builder::BuilderOptions(true, true));
+    }
+
+    // A reloaded model replaces the previous one together with its results.
+    unload(params);
+    models[id] = std::move(loadedModel);
+
+    storm::json<double> result;
+    result["id"] = id;
+    result["constants"] = storm::json<double>::array();
+    for (auto const& constant : models[id].description.getUndefinedConstants()) {
+        result["constants"].push_back(constant.getName());
+    }
+    return result;
+}
+
+storm::json<double> ModelCheckingServer::unload(storm::json<double> const& params) {
+    std::string id = detail::getStringParameter(params, "id");
+    for (auto it = results.begin(); it != results.end();) {
+        if (it->second.modelId == id) {
+            it = results.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return models.erase(id) > 0;
+}
+
+storm::json<double> ModelCheckingServer::listModels() const {
+    storm::json<double> result = storm::json<double>::array();
+    for (auto const& idModel : models) {
+        storm::json<double> entry;
+        entry["id"] = idModel.first;
+        entry["format"] = idModel.second.description.isJaniModel() ? "jani" : "prism";
+        entry["builds"] = storm::json<double>::array();
+        for (auto const& constantsModel : idModel.second.builtModels) {
+            storm::json<double> build;
+            build["constants"] = constantsModel.first;
+            build["states"] = constantsModel.second.model->getNumberOfStates();
+            build["transitions"] = constantsModel.second.model->getNumberOfTransitions();
+            entry["builds"].push_back(build);
+        }
+        result.push_back(entry);
+    }
+    return result;
+}
+
+storm::json<double> ModelCheckingServer::check(storm::json<double> const& params) {
+    std::string modelId = detail::getStringParameter(params, "model");
+    std::string constants = detail::getStringParameter(params, "constants", "");
+    LoadedModel& loadedModel = getLoadedModel(modelId);
+
+    auto properties = storm::api::parsePropertiesForSymbolicModelDescription(detail::getStringParameter(params, "property"), loadedModel.description);
+    properties = storm::api::substituteConstantsInProperties(properties, loadedModel.description.parseConstantDefinitions(constants));
+    BuiltModel& builtModel = getBuiltModel(loadedModel, constants);
+
+    storm::json<double> result = storm::json<double>::array();
+    for (auto const& property : properties) {
+        // The result is computed for all states such that it can be requested later.
+        auto task = storm::api::createTask<double>(property.getRawFormula(), false);
+        auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<double>>();
+        hint->setPrecomputationCache(builtModel.precomputationCache);
+        hint->setSolutionCache(builtModel.solutionCache);
+        task.setHint(hint);
+        std::unique_ptr<storm::modelchecker::CheckResult> checkResult = storm::api::verifyWithSparseEngine<double>(env, builtModel.model, task);
+        STORM_LOG_THROW(checkResult, storm::exceptions::NotSupportedException, "Unable to check the property '" << property.getName() << "'.");
+
+        std::unique_ptr<storm::modelchecker::CheckResult> initialStatesResult = checkResult->clone();
+        initialStatesResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(builtModel.model->getInitialStates()));
+        storm::json<double> entry;
+        entry["name"] = property.getName();
+        entry["id"] = nextResultId;
+        entry["values"] = detail::toJson(*initialStatesResult);
+        result.push_back(entry);
+
+        results[nextResultId++] = StoredResult{modelId, builtModel.model->getNumberOfStates(), std::move(checkResult)};
+    }
+    return result;
+}
+
+storm::json<double> ModelCheckingServer::getResult(storm::json<double> const& params) const {
+    uint64_t id = detail::getUnsignedParameter(params, "id");
+    auto resultIt = results.find(id);
+    STORM_LOG_THROW(resultIt != results.end(), storm::exceptions::InvalidArgumentException, "Unknown result " << id << ".");
+    StoredResult const& storedResult = resultIt->second;
+    if (params.count("states") == 0) {
+        return detail::toJson(*storedResult.result);
+    }
+
+    STORM_LOG_THROW(params["states"].is_array(), storm::exceptions::InvalidArgumentException, "Expected an array of states.");
+    storm::storage::BitVector states(storedResult.numberOfStates);
+    for (auto const& state : params["states"]) {
+        STORM_LOG_THROW(state.is_number_unsigned() && state.get<uint64_t>() < storedResult.numberOfStates, storm::exceptions::InvalidArgumentException,
+                        "The state " << state.dump() << " is not a state of the model.");
+        states.set(state.get<uint64_t>());
+    }
+    std::unique_ptr<storm::modelchecker::CheckResult> filteredResult = storedResult.result->clone();
+    filteredResult->filter(storm::modelchecker::ExplicitQualitativeCheckResult(std::move(states)));
+    return detail::toJson(*filteredResult);
+}
+
+storm::json<double> ModelCheckingServer::release(storm::json<double> const& params) {
+    return results.erase(detail::getUnsignedParameter(params, "id")) > 0;
+}
+
+ModelCheckingServer::LoadedModel& ModelCheckingServer::getLoadedModel(std::string const& id) {
+    auto modelIt = models.find(id);
+    STORM_LOG_THROW(modelIt != models.end(), storm::exceptions::InvalidArgumentException, "Unknown model '" << id << "'.");
+    return modelIt->second;
+}
+
+ModelCheckingServer::BuiltModel& ModelCheckingServer::getBuiltModel(LoadedModel& loadedModel, std::string const& constants) {
+    auto builtModelIt = loadedModel.builtModels.find(constants);
+    if (builtModelIt != loadedModel.builtModels.end()) {
+        return builtModelIt->second;
+    }
+
+    // All labels and reward models are built, such that later properties can be checked on the same model.
+    BuiltModel builtModel;
+    if (loadedModel.sweepBuilder && !loadedModel.sweepBuilder->getValueConstants().empty()) {
+        builtModel.model = loadedModel.sweepBuilder->build(loadedModel.description.parseConstantDefinitions(constants));
+    } else {
+        storm::storage::SymbolicModelDescription description = loadedModel.description.preprocess(constants);
+        builtModel.model = storm::api::buildSparseModel<double>(description, storm::builder::BuilderOptions(true, true));
+    }
+    STORM_LOG_THROW(builtModel.model, storm::exceptions::NotSupportedException, "Unable to build the model.");
+    builtModel.precomputationCache = std::make_shared<storm::modelchecker::ExplicitPrecomputationCache>();
+    builtModel.solutionCache = std::make_shared<storm::modelchecker::ExplicitSolutionCache<double>>();
+    return loadedModel.builtModels.emplace(constants, std::move(builtModel)).first->second;
+}
+
+void runServer() {
+    std::ostream responses(std::cout.rdbuf());
+    std::streambuf* stdoutBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+    STORM_LOG_INFO("Model checking server is waiting for requests.");
+    ModelCheckingServer server;
+    server.run(std::cin, responses);
+    std::cout.rdbuf(stdoutBuffer);
+}
+
+}  // namespace cli
+}  // namespace storm
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace builder {
+template<typename ValueType>
+class ConstantSweepModelBuilder;
+}  // namespace builder
+
+namespace models {
+namespace sparse {
+template<typename ValueType>
+class StandardRewardModel;
+template<typename ValueType, typename RewardModelType>
+class Model;
+}  // namespace sparse
+}  // namespace models
+
+namespace modelchecker {
+class CheckResult;
+class ExplicitPrecomputationCache;
+template<typename ValueType>
+class ExplicitSolutionCache;
+}  // namespace modelchecker
+
+namespace cli {
+
+/*!
+ * A long-running model checking server that keeps parsed and built models (together with the results of their precomputations) in memory, such
+ * that many queries against the same models only pay for the model checking itself. The server reads JSON-RPC 2.0 requests, one per line, and
+ * writes one response per line. The supported methods are
+ *
+ *  - load {id, file, format?}: parses the PRISM (default) or JANI (format "jani" or file extension ".jani") model in the given file.
+ *  - unload {id}: removes the model and all results computed for it.
+ *  - models {}: lists the loaded models and the constant definitions for which they were built.
+ *  - check {model, property, constants?}: checks the given properties, building the model for the given constant definitions if needed. The
+ *    response contains the values in the initial states and an identifier of each result. If only constants that occur in the probabilities
+ *    (or rates) and rewards of a PRISM program change, the state space of a previous build is reused.
+ *  - result {id, states?}: retrieves the values of a previously computed result for all or for the given states.
+ *  - release {id}: removes a previously computed result.
+ *  - shutdown {}: stops the server.
+ */
+class ModelCheckingServer {
+   public:
+    ModelCheckingServer();
+    ~ModelCheckingServer();
+
+    /*!
+     * Answers the requests read from the given stream until the stream ends or a shutdown is requested.
+     */
+    void run(std::istream& in, std::ostream& out);
+
+    /*!
+     * Answers the given request.
+     *
+     * @param request A JSON-RPC request.
+     * @return The response or an empty string if the request is a notification (i.e., has no id).
+     */
+    std::string handleRequest(std::string const& request);
+
+    /*!
+     * Retrieves whether a shutdown was requested.
+     */
+    bool isShutdownRequested() const;
+
+   private:
+    typedef storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<double>> SparseModelType;
+
+    // A model built for one definition of the undefined constants.
+    struct BuiltModel {
+        std::shared_ptr<SparseModelType> model;
+        std::shared_ptr<storm::modelchecker::ExplicitPrecomputationCache> precomputationCache;
+        std::shared_ptr<storm::modelchecker::ExplicitSolutionCache<double>> solutionCache;
+    };
+
+    struct LoadedModel {
+        storm::storage::SymbolicModelDescription description;
+        // For PRISM programs, builds the models for constant definitions that only differ in the transition values without exploring again.
+        std::shared_ptr<storm::builder::ConstantSweepModelBuilder<double>> sweepBuilder;
+        // The built models indexed by their constant definition string.
+        std::map<std::string, BuiltModel> builtModels;
+    };
+
+    struct StoredResult {
+        std::string modelId;
+        uint64_t numberOfStates;
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+    };
+
+    storm::json<double> load(storm::json<double> const& params);
+    storm::json<double> unload(storm::json<double> const& params);
+    storm::json<double> listModels() const;
+    storm::json<double> check(storm::json<double> const& params);
+    storm::json<double> getResult(storm::json<double> const& params) const;
+    storm::json<double> release(storm::json<double> const& params);
+
+    LoadedModel& getLoadedModel(std::string const& id);
+    BuiltModel& getBuiltModel(LoadedModel& loadedModel, std::string const& constants);
+
+    storm::Environment env;
+    std::map<std::string, LoadedModel> models;
+    std::map<uint64_t, StoredResult> results;
+    uint64_t nextResultId;
+    bool shutdownRequested;
+};
+
+/*!
+ * Runs the model checking server on standard input and output. Everything that Storm prints while answering requests is redirected to the
+ * standard error stream, such that the standard output only contains the responses.
+ */
+void runServer();
+
+}  // namespace cli
+}  // namespace storm
@@ -106,12 +106,13 @@ void processPrismInputJaniOutput(storm::prism::Program const& prismProg, std::ve
     auto exportingTime = startStopwatch("Exporting JANI model ... ");
 
     if (outputFilename != "") {
-        storm::api::exportJaniToFile(janiModelProperties.first, janiModelProperties.second, outputFilename, jani.isCompactJsonSet());
+        storm::api::exportJaniToFile(janiModelProperties.first, janiModelProperties.second, outputFilename, jani.isCompactJsonSet(),
+                                     jani.isParallelExportSet());
         STORM_PRINT_AND_LOG("Stored to file '" << outputFilename << "'");
     }
 
     if (output.isStdOutOutputEnabled()) {
-        storm::api::printJaniToStream(janiModelProperties.first, janiModelProperties.second, std::cout, jani.isCompactJsonSet());
+        storm::api::printJaniToStream(janiModelProperties.first, janiModelProperties.second, std::cout, jani.isCompactJsonSet(), jani.isParallelExportSet());
     }
     stopStopwatch(exportingTime);
 }
@@ -242,12 +243,12 @@ void processJaniInputJaniOutput(storm::jani::Model const& janiModel, std::vector
     auto exportingTime = startStopwatch("Exporting JANI model ... ");
 
     if (outputFilename != "") {
-        storm::api::exportJaniToFile(transformedJaniModel, transformedProperties, outputFilename, jani.isCompactJsonSet());
+        storm::api::exportJaniToFile(transformedJaniModel, transformedProperties, outputFilename, jani.isCompactJsonSet(), jani.isParallelExportSet());
         STORM_PRINT_AND_LOG("Stored to file '" << outputFilename << "'");
     }
 
     if (output.isStdOutOutputEnabled()) {
-        storm::api::printJaniToStream(transformedJaniModel, transformedProperties, std::cout, jani.isCompactJsonSet());
+        storm::api::printJaniToStream(transformedJaniModel, transformedProperties, std::cout, jani.isCompactJsonSet(), jani.isParallelExportSet());
     }
     stopStopwatch(exportingTime);
 }
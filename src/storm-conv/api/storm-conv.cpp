@@ -129,12 +129,14 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> convertPrismTo
     return res;
 }
 
-void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact) {
-    storm::jani::JsonExporter::toFile(model, properties, filename, true, compact);
+void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact,
+                      bool parallel) {
+    storm::jani::JsonExporter::toFile(model, properties, filename, true, compact, parallel);
 }
 
-void printJaniToStream(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::ostream& ostream, bool compact) {
-    storm::jani::JsonExporter::toStream(model, properties, ostream, true, compact);
+void printJaniToStream(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::ostream& ostream, bool compact,
+                       bool parallel) {
+    storm::jani::JsonExporter::toStream(model, properties, ostream, true, compact, parallel);
 }
 
 void exportPrismToFile(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties, std::string const& filename) {
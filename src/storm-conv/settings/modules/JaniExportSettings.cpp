@@ -20,6 +20,7 @@ const std::string JaniExportSettings::locationVariablesOptionName = "location-va
 const std::string JaniExportSettings::globalVariablesOptionName = "globalvars";
 const std::string JaniExportSettings::localVariablesOptionName = "localvars";
 const std::string JaniExportSettings::compactJsonOptionName = "compactjson";
+const std::string JaniExportSettings::parallelExportOptionName = "parallel-export";
 const std::string JaniExportSettings::eliminateArraysOptionName = "remove-arrays";
 const std::string JaniExportSettings::eliminateFunctionsOptionName = "remove-functions";
 const std::string JaniExportSettings::replaceUnassignedVariablesWithConstantsOptionName = "replace-unassigned-vars";
@@ -49,6 +50,9 @@ JaniExportSettings::JaniExportSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, compactJsonOptionName, false,
                                                    "If set, the size of the resulting jani file will be reduced at the cost of (human-)readability.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelExportOptionName, false,
+                                                   "If set, the edges of the automata are converted to jani in parallel (requires Intel TBB).")
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, eliminateArraysOptionName, false,
                                                    "If set, transforms the model such that array variables/expressions are eliminated.")
                         .build());
@@ -119,6 +123,10 @@ bool JaniExportSettings::isCompactJsonSet() const {
     return this->getOption(compactJsonOptionName).getHasOptionBeenSet();
 }
 
+bool JaniExportSettings::isParallelExportSet() const {
+    return this->getOption(parallelExportOptionName).getHasOptionBeenSet();
+}
+
 bool JaniExportSettings::isEliminateArraysSet() const {
     return this->getOption(eliminateArraysOptionName).getHasOptionBeenSet();
 }
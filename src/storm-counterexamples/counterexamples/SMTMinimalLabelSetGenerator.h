@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 #include <queue>
 
 #include "storm-counterexamples/counterexamples/GuaranteedLabelSet.h"
@@ -1273,6 +1274,54 @@ class SMTMinimalLabelSetGenerator {
         return getUsedLabelSet(*solver.getModel(), variableInformation);
     }
 
+    /*!
+     * Computes a lower bound on the number of labels that need to be enabled by extracting disjoint unsatisfiable cores. Each core is a set of
+     * labels at least one of which must be enabled, so the number of disjoint cores bounds the size of every solution from below. The at-most-k
+     * constraints are relaxed up to this bound such that the linear search of findSmallestCommandSet starts from there. All clauses learned by the
+     * solver while extracting the cores are kept for the subsequent (incremental) calls.
+     *
+     * @param solver The solver to use for the satisfiability evaluation.
+     * @param variableInformation A structure with information about the variables of the solver.
+     * @param currentBound The currently known lower bound for the number of labels that need to be enabled. It is raised to the core-guided bound.
+     */
+    static void raiseBoundByUnsatCores(storm::solver::SmtSolver& solver, VariableInformation& variableInformation, uint_fast64_t& currentBound) {
+        // Assume all labels that are not part of a core found so far to be disabled.
+        std::map<storm::expressions::Variable, storm::expressions::Expression> remainingAssumptions;
+        for (auto const& labelVariable : variableInformation.minimalityLabelVariables) {
+            remainingAssumptions.emplace(labelVariable, !labelVariable);
+        }
+
+        uint_fast64_t coreBound = currentBound;
+        while (!remainingAssumptions.empty()) {
+            std::set<storm::expressions::Expression> assumptions;
+            for (auto const& variableAssumptionPair : remainingAssumptions) {
+                assumptions.insert(variableAssumptionPair.second);
+            }
+            if (solver.checkWithAssumptions(assumptions) != storm::solver::SmtSolver::CheckResult::Unsat) {
+                break;
+            }
+
+            // The core is returned as freshly translated expressions, so we identify the assumptions by their variables.
+            uint_fast64_t removedAssumptions = 0;
+            for (auto const& coreExpression : solver.getUnsatAssumptions()) {
+                for (auto const& variable : coreExpression.getVariables()) {
+                    removedAssumptions += remainingAssumptions.erase(variable);
+                }
+            }
+            if (removedAssumptions == 0) {
+                // The constraint system is unsatisfiable regardless of the labels.
+                break;
+            }
+            ++coreBound;
+        }
+        STORM_LOG_DEBUG("Unsatisfiable cores yield lower bound " << coreBound << " on the number of labels.");
+
+        while (currentBound < coreBound) {
+            solver.add(variableInformation.auxiliaryVariables.back());
+            variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(solver, variableInformation, ++currentBound));
+        }
+    }
+
     static void ruleOutSingleSolution(storm::solver::SmtSolver& solver, storm::storage::FlatSet<uint_fast64_t> const& labelSet,
                                       VariableInformation& variableInformation, RelevancyInformation const& relevancyInformation) {
         std::vector<storm::expressions::Expression> formulae;
@@ -1698,11 +1747,13 @@ class SMTMinimalLabelSetGenerator {
 
             encodeReachability = settings.isEncodeReachabilitySet();
             useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+            useCoreGuidedBound = settings.isUseCoreGuidedBoundSet();
         }
 
         bool checkThresholdFeasible;
         bool encodeReachability;
         bool useDynamicConstraints;
+        bool useCoreGuidedBound;
         bool silent = false;
         bool addBackwardImplicationCuts = true;
         uint64_t continueAfterFirstCounterexampleUntil = 0;
@@ -1851,6 +1902,11 @@ class SMTMinimalLabelSetGenerator {
         uint_fast64_t zeroProbabilityCount = 0;
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
+        if (options.useCoreGuidedBound) {
+            solverClock = std::chrono::high_resolution_clock::now();
+            raiseBoundByUnsatCores(*solver, variableInformation, currentBound);
+            totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
+        }
         do {
             ++iterations;
 
@@ -21,6 +21,7 @@ const std::string CounterexampleGeneratorSettings::minimalCommandMethodOptionNam
 const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
 const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
 const std::string CounterexampleGeneratorSettings::noDynamicConstraintsOptionName = "nodyn";
+const std::string CounterexampleGeneratorSettings::noCoreGuidedBoundOptionName = "nocorebound";
 
 CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false,
@@ -64,6 +65,11 @@ CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSetti
                                                    "Disables the generation of dynamic constraints in the MAXSAT-based counterexample generation.")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, noCoreGuidedBoundOptionName, true,
+                                                   "Disables the computation of an initial lower bound from unsatisfiable cores in the MAXSAT-based "
+                                                   "counterexample generation.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool CounterexampleGeneratorSettings::isCounterexampleSet() const {
@@ -106,6 +112,10 @@ bool CounterexampleGeneratorSettings::isUseDynamicConstraintsSet() const {
     return !this->getOption(noDynamicConstraintsOptionName).getHasOptionBeenSet();
 }
 
+bool CounterexampleGeneratorSettings::isUseCoreGuidedBoundSet() const {
+    return !this->getOption(noCoreGuidedBoundOptionName).getHasOptionBeenSet();
+}
+
 bool CounterexampleGeneratorSettings::check() const {
     STORM_LOG_THROW(isCounterexampleSet() || !isCounterexampleTypeSet(), storm::exceptions::InvalidSettingsException,
                     "Counterexample type was set but counterexample flag '-cex' is missing.");
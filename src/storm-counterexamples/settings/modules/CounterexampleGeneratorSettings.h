@@ -91,6 +91,13 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     bool isUseDynamicConstraintsSet() const;
 
+    /*!
+     * Retrieves whether to compute an initial lower bound from unsatisfiable cores in the MAXSAT-based technique.
+     *
+     * @return True iff the core-guided lower bound is to be used.
+     */
+    bool isUseCoreGuidedBoundSet() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -106,6 +113,7 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
     static const std::string encodeReachabilityOptionName;
     static const std::string schedulerCutsOptionName;
     static const std::string noDynamicConstraintsOptionName;
+    static const std::string noCoreGuidedBoundOptionName;
 };
 
 }  // namespace modules
@@ -1,6 +1,10 @@
 #include "ExplicitDFTModelBuilder.h"
 
+#include <atomic>
+#include <exception>
 #include <map>
+#include <thread>
+#include <type_traits>
 
 #include <storm/exceptions/IllegalArgumentException.h>
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -42,6 +46,7 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
       matrixBuilder(!generator.isDeterministicModel()),
       stateStorage(dft.stateBitVectorSize()),
       explorationQueue(1, 0, 0.9, false) {
+    numberOfExplorationThreads = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getNumberOfExplorationThreads();
     // Set relevant events
     STORM_LOG_DEBUG("Relevant events: " << this->dft.getRelevantEventsString());
     if (dft.getRelevantEvents().size() <= 1) {
@@ -369,156 +374,277 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
     size_t nrSkippedStates = 0;
     storm::utility::ProgressMeasurement progress("explored states");
     progress.startNewMeasurement(0);
-    // TODO: do not empty queue every time but break before
+    if (numberOfExplorationThreads > 1 && std::is_same<ValueType, double>::value) {
+        exploreStateSpaceConcurrently(approximationThreshold, nrExpandedStates, nrSkippedStates, progress);
+    } else {
+        STORM_LOG_WARN_COND(numberOfExplorationThreads <= 1, "Concurrent state space exploration is only supported for models with double values.");
+        // TODO: do not empty queue every time but break before
+        while (!explorationQueue.empty()) {
+            // Get the first state in the queue
+            auto stateHeuristicPair = popNextState();
+            DFTStatePointer currentState = stateHeuristicPair.first;
+            ExplorationHeuristicPointer currentExplorationHeuristic = stateHeuristicPair.second;
+
+            // Remember that the current row group was actually filled with the transitions of a different state
+            matrixBuilder.setRemapping(currentState->getId());
+
+            matrixBuilder.newRowGroup();
+
+            // if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
+            if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
+                // Skip the current state
+                ++nrSkippedStates;
+                skipState(currentState, currentExplorationHeuristic);
+            } else {
+                // Explore the current state
+                ++nrExpandedStates;
+                generator.load(currentState);
+                storm::generator::StateBehavior<ValueType, StateType> behavior =
+                    generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
+                addBehavior(currentExplorationHeuristic, behavior);
+            }
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+            // Output number of currently explored states
+            if (nrExpandedStates % 100 == 0) {
+                progress.updateProgress(nrExpandedStates);
+            }
+        }  // end exploration
+    }
+
+    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
+    STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
+    STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpaceConcurrently(double approximationThreshold, size_t& nrExpandedStates,
+                                                                                  size_t& nrSkippedStates, storm::utility::ProgressMeasurement& progress) {
+    // Each thread uses its own copy of the generator
+    std::vector<storm::dft::generator::DftNextStateGenerator<ValueType, StateType>> generators(numberOfExplorationThreads, generator);
+    size_t const batchSize = numberOfExplorationThreads * EXPLORATION_BATCH_SIZE_PER_THREAD;
+
+    std::vector<std::pair<DFTStatePointer, ExplorationHeuristicPointer>> batch;
+    std::vector<bool> skipped;
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+    // The successor states generated for each state of the batch. They are referred to by temporary ids until they are added to the state storage.
+    std::vector<std::vector<DFTStatePointer>> successors;
     while (!explorationQueue.empty()) {
-        // Get the first state in the queue
-        ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-        StateType currentId = currentExplorationHeuristic->getId();
-        auto itFind = statesNotExplored.find(currentId);
-        STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-        DFTStatePointer currentState = itFind->second.first;
-        STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-        STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
-        // Remove it from the list of not explored states
-        statesNotExplored.erase(itFind);
-        STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
-        STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
-
-        // Get concrete state if necessary
-        if (currentState->isPseudoState()) {
-            // Create concrete state from pseudo state
-            currentState->construct();
-        }
-        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-        // Remember that the current row group was actually filled with the transitions of a different state
-        matrixBuilder.setRemapping(currentId);
-
-        matrixBuilder.newRowGroup();
-
-        // Try to explore the next state
-        generator.load(currentState);
-
-        // if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
-        if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
-            // Skip the current state
-            ++nrSkippedStates;
-            STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
-            setMarkovian(true);
-            // Add transition to target state with temporary value 0
-            // TODO: what to do when there is no unique target state?
-            // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
-            matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
-            // Remember skipped state
-            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
-            matrixBuilder.finishRow();
-        } else {
-            // Explore the current state
-            ++nrExpandedStates;
-            storm::generator::StateBehavior<ValueType, StateType> behavior =
-                generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-            STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-            setMarkovian(behavior.begin()->isMarkovian());
+        // Take the next states from the queue
+        batch.clear();
+        skipped.clear();
+        while (batch.size() < batchSize && !explorationQueue.empty()) {
+            batch.push_back(popNextState());
+            skipped.push_back(approximationThreshold > 0.0 && batch.back().second->isSkip(approximationThreshold));
+        }
+        behaviors.assign(batch.size(), storm::generator::StateBehavior<ValueType, StateType>());
+        successors.assign(batch.size(), std::vector<DFTStatePointer>());
+
+        // Expand the states concurrently
+        std::atomic<size_t> nextIndex(0);
+        auto expandStates = [&](uint64_t thread) {
+            for (size_t index = nextIndex++; index < batch.size(); index = nextIndex++) {
+                if (skipped[index]) {
+                    continue;
+                }
+                auto& stateSuccessors = successors[index];
+                generators[thread].load(batch[index].first);
+                behaviors[index] = generators[thread].expand([&stateSuccessors, this](DFTStatePointer const& state) {
+                    stateSuccessors.push_back(state);
+                    return static_cast<StateType>(OFFSET_CONCURRENT_SUCCESSOR + stateSuccessors.size() - 1);
+                });
+            }
+        };
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> exceptions(numberOfExplorationThreads);
+        for (uint64_t thread = 0; thread < numberOfExplorationThreads; ++thread) {
+            threads.emplace_back([&, thread]() {
+                try {
+                    expandStates(thread);
+                } catch (...) {
+                    exceptions[thread] = std::current_exception();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
 
-            // Now add all choices.
-            for (auto const& choice : behavior) {
-                // Add the probabilistic behavior to the matrix.
+        // Add the states in the order in which they were taken from the queue
+        std::vector<StateType> successorIds;
+        for (size_t index = 0; index < batch.size(); ++index) {
+            DFTStatePointer const& currentState = batch[index].first;
+            matrixBuilder.setRemapping(currentState->getId());
+            matrixBuilder.newRowGroup();
+            if (skipped[index]) {
+                ++nrSkippedStates;
+                skipState(currentState, batch[index].second);
+                continue;
+            }
+            ++nrExpandedStates;
+            successorIds.clear();
+            for (auto const& successor : successors[index]) {
+                successorIds.push_back(getOrAddStateIndex(successor));
+            }
+            // Replace the temporary ids (different temporary ids might refer to the same state)
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            for (auto const& choice : behaviors[index]) {
+                storm::generator::Choice<ValueType, StateType> resolvedChoice(choice.getActionIndex(), choice.isMarkovian());
                 for (auto const& stateProbabilityPair : choice) {
-                    STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
-                    // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                    matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
-                    // Set heuristic values for reached states
-                    auto iter = statesNotExplored.find(stateProbabilityPair.first);
-                    if (iter != statesNotExplored.end()) {
-                        // Update heuristic values
-                        DFTStatePointer state = iter->second.first;
-                        if (!iter->second.second) {
-                            // Initialize heuristic values
-                            ExplorationHeuristicPointer heuristic;
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    heuristic =
-                                        std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-
-                            iter->second.second = heuristic;
-                            // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
-                            // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
-                            // !state->getFailableElements().hasBEs())) {
-                            if (state->getFailableElements().hasDependencies() ||
-                                (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                // Do not skip absorbing state or if reached by dependencies
-                                iter->second.second->markExpand();
-                            }
-                            if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
-                                // Compute bounds for heuristic now
-                                if (state->isPseudoState()) {
-                                    // Create concrete state from pseudo state
-                                    state->construct();
-                                }
-                                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                                // Initialize bounds
-                                // TODO: avoid hack
-                                ValueType lowerBound = getLowerBound(state);
-                                ValueType upperBound = getUpperBound(state);
-                                heuristic->setBounds(lowerBound, upperBound);
-                            }
-
-                            explorationQueue.push(heuristic);
-                        } else if (!iter->second.second->isExpand()) {
-                            bool changedPriority = false;
-                            double oldPriority = iter->second.second->getPriority();
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
-                                                                                                 /* next values are irrelevant */ stateProbabilityPair.second,
-                                                                                                 stateProbabilityPair.second);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-                            if (changedPriority) {
-                                // Update priority queue
-                                explorationQueue.update(iter->second.second, oldPriority);
-                            }
-                        }
-                    }
+                    StateType id = stateProbabilityPair.first;
+                    resolvedChoice.addProbability(id >= OFFSET_CONCURRENT_SUCCESSOR ? successorIds[id - OFFSET_CONCURRENT_SUCCESSOR] : id,
+                                                  stateProbabilityPair.second);
                 }
-                matrixBuilder.finishRow();
+                behavior.addChoice(std::move(resolvedChoice));
             }
+            behavior.setExpanded();
+            addBehavior(batch[index].second, behavior);
         }
+
         if (storm::utility::resources::isTerminate()) {
             break;
         }
-        // Output number of currently explored states
-        if (nrExpandedStates % 100 == 0) {
-            progress.updateProgress(nrExpandedStates);
-        }
-    }  // end exploration
+        progress.updateProgress(nrExpandedStates);
+    }
+}
 
-    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
-    STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
-    STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
+template<typename ValueType, typename StateType>
+std::pair<typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer,
+          typename ExplicitDFTModelBuilder<ValueType, StateType>::ExplorationHeuristicPointer>
+ExplicitDFTModelBuilder<ValueType, StateType>::popNextState() {
+    ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
+    StateType currentId = currentExplorationHeuristic->getId();
+    auto itFind = statesNotExplored.find(currentId);
+    STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+    DFTStatePointer currentState = itFind->second.first;
+    STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
+    STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+    // Remove it from the list of not explored states
+    statesNotExplored.erase(itFind);
+    STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
+    STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
+
+    // Get concrete state if necessary
+    if (currentState->isPseudoState()) {
+        // Create concrete state from pseudo state
+        currentState->construct();
+    }
+    STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+    return std::make_pair(currentState, currentExplorationHeuristic);
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::skipState(DFTStatePointer const& state, ExplorationHeuristicPointer const& heuristic) {
+    STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(state));
+    setMarkovian(true);
+    // Add transition to target state with temporary value 0
+    // TODO: what to do when there is no unique target state?
+    // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
+    matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
+    // Remember skipped state
+    // Skipped states are kept over all refinement iterations, so only their status is stored and the remaining information is reconstructed on demand
+    state->compact();
+    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(state, heuristic);
+    matrixBuilder.finishRow();
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::addBehavior(ExplorationHeuristicPointer const& currentExplorationHeuristic,
+                                                                storm::generator::StateBehavior<ValueType, StateType> const& behavior) {
+    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
+    setMarkovian(behavior.begin()->isMarkovian());
+
+    // Now add all choices.
+    for (auto const& choice : behavior) {
+        // Add the probabilistic behavior to the matrix.
+        for (auto const& stateProbabilityPair : choice) {
+            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+            // Set transition to state id + offset. This helps in only remapping all previously skipped states.
+            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+            // Set heuristic values for reached states
+            auto iter = statesNotExplored.find(stateProbabilityPair.first);
+            if (iter != statesNotExplored.end()) {
+                // Update heuristic values
+                DFTStatePointer state = iter->second.first;
+                if (!iter->second.second) {
+                    // Initialize heuristic values
+                    ExplorationHeuristicPointer heuristic;
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+
+                    iter->second.second = heuristic;
+                    // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
+                    // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
+                    // !state->getFailableElements().hasBEs())) {
+                    if (state->getFailableElements().hasDependencies() ||
+                        (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                        // Do not skip absorbing state or if reached by dependencies
+                        iter->second.second->markExpand();
+                    }
+                    if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+                        // Compute bounds for heuristic now
+                        if (state->isPseudoState()) {
+                            // Create concrete state from pseudo state
+                            state->construct();
+                        }
+                        STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
+
+                        // Initialize bounds
+                        // TODO: avoid hack
+                        ValueType lowerBound = getLowerBound(state);
+                        ValueType upperBound = getUpperBound(state);
+                        heuristic->setBounds(lowerBound, upperBound);
+                    }
+
+                    explorationQueue.push(heuristic);
+                } else if (!iter->second.second->isExpand()) {
+                    bool changedPriority = false;
+                    double oldPriority = iter->second.second->getPriority();
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
+                                                                                         /* next values are irrelevant */ stateProbabilityPair.second,
+                                                                                         stateProbabilityPair.second);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            changedPriority =
+                                iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            changedPriority =
+                                iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+                    if (changedPriority) {
+                        // Update priority queue
+                        explorationQueue.update(iter->second.second, oldPriority);
+                    }
+                }
+            }
+        }
+        matrixBuilder.finishRow();
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -604,6 +730,22 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
     STORM_LOG_TRACE(modelComponents.stateLabeling);
 }
 
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::setNumberOfExplorationThreads(uint64_t numberOfThreads) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required for the exploration.");
+    numberOfExplorationThreads = numberOfThreads;
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::setReduceDependencyOrders(bool reduce) {
+    generator.setReduceDependencyOrders(reduce);
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::setEliminateVanishingStates(bool eliminate) {
+    generator.setEliminateVanishingStates(eliminate);
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder<ValueType, StateType>::getModel() {
     if (storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isMaxDepthSet() && skippedStates.size() > 0) {
@@ -636,7 +778,6 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder
             for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                 auto matrixEntry = matrix.getRow(it->first, 0).begin();
                 STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
                 matrixEntry->setValue(storm::utility::one<ValueType>());
                 matrixEntry->setColumn(it->first);
             }
@@ -756,7 +897,6 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::changeMatrixBound(storm::sto
     for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
         auto matrixEntry = matrix.getRow(it->first, 0).begin();
         STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-        STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
 
         // Change bound
         // TODO: cache values inbetween iterations
@@ -769,7 +909,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::changeMatrixBound(storm::sto
 }
 
 template<typename ValueType, typename StateType>
-ValueType ExplicitDFTModelBuilder<ValueType, StateType>::getLowerBound(DFTStatePointer const& state) const {
+ValueType ExplicitDFTModelBuilder<ValueType, StateType>::getLowerBound(DFTStatePointer const& pseudoOrConcreteState) const {
+    DFTStatePointer state = pseudoOrConcreteState;
+    if (state->isPseudoState()) {
+        // Reconstruct the failable elements on a temporary copy to keep the stored state compact
+        state = pseudoOrConcreteState->copy();
+        state->construct();
+    }
+
     // Get the lower bound by considering the failure of all possible BEs
     ValueType lowerBound = storm::utility::zero<ValueType>();
     STORM_LOG_ASSERT(!state->getFailableElements().hasDependencies(), "Lower bound should only be computed if dependencies were already handled.");
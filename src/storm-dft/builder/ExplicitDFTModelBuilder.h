@@ -11,6 +11,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateStorage.h"
+#include "storm/utility/ProgressMeasurement.h"
 
 #include "storm-dft/builder/DftExplorationHeuristic.h"
 #include "storm-dft/generator/DftNextStateGenerator.h"
@@ -182,6 +183,32 @@ class ExplicitDFTModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType>> getModelApproximation(bool lowerBound, bool expectedTime);
 
+    /*!
+     * Set the number of threads used for exploring the state space.
+     * With more than one thread, batches of states are taken from the exploration queue and expanded concurrently.
+     * The order given by the exploration heuristic is thus only kept between batches.
+     * Concurrent exploration is only supported for models with double values.
+     *
+     * @param numberOfThreads Number of threads.
+     */
+    void setNumberOfExplorationThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Set whether only one order of dependency failures should be explored if the order cannot influence the outcome.
+     * See DftNextStateGenerator::setReduceDependencyOrders.
+     *
+     * @param reduce Flag indicating whether the reduction should be applied.
+     */
+    void setReduceDependencyOrders(bool reduce);
+
+    /*!
+     * Set whether vanishing states should be eliminated during the exploration.
+     * See DftNextStateGenerator::setEliminateVanishingStates.
+     *
+     * @param eliminate Flag indicating whether vanishing states should be eliminated.
+     */
+    void setEliminateVanishingStates(bool eliminate);
+
    private:
     /*!
      * Explore state space of DFT.
@@ -190,6 +217,44 @@ class ExplicitDFTModelBuilder {
      */
     void exploreStateSpace(double approximationThreshold);
 
+    /*!
+     * Explore state space of DFT with multiple threads.
+     * The states are expanded concurrently, but the new states are registered and the transitions are inserted in the order in which the states were
+     * taken from the exploration queue.
+     *
+     * @param approximationThreshold Threshold to determine when to skip states.
+     * @param nrExpandedStates Counter for the expanded states.
+     * @param nrSkippedStates Counter for the skipped states.
+     * @param progress Progress measurement.
+     */
+    void exploreStateSpaceConcurrently(double approximationThreshold, size_t& nrExpandedStates, size_t& nrSkippedStates,
+                                       storm::utility::ProgressMeasurement& progress);
+
+    /*!
+     * Take the next state from the exploration queue and remove it from the not yet explored states.
+     *
+     * @return The (concrete) state and its heuristic values.
+     */
+    std::pair<DFTStatePointer, ExplorationHeuristicPointer> popNextState();
+
+    /*!
+     * Skip the expansion of the given state and add a temporary transition to the failed state instead.
+     * The row group of the state must have been created already.
+     *
+     * @param state The state.
+     * @param heuristic The heuristic values of the state.
+     */
+    void skipState(DFTStatePointer const& state, ExplorationHeuristicPointer const& heuristic);
+
+    /*!
+     * Add the behavior of the given expanded state to the matrix and update the heuristic values of the reached states.
+     * The row group of the state must have been created already.
+     *
+     * @param heuristic The heuristic values of the state.
+     * @param behavior The behavior of the state.
+     */
+    void addBehavior(ExplorationHeuristicPointer const& heuristic, storm::generator::StateBehavior<ValueType, StateType> const& behavior);
+
     /*!
      * Initialize the matrix for a refinement iteration.
      */
@@ -227,11 +292,11 @@ class ExplicitDFTModelBuilder {
     /*!
      * Get lower bound approximation for state.
      *
-     * @param state        The state.
+     * @param pseudoOrConcreteState The state. A pseudo state is reconstructed temporarily.
      *
      * @return Lower bound approximation.
      */
-    ValueType getLowerBound(DFTStatePointer const& state) const;
+    ValueType getLowerBound(DFTStatePointer const& pseudoOrConcreteState) const;
 
     /*!
      * Get upper bound approximation for state.
@@ -278,6 +343,10 @@ class ExplicitDFTModelBuilder {
     const size_t INITIAL_BITVECTOR_SIZE = 20000;
     // Offset used for pseudo states.
     const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
+    // Offset used for temporary ids of successor states during concurrent exploration.
+    const StateType OFFSET_CONCURRENT_SUCCESSOR = std::numeric_limits<StateType>::max() / 4 * 3;
+    // Number of states per thread that are taken from the exploration queue at once during concurrent exploration.
+    const size_t EXPLORATION_BATCH_SIZE_PER_THREAD = 64;
 
     // Dft
     storm::dft::storage::DFT<ValueType> const& dft;
@@ -289,6 +358,9 @@ class ExplicitDFTModelBuilder {
     // Heuristic used for approximation
     storm::dft::builder::ApproximationHeuristic usedHeuristic;
 
+    // Number of threads used for exploring the state space
+    uint64_t numberOfExplorationThreads = 1;
+
     // Current id for new state
     size_t newIndex = 0;
 
@@ -1,5 +1,7 @@
 #include "DftNextStateGenerator.h"
 
+#include <limits>
+
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/settings/SettingsManager.h"
@@ -15,6 +17,53 @@ DftNextStateGenerator<ValueType, StateType>::DftNextStateGenerator(storm::dft::s
     : mDft(dft), mStateGenerationInfo(stateGenerationInfo), state(nullptr), uniqueFailedState(false) {
     deterministicModel = !mDft.canHaveNondeterminism();
     mTakeFirstDependency = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isTakeFirstDependency();
+    setReduceDependencyOrders(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isReduceDependencyOrders());
+    mEliminateVanishingStates = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isEliminateVanishingStates();
+}
+
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::setReduceDependencyOrders(bool reduce) {
+    mReduceDependencyOrders = reduce;
+    mDynamicAncestors.clear();
+    if (!reduce) {
+        return;
+    }
+    // Gather the dynamic gates above the dependent BEs
+    for (size_t dependencyId : mDft.getDependencies()) {
+        auto dependency = mDft.getDependency(dependencyId);
+        if (!dependency->isFDEP()) {
+            continue;
+        }
+        bool hasRestriction = false;
+        std::set<size_t> dynamicAncestors;
+        std::set<size_t> visited;
+        std::vector<std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const>> stack;
+        for (auto const& dependentEvent : dependency->dependentEvents()) {
+            stack.push_back(dependentEvent);
+        }
+        while (!stack.empty() && !hasRestriction) {
+            auto element = stack.back();
+            stack.pop_back();
+            if (!visited.insert(element->id()).second) {
+                continue;
+            }
+            hasRestriction |= element->hasRestrictions();
+            if (element->isGate() && !element->isStaticElement()) {
+                dynamicAncestors.insert(element->id());
+            }
+            for (auto const& parent : element->parents()) {
+                stack.push_back(parent);
+            }
+        }
+        if (!hasRestriction) {
+            mDynamicAncestors[dependencyId] = std::vector<size_t>(dynamicAncestors.begin(), dynamicAncestors.end());
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::setEliminateVanishingStates(bool eliminate) {
+    mEliminateVanishingStates = eliminate;
 }
 
 template<typename ValueType, typename StateType>
@@ -132,6 +181,20 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
 
     storm::generator::Choice<ValueType, StateType> choice(0, !exploreDependencies);
 
+    // Only explore one representative if the order of the dependency failures does not matter.
+    // Non-conflicting dependencies come first and are handled below.
+    bool representativeDependency = false;
+    if (exploreDependencies && mReduceDependencyOrders && !takeFirstDependency && iterFailable.isConflictingDependency()) {
+        for (auto iterDependency = iterFailable; iterDependency != state->getFailableElements().end(false); ++iterDependency) {
+            if (isOrderIndependentDependency(iterDependency.getFailBE(mDft).second)) {
+                STORM_LOG_TRACE("Only explore order-independent dependency " << iterDependency.getFailBE(mDft).second->name());
+                iterFailable = iterDependency;
+                representativeDependency = true;
+                break;
+            }
+        }
+    }
+
     // Let BE fail
     for (; iterFailable != state->getFailableElements().end(!exploreDependencies); ++iterFailable) {
         // Get BE which fails next
@@ -153,32 +216,29 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             continue;
         }
 
-        StateType newStateId;
-        if (newState->hasFailed(mDft.getTopLevelIndex()) && uniqueFailedState) {
-            // Use unique failed state
-            newStateId = 0;
-        } else {
-            // Add new state
-            newStateId = stateToIdCallback(newState);
-        }
+        std::vector<std::pair<StateType, ValueType>> newStates = getSuccessorIds(newState, stateToIdCallback);
 
         // Set transitions
         if (exploreDependencies) {
             // Failure is due to dependency -> add non-deterministic choice if necessary
             ValueType probability = dependency->probability();
-            choice.addProbability(newStateId, probability);
-            STORM_LOG_TRACE("Added transition to " << newStateId << " with probability " << probability);
+            for (auto const& newStatePair : newStates) {
+                choice.addProbability(newStatePair.first, probability * newStatePair.second);
+                STORM_LOG_TRACE("Added transition to " << newStatePair.first << " with probability " << probability * newStatePair.second);
+            }
 
             if (!storm::utility::isOne(probability)) {
                 // Add transition to state where dependency was unsuccessful
                 DFTStatePointer unsuccessfulState = createSuccessorState(state, nextBE, dependency, false);
                 // Add state
-                StateType unsuccessfulStateId = stateToIdCallback(unsuccessfulState);
                 ValueType remainingProbability = storm::utility::one<ValueType>() - probability;
-                choice.addProbability(unsuccessfulStateId, remainingProbability);
-                STORM_LOG_TRACE("Added transition to " << unsuccessfulStateId << " with remaining probability " << remainingProbability);
-                STORM_LOG_ASSERT(unsuccessfulStateId != state->getId(),
-                                 "Self loop was added (through PDEP) for " << unsuccessfulStateId << " and failure of " << nextBE->name());
+                for (auto const& unsuccessfulStatePair : getSuccessorIds(unsuccessfulState, stateToIdCallback)) {
+                    choice.addProbability(unsuccessfulStatePair.first, remainingProbability * unsuccessfulStatePair.second);
+                    STORM_LOG_TRACE("Added transition to " << unsuccessfulStatePair.first << " with remaining probability "
+                                                           << remainingProbability * unsuccessfulStatePair.second);
+                    STORM_LOG_ASSERT(unsuccessfulStatePair.first != state->getId(),
+                                     "Self loop was added (through PDEP) for " << unsuccessfulStatePair.first << " and failure of " << nextBE->name());
+                }
             }
             result.addChoice(std::move(choice));
         } else {
@@ -186,13 +246,17 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             // Set failure rate according to activation
             ValueType rate = state->getBERate(nextBE->id());
             STORM_LOG_ASSERT(!storm::utility::isZero(rate), "Rate is 0.");
-            choice.addProbability(newStateId, rate);
-            STORM_LOG_TRACE("Added transition to " << newStateId << " with failure rate " << rate);
+            for (auto const& newStatePair : newStates) {
+                choice.addProbability(newStatePair.first, rate * newStatePair.second);
+                STORM_LOG_TRACE("Added transition to " << newStatePair.first << " with failure rate " << rate * newStatePair.second);
+            }
+        }
+        for (auto const& newStatePair : newStates) {
+            STORM_LOG_ASSERT(newStatePair.first != state->getId(), "Self loop was added for " << newStatePair.first << " and failure of " << nextBE->name());
         }
-        STORM_LOG_ASSERT(newStateId != state->getId(), "Self loop was added for " << newStateId << " and failure of " << nextBE->name());
 
         // Handle premature stop for dependencies
-        if (iterFailable.isFailureDueToDependency() && !iterFailable.isConflictingDependency()) {
+        if (representativeDependency || (iterFailable.isFailureDueToDependency() && !iterFailable.isConflictingDependency())) {
             // We only explore the first non-conflicting dependency because we can fix an order.
             break;
         }
@@ -226,6 +290,70 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
     return result;
 }
 
+template<typename ValueType, typename StateType>
+std::vector<std::pair<StateType, ValueType>> DftNextStateGenerator<ValueType, StateType>::getSuccessorIds(DFTStatePointer const& newState,
+                                                                                                          StateToIdCallback const& stateToIdCallback) {
+    if (newState->hasFailed(mDft.getTopLevelIndex()) && uniqueFailedState) {
+        // Use unique failed state
+        return {std::make_pair(static_cast<StateType>(0), storm::utility::one<ValueType>())};
+    }
+    if (mEliminateVanishingStates && newState->getFailableElements().hasDependencies()) {
+        return resolveVanishingState(newState, stateToIdCallback);
+    }
+    // Add new state
+    return {std::make_pair(stateToIdCallback(newState), storm::utility::one<ValueType>())};
+}
+
+template<typename ValueType, typename StateType>
+std::vector<std::pair<StateType, ValueType>> DftNextStateGenerator<ValueType, StateType>::resolveVanishingState(DFTStatePointer const& vanishingState,
+                                                                                                                StateToIdCallback const& stateToIdCallback) {
+    // Explore the dependencies of the vanishing state without adding the successors yet
+    // The successors are already resolved recursively and get temporary ids which cannot clash with the id of the unique failed state
+    StateType const offset = std::numeric_limits<StateType>::max() / 2;
+    std::vector<DFTStatePointer> successors;
+    DFTStatePointer currentState = state;
+    state = vanishingState;
+    storm::generator::StateBehavior<ValueType, StateType> behavior = exploreState(
+        [&successors, offset](DFTStatePointer const& successor) {
+            successors.push_back(successor);
+            return static_cast<StateType>(offset + successors.size() - 1);
+        },
+        true, mTakeFirstDependency);
+    state = currentState;
+
+    std::vector<std::pair<StateType, ValueType>> result;
+    if (behavior.getNumberOfChoices() != 1 || behavior.begin()->isMarkovian()) {
+        // Non-deterministic choice or no dependency could fail -> keep vanishing state
+        result.emplace_back(stateToIdCallback(vanishingState), storm::utility::one<ValueType>());
+        return result;
+    }
+    for (auto const& entry : *behavior.begin()) {
+        if (entry.first < offset) {
+            STORM_LOG_ASSERT(uniqueFailedState && entry.first == 0, "Expected the unique failed state.");
+            result.emplace_back(entry.first, entry.second);
+        } else {
+            result.emplace_back(stateToIdCallback(successors[entry.first - offset]), entry.second);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+bool DftNextStateGenerator<ValueType, StateType>::isOrderIndependentDependency(
+    std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency) const {
+    auto it = mDynamicAncestors.find(dependency->id());
+    if (it == mDynamicAncestors.end()) {
+        return false;
+    }
+    for (size_t gateId : it->second) {
+        if (state->isOperational(gateId)) {
+            // The failure might influence the dynamic behaviour
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
     DFTStatePointer const state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
@@ -31,6 +31,27 @@ class DftNextStateGenerator {
     void load(storm::storage::BitVector const& state);
     void load(DFTStatePointer const& state);
 
+    /*!
+     * Set whether only one order of conflicting dependency failures should be explored if the order cannot influence the outcome.
+     * A failure due to a dependency is order-independent in a state if all dynamic gates above the dependent BE are already failed, failsafe or
+     * don't care and the dependent BE is not subject to restrictions. The failure then only propagates through static gates and commutes with all
+     * other dependency failures.
+     *
+     * @param reduce Flag indicating whether the reduction should be applied.
+     */
+    void setReduceDependencyOrders(bool reduce);
+
+    /*!
+     * Set whether vanishing states should be eliminated during the exploration.
+     * If a BE failure leads to a state in which dependencies can fail and these failures do not involve non-determinism, the failures due to the
+     * dependencies are resolved immediately. The rate of the BE failure is then distributed among the resulting states according to the probabilities of
+     * the dependencies. Thus, only states in which no dependency can fail or which have a non-deterministic choice between dependencies are generated.
+     * Labels are preserved as in NonMarkovianChainTransformer with EliminationLabelBehavior::ExtendLabels, as failures only add labels.
+     *
+     * @param eliminate Flag indicating whether vanishing states should be eliminated.
+     */
+    void setEliminateVanishingStates(bool eliminate);
+
     /*!
      * Expand and explore current state.
      * @param stateToIdCallback  Callback function which adds new state and returns the corresponding id.
@@ -99,6 +120,31 @@ class DftNextStateGenerator {
     storm::generator::StateBehavior<ValueType, StateType> exploreState(StateToIdCallback const& stateToIdCallback, bool exploreDependencies,
                                                                        bool takeFirstDependency);
 
+    /*!
+     * Check whether the failure due to the given dependency is independent of the order of the other dependency failures in the current state.
+     * @param dependency Dependency.
+     * @return True iff no dynamic gate above the dependent BE is still operational.
+     */
+    bool isOrderIndependentDependency(std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency) const;
+
+    /*!
+     * Get the ids of the states reached when moving to the given successor state.
+     * This is the successor itself, the unique failed state or the states reached after eliminating the successor if it is vanishing.
+     * @param newState Successor state.
+     * @param stateToIdCallback Callback function which adds new state and returns the corresponding id.
+     * @return The ids of the reached states together with their probabilities.
+     */
+    std::vector<std::pair<StateType, ValueType>> getSuccessorIds(DFTStatePointer const& newState, StateToIdCallback const& stateToIdCallback);
+
+    /*!
+     * Resolve the failures due to dependencies in a vanishing state until states are reached which either are not vanishing or require a
+     * non-deterministic choice between dependencies.
+     * @param vanishingState State in which dependencies can fail.
+     * @param stateToIdCallback Callback function which adds new state and returns the corresponding id.
+     * @return The reached states together with their probabilities.
+     */
+    std::vector<std::pair<StateType, ValueType>> resolveVanishingState(DFTStatePointer const& vanishingState, StateToIdCallback const& stateToIdCallback);
+
     // The dft used for the generation of next states.
     storm::dft::storage::DFT<ValueType> const& mDft;
 
@@ -116,6 +162,16 @@ class DftNextStateGenerator {
 
     // Flag indicating whether only the first dependency (instead of all) should be explored.
     bool mTakeFirstDependency = false;
+
+    // Flag indicating whether only one order of order-independent dependency failures should be explored.
+    bool mReduceDependencyOrders = false;
+
+    // Flag indicating whether vanishing states should be eliminated on the fly.
+    bool mEliminateVanishingStates = false;
+
+    // Dynamic gates above the dependent BE of each dependency (indexed by dependency id).
+    // Dependencies whose dependent BE is subject to a restriction are never considered order-independent and have no entry.
+    std::map<size_t, std::vector<size_t>> mDynamicAncestors;
 };
 
 }  // namespace generator
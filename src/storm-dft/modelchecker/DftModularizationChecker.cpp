@@ -1,16 +1,21 @@
 #include "DftModularizationChecker.h"
 
+#include <exception>
 #include <sstream>
+#include <thread>
+#include <type_traits>
 
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidModelException.h"
 
 namespace storm::dft {
@@ -18,7 +23,7 @@ namespace modelchecker {
 
 template<typename ValueType>
 DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()}, modelchecker(true) {
+    : dft{dft}, sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()}, modelchecker(true), numberOfThreads(1) {
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -26,6 +31,13 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    computeModuleClasses();
+}
+
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::setNumberOfThreads(uint64_t threads) {
+    STORM_LOG_THROW(threads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required.");
+    numberOfThreads = threads;
 }
 
 template<typename ValueType>
@@ -41,6 +53,33 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::computeModuleClasses() {
+    moduleClasses.clear();
+    auto const colouring = dft->colourDFT();
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        auto const& mod = dynamicModules[i];
+        bool found = false;
+        for (auto& moduleClass : moduleClasses) {
+            auto const& classMod = dynamicModules[moduleClass.front()];
+            if (classMod.getAllElements().size() != mod.getAllElements().size()) {
+                continue;
+            }
+            // Isomorphic modules have the same failure behaviour
+            auto const bijection = dft->findBijection(classMod.getRepresentative(), mod.getRepresentative(), colouring, false);
+            if (!bijection.empty()) {
+                moduleClass.push_back(i);
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            moduleClasses.push_back({i});
+        }
+    }
+    STORM_LOG_DEBUG("Found " << moduleClasses.size() << " non-isomorphic dynamic modules among " << dynamicModules.size() << " dynamic modules.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -69,18 +108,61 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
-        // Remember probabilities for module
+    // Create properties
+    std::stringstream propertyStream{};
+    for (auto const timebound : timepoints) {
+        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    }
+    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+
+    // First analyse one dynamic module per class of isomorphic modules
+    std::vector<typename DFTModelChecker<ValueType>::dft_results> classResults(moduleClasses.size());
+    uint64_t const threads = std::min<uint64_t>(numberOfThreads, moduleClasses.size());
+    if (threads > 1 && std::is_same<ValueType, double>::value) {
+        STORM_LOG_DEBUG("Analyse " << moduleClasses.size() << " dynamic modules with " << threads << " threads.");
+        std::vector<std::thread> workers;
+        std::vector<std::exception_ptr> exceptions(threads);
+        for (uint64_t t = 0; t < threads; ++t) {
+            workers.emplace_back([this, t, threads, &props, &classResults, &exceptions]() {
+                try {
+                    // Each thread uses its own model checker as the checker keeps track of timings.
+                    DFTModelChecker<ValueType> threadChecker(false);
+                    for (size_t i = t; i < moduleClasses.size(); i += threads) {
+                        classResults[i] = analyseDynamicModule(dynamicModules[moduleClasses[i].front()], props, threadChecker);
+                    }
+                } catch (...) {
+                    exceptions[t] = std::current_exception();
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    } else {
+        STORM_LOG_WARN_COND(threads <= 1, "Concurrent analysis of dynamic modules is only supported for double. Falling back to sequential analysis.");
+        for (size_t i = 0; i < moduleClasses.size(); ++i) {
+            auto const& mod = dynamicModules[moduleClasses[i].front()];
+            STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
+            classResults[i] = analyseDynamicModule(mod, props, modelchecker);
+        }
+    }
+
+    // Remember probabilities for all modules of a class
+    for (size_t i = 0; i < moduleClasses.size(); ++i) {
         std::map<ValueType, ValueType> activeSamples{};
-        for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
-            auto const timebound{timepoints[i]};
+        for (size_t j{0}; j < timepoints.size(); ++j) {
+            auto const probability{boost::get<ValueType>(classResults[i][j])};
+            auto const timebound{timepoints[j]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        for (auto const modIndex : moduleClasses[i]) {
+            samplePoints.insert({dynamicModules[modIndex].getRepresentative(), activeSamples});
+        }
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +205,12 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties, DFTModelChecker<ValueType>& checker) {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
     auto subDft = module.getSubtree(*dft);
-
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    return checker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
@@ -16,6 +16,7 @@ namespace modelchecker {
  * DFT analysis via modularization.
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
  * The resulting (static) fault tree is then analyzed via BDDs.
+ * Isomorphic dynamic modules are only analyzed once and the remaining dynamic modules can be analyzed concurrently.
  *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
  */
@@ -58,6 +59,21 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * Set the number of threads used to analyze the dynamic modules.
+     * Each thread analyzes whole modules with its own model checker. Concurrent analysis is only supported for double.
+     * @param threads Number of threads (at least 1).
+     */
+    void setNumberOfThreads(uint64_t threads);
+
+    /*!
+     * Get the number of dynamic modules which are analyzed via model checking, i.e., the number of classes of isomorphic dynamic modules.
+     * @return Number of analyzed dynamic modules.
+     */
+    size_t getNumberOfAnalyzedModules() const {
+        return moduleClasses.size();
+    }
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -65,6 +81,12 @@ class DftModularizationChecker {
      */
     void populateDynamicModules(storm::dft::storage::DftIndependentModule const &module);
 
+    /*!
+     * Partition the dynamic modules into classes of isomorphic modules.
+     * Only the first module of each class needs to be analyzed as all modules in the class have the same failure behaviour.
+     */
+    void computeModuleClasses();
+
     /*!
      * Calculate results for dynamic modules and replace them with BE's in workDFT.
      * @param timepoints Time points for which the failure probability should be computed.
@@ -75,10 +97,11 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probabilities at the time points.
+     * @param checker Model checker used for the analysis.
      */
-    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(
+        storm::dft::storage::DftIndependentModule const &module, FormulaVector const &properties, DFTModelChecker<ValueType> &checker);
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
@@ -89,6 +112,10 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Classes of isomorphic dynamic modules given by their indices in dynamicModules. The first module of each class is analyzed.
+    std::vector<std::vector<size_t>> moduleClasses;
+    // Number of threads used for the analysis of dynamic modules
+    uint64_t numberOfThreads;
 };
 
 }  // namespace modelchecker
@@ -1,6 +1,8 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
@@ -235,6 +237,91 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
     return &bddToBirnbaumFactorsElement.second;
 }
+
+/**
+ * \returns
+ * The birnbaum importance factors of all variables in the bdd.
+ * Variables not occurring in the bdd have no entry.
+ *
+ * \param chunksize
+ * The width of the Eigen Arrays
+ *
+ * \param bdd
+ * The bdd for which to calculate the factors
+ *
+ * \param indexToProbabilities
+ * A reference to a mapping
+ * that must map every variable in the bdd to probabilities
+ *
+ * \param bddToProbabilities
+ * A cache for common sub Bdds.
+ * Must contain valid probabilities for all sub Bdds of bdd,
+ * e.g. from a previous call to recursiveProbabilities.
+ *
+ * \note
+ * The birnbaum factor of variable x is the sum of
+ * P(reach n) * (P(Then(n)) - P(Else(n)))
+ * over all nodes n labelled with x, as every path tests x at most once.
+ * The reach probabilities are computed in a single top-down pass,
+ * such that all factors are obtained with one traversal of the bdd.
+ */
+std::map<uint32_t, Eigen::ArrayXd> allBirnbaumFactors(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
+                                                      std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
+    // Gather all inner nodes
+    std::vector<Bdd> nodes{};
+    std::unordered_set<uint64_t> visited{};
+    std::vector<Bdd> stack{bdd};
+    while (!stack.empty()) {
+        auto const current{stack.back()};
+        stack.pop_back();
+        if (current.isTerminal() || !visited.insert(current.GetBDD()).second) {
+            continue;
+        }
+        nodes.push_back(current);
+        stack.push_back(current.Then());
+        stack.push_back(current.Else());
+    }
+    // Parents have smaller variable indices than their children
+    std::stable_sort(nodes.begin(), nodes.end(), [](Bdd const &lhs, Bdd const &rhs) { return lhs.TopVar() < rhs.TopVar(); });
+
+    std::map<uint32_t, Eigen::ArrayXd> birnbaumFactors{};
+    std::unordered_map<uint64_t, Eigen::ArrayXd> reachProbabilities{};
+    if (nodes.empty()) {
+        return birnbaumFactors;
+    }
+    reachProbabilities[bdd.GetBDD()] = Eigen::ArrayXd::Constant(chunksize, 1);
+
+    auto addReachProbability = [&reachProbabilities](Bdd const &child, Eigen::ArrayXd probabilities) {
+        if (child.isTerminal()) {
+            return;
+        }
+        auto const it{reachProbabilities.find(child.GetBDD())};
+        if (it == reachProbabilities.end()) {
+            reachProbabilities.emplace(child.GetBDD(), std::move(probabilities));
+        } else {
+            it->second += probabilities;
+        }
+    };
+
+    for (auto const &node : nodes) {
+        auto const currentVar{node.TopVar()};
+        auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+        // References into unordered maps stay valid on insertion
+        auto const &reachProbability{reachProbabilities.at(node.GetBDD())};
+        auto const &thenProbabilities{*recursiveProbabilities(chunksize, node.Then(), indexToProbabilities, bddToProbabilities)};
+        auto const &elseProbabilities{*recursiveProbabilities(chunksize, node.Else(), indexToProbabilities, bddToProbabilities)};
+
+        auto it{birnbaumFactors.find(currentVar)};
+        if (it == birnbaumFactors.end()) {
+            it = birnbaumFactors.emplace(currentVar, Eigen::ArrayXd::Constant(chunksize, 0)).first;
+        }
+        it->second += reachProbability * (thenProbabilities - elseProbabilities);
+
+        addReachProbability(node.Then(), Eigen::ArrayXd{reachProbability * currentProbabilities});
+        addReachProbability(node.Else(), Eigen::ArrayXd{reachProbability * (1 - currentProbabilities)});
+    }
+    return birnbaumFactors;
+}
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -391,26 +478,13 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    // All factors are obtained from a single pass over the bdd
+    auto const measures{getAllImportanceMeasuresAtTimepoints({timebound}, 1, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(measures.size());
+    for (auto const &measure : measures) {
+        resultVector.push_back(measure.front());
     }
     return resultVector;
 }
@@ -458,7 +532,6 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTim
     auto const basicElements{getDFT()->getBasicElements()};
 
     std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
     std::vector<std::vector<ValueType>> resultVector{};
     resultVector.resize(getDFT()->getBasicElements().size());
     for (auto &i : resultVector) {
@@ -472,19 +545,16 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTim
         }
 
         auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        // Birnbaum factors of all basic elements in one pass
+        auto const birnbaumFactors{allBirnbaumFactors(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        Eigen::ArrayXd const zeroArray{Eigen::ArrayXd::Constant(currentChunksize, 0)};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
             auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
             auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+            auto const it{birnbaumFactors.find(index)};
+            // Basic elements not occurring in the bdd do not influence it
+            auto const &birnbaumFactorsArray{it != birnbaumFactors.end() ? it->second : zeroArray};
 
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
 
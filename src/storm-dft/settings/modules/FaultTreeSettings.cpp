@@ -27,7 +27,11 @@ const std::string FaultTreeSettings::approximationErrorOptionShortName = "approx
 const std::string FaultTreeSettings::approximationHeuristicOptionName = "approximationheuristic";
 const std::string FaultTreeSettings::maxDepthOptionName = "maxdepth";
 const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
+const std::string FaultTreeSettings::reduceDependencyOrdersOptionName = "reduce-dependency-orders";
+const std::string FaultTreeSettings::eliminateVanishingOptionName = "eliminate-vanishing";
 const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
+const std::string FaultTreeSettings::explorationThreadsOptionName = "exploration-threads";
+const std::string FaultTreeSettings::bddVariableOrderingOptionName = "bdd-variable-order";
 #ifdef STORM_HAVE_Z3
 const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -46,6 +50,15 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
     this->addOption(
         storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false, "Avoid non-determinism by always taking the first possible dependency.")
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, reduceDependencyOrdersOptionName, false,
+                                                   "Only explore one order of conflicting dependency failures if all dynamic elements above the failing "
+                                                   "BE are already failed or failsafe.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, eliminateVanishingOptionName, false,
+                                                   "Eliminate states in which dependencies fail instantaneously during the state space exploration.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, relevantEventsOptionName, false, "Specifies the relevant events from the DFT.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values",
@@ -73,6 +86,23 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build())
                         .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false, "Use a unique constantly failed BE.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Explore the state space with multiple threads. States are expanded in batches such that the order "
+                                                   "of the exploration heuristic is only kept approximately.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, bddVariableOrderingOptionName, false, "Set the heuristic used for ordering the BDD variables.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("heuristic", "The name of the ordering heuristic.")
+                                         .setDefaultValueString("id")
+                                         .addValidatorString(
+                                             storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"id", "dfs", "weighted"}))
+                                         .build())
+                        .build());
 #ifdef STORM_HAVE_Z3
     this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
 #endif
@@ -169,10 +199,34 @@ bool FaultTreeSettings::isTakeFirstDependency() const {
     return this->getOption(firstDependencyOptionName).getHasOptionBeenSet();
 }
 
+bool FaultTreeSettings::isReduceDependencyOrders() const {
+    return this->getOption(reduceDependencyOrdersOptionName).getHasOptionBeenSet();
+}
+
+bool FaultTreeSettings::isEliminateVanishingStates() const {
+    return this->getOption(eliminateVanishingOptionName).getHasOptionBeenSet();
+}
+
 bool FaultTreeSettings::isUniqueFailedBE() const {
     return this->getOption(uniqueFailedBEOptionName).getHasOptionBeenSet();
 }
 
+uint64_t FaultTreeSettings::getNumberOfExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+}
+
+storm::dft::transformations::BddVariableOrdering FaultTreeSettings::getBddVariableOrdering() const {
+    std::string orderingAsString = this->getOption(bddVariableOrderingOptionName).getArgumentByName("heuristic").getValueAsString();
+    if (orderingAsString == "id") {
+        return storm::dft::transformations::BddVariableOrdering::ID;
+    } else if (orderingAsString == "dfs") {
+        return storm::dft::transformations::BddVariableOrdering::DEPTHFIRST;
+    } else if (orderingAsString == "weighted") {
+        return storm::dft::transformations::BddVariableOrdering::WEIGHTED;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal value '" << orderingAsString << "' set as BDD variable ordering.");
+}
+
 #ifdef STORM_HAVE_Z3
 
 bool FaultTreeSettings::solveWithSMT() const {
@@ -2,6 +2,7 @@
 
 #include "storm-config.h"
 #include "storm-dft/builder/DftExplorationHeuristic.h"
+#include "storm-dft/transformations/BddVariableOrdering.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
 namespace storm::dft {
@@ -109,6 +110,20 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool isTakeFirstDependency() const;
 
+    /*!
+     * Retrieves whether only one order of failures due to dependencies should be explored if the order does not influence the outcome.
+     *
+     * @return True iff the option was set.
+     */
+    bool isReduceDependencyOrders() const;
+
+    /*!
+     * Retrieves whether vanishing states should be eliminated during the state space exploration.
+     *
+     * @return True iff the option was set.
+     */
+    bool isEliminateVanishingStates() const;
+
     /*!
      * Retrieves whether the DFT should be transformed to contain at most one constantly failed BE.
      *
@@ -116,6 +131,20 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool isUniqueFailedBE() const;
 
+    /*!
+     * Retrieves the number of threads used for the state space exploration.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
+    /*!
+     * Retrieves the heuristic used for ordering the BDD variables.
+     *
+     * @return The variable ordering heuristic.
+     */
+    storm::dft::transformations::BddVariableOrdering getBddVariableOrdering() const;
+
 #ifdef STORM_HAVE_Z3
 
     /*!
@@ -188,7 +217,11 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string approximationHeuristicOptionName;
     static const std::string maxDepthOptionName;
     static const std::string firstDependencyOptionName;
+    static const std::string reduceDependencyOrdersOptionName;
+    static const std::string eliminateVanishingOptionName;
     static const std::string uniqueFailedBEOptionName;
+    static const std::string explorationThreadsOptionName;
+    static const std::string bddVariableOrderingOptionName;
 #ifdef STORM_HAVE_Z3
     static const std::string solveWithSmtOptionName;
 #endif
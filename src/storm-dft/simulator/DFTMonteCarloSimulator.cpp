@@ -0,0 +1,166 @@
+#include "DFTMonteCarloSimulator.h"
+
+#include <cmath>
+#include <exception>
+#include <thread>
+
+#include <boost/math/distributions/normal.hpp>
+#include <boost/random/seed_seq.hpp>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm::dft {
+namespace simulator {
+
+namespace {
+
+/*!
+ * Counts of the generated traces.
+ */
+struct TraceCounts {
+    uint64_t successful = 0;
+    uint64_t unsuccessful = 0;
+    uint64_t invalid = 0;
+};
+
+}  // namespace
+
+template<typename ValueType>
+DFTMonteCarloSimulator<ValueType>::DFTMonteCarloSimulator(storm::dft::storage::DFT<ValueType> const& dft,
+                                                          storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed,
+                                                          uint64_t numberOfThreads)
+    : dft(dft),
+      stateGenerationInfo(stateGenerationInfo),
+      seed(seed),
+      numberOfThreads(numberOfThreads),
+      confidence(0.95),
+      batchSize(1000),
+      maximalNumberOfTraces(10000000) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required.");
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setConfidence(double confidence) {
+    STORM_LOG_THROW(confidence > 0 && confidence < 1, storm::exceptions::InvalidArgumentException, "Confidence level " << confidence << " is not in (0,1).");
+    this->confidence = confidence;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setBatchSize(uint64_t batchSize) {
+    STORM_LOG_THROW(batchSize > 0, storm::exceptions::InvalidArgumentException, "Batch size must be positive.");
+    this->batchSize = batchSize;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setMaximalNumberOfTraces(uint64_t maximalNumberOfTraces) {
+    this->maximalNumberOfTraces = maximalNumberOfTraces;
+}
+
+template<typename ValueType>
+SimulationEstimate DFTMonteCarloSimulator<ValueType>::estimateUnreliability(double timebound, double precision) {
+    STORM_LOG_THROW(precision > 0, storm::exceptions::InvalidArgumentException, "Precision must be positive.");
+
+    // Each thread has its own simulator with an independent random number stream
+    std::vector<boost::mt19937> randomGenerators;
+    std::vector<std::unique_ptr<DFTTraceSimulator<ValueType>>> simulators;
+    randomGenerators.reserve(numberOfThreads);
+    for (uint64_t t = 0; t < numberOfThreads; ++t) {
+        boost::random::seed_seq seedSequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(t)};
+        randomGenerators.emplace_back(seedSequence);
+    }
+    for (uint64_t t = 0; t < numberOfThreads; ++t) {
+        simulators.push_back(std::make_unique<DFTTraceSimulator<ValueType>>(dft, stateGenerationInfo, randomGenerators[t]));
+    }
+
+    auto simulateBatch = [&](uint64_t t, uint64_t noTraces, TraceCounts& counts) {
+        for (uint64_t i = 0; i < noTraces; ++i) {
+            switch (simulators[t]->simulateCompleteTrace(timebound)) {
+                case SimulationResult::SUCCESSFUL:
+                    ++counts.successful;
+                    break;
+                case SimulationResult::UNSUCCESSFUL:
+                    ++counts.unsuccessful;
+                    break;
+                case SimulationResult::INVALID:
+                    ++counts.invalid;
+                    break;
+            }
+        }
+    };
+
+    TraceCounts total;
+    SimulationEstimate estimate = computeEstimate(0, 0, 0);
+    while (total.successful + total.unsuccessful + total.invalid < maximalNumberOfTraces) {
+        // Distribute the traces of this round among the threads
+        uint64_t remaining = maximalNumberOfTraces - (total.successful + total.unsuccessful + total.invalid);
+        std::vector<uint64_t> noTraces(numberOfThreads, 0);
+        for (uint64_t t = 0; t < numberOfThreads && remaining > 0; ++t) {
+            noTraces[t] = std::min(batchSize, remaining);
+            remaining -= noTraces[t];
+        }
+
+        std::vector<TraceCounts> roundCounts(numberOfThreads);
+        if (numberOfThreads == 1) {
+            simulateBatch(0, noTraces[0], roundCounts[0]);
+        } else {
+            std::vector<std::thread> workers;
+            std::vector<std::exception_ptr> exceptions(numberOfThreads);
+            for (uint64_t t = 0; t < numberOfThreads; ++t) {
+                workers.emplace_back([&, t]() {
+                    try {
+                        simulateBatch(t, noTraces[t], roundCounts[t]);
+                    } catch (...) {
+                        exceptions[t] = std::current_exception();
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        }
+        for (auto const& counts : roundCounts) {
+            total.successful += counts.successful;
+            total.unsuccessful += counts.unsuccessful;
+            total.invalid += counts.invalid;
+        }
+
+        // Sequential stopping rule
+        estimate = computeEstimate(total.successful, total.successful + total.unsuccessful, total.invalid);
+        STORM_LOG_DEBUG("Simulated " << estimate.numberOfTraces << " valid traces, estimate " << estimate.probability << " in [" << estimate.lowerBound << ", "
+                                     << estimate.upperBound << "].");
+        if (estimate.numberOfTraces > 0 && (estimate.upperBound - estimate.lowerBound) / 2 <= precision) {
+            return estimate;
+        }
+    }
+    STORM_LOG_WARN("Maximal number of " << maximalNumberOfTraces << " traces reached before the confidence interval reached precision " << precision << ".");
+    return estimate;
+}
+
+template<typename ValueType>
+SimulationEstimate DFTMonteCarloSimulator<ValueType>::computeEstimate(uint64_t successful, uint64_t valid, uint64_t invalid) const {
+    SimulationEstimate estimate{0, 0, 1, valid, successful, invalid};
+    if (valid == 0) {
+        return estimate;
+    }
+    // Wilson score interval, which also behaves well for probabilities close to 0 or 1
+    double const z = boost::math::quantile(boost::math::normal_distribution<double>(), 1 - (1 - confidence) / 2);
+    double const n = static_cast<double>(valid);
+    double const p = static_cast<double>(successful) / n;
+    double const denominator = 1 + z * z / n;
+    double const center = (p + z * z / (2 * n)) / denominator;
+    double const halfWidth = z * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n)) / denominator;
+    estimate.probability = p;
+    estimate.lowerBound = std::max(0.0, center - halfWidth);
+    estimate.upperBound = std::min(1.0, center + halfWidth);
+    return estimate;
+}
+
+template class DFTMonteCarloSimulator<double>;
+
+}  // namespace simulator
+}  // namespace storm::dft
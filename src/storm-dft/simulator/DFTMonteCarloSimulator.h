@@ -0,0 +1,108 @@
+#pragma once
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/storage/DFT.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Estimate obtained by statistical model checking.
+ */
+struct SimulationEstimate {
+    // Estimated probability.
+    double probability;
+    // Lower bound of the confidence interval.
+    double lowerBound;
+    // Upper bound of the confidence interval.
+    double upperBound;
+    // Number of valid traces used for the estimate.
+    uint64_t numberOfTraces;
+    // Number of valid traces reaching a system failure.
+    uint64_t numberOfSuccessfulTraces;
+    // Number of discarded invalid traces.
+    uint64_t numberOfInvalidTraces;
+};
+
+/*!
+ * Statistical model checking for DFTs via Monte Carlo simulation.
+ * Traces are generated in batches by multiple threads. Each thread uses its own trace simulator with an independent random number stream
+ * which is derived from the seed and the thread index. The results are therefore reproducible for a fixed seed and number of threads.
+ * After each round of batches, a sequential stopping rule checks whether the confidence interval is narrow enough.
+ */
+template<typename ValueType>
+class DFTMonteCarloSimulator {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param seed Seed for the random number streams.
+     * @param numberOfThreads Number of threads generating traces.
+     */
+    DFTMonteCarloSimulator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                           uint64_t seed, uint64_t numberOfThreads = 1);
+
+    /*!
+     * Set the confidence level of the computed confidence intervals.
+     *
+     * @param confidence Confidence level in (0,1).
+     */
+    void setConfidence(double confidence);
+
+    /*!
+     * Set the number of traces generated by each thread in one round.
+     *
+     * @param batchSize Batch size.
+     */
+    void setBatchSize(uint64_t batchSize);
+
+    /*!
+     * Set the maximal number of traces after which the simulation stops, even if the confidence interval is not narrow enough.
+     *
+     * @param maximalNumberOfTraces Maximal number of traces.
+     */
+    void setMaximalNumberOfTraces(uint64_t maximalNumberOfTraces);
+
+    /*!
+     * Estimate the probability that the top level event fails within the given time bound.
+     * Traces are generated until the half-width of the (Wilson score) confidence interval is at most the given precision
+     * or the maximal number of traces is reached. Invalid traces are discarded.
+     *
+     * @param timebound Time bound.
+     * @param precision Required half-width of the confidence interval.
+     * @return Estimate and confidence interval.
+     */
+    SimulationEstimate estimateUnreliability(double timebound, double precision);
+
+   private:
+    /*!
+     * Compute the estimate and the confidence interval from the given trace counts.
+     */
+    SimulationEstimate computeEstimate(uint64_t successful, uint64_t valid, uint64_t invalid) const;
+
+    // The DFT to simulate.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    // Seed for the random number streams.
+    uint64_t seed;
+
+    // Number of threads generating traces.
+    uint64_t numberOfThreads;
+
+    // Confidence level.
+    double confidence;
+
+    // Number of traces per thread and round.
+    uint64_t batchSize;
+
+    // Maximal number of traces.
+    uint64_t maximalNumberOfTraces;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -41,17 +41,17 @@ DFTState<ValueType>::DFTState(DFT<ValueType> const& dft, DFTStateGenerationInfo
 
 template<typename ValueType>
 DFTState<ValueType>::DFTState(storm::storage::BitVector const& status, DFT<ValueType> const& dft, DFTStateGenerationInfo const& stateGenerationInfo, size_t id)
-    : mStatus(status), mId(id), failableElements(dft.nrElements()), indexRelevant(0), mPseudoState(true), mDft(dft), mStateGenerationInfo(stateGenerationInfo) {
+    : mStatus(status), mId(id), failableElements(0), indexRelevant(0), mPseudoState(true), mDft(dft), mStateGenerationInfo(stateGenerationInfo) {
     // Intentionally left empty
 }
 
 template<typename ValueType>
 void DFTState<ValueType>::construct() {
     STORM_LOG_TRACE("Construct concrete state from pseudo state " << mDft.getStateString(mStatus, mStateGenerationInfo, mId));
+    STORM_LOG_ASSERT(mPseudoState, "Only pseudo states can be constructed.");
     // Clear information from pseudo state
-    failableElements.clear();
+    failableElements = storm::dft::storage::FailableElements(mDft.nrElements());
     mUsedRepresentants.clear();
-    STORM_LOG_ASSERT(mPseudoState, "Only pseudo states can be constructed.");
     for (size_t index = 0; index < mDft.nrElements(); ++index) {
         // Initialize currently failable BE
         if (mDft.isBasicElement(index) && isOperational(index) && !isEventDisabledViaRestriction(index)) {
@@ -97,6 +97,15 @@ void DFTState<ValueType>::construct() {
     mPseudoState = false;
 }
 
+template<typename ValueType>
+void DFTState<ValueType>::compact() {
+    // The failable elements and used representants are recomputed by construct()
+    failableElements = storm::dft::storage::FailableElements(0);
+    mUsedRepresentants.clear();
+    mUsedRepresentants.shrink_to_fit();
+    mPseudoState = true;
+}
+
 template<typename ValueType>
 std::shared_ptr<DFTState<ValueType>> DFTState<ValueType>::copy() const {
     return std::make_shared<storm::dft::storage::DFTState<ValueType>>(*this);
@@ -69,6 +69,12 @@ class DFTState {
      */
     void construct();
 
+    /**
+     * Release the information which can be reconstructed from the underlying bitvector and only keep the status.
+     * The state becomes a pseudo state and can be turned into a concrete state again by construct().
+     */
+    void compact();
+
     std::shared_ptr<DFTState<ValueType>> copy() const;
 
     DFTElementState getElementState(size_t id) const;
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace storm::dft {
+namespace transformations {
+
+/*!
+ * Enum representing the heuristic used for ordering the BDD variables of the basic elements.
+ * - ID: order of the element ids.
+ * - DEPTHFIRST: order in which the basic elements are reached by a depth-first search from the top level element.
+ * - WEIGHTED: depth-first search which visits the children of a gate in increasing order of their number of basic elements.
+ */
+enum class BddVariableOrdering { ID, DEPTHFIRST, WEIGHTED };
+
+}  // namespace transformations
+}  // namespace storm::dft
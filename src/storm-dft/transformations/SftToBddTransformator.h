@@ -1,10 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <map>
 #include <memory>
+#include <set>
 #include <vector>
 
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-dft/storage/DFT.h"
 #include "storm-dft/storage/SylvanBddManager.h"
+#include "storm-dft/transformations/BddVariableOrdering.h"
 #include "storm-dft/utility/RelevantEvents.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/bitoperations.h"
@@ -20,15 +26,25 @@ class SftToBddTransformator {
    public:
     using Bdd = sylvan::Bdd;
 
+    /**
+     * Create the transformator and the BDD variables for the basic elements.
+     *
+     * \param variableOrdering
+     * Heuristic for the order of the BDD variables.
+     * If not given, the heuristic set in the fault tree settings is used.
+     */
     SftToBddTransformator(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft,
                           std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager = std::make_shared<storm::dft::storage::SylvanBddManager>(),
-                          storm::dft::utility::RelevantEvents relevantEvents = {})
+                          storm::dft::utility::RelevantEvents relevantEvents = {}, boost::optional<BddVariableOrdering> variableOrdering = boost::none)
         : dft{std::move(dft)}, sylvanBddManager{std::move(sylvanBddManager)}, relevantEvents{relevantEvents} {
+        if (!variableOrdering) {
+            variableOrdering = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getBddVariableOrdering();
+        }
         // create Variables for the BEs
-        for (auto const& i : this->dft->getBasicElements()) {
+        for (auto const& name : orderBasicElements(*variableOrdering)) {
             // Filter constantBeTrigger
-            if (i->name() != "constantBeTrigger") {
-                variables.push_back(this->sylvanBddManager->createVariable(i->name()));
+            if (name != "constantBeTrigger") {
+                variables.push_back(this->sylvanBddManager->createVariable(name));
             }
         }
     }
@@ -104,6 +120,75 @@ class SftToBddTransformator {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     storm::dft::utility::RelevantEvents relevantEvents;
 
+    /**
+     * Order the basic elements according to the given heuristic.
+     * Basic elements which are not reachable from the top level element are appended in id order.
+     *
+     * \return The names of the basic elements in the order in which their BDD variables should be created.
+     */
+    std::vector<std::string> orderBasicElements(BddVariableOrdering variableOrdering) const {
+        std::vector<std::string> result;
+        auto const basicElements{dft->getBasicElements()};
+        result.reserve(basicElements.size());
+        if (variableOrdering == BddVariableOrdering::ID) {
+            for (auto const& be : basicElements) {
+                result.push_back(be->name());
+            }
+            return result;
+        }
+
+        // Number of basic elements below each element (shared elements are counted multiple times)
+        std::map<size_t, size_t> weights;
+        std::function<size_t(std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const> const&)> computeWeight =
+            [&](std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const> const& element) -> size_t {
+            if (!element->isGate()) {
+                return 1;
+            }
+            auto const it{weights.find(element->id())};
+            if (it != weights.end()) {
+                return it->second;
+            }
+            size_t weight{0};
+            for (auto const& child : std::static_pointer_cast<storm::dft::storage::elements::DFTGate<ValueType> const>(element)->children()) {
+                weight += computeWeight(child);
+            }
+            weights[element->id()] = weight;
+            return weight;
+        };
+
+        std::set<size_t> visited;
+        std::vector<std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const>> stack{dft->getTopLevelElement()};
+        while (!stack.empty()) {
+            auto const element{stack.back()};
+            stack.pop_back();
+            if (!visited.insert(element->id()).second) {
+                continue;
+            }
+            if (element->isBasicElement()) {
+                result.push_back(element->name());
+            } else if (element->isGate()) {
+                auto children{std::static_pointer_cast<storm::dft::storage::elements::DFTGate<ValueType> const>(element)->children()};
+                if (variableOrdering == BddVariableOrdering::WEIGHTED) {
+                    std::stable_sort(children.begin(), children.end(),
+                                     [&](auto const& lhs, auto const& rhs) { return computeWeight(lhs) < computeWeight(rhs); });
+                }
+                // Push in reverse order such that the first child is visited first
+                for (auto it = children.rbegin(); it != children.rend(); ++it) {
+                    if (visited.count((*it)->id()) == 0) {
+                        stack.push_back(*it);
+                    }
+                }
+            }
+        }
+        // Append unreachable basic elements
+        for (auto const& be : basicElements) {
+            if (visited.count(be->id()) == 0) {
+                result.push_back(be->name());
+            }
+        }
+        return result;
+    }
+
     /**
      * Translate a simple DFT element into a BDD.
      *
@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
 #include "storm/storage/jani/Model.h"
@@ -14,6 +15,12 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds CTMC from GSPN by exploring its tangible markings with the given number of threads.
+ *    Vanishing markings are eliminated during the exploration.
+ */
+std::shared_ptr<storm::models::sparse::Ctmc<double>> buildCtmc(storm::gspn::GSPN const& gspn, uint64_t numberOfThreads = 1);
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
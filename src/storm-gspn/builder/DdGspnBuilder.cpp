@@ -0,0 +1,242 @@
+#include "storm-gspn/builder/DdGspnBuilder.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+template<storm::dd::DdType Type>
+DdGspnBuilder<Type>::TransitionEncoding::TransitionEncoding(storm::dd::Bdd<Type> const& guard, storm::dd::Bdd<Type> const& update,
+                                                           storm::dd::Bdd<Type> const& overflow)
+    : guard(guard), update(update), overflow(overflow) {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType Type>
+DdGspnBuilder<Type>::DdGspnBuilder(storm::gspn::GSPN const& gspn) : gspn(gspn), defaultCapacity(255) {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType Type>
+void DdGspnBuilder<Type>::setDefaultCapacity(uint64_t capacity) {
+    this->defaultCapacity = capacity;
+}
+
+template<storm::dd::DdType Type>
+void DdGspnBuilder<Type>::build() {
+    createVariables();
+
+    initialMarking = manager->getBddOne();
+    for (uint64_t placeId = 0; placeId < gspn.getNumberOfPlaces(); ++placeId) {
+        initialMarking &= manager->getEncoding(placeVariables[placeId].first, gspn.getPlace(placeId)->getNumberOfInitialTokens());
+    }
+
+    // Encode all transitions. Transitions which can never fire get an unsatisfiable guard such that the indices still match the GSPN.
+    transitionEncodings.clear();
+    for (auto const& transition : gspn.getImmediateTransitions()) {
+        transitionEncodings.push_back(encodeTransition(transition));
+        if (transition.noWeightAttached()) {
+            transitionEncodings.back().guard = manager->getBddZero();
+        }
+    }
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        transitionEncodings.push_back(encodeTransition(transition));
+        if (storm::utility::isZero(transition.getRate())) {
+            transitionEncodings.back().guard = manager->getBddZero();
+        }
+    }
+
+    // Restrict the guards according to the priorities: immediate transitions are disabled by enabled immediate transitions of higher priority
+    // while timed transitions are disabled by all enabled immediate transitions
+    uint64_t const numberOfImmediateTransitions = gspn.getNumberOfImmediateTransitions();
+    std::vector<storm::dd::Bdd<Type>> guards;
+    vanishingMarkings = manager->getBddZero();
+    for (uint64_t i = 0; i < numberOfImmediateTransitions; ++i) {
+        storm::dd::Bdd<Type> guard = transitionEncodings[i].guard;
+        uint64_t priority = gspn.getImmediateTransitions()[i].getPriority();
+        for (uint64_t j = 0; j < numberOfImmediateTransitions; ++j) {
+            if (gspn.getImmediateTransitions()[j].getPriority() > priority) {
+                guard &= !transitionEncodings[j].guard;
+            }
+        }
+        guards.push_back(guard);
+        vanishingMarkings |= transitionEncodings[i].guard;
+    }
+    enablingMarkings = vanishingMarkings;
+    for (uint64_t i = numberOfImmediateTransitions; i < transitionEncodings.size(); ++i) {
+        guards.push_back(transitionEncodings[i].guard && !vanishingMarkings);
+        enablingMarkings |= transitionEncodings[i].guard;
+    }
+
+    transitionRelations.clear();
+    for (uint64_t i = 0; i < transitionEncodings.size(); ++i) {
+        transitionRelations.push_back(guards[i] && transitionEncodings[i].update);
+    }
+
+    // Explore the reachable markings. Each transition is applied to the markings found so far, including the ones found by previous transitions in the
+    // same iteration.
+    reachableMarkings = initialMarking;
+    storm::dd::Bdd<Type> previousMarkings = manager->getBddZero();
+    uint64_t iterations = 0;
+    while (previousMarkings != reachableMarkings) {
+        previousMarkings = reachableMarkings;
+        for (uint64_t i = 0; i < transitionEncodings.size(); ++i) {
+            if (transitionRelations[i].isZero()) {
+                continue;
+            }
+            reachableMarkings |=
+                reachableMarkings.relationalProduct(transitionRelations[i], transitionEncodings[i].rowVariables, transitionEncodings[i].columnVariables);
+        }
+        ++iterations;
+    }
+    STORM_LOG_DEBUG("Reachable markings of the GSPN found after " << iterations << " iterations.");
+
+    for (uint64_t i = 0; i < transitionEncodings.size(); ++i) {
+        if ((reachableMarkings && guards[i] && transitionEncodings[i].overflow).isZero()) {
+            continue;
+        }
+        std::string const& name = i < numberOfImmediateTransitions ? gspn.getImmediateTransitions()[i].getName()
+                                                                   : gspn.getTimedTransitions()[i - numberOfImmediateTransitions].getName();
+        STORM_LOG_THROW(false, storm::exceptions::InvalidModelException, "Firing transition '" << name << "' exceeds the capacity of some place.");
+    }
+}
+
+template<storm::dd::DdType Type>
+std::shared_ptr<storm::dd::DdManager<Type>> const& DdGspnBuilder<Type>::getManager() const {
+    return manager;
+}
+
+template<storm::dd::DdType Type>
+storm::expressions::Variable const& DdGspnBuilder<Type>::getPlaceVariable(uint64_t placeId) const {
+    return placeVariables[placeId].first;
+}
+
+template<storm::dd::DdType Type>
+storm::expressions::Variable const& DdGspnBuilder<Type>::getPlacePrimedVariable(uint64_t placeId) const {
+    return placeVariables[placeId].second;
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> const& DdGspnBuilder<Type>::getInitialMarking() const {
+    return initialMarking;
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> const& DdGspnBuilder<Type>::getReachableMarkings() const {
+    return reachableMarkings;
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> DdGspnBuilder<Type>::getTangibleMarkings() const {
+    return reachableMarkings && !vanishingMarkings;
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> DdGspnBuilder<Type>::getDeadlockMarkings() const {
+    return reachableMarkings && !enablingMarkings;
+}
+
+template<storm::dd::DdType Type>
+uint64_t DdGspnBuilder<Type>::getNumberOfReachableMarkings() const {
+    return reachableMarkings.getNonZeroCount();
+}
+
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> const& DdGspnBuilder<Type>::getTransitionRelations() const {
+    return transitionRelations;
+}
+
+template<storm::dd::DdType Type>
+void DdGspnBuilder<Type>::createVariables() {
+    manager = std::make_shared<storm::dd::DdManager<Type>>();
+    placeVariables.clear();
+    placeCapacities.clear();
+    for (uint64_t placeId = 0; placeId < gspn.getNumberOfPlaces(); ++placeId) {
+        storm::gspn::Place const& place = *gspn.getPlace(placeId);
+        uint64_t capacity = place.hasRestrictedCapacity() ? place.getCapacity() : defaultCapacity;
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= capacity, storm::exceptions::InvalidModelException,
+                        "Initial number of tokens of place '" << place.getName() << "' exceeds its capacity of " << capacity << ".");
+        // Row and column variables of a place are interleaved by the manager
+        placeVariables.push_back(manager->addMetaVariable(place.getName(), 0, capacity));
+        placeCapacities.push_back(capacity);
+    }
+}
+
+template<storm::dd::DdType Type>
+typename DdGspnBuilder<Type>::TransitionEncoding DdGspnBuilder<Type>::encodeTransition(storm::gspn::Transition const& transition) const {
+    TransitionEncoding encoding(manager->getBddOne(), manager->getBddOne(), manager->getBddZero());
+
+    std::set<uint64_t> places;
+    for (auto const& inputPlace : transition.getInputPlaces()) {
+        places.insert(inputPlace.first);
+    }
+    for (auto const& outputPlace : transition.getOutputPlaces()) {
+        places.insert(outputPlace.first);
+    }
+    for (auto const& inhibitionPlace : transition.getInhibitionPlaces()) {
+        places.insert(inhibitionPlace.first);
+    }
+
+    for (uint64_t placeId : places) {
+        auto inputIt = transition.getInputPlaces().find(placeId);
+        auto outputIt = transition.getOutputPlaces().find(placeId);
+        auto inhibitionIt = transition.getInhibitionPlaces().find(placeId);
+        uint64_t consumed = inputIt == transition.getInputPlaces().end() ? 0 : inputIt->second;
+        uint64_t produced = outputIt == transition.getOutputPlaces().end() ? 0 : outputIt->second;
+
+        // The transition is enabled iff the number of tokens lies in [low, high]
+        uint64_t low = consumed;
+        uint64_t high = placeCapacities[placeId];
+        if (inhibitionIt != transition.getInhibitionPlaces().end()) {
+            if (inhibitionIt->second == 0) {
+                encoding.guard = manager->getBddZero();
+                continue;
+            }
+            high = std::min(high, inhibitionIt->second - 1);
+        }
+        if (low > high) {
+            encoding.guard = manager->getBddZero();
+            continue;
+        }
+        encoding.guard &= getTokenRange(placeId, low, high);
+
+        // Places whose number of tokens does not change are not part of the update
+        if (consumed == produced) {
+            continue;
+        }
+        auto const& variables = placeVariables[placeId];
+        storm::dd::Bdd<Type> placeUpdate = manager->getBddZero();
+        for (uint64_t tokens = low; tokens <= high; ++tokens) {
+            uint64_t newTokens = tokens - consumed + produced;
+            if (newTokens > placeCapacities[placeId]) {
+                encoding.overflow |= manager->getEncoding(variables.first, tokens);
+            } else {
+                placeUpdate |= manager->getEncoding(variables.first, tokens) && manager->getEncoding(variables.second, newTokens);
+            }
+        }
+        encoding.update &= placeUpdate;
+        encoding.rowVariables.insert(variables.first);
+        encoding.columnVariables.insert(variables.second);
+    }
+    encoding.overflow &= encoding.guard;
+    return encoding;
+}
+
+template<storm::dd::DdType Type>
+storm::dd::Bdd<Type> DdGspnBuilder<Type>::getTokenRange(uint64_t placeId, uint64_t low, uint64_t high) const {
+    storm::dd::Bdd<Type> result = manager->getBddZero();
+    for (uint64_t tokens = low; tokens <= high; ++tokens) {
+        result |= manager->getEncoding(placeVariables[placeId].first, tokens);
+    }
+    return result;
+}
+
+template class DdGspnBuilder<storm::dd::DdType::CUDD>;
+template class DdGspnBuilder<storm::dd::DdType::Sylvan>;
+
+}  // namespace builder
+}  // namespace storm
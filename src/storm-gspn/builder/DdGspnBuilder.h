@@ -0,0 +1,163 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * This class explores the reachability graph of a GSPN symbolically without translating the GSPN to JANI first.
+ * Each place is encoded by its own meta variable whose range is given by the capacity of the place, i.e., the number of tokens is stored in binary.
+ * The transition relation is partitioned: each transition has its own relation which only refers to the places connected to the transition.
+ * All other places are left untouched by the relational product such that no frame condition has to be encoded.
+ * The exploration applies the transition relations in sequence (chaining), which typically needs far fewer iterations than a breadth-first search.
+ *
+ * Enabling respects the GSPN semantics: immediate transitions take precedence over timed transitions
+ * and immediate transitions are only enabled if no immediate transition of higher priority is enabled.
+ */
+template<storm::dd::DdType Type>
+class DdGspnBuilder {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param gspn The GSPN.
+     */
+    DdGspnBuilder(storm::gspn::GSPN const& gspn);
+
+    /*!
+     * Set the capacity which is assumed for places without restricted capacity.
+     * Exceeding this capacity during the exploration results in an exception.
+     *
+     * @param capacity Maximal number of tokens.
+     */
+    void setDefaultCapacity(uint64_t capacity);
+
+    /*!
+     * Explore the reachable markings of the GSPN.
+     */
+    void build();
+
+    /*!
+     * Get the manager of the decision diagrams.
+     */
+    std::shared_ptr<storm::dd::DdManager<Type>> const& getManager() const;
+
+    /*!
+     * Get the (row) meta variable encoding the number of tokens of the given place.
+     */
+    storm::expressions::Variable const& getPlaceVariable(uint64_t placeId) const;
+
+    /*!
+     * Get the (column) meta variable encoding the number of tokens of the given place after firing a transition.
+     */
+    storm::expressions::Variable const& getPlacePrimedVariable(uint64_t placeId) const;
+
+    /*!
+     * Get the initial marking.
+     */
+    storm::dd::Bdd<Type> const& getInitialMarking() const;
+
+    /*!
+     * Get the reachable markings.
+     */
+    storm::dd::Bdd<Type> const& getReachableMarkings() const;
+
+    /*!
+     * Get the reachable markings in which no immediate transition is enabled.
+     */
+    storm::dd::Bdd<Type> getTangibleMarkings() const;
+
+    /*!
+     * Get the reachable markings in which no transition is enabled.
+     */
+    storm::dd::Bdd<Type> getDeadlockMarkings() const;
+
+    /*!
+     * Get the number of reachable markings.
+     */
+    uint64_t getNumberOfReachableMarkings() const;
+
+    /*!
+     * Get the transition relations of the immediate transitions followed by the ones of the timed transitions.
+     * Each relation only contains the meta variables of the places connected to the transition and already respects the priorities.
+     */
+    std::vector<storm::dd::Bdd<Type>> const& getTransitionRelations() const;
+
+   private:
+    /*!
+     * Information about the encoding of a single transition.
+     */
+    struct TransitionEncoding {
+        TransitionEncoding(storm::dd::Bdd<Type> const& guard, storm::dd::Bdd<Type> const& update, storm::dd::Bdd<Type> const& overflow);
+
+        // Markings in which the transition is enabled.
+        storm::dd::Bdd<Type> guard;
+
+        // Relation between the old and new number of tokens of all places changed by the transition.
+        storm::dd::Bdd<Type> update;
+
+        // Markings in which the transition is enabled but firing it exceeds the capacity of some place.
+        storm::dd::Bdd<Type> overflow;
+
+        // Row and column meta variables of the changed places.
+        std::set<storm::expressions::Variable> rowVariables;
+        std::set<storm::expressions::Variable> columnVariables;
+    };
+
+    /*!
+     * Create the meta variables of all places.
+     */
+    void createVariables();
+
+    /*!
+     * Encode the guard and update of a transition.
+     */
+    TransitionEncoding encodeTransition(storm::gspn::Transition const& transition) const;
+
+    /*!
+     * Get the markings in which the number of tokens of the given place lies in [low, high].
+     */
+    storm::dd::Bdd<Type> getTokenRange(uint64_t placeId, uint64_t low, uint64_t high) const;
+
+    // The GSPN.
+    storm::gspn::GSPN const& gspn;
+
+    // Capacity of places without restricted capacity.
+    uint64_t defaultCapacity;
+
+    // The manager of the decision diagrams.
+    std::shared_ptr<storm::dd::DdManager<Type>> manager;
+
+    // Meta variables (row, column) of the places.
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> placeVariables;
+
+    // Capacity of each place.
+    std::vector<uint64_t> placeCapacities;
+
+    // The encodings of all transitions, the immediate transitions come first.
+    std::vector<TransitionEncoding> transitionEncodings;
+
+    // The (partitioned) transition relations in the same order as the encodings.
+    std::vector<storm::dd::Bdd<Type>> transitionRelations;
+
+    // Markings in which an immediate transition is enabled.
+    storm::dd::Bdd<Type> vanishingMarkings;
+
+    // Markings in which a transition is enabled.
+    storm::dd::Bdd<Type> enablingMarkings;
+
+    storm::dd::Bdd<Type> initialMarking;
+    storm::dd::Bdd<Type> reachableMarkings;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -1,332 +1,306 @@
-//#include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-//#include "storm/models/sparse/StandardRewardModel.h"
-//
-//#include "storm/utility/macros.h"
-//#include "storm/exceptions/NotImplementedException.h"
-//#include "storm/storage/expressions/ExpressionManager.h"
-//#include "storm-parsers/parser/FormulaParser.h"
-//#include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-// namespace storm {
-//    namespace builder {
-//
-//        template<typename ValueType>
-//        storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string const&
-//        formula) {
-//            // set the given gspn and compute the limits of the net
-//            this->gspn = gspn;
-//            computeCapacities(gspn);
-//
-//            // markings maps markings to their corresponding rowgroups (indices)
-//            markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//            builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//            // add initial marking to todo list
-//            auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//            findOrAddBitvectorToMarkings(*bitvector);
-//            currentRowIndex = 0;
-//
-//            // vector marking markovian states (vector contains an 1 if the state is markovian)
-//            storm::storage::BitVector markovianStates(0);
-//
-//            // vector containing the exit rates for the markovian states
-//            std::vector<ValueType> exitRates;
-//
-//
-//            while (!todo.empty()) {
-//                // take next element from the todo list
-//                auto currentBitvector = todo.front();
-//                todo.pop_front();
-//                auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                // increment list of states by one
-//                markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                // create new row group for the current marking
-//                builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                if (!enabledImmediateTransitions.empty()) {
-//                    markovianStates.set(currentRowIndex, 0);
-//                    exitRates.push_back(0);
-//
-//                    auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                    addRowForPartitions(partitions, currentMarking);
-//                } else {
-//
-//                    auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                    if (!enabledTimedTransitions.empty()) {
-//                        markovianStates.set(currentRowIndex, 1);
-//
-//                        auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                        std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                        exitRates.push_back(accRate);
-//
-//                        addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                    } else {
-//                        markovianStates.set(currentRowIndex, 1);
-//                    }
-//                }
-//                ++currentRowIndex;
-//            }
-//
-//            auto matrix = builder.build();
-//
-//            // create expression manager and add variables from the gspn
-//            auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//            for (auto& place : gspn.getPlaces()) {
-//                expressionManager->declareIntegerVariable(place.getName());
-//            }
-//
-//            // parse formula
-//            storm::parser::FormulaParser formulaParser(expressionManager);
-//            auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//            auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//            // create empty state labeling
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//            storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//            std::cout << '\n';
-//            std::cout << "build labeling:\n";
-//            for (auto& atomicFormula : atomicFormulas) {
-//                std::cout << atomicFormula;
-//                auto label = atomicFormula->toString();
-//                labeling.addLabel(label);
-//
-//                for (auto statePair : markings) {
-//                    auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                    for (auto& place : gspn.getPlaces()) {
-//                        auto variable = expressionManager->getVariable(place.getName());
-//                        expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                    }
-//                    bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                    if (hold) {
-//                        labeling.addLabelToState(label, statePair.second);
-//                    }
-//                }
-//
-//            }
-//
-//            //auto labeling = getStateLabeling();
-//
-//            return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//        const& partitions, storm::gspn::Marking const& currentMarking) {
-//            for (auto& partition : partitions) {
-//                std::cout << "\tnew partition:\n";
-//                auto accWeight = getAccumulatedWeight(partition);
-//                std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                for (auto& trans : partition) {
-//                    std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                    auto newMarking = trans.fire(currentMarking);
-//                    std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                    findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                    auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                    double currentWeight = 0;
-//                    if (it != weights.end()) {
-//                        currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                    }
-//                    currentWeight += trans.getWeight() / accWeight;
-//                    weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                }
-//
-//                addValuesToBuilder(weights);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//        enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//            std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//            for (auto& trans : enabledTimedTransitions) {
-//                std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                auto newMarking = trans.fire(currentMarking);
-//                std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                double currentWeightRate = 0;
-//                if (it != rates.end()) {
-//                    currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                }
-//                currentWeightRate += trans.getRate() / accRate;
-//                rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//            }
-//
-//            addValuesToBuilder(rates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//        storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//            for (auto& it : values) {
-//                std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                builder.addNextValue(currentRowIndex, it.first, it.second);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//        ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                storm::gspn::Marking const& marking,
-//                std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//            decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//            for (auto& trans : enabledImmediateTransitions) {
-//                if (trans.noWeightAttached()) {
-//                    decltype(weightedTransitions) singleton;
-//                    singleton.push_back(trans);
-//                    result.push_back(singleton);
-//                } else {
-//                    weightedTransitions.push_back(trans);
-//                }
-//            }
-//
-//            if (weightedTransitions.size() != 0) {
-//                result.push_back(weightedTransitions);
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector)
-//        const {
-//            double result = 0;
-//
-//            for (auto &trans : vector) {
-//                result += trans.getWeight();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//            uint_fast64_t sum = 0;
-//            for (auto& place : gspn.getPlaces()) {//TODO
-//                numberOfBits[place.getID()] = 1;
-//                sum += numberOfBits[place.getID()];
-//            }
-//
-//            // compute next multiple of 64
-//            uint_fast64_t rem = sum % 64;
-//            numberOfTotalBits = sum + 64 - rem;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getTimedTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getImmediateTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//            double result = 0;
-//            for (auto trans : vector) {
-//                result += trans.getRate();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//            for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                if (std::get<1>(*it) == index) {
-//                    return std::get<0>(*it);
-//                }
-//            }
-//            return storm::storage::BitVector();
-//        }
-//
-//        template<typename ValueType>
-//        uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//            auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//            if (index == nextRowGroupIndex) {
-//                // bitvector was not already in the map
-//                ++nextRowGroupIndex;
-//                // bitvector was also never in the todo list
-//                todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//            }
-//            return index;
-//        }
-//
-//        template<typename ValueType>
-//        storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//            std::map<uint_fast64_t , std::string> idToName;
-//            for (auto& place : gspn.getPlaces()) {
-//                idToName[place.getID()] = place.getName();
-//                labeling.addLabel(place.getName());
-//            }
-//
-//            auto it = markings.begin();
-//            for ( ; it != markings.end() ; ++it) {
-//                auto bitvector = std::get<0>(*it);
-//                storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                    if (marking.getNumberOfTokensAt(i) > 0) {
-//                        std::cout << i << '\n';
-//                        labeling.addLabelToState(idToName.at(i), i);
-//                    }
-//                }
-//            }
-//
-//            return labeling;
-//        }
-//
-//        template class ExplicitGspnModelBuilder<double>;
-//    }
-//}
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <thread>
+
+#include <boost/optional.hpp>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::VanishingCache::VanishingCache(uint64_t bucketSize) : indices(bucketSize, 1000) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t numberOfThreads)
+    : gspn(gspn), numberOfThreads(numberOfThreads), defaultCapacity(255), markingSize(64) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required.");
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::setDefaultCapacity(uint64_t capacity) {
+    this->defaultCapacity = capacity;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ExplicitGspnModelBuilder<ValueType>::build() {
+    // Compute the layout of the markings
+    placeOffsets.clear();
+    placeBits.clear();
+    placeCapacities.clear();
+    uint64_t offset = 0;
+    for (uint64_t placeId = 0; placeId < gspn.getNumberOfPlaces(); ++placeId) {
+        storm::gspn::Place const& place = *gspn.getPlace(placeId);
+        uint64_t capacity = place.hasRestrictedCapacity() ? place.getCapacity() : defaultCapacity;
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= capacity, storm::exceptions::InvalidModelException,
+                        "Initial number of tokens of place '" << place.getName() << "' exceeds its capacity of " << capacity << ".");
+        uint64_t bits = 1;
+        while (bits < 64 && (capacity >> bits) > 0) {
+            ++bits;
+        }
+        placeOffsets.push_back(offset);
+        placeBits.push_back(bits);
+        placeCapacities.push_back(capacity);
+        offset += bits;
+    }
+    // Bit vectors in hash maps must have a size which is a multiple of 64
+    markingSize = std::max<uint64_t>(64, ((offset + 63) / 64) * 64);
+
+    storm::storage::BitVector initialMarking(markingSize);
+    for (uint64_t placeId = 0; placeId < gspn.getNumberOfPlaces(); ++placeId) {
+        setTokens(initialMarking, placeId, gspn.getPlace(placeId)->getNumberOfInitialTokens());
+    }
+    if (isVanishing(initialMarking)) {
+        VanishingCache cache(markingSize);
+        Distribution const& initialDistribution = cache.distributions[eliminateVanishing(initialMarking, cache)];
+        STORM_LOG_THROW(initialDistribution.size() == 1, storm::exceptions::NotSupportedException,
+                        "The initial marking is vanishing and leads to " << initialDistribution.size() << " different tangible markings.");
+        initialMarking = initialDistribution.begin()->first;
+    }
+
+    storm::storage::BitVectorHashMap<uint64_t> markingStore(markingSize, 100000);
+    markingStore.findOrAdd(initialMarking, 0);
+    std::vector<storm::storage::BitVector> frontier = {initialMarking};
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, false);
+    std::vector<uint64_t> deadlockStates;
+    uint64_t currentState = 0;
+
+    while (!frontier.empty()) {
+        // Compute the successors of all markings in the frontier
+        // The vanishing markings are only cached within one round to bound the memory consumption
+        std::vector<Distribution> successors(frontier.size());
+        uint64_t usedThreads = std::min<uint64_t>(numberOfThreads, frontier.size());
+        auto computeSuccessorsOfThread = [&](uint64_t thread) {
+            VanishingCache cache(markingSize);
+            for (uint64_t i = thread; i < frontier.size(); i += usedThreads) {
+                successors[i] = computeSuccessors(frontier[i], cache);
+            }
+        };
+        if (usedThreads == 1) {
+            computeSuccessorsOfThread(0);
+        } else {
+            std::vector<std::thread> workers;
+            std::vector<std::exception_ptr> exceptions(usedThreads);
+            for (uint64_t thread = 0; thread < usedThreads; ++thread) {
+                workers.emplace_back([&, thread]() {
+                    try {
+                        computeSuccessorsOfThread(thread);
+                    } catch (...) {
+                        exceptions[thread] = std::current_exception();
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        }
+
+        // Add the successors in the order of the frontier
+        std::vector<storm::storage::BitVector> nextFrontier;
+        std::vector<std::pair<uint64_t, ValueType>> row;
+        for (uint64_t i = 0; i < frontier.size(); ++i, ++currentState) {
+            STORM_LOG_ASSERT(markingStore.getValue(frontier[i]) == currentState, "Rows are not added in the order of the states.");
+            row.clear();
+            for (auto const& successor : successors[i]) {
+                uint64_t newState = markingStore.size();
+                uint64_t successorState = markingStore.findOrAdd(successor.first, newState);
+                if (successorState == newState) {
+                    nextFrontier.push_back(successor.first);
+                }
+                row.emplace_back(successorState, successor.second);
+            }
+            if (row.empty()) {
+                // Add self-loop for deadlock states
+                deadlockStates.push_back(currentState);
+                row.emplace_back(currentState, storm::utility::one<ValueType>());
+            }
+            std::sort(row.begin(), row.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+            for (auto const& entry : row) {
+                matrixBuilder.addNextValue(currentState, entry.first, entry.second);
+            }
+        }
+        frontier = std::move(nextFrontier);
+        STORM_LOG_DEBUG("Explored " << currentState << " tangible markings, " << frontier.size() << " markings in the frontier.");
+    }
+
+    uint64_t numberOfStates = markingStore.size();
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("deadlock", storm::storage::BitVector(numberOfStates, deadlockStates.begin(), deadlockStates.end()));
+    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(matrixBuilder.build(numberOfStates, numberOfStates), std::move(labeling));
+}
+
+template<typename ValueType>
+typename ExplicitGspnModelBuilder<ValueType>::Distribution ExplicitGspnModelBuilder<ValueType>::computeSuccessors(storm::storage::BitVector const& marking,
+                                                                                                                  VanishingCache& cache) const {
+    Distribution successors;
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        if (storm::utility::isZero(transition.getRate()) || !isEnabled(transition, marking)) {
+            continue;
+        }
+        ValueType rate = getRate(transition, marking);
+        storm::storage::BitVector successor = fire(transition, marking);
+        if (isVanishing(successor)) {
+            // Split the rate among the tangible markings reached via immediate transitions
+            uint64_t index = eliminateVanishing(successor, cache);
+            for (auto const& entry : cache.distributions[index]) {
+                successors[entry.first] += rate * entry.second;
+            }
+        } else {
+            successors[successor] += rate;
+        }
+    }
+    return successors;
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::eliminateVanishing(storm::storage::BitVector const& marking, VanishingCache& cache) const {
+    if (cache.indices.contains(marking)) {
+        uint64_t index = cache.indices.getValue(marking);
+        STORM_LOG_THROW(cache.resolved[index], storm::exceptions::NotSupportedException, "Cycles of immediate transitions are not supported.");
+        return index;
+    }
+    uint64_t index = cache.distributions.size();
+    cache.indices.findOrAdd(marking, index);
+    cache.distributions.emplace_back();
+    cache.resolved.push_back(false);
+
+    Distribution distribution;
+    for (auto const& choice : getImmediateChoice(marking)) {
+        storm::storage::BitVector successor = fire(gspn.getImmediateTransitions()[choice.first], marking);
+        if (isVanishing(successor)) {
+            // The cached distributions might be moved by the recursive call, so no reference is kept
+            uint64_t successorIndex = eliminateVanishing(successor, cache);
+            for (auto const& entry : cache.distributions[successorIndex]) {
+                distribution[entry.first] += choice.second * entry.second;
+            }
+        } else {
+            distribution[successor] += choice.second;
+        }
+    }
+    cache.distributions[index] = std::move(distribution);
+    cache.resolved[index] = true;
+    return index;
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isVanishing(storm::storage::BitVector const& marking) const {
+    for (auto const& transition : gspn.getImmediateTransitions()) {
+        if (!transition.noWeightAttached() && isEnabled(transition, marking)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename ValueType>
+std::vector<std::pair<uint64_t, ValueType>> ExplicitGspnModelBuilder<ValueType>::getImmediateChoice(storm::storage::BitVector const& marking) const {
+    std::vector<std::pair<uint64_t, ValueType>> choice;
+    boost::optional<uint64_t> enabledPriority;
+    // Partitions are ordered by decreasing priority
+    for (auto const& partition : gspn.getPartitions()) {
+        if (enabledPriority && partition.priority < enabledPriority.get()) {
+            break;
+        }
+        std::vector<std::pair<uint64_t, ValueType>> partitionChoice;
+        ValueType totalWeight = storm::utility::zero<ValueType>();
+        for (uint64_t transitionId : partition.transitions) {
+            auto const& transition = gspn.getImmediateTransitions()[transitionId];
+            if (!transition.noWeightAttached() && isEnabled(transition, marking)) {
+                partitionChoice.emplace_back(transitionId, transition.getWeight());
+                totalWeight += transition.getWeight();
+            }
+        }
+        if (partitionChoice.empty()) {
+            continue;
+        }
+        STORM_LOG_THROW(choice.empty(), storm::exceptions::NotSupportedException,
+                        "Immediate transitions of different partitions with priority " << partition.priority << " are enabled concurrently.");
+        for (auto& entry : partitionChoice) {
+            entry.second /= totalWeight;
+        }
+        choice = std::move(partitionChoice);
+        enabledPriority = partition.priority;
+    }
+    return choice;
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isEnabled(storm::gspn::Transition const& transition, storm::storage::BitVector const& marking) const {
+    for (auto const& inputPlace : transition.getInputPlaces()) {
+        if (getTokens(marking, inputPlace.first) < inputPlace.second) {
+            return false;
+        }
+    }
+    for (auto const& inhibitionPlace : transition.getInhibitionPlaces()) {
+        if (getTokens(marking, inhibitionPlace.first) >= inhibitionPlace.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::fire(storm::gspn::Transition const& transition, storm::storage::BitVector const& marking) const {
+    storm::storage::BitVector successor(marking);
+    for (auto const& inputPlace : transition.getInputPlaces()) {
+        setTokens(successor, inputPlace.first, getTokens(successor, inputPlace.first) - inputPlace.second);
+    }
+    for (auto const& outputPlace : transition.getOutputPlaces()) {
+        uint64_t tokens = getTokens(successor, outputPlace.first) + outputPlace.second;
+        STORM_LOG_THROW(tokens <= placeCapacities[outputPlace.first], storm::exceptions::InvalidModelException,
+                        "Firing transition '" << transition.getName() << "' exceeds the capacity " << placeCapacities[outputPlace.first] << " of place '"
+                                              << gspn.getPlace(outputPlace.first)->getName() << "'.");
+        setTokens(successor, outputPlace.first, tokens);
+    }
+    return successor;
+}
+
+template<typename ValueType>
+ValueType ExplicitGspnModelBuilder<ValueType>::getRate(storm::gspn::TimedTransition<storm::gspn::GSPN::RateType> const& transition,
+                                                       storm::storage::BitVector const& marking) const {
+    ValueType rate = storm::utility::convertNumber<ValueType>(transition.getRate());
+    if (transition.hasSingleServerSemantics()) {
+        return rate;
+    }
+    STORM_LOG_THROW(transition.hasKServerSemantics() || !transition.getInputPlaces().empty(), storm::exceptions::InvalidModelException,
+                    "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+    // The enabling degree is the number of times the transition could fire concurrently
+    uint64_t enablingDegree = transition.hasKServerSemantics() ? transition.getNumberOfServers() : std::numeric_limits<uint64_t>::max();
+    for (auto const& inputPlace : transition.getInputPlaces()) {
+        enablingDegree = std::min(enablingDegree, getTokens(marking, inputPlace.first) / inputPlace.second);
+    }
+    return rate * storm::utility::convertNumber<ValueType>(enablingDegree);
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getTokens(storm::storage::BitVector const& marking, uint64_t placeId) const {
+    return marking.getAsInt(placeOffsets[placeId], placeBits[placeId]);
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::setTokens(storm::storage::BitVector& marking, uint64_t placeId, uint64_t tokens) const {
+    marking.setFromInt(placeOffsets[placeId], placeBits[placeId], tokens);
+}
+
+template class ExplicitGspnModelBuilder<double>;
+
+}  // namespace builder
+}  // namespace storm
@@ -1,175 +1,147 @@
-//#ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//#define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-//#include <string>
-//
-//#include "storm/models/sparse/MarkovAutomaton.h"
-//#include "storm/models/sparse/StandardRewardModel.h"
-//#include "storm/storage/BitVector.h"
-//#include "storm/storage/BitVectorHashMap.h"
-//#include "storm/storage/gspn/GSPN.h"
-//#include "storm/storage/gspn/ImmediateTransition.h"
-//#include "storm/storage/gspn/TimedTransition.h"
-//
-// namespace storm {
-//    namespace builder {
-//
-//        /*!
-//         * This class provides the facilities for building an markov automaton.
-//         */
-//        template<typename ValueType=double>
-//        class ExplicitGspnModelBuilder {
-//        public:
-//
-//            /*!
-//             * Builds an MarkovAutomaton from the given GSPN.
-//             *
-//             * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//             * @return The resulting MarkovAutomaton
-//             */
-//            storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//        private:
-//
-//            /*!
-//             * Add for each partition a new row in the probability matrix.
-//             *
-//             * @param partitions The partitioned immediate transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             */
-//            void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//            storm::gspn::Marking const& currentMarking);
-//
-//
-//            /*!
-//             * Add row for a markovian state.
-//             *
-//             * @param enabledTimedTransitions List of enabled timed transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             * @param accRate The sum of all rates of the enabled timed transisitons
-//             */
-//            void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//            storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//            /*!
-//             * Struct for comparing unsigned integer for maps
-//             */
-//            struct cmpByIndex {
-//                bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                    return a < b;
-//                }
-//            };
-//
-//            /*!
-//             * This method insert the values from a map into the matrix
-//             *
-//             * @param values The values which are inserted
-//             */
-//            void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//            /*!
-//             * This method partitions all enabled immediate transitions w.r.t. a marking.
-//             * All enabled weighted immediate transitions are in one vector. Between these transitions
-//             * is chosen probabilistically by the weights.
-//             *
-//             * All other enabled non-weighted immediate transitions are in an singleton vector.
-//             * Between different vectors is chosen non-deterministically.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//             * @return The vector of vectors which is described above.
-//             */
-//            std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//            const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//            /*!
-//             * Computes the accumulated weight of immediate transisions which are stored in a list.
-//             *
-//             * @param vector List of immediate transisitions.
-//             */
-//            double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//            /*!
-//             * Compute the upper bound for the number of tokens in each place.
-//             * Also computes the number of bits which are used to store a marking.
-//             *
-//             * @param gspn The corresponding gspn.
-//             */
-//            void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//            /*!
-//             * Returns the vector of enabled timed transition with the highest priority.
-//             *
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled timed transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Returns the vector of active immediate transition with the highest priority.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled immediate transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Computes the accumulated rate of a vector of timed transitions.
-//             *
-//             * @param vector The vector of timed transitions.
-//             * @return The accumulated rate.
-//             */
-//            double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//            // is only needed for debugging purposes
-//            // since markings is injective, we can determine the bitvector
-//            storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//            /*!
-//             * Adds the bitvector to the marking-map.
-//             * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//             *
-//             * @return The rowGroup index for the bitvector.
-//             */
-//            uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//            /*!
-//             * Computes the state labeling and returns it.
-//             * Every state is labeled with its name.
-//             *
-//             * @return The computed state labeling.
-//             */
-//            storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//            // contains the number of bits which are used the store the number of tokens at each place
-//            std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//            // contains the number of bits used to create markings
-//            uint_fast64_t numberOfTotalBits;
-//
-//            // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//            storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//            // a list of markings for which the outgoing edges need to be computed
-//            std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//            //the gspn which is transformed
-//            storm::gspn::GSPN gspn;
-//
-//            // the next index for a new rowgroup
-//            uint_fast64_t nextRowGroupIndex = 0;
-//
-//            // builder object which is used to create the probability matrix
-//            storm::storage::SparseMatrixBuilder<double> builder;
-//
-//            // contains the current row index during the computation
-//            uint_fast64_t currentRowIndex;
-//        };
-//    }
-//}
-//
-//#endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * This class builds the CTMC of a GSPN by directly exploring its tangible reachability graph.
+ * Vanishing markings, i.e., markings enabling immediate transitions, are eliminated on the fly: each timed transition leading to a vanishing marking is
+ * redirected to the tangible markings reached from it by firing immediate transitions and its rate is split according to the weights of the fired
+ * immediate transitions.
+ * The exploration proceeds in breadth-first rounds. Within a round, the successors of the frontier markings (including the elimination of vanishing
+ * markings) are computed by multiple threads. Afterwards, the successors are added to the marking store in the order of the frontier such that the
+ * state numbering does not depend on the number of threads.
+ *
+ * Markings are stored as bit vectors in which each place uses as many bits as are required to encode its capacity.
+ * Only GSPNs whose immediate transitions do not induce non-determinism are supported. Otherwise, the Markov automaton has to be built via JaniGSPNBuilder.
+ */
+template<typename ValueType = double>
+class ExplicitGspnModelBuilder {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param gspn The GSPN.
+     * @param numberOfThreads Number of threads computing the successors of markings.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t numberOfThreads = 1);
+
+    /*!
+     * Set the capacity which is assumed for places without restricted capacity.
+     * Exceeding this capacity during the exploration results in an exception.
+     *
+     * @param capacity Maximal number of tokens.
+     */
+    void setDefaultCapacity(uint64_t capacity);
+
+    /*!
+     * Build the CTMC of the GSPN.
+     * States which have no outgoing transitions get a self-loop and are labelled with "deadlock".
+     *
+     * @return The CTMC.
+     */
+    std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> build();
+
+   private:
+    // Tangible markings reached with the given rates (or probabilities).
+    typedef std::map<storm::storage::BitVector, ValueType> Distribution;
+
+    /*!
+     * Cache for the tangible distributions of vanishing markings. Each thread uses its own cache.
+     */
+    struct VanishingCache {
+        VanishingCache(uint64_t bucketSize);
+
+        // Index of the vanishing markings in the distributions.
+        storm::storage::BitVectorHashMap<uint64_t> indices;
+
+        // The tangible distributions of the vanishing markings.
+        std::vector<Distribution> distributions;
+
+        // Whether the distribution is completely computed. Otherwise, the marking is still on the stack of the elimination.
+        std::vector<bool> resolved;
+    };
+
+    /*!
+     * Compute the tangible successors of a tangible marking.
+     *
+     * @param marking Tangible marking.
+     * @param cache Cache for vanishing markings.
+     * @return Tangible successors with their rates.
+     */
+    Distribution computeSuccessors(storm::storage::BitVector const& marking, VanishingCache& cache) const;
+
+    /*!
+     * Compute the distribution over tangible markings which results from firing immediate transitions in a vanishing marking.
+     *
+     * @param marking Vanishing marking.
+     * @param cache Cache for vanishing markings.
+     * @return Index of the distribution in the cache.
+     */
+    uint64_t eliminateVanishing(storm::storage::BitVector const& marking, VanishingCache& cache) const;
+
+    /*!
+     * Check whether an immediate transition is enabled in the given marking.
+     */
+    bool isVanishing(storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Get the probabilities with which enabled immediate transitions fire in the given marking.
+     *
+     * @param marking Marking.
+     * @return Immediate transitions with their probability. Empty iff the marking is tangible.
+     */
+    std::vector<std::pair<uint64_t, ValueType>> getImmediateChoice(storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Check whether a transition is enabled in a marking.
+     */
+    bool isEnabled(storm::gspn::Transition const& transition, storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Fire a transition in a marking.
+     */
+    storm::storage::BitVector fire(storm::gspn::Transition const& transition, storm::storage::BitVector const& marking) const;
+
+    /*!
+     * Get the rate of an enabled timed transition in a marking according to its server semantics.
+     */
+    ValueType getRate(storm::gspn::TimedTransition<storm::gspn::GSPN::RateType> const& transition, storm::storage::BitVector const& marking) const;
+
+    uint64_t getTokens(storm::storage::BitVector const& marking, uint64_t placeId) const;
+
+    void setTokens(storm::storage::BitVector& marking, uint64_t placeId, uint64_t tokens) const;
+
+    // The GSPN.
+    storm::gspn::GSPN const& gspn;
+
+    // Number of threads.
+    uint64_t numberOfThreads;
+
+    // Capacity of places without restricted capacity.
+    uint64_t defaultCapacity;
+
+    // Offset of each place in the marking.
+    std::vector<uint64_t> placeOffsets;
+
+    // Number of bits of each place in the marking.
+    std::vector<uint64_t> placeBits;
+
+    // Capacity of each place.
+    std::vector<uint64_t> placeCapacities;
+
+    // Number of bits of a marking (a multiple of 64).
+    uint64_t markingSize;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -1,11 +1,14 @@
 #include "MonotonicityChecker.h"
 
+#include <algorithm>
+
 namespace storm {
     namespace analysis {
         /*** Constructor ***/
         template <typename ValueType>
         MonotonicityChecker<ValueType>::MonotonicityChecker(storage::SparseMatrix<ValueType> matrix) {
             this->matrix = matrix;
+            this->numberOfCheckedDerivatives = 0;
         }
 
         /*** Public methods ***/
@@ -114,19 +117,55 @@ namespace storm {
             return localMonotonicity;
         }
 
+        template <typename ValueType>
+        uint_fast64_t MonotonicityChecker<ValueType>::getNumberOfCheckedDerivatives() const {
+            return numberOfCheckedDerivatives;
+        }
+
         /*** Private methods ***/
         template <typename ValueType>
         typename MonotonicityChecker<ValueType>::Monotonicity MonotonicityChecker<ValueType>::checkTransitionMonRes(ValueType function, typename MonotonicityChecker<ValueType>::VariableType param, typename MonotonicityChecker<ValueType>::Region region) {
-            std::pair<bool, bool> res = MonotonicityChecker<ValueType>::checkDerivative(getDerivative(function, param), region);
+            if (function.isConstant()) {
+                return Monotonicity::Constant;
+            }
+            auto& derivative = getDerivative(function, param);
+            std::set<VariableType> derivativeVariables = derivative.gatherVariables();
+
+            // Check whether the monotonicity is already known for a region containing the current region
+            auto& knownResults = transitionMonotonicity[function][param];
+            for (auto const& knownResult : knownResults) {
+                if (isContainedIn(region, knownResult.first, derivativeVariables)) {
+                    return knownResult.second;
+                }
+            }
+
+            ++numberOfCheckedDerivatives;
+            std::pair<bool, bool> res = MonotonicityChecker<ValueType>::checkDerivative(derivative, region);
+            Monotonicity result;
             if (res.first && !res.second) {
-                return Monotonicity::Incr;
+                result = Monotonicity::Incr;
             } else if (!res.first && res.second) {
-                return Monotonicity::Decr;
+                result = Monotonicity::Decr;
             } else if (res.first && res.second) {
-                return Monotonicity::Constant;
+                result = Monotonicity::Constant;
             } else {
+                // Not being monotone on this region does not carry over to its subregions
                 return Monotonicity::Not;
             }
+            // Results on regions contained in the current region are not needed anymore
+            knownResults.erase(std::remove_if(knownResults.begin(), knownResults.end(), [&](std::pair<Region, Monotonicity> const& knownResult) { return isContainedIn(knownResult.first, region, derivativeVariables); }), knownResults.end());
+            knownResults.emplace_back(region, result);
+            return result;
+        }
+
+        template <typename ValueType>
+        bool MonotonicityChecker<ValueType>::isContainedIn(Region const& region, Region const& other, std::set<VariableType> const& variables) {
+            for (auto const& variable : variables) {
+                if (region.getLowerBoundary(variable) < other.getLowerBoundary(variable) || region.getUpperBoundary(variable) > other.getUpperBoundary(variable)) {
+                    return false;
+                }
+            }
+            return true;
         }
 
         template <typename ValueType>
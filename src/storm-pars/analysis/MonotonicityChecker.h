@@ -100,14 +100,30 @@ namespace storm {
              */
             Monotonicity checkLocalMonotonicity(std::shared_ptr<Order> const & order, uint_fast64_t state, VariableType const& var, storage::ParameterRegion<ValueType> const& region);
 
+            /*!
+             * Returns the number of derivatives whose sign had to be checked (i.e., that could not be answered by a previous check on a larger region).
+             */
+            uint_fast64_t getNumberOfCheckedDerivatives() const;
+
         private:
             Monotonicity checkTransitionMonRes(ValueType function, VariableType param, Region region);
 
             ValueType& getDerivative(ValueType function, VariableType var);
 
+            /*!
+             * Checks whether the given region is contained in the other region when only considering the given variables.
+             */
+            static bool isContainedIn(Region const& region, Region const& other, std::set<VariableType> const& variables);
+
             storage::SparseMatrix<ValueType> matrix;
 
             boost::container::flat_map<ValueType, boost::container::flat_map<VariableType, ValueType>> derivatives;
+
+            // The conclusive monotonicity results (Incr, Decr or Constant) of the transitions, together with the region on which they were obtained.
+            // As these results remain valid for every subregion, they are reused during region refinement.
+            boost::container::flat_map<ValueType, boost::container::flat_map<VariableType, std::vector<std::pair<Region, Monotonicity>>>> transitionMonotonicity;
+
+            uint_fast64_t numberOfCheckedDerivatives;
         };
     }
 }
@@ -323,9 +323,17 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                 break;
             }
 
+            std::map<VariableType<FunctionType>, std::unique_ptr<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> checkResults;
+            if (batchedDerivativeEvaluation) {
+                checkResults =
+                    derivativeEvaluationHelper->checkMultipleParameters(env, nesterovPredictedPosition, miniBatch, valueVector, numberOfDerivativeThreads);
+            } else {
+                for (auto const& parameter : miniBatch) {
+                    checkResults[parameter] = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
+                }
+            }
             for (auto const& parameter : miniBatch) {
-                auto checkResult = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
-                ConstantType delta = checkResult->getValueVector()[derivativeEvaluationHelper->getInitialState()];
+                ConstantType delta = checkResults.at(parameter)->getValueVector()[derivativeEvaluationHelper->getInitialState()];
                 if (currentCheckTask->getBound().comparisonType == logic::ComparisonType::Less ||
                     currentCheckTask->getBound().comparisonType == logic::ComparisonType::LessEqual) {
                     delta = -delta;
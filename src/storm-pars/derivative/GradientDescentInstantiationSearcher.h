@@ -161,6 +161,17 @@ class GradientDescentInstantiationSearcher {
         derivativeEvaluationHelper->specifyFormula(env, *this->currentCheckTaskNoBound);
     }
 
+    /**
+     * Sets whether the derivatives of a mini-batch are computed in one batch (see SparseDerivativeInstantiationModelChecker::checkMultipleParameters)
+     * instead of one after the other. This pays off for models with many parameters.
+     * @param batchedDerivativeEvaluation Whether the derivatives are computed in one batch.
+     * @param numberOfThreads The number of threads among which the parameters of a mini-batch are distributed.
+     */
+    void setBatchedDerivativeEvaluation(bool batchedDerivativeEvaluation, uint64_t numberOfThreads = 1) {
+        this->batchedDerivativeEvaluation = batchedDerivativeEvaluation;
+        this->numberOfDerivativeThreads = numberOfThreads;
+    }
+
     /**
      * Perform Gradient Descent.
      * @param env The environment. Pass the same environment as to specifyFormula.
@@ -205,6 +216,8 @@ class GradientDescentInstantiationSearcher {
     const uint_fast64_t miniBatchSize;
     const ConstantType terminationEpsilon;
     const GradientDescentConstraintMethod constraintMethod;
+    bool batchedDerivativeEvaluation = false;
+    uint64_t numberOfDerivativeThreads = 1;
 
     // This is for visualizing data
     const bool recordRun;
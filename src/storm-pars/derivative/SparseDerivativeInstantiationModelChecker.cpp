@@ -1,4 +1,9 @@
 #include "SparseDerivativeInstantiationModelChecker.h"
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
 #include "analysis/GraphConditions.h"
 #include "environment/Environment.h"
 #include "environment/solver/GmmxxSolverEnvironment.h"
@@ -36,9 +41,8 @@ template<typename FunctionType>
 using CoefficientType = typename utility::parametric::CoefficientType<FunctionType>::type;
 
 template<typename FunctionType, typename ConstantType>
-std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
-    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
-    boost::optional<std::vector<ConstantType>> const& valueVector) {
+std::vector<ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::computeInterestingReachabilityProbabilities(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, boost::optional<std::vector<ConstantType>> const& valueVector) {
     std::vector<ConstantType> reachabilityProbabilities;
     if (!valueVector.is_initialized()) {
         storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<FunctionType>, ConstantType> instantiationModelChecker(model);
@@ -58,6 +62,15 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
             interestingReachabilityProbabilities.push_back(reachabilityProbabilities[i]);
         }
     }
+    return interestingReachabilityProbabilities;
+}
+
+template<typename FunctionType, typename ConstantType>
+std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
+    boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = computeInterestingReachabilityProbabilities(env, valuation, valueVector);
+
     // Instantiate the matrices with the given instantiation
 
     instantiationWatch.start();
@@ -72,7 +85,7 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
         functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
     }
 
-    auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
+    auto const& deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
 
     // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMappingUnderived) {
@@ -113,6 +126,104 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
     return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
 }
 
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::checkMultipleParameters(Environment const& env,
+                                                                                                storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                                                std::vector<VariableType<FunctionType>> const& parameters,
+                                                                                                boost::optional<std::vector<ConstantType>> const& valueVector,
+                                                                                                uint64_t numberOfThreads) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = computeInterestingReachabilityProbabilities(env, valuation, valueVector);
+
+    instantiationWatch.start();
+    // The matrix of the equation system is shared by all parameters, so it is instantiated only once.
+    for (auto& functionResult : this->functionsUnderived) {
+        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+    }
+    for (auto& entryValuePair : this->matrixMappingUnderived) {
+        entryValuePair.first->setValue(*(entryValuePair.second));
+    }
+    std::map<VariableType<FunctionType>, ConstantType> point;
+    for (auto const& variableValuePair : valuation) {
+        point.emplace(variableValuePair.first, storm::utility::convertNumber<ConstantType>(variableValuePair.second));
+    }
+    instantiationWatch.stop();
+
+    approximationWatch.start();
+    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, parameters.size()));
+    // The solvers are created upfront as the factory is not thread-safe (it accesses the settings).
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ConstantType>>> solvers;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        solvers.push_back(factory.create(env));
+        solvers.back()->setMatrix(constrainedMatrixInstantiated);
+        solvers.back()->setCachingEnabled(true);
+    }
+
+    std::vector<std::vector<ConstantType>> finalResults(parameters.size());
+    // Computes the derivatives for the parameters with the given index modulo the number of threads.
+    // Each parameter has its own placeholders and matrix (and compiled functions), so the threads operate on disjoint data.
+    auto computeDerivatives = [&](uint64_t thread) {
+        std::vector<ConstantType> variableValues;
+        auto evaluate = [&](storm::utility::CompiledRationalFunction<ConstantType> const& function) {
+            variableValues.clear();
+            for (auto const& variable : function.getVariables()) {
+                variableValues.push_back(point.at(variable));
+            }
+            return function.evaluate(variableValues);
+        };
+        std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
+        for (uint64_t index = thread; index < parameters.size(); index += numberOfThreads) {
+            auto const& parameter = parameters[index];
+            for (auto& placeholderFunctionPair : this->compiledFunctionsDerived.at(parameter)) {
+                *placeholderFunctionPair.first = evaluate(placeholderFunctionPair.second);
+            }
+            for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
+                entryValuePair.first->setValue(*(entryValuePair.second));
+            }
+
+            deltaConstrainedMatricesInstantiated->at(parameter).multiplyWithVector(interestingReachabilityProbabilities, resultVec);
+            for (auto const& rowFunctionPair : this->compiledDerivedOutputVecs.at(parameter)) {
+                resultVec[rowFunctionPair.first] += evaluate(rowFunctionPair.second);
+            }
+
+            finalResults[index].resize(resultVec.size());
+            solvers[thread]->solveEquations(env, finalResults[index], resultVec);
+        }
+    };
+
+    if (numberOfThreads == 1) {
+        computeDerivatives(0);
+    } else {
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> exceptions(numberOfThreads);
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            threads.emplace_back([&, thread]() {
+                try {
+                    computeDerivatives(thread);
+                } catch (...) {
+                    exceptions[thread] = std::current_exception();
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto const& exception : exceptions) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
+    approximationWatch.stop();
+
+    std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> result;
+    for (uint64_t index = 0; index < parameters.size(); ++index) {
+        result[parameters[index]] = std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(finalResults[index]));
+    }
+    return result;
+}
+
 template<typename FunctionType, typename ConstantType>
 void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::specifyFormula(
     Environment const& env, modelchecker::CheckTask<storm::logic::Formula, FunctionType> const& checkTask) {
@@ -290,6 +401,23 @@ void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::spec
         }
     }
 
+    // Compile the derived functions and output vectors for checkMultipleParameters
+    compiledFunctionsDerived.clear();
+    compiledDerivedOutputVecs.clear();
+    for (auto const& var : this->parameters) {
+        auto& compiledFunctions = compiledFunctionsDerived[var];
+        for (auto& functionResult : functionsDerived[var]) {
+            compiledFunctions.emplace_back(&functionResult.second, storm::utility::CompiledRationalFunction<ConstantType>(functionResult.first));
+        }
+        auto& compiledOutputVec = compiledDerivedOutputVecs[var];
+        auto const& derivedOutputVec = derivedOutputVecs->at(var);
+        for (uint64_t row = 0; row < derivedOutputVec.size(); ++row) {
+            if (!storm::utility::isZero(derivedOutputVec[row])) {
+                compiledOutputVec.emplace_back(row, storm::utility::CompiledRationalFunction<ConstantType>(derivedOutputVec[row]));
+            }
+        }
+    }
+
     generalSetupWatch.stop();
 
     // for (auto const& param : this->parameters) {
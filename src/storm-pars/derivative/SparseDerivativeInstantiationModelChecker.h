@@ -7,6 +7,7 @@
 #include "logic/Formula.h"
 #include "modelchecker/CheckTask.h"
 #include "solver/LinearEquationSolver.h"
+#include "storm-pars/utility/CompiledRationalFunction.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -46,7 +47,23 @@ class SparseDerivativeInstantiationModelChecker {
         Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
         typename utility::parametric::VariableType<FunctionType>::type const& parameter,
         boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
-    
+
+    /**
+     * checkMultipleParameters calculates the derivatives of the model w.r.t. several parameters at an instantiation.
+     * In contrast to calling check for every parameter, the reachability probabilities are computed and the equation system
+     * is instantiated only once. All right-hand sides are then solved against this shared matrix: each thread uses a single solver
+     * (with caching enabled) for all of its parameters, so that the setup of the solver is reused. The derived functions are evaluated
+     * in a compiled form, which allows to distribute the parameters over several threads.
+     * Call specifyFormula first!
+     * @param env The environment.
+     * @param parameters The parameters to compute the derivatives for.
+     * @param numberOfThreads The number of threads among which the parameters are distributed.
+     */
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+    checkMultipleParameters(Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                            std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parameters,
+                            boost::optional<std::vector<ConstantType>> const& valueVector = boost::none, uint64_t numberOfThreads = 1);
+
     uint64_t getInitialState() {
         return initialStateEqSystem;
     }
@@ -71,6 +88,13 @@ class SparseDerivativeInstantiationModelChecker {
         deltaConstrainedMatricesInstantiated;
     std::unique_ptr<std::map<typename utility::parametric::VariableType<FunctionType>::type, std::vector<FunctionType>>> derivedOutputVecs;
 
+    // Compiled versions of the derived functions (with their placeholders) and of the non-zero entries (with their rows) of the derived output vectors.
+    // These are used by checkMultipleParameters.
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::vector<std::pair<ConstantType*, storm::utility::CompiledRationalFunction<ConstantType>>>>
+        compiledFunctionsDerived;
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::vector<std::pair<uint64_t, storm::utility::CompiledRationalFunction<ConstantType>>>>
+        compiledDerivedOutputVecs;
+
     // next states: states that have a relevant successor
     storage::BitVector next;
     uint_fast64_t initialStateEqSystem;
@@ -80,6 +104,8 @@ class SparseDerivativeInstantiationModelChecker {
         std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& matrixMapping,
         std::unordered_map<FunctionType, ConstantType>& functions);
     void setup(Environment const& env, modelchecker::CheckTask<storm::logic::Formula, FunctionType> const& checkTask);
+    std::vector<ConstantType> computeInterestingReachabilityProbabilities(Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                          boost::optional<std::vector<ConstantType>> const& valueVector);
 
     utility::Stopwatch instantiationWatch;
     utility::Stopwatch approximationWatch;
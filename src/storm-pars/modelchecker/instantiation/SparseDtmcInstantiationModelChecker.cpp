@@ -1,5 +1,7 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -19,7 +21,28 @@ namespace storm {
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
-            auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+            return checkInstantiatedModel(env, modelInstantiator.instantiate(valuation));
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            // The valuations are evaluated in chunks to bound the memory required for the evaluated functions.
+            uint64_t const chunkSize = 1024;
+            std::vector<std::unique_ptr<CheckResult>> result;
+            result.reserve(valuations.size());
+            for (uint64_t chunkBegin = 0; chunkBegin < valuations.size(); chunkBegin += chunkSize) {
+                uint64_t chunkEnd = std::min<uint64_t>(chunkBegin + chunkSize, valuations.size());
+                modelInstantiator.evaluateBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>>(valuations.begin() + chunkBegin, valuations.begin() + chunkEnd));
+                for (uint64_t index = 0; index < modelInstantiator.getBatchSize(); ++index) {
+                    result.push_back(checkInstantiatedModel(env, modelInstantiator.instantiateFromBatch(index)));
+                }
+            }
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel) {
             STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
             storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <boost/optional.hpp>
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
@@ -22,8 +23,18 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+            /*!
+             * Checks the specified formula for each of the given valuations (e.g., the points of a grid in a parameter sweep).
+             * The occurring functions are evaluated for many valuations at once (see ModelInstantiator::evaluateBatch).
+             * As for check, the result for one valuation is used as a hint for the next one. Hence, similar valuations should be consecutive.
+             * @return the results in the order of the valuations.
+             */
+            std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
         protected:
             
+            std::unique_ptr<CheckResult> checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel);
+            
             // Optimizations for the different formula types
             std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
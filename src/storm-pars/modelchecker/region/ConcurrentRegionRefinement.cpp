@@ -0,0 +1,150 @@
+#include "storm-pars/modelchecker/region/ConcurrentRegionRefinement.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template<typename ParametricType>
+        ConcurrentRegionRefinement<ParametricType>::ConcurrentRegionRefinement(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& regionCheckers) : regionCheckers(regionCheckers) {
+            STORM_LOG_THROW(!this->regionCheckers.empty(), storm::exceptions::InvalidArgumentException, "Concurrent region refinement needs at least one region model checker.");
+            for (auto const& regionChecker : this->regionCheckers) {
+                STORM_LOG_THROW(!regionChecker->isUseMonotonicitySet(), storm::exceptions::NotSupportedException, "Concurrent region refinement does not support monotonicity.");
+            }
+        }
+
+        template<typename ParametricType>
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> ConcurrentRegionRefinement<ParametricType>::performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+            STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " using " << regionCheckers.size() << " threads.");
+
+            auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+            auto areaOfParameterSpace = region.area();
+            auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+
+            struct UnprocessedRegion {
+                storm::storage::ParameterRegion<ParametricType> region;
+                RegionResult result;
+                uint64_t depth;
+                CoefficientType area;
+                uint64_t index; // Regions with the same area are processed in the order in which they were created
+            };
+            // Regions with a larger area are considered first.
+            auto hasLowerPriority = [](UnprocessedRegion const& lhs, UnprocessedRegion const& rhs) {
+                return lhs.area < rhs.area || (lhs.area == rhs.area && lhs.index > rhs.index);
+            };
+            std::priority_queue<UnprocessedRegion, std::vector<UnprocessedRegion>, decltype(hasLowerPriority)> unprocessedRegions(hasLowerPriority);
+            uint64_t numberOfCreatedRegions = 0;
+            unprocessedRegions.push({region, RegionResult::Unknown, 0, areaOfParameterSpace, numberOfCreatedRegions++});
+
+            // The resulting (sub-)regions
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+
+            // State shared between the threads. All of it is protected by the mutex.
+            std::mutex mutex;
+            std::condition_variable condition;
+            uint64_t numberOfBusyThreads = 0;
+            uint64_t numOfAnalyzedRegions = 0;
+            bool done = fractionOfUndiscoveredArea <= thresholdAsCoefficient;
+            std::exception_ptr exception;
+
+            auto work = [&](RegionModelChecker<ParametricType>& regionChecker) {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (true) {
+                    // Wait until there is a region to analyze or until all threads are idle (i.e., no new regions will arrive).
+                    condition.wait(lock, [&]() { return done || !unprocessedRegions.empty() || numberOfBusyThreads == 0; });
+                    if (done || unprocessedRegions.empty()) {
+                        break;
+                    }
+                    UnprocessedRegion current = unprocessedRegions.top();
+                    unprocessedRegions.pop();
+                    ++numberOfBusyThreads;
+                    lock.unlock();
+
+                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                    try {
+                        STORM_LOG_INFO("Analyzing region with refinement depth " << current.depth << ".");
+                        current.result = regionChecker.sampleAndAnalyzeRegion(env, current.region, hypothesis, current.result);
+                        bool isConclusive = current.result == RegionResult::AllSat || current.result == RegionResult::AllViolated;
+                        if (!isConclusive && (!depthThreshold || current.depth < depthThreshold.get())) {
+                            current.region.split(current.region.getCenterPoint(), newRegions);
+                        }
+                    } catch (...) {
+                        lock.lock();
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                        --numberOfBusyThreads;
+                        done = true;
+                        condition.notify_all();
+                        break;
+                    }
+
+                    lock.lock();
+                    --numberOfBusyThreads;
+                    ++numOfAnalyzedRegions;
+                    if (newRegions.empty()) {
+                        // Either the result is conclusive or the region is not further refined. Either way, it is added to the result.
+                        if (current.result == RegionResult::AllSat || current.result == RegionResult::AllViolated) {
+                            fractionOfUndiscoveredArea -= current.area / areaOfParameterSpace;
+                        }
+                        result.emplace_back(std::move(current.region), current.result);
+                    } else {
+                        RegionResult initResForNewRegions = (current.result == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                            ((current.result == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                             RegionResult::Unknown);
+                        for (auto& newRegion : newRegions) {
+                            CoefficientType newArea = newRegion.area();
+                            unprocessedRegions.push({std::move(newRegion), initResForNewRegions, current.depth + 1, std::move(newArea), numberOfCreatedRegions++});
+                        }
+                    }
+                    if (fractionOfUndiscoveredArea <= thresholdAsCoefficient) {
+                        done = true;
+                    }
+                    condition.notify_all();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (auto const& regionChecker : regionCheckers) {
+                threads.emplace_back(work, std::ref(*regionChecker));
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+
+            // Add the still unprocessed regions to the result
+            while (!unprocessedRegions.empty()) {
+                result.emplace_back(unprocessedRegions.top().region, unprocessedRegions.top().result);
+                unprocessedRegions.pop();
+            }
+
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+                STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions using " << regionCheckers.size() << " threads.\n");
+            }
+
+            auto regionCopyForResult = region;
+            return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+        }
+
+#ifdef STORM_HAVE_CARL
+        template class ConcurrentRegionRefinement<storm::RationalFunction>;
+#endif
+    } //namespace modelchecker
+} //namespace storm
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm-pars/modelchecker/region/RegionModelChecker.h"
+#include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+
+        /*!
+         * Performs region refinement (as RegionModelChecker::performRegionRefinement) with several threads.
+         * Each thread owns one of the given region model checkers (and thus its own parameter lifter and solver). The threads take the unknown
+         * subregions from a shared queue in which regions with a larger area (i.e., a smaller refinement depth) are considered first.
+         *
+         * Since the regions are analyzed concurrently, a few more regions than in a sequential refinement might be analyzed before the coverage threshold is reached.
+         * The order of the regions in the result depends on the scheduling of the threads.
+         */
+        template<typename ParametricType>
+        class ConcurrentRegionRefinement {
+        public:
+            typedef typename storm::storage::ParameterRegion<ParametricType>::CoefficientType CoefficientType;
+
+            /*!
+             * @param regionCheckers the (already specified) region model checkers, one for each thread. Monotonicity is not supported.
+             */
+            ConcurrentRegionRefinement(std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& regionCheckers);
+
+            /*!
+             * Iteratively refines the region until the region analysis yields a conclusive result (AllSat or AllViolated).
+             * The parameters have the same meaning as for RegionModelChecker::performRegionRefinement.
+             */
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+
+        private:
+            std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> regionCheckers;
+        };
+
+    } //namespace modelchecker
+} //namespace storm
@@ -41,6 +41,30 @@ namespace storm {
                 return std::make_unique<storm::modelchecker::RegionCheckResult<ParametricType>>(std::move(result));
             }
 
+            template <typename ParametricType>
+            RegionResult RegionModelChecker<ParametricType>::sampleRegion(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResult const& initialResult) {
+                return initialResult;
+            }
+
+            template <typename ParametricType>
+            RegionResult RegionModelChecker<ParametricType>::sampleAndAnalyzeRegion(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis, RegionResult const& initialResult, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult) {
+                RegionResult result = initialResult;
+                if (numberOfSamples > 0 && result != RegionResult::AllSat && result != RegionResult::AllViolated) {
+                    result = sampleRegion(env, region, result);
+                    bool existsSat = result == RegionResult::ExistsSat || result == RegionResult::CenterSat || result == RegionResult::ExistsBoth;
+                    bool existsViolated = result == RegionResult::ExistsViolated || result == RegionResult::CenterViolated || result == RegionResult::ExistsBoth;
+                    // A region can only be AllSat (AllViolated) if no violating (satisfying) point has been found
+                    bool allSatPossible = !existsViolated && hypothesis != RegionResultHypothesis::AllViolated;
+                    bool allViolatedPossible = !existsSat && hypothesis != RegionResultHypothesis::AllSat;
+                    if (!allSatPossible && !allViolatedPossible) {
+                        STORM_LOG_INFO("Region " << region << " is " << result << ", discovered by sampling.");
+                        ++numberOfRegionsKnownThroughSampling;
+                        return result;
+                    }
+                }
+                return analyzeRegion(env, region, hypothesis, result, false, localMonotonicityResult);
+            }
+
             template <typename ParametricType>
             ParametricType RegionModelChecker<ParametricType>::getBoundAtInitState(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
                 STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "The selected region model checker does not support this functionality.");
@@ -57,6 +81,7 @@ namespace storm {
                 auto fractionOfAllSatArea = storm::utility::zero<CoefficientType>();
                 auto fractionOfAllViolatedArea = storm::utility::zero<CoefficientType>();
                 numberOfRegionsKnownThroughMonotonicity = 0;
+                numberOfRegionsKnownThroughSampling = 0;
                 
                 // The resulting (sub-)regions
                 std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
@@ -93,7 +118,7 @@ namespace storm {
                     auto& res = unprocessedRegions.front().second;
                     std::shared_ptr<storm::analysis::Order> order;
                     std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+                    res = sampleAndAnalyzeRegion(env, currentRegion, hypothesis, res);
 
                     switch (res) {
                         case RegionResult::AllSat:
@@ -203,7 +228,7 @@ namespace storm {
                         }
                     }
 
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false, localMonotonicityResult);
+                    res = sampleAndAnalyzeRegion(env, currentRegion, hypothesis, res, localMonotonicityResult);
 
                     switch (res) {
                         case RegionResult::AllSat:
@@ -318,6 +343,9 @@ namespace storm {
                         STORM_PRINT_AND_LOG("    " << numberOfRegionsKnownThroughMonotonicity << " regions where discovered with help of monotonicity.\n");
 
                     }
+                    if (numberOfSamples > 0) {
+                        STORM_PRINT_AND_LOG("    " << numberOfRegionsKnownThroughSampling << " regions were classified by sampling.\n");
+                    }
                 }
                 
                 auto regionCopyForResult = region;
@@ -411,6 +439,23 @@ namespace storm {
             currentRegion.split(currentRegion.getCenterPoint(), regionVector);
         }
 
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setSampling(uint64_t numberOfSamples, uint64_t numberOfThreads) {
+            STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "The number of sampling threads must be positive.");
+            this->numberOfSamples = numberOfSamples;
+            this->numberOfSamplingThreads = numberOfThreads;
+        }
+
+        template <typename ParametricType>
+        uint64_t RegionModelChecker<ParametricType>::getNumberOfSamples() const {
+            return numberOfSamples;
+        }
+
+        template <typename ParametricType>
+        uint64_t RegionModelChecker<ParametricType>::getNumberOfSamplingThreads() const {
+            return numberOfSamplingThreads;
+        }
+
         template<typename ParametricType>
         void RegionModelChecker<ParametricType>::setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneParameters) {
             monotoneIncrParameters = std::move(monotoneParameters.first);
@@ -42,6 +42,19 @@ namespace storm {
              */
             virtual RegionResult analyzeRegion(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, RegionResult const& initialResult = RegionResult::Unknown, bool sampleVerticesOfRegion = false, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult = nullptr) = 0;
             
+            /*!
+             * Samples points within the given region (see setSampling) and refines the given result accordingly, i.e., the result states
+             * whether satisfying and/or violating points are known to exist.
+             * Region model checkers that do not support sampling return the initial result.
+             */
+            virtual RegionResult sampleRegion(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResult const& initialResult = RegionResult::Unknown);
+
+            /*!
+             * Analyzes the given region as analyzeRegion does. If sampling is enabled (see setSampling), points within the region are sampled first.
+             * The (expensive) analysis is skipped if the samples show that the region can not be AllSat or AllViolated (with respect to the hypothesis).
+             */
+            RegionResult sampleAndAnalyzeRegion(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, RegionResult const& initialResult = RegionResult::Unknown, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult = nullptr);
+
              /*!
              * Analyzes the given regions.
              * @param hypothesis if not 'unknown', we only try to show the hypothesis for each region
@@ -94,16 +107,28 @@ namespace storm {
             void setUseBounds(bool bounds = true);
             void setUseOnlyGlobal(bool global = true);
 
+            /*!
+             * Enables sampling of regions before they are analyzed during region refinement (see sampleAndAnalyzeRegion).
+             * @param numberOfSamples the number of points that are sampled (uniformly at random) within each region. Zero disables sampling.
+             * @param numberOfThreads the number of threads that check the sampled points concurrently.
+             */
+            void setSampling(uint64_t numberOfSamples, uint64_t numberOfThreads = 1);
+            uint64_t getNumberOfSamples() const;
+            uint64_t getNumberOfSamplingThreads() const;
+
             void setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneParameters);
 
         private:
             bool useMonotonicity = false;
             bool useOnlyGlobal = false;
             bool useBounds = false;
+            uint64_t numberOfSamples = 0;
+            uint64_t numberOfSamplingThreads = 1;
 
         protected:
 
             uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
+            uint_fast64_t numberOfRegionsKnownThroughSampling = 0;
             boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneIncrParameters;
             boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneDecrParameters;
 
@@ -264,6 +264,14 @@ namespace storm {
             return *instantiationChecker;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::createInstantiationChecker() const {
+            auto result = std::make_unique<storm::modelchecker::SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
+            result->specifyFormula(this->currentCheckTask->template convertValueType<ValueType>());
+            result->setInstantiationsAreGraphPreserving(true);
+            return result;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult) {
 
@@ -271,6 +279,8 @@ namespace storm {
                 return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(resultsForNonMaybeStates);
             }
             parameterLifter->specifyRegion(region, dirForParameters);
+            // Regions are usually refined one after another, so the most recent result for the same direction is a good starting point.
+            std::vector<ConstantType>& x = storm::solver::minimize(dirForParameters) ? minX : maxX;
 
             if (stepBound) {
                 assert(*stepBound > 0);
@@ -487,7 +497,8 @@ namespace storm {
             parameterLifter = nullptr;
             minSchedChoices = boost::none;
             maxSchedChoices = boost::none;
-            x.clear();
+            minX.clear();
+            maxX.clear();
             lowerResultBound = boost::none;
             upperResultBound = boost::none;
             regionSplitEstimationsEnabled = false;
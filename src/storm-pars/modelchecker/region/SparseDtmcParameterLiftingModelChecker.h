@@ -51,6 +51,7 @@ namespace storm {
             virtual void specifyCumulativeRewardFormula(const CheckTask <storm::logic::CumulativeRewardFormula, ConstantType> &checkTask) override;
 
             virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationChecker() override;
+            virtual std::unique_ptr<storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>> createInstantiationChecker() const override;
             virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationCheckerSAT() override;
             virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationCheckerVIO() override;
 
@@ -78,9 +79,9 @@ namespace storm {
             std::unique_ptr<storm::solver::MinMaxLinearEquationSolverFactory<ConstantType>> solverFactory;
             bool solvingRequiresUpperRewardBounds;
             
-            // Results from the most recent solver call.
+            // Results from the most recent solver call (for each direction). These are used as the starting point for the next region.
             boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
-            std::vector<ConstantType> x;
+            std::vector<ConstantType> minX, maxX;
             boost::optional<ConstantType> lowerResultBound, upperResultBound;
             
             bool regionSplitEstimationsEnabled;
@@ -241,6 +241,14 @@ namespace storm {
             return *instantiationChecker;
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>> SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::createInstantiationChecker() const {
+            auto result = std::make_unique<storm::modelchecker::SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
+            result->specifyFormula(this->currentCheckTask->template convertValueType<typename SparseModelType::ValueType>());
+            result->setInstantiationsAreGraphPreserving(true);
+            return result;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult) {
             
@@ -256,9 +264,15 @@ namespace storm {
             if (upperResultBound) solver->setUpperBound(upperResultBound.get());
             if (applyPreviousResultAsHint) {
                 solver->setTrackSchedulers(true);
-                x.resize(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
-                if(storm::solver::minimize(dirForParameters) && minSchedChoices && player1SchedChoices) solver->setSchedulerHints(std::move(player1SchedChoices.get()), std::move(minSchedChoices.get()));
-                if(storm::solver::maximize(dirForParameters) && maxSchedChoices && player1SchedChoices) solver->setSchedulerHints(std::move(player1SchedChoices.get()), std::move(maxSchedChoices.get()));
+                // Prefer the results of a region containing the current one (e.g., its parent region) over the results of the most recent call
+                if (RegionHint const* hint = findRegionHint(region, dirForParameters)) {
+                    x = hint->x;
+                    solver->setSchedulerHints(std::vector<uint_fast64_t>(hint->player1SchedChoices), std::vector<uint_fast64_t>(hint->player2SchedChoices));
+                } else {
+                    x.resize(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
+                    if(storm::solver::minimize(dirForParameters) && minSchedChoices && player1SchedChoices) solver->setSchedulerHints(std::move(player1SchedChoices.get()), std::move(minSchedChoices.get()));
+                    if(storm::solver::maximize(dirForParameters) && maxSchedChoices && player1SchedChoices) solver->setSchedulerHints(std::move(player1SchedChoices.get()), std::move(maxSchedChoices.get()));
+                }
             } else {
                 x.assign(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
             }
@@ -289,6 +303,12 @@ namespace storm {
                         maxSchedChoices = solver->getPlayer2SchedulerChoices();
                     }
                     player1SchedChoices = solver->getPlayer1SchedulerChoices();
+                    if (maximalNumberOfStoredRegionHints > 0) {
+                        if (regionHints.size() >= maximalNumberOfStoredRegionHints) {
+                            regionHints.pop_front();
+                        }
+                        regionHints.push_back({region, dirForParameters, player1SchedChoices.get(), solver->getPlayer2SchedulerChoices(), x});
+                    }
                 }
             }
             
@@ -303,6 +323,35 @@ namespace storm {
             return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(result));
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        typename SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::RegionHint const* SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::findRegionHint(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) const {
+            RegionHint const* result = nullptr;
+            for (auto const& hint : regionHints) {
+                if (hint.dirForParameters != dirForParameters || (result != nullptr && result->region.area() <= hint.region.area())) {
+                    continue;
+                }
+                bool containsRegion = true;
+                for (auto const& variable : region.getVariables()) {
+                    if (hint.region.getLowerBoundary(variable) > region.getLowerBoundary(variable) || hint.region.getUpperBoundary(variable) < region.getUpperBoundary(variable)) {
+                        containsRegion = false;
+                        break;
+                    }
+                }
+                if (containsRegion) {
+                    result = &hint;
+                }
+            }
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::setMaximalNumberOfStoredRegionHints(uint64_t value) {
+            maximalNumberOfStoredRegionHints = value;
+            while (regionHints.size() > maximalNumberOfStoredRegionHints) {
+                regionHints.pop_front();
+            }
+        }
+
         template <typename SparseModelType, typename ConstantType>
         void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::computePlayer1Matrix(boost::optional<storm::storage::BitVector> const& selectedRows) {
             uint_fast64_t n = 0;
@@ -348,6 +397,7 @@ namespace storm {
             lowerResultBound = boost::none;
             upperResultBound = boost::none;
             applyPreviousResultAsHint = false;
+            regionHints.clear();
         }
         
         template <typename SparseModelType, typename ConstantType>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <vector>
 #include <memory>
 #include <boost/optional.hpp>
@@ -34,6 +35,13 @@ namespace storm {
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMinScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
             boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentPlayer1Scheduler();
+
+            /*!
+             * Sets the maximal number of analyzed regions whose results (values and scheduler choices) are stored. When a region is analyzed,
+             * the stored results of the smallest region that contains it (e.g., its parent region during refinement) are used as initial guess.
+             * Zero disables storing results, i.e., only the results of the most recent region are used.
+             */
+            void setMaximalNumberOfStoredRegionHints(uint64_t value);
                 
         protected:
                 
@@ -43,6 +51,7 @@ namespace storm {
             virtual void specifyCumulativeRewardFormula(const CheckTask <storm::logic::CumulativeRewardFormula, ConstantType> &checkTask) override;
                 
             virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationChecker() override;
+            virtual std::unique_ptr<storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>> createInstantiationChecker() const override;
 
             virtual std::unique_ptr<CheckResult> computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult = nullptr) override;
                 
@@ -50,8 +59,20 @@ namespace storm {
                 
 
         private:
+            // The results of the solver call for a region.
+            struct RegionHint {
+                storm::storage::ParameterRegion<typename SparseModelType::ValueType> region;
+                storm::solver::OptimizationDirection dirForParameters;
+                std::vector<uint_fast64_t> player1SchedChoices;
+                std::vector<uint_fast64_t> player2SchedChoices;
+                std::vector<ConstantType> x;
+            };
+
             void computePlayer1Matrix(boost::optional<storm::storage::BitVector> const& selectedRows = boost::none);
             
+            // Retrieves the hint of the smallest stored region that contains the given region (and was checked w.r.t. the given direction), if any.
+            RegionHint const* findRegionHint(storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters) const;
+            
             storm::storage::BitVector maybeStates;
             std::vector<ConstantType> resultsForNonMaybeStates;
             boost::optional<uint_fast64_t> stepBound;
@@ -68,6 +89,8 @@ namespace storm {
             std::vector<ConstantType> x;
             boost::optional<ConstantType> lowerResultBound, upperResultBound;
             bool applyPreviousResultAsHint;
+            std::deque<RegionHint> regionHints;
+            uint64_t maximalNumberOfStoredRegionHints = 64;
         };
     }
 }
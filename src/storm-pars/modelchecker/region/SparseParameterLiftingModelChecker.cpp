@@ -1,6 +1,9 @@
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 
+#include <atomic>
+#include <exception>
 #include <queue>
+#include <thread>
 #include <boost/container/flat_set.hpp>
 #include <storm-pars/analysis/MonotonicityChecker.h>
 
@@ -28,6 +31,7 @@ namespace storm {
         void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyFormula(Environment const& env, storm::modelchecker::CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) {
 
             currentFormula = checkTask.getFormula().asSharedPointer();
+            samplingCheckers.clear();
             currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
             
             if (currentCheckTask->getFormula().isProbabilityOperatorFormula()) {
@@ -186,6 +190,88 @@ namespace storm {
             return result;
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::sampleRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResult const& initialResult) {
+            typedef typename storm::storage::ParameterRegion<typename SparseModelType::ValueType>::CoefficientType CoefficientType;
+            RegionResult result = initialResult;
+            if (result == RegionResult::AllSat || result == RegionResult::AllViolated || this->getNumberOfSamples() == 0) {
+                return result;
+            }
+
+            bool hasSatPoint = result == RegionResult::ExistsSat || result == RegionResult::CenterSat || result == RegionResult::ExistsBoth;
+            bool hasViolatedPoint = result == RegionResult::ExistsViolated || result == RegionResult::CenterViolated || result == RegionResult::ExistsBoth;
+            if (hasSatPoint && hasViolatedPoint) {
+                return RegionResult::ExistsBoth;
+            }
+
+            // The points are drawn upfront such that they do not depend on the number of threads
+            std::uniform_real_distribution<double> distribution(0.0, 1.0);
+            std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> samples(this->getNumberOfSamples());
+            for (auto& sample : samples) {
+                for (auto const& variable : region.getVariables()) {
+                    CoefficientType lowerBoundary = region.getLowerBoundary(variable);
+                    sample.emplace(variable, lowerBoundary + storm::utility::convertNumber<CoefficientType>(distribution(samplingEngine)) * (region.getUpperBoundary(variable) - lowerBoundary));
+                }
+            }
+
+            // Each thread uses its own instantiation checker.
+            uint64_t numberOfThreads = std::min<uint64_t>(this->getNumberOfSamplingThreads(), samples.size());
+            while (samplingCheckers.size() + 1 < numberOfThreads) {
+                samplingCheckers.push_back(createInstantiationChecker());
+            }
+            std::vector<storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>*> checkers = {&getInstantiationChecker()};
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                checkers.push_back(samplingCheckers[thread - 1].get());
+            }
+
+            uint64_t initialState = *this->parametricModel->getInitialStates().begin();
+            std::atomic<bool> foundSatPoint(hasSatPoint);
+            std::atomic<bool> foundViolatedPoint(hasViolatedPoint);
+            auto checkSamples = [&](uint64_t thread) {
+                for (uint64_t sampleIndex = thread; sampleIndex < samples.size() && !(foundSatPoint && foundViolatedPoint); sampleIndex += numberOfThreads) {
+                    if (checkers[thread]->check(env, samples[sampleIndex])->asExplicitQualitativeCheckResult()[initialState]) {
+                        foundSatPoint = true;
+                    } else {
+                        foundViolatedPoint = true;
+                    }
+                }
+            };
+            if (numberOfThreads == 1) {
+                checkSamples(0);
+            } else {
+                std::vector<std::thread> threads;
+                std::vector<std::exception_ptr> exceptions(numberOfThreads);
+                for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                    threads.emplace_back([&, thread]() {
+                        try {
+                            checkSamples(thread);
+                        } catch (...) {
+                            exceptions[thread] = std::current_exception();
+                        }
+                    });
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                for (auto const& exception : exceptions) {
+                    if (exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+            }
+
+            if (foundSatPoint) {
+                if (foundViolatedPoint) {
+                    result = RegionResult::ExistsBoth;
+                } else if (result != RegionResult::CenterSat) {
+                    result = RegionResult::ExistsSat;
+                }
+            } else if (foundViolatedPoint && result != RegionResult::CenterViolated) {
+                result = RegionResult::ExistsViolated;
+            }
+            return result;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult) {
             auto quantitativeResult = computeQuantitativeValues(env, region, dirForParameters, localMonotonicityResult);
@@ -482,6 +568,11 @@ namespace storm {
             return *currentCheckTask;
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        ConstantType const& SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getLastValue() const {
+            return lastValue;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyBoundedUntilFormula(const CheckTask <logic::BoundedUntilFormula, ConstantType> &checkTask) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parameter lifting is not supported for the given property.");
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <random>
+
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
 #include "storm-pars/storage/ParameterRegion.h"
@@ -38,6 +40,12 @@ namespace storm {
              * Analyzes the 2^#parameters corner points of the given region.
              */
             RegionResult sampleVertices(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResult const& initialResult = RegionResult::Unknown);
+
+            /*!
+             * Checks the given number of points (see setSampling) that are sampled uniformly at random within the given region.
+             * The points are checked concurrently with one instantiation model checker per thread. The sampling stops as soon as both, a satisfying and a violating point are known.
+             */
+            virtual RegionResult sampleRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResult const& initialResult = RegionResult::Unknown) override;
             
             /*!
              * Checks the specified formula on the given region by applying parameter lifting (Parameter choices are lifted to nondeterministic choices)
@@ -62,6 +70,11 @@ namespace storm {
 
             SparseModelType const& getConsideredParametricModel() const;
             CheckTask<storm::logic::Formula, ConstantType> const& getCurrentCheckTask() const;
+
+            /*!
+             * Retrieves the value at the initial state that was computed by the most recent call of check.
+             */
+            ConstantType const& getLastValue() const;
             
         protected:
             void specifyFormula(Environment const& env, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
@@ -79,6 +92,8 @@ namespace storm {
             virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationChecker() = 0;
             virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationCheckerSAT();
             virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationCheckerVIO();
+            // Creates a new instantiation model checker for the current property (e.g., to check instantiations concurrently).
+            virtual std::unique_ptr<storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>> createInstantiationChecker() const = 0;
 
             virtual std::unique_ptr<CheckResult> computeQuantitativeValues(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult = nullptr) = 0;
 
@@ -95,6 +110,9 @@ namespace storm {
         private:
             // store the current formula. Note that currentCheckTask only stores a reference to the formula.
             std::shared_ptr<storm::logic::Formula const> currentFormula;
+            // The additional instantiation model checkers used for sampling with multiple threads and the generator for the sampled points.
+            std::vector<std::unique_ptr<storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>>> samplingCheckers;
+            std::mt19937 samplingEngine;
             std::shared_ptr<storm::analysis::Order> copyOrder(std::shared_ptr<storm::analysis::Order> order);
             std::map<std::shared_ptr<storm::analysis::Order>, uint_fast64_t> numberOfCopiesOrder;
             std::map<std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>>, uint_fast64_t> numberOfCopiesMonRes;
@@ -27,7 +27,7 @@ namespace storm {
 
             auto simplifiedTask = checkTask.substituteFormula(*simplifier.getSimplifiedFormula());
 
-            impreciseChecker.specify(env, simplifier.getSimplifiedModel(), simplifiedTask, false, true);
+            impreciseChecker.specify(this->getImpreciseEnvironment(env), simplifier.getSimplifiedModel(), simplifiedTask, false, true);
             preciseChecker.specify(env, simplifier.getSimplifiedModel(), simplifiedTask, false, true);
         }
         
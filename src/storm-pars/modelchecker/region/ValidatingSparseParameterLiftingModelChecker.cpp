@@ -1,17 +1,22 @@
 #include "storm-pars/modelchecker/region/ValidatingSparseParameterLiftingModelChecker.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     namespace modelchecker {
        
         template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
-        ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::ValidatingSparseParameterLiftingModelChecker() : numOfWrongRegions(0) {
+        ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::ValidatingSparseParameterLiftingModelChecker() : numOfWrongRegions(0), numOfSkippedValidations(0), selectiveValidation(false), validationMargin(storm::utility::convertNumber<ImpreciseType>(1e-3)) {
             // Intentionally left empty
         }
         
@@ -19,6 +24,9 @@ namespace storm {
         ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::~ValidatingSparseParameterLiftingModelChecker() {
             if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
                 STORM_PRINT_AND_LOG("Validating Parameter Lifting Model Checker detected " << numOfWrongRegions << " regions where the imprecise method was wrong.\n");
+                if (selectiveValidation) {
+                    STORM_PRINT_AND_LOG("Validating Parameter Lifting Model Checker skipped the exact validation of " << numOfSkippedValidations << " regions whose result was not close to the threshold.\n");
+                }
             }
         }
         
@@ -31,9 +39,19 @@ namespace storm {
         RegionResult ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::analyzeRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResultHypothesis const& hypothesis, RegionResult const& initialResult, bool sampleVerticesOfRegion, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult) {
 
 
-            RegionResult currentResult = getImpreciseChecker().analyzeRegion(env, region, hypothesis, initialResult, false);
-            
-            if (currentResult == RegionResult::AllSat || currentResult == RegionResult::AllViolated) {
+            RegionResult currentResult = getImpreciseChecker().analyzeRegion(getImpreciseEnvironment(env), region, hypothesis, initialResult, false);
+
+            bool validate = currentResult == RegionResult::AllSat || currentResult == RegionResult::AllViolated;
+            if (validate && selectiveValidation) {
+                // The (sound) imprecise bound only needs to be validated if it is close to the threshold.
+                ImpreciseType threshold = getImpreciseChecker().getCurrentCheckTask().getFormula().asOperatorFormula().template getThresholdAs<ImpreciseType>();
+                if (storm::utility::abs<ImpreciseType>(getImpreciseChecker().getLastValue() - threshold) > validationMargin) {
+                    validate = false;
+                    ++numOfSkippedValidations;
+                }
+            }
+
+            if (validate) {
                 applyHintsToPreciseChecker();
                 
                 storm::solver::OptimizationDirection parameterOptDir = getPreciseChecker().getCurrentCheckTask().getOptimizationDirection();
@@ -69,6 +87,36 @@ namespace storm {
             return currentResult;
         }
 
+        template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
+        void ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::setSelectiveValidation(bool value, ImpreciseType const& margin) {
+            STORM_LOG_THROW(margin >= storm::utility::zero<ImpreciseType>(), storm::exceptions::InvalidArgumentException, "The margin for selective validation must not be negative.");
+            selectiveValidation = value;
+            validationMargin = margin;
+        }
+
+        template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
+        bool ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::isSelectiveValidationSet() const {
+            return selectiveValidation;
+        }
+
+        template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
+        Environment ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::getImpreciseEnvironment(Environment const& env) const {
+            Environment result = env;
+            if (selectiveValidation) {
+                // Results that are not validated exactly have to be obtained with sound methods.
+                result.solver().setForceSoundness(true);
+                auto minMaxMethod = result.solver().minMax().getMethod();
+                if (minMaxMethod != storm::solver::MinMaxMethod::SoundValueIteration && minMaxMethod != storm::solver::MinMaxMethod::IntervalIteration && minMaxMethod != storm::solver::MinMaxMethod::PolicyIteration && minMaxMethod != storm::solver::MinMaxMethod::OptimisticValueIteration) {
+                    STORM_LOG_INFO("Using sound value iteration for the imprecise checks of the selective validation.");
+                    result.solver().minMax().setMethod(storm::solver::MinMaxMethod::SoundValueIteration);
+                }
+                if (result.solver().game().getMethod() != storm::solver::GameMethod::PolicyIteration) {
+                    result.solver().game().setMethod(storm::solver::GameMethod::PolicyIteration);
+                }
+            }
+            return result;
+        }
+
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double, storm::RationalNumber>;
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double, storm::RationalNumber>;
 
@@ -3,7 +3,9 @@
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm/environment/Environment.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/constants.h"
 
 namespace storm {
     namespace modelchecker {
@@ -25,6 +27,15 @@ namespace storm {
              */
             virtual RegionResult analyzeRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, RegionResult const& initialResult = RegionResult::Unknown, bool sampleVerticesOfRegion = false, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult = nullptr) override;
 
+            /*!
+             * Enables (or disables) selective validation. If enabled, the imprecise results are computed with sound solution methods and
+             * only those results whose value at the initial state is closer than the given margin to the threshold are validated exactly.
+             * To obtain sound results, the margin should exceed the precision of the (imprecise) sound solution method.
+             * This has to be set before the checker is specified.
+             */
+            void setSelectiveValidation(bool value, ImpreciseType const& margin = storm::utility::convertNumber<ImpreciseType>(1e-3));
+            bool isSelectiveValidationSet() const;
+
         protected:
             
             virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType>& getImpreciseChecker() = 0;
@@ -34,10 +45,17 @@ namespace storm {
             
             virtual void applyHintsToPreciseChecker() = 0;
 
+            // Retrieves the environment for the imprecise checker, i.e., the given environment with forced soundness in case of selective validation.
+            Environment getImpreciseEnvironment(Environment const& env) const;
+
         private:
             
             // Information for statistics
             uint_fast64_t numOfWrongRegions;
+            uint_fast64_t numOfSkippedValidations;
+
+            bool selectiveValidation;
+            ImpreciseType validationMargin;
             
         };
     }
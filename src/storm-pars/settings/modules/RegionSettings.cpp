@@ -22,6 +22,8 @@ namespace storm {
             const std::string RegionSettings::hypothesisOptionName = "hypothesis";
             const std::string RegionSettings::hypothesisShortOptionName = "hyp";
             const std::string RegionSettings::refineOptionName = "refine";
+            const std::string RegionSettings::refinementThreadsOptionName = "refine-threads";
+            const std::string RegionSettings::samplingOptionName = "sampling";
             const std::string RegionSettings::extremumOptionName = "extremum";
             const std::string RegionSettings::extremumSuggestionOptionName = "extremum-init";
             const std::string RegionSettings::splittingThresholdName = "splitting-threshold";
@@ -44,6 +46,13 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("coverage-threshold", "Refinement converges if the fraction of unknown area falls below this threshold.").setDefaultValueDouble(0.05).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0,1.0)).build())
                                 .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument("depth-limit", "If given, limits the number of times a region is refined.").setDefaultValueInteger(-1).makeOptional().build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementThreadsOptionName, false, "Sets the number of threads that concurrently analyze regions during refinement (not supported with monotonicity).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, samplingOptionName, false, "If set, points are sampled within each region during refinement. Regions with both satisfying and violating points are not analyzed further.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("samples", "The number of sampled points per region.").setDefaultValueUnsignedInteger(16).makeOptional().addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build())
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads that check the sampled points.").setDefaultValueUnsignedInteger(1).makeOptional().addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
                 std::vector<std::string> directions = {"min", "max"};
                 std::vector<std::string> precisiontype = {"rel", "abs"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, extremumOptionName, false, "Computes the extremum within the region.")
@@ -122,6 +131,22 @@ namespace storm {
                 return (uint64_t) depth;
             }
             
+            uint64_t RegionSettings::getRefinementThreads() const {
+                return this->getOption(refinementThreadsOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+            }
+            
+            bool RegionSettings::isSamplingSet() const {
+                return this->getOption(samplingOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t RegionSettings::getNumberOfSamples() const {
+                return this->getOption(samplingOptionName).getArgumentByName("samples").getValueAsUnsignedInteger();
+            }
+            
+            uint64_t RegionSettings::getSamplingThreads() const {
+                return this->getOption(samplingOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+            }
+            
             bool RegionSettings::isExtremumSet() const {
                 return this->getOption(extremumOptionName).getHasOptionBeenSet();
             }
@@ -71,6 +71,26 @@ namespace storm {
                  */
                 uint64_t getDepthLimit() const;
                 
+                /*!
+                 * Retrieves the number of threads that analyze regions concurrently during region refinement.
+                 */
+                uint64_t getRefinementThreads() const;
+                
+                /*!
+                 * Retrieves whether regions are sampled before they are analyzed during region refinement.
+                 */
+                bool isSamplingSet() const;
+                
+                /*!
+                 * Retrieves the number of points that are sampled within each region.
+                 */
+                uint64_t getNumberOfSamples() const;
+                
+                /*!
+                 * Retrieves the number of threads that check the sampled points concurrently.
+                 */
+                uint64_t getSamplingThreads() const;
+                
                 /*!
 				 * Retrieves whether an extremal value is to be computed
 				 */
@@ -122,6 +142,8 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string refinementThreadsOptionName;
+				const static std::string samplingOptionName;
 				const static std::string splittingThresholdName;
 				const static std::string extremumOptionName;
 				const static std::string extremumSuggestionOptionName;
@@ -1,5 +1,7 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/vector.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -155,7 +157,10 @@ namespace storm {
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
             // write the evaluation result of each function,evaluation pair into the placeholders
-            functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters);
+            if (!functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters)) {
+                // The matrix and the vector are still up to date
+                return;
+            }
 
             //apply the matrix and vector assignments to write the contents of the placeholder into the matrix/vector
             for (auto &assignment : matrixAssignment) {
@@ -326,20 +331,56 @@ namespace storm {
             // insert the function and the valuation
             //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
             auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+            if (insertionRes.second) {
+                ParametricType const& insertedFunction = insertionRes.first->first.first;
+                auto compiledFunctionIt = compiledFunctions.find(insertedFunction);
+                if (compiledFunctionIt == compiledFunctions.end()) {
+                    compiledFunctionIt = compiledFunctions.emplace(insertedFunction, storm::utility::CompiledRationalFunction<ConstantType>(insertedFunction)).first;
+                }
+                evaluations.push_back({&compiledFunctionIt->second, &insertionRes.first->first.second, &insertionRes.first->second});
+            }
             return insertionRes.first->second;
         }
     
         template<typename ParametricType, typename ConstantType>
-        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
-            for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
-                ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
-                AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-                ConstantType &placeholder = collectedFunctionValuationPlaceholder.second;
+        bool ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            // Find the parameters whose bounds differ from the previous region.
+            std::set<VariableType> changedLowerBounds, changedUpperBounds;
+            for (auto const& variable : region.getVariables()) {
+                auto lastLowerIt = lastLowerBoundaries.find(variable);
+                if (lastLowerIt == lastLowerBoundaries.end() || lastLowerIt->second != region.getLowerBoundary(variable)) {
+                    changedLowerBounds.insert(variable);
+                }
+                auto lastUpperIt = lastUpperBoundaries.find(variable);
+                if (lastUpperIt == lastUpperBoundaries.end() || lastUpperIt->second != region.getUpperBoundary(variable)) {
+                    changedUpperBounds.insert(variable);
+                }
+            }
+            bool directionChanged = !lastDirForUnspecifiedParameters || lastDirForUnspecifiedParameters.get() != dirForUnspecifiedParameters;
+            lastLowerBoundaries = region.getLowerBoundaries();
+            lastUpperBoundaries = region.getUpperBoundaries();
+            lastDirForUnspecifiedParameters = dirForUnspecifiedParameters;
+
+            auto intersects = [](std::set<VariableType> const& lhs, std::set<VariableType> const& rhs) {
+                return std::any_of(lhs.begin(), lhs.end(), [&rhs](VariableType const& variable) { return rhs.count(variable) > 0; });
+            };
+
+            bool updatedPlaceholder = false;
+            for (auto const& evaluation : evaluations) {
+                AbstractValuation const& abstrValuation = *evaluation.valuation;
+                bool unspecifiedParametersChanged = !abstrValuation.getUnspecifiedParameters().empty() && (directionChanged || intersects(abstrValuation.getUnspecifiedParameters(), changedLowerBounds) || intersects(abstrValuation.getUnspecifiedParameters(), changedUpperBounds));
+                if (!unspecifiedParametersChanged && !intersects(abstrValuation.getLowerParameters(), changedLowerBounds) && !intersects(abstrValuation.getUpperParameters(), changedUpperBounds)) {
+                    // The previous result is still valid
+                    continue;
+                }
+                updatedPlaceholder = true;
+                auto const& function = *evaluation.function;
+                ConstantType &placeholder = *evaluation.placeholder;
                 auto concreteValuations = abstrValuation.getConcreteValuations(region);
                 auto concreteValuationIt = concreteValuations.begin();
-                placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+                placeholder = function.evaluate(*concreteValuationIt);
                 for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-                    ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+                    ConstantType currentResult = function.evaluate(*concreteValuationIt);
                     if (storm::solver::minimize(dirForUnspecifiedParameters)) {
                         placeholder = std::min(placeholder, currentResult);
                     } else {
@@ -347,6 +388,7 @@ namespace storm {
                     }
                 }
             }
+            return updatedPlaceholder;
         }
         
         template class ParameterLifter<storm::RationalFunction, double>;
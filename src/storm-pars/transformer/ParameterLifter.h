@@ -4,9 +4,11 @@
 #include <vector>
 #include <unordered_map>
 #include <set>
+#include <boost/optional.hpp>
 
 
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunction.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -132,7 +134,13 @@ namespace storm {
                  */
                 ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
 
-                void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+                /*!
+                 * Evaluates the collected functions wrt. the given region and writes the results into the placeholders.
+                 * Only the pairs whose valuation considers a parameter with different bounds than in the previous call are evaluated again.
+                 * This is the case for most pairs when moving from a region to one of its subregions (or a sibling thereof).
+                 * @return true if at least one placeholder has been updated.
+                 */
+                bool evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
                 
             private:
                 // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
@@ -150,6 +158,21 @@ namespace storm {
 
                 // Stores the collected functions with the valuations together with a placeholder for the result.
                 std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+                // Each occurring function is compiled once (independent of the valuations it occurs with) to avoid evaluating it with carl.
+                std::unordered_map<ParametricType, storm::utility::CompiledRationalFunction<ConstantType>> compiledFunctions;
+
+                // The evaluations to perform, i.e., the compiled function, the valuation and the placeholder for each entry of collectedFunctions.
+                struct Evaluation {
+                    storm::utility::CompiledRationalFunction<ConstantType> const* function;
+                    AbstractValuation const* valuation;
+                    ConstantType* placeholder;
+                };
+                std::vector<Evaluation> evaluations;
+
+                // The bounds of the parameters and the optimization direction of the previous call of evaluateCollectedFunctions
+                typename storm::storage::ParameterRegion<ParametricType>::Valuation lastLowerBoundaries, lastUpperBoundaries;
+                boost::optional<storm::solver::OptimizationDirection> lastDirForUnspecifiedParameters;
             };
             
             FunctionValuationCollector functionValuationCollector;
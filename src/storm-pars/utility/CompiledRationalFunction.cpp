@@ -0,0 +1,242 @@
+#include "storm-pars/utility/CompiledRationalFunction.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+
+        template<typename ValueType>
+        CompiledRationalFunction<ValueType>::CompiledRationalFunction(storm::RationalFunction const& function) : stackSize(0), maxStackSize(0) {
+            std::set<VariableType> variableSet;
+            storm::utility::parametric::gatherOccurringVariables(function, variableSet);
+            variables.assign(variableSet.begin(), variableSet.end());
+
+            compileTerms(getTerms(function.nominatorAsPolynomial().polynomialWithCoefficient()), 0);
+            auto denominator = function.denominatorAsPolynomial().polynomialWithCoefficient();
+            if (!denominator.isOne()) {
+                compileTerms(getTerms(denominator), 0);
+                addInstruction(Opcode::Divide);
+            }
+            STORM_LOG_ASSERT(stackSize == 1, "Unexpected stack size after compiling a function.");
+            stack.resize(maxStackSize);
+        }
+
+        template<typename ValueType>
+        std::vector<typename CompiledRationalFunction<ValueType>::VariableType> const& CompiledRationalFunction<ValueType>::getVariables() const {
+            return variables;
+        }
+
+        template<typename ValueType>
+        ValueType CompiledRationalFunction<ValueType>::evaluate(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation) const {
+            valuationValues.clear();
+            for (auto const& variable : variables) {
+                auto valueIt = valuation.find(variable);
+                STORM_LOG_THROW(valueIt != valuation.end(), storm::exceptions::InvalidArgumentException, "The valuation does not specify a value for variable " << variable << ".");
+                valuationValues.push_back(storm::utility::convertNumber<ValueType>(valueIt->second));
+            }
+            return evaluate(valuationValues);
+        }
+
+        template<typename ValueType>
+        ValueType CompiledRationalFunction<ValueType>::evaluate(std::vector<ValueType> const& variableValues) const {
+            STORM_LOG_ASSERT(variableValues.size() == variables.size(), "Unexpected number of variable values.");
+            uint64_t size = 0;
+            for (auto const& instruction : instructions) {
+                switch (instruction.opcode) {
+                    case Opcode::PushConstant:
+                        stack[size++] = constants[instruction.constant];
+                        break;
+                    case Opcode::AddConstant:
+                        stack[size - 1] += constants[instruction.constant];
+                        break;
+                    case Opcode::Add:
+                        --size;
+                        stack[size - 1] += stack[size];
+                        break;
+                    case Opcode::MultiplyVariable:
+                        if (instruction.exponent == 1) {
+                            stack[size - 1] *= variableValues[instruction.variable];
+                        } else {
+                            stack[size - 1] *= storm::utility::pow(variableValues[instruction.variable], instruction.exponent);
+                        }
+                        break;
+                    case Opcode::Divide:
+                        --size;
+                        stack[size - 1] /= stack[size];
+                        break;
+                }
+            }
+            return stack.front();
+        }
+
+        template<typename ValueType>
+        void CompiledRationalFunction<ValueType>::evaluate(std::vector<std::vector<ValueType> const*> const& variableValues, std::vector<ValueType>& result) const {
+            STORM_LOG_ASSERT(variableValues.size() == variables.size(), "Unexpected number of variable values.");
+            uint64_t const batchSize = result.size();
+            batchStack.resize(maxStackSize);
+            for (auto& stackEntry : batchStack) {
+                stackEntry.resize(batchSize);
+            }
+            // Each instruction is applied to all valuations before the next instruction is considered.
+            uint64_t size = 0;
+            for (auto const& instruction : instructions) {
+                switch (instruction.opcode) {
+                    case Opcode::PushConstant:
+                        std::fill(batchStack[size].begin(), batchStack[size].end(), constants[instruction.constant]);
+                        ++size;
+                        break;
+                    case Opcode::AddConstant: {
+                        auto& top = batchStack[size - 1];
+                        ValueType const& constant = constants[instruction.constant];
+                        for (uint64_t i = 0; i < batchSize; ++i) {
+                            top[i] += constant;
+                        }
+                        break;
+                    }
+                    case Opcode::Add: {
+                        --size;
+                        auto& top = batchStack[size - 1];
+                        auto const& operand = batchStack[size];
+                        for (uint64_t i = 0; i < batchSize; ++i) {
+                            top[i] += operand[i];
+                        }
+                        break;
+                    }
+                    case Opcode::MultiplyVariable: {
+                        auto& top = batchStack[size - 1];
+                        auto const& values = *variableValues[instruction.variable];
+                        if (instruction.exponent == 1) {
+                            for (uint64_t i = 0; i < batchSize; ++i) {
+                                top[i] *= values[i];
+                            }
+                        } else {
+                            for (uint64_t i = 0; i < batchSize; ++i) {
+                                top[i] *= storm::utility::pow(values[i], instruction.exponent);
+                            }
+                        }
+                        break;
+                    }
+                    case Opcode::Divide: {
+                        --size;
+                        auto& top = batchStack[size - 1];
+                        auto const& operand = batchStack[size];
+                        for (uint64_t i = 0; i < batchSize; ++i) {
+                            top[i] /= operand[i];
+                        }
+                        break;
+                    }
+                }
+            }
+            std::copy(batchStack.front().begin(), batchStack.front().end(), result.begin());
+        }
+
+        template<typename ValueType>
+        uint64_t CompiledRationalFunction<ValueType>::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        template<typename ValueType>
+        std::vector<typename CompiledRationalFunction<ValueType>::Term> CompiledRationalFunction<ValueType>::getTerms(storm::RawPolynomial const& polynomial) const {
+            std::vector<Term> result;
+            for (auto const& term : polynomial) {
+                result.push_back({storm::utility::convertNumber<ValueType>(term.coeff()), std::vector<uint64_t>(variables.size(), 0)});
+                // The monomial of a constant term is not set.
+                if (term.monomial()) {
+                    for (auto const& variableExponentPair : *term.monomial()) {
+                        uint64_t variableIndex = std::lower_bound(variables.begin(), variables.end(), variableExponentPair.first) - variables.begin();
+                        STORM_LOG_ASSERT(variableIndex < variables.size() && variables[variableIndex] == variableExponentPair.first, "Unknown variable " << variableExponentPair.first << ".");
+                        result.back().exponents[variableIndex] = variableExponentPair.second;
+                    }
+                }
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        void CompiledRationalFunction<ValueType>::compileTerms(std::vector<Term> const& terms, uint64_t firstVariable) {
+            if (terms.empty()) {
+                addConstantInstruction(Opcode::PushConstant, storm::utility::zero<ValueType>());
+                return;
+            }
+
+            // Find the first variable that occurs in one of the terms.
+            auto occursInTerms = [&terms](uint64_t variable) {
+                return std::any_of(terms.begin(), terms.end(), [variable](Term const& term) { return term.exponents[variable] > 0; });
+            };
+            uint64_t variable = firstVariable;
+            while (variable < variables.size() && !occursInTerms(variable)) {
+                ++variable;
+            }
+            if (variable == variables.size()) {
+                // Since the monomials of a polynomial are unique, there is only one constant term.
+                STORM_LOG_ASSERT(terms.size() == 1, "Expected a single constant term.");
+                addConstantInstruction(Opcode::PushConstant, terms.front().coefficient);
+                return;
+            }
+
+            // Write the terms as a polynomial in the variable, i.e., group them by their exponent of the variable (in descending order).
+            std::map<uint64_t, std::vector<Term>, std::greater<uint64_t>> coefficientTerms;
+            for (auto const& term : terms) {
+                auto& coefficient = coefficientTerms[term.exponents[variable]];
+                coefficient.push_back(term);
+                coefficient.back().exponents[variable] = 0;
+            }
+            auto isConstantCoefficient = [](std::vector<Term> const& coefficient) {
+                return coefficient.size() == 1 && std::all_of(coefficient.front().exponents.begin(), coefficient.front().exponents.end(), [](uint64_t exponent) { return exponent == 0; });
+            };
+
+            // Apply the Horner scheme
+            auto coefficientIt = coefficientTerms.begin();
+            compileTerms(coefficientIt->second, variable + 1);
+            uint64_t previousExponent = coefficientIt->first;
+            for (++coefficientIt; coefficientIt != coefficientTerms.end(); ++coefficientIt) {
+                addInstruction(Opcode::MultiplyVariable, variable, previousExponent - coefficientIt->first);
+                if (isConstantCoefficient(coefficientIt->second)) {
+                    addConstantInstruction(Opcode::AddConstant, coefficientIt->second.front().coefficient);
+                } else {
+                    compileTerms(coefficientIt->second, variable + 1);
+                    addInstruction(Opcode::Add);
+                }
+                previousExponent = coefficientIt->first;
+            }
+            if (previousExponent > 0) {
+                addInstruction(Opcode::MultiplyVariable, variable, previousExponent);
+            }
+        }
+
+        template<typename ValueType>
+        void CompiledRationalFunction<ValueType>::addConstantInstruction(Opcode opcode, ValueType const& constant) {
+            STORM_LOG_ASSERT(opcode == Opcode::PushConstant || opcode == Opcode::AddConstant, "Unexpected opcode.");
+            instructions.push_back({opcode, constants.size(), 0, 0});
+            constants.push_back(constant);
+            if (opcode == Opcode::PushConstant) {
+                ++stackSize;
+                maxStackSize = std::max(maxStackSize, stackSize);
+            }
+        }
+
+        template<typename ValueType>
+        void CompiledRationalFunction<ValueType>::addInstruction(Opcode opcode, uint64_t variable, int_fast64_t exponent) {
+            STORM_LOG_ASSERT(opcode != Opcode::PushConstant && opcode != Opcode::AddConstant, "Unexpected opcode.");
+            instructions.push_back({opcode, 0, variable, exponent});
+            if (opcode == Opcode::Add || opcode == Opcode::Divide) {
+                --stackSize;
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template class CompiledRationalFunction<double>;
+        template class CompiledRationalFunction<storm::RationalNumber>;
+        template class CompiledRationalFunction<storm::RationalFunction>;
+#endif
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A rational function that is compiled into a small program for fast evaluation with the given value type, e.g., double.
+         * Numerator and denominator are translated into a (multivariate) Horner scheme which is evaluated on a stack.
+         * Hence, the evaluation neither involves carl nor arbitrary precision arithmetic (unless the value type requires it).
+         *
+         * Note that evaluating the same object concurrently is not supported as the stack is reused for all evaluations.
+         */
+        template<typename ValueType>
+        class CompiledRationalFunction {
+        public:
+            typedef storm::utility::parametric::VariableType<storm::RationalFunction>::type VariableType;
+
+            CompiledRationalFunction(storm::RationalFunction const& function);
+
+            /*!
+             * Retrieves the variables occurring in the function (in ascending order).
+             */
+            std::vector<VariableType> const& getVariables() const;
+
+            /*!
+             * Evaluates the function wrt. the given valuation which has to assign a value to every occurring variable.
+             */
+            ValueType evaluate(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation) const;
+
+            /*!
+             * Evaluates the function.
+             * @param variableValues The i-th entry is the value of the i-th variable (as given by getVariables()).
+             */
+            ValueType evaluate(std::vector<ValueType> const& variableValues) const;
+
+            /*!
+             * Evaluates the function for several valuations at once.
+             * @param variableValues For the i-th variable (as given by getVariables()), a vector with its values for all valuations.
+             * @param result The values of the function for the different valuations are written into this vector. Its size determines the number of valuations.
+             */
+            void evaluate(std::vector<std::vector<ValueType> const*> const& variableValues, std::vector<ValueType>& result) const;
+
+            /*!
+             * Retrieves the number of instructions of the compiled program.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+        private:
+            enum class Opcode {
+                PushConstant, // Pushes a constant on the stack
+                AddConstant, // Adds a constant to the topmost value
+                Add, // Removes the topmost value and adds it to the new topmost value
+                MultiplyVariable, // Multiplies the topmost value with a power of a variable
+                Divide // Removes the topmost value and divides the new topmost value by it
+            };
+
+            struct Instruction {
+                Opcode opcode;
+                uint64_t constant; // The index of the constant (for PushConstant and AddConstant)
+                uint64_t variable; // The index of the variable (for MultiplyVariable)
+                int_fast64_t exponent; // The exponent of the variable (for MultiplyVariable)
+            };
+
+            // A monomial with its coefficient. The i-th exponent refers to the i-th variable.
+            struct Term {
+                ValueType coefficient;
+                std::vector<uint64_t> exponents;
+            };
+
+            /*!
+             * Translates the given polynomial into terms over the occurring variables.
+             */
+            std::vector<Term> getTerms(storm::RawPolynomial const& polynomial) const;
+
+            /*!
+             * Appends instructions that push the value of the sum of the given terms on the stack (using the Horner scheme).
+             * All given terms must have exponent zero for the variables below firstVariable.
+             */
+            void compileTerms(std::vector<Term> const& terms, uint64_t firstVariable);
+
+            void addConstantInstruction(Opcode opcode, ValueType const& constant);
+            void addInstruction(Opcode opcode, uint64_t variable = 0, int_fast64_t exponent = 0);
+
+            std::vector<VariableType> variables;
+            std::vector<ValueType> constants;
+            std::vector<Instruction> instructions;
+
+            // The current and maximal size of the stack (only used during compilation)
+            uint64_t stackSize;
+            uint64_t maxStackSize;
+
+            // Memory for the evaluation
+            mutable std::vector<ValueType> valuationValues;
+            mutable std::vector<ValueType> stack;
+            mutable std::vector<std::vector<ValueType>> batchStack;
+        };
+
+    }
+}
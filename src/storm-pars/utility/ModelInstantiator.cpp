@@ -1,6 +1,13 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+
 namespace storm {
     namespace utility {
         
@@ -138,7 +145,86 @@ namespace storm {
             ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation){
                 //Write results into the placeholders
                 instantiate_helper(valuation);
+                applyEvaluatedFunctions();
+                return *this->instantiatedModel;
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::evaluateBatch(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+                if (this->compiledFunctions.size() != this->functions.size()) {
+                    compileFunctions();
+                }
+                this->batchSize = valuations.size();
+                
+                // Gather the values of each variable for the different valuations
+                std::vector<std::vector<ConstantType>> variableValues(this->compiledVariables.size(), std::vector<ConstantType>(this->batchSize));
+                for (uint64_t variableIndex = 0; variableIndex < this->compiledVariables.size(); ++variableIndex) {
+                    auto const& variable = this->compiledVariables[variableIndex];
+                    for (uint64_t valuationIndex = 0; valuationIndex < this->batchSize; ++valuationIndex) {
+                        auto valueIt = valuations[valuationIndex].find(variable);
+                        STORM_LOG_THROW(valueIt != valuations[valuationIndex].end(), storm::exceptions::InvalidArgumentException, "Valuation " << valuationIndex << " does not specify a value for variable " << variable << ".");
+                        variableValues[variableIndex][valuationIndex] = storm::utility::convertNumber<ConstantType>(valueIt->second);
+                    }
+                }
+                
+                // Evaluate the functions one after another, each of them for all valuations at once
+                this->batchValues.resize(this->compiledFunctions.size() * this->batchSize);
+                std::vector<ConstantType> functionValues(this->batchSize);
+                std::vector<std::vector<ConstantType> const*> functionVariableValues;
+                auto batchValueIt = this->batchValues.begin();
+                for (uint64_t functionIndex = 0; functionIndex < this->compiledFunctions.size(); ++functionIndex) {
+                    functionVariableValues.clear();
+                    for (auto const& variableIndex : this->compiledFunctionVariables[functionIndex]) {
+                        functionVariableValues.push_back(&variableValues[variableIndex]);
+                    }
+                    this->compiledFunctions[functionIndex].evaluate(functionVariableValues, functionValues);
+                    batchValueIt = std::copy(functionValues.begin(), functionValues.end(), batchValueIt);
+                }
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateFromBatch(uint64_t index) {
+                STORM_LOG_THROW(index < this->batchSize, storm::exceptions::InvalidArgumentException, "Index " << index << " is out of range for a batch of " << this->batchSize << " valuations.");
+                uint64_t functionIndex = 0;
+                for (auto& functionResult : this->functions) {
+                    functionResult.second = this->batchValues[functionIndex * this->batchSize + index];
+                    ++functionIndex;
+                }
+                applyEvaluatedFunctions();
+                return *this->instantiatedModel;
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            uint64_t ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getBatchSize() const {
+                return this->batchSize;
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::compileFunctions() {
+                std::set<VariableType> variableSet;
+                for (auto const& functionResult : this->functions) {
+                    storm::utility::parametric::gatherOccurringVariables(functionResult.first, variableSet);
+                }
+                this->compiledVariables.assign(variableSet.begin(), variableSet.end());
+                std::map<VariableType, uint64_t> variableIndices;
+                for (uint64_t variableIndex = 0; variableIndex < this->compiledVariables.size(); ++variableIndex) {
+                    variableIndices.emplace(this->compiledVariables[variableIndex], variableIndex);
+                }
                 
+                this->compiledFunctions.clear();
+                this->compiledFunctions.reserve(this->functions.size());
+                this->compiledFunctionVariables.clear();
+                for (auto const& functionResult : this->functions) {
+                    this->compiledFunctions.emplace_back(functionResult.first);
+                    this->compiledFunctionVariables.emplace_back();
+                    for (auto const& variable : this->compiledFunctions.back().getVariables()) {
+                        this->compiledFunctionVariables.back().push_back(variableIndices.at(variable));
+                    }
+                }
+            }
+            
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::applyEvaluatedFunctions() {
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
                 for(auto& entryValuePair : this->matrixMapping){
                     entryValuePair.first->setValue(*(entryValuePair.second));
@@ -146,8 +232,6 @@ namespace storm {
                 for(auto& entryValuePair : this->vectorMapping){
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
-                
-                return *this->instantiatedModel;
             }
         
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
@@ -4,7 +4,9 @@
 #include <unordered_map>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
+#include "storm-pars/utility/CompiledRationalFunction.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -48,11 +50,44 @@ namespace storm {
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
                 
+                /*!
+                 * Evaluates the occurring parametric functions for each of the given valuations.
+                 * On the first call, every function is compiled into a CompiledRationalFunction.
+                 * These are then evaluated for all valuations at once using ConstantType arithmetic, where the values of one variable (and of one function) for the different valuations are stored consecutively.
+                 * As opposed to instantiate, the functions are thus not evaluated exactly before being converted to ConstantType.
+                 * The instantiated models can be retrieved with instantiateFromBatch.
+                 * @param valuations Each valuation maps the occurring variables to the values with which they should be substituted
+                 */
+                void evaluateBatch(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
+                
+                /*!
+                 * Retrieves the instantiated model for one of the valuations given in the last call of evaluateBatch.
+                 * Note that the same model object is returned by every call (and by instantiate), i.e., previously retrieved instantiations are overwritten.
+                 * @param index The position of the valuation in the batch
+                 * @return The instantiated model
+                 */
+                ConstantSparseModelType const& instantiateFromBatch(uint64_t index);
+                
+                /*!
+                 * Retrieves the number of valuations that have been evaluated in the last call of evaluateBatch.
+                 */
+                uint64_t getBatchSize() const;
+                
                 /*!
                  *  Check validity
                  */
                 void checkValid() const;
             private:
+                /*!
+                 * Compiles the occurring functions (in the order in which they occur in the functions map).
+                 */
+                void compileFunctions();
+                
+                /*!
+                 * Writes the current values of the placeholders to the matrices and vectors of the instantiated model.
+                 */
+                void applyEvaluatedFunctions();
+                
                 /*!
                  * Initializes the instantiatedModel with dummy data by considering the model-specific ingredients.
                  * Also initializes other model-specific data, e.g., the exitRate vector of a markov automaton
@@ -190,6 +225,17 @@ namespace storm {
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
                 
+                /// The variables occurring in the compiled functions
+                std::vector<VariableType> compiledVariables;
+                /// The occurring functions in the order of the functions map, compiled for the batch evaluation
+                std::vector<storm::utility::CompiledRationalFunction<ConstantType>> compiledFunctions;
+                /// For each compiled function, the indices (in compiledVariables) of its variables
+                std::vector<std::vector<uint64_t>> compiledFunctionVariables;
+                /// The number of valuations in the last batch
+                uint64_t batchSize = 0;
+                /// The values of the functions for the valuations in the last batch. The value of the i-th function for the j-th valuation is at position i*batchSize+j
+                std::vector<ConstantType> batchValues;
+                
                 
             };
     }//Namespace utility
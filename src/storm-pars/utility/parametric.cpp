@@ -1,4 +1,5 @@
 #include <string>
+#include <mutex>
 
 #include "storm-pars/utility/parametric.h"
 #include "storm/utility/constants.h"
@@ -19,6 +20,10 @@ namespace storm {
 #ifdef STORM_HAVE_CARL
             template<>
             typename CoefficientType<storm::RationalFunction>::type evaluate<storm::RationalFunction>(storm::RationalFunction const& function, Valuation<storm::RationalFunction> const& valuation){
+                // The factorizations of rational functions are shared via a global cache that is not thread-safe.
+                // Evaluations are therefore serialized, which allows to analyze regions concurrently.
+                static std::mutex evaluationMutex;
+                std::lock_guard<std::mutex> lock(evaluationMutex);
                 return function.evaluate(valuation);
             }
 
@@ -0,0 +1,362 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <type_traits>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingFormat.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/DistributedSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+
+using namespace storm::exporter::binary;
+
+storm::models::ModelType getModelType(ModelTypeCode const& code) {
+    switch (code) {
+        case ModelTypeCode::Dtmc:
+            return storm::models::ModelType::Dtmc;
+        case ModelTypeCode::Ctmc:
+            return storm::models::ModelType::Ctmc;
+        case ModelTypeCode::Mdp:
+            return storm::models::ModelType::Mdp;
+        case ModelTypeCode::MarkovAutomaton:
+            return storm::models::ModelType::MarkovAutomaton;
+        case ModelTypeCode::Pomdp:
+            return storm::models::ModelType::Pomdp;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown model type " << static_cast<uint32_t>(code) << " in binary model file.");
+}
+
+/*!
+ * Provides access to the sections of a mapped binary model file. All accesses are checked against the bounds of the file.
+ */
+class SectionReader {
+   public:
+    SectionReader(MappedFile const& file) : file(file) {
+        STORM_LOG_THROW(file.getDataSize() >= sizeof(FileHeader), storm::exceptions::WrongFormatException, "The binary model file is too small.");
+        std::memcpy(&header, file.getData(), sizeof(FileHeader));
+        STORM_LOG_THROW(std::equal(std::begin(Magic), std::end(Magic), header.magic), storm::exceptions::WrongFormatException,
+                        "The file is not a binary model file.");
+        STORM_LOG_THROW(header.endiannessMarker == EndiannessMarker, storm::exceptions::WrongFormatException,
+                        "The binary model file was exported on a machine with a different byte order.");
+        STORM_LOG_THROW(header.version == FormatVersion, storm::exceptions::WrongFormatException,
+                        "Unsupported version " << header.version << " of the binary model format. Expected version " << FormatVersion << ".");
+        STORM_LOG_THROW(header.valueType == ValueTypeCode::Double, storm::exceptions::WrongFormatException, "Unknown value type in binary model file.");
+        STORM_LOG_THROW(header.numberOfSections <= (file.getDataSize() - sizeof(FileHeader)) / sizeof(SectionHeader), storm::exceptions::WrongFormatException,
+                        "The section table exceeds the binary model file.");
+        sections.resize(header.numberOfSections);
+        std::memcpy(sections.data(), file.getData() + sizeof(FileHeader), sections.size() * sizeof(SectionHeader));
+        for (auto const& section : sections) {
+            checkBounds(section.nameOffset, section.nameLength);
+            checkBounds(section.offset, section.size);
+            STORM_LOG_THROW(section.offset % SectionAlignment == 0, storm::exceptions::WrongFormatException, "Misaligned section in binary model file.");
+        }
+    }
+
+    FileHeader const& getHeader() const {
+        return header;
+    }
+
+    std::vector<SectionHeader> const& getSections() const {
+        return sections;
+    }
+
+    std::string getName(SectionHeader const& section) const {
+        return std::string(file.getData() + section.nameOffset, section.nameLength);
+    }
+
+    SectionHeader const* findSection(SectionKind kind) const {
+        for (auto const& section : sections) {
+            if (section.kind == kind) {
+                return &section;
+            }
+        }
+        return nullptr;
+    }
+
+    SectionHeader const& getSection(SectionKind kind) const {
+        auto section = findSection(kind);
+        STORM_LOG_THROW(section != nullptr, storm::exceptions::WrongFormatException,
+                        "Missing section " << static_cast<uint32_t>(kind) << " in binary model file.");
+        return *section;
+    }
+
+    /*!
+     * Retrieves the data of the given section, which has to consist of exactly the given number of elements.
+     * The section is aligned, so the data can be accessed in place.
+     */
+    template<typename T>
+    T const* getData(SectionHeader const& section, uint64_t expectedNumberOfElements) const {
+        STORM_LOG_THROW(section.size == expectedNumberOfElements * sizeof(T), storm::exceptions::WrongFormatException,
+                        "Section " << static_cast<uint32_t>(section.kind) << " of binary model file has unexpected size " << section.size << ".");
+        return reinterpret_cast<T const*>(file.getData() + section.offset);
+    }
+
+    std::vector<double> getValues(SectionHeader const& section, uint64_t expectedNumberOfElements) const {
+        double const* data = getData<double>(section, expectedNumberOfElements);
+        return std::vector<double>(data, data + expectedNumberOfElements);
+    }
+
+    /*!
+     * Retrieves the bits first, ..., end-1 of the bit vector over the given number of elements that is stored in the given section.
+     */
+    storm::storage::BitVector getBitVectorRange(SectionHeader const& section, uint64_t size, uint64_t first, uint64_t end) const {
+        uint64_t const* words = getData<uint64_t>(section, (size + 63) / 64);
+        storm::storage::BitVector result(end - first);
+        for (uint64_t index = first; index < end; ++index) {
+            if ((words[index / 64] >> (63 - index % 64)) & 1) {
+                result.set(index - first);
+            }
+        }
+        return result;
+    }
+
+    storm::storage::BitVector getBitVector(SectionHeader const& section, uint64_t size) const {
+        uint64_t numberOfWords = (size + 63) / 64;
+        uint64_t const* words = getData<uint64_t>(section, numberOfWords);
+        storm::storage::BitVector result(size);
+        for (uint64_t word = 0; word < numberOfWords; ++word) {
+            uint64_t numberOfBits = std::min<uint64_t>(64, size - word * 64);
+            result.setFromInt(word * 64, numberOfBits, words[word] >> (64 - numberOfBits));
+        }
+        return result;
+    }
+
+   private:
+    void checkBounds(uint64_t offset, uint64_t size) const {
+        STORM_LOG_THROW(offset <= file.getDataSize() && size <= file.getDataSize() - offset, storm::exceptions::WrongFormatException,
+                        "Section exceeds the binary model file.");
+    }
+
+    MappedFile const& file;
+    FileHeader header;
+    std::vector<SectionHeader> sections;
+};
+
+template<typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<double, RewardModelType>> loadModel(std::string const& filename) {
+    MappedFile file(filename.c_str());
+    SectionReader reader(file);
+    auto const& header = reader.getHeader();
+    storm::models::ModelType type = getModelType(header.modelType);
+    bool nondeterministic =
+        type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp;
+    STORM_LOG_THROW(nondeterministic || header.numberOfChoices == header.numberOfStates, storm::exceptions::WrongFormatException,
+                    "Deterministic model with a different number of states and choices.");
+
+    // Transition matrix.
+    uint64_t const* rowIndicationData = reader.getData<uint64_t>(reader.getSection(SectionKind::RowIndications), header.numberOfChoices + 1);
+    uint64_t const* columnData = reader.getData<uint64_t>(reader.getSection(SectionKind::Columns), header.numberOfEntries);
+    double const* valueData = reader.getData<double>(reader.getSection(SectionKind::Values), header.numberOfEntries);
+    STORM_LOG_THROW(rowIndicationData[0] == 0 && rowIndicationData[header.numberOfChoices] == header.numberOfEntries,
+                    storm::exceptions::WrongFormatException, "Invalid row indications in binary model file.");
+    std::vector<uint_fast64_t> rowIndications(rowIndicationData, rowIndicationData + header.numberOfChoices + 1);
+    STORM_LOG_THROW(std::is_sorted(rowIndications.begin(), rowIndications.end()), storm::exceptions::WrongFormatException,
+                    "Invalid row indications in binary model file.");
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> columnsAndValues;
+    columnsAndValues.reserve(header.numberOfEntries);
+    for (uint64_t entry = 0; entry < header.numberOfEntries; ++entry) {
+        STORM_LOG_THROW(columnData[entry] < header.numberOfStates, storm::exceptions::WrongFormatException, "Invalid column in binary model file.");
+        columnsAndValues.emplace_back(columnData[entry], valueData[entry]);
+    }
+    boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
+    if (nondeterministic) {
+        uint64_t const* groupData = reader.getData<uint64_t>(reader.getSection(SectionKind::RowGroupIndices), header.numberOfStates + 1);
+        STORM_LOG_THROW(groupData[0] == 0 && groupData[header.numberOfStates] == header.numberOfChoices, storm::exceptions::WrongFormatException,
+                        "Invalid row groups in binary model file.");
+        rowGroupIndices = std::vector<uint_fast64_t>(groupData, groupData + header.numberOfStates + 1);
+        STORM_LOG_THROW(std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()), storm::exceptions::WrongFormatException,
+                        "Invalid row groups in binary model file.");
+    }
+
+    storm::storage::sparse::ModelComponents<double, RewardModelType> components(
+        storm::storage::SparseMatrix<double>(header.numberOfStates, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices)),
+        storm::models::sparse::StateLabeling(header.numberOfStates));
+
+    // Labelings and reward models.
+    std::map<std::string, std::pair<std::optional<std::vector<double>>, std::optional<std::vector<double>>>> rewardVectors;
+    for (auto const& section : reader.getSections()) {
+        switch (section.kind) {
+            case SectionKind::StateLabel:
+                components.stateLabeling.addLabel(reader.getName(section), reader.getBitVector(section, header.numberOfStates));
+                break;
+            case SectionKind::ChoiceLabel:
+                if (!components.choiceLabeling) {
+                    components.choiceLabeling = storm::models::sparse::ChoiceLabeling(header.numberOfChoices);
+                }
+                components.choiceLabeling->addLabel(reader.getName(section), reader.getBitVector(section, header.numberOfChoices));
+                break;
+            case SectionKind::StateRewards:
+                rewardVectors[reader.getName(section)].first = reader.getValues(section, header.numberOfStates);
+                break;
+            case SectionKind::StateActionRewards:
+                rewardVectors[reader.getName(section)].second = reader.getValues(section, header.numberOfChoices);
+                break;
+            default:
+                // All other sections are handled separately.
+                break;
+        }
+    }
+    for (auto& rewardVector : rewardVectors) {
+        components.rewardModels.emplace(rewardVector.first, RewardModelType(std::move(rewardVector.second.first), std::move(rewardVector.second.second)));
+    }
+
+    // Model type specific components.
+    if (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton) {
+        components.exitRates = reader.getValues(reader.getSection(SectionKind::ExitRates), header.numberOfStates);
+    }
+    if (type == storm::models::ModelType::Ctmc) {
+        components.rateTransitions = true;
+    } else if (type == storm::models::ModelType::MarkovAutomaton) {
+        components.markovianStates = reader.getBitVector(reader.getSection(SectionKind::MarkovianStates), header.numberOfStates);
+    } else if (type == storm::models::ModelType::Pomdp) {
+        uint32_t const* observationData = reader.getData<uint32_t>(reader.getSection(SectionKind::Observations), header.numberOfStates);
+        components.observabilityClasses = std::vector<uint32_t>(observationData, observationData + header.numberOfStates);
+    }
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(
+    std::string const& filename) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        STORM_LOG_INFO("Reading from file " << filename);
+        return loadModel<RewardModelType>(filename);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary format only supports models with double values.");
+    }
+}
+
+BinaryModelPartition parseBinaryModelPartition(std::string const& filename, uint64_t rank, uint64_t numberOfParts) {
+    STORM_LOG_THROW(rank < numberOfParts, storm::exceptions::InvalidArgumentException, "Invalid rank " << rank << " for " << numberOfParts << " parts.");
+    MappedFile file(filename.c_str());
+    SectionReader reader(file);
+    auto const& header = reader.getHeader();
+    BinaryModelPartition result;
+    result.modelType = getModelType(header.modelType);
+    bool nondeterministic = result.modelType == storm::models::ModelType::Mdp || result.modelType == storm::models::ModelType::Pomdp;
+    STORM_LOG_THROW(nondeterministic || result.modelType == storm::models::ModelType::Dtmc || result.modelType == storm::models::ModelType::Ctmc,
+                    storm::exceptions::NotSupportedException, "Partitioning Markov automata is not supported.");
+
+    uint64_t const* rowIndications = reader.getData<uint64_t>(reader.getSection(SectionKind::RowIndications), header.numberOfChoices + 1);
+    uint64_t const* columns = reader.getData<uint64_t>(reader.getSection(SectionKind::Columns), header.numberOfEntries);
+    double const* values = reader.getData<double>(reader.getSection(SectionKind::Values), header.numberOfEntries);
+    uint64_t const* rowGroupIndices = nullptr;
+    if (nondeterministic) {
+        rowGroupIndices = reader.getData<uint64_t>(reader.getSection(SectionKind::RowGroupIndices), header.numberOfStates + 1);
+        STORM_LOG_THROW(rowGroupIndices[header.numberOfStates] == header.numberOfChoices, storm::exceptions::WrongFormatException,
+                        "Invalid row groups in binary model file.");
+    } else {
+        STORM_LOG_THROW(header.numberOfChoices == header.numberOfStates, storm::exceptions::WrongFormatException,
+                        "Deterministic model with a different number of states and choices.");
+    }
+    auto firstRowOfState = [&](uint64_t state) { return rowGroupIndices ? rowGroupIndices[state] : state; };
+    STORM_LOG_THROW(rowIndications[header.numberOfChoices] == header.numberOfEntries, storm::exceptions::WrongFormatException,
+                    "Invalid row indications in binary model file.");
+
+    result.stateOffsets = storm::storage::DistributedSparseMatrix::computeBalancedStateOffsets(
+        header.numberOfStates, numberOfParts, [&](uint64_t state) { return rowIndications[firstRowOfState(state)]; });
+    uint64_t firstState = result.stateOffsets[rank];
+    uint64_t endState = result.stateOffsets[rank + 1];
+    uint64_t firstRow = firstRowOfState(firstState);
+    uint64_t endRow = firstRowOfState(endState);
+
+    storm::storage::SparseMatrixBuilder<double> builder(endRow - firstRow, header.numberOfStates, rowIndications[endRow] - rowIndications[firstRow], true,
+                                                        nondeterministic, nondeterministic ? endState - firstState : 0);
+    for (uint64_t state = firstState; state < endState; ++state) {
+        if (nondeterministic) {
+            builder.newRowGroup(firstRowOfState(state) - firstRow);
+        }
+        for (uint64_t row = firstRowOfState(state); row < firstRowOfState(state + 1); ++row) {
+            STORM_LOG_THROW(rowIndications[row] <= rowIndications[row + 1], storm::exceptions::WrongFormatException,
+                            "Invalid row indications in binary model file.");
+            for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                STORM_LOG_THROW(columns[entry] < header.numberOfStates, storm::exceptions::WrongFormatException, "Invalid column in binary model file.");
+                builder.addNextValue(row - firstRow, columns[entry], values[entry]);
+            }
+        }
+    }
+    result.transitionMatrix = builder.build();
+
+    for (auto const& section : reader.getSections()) {
+        if (section.kind == SectionKind::StateLabel) {
+            result.stateLabels.emplace(reader.getName(section), reader.getBitVectorRange(section, header.numberOfStates, firstState, endState));
+        }
+    }
+    return result;
+}
+
+BinaryMappedModel parseBinaryMappedModel(std::string const& filename, bool populate) {
+    auto file = std::make_shared<MappedFile>(filename.c_str(), populate);
+    if (!populate) {
+        file->adviseSequential();
+    }
+    SectionReader reader(*file);
+    auto const& header = reader.getHeader();
+    storm::models::ModelType modelType = getModelType(header.modelType);
+    bool nondeterministic = modelType == storm::models::ModelType::Mdp || modelType == storm::models::ModelType::Pomdp;
+    STORM_LOG_THROW(nondeterministic || modelType == storm::models::ModelType::Dtmc || modelType == storm::models::ModelType::Ctmc,
+                    storm::exceptions::NotSupportedException, "Mapping Markov automata is not supported.");
+
+    uint64_t const* rowIndications = reader.getData<uint64_t>(reader.getSection(SectionKind::RowIndications), header.numberOfChoices + 1);
+    uint64_t const* columns = reader.getData<uint64_t>(reader.getSection(SectionKind::Columns), header.numberOfEntries);
+    double const* values = reader.getData<double>(reader.getSection(SectionKind::Values), header.numberOfEntries);
+    uint64_t const* rowGroupIndices = nullptr;
+    if (nondeterministic) {
+        rowGroupIndices = reader.getData<uint64_t>(reader.getSection(SectionKind::RowGroupIndices), header.numberOfStates + 1);
+        STORM_LOG_THROW(rowGroupIndices[0] == 0 && rowGroupIndices[header.numberOfStates] == header.numberOfChoices, storm::exceptions::WrongFormatException,
+                        "Invalid row groups in binary model file.");
+        for (uint64_t state = 0; state < header.numberOfStates; ++state) {
+            STORM_LOG_THROW(rowGroupIndices[state] <= rowGroupIndices[state + 1], storm::exceptions::WrongFormatException,
+                            "Invalid row groups in binary model file.");
+        }
+    } else {
+        STORM_LOG_THROW(header.numberOfChoices == header.numberOfStates, storm::exceptions::WrongFormatException,
+                        "Deterministic model with a different number of states and choices.");
+    }
+
+    // The matrix is not copied, so all accesses have to be checked here.
+    STORM_LOG_THROW(rowIndications[0] == 0 && rowIndications[header.numberOfChoices] == header.numberOfEntries, storm::exceptions::WrongFormatException,
+                    "Invalid row indications in binary model file.");
+    for (uint64_t row = 0; row < header.numberOfChoices; ++row) {
+        STORM_LOG_THROW(rowIndications[row] <= rowIndications[row + 1], storm::exceptions::WrongFormatException,
+                        "Invalid row indications in binary model file.");
+    }
+    for (uint64_t entry = 0; entry < header.numberOfEntries; ++entry) {
+        STORM_LOG_THROW(columns[entry] < header.numberOfStates, storm::exceptions::WrongFormatException, "Invalid column in binary model file.");
+    }
+
+    std::map<std::string, storm::storage::BitVector> stateLabels;
+    for (auto const& section : reader.getSections()) {
+        if (section.kind == SectionKind::StateLabel) {
+            stateLabels.emplace(reader.getName(section), reader.getBitVector(section, header.numberOfStates));
+        }
+    }
+    storm::storage::MappedSparseMatrix matrix(file, header.numberOfChoices, header.numberOfStates, header.numberOfStates, rowIndications, columns, values,
+                                              rowGroupIndices);
+    return {modelType, std::move(matrix), std::move(stateLabels)};
+}
+
+template class BinaryEncodingParser<double>;
+template class BinaryEncodingParser<storm::RationalNumber>;
+template class BinaryEncodingParser<storm::RationalFunction>;
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/models/ModelType.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MappedSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Loader for models in the binary format written by storm::exporter::binaryExportSparseModel. The file is mapped into memory and all components
+ * are copied from their (aligned) sections into the model without parsing.
+ */
+template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+class BinaryEncodingParser {
+   public:
+    /*!
+     * Load a model in the binary format from a file and create the model.
+     *
+     * @param filename The file to be loaded.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& filename);
+};
+
+/*!
+ * The part of a model in the binary format that is owned by one member of a group of processes.
+ */
+struct BinaryModelPartition {
+    storm::models::ModelType modelType;
+
+    // For each member, the first state that it owns, followed by the overall number of states.
+    std::vector<uint64_t> stateOffsets;
+
+    // The rows of the owned states with global columns and a row grouping that is relative to the first owned state.
+    storm::storage::SparseMatrix<double> transitionMatrix;
+
+    // The state labels restricted to the owned states.
+    std::map<std::string, storm::storage::BitVector> stateLabels;
+};
+
+/*!
+ * Loads the part of a model in the binary format that is owned by the given member. The states are partitioned into consecutive ranges with
+ * roughly the same number of transitions, which every member computes on its own. Only the data of the owned states is copied from the mapped
+ * file, so every member only needs memory for its part.
+ *
+ * @param filename The file to be loaded.
+ * @param rank The index of the member.
+ * @param numberOfParts The number of members.
+ */
+BinaryModelPartition parseBinaryModelPartition(std::string const& filename, uint64_t rank, uint64_t numberOfParts);
+
+/*!
+ * A model in the binary format whose transition matrix remains in the mapped file.
+ */
+struct BinaryMappedModel {
+    storm::models::ModelType modelType;
+
+    // The transition matrix, which keeps the file mapped.
+    storm::storage::MappedSparseMatrix transitionMatrix;
+
+    std::map<std::string, storm::storage::BitVector> stateLabels;
+};
+
+/*!
+ * Maps a model in the binary format into memory without copying the transition matrix, such that only the vectors of a subsequent computation
+ * need to fit into main memory. Only the labels are copied. The matrix is validated once by a sequential pass over the file.
+ *
+ * @param filename The file to be loaded.
+ * @param populate If set, the whole file is read ahead, which is beneficial if it fits into main memory. Otherwise, the kernel is told that the
+ * file is going to be read sequentially.
+ */
+BinaryMappedModel parseBinaryMappedModel(std::string const& filename, bool populate = false);
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,313 @@
+#include "storm-parsers/parser/DDEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/DDBinaryFormat.h"
+#include "storm/models/symbolic/Ctmc.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/MarkovAutomaton.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+
+using namespace storm::exporter::ddbinary;
+
+/*!
+ * Reads the consecutive records of a mapped binary DD file. All accesses are checked against the bounds of the file.
+ */
+class RecordReader {
+   public:
+    RecordReader(MappedFile const& file) : file(file), offset(0) {
+        // Intentionally left empty.
+    }
+
+    template<typename T>
+    T read() {
+        T result;
+        std::memcpy(&result, getNext(sizeof(T)), sizeof(T));
+        return result;
+    }
+
+    template<typename T>
+    std::vector<T> read(uint64_t count) {
+        STORM_LOG_THROW(count <= file.getDataSize() / sizeof(T), storm::exceptions::WrongFormatException, "Record exceeds the binary DD file.");
+        std::vector<T> result(count);
+        if (count > 0) {
+            std::memcpy(result.data(), getNext(count * sizeof(T)), count * sizeof(T));
+        }
+        return result;
+    }
+
+    std::string readString(uint64_t length) {
+        return std::string(getNext(length), length);
+    }
+
+    bool isAtEnd() const {
+        return offset == file.getDataSize();
+    }
+
+   private:
+    char const* getNext(uint64_t size) {
+        STORM_LOG_THROW(size <= file.getDataSize() - offset, storm::exceptions::WrongFormatException, "Record exceeds the binary DD file.");
+        char const* result = file.getData() + offset;
+        offset += size;
+        return result;
+    }
+
+    MappedFile const& file;
+    uint64_t offset;
+};
+
+struct MetaVariableRecord {
+    MetaVariableHeader header;
+    std::string name;
+    std::vector<DdVariableRecord> ddVariables;
+};
+
+template<storm::dd::DdType Type>
+class ModelRestorer {
+   public:
+    ModelRestorer(RecordReader& reader, FileHeader const& header) : reader(reader), manager(std::make_shared<storm::dd::DdManager<Type>>()) {
+        std::vector<MetaVariableRecord> records;
+        for (uint64_t position = 0; position < header.numberOfMetaVariables; ++position) {
+            MetaVariableRecord record;
+            record.header = reader.read<MetaVariableHeader>();
+            record.name = reader.readString(record.header.nameLength);
+            record.ddVariables = reader.read<DdVariableRecord>(record.header.numberOfDdVariables);
+            records.push_back(std::move(record));
+        }
+        createMetaVariables(records);
+    }
+
+    std::set<storm::expressions::Variable> readVariableSet() {
+        std::set<storm::expressions::Variable> result;
+        for (auto const& position : reader.read<uint64_t>(reader.read<uint64_t>())) {
+            result.insert(getMetaVariable(position));
+        }
+        return result;
+    }
+
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> readVariablePairs() {
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> result;
+        uint64_t numberOfPairs = reader.read<uint64_t>();
+        for (uint64_t pair = 0; pair < numberOfPairs; ++pair) {
+            std::vector<uint64_t> positions = reader.read<uint64_t>(2);
+            result.emplace_back(getMetaVariable(positions[0]), getMetaVariable(positions[1]));
+        }
+        return result;
+    }
+
+    std::tuple<DdRole, std::string, storm::dd::Add<Type, double>> readDd() {
+        DdHeader header = reader.read<DdHeader>();
+        std::string name = reader.readString(header.nameLength);
+        std::set<storm::expressions::Variable> containedMetaVariables;
+        for (auto const& position : reader.read<uint64_t>(header.numberOfMetaVariables)) {
+            containedMetaVariables.insert(getMetaVariable(position));
+        }
+        std::vector<storm::dd::AddNode<double>> nodes;
+        nodes.reserve(header.numberOfNodes);
+        for (auto const& record : reader.read<NodeRecord>(header.numberOfNodes)) {
+            nodes.push_back({record.ddVariableIndex, record.thenNode, record.elseNode, record.value});
+        }
+        return std::make_tuple(header.role, std::move(name),
+                               storm::dd::Add<Type, double>::fromNodes(*manager, nodes, ddVariables, containedMetaVariables));
+    }
+
+    std::shared_ptr<storm::dd::DdManager<Type>> const& getManager() const {
+        return manager;
+    }
+
+   private:
+    /*!
+     * Recreates the given meta variables in the order of the file. All layers of a meta variable are created at once, such that the DD variables
+     * get the same relative indices as in the exporting manager.
+     */
+    void createMetaVariables(std::vector<MetaVariableRecord> const& records) {
+        for (uint64_t position = 0; position < records.size();) {
+            auto const& record = records[position];
+            STORM_LOG_THROW(!record.name.empty() && record.name.back() != '\'', storm::exceptions::WrongFormatException,
+                            "Unexpected meta variable '" << record.name << "' in binary DD file.");
+            uint64_t numberOfLayers = 1;
+            while (position + numberOfLayers < records.size() &&
+                   records[position + numberOfLayers].name == record.name + std::string(numberOfLayers, '\'')) {
+                ++numberOfLayers;
+            }
+
+            std::vector<storm::expressions::Variable> layers;
+            switch (record.header.type) {
+                case MetaVariableTypeCode::Bool:
+                    layers = manager->addMetaVariable(record.name, numberOfLayers);
+                    break;
+                case MetaVariableTypeCode::Int:
+                    layers = manager->addMetaVariable(record.name, record.header.low, record.header.high, numberOfLayers);
+                    break;
+                case MetaVariableTypeCode::BitVector:
+                    layers = manager->addBitVectorMetaVariable(record.name, record.header.numberOfDdVariables, numberOfLayers);
+                    break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                                    "Unknown type of meta variable '" << record.name << "' in binary DD file.");
+            }
+
+            for (uint64_t layer = 0; layer < numberOfLayers; ++layer) {
+                auto const& layerRecord = records[position + layer];
+                auto const& variables = manager->getMetaVariable(layers[layer]).getDdVariables();
+                STORM_LOG_THROW(layerRecord.header.type == record.header.type && variables.size() == layerRecord.ddVariables.size(),
+                                storm::exceptions::WrongFormatException, "Inconsistent layers of meta variable '" << record.name << "' in binary DD file.");
+                for (uint64_t bit = 0; bit < variables.size(); ++bit) {
+                    STORM_LOG_THROW(ddVariables.emplace(layerRecord.ddVariables[bit].index, variables[bit]).second, storm::exceptions::WrongFormatException,
+                                    "Duplicate DD variable index " << layerRecord.ddVariables[bit].index << " in binary DD file.");
+                    exportedAndRestoredLevels.emplace_back(layerRecord.ddVariables[bit].level, variables[bit].getLevel());
+                }
+                metaVariables.push_back(layers[layer]);
+            }
+            position += numberOfLayers;
+        }
+
+        // The DDs are rebuilt correctly for any variable order, but their size (and thereby the performance) depends on the order.
+        std::sort(exportedAndRestoredLevels.begin(), exportedAndRestoredLevels.end());
+        bool sameOrder = std::is_sorted(exportedAndRestoredLevels.begin(), exportedAndRestoredLevels.end(),
+                                        [](std::pair<uint64_t, uint64_t> const& a, std::pair<uint64_t, uint64_t> const& b) { return a.second < b.second; });
+        STORM_LOG_WARN_COND(sameOrder, "The variable order of the restored model differs from the order of the exported model.");
+    }
+
+    storm::expressions::Variable const& getMetaVariable(uint64_t position) const {
+        STORM_LOG_THROW(position < metaVariables.size(), storm::exceptions::WrongFormatException, "Unknown meta variable in binary DD file.");
+        return metaVariables[position];
+    }
+
+    RecordReader& reader;
+    std::shared_ptr<storm::dd::DdManager<Type>> manager;
+
+    // The restored meta variables in the order of the file.
+    std::vector<storm::expressions::Variable> metaVariables;
+
+    // Maps the indices of the DD variables of the exporting manager to the DD variables of the restored manager.
+    std::unordered_map<uint64_t, storm::dd::Bdd<Type>> ddVariables;
+
+    // The level of every DD variable in the exporting and the restored manager.
+    std::vector<std::pair<uint64_t, uint64_t>> exportedAndRestoredLevels;
+};
+
+template<storm::dd::DdType Type>
+std::shared_ptr<storm::models::symbolic::Model<Type, double>> loadModel(std::string const& filename) {
+    typedef storm::models::symbolic::StandardRewardModel<Type, double> RewardModelType;
+
+    MappedFile file(filename.c_str());
+    RecordReader reader(file);
+    FileHeader header = reader.read<FileHeader>();
+    STORM_LOG_THROW(std::equal(std::begin(Magic), std::end(Magic), header.magic), storm::exceptions::WrongFormatException,
+                    "The file is not a binary DD model file.");
+    STORM_LOG_THROW(header.endiannessMarker == EndiannessMarker, storm::exceptions::WrongFormatException,
+                    "The binary DD model file was exported on a machine with a different byte order.");
+    STORM_LOG_THROW(header.version == FormatVersion, storm::exceptions::WrongFormatException,
+                    "Unsupported version " << header.version << " of the binary DD model format. Expected version " << FormatVersion << ".");
+    STORM_LOG_THROW(header.valueType == ValueTypeCode::Double, storm::exceptions::WrongFormatException, "Unknown value type in binary DD model file.");
+
+    ModelRestorer<Type> restorer(reader, header);
+    std::set<storm::expressions::Variable> rowVariables = restorer.readVariableSet();
+    std::set<storm::expressions::Variable> columnVariables = restorer.readVariableSet();
+    std::set<storm::expressions::Variable> nondeterminismVariables = restorer.readVariableSet();
+    auto rowColumnMetaVariablePairs = restorer.readVariablePairs();
+
+    std::map<DdRole, storm::dd::Add<Type, double>> components;
+    std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap;
+    std::map<std::string, std::tuple<boost::optional<storm::dd::Add<Type, double>>, boost::optional<storm::dd::Add<Type, double>>,
+                                     boost::optional<storm::dd::Add<Type, double>>>>
+        rewardDds;
+    for (uint64_t dd = 0; dd < header.numberOfDds; ++dd) {
+        auto [role, name, add] = restorer.readDd();
+        switch (role) {
+            case DdRole::Label:
+                labelToBddMap.emplace(name, add.notZero());
+                break;
+            case DdRole::StateRewards:
+                std::get<0>(rewardDds[name]) = add;
+                break;
+            case DdRole::StateActionRewards:
+                std::get<1>(rewardDds[name]) = add;
+                break;
+            case DdRole::TransitionRewards:
+                std::get<2>(rewardDds[name]) = add;
+                break;
+            default:
+                components.emplace(role, add);
+        }
+    }
+    STORM_LOG_THROW(reader.isAtEnd(), storm::exceptions::WrongFormatException, "Unexpected data at the end of the binary DD model file.");
+    std::unordered_map<std::string, RewardModelType> rewardModels;
+    for (auto const& rewardDd : rewardDds) {
+        rewardModels.emplace(rewardDd.first, RewardModelType(std::get<0>(rewardDd.second), std::get<1>(rewardDd.second), std::get<2>(rewardDd.second)));
+    }
+
+    auto getComponent = [&components](DdRole role) -> storm::dd::Add<Type, double> const& {
+        auto componentIt = components.find(role);
+        STORM_LOG_THROW(componentIt != components.end(), storm::exceptions::WrongFormatException,
+                        "Missing DD " << static_cast<uint32_t>(role) << " in binary DD model file.");
+        return componentIt->second;
+    };
+    auto const& manager = restorer.getManager();
+    storm::dd::Add<Type, double> const& transitionMatrix = getComponent(DdRole::Transitions);
+    storm::dd::Bdd<Type> reachableStates = getComponent(DdRole::ReachableStates).notZero();
+    storm::dd::Bdd<Type> initialStates = getComponent(DdRole::InitialStates).notZero();
+    storm::dd::Bdd<Type> deadlockStates = getComponent(DdRole::DeadlockStates).notZero();
+
+    switch (header.modelType) {
+        case ModelTypeCode::Dtmc:
+            return std::make_shared<storm::models::symbolic::Dtmc<Type, double>>(manager, reachableStates, initialStates, deadlockStates, transitionMatrix,
+                                                                                 rowVariables, columnVariables, rowColumnMetaVariablePairs, labelToBddMap,
+                                                                                 rewardModels);
+        case ModelTypeCode::Ctmc:
+            return std::make_shared<storm::models::symbolic::Ctmc<Type, double>>(
+                manager, reachableStates, initialStates, deadlockStates, transitionMatrix, getComponent(DdRole::ExitRates), rowVariables, columnVariables,
+                rowColumnMetaVariablePairs, labelToBddMap, rewardModels);
+        case ModelTypeCode::Mdp:
+            return std::make_shared<storm::models::symbolic::Mdp<Type, double>>(manager, reachableStates, initialStates, deadlockStates, transitionMatrix,
+                                                                                rowVariables, columnVariables, rowColumnMetaVariablePairs,
+                                                                                nondeterminismVariables, labelToBddMap, rewardModels);
+        case ModelTypeCode::MarkovAutomaton:
+            return std::make_shared<storm::models::symbolic::MarkovAutomaton<Type, double>>(
+                manager, getComponent(DdRole::MarkovianMarker).notZero(), reachableStates, initialStates, deadlockStates, transitionMatrix, rowVariables,
+                columnVariables, rowColumnMetaVariablePairs, nondeterminismVariables, labelToBddMap, rewardModels);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                    "Unknown model type " << static_cast<uint32_t>(header.modelType) << " in binary DD model file.");
+}
+
+}  // namespace
+
+template<storm::dd::DdType Type, typename ValueType>
+std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DDEncodingParser<Type, ValueType>::parseModel(std::string const& filename) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        STORM_LOG_INFO("Reading from file " << filename);
+        return loadModel<Type>(filename);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary DD format only supports models with double values.");
+    }
+}
+
+template class DDEncodingParser<storm::dd::DdType::CUDD, double>;
+template class DDEncodingParser<storm::dd::DdType::Sylvan, double>;
+template class DDEncodingParser<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+template class DDEncodingParser<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/symbolic/Model.h"
+#include "storm/storage/dd/DdType.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Loader for symbolic models in the binary format written by storm::exporter::binaryExportSymbolicModel. The meta variables are recreated in a new
+ * DD manager in the order in which they were exported and all DDs of the model are rebuilt node by node, so the model is restored without building
+ * it again from its description.
+ */
+template<storm::dd::DdType Type, typename ValueType = double>
+class DDEncodingParser {
+   public:
+    /*!
+     * Load a symbolic model in the binary format from a file and create the model.
+     *
+     * @param filename The file to be loaded.
+     *
+     * @return A symbolic model
+     */
+    static std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> parseModel(std::string const& filename);
+};
+
+}  // namespace parser
+}  // namespace storm
@@ -1,10 +1,12 @@
 #include "storm-parsers/parser/DeterministicSparseTransitionParser.h"
 
+#include <algorithm>
 #include <clocale>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <optional>
 #include <string>
 
 #include "storm-parsers/parser/MappedFile.h"
@@ -14,8 +16,10 @@
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
 namespace storm {
@@ -23,6 +27,209 @@ namespace parser {
 
 using namespace storm::utility::cstring;
 
+namespace {
+
+// Files that are larger than this are parsed in parallel in chunks of roughly this size.
+static const uint64_t ChunkSize = 1ull << 23;
+
+/*!
+ * The information about a chunk of transitions that is gathered in the first (parallel) pass.
+ */
+struct ChunkInfo {
+    // The row and column of the first and the last transition of the chunk. Only valid if the chunk contains transitions.
+    uint_fast64_t firstRow = 0;
+    uint_fast64_t firstColumn = 0;
+    uint_fast64_t lastRow = 0;
+    uint_fast64_t lastColumn = 0;
+
+    uint_fast64_t numberOfTransitions = 0;
+    uint_fast64_t highestStateIndex = 0;
+
+    // The rows without transitions that lie between two transitions of the chunk (only collected for transition files).
+    std::vector<uint_fast64_t> skippedRows;
+
+    // False if the transitions are not ordered by row and column.
+    bool ordered = true;
+};
+
+ChunkInfo scanChunk(char const* buf, char const* end, bool collectSkippedRows) {
+    ChunkInfo info;
+    while (buf < end && buf[0] != '\0') {
+        uint_fast64_t row = checked_strtol(buf, &buf);
+        uint_fast64_t column = checked_strtol(buf, &buf);
+        checked_strtod(buf, &buf);
+
+        if (info.numberOfTransitions == 0) {
+            info.firstRow = row;
+            info.firstColumn = column;
+        } else if (row < info.lastRow || (row == info.lastRow && column <= info.lastColumn)) {
+            info.ordered = false;
+            return info;
+        } else if (collectSkippedRows) {
+            for (uint_fast64_t skippedRow = info.lastRow + 1; skippedRow < row; ++skippedRow) {
+                info.skippedRows.push_back(skippedRow);
+            }
+        }
+        info.lastRow = row;
+        info.lastColumn = column;
+        info.highestStateIndex = std::max({info.highestStateIndex, row, column});
+        ++info.numberOfTransitions;
+
+        buf = trimWhitespaces(buf);
+    }
+    return info;
+}
+
+/*!
+ * Writes the transitions of the chunk to the given (preallocated) vectors of the matrix.
+ *
+ * @param nextRow The first row whose row indication is not yet set by the previous chunks.
+ * @param entry The index of the first entry of the chunk.
+ * @param insertSelfLoops If set, a self-loop is inserted for every skipped row. Otherwise, skipped rows are empty.
+ */
+template<typename ValueType>
+void fillChunk(char const* buf, char const* end, uint_fast64_t nextRow, uint_fast64_t entry, bool insertSelfLoops, std::vector<uint_fast64_t>& rowIndications,
+               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues) {
+    while (buf < end && buf[0] != '\0') {
+        uint_fast64_t row = checked_strtol(buf, &buf);
+        uint_fast64_t column = checked_strtol(buf, &buf);
+        double value = checked_strtod(buf, &buf);
+
+        for (; nextRow <= row; ++nextRow) {
+            rowIndications[nextRow] = entry;
+            if (nextRow < row && insertSelfLoops) {
+                columnsAndValues[entry++] = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(nextRow, storm::utility::one<ValueType>());
+            }
+        }
+        columnsAndValues[entry++] = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(column, ValueType(value));
+
+        buf = trimWhitespaces(buf);
+    }
+}
+
+/*!
+ * Parses the transitions in the given buffer with two parallel passes over line aligned chunks. The first pass counts the entries of each chunk
+ * which yields (via prefix sums) the position of the entries of each chunk in the matrix. The second pass then fills the matrix.
+ *
+ * @return The parsed matrix or none if the file is not in the canonical form (the sequential parser then reports the error, if any).
+ */
+template<typename ValueType, typename MatrixValueType>
+std::optional<storm::storage::SparseMatrix<ValueType>> parseInParallel(std::string const& filename, char const* begin, char const* end, bool isRewardFile,
+                                                                       storm::storage::SparseMatrix<MatrixValueType> const& transitionMatrix) {
+#ifdef STORM_HAVE_INTELTBB
+    std::vector<char const*> boundaries = splitAtLines(begin, end, ChunkSize);
+    uint64_t numberOfChunks = boundaries.size() - 1;
+    STORM_LOG_INFO("Parsing " << filename << " in " << numberOfChunks << " chunks.");
+
+    // First pass.
+    std::vector<ChunkInfo> chunks(numberOfChunks);
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t i = range.begin(); i < range.end(); ++i) {
+            chunks[i] = scanChunk(boundaries[i], boundaries[i + 1], !isRewardFile);
+        }
+    });
+
+    // Check that the chunks fit together and compute the offsets of their entries.
+    std::vector<uint_fast64_t> entryOffsets(numberOfChunks);
+    std::vector<uint_fast64_t> deadlockStates;
+    ChunkInfo const* previous = nullptr;
+    uint_fast64_t numberOfEntries = 0;
+    uint_fast64_t highestStateIndex = 0;
+    for (uint64_t i = 0; i < numberOfChunks; ++i) {
+        ChunkInfo const& chunk = chunks[i];
+        entryOffsets[i] = numberOfEntries;
+        if (!chunk.ordered) {
+            return std::nullopt;
+        }
+        if (chunk.numberOfTransitions == 0) {
+            continue;
+        }
+        uint_fast64_t firstSkippedRow = 0;
+        if (previous) {
+            ChunkInfo const& last = *previous;
+            if (chunk.firstRow < last.lastRow || (chunk.firstRow == last.lastRow && chunk.firstColumn <= last.lastColumn)) {
+                return std::nullopt;
+            }
+            firstSkippedRow = last.lastRow + 1;
+        } else if (!isRewardFile && chunk.firstRow > 1) {
+            // The sequential parser does not support this.
+            return std::nullopt;
+        }
+        if (!isRewardFile) {
+            for (uint_fast64_t skippedRow = firstSkippedRow; skippedRow < chunk.firstRow; ++skippedRow) {
+                deadlockStates.push_back(skippedRow);
+            }
+            deadlockStates.insert(deadlockStates.end(), chunk.skippedRows.begin(), chunk.skippedRows.end());
+        }
+        numberOfEntries += chunk.numberOfTransitions;
+        highestStateIndex = std::max(highestStateIndex, chunk.highestStateIndex);
+        previous = &chunk;
+    }
+    if (!previous) {
+        return std::nullopt;
+    }
+    uint_fast64_t lastRow = previous->lastRow;
+
+    uint_fast64_t rowCount;
+    if (isRewardFile) {
+        if (highestStateIndex + 1 > transitionMatrix.getRowCount() || highestStateIndex + 1 > transitionMatrix.getColumnCount()) {
+            return std::nullopt;
+        }
+        rowCount = transitionMatrix.getRowCount();
+    } else {
+        if (lastRow != highestStateIndex) {
+            // States without outgoing transitions after the last row are not supported by the sequential parser.
+            return std::nullopt;
+        }
+        rowCount = highestStateIndex + 1;
+        bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+        for (auto state : deadlockStates) {
+            if (dontFixDeadlocks) {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": state " << state << " has no outgoing transitions.");
+            } else {
+                STORM_LOG_INFO("Warning while parsing " << filename << ": state " << state << " has no outgoing transitions. A self-loop was inserted.");
+            }
+        }
+        STORM_LOG_THROW(!dontFixDeadlocks || deadlockStates.empty(), storm::exceptions::WrongFormatException,
+                        "Some of the states do not have outgoing transitions.");
+
+        // Each deadlock state gets a self-loop, we have to shift the entries of the chunks accordingly.
+        auto deadlockIt = deadlockStates.begin();
+        uint_fast64_t insertedSelfLoops = 0;
+        for (uint64_t i = 0; i < numberOfChunks; ++i) {
+            entryOffsets[i] += insertedSelfLoops;
+            if (chunks[i].numberOfTransitions > 0) {
+                auto chunkEnd = std::upper_bound(deadlockIt, deadlockStates.end(), chunks[i].lastRow);
+                insertedSelfLoops += std::distance(deadlockIt, chunkEnd);
+                deadlockIt = chunkEnd;
+            }
+        }
+        numberOfEntries += insertedSelfLoops;
+    }
+    STORM_LOG_TRACE("First pass on " << filename << " shows " << numberOfEntries << " non-zeros.");
+
+    // Second pass. Each chunk sets the row indications of all rows up to its last row that are not set by previous chunks.
+    std::vector<uint_fast64_t> rowIndications(rowCount + 1, numberOfEntries);
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(numberOfEntries);
+    std::vector<uint_fast64_t> nextRows(numberOfChunks, 0);
+    for (uint64_t i = 1; i < numberOfChunks; ++i) {
+        nextRows[i] = chunks[i - 1].numberOfTransitions > 0 ? chunks[i - 1].lastRow + 1 : nextRows[i - 1];
+    }
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t i = range.begin(); i < range.end(); ++i) {
+            fillChunk(boundaries[i], boundaries[i + 1], nextRows[i], entryOffsets[i], !isRewardFile, rowIndications, columnsAndValues);
+        }
+    });
+
+    return storm::storage::SparseMatrix<ValueType>(rowCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return std::nullopt;
+#endif
+}
+
+}  // namespace
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<ValueType>::parseDeterministicTransitions(std::string const& filename) {
     storm::storage::SparseMatrix<ValueType> emptyMatrix;
@@ -47,6 +254,23 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     MappedFile file(filename.c_str());
     char const* buf = file.getData();
 
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && file.getDataSize() > ChunkSize) {
+        // Skip the format hint if it is there.
+        char const* begin = trimWhitespaces(buf);
+        if (begin[0] < '0' || begin[0] > '9') {
+            begin = trimWhitespaces(forwardToLineEnd(begin));
+        }
+        auto result = parseInParallel<ValueType>(filename, begin, file.getDataEnd(), isRewardFile, transitionMatrix);
+        if (result) {
+            if (isRewardFile && !result->isSubmatrixOf(transitionMatrix)) {
+                STORM_LOG_ERROR("There are rewards for non existent transitions given in the reward file.");
+                throw storm::exceptions::WrongFormatException() << "There are rewards for non existent transitions given in the reward file.";
+            }
+            return std::move(*result);
+        }
+        STORM_LOG_INFO("Parsing " << filename << " sequentially.");
+    }
+
     // Perform first pass, i.e. count entries that are not zero.
     DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass =
         DeterministicSparseTransitionParser<ValueType>::firstPass(file.getData(), !isRewardFile);
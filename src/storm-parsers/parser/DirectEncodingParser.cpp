@@ -1,11 +1,16 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <cstring>
 #include <iostream>
 #include <regex>
 #include <string>
+#include <type_traits>
 
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -22,6 +27,7 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -30,13 +36,123 @@
 namespace storm {
 namespace parser {
 
+namespace {
+
+// The approximate size (in bytes) of the chunks of the @model section that are parsed in parallel.
+static const uint64_t ChunkSize = 16ull * 1024 * 1024;
+
+// Matches the characters removed by boost::trim_left (within a line).
+static const char* const Whitespace = " \t\v\f\r";
+
+/*!
+ * Retrieves the line starting at the given position (without line breaks) and moves the position to the beginning of the next line.
+ */
+std::string_view nextLine(char const*& position, char const* end) {
+    char const* lineEnd = static_cast<char const*>(std::memchr(position, '\n', end - position));
+    if (lineEnd == nullptr) {
+        lineEnd = end;
+    }
+    std::string_view line(position, lineEnd - position);
+    position = lineEnd == end ? end : lineEnd + 1;
+    // Remove linebreaks
+    while (!line.empty() && (line.back() == '\r' || line.back() == '\n')) {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+bool startsWith(std::string_view str, std::string_view prefix) {
+    return str.substr(0, prefix.size()) == prefix;
+}
+
+std::string_view trimLeft(std::string_view str) {
+    size_t pos = str.find_first_not_of(Whitespace);
+    return pos == std::string_view::npos ? std::string_view() : str.substr(pos);
+}
+
+std::string_view trim(std::string_view str) {
+    str = trimLeft(str);
+    return str.substr(0, str.find_last_not_of(Whitespace) + 1);
+}
+
+/*!
+ * Splits off the part up to the first space from the given string.
+ */
+std::string_view nextToken(std::string_view& str) {
+    size_t posEnd = str.find(' ');
+    std::string_view token = str.substr(0, posEnd);
+    str = posEnd == std::string_view::npos ? std::string_view() : str.substr(posEnd + 1);
+    return token;
+}
+
+/*!
+ * Retrieves the beginning of the first line after the given position that declares a state (or the end, if there is none).
+ */
+char const* findNextStateDeclaration(char const* position, char const* end) {
+    while (position < end) {
+        position = static_cast<char const*>(std::memchr(position, '\n', end - position));
+        if (position == nullptr) {
+            return end;
+        }
+        ++position;
+        char const* lineStart = position;
+        while (lineStart < end && (*lineStart == ' ' || *lineStart == '\t')) {
+            ++lineStart;
+        }
+        if (end - lineStart >= 6 && std::memcmp(lineStart, "state ", 6) == 0) {
+            return position;
+        }
+    }
+    return end;
+}
+
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+struct DirectEncodingParser<ValueType, RewardModelType>::ParsedChunk {
+    // The part of the @model section covered by this chunk.
+    char const* begin;
+    char const* end;
+    uint64_t firstLineNumber;
+
+    // The id of the first state of this chunk and the line in which it is declared (if the chunk contains a state at all).
+    std::optional<uint64_t> firstState;
+    uint64_t firstStateLineNumber = 0;
+
+    // All rows are local to the chunk, i.e. the first row of the first state of the chunk is row 0.
+    std::vector<uint64_t> rowGroupStarts;
+    uint64_t numberOfRows = 0;
+    storm::storage::SparseMatrix<ValueType> transitions;
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+
+    // The (local) states and rows of each label.
+    std::unordered_map<std::string, std::vector<uint64_t>> stateLabels;
+    std::unordered_map<std::string, std::vector<uint64_t>> choiceLabels;
+
+    // The non-zero rewards for each reward model as pairs of (local) state or row and value.
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> stateRewards;
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> actionRewards;
+};
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
     // Load file
     STORM_LOG_INFO("Reading from file " << filename);
-    std::ifstream file;
-    storm::utility::openFile(filename, file);
+    MappedFile file(filename.c_str());
+    char const* position = file.getData();
+    char const* end = file.getDataEnd();
+    uint64_t lineNumber = 0;
+    auto getline = [&position, &end, &lineNumber](std::string& line) {
+        if (position >= end) {
+            line.clear();
+            return false;
+        }
+        ++lineNumber;
+        line = std::string(nextLine(position, end));
+        return true;
+    };
     std::string line;
 
     // Initialize
@@ -51,7 +167,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
 
     // Parse header
-    while (storm::utility::getline(file, line)) {
+    while (getline(line)) {
         if (line.empty() || boost::starts_with(line, "//")) {
             continue;
         }
@@ -68,7 +184,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
         } else if (line == "@parameters") {
             // Parse parameters
             STORM_LOG_THROW(!sawParameters, storm::exceptions::WrongFormatException, "Parameters declared twice");
-            storm::utility::getline(file, line);
+            getline(line);
             if (line != "") {
                 std::vector<std::string> parameters;
                 boost::split(parameters, line, boost::is_any_of(" "));
@@ -81,7 +197,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
         } else if (line == "@placeholders") {
             // Parse placeholders
-            while (storm::utility::getline(file, line)) {
+            while (getline(line)) {
                 size_t posColon = line.find(':');
                 STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException, "':' not found.");
                 std::string placeName = line.substr(0, posColon - 1);
@@ -91,7 +207,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                 STORM_LOG_TRACE("Placeholder " << placeName << " for value " << value);
                 auto ret = placeholders.insert(std::make_pair(placeName.substr(1), value));
                 STORM_LOG_THROW(ret.second, storm::exceptions::WrongFormatException, "Placeholder '$" << placeName << "' was already defined before.");
-                if (file.peek() == '@') {
+                if (position < end && *position == '@') {
                     // Next character is @ -> placeholder definitions ended
                     break;
                 }
@@ -99,16 +215,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
         } else if (line == "@reward_models") {
             // Parse reward models
             STORM_LOG_THROW(rewardModelNames.empty(), storm::exceptions::WrongFormatException, "Reward model names declared twice");
-            storm::utility::getline(file, line);
+            getline(line);
             boost::split(rewardModelNames, line, boost::is_any_of("\t "));
         } else if (line == "@nr_states") {
             // Parse no. of states
             STORM_LOG_THROW(nrStates == 0, storm::exceptions::WrongFormatException, "Number states declared twice");
-            storm::utility::getline(file, line);
+            getline(line);
             nrStates = parseNumber<size_t>(line);
         } else if (line == "@nr_choices") {
             STORM_LOG_THROW(nrChoices == 0, storm::exceptions::WrongFormatException, "Number of actions declared twice");
-            storm::utility::getline(file, line);
+            getline(line);
             nrChoices = parseNumber<size_t>(line);
         } else if (line == "@model") {
             // Parse rest of the model
@@ -118,14 +234,14 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            modelComponents = parseStates(position, end, lineNumber + 1, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
         }
     }
     // Done parsing
-    storm::utility::closeFile(file);
+    STORM_LOG_THROW(modelComponents, storm::exceptions::WrongFormatException, "No model (@model) found in file " << filename << ".");
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
@@ -133,22 +249,95 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    char const* begin, char const* end, uint64_t firstLineNumber, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
     // Initialize
     auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
+
+    // Split the model section into chunks that start at a state declaration. Only values of type double are parsed in parallel as the
+    // parsers for exact and parametric values are not thread safe.
+    std::vector<ParsedChunk> chunks;
+    bool parseInParallel = std::is_same<ValueType, double>::value && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() &&
+                           static_cast<uint64_t>(end - begin) > ChunkSize;
+#ifndef STORM_HAVE_INTELTBB
+    if (parseInParallel) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        parseInParallel = false;
+    }
+#endif
+    chunks.push_back({begin, end, firstLineNumber});
+    if (parseInParallel) {
+        while (static_cast<uint64_t>(end - chunks.back().begin) > ChunkSize) {
+            char const* chunkEnd = findNextStateDeclaration(chunks.back().begin + ChunkSize, end);
+            if (chunkEnd == end) {
+                break;
+            }
+            chunks.back().end = chunkEnd;
+            chunks.push_back({chunkEnd, end, 0});
+        }
+        STORM_LOG_INFO("Parsing the model in " << chunks.size() << " chunks.");
+    }
+
+    // Parse the chunks
+    if (chunks.size() == 1) {
+        parseChunk(chunks.front(), type, stateSize, placeholders, valueParser, options);
+    } else {
+#ifdef STORM_HAVE_INTELTBB
+        // The line numbers (for error messages) are only known after counting the lines of all previous chunks.
+        std::vector<uint64_t> numberOfLines(chunks.size());
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, chunks.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                numberOfLines[i] = std::count(chunks[i].begin, chunks[i].end, '\n');
+            }
+        });
+        for (uint64_t i = 1; i < chunks.size(); ++i) {
+            chunks[i].firstLineNumber = chunks[i - 1].firstLineNumber + numberOfLines[i - 1];
+        }
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, chunks.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                parseChunk(chunks[i], type, stateSize, placeholders, valueParser, options);
+            }
+        });
+#endif
+    }
+    STORM_LOG_TRACE("Finished parsing");
+
+    // Check that the chunks fit together and determine the size of the matrix.
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    uint64_t numberOfStateRewardModels = 0;
+    uint64_t numberOfActionRewardModels = 0;
+    for (auto const& chunk : chunks) {
+        if (!chunk.firstState) {
+            continue;
+        }
+        STORM_LOG_THROW(chunk.firstState.value() == numberOfStates, storm::exceptions::WrongFormatException,
+                        "In line " << chunk.firstStateLineNumber << " state ids are not ordered and without gaps. Expected " << numberOfStates << " but got "
+                                   << chunk.firstState.value() << ".");
+        numberOfStates += chunk.rowGroupStarts.size();
+        numberOfRows += chunk.numberOfRows;
+        numberOfEntries += chunk.transitions.getEntryCount();
+        numberOfStateRewardModels = std::max<uint64_t>(numberOfStateRewardModels, chunk.stateRewards.size());
+        numberOfActionRewardModels = std::max<uint64_t>(numberOfActionRewardModels, chunk.actionRewards.size());
+    }
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || numberOfRows == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << numberOfRows << ") does not match number of actions declared (" << nrChoices
+                                                       << ", in @nr_choices).");
+    }
+
+    // Stitch the chunks together.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, stateSize, numberOfEntries, false, nonDeterministic, 0);
     modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
-    modelComponents->observabilityClasses = std::vector<uint32_t>();
-    modelComponents->observabilityClasses->resize(stateSize);
+    modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize);
     if (options.buildChoiceLabeling) {
         modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
     }
-    std::vector<std::vector<ValueType>> stateRewards;
-    std::vector<std::vector<ValueType>> actionRewards;
     if (continuousTime) {
         modelComponents->exitRates = std::vector<ValueType>(stateSize);
         if (type == storm::models::ModelType::MarkovAutomaton) {
@@ -159,209 +348,271 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
     if (type == storm::models::ModelType::Ctmc) {
         modelComponents->rateTransitions = true;
     }
+    std::vector<std::vector<ValueType>> stateRewards(numberOfStateRewardModels);
+    std::vector<std::vector<ValueType>> actionRewards(numberOfActionRewardModels);
+
+    uint64_t stateOffset = 0;
+    uint64_t rowOffset = 0;
+    for (auto& chunk : chunks) {
+        for (uint64_t localState = 0; localState < chunk.rowGroupStarts.size(); ++localState) {
+            if (nonDeterministic) {
+                builder.newRowGroup(rowOffset + chunk.rowGroupStarts[localState]);
+            }
+            if (continuousTime) {
+                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(chunk.exitRates[localState])) {
+                    modelComponents->markovianStates.get().set(stateOffset + localState);
+                }
+                modelComponents->exitRates.get()[stateOffset + localState] = std::move(chunk.exitRates[localState]);
+            }
+        }
+        for (uint64_t localRow = 0; localRow < chunk.numberOfRows; ++localRow) {
+            for (auto const& entry : chunk.transitions.getRow(localRow)) {
+                builder.addNextValue(rowOffset + localRow, entry.getColumn(), entry.getValue());
+            }
+        }
+        if (type == storm::models::ModelType::Pomdp) {
+            std::copy(chunk.observations.begin(), chunk.observations.end(), modelComponents->observabilityClasses->begin() + stateOffset);
+        }
+        for (auto const& label : chunk.stateLabels) {
+            if (!modelComponents->stateLabeling.containsLabel(label.first)) {
+                modelComponents->stateLabeling.addLabel(label.first);
+            }
+            for (auto const& localState : label.second) {
+                modelComponents->stateLabeling.addLabelToState(label.first, stateOffset + localState);
+            }
+        }
+        for (auto const& label : chunk.choiceLabels) {
+            if (!modelComponents->choiceLabeling.value().containsLabel(label.first)) {
+                modelComponents->choiceLabeling.value().addLabel(label.first);
+            }
+            for (auto const& localRow : label.second) {
+                modelComponents->choiceLabeling.value().addLabelToChoice(label.first, rowOffset + localRow);
+            }
+        }
+        for (uint64_t i = 0; i < chunk.stateRewards.size(); ++i) {
+            for (auto& reward : chunk.stateRewards[i]) {
+                if (stateRewards[i].empty()) {
+                    stateRewards[i].resize(stateSize, storm::utility::zero<ValueType>());
+                }
+                stateRewards[i][stateOffset + reward.first] = std::move(reward.second);
+            }
+        }
+        for (uint64_t i = 0; i < chunk.actionRewards.size(); ++i) {
+            for (auto& reward : chunk.actionRewards[i]) {
+                if (actionRewards[i].empty()) {
+                    actionRewards[i].resize(numberOfRows, storm::utility::zero<ValueType>());
+                }
+                actionRewards[i][rowOffset + reward.first] = std::move(reward.second);
+            }
+        }
+        stateOffset += chunk.rowGroupStarts.size();
+        rowOffset += chunk.numberOfRows;
+        // Release the memory of the chunk.
+        chunk = ParsedChunk();
+    }
+
+    // Build transition matrix
+    modelComponents->transitionMatrix = builder.build(numberOfRows, stateSize, nonDeterministic ? stateSize : 0);
+    STORM_LOG_TRACE("Built matrix");
+
+    // Build reward models
+    uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
+    for (uint64_t i = 0; i < numRewardModels; ++i) {
+        std::string rewardModelName;
+        if (rewardModelNames.size() <= i) {
+            rewardModelName = "rew" + std::to_string(i);
+        } else {
+            rewardModelName = rewardModelNames[i];
+        }
+        std::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+        if (i < stateRewards.size() && !stateRewards[i].empty()) {
+            stateRewardVector = std::move(stateRewards[i]);
+        }
+        if (i < actionRewards.size() && !actionRewards[i].empty()) {
+            actionRewardVector = std::move(actionRewards[i]);
+        }
+        modelComponents->rewardModels.emplace(
+            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+    }
+    STORM_LOG_TRACE("Built reward models");
+    return modelComponents;
+}
+
+template<typename ValueType, typename RewardModelType>
+void DirectEncodingParser<ValueType, RewardModelType>::parseChunk(ParsedChunk& chunk, storm::models::ModelType type, size_t stateSize,
+                                                                  std::unordered_map<std::string, ValueType> const& placeholders,
+                                                                  ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options) {
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, false, 0);
+
+    // Parses rewards of the form [r1, r2, ...] and stores the non-zero ones for the given state or row.
+    auto parseRewards = [&](std::string_view rewardsStr, uint64_t index, std::vector<std::vector<std::pair<uint64_t, ValueType>>>& rewards) {
+        uint64_t rewardModelIndex = 0;
+        while (true) {
+            size_t posComma = rewardsStr.find(',');
+            auto rewardValue = parseValue(rewardsStr.substr(0, posComma), placeholders, valueParser);
+            if (!storm::utility::isZero(rewardValue)) {
+                if (rewards.size() <= rewardModelIndex) {
+                    rewards.resize(rewardModelIndex + 1);
+                }
+                rewards[rewardModelIndex].emplace_back(index, std::move(rewardValue));
+            }
+            ++rewardModelIndex;
+            if (posComma == std::string_view::npos) {
+                break;
+            }
+            rewardsStr.remove_prefix(posComma + 1);
+        }
+        // Reward models are also created if all their rewards are zero.
+        if (rewards.size() < rewardModelIndex) {
+            rewards.resize(rewardModelIndex);
+        }
+    };
 
     // Iterate over all lines
-    std::string line;
-    size_t row = 0;
-    size_t state = 0;
-    uint64_t lineNumber = 0;
-    bool firstState = true;
+    char const* position = chunk.begin;
+    uint64_t row = 0;
+    uint64_t lineNumber = chunk.firstLineNumber - 1;
     bool firstActionForState = true;
-    while (storm::utility::getline(file, line)) {
+    while (position < chunk.end) {
+        std::string_view line = nextLine(position, chunk.end);
         lineNumber++;
-        if (boost::starts_with(line, "//")) {
+        if (startsWith(line, "//")) {
             continue;
         }
         if (line.empty()) {
             continue;
         }
         STORM_LOG_TRACE("Parsing line no " << lineNumber << " : " << line);
-        boost::trim_left(line);
-        if (boost::starts_with(line, "state ")) {
+        line = trimLeft(line);
+        if (startsWith(line, "state ")) {
             // New state
-            if (firstState) {
-                firstState = false;
-            } else {
-                ++state;
+            uint64_t localState = chunk.rowGroupStarts.size();
+            if (localState > 0) {
                 ++row;
             }
+            chunk.rowGroupStarts.push_back(row);
             firstActionForState = true;
-            STORM_LOG_TRACE("New state " << state);
-            STORM_LOG_THROW(state <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
 
             // Parse state id
-            line = line.substr(6);  // Remove "state "
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
+            line.remove_prefix(6);  // Remove "state "
+            uint64_t parsedId = parseNumberFromChars<uint64_t>(nextToken(line));
+            if (localState == 0) {
+                chunk.firstState = parsedId;
+                chunk.firstStateLineNumber = lineNumber;
             } else {
-                line = "";
-            }
-            size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
-            if (nonDeterministic) {
-                STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                builder.newRowGroup(row);
-                STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() <= nrChoices, storm::exceptions::WrongFormatException,
-                                "More actions detected than declared (in @nr_choices).");
+                STORM_LOG_THROW(parsedId == chunk.firstState.value() + localState, storm::exceptions::WrongFormatException,
+                                "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << chunk.firstState.value() + localState
+                                           << " but got " << parsedId << ".");
             }
+            STORM_LOG_TRACE("New state " << parsedId);
+            STORM_LOG_THROW(parsedId < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
 
             if (continuousTime) {
                 // Parse exit rate for CTMC or MA
-                STORM_LOG_THROW(boost::starts_with(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
-                line = line.substr(1);  // Remove "!"
-                curString = line;
-                posEnd = line.find(" ");
-                if (posEnd != std::string::npos) {
-                    curString = line.substr(0, posEnd);
-                    line = line.substr(posEnd + 1);
-                } else {
-                    line = "";
-                }
-                ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
-                }
+                STORM_LOG_THROW(startsWith(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
+                line.remove_prefix(1);  // Remove "!"
+                ValueType exitRate = parseValue(nextToken(line), placeholders, valueParser);
                 STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
+                chunk.exitRates.push_back(std::move(exitRate));
             }
 
-            if (boost::starts_with(line, "[")) {
+            if (startsWith(line, "[")) {
                 // Parse rewards
                 size_t posEndReward = line.find(']');
                 STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing in line " << lineNumber << " .");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("State rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
-                }
-                auto stateRewardsIt = stateRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                        }
-                        (*stateRewardsIt)[state] = std::move(rewardValue);
-                    }
-                    ++stateRewardsIt;
-                }
-                line = line.substr(posEndReward + 1);
+                STORM_LOG_TRACE("State rewards: " << line.substr(1, posEndReward - 1));
+                parseRewards(line.substr(1, posEndReward - 1), localState, chunk.stateRewards);
+                line.remove_prefix(posEndReward + 1);
             }
 
             if (type == storm::models::ModelType::Pomdp) {
-                if (boost::starts_with(line, "{")) {
+                if (startsWith(line, "{")) {
                     size_t posEndObservation = line.find("}");
-                    std::string observation = line.substr(1, posEndObservation - 1);
+                    std::string_view observation = trim(line.substr(1, posEndObservation - 1));
                     STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.value()[state] = std::stoi(observation);
-                    line = line.substr(posEndObservation + 1);
+                    chunk.observations.push_back(parseNumberFromChars<uint32_t>(observation));
+                    line.remove_prefix(std::min(posEndObservation + 1, line.size()));
                 } else {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << " in line " << lineNumber);
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                                    "Expected an observation for state " << parsedId << " in line " << lineNumber);
                 }
             }
 
             // Parse labels
             if (!line.empty()) {
-                std::vector<std::string> labels;
-                // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                // Regex for labels with two cases:
-                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
-                //   (?=(\s|$|\"))
-                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
-                // Iterate over matches
-                auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
-                auto match_end = std::sregex_iterator();
-                for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
-                    std::smatch match = *i;
-                    // Find matched group and add as label
-                    if (match.length(1) > 0) {
-                        labels.push_back(match.str(1));
-                    } else {
-                        labels.push_back(match.str(3));
+                std::vector<std::string_view> labels;
+                if (line.find('"') == std::string_view::npos) {
+                    // Labels are separated by whitespace
+                    for (line = trimLeft(line); !line.empty(); line = trimLeft(line)) {
+                        size_t posEnd = line.find_first_of(Whitespace);
+                        labels.push_back(line.substr(0, posEnd));
+                        line = posEnd == std::string_view::npos ? std::string_view() : line.substr(posEnd);
+                    }
+                } else {
+                    // Labels are separated by whitespace and can optionally be enclosed in quotation marks
+                    // Regex for labels with two cases:
+                    // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
+                    //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
+                    //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
+                    //   (?=(\s|$|\"))
+                    // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
+                    //   - First part matches string without whitespace and quotation marks [^\s\"]+?
+                    //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
+                    static const std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
+
+                    // Iterate over matches
+                    auto match_begin = std::cregex_iterator(line.data(), line.data() + line.size(), labelRegex);
+                    auto match_end = std::cregex_iterator();
+                    for (std::cregex_iterator i = match_begin; i != match_end; ++i) {
+                        std::cmatch match = *i;
+                        // Find matched group and add as label
+                        if (match.length(1) > 0) {
+                            labels.emplace_back(match[1].first, match.length(1));
+                        } else {
+                            labels.emplace_back(match[3].first, match.length(3));
+                        }
                     }
                 }
 
-                for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
-                    }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
+                for (auto const& label : labels) {
+                    chunk.stateLabels[std::string(label)].push_back(localState);
                     STORM_LOG_TRACE("New label: '" << label << "'");
                 }
             }
-        } else if (boost::starts_with(line, "action ")) {
+        } else if (startsWith(line, "action ")) {
             // New action
+            STORM_LOG_THROW(!chunk.rowGroupStarts.empty(), storm::exceptions::WrongFormatException, "Action before first state in line " << lineNumber << ".");
             if (firstActionForState) {
                 firstActionForState = false;
             } else {
                 ++row;
             }
             STORM_LOG_TRACE("New action: " << row);
-            line = line.substr(7);
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
-            }
-
-            // curString contains action name.
-            if (options.buildChoiceLabeling) {
-                if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.value().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.value().addLabel(curString);
-                    }
-                    modelComponents->choiceLabeling.value().addLabelToChoice(curString, row);
-                }
+            line.remove_prefix(7);
+            std::string_view actionName = nextToken(line);
+            if (options.buildChoiceLabeling && actionName != "__NOLABEL__") {
+                chunk.choiceLabels[std::string(actionName)].push_back(row);
             }
             // Check for rewards
-            if (boost::starts_with(line, "[")) {
+            if (startsWith(line, "[")) {
                 // Rewards found
                 size_t posEndReward = line.find(']');
                 STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("Action rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
-                }
-                auto actionRewardsIt = actionRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                        }
-                        (*actionRewardsIt)[row] = std::move(rewardValue);
-                    }
-                    ++actionRewardsIt;
-                }
-                line = line.substr(posEndReward + 1);
+                STORM_LOG_TRACE("Action rewards: " << line.substr(1, posEndReward - 1));
+                parseRewards(line.substr(1, posEndReward - 1), row, chunk.actionRewards);
+                line.remove_prefix(posEndReward + 1);
             }
 
         } else {
             // New transition
+            STORM_LOG_THROW(!chunk.rowGroupStarts.empty(), storm::exceptions::WrongFormatException,
+                            "Transition before first state in line " << lineNumber << ".");
             size_t posColon = line.find(':');
             STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
                             "':' not found in '" << line << "' on line " << lineNumber << ".");
-            size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
-            std::string valueStr = line.substr(posColon + 2);
-            ValueType value = parseValue(valueStr, placeholders, valueParser);
+            uint64_t target = parseNumberFromChars<uint64_t>(trim(line.substr(0, posColon)));
+            ValueType value = parseValue(line.substr(posColon + 1), placeholders, valueParser);
             STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
             STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
                             "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
@@ -369,59 +620,31 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         }
 
         if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
+            std::cout << "Parsed " << chunk.rowGroupStarts.size() << "/" << stateSize << " states before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
             break;
         }
 
     }  // end state iteration
-    STORM_LOG_TRACE("Finished parsing");
 
-    if (nonDeterministic) {
-        STORM_LOG_THROW(nrChoices == 0 || builder.getLastRow() + 1 == nrChoices, storm::exceptions::WrongFormatException,
-                        "Number of actions detected (at least " << builder.getLastRow() + 1 << ") does not match number of actions declared (" << nrChoices
-                                                                << ", in @nr_choices).");
-    }
-
-    // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-    STORM_LOG_TRACE("Built matrix");
-
-    // Build reward models
-    uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
-    for (uint64_t i = 0; i < numRewardModels; ++i) {
-        std::string rewardModelName;
-        if (rewardModelNames.size() <= i) {
-            rewardModelName = "rew" + std::to_string(i);
-        } else {
-            rewardModelName = rewardModelNames[i];
-        }
-        std::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
-        if (i < stateRewards.size() && !stateRewards[i].empty()) {
-            stateRewardVector = std::move(stateRewards[i]);
-        }
-        if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
-            actionRewardVector = std::move(actionRewards[i]);
-        }
-        modelComponents->rewardModels.emplace(
-            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
-    }
-    STORM_LOG_TRACE("Built reward models");
-    return modelComponents;
+    chunk.numberOfRows = chunk.rowGroupStarts.empty() ? 0 : row + 1;
+    chunk.transitions = builder.build(chunk.numberOfRows, stateSize);
 }
 
 template<typename ValueType, typename RewardModelType>
-ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
+ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string_view valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
                                                                        ValueParser<ValueType> const& valueParser) {
-    if (boost::starts_with(valueStr, "$")) {
-        auto it = placeholders.find(valueStr.substr(1));
+    valueStr = trim(valueStr);
+    if (startsWith(valueStr, "$")) {
+        auto it = placeholders.find(std::string(valueStr.substr(1)));
         STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << valueStr << " unknown.");
         return it->second;
+    } else if constexpr (std::is_same<ValueType, double>::value) {
+        return parseNumberFromChars<double>(valueStr);
     } else {
         // Use default value parser
-        return valueParser.parseValue(valueStr);
+        return valueParser.parseValue(std::string(valueStr));
     }
 }
 
@@ -1,6 +1,8 @@
 #ifndef STORM_PARSER_DIRECTENCODINGPARSER_H_
 #define STORM_PARSER_DIRECTENCODINGPARSER_H_
 
+#include <string_view>
+
 #include "storm-parsers/parser/ValueParser.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -29,10 +31,17 @@ class DirectEncodingParser {
         std::string const& fil, DirectEncodingParserOptions const& options = DirectEncodingParserOptions());
 
    private:
+    /*!
+     * The components of the model that are parsed from a chunk of consecutive states.
+     */
+    struct ParsedChunk;
+
     /*!
      * Parse states and return transition matrix.
      *
-     * @param file Input file stream.
+     * @param begin Beginning of the @model section (i.e. the first character after the @model line).
+     * @param end End of the @model section.
+     * @param firstLineNumber The line number of the first line of the @model section.
      * @param type Model type.
      * @param stateSize No. of states
      * @param placeholders Placeholders for values.
@@ -42,8 +51,21 @@ class DirectEncodingParser {
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        char const* begin, char const* end, uint64_t firstLineNumber, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+    /*!
+     * Parse the states of the given chunk. Chunks start at a state declaration, so they can be parsed independently of each other.
+     *
+     * @param chunk The chunk to parse. Its range and first line number have to be set.
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     */
+    static void parseChunk(ParsedChunk& chunk, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+                           ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options);
 
     /*!
      * Parse value from string while using placeholders.
@@ -52,7 +74,7 @@ class DirectEncodingParser {
      * @param valueParser Value parser.
      * @return
      */
-    static ValueType parseValue(std::string const& valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
+    static ValueType parseValue(std::string_view valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
                                 ValueParser<ValueType> const& valueParser);
 };
 
@@ -23,6 +23,22 @@ ExpressionCreator::~ExpressionCreator() {
     }
 }
 
+storm::expressions::Expression const& ExpressionCreator::getBooleanLiteral(bool value) const {
+    storm::expressions::Expression& literal = value ? trueLiteral : falseLiteral;
+    if (!literal.isInitialized()) {
+        literal = manager.boolean(value);
+    }
+    return literal;
+}
+
+storm::expressions::Expression const& ExpressionCreator::getIntegerLiteral(int64_t value) const {
+    auto literalIt = integerLiterals.find(value);
+    if (literalIt == integerLiterals.end()) {
+        literalIt = integerLiterals.emplace(value, manager.integer(value)).first;
+    }
+    return literalIt->second;
+}
+
 storm::expressions::Expression ExpressionCreator::createIteExpression(storm::expressions::Expression const& e1, storm::expressions::Expression const& e2,
                                                                       storm::expressions::Expression const& e3, bool& pass) const {
     if (this->createExpressions) {
@@ -32,7 +48,7 @@ storm::expressions::Expression ExpressionCreator::createIteExpression(storm::exp
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createOrExpression(storm::expressions::Expression const& e1,
@@ -55,7 +71,7 @@ storm::expressions::Expression ExpressionCreator::createOrExpression(storm::expr
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createAndExpression(storm::expressions::Expression const& e1,
@@ -77,7 +93,7 @@ storm::expressions::Expression ExpressionCreator::createAndExpression(storm::exp
         }
         return result;
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createRelationalExpression(storm::expressions::Expression const& e1,
@@ -106,7 +122,7 @@ storm::expressions::Expression ExpressionCreator::createRelationalExpression(sto
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createEqualsExpression(storm::expressions::Expression const& e1,
@@ -129,7 +145,7 @@ storm::expressions::Expression ExpressionCreator::createEqualsExpression(storm::
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createPlusExpression(storm::expressions::Expression const& e1,
@@ -152,7 +168,7 @@ storm::expressions::Expression ExpressionCreator::createPlusExpression(storm::ex
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createMultExpression(storm::expressions::Expression const& e1,
@@ -175,7 +191,7 @@ storm::expressions::Expression ExpressionCreator::createMultExpression(storm::ex
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createPowerModuloExpression(storm::expressions::Expression const& e1,
@@ -198,7 +214,7 @@ storm::expressions::Expression ExpressionCreator::createPowerModuloExpression(st
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createUnaryExpression(std::vector<storm::expressions::OperatorType> const& operatorTypes,
@@ -224,7 +240,7 @@ storm::expressions::Expression ExpressionCreator::createUnaryExpression(std::vec
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createRationalLiteralExpression(storm::RationalNumber const& value, bool& pass) const {
@@ -236,23 +252,23 @@ storm::expressions::Expression ExpressionCreator::createRationalLiteralExpressio
     if (this->createExpressions) {
         return manager.rational(value);
     } else {
-        return manager.boolean(false);
+        return getBooleanLiteral(false);
     }
 }
 
 storm::expressions::Expression ExpressionCreator::createIntegerLiteralExpression(int64_t value, bool&) const {
     if (this->createExpressions) {
-        return manager.integer(value);
+        return getIntegerLiteral(value);
     } else {
-        return manager.boolean(false);
+        return getBooleanLiteral(false);
     }
 }
 
 storm::expressions::Expression ExpressionCreator::createBooleanLiteralExpression(bool value, bool&) const {
     if (this->createExpressions) {
-        return manager.boolean(value);
+        return getBooleanLiteral(value);
     } else {
-        return manager.boolean(false);
+        return getBooleanLiteral(false);
     }
 }
 
@@ -276,7 +292,7 @@ storm::expressions::Expression ExpressionCreator::createMinimumMaximumExpression
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createFloorCeilExpression(storm::expressions::OperatorType const& operatorType,
@@ -298,7 +314,7 @@ storm::expressions::Expression ExpressionCreator::createFloorCeilExpression(stor
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createRoundExpression(storm::expressions::Expression const& e1, bool& pass) const {
@@ -309,7 +325,7 @@ storm::expressions::Expression ExpressionCreator::createRoundExpression(storm::e
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::createPredicateExpression(storm::expressions::OperatorType const& opTyp,
@@ -330,7 +346,7 @@ storm::expressions::Expression ExpressionCreator::createPredicateExpression(stor
             pass = false;
         }
     }
-    return manager.boolean(false);
+    return getBooleanLiteral(false);
 }
 
 storm::expressions::Expression ExpressionCreator::getIdentifierExpression(std::string const& identifier, bool& pass) const {
@@ -340,11 +356,11 @@ storm::expressions::Expression ExpressionCreator::getIdentifierExpression(std::s
         storm::expressions::Expression const* expression = this->identifiers->find(identifier);
         if (expression == nullptr) {
             pass = false;
-            return manager.boolean(false);
+            return getBooleanLiteral(false);
         }
         return *expression;
     } else {
-        return manager.boolean(false);
+        return getBooleanLiteral(false);
     }
 }
 
@@ -1,10 +1,12 @@
 #pragma once
 #include <memory>
+#include <unordered_map>
 // Very ugly, but currently we would like to have the symbol table here.
 #include "storm-parsers/parser/SpiritParserDefinitions.h"
 
 #include <boost/optional.hpp>
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/Expression.h"
 
 namespace storm {
 
@@ -86,6 +88,13 @@ class ExpressionCreator {
                                                              std::vector<storm::expressions::Expression> const& operands, bool& pass) const;
 
    private:
+    /*!
+     * Retrieves the literal with the given value. Literals are shared among all parsed expressions instead of allocating a new expression for
+     * every occurrence, which matters for large generated models.
+     */
+    storm::expressions::Expression const& getBooleanLiteral(bool value) const;
+    storm::expressions::Expression const& getIntegerLiteral(int64_t value) const;
+
     // The manager responsible for the expressions.
     storm::expressions::ExpressionManager const& manager;
     qi::symbols<char, storm::expressions::Expression> const* identifiers = nullptr;
@@ -95,6 +104,11 @@ class ExpressionCreator {
     bool acceptDoubleLiterals = true;
 
     bool deleteIdentifierMapping = false;
+
+    // The literals that were created so far.
+    mutable storm::expressions::Expression trueLiteral;
+    mutable storm::expressions::Expression falseLiteral;
+    mutable std::unordered_map<int64_t, storm::expressions::Expression> integerLiterals;
 };
 }  // namespace parser
 }  // namespace storm
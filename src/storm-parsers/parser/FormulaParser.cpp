@@ -12,6 +12,7 @@
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "FormulaParserGrammar.h"
+#include "storm/io/CompressedInputFile.h"
 #include "storm/io/file.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -60,24 +61,12 @@ std::shared_ptr<storm::logic::Formula const> FormulaParser::parseSingleFormulaFr
 }
 
 std::vector<storm::jani::Property> FormulaParser::parseFromFile(std::string const& filename) const {
-    // Open file and initialize result.
-    std::ifstream inputFileStream;
-    storm::utility::openFile(filename, inputFileStream);
+    // Open the possibly compressed file and initialize result.
+    storm::utility::InputFileStream inputFileStream(filename);
 
-    std::vector<storm::jani::Property> properties;
-
-    // Now try to parse the contents of the file.
-    try {
-        std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
-        properties = parseFromString(fileContent);
-    } catch (std::exception& e) {
-        // In case of an exception properly close the file before passing exception.
-        storm::utility::closeFile(inputFileStream);
-        throw e;
-    }
-
-    // Close the stream in case everything went smoothly and return result.
-    storm::utility::closeFile(inputFileStream);
+    // Now parse the contents of the file. The file is closed once the stream is destroyed.
+    std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
+    std::vector<storm::jani::Property> properties = parseFromString(fileContent);
     return properties;
 }
 
@@ -1,5 +1,6 @@
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
+#include "storm/io/CompressedInputFile.h"
 #include "storm/io/file.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
@@ -244,8 +245,7 @@ storm::storage::sparse::ModelComponents<ValueType> ImcaParserGrammar<ValueType,
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> ImcaMarkovAutomatonParser<ValueType>::parseImcaFile(std::string const& filename) {
     // Open file and initialize result.
-    std::ifstream inputFileStream;
-    storm::utility::openFile(filename, inputFileStream);
+    storm::utility::InputFileStream inputFileStream(filename);
 
     storm::storage::sparse::ModelComponents<ValueType> components;
 
@@ -264,16 +264,8 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> ImcaMarkovAut
         STORM_LOG_DEBUG("Parsed imca file successfully.");
     } catch (qi::expectation_failure<PositionIteratorType> const& e) {
         STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, e.what_);
-        storm::utility::closeFile(inputFileStream);
-    } catch (std::exception& e) {
-        // In case of an exception properly close the file before passing exception.
-        storm::utility::closeFile(inputFileStream);
-        throw e;
     }
 
-    // Close the stream in case everything went smoothly
-    storm::utility::closeFile(inputFileStream);
-
     // Build the model from the obtained model components
     return storm::utility::builder::buildModelFromComponents(storm::models::ModelType::MarkovAutomaton, std::move(components))
         ->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
@@ -34,6 +34,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "storm/io/CompressedInputFile.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
 
@@ -51,8 +52,8 @@ const std::set<std::string> JaniParser<ValueType>::unsupportedOpstrings({"sin",
                                                                          "atan", "acot", "asec",  "acsc",  "sinh",  "cosh",  "tanh", "coth",
                                                                          "sech", "csch", "asinh", "acosh", "atanh", "asinh", "acosh"});
 
-template<typename ValueType>
-std::string getString(typename JaniParser<ValueType>::Json const& structure, std::string const& errorInfo) {
+template<typename ValueType, typename ErrorInfo>
+std::string getString(typename JaniParser<ValueType>::Json const& structure, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(structure.is_string(), storm::exceptions::InvalidJaniException,
                     "Expected a string in " << errorInfo << ", got '" << structure.dump() << "'");
     return structure.front();
@@ -101,10 +102,8 @@ JaniParser<ValueType>::JaniParser(std::string const& jsonstring) : expressionMan
 
 template<typename ValueType>
 void JaniParser<ValueType>::readFile(std::string const& path) {
-    std::ifstream file;
-    storm::utility::openFile(path, file);
+    storm::utility::InputFileStream file(path);
     parsedStructure << file;
-    storm::utility::closeFile(file);
 }
 
 template<typename ValueType>
@@ -193,7 +192,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
         for (auto const& funDef : dummyFunctionDefinitions) {
             bool unused = globalFuns.emplace(funDef.getName(), &funDef).second;
             STORM_LOG_THROW(unused, storm::exceptions::InvalidJaniException,
-                            "Multiple definitions of functions with the name " << funDef.getName() << " in " << scope.description);
+                            "Multiple definitions of functions with the name " << funDef.getName() << " in " << scope.getDescription());
         }
         for (auto const& funStructure : parsedStructure.at("functions")) {
             // Actually parse the function body
@@ -252,7 +251,7 @@ std::vector<std::shared_ptr<storm::logic::Formula const>> JaniParser<ValueType>:
                                                                                                            storm::logic::FormulaContext formulaContext,
                                                                                                            std::string const& opstring, Scope const& scope) {
     STORM_LOG_THROW(propertyStructure.count("exp") == 1, storm::exceptions::InvalidJaniException,
-                    "Expecting operand for operator " << opstring << " in " << scope.description);
+                    "Expecting operand for operator " << opstring << " in " << scope.getDescription());
     return {parseFormula(model, propertyStructure.at("exp"), formulaContext, scope.refine("Operand of operator " + opstring))};
 }
 
@@ -262,9 +261,9 @@ std::vector<std::shared_ptr<storm::logic::Formula const>> JaniParser<ValueType>:
                                                                                                              storm::logic::FormulaContext formulaContext,
                                                                                                              std::string const& opstring, Scope const& scope) {
     STORM_LOG_THROW(propertyStructure.count("left") == 1, storm::exceptions::InvalidJaniException,
-                    "Expecting left operand for operator " << opstring << " in " << scope.description);
+                    "Expecting left operand for operator " << opstring << " in " << scope.getDescription());
     STORM_LOG_THROW(propertyStructure.count("right") == 1, storm::exceptions::InvalidJaniException,
-                    "Expecting right operand for operator " << opstring << " in " << scope.description);
+                    "Expecting right operand for operator " << opstring << " in " << scope.getDescription());
     return {parseFormula(model, propertyStructure.at("left"), formulaContext, scope.refine("Operand of operator " + opstring)),
             parseFormula(model, propertyStructure.at("right"), formulaContext, scope.refine("Operand of operator " + opstring))};
 }
@@ -367,14 +366,14 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
 
         } else if (opString == "∀" || opString == "∃") {
             assert(bound == boost::none);
-            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Forall and Exists are currently not supported in " << scope.description);
+            STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Forall and Exists are currently not supported in " << scope.getDescription());
         } else if (opString == "Emin" || opString == "Emax") {
-            STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Model not compliant: Contains Emin/Emax property in " << scope.description << ".");
+            STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Model not compliant: Contains Emin/Emax property in " << scope.getDescription() << ".");
             STORM_LOG_THROW(propertyStructure.count("exp") == 1, storm::exceptions::InvalidJaniException,
-                            "Expecting reward-expression for operator " << opString << " in " << scope.description);
+                            "Expecting reward-expression for operator " << opString << " in " << scope.getDescription());
             storm::expressions::Expression rewExpr = parseExpression(propertyStructure.at("exp"), scope.refine("Reward expression"));
             STORM_LOG_THROW(rewExpr.hasNumericalType(), storm::exceptions::InvalidJaniException,
-                            "Reward expression '" << rewExpr << "' does not have numerical type in " << scope.description);
+                            "Reward expression '" << rewExpr << "' does not have numerical type in " << scope.getDescription());
             std::string rewardName = rewExpr.toString();
 
             storm::logic::OperatorInformation opInfo;
@@ -383,15 +382,15 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
 
             storm::logic::RewardAccumulation rewardAccumulation(false, false, false);
             if (propertyStructure.count("accumulate") > 0) {
-                rewardAccumulation = parseRewardAccumulation(propertyStructure.at("accumulate"), scope.description);
+                rewardAccumulation = parseRewardAccumulation(propertyStructure.at("accumulate"), scope.getDescription());
             }
 
             bool time = false;
             if (propertyStructure.count("step-instant") > 0) {
                 STORM_LOG_THROW(propertyStructure.count("time-instant") == 0, storm::exceptions::NotSupportedException,
-                                "Storm does not support to have a step-instant and a time-instant in " + scope.description);
+                                "Storm does not support to have a step-instant and a time-instant in " + scope.getDescription());
                 STORM_LOG_THROW(propertyStructure.count("reward-instants") == 0, storm::exceptions::NotSupportedException,
-                                "Storm does not support to have a step-instant and a reward-instant in " + scope.description);
+                                "Storm does not support to have a step-instant and a reward-instant in " + scope.getDescription());
 
                 storm::expressions::Expression stepInstantExpr = parseExpression(propertyStructure.at("step-instant"), scope.refine("Step instant"));
                 if (!rewExpr.isVariable()) {
@@ -409,7 +408,7 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
                 }
             } else if (propertyStructure.count("time-instant") > 0) {
                 STORM_LOG_THROW(propertyStructure.count("reward-instants") == 0, storm::exceptions::NotSupportedException,
-                                "Storm does not support to have a time-instant and a reward-instant in " + scope.description);
+                                "Storm does not support to have a time-instant and a reward-instant in " + scope.getDescription());
                 storm::expressions::Expression timeInstantExpr = parseExpression(propertyStructure.at("time-instant"), scope.refine("time instant"));
                 if (!rewExpr.isVariable()) {
                     model.addNonTrivialRewardExpression(rewardName, rewExpr);
@@ -431,8 +430,8 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
                     storm::expressions::Expression rewInstRewardModelExpression =
                         parseExpression(rewInst.at("exp"), scope.refine("Reward expression at reward instant"));
                     STORM_LOG_THROW(rewInstRewardModelExpression.hasNumericalType(), storm::exceptions::InvalidJaniException,
-                                    "Reward expression '" << rewInstRewardModelExpression << "' does not have numerical type in " << scope.description);
-                    storm::logic::RewardAccumulation boundRewardAccumulation = parseRewardAccumulation(rewInst.at("accumulate"), scope.description);
+                                    "Reward expression '" << rewInstRewardModelExpression << "' does not have numerical type in " << scope.getDescription());
+                    storm::logic::RewardAccumulation boundRewardAccumulation = parseRewardAccumulation(rewInst.at("accumulate"), scope.getDescription());
                     bool steps = (boundRewardAccumulation.isStepsSet() || boundRewardAccumulation.isExitSet()) && boundRewardAccumulation.size() == 1;
                     bool time = boundRewardAccumulation.isTimeSet() && boundRewardAccumulation.size() == 1 && !model.isDiscreteTimeModel();
                     if ((steps || time) && !rewInstRewardModelExpression.containsVariables() &&
@@ -481,21 +480,21 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
             // Reward accumulation is optional as it was not available in the early days...
             boost::optional<storm::logic::RewardAccumulation> rewardAccumulation;
             if (propertyStructure.count("accumulate") > 0) {
-                STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Unexpected accumulate field in " << scope.description << ".");
-                rewardAccumulation = parseRewardAccumulation(propertyStructure.at("accumulate"), scope.description);
+                STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Unexpected accumulate field in " << scope.getDescription() << ".");
+                rewardAccumulation = parseRewardAccumulation(propertyStructure.at("accumulate"), scope.getDescription());
             }
             STORM_LOG_THROW(propertyStructure.count("exp") > 0, storm::exceptions::InvalidJaniException,
-                            "Expected an expression at steady state property at " << scope.description);
+                            "Expected an expression at steady state property at " << scope.getDescription());
             auto exp = parseExpression(propertyStructure["exp"], scope.refine("steady-state operator"), true);
             if (!exp.isInitialized() || exp.hasBooleanType()) {
                 STORM_LOG_THROW(!rewardAccumulation.is_initialized(), storm::exceptions::InvalidJaniException,
-                                "Long-run average probabilities are not allowed to have a reward accumulation at" << scope.description);
+                                "Long-run average probabilities are not allowed to have a reward accumulation at" << scope.getDescription());
                 std::shared_ptr<storm::logic::Formula const> subformula =
                     parseUnaryFormulaArgument(model, propertyStructure, formulaContext, opString, scope.refine("Steady-state operator"))[0];
                 return std::make_shared<storm::logic::LongRunAverageOperatorFormula>(subformula, opInfo);
             }
             STORM_LOG_THROW(exp.hasNumericalType(), storm::exceptions::InvalidJaniException,
-                            "Reward expression '" << exp << "' does not have numerical type in " << scope.description);
+                            "Reward expression '" << exp << "' does not have numerical type in " << scope.getDescription());
             std::string rewardName = exp.toString();
             if (!exp.isVariable()) {
                 model.addNonTrivialRewardExpression(rewardName, exp);
@@ -518,14 +517,14 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
             std::vector<boost::optional<storm::logic::TimeBound>> lowerBounds, upperBounds;
             std::vector<storm::logic::TimeBoundReference> tbReferences;
             if (propertyStructure.count("step-bounds") > 0) {
-                STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Jani model not compliant: Contains step-bounds in " << scope.description << ".");
+                STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Jani model not compliant: Contains step-bounds in " << scope.getDescription() << ".");
                 storm::jani::PropertyInterval pi =
                     parsePropertyInterval(propertyStructure.at("step-bounds"), scope.refine("step-bounded until").clearVariables());
                 insertLowerUpperTimeBounds(lowerBounds, upperBounds, pi);
                 tbReferences.emplace_back(storm::logic::TimeBoundType::Steps);
             }
             if (propertyStructure.count("time-bounds") > 0) {
-                STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Jani model not compliant: Contains time-bounds in " << scope.description << ".");
+                STORM_LOG_WARN_COND(model.getJaniVersion() == 1, "Jani model not compliant: Contains time-bounds in " << scope.getDescription() << ".");
                 storm::jani::PropertyInterval pi =
                     parsePropertyInterval(propertyStructure.at("time-bounds"), scope.refine("time-bounded until").clearVariables());
                 insertLowerUpperTimeBounds(lowerBounds, upperBounds, pi);
@@ -536,12 +535,12 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
                     storm::jani::PropertyInterval pi = parsePropertyInterval(rbStructure.at("bounds"), scope.refine("reward-bounded until").clearVariables());
                     insertLowerUpperTimeBounds(lowerBounds, upperBounds, pi);
                     STORM_LOG_THROW(rbStructure.count("exp") == 1, storm::exceptions::InvalidJaniException,
-                                    "Expecting reward-expression for operator " << opString << " in " << scope.description);
+                                    "Expecting reward-expression for operator " << opString << " in " << scope.getDescription());
                     storm::expressions::Expression rewInstRewardModelExpression =
                         parseExpression(rbStructure.at("exp"), scope.refine("Reward expression at reward-bounds"));
                     STORM_LOG_THROW(rewInstRewardModelExpression.hasNumericalType(), storm::exceptions::InvalidJaniException,
-                                    "Reward expression '" << rewInstRewardModelExpression << "' does not have numerical type in " << scope.description);
-                    storm::logic::RewardAccumulation boundRewardAccumulation = parseRewardAccumulation(rbStructure.at("accumulate"), scope.description);
+                                    "Reward expression '" << rewInstRewardModelExpression << "' does not have numerical type in " << scope.getDescription());
+                    storm::logic::RewardAccumulation boundRewardAccumulation = parseRewardAccumulation(rbStructure.at("accumulate"), scope.getDescription());
                     bool steps = (boundRewardAccumulation.isStepsSet() || boundRewardAccumulation.isExitSet()) && boundRewardAccumulation.size() == 1;
                     bool time = boundRewardAccumulation.isTimeSet() && boundRewardAccumulation.size() == 1 && !model.isDiscreteTimeModel();
                     if ((steps || time) && !rewInstRewardModelExpression.containsVariables() &&
@@ -645,7 +644,8 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
                             } else {
                                 STORM_LOG_THROW(
                                     false, storm::exceptions::NotSupportedException,
-                                    "Comparison operators '=' or '≠' in property specifications are currently not supported in " << scope.description << ".");
+                                    "Comparison operators '=' or '≠' in property specifications are currently not supported in "
+                                        << scope.getDescription() << ".");
                             }
                         }
                         return parseFormula(model, propertyStructure.at(leftRight[i]), formulaContext, scope, storm::logic::Bound(ct, boundExpr));
@@ -656,7 +656,7 @@ std::shared_ptr<storm::logic::Formula const> JaniParser<ValueType>::parseFormula
         } else if (expr.isInitialized()) {
             STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
                             "Non-trivial Expression '" << expr << "' contains a boolean transient variable. Can not translate to PRCTL-like formula at "
-                                                       << scope.description << ".");
+                                                       << scope.getDescription() << ".");
         } else {
             STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException, "Unknown operator " << opString);
         }
@@ -737,22 +737,22 @@ storm::jani::Property JaniParser<ValueType>::parseProperty(storm::jani::Model& m
 template<typename ValueType>
 std::shared_ptr<storm::jani::Constant> JaniParser<ValueType>::parseConstant(Json const& constantStructure, Scope const& scope) {
     STORM_LOG_THROW(constantStructure.count("name") == 1, storm::exceptions::InvalidJaniException,
-                    "Variable (scope: " + scope.description + ") must have a name");
-    std::string name = getString<ValueType>(constantStructure.at("name"), "variable-name in " + scope.description + "-scope");
+                    "Variable (scope: " + scope.getDescription() + ") must have a name");
+    std::string name = getString<ValueType>(constantStructure.at("name"), "variable-name in " + scope.getDescription() + "-scope");
     // TODO check existance of name.
     // TODO store prefix in variable.
     std::string exprManagerName = name;
 
     STORM_LOG_THROW(constantStructure.count("type") == 1, storm::exceptions::InvalidJaniException,
-                    "Constant '" + name + "' (scope: " + scope.description + ") must have a (single) type-declaration.");
+                    "Constant '" + name + "' (scope: " + scope.getDescription() + ") must have a (single) type-declaration.");
     auto type = parseType(constantStructure.at("type"), name, scope);
     STORM_LOG_THROW((type.first->isBasicType() || type.first->isBoundedType()), storm::exceptions::InvalidJaniException,
-                    "Constant '" + name + "' (scope: " + scope.description + ") has unexpected type");
+                    "Constant '" + name + "' (scope: " + scope.getDescription() + ") has unexpected type");
 
     uint_fast64_t valueCount = constantStructure.count("value");
     storm::expressions::Expression definingExpression;
     STORM_LOG_THROW(valueCount < 2, storm::exceptions::InvalidJaniException,
-                    "Value for constant '" + name + "' (scope: " + scope.description + ") must be given at most once.");
+                    "Value for constant '" + name + "' (scope: " + scope.getDescription() + ") must be given at most once.");
     if (valueCount == 1) {
         // Read initial value before; that makes creation later on a bit easier, and has as an additional benefit that we do not need to check whether the
         // variable occurs also on the assignment.
@@ -760,7 +760,7 @@ std::shared_ptr<storm::jani::Constant> JaniParser<ValueType>::parseConstant(Json
         assert(definingExpression.isInitialized());
         STORM_LOG_THROW((type.second == definingExpression.getType() || type.second.isRationalType() && definingExpression.getType().isIntegerType()),
                         storm::exceptions::InvalidJaniException,
-                        "Type of value for constant '" + name + "' (scope: " + scope.description + ") does not match the given type '" +
+                        "Type of value for constant '" + name + "' (scope: " + scope.getDescription() + ") does not match the given type '" +
                             type.first->getStringRepresentation() + ".");
     }
 
@@ -803,17 +803,17 @@ std::pair<std::unique_ptr<storm::jani::JaniType>, storm::expressions::Type> Jani
             result.second = expressionManager->getRationalType();
         } else {
             STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
-                            "Unsupported type " << typeStructure.dump() << " for variable '" << variableName << "' (scope: " << scope.description << ").");
+                            "Unsupported type " << typeStructure.dump() << " for variable '" << variableName << "' (scope: " << scope.getDescription() << ").");
         }
     } else if (typeStructure.is_object()) {
         STORM_LOG_THROW(typeStructure.count("kind") == 1, storm::exceptions::InvalidJaniException,
-                        "For complex type as in variable " << variableName << "(scope: " << scope.description << ") kind must be given");
+                        "For complex type as in variable " << variableName << "(scope: " << scope.getDescription() << ") kind must be given");
         std::string kind =
-            getString<ValueType>(typeStructure.at("kind"), "kind for complex type as in variable " + variableName + "(scope: " + scope.description + ") ");
+            getString<ValueType>(typeStructure.at("kind"), "kind for complex type as in variable " + variableName + "(scope: " + scope.getDescription() + ") ");
         if (kind == "bounded") {
             STORM_LOG_THROW(
                 typeStructure.count("lower-bound") + typeStructure.count("upper-bound") > 0, storm::exceptions::InvalidJaniException,
-                "For bounded type as in variable " << variableName << "(scope: " << scope.description << ") lower-bound or upper-bound must be given");
+                "For bounded type as in variable " << variableName << "(scope: " << scope.getDescription() << ") lower-bound or upper-bound must be given");
             storm::expressions::Expression lowerboundExpr;
             if (typeStructure.count("lower-bound") > 0) {
                 lowerboundExpr = parseExpression(typeStructure.at("lower-bound"), scope.refine("Lower bound for variable " + variableName));
@@ -823,48 +823,53 @@ std::pair<std::unique_ptr<storm::jani::JaniType>, storm::expressions::Type> Jani
                 upperboundExpr = parseExpression(typeStructure.at("upper-bound"), scope.refine("Upper bound for variable " + variableName));
             }
             STORM_LOG_THROW(typeStructure.count("base") == 1, storm::exceptions::InvalidJaniException,
-                            "For bounded type as in variable " << variableName << "(scope: " << scope.description << ") base must be given");
+                            "For bounded type as in variable " << variableName << "(scope: " << scope.getDescription() << ") base must be given");
             std::string basictype =
-                getString<ValueType>(typeStructure.at("base"), "base for bounded type as in variable " + variableName + "(scope: " + scope.description + ") ");
+                getString<ValueType>(typeStructure.at("base"),
+                                     "base for bounded type as in variable " + variableName + "(scope: " + scope.getDescription() + ") ");
             if (basictype == "int") {
                 STORM_LOG_THROW(!lowerboundExpr.isInitialized() || lowerboundExpr.hasIntegerType(), storm::exceptions::InvalidJaniException,
-                                "Lower bound for bounded integer variable " << variableName << "(scope: " << scope.description << ") must be integer-typed");
+                                "Lower bound for bounded integer variable " << variableName << "(scope: " << scope.getDescription()
+                                                                            << ") must be integer-typed");
                 STORM_LOG_THROW(!upperboundExpr.isInitialized() || upperboundExpr.hasIntegerType(), storm::exceptions::InvalidJaniException,
-                                "Upper bound for bounded integer variable " << variableName << "(scope: " << scope.description << ") must be integer-typed");
+                                "Upper bound for bounded integer variable " << variableName << "(scope: " << scope.getDescription()
+                                                                            << ") must be integer-typed");
                 if (lowerboundExpr.isInitialized() && upperboundExpr.isInitialized() && !lowerboundExpr.containsVariables() &&
                     !upperboundExpr.containsVariables()) {
                     STORM_LOG_THROW(lowerboundExpr.evaluateAsInt() <= upperboundExpr.evaluateAsInt(), storm::exceptions::InvalidJaniException,
                                     "Lower bound must not be larger than upper bound for bounded integer variable " << variableName
-                                                                                                                    << "(scope: " << scope.description << ").");
+                                                                                                                    << "(scope: "
+                                                                                                                    << scope.getDescription() << ").");
                 }
                 result.first = std::make_unique<storm::jani::BoundedType>(storm::jani::BoundedType::BaseType::Int, lowerboundExpr, upperboundExpr);
                 result.second = expressionManager->getIntegerType();
             } else if (basictype == "real") {
                 STORM_LOG_THROW(!lowerboundExpr.isInitialized() || lowerboundExpr.hasNumericalType(), storm::exceptions::InvalidJaniException,
-                                "Lower bound for bounded real variable " << variableName << "(scope: " << scope.description << ") must be numeric");
+                                "Lower bound for bounded real variable " << variableName << "(scope: " << scope.getDescription() << ") must be numeric");
                 STORM_LOG_THROW(!upperboundExpr.isInitialized() || upperboundExpr.hasNumericalType(), storm::exceptions::InvalidJaniException,
-                                "Upper bound for bounded real variable " << variableName << "(scope: " << scope.description << ") must be numeric");
+                                "Upper bound for bounded real variable " << variableName << "(scope: " << scope.getDescription() << ") must be numeric");
                 if (lowerboundExpr.isInitialized() && upperboundExpr.isInitialized() && !lowerboundExpr.containsVariables() &&
                     !upperboundExpr.containsVariables()) {
                     STORM_LOG_THROW(lowerboundExpr.evaluateAsRational() <= upperboundExpr.evaluateAsRational(), storm::exceptions::InvalidJaniException,
                                     "Lower bound must not be larger than upper bound for bounded real variable " << variableName
-                                                                                                                 << "(scope: " << scope.description << ").");
+                                                                                                                 << "(scope: "
+                                                                                                                 << scope.getDescription() << ").");
                 }
                 result.first = std::make_unique<storm::jani::BoundedType>(storm::jani::BoundedType::BaseType::Real, lowerboundExpr, upperboundExpr);
                 result.second = expressionManager->getRationalType();
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
-                                "Unsupported base " << basictype << " for bounded variable " << variableName << "(scope: " << scope.description << ").");
+                                "Unsupported base " << basictype << " for bounded variable " << variableName << "(scope: " << scope.getDescription() << ").");
             }
         } else if (kind == "array") {
             STORM_LOG_THROW(typeStructure.count("base") == 1, storm::exceptions::InvalidJaniException,
-                            "For array type as in variable " << variableName << "(scope: " << scope.description << ") base must be given");
+                            "For array type as in variable " << variableName << "(scope: " << scope.getDescription() << ") base must be given");
             auto base = parseType(typeStructure.at("base"), variableName, scope);
             result.first = std::make_unique<storm::jani::ArrayType>(std::move(base.first));
             result.second = expressionManager->getArrayType(base.second);
         } else {
             STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
-                            "Unsupported kind " << kind << " for complex type of variable " << variableName << "(scope: " << scope.description << ").");
+                            "Unsupported kind " << kind << " for complex type of variable " << variableName << "(scope: " << scope.getDescription() << ").");
         }
     }
     return result;
@@ -874,36 +879,38 @@ template<typename ValueType>
 storm::jani::FunctionDefinition JaniParser<ValueType>::parseFunctionDefinition(Json const& functionDefinitionStructure, Scope const& scope, bool firstPass,
                                                                                std::string const& parameterNamePrefix) {
     STORM_LOG_THROW(functionDefinitionStructure.count("name") == 1, storm::exceptions::InvalidJaniException,
-                    "Function definition (scope: " + scope.description + ") must have a name");
-    std::string functionName = getString<ValueType>(functionDefinitionStructure.at("name"), "function-name in " + scope.description);
+                    "Function definition (scope: " + scope.getDescription() + ") must have a name");
+    std::string functionName = getString<ValueType>(functionDefinitionStructure.at("name"), "function-name in " + scope.getDescription());
     STORM_LOG_THROW(functionDefinitionStructure.count("type") == 1, storm::exceptions::InvalidJaniException,
-                    "Function definition '" + functionName + "' (scope: " + scope.description + ") must have a (single) type-declaration.");
+                    "Function definition '" + functionName + "' (scope: " + scope.getDescription() + ") must have a (single) type-declaration.");
     auto type = parseType(functionDefinitionStructure.at("type"), functionName, scope);
     STORM_LOG_THROW(
         !(type.first->isClockType() || type.first->isContinuousType()), storm::exceptions::InvalidJaniException,
-        "Function definition '" + functionName + "' (scope: " + scope.description + ") uses illegal type '" + type.first->getStringRepresentation() + "'.");
+        "Function definition '" + functionName + "' (scope: " + scope.getDescription() + ") uses illegal type '" +
+            type.first->getStringRepresentation() + "'.");
 
     std::unordered_map<std::string, storm::expressions::Variable> parameterNameToVariableMap;
     std::vector<storm::expressions::Variable> parameters;
     if (!firstPass && functionDefinitionStructure.count("parameters") > 0) {
         STORM_LOG_THROW(functionDefinitionStructure.count("parameters") == 1, storm::exceptions::InvalidJaniException,
-                        "Function definition '" + functionName + "' (scope: " + scope.description + ") must have exactly one list of parameters.");
+                        "Function definition '" + functionName + "' (scope: " + scope.getDescription() + ") must have exactly one list of parameters.");
         for (auto const& parameterStructure : functionDefinitionStructure.at("parameters")) {
             STORM_LOG_THROW(parameterStructure.count("name") == 1, storm::exceptions::InvalidJaniException,
                             "Parameter declaration of parameter " + std::to_string(parameters.size()) + " of Function definition '" + functionName +
-                                "' (scope: " + scope.description + ") must have a name");
+                                "' (scope: " + scope.getDescription() + ") must have a name");
             std::string parameterName =
                 getString<ValueType>(parameterStructure.at("name"), "parameter-name of parameter " + std::to_string(parameters.size()) +
-                                                                        " of Function definition '" + functionName + "' (scope: " + scope.description + ").");
+                                                                        " of Function definition '" + functionName +
+                                                                        "' (scope: " + scope.getDescription() + ").");
             STORM_LOG_THROW(parameterStructure.count("type") == 1, storm::exceptions::InvalidJaniException,
                             "Parameter declaration of parameter " + std::to_string(parameters.size()) + " of Function definition '" + functionName +
-                                "' (scope: " + scope.description + ") must have exactly one type.");
+                                "' (scope: " + scope.getDescription() + ") must have exactly one type.");
             auto parameterType =
                 parseType(parameterStructure.at("type"), parameterName,
                           scope.refine("parameter declaration of parameter " + std::to_string(parameters.size()) + " of Function definition " + functionName));
             STORM_LOG_THROW(!(parameterType.first->isClockType() || parameterType.first->isContinuousType()), storm::exceptions::InvalidJaniException,
                             "Type of parameter " + std::to_string(parameters.size()) + " of function definition '" + functionName +
-                                "' (scope: " + scope.description + ") uses illegal type '" + parameterType.first->getStringRepresentation() + "'.");
+                                "' (scope: " + scope.getDescription() + ") uses illegal type '" + parameterType.first->getStringRepresentation() + "'.");
             STORM_LOG_WARN_COND(!parameterType.first->isBoundedType(),
                                 "Bounds on parameter" + parameterName + " of function definition " + functionName + " will be ignored.");
 
@@ -914,13 +921,13 @@ storm::jani::FunctionDefinition JaniParser<ValueType>::parseFunctionDefinition(J
     }
 
     STORM_LOG_THROW(functionDefinitionStructure.count("body") == 1, storm::exceptions::InvalidJaniException,
-                    "Function definition '" + functionName + "' (scope: " + scope.description + ") must have a (single) body.");
+                    "Function definition '" + functionName + "' (scope: " + scope.getDescription() + ") must have a (single) body.");
     storm::expressions::Expression functionBody;
     if (!firstPass) {
         functionBody = parseExpression(functionDefinitionStructure.at("body"), scope.refine("body of function definition " + functionName), false,
                                        parameterNameToVariableMap);
         STORM_LOG_WARN_COND(functionBody.getType() == type.second || (functionBody.getType().isIntegerType() && type.second.isRationalType()),
-                            "Type of body of function " + functionName + "' (scope: " + scope.description + ") has type "
+                            "Type of body of function " + functionName + "' (scope: " + scope.getDescription() + ") has type "
                                 << functionBody.getType() << " although the function type is given as " << type.second);
     }
     return storm::jani::FunctionDefinition(functionName, type.second, parameters, functionBody);
@@ -929,37 +936,37 @@ storm::jani::FunctionDefinition JaniParser<ValueType>::parseFunctionDefinition(J
 template<typename ValueType>
 std::shared_ptr<storm::jani::Variable> JaniParser<ValueType>::parseVariable(Json const& variableStructure, Scope const& scope, std::string const& namePrefix) {
     STORM_LOG_THROW(variableStructure.count("name") == 1, storm::exceptions::InvalidJaniException,
-                    "Variable (scope: " + scope.description + ") must have a name");
-    std::string name = getString<ValueType>(variableStructure.at("name"), "variable-name in " + scope.description + "-scope");
+                    "Variable (scope: " + scope.getDescription() + ") must have a name");
+    std::string name = getString<ValueType>(variableStructure.at("name"), "variable-name in " + scope.getDescription() + "-scope");
     // TODO check existance of name.
     // TODO store prefix in variable.
     std::string exprManagerName = namePrefix + name;
     bool transientVar = defaultVariableTransient;  // Default value for variables.
     uint_fast64_t tvarcount = variableStructure.count("transient");
     STORM_LOG_THROW(tvarcount <= 1, storm::exceptions::InvalidJaniException,
-                    "Multiple definitions of transient not allowed in variable '" + name + "' (scope: " + scope.description + ").");
+                    "Multiple definitions of transient not allowed in variable '" + name + "' (scope: " + scope.getDescription() + ").");
     if (tvarcount == 1) {
         transientVar =
-            getBoolean<ValueType>(variableStructure.at("transient"), "transient-attribute in variable '" + name + "' (scope: " + scope.description + ").");
+            getBoolean<ValueType>(variableStructure.at("transient"), "transient-attribute in variable '" + name + "' (scope: " + scope.getDescription() + ").");
     }
     STORM_LOG_THROW(variableStructure.count("type") == 1, storm::exceptions::InvalidJaniException,
-                    "Variable '" + name + "' (scope: " + scope.description + ") must have a (single) type-declaration.");
+                    "Variable '" + name + "' (scope: " + scope.getDescription() + ") must have a (single) type-declaration.");
     auto type = parseType(variableStructure.at("type"), name, scope);
 
     uint_fast64_t initvalcount = variableStructure.count("initial-value");
     if (transientVar) {
         STORM_LOG_THROW(initvalcount == 1, storm::exceptions::InvalidJaniException,
-                        "Initial value must be given once for transient variable '" + name + "' (scope: " + scope.description + ") " + name +
-                            "' (scope: " + scope.description + ").");
+                        "Initial value must be given once for transient variable '" + name + "' (scope: " + scope.getDescription() + ") " + name +
+                            "' (scope: " + scope.getDescription() + ").");
     } else {
         STORM_LOG_THROW(initvalcount <= 1, storm::exceptions::InvalidJaniException,
-                        "Initial value can be given at most one for variable " + name + "' (scope: " + scope.description + ").");
+                        "Initial value can be given at most one for variable " + name + "' (scope: " + scope.getDescription() + ").");
     }
     boost::optional<storm::expressions::Expression> initVal;
     if (initvalcount == 1 && !variableStructure.at("initial-value").is_null()) {
         initVal = parseExpression(variableStructure.at("initial-value"), scope.refine("Initial value for variable " + name));
         // STORM_LOG_THROW((type.second == initVal->getType() || type.second.isRationalType() && initVal->getType().isIntegerType()),
-        // storm::exceptions::InvalidJaniException,"Type of initial value for variable " + name + "' (scope: " + scope.description + ") does not match the
+        // storm::exceptions::InvalidJaniException,"Type of initial value for variable " + name + "' (scope: " + scope.getDescription() + ") does not match the
         // variable type '" + type.first->getStringRepresentation() + "'.");
     } else {
         assert(!transientVar);
@@ -976,7 +983,8 @@ std::shared_ptr<storm::jani::Variable> JaniParser<ValueType>::parseVariable(Json
 /**
  * Helper for parse expression.
  */
-void ensureNumberOfArguments(uint64_t expected, uint64_t actual, std::string const& opstring, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureNumberOfArguments(uint64_t expected, uint64_t actual, std::string const& opstring, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expected == actual, storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects " << expected << " arguments, but got " << actual << " in " << errorInfo << ".");
 }
@@ -1003,7 +1011,8 @@ std::vector<storm::expressions::Expression> JaniParser<ValueType>::parseBinaryEx
 /**
  * Helper for parse expression.
  */
-void ensureBooleanType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureBooleanType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.hasBooleanType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument[" << argNr << "]: '" << expr << "' to be Boolean in " << errorInfo << ".");
 }
@@ -1011,7 +1020,8 @@ void ensureBooleanType(storm::expressions::Expression const& expr, std::string c
 /**
  * Helper for parse expression.
  */
-void ensureNumericalType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureNumericalType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.hasNumericalType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument " + std::to_string(argNr) + " to be numerical in " << errorInfo << ".");
 }
@@ -1019,7 +1029,8 @@ void ensureNumericalType(storm::expressions::Expression const& expr, std::string
 /**
  * Helper for parse expression.
  */
-void ensureIntegerType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureIntegerType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.hasIntegerType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument " + std::to_string(argNr) + " to be numerical in " << errorInfo << ".");
 }
@@ -1027,7 +1038,8 @@ void ensureIntegerType(storm::expressions::Expression const& expr, std::string c
 /**
  * Helper for parse expression.
  */
-void ensureArrayType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, std::string const& errorInfo) {
+template<typename ErrorInfo>
+void ensureArrayType(storm::expressions::Expression const& expr, std::string const& opstring, unsigned argNr, ErrorInfo const& errorInfo) {
     STORM_LOG_THROW(expr.getType().isArrayType(), storm::exceptions::InvalidJaniException,
                     "Operator " << opstring << " expects argument " + std::to_string(argNr) + " to be of type 'array' in " << errorInfo << ".");
 }
@@ -1035,7 +1047,7 @@ void ensureArrayType(storm::expressions::Expression const& expr, std::string con
 template<typename ValueType>
 storm::jani::LValue JaniParser<ValueType>::parseLValue(Json const& lValueStructure, Scope const& scope) {
     if (lValueStructure.is_string()) {
-        std::string ident = getString<ValueType>(lValueStructure, scope.description);
+        std::string ident = getString<ValueType>(lValueStructure, scope);
         storm::jani::Variable const* var = nullptr;
         if (scope.localVars != nullptr) {
             auto localVar = scope.localVars->find(ident);
@@ -1045,10 +1057,10 @@ storm::jani::LValue JaniParser<ValueType>::parseLValue(Json const& lValueStructu
         }
         if (var == nullptr) {
             STORM_LOG_THROW(scope.globalVars != nullptr, storm::exceptions::InvalidJaniException,
-                            "Unknown identifier '" << ident << "' occurs in " << scope.description);
+                            "Unknown identifier '" << ident << "' occurs in " << scope.getDescription());
             auto globalVar = scope.globalVars->find(ident);
             STORM_LOG_THROW(globalVar != scope.globalVars->end(), storm::exceptions::InvalidJaniException,
-                            "Unknown identifier '" << ident << "' occurs in " << scope.description);
+                            "Unknown identifier '" << ident << "' occurs in " << scope.getDescription());
             var = globalVar->second;
         }
 
@@ -1057,17 +1069,22 @@ storm::jani::LValue JaniParser<ValueType>::parseLValue(Json const& lValueStructu
         // structure will be something like "op": "aa", "exp": {}, "index": {}
         // in exp we have something that is either a variable, or some other array access.
         // e.g. a[1][4] will look like: "op": "aa", "exp": {"op": "aa", "exp": "a", "index": {1}}, "index": {4}
-        std::string opstring = getString<ValueType>(lValueStructure.at("op"), scope.description);
-        STORM_LOG_THROW(opstring == "aa", storm::exceptions::InvalidJaniException, "Unknown operation '" << opstring << "' occurs in " << scope.description);
-        STORM_LOG_THROW(lValueStructure.count("exp") == 1, storm::exceptions::InvalidJaniException, "Missing 'exp' in array access at " << scope.description);
+        std::string opstring = getString<ValueType>(lValueStructure.at("op"), scope);
+        STORM_LOG_THROW(opstring == "aa", storm::exceptions::InvalidJaniException,
+                        "Unknown operation '" << opstring << "' occurs in " << scope.getDescription());
+        STORM_LOG_THROW(lValueStructure.count("exp") == 1, storm::exceptions::InvalidJaniException,
+                        "Missing 'exp' in array access at " << scope.getDescription());
         auto expLValue = parseLValue(lValueStructure.at("exp"), scope.refine("Expression of array access"));
-        STORM_LOG_THROW(expLValue.isArray(), storm::exceptions::InvalidJaniException, "Array access considers non-array expression at " << scope.description);
-        STORM_LOG_THROW(lValueStructure.count("index"), storm::exceptions::InvalidJaniException, "Missing 'index' in array access at " << scope.description);
+        STORM_LOG_THROW(expLValue.isArray(), storm::exceptions::InvalidJaniException,
+                        "Array access considers non-array expression at " << scope.getDescription());
+        STORM_LOG_THROW(lValueStructure.count("index"), storm::exceptions::InvalidJaniException,
+                        "Missing 'index' in array access at " << scope.getDescription());
         auto indexExpression = parseExpression(lValueStructure.at("index"), scope.refine("Index of array access"));
         expLValue.addArrayAccessIndex(indexExpression);
         return expLValue;
     } else {
-        STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException, "Unknown LValue '" << lValueStructure.dump() << "' occurs in " << scope.description);
+        STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
+                        "Unknown LValue '" << lValueStructure.dump() << "' occurs in " << scope.getDescription());
         // Silly warning suppression.
         return storm::jani::LValue(*scope.globalVars->end()->second);
     }
@@ -1100,7 +1117,7 @@ storm::expressions::Variable JaniParser<ValueType>::getVariableOrConstantExpress
             return it->second->getExpressionVariable();
         }
     }
-    STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException, "Unknown identifier '" << ident << "' occurs in " << scope.description);
+    STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException, "Unknown identifier '" << ident << "' occurs in " << scope.getDescription());
     // Silly warning suppression.
     return storm::expressions::Variable();
 }
@@ -1126,10 +1143,11 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
         if (expressionStructure.count("distribution") == 1) {
             STORM_LOG_THROW(
                 false, storm::exceptions::InvalidJaniException,
-                "Distributions are not supported by storm expressions, cannot import " << expressionStructure.dump() << " in " << scope.description << ".");
+                "Distributions are not supported by storm expressions, cannot import " << expressionStructure.dump() << " in "
+                                                                                                       << scope.getDescription() << ".");
         }
         if (expressionStructure.count("op") == 1) {
-            std::string opstring = getString<ValueType>(expressionStructure.at("op"), scope.description);
+            std::string opstring = getString<ValueType>(expressionStructure.at("op"), scope);
             std::vector<storm::expressions::Expression> arguments = {};
             if (opstring == "ite") {
                 STORM_LOG_THROW(expressionStructure.count("if") == 1, storm::exceptions::InvalidJaniException, "If operator required");
@@ -1141,9 +1159,9 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                     parseExpression(expressionStructure.at("then"), scope.refine("then-formula"), returnNoneInitializedOnUnknownOperator, auxiliaryVariables));
                 arguments.push_back(
                     parseExpression(expressionStructure.at("else"), scope.refine("else-formula"), returnNoneInitializedOnUnknownOperator, auxiliaryVariables));
-                ensureNumberOfArguments(3, arguments.size(), opstring, scope.description);
+                ensureNumberOfArguments(3, arguments.size(), opstring, scope);
                 assert(arguments.size() == 3);
-                ensureBooleanType(arguments[0], opstring, 0, scope.description);
+                ensureBooleanType(arguments[0], opstring, 0, scope);
                 return storm::expressions::ite(arguments[0], arguments[1], arguments[2]);
             } else if (opstring == "∨") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1151,8 +1169,8 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized() || !arguments[1].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureBooleanType(arguments[0], opstring, 0, scope.description);
-                ensureBooleanType(arguments[1], opstring, 1, scope.description);
+                ensureBooleanType(arguments[0], opstring, 0, scope);
+                ensureBooleanType(arguments[1], opstring, 1, scope);
                 return arguments[0] || arguments[1];
             } else if (opstring == "∧") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1160,8 +1178,8 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized() || !arguments[1].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureBooleanType(arguments[0], opstring, 0, scope.description);
-                ensureBooleanType(arguments[1], opstring, 1, scope.description);
+                ensureBooleanType(arguments[0], opstring, 0, scope);
+                ensureBooleanType(arguments[1], opstring, 1, scope);
                 return arguments[0] && arguments[1];
             } else if (opstring == "⇒") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1169,8 +1187,8 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized() || !arguments[1].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureBooleanType(arguments[0], opstring, 0, scope.description);
-                ensureBooleanType(arguments[1], opstring, 1, scope.description);
+                ensureBooleanType(arguments[0], opstring, 0, scope);
+                ensureBooleanType(arguments[1], opstring, 1, scope);
                 return (!arguments[0]) || arguments[1];
             } else if (opstring == "¬") {
                 arguments = parseUnaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1178,7 +1196,7 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureBooleanType(arguments[0], opstring, 0, scope.description);
+                ensureBooleanType(arguments[0], opstring, 0, scope);
                 return !arguments[0];
             } else if (opstring == "=") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1187,10 +1205,10 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                     return storm::expressions::Expression();
                 }
                 if (arguments[0].hasBooleanType()) {
-                    ensureBooleanType(arguments[1], opstring, 1, scope.description);
+                    ensureBooleanType(arguments[1], opstring, 1, scope);
                     return storm::expressions::iff(arguments[0], arguments[1]);
                 } else {
-                    ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                    ensureNumericalType(arguments[1], opstring, 1, scope);
                     return arguments[0] == arguments[1];
                 }
             } else if (opstring == "≠") {
@@ -1200,10 +1218,10 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                     return storm::expressions::Expression();
                 }
                 if (arguments[0].hasBooleanType()) {
-                    ensureBooleanType(arguments[1], opstring, 1, scope.description);
+                    ensureBooleanType(arguments[1], opstring, 1, scope);
                     return storm::expressions::xclusiveor(arguments[0], arguments[1]);
                 } else {
-                    ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                    ensureNumericalType(arguments[1], opstring, 1, scope);
                     return arguments[0] != arguments[1];
                 }
             } else if (opstring == "<") {
@@ -1212,8 +1230,8 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized() || !arguments[1].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] < arguments[1];
             } else if (opstring == "≤") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1221,8 +1239,8 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized() || !arguments[1].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] <= arguments[1];
             } else if (opstring == ">") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1230,8 +1248,8 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized() || !arguments[1].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] > arguments[1];
             } else if (opstring == "≥") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
@@ -1239,118 +1257,118 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (!arguments[0].isInitialized() || !arguments[1].isInitialized()) {
                     return storm::expressions::Expression();
                 }
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] >= arguments[1];
             } else if (opstring == "+") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] + arguments[1];
             } else if (opstring == "-" && expressionStructure.count("left") > 0) {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] - arguments[1];
             } else if (opstring == "-") {
                 arguments = parseUnaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 1);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
                 return -arguments[0];
             } else if (opstring == "*") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] * arguments[1];
             } else if (opstring == "/") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] / arguments[1];
             } else if (opstring == "%") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return arguments[0] % arguments[1];
             } else if (opstring == "max") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return storm::expressions::maximum(arguments[0], arguments[1]);
             } else if (opstring == "min") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return storm::expressions::minimum(arguments[0], arguments[1]);
             } else if (opstring == "floor") {
                 arguments = parseUnaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 1);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
                 return storm::expressions::floor(arguments[0]);
             } else if (opstring == "ceil") {
                 arguments = parseUnaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 1);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
                 return storm::expressions::ceil(arguments[0]);
             } else if (opstring == "abs") {
                 arguments = parseUnaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 1);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
                 return storm::expressions::abs(arguments[0]);
             } else if (opstring == "sgn") {
                 arguments = parseUnaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 1);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
                 return storm::expressions::sign(arguments[0]);
             } else if (opstring == "trc") {
                 arguments = parseUnaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 1);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
                 return storm::expressions::truncate(arguments[0]);
             } else if (opstring == "pow") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 return storm::expressions::pow(arguments[0], arguments[1]);
             } else if (opstring == "exp") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 // TODO implement
                 STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "exp operation is not yet implemented");
             } else if (opstring == "log") {
                 arguments = parseBinaryExpressionArguments(expressionStructure, opstring, scope, returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 assert(arguments.size() == 2);
-                ensureNumericalType(arguments[0], opstring, 0, scope.description);
-                ensureNumericalType(arguments[1], opstring, 1, scope.description);
+                ensureNumericalType(arguments[0], opstring, 0, scope);
+                ensureNumericalType(arguments[1], opstring, 1, scope);
                 // TODO implement
                 STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "log operation is not yet implemented");
             } else if (opstring == "aa") {
                 STORM_LOG_THROW(expressionStructure.count("exp") == 1, storm::exceptions::InvalidJaniException,
-                                "Array access operator requires exactly one exp (at " + scope.description + ").");
+                                "Array access operator requires exactly one exp (at " + scope.getDescription() + ").");
                 storm::expressions::Expression exp = parseExpression(expressionStructure.at("exp"), scope.refine("'exp' of array access operator"),
                                                                      returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
                 STORM_LOG_THROW(expressionStructure.count("index") == 1, storm::exceptions::InvalidJaniException,
-                                "Array access operator requires exactly one index (at " + scope.description + ").");
+                                "Array access operator requires exactly one index (at " + scope.getDescription() + ").");
                 storm::expressions::Expression index = parseExpression(expressionStructure.at("index"), scope.refine("index of array access operator"),
                                                                        returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
-                ensureArrayType(exp, opstring, 0, scope.description);
-                ensureIntegerType(index, opstring, 1, scope.description);
+                ensureArrayType(exp, opstring, 0, scope);
+                ensureIntegerType(index, opstring, 1, scope);
                 return std::make_shared<storm::expressions::ArrayAccessExpression>(exp.getManager(), exp.getType().getElementType(),
                                                                                    exp.getBaseExpressionPointer(), index.getBaseExpressionPointer())
                     ->toExpression();
             } else if (opstring == "av") {
                 STORM_LOG_THROW(expressionStructure.count("elements") == 1, storm::exceptions::InvalidJaniException,
-                                "Array value operator requires exactly one 'elements' (at " + scope.description + ").");
+                                "Array value operator requires exactly one 'elements' (at " + scope.getDescription() + ").");
                 std::vector<std::shared_ptr<storm::expressions::BaseExpression const>> elements;
                 storm::expressions::Type commonType;
                 bool first = true;
@@ -1367,7 +1385,7 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                         } else {
                             STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
                                             "Incompatible element types " << commonType << " and " << elements.back()->getType()
-                                                                          << " of array value expression at " << scope.description);
+                                                                          << " of array value expression at " << scope.getDescription());
                         }
                     }
                 }
@@ -1375,21 +1393,21 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                     ->toExpression();
             } else if (opstring == "ac") {
                 STORM_LOG_THROW(expressionStructure.count("length") == 1, storm::exceptions::InvalidJaniException,
-                                "Array access operator requires exactly one length (at " + scope.description + ").");
+                                "Array access operator requires exactly one length (at " + scope.getDescription() + ").");
                 storm::expressions::Expression length = parseExpression(expressionStructure.at("length"), scope.refine("index of array constructor expression"),
                                                                         returnNoneInitializedOnUnknownOperator, auxiliaryVariables);
-                ensureIntegerType(length, opstring, 1, scope.description);
+                ensureIntegerType(length, opstring, 1, scope);
                 STORM_LOG_THROW(expressionStructure.count("var") == 1, storm::exceptions::InvalidJaniException,
-                                "Array access operator requires exactly one var (at " + scope.description + ").");
+                                "Array access operator requires exactly one var (at " + scope.getDescription() + ").");
                 std::string indexVarName =
-                    getString<ValueType>(expressionStructure.at("var"), "Field 'var' of Array access operator (at " + scope.description + ").");
+                    getString<ValueType>(expressionStructure.at("var"), "Field 'var' of Array access operator (at " + scope.getDescription() + ").");
                 STORM_LOG_THROW(auxiliaryVariables.find(indexVarName) == auxiliaryVariables.end(), storm::exceptions::InvalidJaniException,
-                                "Index variable " << indexVarName << " is already defined as an auxiliary variable (at " + scope.description + ").");
+                                "Index variable " << indexVarName << " is already defined as an auxiliary variable (at " + scope.getDescription() + ").");
                 auto newAuxVars = auxiliaryVariables;
                 storm::expressions::Variable indexVar = expressionManager->declareFreshIntegerVariable(false, "ac_" + indexVarName);
                 newAuxVars.emplace(indexVarName, indexVar);
                 STORM_LOG_THROW(expressionStructure.count("exp") == 1, storm::exceptions::InvalidJaniException,
-                                "Array constructor operator requires exactly one exp (at " + scope.description + ").");
+                                "Array constructor operator requires exactly one exp (at " + scope.getDescription() + ").");
                 storm::expressions::Expression exp = parseExpression(expressionStructure.at("exp"), scope.refine("exp of array constructor"),
                                                                      returnNoneInitializedOnUnknownOperator, newAuxVars);
                 return std::make_shared<storm::expressions::ConstructorArrayExpression>(*expressionManager, expressionManager->getArrayType(exp.getType()),
@@ -1398,9 +1416,9 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                     ->toExpression();
             } else if (opstring == "call") {
                 STORM_LOG_THROW(expressionStructure.count("function") == 1, storm::exceptions::InvalidJaniException,
-                                "Function call operator requires exactly one function (at " + scope.description + ").");
+                                "Function call operator requires exactly one function (at " + scope.getDescription() + ").");
                 std::string functionName =
-                    getString<ValueType>(expressionStructure.at("function"), "in function call operator (at " + scope.description + ").");
+                    getString<ValueType>(expressionStructure.at("function"), "in function call operator (at " + scope.getDescription() + ").");
                 storm::jani::FunctionDefinition const* functionDefinition;
                 if (scope.localFunctions != nullptr && scope.localFunctions->count(functionName) > 0) {
                     functionDefinition = scope.localFunctions->at(functionName);
@@ -1408,14 +1426,14 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                     functionDefinition = scope.globalFunctions->at(functionName);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
-                                    "Function call operator calls unknown function '" + functionName + "' (at " + scope.description + ").");
+                                    "Function call operator calls unknown function '" + functionName + "' (at " + scope.getDescription() + ").");
                 }
                 STORM_LOG_THROW(expressionStructure.count("args") == 1, storm::exceptions::InvalidJaniException,
-                                "Function call operator requires exactly one args (at " + scope.description + ").");
+                                "Function call operator requires exactly one args (at " + scope.getDescription() + ").");
                 std::vector<std::shared_ptr<storm::expressions::BaseExpression const>> args;
                 if (expressionStructure.count("args") > 0) {
                     STORM_LOG_THROW(expressionStructure.count("args") == 1, storm::exceptions::InvalidJaniException,
-                                    "Function call operator requires exactly one args (at " + scope.description + ").");
+                                    "Function call operator requires exactly one args (at " + scope.getDescription() + ").");
                     for (auto const& arg : expressionStructure.at("args")) {
                         args.push_back(parseExpression(arg, scope.refine("argument " + std::to_string(args.size()) + " of function call expression"),
                                                        returnNoneInitializedOnUnknownOperator, auxiliaryVariables)
@@ -1430,15 +1448,15 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
                 if (returnNoneInitializedOnUnknownOperator) {
                     return storm::expressions::Expression();
                 }
-                STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException, "Unknown operator " << opstring << " in " << scope.description << ".");
+                STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException, "Unknown operator " << opstring << " in " << scope.getDescription() << ".");
             }
         }
         STORM_LOG_THROW(
             false, storm::exceptions::InvalidJaniException,
-            "No supported operator declaration found for complex expressions as " << expressionStructure.dump() << " in " << scope.description << ".");
+            "No supported operator declaration found for complex expressions as " << expressionStructure.dump() << " in " << scope.getDescription() << ".");
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidJaniException,
-                    "No supported expression found at " << expressionStructure.dump() << " in " << scope.description << ".");
+                    "No supported expression found at " << expressionStructure.dump() << " in " << scope.getDescription() << ".");
     // Silly warning suppression.
     return storm::expressions::Expression();
 }
@@ -1492,7 +1510,7 @@ storm::jani::Automaton JaniParser<ValueType>::parseAutomaton(Json const& automat
         for (auto const& funDef : dummyFunctionDefinitions) {
             bool unused = localFuns.emplace(funDef.getName(), &funDef).second;
             STORM_LOG_THROW(unused, storm::exceptions::InvalidJaniException,
-                            "Multiple definitions of functions with the name " << funDef.getName() << " in " << scope.description);
+                            "Multiple definitions of functions with the name " << funDef.getName() << " in " << scope.getDescription());
         }
         for (auto const& funStructure : automatonStructure.at("functions")) {
             // Actually parse the function body
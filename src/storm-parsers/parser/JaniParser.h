@@ -63,14 +63,33 @@ class JaniParser {
         FunctionsMap const* globalFunctions;
         VariablesMap const* localVars;
         FunctionsMap const* localFunctions;
+        // The scope this scope was refined from (if its description was extended). Refined scopes only live as long as their parents.
+        Scope const* parent = nullptr;
+
+        /*!
+         * Refines the scope. The description of the refined scope is only assembled when it is needed (i.e. for error messages), as building
+         * it for every nested expression takes time quadratic in the nesting depth.
+         */
         Scope refine(std::string const& prependedDescription = "") const {
             Scope res(*this);
             if (prependedDescription != "") {
-                res.description = "'" + prependedDescription + "' at " + res.description;
+                res.description = prependedDescription;
+                res.parent = this;
             }
             return res;
         }
 
+        std::string getDescription() const {
+            if (parent == nullptr) {
+                return description;
+            }
+            return "'" + description + "' at " + parent->getDescription();
+        }
+
+        friend std::ostream& operator<<(std::ostream& out, Scope const& scope) {
+            return out << scope.getDescription();
+        }
+
         Scope& clearVariables() {
             this->globalVars = nullptr;
             this->localVars = nullptr;
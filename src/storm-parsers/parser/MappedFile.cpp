@@ -10,20 +10,33 @@
 #include <fcntl.h>
 #include <cstring>
 #include <fstream>
+#include <iterator>
 
 #include <boost/integer/integer_mask.hpp>
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/io/CompressedInputFile.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace parser {
 
-MappedFile::MappedFile(const char* filename) {
+MappedFile::MappedFile(const char* filename, bool populate) {
     STORM_LOG_THROW(storm::utility::fileExistsAndIsReadable(filename), storm::exceptions::FileIoException,
                     "Error while reading " << filename << ": The file does not exist or is not readable.");
 
+    if (storm::utility::getCompressionFormat(filename) != storm::utility::CompressionFormat::None) {
+        storm::utility::InputFileStream stream(filename);
+        decompressedData.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        uint64_t size = decompressedData.size();
+        // Parsers may rely on the data being terminated like the zero-filled last page of a mapping.
+        decompressedData.push_back('\0');
+        this->data = decompressedData.data();
+        this->dataEnd = this->data + size;
+        return;
+    }
+
 #if defined LINUX || defined MACOSX
 
     // Do file mapping for reasonable systems.
@@ -40,7 +53,13 @@ MappedFile::MappedFile(const char* filename) {
 
     STORM_LOG_THROW(this->file >= 0, storm::exceptions::FileIoException, "Error in open(" << filename << "): Probably, we may not read this file.");
 
-    this->data = static_cast<char*>(mmap(NULL, this->st.st_size, PROT_READ, MAP_PRIVATE, this->file, 0));
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (populate) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+    this->data = static_cast<char*>(mmap(NULL, this->st.st_size, PROT_READ, flags, this->file, 0));
     if (this->data == MAP_FAILED) {
         close(this->file);
         STORM_LOG_ERROR("Error in mmap(" << filename << "): " << std::strerror(errno));
@@ -82,6 +101,9 @@ MappedFile::MappedFile(const char* filename) {
 }
 
 MappedFile::~MappedFile() {
+    if (!decompressedData.empty()) {
+        return;
+    }
 #if defined LINUX || defined MACOSX
     munmap(this->data, this->st.st_size);
     close(this->file);
@@ -103,5 +125,13 @@ std::size_t MappedFile::getDataSize() const {
     return this->getDataEnd() - this->getData();
 }
 
+void MappedFile::adviseSequential() const {
+#if defined LINUX || defined MACOSX
+    if (decompressedData.empty() && getDataSize() > 0) {
+        madvise(this->data, getDataSize(), MADV_SEQUENTIAL);
+    }
+#endif
+}
+
 }  // namespace parser
 }  // namespace storm
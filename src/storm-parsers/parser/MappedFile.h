@@ -10,6 +10,7 @@
 
 #include <sys/stat.h>
 #include <cstddef>
+#include <vector>
 
 #include "storm/utility/OsDetection.h"
 
@@ -29,6 +30,8 @@ namespace parser {
  * The public member data is a pointer to the actual file content.
  * Using this method, the kernel will take care of all buffering.
  * This is most probably much more efficient than doing this manually.
+ *
+ * Files compressed with gzip or zstd can not be mapped directly. Instead, they are decompressed into memory when the MappedFile is constructed.
  */
 class MappedFile {
    public:
@@ -38,8 +41,9 @@ class MappedFile {
      * If anything of this fails, an appropriate exception is raised and a log entry is written.
      *
      * @param filename Path and name of the file to be opened.
+     * @param populate If set, all pages are read ahead when the file is mapped (Linux only).
      */
-    MappedFile(const char* filename);
+    MappedFile(const char* filename, bool populate = false);
 
     /*!
      * Destructs a MappedFile.
@@ -66,6 +70,12 @@ class MappedFile {
      */
     std::size_t getDataSize() const;
 
+    /*!
+     * Tells the kernel that the data is going to be accessed sequentially, so it reads ahead aggressively and may drop pages soon after they were
+     * accessed.
+     */
+    void adviseSequential() const;
+
    private:
     //! A pointer to the mapped file content.
     char* data;
@@ -73,6 +83,9 @@ class MappedFile {
     //! A pointer to end of the mapped file content.
     char* dataEnd;
 
+    //! The decompressed content if the file is compressed. In this case, the file is not mapped.
+    std::vector<char> decompressedData;
+
 #if defined LINUX || defined MACOSX
 
     //! The file descriptor obtained by open().
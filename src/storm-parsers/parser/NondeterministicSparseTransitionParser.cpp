@@ -1,5 +1,7 @@
 #include "storm-parsers/parser/NondeterministicSparseTransitionParser.h"
 
+#include <algorithm>
+#include <optional>
 #include <string>
 
 #include "storm-parsers/parser/MappedFile.h"
@@ -7,19 +9,306 @@
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm-parsers/util/cstring.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 namespace storm {
 namespace parser {
 
 using namespace storm::utility::cstring;
 
+namespace {
+
+// Files that are larger than this are parsed in parallel in chunks of roughly this size.
+static const uint64_t ChunkSize = 1ull << 23;
+
+/*!
+ * A single line of a transition file.
+ */
+struct Transition {
+    uint_fast64_t source = 0;
+    uint_fast64_t choice = 0;
+    uint_fast64_t target = 0;
+    double value = 0.0;
+};
+
+Transition readTransition(char const*& buf) {
+    Transition transition;
+    transition.source = checked_strtol(buf, &buf);
+    transition.choice = checked_strtol(buf, &buf);
+    transition.target = checked_strtol(buf, &buf);
+    transition.value = checked_strtod(buf, &buf);
+
+    // Skip the optional action name.
+    buf = forwardToLineEnd(buf);
+    buf = trimWhitespaces(buf);
+    return transition;
+}
+
+/*!
+ * The information about a chunk of transitions that is gathered in the first (parallel) pass.
+ */
+struct ChunkInfo {
+    // The first and the last transition of the chunk. Only valid if the chunk contains transitions.
+    Transition first;
+    Transition last;
+
+    uint_fast64_t numberOfTransitions = 0;
+    uint_fast64_t highestStateIndex = 0;
+
+    // The number of rows that start at a transition of the chunk other than the first (only for transition files).
+    uint_fast64_t numberOfNewRows = 0;
+
+    // The states without transitions that lie between two transitions of the chunk (only for transition files).
+    std::vector<uint_fast64_t> skippedStates;
+
+    // False if the transitions are not ordered or not valid, e.g. because of values that are not probabilities.
+    bool valid = true;
+};
+
+/*!
+ * Retrieves the row of the given transition of a reward file, or none if the transition does not belong to a choice of the model.
+ */
+std::optional<uint_fast64_t> getRewardRow(Transition const& transition, std::vector<uint_fast64_t> const& rowGroupIndices) {
+    if (transition.source + 1 >= rowGroupIndices.size() ||
+        transition.choice >= rowGroupIndices[transition.source + 1] - rowGroupIndices[transition.source]) {
+        return std::nullopt;
+    }
+    return rowGroupIndices[transition.source] + transition.choice;
+}
+
+/*!
+ * Checks whether the given transition can follow the previous one in a file that is in canonical form.
+ */
+bool isValidSuccessor(Transition const& previous, Transition const& transition, bool isRewardFile, std::vector<uint_fast64_t> const& rowGroupIndices) {
+    if (isRewardFile) {
+        auto previousRow = getRewardRow(previous, rowGroupIndices);
+        auto row = getRewardRow(transition, rowGroupIndices);
+        return previousRow && row && (*previousRow < *row || (*previousRow == *row && previous.target < transition.target));
+    } else {
+        bool sameRow = previous.source == transition.source && previous.choice == transition.choice;
+        return previous.source <= transition.source && (!sameRow || previous.target < transition.target);
+    }
+}
+
+ChunkInfo scanChunk(char const* buf, char const* end, bool isRewardFile, std::vector<uint_fast64_t> const& rowGroupIndices) {
+    ChunkInfo info;
+    while (buf < end && buf[0] != '\0') {
+        Transition transition = readTransition(buf);
+        if (transition.value < 0.0 || (!isRewardFile && transition.value > 1.0) || (isRewardFile && !getRewardRow(transition, rowGroupIndices))) {
+            info.valid = false;
+            return info;
+        }
+
+        if (info.numberOfTransitions == 0) {
+            info.first = transition;
+        } else if (!isValidSuccessor(info.last, transition, isRewardFile, rowGroupIndices)) {
+            info.valid = false;
+            return info;
+        } else if (!isRewardFile) {
+            if (transition.source != info.last.source || transition.choice != info.last.choice) {
+                ++info.numberOfNewRows;
+            }
+            for (uint_fast64_t state = info.last.source + 1; state < transition.source; ++state) {
+                info.skippedStates.push_back(state);
+            }
+        }
+        info.last = transition;
+        info.highestStateIndex = std::max({info.highestStateIndex, transition.source, transition.target});
+        ++info.numberOfTransitions;
+    }
+    return info;
+}
+
+/*!
+ * The position in the matrix at which a chunk starts.
+ */
+struct ChunkStart {
+    // The last transition before the chunk (or the initial state of the parser) and the row it belongs to.
+    Transition previous;
+    uint_fast64_t row = 0;
+
+    // The index of the first entry of the chunk.
+    uint_fast64_t entry = 0;
+};
+
+/*!
+ * Writes the transitions of the chunk of a transition file to the given (preallocated) vectors of the matrix and inserts self-loops for skipped
+ * states.
+ */
+template<typename ValueType>
+void fillTransitionChunk(char const* buf, char const* end, ChunkStart start, std::vector<uint_fast64_t>& rowIndications,
+                         std::vector<uint_fast64_t>& rowGroupIndices, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues) {
+    Transition previous = start.previous;
+    uint_fast64_t row = start.row;
+    uint_fast64_t entry = start.entry;
+    while (buf < end && buf[0] != '\0') {
+        Transition transition = readTransition(buf);
+        if (transition.source != previous.source || transition.choice != previous.choice) {
+            ++row;
+            for (uint_fast64_t state = previous.source + 1; state < transition.source; ++state) {
+                rowGroupIndices[state] = row;
+                rowIndications[row] = entry;
+                columnsAndValues[entry++] = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(state, storm::utility::one<ValueType>());
+                ++row;
+            }
+            if (transition.source != previous.source) {
+                rowGroupIndices[transition.source] = row;
+            }
+            rowIndications[row] = entry;
+        }
+        columnsAndValues[entry++] = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(transition.target, ValueType(transition.value));
+        previous = transition;
+    }
+}
+
+/*!
+ * Writes the transitions of the chunk of a reward file to the given (preallocated) vectors of the matrix.
+ */
+template<typename ValueType>
+void fillRewardChunk(char const* buf, char const* end, ChunkStart start, std::vector<uint_fast64_t> const& rowGroupIndices,
+                     std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues) {
+    uint_fast64_t lastRow = start.row;
+    uint_fast64_t entry = start.entry;
+    while (buf < end && buf[0] != '\0') {
+        Transition transition = readTransition(buf);
+        uint_fast64_t row = rowGroupIndices[transition.source] + transition.choice;
+        for (; lastRow < row; ++lastRow) {
+            rowIndications[lastRow + 1] = entry;
+        }
+        columnsAndValues[entry++] = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(transition.target, ValueType(transition.value));
+    }
+}
+
+/*!
+ * Parses the transitions in the given buffer with two parallel passes over line aligned chunks. The first pass counts the rows and entries of each
+ * chunk which yields (via prefix sums) the position of each chunk in the matrix. The second pass then fills the matrix.
+ *
+ * @return The parsed matrix or none if the file is not in the canonical form (the sequential parser then reports the error, if any).
+ */
+template<typename ValueType, typename MatrixValueType>
+std::optional<storm::storage::SparseMatrix<ValueType>> parseInParallel(std::string const& filename, char const* begin, char const* end, bool isRewardFile,
+                                                                       storm::storage::SparseMatrix<MatrixValueType> const& modelInformation) {
+#ifdef STORM_HAVE_INTELTBB
+    std::vector<char const*> boundaries = splitAtLines(begin, end, ChunkSize);
+    uint64_t numberOfChunks = boundaries.size() - 1;
+    STORM_LOG_INFO("Parsing " << filename << " in " << numberOfChunks << " chunks.");
+    std::vector<uint_fast64_t> noRowGroupIndices;
+    std::vector<uint_fast64_t> const& modelRowGroupIndices = isRewardFile ? modelInformation.getRowGroupIndices() : noRowGroupIndices;
+
+    // First pass.
+    std::vector<ChunkInfo> chunks(numberOfChunks);
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t i = range.begin(); i < range.end(); ++i) {
+            chunks[i] = scanChunk(boundaries[i], boundaries[i + 1], isRewardFile, modelRowGroupIndices);
+        }
+    });
+
+    // Check that the chunks fit together and compute their positions in the matrix. Like the sequential parser, we start as if a transition of the
+    // first choice of the first state was read before.
+    std::vector<ChunkStart> starts(numberOfChunks);
+    std::vector<uint_fast64_t> deadlockStates;
+    ChunkStart current;
+    bool hasPreviousTransition = false;
+    uint_fast64_t highestStateIndex = 0;
+    for (uint64_t i = 0; i < numberOfChunks; ++i) {
+        ChunkInfo const& chunk = chunks[i];
+        starts[i] = current;
+        if (!chunk.valid) {
+            return std::nullopt;
+        }
+        if (chunk.numberOfTransitions == 0) {
+            continue;
+        }
+        if (hasPreviousTransition && !isValidSuccessor(current.previous, chunk.first, isRewardFile, modelRowGroupIndices)) {
+            return std::nullopt;
+        }
+        if (isRewardFile) {
+            current.row = *getRewardRow(chunk.last, modelRowGroupIndices);
+        } else {
+            uint64_t numberOfDeadlockStates = deadlockStates.size();
+            for (uint_fast64_t state = current.previous.source + 1; state < chunk.first.source; ++state) {
+                deadlockStates.push_back(state);
+            }
+            deadlockStates.insert(deadlockStates.end(), chunk.skippedStates.begin(), chunk.skippedStates.end());
+            numberOfDeadlockStates = deadlockStates.size() - numberOfDeadlockStates;
+            bool firstStartsRow = chunk.first.source != current.previous.source || chunk.first.choice != current.previous.choice;
+            current.row += (firstStartsRow ? 1 : 0) + chunk.numberOfNewRows + numberOfDeadlockStates;
+            current.entry += numberOfDeadlockStates;
+        }
+        current.entry += chunk.numberOfTransitions;
+        current.previous = chunk.last;
+        hasPreviousTransition = true;
+        highestStateIndex = std::max(highestStateIndex, chunk.highestStateIndex);
+    }
+    if (!hasPreviousTransition) {
+        return std::nullopt;
+    }
+    uint_fast64_t numberOfEntries = current.entry;
+
+    std::vector<uint_fast64_t> rowIndications;
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues;
+    if (isRewardFile) {
+        if (highestStateIndex + 1 > modelInformation.getColumnCount() || numberOfEntries > modelInformation.getEntryCount()) {
+            return std::nullopt;
+        }
+        STORM_LOG_INFO("Attempting to create matrix of size " << modelInformation.getRowCount() << " x " << modelInformation.getColumnCount() << " with "
+                                                              << numberOfEntries << " entries.");
+
+        // Second pass. Each chunk sets the row indications of the rows after the last row of the previous chunk up to its own last row.
+        rowIndications.resize(modelInformation.getRowCount() + 1, numberOfEntries);
+        rowIndications[0] = 0;
+        columnsAndValues.resize(numberOfEntries);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                fillRewardChunk(boundaries[i], boundaries[i + 1], starts[i], modelRowGroupIndices, rowIndications, columnsAndValues);
+            }
+        });
+        return storm::storage::SparseMatrix<ValueType>(modelInformation.getColumnCount(), std::move(rowIndications), std::move(columnsAndValues),
+                                                       std::vector<uint_fast64_t>(modelRowGroupIndices));
+    }
+
+    bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+    for (auto state : deadlockStates) {
+        if (dontFixDeadlocks) {
+            STORM_LOG_ERROR("Error while parsing " << filename << ": node " << state << " has no outgoing transitions.");
+        } else {
+            STORM_LOG_INFO("Warning while parsing " << filename << ": node " << state << " has no outgoing transitions. A self-loop was inserted.");
+        }
+    }
+    STORM_LOG_THROW(!dontFixDeadlocks || deadlockStates.empty(), storm::exceptions::WrongFormatException,
+                    "Some of the states do not have outgoing transitions.");
+    uint_fast64_t numberOfRows = current.row + 1;
+    STORM_LOG_INFO("Attempting to create matrix of size " << numberOfRows << " x " << (highestStateIndex + 1) << " with " << numberOfEntries << " entries.");
+
+    // Second pass. States that only occur as targets after the last source state get empty row groups.
+    rowIndications.resize(numberOfRows + 1, numberOfEntries);
+    rowIndications[0] = 0;
+    std::vector<uint_fast64_t> rowGroupIndices(highestStateIndex + 2, numberOfRows);
+    rowGroupIndices[0] = 0;
+    columnsAndValues.resize(numberOfEntries);
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t i = range.begin(); i < range.end(); ++i) {
+            fillTransitionChunk(boundaries[i], boundaries[i + 1], starts[i], rowIndications, rowGroupIndices, columnsAndValues);
+        }
+    });
+    return storm::storage::SparseMatrix<ValueType>(highestStateIndex + 1, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return std::nullopt;
+#endif
+}
+
+}  // namespace
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<ValueType>::parseNondeterministicTransitions(std::string const& filename) {
     storm::storage::SparseMatrix<ValueType> emptyMatrix;
@@ -44,6 +333,23 @@ storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<V
     MappedFile file(filename.c_str());
     char const* buf = file.getData();
 
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && file.getDataSize() > ChunkSize) {
+        // Skip the format hint if it is there.
+        char const* begin = trimWhitespaces(buf);
+        if (begin[0] < '0' || begin[0] > '9') {
+            begin = trimWhitespaces(forwardToLineEnd(begin));
+        }
+        auto result = parseInParallel<ValueType>(filename, begin, file.getDataEnd(), isRewardFile, modelInformation);
+        if (result) {
+            if (isRewardFile && !result->isSubmatrixOf(modelInformation)) {
+                STORM_LOG_ERROR("There are rewards for non existent transitions given in the reward file.");
+                throw storm::exceptions::WrongFormatException() << "There are rewards for non existent transitions given in the reward file.";
+            }
+            return std::move(*result);
+        }
+        STORM_LOG_INFO("Parsing " << filename << " sequentially.");
+    }
+
     // Perform first pass, i.e. obtain number of columns, rows and non-zero elements.
     NondeterministicSparseTransitionParser::FirstPassResult firstPass =
         NondeterministicSparseTransitionParser::firstPass(file.getData(), isRewardFile, modelInformation);
@@ -1,5 +1,7 @@
 #include "storm-parsers/parser/PrismParser.h"
 
+#include <cctype>
+#include <queue>
 #include <unordered_set>
 #include "storm/storage/prism/Compositions.h"
 
@@ -7,6 +9,7 @@
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/CompressedInputFile.h"
 #include "storm/io/file.h"
 #include "storm/utility/macros.h"
 
@@ -19,27 +22,13 @@
 namespace storm {
 namespace parser {
 storm::prism::Program PrismParser::parse(std::string const& filename, bool prismCompatibility) {
-    // Open file and initialize result.
-    std::ifstream inputFileStream;
-    storm::utility::openFile(filename, inputFileStream);
+    // Open the possibly compressed file and initialize result.
+    storm::utility::InputFileStream inputFileStream(filename);
     storm::prism::Program result;
 
-    // Now try to parse the contents of the file.
-    try {
-        std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
-        result = parseFromString(fileContent, filename, prismCompatibility);
-    } catch (storm::exceptions::WrongFormatException& e) {
-        // In case of an exception properly close the file before passing exception.
-        storm::utility::closeFile(inputFileStream);
-        throw e;
-    } catch (std::exception& e) {
-        // In case of an exception properly close the file before passing exception.
-        storm::utility::closeFile(inputFileStream);
-        throw e;
-    }
-
-    // Close the stream in case everything went smoothly and return result.
-    storm::utility::closeFile(inputFileStream);
+    // Now try to parse the contents of the file. The file is closed once the stream is destroyed.
+    std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
+    result = parseFromString(fileContent, filename, prismCompatibility);
     return result;
 }
 
@@ -440,43 +429,122 @@ void PrismParser::moveToSecondRun() {
     this->globalProgramInformation.moveToSecondRun();
 }
 
+namespace {
+/*!
+ * Orders the formulas such that every formula comes after the formulas its expression refers to, where the references are determined by scanning
+ * the expressions for identifiers. Formulas that (transitively) depend on themselves are omitted. In contrast to repeatedly trying to parse all
+ * formulas, this takes time linear in the size of the formulas, even if they are declared in reverse order.
+ */
+std::vector<uint64_t> getFormulaDependencyOrder(std::vector<storm::prism::Formula> const& formulas, std::vector<std::string> const& formulaExpressions) {
+    std::unordered_map<std::string, uint64_t> formulaNameToIndexMap;
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        formulaNameToIndexMap.emplace(formulas[formulaIndex].getName(), formulaIndex);
+    }
+
+    std::vector<std::vector<uint64_t>> dependentFormulas(formulas.size());
+    std::vector<uint64_t> numberOfDependencies(formulas.size(), 0);
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        std::string const& expression = formulaExpressions[formulaIndex];
+        std::unordered_set<uint64_t> dependencies;
+        uint64_t position = 0;
+        while (position < expression.size()) {
+            unsigned char character = expression[position];
+            if (std::isalnum(character) || character == '_') {
+                uint64_t end = position + 1;
+                while (end < expression.size() && (std::isalnum(static_cast<unsigned char>(expression[end])) || expression[end] == '_')) {
+                    ++end;
+                }
+                // Tokens starting with a digit are number literals (possibly with an exponent) rather than identifiers.
+                if (!std::isdigit(character)) {
+                    auto nameIndexPair = formulaNameToIndexMap.find(expression.substr(position, end - position));
+                    if (nameIndexPair != formulaNameToIndexMap.end()) {
+                        dependencies.insert(nameIndexPair->second);
+                    }
+                }
+                position = end;
+            } else {
+                ++position;
+            }
+        }
+        numberOfDependencies[formulaIndex] = dependencies.size();
+        for (auto dependency : dependencies) {
+            dependentFormulas[dependency].push_back(formulaIndex);
+        }
+    }
+
+    // Always proceed with the first formula whose dependencies are resolved, such that formulas declared in a proper order keep their order.
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> resolvedFormulas;
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        if (numberOfDependencies[formulaIndex] == 0) {
+            resolvedFormulas.push(formulaIndex);
+        }
+    }
+    std::vector<uint64_t> order;
+    order.reserve(formulas.size());
+    while (!resolvedFormulas.empty()) {
+        uint64_t formulaIndex = resolvedFormulas.top();
+        resolvedFormulas.pop();
+        order.push_back(formulaIndex);
+        for (auto dependentFormula : dependentFormulas[formulaIndex]) {
+            if (--numberOfDependencies[dependentFormula] == 0) {
+                resolvedFormulas.push(dependentFormula);
+            }
+        }
+    }
+    return order;
+}
+}  // namespace
+
 void PrismParser::createFormulaIdentifiers(std::vector<storm::prism::Formula> const& formulas) {
     STORM_LOG_THROW(formulas.size() == this->formulaExpressions.size(), storm::exceptions::UnexpectedException,
                     "Unexpected number of formulas and formula expressions");
     this->formulaOrder.clear();
     storm::storage::BitVector unprocessed(formulas.size(), true);
-    // It might be that formulas are declared in a weird order.
-    // We follow a trial-and-error approach: If we can not parse the expression for one formula,
+    // Tries to parse the expression of the given formula and, if this succeeds, declares the formula as an identifier.
+    auto processFormula = [&](uint64_t formulaIndex) {
+        storm::expressions::Expression expression = this->expressionParser->parseFromString(formulaExpressions[formulaIndex], true);
+        if (!expression.isInitialized()) {
+            return false;
+        }
+        unprocessed.set(formulaIndex, false);
+        formulaOrder.push_back(formulaIndex);
+        storm::expressions::Variable variable;
+        try {
+            if (expression.hasIntegerType()) {
+                variable = manager->declareIntegerVariable(formulas[formulaIndex].getName());
+            } else if (expression.hasBooleanType()) {
+                variable = manager->declareBooleanVariable(formulas[formulaIndex].getName());
+            } else {
+                STORM_LOG_ASSERT(expression.hasNumericalType(), "Unexpected type for formula expression of formula " << formulas[formulaIndex].getName());
+                variable = manager->declareRationalVariable(formulas[formulaIndex].getName());
+            }
+            this->identifiers_.add(formulas[formulaIndex].getName(), variable.getExpression());
+        } catch (storm::exceptions::InvalidArgumentException const& e) {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Parsing error in " << this->getFilename() << ": illegal identifier '" << formulas[formulaIndex].getName() << "' at line '"
+                                                << formulas[formulaIndex].getLineNumber());
+        }
+        this->expressionParser->setIdentifierMapping(&this->identifiers_);
+        return true;
+    };
+
+    // It might be that formulas are declared in a weird order, so we first process them in the order given by their dependencies.
+    for (auto formulaIndex : getFormulaDependencyOrder(formulas, formulaExpressions)) {
+        if (!processFormula(formulaIndex)) {
+            break;
+        }
+    }
+
+    // If this did not work out, we follow a trial-and-error approach for the remaining formulas: If we can not parse the expression for one formula,
     // we assume a subsequent formula has to be evaluated first.
     // We cycle through the formulas until no further progress is made
     bool progress = true;
-    while (progress) {
+    while (progress && !unprocessed.empty()) {
         progress = false;
         for (uint64_t formulaIndex = unprocessed.getNextSetIndex(0); formulaIndex < formulas.size();
              formulaIndex = unprocessed.getNextSetIndex(formulaIndex + 1)) {
-            storm::expressions::Expression expression = this->expressionParser->parseFromString(formulaExpressions[formulaIndex], true);
-            if (expression.isInitialized()) {
+            if (processFormula(formulaIndex)) {
                 progress = true;
-                unprocessed.set(formulaIndex, false);
-                formulaOrder.push_back(formulaIndex);
-                storm::expressions::Variable variable;
-                try {
-                    if (expression.hasIntegerType()) {
-                        variable = manager->declareIntegerVariable(formulas[formulaIndex].getName());
-                    } else if (expression.hasBooleanType()) {
-                        variable = manager->declareBooleanVariable(formulas[formulaIndex].getName());
-                    } else {
-                        STORM_LOG_ASSERT(expression.hasNumericalType(),
-                                         "Unexpected type for formula expression of formula " << formulas[formulaIndex].getName());
-                        variable = manager->declareRationalVariable(formulas[formulaIndex].getName());
-                    }
-                    this->identifiers_.add(formulas[formulaIndex].getName(), variable.getExpression());
-                } catch (storm::exceptions::InvalidArgumentException const& e) {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                    "Parsing error in " << this->getFilename() << ": illegal identifier '" << formulas[formulaIndex].getName() << "' at line '"
-                                                        << formulas[formulaIndex].getLineNumber());
-                }
-                this->expressionParser->setIdentifierMapping(&this->identifiers_);
             }
         }
     }
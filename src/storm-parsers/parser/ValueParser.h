@@ -2,6 +2,9 @@
 #define STORM_PARSER_VALUEPARSER_H_
 
 #include <boost/lexical_cast.hpp>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
 #include "storm-parsers/parser/ExpressionParser.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -76,6 +79,32 @@ inline double parseNumber(std::string const& value) {
     }
 }
 
+/*!
+ * Parse number from a string view. Integers and doubles are parsed with std::from_chars (avoiding the overhead of streams) if possible.
+ * Otherwise, this falls back to parseNumber.
+ *
+ * @param value String containing the value.
+ *
+ * @return NumberType.
+ */
+template<typename NumberType>
+inline NumberType parseNumberFromChars(std::string_view value) {
+#if defined(__cpp_lib_to_chars)
+    constexpr bool supportsFromChars = std::is_integral<NumberType>::value || std::is_same<NumberType, double>::value;
+#else
+    // Floating point types are not supported by all standard libraries.
+    constexpr bool supportsFromChars = std::is_integral<NumberType>::value;
+#endif
+    if constexpr (supportsFromChars) {
+        NumberType result;
+        auto [end, errorCode] = std::from_chars(value.data(), value.data() + value.size(), result);
+        if (errorCode == std::errc() && end == value.data() + value.size()) {
+            return result;
+        }
+    }
+    return parseNumber<NumberType>(std::string(value));
+}
+
 }  // namespace parser
 }  // namespace storm
 
@@ -84,6 +84,19 @@ char const* forwardToNextLine(char const* buffer) {
     return lineEnd;
 }
 
+std::vector<char const*> splitAtLines(char const* begin, char const* end, uint64_t chunkSize) {
+    std::vector<char const*> boundaries = {begin};
+    while (static_cast<uint64_t>(end - boundaries.back()) > chunkSize) {
+        char const* boundary = trimWhitespaces(forwardToLineEnd(boundaries.back() + chunkSize));
+        if (boundary >= end) {
+            break;
+        }
+        boundaries.push_back(boundary);
+    }
+    boundaries.push_back(end);
+    return boundaries;
+}
+
 }  // namespace cstring
 
 }  // namespace utility
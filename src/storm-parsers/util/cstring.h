@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 namespace storm {
 namespace utility {
@@ -38,6 +39,16 @@ char const* forwardToLineEnd(char const* buffer);
  */
 char const* forwardToNextLine(char const* buffer);
 
+/*!
+ * @brief Splits the given buffer into chunks of roughly the given size that can be processed independently.
+ *
+ * Every chunk but the first starts at the first non-whitespace character of a line, i.e. at a position that is also reached when processing the
+ * buffer line by line and skipping whitespaces after each line.
+ *
+ * @return The boundaries of the chunks, i.e. a vector starting with begin and ending with end.
+ */
+std::vector<char const*> splitAtLines(char const* begin, char const* end, uint64_t chunkSize);
+
 }  // namespace cstring
 }  // namespace utility
 }  // namespace storm
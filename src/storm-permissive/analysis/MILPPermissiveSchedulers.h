@@ -26,6 +26,7 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mAlphaVariables;
     std::unordered_map<storm::storage::StateActionTarget, storm::expressions::Variable> mBetaVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mGammaVariables;
+    std::vector<uint_fast64_t> mEndComponentIndices;
 
    public:
     MilpPermissiveSchedulerComputation(storm::solver::LpSolver<double>& milpsolver, storm::models::sparse::Mdp<double, RM> const& mdp,
@@ -87,7 +88,7 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     /**
      *  Create variables
      */
-    void createVariables(PermissiveSchedulerPenalties const& penalties, storm::storage::BitVector const& relevantStates) {
+    void createVariables(PermissiveSchedulerPenalties const& penalties, storm::storage::BitVector const& relevantStates, bool lowerBound) {
         // We need the unique initial state later, so we get that one before looping.
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
@@ -102,12 +103,15 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                 var = solver.addLowerBoundedContinuousVariable("x_" + std::to_string(s), 0.0);
             }
             mProbVariables[s] = var;
-            // Create alpha_s variables
-            var = solver.addBinaryVariable("alp_" + std::to_string(s));
-            mAlphaVariables[s] = var;
-            // Create gamma_s variables
-            var = solver.addBoundedContinuousVariable("gam_" + std::to_string(s), 0.0, 1.0);
-            mGammaVariables[s] = var;
+            bool progress = needsProgressConstraints(s, lowerBound);
+            if (progress) {
+                // Create alpha_s variables
+                var = solver.addBinaryVariable("alp_" + std::to_string(s));
+                mAlphaVariables[s] = var;
+                // Create gamma_s variables
+                var = solver.addBoundedContinuousVariable("gam_" + std::to_string(s), 0.0, 1.0);
+                mGammaVariables[s] = var;
+            }
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 auto stateAndAction = storage::StateActionPair(s, a);
 
@@ -116,6 +120,9 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                 var = solver.addBinaryVariable("y_" + std::to_string(s) + "_" + std::to_string(a), -penalty);
                 multistrategyVariables[stateAndAction] = var;
 
+                if (!progress) {
+                    continue;
+                }
                 // Create beta_(s,a,t) variables
                 // Iterate over successors of s via a.
                 for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
@@ -153,8 +160,6 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                 expr = expr + multistrategyVariables[storage::StateActionPair(s, a)];
             }
             solver.addConstraint("c2-" + stateString, solver.getConstant(1) <= expr);
-            // (5)
-            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
 
             // (3) For the relevant states.
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
@@ -176,6 +181,12 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                 }
             }
 
+            // (5), (6) and (8) are only necessary for lower-bounded properties and states in end components.
+            if (!needsProgressConstraints(s, lowerBound)) {
+                continue;
+            }
+            // (5)
+            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 // (6)
                 std::string sastring(stateString + "_" + std::to_string(a));
@@ -193,8 +204,8 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                     if (entry.getValue() != 0) {
                         storage::StateActionTarget sat = {s, a, entry.getColumn()};
                         std::string satstring = to_string(sat);
-                        // (8)
-                        if (relevantStates[entry.getColumn()]) {
+                        // (8) Paths can only cycle inside an end component.
+                        if (relevantStates[entry.getColumn()] && mEndComponentIndices[entry.getColumn()] == mEndComponentIndices[s]) {
                             STORM_LOG_ASSERT(mGammaVariables.count(entry.getColumn()) > 0, "Entry not found.");
                             STORM_LOG_ASSERT(mGammaVariables.count(s) > 0, "Entry not found.");
                             STORM_LOG_ASSERT(mBetaVariables.count(sat) > 0, "Entry not found.");
@@ -208,15 +219,25 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     }
 
     /**
-     *
+     * Whether the state needs the variables and constraints that enforce progress towards the goal states.
+     */
+    bool needsProgressConstraints(uint_fast64_t state, bool lowerBound) const {
+        return lowerBound && mEndComponentIndices[state] != this->noEndComponent;
+    }
+
+    /**
+     * Create the MILP. Only the states that are reachable from the initial state without passing through goal or sink states
+     * are encoded and the progress constraints are restricted to the states in end components.
      */
     void createMILP(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
-        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
-        storm::storage::BitVector relevantStates = ~irrelevant;
+        storm::storage::BitVector relevantStates = this->computeRelevantStates();
+        mEndComponentIndices = this->computeEndComponentIndices(relevantStates);
+        STORM_LOG_DEBUG("Encoding " << relevantStates.getNumberOfSetBits() << " of " << this->mdp.getNumberOfStates()
+                                    << " states for the computation of a permissive scheduler.");
         // Notice that the separated construction of variables and
         // constraints slows down the construction of the MILP.
         // In the future, we might want to merge this.
-        createVariables(penalties, relevantStates);
+        createVariables(penalties, relevantStates, lowerBound);
         createConstraints(lowerBound, boundary, relevantStates);
 
         solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
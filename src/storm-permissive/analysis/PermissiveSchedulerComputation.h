@@ -1,11 +1,15 @@
 #pragma once
 
+#include <limits>
 #include <memory>
+#include <vector>
 
 #include "storm-permissive/analysis/PermissiveSchedulerPenalty.h"
 #include "storm-permissive/analysis/PermissiveSchedulers.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/utility/graph.h"
 
 namespace storm {
 namespace ps {
@@ -18,6 +22,34 @@ class PermissiveSchedulerComputation {
     storm::storage::BitVector const& mSinks;
     PermissiveSchedulerPenalties mPenalties;
 
+    // Marks states that are not contained in an end component of the relevant states.
+    static constexpr uint_fast64_t noEndComponent = std::numeric_limits<uint_fast64_t>::max();
+
+    /**
+     * Computes the states that need to be encoded, i.e., the states that are neither goal nor sink states and that
+     * are reachable from the initial state without passing through a goal or sink state.
+     */
+    storm::storage::BitVector computeRelevantStates() const {
+        storm::storage::BitVector maybeStates = ~(mGoals | mSinks);
+        return storm::utility::graph::getReachableStates(mdp.getTransitionMatrix(), mdp.getInitialStates(), maybeStates, ~maybeStates) & maybeStates;
+    }
+
+    /**
+     * Assigns each relevant state the index of the maximal end component (of the MDP restricted to the relevant states) that contains it.
+     * Spurious solutions of the encoding can only occur inside end components, so only the states of end components need the
+     * variables and constraints that enforce progress towards the goal states.
+     */
+    std::vector<uint_fast64_t> computeEndComponentIndices(storm::storage::BitVector const& relevantStates) const {
+        std::vector<uint_fast64_t> result(mdp.getNumberOfStates(), noEndComponent);
+        storm::storage::MaximalEndComponentDecomposition<double> mecs(mdp.getTransitionMatrix(), mdp.getBackwardTransitions(), relevantStates);
+        for (uint_fast64_t mecIndex = 0; mecIndex < mecs.size(); ++mecIndex) {
+            for (auto const& stateChoices : mecs[mecIndex]) {
+                result[stateChoices.first] = mecIndex;
+            }
+        }
+        return result;
+    }
+
    public:
     PermissiveSchedulerComputation(storm::models::sparse::Mdp<double, RM> const& mdp, storm::storage::BitVector const& goalstates,
                                    storm::storage::BitVector const& sinkstates)
@@ -45,7 +45,8 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMC(s
 
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp) {
+                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                bool minimizePenalty) {
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<double, RM>> propMC(mdp);
     STORM_LOG_ASSERT(safeProp.getSubformula().isEventuallyFormula(), "No eventually formula.");
     auto backwardTransitions = mdp.getBackwardTransitions();
@@ -59,6 +60,7 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(
     auto solver = storm::utility::solver::getSmtSolver(*expressionManager);
     SmtPermissiveSchedulerComputation<storm::models::sparse::StandardRewardModel<double>> comp(*solver, mdp, goalstates, sinkstates);
     STORM_LOG_THROW(!storm::logic::isStrict(safeProp.getComparisonType()), storm::exceptions::NotImplementedException, "Strict bounds are not supported");
+    comp.setMinimizePenalty(minimizePenalty);
     comp.calculatePermissiveScheduler(storm::logic::isLowerBound(safeProp.getComparisonType()), safeProp.getThresholdAs<double>());
     if (comp.foundSolution()) {
         return boost::optional<SubMDPPermissiveScheduler<RM>>(comp.getScheduler());
@@ -71,7 +73,8 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double> const& mdp,
                                                                                         storm::logic::ProbabilityOperatorFormula const& safeProp);
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double> const& mdp,
-                                                                                       storm::logic::ProbabilityOperatorFormula const& safeProp);
+                                                                                       storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                       bool minimizePenalty);
 
 }  // namespace ps
 }  // namespace storm
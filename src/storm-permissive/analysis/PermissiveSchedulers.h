@@ -77,8 +77,14 @@ template<typename RM = storm::models::sparse::StandardRewardModel<double>>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
                                                                                  storm::logic::ProbabilityOperatorFormula const& safeProp);
 
+/**
+ * Computes a permissive scheduler via an SMT encoding.
+ * If minimizePenalty is set, the penalty of the scheduler is minimized by incrementally tightening a bound on the penalty.
+ * Otherwise, additional state-action pairs are greedily enabled in the order of their penalties.
+ */
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp);
+                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                bool minimizePenalty = false);
 }  // namespace ps
 }  // namespace storm
@@ -18,6 +18,8 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mAlphaVariables;
     std::unordered_map<storm::storage::StateActionTarget, storm::expressions::Variable> mBetaVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mGammaVariables;
+    std::vector<uint_fast64_t> mEndComponentIndices;
+    bool mMinimizePenalty = false;
 
    public:
     SmtPermissiveSchedulerComputation(storm::solver::SmtSolver& smtSolver, storm::models::sparse::Mdp<double, RM> const& mdp,
@@ -33,6 +35,14 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
         mPerformedSmtLoop = true;
     }
 
+    /**
+     * If set, the penalty of the permissive scheduler is minimized by incrementally tightening a bound on the penalty.
+     * Otherwise, disabled state-action pairs are greedily enabled in the order of their penalties.
+     */
+    void setMinimizePenalty(bool minimizePenalty) {
+        mMinimizePenalty = minimizePenalty;
+    }
+
     bool foundSolution() const override {
         STORM_LOG_ASSERT(mPerformedSmtLoop, "SMT loop not performed.");
         return mFoundSolution;
@@ -53,7 +63,7 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
     /**
      *  Create variables
      */
-    void createVariables(storm::storage::BitVector const& relevantStates) {
+    void createVariables(storm::storage::BitVector const& relevantStates, bool lowerBound) {
         storm::expressions::Variable var;
         for (uint_fast64_t s : relevantStates) {
             // Create x_s variables
@@ -61,14 +71,17 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
             solver.add(var >= manager.rational(0));
             solver.add(var <= manager.rational(1));
             mProbVariables[s] = var;
-            // Create alpha_s variables
-            var = manager.declareBooleanVariable("alp_" + std::to_string(s));
-            mAlphaVariables[s] = var;
-            // Create gamma_s variables
-            var = manager.declareRationalVariable("gam_" + std::to_string(s));
-            solver.add(var >= manager.rational(0));
-            solver.add(var <= manager.rational(1));
-            mGammaVariables[s] = var;
+            bool progress = needsProgressConstraints(s, lowerBound);
+            if (progress) {
+                // Create alpha_s variables
+                var = manager.declareBooleanVariable("alp_" + std::to_string(s));
+                mAlphaVariables[s] = var;
+                // Create gamma_s variables
+                var = manager.declareRationalVariable("gam_" + std::to_string(s));
+                solver.add(var >= manager.rational(0));
+                solver.add(var <= manager.rational(1));
+                mGammaVariables[s] = var;
+            }
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 auto stateAndAction = storage::StateActionPair(s, a);
 
@@ -77,6 +90,9 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                 multistrategyVariables[stateAndAction] = var;
                 multistrategyVariablesToTakenMap[var] = false;
 
+                if (!progress) {
+                    continue;
+                }
                 // Create beta_(s,a,t) variables
                 // Iterate over successors of s via a.
                 for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
@@ -115,12 +131,6 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
             solver.add(storm::expressions::disjunction(expressions));
             expressions.clear();
 
-            // (5) These constraints are only necessary for lower-bounded properties.
-            if (lowerBound) {
-                //                        TODO
-                //                        solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
-            }
-
             // (3) For the relevant states.
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 std::string sastring(stateString + "_" + std::to_string(a));
@@ -142,57 +152,111 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                 expressions.clear();
             }
 
-            // (6) and (8) are only necessary for lower-bounded properties.
-            if (lowerBound) {
-                //                        TODO
-                //                        for(uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
-                //                            // (6)
-                //                            std::string sastring(stateString + "_" + std::to_string(a));
-                //                            expr = solver.getConstant(0.0);
-                //                            for(auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s]+a))
-                //                            {
-                //                                if(entry.getValue() != 0) {
-                //                                    storage::StateActionTarget sat = {s,a,entry.getColumn()};
-                //                                    expr = expr + mBetaVariables[sat];
-                //                                }
-                //                            }
-                //                            solver.addConstraint("c6-" + sastring, multistrategyVariables[storage::StateActionPair(s,a)] ==
-                //                            (solver.getConstant(1) - mAlphaVariables[s]) + expr);
-                //
-                //                            for(auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s]+a))
-                //                            {
-                //                                if(entry.getValue() != 0) {
-                //                                    storage::StateActionTarget sat = {s,a,entry.getColumn()};
-                //                                    std::string satstring = to_string(sat);
-                //                                    // (8)
-                //                                    if(relevantStates[entry.getColumn()]) {
-                //                                        STORM_LOG_ASSERT(mGammaVariables.count(entry.getColumn()) > 0, "Entry not found.");
-                //                                        STORM_LOG_ASSERT(mGammaVariables.count(s) > 0, "Entry not found.");
-                //                                        STORM_LOG_ASSERT(mBetaVariables.count(sat) > 0, "Entry not found.");
-                //                                        solver.addConstraint("c8-" + satstring, mGammaVariables[entry.getColumn()] < mGammaVariables[s] +
-                //                                        (solver.getConstant(1) - mBetaVariables[sat]) + mProbVariables[s]); // With rewards, we have to change
-                //                                        this.
-                //                                    }
-                //                                }
-                //                            }
-                //                        }
+            // (5), (6) and (8) are only necessary for lower-bounded properties and states in end components.
+            if (!needsProgressConstraints(s, lowerBound)) {
+                continue;
+            }
+            // (5)
+            solver.add(storm::expressions::implies(!mAlphaVariables[s], mProbVariables[s] <= manager.rational(0)));
+            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
+                // (6)
+                std::vector<storm::expressions::Expression> betaValues;
+                for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
+                    if (entry.getValue() != 0) {
+                        storage::StateActionTarget sat = {s, a, entry.getColumn()};
+                        betaValues.push_back(storm::expressions::ite(mBetaVariables[sat], manager.integer(1), manager.integer(0)));
+                    }
+                }
+                solver.add(storm::expressions::ite(multistrategyVariables[storage::StateActionPair(s, a)], manager.integer(1), manager.integer(0)) ==
+                           storm::expressions::ite(mAlphaVariables[s], manager.integer(0), manager.integer(1)) + storm::expressions::sum(betaValues));
+
+                for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
+                    if (entry.getValue() != 0) {
+                        storage::StateActionTarget sat = {s, a, entry.getColumn()};
+                        // (8) Paths can only cycle inside an end component.
+                        if (relevantStates[entry.getColumn()] && mEndComponentIndices[entry.getColumn()] == mEndComponentIndices[s]) {
+                            STORM_LOG_ASSERT(mGammaVariables.count(entry.getColumn()) > 0, "Entry not found.");
+                            STORM_LOG_ASSERT(mGammaVariables.count(s) > 0, "Entry not found.");
+                            STORM_LOG_ASSERT(mBetaVariables.count(sat) > 0, "Entry not found.");
+                            solver.add(storm::expressions::implies(mBetaVariables[sat],
+                                                                   mGammaVariables[entry.getColumn()].getExpression() < mGammaVariables[s].getExpression()));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Whether the state needs the variables and constraints that enforce progress towards the goal states.
+     */
+    bool needsProgressConstraints(uint_fast64_t state, bool lowerBound) const {
+        return lowerBound && mEndComponentIndices[state] != this->noEndComponent;
+    }
+
+    /**
+     * Retrieves the total penalty of the state-action pairs that are disabled in the given model.
+     */
+    double getPenalty(storm::solver::SmtSolver::ModelReference const& model, PermissiveSchedulerPenalties const& penalties) const {
+        double result = 0.0;
+        for (auto const& entry : multistrategyVariables) {
+            if (!model.getBooleanValue(entry.second)) {
+                result += penalties.get(entry.first);
             }
         }
+        return result;
     }
 
     /**
-     *
+     * Starting from the given solution, repeatedly asks for a solution with a smaller penalty. The solver keeps the constraints (and what it
+     * learned about them) between the calls, such that only the bound on the penalty has to be tightened.
+     */
+    void minimizePenalty(std::shared_ptr<storm::solver::SmtSolver::ModelReference> model, PermissiveSchedulerPenalties const& penalties) {
+        std::vector<storm::expressions::Expression> disabledPenalties;
+        for (auto const& entry : multistrategyVariables) {
+            disabledPenalties.push_back(storm::expressions::ite(entry.second, manager.rational(0), manager.rational(penalties.get(entry.first))));
+        }
+        storm::expressions::Expression penalty = storm::expressions::sum(disabledPenalties);
+
+        storm::solver::SmtSolver::CheckResult result;
+        uint_fast64_t iterations = 0;
+        do {
+            for (auto const& entry : multistrategyVariables) {
+                multistrategyVariablesToTakenMap[entry.second] = model->getBooleanValue(entry.second);
+            }
+            double currentPenalty = getPenalty(*model, penalties);
+            STORM_LOG_DEBUG("Found permissive scheduler with penalty " << currentPenalty << ".");
+            if (currentPenalty == 0.0) {
+                break;
+            }
+            solver.add(penalty < manager.rational(currentPenalty));
+            result = solver.check();
+            if (result == storm::solver::SmtSolver::CheckResult::Sat) {
+                model = solver.getModel();
+            }
+            ++iterations;
+        } while (result == storm::solver::SmtSolver::CheckResult::Sat);
+        STORM_LOG_WARN_COND(result != storm::solver::SmtSolver::CheckResult::Unknown, "SMT solver could not decide whether the penalty can be decreased.");
+        STORM_LOG_DEBUG("Tightened the penalty bound " << iterations << " times.");
+    }
+
+    /**
+     * Encode the problem and solve it. Only the states that are reachable from the initial state without passing through goal or sink
+     * states are encoded and the progress constraints are restricted to the states in end components.
      */
     void performSmtLoop(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
-        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
-        storm::storage::BitVector relevantStates = ~irrelevant;
-        createVariables(relevantStates);
+        storm::storage::BitVector relevantStates = this->computeRelevantStates();
+        mEndComponentIndices = this->computeEndComponentIndices(relevantStates);
+        createVariables(relevantStates, lowerBound);
         createConstraints(lowerBound, boundary, relevantStates);
 
         // Find the initial solution (if possible).
         storm::solver::SmtSolver::CheckResult result = solver.check();
 
-        if (result == storm::solver::SmtSolver::CheckResult::Sat) {
+        if (result == storm::solver::SmtSolver::CheckResult::Sat && mMinimizePenalty) {
+            minimizePenalty(solver.getModel(), penalties);
+            mFoundSolution = true;
+        } else if (result == storm::solver::SmtSolver::CheckResult::Sat) {
             // Extract the solution from the multi-strategy variables and track all state-action pairs that were
             // not taken. Also, we assert all decided choices, so they are not altered anymore.
             std::shared_ptr<storm::solver::SmtSolver::ModelReference> model = solver.getModel();
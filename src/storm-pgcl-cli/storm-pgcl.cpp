@@ -5,6 +5,7 @@
 #include "storm-cli-utilities/cli.h"
 #include "storm-pgcl/builder/JaniProgramGraphBuilder.h"
 #include "storm-pgcl/builder/ProgramGraphBuilder.h"
+#include "storm-pgcl/builder/ProgramGraphSimplifier.h"
 #include "storm/exceptions/BaseException.h"
 #include "storm/storage/jani/visitor/JSONExporter.h"
 #include "storm/utility/macros.h"
@@ -81,6 +82,9 @@ int main(const int argc, const char** argv) {
 
         storm::pgcl::PgclProgram prog = storm::parser::PgclParser::parse(pgcl.getPgclFilename());
         storm::ppg::ProgramGraph* progGraph = storm::builder::ProgramGraphBuilder::build(prog);
+        if (pgcl.isSimplifyProgramGraphSet()) {
+            storm::builder::ProgramGraphSimplifier::simplify(*progGraph);
+        }
 
         progGraph->printInfo(std::cout);
         if (pgcl.isProgramGraphToDotSet()) {
@@ -0,0 +1,393 @@
+#include "ProgramGraphSimplifier.h"
+
+#include <algorithm>
+#include <set>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+void ProgramGraphSimplifier::simplify(storm::ppg::ProgramGraph& graph) {
+    ProgramGraphSimplifier simplifier(graph);
+    uint64_t locationsBefore = graph.nrLocations();
+    bool changed = true;
+    while (changed) {
+        changed = simplifier.mergeStraightLineEdges();
+        changed |= simplifier.eliminateProbabilisticRetries();
+        changed |= simplifier.summarizeCountedLoops();
+    }
+    graph.removeUnusedActions();
+    STORM_LOG_INFO("Simplified program graph from " << locationsBefore << " to " << graph.nrLocations() << " locations.");
+}
+
+bool ProgramGraphSimplifier::mergeStraightLineEdges() {
+    bool changed = false;
+    std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t> incomingEdges = countIncomingEdges();
+    for (auto const& locId : getLocationIdentifiers()) {
+        // Merged locations are removed on the fly.
+        if (!graph.hasLocation(locId)) {
+            continue;
+        }
+        storm::ppg::ProgramLocation& source = graph.getLocation(locId);
+        bool singleEdgeGroup = source.nrOutgoingEdgeGroups() == 1;
+        for (auto const& edgegroup : source) {
+            for (auto const& edge : *edgegroup) {
+                while (mergeWithSuccessor(*edge, singleEdgeGroup, incomingEdges)) {
+                    changed = true;
+                }
+            }
+        }
+    }
+    return changed;
+}
+
+bool ProgramGraphSimplifier::mergeWithSuccessor(storm::ppg::ProgramEdge& edge, bool singleEdgeGroup,
+                                                std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t>& incomingEdges) {
+    storm::ppg::ProgramLocationIdentifier middleId = edge.getTargetId();
+    if (middleId == edge.getSourceId() || incomingEdges.at(middleId) != 1) {
+        return false;
+    }
+    storm::ppg::ProgramLocation& middle = graph.getLocation(middleId);
+    if (middle.isInitial() || !graph.getLabels(middleId).empty() || !middle.hasUniqueSuccessor() || (*middle.begin())->nrEdges() != 1) {
+        return false;
+    }
+    storm::ppg::ProgramEdge const& successor = **(*middle.begin())->begin();
+    if (!successor.getCondition().isTrue() || successor.getTargetId() == middleId) {
+        return false;
+    }
+
+    // The edges of probabilistic branches may not carry assignments, so these can only be redirected.
+    storm::ppg::ProgramActionIdentifier action;
+    if (hasNoEffect(successor.getActionId())) {
+        action = edge.getActionId();
+    } else if (!singleEdgeGroup) {
+        return false;
+    } else if (hasNoEffect(edge.getActionId())) {
+        action = successor.getActionId();
+    } else {
+        storm::ppg::DeterministicProgramAction const* first = getSingleLevelAction(edge.getActionId());
+        storm::ppg::DeterministicProgramAction const* second = getSingleLevelAction(successor.getActionId());
+        if (first == nullptr || second == nullptr) {
+            return false;
+        }
+        action = composeActions(*first, *second);
+    }
+    edge.setActionId(action);
+    edge.setTargetId(successor.getTargetId());
+    incomingEdges.erase(middleId);
+    graph.removeLocation(middleId);
+    return true;
+}
+
+bool ProgramGraphSimplifier::eliminateProbabilisticRetries() {
+    bool changed = false;
+    storm::expressions::ExpressionManager const& manager = *graph.getExpressionManager();
+    std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t> incomingEdges = countIncomingEdges();
+    for (auto const& locId : getLocationIdentifiers()) {
+        storm::ppg::ProgramLocation& location = graph.getLocation(locId);
+        if (location.nrOutgoingEdgeGroups() < 2 || location.hasNonDeterminism()) {
+            continue;
+        }
+        // The probabilities need to be constant, such that we can check that the retries do not absorb all the probability mass.
+        bool constantProbabilities = true;
+        storm::RationalNumber retryProbability = storm::utility::zero<storm::RationalNumber>();
+        std::vector<std::pair<storm::ppg::ProgramEdgeGroupIdentifier, storm::ppg::ProgramLocationIdentifier>> retries;
+        for (auto const& edgegroup : location) {
+            if (edgegroup->getProbability().containsVariables()) {
+                constantProbabilities = false;
+                break;
+            }
+            if (edgegroup->nrEdges() == 1 && isRetry(**edgegroup->begin(), incomingEdges)) {
+                retryProbability += edgegroup->getProbability().evaluateAsRational();
+                retries.emplace_back(edgegroup->getId(), (*edgegroup->begin())->getTargetId());
+            }
+        }
+        if (!constantProbabilities || retries.empty() || retryProbability >= storm::utility::one<storm::RationalNumber>()) {
+            continue;
+        }
+
+        for (auto const& retry : retries) {
+            location.removeEdgeGroup(retry.first);
+            --incomingEdges.at(retry.second);
+        }
+        if (location.nrOutgoingEdgeGroups() == 1) {
+            (*location.begin())->setProbability(manager.rational(1));
+        } else {
+            storm::expressions::Expression normalization = manager.rational(storm::utility::one<storm::RationalNumber>() - retryProbability);
+            for (auto const& edgegroup : location) {
+                edgegroup->setProbability((edgegroup->getProbability() / normalization).simplify());
+            }
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+bool ProgramGraphSimplifier::isRetry(storm::ppg::ProgramEdge const& edge,
+                                     std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t> const& incomingEdges) {
+    if (!edge.getCondition().isTrue() || !hasNoEffect(edge.getActionId())) {
+        return false;
+    }
+    storm::ppg::ProgramLocationIdentifier branchId = edge.getSourceId();
+    if (edge.getTargetId() == branchId) {
+        return true;
+    }
+
+    // Otherwise, the edge has to lead to the head of a loop, whose body starts with the branch. If the branch can only be reached via the loop head,
+    // the loop condition still holds when returning to the head, so the body is entered again right away.
+    storm::ppg::ProgramLocation& head = graph.getLocation(edge.getTargetId());
+    if (head.nrOutgoingEdgeGroups() != 1 || incomingEdges.at(branchId) != 1) {
+        return false;
+    }
+    storm::ppg::ProgramEdge const* bodyEdge = nullptr;
+    for (auto const& headEdge : **head.begin()) {
+        if (headEdge->getTargetId() == branchId) {
+            bodyEdge = headEdge;
+        }
+    }
+    if (bodyEdge == nullptr || !hasNoEffect(bodyEdge->getActionId())) {
+        return false;
+    }
+    storm::expressions::Expression exitCondition = !bodyEdge->getCondition();
+    for (auto const& headEdge : **head.begin()) {
+        if (headEdge != bodyEdge && !headEdge->getCondition().isSyntacticallyEqual(exitCondition)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ProgramGraphSimplifier::summarizeCountedLoops() {
+    bool changed = false;
+    for (auto const& locId : getLocationIdentifiers()) {
+        storm::ppg::ProgramLocation& head = graph.getLocation(locId);
+        if (head.nrOutgoingEdgeGroups() != 1 || (*head.begin())->nrEdges() != 2) {
+            continue;
+        }
+        storm::ppg::ProgramEdge* loopEdge = *(*head.begin())->begin();
+        storm::ppg::ProgramEdge* exitEdge = *((*head.begin())->begin() + 1);
+        if (exitEdge->getTargetId() == locId) {
+            std::swap(loopEdge, exitEdge);
+        }
+        if (loopEdge->getTargetId() != locId || exitEdge->getTargetId() == locId || !exitEdge->getCondition().isSyntacticallyEqual(!loopEdge->getCondition())) {
+            continue;
+        }
+        storm::ppg::DeterministicProgramAction const* body = getSingleLevelAction(loopEdge->getActionId());
+        storm::ppg::DeterministicProgramAction const* exitAction = nullptr;
+        if (!hasNoEffect(exitEdge->getActionId())) {
+            exitAction = getSingleLevelAction(exitEdge->getActionId());
+        }
+        if (body == nullptr || (exitAction == nullptr && !hasNoEffect(exitEdge->getActionId()))) {
+            continue;
+        }
+
+        boost::optional<storm::ppg::ProgramActionIdentifier> summary = summarizeLoop(loopEdge->getCondition(), *body);
+        if (!summary) {
+            continue;
+        }
+        storm::ppg::ProgramActionIdentifier action = summary.get();
+        if (exitAction != nullptr) {
+            action = composeActions(static_cast<storm::ppg::DeterministicProgramAction const&>(graph.getAction(action)), *exitAction);
+        }
+        // The summarizing edge is only taken if the loop is entered at all; otherwise, the exit edge remains.
+        loopEdge->setActionId(action);
+        loopEdge->setTargetId(exitEdge->getTargetId());
+        changed = true;
+    }
+    return changed;
+}
+
+boost::optional<storm::ppg::ProgramActionIdentifier> ProgramGraphSimplifier::summarizeLoop(storm::expressions::Expression const& condition,
+                                                                                           storm::ppg::DeterministicProgramAction const& body) {
+    storm::expressions::ExpressionManager const& manager = *graph.getExpressionManager();
+    std::set<storm::expressions::Variable> assigned;
+    for (auto const& group : body) {
+        for (auto const& assignment : group) {
+            assigned.insert(graph.getVariables().at(assignment.first));
+        }
+    }
+
+    // The loop condition needs to compare the counter with a loop-invariant bound.
+    if (!condition.isRelationalExpression()) {
+        return boost::none;
+    }
+    storm::expressions::Expression counter = condition.getOperand(0);
+    storm::expressions::Expression bound = condition.getOperand(1);
+    storm::expressions::OperatorType relation = condition.getOperator();
+    if (!counter.isVariable()) {
+        std::swap(counter, bound);
+        if (relation == storm::expressions::OperatorType::Less) {
+            relation = storm::expressions::OperatorType::Greater;
+        } else if (relation == storm::expressions::OperatorType::LessOrEqual) {
+            relation = storm::expressions::OperatorType::GreaterOrEqual;
+        } else if (relation == storm::expressions::OperatorType::Greater) {
+            relation = storm::expressions::OperatorType::Less;
+        } else if (relation == storm::expressions::OperatorType::GreaterOrEqual) {
+            relation = storm::expressions::OperatorType::LessOrEqual;
+        }
+    }
+    if (!counter.isVariable() || !counter.hasIntegerType() || !bound.hasIntegerType() || bound.containsVariable(assigned)) {
+        return boost::none;
+    }
+    storm::expressions::Variable const& counterVariable = counter.getBaseExpression().asVariableExpression().getVariable();
+
+    // Every variable either needs to be incremented by a loop-invariant amount or assigned a loop-invariant value.
+    std::vector<storm::ppg::ProgramVariableIdentifier> rewards = graph.rewardVariables();
+    std::map<storm::ppg::ProgramVariableIdentifier, storm::expressions::Expression> increments;
+    std::map<storm::ppg::ProgramVariableIdentifier, storm::expressions::Expression> invariantAssignments;
+    for (auto const& group : body) {
+        for (auto const& assignment : group) {
+            storm::expressions::Variable const& variable = graph.getVariables().at(assignment.first);
+            storm::expressions::Expression const& expression = assignment.second;
+            if (!expression.containsVariable(assigned)) {
+                invariantAssignments.emplace(assignment.first, expression);
+                continue;
+            }
+            // Summing up reward variables would make them look like ordinary variables to the JANI builder.
+            if (std::find(rewards.begin(), rewards.end(), assignment.first) != rewards.end()) {
+                return boost::none;
+            }
+            if (!variable.hasIntegerType() || !expression.hasIntegerType() || !expression.isLinear()) {
+                return boost::none;
+            }
+            std::map<storm::expressions::Variable, storm::expressions::Expression> variableAtZero = {{variable, manager.integer(0)}};
+            std::map<storm::expressions::Variable, storm::expressions::Expression> atZero;
+            std::map<storm::expressions::Variable, storm::expressions::Expression> atOne;
+            for (auto const& readVariable : expression.getVariables()) {
+                if (readVariable != variable && assigned.count(readVariable) > 0) {
+                    return boost::none;
+                }
+                atZero.emplace(readVariable, manager.integer(0));
+                atOne.emplace(readVariable, readVariable == variable ? manager.integer(1) : manager.integer(0));
+            }
+            // As the expression is linear, the coefficient of the variable does not depend on the other variables.
+            if (expression.substitute(atOne).evaluateAsInt() - expression.substitute(atZero).evaluateAsInt() != 1) {
+                return boost::none;
+            }
+            increments.emplace(assignment.first, expression.substitute(variableAtZero).simplify());
+        }
+    }
+    auto counterIncrement = increments.find(counterVariable.getIndex());
+    if (counterIncrement == increments.end() || counterIncrement->second.containsVariables()) {
+        return boost::none;
+    }
+
+    // Determine the number of iterations, which is positive whenever the loop condition holds.
+    int64_t step = counterIncrement->second.evaluateAsInt();
+    storm::expressions::Expression distance;
+    if (step > 0 && (relation == storm::expressions::OperatorType::Less || relation == storm::expressions::OperatorType::LessOrEqual)) {
+        distance = bound - counter;
+    } else if (step < 0 && (relation == storm::expressions::OperatorType::Greater || relation == storm::expressions::OperatorType::GreaterOrEqual)) {
+        distance = counter - bound;
+    } else {
+        return boost::none;
+    }
+    bool strict = relation == storm::expressions::OperatorType::Less || relation == storm::expressions::OperatorType::Greater;
+    int64_t stepSize = std::abs(step);
+    storm::expressions::Expression iterations;
+    if (stepSize == 1) {
+        iterations = strict ? distance : distance + 1;
+    } else if (strict) {
+        iterations = storm::expressions::ceil(distance / manager.rational(static_cast<double>(stepSize)));
+    } else {
+        iterations = storm::expressions::floor(distance / manager.rational(static_cast<double>(stepSize))) + 1;
+    }
+
+    storm::ppg::DeterministicProgramAction* summary = graph.addDeterministicAction();
+    for (auto const& increment : increments) {
+        storm::expressions::Expression current = graph.getVariables().at(increment.first).getExpression();
+        summary->addAssignment(increment.first, (current + increment.second * iterations).simplify());
+    }
+    for (auto const& assignment : invariantAssignments) {
+        summary->addAssignment(assignment.first, assignment.second);
+    }
+    return summary->id();
+}
+
+storm::ppg::ProgramActionIdentifier ProgramGraphSimplifier::composeActions(storm::ppg::DeterministicProgramAction const& first,
+                                                                           storm::ppg::DeterministicProgramAction const& second) {
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution = getSubstitution(first);
+    storm::ppg::DeterministicProgramAction* composed = graph.addDeterministicAction();
+    std::set<storm::ppg::ProgramVariableIdentifier> assignedBySecond;
+    for (auto const& group : second) {
+        for (auto const& assignment : group) {
+            composed->addAssignment(assignment.first, assignment.second.substitute(substitution).simplify());
+            assignedBySecond.insert(assignment.first);
+        }
+    }
+    for (auto const& group : first) {
+        for (auto const& assignment : group) {
+            if (assignedBySecond.count(assignment.first) == 0) {
+                composed->addAssignment(assignment.first, assignment.second);
+            }
+        }
+    }
+    return composed->id();
+}
+
+storm::ppg::DeterministicProgramAction const* ProgramGraphSimplifier::getSingleLevelAction(storm::ppg::ProgramActionIdentifier id) const {
+    if (!graph.isDeterministicAction(id)) {
+        return nullptr;
+    }
+    storm::ppg::DeterministicProgramAction const& action = static_cast<storm::ppg::DeterministicProgramAction const&>(graph.getAction(id));
+    return action.nrLevels() <= 1 ? &action : nullptr;
+}
+
+bool ProgramGraphSimplifier::hasNoEffect(storm::ppg::ProgramActionIdentifier id) const {
+    if (id == graph.getNoActionId()) {
+        return true;
+    }
+    if (!graph.isDeterministicAction(id)) {
+        return false;
+    }
+    for (auto const& group : static_cast<storm::ppg::DeterministicProgramAction const&>(graph.getAction(id))) {
+        for (auto const& assignment : group) {
+            if (!assignment.second.isVariable() || assignment.second.getBaseExpression().asVariableExpression().getVariable().getIndex() != assignment.first) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::map<storm::expressions::Variable, storm::expressions::Expression> ProgramGraphSimplifier::getSubstitution(
+    storm::ppg::DeterministicProgramAction const& action) const {
+    std::map<storm::expressions::Variable, storm::expressions::Expression> result;
+    for (auto const& group : action) {
+        for (auto const& assignment : group) {
+            result.emplace(graph.getVariables().at(assignment.first), assignment.second);
+        }
+    }
+    return result;
+}
+
+std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t> ProgramGraphSimplifier::countIncomingEdges() const {
+    std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t> result;
+    for (auto it = graph.locationBegin(); it != graph.locationEnd(); ++it) {
+        result.emplace(it->first, 0);
+    }
+    for (auto it = graph.locationBegin(); it != graph.locationEnd(); ++it) {
+        for (auto const& edgegroup : it->second) {
+            for (auto const& edge : *edgegroup) {
+                ++result.at(edge->getTargetId());
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<storm::ppg::ProgramLocationIdentifier> ProgramGraphSimplifier::getLocationIdentifiers() const {
+    std::vector<storm::ppg::ProgramLocationIdentifier> result;
+    for (auto it = graph.locationBegin(); it != graph.locationEnd(); ++it) {
+        result.push_back(it->first);
+    }
+    return result;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm-pgcl/storage/ppg/ProgramGraph.h"
+
+namespace storm {
+namespace builder {
+
+/**
+ * Shrinks a program graph before it is translated to JANI. The simplifier
+ *  - merges straight-line sequences of edges into single edges,
+ *  - folds probabilistic branches that restart a loop iteration without any effect into the remaining branches (summing up the geometric series),
+ *  - replaces counted loops, in which every variable is incremented by a loop-invariant amount or assigned a loop-invariant value,
+ *    by a single edge with closed-form updates.
+ * The distribution over the terminal locations and valuations is preserved, the number of steps to get there is not.
+ */
+class ProgramGraphSimplifier {
+   public:
+    /**
+     * Simplifies the given program graph in place.
+     */
+    static void simplify(storm::ppg::ProgramGraph& graph);
+
+   private:
+    ProgramGraphSimplifier(storm::ppg::ProgramGraph& graph) : graph(graph) {
+        // Intentionally left empty.
+    }
+
+    /**
+     * Merges edges leading to a location that has no other incoming edge and a single unguarded outgoing edge with this outgoing edge.
+     * @return True iff the graph was changed.
+     */
+    bool mergeStraightLineEdges();
+
+    /**
+     * Merges the given edge with the outgoing edge of its target location, if possible.
+     * @return True iff the edge was merged.
+     */
+    bool mergeWithSuccessor(storm::ppg::ProgramEdge& edge, bool singleEdgeGroup,
+                            std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t>& incomingEdges);
+
+    /**
+     * Removes the probabilistic branches that restart the current loop iteration without any effect.
+     * The remaining branches are eventually taken with probability p / (1 - q), where q is the probability of the removed branches.
+     * @return True iff the graph was changed.
+     */
+    bool eliminateProbabilisticRetries();
+
+    /**
+     * Checks whether taking the given edge leads back to its source location without any effect.
+     */
+    bool isRetry(storm::ppg::ProgramEdge const& edge, std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t> const& incomingEdges);
+
+    /**
+     * Replaces the self-loops of counted loops by an edge that performs all iterations at once.
+     * @return True iff the graph was changed.
+     */
+    bool summarizeCountedLoops();
+
+    /**
+     * Creates an action that applies the given loop body as long as the given condition holds.
+     * @return The identifier of the action or none, if the loop is not of the supported form.
+     */
+    boost::optional<storm::ppg::ProgramActionIdentifier> summarizeLoop(storm::expressions::Expression const& condition,
+                                                                       storm::ppg::DeterministicProgramAction const& body);
+
+    /**
+     * Creates an action that executes the first and then the second action.
+     */
+    storm::ppg::ProgramActionIdentifier composeActions(storm::ppg::DeterministicProgramAction const& first,
+                                                       storm::ppg::DeterministicProgramAction const& second);
+
+    /**
+     * Retrieves the deterministic action with the given identifier, if it consists of at most one assignment level.
+     * @return The action or nullptr, if there is no such action.
+     */
+    storm::ppg::DeterministicProgramAction const* getSingleLevelAction(storm::ppg::ProgramActionIdentifier id) const;
+
+    /**
+     * Checks whether the action with the given identifier leaves all variables unchanged.
+     */
+    bool hasNoEffect(storm::ppg::ProgramActionIdentifier id) const;
+
+    std::map<storm::expressions::Variable, storm::expressions::Expression> getSubstitution(storm::ppg::DeterministicProgramAction const& action) const;
+    std::unordered_map<storm::ppg::ProgramLocationIdentifier, uint64_t> countIncomingEdges() const;
+    std::vector<storm::ppg::ProgramLocationIdentifier> getLocationIdentifiers() const;
+
+    /// The program graph to simplify.
+    storm::ppg::ProgramGraph& graph;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -22,6 +22,7 @@ const std::string PGCLSettings::programGraphToDotOptionName = "draw-program-grap
 const std::string PGCLSettings::programGraphToDotShortOptionName = "pg";
 const std::string PGCLSettings::programVariableRestrictionsOptionName = "variable-restrictions";
 const std::string PGCLSettings::programVariableRestrictionShortOptionName = "rvar";
+const std::string PGCLSettings::simplifyProgramGraphOptionName = "simplify-program-graph";
 const std::string PGCLSettings::propertyOptionName = "prop";
 const std::string PGCLSettings::propertyOptionShortName = "prop";
 
@@ -46,6 +47,10 @@ PGCLSettings::PGCLSettings() : ModuleSettings(moduleName) {
                         .setShortName(programVariableRestrictionShortOptionName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("description", "description of the variable restrictions").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simplifyProgramGraphOptionName, false,
+                                                   "Merges straight-line code and summarizes counted and probabilistic loops in the program graph. "
+                                                   "Preserves the terminal distribution, but not the number of steps.")
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, propertyOptionName, false, "Specifies the properties to be checked on the model.")
             .setShortName(propertyOptionShortName)
@@ -90,6 +95,10 @@ std::string PGCLSettings::getProgramVariableRestrictions() const {
     return this->getOption(programVariableRestrictionsOptionName).getArgumentByName("description").getValueAsString();
 }
 
+bool PGCLSettings::isSimplifyProgramGraphSet() const {
+    return this->getOption(simplifyProgramGraphOptionName).getHasOptionBeenSet();
+}
+
 bool PGCLSettings::isPropertyInputSet() const {
     return this->getOption(propertyOptionName).getHasOptionBeenSet();
 }
@@ -53,6 +53,11 @@ class PGCLSettings : public ModuleSettings {
      */
     std::string getProgramVariableRestrictions() const;
 
+    /**
+     * Whether the program graph should be simplified (merging straight-line code and summarizing loops) before it is transformed
+     */
+    bool isSimplifyProgramGraphSet() const;
+
     /*!
      * Retrieves whether the property option was set.
      *
@@ -88,6 +93,7 @@ class PGCLSettings : public ModuleSettings {
     static const std::string programGraphToDotShortOptionName;
     static const std::string programVariableRestrictionsOptionName;
     static const std::string programVariableRestrictionShortOptionName;
+    static const std::string simplifyProgramGraphOptionName;
     static const std::string propertyOptionName;
     static const std::string propertyOptionShortName;
 };
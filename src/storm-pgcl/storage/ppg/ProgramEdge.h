@@ -33,6 +33,14 @@ class ProgramEdge {
         return action;
     }
 
+    void setTargetId(ProgramLocationIdentifier targetId) {
+        target = targetId;
+    }
+
+    void setActionId(ProgramActionIdentifier actionId) {
+        action = actionId;
+    }
+
     virtual ~ProgramEdge() {
         // Intentionally left empty.
     }
@@ -58,6 +58,10 @@ class ProgramEdgeGroup {
         return probability;
     }
 
+    void setProbability(storm::expressions::Expression const& newProbability) {
+        probability = newProbability;
+    }
+
     ProgramGraph const& getGraph() const {
         return *graph;
     }
@@ -165,17 +165,30 @@ std::vector<ProgramVariableIdentifier> ProgramGraph::variablesNotInGuards() cons
     return result;
 }
 
-//        void ProgramGraph::mergeActions() {
-//            auto initialLocs = initialLocations();
-//            assert(initialLocs.size() == 1);
-//            // For now, we only follow the unique path.
-//            ProgramLocationIdentifier currentLocId = initialLocs.front();
-//            while(locations.at(currentLocId).hasUniqueSuccessor()) {
-//                auto& edgeGroup = **locations.at(currentLocId()).begin();
-//                auto& edge = **edgeGroup.begin();
-//
-//            }
-//        }
+void ProgramGraph::removeUnusedActions() {
+    std::set<ProgramActionIdentifier> used = {noActionId};
+    for (auto const& loc : locations) {
+        for (auto const& edgegroup : loc.second) {
+            for (auto const& edge : *edgegroup) {
+                used.insert(edge->getActionId());
+            }
+        }
+    }
+    for (auto it = deterministicActions.begin(); it != deterministicActions.end();) {
+        if (used.count(it->first) == 0) {
+            it = deterministicActions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = probabilisticActions.begin(); it != probabilisticActions.end();) {
+        if (used.count(it->first) == 0) {
+            it = probabilisticActions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
 
 void ProgramGraph::printDot(std::ostream& os) const {
     os << "digraph ppg {\n";
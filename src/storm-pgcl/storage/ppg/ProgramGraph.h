@@ -139,6 +139,25 @@ class ProgramGraph {
         return hasSuccessfulTerminationLabel(loc) || hasAbortLabel(loc);
     }
 
+    ProgramLocation& getLocation(ProgramLocationIdentifier id) {
+        return locations.at(id);
+    }
+
+    /**
+     * Removes the location with the given identifier together with its outgoing edges.
+     * Edges leading to the location have to be redirected beforehand.
+     */
+    void removeLocation(ProgramLocationIdentifier id) {
+        assert(hasLocation(id));
+        locations.erase(id);
+        locationLabels.erase(id);
+    }
+
+    /**
+     * Removes all actions that are not attached to an edge anymore.
+     */
+    void removeUnusedActions();
+
     ProgramActionIdentifier getNoActionId() const {
         return noActionId;
     }
@@ -268,10 +287,6 @@ class ProgramGraph {
     std::pair<bool, bool> checkIfRewardVariableHelper(storm::expressions::Variable const& var,
                                                       std::unordered_map<ProgramActionIdentifier, DeterministicProgramAction> const& detActions) const;
 
-    ProgramLocation& getLocation(ProgramLocationIdentifier id) {
-        return locations.at(id);
-    }
-
     /**
      * Gets a free location index (based on whatever scheme we are using).
      */
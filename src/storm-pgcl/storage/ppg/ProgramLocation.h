@@ -30,6 +30,20 @@ class ProgramLocation {
         return edgeGroups.back();
     }
 
+    /**
+     * Removes the outgoing edge group with the given identifier (and all its edges).
+     */
+    void removeEdgeGroup(ProgramEdgeGroupIdentifier id) {
+        for (auto it = edgeGroups.begin(); it != edgeGroups.end(); ++it) {
+            if ((*it)->getId() == id) {
+                delete *it;
+                edgeGroups.erase(it);
+                return;
+            }
+        }
+        assert(false);
+    }
+
     bool isInitial() const {
         return init;
     }
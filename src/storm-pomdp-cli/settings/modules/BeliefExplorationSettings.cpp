@@ -21,6 +21,7 @@ namespace storm {
             
             const std::string refineOption = "refine";
             const std::string explorationTimeLimitOption = "exploration-time";
+            const std::string explorationMemoryLimitOption = "exploration-memory";
             const std::string resolutionOption = "resolution";
             const std::string sizeThresholdOption = "size-threshold";
             const std::string gapThresholdOption = "gap-threshold";
@@ -28,6 +29,9 @@ namespace storm {
             const std::string observationThresholdOption = "obs-threshold";
             const std::string numericPrecisionOption = "numeric-precision";
             const std::string triangulationModeOption = "triangulationmode";
+            const std::string concurrentRefinementOption = "concurrent";
+            const std::string expansionThreadsOption = "expansion-threads";
+            const std::string explorationOrderOption = "exploration-order";
 
             BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
                 
@@ -35,6 +39,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationTimeLimitOption, false, "Sets after which time no further states shall be explored.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time","In seconds.").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationMemoryLimitOption, false, "Sets how much memory the beliefs and the explored MDP may take (per approximation) before no further states are explored.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("memory","In megabytes.").addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, resolutionOption, false,"Sets the resolution of the discretization and how it is increased in case of refinement").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("init","the initial resolution (higher means more precise)").setDefaultValueUnsignedInteger(3).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("factor","Multiplied to the resolution of refined observations (higher means more precise).").setDefaultValueDouble(2).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterValidator(1)).build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, observationThresholdOption, false,"Only observations whose score is below this threshold will be refined.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("init","initial threshold (higher means more precise").setDefaultValueDouble(0.1).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0,1)).build()).addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("factor","Controlls how fast the threshold is increased in each refinement step (higher means more precise).").setDefaultValueDouble(0.1).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0,1)).build()).build());
@@ -50,6 +56,14 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, triangulationModeOption, false,"Sets how to triangulate beliefs when discretizing.").setIsAdvanced().addArgument(
                         storm::settings::ArgumentBuilder::createStringArgument("value","the triangulation mode").setDefaultValueString("dynamic").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"dynamic", "static"})).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, concurrentRefinementOption, false,"If set, the over- and the under-approximation are refined concurrently in two threads.").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, expansionThreadsOption, false,"Sets the number of threads that compute the successor beliefs and their triangulations when building the over-approximation.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number","the number of threads").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOption, false,"Sets the order in which beliefs are explored. 'heuristic' prefers beliefs with a large gap between the value bounds that are reached with a high probability.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createStringArgument("value","the exploration order").setDefaultValueString("bfs").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"bfs", "heuristic"})).build()).build());
             }
 
             bool BeliefExplorationSettings::isRefineSet() const {
@@ -77,6 +91,14 @@ namespace storm {
                 return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
             }
             
+            bool BeliefExplorationSettings::isExplorationMemoryLimitSet() const {
+                return this->getOption(explorationMemoryLimitOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t BeliefExplorationSettings::getExplorationMemoryLimit() const {
+                return this->getOption(explorationMemoryLimitOption).getArgumentByName("memory").getValueAsUnsignedInteger();
+            }
+            
             uint64_t BeliefExplorationSettings::getResolutionInit() const {
                 return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
             }
@@ -133,6 +155,18 @@ namespace storm {
                 return this->getOption(triangulationModeOption).getArgumentByName("value").getValueAsString() == "static";
             }
             
+            bool BeliefExplorationSettings::isConcurrentRefinementSet() const {
+                return this->getOption(concurrentRefinementOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t BeliefExplorationSettings::getExpansionThreads() const {
+                return this->getOption(expansionThreadsOption).getArgumentByName("number").getValueAsUnsignedInteger();
+            }
+            
+            bool BeliefExplorationSettings::isHeuristicExplorationOrderSet() const {
+                return this->getOption(explorationOrderOption).getArgumentByName("value").getValueAsString() == "heuristic";
+            }
+            
             template<typename ValueType>
             void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
                 options.refine = isRefineSet();
@@ -147,6 +181,11 @@ namespace storm {
                 } else {
                     options.explorationTimeLimit = boost::none;
                 }
+                if (isExplorationMemoryLimitSet()) {
+                    options.explorationMemoryLimit = getExplorationMemoryLimit();
+                } else {
+                    options.explorationMemoryLimit = boost::none;
+                }
                 options.resolutionInit = getResolutionInit();
                 options.resolutionFactor = storm::utility::convertNumber<ValueType>(getResolutionFactor());
                 options.sizeThresholdInit = getSizeThresholdInit();
@@ -168,6 +207,9 @@ namespace storm {
                     }
                 }
                 options.dynamicTriangulation = isDynamicTriangulationModeSet();
+                options.concurrentRefinement = isConcurrentRefinementSet();
+                options.expansionThreads = getExpansionThreads();
+                options.heuristicSearchExploration = isHeuristicExplorationOrderSet();
             }
             
             template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double>& options) const;
@@ -35,6 +35,9 @@ namespace storm {
                 bool isExplorationTimeLimitSet() const;
                 uint64_t getExplorationTimeLimit() const;
                 
+                bool isExplorationMemoryLimitSet() const;
+                uint64_t getExplorationMemoryLimit() const;
+                
                 /// Discretization Resolution
                 uint64_t getResolutionInit() const;
                 double getResolutionFactor() const;
@@ -60,6 +63,15 @@ namespace storm {
                 
                 bool isDynamicTriangulationModeSet() const;
                 bool isStaticTriangulationModeSet() const;
+                
+                /// Controls whether the over- and the under-approximation are refined concurrently
+                bool isConcurrentRefinementSet() const;
+                
+                /// The number of threads that compute successor beliefs and triangulations
+                uint64_t getExpansionThreads() const;
+                
+                /// Controls whether beliefs are explored in a heuristic search order instead of breadth-first
+                bool isHeuristicExplorationOrderSet() const;
     
                 template<typename ValueType>
                 void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
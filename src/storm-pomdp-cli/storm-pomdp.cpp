@@ -26,6 +26,7 @@
 #include "storm-pomdp/analysis/FormulaInformation.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 
 #include "storm/api/storm.h"
@@ -243,6 +244,32 @@ namespace storm {
                             search.getStatistics().print();
                         }
 
+                    } else if (qualSettings.getMemlessSearchMethod() == "portfolio") {
+                        // Runs the iterative search with several encodings of the lookahead in parallel
+                        storm::pomdp::MemlessSearchOptions options = fillMemlessSearchOptionsFromSettings();
+                        storm::pomdp::PolicySearchPortfolio<ValueType> portfolio(pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory,
+                                                                                 storm::pomdp::PolicySearchPortfolio<ValueType>::createDefaultConfigurations(options, lookahead));
+                        if (qualSettings.isWinningRegionSet()) {
+                            portfolio.computeWinningRegion();
+                        } else {
+                            bool result = portfolio.analyzeForInitialStates();
+                            if (result) {
+                                STORM_PRINT_AND_LOG("From initial state, one can almost-surely reach the target.\n");
+                            } else {
+                                STORM_PRINT_AND_LOG("From initial state, one may not almost-surely reach the target.\n");
+                            }
+                        }
+                        if (qualSettings.isPrintWinningRegionSet()) {
+                            portfolio.getLastWinningRegion().print();
+                            std::cout << '\n';
+                        }
+                        if (qualSettings.isExportWinningRegionSet()) {
+                            std::size_t hash = pomdp.hash();
+                            portfolio.getLastWinningRegion().storeToFile(qualSettings.exportWinningRegionPath(), "model hash: " + std::to_string(hash));
+                        }
+                        if (coreSettings.isShowStatisticsSet()) {
+                            STORM_PRINT_AND_LOG("#STATS Number of belief support states: " << portfolio.getLastWinningRegion().beliefSupportStates() << '\n');
+                        }
                     } else {
                         STORM_LOG_ERROR("This method is not implemented.");
                     }
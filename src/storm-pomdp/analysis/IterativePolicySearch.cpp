@@ -31,6 +31,33 @@ namespace storm::pomdp {
             }
         }
 
+        PolicySearchExchange::PolicySearchExchange(std::vector<uint64_t> const& observationSizes) : winningRegion(observationSizes), stopped(false) {
+            // Intentionally left empty.
+        }
+
+        void PolicySearchExchange::publish(WinningRegion const& region) {
+            std::lock_guard<std::mutex> lock(mutex);
+            winningRegion.join(region);
+        }
+
+        bool PolicySearchExchange::retrieve(WinningRegion& region) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return region.join(winningRegion);
+        }
+
+        WinningRegion PolicySearchExchange::getWinningRegion() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return winningRegion;
+        }
+
+        void PolicySearchExchange::stop() {
+            stopped = true;
+        }
+
+        bool PolicySearchExchange::isStopped() const {
+            return stopped;
+        }
+
         template <typename ValueType>
         void IterativePolicySearch<ValueType>::Statistics::print() const {
             STORM_PRINT_AND_LOG("#STATS Total time: " << totalTimer << '\n');
@@ -383,6 +410,11 @@ namespace storm::pomdp {
             STORM_LOG_DEBUG("Surely reach sink states: " << surelyReachSinkStates);
             STORM_LOG_DEBUG("Target states " << targetStates);
             STORM_LOG_DEBUG("Questionmark states " << (~surelyReachSinkStates & ~targetStates));
+            stopped = false;
+            if (checkStopped()) {
+                return false;
+            }
+            synchronizeWinningRegion();
             stats.initializeSolverTimer.start();
             // TODO: When do we need to reinitialize? When the solver has been reset.
             bool lookaheadConstraintsRequired = initialize(k);
@@ -527,6 +559,9 @@ namespace storm::pomdp {
 
             bool foundWhatWeLookFor = false;
             while(true) {
+                if (checkStopped()) {
+                    return false;
+                }
                 stats.incrementOuterIterations();
                 // TODO consider what we really want to store about the schedulers.
                 scheduler.reset(pomdp.getNrObservations(), maximalNrActions);
@@ -551,6 +586,9 @@ namespace storm::pomdp {
 
                     bool foundScheduler = foundWhatWeLookFor;
                     if (!foundScheduler) {
+                        if (checkStopped()) {
+                            return false;
+                        }
                         foundScheduler = this->smtCheck(iterations);
                     }
                     if (!foundScheduler) {
@@ -720,6 +758,9 @@ namespace storm::pomdp {
                     }
                 }
                 stats.winningRegionUpdatesTimer.stop();
+                if (exchange && !updated.empty()) {
+                    exchange->publish(winningRegion);
+                }
                 if (foundWhatWeLookFor) {
                     return true;
                 }
@@ -909,6 +950,43 @@ namespace storm::pomdp {
             return stats;
         }
 
+        template<typename ValueType>
+        void IterativePolicySearch<ValueType>::setExchange(std::shared_ptr<PolicySearchExchange> const& exchange) {
+            this->exchange = exchange;
+        }
+
+        template<typename ValueType>
+        bool IterativePolicySearch<ValueType>::wasStopped() const {
+            return stopped;
+        }
+
+        template<typename ValueType>
+        void IterativePolicySearch<ValueType>::synchronizeWinningRegion() {
+            if (!exchange) {
+                return;
+            }
+            exchange->publish(winningRegion);
+            if (exchange->retrieve(winningRegion)) {
+                STORM_LOG_DEBUG("Winning region was extended by the shared winning region.");
+                for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+                    if (winningRegion.observationIsWinning(observation)) {
+                        for (uint64_t state : statesPerObservation[observation]) {
+                            targetStates.set(state);
+                        }
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        bool IterativePolicySearch<ValueType>::checkStopped() {
+            if (exchange && exchange->isStopped()) {
+                STORM_LOG_INFO("Policy search was stopped.");
+                stopped = true;
+            }
+            return stopped;
+        }
+
         template <typename ValueType>
         bool IterativePolicySearch<ValueType>::smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions) {
             if(options.isExportSATSet()) {
@@ -1,3 +1,7 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
 #include <vector>
 #include <sstream>
 #include "storm/storage/expressions/Expressions.h"
@@ -16,7 +20,7 @@ namespace pomdp {
     enum class MemlessSearchPathVariables {
         BooleanRanking, IntegerRanking, RealRanking
     };
-    MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
+    inline MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
         if(in == "int") {
             return MemlessSearchPathVariables::IntegerRanking;
         } else if (in == "real") {
@@ -113,6 +117,39 @@ namespace pomdp {
         }
     };
 
+    /*!
+     * Allows several policy searches on the same POMDP to share the winning regions they have found so far and to stop each other.
+     * All methods are thread-safe.
+     */
+    class PolicySearchExchange {
+    public:
+        PolicySearchExchange(std::vector<uint64_t> const& observationSizes);
+
+        /*!
+         * Adds the given winning region to the shared winning region.
+         */
+        void publish(WinningRegion const& region);
+
+        /*!
+         * Adds the shared winning region to the given winning region.
+         * @return true, if the given winning region has changed.
+         */
+        bool retrieve(WinningRegion& region) const;
+
+        WinningRegion getWinningRegion() const;
+
+        /*!
+         * Requests all searches that use this exchange to stop as soon as possible.
+         */
+        void stop();
+        bool isStopped() const;
+
+    private:
+        mutable std::mutex mutex;
+        WinningRegion winningRegion;
+        std::atomic<bool> stopped;
+    };
+
     template<typename ValueType>
     class IterativePolicySearch {
     // Implements an extension to the Chatterjee, Chmelik, Davies (AAAI-16) paper.
@@ -195,6 +232,17 @@ namespace pomdp {
 
         Statistics const& getStatistics() const;
         void finalizeStatistics();
+
+        /*!
+         * Lets this search share its winning region via the given exchange.
+         * The shared winning region is taken into account whenever the search (re)starts, and the search stops once the exchange is stopped.
+         */
+        void setExchange(std::shared_ptr<PolicySearchExchange> const& exchange);
+
+        /*!
+         * Retrieves whether the last analysis was stopped via the exchange. In this case, the result of the analysis is meaningless (but the winning region is still sound).
+         */
+        bool wasStopped() const;
     private:
         storm::expressions::Expression const& getDoneActionExpression(uint64_t obs) const;
 
@@ -213,6 +261,17 @@ namespace pomdp {
 
         bool smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions = {});
 
+        /*!
+         * Publishes the current winning region and adds the shared winning region to it (if there is an exchange).
+         * States of observations that became winning are added to the target states.
+         */
+        void synchronizeWinningRegion();
+
+        /*!
+         * Checks whether the search shall stop because of the exchange.
+         */
+        bool checkStopped();
+
 
         std::unique_ptr<storm::solver::SmtSolver> smtSolver;
         storm::models::sparse::Pomdp<ValueType> const& pomdp;
@@ -253,6 +312,8 @@ namespace pomdp {
 
         std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory;
         std::shared_ptr<WinningRegionQueryInterface<ValueType>> validator;
+        std::shared_ptr<PolicySearchExchange> exchange;
+        bool stopped = false;
 
         mutable  bool useFindOffset = false;
     };
@@ -0,0 +1,139 @@
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
+
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace pomdp {
+
+        template<typename ValueType>
+        PolicySearchPortfolio<ValueType>::PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                                                storm::storage::BitVector const& targetStates,
+                                                                storm::storage::BitVector const& surelyReachSinkStates,
+                                                                std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory,
+                                                                std::vector<Configuration> const& configurations) :
+                pomdp(pomdp),
+                targetStates(targetStates),
+                surelyReachSinkStates(surelyReachSinkStates),
+                smtSolverFactory(smtSolverFactory),
+                configurations(configurations),
+                statesPerObservation(pomdp.getNrObservations()) {
+            STORM_LOG_THROW(!configurations.empty(), storm::exceptions::UnexpectedException, "A portfolio needs at least one configuration.");
+            uint64_t state = 0;
+            for (auto obs : pomdp.getObservations()) {
+                statesPerObservation[obs].push_back(state++);
+            }
+            for (auto const& states : statesPerObservation) {
+                observationSizes.push_back(states.size());
+            }
+            winningRegion = WinningRegion(observationSizes);
+        }
+
+        template<typename ValueType>
+        std::vector<typename PolicySearchPortfolio<ValueType>::Configuration> PolicySearchPortfolio<ValueType>::createDefaultConfigurations(MemlessSearchOptions const& options, uint64_t lookahead) {
+            std::vector<Configuration> result;
+            for (auto pathVariableType : {MemlessSearchPathVariables::RealRanking, MemlessSearchPathVariables::IntegerRanking, MemlessSearchPathVariables::BooleanRanking}) {
+                result.push_back({options, lookahead});
+                result.back().options.pathVariableType = pathVariableType;
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        bool PolicySearchPortfolio<ValueType>::analyzeForInitialStates() {
+            bool result = run(true);
+            return result || initialStatesAreWinning();
+        }
+
+        template<typename ValueType>
+        void PolicySearchPortfolio<ValueType>::computeWinningRegion() {
+            run(false);
+        }
+
+        template<typename ValueType>
+        WinningRegion const& PolicySearchPortfolio<ValueType>::getLastWinningRegion() const {
+            return winningRegion;
+        }
+
+        template<typename ValueType>
+        bool PolicySearchPortfolio<ValueType>::run(bool onlyInitialStates) {
+            // Winning regions of previous runs remain valid
+            auto exchange = std::make_shared<PolicySearchExchange>(observationSizes);
+            exchange->publish(winningRegion);
+            // Each search gets its own SMT solver (and expression manager) so that they can run in parallel.
+            std::vector<std::unique_ptr<IterativePolicySearch<ValueType>>> searches;
+            for (auto const& configuration : configurations) {
+                searches.push_back(std::make_unique<IterativePolicySearch<ValueType>>(pomdp, targetStates, surelyReachSinkStates, smtSolverFactory, configuration.options));
+                searches.back()->setExchange(exchange);
+            }
+
+            std::mutex resultMutex;
+            bool result = false;
+            bool hasResult = false;
+            std::exception_ptr exception;
+            std::vector<std::thread> threads;
+            for (uint64_t i = 0; i < searches.size(); ++i) {
+                threads.emplace_back([&, i]() {
+                    try {
+                        bool searchResult = true;
+                        if (onlyInitialStates) {
+                            searchResult = searches[i]->analyzeForInitialStates(configurations[i].lookahead);
+                        } else {
+                            searches[i]->computeWinningRegion(configurations[i].lookahead);
+                        }
+                        if (!searches[i]->wasStopped()) {
+                            exchange->publish(searches[i]->getLastWinningRegion());
+                            std::lock_guard<std::mutex> lock(resultMutex);
+                            if (!hasResult) {
+                                STORM_LOG_INFO("Policy search with configuration " << i << " finished first.");
+                                hasResult = true;
+                                result = searchResult;
+                            }
+                        }
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(resultMutex);
+                        if (!exception) {
+                            exception = std::current_exception();
+                        }
+                    }
+                    // Either way, the remaining searches are not needed anymore.
+                    exchange->stop();
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            winningRegion = exchange->getWinningRegion();
+            return result;
+        }
+
+        template<typename ValueType>
+        bool PolicySearchPortfolio<ValueType>::initialStatesAreWinning() const {
+            for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+                storm::storage::BitVector check(statesPerObservation[observation].size());
+                uint64_t i = 0;
+                for (uint64_t state : statesPerObservation[observation]) {
+                    if (pomdp.getInitialStates().get(state)) {
+                        check.set(i);
+                    }
+                    ++i;
+                }
+                if (!check.empty() && !winningRegion.query(observation, check)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template class PolicySearchPortfolio<double>;
+        template class PolicySearchPortfolio<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/WinningRegion.h"
+
+namespace storm {
+    namespace pomdp {
+
+        /*!
+         * Runs several iterative policy searches with different parameters in parallel (one thread per configuration).
+         * The searches share the winning regions they find via a PolicySearchExchange and all searches stop as soon as one of them is finished.
+         */
+        template<typename ValueType>
+        class PolicySearchPortfolio {
+        public:
+            struct Configuration {
+                MemlessSearchOptions options;
+                uint64_t lookahead;
+            };
+
+            PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                  storm::storage::BitVector const& targetStates,
+                                  storm::storage::BitVector const& surelyReachSinkStates,
+                                  std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory,
+                                  std::vector<Configuration> const& configurations);
+
+            /*!
+             * Creates configurations that differ in the encoding of the lookahead, based on the given options.
+             */
+            static std::vector<Configuration> createDefaultConfigurations(MemlessSearchOptions const& options, uint64_t lookahead);
+
+            /*!
+             * Checks whether the initial states are in the winning region found by the first search that finishes.
+             * Since the winning regions of all searches are shared, the result is at least as good as the result of that search.
+             */
+            bool analyzeForInitialStates();
+
+            /*!
+             * Computes a winning region. The computation stops as soon as the first search is finished.
+             */
+            void computeWinningRegion();
+
+            WinningRegion const& getLastWinningRegion() const;
+
+        private:
+            /*!
+             * Runs all searches until the first one finishes and collects the shared winning region.
+             * @return true, if the search that finished first found what it was looking for.
+             */
+            bool run(bool onlyInitialStates);
+
+            bool initialStatesAreWinning() const;
+
+            storm::models::sparse::Pomdp<ValueType> const& pomdp;
+            storm::storage::BitVector targetStates;
+            storm::storage::BitVector surelyReachSinkStates;
+            std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
+            std::vector<Configuration> configurations;
+            std::vector<std::vector<uint64_t>> statesPerObservation;
+            std::vector<uint64_t> observationSizes;
+            WinningRegion winningRegion;
+        };
+    }
+}
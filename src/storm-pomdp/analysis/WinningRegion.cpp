@@ -3,6 +3,7 @@
 #include <storm/exceptions/WrongFormatException.h>
 #include "storm/io/file.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm-pomdp/analysis/WinningRegion.h"
@@ -68,6 +69,17 @@ namespace pomdp {
 
     }
 
+    bool WinningRegion::join(WinningRegion const& other) {
+        STORM_LOG_ASSERT(observationSizes == other.observationSizes, "Winning regions for different POMDPs can not be joined.");
+        bool changed = false;
+        for (uint64_t observation = 0; observation < other.winningRegion.size(); ++observation) {
+            for (auto const& support : other.winningRegion[observation]) {
+                changed |= update(observation, support);
+            }
+        }
+        return changed;
+    }
+
     bool WinningRegion::query(uint64_t observation, storm::storage::BitVector const& currently) const {
         for(storm::storage::BitVector winning : winningRegion[observation]) {
             if(currently.isSubsetOf(winning)) {
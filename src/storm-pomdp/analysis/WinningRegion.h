@@ -11,6 +11,11 @@ namespace storm {
             WinningRegion(std::vector<uint64_t> const& observationSizes = {});
 
             bool update(uint64_t observation, storm::storage::BitVector const& winning);
+            /*!
+             * Adds all winning supports of the given region (for the same POMDP) to this region.
+             * @return true, if this region has changed.
+             */
+            bool join(WinningRegion const& other);
             bool query(uint64_t observation, storm::storage::BitVector const& currently) const;
             bool isWinning(uint64_t observation, uint64_t offset) const {
                 assert(observation < observationSizes.size());
@@ -1,5 +1,8 @@
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 
@@ -14,6 +17,8 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/vector.h"
 
+#include "storm/exceptions/IllegalFunctionCallException.h"
+
 namespace storm {
     namespace builder {
         template<typename PomdpType, typename BeliefValueType>
@@ -29,7 +34,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), status(Status::Uninitialized) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), heuristicSearch(false), numberOfExploredTransitions(0), keepTransitionsOfEmittedStates(true), transitionsWereDiscarded(false), pomdpValueBounds(pomdpValueBounds), status(Status::Uninitialized) {
             // Intentionally left empty
         }
 
@@ -38,6 +43,19 @@ namespace storm {
             return *beliefManager;
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::setHeuristicSearch(bool value) {
+            STORM_LOG_ASSERT(status != Status::Exploring, "Method call is invalid in current status.");
+            heuristicSearch = value;
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::setExploredStateCallback(std::function<void(ExploredState const&)> const& callback, bool keepTransitions) {
+            STORM_LOG_ASSERT(status != Status::Exploring, "Method call is invalid in current status.");
+            exploredStateCallback = callback;
+            keepTransitionsOfEmittedStates = keepTransitions;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void
         BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(boost::optional<ValueType> extraTargetStateValue, boost::optional<ValueType> extraBottomStateValue) {
@@ -48,15 +66,21 @@ namespace storm {
             exploredBeliefIds.clear();
             exploredBeliefIds.grow(beliefManager->getNumberOfBeliefIds(), false);
             mdpStatesToExplore.clear();
+            explorationReachProbabilities.clear();
+            explorationPriorities.clear();
+            rowGroupOfMdpState.clear();
             lowerValueBounds.clear();
             upperValueBounds.clear();
             values.clear();
+            schedulerChoices.clear();
             exploredMdpTransitions.clear();
+            numberOfExploredTransitions = 0;
             exploredChoiceIndices.clear();
             mdpActionRewards.clear();
             targetStates.clear();
             truncatedStates.clear();
             delayedExplorationChoices.clear();
+            transitionsWereDiscarded = false;
             optimalChoices = boost::none;
             optimalChoicesReachableMdpStates = boost::none;
             exploredMdp = nullptr;
@@ -71,6 +95,7 @@ namespace storm {
 
                 internalAddTransition(getStartOfCurrentRowGroup(), extraBottomState.get(), storm::utility::one<ValueType>());
                 internalAddRowGroupIndex();
+                emitExploredState(extraBottomState.get());
             } else {
                 extraBottomState = boost::none;
             }
@@ -85,6 +110,7 @@ namespace storm {
 
                 targetStates.grow(getCurrentNumberOfMdpStates(), false);
                 targetStates.set(extraTargetState.get(), true);
+                emitExploredState(extraTargetState.get());
             } else {
                 extraTargetState = boost::none;
             }
@@ -103,6 +129,7 @@ namespace storm {
             exploredBeliefIds.grow(beliefManager->getNumberOfBeliefIds(), false);
             exploredMdpTransitions.clear();
             exploredMdpTransitions.resize(exploredMdp->getNumberOfChoices());
+            numberOfExploredTransitions = 0;
             exploredChoiceIndices = exploredMdp->getNondeterministicChoiceIndices();
             mdpActionRewards.clear();
             if (exploredMdp->hasRewardModel()) {
@@ -113,16 +140,22 @@ namespace storm {
             truncatedStates = storm::storage::BitVector(getCurrentNumberOfMdpStates(), false);
             delayedExplorationChoices.clear();
             mdpStatesToExplore.clear();
+            explorationReachProbabilities.clear();
+            explorationPriorities.clear();
+            rowGroupOfMdpState.clear();
+            transitionsWereDiscarded = false;
 
             // The extra states are not changed
             if (extraBottomState) {
                 currentMdpState = extraBottomState.get();
                 restoreOldBehaviorAtCurrentState(0);
+                emitExploredState(extraBottomState.get());
             }
             if (extraTargetState) {
                 currentMdpState = extraTargetState.get();
                 restoreOldBehaviorAtCurrentState(0);
                 targetStates.set(extraTargetState.get(), true);
+                emitExploredState(extraTargetState.get());
             }
             currentMdpState = noState();
 
@@ -140,18 +173,46 @@ namespace storm {
         typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
             STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
             // Mark the end of the previously explored row group.
-            if (currentMdpState != noState() && !currentStateHasOldBehavior()) {
-                internalAddRowGroupIndex();
+            if (currentMdpState != noState()) {
+                if (!currentStateHasOldBehavior()) {
+                    internalAddRowGroupIndex();
+                }
+                emitExploredState(currentMdpState);
             }
 
             // Pop from the queue.
-            currentMdpState = mdpStatesToExplore.front();
-            mdpStatesToExplore.pop_front();
-
+            if (heuristicSearch) {
+                std::pop_heap(mdpStatesToExplore.begin(), mdpStatesToExplore.end(), ExplorationPriorityLess(explorationPriorities));
+                currentMdpState = mdpStatesToExplore.back();
+                mdpStatesToExplore.pop_back();
+                // New states are not necessarily explored in the order of their indices, so their choices are appended in a different order.
+                if (currentMdpState >= rowGroupOfMdpState.size()) {
+                    rowGroupOfMdpState.resize(currentMdpState + 1, noState());
+                }
+                rowGroupOfMdpState[currentMdpState] = currentStateHasOldBehavior() ? currentMdpState : exploredChoiceIndices.size() - 1;
+            } else {
+                currentMdpState = mdpStatesToExplore.front();
+                mdpStatesToExplore.pop_front();
+            }
 
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId>
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::getBeliefIdsOfUpcomingStates(uint64_t const &numberOfStates) const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            std::vector<BeliefId> result;
+            auto mdpStateIt = mdpStatesToExplore.begin();
+            for (uint64_t i = 0; i < numberOfStates && mdpStateIt != mdpStatesToExplore.end(); ++i, ++mdpStateIt) {
+                bool hasOldBehavior = exploredMdp && *mdpStateIt < exploredMdp->getNumberOfStates();
+                if (!hasOldBehavior || exploredMdp->getStateLabeling().getStateHasLabel("truncated", *mdpStateIt)) {
+                    result.push_back(mdpStateToBeliefIdMap[*mdpStateIt]);
+                }
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
@@ -192,7 +253,7 @@ namespace storm {
                     return false;
                 }
             } else {
-                column = getOrAddMdpState(transitionTarget);
+                column = getOrAddMdpState(transitionTarget, getCurrentReachProbability() * value);
             }
             uint64_t row = getStartOfCurrentRowGroup() + localActionIndex;
             internalAddTransition(row, column, value);
@@ -310,7 +371,7 @@ namespace storm {
                     if (!exploredBeliefIds.get(beliefId)) {
                         // This belief needs exploration
                         exploredBeliefIds.set(beliefId, true);
-                        mdpStatesToExplore.push_back(transition.getColumn());
+                        addToExplorationQueue(transition.getColumn(), getCurrentReachProbability() * transition.getValue());
                     }
                 }
             }
@@ -319,7 +380,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        void BeliefMdpExplorer<PomdpType, BeliefValueType>::finishExploration() {
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::finishExploration(bool buildMdp) {
             STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
             STORM_LOG_ASSERT(!hasUnexploredState(), "Finishing exploration not possible if there are still unexplored states.");
 
@@ -328,12 +389,27 @@ namespace storm {
             if (!currentStateHasOldBehavior()) {
                 internalAddRowGroupIndex();
             }
+            if (currentMdpState != noState()) {
+                emitExploredState(currentMdpState);
+            }
+            if (!buildMdp) {
+                // The explored states have already been passed to the callback. Free the memory as the explorer needs to be started again anyway.
+                currentMdpState = noState();
+                std::vector<std::map<MdpStateType, ValueType>>().swap(exploredMdpTransitions);
+                exploredMdp = nullptr;
+                status = Status::Uninitialized;
+                return;
+            }
+            STORM_LOG_THROW(!transitionsWereDiscarded, storm::exceptions::IllegalFunctionCallException, "Can not build the explored MDP as the transitions of emitted states were discarded.");
             // Resize state- and choice based vectors to the correct size
             targetStates.resize(getCurrentNumberOfMdpStates(), false);
             truncatedStates.resize(getCurrentNumberOfMdpStates(), false);
             if (!mdpActionRewards.empty()) {
                 mdpActionRewards.resize(getCurrentNumberOfMdpChoices(), storm::utility::zero<ValueType>());
             }
+            if (heuristicSearch) {
+                renumberStatesByRowGroups();
+            }
 
             // We are not exploring anymore
             currentMdpState = noState();
@@ -500,6 +576,7 @@ namespace storm {
             storm::utility::vector::filterVectorInPlace(lowerValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(upperValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(values, relevantMdpStates);
+            storm::utility::vector::filterVectorInPlace(schedulerChoices, relevantMdpStates);
 
         }
 
@@ -523,10 +600,114 @@ namespace storm {
             return exploredMdpTransitions.size();
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        uint64_t BeliefMdpExplorer<PomdpType, BeliefValueType>::getMemoryUsage() const {
+            // For the nodes of std::map, we assume an overhead of four pointers (children, parent and color).
+            uint64_t const mapNodeOverhead = 4 * sizeof(void*);
+            uint64_t result = numberOfExploredTransitions * (sizeof(std::pair<MdpStateType const, ValueType>) + mapNodeOverhead);
+            result += exploredMdpTransitions.capacity() * sizeof(std::map<MdpStateType, ValueType>);
+            result += beliefIdToMdpStateMap.size() * (sizeof(std::pair<BeliefId const, MdpStateType>) + mapNodeOverhead);
+            result += (mdpStateToBeliefIdMap.capacity() + exploredChoiceIndices.capacity() + rowGroupOfMdpState.capacity() + schedulerChoices.capacity() + mdpStatesToExplore.size()) * sizeof(uint64_t);
+            result += (mdpActionRewards.capacity() + lowerValueBounds.capacity() + upperValueBounds.capacity() + values.capacity() + explorationReachProbabilities.capacity() + explorationPriorities.capacity()) * sizeof(ValueType);
+            result += (exploredBeliefIds.size() + targetStates.size() + truncatedStates.size() + delayedExplorationChoices.size()) / 8;
+            if (exploredMdp) {
+                auto const& matrix = exploredMdp->getTransitionMatrix();
+                result += matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>) + (matrix.getRowCount() + matrix.getRowGroupCount()) * sizeof(uint64_t);
+                if (exploredMdp->hasRewardModel()) {
+                    result += exploredMdp->getNumberOfChoices() * sizeof(ValueType);
+                }
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getStartOfCurrentRowGroup() const {
             STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
-            return exploredChoiceIndices[getCurrentMdpState()];
+            return exploredChoiceIndices[getRowGroupIndex(getCurrentMdpState())];
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getRowGroupIndex(MdpStateType const &mdpState) const {
+            if (mdpState < rowGroupOfMdpState.size() && rowGroupOfMdpState[mdpState] != noState()) {
+                return rowGroupOfMdpState[mdpState];
+            }
+            return mdpState;
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::renumberStatesByRowGroups() {
+            std::vector<MdpStateType> newIndices(getCurrentNumberOfMdpStates());
+            bool isIdentity = true;
+            for (MdpStateType mdpState = 0; mdpState < newIndices.size(); ++mdpState) {
+                newIndices[mdpState] = getRowGroupIndex(mdpState);
+                isIdentity &= newIndices[mdpState] == mdpState;
+            }
+            rowGroupOfMdpState.clear();
+            if (isIdentity) {
+                return;
+            }
+            // Only states that were newly added in this exploration are renumbered, i.e., the states of a previously explored MDP keep their index.
+            auto permute = [&newIndices](auto &stateVector) {
+                std::remove_reference_t<decltype(stateVector)> result(stateVector.size());
+                for (MdpStateType mdpState = 0; mdpState < newIndices.size(); ++mdpState) {
+                    result[newIndices[mdpState]] = std::move(stateVector[mdpState]);
+                }
+                stateVector = std::move(result);
+            };
+            auto permuteBitVector = [&newIndices](storm::storage::BitVector &states) {
+                storm::storage::BitVector result(states.size(), false);
+                for (auto const &mdpState : states) {
+                    result.set(newIndices[mdpState], true);
+                }
+                states = std::move(result);
+            };
+            for (auto &row : exploredMdpTransitions) {
+                std::map<MdpStateType, ValueType> newRow;
+                for (auto &entry : row) {
+                    newRow.emplace(newIndices[entry.first], std::move(entry.second));
+                }
+                row = std::move(newRow);
+            }
+            permute(mdpStateToBeliefIdMap);
+            for (auto &entry : beliefIdToMdpStateMap) {
+                entry.second = newIndices[entry.second];
+            }
+            permute(lowerValueBounds);
+            permute(upperValueBounds);
+            permute(values);
+            permute(schedulerChoices);
+            permuteBitVector(targetStates);
+            permuteBitVector(truncatedStates);
+            initialMdpState = newIndices[initialMdpState];
+            if (extraTargetState) {
+                extraTargetState = newIndices[extraTargetState.get()];
+            }
+            if (extraBottomState) {
+                extraBottomState = newIndices[extraBottomState.get()];
+            }
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::emitExploredState(MdpStateType const &mdpState) {
+            if (!exploredStateCallback) {
+                return;
+            }
+            ExploredState exploredState;
+            exploredState.mdpState = mdpState;
+            exploredState.beliefId = mdpStateToBeliefIdMap[mdpState];
+            exploredState.isTarget = mdpState < targetStates.size() && targetStates.get(mdpState);
+            exploredState.isTruncated = mdpState < truncatedStates.size() && truncatedStates.get(mdpState);
+            MdpStateType rowGroup = getRowGroupIndex(mdpState);
+            for (uint64_t row = exploredChoiceIndices[rowGroup]; row < exploredChoiceIndices[rowGroup + 1]; ++row) {
+                exploredState.choices.emplace_back(exploredMdpTransitions[row].begin(), exploredMdpTransitions[row].end());
+                exploredState.choiceRewards.push_back(row < mdpActionRewards.size() ? mdpActionRewards[row] : storm::utility::zero<ValueType>());
+                if (!keepTransitionsOfEmittedStates) {
+                    numberOfExploredTransitions -= exploredMdpTransitions[row].size();
+                    std::map<MdpStateType, ValueType>().swap(exploredMdpTransitions[row]);
+                    transitionsWereDiscarded = true;
+                }
+            }
+            exploredStateCallback(exploredState);
         }
 
         template<typename PomdpType, typename BeliefValueType>
@@ -571,10 +752,20 @@ namespace storm {
             STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
             auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
             auto task = createStandardCheckTask(property);
+            // The obtained scheduler serves as a hint when the values of a refined MDP are computed
+            task.setProduceSchedulers(true);
 
             std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(exploredMdp, task));
             if (res) {
-                values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+                auto &quantitativeResult = res->asExplicitQuantitativeCheckResult<ValueType>();
+                if (quantitativeResult.hasScheduler()) {
+                    auto const &scheduler = quantitativeResult.getScheduler();
+                    for (MdpStateType mdpState = 0; mdpState < schedulerChoices.size(); ++mdpState) {
+                        auto const &choice = scheduler.getChoice(mdpState);
+                        schedulerChoices[mdpState] = choice.isDefined() ? choice.getDeterministicChoice() : 0;
+                    }
+                }
+                values = std::move(quantitativeResult.getValueVector());
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                           "Computed values are smaller than the lower bound.");
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
@@ -610,6 +801,54 @@ namespace storm {
             return mdpStateToBeliefIdMap[exploredMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<std::pair<uint64_t, typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>>
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::getComputedValuesAtDiracBeliefs() const {
+            STORM_LOG_ASSERT(status == Status::ModelChecked, "Method call is invalid in current status.");
+            std::vector<std::pair<uint64_t, ValueType>> result;
+            for (MdpStateType mdpState = 0; mdpState < mdpStateToBeliefIdMap.size(); ++mdpState) {
+                BeliefId const &beliefId = mdpStateToBeliefIdMap[mdpState];
+                if (beliefId != beliefManager->noId()) {
+                    if (auto pomdpState = beliefManager->getDiracState(beliefId)) {
+                        result.emplace_back(pomdpState.get(), values[mdpState]);
+                    }
+                }
+            }
+            return result;
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::setAdditionalPomdpLowerValueBounds(std::vector<ValueType> const &bounds) {
+            if (additionalPomdpLowerValueBoundsIndex) {
+                pomdpValueBounds.lower[additionalPomdpLowerValueBoundsIndex.get()] = bounds;
+            } else {
+                additionalPomdpLowerValueBoundsIndex = pomdpValueBounds.lower.size();
+                pomdpValueBounds.lower.push_back(bounds);
+            }
+            for (MdpStateType mdpState = 0; mdpState < lowerValueBounds.size(); ++mdpState) {
+                BeliefId const &beliefId = mdpStateToBeliefIdMap[mdpState];
+                if (beliefId != beliefManager->noId()) {
+                    lowerValueBounds[mdpState] = std::max(lowerValueBounds[mdpState], beliefManager->getWeightedSum(beliefId, bounds));
+                }
+            }
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::setAdditionalPomdpUpperValueBounds(std::vector<ValueType> const &bounds) {
+            if (additionalPomdpUpperValueBoundsIndex) {
+                pomdpValueBounds.upper[additionalPomdpUpperValueBoundsIndex.get()] = bounds;
+            } else {
+                additionalPomdpUpperValueBoundsIndex = pomdpValueBounds.upper.size();
+                pomdpValueBounds.upper.push_back(bounds);
+            }
+            for (MdpStateType mdpState = 0; mdpState < upperValueBounds.size(); ++mdpState) {
+                BeliefId const &beliefId = mdpStateToBeliefIdMap[mdpState];
+                if (beliefId != beliefManager->noId()) {
+                    upperValueBounds[mdpState] = std::min(upperValueBounds[mdpState], beliefManager->getWeightedSum(beliefId, bounds));
+                }
+            }
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::gatherSuccessorObservationInformationAtCurrentState(uint64_t localActionIndex,
                                                                                                                 std::map<uint32_t, SuccessorObservationInformation> &gatheredSuccessorObservations) {
@@ -727,6 +966,16 @@ namespace storm {
             auto task = storm::api::createTask<ValueType>(property, false);
             auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
             hint.setResultHint(values);
+            if (exploredMdp && schedulerChoices.size() == exploredMdp->getNumberOfStates()) {
+                // Use the choices of the previously computed scheduler as initial scheduler. After a refinement, the number of choices of a
+                // state might have changed so we fall back to the first choice in this case.
+                storm::storage::Scheduler<ValueType> schedulerHint(exploredMdp->getNumberOfStates());
+                for (MdpStateType mdpState = 0; mdpState < exploredMdp->getNumberOfStates(); ++mdpState) {
+                    uint64_t choice = schedulerChoices[mdpState];
+                    schedulerHint.setChoice(choice < exploredMdp->getTransitionMatrix().getRowGroupSize(mdpState) ? choice : 0, mdpState);
+                }
+                hint.setSchedulerHint(std::move(schedulerHint));
+            }
             auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
             task.setHint(hintPtr);
             return task;
@@ -752,6 +1001,7 @@ namespace storm {
             }
             STORM_LOG_ASSERT(exploredMdpTransitions[row].count(column) == 0, "Trying to insert multiple transitions to the same state.");
             exploredMdpTransitions[row][column] = value;
+            ++numberOfExploredTransitions;
         }
 
         template<typename PomdpType, typename BeliefValueType>
@@ -774,12 +1024,14 @@ namespace storm {
             upperValueBounds.push_back(upperBound);
             // Take the middle value as a hint
             values.push_back((lowerBound + upperBound) / storm::utility::convertNumber<ValueType, uint64_t>(2));
+            // Without further information, the first choice is taken as hint
+            schedulerChoices.push_back(0);
             STORM_LOG_ASSERT(lowerValueBounds.size() == getCurrentNumberOfMdpStates(), "Value vectors have different size then number of available states.");
             STORM_LOG_ASSERT(lowerValueBounds.size() == upperValueBounds.size() && values.size() == upperValueBounds.size(), "Value vectors have inconsistent size.");
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getOrAddMdpState(BeliefId const &beliefId) {
+        typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getOrAddMdpState(BeliefId const &beliefId, ValueType const &reachProbability) {
             exploredBeliefIds.grow(beliefId + 1, false);
             if (exploredBeliefIds.get(beliefId)) {
                 return beliefIdToMdpStateMap[beliefId];
@@ -791,7 +1043,7 @@ namespace storm {
                 if (exploredMdp) {
                     auto findRes = beliefIdToMdpStateMap.find(beliefId);
                     if (findRes != beliefIdToMdpStateMap.end()) {
-                        mdpStatesToExplore.push_back(findRes->second);
+                        addToExplorationQueue(findRes->second, reachProbability);
                         return findRes->second;
                     }
                 }
@@ -801,11 +1053,47 @@ namespace storm {
                 mdpStateToBeliefIdMap.push_back(beliefId);
                 beliefIdToMdpStateMap[beliefId] = result;
                 insertValueHints(computeLowerValueBoundAtBelief(beliefId), computeUpperValueBoundAtBelief(beliefId));
-                mdpStatesToExplore.push_back(result);
+                addToExplorationQueue(result, reachProbability);
                 return result;
             }
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType BeliefMdpExplorer<PomdpType, BeliefValueType>::getCurrentReachProbability() const {
+            if (!heuristicSearch) {
+                // The reach probabilities are only tracked when they are needed
+                return storm::utility::one<ValueType>();
+            }
+            STORM_LOG_ASSERT(getCurrentMdpState() < explorationReachProbabilities.size(), "No reach probability available for the current state.");
+            return explorationReachProbabilities[getCurrentMdpState()];
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::addToExplorationQueue(MdpStateType const &mdpState, ValueType const &reachProbability) {
+            mdpStatesToExplore.push_back(mdpState);
+            if (heuristicSearch) {
+                if (mdpState >= explorationPriorities.size()) {
+                    explorationReachProbabilities.resize(mdpState + 1, storm::utility::zero<ValueType>());
+                    explorationPriorities.resize(mdpState + 1, storm::utility::zero<ValueType>());
+                }
+                // Similar to the trials of HSVI, the states are explored in the order of the probability mass that is still uncertain.
+                explorationReachProbabilities[mdpState] = reachProbability;
+                explorationPriorities[mdpState] = reachProbability * (upperValueBounds[mdpState] - lowerValueBounds[mdpState]);
+                std::push_heap(mdpStatesToExplore.begin(), mdpStatesToExplore.end(), ExplorationPriorityLess(explorationPriorities));
+            }
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::ExplorationPriorityLess::ExplorationPriorityLess(std::vector<ValueType> const &priorities) : priorities(priorities) {
+            // Intentionally left empty
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        bool BeliefMdpExplorer<PomdpType, BeliefValueType>::ExplorationPriorityLess::operator()(MdpStateType const &lhs, MdpStateType const &rhs) const {
+            // Among states with the same priority, the one that was discovered first is explored first.
+            return priorities[lhs] < priorities[rhs] || (priorities[lhs] == priorities[rhs] && lhs > rhs);
+        }
+
         template
         class BeliefMdpExplorer<storm::models::sparse::Pomdp<double>>;
 
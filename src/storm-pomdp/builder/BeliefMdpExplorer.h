@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <functional>
 #include <vector>
 #include <deque>
 #include <map>
@@ -38,12 +39,42 @@ namespace storm {
                 ModelChecked
             };
 
+            /*!
+             * Describes a state whose exploration is completed, as passed to the callback set via setExploredStateCallback.
+             */
+            struct ExploredState {
+                MdpStateType mdpState;
+                BeliefId beliefId; // noId() for the extra target and bottom states
+                bool isTarget;
+                bool isTruncated;
+                std::vector<std::vector<std::pair<MdpStateType, ValueType>>> choices; // The successor states (with probabilities) of each choice
+                std::vector<ValueType> choiceRewards; // The reward of each choice (zero if no rewards were computed)
+            };
+
             BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds);
 
             BeliefMdpExplorer(BeliefMdpExplorer &&other) = default;
 
             BeliefManagerType const &getBeliefManager() const;
 
+            /*!
+             * Sets whether the states are explored in a heuristic search order instead of breadth-first.
+             * In the heuristic search order, the state with the largest product of (i) the probability of the path on which the state was discovered and
+             * (ii) the gap between the lower and upper value bound of the state is explored next. Thus, when the exploration is truncated, the states
+             * whose values are irrelevant for the initial state are more likely to be truncated.
+             */
+            void setHeuristicSearch(bool value);
+
+            /*!
+             * Sets a callback that is invoked whenever the exploration of a state is completed (including states whose old behavior is restored and the extra states).
+             * This allows to pass the explored MDP to an external solver while it is being explored.
+             * All emitted states and transitions refer to the state indices used during exploration. In heuristic search mode, these indices
+             * differ from the indices of the states of the explored MDP. After a restart, previously emitted states that are not reached again are not part of the new MDP.
+             * @param keepTransitions if false, the transitions of a state are discarded as soon as it has been emitted.
+             *        In this case, the exploration can only be finished without building the MDP (see finishExploration).
+             */
+            void setExploredStateCallback(std::function<void(ExploredState const&)> const& callback, bool keepTransitions = true);
+
             void startNewExploration(boost::optional<ValueType> extraTargetStateValue = boost::none, boost::optional<ValueType> extraBottomStateValue = boost::none);
 
             /*!
@@ -58,6 +89,12 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Considers the given number of states that are explored next and retrieves the beliefs of those states that are likely to be expanded.
+             * States with old behavior that was not truncated in the previous exploration are skipped as their behavior is usually restored.
+             */
+            std::vector<BeliefId> getBeliefIdsOfUpcomingStates(uint64_t const &numberOfStates) const;
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
@@ -119,7 +156,12 @@ namespace storm {
              */
             void restoreOldBehaviorAtCurrentState(uint64_t const &localActionIndex);
 
-            void finishExploration();
+            /*!
+             * Completes the exploration.
+             * @param buildMdp if false, no MDP is built. This is useful if the explored states are only passed to the callback set via setExploredStateCallback.
+             *        The explorer needs to be started again afterwards.
+             */
+            void finishExploration(bool buildMdp = true);
 
             void dropUnexploredStates();
 
@@ -129,6 +171,13 @@ namespace storm {
 
             MdpStateType getCurrentNumberOfMdpChoices() const;
 
+            /*!
+             * Retrieves an estimate of the memory (in bytes) that is allocated by this explorer, including the MDP of a previous exploration.
+             * The beliefs themselves are stored in the belief manager and are not considered.
+             * The estimate can be computed in constant time, so it can be queried after each explored state.
+             */
+            uint64_t getMemoryUsage() const;
+
             MdpStateType getStartOfCurrentRowGroup() const;
 
             ValueType getLowerValueBoundAtCurrentState() const;
@@ -149,6 +198,24 @@ namespace storm {
 
             MdpStateType getBeliefId(MdpStateType exploredMdpState) const;
 
+            /*!
+             * Collects the computed values of those explored MDP states whose belief is a Dirac belief.
+             * @return pairs consisting of a POMDP state and the computed value at the Dirac belief of that state.
+             */
+            std::vector<std::pair<uint64_t, ValueType>> getComputedValuesAtDiracBeliefs() const;
+
+            /*!
+             * Uses the given values as an additional lower bound for the values of the POMDP states. Bounds given in a previous call are replaced.
+             * The lower value bounds of the MDP states that were already explored are tightened accordingly.
+             */
+            void setAdditionalPomdpLowerValueBounds(std::vector<ValueType> const &bounds);
+
+            /*!
+             * Uses the given values as an additional upper bound for the values of the POMDP states. Bounds given in a previous call are replaced.
+             * The upper value bounds of the MDP states that were already explored are tightened accordingly.
+             */
+            void setAdditionalPomdpUpperValueBounds(std::vector<ValueType> const &bounds);
+
             void gatherSuccessorObservationInformationAtCurrentState(uint64_t localActionIndex, std::map<uint32_t, SuccessorObservationInformation> &gatheredSuccessorObservations);
 
             void gatherSuccessorObservationInformationAtMdpChoice(uint64_t mdpChoice, std::map<uint32_t, SuccessorObservationInformation> &gatheredSuccessorObservations);
@@ -187,7 +254,40 @@ namespace storm {
 
             void insertValueHints(ValueType const &lowerBound, ValueType const &upperBound);
 
-            MdpStateType getOrAddMdpState(BeliefId const &beliefId);
+            MdpStateType getOrAddMdpState(BeliefId const &beliefId, ValueType const &reachProbability = storm::utility::one<ValueType>());
+
+            /*!
+             * Retrieves the probability of the path on which the current state was discovered (only tracked in heuristic search mode).
+             */
+            ValueType getCurrentReachProbability() const;
+
+            void addToExplorationQueue(MdpStateType const &mdpState, ValueType const &reachProbability);
+
+            /*!
+             * Retrieves the index of the row group that holds the choices of the given state.
+             * This coincides with the state index unless the state was explored out of order in heuristic search mode.
+             */
+            MdpStateType getRowGroupIndex(MdpStateType const &mdpState) const;
+
+            /*!
+             * Renumbers the states such that the index of each state coincides with the index of its row group.
+             * This is necessary after an exploration in heuristic search mode as new states are then not explored in the order of their indices.
+             */
+            void renumberStatesByRowGroups();
+
+            /*!
+             * Passes the given (completely explored) state to the explored state callback (if any).
+             */
+            void emitExploredState(MdpStateType const &mdpState);
+
+            /*!
+             * Compares MDP states by their exploration priority. Used to organize the exploration queue as a heap in heuristic search mode.
+             */
+            struct ExplorationPriorityLess {
+                ExplorationPriorityLess(std::vector<ValueType> const &priorities);
+                bool operator()(MdpStateType const &lhs, MdpStateType const &rhs) const;
+                std::vector<ValueType> const &priorities;
+            };
             
             // Belief state related information
             std::shared_ptr<BeliefManagerType> beliefManager;
@@ -196,11 +296,19 @@ namespace storm {
             storm::storage::BitVector exploredBeliefIds;
             
             // Exploration information
-            std::deque<uint64_t> mdpStatesToExplore;
+            std::deque<uint64_t> mdpStatesToExplore; // A FIFO queue or, in heuristic search mode, a heap w.r.t. the exploration priorities
+            bool heuristicSearch;
+            std::vector<ValueType> explorationReachProbabilities;
+            std::vector<ValueType> explorationPriorities;
+            std::vector<MdpStateType> rowGroupOfMdpState; // Only used in heuristic search mode. States that are not mapped to a row group (noState()) use the row group with their own index.
             std::vector<std::map<MdpStateType, ValueType>> exploredMdpTransitions;
+            uint64_t numberOfExploredTransitions; // The number of entries in exploredMdpTransitions
             std::vector<MdpStateType> exploredChoiceIndices;
             std::vector<ValueType> mdpActionRewards;
             uint64_t currentMdpState;
+            std::function<void(ExploredState const&)> exploredStateCallback;
+            bool keepTransitionsOfEmittedStates;
+            bool transitionsWereDiscarded;
             
             // Special states and choices during exploration
             boost::optional<MdpStateType> extraTargetState;
@@ -217,7 +325,10 @@ namespace storm {
             storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> pomdpValueBounds;
             std::vector<ValueType> lowerValueBounds;
             std::vector<ValueType> upperValueBounds;
+            boost::optional<uint64_t> additionalPomdpLowerValueBoundsIndex;
+            boost::optional<uint64_t> additionalPomdpUpperValueBoundsIndex;
             std::vector<ValueType> values; // Contains an estimate during building and the actual result after a check has performed
+            std::vector<uint64_t> schedulerChoices; // Contains the local choices of the scheduler obtained in the last check (if any), used as a hint for the next check
             boost::optional<storm::storage::BitVector> optimalChoices;
             boost::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
             
@@ -1,5 +1,8 @@
 #include "BeliefExplorationPomdpModelChecker.h"
 
+#include <atomic>
+#include <future>
+#include <mutex>
 #include <tuple>
 
 #include <boost/algorithm/string.hpp>
@@ -68,7 +71,7 @@ namespace storm {
             }
             
             template<typename PomdpModelType, typename BeliefValueType>
-            BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::Statistics::Statistics() :  beliefMdpDetectedToBeFinite(false), refinementFixpointDetected(false), overApproximationBuildAborted(false), underApproximationBuildAborted(false), aborted(false) {
+            BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::Statistics::Statistics() :  beliefMdpDetectedToBeFinite(false), refinementFixpointDetected(false), overApproximationBuildAborted(false), overApproximationMemoryLimitReached(false), underApproximationBuildAborted(false), underApproximationMemoryLimitReached(false), aborted(false) {
                 // intentionally left empty;
             }
             
@@ -183,6 +186,9 @@ namespace storm {
                     }
                     stream << statistics.overApproximationStates.get() << '\n';
                     stream << "# Maximal resolution for over-approximation: " << statistics.overApproximationMaxResolution.get() << '\n';
+                    if (statistics.overApproximationMemoryLimitReached) {
+                        stream << "# Exploration of the over-approx grid MDP was cut off due to the memory limit.\n";
+                    }
                     stream << "# Time spend for building the over-approx grid MDP(s): " << statistics.overApproximationBuildTime << '\n';
                     stream << "# Time spend for checking the over-approx grid MDP(s): " << statistics.overApproximationCheckTime << '\n';
                 }
@@ -201,6 +207,9 @@ namespace storm {
                     if (statistics.underApproximationStateLimit) {
                         stream << "# Exploration state limit for under-approximation: " << statistics.underApproximationStateLimit.get() << '\n';
                     }
+                    if (statistics.underApproximationMemoryLimitReached) {
+                        stream << "# Exploration of the under-approx grid MDP was cut off due to the memory limit.\n";
+                    }
                     stream << "# Time spend for building the under-approx grid MDP(s): " << statistics.underApproximationBuildTime << '\n';
                     stream << "# Time spend for checking the under-approx grid MDP(s): " << statistics.underApproximationCheckTime << '\n';
                 }
@@ -218,6 +227,7 @@ namespace storm {
                         manager->setRewardModel(rewardModelName);
                     }
                     auto approx = std::make_shared<ExplorerType>(manager, pomdpValueBounds);
+                    approx->setHeuristicSearch(options.heuristicSearchExploration);
                     HeuristicParameters heuristicParameters;
                     heuristicParameters.gapThreshold = options.gapThresholdInit;
                     heuristicParameters.observationThreshold = options.obsThresholdInit; // Actually not relevant without refinement
@@ -243,6 +253,7 @@ namespace storm {
                         manager->setRewardModel(rewardModelName);
                     }
                     auto approx = std::make_shared<ExplorerType>(manager, pomdpValueBounds);
+                    approx->setHeuristicSearch(options.heuristicSearchExploration);
                     HeuristicParameters heuristicParameters;
                     heuristicParameters.gapThreshold = options.gapThresholdInit;
                     heuristicParameters.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
@@ -272,6 +283,13 @@ namespace storm {
             
             template<typename PomdpModelType, typename BeliefValueType>
             void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::refineReachability(std::set<uint32_t> const &targetObservations, bool min, boost::optional<std::string> rewardModelName, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds, Result& result) {
+                if (options.concurrentRefinement) {
+                    STORM_LOG_WARN_COND(options.discretize && options.unfold, "Concurrent refinement requires both an over- and an under-approximation. Refining sequentially.");
+                    if (options.discretize && options.unfold) {
+                        refineReachabilityConcurrently(targetObservations, min, rewardModelName, pomdpValueBounds, result);
+                        return;
+                    }
+                }
                 statistics.refinementSteps = 0;
 
                 // Set up exploration data
@@ -286,6 +304,7 @@ namespace storm {
                         overApproxBeliefManager->setRewardModel(rewardModelName);
                     }
                     overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, pomdpValueBounds);
+                    overApproximation->setHeuristicSearch(options.heuristicSearchExploration);
                     overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
                     overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
                     overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
@@ -310,6 +329,7 @@ namespace storm {
                         underApproxBeliefManager->setRewardModel(rewardModelName);
                     }
                     underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, pomdpValueBounds);
+                    underApproximation->setHeuristicSearch(options.heuristicSearchExploration);
                     underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
                     underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
                     underApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit;
@@ -429,6 +449,173 @@ namespace storm {
                 }
             }
 
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::refineReachabilityConcurrently(std::set<uint32_t> const &targetObservations, bool min, boost::optional<std::string> rewardModelName, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds, Result& result) {
+                statistics.refinementSteps = 0;
+                STORM_LOG_WARN_COND(options.refineStepLimit.is_initialized() || !storm::utility::isZero(options.refinePrecision), "No termination criterion for refinement given. Consider to specify a steplimit, a non-zero precisionlimit, or a timeout");
+                auto triangulationMode = options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static;
+
+                // Data that is shared between the two threads. The result and the exchanged bounds are protected by the mutex.
+                std::mutex sharedDataMutex;
+                std::atomic<bool> finished(false);
+                // Bounds on the values of the POMDP states that are obtained from the over-approximation, i.e., upper bounds for maximizing and lower bounds for minimizing properties.
+                // They are only used to guide the exploration of the under-approximation. The values of the under-approximation cannot be passed in the other direction
+                // since the under-approximation does not yield bounds on the values at the states it explores.
+                std::vector<ValueType> pomdpStateBounds(pomdp().getNumberOfStates());
+                uint64_t pomdpStateBoundsVersion = 0;
+                {
+                    auto initialPomdpValueBounds = pomdpValueBounds;
+                    for (uint64_t state = 0; state < pomdpStateBounds.size(); ++state) {
+                        pomdpStateBounds[state] = min ? initialPomdpValueBounds.getHighestLowerBound(state) : initialPomdpValueBounds.getSmallestUpperBound(state);
+                    }
+                }
+
+                auto stepLimitReached = [this](uint64_t const& steps) {
+                    return options.refineStepLimit.is_initialized() && steps >= options.refineStepLimit.get();
+                };
+
+                // Updates the result with the given value of one of the approximations. The mutex has to be locked when calling this.
+                auto updateResult = [&](ValueType const& newValue, bool overApprox, uint64_t const& step) {
+                    bool betterBound = (overApprox == min) ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
+                    if (betterBound) {
+                        STORM_LOG_INFO((overApprox ? "Over" : "Under") << "-approx result for refinement improved after " << statistics.totalTime << " in refinement step #" << step << ". New value is '" << newValue << "'.");
+                        STORM_LOG_INFO("\tCurrent result is [" << result.lowerBound << ", " << result.upperBound << "].");
+                    }
+                    if (result.diff() <= options.refinePrecision) {
+                        finished = true;
+                    }
+                };
+
+                // Both tasks return the number of performed refinement steps and whether a refinement fixpoint has been reached.
+                auto refineOverApproximation = [&]() -> std::pair<uint64_t, bool> {
+                    std::vector<BeliefValueType> observationResolutionVector(pomdp().getNrObservations(), storm::utility::convertNumber<BeliefValueType>(options.resolutionInit));
+                    auto beliefManager = std::make_shared<BeliefManagerType>(pomdp(), options.numericPrecision, triangulationMode);
+                    if (rewardModelName) {
+                        beliefManager->setRewardModel(rewardModelName);
+                    }
+                    auto overApproximation = std::make_shared<ExplorerType>(beliefManager, pomdpValueBounds);
+                    overApproximation->setHeuristicSearch(options.heuristicSearchExploration);
+                    HeuristicParameters heuristicParameters;
+                    heuristicParameters.gapThreshold = options.gapThresholdInit;
+                    heuristicParameters.observationThreshold = options.obsThresholdInit;
+                    heuristicParameters.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
+                    heuristicParameters.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
+                    uint64_t steps = 0;
+                    bool fixPoint = false;
+                    while (true) {
+                        if (steps > 0) {
+                            if (min) {
+                                overApproximation->takeCurrentValuesAsLowerBounds();
+                            } else {
+                                overApproximation->takeCurrentValuesAsUpperBounds();
+                            }
+                            heuristicParameters.gapThreshold *= options.gapThresholdFactor;
+                            heuristicParameters.sizeThreshold = storm::utility::convertNumber<uint64_t, ValueType>(storm::utility::convertNumber<ValueType, uint64_t>(overApproximation->getExploredMdp()->getNumberOfStates()) * options.sizeThresholdFactor);
+                            heuristicParameters.observationThreshold += options.obsThresholdIncrementFactor * (storm::utility::one<ValueType>() - heuristicParameters.observationThreshold);
+                            heuristicParameters.optimalChoiceValueEpsilon *= options.optimalChoiceValueThresholdFactor;
+                        }
+                        fixPoint = buildOverApproximation(targetObservations, min, rewardModelName.is_initialized(), steps > 0, heuristicParameters, observationResolutionVector, beliefManager, overApproximation) && steps > 0;
+                        if (!overApproximation->hasComputedValues() || storm::utility::resources::isTerminate()) {
+                            finished = true;
+                            break;
+                        }
+                        auto diracBeliefValues = overApproximation->getComputedValuesAtDiracBeliefs();
+                        {
+                            std::lock_guard<std::mutex> lock(sharedDataMutex);
+                            for (auto const& stateValue : diracBeliefValues) {
+                                ValueType& bound = pomdpStateBounds[stateValue.first];
+                                bound = min ? std::max(bound, stateValue.second) : std::min(bound, stateValue.second);
+                            }
+                            ++pomdpStateBoundsVersion;
+                            updateResult(overApproximation->getComputedValueAtInitialState(), true, steps);
+                        }
+                        STORM_LOG_INFO_COND(steps > 1000, "Completed over-approx iteration #" << steps << ". Over-approx MDP has size " << overApproximation->getExploredMdp()->getNumberOfStates() << ".");
+                        if (finished || fixPoint || stepLimitReached(steps)) {
+                            break;
+                        }
+                        ++steps;
+                    }
+                    return {steps, fixPoint};
+                };
+
+                auto refineUnderApproximation = [&]() -> std::pair<uint64_t, bool> {
+                    auto beliefManager = std::make_shared<BeliefManagerType>(pomdp(), options.numericPrecision, triangulationMode);
+                    if (rewardModelName) {
+                        beliefManager->setRewardModel(rewardModelName);
+                    }
+                    auto underApproximation = std::make_shared<ExplorerType>(beliefManager, pomdpValueBounds);
+                    underApproximation->setHeuristicSearch(options.heuristicSearchExploration);
+                    HeuristicParameters heuristicParameters;
+                    heuristicParameters.gapThreshold = options.gapThresholdInit;
+                    heuristicParameters.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
+                    heuristicParameters.sizeThreshold = options.sizeThresholdInit;
+                    if (heuristicParameters.sizeThreshold == 0) {
+                        // Select a decent value automatically
+                        heuristicParameters.sizeThreshold = pomdp().getNumberOfStates() * pomdp().getMaxNrStatesWithSameObservation();
+                    }
+                    uint64_t steps = 0;
+                    uint64_t knownPomdpStateBoundsVersion = 0;
+                    bool fixPoint = false;
+                    while (!finished) {
+                        if (steps > 0) {
+                            heuristicParameters.gapThreshold *= options.gapThresholdFactor;
+                            heuristicParameters.sizeThreshold = storm::utility::convertNumber<uint64_t, ValueType>(storm::utility::convertNumber<ValueType, uint64_t>(underApproximation->getExploredMdp()->getNumberOfStates()) * options.sizeThresholdFactor);
+                            heuristicParameters.optimalChoiceValueEpsilon *= options.optimalChoiceValueThresholdFactor;
+                        }
+                        // Take over the bounds that the over-approximation has found since the last step.
+                        boost::optional<std::vector<ValueType>> newPomdpStateBounds;
+                        {
+                            std::lock_guard<std::mutex> lock(sharedDataMutex);
+                            if (knownPomdpStateBoundsVersion != pomdpStateBoundsVersion) {
+                                knownPomdpStateBoundsVersion = pomdpStateBoundsVersion;
+                                newPomdpStateBounds = pomdpStateBounds;
+                            }
+                        }
+                        if (newPomdpStateBounds) {
+                            if (min) {
+                                underApproximation->setAdditionalPomdpLowerValueBounds(newPomdpStateBounds.get());
+                            } else {
+                                underApproximation->setAdditionalPomdpUpperValueBounds(newPomdpStateBounds.get());
+                            }
+                        }
+                        fixPoint = buildUnderApproximation(targetObservations, min, rewardModelName.is_initialized(), steps > 0, heuristicParameters, beliefManager, underApproximation) && steps > 0;
+                        if (!underApproximation->hasComputedValues() || storm::utility::resources::isTerminate()) {
+                            finished = true;
+                            break;
+                        }
+                        {
+                            std::lock_guard<std::mutex> lock(sharedDataMutex);
+                            updateResult(underApproximation->getComputedValueAtInitialState(), false, steps);
+                        }
+                        STORM_LOG_INFO_COND(steps > 1000, "Completed under-approx iteration #" << steps << ". Under-approx MDP has size " << underApproximation->getExploredMdp()->getNumberOfStates() << ".");
+                        if (finished || fixPoint || stepLimitReached(steps)) {
+                            break;
+                        }
+                        ++steps;
+                    }
+                    return {steps, fixPoint};
+                };
+
+                auto overApproxTask = std::async(std::launch::async, refineOverApproximation);
+                std::pair<uint64_t, bool> underApproxSteps;
+                try {
+                    underApproxSteps = refineUnderApproximation();
+                } catch (...) {
+                    // The other thread accesses data on this stack frame, so we wait for it before passing on the exception.
+                    finished = true;
+                    overApproxTask.wait();
+                    throw;
+                }
+                std::pair<uint64_t, bool> overApproxSteps = overApproxTask.get();
+
+                statistics.refinementSteps = std::max(overApproxSteps.first, underApproxSteps.first);
+                STORM_LOG_INFO("Concurrent refinement stopped after " << overApproxSteps.first << " over-approx and " << underApproxSteps.first << " under-approx iterations. Current result is [" << result.lowerBound << ", " << result.upperBound << "].");
+                if (overApproxSteps.second && underApproxSteps.second) {
+                    STORM_LOG_INFO("Refinement fixpoint reached after " << statistics.refinementSteps.get() << " iterations.\n");
+                    statistics.refinementFixpointDetected = true;
+                }
+            }
+
             /*!
              * Heuristically rates the quality of the approximation described by the given successor observation info.
              * Here, 0 means a bad approximation and 1 means a good approximation.
@@ -555,16 +742,46 @@ namespace storm {
                 if (options.explorationTimeLimit) {
                     explorationTime.start();
                 }
-                bool timeLimitExceeded = false;
+                bool explorationLimitExceeded = false;
                 std::map<uint32_t, typename ExplorerType::SuccessorObservationInformation> gatheredSuccessorObservations; // Declare here to avoid reallocations
                 uint64_t numRewiredOrExploredStates = 0;
+                // With multiple threads, the successors of upcoming beliefs are computed in batches and kept until the corresponding state is explored.
+                std::unordered_map<typename BeliefManagerType::BeliefId, std::vector<std::vector<std::pair<typename BeliefManagerType::BeliefId, ValueType>>>> expandedBeliefs;
+                auto expandAndTriangulate = [&](typename BeliefManagerType::BeliefId const& beliefId, uint64_t const& action) {
+                    if (options.expansionThreads <= 1) {
+                        return beliefManager->expandAndTriangulate(beliefId, action, observationResolutionVector);
+                    }
+                    auto expandedBeliefIt = expandedBeliefs.find(beliefId);
+                    if (expandedBeliefIt == expandedBeliefs.end()) {
+                        std::vector<typename BeliefManagerType::BeliefId> batch = {beliefId};
+                        // Consider a few upcoming states per thread so that the threads are kept busy.
+                        for (auto const& upcomingBeliefId : overApproximation->getBeliefIdsOfUpcomingStates(16 * options.expansionThreads)) {
+                            if (targetObservations.count(beliefManager->getBeliefObservation(upcomingBeliefId)) == 0 && expandedBeliefs.count(upcomingBeliefId) == 0) {
+                                batch.push_back(upcomingBeliefId);
+                            }
+                        }
+                        auto batchSuccessors = beliefManager->expandConcurrently(batch, observationResolutionVector, options.expansionThreads);
+                        for (uint64_t i = 0; i < batch.size(); ++i) {
+                            expandedBeliefs.emplace(batch[i], std::move(batchSuccessors[i]));
+                        }
+                        expandedBeliefIt = expandedBeliefs.find(beliefId);
+                    }
+                    return std::move(expandedBeliefIt->second[action]);
+                };
                 while (overApproximation->hasUnexploredState()) {
-                    if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
+                    if (!explorationLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
-                        timeLimitExceeded = true;
+                        explorationLimitExceeded = true;
                         STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because the exploration time limit is exceeded.");
                         fixPoint = false;
                     }
+                    if (!explorationLimitExceeded && explorationMemoryLimitExceeded(*beliefManager, *overApproximation)) {
+                        STORM_LOG_INFO("Exploration memory limit exceeded.");
+                        explorationLimitExceeded = true;
+                        statistics.overApproximationMemoryLimitReached = true;
+                        STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because the exploration memory limit is exceeded.");
+                        fixPoint = false;
+                    }
 
                     uint64_t currId = overApproximation->exploreNextState();
                     bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
@@ -600,7 +817,7 @@ namespace storm {
                         if (!hasOldBehavior) {
                             // Case 1
                             // If we explore this state and if it has no old behavior, it is clear that an "old" optimal scheduler can be extended to a scheduler that reaches this state
-                            if (!timeLimitExceeded && gap > heuristicParameters.gapThreshold && numRewiredOrExploredStates < heuristicParameters.sizeThreshold) {
+                            if (!explorationLimitExceeded && gap > heuristicParameters.gapThreshold && numRewiredOrExploredStates < heuristicParameters.sizeThreshold) {
                                 exploreAllActions = true; // Case 1.1
                             } else {
                                 truncateAllActions = true; // Case 1.2
@@ -609,7 +826,7 @@ namespace storm {
                         } else {
                             if (overApproximation->getCurrentStateWasTruncated()) {
                                 // Case 2
-                                if (!timeLimitExceeded && overApproximation->currentStateIsOptimalSchedulerReachable() && gap > heuristicParameters.gapThreshold && numRewiredOrExploredStates < heuristicParameters.sizeThreshold) {
+                                if (!explorationLimitExceeded && overApproximation->currentStateIsOptimalSchedulerReachable() && gap > heuristicParameters.gapThreshold && numRewiredOrExploredStates < heuristicParameters.sizeThreshold) {
                                     exploreAllActions = true; // Case 2.1
                                     STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because a previously truncated state is now explored.");
                                     fixPoint = false;
@@ -630,7 +847,7 @@ namespace storm {
                             } else {
                                 // Case 3
                                 // The decision for rewiring also depends on the corresponding action, but we have some criteria that lead to case 3.2 (independent of the action)
-                                if (!timeLimitExceeded && overApproximation->currentStateIsOptimalSchedulerReachable() && gap > heuristicParameters.gapThreshold && numRewiredOrExploredStates < heuristicParameters.sizeThreshold) {
+                                if (!explorationLimitExceeded && overApproximation->currentStateIsOptimalSchedulerReachable() && gap > heuristicParameters.gapThreshold && numRewiredOrExploredStates < heuristicParameters.sizeThreshold) {
                                     checkRewireForAllActions = true; // Case 3.1 or Case 3.2
                                 } else {
                                     restoreAllActions = true; // Definitely Case 3.2
@@ -674,7 +891,7 @@ namespace storm {
                                 expandedAtLeastOneAction = true;
                                 if (!truncateAllActions) {
                                     // Cases 1.1, 2.1, or 3.1
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    auto successorGridPoints = expandAndTriangulate(currId, action);
                                     for (auto const& successor : successorGridPoints) {
                                         overApproximation->addTransitionToBelief(action, successor.first, successor.second, false);
                                     }
@@ -685,7 +902,7 @@ namespace storm {
                                     // Cases 1.2 or 2.2
                                     ValueType truncationProbability = storm::utility::zero<ValueType>();
                                     ValueType truncationValueBound = storm::utility::zero<ValueType>();
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    auto successorGridPoints = expandAndTriangulate(currId, action);
                                     for (auto const& successor : successorGridPoints) {
                                         bool added = overApproximation->addTransitionToBelief(action, successor.first, successor.second, true);
                                         if (!added) {
@@ -710,6 +927,7 @@ namespace storm {
                         if (expandedAtLeastOneAction) {
                             ++numRewiredOrExploredStates;
                         }
+                        expandedBeliefs.erase(currId);
                     }
                     
                     if (storm::utility::resources::isTerminate()) {
@@ -741,6 +959,15 @@ namespace storm {
                 return fixPoint;
             }
 
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::explorationMemoryLimitExceeded(BeliefManagerType const& beliefManager, ExplorerType const& explorer) const {
+                if (!options.explorationMemoryLimit) {
+                    return false;
+                }
+                uint64_t memoryUsage = beliefManager.getMemoryUsage() + explorer.getMemoryUsage();
+                return memoryUsage > options.explorationMemoryLimit.get() * 1024 * 1024;
+            }
+
             template<typename PomdpModelType, typename BeliefValueType>
             bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::buildUnderApproximation(std::set<uint32_t> const &targetObservations, bool min, bool computeRewards, bool refine, HeuristicParameters const& heuristicParameters, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& underApproximation) {
                 statistics.underApproximationBuildTime.start();
@@ -765,17 +992,22 @@ namespace storm {
                 if (options.explorationTimeLimit) {
                     explorationTime.start();
                 }
-                bool timeLimitExceeded = false;
+                bool explorationLimitExceeded = false;
                 while (underApproximation->hasUnexploredState()) {
-                    if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
+                    if (!explorationLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
-                        timeLimitExceeded = true;
+                        explorationLimitExceeded = true;
+                    }
+                    if (!explorationLimitExceeded && explorationMemoryLimitExceeded(*beliefManager, *underApproximation)) {
+                        STORM_LOG_INFO("Exploration memory limit exceeded.");
+                        explorationLimitExceeded = true;
+                        statistics.underApproximationMemoryLimitReached = true;
                     }
                     uint64_t currId = underApproximation->exploreNextState();
                     
                     uint32_t currObservation = beliefManager->getBeliefObservation(currId);
                     bool stateAlreadyExplored = refine && underApproximation->currentStateHasOldBehavior() && !underApproximation->getCurrentStateWasTruncated();
-                    if (!stateAlreadyExplored || timeLimitExceeded) {
+                    if (!stateAlreadyExplored || explorationLimitExceeded) {
                         fixPoint = false;
                     }
                     if (targetObservations.count(currObservation) != 0) {
@@ -783,7 +1015,7 @@ namespace storm {
                         underApproximation->addSelfloopTransition();
                     } else {
                         bool stopExploration = false;
-                        if (timeLimitExceeded) {
+                        if (explorationLimitExceeded) {
                             stopExploration = true;
                             underApproximation->setCurrentStateIsTruncated();
                         } else if (!stateAlreadyExplored) {
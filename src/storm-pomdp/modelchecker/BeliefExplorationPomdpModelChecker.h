@@ -73,6 +73,16 @@ namespace storm {
                  */
                 void refineReachability(std::set<uint32_t> const &targetObservations, bool min, boost::optional<std::string> rewardModelName, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds, Result& result);
                 
+                /**
+                 * Runs the automatic refinement loop, where the over- and the under-approximation are refined concurrently in two threads.
+                 * Whenever the over-approximation has been checked, its values at Dirac beliefs are passed to the under-approximation, where they tighten the value bounds that guide the exploration.
+                 * The refinement stops as soon as the goal precision, the refinement step limit, or a fixpoint of both approximations is reached.
+                 *
+                 * @param targetObservations the set of observations to be reached
+                 * @param min true if minimum probability is to be computed
+                 */
+                void refineReachabilityConcurrently(std::set<uint32_t> const &targetObservations, bool min, boost::optional<std::string> rewardModelName, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds, Result& result);
+                
                 struct HeuristicParameters {
                     ValueType gapThreshold;
                     ValueType observationThreshold;
@@ -92,6 +102,11 @@ namespace storm {
                  */
                 bool buildUnderApproximation(std::set<uint32_t> const &targetObservations, bool min, bool computeRewards, bool refine, HeuristicParameters const& heuristicParameters, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& underApproximation);
 
+                /**
+                 * Returns true if a memory limit for the exploration is given and the estimated memory of the given belief manager and explorer exceeds it.
+                 */
+                bool explorationMemoryLimitExceeded(BeliefManagerType const& beliefManager, ExplorerType const& explorer) const;
+
                 BeliefValueType rateObservation(typename ExplorerType::SuccessorObservationInformation const& info, BeliefValueType const& observationResolution, BeliefValueType const& maxResolution);
                 
                 std::vector<BeliefValueType> getObservationRatings(std::shared_ptr<ExplorerType> const& overApproximation, std::vector<BeliefValueType> const& observationResolutionVector);
@@ -106,12 +121,14 @@ namespace storm {
                     
                     boost::optional<uint64_t> overApproximationStates;
                     bool overApproximationBuildAborted;
+                    bool overApproximationMemoryLimitReached;
                     storm::utility::Stopwatch overApproximationBuildTime;
                     storm::utility::Stopwatch overApproximationCheckTime;
                     boost::optional<BeliefValueType> overApproximationMaxResolution;
                     
                     boost::optional<uint64_t> underApproximationStates;
                     bool underApproximationBuildAborted;
+                    bool underApproximationMemoryLimitReached;
                     storm::utility::Stopwatch underApproximationBuildTime;
                     storm::utility::Stopwatch underApproximationCheckTime;
                     boost::optional<uint64_t> underApproximationStateLimit;
@@ -19,6 +19,7 @@ namespace storm {
                 boost::optional<uint64_t> refineStepLimit;
                 ValueType refinePrecision = storm::utility::zero<ValueType>();
                 boost::optional<uint64_t> explorationTimeLimit;
+                boost::optional<uint64_t> explorationMemoryLimit; // In megabytes. Once the (estimated) memory of the beliefs and the explored MDP exceeds this, the remaining states are cut off.
                 
                 // Controlparameters for the refinement heuristic
                 // Discretization Resolution
@@ -39,6 +40,9 @@ namespace storm {
                 
                 ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
                 bool dynamicTriangulation = true; // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+                bool concurrentRefinement = false; // Sets whether the over- and the under-approximation are refined concurrently in two threads (requires both discretize and unfold)
+                uint64_t expansionThreads = 1; // The number of threads that compute the successors (and triangulations) of the explored beliefs
+                bool heuristicSearchExploration = false; // Sets whether beliefs are explored in a heuristic search order (prioritizing large probability-weighted gaps between the bounds) instead of breadth-first
             };
         }
     }
@@ -1,5 +1,11 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
@@ -28,22 +34,10 @@ namespace storm {
             }
         }
 
-        template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-            std::size_t seed = 0;
-            // Assumes that beliefs are ordered
-            for (auto const &entry : belief) {
-                boost::hash_combine(seed, entry.first);
-                boost::hash_combine(seed, entry.second);
-            }
-            return seed;
-        }
-
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
                 : pomdp(pomdp), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
             initialBeliefId = computeInitialBelief();
         }
 
@@ -98,6 +92,15 @@ namespace storm {
             return result;
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        boost::optional<StateType> BeliefManager<PomdpType, BeliefValueType, StateType>::getDiracState(BeliefId const &beliefId) const {
+            auto const &belief = getBelief(beliefId);
+            if (belief.size() == 1) {
+                return belief.begin()->first;
+            }
+            return boost::none;
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId const &BeliefManager<PomdpType, BeliefValueType, StateType>::getInitialBelief() const {
             return initialBeliefId;
@@ -138,7 +141,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         template<typename DistributionType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const {
             auto insertionRes = distr.emplace(state, value);
             if (!insertionRes.second) {
                 insertionRes.first->second += value;
@@ -158,6 +161,11 @@ namespace storm {
             return beliefs.size();
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getMemoryUsage() const {
+            return beliefs.getMemoryUsage() + pomdpActionRewardVector.capacity() * sizeof(ValueType);
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
         BeliefManager<PomdpType, BeliefValueType, StateType>::expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex,
@@ -172,23 +180,22 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return beliefs.getBelief(id);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefView const &belief) const {
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            BeliefId id = beliefs.find(belief);
+            STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+            return id;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefView const &belief) const {
             std::stringstream str;
             str << "{ ";
             bool first = true;
@@ -205,7 +212,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefView const &first, BeliefView const &second) const {
             if (first.size() != second.size()) {
                 return false;
             }
@@ -223,7 +230,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefView const &belief) const {
             BeliefValueType sum = storm::utility::zero<ValueType>();
             boost::optional<uint32_t> observation;
             for (auto const &entry : belief) {
@@ -264,12 +271,12 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefView const &belief, PendingTriangulation const &triangulation) const {
             if (triangulation.weights.size() != triangulation.gridPoints.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
             }
-            if (triangulation.size() == 0) {
+            if (triangulation.weights.empty()) {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
@@ -288,7 +295,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
+                BeliefType const &gridPoint = triangulation.gridPoints[i];
                 for (auto const &pointEntry : gridPoint) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
@@ -309,14 +316,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefView const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -325,20 +332,30 @@ namespace storm {
             // Variable names are mostly based on the paper
             // However, we speed this up a little by exploiting that belief states usually have sparse support (i.e. numEntries is much smaller than pomdp.getNumberOfStates()).
             // Initialize diffs and the first row of the 'qs' matrix (aka v)
-            std::set<FreudenthalDiff, std::greater<FreudenthalDiff>> sorted_diffs; // d (and p?) in the paper
+            // The diffs are kept in a sorted vector (instead of a set) to avoid an allocation per belief entry.
+            std::vector<FreudenthalDiff> sorted_diffs; // d (and p?) in the paper
+            sorted_diffs.reserve(numEntries);
             std::vector<BeliefValueType> qsRow; // Row of the 'qs' matrix from the paper (initially corresponds to v
-            qsRow.reserve(numEntries);
+            qsRow.reserve(numEntries + 1);
             std::vector<StateType> toOriginalIndicesMap; // Maps 'local' indices to the original pomdp state indices
             toOriginalIndicesMap.reserve(numEntries);
             BeliefValueType x = resolution;
             for (auto const &entry : belief) {
                 qsRow.push_back(storm::utility::floor(x)); // v
-                sorted_diffs.emplace(toOriginalIndicesMap.size(), x - qsRow.back()); // x-v
+                sorted_diffs.emplace_back(toOriginalIndicesMap.size(), x - qsRow.back()); // x-v
                 toOriginalIndicesMap.push_back(entry.first);
                 x -= entry.second * resolution;
             }
+            std::sort(sorted_diffs.begin(), sorted_diffs.end(), std::greater<FreudenthalDiff>());
             // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
             qsRow.push_back(storm::utility::zero<BeliefValueType>());
+            // The (unscaled) entries of the current grid point, i.e., the differences of neighboring entries of the current qs row.
+            // As only one entry of the qs row changes from one grid point to the next, at most two of these entries need to be updated.
+            std::vector<BeliefValueType> gridPointEntries;
+            gridPointEntries.reserve(numEntries);
+            for (StateType j = 0; j < numEntries; ++j) {
+                gridPointEntries.push_back(qsRow[j] - qsRow[j + 1]);
+            }
 
             result.weights.reserve(numEntries);
             result.gridPoints.reserve(numEntries);
@@ -353,26 +370,31 @@ namespace storm {
                     weight += storm::utility::one<ValueType>();
                 } else {
                     // 'compute' the next row of the qs matrix
-                    qsRow[previousSortedDiff->dimension] += storm::utility::one<BeliefValueType>();
+                    StateType const &dimension = previousSortedDiff->dimension;
+                    qsRow[dimension] += storm::utility::one<BeliefValueType>();
+                    gridPointEntries[dimension] += storm::utility::one<BeliefValueType>();
+                    if (dimension > 0) {
+                        gridPointEntries[dimension - 1] -= storm::utility::one<BeliefValueType>();
+                    }
                 }
                 if (!cc.isZero(weight)) {
                     result.weights.push_back(weight);
-                    // Compute the grid point
+                    // Compute the grid point. The original indices are increasing, so the entries can be appended.
                     BeliefType gridPoint;
+                    gridPoint.reserve(numEntries);
                     for (StateType j = 0; j < numEntries; ++j) {
-                        BeliefValueType gridPointEntry = qsRow[j] - qsRow[j + 1];
-                        if (!cc.isZero(gridPointEntry)) {
-                            gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
+                        if (!cc.isZero(gridPointEntries[j])) {
+                            gridPoint.emplace_hint(gridPoint.end(), toOriginalIndicesMap[j], gridPointEntries[j] / resolution);
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    result.gridPoints.push_back(std::move(gridPoint));
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -409,14 +431,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::PendingTriangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefView const &belief, BeliefValueType const &resolution) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            PendingTriangulation result;
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
                 result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                result.gridPoints.push_back(belief.toBelief());
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
@@ -430,17 +452,28 @@ namespace storm {
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation.");
             return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution) {
+            PendingTriangulation pendingTriangulation = computeTriangulation(belief, resolution);
+            Triangulation result;
+            result.weights = std::move(pendingTriangulation.weights);
+            result.gridPoints.reserve(pendingTriangulation.gridPoints.size());
+            for (auto const &gridPoint : pendingTriangulation.gridPoints) {
+                result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            }
+            return result;
+        }
 
-            BeliefType belief = getBelief(beliefId);
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessors(BeliefView const &belief, uint64_t actionIndex,
+                                                                                boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            std::vector<std::pair<BeliefType, ValueType>> destinations;
 
             // Find the probability we go to each observation
             BeliefType successorObs; // This is actually not a belief but has the same type
@@ -470,18 +503,90 @@ namespace storm {
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
+                    PendingTriangulation triangulation = computeTriangulation(successorBelief, observationTriangulationResolutions.get()[successor.first]);
+                    for (size_t j = 0; j < triangulation.weights.size(); ++j) {
                         // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                        destinations.emplace_back(std::move(triangulation.gridPoints[j]), triangulation.weights[j] * successor.second);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    destinations.emplace_back(std::move(successorBelief), successor.second);
                 }
             }
 
             return destinations;
+        }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            // The successors are computed completely before they are added because adding beliefs invalidates views of stored beliefs.
+            auto successors = computeSuccessors(getBelief(beliefId), actionIndex, observationTriangulationResolutions);
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            destinations.reserve(successors.size());
+            for (auto const &successor : successors) {
+                destinations.emplace_back(getOrAddBeliefId(successor.first), successor.second);
+            }
+            return destinations;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::vector<std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandConcurrently(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions,
+                                                                                 uint64_t numberOfThreads) {
+            // Gather the pairs of beliefs and actions that need to be expanded.
+            std::vector<std::vector<std::vector<std::pair<BeliefId, ValueType>>>> result(beliefIds.size());
+            std::vector<std::pair<uint64_t, uint64_t>> expansions;
+            for (uint64_t beliefIndex = 0; beliefIndex < beliefIds.size(); ++beliefIndex) {
+                uint64_t numberOfChoices = getBeliefNumberOfChoices(beliefIds[beliefIndex]);
+                result[beliefIndex].resize(numberOfChoices);
+                for (uint64_t action = 0; action < numberOfChoices; ++action) {
+                    expansions.emplace_back(beliefIndex, action);
+                }
+            }
+
+            // Compute the successors. As the belief storage is not modified in this phase, the threads only need to agree on the next expansion to compute.
+            std::vector<std::vector<std::pair<BeliefType, ValueType>>> successors(expansions.size());
+            std::atomic<uint64_t> nextExpansion(0);
+            std::exception_ptr exception;
+            std::mutex exceptionMutex;
+            auto computeExpansions = [&]() {
+                try {
+                    for (uint64_t expansion = nextExpansion++; expansion < expansions.size(); expansion = nextExpansion++) {
+                        successors[expansion] = computeSuccessors(getBelief(beliefIds[expansions[expansion].first]), expansions[expansion].second, observationResolutions);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(exceptionMutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                    // Let the other threads stop as soon as possible.
+                    nextExpansion = expansions.size();
+                }
+            };
+            numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, expansions.size()));
+            std::vector<std::thread> threads;
+            threads.reserve(numberOfThreads - 1);
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                threads.emplace_back(computeExpansions);
+            }
+            computeExpansions();
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+
+            // Add the successors in a fixed order.
+            for (uint64_t expansion = 0; expansion < expansions.size(); ++expansion) {
+                auto &destinations = result[expansions[expansion].first][expansions[expansion].second];
+                destinations.reserve(successors[expansion].size());
+                for (auto const &successor : successors[expansion]) {
+                    destinations.emplace_back(getOrAddBeliefId(successor.first), successor.second);
+                }
+            }
+            return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -498,16 +603,9 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefView const &belief) {
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            return beliefs.findOrAdd(belief);
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
@@ -7,6 +7,7 @@
 #include <boost/container/flat_set.hpp>
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm-pomdp/storage/CompactBeliefStore.h"
 
 namespace storm {
     namespace storage {
@@ -15,7 +16,8 @@ namespace storm {
         class BeliefManager {
         public:
             typedef typename PomdpType::ValueType ValueType;
-            typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType; // iterating over this shall be ordered (for correct hash computation)
+            typedef CompactBeliefStore<StateType, BeliefValueType> BeliefStoreType;
+            typedef typename BeliefStoreType::BeliefType BeliefType; // iterating over this shall be ordered (for correct hash computation)
             typedef boost::container::flat_set<StateType> BeliefSupportType;
             typedef uint64_t BeliefId;
 
@@ -47,6 +49,11 @@ namespace storm {
 
             ValueType getWeightedSum(BeliefId const &beliefId, std::vector<ValueType> const &summands);
 
+            /*!
+             * If the given belief is a Dirac belief, i.e., its support consists of a single POMDP state, that state is returned.
+             */
+            boost::optional<StateType> getDiracState(BeliefId const &beliefId) const;
+
             BeliefId const &getInitialBelief() const;
 
             ValueType getBeliefActionReward(BeliefId const &beliefId, uint64_t const &localActionIndex) const;
@@ -58,22 +65,34 @@ namespace storm {
             Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
             template<typename DistributionType>
-            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
             void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
             BeliefId getNumberOfBeliefIds() const;
 
+            /*!
+             * Retrieves an estimate of the memory (in bytes) that is allocated for the stored beliefs.
+             */
+            uint64_t getMemoryUsage() const;
+
             std::vector<std::pair<BeliefId, ValueType>>
             expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const &observationResolutions);
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
-        private:
+            /*!
+             * Expands the given beliefs under each of their actions. If observation resolutions are given, the successor beliefs are triangulated as in expandAndTriangulate.
+             * The successor beliefs (or grid points) are computed concurrently by the given number of threads. They are only added to this manager afterwards
+             * (in the order of the given beliefs and actions), so the ids of new beliefs do not depend on the number of threads.
+             *
+             * @return for each given belief and each of its actions the successor beliefs (or grid points) together with their probabilities
+             */
+            std::vector<std::vector<std::vector<std::pair<BeliefId, ValueType>>>>
+            expandConcurrently(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions, uint64_t numberOfThreads);
 
-            struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
-            };
+        private:
+            typedef typename BeliefStoreType::BeliefView BeliefView;
 
             struct FreudenthalDiff {
                 FreudenthalDiff(StateType const &dimension, BeliefValueType diff);
@@ -83,38 +102,52 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            BeliefView getBelief(BeliefId const &id) const;
 
-            BeliefId getId(BeliefType const &belief) const;
+            BeliefId getId(BeliefView const &belief) const;
 
-            std::string toString(BeliefType const &belief) const;
+            std::string toString(BeliefView const &belief) const;
+
+            bool isEqual(BeliefView const &first, BeliefView const &second) const;
+
+            bool assertBelief(BeliefView const &belief) const;
+
+            // A triangulation whose grid points have not been added to the belief storage yet.
+            struct PendingTriangulation {
+                std::vector<BeliefType> gridPoints;
+                std::vector<BeliefValueType> weights;
+            };
 
-            bool isEqual(BeliefType const &first, BeliefType const &second) const;
+            bool assertTriangulation(BeliefView const &belief, PendingTriangulation const &triangulation) const;
 
-            bool assertBelief(BeliefType const &belief) const;
+            uint32_t getBeliefObservation(BeliefView const &belief) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            void triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            void triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            PendingTriangulation computeTriangulation(BeliefView const &belief, BeliefValueType const &resolution) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            Triangulation triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution);
 
-            Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+            /*!
+             * Computes the successor beliefs (or their grid points, if observation resolutions are given) without adding them to the belief storage.
+             * As the belief storage is not modified, this can be called concurrently.
+             */
+            std::vector<std::pair<BeliefType, ValueType>>
+            computeSuccessors(BeliefView const &belief, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
 
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
             BeliefId computeInitialBelief();
 
-            BeliefId getOrAddBeliefId(BeliefType const &belief);
+            BeliefId getOrAddBeliefId(BeliefView const &belief);
 
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            BeliefStoreType beliefs;
             BeliefId initialBeliefId;
             
             storm::utility::ConstantsComparator<ValueType> cc;
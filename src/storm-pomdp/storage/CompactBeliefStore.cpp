@@ -0,0 +1,163 @@
+#include "storm-pomdp/storage/CompactBeliefStore.h"
+
+#include <limits>
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename StateType, typename BeliefValueType>
+        CompactBeliefStore<StateType, BeliefValueType>::BeliefView::BeliefView(EntryType const* first, EntryType const* last) : first(first), last(last) {
+            // Intentionally left empty
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        CompactBeliefStore<StateType, BeliefValueType>::BeliefView::BeliefView(BeliefType const &belief) : first(belief.empty() ? nullptr : &*belief.begin()), last(first + belief.size()) {
+            // Intentionally left empty
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        typename CompactBeliefStore<StateType, BeliefValueType>::EntryType const* CompactBeliefStore<StateType, BeliefValueType>::BeliefView::begin() const {
+            return first;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        typename CompactBeliefStore<StateType, BeliefValueType>::EntryType const* CompactBeliefStore<StateType, BeliefValueType>::BeliefView::end() const {
+            return last;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        uint64_t CompactBeliefStore<StateType, BeliefValueType>::BeliefView::size() const {
+            return last - first;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        bool CompactBeliefStore<StateType, BeliefValueType>::BeliefView::empty() const {
+            return first == last;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        typename CompactBeliefStore<StateType, BeliefValueType>::BeliefType CompactBeliefStore<StateType, BeliefValueType>::BeliefView::toBelief() const {
+            // The entries are already ordered, so we can insert them without further checks.
+            BeliefType result;
+            result.insert(boost::container::ordered_unique_range, first, last);
+            return result;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        CompactBeliefStore<StateType, BeliefValueType>::CompactBeliefStore() : offsets(1, 0), table(16, noId()) {
+            // Intentionally left empty
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        typename CompactBeliefStore<StateType, BeliefValueType>::BeliefId CompactBeliefStore<StateType, BeliefValueType>::noId() const {
+            return std::numeric_limits<BeliefId>::max();
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        typename CompactBeliefStore<StateType, BeliefValueType>::BeliefId CompactBeliefStore<StateType, BeliefValueType>::findOrAdd(BeliefView const &belief) {
+            std::size_t hash = computeHash(belief);
+            uint64_t position = findPosition(belief, hash);
+            if (table[position] != noId()) {
+                return table[position];
+            }
+
+            // Keep the load factor of the table below 3/4.
+            if (4 * (size() + 1) > 3 * table.size()) {
+                rehash(2 * table.size());
+                position = findPosition(belief, hash);
+            }
+            BeliefId id = size();
+            entries.insert(entries.end(), belief.begin(), belief.end());
+            offsets.push_back(entries.size());
+            hashes.push_back(hash);
+            table[position] = id;
+            return id;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        typename CompactBeliefStore<StateType, BeliefValueType>::BeliefId CompactBeliefStore<StateType, BeliefValueType>::find(BeliefView const &belief) const {
+            return table[findPosition(belief, computeHash(belief))];
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        typename CompactBeliefStore<StateType, BeliefValueType>::BeliefView CompactBeliefStore<StateType, BeliefValueType>::getBelief(BeliefId const &id) const {
+            STORM_LOG_ASSERT(id < size(), "Belief index " << id << " is out of range.");
+            return BeliefView(entries.data() + offsets[id], entries.data() + offsets[id + 1]);
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        uint64_t CompactBeliefStore<StateType, BeliefValueType>::size() const {
+            return hashes.size();
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        uint64_t CompactBeliefStore<StateType, BeliefValueType>::getNumberOfEntries() const {
+            return entries.size();
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        uint64_t CompactBeliefStore<StateType, BeliefValueType>::getMemoryUsage() const {
+            return entries.capacity() * sizeof(EntryType) + offsets.capacity() * sizeof(uint64_t) + hashes.capacity() * sizeof(std::size_t) + table.capacity() * sizeof(BeliefId);
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        std::size_t CompactBeliefStore<StateType, BeliefValueType>::computeHash(BeliefView const &belief) {
+            std::size_t seed = 0;
+            // Assumes that beliefs are ordered
+            for (auto const &entry : belief) {
+                boost::hash_combine(seed, entry.first);
+                boost::hash_combine(seed, entry.second);
+            }
+            return seed;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        bool CompactBeliefStore<StateType, BeliefValueType>::isEqual(BeliefId const &id, BeliefView const &belief) const {
+            BeliefView storedBelief = getBelief(id);
+            if (storedBelief.size() != belief.size()) {
+                return false;
+            }
+            auto beliefIt = belief.begin();
+            for (auto const &entry : storedBelief) {
+                if (entry.first != beliefIt->first || entry.second != beliefIt->second) {
+                    return false;
+                }
+                ++beliefIt;
+            }
+            return true;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        uint64_t CompactBeliefStore<StateType, BeliefValueType>::findPosition(BeliefView const &belief, std::size_t const &hash) const {
+            uint64_t const mask = table.size() - 1;
+            uint64_t position = hash & mask;
+            // Compare the precomputed hash values first to avoid most of the comparisons of the entries.
+            while (table[position] != noId() && (hashes[table[position]] != hash || !isEqual(table[position], belief))) {
+                position = (position + 1) & mask;
+            }
+            return position;
+        }
+
+        template<typename StateType, typename BeliefValueType>
+        void CompactBeliefStore<StateType, BeliefValueType>::rehash(uint64_t newTableSize) {
+            STORM_LOG_ASSERT((newTableSize & (newTableSize - 1)) == 0, "The size of the hash table has to be a power of two.");
+            table.assign(newTableSize, noId());
+            uint64_t const mask = newTableSize - 1;
+            for (BeliefId id = 0; id < size(); ++id) {
+                uint64_t position = hashes[id] & mask;
+                while (table[position] != noId()) {
+                    position = (position + 1) & mask;
+                }
+                table[position] = id;
+            }
+        }
+
+        template class CompactBeliefStore<uint64_t, double>;
+
+        template class CompactBeliefStore<uint64_t, storm::RationalNumber>;
+    }
+}
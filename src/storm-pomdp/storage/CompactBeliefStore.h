@@ -0,0 +1,105 @@
+#pragma once
+
+#include <vector>
+#include <boost/container/flat_map.hpp>
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Stores beliefs, i.e., sparse distributions over POMDP states, and assigns a unique id to each of them.
+         * The entries of all beliefs are kept in a single contiguous array. Beliefs are interned using an open addressing hash table
+         * (with linear probing) that only stores belief ids and relies on the precomputed hash values of the stored beliefs.
+         * Compared to storing each belief as a separate map (and a second time as the key of a hash map), this avoids the duplication
+         * as well as the per-belief allocations.
+         */
+        template <typename StateType, typename BeliefValueType>
+        class CompactBeliefStore {
+        public:
+            typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType; // iterating over this shall be ordered (for correct hash computation)
+            typedef typename BeliefType::value_type EntryType;
+            typedef uint64_t BeliefId;
+
+            /*!
+             * A lightweight view on the (ordered) entries of a belief.
+             * Views of stored beliefs are invalidated whenever a new belief is added to the store.
+             */
+            class BeliefView {
+            public:
+                BeliefView(EntryType const* first, EntryType const* last);
+
+                /*!
+                 * Creates a view on the entries of the given belief.
+                 */
+                BeliefView(BeliefType const &belief);
+
+                EntryType const* begin() const;
+                EntryType const* end() const;
+                uint64_t size() const;
+                bool empty() const;
+
+                /*!
+                 * Copies the entries of this view into a new belief.
+                 */
+                BeliefType toBelief() const;
+
+            private:
+                EntryType const* first;
+                EntryType const* last;
+            };
+
+            CompactBeliefStore();
+
+            BeliefId noId() const;
+
+            /*!
+             * Retrieves the id of the given belief, adding it to the store if it is not yet present.
+             */
+            BeliefId findOrAdd(BeliefView const &belief);
+
+            /*!
+             * Retrieves the id of the given belief or noId() if it is not present.
+             */
+            BeliefId find(BeliefView const &belief) const;
+
+            BeliefView getBelief(BeliefId const &id) const;
+
+            /*!
+             * Retrieves the number of stored beliefs. The ids of the stored beliefs are 0, 1, ..., size() - 1.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the total number of entries of all stored beliefs.
+             */
+            uint64_t getNumberOfEntries() const;
+
+            /*!
+             * Retrieves an estimate of the memory (in bytes) that is allocated by this store.
+             */
+            uint64_t getMemoryUsage() const;
+
+        private:
+            static std::size_t computeHash(BeliefView const &belief);
+
+            bool isEqual(BeliefId const &id, BeliefView const &belief) const;
+
+            /*!
+             * Retrieves the position of the given belief in the hash table, i.e., either the position of the matching id or the first free position.
+             */
+            uint64_t findPosition(BeliefView const &belief, std::size_t const &hash) const;
+
+            void rehash(uint64_t newTableSize);
+
+            // The entries of all beliefs. The entries of the belief with id i are at positions offsets[i], ..., offsets[i+1] - 1.
+            std::vector<EntryType> entries;
+            std::vector<uint64_t> offsets;
+
+            // The hash value of each stored belief.
+            std::vector<std::size_t> hashes;
+
+            // The hash table whose size is always a power of two. Free positions are marked with noId().
+            std::vector<BeliefId> table;
+        };
+    }
+}
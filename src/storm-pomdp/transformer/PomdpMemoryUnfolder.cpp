@@ -4,7 +4,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/sparse/ModelComponents.h"
-#include "storm/utility/graph.h"
+#include "storm/utility/constants.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -21,23 +21,20 @@ namespace storm {
             
             template<typename ValueType>
             std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> PomdpMemoryUnfolder<ValueType>::transform() const {
-                // For simplicity we first build the 'full' product of pomdp and memory (with pomdp.numStates * memory.numStates states).
                 STORM_LOG_THROW(pomdp.isCanonic() , storm::exceptions::InvalidArgumentException, "POMDP must be canonical to unfold memory into it");
+                // Only the reachable part of the product of pomdp and memory is built.
+                // The reachable states keep the order of the 'full' product (with pomdp.numStates * memory.numStates states).
+                storm::storage::BitVector reachableStates = computeReachableStates();
                 storm::storage::sparse::ModelComponents<ValueType> components;
-                components.transitionMatrix = transformTransitions();
-                components.stateLabeling = transformStateLabeling();
-                
-                // Now delete unreachable states.
-                storm::storage::BitVector allStates(components.transitionMatrix.getRowGroupCount(), true);
-                auto reachableStates = storm::utility::graph::getReachableStates(components.transitionMatrix, components.stateLabeling.getStates("init"), allStates, ~allStates);
-                components.transitionMatrix = components.transitionMatrix.getSubmatrix(true, reachableStates, reachableStates);
-                components.stateLabeling = components.stateLabeling.getSubLabeling(reachableStates);
+                components.transitionMatrix = transformTransitions(reachableStates);
+                components.stateLabeling = transformStateLabeling(reachableStates);
                 if (keepStateValuations && pomdp.hasStateValuations()) {
-                    std::vector<uint64_t> newToOldStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), 0);
-                    for (uint64_t newState = 0; newState < newToOldStates.size(); newState++) {
-                        newToOldStates[newState] = getModelState(newState);
+                    std::vector<uint64_t> newToOldStates;
+                    newToOldStates.reserve(reachableStates.getNumberOfSetBits());
+                    for (auto const& unfoldingState : reachableStates) {
+                        newToOldStates.push_back(getModelState(unfoldingState));
                     }
-                    components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates).selectStates(reachableStates);
+                    components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates);
                 }
 
                 // build the remaining components
@@ -50,34 +47,67 @@ namespace storm {
             }
         
             template<typename ValueType>
-            storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions() const {
+            storm::storage::BitVector PomdpMemoryUnfolder<ValueType>::computeReachableStates() const {
+                storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
+                storm::storage::BitVector reachableStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+                std::vector<uint64_t> stack;
+                for (auto const& modelState : pomdp.getInitialStates()) {
+                    uint64_t unfoldingState = getUnfoldingState(modelState, memory.getInitialState());
+                    if (!reachableStates.get(unfoldingState)) {
+                        reachableStates.set(unfoldingState);
+                        stack.push_back(unfoldingState);
+                    }
+                }
+                while (!stack.empty()) {
+                    uint64_t unfoldingState = stack.back();
+                    stack.pop_back();
+                    uint64_t modelState = getModelState(unfoldingState);
+                    for (auto const& entry : origTransitions.getRowGroup(modelState)) {
+                        if (storm::utility::isZero(entry.getValue())) {
+                            continue;
+                        }
+                        for (auto const& memStatePrime : memory.getTransitions(getMemoryState(unfoldingState))) {
+                            uint64_t successor = getUnfoldingState(entry.getColumn(), memStatePrime);
+                            if (!reachableStates.get(successor)) {
+                                reachableStates.set(successor);
+                                stack.push_back(successor);
+                            }
+                        }
+                    }
+                }
+                return reachableStates;
+            }
+        
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions(storm::storage::BitVector const& reachableStates) const {
                 storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
                 uint64_t numRows = 0;
                 uint64_t numEntries = 0;
-                for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                    for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
-                        numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
-                    }
+                for (auto const& unfoldingState : reachableStates) {
+                    uint64_t modelState = getModelState(unfoldingState);
+                    uint64_t memState = getMemoryState(unfoldingState);
+                    numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
+                    numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
                 }
-                storm::storage::SparseMatrixBuilder<ValueType> builder(numRows,
-                                                                        pomdp.getNumberOfStates() * memory.getNumberOfStates(),
-                                                                        numEntries,
-                                                                        true,
-                                                                        true,
-                                                                        pomdp.getNumberOfStates() * memory.getNumberOfStates());
+                uint64_t numStates = reachableStates.getNumberOfSetBits();
+                std::vector<uint_fast64_t> newStateIndices = reachableStates.getNumberOfSetBitsBeforeIndices();
+                storm::storage::SparseMatrixBuilder<ValueType> builder(numRows, numStates, numEntries, true, true, numStates);
                 
                 uint64_t row = 0;
-                for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                    for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        builder.newRowGroup(row);
-                        for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
-                            for (auto const& memStatePrime : memory.getTransitions(memState)) {
-                                for (auto const& entry : origTransitions.getRow(origRow)) {
-                                    builder.addNextValue(row, getUnfoldingState(entry.getColumn(), memStatePrime), entry.getValue());
+                for (auto const& unfoldingState : reachableStates) {
+                    uint64_t modelState = getModelState(unfoldingState);
+                    uint64_t memState = getMemoryState(unfoldingState);
+                    builder.newRowGroup(row);
+                    for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
+                        for (auto const& memStatePrime : memory.getTransitions(memState)) {
+                            for (auto const& entry : origTransitions.getRow(origRow)) {
+                                uint64_t successor = getUnfoldingState(entry.getColumn(), memStatePrime);
+                                // Zero entries might lead to states that are not reachable
+                                if (reachableStates.get(successor)) {
+                                    builder.addNextValue(row, newStateIndices[successor], entry.getValue());
                                 }
-                                ++row;
                             }
+                            ++row;
                         }
                     }
                 }
@@ -85,20 +115,25 @@ namespace storm {
             }
         
             template<typename ValueType>
-            storm::models::sparse::StateLabeling PomdpMemoryUnfolder<ValueType>::transformStateLabeling() const {
-                storm::models::sparse::StateLabeling labeling(pomdp.getNumberOfStates() * memory.getNumberOfStates());
+            storm::models::sparse::StateLabeling PomdpMemoryUnfolder<ValueType>::transformStateLabeling(storm::storage::BitVector const& reachableStates) const {
+                uint64_t numStates = reachableStates.getNumberOfSetBits();
+                std::vector<uint_fast64_t> newStateIndices = reachableStates.getNumberOfSetBitsBeforeIndices();
+                storm::models::sparse::StateLabeling labeling(numStates);
                 for (auto const& labelName : pomdp.getStateLabeling().getLabels()) {
-                    storm::storage::BitVector newStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+                    storm::storage::BitVector newStates(numStates, false);
                     
                     // The init label is only assigned to unfolding states with the initial memory state
                     if (labelName == "init") {
                         for (auto const& modelState : pomdp.getStateLabeling().getStates(labelName)) {
-                            newStates.set(getUnfoldingState(modelState, memory.getInitialState()));
+                            newStates.set(newStateIndices[getUnfoldingState(modelState, memory.getInitialState())]);
                         }
                     } else {
                         for (auto const& modelState : pomdp.getStateLabeling().getStates(labelName)) {
                             for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                                newStates.set(getUnfoldingState(modelState, memState));
+                                uint64_t unfoldingState = getUnfoldingState(modelState, memState);
+                                if (reachableStates.get(unfoldingState)) {
+                                    newStates.set(newStateIndices[unfoldingState]);
+                                }
                             }
                         }
                     }
@@ -106,9 +141,12 @@ namespace storm {
                 }
                 if (addMemoryLabels) {
                     for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        storm::storage::BitVector newStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+                        storm::storage::BitVector newStates(numStates, false);
                         for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                            newStates.set(getUnfoldingState(modelState, memState));
+                            uint64_t unfoldingState = getUnfoldingState(modelState, memState);
+                            if (reachableStates.get(unfoldingState)) {
+                                newStates.set(newStateIndices[unfoldingState]);
+                            }
                         }
                         labeling.addLabel("memstate_"+std::to_string(memState), newStates);
                     }
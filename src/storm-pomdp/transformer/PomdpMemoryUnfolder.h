@@ -17,8 +17,14 @@ namespace storm {
             std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> transform() const;
 
         private:
-            storm::storage::SparseMatrix<ValueType> transformTransitions() const;
-            storm::models::sparse::StateLabeling transformStateLabeling() const;
+            /*!
+             * Computes the (state, memory) pairs of the product that are reachable from the initial states (with the initial memory state).
+             * The pairs are indexed as returned by getUnfoldingState.
+             */
+            storm::storage::BitVector computeReachableStates() const;
+            
+            storm::storage::SparseMatrix<ValueType> transformTransitions(storm::storage::BitVector const& reachableStates) const;
+            storm::models::sparse::StateLabeling transformStateLabeling(storm::storage::BitVector const& reachableStates) const;
             std::vector<uint32_t> transformObservabilityClasses(storm::storage::BitVector const& reachableStates) const;
             storm::models::sparse::StandardRewardModel<ValueType> transformRewardModel(storm::models::sparse::StandardRewardModel<ValueType> const& rewardModel, storm::storage::BitVector const& reachableStates) const;
             
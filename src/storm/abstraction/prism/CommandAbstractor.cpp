@@ -81,6 +81,7 @@ void CommandAbstractor<DdType, ValueType>::refine(std::vector<uint_fast64_t> con
     bool relevantPredicatesChanged = this->relevantPredicatesChanged(newRelevantPredicates);
     if (relevantPredicatesChanged) {
         addMissingPredicates(newRelevantPredicates);
+        enumeratedSolutions = boost::none;
     }
     forceRecomputation |= relevantPredicatesChanged;
 
@@ -109,19 +110,70 @@ std::set<storm::expressions::Variable> const& CommandAbstractor<DdType, ValueTyp
     return assignedVariables;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateSolutions() {
+    if (!forceRecomputation || enumeratedSolutions) {
+        return;
+    }
+
+    if (useDecomposition) {
+        enumerateSolutionsWithDecomposition();
+    } else {
+        enumerateSolutionsWithoutDecomposition();
+    }
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 void CommandAbstractor<DdType, ValueType>::recomputeCachedBdd() {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // The solutions may already have been enumerated (possibly in parallel to other commands).
+    enumerateSolutions();
     if (useDecomposition) {
         recomputeCachedBddWithDecomposition();
     } else {
         recomputeCachedBddWithoutDecomposition();
     }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Built BDD from " << enumeratedSolutions.get().numberOfSolutions << " solutions in "
+                                      << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+    enumeratedSolutions = boost::none;
+    forceRecomputation = false;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
-void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
-    STORM_LOG_TRACE("Recomputing BDD for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
+void CommandAbstractor<DdType, ValueType>::enumerateBlockSolutions(std::vector<storm::expressions::Variable> const& variables, EnumeratedBlock& block) {
+    smtSolver->allSat(variables, [&block](storm::solver::SmtSolver::ModelReference const& model) {
+        storm::storage::BitVector solution(block.sourceVariablesAndPredicates.size());
+        uint64_t index = 0;
+        for (auto const& variableIndexPair : block.sourceVariablesAndPredicates) {
+            if (model.getBooleanValue(variableIndexPair.first)) {
+                solution.set(index);
+            }
+            ++index;
+        }
+        for (auto const& updateVariablesAndPredicates : block.destinationVariablesAndPredicates) {
+            solution.resize(solution.size() + updateVariablesAndPredicates.size());
+            for (auto const& variableIndexPair : updateVariablesAndPredicates) {
+                if (model.getBooleanValue(variableIndexPair.first)) {
+                    solution.set(index);
+                }
+                ++index;
+            }
+        }
+        block.solutions.push_back(std::move(solution));
+        return true;
+    });
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithDecomposition() {
+    STORM_LOG_TRACE("Enumerating solutions for command " << command.get() << " [with index " << command.get().getGlobalIndex()
+                                                         << "] using the decomposition.");
     auto start = std::chrono::high_resolution_clock::now();
+    enumeratedSolutions = EnumeratedSolutions();
+    EnumeratedSolutions& result = enumeratedSolutions.get();
 
     // compute a decomposition of the command
     //  * start with all relevant blocks: blocks of assignment variables and variables in the rhs of assignments
@@ -264,56 +316,42 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
             enumerateAbstractGuard = false;
         }
     }
-
-    uint64_t numberOfSolutions = 0;
-    uint64_t numberOfTotalSolutions = 0;
+    result.guardEnumerated = enumerateAbstractGuard;
 
     // If we need to enumerate the guard, do it only once now.
     if (enumerateAbstractGuard) {
         std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
         std::vector<storm::expressions::Variable> guardDecisionVariables;
-        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
         for (auto const& element : relevantPredicatesAndVariables.first) {
             if (relatedGuardPredicates.find(element.second) != relatedGuardPredicates.end()) {
                 guardDecisionVariables.push_back(element.first);
-                guardVariablesAndPredicates.push_back(element);
+                result.guard.sourceVariablesAndPredicates.push_back(element);
             }
         }
-        abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
-        smtSolver->allSat(guardDecisionVariables,
-                          [this, &guardVariablesAndPredicates, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-                              abstractGuard |= getSourceStateBdd(model, guardVariablesAndPredicates);
-                              ++numberOfSolutions;
-                              return true;
-                          });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for abstract guard.");
+        enumerateBlockSolutions(guardDecisionVariables, result.guard);
+        STORM_LOG_TRACE("Enumerated " << result.guard.solutions.size() << " solutions for abstract guard.");
 
         // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
-        // the other solutions.
+        // the other solutions. The guard is given by its solutions over the decision variables, so that no DDs
+        // (and no fresh variables) are required at this point.
 
         // Create a new backtracking point before adding the guard.
         smtSolver->push();
 
-        // Create the guard constraint.
-        std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result =
-            abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
-
-        // Then add it to the solver.
-        for (auto const& expression : result.first) {
-            smtSolver->add(expression);
-        }
-
-        // Finally associate the level variables with the predicates.
-        for (auto const& indexVariablePair : result.second) {
-            smtSolver->add(
-                storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
+        if (!guardDecisionVariables.empty() && !result.guard.solutions.empty()) {
+            std::vector<storm::expressions::Expression> guardCubes;
+            for (auto const& solution : result.guard.solutions) {
+                std::vector<storm::expressions::Expression> literals;
+                for (uint64_t index = 0; index < guardDecisionVariables.size(); ++index) {
+                    literals.push_back(solution.get(index) ? guardDecisionVariables[index].getExpression() : !guardDecisionVariables[index]);
+                }
+                guardCubes.push_back(storm::expressions::conjunction(literals));
+            }
+            smtSolver->add(storm::expressions::disjunction(guardCubes));
         }
     }
 
     // Then enumerate the solutions for each of the blocks of the decomposition.
-    uint64_t usedNondeterminismVariables = 0;
-    uint64_t blockCounter = 0;
-    std::vector<storm::dd::Bdd<DdType>> blockBdds;
     for (auto const& block : relevantBlockPartition) {
         std::set<uint64_t> relevantPredicates;
         for (auto const& innerBlock : block) {
@@ -326,18 +364,17 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
             continue;
         }
 
+        EnumeratedBlock enumeratedBlock;
         std::vector<storm::expressions::Variable> transitionDecisionVariables;
-        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
         for (auto const& element : relevantPredicatesAndVariables.first) {
             if (relevantPredicates.find(element.second) != relevantPredicates.end()) {
                 transitionDecisionVariables.push_back(element.first);
-                sourceVariablesAndPredicates.push_back(element);
+                enumeratedBlock.sourceVariablesAndPredicates.push_back(element);
             }
         }
 
-        std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
         for (uint64_t updateIndex = 0; updateIndex < command.get().getNumberOfUpdates(); ++updateIndex) {
-            destinationVariablesAndPredicates.emplace_back();
+            enumeratedBlock.destinationVariablesAndPredicates.emplace_back();
             for (auto const& assignment : command.get().getUpdate(updateIndex).getAssignments()) {
                 uint64_t assignmentVariableBlockIndex = localExpressionInformation.getBlockIndexOfVariable(assignment.getVariable());
 
@@ -345,7 +382,7 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
                     std::set<uint64_t> const& assignmentVariableBlock = localExpressionInformation.getExpressionBlock(assignmentVariableBlockIndex);
                     for (auto const& element : relevantPredicatesAndVariables.second[updateIndex]) {
                         if (assignmentVariableBlock.find(element.second) != assignmentVariableBlock.end()) {
-                            destinationVariablesAndPredicates.back().push_back(element);
+                            enumeratedBlock.destinationVariablesAndPredicates.back().push_back(element);
                             transitionDecisionVariables.push_back(element.first);
                         }
                     }
@@ -353,17 +390,41 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
             }
         }
 
+        enumerateBlockSolutions(transitionDecisionVariables, enumeratedBlock);
+        STORM_LOG_TRACE("Enumerated " << enumeratedBlock.solutions.size() << " solutions for block " << result.blocks.size() << ".");
+        result.numberOfSolutions += enumeratedBlock.solutions.size();
+        result.blocks.push_back(std::move(enumeratedBlock));
+    }
+
+    if (enumerateAbstractGuard) {
+        smtSolver->pop();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Enumerated " << result.numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                                  << "ms.");
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
+    EnumeratedSolutions const& solutions = enumeratedSolutions.get();
+
+    if (solutions.guardEnumerated) {
+        abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
+        for (auto const& solution : solutions.guard.solutions) {
+            abstractGuard |= getSourceStateBdd(solution, solutions.guard.sourceVariablesAndPredicates);
+        }
+    }
+
+    uint64_t usedNondeterminismVariables = 0;
+    uint64_t blockCounter = 0;
+    std::vector<storm::dd::Bdd<DdType>> blockBdds;
+    for (auto const& block : solutions.blocks) {
         std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-        numberOfSolutions = 0;
-        smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions, &sourceVariablesAndPredicates,
-                                                        &destinationVariablesAndPredicates](storm::solver::SmtSolver::ModelReference const& model) {
-            sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(
-                getDistributionBdd(model, destinationVariablesAndPredicates));
-            ++numberOfSolutions;
-            return true;
-        });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-        numberOfTotalSolutions += numberOfSolutions;
+        for (auto const& solution : block.solutions) {
+            sourceToDistributionsMap[getSourceStateBdd(solution, block.sourceVariablesAndPredicates)].push_back(
+                getDistributionBdd(solution, block.sourceVariablesAndPredicates.size(), block.destinationVariablesAndPredicates));
+        }
 
         // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
         // need to encode the nondeterminism.
@@ -403,20 +464,14 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         ++blockCounter;
     }
 
-    if (enumerateAbstractGuard) {
-        smtSolver->pop();
-    }
-
     // multiply the results
     storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
-    uint64_t blockIndex = 0;
     for (auto const& blockBdd : blockBdds) {
         resultBdd &= blockBdd;
-        ++blockIndex;
     }
 
     // If we did not explicitly enumerate the guard, we can construct it from the result BDD.
-    if (!enumerateAbstractGuard) {
+    if (!solutions.guardEnumerated) {
         std::set<storm::expressions::Variable> allVariables(getAbstractionInformation().getSuccessorVariables());
         auto player2Variables = getAbstractionInformation().getPlayer2VariableSet(usedNondeterminismVariables);
         allVariables.insert(player2Variables.begin(), player2Variables.end());
@@ -442,28 +497,37 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
 
     // Cache the result.
     cachedDd = GameBddResult<DdType>(resultBdd, usedNondeterminismVariables);
+}
 
-    auto end = std::chrono::high_resolution_clock::now();
+template<storm::dd::DdType DdType, typename ValueType>
+void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithoutDecomposition() {
+    STORM_LOG_TRACE("Enumerating solutions for command " << command.get());
+    auto start = std::chrono::high_resolution_clock::now();
+    enumeratedSolutions = EnumeratedSolutions();
+    EnumeratedSolutions& result = enumeratedSolutions.get();
+
+    result.blocks.emplace_back();
+    EnumeratedBlock& block = result.blocks.back();
+    block.sourceVariablesAndPredicates = relevantPredicatesAndVariables.first;
+    block.destinationVariablesAndPredicates = relevantPredicatesAndVariables.second;
+    enumerateBlockSolutions(decisionVariables, block);
+    result.numberOfSolutions = block.solutions.size();
 
-    STORM_LOG_TRACE("Enumerated " << numberOfTotalSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Enumerated " << result.numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
                                   << "ms.");
-    forceRecomputation = false;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
 void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition() {
-    STORM_LOG_TRACE("Recomputing BDD for command " << command.get());
-    auto start = std::chrono::high_resolution_clock::now();
+    EnumeratedBlock const& block = enumeratedSolutions.get().blocks.front();
 
     // Create a mapping from source state DDs to their distributions.
     std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-    uint64_t numberOfSolutions = 0;
-    smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions](storm::solver::SmtSolver::ModelReference const& model) {
-        sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(
-            getDistributionBdd(model, relevantPredicatesAndVariables.second));
-        ++numberOfSolutions;
-        return true;
-    });
+    for (auto const& solution : block.solutions) {
+        sourceToDistributionsMap[getSourceStateBdd(solution, block.sourceVariablesAndPredicates)].push_back(
+            getDistributionBdd(solution, block.sourceVariablesAndPredicates.size(), block.destinationVariablesAndPredicates));
+    }
 
     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
     // need to encode the nondeterminism.
@@ -507,13 +571,7 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecompositio
 
     // Cache the result.
     cachedDd = GameBddResult<DdType>(resultBdd, numberOfVariablesNeeded);
-    auto end = std::chrono::high_resolution_clock::now();
-
-    STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
-                                  << "ms.");
-    forceRecomputation = false;
 }
-
 template<storm::dd::DdType DdType, typename ValueType>
 std::pair<std::set<uint_fast64_t>, std::set<uint_fast64_t>> CommandAbstractor<DdType, ValueType>::computeRelevantPredicates(
     std::vector<storm::prism::Assignment> const& assignments) const {
@@ -626,16 +684,13 @@ void CommandAbstractor<DdType, ValueType>::addMissingPredicates(
 
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
-    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
+    storm::storage::BitVector const& solution, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
-    for (auto variableIndexPairIt = variablePredicates.rbegin(), variableIndexPairIte = variablePredicates.rend(); variableIndexPairIt != variableIndexPairIte;
-         ++variableIndexPairIt) {
-        auto const& variableIndexPair = *variableIndexPairIt;
-        if (model.getBooleanValue(variableIndexPair.first)) {
-            result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+    for (uint64_t index = variablePredicates.size(); index > 0; --index) {
+        if (solution.get(index - 1)) {
+            result &= this->getAbstractionInformation().encodePredicateAsSource(variablePredicates[index - 1].second);
         } else {
-            result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+            result &= !this->getAbstractionInformation().encodePredicateAsSource(variablePredicates[index - 1].second);
         }
     }
 
@@ -645,7 +700,7 @@ storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(
 
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(
-    storm::solver::SmtSolver::ModelReference const& model,
+    storm::storage::BitVector const& solution, uint64_t offset,
     std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
 
@@ -653,15 +708,14 @@ storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(
         storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
 
         // Translate block variables for this update into a successor block.
-        for (auto variableIndexPairIt = variablePredicates[updateIndex].rbegin(), variableIndexPairIte = variablePredicates[updateIndex].rend();
-             variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-            auto const& variableIndexPair = *variableIndexPairIt;
-            if (model.getBooleanValue(variableIndexPair.first)) {
-                updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+        for (uint64_t index = variablePredicates[updateIndex].size(); index > 0; --index) {
+            if (solution.get(offset + index - 1)) {
+                updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variablePredicates[updateIndex][index - 1].second);
             } else {
-                updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+                updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variablePredicates[updateIndex][index - 1].second);
             }
         }
+        offset += variablePredicates[updateIndex].size();
 
         updateBdd &= this->getAbstractionInformation().encodeAux(updateIndex, 0, this->getAbstractionInformation().getAuxVariableCount());
         result |= updateBdd;
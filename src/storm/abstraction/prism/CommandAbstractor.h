@@ -5,9 +5,12 @@
 #include <set>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "storm/abstraction/GameBddResult.h"
 #include "storm/abstraction/LocalExpressionInformation.h"
 #include "storm/abstraction/StateSetAbstractor.h"
+#include "storm/storage/BitVector.h"
 
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
@@ -88,6 +91,13 @@ class CommandAbstractor {
      */
     std::set<storm::expressions::Variable> const& getAssignedVariables() const;
 
+    /*!
+     * Performs the SMT queries that are required to recompute the abstraction of the command (if any). The solutions are stored and only
+     * translated to BDDs by the next call to abstract(). As this only involves the solver of this command, it may be called for different
+     * commands in parallel.
+     */
+    void enumerateSolutions();
+
     /*!
      * Computes the abstraction of the command wrt. to the current set of predicates.
      *
@@ -156,21 +166,56 @@ class CommandAbstractor {
     void addMissingPredicates(std::pair<std::set<uint_fast64_t>, std::vector<std::set<uint_fast64_t>>> const& newRelevantPredicates);
 
     /*!
-     * Translates the given model to a source state DD.
+     * The solutions of the SMT queries for a block of the decomposition (or all relevant predicates if the decomposition is not used).
+     */
+    struct EnumeratedBlock {
+        // The decision variables of the source predicates and the successor predicates of each update.
+        std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
+        std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
+
+        // The solutions. Each solution assigns the source variables followed by the successor variables of all updates.
+        std::vector<storm::storage::BitVector> solutions;
+    };
+
+    /*!
+     * The solutions of all SMT queries required for recomputing the cached BDD.
+     */
+    struct EnumeratedSolutions {
+        // Whether the abstract guard was enumerated explicitly. If so, the guard block contains its solutions.
+        bool guardEnumerated = false;
+        EnumeratedBlock guard;
+
+        std::vector<EnumeratedBlock> blocks;
+        uint64_t numberOfSolutions = 0;
+    };
+
+    /*!
+     * Enumerates all valuations of the given variables that satisfy the assertions of the solver and stores them as solutions of the block.
      *
-     * @param model The model to translate.
+     * @param variables The variables to enumerate. They must contain the source and successor variables of the block.
+     * @param block The block whose solutions to compute.
+     */
+    void enumerateBlockSolutions(std::vector<storm::expressions::Variable> const& variables, EnumeratedBlock& block);
+
+    /*!
+     * Translates the given solution to a source state DD.
+     *
+     * @param solution The solution to translate.
+     * @param variablePredicates The source variables and predicates. Their values form the first bits of the solution.
      * @return The source state encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model,
+    storm::dd::Bdd<DdType> getSourceStateBdd(storm::storage::BitVector const& solution,
                                              std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
 
     /*!
-     * Translates the given model to a distribution over successor states.
+     * Translates the given solution to a distribution over successor states.
      *
-     * @param model The model to translate.
-     * @return The source state encoded as a DD.
+     * @param solution The solution to translate.
+     * @param offset The index of the first bit of the solution that refers to the successor variables.
+     * @param variablePredicates The successor variables and predicates of each update.
+     * @return The distribution encoded as a DD.
      */
-    storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model,
+    storm::dd::Bdd<DdType> getDistributionBdd(storm::storage::BitVector const& solution, uint64_t offset,
                                               std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
 
     /*!
@@ -179,12 +224,22 @@ class CommandAbstractor {
     void recomputeCachedBdd();
 
     /*!
-     * Recomputes the cached BDD without using the decomposition.
+     * Enumerates the solutions for recomputing the cached BDD without using the decomposition.
+     */
+    void enumerateSolutionsWithoutDecomposition();
+
+    /*!
+     * Enumerates the solutions for recomputing the cached BDD using the decomposition.
+     */
+    void enumerateSolutionsWithDecomposition();
+
+    /*!
+     * Recomputes the cached BDD from the enumerated solutions without using the decomposition.
      */
     void recomputeCachedBddWithoutDecomposition();
 
     /*!
-     * Recomputes the cached BDD using th decomposition.
+     * Recomputes the cached BDD from the enumerated solutions using the decomposition.
      */
     void recomputeCachedBddWithDecomposition();
 
@@ -263,6 +318,9 @@ class CommandAbstractor {
     // A flag remembering whether we need to force recomputation of the BDD.
     bool forceRecomputation;
 
+    // The solutions which were enumerated for the pending recomputation of the BDD (if any).
+    boost::optional<EnumeratedSolutions> enumeratedSolutions;
+
     // The abstract guard of the command. This is only used if the guard is not a predicate, because it can
     // then be used to constrain the bottom state abstractor.
     storm::dd::Bdd<DdType> abstractGuard;
@@ -10,8 +10,10 @@
 #include "storm/storage/prism/Module.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm-config.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/macros.h"
@@ -64,7 +66,21 @@ std::set<storm::expressions::Variable> const& ModuleAbstractor<DdType, ValueType
 
 template<storm::dd::DdType DdType, typename ValueType>
 GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
-    // First, we retrieve the abstractions of all commands.
+    // First, we perform the SMT queries of all commands whose abstraction needs to be recomputed. As every command has its own solver, this
+    // can be done in parallel. The translation of the solutions to BDDs is done sequentially, because the DD manager is shared.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, commands.size()), [this](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                commands[index].enumerateSolutions();
+            }
+        });
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+    }
+
+    // Then, we retrieve the abstractions of all commands.
     std::vector<GameBddResult<DdType>> commandDdsAndUsedOptionVariableCounts;
     uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
     for (auto& command : commands) {
@@ -73,7 +89,7 @@ GameBddResult<DdType> ModuleAbstractor<DdType, ValueType>::abstract() {
             std::max(maximalNumberOfUsedOptionVariables, commandDdsAndUsedOptionVariableCounts.back().numberOfPlayer2Variables);
     }
 
-    // Then, we build the module BDD by adding the single command DDs. We need to make sure that all command
+    // Finally, we build the module BDD by adding the single command DDs. We need to make sure that all command
     // DDs use the same amount DD variable encoding the choices of player 2.
     storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
     for (auto const& commandDd : commandDdsAndUsedOptionVariableCounts) {
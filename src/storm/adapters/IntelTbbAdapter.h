@@ -19,7 +19,10 @@
 
 #ifdef STORM_HAVE_INTELTBB
 #include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+#include "tbb/task_group.h"
 #include "tbb/tbb_stddef.h"
 #endif
 
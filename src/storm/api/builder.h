@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryEncodingParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
@@ -93,16 +94,17 @@ template<typename ValueType>
 storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::storage::SymbolicModelDescription const& model,
                                                                          storm::builder::BuilderOptions const& options,
                                                                          std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr) {
-    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+    // Without an action mask, the builder gets a factory for generators, which allows it to explore the state space in parallel.
     if (model.isPrismProgram()) {
-        generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options, actionMask);
-    } else if (model.isJaniModel()) {
-        STORM_LOG_THROW(actionMask == nullptr, storm::exceptions::NotSupportedException, "Action masks for JANI are not yet supported");
-        generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model.asJaniModel(), options);
-    } else {
-        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
+        if (actionMask) {
+            return storm::builder::ExplicitModelBuilder<ValueType>(
+                std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options, actionMask));
+        }
+        return storm::builder::ExplicitModelBuilder<ValueType>(model.asPrismProgram(), options);
     }
-    return storm::builder::ExplicitModelBuilder<ValueType>(generator);
+    STORM_LOG_THROW(model.isJaniModel(), storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
+    STORM_LOG_THROW(actionMask == nullptr, storm::exceptions::NotSupportedException, "Action masks for JANI are not yet supported");
+    return storm::builder::ExplicitModelBuilder<ValueType>(model.asJaniModel(), options);
 }
 
 template<typename ValueType>
@@ -164,6 +166,11 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitBinaryModel(std::string const& binaryFile) {
+    return storm::parser::BinaryEncodingParser<ValueType>::parseModel(binaryFile);
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
@@ -3,6 +3,8 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/io/BinaryResultExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
@@ -33,6 +35,11 @@ void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueTy
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    storm::exporter::binaryExportSparseModel(filename, model);
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     storm::exporter::explicitExportSymbolicModel(filename, model);
@@ -59,13 +66,20 @@ void exportSymbolicModelAsDot(std::shared_ptr<storm::models::symbolic::Model<Typ
     model->writeDotToFile(filename);
 }
 
+inline bool hasFileExtension(std::string const& filename, std::string const& extension) {
+    return filename.size() > extension.size() && std::equal(extension.rbegin(), extension.rend(), filename.rbegin());
+}
+
 template<typename ValueType>
 void exportScheduler(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::storage::Scheduler<ValueType> const& scheduler,
                      std::string const& filename) {
+    if (hasFileExtension(filename, ".bin")) {
+        storm::exporter::binaryExportScheduler(filename, scheduler);
+        return;
+    }
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
-    std::string jsonFileExtension = ".json";
-    if (filename.size() > 4 && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin())) {
+    if (hasFileExtension(filename, ".json")) {
         scheduler.printJsonToStream(stream, model, false, true);
     } else {
         scheduler.printToStream(stream, model, false, true);
@@ -79,13 +93,12 @@ inline void exportCheckResultToJson(std::shared_ptr<storm::models::sparse::Model
     std::ofstream stream;
     storm::utility::openFile(filename, stream);
     if (checkResult->isExplicitQualitativeCheckResult()) {
-        stream << checkResult->asExplicitQualitativeCheckResult().toJson(model->getOptionalStateValuations(), model->getStateLabeling()).dump(4);
+        checkResult->asExplicitQualitativeCheckResult().writeJsonToStream(stream, model->getOptionalStateValuations(), model->getStateLabeling());
     } else {
         STORM_LOG_THROW(checkResult->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException,
                         "Export of check results is only supported for explicit check results (e.g. in the sparse engine)");
-        stream << checkResult->template asExplicitQuantitativeCheckResult<ValueType>()
-                      .toJson(model->getOptionalStateValuations(), model->getStateLabeling())
-                      .dump(4);
+        checkResult->template asExplicitQuantitativeCheckResult<ValueType>().writeJsonToStream(stream, model->getOptionalStateValuations(),
+                                                                                                model->getStateLabeling());
     }
     storm::utility::closeFile(stream);
 }
@@ -96,5 +109,23 @@ inline void exportCheckResultToJson<storm::RationalFunction>(std::shared_ptr<sto
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of check results is not supported for rational functions. ");
 }
 
+template<typename ValueType>
+void exportCheckResultAsBinary(std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
+    storm::exporter::binaryExportCheckResult<ValueType>(filename, *checkResult);
+}
+
+/*!
+ * Exports the check result in the binary result format if the file name ends with '.bin' and in json otherwise.
+ */
+template<typename ValueType>
+void exportCheckResult(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                       std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
+    if (hasFileExtension(filename, ".bin")) {
+        exportCheckResultAsBinary<ValueType>(checkResult, filename);
+    } else {
+        exportCheckResultToJson(model, checkResult, filename);
+    }
+}
+
 }  // namespace api
 }  // namespace storm
@@ -2,6 +2,7 @@
 
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
+#include "storm/transformer/StateReorderer.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -146,5 +147,14 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> transformToNondetermini
     }
 }
 
+/*!
+ * Renumbers the states of the given model according to the given ordering to improve the memory locality of subsequent computations.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> reorderSparseModelStates(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                                  storm::transformer::StateOrdering const& ordering) {
+    return storm::transformer::reorderStates(*model, ordering);
+}
+
 }  // namespace api
 }  // namespace storm
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <exception>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
@@ -11,14 +16,18 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/propositional/StateFormulaCache.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/simulation/SimulationModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
@@ -33,6 +42,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
@@ -185,6 +195,44 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with Simulation engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSimulationEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+    storm::expressions::Expression const& importanceFunction = storm::expressions::Expression()) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Simulation engine is currently only applicable to PRISM models.");
+    storm::prism::Program const& program = model.asPrismProgram();
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The model type " << program.getModelType() << " is not supported by the simulation engine.");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::modelchecker::SimulationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+    if (importanceFunction.isInitialized()) {
+        checker.setImportanceFunction(importanceFunction);
+    }
+    if (checker.canHandle(task)) {
+        result = checker.check(env, task);
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSimulationEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&,
+    storm::expressions::Expression const& = storm::expressions::Expression()) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSimulationEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                             storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithSimulationEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -352,6 +400,81 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
     return verifyWithSparseEngine(env, model, task);
 }
 
+/*!
+ * Checks the given tasks on the given model. In contrast to checking them one by one, work is shared among the tasks: The results of (sub-)state
+ * formulas and of qualitative analyses are cached and the backward transitions are built only once. The tasks are checked concurrently by the
+ * given number of threads. Tasks that already carry an explicit hint keep it and only share the state formula results.
+ *
+ * @param errors If given, an exception that is raised while checking a task is stored at the index of the task (and the result is null).
+ * Otherwise, the first such exception is rethrown after all tasks are processed.
+ * @return The results of the tasks in the given order, where the result of a task that cannot be handled is null.
+ */
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks, uint64_t numberOfThreads = 1,
+    std::vector<std::exception_ptr>* errors = nullptr) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required.");
+    storm::Environment batchEnv = env;
+    if (!batchEnv.modelchecker().getStateFormulaCache()) {
+        batchEnv.modelchecker().setStateFormulaCache(std::make_shared<storm::modelchecker::StateFormulaCache>());
+    }
+
+    // Everything that the model computes lazily is computed upfront, such that the concurrent checks only read the model.
+    if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto ma = model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+        if (!ma->isClosed()) {
+            STORM_LOG_WARN("Closing Markov automaton. Consider closing the MA before verification.");
+            ma->close();
+        }
+    }
+    model->prepareForConcurrentAccess();
+
+    auto precomputationCache = std::make_shared<storm::modelchecker::ExplicitPrecomputationCache>();
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> batchTasks;
+    batchTasks.reserve(tasks.size());
+    for (auto const& task : tasks) {
+        batchTasks.push_back(task);
+        if (!task.getHint().isExplicitModelCheckerHint()) {
+            auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>();
+            hint->setPrecomputationCache(precomputationCache);
+            batchTasks.back().setHint(hint);
+        }
+    }
+
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(tasks.size());
+    std::vector<std::exception_ptr> taskErrors(tasks.size());
+    std::atomic<uint64_t> nextTask(0);
+    auto checkTasks = [&]() {
+        for (uint64_t index = nextTask++; index < batchTasks.size(); index = nextTask++) {
+            try {
+                results[index] = verifyWithSparseEngine(batchEnv, model, batchTasks[index]);
+            } catch (...) {
+                taskErrors[index] = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < std::min<uint64_t>(numberOfThreads, tasks.size()); ++thread) {
+        threads.emplace_back(checkTasks);
+    }
+    checkTasks();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (errors) {
+        *errors = std::move(taskErrors);
+    } else {
+        for (auto const& error : taskErrors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+    return results;
+}
+
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistributionWithSparseEngine(
     storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
@@ -414,6 +537,27 @@ std::unique_ptr<storm::modelchecker::CheckResult> computeExpectedVisitingTimesWi
     return result;
 }
 
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> computeBoundedUntilProbabilitiesForTimePointsWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timePoints) {
+    storm::logic::Formula const& formula = task.getFormula();
+    STORM_LOG_THROW(formula.isProbabilityOperatorFormula() && formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula(),
+                    storm::exceptions::NotSupportedException, "Computing results for multiple time points is only supported for time-bounded until probabilities.");
+    storm::logic::BoundedUntilFormula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+    return modelchecker.computeBoundedUntilProbabilitiesForTimePoints(env, task.substituteFormula(pathFormula), timePoints);
+}
+
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> computeBoundedUntilProbabilitiesForTimePointsWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timePoints) {
+    STORM_LOG_THROW(model->getType() == storm::models::ModelType::Ctmc, storm::exceptions::NotSupportedException,
+                    "Computing results for multiple time points for the model type " << model->getType() << " is not supported.");
+    return computeBoundedUntilProbabilitiesForTimePointsWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task, timePoints);
+}
+
 //
 // Verifying with Hybrid engine
 //
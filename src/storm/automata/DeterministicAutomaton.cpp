@@ -46,6 +46,15 @@ std::size_t DeterministicAutomaton::getNumberOfEdgesPerState() const {
     return edgesPerState;
 }
 
+bool DeterministicAutomaton::isSink(std::size_t state) const {
+    for (APSet::alphabet_element label = 0; label < edgesPerState; ++label) {
+        if (getSuccessor(state, label) != state) {
+            return false;
+        }
+    }
+    return true;
+}
+
 AcceptanceCondition::ptr DeterministicAutomaton::getAcceptance() const {
     return acceptance;
 }
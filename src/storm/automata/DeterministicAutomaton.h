@@ -25,6 +25,12 @@ class DeterministicAutomaton {
     std::size_t getNumberOfStates() const;
     std::size_t getNumberOfEdgesPerState() const;
 
+    /*!
+     * Checks whether the given state is a sink, i.e., whether all of its edges are self-loops.
+     * Whether a run entering a sink is accepted only depends on the sink itself.
+     */
+    bool isSink(std::size_t state) const;
+
     std::shared_ptr<AcceptanceCondition> getAcceptance() const;
 
     void printHOA(std::ostream& out) const;
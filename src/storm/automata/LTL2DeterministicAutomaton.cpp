@@ -4,10 +4,14 @@
 #include "storm/exceptions/ExpressionEvaluationException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/file.h"
 #include "storm/logic/Formula.h"
 #include "storm/utility/macros.h"
 
 #include <sys/wait.h>
+#include <map>
+#include <mutex>
+#include <sstream>
 
 #ifdef STORM_HAVE_SPOT
 #include "spot/tl/formula.hh"
@@ -20,6 +24,23 @@
 namespace storm {
 namespace automata {
 
+namespace {
+std::mutex cacheMutex;
+std::map<std::string, std::shared_ptr<DeterministicAutomaton>> translationCache;
+
+/*!
+ * FNV-1a hash of the cache key. Unlike std::hash, it is stable across runs and platforms, which is required for the file names of persisted translations.
+ */
+uint64_t stableHash(std::string const& key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+}  // namespace
+
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
 #ifdef STORM_HAVE_SPOT
     std::string prefixLtl = f.toPrefixString();
@@ -102,6 +123,60 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
     }
 }
 
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daCached(storm::logic::Formula const& f, bool dnf,
+                                                                               boost::optional<std::string> const& ltl2daTool,
+                                                                               boost::optional<std::string> const& cacheDirectory) {
+    std::string key = (ltl2daTool ? "tool:" + ltl2daTool.get() : std::string(dnf ? "spot-dnf" : "spot")) + "|" + f.toPrefixString();
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = translationCache.find(key);
+        if (it != translationCache.end()) {
+            STORM_LOG_INFO("Reusing deterministic automaton for " << f.toPrefixString() << ".");
+            return it->second;
+        }
+    }
+
+    // Persisted translations start with their key to detect hash collisions
+    std::shared_ptr<DeterministicAutomaton> da;
+    std::string cacheFile;
+    if (cacheDirectory) {
+        std::stringstream fileName;
+        fileName << cacheDirectory.get() << "/ltl2da-" << std::hex << stableHash(key) << ".hoa";
+        cacheFile = fileName.str();
+        if (storm::utility::fileExistsAndIsReadable(cacheFile)) {
+            std::ifstream in;
+            storm::utility::openFile(cacheFile, in);
+            std::string storedKey;
+            storm::utility::getline(in, storedKey);
+            if (storedKey == key) {
+                STORM_LOG_INFO("Reading deterministic automaton for " << f.toPrefixString() << " from cache file '" << cacheFile << "'.");
+                da = DeterministicAutomaton::parse(in);
+            }
+            storm::utility::closeFile(in);
+        }
+    }
+
+    if (!da) {
+        da = ltl2daTool ? ltl2daExternalTool(f, ltl2daTool.get()) : ltl2daSpot(f, dnf);
+        if (cacheDirectory) {
+            std::ofstream out;
+            storm::utility::openFile(cacheFile, out);
+            out << key << '\n';
+            da->printHOA(out);
+            storm::utility::closeFile(out);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    translationCache.emplace(key, da);
+    return da;
+}
+
+void LTL2DeterministicAutomaton::clearCache() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    translationCache.clear();
+}
+
 }  // namespace automata
 
 }  // namespace storm
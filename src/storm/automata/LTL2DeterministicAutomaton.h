@@ -1,6 +1,8 @@
 #pragma
 
+#include <boost/optional.hpp>
 #include <memory>
+#include <string>
 
 namespace storm {
 
@@ -35,6 +37,26 @@ class LTL2DeterministicAutomaton {
      * @return An automaton equivalent to the formula.
      */
     static std::shared_ptr<DeterministicAutomaton> ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool);
+
+    /*!
+     * Converts an LTL formula into a deterministic omega-automaton and reuses previous translations of the same formula.
+     * Translations are cached in memory, keyed by the prefix representation of the formula, the translator and the DNF flag.
+     * As the atomic propositions of extracted LTL skeletons are named canonically, properties sharing the skeleton share the translation.
+     * If a cache directory is given, translations are also stored there in HOA format and thus reused across runs.
+     *
+     * @param f The LTL formula.
+     * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF (only used for Spot).
+     * @param ltl2daTool If given, the external tool used instead of Spot.
+     * @param cacheDirectory If given, the directory in which translations are persisted.
+     * @return An automaton equivalent to the formula.
+     */
+    static std::shared_ptr<DeterministicAutomaton> ltl2daCached(storm::logic::Formula const& f, bool dnf, boost::optional<std::string> const& ltl2daTool,
+                                                                boost::optional<std::string> const& cacheDirectory = boost::none);
+
+    /*!
+     * Removes all translations from the in-memory cache.
+     */
+    static void clearCache();
 };
 
 }  // namespace automata
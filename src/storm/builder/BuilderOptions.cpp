@@ -44,12 +44,17 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       applyMaximalProgressAssumption(false),
       buildChoiceLabels(false),
       buildStateValuations(false),
+      buildStateValuationsLazily(false),
       buildChoiceOrigins(false),
       scaleAndLiftTransitionRewards(true),
       explorationChecks(false),
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
+      partialOrderReduction(false),
+      symmetryReduction(false),
+      compressStateLabeling(false),
+      nativeExpressionCompilation(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
       showProgressDelay(0) {
@@ -153,6 +158,10 @@ bool BuilderOptions::isBuildStateValuationsSet() const {
     return buildStateValuations;
 }
 
+bool BuilderOptions::isBuildStateValuationsLazilySet() const {
+    return buildStateValuationsLazily;
+}
+
 bool BuilderOptions::isBuildObservationValuationsSet() const {
     return buildObservationValuations;
 }
@@ -189,6 +198,22 @@ bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
 
+bool BuilderOptions::isPartialOrderReductionSet() const {
+    return partialOrderReduction;
+}
+
+bool BuilderOptions::isSymmetryReductionSet() const {
+    return symmetryReduction;
+}
+
+bool BuilderOptions::isCompressStateLabelingSet() const {
+    return compressStateLabeling;
+}
+
+bool BuilderOptions::isNativeExpressionCompilationSet() const {
+    return nativeExpressionCompilation;
+}
+
 BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
     buildAllRewardModels = newValue;
     return *this;
@@ -260,6 +285,11 @@ BuilderOptions& BuilderOptions::setBuildStateValuations(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setBuildStateValuationsLazily(bool newValue) {
+    buildStateValuationsLazily = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::setBuildObservationValuations(bool newValue) {
     buildObservationValuations = newValue;
     return *this;
@@ -290,6 +320,26 @@ BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+    partialOrderReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+    symmetryReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setCompressStateLabeling(bool newValue) {
+    compressStateLabeling = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setNativeExpressionCompilation(bool newValue) {
+    nativeExpressionCompilation = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::substituteExpressions(
     std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
     for (auto& e : expressionLabels) {
@@ -109,6 +109,7 @@ class BuilderOptions {
     bool isApplyMaximalProgressAssumptionSet() const;
     bool isBuildChoiceLabelsSet() const;
     bool isBuildStateValuationsSet() const;
+    bool isBuildStateValuationsLazilySet() const;
     bool isBuildObservationValuationsSet() const;
     bool isBuildChoiceOriginsSet() const;
     bool isBuildAllRewardModelsSet() const;
@@ -120,6 +121,10 @@ class BuilderOptions {
     bool isAddOutOfBoundsStateSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
+    bool isPartialOrderReductionSet() const;
+    bool isSymmetryReductionSet() const;
+    bool isCompressStateLabelingSet() const;
+    bool isNativeExpressionCompilationSet() const;
     uint64_t getShowProgressDelay() const;
 
     /**
@@ -164,6 +169,14 @@ class BuilderOptions {
      */
     BuilderOptions& setBuildStateValuations(bool newValue = true);
 
+    /**
+     * Should the state valuations (if built) only store the compressed states and derive the valuation of a state when it is queried?
+     * This saves memory if only few valuations are needed.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setBuildStateValuationsLazily(bool newValue = true);
+
     /**
      * Should a observation valuation mapping be built?
      * @param newValue The new value (default true)
@@ -206,6 +219,31 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+    /**
+     * Should independent interleavings be pruned during the exploration (if supported by the generator)?
+     * The generator relies on new states receiving consecutive indices from the state-to-id callback.
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
+    /**
+     * Should states that only differ by a permutation of symmetric components be merged (if supported by the generator)?
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+    /**
+     * Should the labels of the built model be compressed (if this saves memory)?
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setCompressStateLabeling(bool newValue = true);
+
+    /**
+     * Should the expressions of the model be compiled to native code (if supported by the generator)?
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setNativeExpressionCompilation(bool newValue = true);
+
     /**
      * Sets the number of bits that will be reserved for unbounded integer variables.
      */
@@ -246,6 +284,9 @@ class BuilderOptions {
     /// A flag indicating whether or not to build for each state the variable valuation from which it originates.
     bool buildStateValuations;
 
+    /// A flag indicating whether the state valuations only store the compressed states.
+    bool buildStateValuationsLazily;
+
     /// A flag indicating whether or not to build observation valuations
     bool buildObservationValuations;
 
@@ -268,6 +309,18 @@ class BuilderOptions {
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
+    /// A flag indicating whether partial order reduction is to be applied.
+    bool partialOrderReduction;
+
+    /// A flag indicating whether symmetry reduction is to be applied.
+    bool symmetryReduction;
+
+    /// A flag indicating whether the state labeling is to be compressed.
+    bool compressStateLabeling;
+
+    /// A flag indicating whether the expressions are to be compiled to native code.
+    bool nativeExpressionCompilation;
+
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
@@ -0,0 +1,179 @@
+#include "storm/builder/CompositionalBisimulationBuilder.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/logic/AtomicLabelFormula.h"
+#include "storm/logic/FormulaInformation.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BoostTypes.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+bool containsOnlyVariables(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable> const& variables) {
+    std::set<storm::expressions::Variable> containedVariables = expression.getVariables();
+    return std::includes(variables.begin(), variables.end(), containedVariables.begin(), containedVariables.end());
+}
+
+/*!
+ * Determines for every label of the given program the (unique) module whose variables it refers to. Labels that do not refer to any
+ * variable are assigned to the first module. If some label refers to the variables of several modules, none is returned.
+ */
+boost::optional<std::map<std::string, uint64_t>> computeLabelOwners(storm::prism::Program const& program) {
+    std::map<std::string, uint64_t> result;
+    for (auto const& label : program.getLabels()) {
+        bool foundOwner = false;
+        for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+            if (containsOnlyVariables(label.getStatePredicateExpression(), program.getModule(moduleIndex).getAllExpressionVariables())) {
+                result[label.getName()] = moduleIndex;
+                foundOwner = true;
+                break;
+            }
+        }
+        if (!foundOwner) {
+            return boost::none;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> minimize(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc,
+                                                                 std::set<std::string> const& relevantLabels, storm::storage::BisimulationType type) {
+    typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<ValueType>>::Options options;
+    std::set<std::string> respectedLabels;
+    for (auto const& label : relevantLabels) {
+        if (ctmc->getStateLabeling().containsLabel(label)) {
+            respectedLabels.insert(label);
+        }
+    }
+    options.respectedAtomicPropositions = respectedLabels;
+    options.setType(type);
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<ValueType>> decomposition(*ctmc, options);
+    decomposition.computeBisimulationDecomposition();
+    return decomposition.getQuotient()->template as<storm::models::sparse::Ctmc<ValueType>>();
+}
+}  // namespace
+
+template<typename ValueType>
+bool CompositionalBisimulationBuilder<ValueType>::canHandle(storm::prism::Program const& program) {
+    if (program.getModelType() != storm::prism::Program::ModelType::CTMC || program.getNumberOfModules() < 2 || program.hasUndefinedConstants() ||
+        !program.getGlobalBooleanVariables().empty() || !program.getGlobalIntegerVariables().empty() || program.hasInitialConstruct() ||
+        program.specifiesSystemComposition()) {
+        return false;
+    }
+
+    storm::prism::Program substitutedProgram = program.substituteConstantsFormulas();
+    std::map<uint_fast64_t, uint64_t> actionIndexToModule;
+    for (uint64_t moduleIndex = 0; moduleIndex < substitutedProgram.getNumberOfModules(); ++moduleIndex) {
+        storm::prism::Module const& module = substitutedProgram.getModule(moduleIndex);
+        std::set<storm::expressions::Variable> moduleVariables = module.getAllExpressionVariables();
+        for (auto const& command : module.getCommands()) {
+            // Commands with an action that appears in another module synchronize.
+            if (command.isLabeled()) {
+                auto actionIt = actionIndexToModule.emplace(command.getActionIndex(), moduleIndex).first;
+                if (actionIt->second != moduleIndex) {
+                    return false;
+                }
+            }
+
+            // The behaviour of the module must not depend on the variables of other modules.
+            if (!containsOnlyVariables(command.getGuardExpression(), moduleVariables)) {
+                return false;
+            }
+            for (auto const& update : command.getUpdates()) {
+                if (!containsOnlyVariables(update.getLikelihoodExpression(), moduleVariables)) {
+                    return false;
+                }
+                for (auto const& assignment : update.getAssignments()) {
+                    if (!containsOnlyVariables(assignment.getExpression(), moduleVariables)) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return static_cast<bool>(computeLabelOwners(substitutedProgram));
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> CompositionalBisimulationBuilder<ValueType>::build(
+    storm::prism::Program const& program, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type) {
+    STORM_LOG_THROW(canHandle(program), storm::exceptions::NotSupportedException,
+                    "Compositional bisimulation minimization is only supported for CTMCs whose modules neither synchronize nor share variables.");
+
+    // Determine the labels that need to be preserved.
+    std::set<std::string> relevantLabels;
+    if (formulas.empty()) {
+        for (auto const& label : program.getLabels()) {
+            relevantLabels.insert(label.getName());
+        }
+    } else {
+        for (auto const& formula : formulas) {
+            STORM_LOG_THROW(!formula->info().containsRewardOperator(), storm::exceptions::NotSupportedException,
+                            "Compositional bisimulation minimization does not support reward properties.");
+            STORM_LOG_THROW(formula->getAtomicExpressionFormulas().empty(), storm::exceptions::NotSupportedException,
+                            "Compositional bisimulation minimization requires properties to refer to labels instead of expressions.");
+            for (auto const& labelFormula : formula->getAtomicLabelFormulas()) {
+                relevantLabels.insert(labelFormula->getLabel());
+            }
+        }
+    }
+
+    storm::prism::Program substitutedProgram = program.substituteConstantsFormulas();
+    std::map<std::string, uint64_t> labelOwners = computeLabelOwners(substitutedProgram).get();
+
+    std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composedModel;
+    for (uint64_t moduleIndex = 0; moduleIndex < substitutedProgram.getNumberOfModules(); ++moduleIndex) {
+        // Build the module on its own by dropping the commands of all other modules. Their variables then keep their initial values.
+        storm::storage::FlatSet<uint_fast64_t> commandIndices;
+        for (auto const& command : substitutedProgram.getModule(moduleIndex).getCommands()) {
+            commandIndices.insert(command.getGlobalIndex());
+        }
+        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> componentModel =
+            storm::builder::ExplicitModelBuilder<ValueType>(substitutedProgram.restrictCommands(commandIndices), storm::builder::BuilderOptions(false, true))
+                .build()
+                ->template as<storm::models::sparse::Ctmc<ValueType>>();
+
+        // Only the labels that refer to the variables of this module are meaningful for the component.
+        std::set<std::string> componentLabels;
+        for (auto const& label : relevantLabels) {
+            auto ownerIt = labelOwners.find(label);
+            if (ownerIt != labelOwners.end() && ownerIt->second == moduleIndex) {
+                componentLabels.insert(label);
+            }
+        }
+        componentModel = minimize(componentModel, componentLabels, type);
+        STORM_LOG_DEBUG("Quotient of module " << substitutedProgram.getModule(moduleIndex).getName() << " has " << componentModel->getNumberOfStates()
+                                              << " states.");
+
+        if (composedModel) {
+            composedModel = minimize(ParallelCompositionBuilder<ValueType>::compose(composedModel, componentModel, false), relevantLabels, type);
+        } else {
+            composedModel = componentModel;
+        }
+        STORM_LOG_DEBUG("Composed quotient has " << composedModel->getNumberOfStates() << " states.");
+    }
+    return composedModel;
+}
+
+template class CompositionalBisimulationBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+template class CompositionalBisimulationBuilder<storm::RationalNumber>;
+template class CompositionalBisimulationBuilder<storm::RationalFunction>;
+#endif
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/storage/bisimulation/BisimulationType.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the bisimulation quotient of a PRISM CTMC compositionally: every module is built and minimized on its own and the quotients are
+ * composed (and minimized again) one by one using the ParallelCompositionBuilder. This way, the unminimized product is never built.
+ * As the composition is a pure interleaving, the modules must not interact, i.e. they may neither synchronize nor read the variables of other
+ * modules, and every label must only refer to the variables of a single module.
+ */
+template<typename ValueType>
+class CompositionalBisimulationBuilder {
+   public:
+    /*!
+     * Checks whether the given program can be minimized compositionally.
+     *
+     * @param program The program to check. All constants need to be defined.
+     * @return True iff the program is a CTMC whose modules do not interact.
+     */
+    static bool canHandle(storm::prism::Program const& program);
+
+    /*!
+     * Builds the bisimulation quotient of the given program.
+     *
+     * @param program The program to build. It must satisfy canHandle.
+     * @param formulas The formulas that need to be preserved. If empty, all labels of the program are preserved. The formulas must neither
+     * contain reward operators nor atomic expressions.
+     * @param type The type of bisimulation to use.
+     * @return The quotient model.
+     */
+    static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> build(storm::prism::Program const& program,
+                                                                         std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                         storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong);
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,258 @@
+#include "storm/builder/ConstantSweepModelBuilder.h"
+
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/ModelType.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace builder {
+
+namespace detail {
+
+void addVariables(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable>& variables) {
+    if (expression.isInitialized()) {
+        std::set<storm::expressions::Variable> expressionVariables = expression.getVariables();
+        variables.insert(expressionVariables.begin(), expressionVariables.end());
+    }
+}
+
+/*!
+ * Retrieves the variables occurring in the expressions that influence the reachable state space or the labels of the given program.
+ */
+std::set<storm::expressions::Variable> getStructuralVariables(storm::prism::Program const& program) {
+    std::set<storm::expressions::Variable> result;
+    for (auto const& variable : program.getGlobalBooleanVariables()) {
+        addVariables(variable.getInitialValueExpression(), result);
+    }
+    for (auto const& variable : program.getGlobalIntegerVariables()) {
+        addVariables(variable.getInitialValueExpression(), result);
+        addVariables(variable.getLowerBoundExpression(), result);
+        addVariables(variable.getUpperBoundExpression(), result);
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& variable : module.getBooleanVariables()) {
+            addVariables(variable.getInitialValueExpression(), result);
+        }
+        for (auto const& variable : module.getIntegerVariables()) {
+            addVariables(variable.getInitialValueExpression(), result);
+            addVariables(variable.getLowerBoundExpression(), result);
+            addVariables(variable.getUpperBoundExpression(), result);
+        }
+        for (auto const& command : module.getCommands()) {
+            addVariables(command.getGuardExpression(), result);
+            for (auto const& update : command.getUpdates()) {
+                for (auto const& assignment : update.getAssignments()) {
+                    addVariables(assignment.getExpression(), result);
+                }
+            }
+        }
+    }
+    for (auto const& label : program.getLabels()) {
+        addVariables(label.getStatePredicateExpression(), result);
+    }
+    if (program.hasInitialConstruct()) {
+        addVariables(program.getInitialConstruct().getInitialStatesExpression(), result);
+    }
+    for (auto const& rewardModel : program.getRewardModels()) {
+        for (auto const& stateReward : rewardModel.getStateRewards()) {
+            addVariables(stateReward.getStatePredicateExpression(), result);
+        }
+        for (auto const& stateActionReward : rewardModel.getStateActionRewards()) {
+            addVariables(stateActionReward.getStatePredicateExpression(), result);
+        }
+        for (auto const& transitionReward : rewardModel.getTransitionRewards()) {
+            addVariables(transitionReward.getSourceStatePredicateExpression(), result);
+            addVariables(transitionReward.getTargetStatePredicateExpression(), result);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+class FunctionEvaluator {
+   public:
+    FunctionEvaluator(std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> const& valuation) : valuation(valuation) {
+        // Intentionally left empty.
+    }
+
+    ValueType evaluate(storm::RationalFunction const& function) {
+        auto it = cache.find(function);
+        if (it == cache.end()) {
+            it = cache.emplace(function, storm::utility::convertNumber<ValueType>(function.evaluate(valuation))).first;
+        }
+        return it->second;
+    }
+
+    std::vector<ValueType> evaluate(std::vector<storm::RationalFunction> const& functions) {
+        std::vector<ValueType> result;
+        result.reserve(functions.size());
+        for (auto const& function : functions) {
+            result.push_back(evaluate(function));
+        }
+        return result;
+    }
+
+    storm::storage::SparseMatrix<ValueType> evaluate(storm::storage::SparseMatrix<storm::RationalFunction> const& matrix, bool fixEmptyRows) {
+        bool hasRowGrouping = !matrix.hasTrivialRowGrouping();
+        storm::storage::SparseMatrixBuilder<ValueType> builder(matrix.getRowCount(), matrix.getColumnCount(), 0, true, hasRowGrouping,
+                                                               hasRowGrouping ? matrix.getRowGroupCount() : 0);
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            if (hasRowGrouping) {
+                builder.newRowGroup(matrix.getRowGroupIndices()[group]);
+            }
+            for (uint64_t row = matrix.getRowGroupIndices()[group]; row < matrix.getRowGroupIndices()[group + 1]; ++row) {
+                bool rowIsEmpty = true;
+                for (auto const& entry : matrix.getRow(row)) {
+                    ValueType value = evaluate(entry.getValue());
+                    if (!storm::utility::isZero(value)) {
+                        builder.addNextValue(row, entry.getColumn(), value);
+                        rowIsEmpty = false;
+                    }
+                }
+                // A row whose entries all evaluate to zero is made absorbing just like the deadlock states of the builder.
+                if (rowIsEmpty && fixEmptyRows) {
+                    builder.addNextValue(row, group, storm::utility::one<ValueType>());
+                }
+            }
+        }
+        return builder.build();
+    }
+
+   private:
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> const& valuation;
+    std::unordered_map<storm::RationalFunction, ValueType> cache;
+};
+
+std::string toString(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+    std::stringstream stream;
+    for (auto const& definition : constantDefinitions) {
+        stream << definition.first.getName() << "=" << definition.second << ";";
+    }
+    return stream.str();
+}
+
+}  // namespace detail
+
+template<typename ValueType>
+ConstantSweepModelBuilder<ValueType>::ConstantSweepModelBuilder(storm::prism::Program const& program, storm::builder::BuilderOptions const& options)
+    : program(program), options(options), numberOfExplorations(0) {
+    storm::prism::Program::ModelType modelType = program.getModelType();
+    if (modelType != storm::prism::Program::ModelType::DTMC && modelType != storm::prism::Program::ModelType::CTMC &&
+        modelType != storm::prism::Program::ModelType::MDP) {
+        return;
+    }
+    std::set<storm::expressions::Variable> structuralVariables = detail::getStructuralVariables(program.substituteConstantsFormulas());
+    for (auto const& constant : program.getUndefinedConstants()) {
+        storm::expressions::Variable const& variable = constant.get().getExpressionVariable();
+        if (constant.get().getType().isRationalType() && structuralVariables.count(variable) == 0) {
+            valueConstants.insert(variable);
+        }
+    }
+    STORM_LOG_INFO("Found " << valueConstants.size() << " undefined constants that do not influence the reachable state space.");
+}
+
+template<typename ValueType>
+std::set<storm::expressions::Variable> const& ConstantSweepModelBuilder<ValueType>::getValueConstants() const {
+    return valueConstants;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ConstantSweepModelBuilder<ValueType>::build(
+    std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+    std::map<storm::expressions::Variable, storm::expressions::Expression> structuralDefinitions;
+    std::map<storm::expressions::Variable, storm::expressions::Expression> valueConstantDefinitions;
+    for (auto const& definition : constantDefinitions) {
+        if (valueConstants.count(definition.first) > 0) {
+            valueConstantDefinitions.insert(definition);
+        } else {
+            structuralDefinitions.insert(definition);
+        }
+    }
+    STORM_LOG_THROW(valueConstantDefinitions.size() == valueConstants.size(), storm::exceptions::InvalidArgumentException,
+                    "Not all undefined constants that do not influence the reachable state space are defined.");
+
+    if (valueConstants.empty()) {
+        ++numberOfExplorations;
+        return storm::builder::ExplicitModelBuilder<ValueType>(program.defineUndefinedConstants(constantDefinitions), options).build();
+    }
+
+    std::string key = detail::toString(structuralDefinitions);
+    auto skeletonIt = skeletons.find(key);
+    if (skeletonIt == skeletons.end()) {
+        STORM_LOG_INFO("Exploring the state space for constants '" << key << "'.");
+        ++numberOfExplorations;
+        auto skeleton = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program.defineUndefinedConstants(structuralDefinitions), options).build();
+        skeletonIt = skeletons.emplace(key, skeleton).first;
+    }
+    return instantiate(*skeletonIt->second, valueConstantDefinitions);
+}
+
+template<typename ValueType>
+uint64_t ConstantSweepModelBuilder<ValueType>::getNumberOfExplorations() const {
+    return numberOfExplorations;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ConstantSweepModelBuilder<ValueType>::instantiate(
+    storm::models::sparse::Model<storm::RationalFunction> const& skeleton,
+    std::map<storm::expressions::Variable, storm::expressions::Expression> const& valueConstantDefinitions) const {
+    // The builder translates the undefined constants to parameters with the same name.
+    std::map<std::string, storm::RationalFunctionCoefficient> valuesByName;
+    for (auto const& definition : valueConstantDefinitions) {
+        valuesByName[definition.first.getName()] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(definition.second.evaluateAsRational());
+    }
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    for (auto const& parameter : storm::models::sparse::getAllParameters(skeleton)) {
+        auto valueIt = valuesByName.find(parameter.name());
+        STORM_LOG_THROW(valueIt != valuesByName.end(), storm::exceptions::InvalidArgumentException,
+                        "The model contains the parameter '" << parameter.name() << "' that is not a defined constant.");
+        valuation.emplace(parameter, valueIt->second);
+    }
+
+    detail::FunctionEvaluator<ValueType> evaluator(valuation);
+    bool isCtmc = skeleton.getType() == storm::models::ModelType::Ctmc;
+    storm::storage::sparse::ModelComponents<ValueType> components(evaluator.evaluate(skeleton.getTransitionMatrix(), true),
+                                                                  storm::models::sparse::StateLabeling(skeleton.getStateLabeling()));
+    components.rateTransitions = isCtmc;
+    for (auto const& rewardModel : skeleton.getRewardModels()) {
+        std::optional<std::vector<ValueType>> stateRewards;
+        std::optional<std::vector<ValueType>> stateActionRewards;
+        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+        if (rewardModel.second.hasStateRewards()) {
+            stateRewards = evaluator.evaluate(rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            stateActionRewards = evaluator.evaluate(rewardModel.second.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            transitionRewards = evaluator.evaluate(rewardModel.second.getTransitionRewardMatrix(), false);
+        }
+        components.rewardModels.emplace(rewardModel.first, storm::models::sparse::StandardRewardModel<ValueType>(
+                                                               std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+    }
+    if (skeleton.hasChoiceLabeling()) {
+        components.choiceLabeling = skeleton.getChoiceLabeling();
+    }
+    if (skeleton.hasStateValuations()) {
+        components.stateValuations = skeleton.getStateValuations();
+    }
+    if (skeleton.hasChoiceOrigins()) {
+        components.choiceOrigins = skeleton.getChoiceOrigins();
+    }
+    return storm::utility::builder::buildModelFromComponents(skeleton.getType(), std::move(components));
+}
+
+template class ConstantSweepModelBuilder<double>;
+template class ConstantSweepModelBuilder<storm::RationalNumber>;
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the sparse models of a PRISM program for varying definitions of its undefined constants. Undefined real-valued constants that only occur
+ * in the probabilities (or rates) of updates and in reward values do not influence the reachable state space. For these "value constants", the
+ * program is explored only once (with the value constants as parameters) and each definition only evaluates the matrix entries and rewards of this
+ * skeleton. The other constants still require an exploration, but the skeleton is reused for all definitions that agree on them.
+ *
+ * Entries that evaluate to zero are dropped, but the states that are only reachable via such entries remain in the model (and are unreachable).
+ */
+template<typename ValueType>
+class ConstantSweepModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given program.
+     *
+     * @param program The program, which may contain undefined constants.
+     * @param options The options for building the models.
+     */
+    ConstantSweepModelBuilder(storm::prism::Program const& program, storm::builder::BuilderOptions const& options = storm::builder::BuilderOptions());
+
+    /*!
+     * Retrieves the value constants of the program, i.e., the constants that do not influence the reachable state space. Only DTMCs, CTMCs and
+     * MDPs can have value constants.
+     */
+    std::set<storm::expressions::Variable> const& getValueConstants() const;
+
+    /*!
+     * Builds the model for the given definitions of the undefined constants, which have to define all undefined constants.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build(
+        std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+    /*!
+     * Retrieves the number of explorations of the state space that were performed so far.
+     */
+    uint64_t getNumberOfExplorations() const;
+
+   private:
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> instantiate(
+        storm::models::sparse::Model<storm::RationalFunction> const& skeleton,
+        std::map<storm::expressions::Variable, storm::expressions::Expression> const& valueConstantDefinitions) const;
+
+    storm::prism::Program program;
+    storm::builder::BuilderOptions options;
+    std::set<storm::expressions::Variable> valueConstants;
+
+    // The skeletons indexed by the definitions of the constants that are not value constants.
+    std::map<std::string, std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>>> skeletons;
+
+    uint64_t numberOfExplorations;
+};
+
+}  // namespace builder
+}  // namespace storm
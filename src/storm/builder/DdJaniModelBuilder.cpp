@@ -1,5 +1,7 @@
 #include "storm/builder/DdJaniModelBuilder.h"
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include <sstream>
 
 #include <boost/algorithm/string/join.hpp>
@@ -41,6 +43,7 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/jani.h"
 #include "storm/utility/macros.h"
@@ -379,42 +382,53 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
         }
 
+        // Collect the location variables and the non-transient variables in declaration order and let the selected heuristic determine the order in
+        // which they are created.
+        std::vector<storm::expressions::Variable> declarationOrder;
+        std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomaton;
+        std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariable;
         for (auto const& automatonName : this->automata) {
             storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+            declarationOrder.push_back(automaton.getLocationExpressionVariable());
+            locationVariableToAutomaton.emplace(automaton.getLocationExpressionVariable(), &automaton);
+        }
+        for (auto const& variable : this->model.getGlobalVariables()) {
+            if (!variable.isTransient()) {
+                declarationOrder.push_back(variable.getExpressionVariable());
+                expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+            }
+        }
+        for (auto const& automaton : this->model.getAutomata()) {
+            for (auto const& variable : automaton.getVariables()) {
+                if (!variable.isTransient()) {
+                    declarationOrder.push_back(variable.getExpressionVariable());
+                    expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+                }
+            }
+        }
+        storm::builder::DdVariableOrderingHeuristic heuristic =
+            storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic();
+        STORM_LOG_DEBUG("Creating DD variables in " << heuristic << " order.");
 
-            // Start by creating a meta variable for the location of the automaton.
-            storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-            result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-            result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-            result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-            result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-
-            // Add the location variable to the row/column variables.
-            result.rowMetaVariables.insert(variablePair.first);
-            result.columnMetaVariables.insert(variablePair.second);
-
-            // Add the legal range for the location variables.
-            result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-            result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+        for (auto const& expressionVariable : storm::builder::orderDdVariables(heuristic, this->model, declarationOrder)) {
+            auto locationIt = locationVariableToAutomaton.find(expressionVariable);
+            if (locationIt != locationVariableToAutomaton.end()) {
+                createLocationVariable(*locationIt->second, result);
+            } else {
+                createVariable(*expressionVariableToVariable.at(expressionVariable), result);
+            }
         }
 
-        // Create global variables.
+        // Create the ranges of the global variables.
         storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
         for (auto const& variable : this->model.getGlobalVariables()) {
-            // Only create the variable if it's non-transient.
-            if (variable.isTransient()) {
-                continue;
+            if (!variable.isTransient()) {
+                globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
-
-            createVariable(variable, result);
-            globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
         }
         result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
 
-        // Create the variables for the individual automata.
+        // Create the identities and ranges of the individual automata.
         for (auto const& automaton : this->model.getAutomata()) {
             storm::dd::Bdd<Type> identity = result.manager->getBddOne();
             storm::dd::Bdd<Type> range = result.manager->getBddOne();
@@ -426,14 +440,13 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             identity &= variableIdentity;
             range &= result.manager->getRange(locationVariables.first);
 
-            // Then create variables for the variables of the automaton.
+            // Then add the ones of the variables of the automaton.
             for (auto const& variable : automaton.getVariables()) {
-                // Only create the variable if it's non-transient.
+                // Only non-transient variables have been created.
                 if (variable.isTransient()) {
                     continue;
                 }
 
-                createVariable(variable, result);
                 identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                 range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
@@ -451,6 +464,25 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         return result;
     }
 
+    void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+        storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+            result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+        result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+        result.rowColumnMetaVariablePairs.push_back(variablePair);
+
+        result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+        result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+
+        // Add the location variable to the row/column variables.
+        result.rowMetaVariables.insert(variablePair.first);
+        result.columnMetaVariables.insert(variablePair.second);
+
+        // Add the legal range for the location variables.
+        result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+        result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+    }
+
     void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
         auto const& type = variable.getType();
         if (type.isBasicType() && type.asBasicType().isBooleanType()) {
@@ -539,6 +571,9 @@ struct ComposerResult {
     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
     storm::dd::Bdd<Type> illegalFragment;
     uint64_t numberOfNondeterminismVariables;
+
+    // The transitions of the individual actions (only filled if requested). Their sum is the transitions DD (before postprocessing).
+    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
 };
 
 // A class that is responsible for performing the actual composition. This
@@ -945,16 +980,20 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
 
     CombinedEdgesSystemComposer(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation,
                                 CompositionVariables<Type, ValueType> const& variables, std::vector<storm::expressions::Variable> const& transientVariables,
-                                bool applyMaximumProgress)
+                                bool applyMaximumProgress, bool keepActionTransitions = false)
         : SystemComposer<Type, ValueType>(model, variables, transientVariables),
           actionInformation(actionInformation),
-          applyMaximumProgress(applyMaximumProgress) {
+          applyMaximumProgress(applyMaximumProgress),
+          keepActionTransitions(keepActionTransitions) {
         // Intentionally left empty.
     }
 
     storm::jani::CompositionInformation const& actionInformation;
     bool applyMaximumProgress;
 
+    // Whether the transitions of the individual actions are to be stored in the result (in addition to their sum).
+    bool keepActionTransitions;
+
     ComposerResult<Type, ValueType> compose() override {
         STORM_LOG_THROW(this->model.hasStandardCompliantComposition(), storm::exceptions::WrongFormatException,
                         "Model builder only supports non-nested parallel compositions.");
@@ -1098,6 +1137,9 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
             }
 
             subautomata.push_back(boost::any_cast<AutomatonDd>(composition.getSubcomposition(subcompositionIndex).accept(*this, actionInstantiations)));
+
+            // No DD operation is in progress between translating automata, so this is a good point to reorder the variables if necessary.
+            this->variables.manager->reorderIfNecessary();
         }
 
         return composeInParallel(subautomata, composition.getSynchronizationVectors());
@@ -2020,6 +2062,7 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
 
             // Add missing global variable identities, action and nondeterminism encodings.
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+            std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
             std::unordered_set<ActionIdentification, ActionIdentificationHash> containedActions;
             for (auto& action : automaton.actions) {
                 STORM_LOG_TRACE("Treating action with index " << action.first.actionIndex << (action.first.isMarkovian() ? " (Markovian)" : "") << ".");
@@ -2047,16 +2090,22 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 }
 
                 result += extendedTransitions;
+                if (keepActionTransitions) {
+                    actionTransitions.push_back(extendedTransitions);
+                }
             }
 
-            return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment,
-                                                   numberOfUsedNondeterminismVariables);
+            ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment,
+                                                           numberOfUsedNondeterminismVariables);
+            composerResult.actionTransitions = std::move(actionTransitions);
+            return composerResult;
         } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
             // Simply add all actions, but make sure to include the missing global variable identities.
 
             storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
             storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
+            std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
             std::unordered_set<uint64_t> actionIndices;
             for (auto& action : automaton.actions) {
                 STORM_LOG_THROW(actionIndices.find(action.first.actionIndex) == actionIndices.end(), storm::exceptions::WrongFormatException,
@@ -2066,9 +2115,14 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
                 addMissingGlobalVariableIdentities(action.second);
                 addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
                 result += action.second.transitions;
+                if (keepActionTransitions) {
+                    actionTransitions.push_back(action.second.transitions);
+                }
             }
 
-            return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+            ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+            composerResult.actionTransitions = std::move(actionTransitions);
+            return composerResult;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
         }
@@ -2352,8 +2406,12 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
 
     // Create a builder to compose and build the model.
     bool applyMaximumProgress = options.applyMaximumProgressAssumption && model.getModelType() == storm::jani::ModelType::MA;
-    CombinedEdgesSystemComposer<Type, ValueType> composer(model, actionInformation, variables, rewardVariables, applyMaximumProgress);
+    storm::utility::dd::ReachabilityMethod reachabilityMethod =
+        storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityMethod();
+    CombinedEdgesSystemComposer<Type, ValueType> composer(model, actionInformation, variables, rewardVariables, applyMaximumProgress,
+                                                          reachabilityMethod != storm::utility::dd::ReachabilityMethod::Bfs);
     ComposerResult<Type, ValueType> system = composer.compose();
+    variables.manager->reorderIfNecessary();
 
     // Postprocess the variables in place.
     postprocessVariables(model.getModelType(), system, variables);
@@ -2379,9 +2437,26 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
         model.getModelType() == storm::jani::ModelType::MA) {
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
     }
-    modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
-                                                                                 variables.columnMetaVariables)
-                                          .first;
+    if (reachabilityMethod == storm::utility::dd::ReachabilityMethod::Bfs) {
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+    } else {
+        // Use the transitions of the individual actions instead, which need to be cut to the non-terminal states as well.
+        std::vector<storm::dd::Bdd<Type>> actionTransitionsBdds;
+        for (auto const& actionTransitions : system.actionTransitions) {
+            storm::dd::Bdd<Type> actionTransitionsBdd = actionTransitions.notZero() && !terminalStates;
+            if (model.getModelType() == storm::jani::ModelType::MDP || model.getModelType() == storm::jani::ModelType::LTS ||
+                model.getModelType() == storm::jani::ModelType::MA) {
+                actionTransitionsBdd = actionTransitionsBdd.existsAbstract(variables.allNondeterminismVariables);
+            }
+            actionTransitionsBdds.push_back(actionTransitionsBdd);
+        }
+        system.actionTransitions.clear();
+        modelComponents.reachableStates = storm::utility::dd::computeReachableStates(reachabilityMethod, modelComponents.initialStates, actionTransitionsBdds,
+                                                                                     variables.rowMetaVariables, variables.columnMetaVariables)
+                                              .first;
+    }
 
     // Check that the reachable fragment does not overlap with the illegal fragment.
     storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -2410,6 +2485,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuilder<Type, ValueType>::build(storm::jani::Model const& model,
                                                                                                             Options const& options) {
+    storm::utility::InstrumentationTimer instrumentationTimer("building.dd");
     // Prepare the model and do some sanity checks
     if (!std::is_same<ValueType, storm::RationalFunction>::value && model.hasUndefinedConstants()) {
         std::vector<std::reference_wrapper<storm::jani::Constant const>> undefinedConstants = model.getUndefinedConstants();
@@ -1,5 +1,7 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/models/symbolic/Ctmc.h"
@@ -13,6 +15,7 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/math.h"
 #include "storm/utility/prism.h"
@@ -188,93 +191,72 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
-        // Create meta variables for global program variables.
+        // Collect the program variables in declaration order and let the selected heuristic determine the order in which they are created.
+        std::vector<storm::expressions::Variable> declarationOrder;
+        std::map<storm::expressions::Variable, storm::prism::IntegerVariable const*> integerVariables;
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-
-            STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
-
-            rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-            columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-            rowColumnMetaVariablePairs.push_back(variablePair);
-
+            declarationOrder.push_back(integerVariable.getExpressionVariable());
+            integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-
-            STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
+            declarationOrder.push_back(booleanVariable.getExpressionVariable());
+            allGlobalVariables.insert(booleanVariable.getExpressionVariable());
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                declarationOrder.push_back(integerVariable.getExpressionVariable());
+                integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
+            }
+            for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                declarationOrder.push_back(booleanVariable.getExpressionVariable());
+            }
+        }
+        storm::builder::DdVariableOrderingHeuristic heuristic =
+            storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic();
+        std::vector<storm::expressions::Variable> variableOrder = storm::builder::orderDdVariables(heuristic, program, declarationOrder);
+        STORM_LOG_DEBUG("Creating DD variables in " << heuristic << " order.");
+
+        // Create meta variables for all program variables.
+        for (storm::expressions::Variable const& variable : variableOrder) {
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+            auto integerVariableIt = integerVariables.find(variable);
+            if (integerVariableIt != integerVariables.end()) {
+                int_fast64_t low = integerVariableIt->second->getLowerBoundExpression().evaluateAsInt();
+                int_fast64_t high = integerVariableIt->second->getUpperBoundExpression().evaluateAsInt();
+                variablePair = manager->addMetaVariable(variable.getName(), low, high);
+            } else {
+                variablePair = manager->addMetaVariable(variable.getName());
+            }
+            STORM_LOG_TRACE("Created meta variables for variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and "
+                                                                    << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
 
             rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
+            variableToRowMetaVariableMap->emplace(variable, variablePair.first);
 
             columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
+            variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
 
             storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-
+            variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
             rowColumnMetaVariablePairs.push_back(variablePair);
-            allGlobalVariables.insert(booleanVariable.getExpressionVariable());
         }
 
-        // Create meta variables for each of the modules' variables.
+        // Create the identities and ranges of the modules.
         for (storm::prism::Module const& module : program.getModules()) {
             storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
             storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
 
+            std::vector<storm::expressions::Variable> moduleVariables;
             for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
-                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleVariables.push_back(integerVariable.getExpressionVariable());
             }
             for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+                moduleVariables.push_back(booleanVariable.getExpressionVariable());
+            }
+            for (storm::expressions::Variable const& variable : moduleVariables) {
+                moduleIdentity &= variableToIdentityMap.at(variable).toBdd();
+                moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(variable));
             }
             moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
             moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -318,6 +300,8 @@ class ModuleComposer : public storm::prism::CompositionVisitor {
         typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram result = DdPrismModelBuilder<Type, ValueType>::createModuleDecisionDiagram(
             generationInfo, generationInfo.program.getModule(composition.getModuleName()), synchronizingActionToOffsetMap);
 
+        // No DD operation is in progress between translating modules, so this is a good point to reorder the variables if necessary.
+        generationInfo.manager->reorderIfNecessary();
         return result;
     }
 
@@ -593,6 +577,8 @@ class ModuleComposer : public storm::prism::CompositionVisitor {
 
         // Keep track of the number of nondeterminism variables used.
         left.numberOfUsedNondeterminismVariables = std::max(left.numberOfUsedNondeterminismVariables, numberOfUsedNondeterminismVariables);
+
+        generationInfo.manager->reorderIfNecessary();
     }
 
     typename DdPrismModelBuilder<Type, ValueType>::GenerationInformation& generationInfo;
@@ -664,6 +650,9 @@ struct DdPrismModelBuilder<Type, ValueType>::SystemResult {
     storm::dd::Add<Type, ValueType> allTransitionsDd;
     typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram globalModule;
     boost::optional<storm::dd::Add<Type, ValueType>> stateActionDd;
+
+    // The transitions of the individual actions (only filled if requested). Their sum is allTransitionsDd (before normalization).
+    std::vector<storm::dd::Add<Type, ValueType>> actionTransitionsDds;
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -1130,8 +1119,8 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::getSynchro
 }
 
 template<storm::dd::DdType Type, typename ValueType>
-storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSystemFromModule(GenerationInformation& generationInfo,
-                                                                                             ModuleDecisionDiagram& module) {
+storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSystemFromModule(
+    GenerationInformation& generationInfo, ModuleDecisionDiagram& module, std::vector<storm::dd::Add<Type, ValueType>>* actionTransitionsDds) {
     storm::dd::Add<Type, ValueType> result;
 
     // Make sure all actions contain all necessary meta variables.
@@ -1196,6 +1185,13 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
             synchronizingAction.second *= getSynchronizationDecisionDiagram(generationInfo, synchronizingAction.first);
         }
 
+        if (actionTransitionsDds) {
+            actionTransitionsDds->push_back(result);
+            for (auto const& synchronizingAction : synchronizingActionToDdMap) {
+                actionTransitionsDds->push_back(synchronizingAction.second);
+            }
+        }
+
         // Now, we can simply add all synchronizing actions to the result.
         for (auto const& synchronizingAction : synchronizingActionToDdMap) {
             result += synchronizingAction.second;
@@ -1216,6 +1212,9 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
         }
 
         result = identityEncoding * module.independentAction.transitionsDd;
+        if (actionTransitionsDds) {
+            actionTransitionsDds->push_back(result);
+        }
         for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
             // Compute missing global variable identities in synchronizing actions.
             missingIdentities = std::set<storm::expressions::Variable>();
@@ -1229,7 +1228,11 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
                 identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
             }
 
-            result += identityEncoding * synchronizingAction.second.transitionsDd;
+            storm::dd::Add<Type, ValueType> actionTransitions = identityEncoding * synchronizingAction.second.transitionsDd;
+            if (actionTransitionsDds) {
+                actionTransitionsDds->push_back(actionTransitions);
+            }
+            result += actionTransitions;
         }
     } else {
         STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Illegal model type.");
@@ -1239,13 +1242,14 @@ storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSyst
 
 template<storm::dd::DdType Type, typename ValueType>
 typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<Type, ValueType>::createSystemDecisionDiagram(
-    GenerationInformation& generationInfo) {
+    GenerationInformation& generationInfo, bool keepActionTransitions) {
     ModuleComposer<Type, ValueType> composer(generationInfo);
     ModuleDecisionDiagram system =
         composer.compose(generationInfo.program.specifiesSystemComposition() ? generationInfo.program.getSystemCompositionConstruct().getSystemComposition()
                                                                              : *generationInfo.program.getDefaultSystemComposition());
 
-    storm::dd::Add<Type, ValueType> result = createSystemFromModule(generationInfo, system);
+    std::vector<storm::dd::Add<Type, ValueType>> actionTransitionsDds;
+    storm::dd::Add<Type, ValueType> result = createSystemFromModule(generationInfo, system, keepActionTransitions ? &actionTransitionsDds : nullptr);
 
     // Create an auxiliary DD that is used later during the construction of reward models.
     boost::optional<storm::dd::Add<Type, ValueType>> stateActionDd;
@@ -1263,7 +1267,9 @@ typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<
         generationInfo.nondeterminismMetaVariables.resize(system.numberOfUsedNondeterminismVariables);
     }
 
-    return SystemResult(result, system, stateActionDd);
+    SystemResult systemResult(result, system, stateActionDd);
+    systemResult.actionTransitionsDds = std::move(actionTransitionsDds);
+    return systemResult;
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -1424,7 +1430,10 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
     // In particular, this creates the meta variables used to encode the model.
     GenerationInformation generationInfo(program, manager);
 
-    SystemResult system = createSystemDecisionDiagram(generationInfo);
+    storm::utility::dd::ReachabilityMethod reachabilityMethod =
+        storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityMethod();
+    SystemResult system = createSystemDecisionDiagram(generationInfo, reachabilityMethod != storm::utility::dd::ReachabilityMethod::Bfs);
+    generationInfo.manager->reorderIfNecessary();
     storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
 
     ModuleDecisionDiagram const& globalModule = system.globalModule;
@@ -1455,9 +1464,26 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
     }
 
-    storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
-                                                                                            generationInfo.columnMetaVariables)
-                                               .first;
+    storm::dd::Bdd<Type> reachableStates;
+    if (reachabilityMethod == storm::utility::dd::ReachabilityMethod::Bfs) {
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
+                                                                           generationInfo.columnMetaVariables)
+                              .first;
+    } else {
+        // Use the transitions of the individual actions instead, which need to be cut to the non-terminal states as well.
+        std::vector<storm::dd::Bdd<Type>> actionTransitionsBdds;
+        for (auto const& actionTransitionsDd : system.actionTransitionsDds) {
+            storm::dd::Bdd<Type> actionTransitionsBdd = actionTransitionsDd.notZero() && !terminalStatesBdd;
+            if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+                actionTransitionsBdd = actionTransitionsBdd.existsAbstract(generationInfo.allNondeterminismVariables);
+            }
+            actionTransitionsBdds.push_back(actionTransitionsBdd);
+        }
+        system.actionTransitionsDds.clear();
+        reachableStates = storm::utility::dd::computeReachableStates<Type>(reachabilityMethod, initialStates, actionTransitionsBdds,
+                                                                           generationInfo.rowMetaVariables, generationInfo.columnMetaVariables)
+                              .first;
+    }
     storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
     transitionMatrix *= reachableStatesAdd;
     if (system.stateActionDd) {
@@ -1573,6 +1599,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBuilder<Type, ValueType>::build(storm::prism::Program const& program,
                                                                                                              Options const& options) {
+    storm::utility::InstrumentationTimer instrumentationTimer("building.dd");
     if (!std::is_same<ValueType, storm::RationalFunction>::value && program.hasUndefinedConstants()) {
         std::vector<std::reference_wrapper<storm::prism::Constant const>> undefinedConstants = program.getUndefinedConstants();
         std::stringstream stream;
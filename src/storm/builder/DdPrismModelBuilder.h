@@ -279,7 +279,9 @@ class DdPrismModelBuilder {
 
     static storm::dd::Add<Type, ValueType> getSynchronizationDecisionDiagram(GenerationInformation& generationInfo, uint_fast64_t actionIndex = 0);
 
-    static storm::dd::Add<Type, ValueType> createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module);
+    // Creates the transitions of the system from the given (global) module. If requested, the transitions of the individual actions are stored.
+    static storm::dd::Add<Type, ValueType> createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module,
+                                                                  std::vector<storm::dd::Add<Type, ValueType>>* actionTransitionsDds = nullptr);
 
     static std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> createRewardModelDecisionDiagrams(
         std::vector<std::reference_wrapper<storm::prism::RewardModel const>> const& selectedRewardModels, SystemResult& system,
@@ -291,7 +293,7 @@ class DdPrismModelBuilder {
         storm::dd::Add<Type, ValueType> const& reachableStatesAdd, storm::dd::Add<Type, ValueType> const& transitionMatrix,
         boost::optional<storm::dd::Add<Type, ValueType>>& stateActionDd);
 
-    static SystemResult createSystemDecisionDiagram(GenerationInformation& generationInfo);
+    static SystemResult createSystemDecisionDiagram(GenerationInformation& generationInfo, bool keepActionTransitions = false);
 
     static storm::dd::Bdd<Type> createInitialStatesDecisionDiagram(GenerationInformation& generationInfo);
 };
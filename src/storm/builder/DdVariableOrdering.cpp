@@ -0,0 +1,354 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic) {
+    switch (heuristic) {
+        case DdVariableOrderingHeuristic::Declaration:
+            out << "declaration";
+            break;
+        case DdVariableOrderingHeuristic::Force:
+            out << "force";
+            break;
+        case DdVariableOrderingHeuristic::Clustering:
+            out << "clustering";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+DdVariableInteractions::DdVariableInteractions(uint64_t numberOfVariables) : variableToComponent(numberOfVariables) {
+    std::iota(variableToComponent.begin(), variableToComponent.end(), 0);
+}
+
+void DdVariableInteractions::setComponent(uint64_t variable, uint64_t component) {
+    variableToComponent[variable] = component;
+}
+
+void DdVariableInteractions::addHyperedge(std::vector<uint64_t> variables) {
+    std::sort(variables.begin(), variables.end());
+    variables.erase(std::unique(variables.begin(), variables.end()), variables.end());
+    // Hyperedges with a single variable do not constrain the order.
+    if (variables.size() > 1) {
+        hyperedges.push_back(std::move(variables));
+    }
+}
+
+uint64_t DdVariableInteractions::getNumberOfVariables() const {
+    return variableToComponent.size();
+}
+
+std::vector<uint64_t> const& DdVariableInteractions::getComponents() const {
+    return variableToComponent;
+}
+
+std::vector<std::vector<uint64_t>> const& DdVariableInteractions::getHyperedges() const {
+    return hyperedges;
+}
+
+namespace {
+
+// The sum of the spans of all hyperedges with respect to the given positions of the variables.
+uint64_t getTotalSpan(DdVariableInteractions const& interactions, std::vector<uint64_t> const& positions) {
+    uint64_t result = 0;
+    for (auto const& hyperedge : interactions.getHyperedges()) {
+        auto minMax = std::minmax_element(hyperedge.begin(), hyperedge.end(),
+                                          [&positions](uint64_t left, uint64_t right) { return positions[left] < positions[right]; });
+        result += positions[*minMax.second] - positions[*minMax.first];
+    }
+    return result;
+}
+
+std::vector<uint64_t> computeForceOrder(DdVariableInteractions const& interactions) {
+    uint64_t numberOfVariables = interactions.getNumberOfVariables();
+    std::vector<uint64_t> order(numberOfVariables);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint64_t> positions = order;
+
+    std::vector<uint64_t> bestOrder = order;
+    uint64_t bestSpan = getTotalSpan(interactions, positions);
+
+    // The heuristic usually converges quickly, the bound only guards against oscillation.
+    uint64_t maximalNumberOfIterations = 10 + 2 * static_cast<uint64_t>(std::log2(numberOfVariables + 1));
+    std::vector<double> gravity(numberOfVariables);
+    std::vector<uint64_t> numberOfHyperedges(numberOfVariables);
+    for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+        std::fill(gravity.begin(), gravity.end(), 0.0);
+        std::fill(numberOfHyperedges.begin(), numberOfHyperedges.end(), 0);
+        for (auto const& hyperedge : interactions.getHyperedges()) {
+            double centerOfGravity = 0.0;
+            for (auto const& variable : hyperedge) {
+                centerOfGravity += positions[variable];
+            }
+            centerOfGravity /= hyperedge.size();
+            for (auto const& variable : hyperedge) {
+                gravity[variable] += centerOfGravity;
+                ++numberOfHyperedges[variable];
+            }
+        }
+        for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+            // Variables without any interaction keep their position.
+            gravity[variable] = numberOfHyperedges[variable] == 0 ? positions[variable] : gravity[variable] / numberOfHyperedges[variable];
+        }
+
+        // The stable sort (ties are broken by the current position) prevents variables with equal gravity from oscillating.
+        std::stable_sort(order.begin(), order.end(), [&gravity](uint64_t left, uint64_t right) { return gravity[left] < gravity[right]; });
+        for (uint64_t position = 0; position < numberOfVariables; ++position) {
+            positions[order[position]] = position;
+        }
+
+        uint64_t span = getTotalSpan(interactions, positions);
+        if (span >= bestSpan) {
+            break;
+        }
+        bestSpan = span;
+        bestOrder = order;
+    }
+    return bestOrder;
+}
+
+std::vector<uint64_t> computeClusteringOrder(DdVariableInteractions const& interactions) {
+    std::vector<uint64_t> const& components = interactions.getComponents();
+
+    // Renumber the components in the order in which they first occur.
+    std::map<uint64_t, uint64_t> componentToIndex;
+    for (auto const& component : components) {
+        componentToIndex.emplace(component, componentToIndex.size());
+    }
+    uint64_t numberOfComponents = componentToIndex.size();
+
+    // Two components communicate once for every hyperedge that contains variables of both.
+    std::vector<std::vector<uint64_t>> communication(numberOfComponents, std::vector<uint64_t>(numberOfComponents, 0));
+    for (auto const& hyperedge : interactions.getHyperedges()) {
+        std::vector<uint64_t> involvedComponents;
+        for (auto const& variable : hyperedge) {
+            involvedComponents.push_back(componentToIndex.at(components[variable]));
+        }
+        std::sort(involvedComponents.begin(), involvedComponents.end());
+        involvedComponents.erase(std::unique(involvedComponents.begin(), involvedComponents.end()), involvedComponents.end());
+        for (auto const& first : involvedComponents) {
+            for (auto const& second : involvedComponents) {
+                if (first != second) {
+                    ++communication[first][second];
+                }
+            }
+        }
+    }
+
+    // Greedily append the component that communicates most with the already placed ones. Ties are broken by the declaration order. The first
+    // component is the one that communicates most overall.
+    std::vector<uint64_t> connectionToPlaced(numberOfComponents, 0);
+    for (uint64_t component = 0; component < numberOfComponents; ++component) {
+        connectionToPlaced[component] = std::accumulate(communication[component].begin(), communication[component].end(), 0ull);
+    }
+    std::vector<bool> placed(numberOfComponents, false);
+    std::vector<uint64_t> componentOrder;
+    for (uint64_t step = 0; step < numberOfComponents; ++step) {
+        uint64_t best = numberOfComponents;
+        for (uint64_t component = 0; component < numberOfComponents; ++component) {
+            if (placed[component]) {
+                continue;
+            }
+            if (best == numberOfComponents || connectionToPlaced[component] > connectionToPlaced[best]) {
+                best = component;
+            }
+        }
+        placed[best] = true;
+        componentOrder.push_back(best);
+        if (step == 0) {
+            std::fill(connectionToPlaced.begin(), connectionToPlaced.end(), 0);
+        }
+        for (uint64_t component = 0; component < numberOfComponents; ++component) {
+            connectionToPlaced[component] += communication[best][component];
+        }
+    }
+
+    std::vector<uint64_t> positionOfComponent(numberOfComponents);
+    for (uint64_t position = 0; position < numberOfComponents; ++position) {
+        positionOfComponent[componentOrder[position]] = position;
+    }
+    std::vector<uint64_t> order(components.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint64_t left, uint64_t right) {
+        return positionOfComponent[componentToIndex.at(components[left])] < positionOfComponent[componentToIndex.at(components[right])];
+    });
+    return order;
+}
+
+// Maps the variables to their positions in the declaration order.
+std::unordered_map<storm::expressions::Variable, uint64_t> getVariableToPositionMap(std::vector<storm::expressions::Variable> const& variables) {
+    std::unordered_map<storm::expressions::Variable, uint64_t> result;
+    for (uint64_t position = 0; position < variables.size(); ++position) {
+        result.emplace(variables[position], position);
+    }
+    return result;
+}
+
+// Adds the position of the given variable to the given vector if it is a state variable.
+void addPosition(storm::expressions::Variable const& variable, std::unordered_map<storm::expressions::Variable, uint64_t> const& variableToPosition,
+                 std::vector<uint64_t>& positions) {
+    auto it = variableToPosition.find(variable);
+    if (it != variableToPosition.end()) {
+        positions.push_back(it->second);
+    }
+}
+
+void addPositions(std::set<storm::expressions::Variable> const& variables,
+                  std::unordered_map<storm::expressions::Variable, uint64_t> const& variableToPosition, std::vector<uint64_t>& positions) {
+    for (auto const& variable : variables) {
+        addPosition(variable, variableToPosition, positions);
+    }
+}
+
+std::vector<storm::expressions::Variable> applyOrder(DdVariableOrderingHeuristic const& heuristic, DdVariableInteractions const& interactions,
+                                                     std::vector<storm::expressions::Variable> const& declarationOrder) {
+    std::vector<storm::expressions::Variable> result;
+    for (auto const& position : computeDdVariableOrder(heuristic, interactions)) {
+        result.push_back(declarationOrder[position]);
+    }
+    return result;
+}
+
+}  // namespace
+
+std::vector<uint64_t> computeDdVariableOrder(DdVariableOrderingHeuristic const& heuristic, DdVariableInteractions const& interactions) {
+    switch (heuristic) {
+        case DdVariableOrderingHeuristic::Declaration: {
+            std::vector<uint64_t> result(interactions.getNumberOfVariables());
+            std::iota(result.begin(), result.end(), 0);
+            return result;
+        }
+        case DdVariableOrderingHeuristic::Force:
+            return computeForceOrder(interactions);
+        case DdVariableOrderingHeuristic::Clustering:
+            return computeClusteringOrder(interactions);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown variable ordering heuristic '" << heuristic << "'.");
+}
+
+std::vector<storm::expressions::Variable> orderDdVariables(DdVariableOrderingHeuristic const& heuristic, storm::prism::Program const& program,
+                                                           std::vector<storm::expressions::Variable> const& declarationOrder) {
+    if (heuristic == DdVariableOrderingHeuristic::Declaration) {
+        return declarationOrder;
+    }
+
+    auto variableToPosition = getVariableToPositionMap(declarationOrder);
+    DdVariableInteractions interactions(declarationOrder.size());
+
+    // Global variables remain components of their own, the variables of a module form one component.
+    std::map<uint64_t, std::vector<uint64_t>> actionToWrittenVariables;
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getModules().size(); ++moduleIndex) {
+        storm::prism::Module const& module = program.getModules()[moduleIndex];
+        uint64_t component = declarationOrder.size() + moduleIndex;
+        for (auto const& variable : module.getIntegerVariables()) {
+            interactions.setComponent(variableToPosition.at(variable.getExpressionVariable()), component);
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            interactions.setComponent(variableToPosition.at(variable.getExpressionVariable()), component);
+        }
+
+        for (auto const& command : module.getCommands()) {
+            std::vector<uint64_t> accessed;
+            std::vector<uint64_t> written;
+            addPositions(command.getGuardExpression().getVariables(), variableToPosition, accessed);
+            for (auto const& update : command.getUpdates()) {
+                addPositions(update.getLikelihoodExpression().getVariables(), variableToPosition, accessed);
+                for (auto const& assignment : update.getAssignments()) {
+                    addPosition(assignment.getVariable(), variableToPosition, written);
+                    addPositions(assignment.getExpression().getVariables(), variableToPosition, accessed);
+                }
+            }
+            if (command.isLabeled()) {
+                auto& variablesOfAction = actionToWrittenVariables[command.getActionIndex()];
+                variablesOfAction.insert(variablesOfAction.end(), written.begin(), written.end());
+            }
+            accessed.insert(accessed.end(), written.begin(), written.end());
+            interactions.addHyperedge(std::move(accessed));
+        }
+    }
+
+    // Synchronizing commands change the variables of all participating modules at once.
+    for (auto& actionVariables : actionToWrittenVariables) {
+        interactions.addHyperedge(std::move(actionVariables.second));
+    }
+
+    return applyOrder(heuristic, interactions, declarationOrder);
+}
+
+std::vector<storm::expressions::Variable> orderDdVariables(DdVariableOrderingHeuristic const& heuristic, storm::jani::Model const& model,
+                                                           std::vector<storm::expressions::Variable> const& declarationOrder) {
+    if (heuristic == DdVariableOrderingHeuristic::Declaration) {
+        return declarationOrder;
+    }
+
+    auto variableToPosition = getVariableToPositionMap(declarationOrder);
+    DdVariableInteractions interactions(declarationOrder.size());
+
+    // Global variables remain components of their own, the location and the local variables of an automaton form one component.
+    std::map<uint64_t, std::vector<uint64_t>> actionToWrittenVariables;
+    for (uint64_t automatonIndex = 0; automatonIndex < model.getAutomata().size(); ++automatonIndex) {
+        storm::jani::Automaton const& automaton = model.getAutomata()[automatonIndex];
+        uint64_t component = declarationOrder.size() + automatonIndex;
+        std::vector<uint64_t> locationVariable;
+        addPosition(automaton.getLocationExpressionVariable(), variableToPosition, locationVariable);
+        for (auto const& position : locationVariable) {
+            interactions.setComponent(position, component);
+        }
+        for (auto const& variable : automaton.getVariables()) {
+            auto it = variableToPosition.find(variable.getExpressionVariable());
+            if (it != variableToPosition.end()) {
+                interactions.setComponent(it->second, component);
+            }
+        }
+
+        for (auto const& edge : automaton.getEdges()) {
+            std::vector<uint64_t> accessed;
+            std::vector<uint64_t> written = locationVariable;
+            addPositions(edge.getGuard().getVariables(), variableToPosition, accessed);
+            for (auto const& destination : edge.getDestinations()) {
+                addPositions(destination.getProbability().getVariables(), variableToPosition, accessed);
+                for (auto const& assignment : destination.getOrderedAssignments().getNonTransientAssignments()) {
+                    if (assignment.lValueIsVariable()) {
+                        addPosition(assignment.getExpressionVariable(), variableToPosition, written);
+                    }
+                    addPositions(assignment.getAssignedExpression().getVariables(), variableToPosition, accessed);
+                }
+            }
+            if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                auto& variablesOfAction = actionToWrittenVariables[edge.getActionIndex()];
+                variablesOfAction.insert(variablesOfAction.end(), written.begin(), written.end());
+            }
+            accessed.insert(accessed.end(), written.begin(), written.end());
+            interactions.addHyperedge(std::move(accessed));
+        }
+    }
+
+    // Edges with the same action are potentially synchronized and change the variables of all participating automata at once.
+    for (auto& actionVariables : actionToWrittenVariables) {
+        interactions.addHyperedge(std::move(actionVariables.second));
+    }
+
+    return applyOrder(heuristic, interactions, declarationOrder);
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+// An enum that contains all heuristics that can be used to determine the order in which the DD builders create the meta variables of a model.
+enum class DdVariableOrderingHeuristic { Declaration, Force, Clustering };
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic);
+
+/*!
+ * Describes which variables of a model interact with each other. Variables are referred to by their position in the declaration order.
+ */
+class DdVariableInteractions {
+   public:
+    /*!
+     * Creates an object without interactions in which every variable forms a component of its own.
+     *
+     * @param numberOfVariables The number of variables.
+     */
+    DdVariableInteractions(uint64_t numberOfVariables);
+
+    /*!
+     * Assigns the given variable to the given component (e.g. the module or automaton declaring it). Variables of the same component are kept
+     * together by the clustering heuristic.
+     */
+    void setComponent(uint64_t variable, uint64_t component);
+
+    /*!
+     * Adds a set of variables that are accessed together, e.g. by a command or an edge. Duplicate entries are removed.
+     */
+    void addHyperedge(std::vector<uint64_t> variables);
+
+    uint64_t getNumberOfVariables() const;
+    std::vector<uint64_t> const& getComponents() const;
+    std::vector<std::vector<uint64_t>> const& getHyperedges() const;
+
+   private:
+    std::vector<uint64_t> variableToComponent;
+    std::vector<std::vector<uint64_t>> hyperedges;
+};
+
+/*!
+ * Computes an order of the variables with the given heuristic.
+ *
+ * - Declaration keeps the declaration order.
+ * - Force iteratively moves every variable to the average center of gravity of the hyperedges it belongs to (FORCE heuristic by Aloul et al.)
+ *   as long as the total span of the hyperedges decreases.
+ * - Clustering orders the components such that strongly communicating components are adjacent and keeps the variables of each component
+ *   together in declaration order.
+ *
+ * @return The positions (in declaration order) of the variables in the order in which they are to be created.
+ */
+std::vector<uint64_t> computeDdVariableOrder(DdVariableOrderingHeuristic const& heuristic, DdVariableInteractions const& interactions);
+
+/*!
+ * Orders the given state variables of the program with the given heuristic. Commands and synchronizing actions induce the interactions and the
+ * modules the components.
+ *
+ * @param declarationOrder The (non-transient) state variables in the order in which they would be created without reordering.
+ * @return The same variables in the order in which they are to be created.
+ */
+std::vector<storm::expressions::Variable> orderDdVariables(DdVariableOrderingHeuristic const& heuristic, storm::prism::Program const& program,
+                                                           std::vector<storm::expressions::Variable> const& declarationOrder);
+
+/*!
+ * Orders the given state variables of the model with the given heuristic. Edges and shared actions induce the interactions and the automata the
+ * components. The location variables of the automata are treated like all other variables.
+ *
+ * @param declarationOrder The (non-transient) state variables in the order in which they would be created without reordering.
+ * @return The same variables in the order in which they are to be created.
+ */
+std::vector<storm::expressions::Variable> orderDdVariables(DdVariableOrderingHeuristic const& heuristic, storm::jani::Model const& model,
+                                                           std::vector<storm::expressions::Variable> const& declarationOrder);
+
+}  // namespace builder
+}  // namespace storm
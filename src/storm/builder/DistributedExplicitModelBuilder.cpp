@@ -0,0 +1,228 @@
+#include "storm/builder/DistributedExplicitModelBuilder.h"
+
+#include <algorithm>
+#include <deque>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/sparse/StateStorage.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace detail {
+
+// Indices of the generator callback from this offset on refer to states owned by other members ("ghosts").
+uint32_t const GhostIndexOffset = 1u << 31;
+
+void appendState(storm::generator::CompressedState const& state, std::vector<uint64_t>& words) {
+    for (uint64_t bitIndex = 0; bitIndex < state.size(); bitIndex += 64) {
+        words.push_back(state.getAsInt(bitIndex, std::min<uint64_t>(64, state.size() - bitIndex)));
+    }
+}
+
+storm::generator::CompressedState readState(std::vector<uint64_t> const& words, uint64_t& position, uint64_t bitsPerState) {
+    storm::generator::CompressedState state(bitsPerState);
+    for (uint64_t bitIndex = 0; bitIndex < bitsPerState; bitIndex += 64) {
+        state.setFromInt(bitIndex, std::min<uint64_t>(64, bitsPerState - bitIndex), words[position++]);
+    }
+    return state;
+}
+
+storm::models::ModelType getModelType(storm::generator::ModelType const& type) {
+    switch (type) {
+        case storm::generator::ModelType::DTMC:
+            return storm::models::ModelType::Dtmc;
+        case storm::generator::ModelType::CTMC:
+            return storm::models::ModelType::Ctmc;
+        case storm::generator::ModelType::MDP:
+            return storm::models::ModelType::Mdp;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The distributed builder only supports DTMCs, CTMCs and MDPs.");
+    }
+}
+
+}  // namespace detail
+
+DistributedExplicitModelBuilder::DistributedExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> const& generator,
+                                                                 std::shared_ptr<storm::utility::Communicator> const& communicator, uint64_t batchSize)
+    : generator(generator), communicator(communicator), batchSize(std::max<uint64_t>(1, batchSize)) {
+    // Intentionally left empty.
+}
+
+DistributedExplicitModelBuilder::DistributedExplicitModelBuilder(storm::prism::Program const& program, storm::builder::BuilderOptions const& options,
+                                                                 std::shared_ptr<storm::utility::Communicator> const& communicator, uint64_t batchSize)
+    : DistributedExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<double, uint32_t>>(program, options), communicator,
+                                      batchSize) {
+    // Intentionally left empty.
+}
+
+DistributedExplicitModelBuilder::Result DistributedExplicitModelBuilder::build() {
+    Result result;
+    result.modelType = detail::getModelType(generator->getModelType());
+    bool deterministic = generator->isDeterministicModel();
+    bool fixDeadlocks = !storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+    uint64_t rank = communicator->getRank();
+    uint64_t size = communicator->getSize();
+    uint64_t bitsPerState = generator->getStateSize();
+    storm::storage::FNV1aBitVectorHash ownerHash;
+
+    // The owned states (numbered in the order of their discovery) and the states of other members that occur as successors.
+    storm::storage::sparse::StateStorage<uint32_t> ownStates(bitsPerState);
+    std::deque<std::pair<storm::generator::CompressedState, uint32_t>> statesToExplore;
+    storm::storage::BitVectorHashMap<uint32_t> ghostStates(bitsPerState, 1000);
+    std::vector<std::pair<uint64_t, uint64_t>> ghostOwnerAndIndex;
+
+    // The ghost states that still have to be sent to their owners.
+    std::vector<std::vector<uint64_t>> outgoingStates(size);
+    std::vector<std::vector<uint32_t>> outgoingGhosts(size);
+
+    auto addOwnState = [&](storm::generator::CompressedState const& state) {
+        uint32_t newIndex = static_cast<uint32_t>(ownStates.getNumberOfStates());
+        uint32_t index = ownStates.stateToId.findOrAdd(state, newIndex);
+        if (index == newIndex) {
+            STORM_LOG_THROW(newIndex < detail::GhostIndexOffset, storm::exceptions::NotSupportedException, "Too many states for a single member.");
+            statesToExplore.emplace_back(state, index);
+        }
+        return index;
+    };
+    auto stateToIdCallback = [&](storm::generator::CompressedState const& state) -> uint32_t {
+        uint64_t owner = ownerHash(state) % size;
+        if (owner == rank) {
+            return addOwnState(state);
+        }
+        uint32_t newGhost = static_cast<uint32_t>(ghostOwnerAndIndex.size());
+        uint32_t ghost = ghostStates.findOrAdd(state, newGhost);
+        if (ghost == newGhost) {
+            STORM_LOG_THROW(newGhost < detail::GhostIndexOffset, storm::exceptions::NotSupportedException, "Too many successors of other members.");
+            ghostOwnerAndIndex.emplace_back(owner, 0);
+            detail::appendState(state, outgoingStates[owner]);
+            outgoingGhosts[owner].push_back(ghost);
+        }
+        return detail::GhostIndexOffset + ghost;
+    };
+
+    // Every member enumerates all initial states, but only registers the ones it owns.
+    auto initialStateCallback = [&](storm::generator::CompressedState const& state) -> uint32_t {
+        return ownerHash(state) % size == rank ? addOwnState(state) : detail::GhostIndexOffset;
+    };
+    for (auto index : generator->getInitialStates(initialStateCallback)) {
+        if (index < detail::GhostIndexOffset) {
+            ownStates.initialStateIndices.push_back(index);
+        }
+    }
+    STORM_LOG_THROW(communicator->allReduceSum(static_cast<double>(ownStates.initialStateIndices.size())) > 0, storm::exceptions::WrongFormatException,
+                    "The model does not have an initial state.");
+
+    // The rows of the owned states, whose columns are indices of the callback (i.e., owned states or ghosts).
+    std::vector<uint64_t> rowGroupIndices = {0};
+    std::vector<uint64_t> rowIndications = {0};
+    std::vector<std::pair<uint32_t, double>> entries;
+
+    uint64_t numberOfRounds = 0;
+    while (true) {
+        for (uint64_t expanded = 0; expanded < batchSize && !statesToExplore.empty(); ++expanded) {
+            // The states are explored in the order of their indices, so the rows are added in this order, too.
+            storm::generator::CompressedState state = std::move(statesToExplore.front().first);
+            uint32_t index = statesToExplore.front().second;
+            statesToExplore.pop_front();
+            STORM_LOG_ASSERT(index == rowGroupIndices.size() - 1, "Unexpected exploration order.");
+
+            generator->load(state);
+            storm::generator::StateBehavior<double, uint32_t> behavior = generator->expand(stateToIdCallback);
+            if (behavior.empty()) {
+                STORM_LOG_THROW(fixDeadlocks || !behavior.wasExpanded(), storm::exceptions::WrongFormatException,
+                                "Found deadlock state (" << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+                if (behavior.wasExpanded()) {
+                    ownStates.deadlockStateIndices.push_back(index);
+                }
+                entries.emplace_back(index, 1.0);
+                rowIndications.push_back(entries.size());
+            } else {
+                for (auto const& choice : behavior) {
+                    for (auto const& stateProbabilityPair : choice) {
+                        entries.emplace_back(stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                    rowIndications.push_back(entries.size());
+                }
+            }
+            rowGroupIndices.push_back(rowIndications.size() - 1);
+        }
+
+        // Send the new ghosts to their owners, which reply with their indices.
+        std::vector<std::vector<uint64_t>> incomingStates = communicator->allToAll(outgoingStates);
+        std::vector<std::vector<uint64_t>> replies(size);
+        for (uint64_t sender = 0; sender < size; ++sender) {
+            uint64_t position = 0;
+            while (position < incomingStates[sender].size()) {
+                replies[sender].push_back(addOwnState(detail::readState(incomingStates[sender], position, bitsPerState)));
+            }
+        }
+        std::vector<std::vector<uint64_t>> incomingReplies = communicator->allToAll(replies);
+        for (uint64_t owner = 0; owner < size; ++owner) {
+            STORM_LOG_ASSERT(incomingReplies[owner].size() == outgoingGhosts[owner].size(), "Unexpected number of replies.");
+            for (uint64_t position = 0; position < outgoingGhosts[owner].size(); ++position) {
+                ghostOwnerAndIndex[outgoingGhosts[owner][position]].second = incomingReplies[owner][position];
+            }
+            outgoingStates[owner].clear();
+            outgoingGhosts[owner].clear();
+        }
+        ++numberOfRounds;
+
+        if (communicator->allReduceSum(static_cast<double>(statesToExplore.size())) == 0) {
+            break;
+        }
+    }
+
+    // Number the states of all members consecutively and replace the indices of the callback by the global indices.
+    uint64_t numberOfLocalStates = ownStates.getNumberOfStates();
+    std::vector<uint64_t> stateOffsets = {0};
+    for (auto memberStates : communicator->allGather(numberOfLocalStates)) {
+        stateOffsets.push_back(stateOffsets.back() + memberStates);
+    }
+    auto toGlobalIndex = [&](uint32_t index) -> uint64_t {
+        if (index < detail::GhostIndexOffset) {
+            return stateOffsets[rank] + index;
+        }
+        auto const& ownerAndIndex = ghostOwnerAndIndex[index - detail::GhostIndexOffset];
+        return stateOffsets[ownerAndIndex.first] + ownerAndIndex.second;
+    };
+
+    uint64_t numberOfRows = rowIndications.size() - 1;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfRows, stateOffsets.back(), entries.size(), true, !deterministic,
+                                                        deterministic ? 0 : numberOfLocalStates);
+    std::vector<std::pair<uint64_t, double>> rowEntries;
+    for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+        if (!deterministic) {
+            builder.newRowGroup(rowGroupIndices[state]);
+        }
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            rowEntries.clear();
+            for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                rowEntries.emplace_back(toGlobalIndex(entries[entry].first), entries[entry].second);
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(),
+                      [](std::pair<uint64_t, double> const& a, std::pair<uint64_t, double> const& b) { return a.first < b.first; });
+            for (auto const& entry : rowEntries) {
+                builder.addNextValue(row, entry.first, entry.second);
+            }
+        }
+    }
+    entries.clear();
+    entries.shrink_to_fit();
+    result.transitionMatrix = std::make_shared<storm::storage::DistributedSparseMatrix>(communicator, stateOffsets, builder.build());
+    result.stateLabeling = generator->label(ownStates, ownStates.initialStateIndices, ownStates.deadlockStateIndices);
+    STORM_LOG_INFO("Member " << rank << " explored " << numberOfLocalStates << " of " << stateOffsets.back() << " states in " << numberOfRounds
+                             << " rounds with a halo of " << result.transitionMatrix->getNumberOfHaloStates() << " states.");
+    return result;
+}
+
+}  // namespace builder
+}  // namespace storm
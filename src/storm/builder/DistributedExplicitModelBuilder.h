@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/models/ModelType.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/DistributedSparseMatrix.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/Communicator.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Explores the state space of a model on a group of processes. Every state is owned by the member given by the hash of the compressed state
+ * modulo the size of the group. Each member expands its own states with a local generator and sends the successors it does not own (at most once
+ * per state and member) in batches to their owners, which reply with their indices. Afterwards, the states of every member are numbered
+ * consecutively in the order of their discovery, which yields the partition of a DistributedSparseMatrix.
+ *
+ * Only DTMCs, CTMCs and MDPs are supported. Reward models, choice labels and state valuations are not built.
+ */
+class DistributedExplicitModelBuilder {
+   public:
+    struct Result {
+        storm::models::ModelType modelType;
+
+        // The rows of the owned states.
+        std::shared_ptr<storm::storage::DistributedSparseMatrix> transitionMatrix;
+
+        // The labeling of the owned states, including the labels "init" and "deadlock".
+        storm::models::sparse::StateLabeling stateLabeling;
+    };
+
+    /*!
+     * Creates a builder for the calling member of the group.
+     *
+     * @param generator The generator of the member. Every member needs its own generator for the same model.
+     * @param communicator The group of processes.
+     * @param batchSize The number of states that are expanded before the successors are sent to their owners.
+     */
+    DistributedExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> const& generator,
+                                    std::shared_ptr<storm::utility::Communicator> const& communicator, uint64_t batchSize = 65536);
+
+    /*!
+     * Creates a builder for the given PRISM program.
+     */
+    DistributedExplicitModelBuilder(storm::prism::Program const& program, storm::builder::BuilderOptions const& options,
+                                    std::shared_ptr<storm::utility::Communicator> const& communicator, uint64_t batchSize = 65536);
+
+    /*!
+     * Explores the state space. This is a collective operation.
+     */
+    Result build();
+
+   private:
+    std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> generator;
+    std::shared_ptr<storm::utility::Communicator> communicator;
+    uint64_t batchSize;
+};
+
+}  // namespace builder
+}  // namespace storm
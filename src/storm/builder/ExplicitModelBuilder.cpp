@@ -1,7 +1,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <limits>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/builder/RewardModelBuilder.h"
@@ -9,6 +13,7 @@
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -29,6 +34,7 @@
 #include "storm/storage/jani/ParallelComposition.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -38,6 +44,14 @@
 namespace storm {
 namespace builder {
 
+namespace detail {
+uint64_t getMaxFrontierStatesInMemory(ExplorationOrder explorationOrder, uint64_t maxFrontierStatesInMemory) {
+    STORM_LOG_WARN_COND(maxFrontierStatesInMemory == 0 || explorationOrder == ExplorationOrder::Bfs,
+                        "Writing unexplored states to disk requires breadth-first exploration. Keeping all unexplored states in memory.");
+    return explorationOrder == ExplorationOrder::Bfs ? maxFrontierStatesInMemory : 0;
+}
+}  // namespace detail
+
 template<typename StateType>
 StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const {
     auto cs = storm::generator::createCompressedState(this->varInfo, stateDescription, true);
@@ -55,14 +69,37 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-    // Intentionally left empty.
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      parallelExploration(storm::settings::getModule<storm::settings::modules::BuildSettings>().isParallelExplorationSet()),
+      treeCompression(storm::settings::getModule<storm::settings::modules::BuildSettings>().isTreeCompressionSet()),
+      maxFrontierStatesInMemory(0) {
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (buildSettings.isFrontierSpillSet()) {
+        maxFrontierStatesInMemory = buildSettings.getFrontierSpillStates();
+        frontierSpillDirectory = buildSettings.getFrontierSpillDirectory();
+    }
 }
 
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator),
+      options(options),
+      stateStorage(this->generator->getStateSize(), options.treeCompression),
+      statesToExplore(this->generator->getStateSize(), detail::getMaxFrontierStatesInMemory(options.explorationOrder, options.maxFrontierStatesInMemory),
+                      options.frontierSpillDirectory) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(GeneratorFactory const& generatorFactory, Options const& options)
+    : generator(generatorFactory()),
+      generatorFactory(generatorFactory),
+      options(options),
+      stateStorage(this->generator->getStateSize(), options.treeCompression),
+      statesToExplore(this->generator->getStateSize(), detail::getMaxFrontierStatesInMemory(options.explorationOrder, options.maxFrontierStatesInMemory),
+                      options.frontierSpillDirectory) {
     // Intentionally left empty.
 }
 
@@ -70,7 +107,11 @@ template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program,
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
-    : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
+    : ExplicitModelBuilder(
+          [program, generatorOptions]() {
+              return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+          },
+          builderOptions) {
     // Intentionally left empty.
 }
 
@@ -78,12 +119,15 @@ template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model,
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
-    : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
+    : ExplicitModelBuilder(
+          [model, generatorOptions]() { return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions); },
+          builderOptions) {
     // Intentionally left empty.
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::build() {
+    storm::utility::InstrumentationTimer instrumentationTimer("building.explicit");
     STORM_LOG_DEBUG("Exploration order is: " << options.explorationOrder);
 
     switch (generator->getModelType()) {
@@ -162,6 +206,21 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
                     "The model does not have a single initial state.");
 
+#ifdef STORM_HAVE_INTELTBB
+    bool exploreInParallel = options.parallelExploration && generatorFactory && options.explorationOrder == ExplorationOrder::Bfs &&
+                             !generator->getOptions().isPartialOrderReductionSet();
+    STORM_LOG_WARN_COND(!options.parallelExploration || exploreInParallel,
+                        "Parallel exploration requires bfs order, a builder that was not created from a single generator and no partial order reduction. "
+                        "Exploring sequentially.");
+#else
+    bool exploreInParallel = false;
+    STORM_LOG_WARN_COND(!options.parallelExploration, "Parallel exploration requires Intel TBB. Exploring sequentially.");
+#endif
+    if (exploreInParallel) {
+        buildMatricesParallel(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+        return;
+    }
+
     // Now explore the current state until there is no more reachable state.
     uint_fast64_t currentRowGroup = 0;
     uint_fast64_t currentRow = 0;
@@ -194,103 +253,8 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         }
         storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
 
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                }
-
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
-
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
-
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                    }
-                }
-
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                ++currentRow;
-                ++currentRowGroup;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-            }
-        } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
-            }
-
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
-
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
-                ++currentRow;
-                firstChoiceOfState = false;
-            }
-
-            ++currentRowGroup;
-        }
+        addBehavior(currentState, currentIndex, behavior, {}, currentRowGroup, currentRow, transitionMatrixBuilder, rewardModelBuilders,
+                    stateAndChoiceInformationBuilder);
 
         ++numberOfExploredStates;
         if (generator->getOptions().isShowProgressSet()) {
@@ -345,6 +309,247 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     }
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addBehavior(
+    CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+    std::vector<StateType> const& newStateIndices, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow,
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    // If there is no behavior, we might have to introduce a self-loop.
+    if (behavior.empty()) {
+        if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+            // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+            }
+
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
+
+            transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+
+            // This state shall be Markovian (to not introduce Zeno behavior)
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+            // Other state-based information does not need to be treated, in particular:
+            // * StateValuations have already been set above
+            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+            ++currentRow;
+            ++currentRowGroup;
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+        }
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
+            }
+            ++stateRewardIt;
+        }
+
+        // If the model is nondeterministic, we need to open a row group.
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+
+        // Now add all choices.
+        bool firstChoiceOfState = true;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                for (auto const& label : choice.getLabels()) {
+                    stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+
+            // Add the probabilistic behavior to the matrix.
+            if (newStateIndices.empty()) {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            } else {
+                // Replace the placeholders by the actual indices. As this changes the order of the entries, we need to sort them again.
+                std::vector<std::pair<StateType, ValueType>> entries;
+                entries.reserve(choice.size());
+                for (auto const& stateProbabilityPair : choice) {
+                    uint64_t placeholderOffset = getPlaceholderIndex(0) - stateProbabilityPair.first;
+                    entries.emplace_back(placeholderOffset < newStateIndices.size() ? newStateIndices[placeholderOffset] : stateProbabilityPair.first,
+                                         stateProbabilityPair.second);
+                }
+                std::sort(entries.begin(), entries.end(),
+                          [](std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                for (auto const& entry : entries) {
+                    transitionMatrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+                }
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                }
+                ++choiceRewardIt;
+            }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
+
+        ++currentRowGroup;
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getPlaceholderIndex(uint64_t offset) {
+    return std::numeric_limits<StateType>::max() - static_cast<StateType>(offset);
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesParallel(
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+#ifdef STORM_HAVE_INTELTBB
+    // The result of expanding a single state. New states are referred to by placeholder indices, the i-th new state (in the order in which the
+    // generator requested them) gets the placeholder with offset i.
+    struct Expansion {
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        std::vector<CompressedState> newStates;
+    };
+
+    // Each worker thread owns a generator. Creation is serialized as the generators share the expression manager of the input model.
+    std::mutex generatorCreationMutex;
+    tbb::enumerable_thread_specific<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators([&]() {
+        std::lock_guard<std::mutex> lock(generatorCreationMutex);
+        return generatorFactory();
+    });
+
+    uint_fast64_t currentRowGroup = 0;
+    uint_fast64_t currentRow = 0;
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+    uint64_t numberOfExploredStates = 0;
+
+    // States are taken from the queue in chunks of bounded size, so that the frontier may be kept on disk.
+    uint64_t const maxChunkSize = 1ull << 18;
+    std::vector<std::pair<CompressedState, StateType>> currentChunk;
+    std::vector<Expansion> expansions;
+    std::vector<StateType> newStateIndices;
+    while (!statesToExplore.empty()) {
+        currentChunk.clear();
+        while (!statesToExplore.empty() && currentChunk.size() < maxChunkSize) {
+            currentChunk.push_back(std::move(statesToExplore.front()));
+            statesToExplore.pop_front();
+        }
+        expansions.clear();
+        expansions.resize(currentChunk.size());
+
+        // Expand all states of the current chunk. During this phase, the state storage is only read.
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, currentChunk.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            auto& workerGenerator = workerGenerators.local();
+            for (uint64_t chunkIndex = range.begin(); chunkIndex < range.end(); ++chunkIndex) {
+                Expansion& expansion = expansions[chunkIndex];
+                std::unordered_map<CompressedState, StateType> placeholders;
+                std::function<StateType(CompressedState const&)> stateToIdCallback = [&](CompressedState const& state) {
+                    if (stateStorage.stateToId.contains(state)) {
+                        return stateStorage.stateToId.getValue(state);
+                    }
+                    auto placeholderIt = placeholders.find(state);
+                    if (placeholderIt != placeholders.end()) {
+                        return placeholderIt->second;
+                    }
+                    StateType placeholder = getPlaceholderIndex(expansion.newStates.size());
+                    placeholders.emplace(state, placeholder);
+                    expansion.newStates.push_back(state);
+                    return placeholder;
+                };
+                workerGenerator->load(currentChunk[chunkIndex].first);
+                expansion.behavior = workerGenerator->expand(stateToIdCallback);
+            }
+        });
+
+        // Assign the indices of the new states and add the behaviors in the order of the states. This yields the same indices as the sequential
+        // breadth-first exploration. The new states are appended to the exploration queue.
+        for (uint64_t chunkIndex = 0; chunkIndex < currentChunk.size(); ++chunkIndex) {
+            CompressedState const& currentState = currentChunk[chunkIndex].first;
+            StateType currentIndex = currentChunk[chunkIndex].second;
+            Expansion& expansion = expansions[chunkIndex];
+
+            newStateIndices.clear();
+            for (auto const& newState : expansion.newStates) {
+                newStateIndices.push_back(getOrAddStateIndex(newState));
+            }
+            STORM_LOG_THROW(stateStorage.getNumberOfStates() + expansion.newStates.size() <= getPlaceholderIndex(expansion.newStates.size()),
+                            storm::exceptions::WrongFormatException, "Too many states for parallel exploration with the current state index type.");
+
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                if (stateAndChoiceInformationBuilder.stateValuationsBuilder().isLazy()) {
+                    // Lazy valuations only store the compressed state, so there is no need to load it.
+                    stateAndChoiceInformationBuilder.stateValuationsBuilder().addCompressedState(currentIndex, currentState);
+                } else {
+                    generator->load(currentState);
+                    generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+                }
+            }
+            addBehavior(currentState, currentIndex, expansion.behavior, newStateIndices, currentRowGroup, currentRow, transitionMatrixBuilder,
+                        rewardModelBuilders, stateAndChoiceInformationBuilder);
+        }
+        numberOfExploredStates += currentChunk.size();
+
+        if (generator->getOptions().isShowProgressSet()) {
+            auto now = std::chrono::high_resolution_clock::now();
+            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+            if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (" << statesToExplore.size()
+                          << " states left to explore).\n";
+                timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    }
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel exploration requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
     // Determine whether we have to combine different choices to one or whether this model can have more than
@@ -353,6 +558,8 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
 
     // Prepare the component builders
     storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
+    // The number of transitions is not known before the exploration, so we collect them in chunks to avoid reallocations of the entry storage.
+    transitionMatrixBuilder.useChunkedEntryStorage(1ull << 20);
     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
     for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
         rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
@@ -418,7 +625,11 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
-    return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+    storm::models::sparse::StateLabeling result = generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+    if (generator->getOptions().isCompressStateLabelingSet()) {
+        result.compress();
+    }
+    return result;
 }
 
 // Explicitly instantiate the class.
@@ -6,7 +6,9 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -26,6 +28,7 @@
 #include "storm/utility/prism.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/ExplorationQueue.h"
 
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/NextStateGenerator.h"
@@ -46,7 +49,7 @@ class StateAndChoiceInformationBuilder;
 template<typename StateType>
 class ExplicitStateLookup {
    public:
-    ExplicitStateLookup(VariableInformation const& varInfo, storm::storage::BitVectorHashMap<StateType> const& stateToId)
+    ExplicitStateLookup(VariableInformation const& varInfo, storm::storage::sparse::StateToIdMap<StateType> const& stateToId)
         : varInfo(varInfo), stateToId(stateToId) {
         // intentionally left empty.
     }
@@ -64,7 +67,7 @@ class ExplicitStateLookup {
 
    private:
     VariableInformation varInfo;
-    storm::storage::BitVectorHashMap<StateType> stateToId;
+    storm::storage::sparse::StateToIdMap<StateType> stateToId;
 };
 
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>, typename StateType = uint32_t>
@@ -78,8 +81,22 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // Whether the state space is explored using multiple threads. This requires breadth-first exploration.
+        bool parallelExploration;
+
+        // Whether the explored states are stored tree-compressed, which reduces the memory consumption for states with many variables.
+        bool treeCompression;
+
+        // The maximal number of unexplored states that are kept in memory (zero means unbounded). Further unexplored states are written to
+        // temporary files in the given directory. This requires breadth-first exploration.
+        uint64_t maxFrontierStatesInMemory;
+        std::string frontierSpillDirectory;
     };
 
+    /// A factory creating fresh (independent) instances of the next-state generator.
+    typedef std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> GeneratorFactory;
+
     /*!
      * Creates an explicit model builder that uses the provided generator.
      *
@@ -87,6 +104,14 @@ class ExplicitModelBuilder {
      */
     ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options = Options());
 
+    /*!
+     * Creates an explicit model builder that uses generators obtained from the provided factory. In contrast to providing a single generator, this
+     * allows the builder to explore the state space with multiple threads, each of which owns a generator.
+     *
+     * @param generatorFactory The factory creating the generators. It is invoked once upon construction.
+     */
+    ExplicitModelBuilder(GeneratorFactory const& generatorFactory, Options const& options = Options());
+
     /*!
      * Creates an explicit model builder for the given PRISM program.
      *
@@ -144,6 +169,33 @@ class ExplicitModelBuilder {
                        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Explores the states in the exploration queue chunk by chunk. The states of a chunk are expanded in parallel, the resulting behaviors are
+     * added to the matrices sequentially in the order of the state indices. The result coincides with the one of the sequential breadth-first
+     * exploration.
+     */
+    void buildMatricesParallel(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                               std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                               StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+    /*!
+     * Adds the given behavior of the state with the given index to the matrices, the reward models and the state and choice information.
+     *
+     * @param newStateIndices If not empty, the transitions of the behavior may refer to placeholder indices of new states (see
+     * getPlaceholderIndex), which are replaced by the corresponding entries of this vector.
+     */
+    void addBehavior(CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                     std::vector<StateType> const& newStateIndices, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow,
+                     storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                     StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+    /*!
+     * Retrieves the placeholder index for the new state with the given offset during parallel exploration. Placeholder indices are taken from the
+     * top of the index range.
+     */
+    static StateType getPlaceholderIndex(uint64_t offset);
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -161,6 +213,9 @@ class ExplicitModelBuilder {
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// If given, a factory for additional generators that is used for parallel exploration.
+    GeneratorFactory generatorFactory;
+
     /// The options to be used for the building process.
     Options options;
 
@@ -168,7 +223,7 @@ class ExplicitModelBuilder {
     storm::storage::sparse::StateStorage<StateType> stateStorage;
 
     /// A set of states that still need to be explored.
-    std::deque<std::pair<CompressedState, StateType>> statesToExplore;
+    ExplorationQueue<StateType> statesToExplore;
 
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
@@ -0,0 +1,168 @@
+#include "storm/builder/ExplorationQueue.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace detail {
+// States are stored as the XOR with the previously stored state, encoded as a sequence of variable-length integers (7 bits per byte). As
+// consecutive states in the frontier typically differ in few variables, most words are encoded by a single (zero) byte.
+inline void writeVarInt(std::vector<char>& buffer, uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+inline uint64_t readVarInt(std::istream& in) {
+    uint64_t result = 0;
+    uint64_t shift = 0;
+    char byte;
+    do {
+        in.get(byte);
+        STORM_LOG_THROW(in, storm::exceptions::FileIoException, "Unexpected end of temporary exploration file.");
+        result |= static_cast<uint64_t>(static_cast<unsigned char>(byte) & 0x7F) << shift;
+        shift += 7;
+    } while (static_cast<unsigned char>(byte) & 0x80);
+    return result;
+}
+}  // namespace detail
+
+template<typename StateType>
+ExplorationQueue<StateType>::ExplorationQueue(uint64_t bitsPerState, uint64_t maxStatesInMemory, std::string const& spillDirectory)
+    : bitsPerState(bitsPerState), maxStatesInMemory(maxStatesInMemory), spillDirectory(spillDirectory), statesInFiles(0), numberOfWrittenFiles(0) {
+    if (this->spillDirectory.empty()) {
+        char const* temporaryDirectory = std::getenv("TMPDIR");
+        this->spillDirectory = temporaryDirectory == nullptr ? "/tmp" : temporaryDirectory;
+    }
+}
+
+template<typename StateType>
+ExplorationQueue<StateType>::~ExplorationQueue() {
+    for (auto const& file : files) {
+        std::remove(file.first.c_str());
+    }
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::emplace_front(storm::generator::CompressedState const& state, StateType const& index) {
+    STORM_LOG_ASSERT(maxStatesInMemory == 0, "Adding states at the front is not supported if states are written to disk.");
+    head.emplace_front(state, index);
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::emplace_back(storm::generator::CompressedState const& state, StateType const& index) {
+    if (files.empty() && tail.empty() && (maxStatesInMemory == 0 || head.size() < maxStatesInMemory / 2)) {
+        // As long as nothing is on disk, we can directly append to the head.
+        head.emplace_back(state, index);
+    } else {
+        tail.emplace_back(state, index);
+        if (tail.size() >= maxStatesInMemory / 2) {
+            spill();
+        }
+    }
+}
+
+template<typename StateType>
+std::pair<storm::generator::CompressedState, StateType>& ExplorationQueue<StateType>::front() {
+    loadFront();
+    return head.front();
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::pop_front() {
+    loadFront();
+    head.pop_front();
+}
+
+template<typename StateType>
+bool ExplorationQueue<StateType>::empty() const {
+    return head.empty() && files.empty() && tail.empty();
+}
+
+template<typename StateType>
+uint64_t ExplorationQueue<StateType>::size() const {
+    return head.size() + statesInFiles + tail.size();
+}
+
+template<typename StateType>
+uint64_t ExplorationQueue<StateType>::getNumberOfWrittenFiles() const {
+    return numberOfWrittenFiles;
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::spill() {
+    std::string fileName = spillDirectory + "/storm-exploration-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "-" +
+                           std::to_string(reinterpret_cast<uintptr_t>(this)) + "-" + std::to_string(numberOfWrittenFiles) + ".bin";
+    std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Could not create temporary exploration file " << fileName << ".");
+
+    uint64_t numberOfWords = (bitsPerState + 63) / 64;
+    std::vector<uint64_t> previousWords(numberOfWords, 0);
+    std::vector<char> buffer;
+    for (auto const& stateIndexPair : tail) {
+        buffer.clear();
+        detail::writeVarInt(buffer, stateIndexPair.second);
+        for (uint64_t word = 0; word < numberOfWords; ++word) {
+            uint64_t value = stateIndexPair.first.getAsInt(word * 64, std::min<uint64_t>(64, bitsPerState - word * 64));
+            detail::writeVarInt(buffer, value ^ previousWords[word]);
+            previousWords[word] = value;
+        }
+        out.write(buffer.data(), buffer.size());
+    }
+    out.close();
+    STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Could not write temporary exploration file " << fileName << ".");
+    STORM_LOG_TRACE("Wrote " << tail.size() << " states of the exploration queue to " << fileName << ".");
+
+    files.emplace_back(fileName, tail.size());
+    statesInFiles += tail.size();
+    ++numberOfWrittenFiles;
+    tail.clear();
+    tail.shrink_to_fit();
+}
+
+template<typename StateType>
+void ExplorationQueue<StateType>::loadFront() {
+    if (!head.empty()) {
+        return;
+    }
+    if (files.empty()) {
+        // All remaining states are in the tail.
+        head.insert(head.end(), std::make_move_iterator(tail.begin()), std::make_move_iterator(tail.end()));
+        tail.clear();
+        return;
+    }
+
+    std::string fileName = files.front().first;
+    uint64_t numberOfStates = files.front().second;
+    files.pop_front();
+    statesInFiles -= numberOfStates;
+
+    std::ifstream in(fileName, std::ios::binary);
+    STORM_LOG_THROW(in, storm::exceptions::FileIoException, "Could not open temporary exploration file " << fileName << ".");
+    uint64_t numberOfWords = (bitsPerState + 63) / 64;
+    std::vector<uint64_t> previousWords(numberOfWords, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        StateType index = static_cast<StateType>(detail::readVarInt(in));
+        storm::generator::CompressedState compressedState(bitsPerState);
+        for (uint64_t word = 0; word < numberOfWords; ++word) {
+            previousWords[word] ^= detail::readVarInt(in);
+            compressedState.setFromInt(word * 64, std::min<uint64_t>(64, bitsPerState - word * 64), previousWords[word]);
+        }
+        head.emplace_back(std::move(compressedState), index);
+    }
+    in.close();
+    std::remove(fileName.c_str());
+}
+
+template class ExplorationQueue<uint32_t>;
+}  // namespace builder
+}  // namespace storm
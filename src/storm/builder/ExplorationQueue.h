@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * The queue of states that still need to be explored by the explicit model builder. If a maximal number of states in memory is given, the queue
+ * writes the most recently added states to (compressed) temporary files once this number is exceeded and streams them back when they are
+ * about to be explored. This keeps the memory consumption of the frontier bounded for breadth-first exploration, where the queue can get large.
+ * Spilling is only supported if states are added at the back of the queue.
+ */
+template<typename StateType>
+class ExplorationQueue {
+   public:
+    /*!
+     * Creates an empty queue.
+     *
+     * @param bitsPerState The number of bits of the states.
+     * @param maxStatesInMemory The maximal number of states that are kept in memory. Zero means that states are never written to disk.
+     * @param spillDirectory The directory in which the temporary files are created. If empty, the directory given by the environment variable
+     * TMPDIR (or /tmp) is used.
+     */
+    ExplorationQueue(uint64_t bitsPerState, uint64_t maxStatesInMemory = 0, std::string const& spillDirectory = "");
+
+    ExplorationQueue(ExplorationQueue const& other) = delete;
+    ExplorationQueue& operator=(ExplorationQueue const& other) = delete;
+    ExplorationQueue(ExplorationQueue&& other) = default;
+    ExplorationQueue& operator=(ExplorationQueue&& other) = default;
+
+    /*!
+     * Removes the temporary files that have not been read (yet).
+     */
+    ~ExplorationQueue();
+
+    /*!
+     * Adds the given state to the front of the queue. This must not be used if the queue may spill states to disk.
+     */
+    void emplace_front(storm::generator::CompressedState const& state, StateType const& index);
+
+    /*!
+     * Adds the given state to the back of the queue.
+     */
+    void emplace_back(storm::generator::CompressedState const& state, StateType const& index);
+
+    /*!
+     * Retrieves the first state of the queue, which must not be empty.
+     */
+    std::pair<storm::generator::CompressedState, StateType>& front();
+
+    /*!
+     * Removes the first state of the queue, which must not be empty.
+     */
+    void pop_front();
+
+    bool empty() const;
+
+    /*!
+     * Retrieves the number of states in the queue (including the ones stored on disk).
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of temporary files that have been written so far.
+     */
+    uint64_t getNumberOfWrittenFiles() const;
+
+   private:
+    /*!
+     * Writes the states at the back of the queue to a new temporary file.
+     */
+    void spill();
+
+    /*!
+     * Makes sure that the first state of the queue is in memory, if the queue is not empty.
+     */
+    void loadFront();
+
+    // The number of bits of the states.
+    uint64_t bitsPerState;
+
+    // The maximal number of states in memory (zero if states are never written to disk).
+    uint64_t maxStatesInMemory;
+
+    // The directory for temporary files.
+    std::string spillDirectory;
+
+    // The states at the front of the queue, which are explored next.
+    std::deque<std::pair<storm::generator::CompressedState, StateType>> head;
+
+    // The temporary files holding the states between head and tail (oldest first) together with the number of states in the respective files.
+    std::deque<std::pair<std::string, uint64_t>> files;
+
+    // The states that were most recently added to the back of the queue.
+    std::vector<std::pair<storm::generator::CompressedState, StateType>> tail;
+
+    // The number of states that are currently stored in files.
+    uint64_t statesInFiles;
+
+    // The number of files written so far (used to create unique file names).
+    uint64_t numberOfWrittenFiles;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -165,6 +165,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuild
 template class ParallelCompositionBuilder<double>;
 
 #ifdef STORM_HAVE_CARL
+template class ParallelCompositionBuilder<storm::RationalNumber>;
 template class ParallelCompositionBuilder<storm::RationalFunction>;
 #endif
 
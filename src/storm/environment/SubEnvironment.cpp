@@ -13,37 +13,49 @@ SubEnvironment<EnvironmentType>::SubEnvironment() : subEnv(nullptr) {
 }
 
 template<typename EnvironmentType>
-SubEnvironment<EnvironmentType>::SubEnvironment(SubEnvironment const& other) : subEnv(other.subEnv ? new EnvironmentType(*other.subEnv) : nullptr) {
-    // Intentionally left empty
+SubEnvironment<EnvironmentType>::SubEnvironment(SubEnvironment const& other) : subEnv(nullptr) {
+    EnvironmentType const* otherEnv = other.subEnv.load(std::memory_order_acquire);
+    if (otherEnv) {
+        subEnv.store(new EnvironmentType(*otherEnv), std::memory_order_release);
+    }
 }
 
 template<typename EnvironmentType>
 SubEnvironment<EnvironmentType>& SubEnvironment<EnvironmentType>::operator=(SubEnvironment const& other) {
-    if (other.subEnv) {
-        subEnv = std::make_unique<EnvironmentType>(*other.subEnv);
-    } else {
-        subEnv.reset();
+    if (this != &other) {
+        EnvironmentType const* otherEnv = other.subEnv.load(std::memory_order_acquire);
+        std::unique_ptr<EnvironmentType> newEnv(otherEnv ? new EnvironmentType(*otherEnv) : nullptr);
+        delete subEnv.exchange(newEnv.release(), std::memory_order_acq_rel);
     }
     return *this;
 }
 
+template<typename EnvironmentType>
+SubEnvironment<EnvironmentType>::~SubEnvironment() {
+    delete subEnv.load(std::memory_order_acquire);
+}
+
 template<typename EnvironmentType>
 EnvironmentType const& SubEnvironment<EnvironmentType>::get() const {
-    assertInitialized();
-    return *subEnv;
+    return *assertInitialized();
 }
 
 template<typename EnvironmentType>
 EnvironmentType& SubEnvironment<EnvironmentType>::get() {
-    assertInitialized();
-    return *subEnv;
+    return *assertInitialized();
 }
 
 template<typename EnvironmentType>
-void SubEnvironment<EnvironmentType>::assertInitialized() const {
-    if (!subEnv) {
-        subEnv = std::make_unique<EnvironmentType>();
+EnvironmentType* SubEnvironment<EnvironmentType>::assertInitialized() const {
+    EnvironmentType* env = subEnv.load(std::memory_order_acquire);
+    if (!env) {
+        // If several threads create the sub-environment at the same time, only the first one is kept.
+        auto newEnv = std::make_unique<EnvironmentType>();
+        if (subEnv.compare_exchange_strong(env, newEnv.get(), std::memory_order_acq_rel)) {
+            env = newEnv.release();
+        }
     }
+    return env;
 }
 
 template class SubEnvironment<InternalEnvironment>;
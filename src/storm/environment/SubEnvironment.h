@@ -1,20 +1,26 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 namespace storm {
 
+/*!
+ * Holds a sub-environment that is only created (from the current settings) when it is accessed for the first time. The creation may happen
+ * concurrently, such that an environment can be shared read-only between threads.
+ */
 template<typename EnvironmentType>
 class SubEnvironment {
    public:
     SubEnvironment();
     SubEnvironment(SubEnvironment const& other);
     SubEnvironment<EnvironmentType>& operator=(SubEnvironment const& other);
+    ~SubEnvironment();
     EnvironmentType const& get() const;
     EnvironmentType& get();
 
    private:
-    void assertInitialized() const;
-    mutable std::unique_ptr<EnvironmentType> subEnv;
+    EnvironmentType* assertInitialized() const;
+    mutable std::atomic<EnvironmentType*> subEnv;
 };
 }  // namespace storm
@@ -1,6 +1,7 @@
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/modelchecker/propositional/StateFormulaCache.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ModelCheckerSettings.h"
@@ -13,9 +14,13 @@ namespace storm {
 
 ModelCheckerEnvironment::ModelCheckerEnvironment() {
     auto const& mcSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+    conditionalDirect = mcSettings.isConditionalDirectSet();
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    if (mcSettings.isLtl2daCacheDirectorySet()) {
+        ltl2daCacheDirectory = mcSettings.getLtl2daCacheDirectory();
+    }
 }
 
 ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -46,4 +51,36 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isLtl2daCacheDirectorySet() const {
+    return ltl2daCacheDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getLtl2daCacheDirectory() const {
+    return ltl2daCacheDirectory.get();
+}
+
+void ModelCheckerEnvironment::setLtl2daCacheDirectory(std::string const& value) {
+    ltl2daCacheDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetLtl2daCacheDirectory() {
+    ltl2daCacheDirectory = boost::none;
+}
+
+bool ModelCheckerEnvironment::isConditionalDirectSet() const {
+    return conditionalDirect;
+}
+
+void ModelCheckerEnvironment::setConditionalDirect(bool value) {
+    conditionalDirect = value;
+}
+
+std::shared_ptr<storm::modelchecker::StateFormulaCache> const& ModelCheckerEnvironment::getStateFormulaCache() const {
+    return stateFormulaCache;
+}
+
+void ModelCheckerEnvironment::setStateFormulaCache(std::shared_ptr<storm::modelchecker::StateFormulaCache> const& value) {
+    stateFormulaCache = value;
+}
+
 }  // namespace storm
@@ -12,6 +12,10 @@ namespace storm {
 // Forward declare subenvironments
 class MultiObjectiveModelCheckerEnvironment;
 
+namespace modelchecker {
+class StateFormulaCache;
+}
+
 class ModelCheckerEnvironment {
    public:
     ModelCheckerEnvironment();
@@ -25,8 +29,28 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    bool isLtl2daCacheDirectorySet() const;
+    std::string const& getLtl2daCacheDirectory() const;
+    void setLtl2daCacheDirectory(std::string const& value);
+    void unsetLtl2daCacheDirectory();
+
+    /*!
+     * Whether conditional probabilities in MDPs are computed directly on the original model (instead of on the transformed restart model).
+     */
+    bool isConditionalDirectSet() const;
+    void setConditionalDirect(bool value);
+
+    /*!
+     * Retrieves the cache for the results of state formulas (or null if there is none). Copies of the environment share the cache.
+     */
+    std::shared_ptr<storm::modelchecker::StateFormulaCache> const& getStateFormulaCache() const;
+    void setStateFormulaCache(std::shared_ptr<storm::modelchecker::StateFormulaCache> const& value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    boost::optional<std::string> ltl2daCacheDirectory;
+    bool conditionalDirect;
+    std::shared_ptr<storm::modelchecker::StateFormulaCache> stateFormulaCache;
 };
 }  // namespace storm
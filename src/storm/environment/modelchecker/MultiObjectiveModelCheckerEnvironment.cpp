@@ -37,6 +37,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
     if (multiobjectiveSettings.isMaxStepsSet()) {
         maxSteps = multiobjectiveSettings.getMaxSteps();
     }
+    weightVectorBatchSize = multiobjectiveSettings.getWeightVectorBatchSize();
     if (multiobjectiveSettings.hasSchedulerRestriction()) {
         schedulerRestriction = multiobjectiveSettings.getSchedulerRestriction();
     }
@@ -137,6 +138,15 @@ void MultiObjectiveModelCheckerEnvironment::unsetMaxSteps() {
     maxSteps = boost::none;
 }
 
+uint64_t const& MultiObjectiveModelCheckerEnvironment::getWeightVectorBatchSize() const {
+    return weightVectorBatchSize;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setWeightVectorBatchSize(uint64_t const& value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The weight vector batch size must be positive.");
+    weightVectorBatchSize = value;
+}
+
 bool MultiObjectiveModelCheckerEnvironment::isSchedulerRestrictionSet() const {
     return schedulerRestriction.is_initialized();
 }
@@ -1,5 +1,8 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/utility/constants.h"
@@ -25,6 +28,11 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    mixedPrecision = minMaxSettings.isMixedPrecisionSet();
+    ddQuantizationBits = minMaxSettings.getDdQuantizationBits();
+    policyEvaluationSweeps = minMaxSettings.getPolicyEvaluationSweeps();
+    policyImprovementThreads = minMaxSettings.getPolicyImprovementThreads();
+    portfolioMethods = minMaxSettings.getPortfolioMethods();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -44,6 +52,33 @@ void MinMaxSolverEnvironment::setMethod(storm::solver::MinMaxMethod value, bool
     minMaxMethod = value;
 }
 
+bool MinMaxSolverEnvironment::isRaceMethodSet() const {
+    return raceMethod.is_initialized();
+}
+
+storm::solver::MinMaxMethod const& MinMaxSolverEnvironment::getRaceMethod() const {
+    STORM_LOG_ASSERT(raceMethod, "No race method was set.");
+    return raceMethod.get();
+}
+
+void MinMaxSolverEnvironment::setRaceMethod(storm::solver::MinMaxMethod value) {
+    raceMethod = value;
+}
+
+void MinMaxSolverEnvironment::unsetRaceMethod() {
+    raceMethod = boost::none;
+}
+
+std::vector<storm::solver::MinMaxMethod> const& MinMaxSolverEnvironment::getPortfolioMethods() const {
+    return portfolioMethods;
+}
+
+void MinMaxSolverEnvironment::setPortfolioMethods(std::vector<storm::solver::MinMaxMethod> const& value) {
+    STORM_LOG_ASSERT(std::find(value.begin(), value.end(), storm::solver::MinMaxMethod::Portfolio) == value.end(),
+                     "The portfolio method can not be part of a portfolio.");
+    portfolioMethods = value;
+}
+
 uint64_t const& MinMaxSolverEnvironment::getMaximalNumberOfIterations() const {
     return maxIterationCount;
 }
@@ -84,4 +119,37 @@ void MinMaxSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+bool MinMaxSolverEnvironment::isMixedPrecisionSet() const {
+    return mixedPrecision;
+}
+
+void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
+uint64_t const& MinMaxSolverEnvironment::getDdQuantizationBits() const {
+    return ddQuantizationBits;
+}
+
+void MinMaxSolverEnvironment::setDdQuantizationBits(uint64_t value) {
+    ddQuantizationBits = value;
+}
+
+uint64_t const& MinMaxSolverEnvironment::getPolicyEvaluationSweeps() const {
+    return policyEvaluationSweeps;
+}
+
+void MinMaxSolverEnvironment::setPolicyEvaluationSweeps(uint64_t value) {
+    policyEvaluationSweeps = value;
+}
+
+uint64_t const& MinMaxSolverEnvironment::getPolicyImprovementThreads() const {
+    return policyImprovementThreads;
+}
+
+void MinMaxSolverEnvironment::setPolicyImprovementThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "At least one thread is required.");
+    policyImprovementThreads = value;
+}
+
 }  // namespace storm
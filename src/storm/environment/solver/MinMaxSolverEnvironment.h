@@ -1,5 +1,8 @@
 #pragma once
 
+#include <boost/optional.hpp>
+#include <vector>
+
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -16,6 +19,12 @@ class MinMaxSolverEnvironment {
     storm::solver::MinMaxMethod const& getMethod() const;
     bool const& isMethodSetFromDefault() const;
     void setMethod(storm::solver::MinMaxMethod value, bool isSetFromDefault = false);
+    bool isRaceMethodSet() const;
+    storm::solver::MinMaxMethod const& getRaceMethod() const;
+    void setRaceMethod(storm::solver::MinMaxMethod value);
+    void unsetRaceMethod();
+    std::vector<storm::solver::MinMaxMethod> const& getPortfolioMethods() const;
+    void setPortfolioMethods(std::vector<storm::solver::MinMaxMethod> const& value);
     uint64_t const& getMaximalNumberOfIterations() const;
     void setMaximalNumberOfIterations(uint64_t value);
     storm::RationalNumber const& getPrecision() const;
@@ -26,14 +35,28 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    bool isMixedPrecisionSet() const;
+    void setMixedPrecision(bool value);
+    uint64_t const& getDdQuantizationBits() const;
+    void setDdQuantizationBits(uint64_t value);
+    uint64_t const& getPolicyEvaluationSweeps() const;
+    void setPolicyEvaluationSweeps(uint64_t value);
+    uint64_t const& getPolicyImprovementThreads() const;
+    void setPolicyImprovementThreads(uint64_t value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
     bool methodSetFromDefault;
+    boost::optional<storm::solver::MinMaxMethod> raceMethod;
+    std::vector<storm::solver::MinMaxMethod> portfolioMethods;
     uint64_t maxIterationCount;
     storm::RationalNumber precision;
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool symmetricUpdates;
+    bool mixedPrecision;
+    uint64_t ddQuantizationBits;
+    uint64_t policyEvaluationSweeps;
+    uint64_t policyImprovementThreads;
 };
 }  // namespace storm
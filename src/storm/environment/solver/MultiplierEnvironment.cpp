@@ -11,6 +11,9 @@ MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    soaLayout = multiplierSettings.isSoaLayoutSet();
+    parallelGaussSeidel = multiplierSettings.isParallelGaussSeidelSet();
+    numaAware = multiplierSettings.isNumaAwareSet();
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +33,28 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+bool MultiplierEnvironment::isSoaLayoutSet() const {
+    return soaLayout;
+}
+
+void MultiplierEnvironment::setSoaLayout(bool value) {
+    soaLayout = value;
+}
+
+bool MultiplierEnvironment::isParallelGaussSeidelSet() const {
+    return parallelGaussSeidel;
+}
+
+void MultiplierEnvironment::setParallelGaussSeidel(bool value) {
+    parallelGaussSeidel = value;
+}
+
+bool MultiplierEnvironment::isNumaAwareSet() const {
+    return numaAware;
+}
+
+void MultiplierEnvironment::setNumaAware(bool value) {
+    numaAware = value;
+}
+
 }  // namespace storm
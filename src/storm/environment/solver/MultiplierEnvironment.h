@@ -13,9 +13,18 @@ class MultiplierEnvironment {
     storm::solver::MultiplierType const& getType() const;
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
+    bool isSoaLayoutSet() const;
+    void setSoaLayout(bool value);
+    bool isParallelGaussSeidelSet() const;
+    void setParallelGaussSeidel(bool value);
+    bool isNumaAwareSet() const;
+    void setNumaAware(bool value);
 
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    bool soaLayout;
+    bool parallelGaussSeidel;
+    bool numaAware;
 };
 }  // namespace storm
@@ -26,6 +26,10 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    mixedPrecision = nativeSettings.isMixedPrecisionSet();
+    ddQuantizationBits = nativeSettings.getDdQuantizationBits();
+    preconditioner = nativeSettings.getPreconditioningMethod();
+    restartThreshold = nativeSettings.getRestartIterationCount();
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +97,36 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+bool NativeSolverEnvironment::isMixedPrecisionSet() const {
+    return mixedPrecision;
+}
+
+void NativeSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
+uint64_t const& NativeSolverEnvironment::getDdQuantizationBits() const {
+    return ddQuantizationBits;
+}
+
+void NativeSolverEnvironment::setDdQuantizationBits(uint64_t value) {
+    ddQuantizationBits = value;
+}
+
+storm::solver::NativeLinearEquationSolverPreconditioner const& NativeSolverEnvironment::getPreconditioner() const {
+    return preconditioner;
+}
+
+void NativeSolverEnvironment::setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value) {
+    preconditioner = value;
+}
+
+uint64_t const& NativeSolverEnvironment::getRestartThreshold() const {
+    return restartThreshold;
+}
+
+void NativeSolverEnvironment::setRestartThreshold(uint64_t value) {
+    restartThreshold = value;
+}
+
 }  // namespace storm
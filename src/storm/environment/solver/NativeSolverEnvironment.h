@@ -28,6 +28,14 @@ class NativeSolverEnvironment {
     void setSorOmega(storm::RationalNumber const& value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    bool isMixedPrecisionSet() const;
+    void setMixedPrecision(bool value);
+    uint64_t const& getDdQuantizationBits() const;
+    void setDdQuantizationBits(uint64_t value);
+    storm::solver::NativeLinearEquationSolverPreconditioner const& getPreconditioner() const;
+    void setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value);
+    uint64_t const& getRestartThreshold() const;
+    void setRestartThreshold(uint64_t value);
 
    private:
     storm::solver::NativeLinearEquationSolverMethod method;
@@ -38,5 +46,9 @@ class NativeSolverEnvironment {
     storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
     storm::RationalNumber sorOmega;
     bool symmetricUpdates;
+    bool mixedPrecision;
+    uint64_t ddQuantizationBits;
+    storm::solver::NativeLinearEquationSolverPreconditioner preconditioner;
+    uint64_t restartThreshold;
 };
 }  // namespace storm
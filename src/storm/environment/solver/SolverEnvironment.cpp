@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/solver/SolverWorkspace.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -178,4 +179,13 @@ void SolverEnvironment::setLinearEquationSolverPrecision(boost::optional<storm::
         // gmm, eigen, elimination, and topological solvers do not have a precision
     }
 }
+
+std::shared_ptr<storm::solver::SolverWorkspace> const& SolverEnvironment::getWorkspace() const {
+    return workspace;
+}
+
+void SolverEnvironment::setWorkspace(std::shared_ptr<storm::solver::SolverWorkspace> const& value) {
+    workspace = value;
+}
+
 }  // namespace storm
@@ -10,6 +10,10 @@
 
 namespace storm {
 
+namespace solver {
+class SolverWorkspace;
+}
+
 // Forward declare subenvironments
 class EigenSolverEnvironment;
 class GmmxxSolverEnvironment;
@@ -62,6 +66,13 @@ class SolverEnvironment {
     void setLinearEquationSolverPrecision(boost::optional<storm::RationalNumber> const& newPrecision,
                                           boost::optional<bool> const& relativePrecision = boost::none);
 
+    /*!
+     * Retrieves the workspace from which solvers obtain their auxiliary vectors (or null if each solver allocates its own vectors).
+     * Copies of this environment share the workspace.
+     */
+    std::shared_ptr<storm::solver::SolverWorkspace> const& getWorkspace() const;
+    void setWorkspace(std::shared_ptr<storm::solver::SolverWorkspace> const& value);
+
    private:
     SubEnvironment<EigenSolverEnvironment> eigenSolverEnvironment;
     SubEnvironment<GmmxxSolverEnvironment> gmmxxSolverEnvironment;
@@ -78,5 +89,6 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    std::shared_ptr<storm::solver::SolverWorkspace> workspace;
 };
 }  // namespace storm
@@ -14,6 +14,8 @@ TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
     precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
     relative = tbSettings.isRelativePrecision();
     unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+    adaptiveUniformization = tbSettings.isAdaptiveUniformizationSet();
+    steadyStateDetection = tbSettings.isSteadyStateDetectionSet();
 }
 
 TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -57,4 +59,20 @@ void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value)
     unifPlusKappa = value;
 }
 
+bool const& TimeBoundedSolverEnvironment::isAdaptiveUniformizationSet() const {
+    return adaptiveUniformization;
+}
+
+void TimeBoundedSolverEnvironment::setAdaptiveUniformization(bool value) {
+    adaptiveUniformization = value;
+}
+
+bool const& TimeBoundedSolverEnvironment::isSteadyStateDetectionSet() const {
+    return steadyStateDetection;
+}
+
+void TimeBoundedSolverEnvironment::setSteadyStateDetection(bool value) {
+    steadyStateDetection = value;
+}
+
 }  // namespace storm
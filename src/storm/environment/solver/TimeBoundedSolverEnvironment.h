@@ -24,6 +24,11 @@ class TimeBoundedSolverEnvironment {
     storm::RationalNumber const& getUnifPlusKappa() const;
     void setUnifPlusKappa(storm::RationalNumber value);
 
+    bool const& isAdaptiveUniformizationSet() const;
+    void setAdaptiveUniformization(bool value);
+    bool const& isSteadyStateDetectionSet() const;
+    void setSteadyStateDetection(bool value);
+
    private:
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
@@ -32,5 +37,8 @@ class TimeBoundedSolverEnvironment {
     bool relative;
 
     storm::RationalNumber unifPlusKappa;
+
+    bool adaptiveUniformization;
+    bool steadyStateDetection;
 };
 }  // namespace storm
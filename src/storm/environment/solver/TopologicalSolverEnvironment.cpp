@@ -15,6 +15,8 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    parallelSccSolving = topologicalSettings.isParallelSet();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +53,12 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+bool TopologicalSolverEnvironment::isParallelSccSolvingSet() const {
+    return parallelSccSolving;
+}
+
+void TopologicalSolverEnvironment::setParallelSccSolving(bool value) {
+    parallelSccSolving = value;
+}
+
 }  // namespace storm
@@ -19,11 +19,16 @@ class TopologicalSolverEnvironment {
     bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
     void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
 
+    bool isParallelSccSolvingSet() const;
+    void setParallelSccSolving(bool value);
+
    private:
     storm::solver::EquationSolverType underlyingEquationSolverType;
     bool underlyingEquationSolverTypeSetFromDefault;
 
     storm::solver::MinMaxMethod underlyingMinMaxMethod;
     bool underlyingMinMaxMethodSetFromDefault;
+
+    bool parallelSccSolving;
 };
 }  // namespace storm
@@ -0,0 +1,320 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+int_fast64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+    int_fast64_t* top = stack.data() - 1;
+    uint64_t programCounter = 0;
+    uint64_t const numberOfInstructions = instructions.size();
+    while (programCounter < numberOfInstructions) {
+        Instruction const& instruction = instructions[programCounter];
+        ++programCounter;
+        switch (instruction.opCode) {
+            case OpCode::Constant:
+                *(++top) = instruction.value;
+                break;
+            case OpCode::LoadBoolean:
+                *(++top) = state.get(instruction.bitOffset) ? 1 : 0;
+                break;
+            case OpCode::LoadInteger:
+                *(++top) = static_cast<int_fast64_t>(state.getAsInt(instruction.bitOffset, instruction.bitWidth)) + instruction.value;
+                break;
+            case OpCode::Not:
+                *top = *top ? 0 : 1;
+                break;
+            case OpCode::Negate:
+                *top = -*top;
+                break;
+            case OpCode::And:
+                --top;
+                *top = (*top && *(top + 1)) ? 1 : 0;
+                break;
+            case OpCode::Or:
+                --top;
+                *top = (*top || *(top + 1)) ? 1 : 0;
+                break;
+            case OpCode::Xor:
+                --top;
+                *top = ((*top != 0) != (*(top + 1) != 0)) ? 1 : 0;
+                break;
+            case OpCode::Implies:
+                --top;
+                *top = (!*top || *(top + 1)) ? 1 : 0;
+                break;
+            case OpCode::Iff:
+                --top;
+                *top = ((*top != 0) == (*(top + 1) != 0)) ? 1 : 0;
+                break;
+            case OpCode::Plus:
+                --top;
+                *top += *(top + 1);
+                break;
+            case OpCode::Minus:
+                --top;
+                *top -= *(top + 1);
+                break;
+            case OpCode::Times:
+                --top;
+                *top *= *(top + 1);
+                break;
+            case OpCode::Min:
+                --top;
+                *top = std::min(*top, *(top + 1));
+                break;
+            case OpCode::Max:
+                --top;
+                *top = std::max(*top, *(top + 1));
+                break;
+            case OpCode::Modulo:
+                --top;
+                STORM_LOG_THROW(*(top + 1) != 0, storm::exceptions::InvalidArgumentException, "Modulo by zero while evaluating expression.");
+                *top %= *(top + 1);
+                break;
+            case OpCode::Equal:
+                --top;
+                *top = *top == *(top + 1) ? 1 : 0;
+                break;
+            case OpCode::NotEqual:
+                --top;
+                *top = *top != *(top + 1) ? 1 : 0;
+                break;
+            case OpCode::Less:
+                --top;
+                *top = *top < *(top + 1) ? 1 : 0;
+                break;
+            case OpCode::LessOrEqual:
+                --top;
+                *top = *top <= *(top + 1) ? 1 : 0;
+                break;
+            case OpCode::Greater:
+                --top;
+                *top = *top > *(top + 1) ? 1 : 0;
+                break;
+            case OpCode::GreaterOrEqual:
+                --top;
+                *top = *top >= *(top + 1) ? 1 : 0;
+                break;
+            case OpCode::Jump:
+                programCounter = instruction.bitOffset;
+                break;
+            case OpCode::JumpIfFalse:
+                if (!*(top--)) {
+                    programCounter = instruction.bitOffset;
+                }
+                break;
+        }
+    }
+    STORM_LOG_ASSERT(top == stack.data(), "Unexpected stack size after evaluating expression.");
+    return *top;
+}
+
+bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+    return evaluateAsInt(state) != 0;
+}
+
+StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation) : supported(true), stackSize(0), maxStackSize(0) {
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        variableLocations.emplace(locationVariable.variable, VariableLocation{false, locationVariable.bitOffset, locationVariable.bitWidth, 0});
+    }
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variableLocations.emplace(booleanVariable.variable, VariableLocation{true, booleanVariable.bitOffset, 1, 0});
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        variableLocations.emplace(integerVariable.variable,
+                                  VariableLocation{false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound});
+    }
+}
+
+boost::optional<CompiledStateExpression> StateExpressionCompiler::compile(storm::expressions::Expression const& expression) {
+    result = CompiledStateExpression();
+    supported = !expression.hasRationalType();
+    stackSize = 0;
+    maxStackSize = 0;
+    if (supported) {
+        expression.getBaseExpression().accept(*this, boost::none);
+    }
+    if (!supported) {
+        return boost::none;
+    }
+    STORM_LOG_ASSERT(stackSize == 1, "Unexpected stack size after compiling expression.");
+    result.stack.resize(maxStackSize);
+    return std::move(result);
+}
+
+void StateExpressionCompiler::addInstruction(CompiledStateExpression::OpCode opCode, uint64_t numberOfOperands, uint64_t bitOffset, uint64_t bitWidth,
+                                             int_fast64_t value) {
+    result.instructions.push_back({opCode, bitOffset, bitWidth, value});
+    stackSize = stackSize - numberOfOperands + 1;
+    maxStackSize = std::max(maxStackSize, stackSize);
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) {
+    if (expression.hasRationalType()) {
+        supported = false;
+        return boost::none;
+    }
+    expression.getCondition()->accept(*this, data);
+    uint64_t jumpToElse = result.instructions.size();
+    result.instructions.push_back({CompiledStateExpression::OpCode::JumpIfFalse, 0, 0, 0});
+    --stackSize;
+    expression.getThenExpression()->accept(*this, data);
+    uint64_t jumpToEnd = result.instructions.size();
+    result.instructions.push_back({CompiledStateExpression::OpCode::Jump, 0, 0, 0});
+    // The else branch starts with the same stack as the then branch.
+    --stackSize;
+    result.instructions[jumpToElse].bitOffset = result.instructions.size();
+    expression.getElseExpression()->accept(*this, data);
+    result.instructions[jumpToEnd].bitOffset = result.instructions.size();
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
+    expression.getFirstOperand()->accept(*this, data);
+    expression.getSecondOperand()->accept(*this, data);
+    switch (expression.getOperatorType()) {
+        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+            addInstruction(CompiledStateExpression::OpCode::And, 2);
+            break;
+        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+            addInstruction(CompiledStateExpression::OpCode::Or, 2);
+            break;
+        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+            addInstruction(CompiledStateExpression::OpCode::Xor, 2);
+            break;
+        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies:
+            addInstruction(CompiledStateExpression::OpCode::Implies, 2);
+            break;
+        case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+            addInstruction(CompiledStateExpression::OpCode::Iff, 2);
+            break;
+    }
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
+    if (expression.hasRationalType()) {
+        supported = false;
+        return boost::none;
+    }
+    expression.getFirstOperand()->accept(*this, data);
+    expression.getSecondOperand()->accept(*this, data);
+    switch (expression.getOperatorType()) {
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus:
+            addInstruction(CompiledStateExpression::OpCode::Plus, 2);
+            break;
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus:
+            addInstruction(CompiledStateExpression::OpCode::Minus, 2);
+            break;
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times:
+            addInstruction(CompiledStateExpression::OpCode::Times, 2);
+            break;
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min:
+            addInstruction(CompiledStateExpression::OpCode::Min, 2);
+            break;
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max:
+            addInstruction(CompiledStateExpression::OpCode::Max, 2);
+            break;
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo:
+            addInstruction(CompiledStateExpression::OpCode::Modulo, 2);
+            break;
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide:
+        case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power:
+            // The semantics of these operators are not closed under integers, so we leave them to the evaluator.
+            supported = false;
+            break;
+    }
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) {
+    expression.getFirstOperand()->accept(*this, data);
+    expression.getSecondOperand()->accept(*this, data);
+    switch (expression.getRelationType()) {
+        case storm::expressions::RelationType::Equal:
+            addInstruction(CompiledStateExpression::OpCode::Equal, 2);
+            break;
+        case storm::expressions::RelationType::NotEqual:
+            addInstruction(CompiledStateExpression::OpCode::NotEqual, 2);
+            break;
+        case storm::expressions::RelationType::Less:
+            addInstruction(CompiledStateExpression::OpCode::Less, 2);
+            break;
+        case storm::expressions::RelationType::LessOrEqual:
+            addInstruction(CompiledStateExpression::OpCode::LessOrEqual, 2);
+            break;
+        case storm::expressions::RelationType::Greater:
+            addInstruction(CompiledStateExpression::OpCode::Greater, 2);
+            break;
+        case storm::expressions::RelationType::GreaterOrEqual:
+            addInstruction(CompiledStateExpression::OpCode::GreaterOrEqual, 2);
+            break;
+    }
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::VariableExpression const& expression, boost::any const&) {
+    auto locationIt = variableLocations.find(expression.getVariable());
+    if (expression.hasRationalType() || locationIt == variableLocations.end()) {
+        supported = false;
+        return boost::none;
+    }
+    VariableLocation const& location = locationIt->second;
+    if (location.isBoolean) {
+        addInstruction(CompiledStateExpression::OpCode::LoadBoolean, 0, location.bitOffset);
+    } else if (location.bitWidth == 0) {
+        addInstruction(CompiledStateExpression::OpCode::Constant, 0, 0, 0, location.lowerBound);
+    } else {
+        addInstruction(CompiledStateExpression::OpCode::LoadInteger, 0, location.bitOffset, location.bitWidth, location.lowerBound);
+    }
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
+    expression.getOperand()->accept(*this, data);
+    addInstruction(CompiledStateExpression::OpCode::Not, 1);
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
+    if (expression.hasRationalType() || expression.getOperand()->hasRationalType()) {
+        supported = false;
+        return boost::none;
+    }
+    expression.getOperand()->accept(*this, data);
+    // Rounding an integer has no effect.
+    if (expression.getOperatorType() == storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus) {
+        addInstruction(CompiledStateExpression::OpCode::Negate, 1);
+    }
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) {
+    addInstruction(CompiledStateExpression::OpCode::Constant, 0, 0, 0, expression.getValue() ? 1 : 0);
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) {
+    addInstruction(CompiledStateExpression::OpCode::Constant, 0, 0, 0, expression.getValue());
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::RationalLiteralExpression const&, boost::any const&) {
+    supported = false;
+    return boost::none;
+}
+
+boost::any StateExpressionCompiler::visit(storm::expressions::PredicateExpression const&, boost::any const&) {
+    supported = false;
+    return boost::none;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * A boolean or integer expression that has been translated to a flat sequence of instructions that are evaluated directly on compressed
+ * states. Compared to the expression evaluator, this avoids the evaluation of the expression tree in floating point arithmetic and the
+ * prior unpacking of the state into the evaluator.
+ */
+class CompiledStateExpression {
+   public:
+    friend class StateExpressionCompiler;
+
+    /*!
+     * Evaluates the expression in the given state.
+     */
+    int_fast64_t evaluateAsInt(CompressedState const& state) const;
+
+    /*!
+     * Evaluates the (boolean) expression in the given state.
+     */
+    bool evaluateAsBool(CompressedState const& state) const;
+
+   private:
+    enum class OpCode : uint8_t {
+        Constant,
+        LoadBoolean,
+        LoadInteger,
+        Not,
+        Negate,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Iff,
+        Plus,
+        Minus,
+        Times,
+        Min,
+        Max,
+        Modulo,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        Jump,
+        JumpIfFalse
+    };
+
+    struct Instruction {
+        OpCode opCode;
+        // The bit offset (and width) of the loaded variable or the target of a jump.
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        // The constant or the lower bound of the loaded variable.
+        int_fast64_t value;
+    };
+
+    // The instructions. Each instruction takes its operands from the stack and pushes its result.
+    std::vector<Instruction> instructions;
+
+    // The stack used during evaluation. Its size is the maximal number of values on the stack.
+    mutable std::vector<int_fast64_t> stack;
+};
+
+/*!
+ * Translates expressions over the variables of a model to compiled state expressions.
+ */
+class StateExpressionCompiler : public storm::expressions::ExpressionVisitor {
+   public:
+    StateExpressionCompiler(VariableInformation const& variableInformation);
+
+    /*!
+     * Compiles the given expression. If the expression contains constructs that can not be compiled (e.g. rational values or variables that
+     * are not part of the state), boost::none is returned.
+     */
+    boost::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression);
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(storm::expressions::PredicateExpression const& expression, boost::any const& data) override;
+
+   private:
+    /*!
+     * Appends an instruction that takes the given number of operands from the stack and pushes one value.
+     */
+    void addInstruction(CompiledStateExpression::OpCode opCode, uint64_t numberOfOperands, uint64_t bitOffset = 0, uint64_t bitWidth = 0,
+                        int_fast64_t value = 0);
+
+    struct VariableLocation {
+        bool isBoolean;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int_fast64_t lowerBound;
+    };
+
+    // The locations of the variables in the compressed states.
+    std::unordered_map<storm::expressions::Variable, VariableLocation> variableLocations;
+
+    // The expression that is currently compiled.
+    CompiledStateExpression result;
+
+    // Whether the current expression can be compiled (so far).
+    bool supported;
+
+    // The number of values on the stack after the instructions compiled so far and the maximal such number.
+    uint64_t stackSize;
+    uint64_t maxStackSize;
+};
+
+}  // namespace generator
+}  // namespace storm
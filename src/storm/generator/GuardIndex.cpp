@@ -0,0 +1,121 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+namespace storm {
+namespace generator {
+
+namespace detail {
+// Collects the variables that the given guard constrains to a single value via one of its conjuncts.
+void collectFixedValues(storm::expressions::Expression const& guard, std::map<storm::expressions::Variable, int_fast64_t>& fixedValues) {
+    if (guard.isVariable()) {
+        if (guard.hasBooleanType()) {
+            fixedValues.emplace(guard.getBaseExpression().asVariableExpression().getVariable(), 1);
+        }
+    } else if (guard.isFunctionApplication()) {
+        switch (guard.getOperator()) {
+            case storm::expressions::OperatorType::And:
+                collectFixedValues(guard.getOperand(0), fixedValues);
+                collectFixedValues(guard.getOperand(1), fixedValues);
+                break;
+            case storm::expressions::OperatorType::Not:
+                if (guard.getOperand(0).isVariable() && guard.getOperand(0).hasBooleanType()) {
+                    fixedValues.emplace(guard.getOperand(0).getBaseExpression().asVariableExpression().getVariable(), 0);
+                }
+                break;
+            case storm::expressions::OperatorType::Equal:
+                for (uint64_t variableOperand = 0; variableOperand < 2; ++variableOperand) {
+                    storm::expressions::Expression variable = guard.getOperand(variableOperand);
+                    storm::expressions::Expression value = guard.getOperand(1 - variableOperand);
+                    if (variable.isVariable() && variable.hasIntegerType() && value.isLiteral() && value.hasIntegerType()) {
+                        fixedValues.emplace(variable.getBaseExpression().asVariableExpression().getVariable(), value.evaluateAsInt());
+                        break;
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+}  // namespace detail
+
+GuardIndex::GuardIndex(std::vector<std::pair<uint_fast64_t, storm::expressions::Expression>> const& commands, VariableInformation const& variableInformation)
+    : bitOffset(0), bitWidth(0) {
+    // Indexing only pays off for domains of moderate size, as we store the candidates for each value.
+    uint64_t const maxDomainSize = 1024;
+
+    struct Location {
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int_fast64_t lowerBound;
+        int_fast64_t upperBound;
+    };
+    std::map<storm::expressions::Variable, Location> locations;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        locations.emplace(booleanVariable.variable, Location{booleanVariable.bitOffset, 1, 0, 1});
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        if (integerVariable.bitWidth > 0 && static_cast<uint64_t>(integerVariable.upperBound - integerVariable.lowerBound) < maxDomainSize) {
+            locations.emplace(integerVariable.variable,
+                              Location{integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound});
+        }
+    }
+
+    // Determine the fixed values of all guards and the variable that is fixed by most guards.
+    std::vector<std::map<storm::expressions::Variable, int_fast64_t>> fixedValues(commands.size());
+    std::map<storm::expressions::Variable, uint64_t> numberOfFixingGuards;
+    for (uint64_t i = 0; i < commands.size(); ++i) {
+        allCommands.push_back(commands[i].first);
+        detail::collectFixedValues(commands[i].second, fixedValues[i]);
+        for (auto const& variableValuePair : fixedValues[i]) {
+            if (locations.count(variableValuePair.first) > 0) {
+                ++numberOfFixingGuards[variableValuePair.first];
+            }
+        }
+    }
+    auto bestIt = numberOfFixingGuards.end();
+    for (auto it = numberOfFixingGuards.begin(); it != numberOfFixingGuards.end(); ++it) {
+        if (bestIt == numberOfFixingGuards.end() || it->second > bestIt->second) {
+            bestIt = it;
+        }
+    }
+    if (bestIt == numberOfFixingGuards.end() || bestIt->second < 2) {
+        return;
+    }
+
+    Location const& location = locations.at(bestIt->first);
+    bitOffset = location.bitOffset;
+    bitWidth = location.bitWidth;
+    candidatesByValue.resize(location.upperBound - location.lowerBound + 1);
+    for (uint64_t i = 0; i < commands.size(); ++i) {
+        auto valueIt = fixedValues[i].find(bestIt->first);
+        if (valueIt == fixedValues[i].end()) {
+            for (auto& candidates : candidatesByValue) {
+                candidates.push_back(commands[i].first);
+            }
+        } else if (valueIt->second >= location.lowerBound && valueIt->second <= location.upperBound) {
+            candidatesByValue[valueIt->second - location.lowerBound].push_back(commands[i].first);
+        }
+        // Otherwise, the guard can never be satisfied.
+    }
+}
+
+std::vector<uint_fast64_t> const& GuardIndex::getCandidates(CompressedState const& state) const {
+    if (candidatesByValue.empty()) {
+        return allCommands;
+    }
+    uint64_t value = state.getAsInt(bitOffset, bitWidth);
+    return value < candidatesByValue.size() ? candidatesByValue[value] : allCommands;
+}
+
+bool GuardIndex::isIndexed() const {
+    return !candidatesByValue.empty();
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * An index over the guards of a set of commands that, given a state, yields the commands whose guards may hold. For this, the variable that
+ * is most often constrained to a fixed value by a conjunct of the guards (like s=3 or b) is determined. The commands are then bucketed by
+ * the value they require for this variable, so that for a state, only the commands in the matching bucket need to be evaluated.
+ */
+class GuardIndex {
+   public:
+    /*!
+     * Creates an index for the given commands.
+     *
+     * @param commands The indices of the commands together with their guards. The order of the indices is preserved by the candidates.
+     * @param variableInformation The information about the variables of the compressed states.
+     */
+    GuardIndex(std::vector<std::pair<uint_fast64_t, storm::expressions::Expression>> const& commands, VariableInformation const& variableInformation);
+
+    /*!
+     * Retrieves the (ordered) indices of the commands whose guard may hold in the given state. The guards of all other commands are violated.
+     */
+    std::vector<uint_fast64_t> const& getCandidates(CompressedState const& state) const;
+
+    /*!
+     * Retrieves whether the commands are actually indexed (otherwise, all commands are always candidates).
+     */
+    bool isIndexed() const;
+
+   private:
+    // The indices of all commands.
+    std::vector<uint_fast64_t> allCommands;
+
+    // The location of the variable that is used for the index in the compressed state.
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+
+    // The candidates for each value of the variable (offset by the lower bound). Empty if the commands are not indexed.
+    std::vector<std::vector<uint_fast64_t>> candidatesByValue;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -568,9 +568,19 @@ storm::storage::sparse::StateValuationsBuilder JaniNextStateGenerator<ValueType,
     return result;
 }
 
+template<typename ValueType, typename StateType>
+bool JaniNextStateGenerator<ValueType, StateType>::canDecodeStateValuations() const {
+    return transientVariableInformation.booleanVariableInformation.empty() && transientVariableInformation.integerVariableInformation.empty() &&
+           transientVariableInformation.rationalVariableInformation.empty();
+}
+
 template<typename ValueType, typename StateType>
 void JaniNextStateGenerator<ValueType, StateType>::addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
                                                                      storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const {
+    if (valuationsBuilder.isLazy()) {
+        NextStateGenerator<ValueType, StateType>::addStateValuation(currentStateIndex, valuationsBuilder);
+        return;
+    }
     std::vector<bool> booleanValues;
     booleanValues.reserve(this->variableInformation.booleanVariables.size() + transientVariableInformation.booleanVariableInformation.size());
     std::vector<int64_t> integerValues;
@@ -74,6 +74,10 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
     virtual void unpackTransientVariableValuesIntoEvaluator(CompressedState const& state,
                                                             storm::expressions::ExpressionEvaluator<ValueType>& evaluator) const override;
 
+   protected:
+    /// Transient variables are not part of the compressed states, so they can only be evaluated when exploring a state.
+    virtual bool canDecodeStateValuations() const override;
+
    private:
     /*!
      * Retrieves the location index from the given state.
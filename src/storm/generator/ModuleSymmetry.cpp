@@ -0,0 +1,300 @@
+#include "storm/generator/ModuleSymmetry.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+
+#include <boost/optional.hpp>
+
+#include "storm-config.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/solver/SmtSolver.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/solver.h"
+
+namespace storm {
+namespace generator {
+
+namespace detail {
+// Checks whether two expressions are equivalent (within the variable ranges of the program). If no SMT solver is available, only syntactically
+// equal expressions are recognized.
+class EquivalenceChecker {
+   public:
+    EquivalenceChecker(storm::prism::Program const& program) : program(program) {
+        // Intentionally left empty.
+    }
+
+    bool areEquivalent(storm::expressions::Expression const& first, storm::expressions::Expression const& second) {
+        if (first.isSyntacticallyEqual(second)) {
+            return true;
+        }
+#if defined(STORM_HAVE_Z3) || defined(STORM_HAVE_MSAT)
+        if (!solver) {
+            storm::utility::solver::SmtSolverFactory factory;
+            solver = factory.create(program.getManager());
+            for (auto const& rangeExpression : program.getAllRangeExpressions()) {
+                solver->add(rangeExpression);
+            }
+        }
+        solver->push();
+        solver->add(first.hasBooleanType() ? storm::expressions::xclusiveor(first, second) : first != second);
+        bool result = solver->check() == storm::solver::SmtSolver::CheckResult::Unsat;
+        solver->pop();
+        return result;
+#else
+        return false;
+#endif
+    }
+
+   private:
+    storm::prism::Program const& program;
+    std::unique_ptr<storm::solver::SmtSolver> solver;
+};
+
+// Checks whether the given substitution of variables maps the command onto the other command.
+bool isMappedTo(storm::prism::Command const& command, std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution,
+                storm::prism::Command const& other, EquivalenceChecker& checker) {
+    if (command.getActionIndex() != other.getActionIndex() || command.isMarkovian() != other.isMarkovian() ||
+        command.getNumberOfUpdates() != other.getNumberOfUpdates()) {
+        return false;
+    }
+    if (!checker.areEquivalent(command.getGuardExpression().substitute(substitution), other.getGuardExpression())) {
+        return false;
+    }
+    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+        storm::prism::Update const& update = command.getUpdate(k);
+        storm::prism::Update const& otherUpdate = other.getUpdate(k);
+        if (update.getNumberOfAssignments() != otherUpdate.getNumberOfAssignments() ||
+            !checker.areEquivalent(update.getLikelihoodExpression().substitute(substitution), otherUpdate.getLikelihoodExpression())) {
+            return false;
+        }
+        for (auto const& assignment : update.getAssignments()) {
+            auto substitutionIt = substitution.find(assignment.getVariable());
+            storm::expressions::Variable const& variable =
+                substitutionIt == substitution.end() ? assignment.getVariable() : substitutionIt->second.getBaseExpression().asVariableExpression().getVariable();
+            auto otherIt = std::find_if(otherUpdate.getAssignments().begin(), otherUpdate.getAssignments().end(),
+                                        [&variable](storm::prism::Assignment const& otherAssignment) { return otherAssignment.getVariable() == variable; });
+            if (otherIt == otherUpdate.getAssignments().end() ||
+                !checker.areEquivalent(assignment.getExpression().substitute(substitution), otherIt->getExpression())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Information about a local variable of a module that is relevant for the symmetry.
+struct LocalVariable {
+    storm::expressions::Variable variable;
+    boost::optional<storm::expressions::Expression> initialValue;
+    int_fast64_t lowerBound;
+    int_fast64_t upperBound;
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+};
+
+// Retrieves the local variables of the given module in the order of their declaration or nothing, if one of them is not supported.
+boost::optional<std::vector<LocalVariable>> getLocalVariables(storm::prism::Module const& module, VariableInformation const& variableInformation) {
+    if (!module.getClockVariables().empty()) {
+        return boost::none;
+    }
+    std::vector<LocalVariable> result;
+    for (auto const& booleanVariable : module.getBooleanVariables()) {
+        auto it = std::find_if(variableInformation.booleanVariables.begin(), variableInformation.booleanVariables.end(),
+                               [&booleanVariable](BooleanVariableInformation const& info) { return info.variable == booleanVariable.getExpressionVariable(); });
+        STORM_LOG_ASSERT(it != variableInformation.booleanVariables.end(), "Unknown variable " << booleanVariable.getName() << ".");
+        boost::optional<storm::expressions::Expression> initialValue;
+        if (booleanVariable.hasInitialValue()) {
+            initialValue = booleanVariable.getInitialValueExpression();
+        }
+        result.push_back({it->variable, initialValue, 0, 1, it->bitOffset, 1});
+    }
+    for (auto const& integerVariable : module.getIntegerVariables()) {
+        auto it = std::find_if(variableInformation.integerVariables.begin(), variableInformation.integerVariables.end(),
+                               [&integerVariable](IntegerVariableInformation const& info) { return info.variable == integerVariable.getExpressionVariable(); });
+        STORM_LOG_ASSERT(it != variableInformation.integerVariables.end(), "Unknown variable " << integerVariable.getName() << ".");
+        if (it->forceOutOfBoundsCheck) {
+            // Unbounded variables are not supported.
+            return boost::none;
+        }
+        boost::optional<storm::expressions::Expression> initialValue;
+        if (integerVariable.hasInitialValue()) {
+            initialValue = integerVariable.getInitialValueExpression();
+        }
+        result.push_back({it->variable, initialValue, it->lowerBound, it->upperBound, it->bitOffset, it->bitWidth});
+    }
+    return result;
+}
+
+// Checks whether swapping the local variables of the two given modules maps the program onto itself.
+bool isSymmetric(storm::prism::Program const& program, uint_fast64_t firstModuleIndex, std::vector<LocalVariable> const& firstVariables,
+                 uint_fast64_t secondModuleIndex, std::vector<LocalVariable> const& secondVariables,
+                 std::vector<storm::expressions::Expression> const& invariantExpressions, EquivalenceChecker& checker) {
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+    for (uint_fast64_t i = 0; i < firstVariables.size(); ++i) {
+        LocalVariable const& first = firstVariables[i];
+        LocalVariable const& second = secondVariables[i];
+        if (!(first.variable.getType() == second.variable.getType()) || first.lowerBound != second.lowerBound || first.upperBound != second.upperBound ||
+            first.bitWidth != second.bitWidth || first.initialValue.is_initialized() != second.initialValue.is_initialized()) {
+            return false;
+        }
+        if (first.initialValue && !checker.areEquivalent(first.initialValue.get(), second.initialValue.get())) {
+            return false;
+        }
+        substitution.emplace(first.variable, second.variable.getExpression());
+        substitution.emplace(second.variable, first.variable.getExpression());
+    }
+
+    // The commands of the first module need to be mapped onto the ones of the second module (and vice versa, as the substitution is an
+    // involution). All other commands need to be mapped onto themselves.
+    storm::prism::Module const& firstModule = program.getModule(firstModuleIndex);
+    storm::prism::Module const& secondModule = program.getModule(secondModuleIndex);
+    if (firstModule.getNumberOfCommands() != secondModule.getNumberOfCommands()) {
+        return false;
+    }
+    for (uint_fast64_t j = 0; j < firstModule.getNumberOfCommands(); ++j) {
+        if (!isMappedTo(firstModule.getCommand(j), substitution, secondModule.getCommand(j), checker)) {
+            return false;
+        }
+    }
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        if (i == firstModuleIndex || i == secondModuleIndex) {
+            continue;
+        }
+        for (auto const& command : program.getModule(i).getCommands()) {
+            if (!isMappedTo(command, substitution, command, checker)) {
+                return false;
+            }
+        }
+    }
+
+    if (program.hasInitialConstruct() &&
+        !checker.areEquivalent(program.getInitialConstruct().getInitialStatesExpression().substitute(substitution),
+                               program.getInitialConstruct().getInitialStatesExpression())) {
+        return false;
+    }
+    for (auto const& expression : invariantExpressions) {
+        if (!checker.areEquivalent(expression.substitute(substitution), expression)) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace detail
+
+ModuleSymmetry::ModuleSymmetry(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                               std::vector<storm::expressions::Expression> const& invariantExpressions) {
+    detail::EquivalenceChecker checker(program);
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        storm::prism::Module const& baseModule = program.getModule(i);
+        if (baseModule.isRenamedFromModule()) {
+            continue;
+        }
+        auto baseVariables = detail::getLocalVariables(baseModule, variableInformation);
+        if (!baseVariables || baseVariables->empty()) {
+            continue;
+        }
+
+        std::vector<std::vector<std::pair<uint64_t, uint64_t>>> group;
+        auto addModule = [&group](std::vector<detail::LocalVariable> const& variables) {
+            group.emplace_back();
+            for (auto const& variable : variables) {
+                group.back().emplace_back(variable.bitOffset, variable.bitWidth);
+            }
+        };
+        addModule(baseVariables.get());
+
+        for (uint_fast64_t j = 0; j < program.getNumberOfModules(); ++j) {
+            storm::prism::Module const& module = program.getModule(j);
+            if (!module.isRenamedFromModule() || module.getBaseModule() != baseModule.getName()) {
+                continue;
+            }
+
+            // Order the local variables of the module according to the renaming.
+            auto moduleVariables = detail::getLocalVariables(module, variableInformation);
+            if (!moduleVariables || moduleVariables->size() != baseVariables->size()) {
+                continue;
+            }
+            std::vector<detail::LocalVariable> renamedVariables;
+            for (auto const& baseVariable : baseVariables.get()) {
+                auto renamingIt = module.getRenaming().find(baseVariable.variable.getName());
+                if (renamingIt == module.getRenaming().end()) {
+                    break;
+                }
+                auto it = std::find_if(moduleVariables->begin(), moduleVariables->end(),
+                                       [&renamingIt](detail::LocalVariable const& variable) { return variable.variable.getName() == renamingIt->second; });
+                if (it == moduleVariables->end()) {
+                    break;
+                }
+                renamedVariables.push_back(*it);
+            }
+
+            if (renamedVariables.size() == baseVariables->size() &&
+                detail::isSymmetric(program, i, baseVariables.get(), j, renamedVariables, invariantExpressions, checker)) {
+                addModule(renamedVariables);
+            } else {
+                STORM_LOG_INFO("Module " << module.getName() << " is not symmetric to module " << baseModule.getName() << ".");
+            }
+        }
+
+        if (group.size() > 1) {
+            STORM_LOG_INFO("Found " << group.size() << " symmetric copies of module " << baseModule.getName() << ".");
+            groups.push_back(std::move(group));
+        }
+    }
+}
+
+bool ModuleSymmetry::empty() const {
+    return groups.empty();
+}
+
+uint64_t ModuleSymmetry::getNumberOfGroups() const {
+    return groups.size();
+}
+
+uint64_t ModuleSymmetry::getNumberOfModules(uint64_t group) const {
+    return groups[group].size();
+}
+
+void ModuleSymmetry::canonicalize(CompressedState& state) const {
+    std::vector<uint64_t> values;
+    std::vector<uint64_t> order;
+    for (auto const& group : groups) {
+        uint64_t const numberOfVariables = group.front().size();
+        values.clear();
+        for (auto const& module : group) {
+            for (auto const& location : module) {
+                values.push_back(location.second == 0 ? 0 : state.getAsInt(location.first, location.second));
+            }
+        }
+
+        // Sort the modules lexicographically by the values of their local variables.
+        auto valuesOf = [&values, numberOfVariables](uint64_t module) { return values.begin() + module * numberOfVariables; };
+        auto isLess = [&valuesOf, numberOfVariables](uint64_t first, uint64_t second) {
+            return std::lexicographical_compare(valuesOf(first), valuesOf(first) + numberOfVariables, valuesOf(second), valuesOf(second) + numberOfVariables);
+        };
+        order.resize(group.size());
+        for (uint64_t module = 0; module < group.size(); ++module) {
+            order[module] = module;
+        }
+        if (std::is_sorted(order.begin(), order.end(), isLess)) {
+            continue;
+        }
+        std::sort(order.begin(), order.end(), isLess);
+
+        for (uint64_t module = 0; module < group.size(); ++module) {
+            auto sourceIt = valuesOf(order[module]);
+            for (uint64_t variable = 0; variable < numberOfVariables; ++variable, ++sourceIt) {
+                auto const& location = group[module][variable];
+                if (location.second > 0) {
+                    state.setFromInt(location.first, location.second, *sourceIt);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace generator
+}  // namespace storm
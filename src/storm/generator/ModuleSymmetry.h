@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace prism {
+class Program;
+}
+
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * The symmetries of a PRISM program that stem from modules created via renaming. A group consists of a module and all modules that were renamed
+ * from it such that swapping the local variables of any two of them maps the program onto itself. Within a group, the modules can thus be
+ * permuted arbitrarily and a state can be replaced by a canonical representative of its orbit, which is obtained by sorting the valuations of
+ * the local variables of the modules of each group.
+ */
+class ModuleSymmetry {
+   public:
+    /*!
+     * Creates an empty symmetry, i.e., states are never changed.
+     */
+    ModuleSymmetry() = default;
+
+    /*!
+     * Detects the symmetric module groups of the given program.
+     *
+     * @param program The program (whose constants and formulas have been substituted).
+     * @param variableInformation The information about the variables of the compressed states.
+     * @param invariantExpressions Expressions (such as labels, rewards, or terminal states) that have to be invariant under the symmetry.
+     */
+    ModuleSymmetry(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                   std::vector<storm::expressions::Expression> const& invariantExpressions);
+
+    /*!
+     * Retrieves whether there is no symmetric group.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves the number of symmetric groups.
+     */
+    uint64_t getNumberOfGroups() const;
+
+    /*!
+     * Retrieves the number of modules in the given group.
+     */
+    uint64_t getNumberOfModules(uint64_t group) const;
+
+    /*!
+     * Replaces the given state by the canonical representative of its orbit.
+     */
+    void canonicalize(CompressedState& state) const;
+
+   private:
+    // For each group and each of its modules, the locations (offset and width) of the local variables in the compressed state. For all modules
+    // of a group, the variables are listed in the same order.
+    std::vector<std::vector<std::vector<std::pair<uint64_t, uint64_t>>>> groups;
+};
+
+}  // namespace generator
+}  // namespace storm
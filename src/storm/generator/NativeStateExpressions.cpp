@@ -0,0 +1,407 @@
+#include "storm/generator/NativeStateExpressions.h"
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+extern char** environ;
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ToCppVisitor.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace detail {
+
+/*!
+ * Checks whether an expression can be translated to native code whose semantics coincide with the one of the expression evaluator.
+ */
+class NativeSupportChecker : public storm::expressions::ExpressionVisitor {
+   public:
+    NativeSupportChecker(std::unordered_map<storm::expressions::Variable, std::string> const& variableCode) : variableCode(variableCode) {
+        // Intentionally left empty.
+    }
+
+    bool isSupported(storm::expressions::Expression const& expression) {
+        return boost::any_cast<bool>(expression.getBaseExpression().accept(*this, boost::none));
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+        return boost::any_cast<bool>(expression.getCondition()->accept(*this, data)) &&
+               boost::any_cast<bool>(expression.getThenExpression()->accept(*this, data)) &&
+               boost::any_cast<bool>(expression.getElseExpression()->accept(*this, data));
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        return boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, data)) &&
+               boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, data));
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        switch (expression.getOperatorType()) {
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide:
+                // A division of integers would be truncated in C++.
+                if (!expression.getFirstOperand()->hasRationalType() && !expression.getSecondOperand()->hasRationalType()) {
+                    return false;
+                }
+                break;
+            case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                // Only integer modulo operations by nonzero constants are translated, since a modulo by zero would crash the native code.
+                if (expression.hasRationalType() || !expression.getSecondOperand()->isLiteral() || expression.getSecondOperand()->evaluateAsInt() == 0) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+        return boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, data)) &&
+               boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, data));
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+        return boost::any_cast<bool>(expression.getFirstOperand()->accept(*this, data)) &&
+               boost::any_cast<bool>(expression.getSecondOperand()->accept(*this, data));
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        return variableCode.find(expression.getVariable()) != variableCode.end();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        return expression.getOperand()->accept(*this, data);
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        return expression.getOperand()->accept(*this, data);
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const&, boost::any const&) override {
+        return true;
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const&, boost::any const&) override {
+        return true;
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const&, boost::any const&) override {
+        return true;
+    }
+
+    virtual boost::any visit(storm::expressions::PredicateExpression const&, boost::any const&) override {
+        return false;
+    }
+
+   private:
+    std::unordered_map<storm::expressions::Variable, std::string> const& variableCode;
+};
+
+// The code preceding the compiled expressions. It provides access to the bits of the state (in the layout of storm::storage::BitVector) as well
+// as the functions used by the ToCppVisitor that are not part of the standard library for operands of different types.
+std::string const nativePrelude = R"(#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+namespace storm_native {
+
+inline bool getBool(uint64_t const* state, uint64_t bitOffset) {
+    return (state[bitOffset >> 6] >> (63 - (bitOffset & 63))) & 1ull;
+}
+
+inline int64_t getInt(uint64_t const* state, uint64_t bitOffset, uint64_t bitWidth, int64_t lowerBound) {
+    if (bitWidth == 0) {
+        return lowerBound;
+    }
+    uint64_t bucket = bitOffset >> 6;
+    uint64_t bitIndexInBucket = bitOffset & 63;
+    uint64_t value;
+    if (bitIndexInBucket + bitWidth <= 64) {
+        value = (state[bucket] << bitIndexInBucket) >> (64 - bitWidth);
+    } else {
+        uint64_t remainingBits = bitIndexInBucket + bitWidth - 64;
+        value = (((state[bucket] << bitIndexInBucket) >> bitIndexInBucket) << remainingBits) | (state[bucket + 1] >> (64 - remainingBits));
+    }
+    return static_cast<int64_t>(value) + lowerBound;
+}
+
+namespace std {
+using ::std::ceil;
+using ::std::floor;
+using ::std::pow;
+
+template<typename A, typename B>
+inline auto min(A a, B b) -> decltype(a + b) {
+    return a < b ? a : b;
+}
+
+template<typename A, typename B>
+inline auto max(A a, B b) -> decltype(a + b) {
+    return a < b ? b : a;
+}
+}  // namespace std
+
+)";
+
+/*!
+ * Checks whether the given file status belongs to a file of the current user that nobody else may write to.
+ */
+bool isPrivate(struct stat const& status) {
+    return status.st_uid == geteuid() && (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+/*!
+ * Checks whether the given path is a directory in which only the current user may create or replace files.
+ */
+bool isPrivateDirectory(std::string const& path) {
+    struct stat status;
+    return lstat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode) && isPrivate(status);
+}
+
+/*!
+ * Retrieves the directory in which the shared objects are cached. As shared objects found in this directory are loaded into the process, the
+ * directory has to be private to the current user. By default, this is a per-user directory in TMPDIR (or /tmp). If the directory is not
+ * private (for example because another user created it first), a fresh private directory is used, which disables reusing earlier compilations.
+ *
+ * @return The directory or an empty string if no suitable directory could be created.
+ */
+std::string getCacheDirectory(std::string const& directory) {
+    std::string temporaryDirectory = "/tmp";
+    char const* environmentDirectory = std::getenv("TMPDIR");
+    if (environmentDirectory != nullptr && *environmentDirectory != '\0') {
+        temporaryDirectory = environmentDirectory;
+    }
+
+    std::string result = directory;
+    if (result.empty()) {
+        result = temporaryDirectory + "/storm_native_" + std::to_string(geteuid());
+        if (mkdir(result.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+            result.clear();
+        }
+    }
+    if (!result.empty() && isPrivateDirectory(result)) {
+        return result;
+    }
+    STORM_LOG_WARN("The directory '" << result << "' for native code is not private to the current user, using a fresh directory instead.");
+    std::string pattern = temporaryDirectory + "/storm_native_XXXXXX";
+    std::vector<char> buffer(pattern.begin(), pattern.end());
+    buffer.push_back('\0');
+    if (mkdtemp(buffer.data()) == nullptr) {
+        return "";
+    }
+    return buffer.data();
+}
+
+/*!
+ * Runs the given command (without invoking a shell) and waits for its termination.
+ *
+ * @return True iff the command terminated successfully.
+ */
+bool runCommand(std::vector<std::string> const& arguments) {
+    std::vector<char*> argv;
+    for (auto const& argument : arguments) {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+    pid_t pid;
+    if (posix_spawnp(&pid, argv.front(), nullptr, nullptr, argv.data(), environ) != 0) {
+        return false;
+    }
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/*!
+ * Opens the given shared object if it is a regular file of the current user that nobody else may write to.
+ *
+ * @return The handle of the shared object or null if it cannot (or must not) be loaded.
+ */
+void* openPrivateLibrary(std::string const& libraryFile) {
+    int descriptor = open(libraryFile.c_str(), O_RDONLY | O_NOFOLLOW);
+    if (descriptor < 0) {
+        return nullptr;
+    }
+    struct stat status;
+    void* handle = nullptr;
+    if (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) && isPrivate(status)) {
+        handle = dlopen(libraryFile.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (handle == nullptr) {
+            STORM_LOG_WARN("Unable to load native code for expressions from '" << libraryFile << "': " << dlerror() << ".");
+        }
+    } else {
+        STORM_LOG_WARN("Refusing to load native code for expressions from '" << libraryFile << "' as it is not private to the current user.");
+    }
+    close(descriptor);
+    return handle;
+}
+
+}  // namespace detail
+
+NativeStateExpressions::NativeStateExpressions(void* handle) : handle(handle) {
+    // Intentionally left empty.
+}
+
+NativeStateExpressions::~NativeStateExpressions() {
+    if (handle != nullptr) {
+        dlclose(handle);
+    }
+}
+
+NativeStateExpressions::IntegerFunction NativeStateExpressions::getIntegerFunction(storm::expressions::Expression const& expression) const {
+    auto it = integerFunctions.find(&expression.getBaseExpression());
+    return it == integerFunctions.end() ? nullptr : it->second;
+}
+
+NativeStateExpressions::DoubleFunction NativeStateExpressions::getDoubleFunction(storm::expressions::Expression const& expression) const {
+    auto it = doubleFunctions.find(&expression.getBaseExpression());
+    return it == doubleFunctions.end() ? nullptr : it->second;
+}
+
+int64_t NativeStateExpressions::evaluate(IntegerFunction function, CompressedState const& state) {
+    return function(state.getBuckets());
+}
+
+double NativeStateExpressions::evaluate(DoubleFunction function, CompressedState const& state) {
+    return function(state.getBuckets());
+}
+
+NativeStateExpressionCompiler::NativeStateExpressionCompiler(VariableInformation const& variableInformation) {
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        variableCode.emplace(locationVariable.variable,
+                             "getInt(state, " + std::to_string(locationVariable.bitOffset) + ", " + std::to_string(locationVariable.bitWidth) + ", 0)");
+    }
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variableCode.emplace(booleanVariable.variable, "getBool(state, " + std::to_string(booleanVariable.bitOffset) + ")");
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        variableCode.emplace(integerVariable.variable, "getInt(state, " + std::to_string(integerVariable.bitOffset) + ", " +
+                                                           std::to_string(integerVariable.bitWidth) + ", " + std::to_string(integerVariable.lowerBound) +
+                                                           ")");
+    }
+}
+
+bool NativeStateExpressionCompiler::addExpression(storm::expressions::Expression const& expression) {
+    if (expressionIndices.find(&expression.getBaseExpression()) != expressionIndices.end()) {
+        return true;
+    }
+    detail::NativeSupportChecker checker(variableCode);
+    if (!checker.isSupported(expression)) {
+        return false;
+    }
+    expressionIndices.emplace(&expression.getBaseExpression(), expressions.size());
+    expressions.push_back(expression);
+    return true;
+}
+
+std::string NativeStateExpressionCompiler::getCode() const {
+    std::unordered_map<storm::expressions::Variable, std::string> prefixes;
+    storm::expressions::ToCppTranslationOptions options(prefixes, variableCode, storm::expressions::ToCppTranslationMode::KeepType);
+    storm::expressions::ToCppVisitor visitor;
+
+    std::stringstream code;
+    code << detail::nativePrelude;
+    for (uint64_t index = 0; index < expressions.size(); ++index) {
+        auto const& expression = expressions[index];
+        code << "extern \"C\" " << (expression.hasRationalType() ? "double" : "int64_t") << " storm_native_" << index << "(uint64_t const* state) {\n";
+        code << "    return " << visitor.translate(expression, options) << ";\n";
+        code << "}\n\n";
+    }
+    code << "}  // namespace storm_native\n";
+    return code.str();
+}
+
+std::shared_ptr<NativeStateExpressions> NativeStateExpressionCompiler::compile(std::string const& compiler, std::string const& directory) const {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::string code = getCode();
+
+    std::string cacheDirectory = detail::getCacheDirectory(directory);
+    if (cacheDirectory.empty()) {
+        STORM_LOG_WARN("Unable to create a private directory for native code. Expressions are interpreted.");
+        return nullptr;
+    }
+
+    // The shared objects are identified by a hash of the code and the compiler such that they can be reused by later invocations.
+    std::stringstream baseName;
+    baseName << cacheDirectory << "/storm_native_" << std::hex << std::hash<std::string>()(compiler + "\n" + code);
+    std::string libraryFile = baseName.str() + ".so";
+
+    struct stat libraryStatus;
+    bool cached = lstat(libraryFile.c_str(), &libraryStatus) == 0;
+    if (!cached) {
+        // Write to files unique for this process and thread and move the result such that concurrent compilations do not clash.
+        std::stringstream uniqueName;
+        uniqueName << baseName.str() << "_" << getpid() << "_" << std::hash<std::thread::id>()(std::this_thread::get_id());
+        std::string sourceFile = uniqueName.str() + ".cpp";
+        std::string temporaryLibraryFile = uniqueName.str() + ".so";
+        {
+            std::ofstream sourceStream(sourceFile);
+            if (!sourceStream) {
+                STORM_LOG_WARN("Unable to write native code for expressions to '" << sourceFile << "'. Expressions are interpreted.");
+                return nullptr;
+            }
+            sourceStream << code;
+        }
+        // The compiler command may consist of several words (e.g. 'ccache g++'), which are passed as separate arguments.
+        std::istringstream compilerStream(compiler);
+        std::vector<std::string> arguments{std::istream_iterator<std::string>(compilerStream), std::istream_iterator<std::string>()};
+        if (arguments.empty()) {
+            std::remove(sourceFile.c_str());
+            STORM_LOG_WARN("No compiler for native code given. Expressions are interpreted.");
+            return nullptr;
+        }
+        arguments.insert(arguments.end(), {"-O2", "-shared", "-fPIC", "-o", temporaryLibraryFile, sourceFile});
+        bool success = detail::runCommand(arguments);
+        std::remove(sourceFile.c_str());
+        if (!success || std::rename(temporaryLibraryFile.c_str(), libraryFile.c_str()) != 0) {
+            std::remove(temporaryLibraryFile.c_str());
+            STORM_LOG_WARN("Compiling the native code for expressions with '" << compiler << "' failed. Expressions are interpreted.");
+            return nullptr;
+        }
+    }
+
+    void* handle = detail::openPrivateLibrary(libraryFile);
+    if (handle == nullptr) {
+        STORM_LOG_WARN("Expressions are interpreted.");
+        return nullptr;
+    }
+    auto result = std::make_shared<NativeStateExpressions>(handle);
+    for (uint64_t index = 0; index < expressions.size(); ++index) {
+        std::string symbol = "storm_native_" + std::to_string(index);
+        void* function = dlsym(handle, symbol.c_str());
+        if (function == nullptr) {
+            STORM_LOG_WARN("Unable to find symbol '" << symbol << "' in '" << libraryFile << "'. Expressions are interpreted.");
+            return nullptr;
+        }
+        if (expressions[index].hasRationalType()) {
+            result->doubleFunctions.emplace(&expressions[index].getBaseExpression(), reinterpret_cast<NativeStateExpressions::DoubleFunction>(function));
+        } else {
+            result->integerFunctions.emplace(&expressions[index].getBaseExpression(), reinterpret_cast<NativeStateExpressions::IntegerFunction>(function));
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_INFO((cached ? "Loaded " : "Compiled ") << expressions.size() << " expressions to native code in "
+                                                      << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+    return result;
+}
+
+}  // namespace generator
+}  // namespace storm
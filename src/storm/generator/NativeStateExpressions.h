@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * Expressions over the variables of a model that were compiled to native functions operating directly on the bits of compressed states.
+ * The functions are loaded from a shared object which stays loaded as long as this object exists.
+ */
+class NativeStateExpressions {
+   public:
+    typedef int64_t (*IntegerFunction)(uint64_t const*);
+    typedef double (*DoubleFunction)(uint64_t const*);
+
+    NativeStateExpressions(void* handle);
+    ~NativeStateExpressions();
+
+    NativeStateExpressions(NativeStateExpressions const&) = delete;
+    NativeStateExpressions& operator=(NativeStateExpressions const&) = delete;
+
+    /*!
+     * Retrieves the function computing the given boolean or integer expression (or null if the expression was not compiled).
+     */
+    IntegerFunction getIntegerFunction(storm::expressions::Expression const& expression) const;
+
+    /*!
+     * Retrieves the function computing the given rational expression (or null if the expression was not compiled).
+     */
+    DoubleFunction getDoubleFunction(storm::expressions::Expression const& expression) const;
+
+    /*!
+     * Evaluates the given function in the given state.
+     */
+    static int64_t evaluate(IntegerFunction function, CompressedState const& state);
+    static double evaluate(DoubleFunction function, CompressedState const& state);
+
+   private:
+    friend class NativeStateExpressionCompiler;
+
+    // The handle of the loaded shared object.
+    void* handle;
+
+    // The functions of the compiled expressions.
+    std::unordered_map<storm::expressions::BaseExpression const*, IntegerFunction> integerFunctions;
+    std::unordered_map<storm::expressions::BaseExpression const*, DoubleFunction> doubleFunctions;
+};
+
+/*!
+ * Translates expressions over the variables of a model to C++ (via the ToCppVisitor) and compiles them with an external compiler into a shared
+ * object that is loaded at runtime. The shared objects are cached in a directory and reused if the same code is compiled again.
+ * Rational expressions are evaluated in double precision. Expressions referring to variables that are not part of the state, integer
+ * divisions and predicates are not compiled.
+ */
+class NativeStateExpressionCompiler {
+   public:
+    NativeStateExpressionCompiler(VariableInformation const& variableInformation);
+
+    /*!
+     * Adds the given expression to the expressions that are to be compiled. The expression must be kept alive as long as the compiled
+     * expressions are used, since they are identified by the address of the expression.
+     *
+     * @return True iff the expression can be compiled.
+     */
+    bool addExpression(storm::expressions::Expression const& expression);
+
+    /*!
+     * Retrieves the C++ code of all added expressions.
+     */
+    std::string getCode() const;
+
+    /*!
+     * Compiles all added expressions.
+     *
+     * @param compiler The command invoking the C++ compiler.
+     * @param directory The directory in which the compiled code is cached (if empty, a per-user directory in TMPDIR or /tmp is used). Only
+     * directories and shared objects that belong to the current user and are not writable by others are used.
+     * @return The compiled expressions or null if the compilation failed.
+     */
+    std::shared_ptr<NativeStateExpressions> compile(std::string const& compiler, std::string const& directory) const;
+
+   private:
+    // The C++ code that reads the variables from the bits of the state.
+    std::unordered_map<storm::expressions::Variable, std::string> variableCode;
+
+    // The added expressions.
+    std::vector<storm::expressions::Expression> expressions;
+    std::unordered_map<storm::expressions::BaseExpression const*, uint64_t> expressionIndices;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -41,6 +41,7 @@ NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions:
       variableInformation(variableInformation),
       evaluator(nullptr),
       state(nullptr),
+      evaluatorStateValid(false),
       actionMask(mask) {
     if (variableInformation.hasOutOfBoundsBit()) {
         outOfBoundsState = createOutOfBoundsState(variableInformation);
@@ -54,7 +55,13 @@ template<typename ValueType, typename StateType>
 NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager,
                                                              NextStateGeneratorOptions const& options,
                                                              std::shared_ptr<ActionMask<ValueType, StateType>> const& mask)
-    : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), actionMask(mask) {
+    : options(options),
+      expressionManager(expressionManager.getSharedPointer()),
+      variableInformation(),
+      evaluator(nullptr),
+      state(nullptr),
+      evaluatorStateValid(false),
+      actionMask(mask) {
     if (variableInformation.hasOutOfBoundsBit()) {
         outOfBoundsState = createOutOfBoundsState(variableInformation);
     }
@@ -85,9 +92,25 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
     for (auto const& v : variableInformation.integerVariables) {
         result.addVariable(v.variable);
     }
+    if (options.isBuildStateValuationsLazilySet()) {
+        if (canDecodeStateValuations()) {
+            result.setCompressedStateDecoder(
+                getStateSize(), [variableInformation = variableInformation](storm::storage::BitVector const& compressedState, std::vector<bool>& booleanValues,
+                                                                            std::vector<int64_t>& integerValues) {
+                    extractVariableValues(compressedState, variableInformation, integerValues, booleanValues, integerValues);
+                });
+        } else {
+            STORM_LOG_WARN("The state valuations are stored explicitly as they can not be derived from the compressed states.");
+        }
+    }
     return result;
 }
 
+template<typename ValueType, typename StateType>
+bool NextStateGenerator<ValueType, StateType>::canDecodeStateValuations() const {
+    return true;
+}
+
 template<typename ValueType, typename StateType>
 storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeObservationValuationsBuilder() const {
     storm::storage::sparse::StateValuationsBuilder result;
@@ -109,13 +132,65 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
 
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
-    // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-    unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+    // Since almost all subsequent operations are based on the evaluator, we load the state into it now. If the evaluator holds the values of a
+    // state of the same size, it suffices to update the variables in the blocks that differ.
+    if (evaluatorStateValid && evaluatorState.size() == state.size()) {
+        if (variablesByBlock.empty()) {
+            uint64_t numberOfBlocks = (state.size() + 63) / 64;
+            variablesByBlock.resize(numberOfBlocks);
+            auto addVariable = [&](uint8_t kind, uint64_t index, uint64_t bitOffset, uint64_t bitWidth) {
+                for (uint64_t block = bitOffset / 64; block < numberOfBlocks && block * 64 < bitOffset + std::max<uint64_t>(bitWidth, 1); ++block) {
+                    variablesByBlock[block].emplace_back(kind, index);
+                }
+            };
+            for (uint64_t i = 0; i < variableInformation.locationVariables.size(); ++i) {
+                addVariable(0, i, variableInformation.locationVariables[i].bitOffset, variableInformation.locationVariables[i].bitWidth);
+            }
+            for (uint64_t i = 0; i < variableInformation.booleanVariables.size(); ++i) {
+                addVariable(1, i, variableInformation.booleanVariables[i].bitOffset, 1);
+            }
+            for (uint64_t i = 0; i < variableInformation.integerVariables.size(); ++i) {
+                addVariable(2, i, variableInformation.integerVariables[i].bitOffset, variableInformation.integerVariables[i].bitWidth);
+            }
+        }
+
+        for (uint64_t block = 0; block < variablesByBlock.size(); ++block) {
+            uint64_t blockWidth = std::min<uint64_t>(64, state.size() - block * 64);
+            if (state.getAsInt(block * 64, blockWidth) == evaluatorState.getAsInt(block * 64, blockWidth)) {
+                continue;
+            }
+            for (auto const& kindIndexPair : variablesByBlock[block]) {
+                if (kindIndexPair.first == 0) {
+                    auto const& locationVariable = variableInformation.locationVariables[kindIndexPair.second];
+                    if (locationVariable.bitWidth != 0) {
+                        evaluator->setIntegerValue(locationVariable.variable, state.getAsInt(locationVariable.bitOffset, locationVariable.bitWidth));
+                    }
+                } else if (kindIndexPair.first == 1) {
+                    auto const& booleanVariable = variableInformation.booleanVariables[kindIndexPair.second];
+                    evaluator->setBooleanValue(booleanVariable.variable, state.get(booleanVariable.bitOffset));
+                } else {
+                    auto const& integerVariable = variableInformation.integerVariables[kindIndexPair.second];
+                    evaluator->setIntegerValue(integerVariable.variable,
+                                               static_cast<int_fast64_t>(state.getAsInt(integerVariable.bitOffset, integerVariable.bitWidth)) +
+                                                   integerVariable.lowerBound);
+                }
+            }
+        }
+    } else {
+        unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+    }
+    evaluatorState = state;
+    evaluatorStateValid = true;
 
     // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
     this->state = &state;
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::invalidateEvaluatorState() const {
+    evaluatorStateValid = false;
+}
+
 template<typename ValueType, typename StateType>
 bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Expression const& expression) const {
     if (expression.isTrue()) {
@@ -132,6 +207,10 @@ VariableInformation const& NextStateGenerator<ValueType, StateType>::getVariable
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
                                                                  storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const {
+    if (valuationsBuilder.isLazy()) {
+        valuationsBuilder.addCompressedState(currentStateIndex, *this->state);
+        return;
+    }
     std::vector<bool> booleanValues;
     booleanValues.reserve(variableInformation.booleanVariables.size());
     std::vector<int64_t> integerValues;
@@ -207,6 +286,7 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
             }
         }
     }
+    invalidateEvaluatorState();
 
     if (!result.containsLabel("init")) {
         // Also label the initial state with the special label "init".
@@ -159,8 +159,19 @@ class NextStateGenerator {
 
     virtual storm::storage::sparse::StateValuationsBuilder initializeObservationValuationsBuilder() const;
 
+    /*!
+     * Retrieves whether the valuation of a state can be derived from the compressed state alone, which is required for lazy state valuations.
+     */
+    virtual bool canDecodeStateValuations() const;
+
     void postprocess(StateBehavior<ValueType, StateType>& result);
 
+    /*!
+     * Indicates that the evaluator no longer holds the values of the most recently loaded state (e.g. because another state was unpacked into
+     * it), so that the next load has to unpack all variables.
+     */
+    void invalidateEvaluatorState() const;
+
     /// The options to be used for next-state generation.
     NextStateGeneratorOptions options;
 
@@ -179,6 +190,15 @@ class NextStateGenerator {
     /// The currently loaded state.
     CompressedState const* state;
 
+    /// A copy of the state whose values are held by the evaluator. Loading another state then only needs to update the variables stored in
+    /// the 64-bit blocks of the state that changed.
+    CompressedState evaluatorState;
+    mutable bool evaluatorStateValid;
+
+    /// For each 64-bit block of the states, the variables (as pairs of the variable kind and the index in the variable information) that are
+    /// stored (partly) in that block. Constructed upon first use.
+    std::vector<std::vector<std::pair<uint8_t, uint64_t>>> variablesByBlock;
+
     /// A comparator used to compare constants.
     storm::utility::ConstantsComparator<ValueType> comparator;
 
@@ -1,5 +1,6 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
 #include <boost/any.hpp>
 #include <boost/container/flat_map.hpp>
 
@@ -14,7 +15,11 @@
 
 #include "storm/solver/SmtSolver.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -37,7 +42,11 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 template<typename ValueType, typename StateType>
 PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                                                                        std::shared_ptr<ActionMask<ValueType, StateType>> const& mask, bool)
-    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask), program(program), rewardModels(), hasStateActionRewards(false) {
+    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask),
+      program(program),
+      rewardModels(),
+      hasStateActionRewards(false),
+      numberOfKnownStates(0) {
     STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
     STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException,
                     "The explicit next-state generator currently does not support custom system compositions.");
@@ -101,6 +110,307 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    compileExpressions();
+    buildGuardIndices();
+    detectSymmetries();
+    determinePartialOrderReductionModules();
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    StateExpressionCompiler compiler(this->variableInformation);
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            if (command.getGlobalIndex() >= compiledGuards.size()) {
+                compiledGuards.resize(command.getGlobalIndex() + 1);
+            }
+            compiledGuards[command.getGlobalIndex()] = compiler.compile(command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                if (update.getGlobalIndex() >= compiledAssignments.size()) {
+                    compiledAssignments.resize(update.getGlobalIndex() + 1);
+                }
+                auto& assignments = compiledAssignments[update.getGlobalIndex()];
+                assignments.clear();
+                for (auto const& assignment : update.getAssignments()) {
+                    assignments.push_back(compiler.compile(assignment.getExpression()));
+                }
+            }
+        }
+    }
+
+    if (this->options.isNativeExpressionCompilationSet()) {
+        compileNativeExpressions();
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileNativeExpressions() {
+    // Rational expressions are evaluated in double precision by the native code, so they are only compiled if the model is built with doubles.
+    bool const compileRationalExpressions = std::is_same<ValueType, double>::value;
+    NativeStateExpressionCompiler compiler(this->variableInformation);
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            compiler.addExpression(command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                if (compileRationalExpressions) {
+                    compiler.addExpression(update.getLikelihoodExpression());
+                }
+                for (auto const& assignment : update.getAssignments()) {
+                    compiler.addExpression(assignment.getExpression());
+                }
+            }
+        }
+    }
+    for (auto const& rewardModel : rewardModels) {
+        for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+            compiler.addExpression(stateReward.getStatePredicateExpression());
+            if (compileRationalExpressions) {
+                compiler.addExpression(stateReward.getRewardValueExpression());
+            }
+        }
+        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            compiler.addExpression(stateActionReward.getStatePredicateExpression());
+            if (compileRationalExpressions) {
+                compiler.addExpression(stateActionReward.getRewardValueExpression());
+            }
+        }
+    }
+
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    nativeExpressions = compiler.compile(buildSettings.getNativeExpressionCompiler(), buildSettings.getNativeExpressionDirectory());
+    if (!nativeExpressions) {
+        return;
+    }
+
+    nativeGuards.resize(compiledGuards.size(), nullptr);
+    nativeAssignments.resize(compiledAssignments.size());
+    nativeLikelihoods.resize(compiledAssignments.size(), nullptr);
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            nativeGuards[command.getGlobalIndex()] = nativeExpressions->getIntegerFunction(command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                nativeLikelihoods[update.getGlobalIndex()] = nativeExpressions->getDoubleFunction(update.getLikelihoodExpression());
+                auto& assignments = nativeAssignments[update.getGlobalIndex()];
+                assignments.clear();
+                for (auto const& assignment : update.getAssignments()) {
+                    assignments.push_back(nativeExpressions->getIntegerFunction(assignment.getExpression()));
+                }
+            }
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        storm::prism::Module const& module = program.getModule(i);
+
+        std::vector<std::pair<uint_fast64_t, storm::expressions::Expression>> commands;
+        for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+            if (!isCommandPotentiallySynchronizing(module.getCommand(j))) {
+                commands.emplace_back(j, module.getCommand(j).getGuardExpression());
+            }
+        }
+        asynchronousGuardIndices.emplace_back(commands, this->variableInformation);
+
+        synchronousGuardIndices.emplace_back();
+        for (auto const& actionNameIndexPair : program.getActionNameToIndexMapping()) {
+            if (!module.hasActionIndex(actionNameIndexPair.second)) {
+                continue;
+            }
+            commands.clear();
+            for (auto commandIndex : module.getCommandIndicesByActionIndex(actionNameIndexPair.second)) {
+                commands.emplace_back(commandIndex, module.getCommand(commandIndex).getGuardExpression());
+            }
+            synchronousGuardIndices.back().emplace(actionNameIndexPair.second, GuardIndex(commands, this->variableInformation));
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::detectSymmetries() {
+    if (!this->options.isSymmetryReductionSet()) {
+        return;
+    }
+    if (program.getModelType() == storm::prism::Program::ModelType::POMDP || program.getModelType() == storm::prism::Program::ModelType::SMG ||
+        this->actionMask != nullptr) {
+        STORM_LOG_WARN("Symmetry reduction is not supported for POMDPs, SMGs and action masks. Exploring the full state space.");
+        return;
+    }
+
+    // Everything that is observable in the resulting model has to be invariant under the symmetry.
+    std::vector<storm::expressions::Expression> invariantExpressions;
+    if (this->options.isBuildAllLabelsSet()) {
+        for (auto const& label : program.getLabels()) {
+            invariantExpressions.push_back(label.getStatePredicateExpression());
+        }
+    } else {
+        for (auto const& labelName : this->options.getLabelNames()) {
+            if (program.hasLabel(labelName)) {
+                invariantExpressions.push_back(program.getLabelExpression(labelName));
+            }
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        invariantExpressions.push_back(expressionLabel.second);
+    }
+    for (auto const& expressionBool : this->terminalStates) {
+        invariantExpressions.push_back(expressionBool.first);
+    }
+    for (auto const& rewardModel : rewardModels) {
+        for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+            invariantExpressions.push_back(stateReward.getStatePredicateExpression());
+            invariantExpressions.push_back(stateReward.getRewardValueExpression());
+        }
+        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            invariantExpressions.push_back(stateActionReward.getStatePredicateExpression());
+            invariantExpressions.push_back(stateActionReward.getRewardValueExpression());
+        }
+        for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+            invariantExpressions.push_back(transitionReward.getSourceStatePredicateExpression());
+            invariantExpressions.push_back(transitionReward.getTargetStatePredicateExpression());
+            invariantExpressions.push_back(transitionReward.getRewardValueExpression());
+        }
+    }
+
+    symmetry = ModuleSymmetry(program, this->variableInformation, invariantExpressions);
+    STORM_LOG_WARN_COND(!symmetry.empty(), "Symmetry reduction was requested, but no symmetric modules were found.");
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::determinePartialOrderReductionModules() {
+    if (!this->options.isPartialOrderReductionSet()) {
+        return;
+    }
+    if (!symmetry.empty()) {
+        STORM_LOG_WARN("Partial order reduction is not supported in combination with symmetry reduction. Exploring all interleavings.");
+        return;
+    }
+    if (program.getModelType() != storm::prism::Program::ModelType::MDP || !rewardModels.empty() || this->actionMask != nullptr) {
+        STORM_LOG_WARN("Partial order reduction is only supported for MDPs without reward models and action masks. Exploring the full state space.");
+        return;
+    }
+
+    // Collect all variables that are observable through the labeling or the terminal states.
+    std::set<storm::expressions::Variable> visibleVariables;
+    auto addVariables = [](std::set<storm::expressions::Variable>& variables, storm::expressions::Expression const& expression) {
+        auto const& expressionVariables = expression.getVariables();
+        variables.insert(expressionVariables.begin(), expressionVariables.end());
+    };
+    if (this->options.isBuildAllLabelsSet()) {
+        for (auto const& label : program.getLabels()) {
+            addVariables(visibleVariables, label.getStatePredicateExpression());
+        }
+    } else {
+        for (auto const& labelName : this->options.getLabelNames()) {
+            if (program.hasLabel(labelName)) {
+                addVariables(visibleVariables, program.getLabelExpression(labelName));
+            }
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        addVariables(visibleVariables, expressionLabel.second);
+    }
+    for (auto const& expressionBool : this->terminalStates) {
+        addVariables(visibleVariables, expressionBool.first);
+    }
+
+    // Collect the variables that are read or written by the commands of each module.
+    std::vector<std::set<storm::expressions::Variable>> accessedVariables(program.getNumberOfModules());
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        for (auto const& command : program.getModule(i).getCommands()) {
+            addVariables(accessedVariables[i], command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                addVariables(accessedVariables[i], update.getLikelihoodExpression());
+                for (auto const& assignment : update.getAssignments()) {
+                    accessedVariables[i].insert(assignment.getVariable());
+                    addVariables(accessedVariables[i], assignment.getExpression());
+                }
+            }
+        }
+    }
+
+    // A module is independent of all others if it only accesses its own variables. If its variables are in
+    // addition invisible, its asynchronous commands may be executed before all other commands.
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        std::set<storm::expressions::Variable> localVariables = program.getModule(i).getAllExpressionVariables();
+        bool isCandidate = program.getModule(i).getNumberOfCommands() > 0 &&
+                           std::includes(localVariables.begin(), localVariables.end(), accessedVariables[i].begin(), accessedVariables[i].end());
+        for (auto const& variable : localVariables) {
+            if (!isCandidate) {
+                break;
+            }
+            isCandidate = visibleVariables.count(variable) == 0;
+            for (uint_fast64_t j = 0; isCandidate && j < program.getNumberOfModules(); ++j) {
+                isCandidate = i == j || accessedVariables[j].count(variable) == 0;
+            }
+        }
+        if (isCandidate) {
+            partialOrderReductionModules.push_back(i);
+        }
+    }
+    STORM_LOG_INFO("Partial order reduction may prune the interleavings of " << partialOrderReductionModules.size() << " of "
+                                                                             << program.getNumberOfModules() << " modules.");
+}
+
+template<typename ValueType, typename StateType>
+boost::optional<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoice(StateToIdCallback const& stateToIdCallback) {
+    for (auto moduleIndex : partialOrderReductionModules) {
+        // The module needs to have exactly one enabled command, which must not be synchronizing. As the guards
+        // only refer to variables of the module, this remains true until the command is executed.
+        uint_fast64_t numberOfEnabledCommands = 0;
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            if (isCommandEnabled(command)) {
+                ++numberOfEnabledCommands;
+                if (numberOfEnabledCommands > 1 || isCommandPotentiallySynchronizing(command)) {
+                    numberOfEnabledCommands = 0;
+                    break;
+                }
+            }
+        }
+        if (numberOfEnabledCommands != 1) {
+            continue;
+        }
+
+        // To not postpone the other commands indefinitely, all successors need to be new states. Otherwise, the
+        // reduced transition might close a cycle in which no state is fully expanded.
+        StateType firstNewState = numberOfKnownStates;
+        std::vector<Choice<ValueType>> choices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::All, moduleIndex);
+        STORM_LOG_ASSERT(choices.size() == 1, "Expected exactly one choice.");
+        if (std::all_of(choices.front().begin(), choices.front().end(),
+                        [firstNewState](auto const& stateProbabilityPair) { return stateProbabilityPair.first >= firstNewState; })) {
+            return std::move(choices.front());
+        }
+    }
+    return boost::none;
+}
+
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::getCanonicalStateToIdCallback(
+    StateToIdCallback const& stateToIdCallback) const {
+    if (symmetry.empty()) {
+        return StateToIdCallback();
+    }
+    return [this, &stateToIdCallback](CompressedState const& state) {
+        CompressedState canonicalState = state;
+        symmetry.canonicalize(canonicalState);
+        return stateToIdCallback(canonicalState);
+    };
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isCommandEnabled(storm::prism::Command const& command) const {
+    if (nativeExpressions) {
+        if (auto nativeGuard = nativeGuards[command.getGlobalIndex()]) {
+            return NativeStateExpressions::evaluate(nativeGuard, *this->state) != 0;
+        }
+    }
+    auto const& compiledGuard = compiledGuards[command.getGlobalIndex()];
+    if (compiledGuard) {
+        return compiledGuard->evaluateAsBool(*this->state);
+    }
+    return this->evaluator->asBool(command.getGuardExpression());
 }
 
 template<typename ValueType, typename StateType>
@@ -178,7 +488,9 @@ bool PrismNextStateGenerator<ValueType, StateType>::isPartiallyObservable() cons
 }
 
 template<typename ValueType, typename StateType>
-std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& originalStateToIdCallback) {
+    StateToIdCallback canonicalStateToIdCallback = getCanonicalStateToIdCallback(originalStateToIdCallback);
+    StateToIdCallback const& stateToIdCallback = symmetry.empty() ? originalStateToIdCallback : canonicalStateToIdCallback;
     std::vector<StateType> initialStateIndices;
 
     // If all states are initial, we can simplify the enumeration substantially.
@@ -275,26 +587,31 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
         STORM_LOG_DEBUG("Enumerated " << initialStateIndices.size() << " initial states using SMT solving.");
     }
 
+    if (!symmetry.empty()) {
+        // Symmetric initial states are represented by the same state.
+        std::sort(initialStateIndices.begin(), initialStateIndices.end());
+        initialStateIndices.erase(std::unique(initialStateIndices.begin(), initialStateIndices.end()), initialStateIndices.end());
+    }
+
+    for (auto const& id : initialStateIndices) {
+        numberOfKnownStates = std::max(numberOfKnownStates, static_cast<StateType>(id + 1));
+    }
+
     return initialStateIndices;
 }
 
 template<typename ValueType, typename StateType>
-StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& originalStateToIdCallback) {
+    StateToIdCallback canonicalStateToIdCallback = getCanonicalStateToIdCallback(originalStateToIdCallback);
+    StateToIdCallback const& stateToIdCallback = symmetry.empty() ? originalStateToIdCallback : canonicalStateToIdCallback;
+
     // Prepare the result, in case we return early.
     StateBehavior<ValueType, StateType> result;
 
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
     for (auto const& rewardModel : rewardModels) {
-        ValueType stateRewardValue = storm::utility::zero<ValueType>();
-        if (rewardModel.get().hasStateRewards()) {
-            for (auto const& stateReward : rewardModel.get().getStateRewards()) {
-                if (this->evaluator->asBool(stateReward.getStatePredicateExpression())) {
-                    stateRewardValue += ValueType(this->evaluator->asRational(stateReward.getRewardValueExpression()));
-                }
-            }
-        }
-        result.addStateReward(stateRewardValue);
+        result.addStateReward(evaluateStateReward(rewardModel.get()));
     }
 
     // If a terminal expression was set and we must not expand this state, return now.
@@ -310,7 +627,21 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     result.setExpanded();
 
     std::vector<Choice<ValueType>> allChoices;
-    if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+    if (!partialOrderReductionModules.empty()) {
+        // Keep track of the states that were discovered so far to be able to recognize new states.
+        StateToIdCallback trackingStateToIdCallback = [this, &stateToIdCallback](CompressedState const& state) {
+            StateType id = stateToIdCallback(state);
+            numberOfKnownStates = std::max(numberOfKnownStates, static_cast<StateType>(id + 1));
+            return id;
+        };
+        boost::optional<Choice<ValueType>> ampleChoice = getAmpleChoice(trackingStateToIdCallback);
+        if (ampleChoice) {
+            allChoices.push_back(std::move(ampleChoice.get()));
+        } else {
+            allChoices = getAsynchronousChoices(*this->state, trackingStateToIdCallback);
+            addSynchronousChoices(allChoices, *this->state, trackingStateToIdCallback);
+        }
+    } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
         allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
@@ -374,9 +705,9 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
                 for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
                     for (auto const& choice : allChoices) {
                         if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                            evaluateBooleanExpressionInCurrentState(stateActionReward.getStatePredicateExpression())) {
                             stateActionRewardValue +=
-                                ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression())) * choice.getTotalMass();
+                                evaluateRationalExpressionInCurrentState(stateActionReward.getRewardValueExpression()) * choice.getTotalMass();
                         }
                     }
                 }
@@ -426,13 +757,73 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
+    if (nativeExpressions) {
+        if (auto function = nativeExpressions->getIntegerFunction(expr)) {
+            return NativeStateExpressions::evaluate(function, *this->state) != 0;
+        }
+    }
     return this->evaluator->asBool(expr);
 }
 
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateRationalExpressionInCurrentState(expressions::Expression const& expr) const {
+    if (nativeExpressions) {
+        if (auto function = nativeExpressions->getDoubleFunction(expr)) {
+            return storm::utility::convertNumber<ValueType>(NativeStateExpressions::evaluate(function, *this->state));
+        }
+    }
+    return this->evaluator->asRational(expr);
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateStateReward(storm::prism::RewardModel const& rewardModel) const {
+    ValueType stateRewardValue = storm::utility::zero<ValueType>();
+    if (rewardModel.hasStateRewards()) {
+        for (auto const& stateReward : rewardModel.getStateRewards()) {
+            if (evaluateBooleanExpressionInCurrentState(stateReward.getStatePredicateExpression())) {
+                stateRewardValue += evaluateRationalExpressionInCurrentState(stateReward.getRewardValueExpression());
+            }
+        }
+    }
+    return stateRewardValue;
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateStateActionReward(storm::prism::RewardModel const& rewardModel,
+                                                                                   uint_fast64_t actionIndex) const {
+    ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+    if (rewardModel.hasStateActionRewards()) {
+        for (auto const& stateActionReward : rewardModel.getStateActionRewards()) {
+            if (stateActionReward.getActionIndex() == actionIndex &&
+                evaluateBooleanExpressionInCurrentState(stateActionReward.getStatePredicateExpression())) {
+                stateActionRewardValue += evaluateRationalExpressionInCurrentState(stateActionReward.getRewardValueExpression());
+            }
+        }
+    }
+    return stateActionRewardValue;
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateLikelihood(storm::prism::Update const& update) const {
+    if (nativeExpressions) {
+        if (auto nativeLikelihood = nativeLikelihoods[update.getGlobalIndex()]) {
+            return storm::utility::convertNumber<ValueType>(NativeStateExpressions::evaluate(nativeLikelihood, *this->state));
+        }
+    }
+    return this->evaluator->asRational(update.getLikelihoodExpression());
+}
+
 template<typename ValueType, typename StateType>
 CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
     CompressedState newState(state);
+    if (!applyUpdateInPlace(newState, update)) {
+        return this->outOfBoundsState;
+    }
+    return newState;
+}
 
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::applyUpdateInPlace(CompressedState& newState, storm::prism::Update const& update) {
     // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
     // assignments to boolean variables precede the assignments to all integer variables and that within the
     // types, the assignments to variables are ordered (in ascending order) by the expression variables.
@@ -440,26 +831,46 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 
     auto assignmentIt = update.getAssignments().begin();
     auto assignmentIte = update.getAssignments().end();
+    auto compiledAssignmentIt = compiledAssignments[update.getGlobalIndex()].begin();
+    NativeStateExpressions::IntegerFunction const* nativeAssignmentIt = nativeExpressions ? nativeAssignments[update.getGlobalIndex()].data() : nullptr;
 
     // Iterate over all boolean assignments and carry them out.
     auto boolIt = this->variableInformation.booleanVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != boolIt->variable) {
             ++boolIt;
         }
-        newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+        // Like the evaluator, the compiled expressions are evaluated in the loaded state (which differs from the given one for synchronizing updates).
+        if (nativeAssignmentIt && *nativeAssignmentIt) {
+            newState.set(boolIt->bitOffset, NativeStateExpressions::evaluate(*nativeAssignmentIt, *this->state) != 0);
+        } else {
+            newState.set(boolIt->bitOffset, *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsBool(*this->state)
+                                                                  : this->evaluator->asBool(assignmentIt->getExpression()));
+        }
+        if (nativeAssignmentIt) {
+            ++nativeAssignmentIt;
+        }
     }
 
     // Iterate over all integer assignments and carry them out.
     auto integerIt = this->variableInformation.integerVariables.begin();
-    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
+    for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt, ++compiledAssignmentIt) {
         while (assignmentIt->getVariable() != integerIt->variable) {
             ++integerIt;
         }
-        int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+        int_fast64_t assignedValue;
+        if (nativeAssignmentIt && *nativeAssignmentIt) {
+            assignedValue = NativeStateExpressions::evaluate(*nativeAssignmentIt, *this->state);
+        } else {
+            assignedValue =
+                *compiledAssignmentIt ? (*compiledAssignmentIt)->evaluateAsInt(*this->state) : this->evaluator->asInt(assignmentIt->getExpression());
+        }
+        if (nativeAssignmentIt) {
+            ++nativeAssignmentIt;
+        }
         if (this->options.isAddOutOfBoundsStateSet()) {
             if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
-                return this->outOfBoundsState;
+                return false;
             }
         } else if (integerIt->forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
             STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException,
@@ -478,18 +889,18 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
     // Check that we processed all assignments.
     STORM_LOG_ASSERT(assignmentIt == assignmentIte, "Not all assignments were consumed.");
 
-    return newState;
+    return true;
 }
 
 struct ActiveCommandData {
-    ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
-                      typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
+    ActiveCommandData(storm::prism::Module const* modulePtr, std::vector<uint_fast64_t> const* commandIndicesPtr,
+                      typename std::vector<uint_fast64_t>::const_iterator currentCommandIndexIt)
         : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
         // Intentionally left empty
     }
     storm::prism::Module const* modulePtr;
-    std::set<uint_fast64_t> const* commandIndicesPtr;
-    typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
+    std::vector<uint_fast64_t> const* commandIndicesPtr;
+    typename std::vector<uint_fast64_t>::const_iterator currentCommandIndexIt;
 };
 
 template<typename ValueType, typename StateType>
@@ -510,14 +921,15 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
             continue;
         }
 
-        std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
-
         // If the module contains the action, but there is no command in the module that is labeled with
         // this action, we don't have any feasible command combinations.
-        if (commandIndices.empty()) {
+        if (module.getCommandIndicesByActionIndex(actionIndex).empty()) {
             return boost::none;
         }
 
+        // Only the commands whose guards are not known to be violated need to be considered.
+        std::vector<uint_fast64_t> const& commandIndices = synchronousGuardIndices[i].at(actionIndex).getCandidates(*this->state);
+
         // Look up commands by their indices and check if the guard evaluates to true in the given state.
         bool hasOneEnabledCommand = false;
         for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
@@ -531,7 +943,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
                 activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -565,7 +977,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 commands.push_back(command);
             }
         }
@@ -580,21 +992,21 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
 template<typename ValueType, typename StateType>
 std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAsynchronousChoices(CompressedState const& state,
                                                                                                      StateToIdCallback stateToIdCallback,
-                                                                                                     CommandFilter const& commandFilter) {
+                                                                                                     CommandFilter const& commandFilter,
+                                                                                                     boost::optional<uint_fast64_t> const& moduleIndex) {
     std::vector<Choice<ValueType>> result;
 
-    // Iterate over all modules.
+    // Iterate over all (selected) modules.
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        if (moduleIndex && i != moduleIndex.get()) {
+            continue;
+        }
         storm::prism::Module const& module = program.getModule(i);
 
-        // Iterate over all commands.
-        for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+        // Iterate over all commands that are not possibly synchronizing and whose guards are not known to be violated.
+        for (uint_fast64_t j : asynchronousGuardIndices[i].getCandidates(state)) {
             storm::prism::Command const& command = module.getCommand(j);
 
-            // Only consider commands that are not possibly synchronizing.
-            if (isCommandPotentiallySynchronizing(command))
-                continue;
-
             if (commandFilter != CommandFilter::All) {
                 STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
                 if ((commandFilter == CommandFilter::Markovian) != command.isMarkovian()) {
@@ -608,7 +1020,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isCommandEnabled(command)) {
                 continue;
             }
 
@@ -626,7 +1038,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                 storm::prism::Update const& update = command.getUpdate(k);
 
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                ValueType probability = evaluateLikelihood(update);
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
@@ -642,16 +1054,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
 
             // Create the state-action reward for the newly created choice.
             for (auto const& rewardModel : rewardModels) {
-                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateActionRewards()) {
-                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                        }
-                    }
-                }
-                choice.addReward(stateActionRewardValue);
+                choice.addReward(evaluateStateActionReward(rewardModel.get(), choice.getActionIndex()));
             }
 
             if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
@@ -692,7 +1095,7 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
             storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
+            generateSynchronizedDistribution(applyUpdate(state, update), probability * evaluateLikelihood(update),
                                              position + 1, iteratorList, distribution, stateToIdCallback);
         }
     }
@@ -776,16 +1179,7 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
 
                 // Create the state-action reward for the newly created choice.
                 for (auto const& rewardModel : rewardModels) {
-                    ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                    if (rewardModel.get().hasStateActionRewards()) {
-                        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                            if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                                this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                            }
-                        }
-                    }
-                    choice.addReward(stateActionRewardValue);
+                    choice.addReward(evaluateStateActionReward(rewardModel.get(), choice.getActionIndex()));
                 }
 
                 // Now, check whether there is one more command combination to consider.
@@ -806,6 +1200,172 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
     }
 }
 
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::sampleSuccessor(std::function<double()> const& random, CompressedState& successor,
+                                                                    std::vector<ValueType>* actionRewards) {
+    STORM_LOG_THROW(program.isDiscreteTimeModel(), storm::exceptions::NotSupportedException,
+                    "Sampling successors is only supported for discrete-time models.");
+    STORM_LOG_ASSERT(&successor != this->state, "The successor must not be the loaded state.");
+    STORM_LOG_ASSERT(!actionRewards || actionRewards->size() == rewardModels.size(), "Unexpected number of action rewards.");
+
+    for (auto const& expressionBool : this->terminalStates) {
+        if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+            return false;
+        }
+    }
+
+    auto isAsynchronousCommandEnabled = [this](storm::prism::Command const& command) {
+        if (this->actionMask != nullptr && !this->actionMask->query(*this, command.getActionIndex())) {
+            return false;
+        }
+        return isCommandEnabled(command);
+    };
+    auto setActionRewards = [this, actionRewards](uint_fast64_t actionIndex) {
+        if (actionRewards) {
+            for (uint64_t i = 0; i < rewardModels.size(); ++i) {
+                (*actionRewards)[i] = evaluateStateActionReward(rewardModels[i].get(), actionIndex);
+            }
+        }
+    };
+
+    // Count the enabled choices. Each enabled asynchronous command yields one choice and each synchronizing action yields one choice for
+    // every combination of enabled commands of the modules that have this action.
+    uint64_t numberOfChoices = 0;
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        for (uint_fast64_t j : asynchronousGuardIndices[i].getCandidates(*this->state)) {
+            if (isAsynchronousCommandEnabled(program.getModule(i).getCommand(j))) {
+                ++numberOfChoices;
+            }
+        }
+    }
+    for (uint_fast64_t actionIndex : program.getSynchronizingActionIndices()) {
+        numberOfChoices += getNumberOfSynchronousChoices(actionIndex);
+    }
+    if (numberOfChoices == 0) {
+        return false;
+    }
+
+    // Select one of the choices uniformly and locate it by repeating the enumeration.
+    uint64_t selectedChoice = std::min(static_cast<uint64_t>(random() * numberOfChoices), numberOfChoices - 1);
+    successor = *this->state;
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        for (uint_fast64_t j : asynchronousGuardIndices[i].getCandidates(*this->state)) {
+            storm::prism::Command const& command = program.getModule(i).getCommand(j);
+            if (!isAsynchronousCommandEnabled(command)) {
+                continue;
+            }
+            if (selectedChoice == 0) {
+                applySampledUpdate(command, random, successor);
+                setActionRewards(command.getActionIndex());
+                return true;
+            }
+            --selectedChoice;
+        }
+    }
+    for (uint_fast64_t actionIndex : program.getSynchronizingActionIndices()) {
+        uint64_t numberOfSynchronousChoices = getNumberOfSynchronousChoices(actionIndex);
+        if (selectedChoice >= numberOfSynchronousChoices) {
+            selectedChoice -= numberOfSynchronousChoices;
+            continue;
+        }
+
+        // Decode the selected combination of commands and apply the sampled updates of the commands one after another.
+        for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+            if (!program.getModule(i).hasActionIndex(actionIndex)) {
+                continue;
+            }
+            uint64_t numberOfCommands = getNumberOfEnabledSynchronizingCommands(i, actionIndex);
+            storm::prism::Command const& command = getEnabledSynchronizingCommand(i, actionIndex, selectedChoice % numberOfCommands);
+            selectedChoice /= numberOfCommands;
+            if (!applySampledUpdate(command, random, successor)) {
+                break;
+            }
+        }
+        setActionRewards(actionIndex);
+        return true;
+    }
+    STORM_LOG_ASSERT(false, "The selected choice was not found.");
+    return false;
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::addStateRewardsInCurrentState(std::vector<ValueType>& rewards) const {
+    STORM_LOG_ASSERT(rewards.size() == rewardModels.size(), "Unexpected number of rewards.");
+    for (uint64_t i = 0; i < rewardModels.size(); ++i) {
+        rewards[i] += evaluateStateReward(rewardModels[i].get());
+    }
+}
+
+template<typename ValueType, typename StateType>
+uint64_t PrismNextStateGenerator<ValueType, StateType>::getNumberOfEnabledSynchronizingCommands(uint_fast64_t moduleIndex, uint_fast64_t actionIndex) const {
+    storm::prism::Module const& module = program.getModule(moduleIndex);
+    if (module.getCommandIndicesByActionIndex(actionIndex).empty()) {
+        return 0;
+    }
+    uint64_t result = 0;
+    for (uint_fast64_t j : synchronousGuardIndices[moduleIndex].at(actionIndex).getCandidates(*this->state)) {
+        storm::prism::Command const& command = module.getCommand(j);
+        if (isCommandPotentiallySynchronizing(command) && isCommandEnabled(command)) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+storm::prism::Command const& PrismNextStateGenerator<ValueType, StateType>::getEnabledSynchronizingCommand(uint_fast64_t moduleIndex, uint_fast64_t actionIndex,
+                                                                                                         uint64_t position) const {
+    storm::prism::Module const& module = program.getModule(moduleIndex);
+    for (uint_fast64_t j : synchronousGuardIndices[moduleIndex].at(actionIndex).getCandidates(*this->state)) {
+        storm::prism::Command const& command = module.getCommand(j);
+        if (isCommandPotentiallySynchronizing(command) && isCommandEnabled(command)) {
+            if (position == 0) {
+                return command;
+            }
+            --position;
+        }
+    }
+    STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "The module '" << module.getName() << "' has not enough enabled commands.");
+}
+
+template<typename ValueType, typename StateType>
+uint64_t PrismNextStateGenerator<ValueType, StateType>::getNumberOfSynchronousChoices(uint_fast64_t actionIndex) {
+    if (this->actionMask != nullptr && !this->actionMask->query(*this, actionIndex)) {
+        return 0;
+    }
+    uint64_t result = 1;
+    for (uint_fast64_t i = 0; i < program.getNumberOfModules() && result > 0; ++i) {
+        if (program.getModule(i).hasActionIndex(actionIndex)) {
+            result *= getNumberOfEnabledSynchronizingCommands(i, actionIndex);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::applySampledUpdate(storm::prism::Command const& command, std::function<double()> const& random,
+                                                                       CompressedState& successor) {
+    double threshold = random();
+    storm::prism::Update const* selectedUpdate = nullptr;
+    for (auto const& update : command.getUpdates()) {
+        double probability = storm::utility::convertNumber<double>(evaluateLikelihood(update));
+        if (probability > 0.0) {
+            selectedUpdate = &update;
+            if (threshold < probability) {
+                break;
+            }
+            threshold -= probability;
+        }
+    }
+    STORM_LOG_THROW(selectedUpdate != nullptr, storm::exceptions::WrongFormatException,
+                    "The command '" << command << "' is enabled but has no update with positive probability.");
+    if (!applyUpdateInPlace(successor, *selectedUpdate)) {
+        successor = this->outOfBoundsState;
+        return false;
+    }
+    return true;
+}
+
 template<typename ValueType, typename StateType>
 std::map<std::string, storm::storage::PlayerIndex> PrismNextStateGenerator<ValueType, StateType>::getPlayerNameToIndexMap() const {
     return program.getPlayerNameToIndexMapping();
@@ -844,6 +1404,7 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
         return result;
     }
     unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+    this->invalidateEvaluatorState();
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result.setFromInt(64 * i, 64, this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression()));
     }
@@ -1,6 +1,10 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/ModuleSymmetry.h"
+#include "storm/generator/NativeStateExpressions.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -36,6 +40,26 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
     bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const&) const;
+    ValueType evaluateRationalExpressionInCurrentState(storm::expressions::Expression const&) const;
+
+    /*!
+     * Samples a successor of the currently loaded state without constructing the behavior of the state. One of the enabled choices (i.e. an
+     * asynchronous command or a combination of synchronizing commands) is selected uniformly, which resolves nondeterminism uniformly and
+     * matches the semantics of DTMCs, and the update of each involved command is selected according to its likelihood. The guards and
+     * assignments are evaluated by their compiled versions (where available) and no memory is allocated if the successor already has the
+     * size of the state.
+     *
+     * @param random A function that draws numbers uniformly from [0, 1).
+     * @param successor The sampled successor is written to this state. It must not be the loaded state.
+     * @param actionRewards If given, the state-action rewards of the selected choice are written to this vector (one entry per reward model).
+     * @return False iff the loaded state is terminal or has no enabled choice. In this case, the successor and the rewards are not modified.
+     */
+    bool sampleSuccessor(std::function<double()> const& random, CompressedState& successor, std::vector<ValueType>* actionRewards = nullptr);
+
+    /*!
+     * Adds the state rewards of the currently loaded state to the given vector (one entry per reward model).
+     */
+    void addStateRewardsInCurrentState(std::vector<ValueType>& rewards) const;
 
     virtual std::size_t getNumberOfRewardModels() const override;
     virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
@@ -67,6 +91,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      */
     CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
 
+    /*!
+     * Applies an update (evaluated in the state currently loaded into the evaluator) to the given state in place.
+     * @return False iff the update leads to an out-of-bounds value and out-of-bounds states are to be added. The state is then only partially updated.
+     */
+    bool applyUpdateInPlace(CompressedState& state, storm::prism::Update const& update);
+
     /*!
      * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
      * modules.
@@ -90,10 +120,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      * Retrieves all choices that are definitively asynchronous, possible from the given state.
      *
      * @param state The state for which to retrieve the unlabeled choices.
+     * @param moduleIndex If given, only the commands of this module are considered.
      * @return The asynchronous choices of the state.
      */
     std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                          CommandFilter const& commandFilter = CommandFilter::All);
+                                                          CommandFilter const& commandFilter = CommandFilter::All,
+                                                          boost::optional<uint_fast64_t> const& moduleIndex = boost::none);
 
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
@@ -125,6 +157,77 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Compiles the guards and the assigned expressions of the program (where possible).
+     */
+    void compileExpressions();
+
+    /*!
+     * Compiles the guards, the assigned expressions, the likelihoods and the rewards of the program to native code (where possible).
+     */
+    void compileNativeExpressions();
+
+    /*!
+     * Evaluates the likelihood of the given update in the currently loaded state.
+     */
+    ValueType evaluateLikelihood(storm::prism::Update const& update) const;
+
+    /*!
+     * Evaluates the (state-action) reward of the given reward model in the currently loaded state (for the given action).
+     */
+    ValueType evaluateStateReward(storm::prism::RewardModel const& rewardModel) const;
+    ValueType evaluateStateActionReward(storm::prism::RewardModel const& rewardModel, uint_fast64_t actionIndex) const;
+
+    /*!
+     * Helpers for sampling successors: the number of enabled (potentially) synchronizing commands of the module with the given action, the
+     * enabled command at the given position among them and the number of enabled command combinations of the given action.
+     */
+    uint64_t getNumberOfEnabledSynchronizingCommands(uint_fast64_t moduleIndex, uint_fast64_t actionIndex) const;
+    storm::prism::Command const& getEnabledSynchronizingCommand(uint_fast64_t moduleIndex, uint_fast64_t actionIndex, uint64_t position) const;
+    uint64_t getNumberOfSynchronousChoices(uint_fast64_t actionIndex);
+
+    /*!
+     * Samples an update of the given command according to the likelihoods and applies it to the given successor.
+     * @return False iff the update led to the out-of-bounds state, which is then stored in the successor.
+     */
+    bool applySampledUpdate(storm::prism::Command const& command, std::function<double()> const& random, CompressedState& successor);
+
+    /*!
+     * Builds the guard indices for the commands of the modules.
+     */
+    void buildGuardIndices();
+
+    /*!
+     * Evaluates the guard of the given command in the currently loaded state.
+     */
+    bool isCommandEnabled(storm::prism::Command const& command) const;
+
+    /*!
+     * Detects the symmetric modules of the program if symmetry reduction is enabled.
+     */
+    void detectSymmetries();
+
+    /*!
+     * Retrieves a callback that replaces states by their canonical representatives before passing them to the given callback. If there are
+     * no symmetries, an empty callback is returned.
+     */
+    StateToIdCallback getCanonicalStateToIdCallback(StateToIdCallback const& stateToIdCallback) const;
+
+    /*!
+     * Determines the modules whose commands are independent of all other modules and do not affect the labeling
+     * or the terminal states, i.e., the modules whose interleavings may be pruned by partial order reduction.
+     */
+    void determinePartialOrderReductionModules();
+
+    /*!
+     * Tries to find a single choice of the currently loaded state whose exploration suffices (an ample set).
+     * This is the case for the only enabled command of an independent module whose synchronizing commands are
+     * all disabled, provided that all successors of the command are new states.
+     *
+     * @return The choice, if one was found.
+     */
+    boost::optional<Choice<ValueType>> getAmpleChoice(StateToIdCallback const& stateToIdCallback);
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
@@ -137,6 +240,35 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // The compiled guards indexed by the global command index (none if the guard could not be compiled).
+    std::vector<boost::optional<CompiledStateExpression>> compiledGuards;
+
+    // The compiled assigned expressions indexed by the global update index and the position of the assignment.
+    std::vector<std::vector<boost::optional<CompiledStateExpression>>> compiledAssignments;
+
+    // The expressions compiled to native code (if any) and their functions indexed like the compiled guards and assignments (null if the
+    // expression was not compiled). Likelihoods are only compiled for double precision.
+    std::shared_ptr<NativeStateExpressions> nativeExpressions;
+    std::vector<NativeStateExpressions::IntegerFunction> nativeGuards;
+    std::vector<std::vector<NativeStateExpressions::IntegerFunction>> nativeAssignments;
+    std::vector<NativeStateExpressions::DoubleFunction> nativeLikelihoods;
+
+    // For each module, an index over the guards of the commands that are not potentially synchronizing.
+    std::vector<GuardIndex> asynchronousGuardIndices;
+
+    // For each module, the indices over the guards of the commands labeled with the respective action index.
+    std::vector<std::map<uint_fast64_t, GuardIndex>> synchronousGuardIndices;
+
+    // The symmetric modules of the program that are exploited during the exploration.
+    ModuleSymmetry symmetry;
+
+    // The indices of the modules that are considered by the partial order reduction (empty if it is disabled).
+    std::vector<uint_fast64_t> partialOrderReductionModules;
+
+    // One plus the largest state index that was returned by a state-to-id callback so far. As new states receive
+    // consecutive indices, all states with larger indices were not discovered yet.
+    StateType numberOfKnownStates;
 };
 
 }  // namespace generator
@@ -0,0 +1,225 @@
+#include "storm/io/BinaryEncodingExporter.h"
+
+#include <fstream>
+#include <functional>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryEncodingFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace binary {
+namespace {
+
+// The number of elements that are buffered before they are written to the stream.
+static const uint64_t WriteBufferSize = 1ull << 16;
+
+struct PendingSection {
+    SectionKind kind;
+    std::string name;
+    uint64_t size;
+    std::function<void(std::ostream&)> writeData;
+};
+
+ModelTypeCode getModelTypeCode(storm::models::ModelType const& type) {
+    switch (type) {
+        case storm::models::ModelType::Dtmc:
+            return ModelTypeCode::Dtmc;
+        case storm::models::ModelType::Ctmc:
+            return ModelTypeCode::Ctmc;
+        case storm::models::ModelType::Mdp:
+            return ModelTypeCode::Mdp;
+        case storm::models::ModelType::MarkovAutomaton:
+            return ModelTypeCode::MarkovAutomaton;
+        case storm::models::ModelType::Pomdp:
+            return ModelTypeCode::Pomdp;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Models of type " << type << " can not be exported in the binary format.");
+    }
+}
+
+template<typename T>
+void writeArray(std::ostream& os, T const* data, uint64_t count) {
+    os.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+}
+
+// Writes the values returned by the given function for all indices in [0, count) using a fixed-size buffer.
+template<typename T, typename ValueFunction>
+void writeBuffered(std::ostream& os, uint64_t count, ValueFunction const& getValue) {
+    std::vector<T> buffer;
+    buffer.reserve(std::min(count, WriteBufferSize));
+    for (uint64_t index = 0; index < count; ++index) {
+        buffer.push_back(getValue(index));
+        if (buffer.size() == WriteBufferSize) {
+            writeArray(os, buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    writeArray(os, buffer.data(), buffer.size());
+}
+
+uint64_t getNumberOfWords(storm::storage::BitVector const& bitVector) {
+    return (bitVector.size() + 63) / 64;
+}
+
+PendingSection createBitVectorSection(SectionKind kind, std::string const& name, storm::storage::BitVector const& bitVector) {
+    return {kind, name, getNumberOfWords(bitVector) * sizeof(uint64_t), [&bitVector](std::ostream& os) {
+                writeBuffered<uint64_t>(os, getNumberOfWords(bitVector), [&bitVector](uint64_t word) {
+                    uint64_t numberOfBits = std::min<uint64_t>(64, bitVector.size() - word * 64);
+                    return static_cast<uint64_t>(bitVector.getAsInt(word * 64, numberOfBits)) << (64 - numberOfBits);
+                });
+            }};
+}
+
+PendingSection createValueSection(SectionKind kind, std::string const& name, std::vector<double> const& values) {
+    return {kind, name, values.size() * sizeof(double), [&values](std::ostream& os) { writeArray(os, values.data(), values.size()); }};
+}
+
+uint64_t alignOffset(uint64_t offset) {
+    return (offset + SectionAlignment - 1) / SectionAlignment * SectionAlignment;
+}
+
+void writePadding(std::ostream& os, uint64_t currentOffset, uint64_t targetOffset) {
+    static const char zeros[SectionAlignment] = {};
+    STORM_LOG_ASSERT(targetOffset >= currentOffset && targetOffset - currentOffset < SectionAlignment, "Unexpected padding.");
+    os.write(zeros, targetOffset - currentOffset);
+}
+
+void exportModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+    auto const& matrix = sparseModel->getTransitionMatrix();
+    std::vector<PendingSection> sections;
+
+    // The transition matrix.
+    sections.push_back({SectionKind::RowIndications, "", (matrix.getRowCount() + 1) * sizeof(uint64_t), [&matrix](std::ostream& os) {
+                            writeBuffered<uint64_t>(os, matrix.getRowCount() + 1,
+                                                    [&matrix](uint64_t row) { return static_cast<uint64_t>(matrix.begin(row) - matrix.begin()); });
+                        }});
+    sections.push_back({SectionKind::Columns, "", matrix.getEntryCount() * sizeof(uint64_t), [&matrix](std::ostream& os) {
+                            auto entryIt = matrix.begin();
+                            writeBuffered<uint64_t>(os, matrix.getEntryCount(), [&entryIt](uint64_t) { return (entryIt++)->getColumn(); });
+                        }});
+    sections.push_back({SectionKind::Values, "", matrix.getEntryCount() * sizeof(double), [&matrix](std::ostream& os) {
+                            auto entryIt = matrix.begin();
+                            writeBuffered<double>(os, matrix.getEntryCount(), [&entryIt](uint64_t) { return (entryIt++)->getValue(); });
+                        }});
+    if (sparseModel->isNondeterministicModel()) {
+        auto const& groups = matrix.getRowGroupIndices();
+        sections.push_back({SectionKind::RowGroupIndices, "", groups.size() * sizeof(uint64_t), [&groups](std::ostream& os) {
+                                writeBuffered<uint64_t>(os, groups.size(), [&groups](uint64_t group) { return static_cast<uint64_t>(groups[group]); });
+                            }});
+    }
+
+    // Labelings.
+    for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+        sections.push_back(createBitVectorSection(SectionKind::StateLabel, label, sparseModel->getStateLabeling().getStates(label)));
+    }
+    if (sparseModel->hasChoiceLabeling()) {
+        for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+            sections.push_back(createBitVectorSection(SectionKind::ChoiceLabel, label, sparseModel->getChoiceLabeling().getChoices(label)));
+        }
+    }
+
+    // Reward models.
+    for (auto const& rewardModel : sparseModel->getRewardModels()) {
+        STORM_LOG_THROW(!rewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                        "Transition rewards (of reward model '" << rewardModel.first << "') can not be exported in the binary format.");
+        if (rewardModel.second.hasStateRewards()) {
+            sections.push_back(createValueSection(SectionKind::StateRewards, rewardModel.first, rewardModel.second.getStateRewardVector()));
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            sections.push_back(createValueSection(SectionKind::StateActionRewards, rewardModel.first, rewardModel.second.getStateActionRewardVector()));
+        }
+        if (!rewardModel.second.hasStateRewards() && !rewardModel.second.hasStateActionRewards()) {
+            // Keep the (empty) reward model by writing zero state rewards.
+            uint64_t numberOfStates = sparseModel->getNumberOfStates();
+            sections.push_back({SectionKind::StateRewards, rewardModel.first, numberOfStates * sizeof(double), [numberOfStates](std::ostream& os) {
+                                    writeBuffered<double>(os, numberOfStates, [](uint64_t) { return 0.0; });
+                                }});
+        }
+    }
+
+    // Model type specific components.
+    if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
+        sections.push_back(createValueSection(SectionKind::ExitRates, "", sparseModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector()));
+    } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto ma = sparseModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        sections.push_back(createValueSection(SectionKind::ExitRates, "", ma->getExitRates()));
+        sections.push_back(createBitVectorSection(SectionKind::MarkovianStates, "", ma->getMarkovianStates()));
+    } else if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+        auto const& observations = sparseModel->as<storm::models::sparse::Pomdp<double>>()->getObservations();
+        sections.push_back({SectionKind::Observations, "", observations.size() * sizeof(uint32_t),
+                            [&observations](std::ostream& os) { writeArray(os, observations.data(), observations.size()); }});
+    }
+
+    // Determine the location of all names and sections.
+    FileHeader fileHeader;
+    std::copy(std::begin(Magic), std::end(Magic), fileHeader.magic);
+    fileHeader.version = FormatVersion;
+    fileHeader.endiannessMarker = EndiannessMarker;
+    fileHeader.valueType = ValueTypeCode::Double;
+    fileHeader.modelType = getModelTypeCode(sparseModel->getType());
+    fileHeader.numberOfStates = sparseModel->getNumberOfStates();
+    fileHeader.numberOfChoices = sparseModel->getNumberOfChoices();
+    fileHeader.numberOfEntries = matrix.getEntryCount();
+    fileHeader.numberOfSections = sections.size();
+
+    std::vector<SectionHeader> sectionHeaders;
+    uint64_t offset = sizeof(FileHeader) + sections.size() * sizeof(SectionHeader);
+    for (auto const& section : sections) {
+        sectionHeaders.push_back({section.kind, static_cast<uint32_t>(section.name.size()), offset, 0, section.size});
+        offset += section.name.size();
+    }
+    for (auto& sectionHeader : sectionHeaders) {
+        sectionHeader.offset = alignOffset(offset);
+        offset = sectionHeader.offset + sectionHeader.size;
+    }
+
+    // Write everything.
+    writeArray(os, &fileHeader, 1);
+    writeArray(os, sectionHeaders.data(), sectionHeaders.size());
+    offset = sizeof(FileHeader) + sections.size() * sizeof(SectionHeader);
+    for (auto const& section : sections) {
+        os.write(section.name.data(), section.name.size());
+        offset += section.name.size();
+    }
+    for (uint64_t sectionIndex = 0; sectionIndex < sections.size(); ++sectionIndex) {
+        writePadding(os, offset, sectionHeaders[sectionIndex].offset);
+        sections[sectionIndex].writeData(os);
+        offset = sectionHeaders[sectionIndex].offset + sectionHeaders[sectionIndex].size;
+    }
+}
+
+}  // namespace
+}  // namespace binary
+
+template<typename ValueType>
+void binaryExportSparseModel(std::string const& filename, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+        binary::exportModel(stream, sparseModel);
+        stream.close();
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Error while writing to file " << filename << ".");
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary format only supports models with double values.");
+    }
+}
+
+template void binaryExportSparseModel<double>(std::string const& filename, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+template void binaryExportSparseModel<storm::RationalNumber>(std::string const& filename,
+                                                             std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel);
+template void binaryExportSparseModel<storm::RationalFunction>(std::string const& filename,
+                                                               std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel);
+}  // namespace exporter
+}  // namespace storm
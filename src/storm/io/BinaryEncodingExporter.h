@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model into the binary format described in BinaryEncodingFormat.h. In contrast to DRN, this format can be loaded without
+ * parsing as all components are stored as aligned arrays. Only models with double values are supported. State valuations, choice origins and
+ * transition rewards are not exported.
+ *
+ * @param filename     File path
+ * @param sparseModel  Model to export
+ */
+template<typename ValueType>
+void binaryExportSparseModel(std::string const& filename, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace binary {
+
+/*
+ * Layout of the binary encoding of sparse models. All integers and values are stored in the byte order of the exporting machine, which the
+ * loader checks via the endianness marker in the header.
+ *
+ * - FileHeader
+ * - numberOfSections many SectionHeaders
+ * - The names of all sections (not null-terminated)
+ * - The data of all sections. Each section starts at an offset that is a multiple of SectionAlignment, so that the data can be accessed in place
+ *   after mapping the file into memory.
+ *
+ * Matrices are stored in CSR format (row indications, columns and values) and bit vectors are stored as 64-bit words, where the first bit is the
+ * most significant bit of the first word. An incomplete last word is padded with zeros at its least significant bits.
+ */
+
+// The first bytes of each file.
+static const char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+
+// Increased whenever the layout changes in a way older loaders cannot handle.
+static const uint32_t FormatVersion = 1;
+
+// Written as uint32_t to detect files that were exported on a machine with a different byte order.
+static const uint32_t EndiannessMarker = 0x01020304;
+
+// The offset of every section is a multiple of this number of bytes.
+static const uint64_t SectionAlignment = 64;
+
+enum class ValueTypeCode : uint32_t { Double = 0 };
+
+enum class ModelTypeCode : uint32_t { Dtmc = 0, Ctmc = 1, Mdp = 2, MarkovAutomaton = 3, Pomdp = 4 };
+
+enum class SectionKind : uint32_t {
+    RowIndications = 0,      // uint64_t, number of rows plus one
+    Columns = 1,             // uint64_t, one per matrix entry
+    Values = 2,              // double, one per matrix entry
+    RowGroupIndices = 3,     // uint64_t, number of states plus one (only for nondeterministic models)
+    StateLabel = 4,          // bit vector over states, the section name is the label
+    ChoiceLabel = 5,         // bit vector over choices, the section name is the label
+    StateRewards = 6,        // double, one per state, the section name is the reward model name
+    StateActionRewards = 7,  // double, one per choice, the section name is the reward model name
+    ExitRates = 8,           // double, one per state (only for continuous time models)
+    MarkovianStates = 9,     // bit vector over states (only for Markov automata)
+    Observations = 10        // uint32_t, one per state (only for POMDPs)
+};
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endiannessMarker;
+    ValueTypeCode valueType;
+    ModelTypeCode modelType;
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+    uint64_t numberOfEntries;
+    uint64_t numberOfSections;
+};
+
+struct SectionHeader {
+    SectionKind kind;
+    uint32_t nameLength;
+    uint64_t nameOffset;
+    uint64_t offset;
+    uint64_t size;  // in bytes
+};
+
+static_assert(sizeof(FileHeader) == 56, "Unexpected size of the binary file header.");
+static_assert(sizeof(SectionHeader) == 32, "Unexpected size of the binary section header.");
+
+}  // namespace binary
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,199 @@
+#include "storm/io/BinaryResultExporter.h"
+
+#include <boost/optional.hpp>
+#include <fstream>
+#include <functional>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryResultFormat.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace resultbinary {
+namespace {
+
+// The number of elements that are buffered before they are written to the stream.
+static const uint64_t WriteBufferSize = 1ull << 16;
+
+template<typename T>
+void writeArray(std::ostream& os, T const* data, uint64_t count) {
+    os.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+}
+
+// Writes the values returned by the given function for all indices in [0, count) using a fixed-size buffer.
+template<typename T, typename ValueFunction>
+void writeBuffered(std::ostream& os, uint64_t count, ValueFunction const& getValue) {
+    std::vector<T> buffer;
+    buffer.reserve(std::min(count, WriteBufferSize));
+    for (uint64_t index = 0; index < count; ++index) {
+        buffer.push_back(getValue(index));
+        if (buffer.size() == WriteBufferSize) {
+            writeArray(os, buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    writeArray(os, buffer.data(), buffer.size());
+}
+
+// Writes zeros such that the next column starts at an offset that is a multiple of ColumnAlignment.
+void writePadding(std::ostream& os, uint64_t currentSize) {
+    static const char zeros[ColumnAlignment] = {};
+    os.write(zeros, (ColumnAlignment - currentSize % ColumnAlignment) % ColumnAlignment);
+}
+
+struct Column {
+    uint64_t size;
+    std::function<void(std::ostream&)> writeData;
+};
+
+// Writes the header and the given columns. The state indices are only written if they are given.
+void writeFile(std::string const& filename, FileHeader const& header, boost::optional<Column> const& stateIndices, Column const& data) {
+    std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+    writeArray(stream, &header, 1);
+    writePadding(stream, sizeof(FileHeader));
+    if (stateIndices) {
+        stateIndices->writeData(stream);
+        writePadding(stream, stateIndices->size);
+    }
+    data.writeData(stream);
+    writePadding(stream, data.size);
+    stream.close();
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Error while writing to file " << filename << ".");
+}
+
+FileHeader createHeader(ContentCode content, ValueTypeCode valueType, uint64_t numberOfEntries, uint64_t numberOfMemoryStates, bool hasStateIndices) {
+    FileHeader header;
+    std::copy(std::begin(Magic), std::end(Magic), header.magic);
+    header.version = FormatVersion;
+    header.endiannessMarker = EndiannessMarker;
+    header.content = content;
+    header.valueType = valueType;
+    header.numberOfEntries = numberOfEntries;
+    header.numberOfMemoryStates = numberOfMemoryStates;
+    header.hasStateIndices = hasStateIndices ? 1 : 0;
+    header.reserved = 0;
+    return header;
+}
+
+template<typename MapType>
+Column createStateIndexColumn(MapType const& map) {
+    return {map.size() * sizeof(uint64_t), [&map](std::ostream& os) {
+                auto it = map.begin();
+                writeBuffered<uint64_t>(os, map.size(), [&it](uint64_t) { return static_cast<uint64_t>((it++)->first); });
+            }};
+}
+
+uint64_t getNumberOfWords(storm::storage::BitVector const& bitVector) {
+    return (bitVector.size() + 63) / 64;
+}
+
+Column createBitColumn(storm::storage::BitVector const& bitVector) {
+    return {getNumberOfWords(bitVector) * sizeof(uint64_t), [&bitVector](std::ostream& os) {
+                writeBuffered<uint64_t>(os, getNumberOfWords(bitVector), [&bitVector](uint64_t word) {
+                    uint64_t numberOfBits = std::min<uint64_t>(64, bitVector.size() - word * 64);
+                    return static_cast<uint64_t>(bitVector.getAsInt(word * 64, numberOfBits)) << (64 - numberOfBits);
+                });
+            }};
+}
+
+template<typename ValueType>
+double toDouble(ValueType const& value) {
+    return storm::utility::convertNumber<double>(value);
+}
+
+template<typename ValueType>
+void exportQuantitativeResult(std::string const& filename, storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& result) {
+    if (result.isResultForAllStates()) {
+        auto const& values = result.getValueVector();
+        Column data;
+        if constexpr (std::is_same<ValueType, double>::value) {
+            data = {values.size() * sizeof(double), [&values](std::ostream& os) { writeArray(os, values.data(), values.size()); }};
+        } else {
+            data = {values.size() * sizeof(double),
+                    [&values](std::ostream& os) { writeBuffered<double>(os, values.size(), [&values](uint64_t index) { return toDouble(values[index]); }); }};
+        }
+        writeFile(filename, createHeader(ContentCode::Values, ValueTypeCode::Double, values.size(), 1, false), boost::none, data);
+    } else {
+        auto const& values = result.getValueMap();
+        Column data = {values.size() * sizeof(double), [&values](std::ostream& os) {
+                           auto it = values.begin();
+                           writeBuffered<double>(os, values.size(), [&it](uint64_t) { return toDouble((it++)->second); });
+                       }};
+        writeFile(filename, createHeader(ContentCode::Values, ValueTypeCode::Double, values.size(), 1, true), createStateIndexColumn(values), data);
+    }
+}
+
+void exportQualitativeResult(std::string const& filename, storm::modelchecker::ExplicitQualitativeCheckResult const& result) {
+    if (result.isResultForAllStates()) {
+        auto const& truthValues = result.getTruthValuesVector();
+        writeFile(filename, createHeader(ContentCode::TruthValues, ValueTypeCode::Bit, truthValues.size(), 1, false), boost::none,
+                  createBitColumn(truthValues));
+    } else {
+        // Gather the truth values first as the entries of the map can not be accessed by their position.
+        auto const& truthValues = result.getTruthValuesMap();
+        storm::storage::BitVector bits(truthValues.size());
+        uint64_t position = 0;
+        for (auto const& stateValue : truthValues) {
+            bits.set(position++, stateValue.second);
+        }
+        writeFile(filename, createHeader(ContentCode::TruthValues, ValueTypeCode::Bit, truthValues.size(), 1, true), createStateIndexColumn(truthValues),
+                  createBitColumn(bits));
+    }
+}
+
+}  // namespace
+}  // namespace resultbinary
+
+template<typename ValueType>
+void binaryExportCheckResult(std::string const& filename, storm::modelchecker::CheckResult const& checkResult) {
+    if (checkResult.isExplicitQualitativeCheckResult()) {
+        resultbinary::exportQualitativeResult(filename, checkResult.asExplicitQualitativeCheckResult());
+    } else {
+        STORM_LOG_THROW(checkResult.isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException,
+                        "Export of check results is only supported for explicit check results (e.g. in the sparse engine)");
+        if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary result format does not support rational functions.");
+        } else {
+            resultbinary::exportQuantitativeResult(filename, checkResult.template asExplicitQuantitativeCheckResult<ValueType>());
+        }
+    }
+}
+
+template<typename ValueType>
+void binaryExportScheduler(std::string const& filename, storm::storage::Scheduler<ValueType> const& scheduler) {
+    using namespace resultbinary;
+    STORM_LOG_THROW(scheduler.isDeterministicScheduler(), storm::exceptions::NotSupportedException,
+                    "The binary result format only supports deterministic schedulers.");
+    uint64_t numberOfStates = scheduler.getNumberOfModelStates();
+    uint64_t numberOfMemoryStates = scheduler.getNumberOfMemoryStates();
+    Column data = {numberOfMemoryStates * numberOfStates * sizeof(uint64_t), [&scheduler, numberOfStates, numberOfMemoryStates](std::ostream& os) {
+                       writeBuffered<uint64_t>(os, numberOfMemoryStates * numberOfStates, [&scheduler, numberOfStates](uint64_t index) {
+                           auto const& choice = scheduler.getChoice(index % numberOfStates, index / numberOfStates);
+                           return choice.isDefined() ? static_cast<uint64_t>(choice.getDeterministicChoice()) : UndefinedChoice;
+                       });
+                   }};
+    writeFile(filename, createHeader(ContentCode::SchedulerChoices, ValueTypeCode::UInt64, numberOfStates, numberOfMemoryStates, false), boost::none,
+              data);
+}
+
+template void binaryExportCheckResult<double>(std::string const& filename, storm::modelchecker::CheckResult const& checkResult);
+template void binaryExportCheckResult<storm::RationalNumber>(std::string const& filename, storm::modelchecker::CheckResult const& checkResult);
+template void binaryExportCheckResult<storm::RationalFunction>(std::string const& filename, storm::modelchecker::CheckResult const& checkResult);
+
+template void binaryExportScheduler<double>(std::string const& filename, storm::storage::Scheduler<double> const& scheduler);
+template void binaryExportScheduler<storm::RationalNumber>(std::string const& filename, storm::storage::Scheduler<storm::RationalNumber> const& scheduler);
+template void binaryExportScheduler<storm::RationalFunction>(std::string const& filename,
+                                                             storm::storage::Scheduler<storm::RationalFunction> const& scheduler);
+}  // namespace exporter
+}  // namespace storm
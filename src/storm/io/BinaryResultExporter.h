@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/storage/Scheduler.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports an explicit check result into the binary format described in BinaryResultFormat.h. Quantitative results are stored as doubles (exact
+ * values are converted), qualitative results as bit vectors. In contrast to the json export, neither state valuations nor labels are written.
+ *
+ * @param filename     File path
+ * @param checkResult  The explicit check result to export
+ */
+template<typename ValueType>
+void binaryExportCheckResult(std::string const& filename, storm::modelchecker::CheckResult const& checkResult);
+
+/*!
+ * Exports the choices of a deterministic scheduler into the binary format described in BinaryResultFormat.h.
+ *
+ * @param filename   File path
+ * @param scheduler  The scheduler to export
+ */
+template<typename ValueType>
+void binaryExportScheduler(std::string const& filename, storm::storage::Scheduler<ValueType> const& scheduler);
+
+}  // namespace exporter
+}  // namespace storm
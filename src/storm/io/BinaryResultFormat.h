@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace resultbinary {
+
+/*
+ * Layout of the binary encoding of check results and schedulers. All integers and values are stored in the byte order of the exporting machine,
+ * which readers can check via the endianness marker in the header.
+ *
+ * - FileHeader
+ * - If hasStateIndices is set, the column of state indices: numberOfEntries many uint64_t in ascending order. Otherwise, the entries refer to
+ *   the states 0, ..., numberOfEntries - 1.
+ * - The column of data, depending on the content:
+ *   - Values: numberOfEntries many doubles.
+ *   - TruthValues: a bit vector with numberOfEntries bits stored as 64-bit words, where the first bit is the most significant bit of the first
+ *     word. An incomplete last word is padded with zeros at its least significant bits.
+ *   - SchedulerChoices: numberOfMemoryStates * numberOfEntries many uint64_t, namely the choices of all states for memory state 0, then for
+ *     memory state 1, and so on. A choice is the index of the chosen action local to the state or UndefinedChoice.
+ *
+ * Each column starts at an offset that is a multiple of ColumnAlignment, so the columns can be used in place (e.g. as Arrow buffers) after
+ * mapping the file into memory.
+ */
+
+// The first bytes of each file.
+static const char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'R', 'E', 'S'};
+
+// Increased whenever the layout changes in a way older readers cannot handle.
+static const uint32_t FormatVersion = 1;
+
+// Written as uint32_t to detect files that were exported on a machine with a different byte order.
+static const uint32_t EndiannessMarker = 0x01020304;
+
+// The offset of every column is a multiple of this number of bytes.
+static const uint64_t ColumnAlignment = 64;
+
+// Marks states for which the scheduler does not define a choice.
+static const uint64_t UndefinedChoice = UINT64_MAX;
+
+enum class ContentCode : uint32_t { Values = 0, TruthValues = 1, SchedulerChoices = 2 };
+
+enum class ValueTypeCode : uint32_t { Double = 0, Bit = 1, UInt64 = 2 };
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endiannessMarker;
+    ContentCode content;
+    ValueTypeCode valueType;
+    uint64_t numberOfEntries;
+    uint64_t numberOfMemoryStates;  // one for everything but schedulers with memory
+    uint32_t hasStateIndices;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 48, "Unexpected size of the binary result file header.");
+
+}  // namespace resultbinary
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,292 @@
+#include "storm/io/CompressedInputFile.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef STORM_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace {
+
+// The size of the blocks of decompressed data that are handed from the decompression thread to the stream.
+static const uint64_t BlockSize = 1ull << 20;
+
+// The number of decompressed blocks the decompression thread may be ahead of the reader.
+static const uint64_t MaxQueuedBlocks = 4;
+
+// The size of the blocks in which the compressed file is read.
+static const uint64_t CompressedBlockSize = 1ull << 18;
+
+std::string getFormatName(CompressionFormat format) {
+    switch (format) {
+        case CompressionFormat::Gzip:
+            return "gzip";
+        case CompressionFormat::Zstd:
+            return "zstd";
+        default:
+            return "uncompressed";
+    }
+}
+
+/*!
+ * A stream buffer that provides the decompressed content of a file. A separate thread decompresses the file into blocks that are queued until
+ * they are read.
+ */
+class DecompressingStreamBuffer : public std::streambuf {
+   public:
+    DecompressingStreamBuffer(std::string const& filepath, CompressionFormat format) : filepath(filepath), format(format) {
+#ifndef STORM_HAVE_ZLIB
+        STORM_LOG_THROW(format != CompressionFormat::Gzip, storm::exceptions::NotSupportedException,
+                        "Can not read gzip compressed file " << filepath << " as Storm was built without zlib support.");
+#endif
+#ifndef STORM_HAVE_ZSTD
+        STORM_LOG_THROW(format != CompressionFormat::Zstd, storm::exceptions::NotSupportedException,
+                        "Can not read zstd compressed file " << filepath << " as Storm was built without zstd support.");
+#endif
+        input.open(filepath, std::ios::binary);
+        STORM_LOG_THROW(input, storm::exceptions::FileIoException, "Could not open file " << filepath << ".");
+        worker = std::thread([this]() { run(); });
+    }
+
+    ~DecompressingStreamBuffer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        condition.notify_all();
+        worker.join();
+    }
+
+   protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return !blocks.empty() || finished; });
+        if (blocks.empty()) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return traits_type::eof();
+        }
+        currentBlock = std::move(blocks.front());
+        blocks.pop_front();
+        lock.unlock();
+        condition.notify_all();
+        setg(currentBlock.data(), currentBlock.data(), currentBlock.data() + currentBlock.size());
+        return traits_type::to_int_type(*gptr());
+    }
+
+   private:
+    void run() {
+        try {
+            if (format == CompressionFormat::Gzip) {
+                decompressGzip();
+            } else {
+                decompressZstd();
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            error = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished = true;
+        }
+        condition.notify_all();
+    }
+
+    /*!
+     * Reads the next part of the compressed file into the given buffer and returns the number of read bytes (zero at the end of the file).
+     */
+    uint64_t readCompressed(std::vector<char>& compressed) {
+        input.read(compressed.data(), compressed.size());
+        STORM_LOG_THROW(!input.bad(), storm::exceptions::FileIoException, "Error while reading file " << filepath << ".");
+        return input.gcount();
+    }
+
+    /*!
+     * Hands the first bytes of the given block to the reader, waiting if the reader is too far behind.
+     *
+     * @return False if the stream is destroyed and the decompression should stop.
+     */
+    bool pushBlock(std::vector<char>& block, uint64_t size) {
+        if (size == 0) {
+            return true;
+        }
+        block.resize(size);
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return stopped || blocks.size() < MaxQueuedBlocks; });
+        if (stopped) {
+            return false;
+        }
+        blocks.push_back(std::move(block));
+        lock.unlock();
+        condition.notify_all();
+        block = std::vector<char>(BlockSize);
+        return true;
+    }
+
+    void decompressGzip() {
+#ifdef STORM_HAVE_ZLIB
+        z_stream stream = {};
+        // Detect the gzip (or zlib) header automatically.
+        STORM_LOG_THROW(inflateInit2(&stream, 15 + 32) == Z_OK, storm::exceptions::FileIoException, "Could not initialize zlib.");
+        std::unique_ptr<z_stream, int (*)(z_stream*)> streamGuard(&stream, &inflateEnd);
+        std::vector<char> compressed(CompressedBlockSize);
+        std::vector<char> block(BlockSize);
+        stream.next_out = reinterpret_cast<Bytef*>(block.data());
+        stream.avail_out = block.size();
+        // Whether a member of the file was started but not yet finished.
+        bool inMember = false;
+        // Whether zlib may hold back output because the last block was filled completely.
+        bool outputPending = false;
+        while (true) {
+            if (stream.avail_in == 0 && !outputPending) {
+                stream.avail_in = readCompressed(compressed);
+                stream.next_in = reinterpret_cast<Bytef*>(compressed.data());
+                if (stream.avail_in == 0) {
+                    break;
+                }
+            }
+            inMember = true;
+            int status = inflate(&stream, Z_NO_FLUSH);
+            STORM_LOG_THROW(status == Z_OK || status == Z_STREAM_END || status == Z_BUF_ERROR, storm::exceptions::FileIoException,
+                            "Error while decompressing " << filepath << ": " << (stream.msg ? stream.msg : "unknown error") << ".");
+            if (status == Z_STREAM_END) {
+                // Files may consist of several gzip members.
+                inMember = false;
+                inflateReset(&stream);
+            }
+            outputPending = stream.avail_out == 0;
+            if (outputPending) {
+                if (!pushBlock(block, block.size())) {
+                    return;
+                }
+                stream.next_out = reinterpret_cast<Bytef*>(block.data());
+                stream.avail_out = block.size();
+            }
+        }
+        STORM_LOG_THROW(!inMember, storm::exceptions::FileIoException, "Unexpected end of gzip compressed file " << filepath << ".");
+        pushBlock(block, block.size() - stream.avail_out);
+#endif
+    }
+
+    void decompressZstd() {
+#ifdef STORM_HAVE_ZSTD
+        std::unique_ptr<ZSTD_DStream, size_t (*)(ZSTD_DStream*)> stream(ZSTD_createDStream(), &ZSTD_freeDStream);
+        STORM_LOG_THROW(stream && !ZSTD_isError(ZSTD_initDStream(stream.get())), storm::exceptions::FileIoException, "Could not initialize zstd.");
+        std::vector<char> compressed(CompressedBlockSize);
+        std::vector<char> block(BlockSize);
+        ZSTD_inBuffer in = {compressed.data(), 0, 0};
+        ZSTD_outBuffer out = {block.data(), block.size(), 0};
+        // Whether a frame of the file was started but not yet finished.
+        bool inFrame = false;
+        // Whether zstd may hold back output because the last block was filled completely.
+        bool outputPending = false;
+        while (true) {
+            if (in.pos == in.size && !outputPending) {
+                in.size = readCompressed(compressed);
+                in.pos = 0;
+                if (in.size == 0) {
+                    break;
+                }
+            }
+            size_t status = ZSTD_decompressStream(stream.get(), &out, &in);
+            STORM_LOG_THROW(!ZSTD_isError(status), storm::exceptions::FileIoException,
+                            "Error while decompressing " << filepath << ": " << ZSTD_getErrorName(status) << ".");
+            // A status of zero indicates that a frame was completely decoded and flushed.
+            inFrame = status != 0;
+            outputPending = out.pos == out.size;
+            if (outputPending) {
+                if (!pushBlock(block, out.pos)) {
+                    return;
+                }
+                out = {block.data(), block.size(), 0};
+            }
+        }
+        STORM_LOG_THROW(!inFrame, storm::exceptions::FileIoException, "Unexpected end of zstd compressed file " << filepath << ".");
+        pushBlock(block, out.pos);
+#endif
+    }
+
+    std::string filepath;
+    CompressionFormat format;
+    std::ifstream input;
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable condition;
+    // The following members are guarded by the mutex.
+    std::deque<std::vector<char>> blocks;
+    bool finished = false;
+    bool stopped = false;
+    std::exception_ptr error;
+
+    // The block that is currently read.
+    std::vector<char> currentBlock;
+};
+
+}  // namespace
+
+CompressionFormat getCompressionFormat(std::string const& filepath) {
+    std::ifstream file(filepath, std::ios::binary);
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << filepath << ".");
+    unsigned char magic[4] = {};
+    file.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    uint64_t size = file.gcount();
+    if (size >= 2 && magic[0] == 0x1f && magic[1] == 0x8b) {
+        return CompressionFormat::Gzip;
+    } else if (size >= 4 && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd) {
+        return CompressionFormat::Zstd;
+    }
+    return CompressionFormat::None;
+}
+
+InputFileStream::InputFileStream(std::string const& filepath) : std::istream(nullptr), compressionFormat(storm::utility::getCompressionFormat(filepath)) {
+    if (compressionFormat == CompressionFormat::None) {
+        auto fileBuffer = std::make_unique<std::filebuf>();
+        STORM_LOG_THROW(fileBuffer->open(filepath, std::ios::in), storm::exceptions::FileIoException, "Could not open file " << filepath << ".");
+        buffer = std::move(fileBuffer);
+    } else {
+        STORM_LOG_INFO("Decompressing " << getFormatName(compressionFormat) << " compressed file " << filepath << " while reading.");
+        buffer = std::make_unique<DecompressingStreamBuffer>(filepath, compressionFormat);
+    }
+    rdbuf(buffer.get());
+    if (compressionFormat != CompressionFormat::None) {
+        // Let exceptions from the decompression pass through instead of only setting the badbit.
+        exceptions(std::ios::badbit);
+    }
+}
+
+InputFileStream::~InputFileStream() {
+    // Detach the buffer before it is destroyed (without throwing due to the badbit set when detaching).
+    exceptions(std::ios::goodbit);
+    rdbuf(nullptr);
+}
+
+CompressionFormat InputFileStream::getCompressionFormat() const {
+    return compressionFormat;
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <string>
+
+namespace storm {
+namespace utility {
+
+enum class CompressionFormat { None, Gzip, Zstd };
+
+/*!
+ * Determines whether the given file is compressed by looking at its first bytes.
+ *
+ * @param filepath Path and name of the file.
+ * @return The compression format of the file.
+ */
+CompressionFormat getCompressionFormat(std::string const& filepath);
+
+/*!
+ * An input stream for files that may be compressed with gzip or zstd. Compressed files are decompressed on the fly in a separate thread, such
+ * that the decompression overlaps with the processing of the data read from the stream. Uncompressed files are read as with std::ifstream.
+ * Errors during the decompression are thrown as exceptions when reading from the stream.
+ */
+class InputFileStream : public std::istream {
+   public:
+    /*!
+     * Opens the given file for reading.
+     *
+     * @param filepath Path and name of the file to be read.
+     */
+    explicit InputFileStream(std::string const& filepath);
+
+    ~InputFileStream();
+
+    /*!
+     * Retrieves the compression format of the opened file.
+     */
+    CompressionFormat getCompressionFormat() const;
+
+   private:
+    CompressionFormat compressionFormat;
+    std::unique_ptr<std::streambuf> buffer;
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace ddbinary {
+
+/*
+ * Layout of the binary encoding of symbolic models. All integers and values are stored in the byte order of the exporting machine, which the
+ * loader checks via the endianness marker in the header.
+ *
+ * - FileHeader
+ * - numberOfMetaVariables many meta variables, each consisting of
+ *   - a MetaVariableHeader,
+ *   - its name (not null-terminated) and
+ *   - numberOfDdVariables many DdVariableRecords for the DD variables encoding the meta variable (most significant bit first).
+ *   The meta variables are stored in the order in which they were created, i.e. by the lowest index of their DD variables, and all layers of a
+ *   meta variable (x, x', x'', ...) are stored consecutively, so the loader can recreate them with the same indices.
+ * - The variable sets of the model. Each set is stored as its number of elements followed by the positions of the meta variables (in the list of
+ *   meta variables above) as uint64_t. The sets are the row, column and nondeterminism variables and the row/column pairs (stored as pairs of
+ *   positions), in that order.
+ * - numberOfDds many DDs, each consisting of
+ *   - a DdHeader,
+ *   - its name (not null-terminated),
+ *   - the positions of its meta variables as uint64_t and
+ *   - numberOfNodes many NodeRecords, where the children of each node precede the node and the last node is the root.
+ *
+ * BDDs are stored as 0/1-ADDs.
+ */
+
+// The first bytes of each file.
+static const char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'D', 'D'};
+
+// Increased whenever the layout changes in a way older loaders cannot handle.
+static const uint32_t FormatVersion = 1;
+
+// Written as uint32_t to detect files that were exported on a machine with a different byte order.
+static const uint32_t EndiannessMarker = 0x01020304;
+
+// The DD variable index that marks terminal nodes.
+static const uint64_t TerminalIndex = UINT64_MAX;
+
+enum class ValueTypeCode : uint32_t { Double = 0 };
+
+enum class ModelTypeCode : uint32_t { Dtmc = 0, Ctmc = 1, Mdp = 2, MarkovAutomaton = 3 };
+
+enum class MetaVariableTypeCode : uint32_t { Bool = 0, Int = 1, BitVector = 2 };
+
+enum class DdRole : uint32_t {
+    Transitions = 0,
+    ReachableStates = 1,
+    InitialStates = 2,
+    DeadlockStates = 3,
+    Label = 4,               // the name is the label
+    ExitRates = 5,           // only for continuous time models
+    MarkovianMarker = 6,     // only for Markov automata
+    StateRewards = 7,        // the name is the reward model name
+    StateActionRewards = 8,  // the name is the reward model name
+    TransitionRewards = 9    // the name is the reward model name
+};
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t endiannessMarker;
+    ValueTypeCode valueType;
+    ModelTypeCode modelType;
+    uint64_t numberOfMetaVariables;
+    uint64_t numberOfDds;
+};
+
+struct MetaVariableHeader {
+    MetaVariableTypeCode type;
+    uint32_t nameLength;
+    int64_t low;   // only for integer meta variables
+    int64_t high;  // only for integer meta variables
+    uint64_t numberOfDdVariables;
+};
+
+struct DdVariableRecord {
+    uint64_t index;
+    uint64_t level;
+};
+
+struct DdHeader {
+    DdRole role;
+    uint32_t nameLength;
+    uint64_t numberOfMetaVariables;
+    uint64_t numberOfNodes;
+};
+
+struct NodeRecord {
+    uint64_t ddVariableIndex;  // TerminalIndex for terminal nodes
+    uint64_t thenNode;
+    uint64_t elseNode;
+    double value;  // only for terminal nodes
+};
+
+static_assert(sizeof(FileHeader) == 40, "Unexpected size of the binary DD file header.");
+static_assert(sizeof(MetaVariableHeader) == 32, "Unexpected size of the binary DD meta variable header.");
+static_assert(sizeof(DdHeader) == 24, "Unexpected size of the binary DD header.");
+static_assert(sizeof(NodeRecord) == 32, "Unexpected size of the binary DD node record.");
+
+}  // namespace ddbinary
+}  // namespace exporter
+}  // namespace storm
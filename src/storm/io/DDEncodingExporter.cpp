@@ -1,6 +1,22 @@
 #include "storm/io/DDEncodingExporter.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <tuple>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/DDBinaryFormat.h"
 #include "storm/io/file.h"
+#include "storm/models/symbolic/Ctmc.h"
+#include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/utility/macros.h"
 
 namespace storm {
 namespace exporter {
@@ -25,6 +41,205 @@ void explicitExportSymbolicModel(std::string const& filename, std::shared_ptr<st
     }
 }
 
+namespace ddbinary {
+namespace {
+
+ModelTypeCode getModelTypeCode(storm::models::ModelType const& type) {
+    switch (type) {
+        case storm::models::ModelType::Dtmc:
+            return ModelTypeCode::Dtmc;
+        case storm::models::ModelType::Ctmc:
+            return ModelTypeCode::Ctmc;
+        case storm::models::ModelType::Mdp:
+            return ModelTypeCode::Mdp;
+        case storm::models::ModelType::MarkovAutomaton:
+            return ModelTypeCode::MarkovAutomaton;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Models of type " << type << " can not be exported in the binary DD format.");
+    }
+}
+
+MetaVariableTypeCode getMetaVariableTypeCode(storm::dd::MetaVariableType const& type) {
+    switch (type) {
+        case storm::dd::MetaVariableType::Bool:
+            return MetaVariableTypeCode::Bool;
+        case storm::dd::MetaVariableType::Int:
+            return MetaVariableTypeCode::Int;
+        case storm::dd::MetaVariableType::BitVector:
+            return MetaVariableTypeCode::BitVector;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown type of meta variable.");
+}
+
+template<typename T>
+void writeArray(std::ostream& os, T const* data, uint64_t count) {
+    os.write(reinterpret_cast<char const*>(data), count * sizeof(T));
+}
+
+template<storm::dd::DdType Type>
+class DdWriter {
+   public:
+    DdWriter(std::ostream& os, storm::dd::DdManager<Type> const& manager) : os(os), manager(manager) {
+        // Sort the meta variables by the lowest index of their DD variables, i.e. by the order in which they were created.
+        auto allMetaVariables = manager.getAllMetaVariables();
+        metaVariables.assign(allMetaVariables.begin(), allMetaVariables.end());
+        std::sort(metaVariables.begin(), metaVariables.end(), [&manager](storm::expressions::Variable const& a, storm::expressions::Variable const& b) {
+            return manager.getMetaVariable(a).getLowestIndex() < manager.getMetaVariable(b).getLowestIndex();
+        });
+        for (uint64_t position = 0; position < metaVariables.size(); ++position) {
+            positions.emplace(metaVariables[position], position);
+        }
+    }
+
+    uint64_t getNumberOfMetaVariables() const {
+        return metaVariables.size();
+    }
+
+    void writeMetaVariables() {
+        for (auto const& variable : metaVariables) {
+            auto const& metaVariable = manager.getMetaVariable(variable);
+            MetaVariableHeader header = {getMetaVariableTypeCode(metaVariable.getType()), static_cast<uint32_t>(metaVariable.getName().size()), 0, 0,
+                                         metaVariable.getNumberOfDdVariables()};
+            if (metaVariable.getType() == storm::dd::MetaVariableType::Int) {
+                header.low = metaVariable.getLow();
+                header.high = metaVariable.getHigh();
+            }
+            writeArray(os, &header, 1);
+            os.write(metaVariable.getName().data(), metaVariable.getName().size());
+            for (auto const& indexAndLevel : metaVariable.getIndicesAndLevels()) {
+                DdVariableRecord record = {indexAndLevel.first, indexAndLevel.second};
+                writeArray(os, &record, 1);
+            }
+        }
+    }
+
+    template<typename VariableSet>
+    void writeVariableSet(VariableSet const& variables) {
+        std::vector<uint64_t> variablePositions;
+        for (auto const& variable : variables) {
+            variablePositions.push_back(getPosition(variable));
+        }
+        uint64_t numberOfVariables = variablePositions.size();
+        writeArray(os, &numberOfVariables, 1);
+        writeArray(os, variablePositions.data(), variablePositions.size());
+    }
+
+    void writeVariablePairs(std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& pairs) {
+        uint64_t numberOfPairs = pairs.size();
+        writeArray(os, &numberOfPairs, 1);
+        for (auto const& pair : pairs) {
+            uint64_t pairPositions[2] = {getPosition(pair.first), getPosition(pair.second)};
+            writeArray(os, pairPositions, 2);
+        }
+    }
+
+    void writeDd(DdRole role, std::string const& name, storm::dd::Add<Type, double> const& add) {
+        std::vector<storm::dd::AddNode<double>> nodes = add.getNodes();
+        DdHeader header = {role, static_cast<uint32_t>(name.size()), add.getContainedMetaVariables().size(), nodes.size()};
+        writeArray(os, &header, 1);
+        os.write(name.data(), name.size());
+        std::vector<uint64_t> variablePositions;
+        for (auto const& variable : add.getContainedMetaVariables()) {
+            variablePositions.push_back(getPosition(variable));
+        }
+        writeArray(os, variablePositions.data(), variablePositions.size());
+        std::vector<NodeRecord> records;
+        records.reserve(nodes.size());
+        for (auto const& node : nodes) {
+            records.push_back({node.ddVariableIndex, node.thenNode, node.elseNode, node.value});
+        }
+        writeArray(os, records.data(), records.size());
+    }
+
+    void writeDd(DdRole role, std::string const& name, storm::dd::Bdd<Type> const& bdd) {
+        writeDd(role, name, bdd.template toAdd<double>());
+    }
+
+   private:
+    uint64_t getPosition(storm::expressions::Variable const& variable) const {
+        auto positionIt = positions.find(variable);
+        STORM_LOG_ASSERT(positionIt != positions.end(), "Unknown meta variable " << variable.getName() << ".");
+        return positionIt->second;
+    }
+
+    std::ostream& os;
+    storm::dd::DdManager<Type> const& manager;
+    std::vector<storm::expressions::Variable> metaVariables;
+    std::map<storm::expressions::Variable, uint64_t> positions;
+};
+
+template<storm::dd::DdType Type>
+void exportModel(std::ostream& os, std::shared_ptr<storm::models::symbolic::Model<Type, double>> const& symbolicModel) {
+    DdWriter<Type> writer(os, symbolicModel->getManager());
+
+    // Collect the DDs first, as their number is part of the header.
+    std::vector<std::tuple<DdRole, std::string, storm::dd::Add<Type, double>>> dds;
+    dds.emplace_back(DdRole::Transitions, "", symbolicModel->getTransitionMatrix());
+    dds.emplace_back(DdRole::ReachableStates, "", symbolicModel->getReachableStates().template toAdd<double>());
+    dds.emplace_back(DdRole::InitialStates, "", symbolicModel->getInitialStates().template toAdd<double>());
+    dds.emplace_back(DdRole::DeadlockStates, "", symbolicModel->getDeadlockStates().template toAdd<double>());
+    for (auto const& label : symbolicModel->getLabels()) {
+        dds.emplace_back(DdRole::Label, label, symbolicModel->getStates(label).template toAdd<double>());
+    }
+    for (auto const& rewardModel : symbolicModel->getRewardModels()) {
+        if (rewardModel.second.hasStateRewards()) {
+            dds.emplace_back(DdRole::StateRewards, rewardModel.first, rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            dds.emplace_back(DdRole::StateActionRewards, rewardModel.first, rewardModel.second.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            dds.emplace_back(DdRole::TransitionRewards, rewardModel.first, rewardModel.second.getTransitionRewardMatrix());
+        }
+        if (rewardModel.second.empty()) {
+            // Keep the (empty) reward model by writing zero state rewards.
+            dds.emplace_back(DdRole::StateRewards, rewardModel.first, symbolicModel->getManager().template getAddZero<double>());
+        }
+    }
+    if (symbolicModel->getType() == storm::models::ModelType::Ctmc) {
+        dds.emplace_back(DdRole::ExitRates, "", symbolicModel->template as<storm::models::symbolic::Ctmc<Type, double>>()->getExitRateVector());
+    } else if (symbolicModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto ma = symbolicModel->template as<storm::models::symbolic::MarkovAutomaton<Type, double>>();
+        dds.emplace_back(DdRole::MarkovianMarker, "", ma->getMarkovianMarker().template toAdd<double>());
+    }
+
+    FileHeader fileHeader;
+    std::copy(std::begin(Magic), std::end(Magic), fileHeader.magic);
+    fileHeader.version = FormatVersion;
+    fileHeader.endiannessMarker = EndiannessMarker;
+    fileHeader.valueType = ValueTypeCode::Double;
+    fileHeader.modelType = getModelTypeCode(symbolicModel->getType());
+    fileHeader.numberOfMetaVariables = writer.getNumberOfMetaVariables();
+    fileHeader.numberOfDds = dds.size();
+    writeArray(os, &fileHeader, 1);
+
+    writer.writeMetaVariables();
+    writer.writeVariableSet(symbolicModel->getRowVariables());
+    writer.writeVariableSet(symbolicModel->getColumnVariables());
+    writer.writeVariableSet(symbolicModel->getNondeterminismVariables());
+    writer.writeVariablePairs(symbolicModel->getRowColumnMetaVariablePairs());
+    for (auto const& dd : dds) {
+        writer.writeDd(std::get<0>(dd), std::get<1>(dd), std::get<2>(dd));
+    }
+}
+
+}  // namespace
+}  // namespace ddbinary
+
+template<storm::dd::DdType Type, typename ValueType>
+void binaryExportSymbolicModel(std::string const& filename, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> symbolicModel) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+        ddbinary::exportModel(stream, symbolicModel);
+        stream.close();
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Error while writing to file " << filename << ".");
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The binary DD format only supports models with double values.");
+    }
+}
+
 template void explicitExportSymbolicModel<storm::dd::DdType::CUDD, double>(
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> sparseModel);
 template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, double>(
@@ -34,5 +249,14 @@ template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, storm::Rati
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber>> sparseModel);
 template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, storm::RationalFunction>(
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction>> sparseModel);
+
+template void binaryExportSymbolicModel<storm::dd::DdType::CUDD, double>(
+    std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> symbolicModel);
+template void binaryExportSymbolicModel<storm::dd::DdType::Sylvan, double>(
+    std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> symbolicModel);
+template void binaryExportSymbolicModel<storm::dd::DdType::Sylvan, storm::RationalNumber>(
+    std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber>> symbolicModel);
+template void binaryExportSymbolicModel<storm::dd::DdType::Sylvan, storm::RationalFunction>(
+    std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction>> symbolicModel);
 }  // namespace exporter
 }  // namespace storm
@@ -14,5 +14,16 @@ namespace exporter {
 template<storm::dd::DdType Type, typename ValueType>
 void explicitExportSymbolicModel(std::string const& filename, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> symbolicModel);
 
+/*!
+ * Exports a symbolic model into the binary format described in DDBinaryFormat.h. Besides the DDs of the model, the file contains the meta variables
+ * of the DD manager together with the order of their DD variables, such that the model can be restored (see storm::parser::DDEncodingParser)
+ * without building it again. Only models with double values are supported. Labels are stored as the sets of states they describe.
+ *
+ * @param filename       File path
+ * @param symbolicModel  Model to export
+ */
+template<storm::dd::DdType Type, typename ValueType>
+void binaryExportSymbolicModel(std::string const& filename, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> symbolicModel);
+
 }  // namespace exporter
-}  // namespace storm
\ No newline at end of file
+}  // namespace storm
@@ -1,6 +1,12 @@
 #include "storm/io/DirectEncodingExporter.h"
 #include <storm/exceptions/NotSupportedException.h>
 
+#include <charconv>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -8,6 +14,8 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -16,6 +24,128 @@
 namespace storm {
 namespace exporter {
 
+namespace {
+
+// The number of states that are formatted into one block of output.
+static const uint64_t StatesPerBlock = 1024;
+
+// The number of blocks that are formatted (in parallel) before they are written.
+static const uint64_t BlocksPerRound = 256;
+
+// The size (in bytes) after which the output buffer is written when formatting sequentially.
+static const uint64_t FlushSize = 1ull << 20;
+
+/*!
+ * Collects formatted output in a string before it is written to a stream in one go. Integers and doubles are formatted with std::to_chars,
+ * which is much faster than formatting them with a stream. The output is the same as if everything was written to the given stream.
+ */
+class OutputBuffer {
+   public:
+    OutputBuffer(std::ostream const& os) : flags(os.flags()), precision(os.precision()) {
+        std::ios_base::fmtflags floatField = flags & std::ios_base::floatfield;
+        useToChars = (flags & (std::ios_base::showpos | std::ios_base::showpoint | std::ios_base::uppercase)) == 0 &&
+                     floatField != (std::ios_base::fixed | std::ios_base::scientific);
+#if defined(__cpp_lib_to_chars)
+        if (floatField == std::ios_base::fixed) {
+            format = std::chars_format::fixed;
+        } else if (floatField == std::ios_base::scientific) {
+            format = std::chars_format::scientific;
+        }
+#endif
+    }
+
+    template<typename T>
+    OutputBuffer& operator<<(T const& value) {
+        if constexpr (std::is_convertible<T const&, std::string_view>::value) {
+            buffer.append(std::string_view(value));
+        } else if constexpr (std::is_same<T, char>::value) {
+            buffer.push_back(value);
+        } else if constexpr (std::is_integral<T>::value) {
+            appendWithToChars(value);
+#if defined(__cpp_lib_to_chars)
+        } else if constexpr (std::is_same<T, double>::value) {
+            if (useToChars) {
+                appendWithToChars(value, format, static_cast<int>(precision));
+            } else {
+                appendWithStream(value);
+            }
+#endif
+        } else {
+            appendWithStream(value);
+        }
+        return *this;
+    }
+
+    uint64_t size() const {
+        return buffer.size();
+    }
+
+    /*!
+     * Writes the collected output to the given stream and clears the buffer.
+     */
+    void flush(std::ostream& os) {
+        os.write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+
+   private:
+    template<typename T, typename... Args>
+    void appendWithToChars(T const& value, Args... args) {
+        // Large enough for all integers and doubles with a precision of up to 1000 (which is also the limit for printf)
+        char chars[1100];
+        auto result = std::to_chars(chars, chars + sizeof(chars), value, args...);
+        if (result.ec == std::errc()) {
+            buffer.append(chars, result.ptr);
+        } else {
+            appendWithStream(value);
+        }
+    }
+
+    template<typename T>
+    void appendWithStream(T const& value) {
+        if (!stream) {
+            stream = std::make_unique<std::ostringstream>();
+            stream->flags(flags);
+            stream->precision(precision);
+        }
+        stream->str("");
+        *stream << value;
+        buffer.append(stream->str());
+    }
+
+    std::string buffer;
+    std::ios_base::fmtflags flags;
+    std::streamsize precision;
+    bool useToChars;
+#if defined(__cpp_lib_to_chars)
+    std::chars_format format = std::chars_format::general;
+#endif
+    // Only used for values that can not be formatted with std::to_chars.
+    std::unique_ptr<std::ostringstream> stream;
+};
+
+/*!
+ * Write value to the given output while using the placeholders.
+ */
+template<typename OutputType, typename ValueType>
+void writeValueTo(OutputType& out, ValueType const& value, std::unordered_map<ValueType, std::string> const& placeholders) {
+    if (storm::utility::isConstant(value)) {
+        out << value;
+        return;
+    }
+
+    // Try to use placeholder
+    auto it = placeholders.find(value);
+    if (it != placeholders.end()) {
+        // Use placeholder
+        out << "$" << it->second;
+    } else {
+        out << value;
+    }
+}
+
+}  // namespace
+
 template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
@@ -71,111 +201,153 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
     storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
 
     // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
-
-        // Write exit rates for CTMCs and MAs
-        if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
-        }
-
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
-        }
-
-        // Write state rewards
-        bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-            if (first) {
-                os << " [";
-                first = false;
-            } else {
-                os << ", ";
+    auto writeStates = [&](OutputBuffer& out, uint64_t firstState, uint64_t endState) {
+        for (typename storm::storage::SparseMatrix<ValueType>::index_type group = firstState; group < endState; ++group) {
+            out << "state " << group;
+
+            // Write exit rates for CTMCs and MAs
+            if (!exitRates.empty()) {
+                out << " !";
+                writeValueTo(out, exitRates.at(group), placeholders);
             }
 
-            if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-            } else {
-                os << "0";
+            if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+                out << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
             }
-        }
 
-        if (!first) {
-            os << "]";
-        }
-
-        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
-            } else {
-                os << " " << label;
-            }
-        }
-        os << '\n';
-        // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
-        }
-
-        // Write probabilities
-        typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-        typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-        // Iterate over all actions
-        for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-            // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
-                bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
-                }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                    if (!lfirst) {
-                        os << "_";
-                        lfirst = false;
-                    }
-                    os << label;
-                }
-            } else {
-                os << "\taction " << row - start;
-            }
-
-            // Write action rewards
+            // Write state rewards
             bool first = true;
             for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
                 if (first) {
-                    os << " [";
+                    out << " [";
                     first = false;
                 } else {
-                    os << ", ";
+                    out << ", ";
                 }
 
-                if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
+                if (rewardModelEntry.second.hasStateRewards()) {
+                    writeValueTo(out, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
                 } else {
-                    os << "0";
+                    out << "0";
                 }
             }
+
             if (!first) {
-                os << "]";
+                out << "]";
+            }
+
+            // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+            for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
+                STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                                "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+                // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+                if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+                    out << " \"" << label << "\"";
+                } else {
+                    out << " " << label;
+                }
+            }
+            out << '\n';
+            // Write state valuations as comments
+            if (sparseModel->hasStateValuations()) {
+                out << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+            }
+
+            // Write probabilities
+            typename storm::storage::SparseMatrix<ValueType>::index_type start =
+                matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+            typename storm::storage::SparseMatrix<ValueType>::index_type end =
+                matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+            // Iterate over all actions
+            for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
+                // Write choice
+                if (sparseModel->hasChoiceLabeling()) {
+                    out << "\taction ";
+                    bool lfirst = true;
+                    if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
+                        out << "__NOLABEL__";
+                    }
+                    for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
+                        if (!lfirst) {
+                            out << "_";
+                            lfirst = false;
+                        }
+                        out << label;
+                    }
+                } else {
+                    out << "\taction " << row - start;
+                }
+
+                // Write action rewards
+                bool first = true;
+                for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+                    if (first) {
+                        out << " [";
+                        first = false;
+                    } else {
+                        out << ", ";
+                    }
+
+                    if (rewardModelEntry.second.hasStateActionRewards()) {
+                        writeValueTo(out, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
+                    } else {
+                        out << "0";
+                    }
+                }
+                if (!first) {
+                    out << "]";
+                }
+                out << '\n';
+
+                // Write transitions
+                for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
+                    ValueType prob = it->getValue();
+                    out << "\t\t" << it->getColumn() << " : ";
+                    writeValueTo(out, prob, placeholders);
+                    out << '\n';
+                }
+            }
+        }  // end state iteration
+    };
+
+    // Blocks of states are formatted in parallel and written in order. Rational functions are always formatted sequentially.
+    uint64_t numberOfStates = matrix.getRowGroupCount();
+    bool formatInParallel = !std::is_same<ValueType, storm::RationalFunction>::value &&
+                            storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && numberOfStates > StatesPerBlock;
+    if (formatInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+        uint64_t numberOfBlocks = (numberOfStates + StatesPerBlock - 1) / StatesPerBlock;
+        std::vector<OutputBuffer> buffers;
+        for (uint64_t block = 0; block < std::min(numberOfBlocks, BlocksPerRound); ++block) {
+            buffers.emplace_back(os);
+        }
+        for (uint64_t roundStart = 0; roundStart < numberOfBlocks; roundStart += BlocksPerRound) {
+            uint64_t roundEnd = std::min(roundStart + BlocksPerRound, numberOfBlocks);
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(roundStart, roundEnd), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t block = range.begin(); block < range.end(); ++block) {
+                    writeStates(buffers[block - roundStart], block * StatesPerBlock, std::min((block + 1) * StatesPerBlock, numberOfStates));
+                }
+            });
+            for (uint64_t block = roundStart; block < roundEnd; ++block) {
+                buffers[block - roundStart].flush(os);
             }
-            os << '\n';
-
-            // Write transitions
-            for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
+        }
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        formatInParallel = false;
+#endif
+    }
+    if (!formatInParallel) {
+        OutputBuffer out(os);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            writeStates(out, state, state + 1);
+            if (out.size() >= FlushSize) {
+                out.flush(os);
             }
         }
-    }  // end state iteration
+        out.flush(os);
+    }
 }
 
 template<typename ValueType>
@@ -255,19 +427,7 @@ std::unordered_map<storm::RationalFunction, std::string> generatePlaceholders(
 
 template<typename ValueType>
 void writeValue(std::ostream& os, ValueType value, std::unordered_map<ValueType, std::string> const& placeholders) {
-    if (storm::utility::isConstant(value)) {
-        os << value;
-        return;
-    }
-
-    // Try to use placeholder
-    auto it = placeholders.find(value);
-    if (it != placeholders.end()) {
-        // Use placeholder
-        os << "$" << it->second;
-    } else {
-        os << value;
-    }
+    writeValueTo(os, value, placeholders);
 }
 
 // Template instantiations
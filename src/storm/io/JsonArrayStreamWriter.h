@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Writes a json array to a stream element by element, so that the whole array never has to be held in memory. The output is identical to dumping
+ * a json array containing the same elements with the given indentation.
+ */
+template<typename JsonType>
+class JsonArrayStreamWriter {
+   public:
+    /*!
+     * Creates a writer that writes an array to the given stream.
+     *
+     * @param out The stream to write to. It must outlive the writer.
+     * @param indent The number of spaces that are used for indentation.
+     */
+    JsonArrayStreamWriter(std::ostream& out, uint64_t indent = 4) : out(out), indentation(indent, ' '), numberOfElements(0), finished(false) {
+        // Intentionally left empty.
+    }
+
+    JsonArrayStreamWriter(JsonArrayStreamWriter const&) = delete;
+    JsonArrayStreamWriter& operator=(JsonArrayStreamWriter const&) = delete;
+
+    ~JsonArrayStreamWriter() {
+        finish();
+    }
+
+    /*!
+     * Appends the given element to the array.
+     */
+    void add(JsonType const& element) {
+        out << (numberOfElements == 0 ? "[\n" : ",\n") << indentation;
+        // Dump the element on its own and indent all of its lines by one level.
+        std::string dumped = element.dump(static_cast<int>(indentation.size()));
+        uint64_t lineStart = 0;
+        for (uint64_t newLine = dumped.find('\n'); newLine != std::string::npos; newLine = dumped.find('\n', lineStart)) {
+            out.write(dumped.data() + lineStart, newLine + 1 - lineStart);
+            out << indentation;
+            lineStart = newLine + 1;
+        }
+        out.write(dumped.data() + lineStart, dumped.size() - lineStart);
+        ++numberOfElements;
+    }
+
+    /*!
+     * Closes the array. Further elements can not be added afterwards. This is called automatically upon destruction.
+     */
+    void finish() {
+        if (!finished) {
+            out << (numberOfElements == 0 ? "[]" : "\n]");
+            finished = true;
+        }
+    }
+
+    /*!
+     * Retrieves the number of elements that were added so far.
+     */
+    uint64_t getNumberOfElements() const {
+        return numberOfElements;
+    }
+
+   private:
+    std::ostream& out;
+    std::string indentation;
+    uint64_t numberOfElements;
+    bool finished;
+};
+
+}  // namespace exporter
+}  // namespace storm
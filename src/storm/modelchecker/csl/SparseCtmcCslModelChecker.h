@@ -61,6 +61,13 @@ class SparseCtmcCslModelChecker : public SparsePropositionalModelChecker<SparseC
      */
     std::vector<ValueType> computeAllTransientProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask);
 
+    /*!
+     * Computes the probabilities of the given time-bounded until formula for each of the given time points, i.e., the upper time bound of the
+     * formula is replaced by each of the time points. All time points are handled within a single uniformization.
+     */
+    std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& timePoints);
+
     /*!
      * Computes the long run average (or: steady state) distribution over all states
      * Assumes a uniform distribution over initial states.
@@ -1,5 +1,11 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -25,6 +31,7 @@
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -35,6 +42,40 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+/*!
+ * Retrieves whether the series of uniformization steps may be truncated as soon as the values do not change anymore.
+ */
+bool useSteadyStateDetection(storm::Environment const& env) {
+    if (!env.solver().timeBounded().isSteadyStateDetectionSet()) {
+        return false;
+    }
+    STORM_LOG_WARN_COND(!env.solver().isForceSoundness(), "Steady-state detection is disabled since sound results are required.");
+    return !env.solver().isForceSoundness();
+}
+
+/*!
+ * Computes the maximal change of the values in one iteration for which a steady state is assumed. Assuming that the change per iteration does
+ * not increase, the values change by at most epsilon in total during the remaining iterations.
+ */
+template<typename ValueType>
+ValueType computeSteadyStateThreshold(ValueType const& epsilon, uint_fast64_t remainingIterations) {
+    return epsilon / storm::utility::convertNumber<ValueType>(static_cast<uint64_t>(std::max<uint_fast64_t>(remainingIterations, 1)));
+}
+
+/*!
+ * Sums up the Fox-Glynn weights of all iterations from the given one up to the right truncation point.
+ */
+template<typename ValueType>
+ValueType computeRemainingWeight(storm::utility::numerical::FoxGlynnResult<ValueType> const& foxGlynnResult, uint_fast64_t firstIteration) {
+    ValueType remainingWeight = storm::utility::zero<ValueType>();
+    for (uint_fast64_t index = std::max<uint_fast64_t>(firstIteration, foxGlynnResult.left); index <= foxGlynnResult.right; ++index) {
+        remainingWeight += foxGlynnResult.weights[index - foxGlynnResult.left];
+    }
+    return remainingWeight;
+}
+}  // namespace
+
 template<typename ValueType>
 bool SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon,
                                                                     std::vector<ValueType> const& resultVector,
@@ -100,6 +141,11 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
     STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
 
+    // Adaptive uniformization starts from an initial distribution, so it is only applied if the relevant states are known.
+    bool const useAdaptiveUniformization = env.solver().timeBounded().isAdaptiveUniformizationSet() && goal.hasRelevantValues();
+    STORM_LOG_WARN_COND(!env.solver().timeBounded().isAdaptiveUniformizationSet() || useAdaptiveUniformization,
+                        "Adaptive uniformization is not applied since the relevant states are not known.");
+
     // the positions within the result for which the precision needs to be checked
     storm::storage::BitVector relevantValues;
     if (goal.hasRelevantValues()) {
@@ -122,7 +168,28 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
 
                     result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
                     storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
-                    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+                    if (useAdaptiveUniformization) {
+                        // Compute the probability of each relevant 'maybe' state separately by computing the transient distribution (forward) in
+                        // which the psi states are absorbing. The values of the remaining 'maybe' states are not computed.
+                        storm::storage::SparseMatrix<ValueType> forwardMatrix =
+                            rateMatrix.getSubmatrix(false, statesWithProbabilityGreater0, statesWithProbabilityGreater0);
+                        std::vector<ValueType> forwardExitRates(statesWithProbabilityGreater0.getNumberOfSetBits());
+                        storm::utility::vector::selectVectorValues(forwardExitRates, statesWithProbabilityGreater0, exitRates);
+                        storm::storage::BitVector forwardPsiStates = psiStates % statesWithProbabilityGreater0;
+                        for (auto state : forwardPsiStates) {
+                            for (auto& entry : forwardMatrix.getRow(state)) {
+                                entry.setValue(storm::utility::zero<ValueType>());
+                            }
+                            forwardExitRates[state] = storm::utility::zero<ValueType>();
+                        }
+                        for (auto state : relevantValues & statesWithProbabilityGreater0NonPsi) {
+                            std::vector<ValueType> values(forwardExitRates.size(), storm::utility::zero<ValueType>());
+                            values[statesWithProbabilityGreater0.getNumberOfSetBitsBeforeIndex(state)] = storm::utility::one<ValueType>();
+                            std::vector<ValueType> distribution = computeTransientDistributionWithAdaptiveUniformization<ValueType>(
+                                env, forwardMatrix, forwardExitRates, values, storm::utility::convertNumber<ValueType>(upperBound), epsilon);
+                            result[state] = storm::utility::vector::sum_if(distribution, forwardPsiStates);
+                        }
+                    } else if (!statesWithProbabilityGreater0NonPsi.empty()) {
                         // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
                         ValueType uniformizationRate = 0;
                         for (auto state : statesWithProbabilityGreater0NonPsi) {
@@ -277,6 +344,90 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, std::vector<double> const& timePoints) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(timePoints.size());
+    for (auto const& timePoint : timePoints) {
+        STORM_LOG_THROW(timePoint >= 0.0 && timePoint != storm::utility::infinity<double>(), storm::exceptions::InvalidArgumentException,
+                        "The time point " << timePoint << " is not a non-negative finite number.");
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(timePoint));
+    }
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+    // further computations.
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0.getNumberOfSetBits() << " states with probability greater 0.");
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+    // the positions within the result for which the precision needs to be checked
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // All intervals are of the form [0, t], so the psi states have probability one for every time point.
+    std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+    std::vector<std::vector<ValueType>> results(timeBounds.size(), initialResult);
+    if (statesWithProbabilityGreater0NonPsi.empty()) {
+        return results;
+    }
+
+    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+    ValueType uniformizationRate = 0;
+    for (auto state : statesWithProbabilityGreater0NonPsi) {
+        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+    }
+    uniformizationRate *= 1.02;
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+    // Compute the uniformized matrix.
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
+        computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+    // Compute the vector that is to be added as a compensation for removing the absorbing states.
+    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+    for (auto& element : b) {
+        element /= uniformizationRate;
+    }
+
+    bool repeat;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+        std::vector<std::vector<ValueType>> subresults =
+            computeTransientProbabilitiesForTimePoints(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+        repeat = false;
+        for (uint_fast64_t i = 0; i < results.size(); ++i) {
+            storm::utility::vector::setVectorValues(results[i], statesWithProbabilityGreater0NonPsi, subresults[i]);
+            // The epsilon is shared among all time points, so it has to be sufficiently small for each of them.
+            repeat |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, results[i], relevantValues);
+        }
+    } while (repeat);
+    return results;
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -572,6 +723,26 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
     storm::storage::BitVector relevantStates(numberOfStates, true);
     STORM_LOG_DEBUG(relevantStates.getNumberOfSetBits() << " relevant states.");
 
+    if (!relevantStates.empty() && env.solver().timeBounded().isAdaptiveUniformizationSet()) {
+        ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+        STORM_LOG_WARN_COND(!env.solver().timeBounded().getRelativeTerminationCriterion(),
+                            "Computation of transient probabilities with relative precision not supported. Using absolute precision instead.");
+        // The psi states are absorbing. As opposed to the self-loops used below, removing their transitions keeps them from increasing the adaptive
+        // uniformization rates.
+        storm::storage::SparseMatrix<ValueType> forwardMatrix(rateMatrix);
+        std::vector<ValueType> forwardExitRates = exitRates;
+        for (auto state : psiStates) {
+            for (auto& entry : forwardMatrix.getRow(state)) {
+                entry.setValue(storm::utility::zero<ValueType>());
+            }
+            forwardExitRates[state] = storm::utility::zero<ValueType>();
+        }
+        std::vector<ValueType> values(numberOfStates, storm::utility::zero<ValueType>());
+        storm::utility::vector::setVectorValues(values, initialStates, storm::utility::one<ValueType>() / initialStates.getNumberOfSetBits());
+        return computeTransientDistributionWithAdaptiveUniformization<ValueType>(env, forwardMatrix, forwardExitRates, values,
+                                                                                 storm::utility::convertNumber<ValueType>(timeBound), epsilon);
+    }
+
     if (!relevantStates.empty()) {
         // Find the maximal rate of all relevant states to take it as the uniformization rate.
         ValueType uniformizationRate = 0;
@@ -703,6 +874,31 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     }
 
     auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    if (!useMixedPoissonProbabilities && useSteadyStateDetection(env)) {
+        // Perform the matrix-vector multiplications one after another and stop as soon as the values do not change anymore. In that case, the
+        // values of all remaining iterations coincide with the current ones, so the remaining weights are applied to the current values.
+        std::vector<ValueType> previousValues(values.size());
+        ValueType weight = 0;
+        std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
+        for (uint_fast64_t index = 1; index <= foxGlynnResult.right; ++index) {
+            std::swap(values, previousValues);
+            multiplier->multiply(env, previousValues, addVector, values);
+            if (index >= foxGlynnResult.left) {
+                weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+                storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+            }
+            ValueType threshold = computeSteadyStateThreshold(epsilon, foxGlynnResult.right - index);
+            if (index < foxGlynnResult.right && storm::utility::vector::equalModuloPrecision(values, previousValues, threshold, false)) {
+                STORM_LOG_INFO("Detected steady state after " << index << " of " << foxGlynnResult.right << " iterations.");
+                weight = computeRemainingWeight(foxGlynnResult, index + 1);
+                storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                break;
+            }
+        }
+        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+        return result;
+    }
+
     if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
         // Perform the matrix-vector multiplications (without adding).
         multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
@@ -738,6 +934,240 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimePoints(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    // Use Fox-Glynn to get the truncation points and the weights for every time bound. Time bounds in which no time can pass keep the initial values.
+    std::vector<std::vector<ValueType>> results(timeBounds.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+    std::vector<boost::optional<storm::utility::numerical::FoxGlynnResult<ValueType>>> foxGlynnResults(timeBounds.size());
+    uint_fast64_t maxRight = 0;
+    for (uint_fast64_t i = 0; i < timeBounds.size(); ++i) {
+        ValueType lambda = timeBounds[i] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            results[i] = values;
+        } else {
+            foxGlynnResults[i] = storm::utility::numerical::foxGlynn(lambda, epsilon);
+            STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[i] << ": left=" << foxGlynnResults[i]->left
+                                                                      << ", right=" << foxGlynnResults[i]->right);
+            maxRight = std::max<uint_fast64_t>(maxRight, foxGlynnResults[i]->right);
+        }
+    }
+
+    STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+
+    // The powers of the uniformized matrix are shared among all time bounds, so a single series of matrix-vector multiplications up to the largest
+    // right truncation point suffices. In each step, the current values are scaled and added to the results of all time bounds whose truncation
+    // interval contains the step.
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    bool const steadyStateDetection = useSteadyStateDetection(env);
+    std::vector<ValueType> previousValues;
+    ValueType weight = 0;
+    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
+    for (uint_fast64_t index = 0; index <= maxRight; ++index) {
+        if (index > 0) {
+            if (steadyStateDetection) {
+                std::swap(values, previousValues);
+                values.resize(previousValues.size());
+                multiplier->multiply(env, previousValues, addVector, values);
+            } else {
+                multiplier->multiply(env, values, addVector, values);
+            }
+        }
+        for (uint_fast64_t i = 0; i < timeBounds.size(); ++i) {
+            auto const& foxGlynnResult = foxGlynnResults[i];
+            if (foxGlynnResult && foxGlynnResult->left <= index && index <= foxGlynnResult->right) {
+                weight = foxGlynnResult->weights[index - foxGlynnResult->left];
+                storm::utility::vector::applyPointwise(results[i], values, results[i], addAndScale);
+            }
+        }
+        if (steadyStateDetection && index > 0 && index < maxRight &&
+            storm::utility::vector::equalModuloPrecision(values, previousValues, computeSteadyStateThreshold(epsilon, maxRight - index), false)) {
+            // The values of all remaining iterations coincide with the current ones.
+            STORM_LOG_INFO("Detected steady state after " << index << " of " << maxRight << " iterations.");
+            for (uint_fast64_t i = 0; i < timeBounds.size(); ++i) {
+                auto const& foxGlynnResult = foxGlynnResults[i];
+                if (foxGlynnResult && index < foxGlynnResult->right) {
+                    weight = computeRemainingWeight(*foxGlynnResult, index + 1);
+                    storm::utility::vector::applyPointwise(results[i], values, results[i], addAndScale);
+                }
+            }
+            break;
+        }
+    }
+
+    // Finally, divide the results by the total weights
+    for (uint_fast64_t i = 0; i < timeBounds.size(); ++i) {
+        if (foxGlynnResults[i]) {
+            storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(results[i], storm::utility::one<ValueType>() / foxGlynnResults[i]->totalWeight);
+        }
+    }
+    return results;
+}
+
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<ValueType> SparseCtmcCslHelper::computeTransientDistributionWithAdaptiveUniformization(Environment const& env,
+                                                                                                  storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                                  std::vector<ValueType> const& exitRates,
+                                                                                                  std::vector<ValueType> values, ValueType timeBound,
+                                                                                                  ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+
+    // Determine (via breadth-first search) for each state the minimal number of steps in which it is reachable from the initial distribution.
+    std::vector<uint_fast64_t> distances(numberOfStates, std::numeric_limits<uint_fast64_t>::max());
+    std::vector<uint_fast64_t> reachableStates;
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        if (!storm::utility::isZero(values[state])) {
+            distances[state] = 0;
+            reachableStates.push_back(state);
+        }
+    }
+    for (uint_fast64_t i = 0; i < reachableStates.size(); ++i) {
+        uint_fast64_t state = reachableStates[i];
+        for (auto const& entry : rateMatrix.getRow(state)) {
+            if (!storm::utility::isZero(entry.getValue()) && distances[entry.getColumn()] == std::numeric_limits<uint_fast64_t>::max()) {
+                distances[entry.getColumn()] = distances[state] + 1;
+                reachableStates.push_back(entry.getColumn());
+            }
+        }
+    }
+
+    // The k-th step is uniformized with the maximal exit rate of the states reachable within k steps. Once this rate reaches the maximal exit rate
+    // of all reachable states, it stays constant.
+    std::vector<ValueType> rates;
+    for (auto state : reachableStates) {
+        if (distances[state] == rates.size()) {
+            rates.push_back(rates.empty() ? storm::utility::zero<ValueType>() : rates.back());
+        }
+        rates.back() = std::max(rates.back(), exitRates[state]);
+    }
+    if (rates.empty() || storm::utility::isZero(rates.back())) {
+        // No time can pass.
+        return values;
+    }
+    ValueType maxRate = rates.back();
+    uint_fast64_t numberOfAdaptiveSteps = std::find(rates.begin(), rates.end(), maxRate) - rates.begin();
+    rates.resize(numberOfAdaptiveSteps);
+    maxRate *= 1.02;
+    for (auto& rate : rates) {
+        rate *= 1.02;
+    }
+
+    ValueType lambda = timeBound * maxRate;
+    if (storm::utility::isZero(lambda)) {
+        return values;
+    }
+
+    // The number of steps performed until the time bound follows a pure birth process whose k-th state has the rate of the k-th step. We obtain its
+    // transient distribution by uniformizing it with the maximal rate. All birth states from numberOfAdaptiveSteps on have this rate, so the
+    // uniformized birth process just moves one state further per iteration there. We therefore only keep track of the distribution over the first
+    // states and of the probability to enter the remaining states in every iteration.
+    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+    STORM_LOG_DEBUG("Fox-Glynn cutoff points of the birth process: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+    std::vector<ValueType> birthDistribution(numberOfAdaptiveSteps, storm::utility::zero<ValueType>());
+    std::vector<ValueType> entranceProbabilities(foxGlynnResult.right + 1, storm::utility::zero<ValueType>());
+    if (numberOfAdaptiveSteps == 0) {
+        entranceProbabilities.front() = storm::utility::one<ValueType>();
+    } else {
+        birthDistribution.front() = storm::utility::one<ValueType>();
+    }
+    // Probabilities below this threshold are neglected. In total, this introduces an error of at most epsilon / 4.
+    ValueType const negligible = epsilon / storm::utility::convertNumber<ValueType>(static_cast<uint64_t>(8 * (foxGlynnResult.right + 1)));
+
+    // The probabilities of performing exactly k steps until the time bound.
+    std::vector<ValueType> stepProbabilities(numberOfAdaptiveSteps, storm::utility::zero<ValueType>());
+    uint_fast64_t lowestBirthState = 0;
+    for (uint_fast64_t iteration = 0; iteration <= foxGlynnResult.right && lowestBirthState < numberOfAdaptiveSteps; ++iteration) {
+        uint_fast64_t highestBirthState = std::min(numberOfAdaptiveSteps - 1, iteration);
+        if (iteration >= foxGlynnResult.left) {
+            ValueType weight = foxGlynnResult.weights[iteration - foxGlynnResult.left] / foxGlynnResult.totalWeight;
+            for (uint_fast64_t birthState = lowestBirthState; birthState <= highestBirthState; ++birthState) {
+                stepProbabilities[birthState] += weight * birthDistribution[birthState];
+            }
+        }
+        if (iteration == foxGlynnResult.right) {
+            break;
+        }
+
+        // Perform one iteration of the uniformized birth process.
+        entranceProbabilities[iteration + 1] = birthDistribution.back() * rates.back() / maxRate;
+        highestBirthState = std::min(numberOfAdaptiveSteps - 1, iteration + 1);
+        for (uint_fast64_t birthState = highestBirthState; birthState > lowestBirthState; --birthState) {
+            birthDistribution[birthState] = birthDistribution[birthState] * (storm::utility::one<ValueType>() - rates[birthState] / maxRate) +
+                                            birthDistribution[birthState - 1] * rates[birthState - 1] / maxRate;
+        }
+        birthDistribution[lowestBirthState] *= storm::utility::one<ValueType>() - rates[lowestBirthState] / maxRate;
+        while (lowestBirthState <= highestBirthState && birthDistribution[lowestBirthState] < negligible) {
+            birthDistribution[lowestBirthState] = storm::utility::zero<ValueType>();
+            ++lowestBirthState;
+        }
+    }
+    // Entering the birth state with the maximal rate in iteration m means that we are in birth state numberOfAdaptiveSteps + j after m + j iterations.
+    for (uint_fast64_t entranceIteration = 0; entranceIteration <= foxGlynnResult.right; ++entranceIteration) {
+        ValueType const& entranceProbability = entranceProbabilities[entranceIteration];
+        if (entranceProbability < negligible) {
+            continue;
+        }
+        uint_fast64_t firstIteration = std::max<uint_fast64_t>(entranceIteration, foxGlynnResult.left);
+        stepProbabilities.resize(std::max<uint_fast64_t>(stepProbabilities.size(), numberOfAdaptiveSteps + foxGlynnResult.right - entranceIteration + 1),
+                                 storm::utility::zero<ValueType>());
+        for (uint_fast64_t iteration = firstIteration; iteration <= foxGlynnResult.right; ++iteration) {
+            stepProbabilities[numberOfAdaptiveSteps + iteration - entranceIteration] +=
+                entranceProbability * foxGlynnResult.weights[iteration - foxGlynnResult.left] / foxGlynnResult.totalWeight;
+        }
+    }
+    while (!stepProbabilities.empty() && storm::utility::isZero(stepProbabilities.back())) {
+        stepProbabilities.pop_back();
+    }
+    STORM_LOG_INFO("Adaptive uniformization performs " << (stepProbabilities.empty() ? 0 : stepProbabilities.size() - 1) << " instead of "
+                                                       << foxGlynnResult.right << " matrix-vector multiplications.");
+
+    // Finally, perform the steps of the (adaptively) uniformized CTMC. The k-th step computes x + (x * (R - E)) / q_k, where R is the rate matrix,
+    // E the diagonal matrix of exit rates and q_k the rate of the k-th step.
+    storm::storage::SparseMatrix<ValueType> transposedRateMatrix = rateMatrix.transpose();
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, transposedRateMatrix);
+    bool const steadyStateDetection = useSteadyStateDetection(env);
+    std::vector<ValueType> result(numberOfStates, storm::utility::zero<ValueType>());
+    std::vector<ValueType> inflow(numberOfStates);
+    ValueType weight = 0;
+    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
+    for (uint_fast64_t step = 0; step < stepProbabilities.size(); ++step) {
+        weight = stepProbabilities[step];
+        if (!storm::utility::isZero(weight)) {
+            storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+        }
+        if (step + 1 == stepProbabilities.size()) {
+            break;
+        }
+
+        ValueType const& rate = step < numberOfAdaptiveSteps ? rates[step] : maxRate;
+        if (storm::utility::isZero(rate)) {
+            // None of the states reachable within this number of steps can be left.
+            continue;
+        }
+        multiplier->multiply(env, values, nullptr, inflow);
+        ValueType maxDiff = storm::utility::zero<ValueType>();
+        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+            ValueType diff = (inflow[state] - exitRates[state] * values[state]) / rate;
+            values[state] += diff;
+            maxDiff = std::max(maxDiff, storm::utility::abs(diff));
+        }
+        if (steadyStateDetection && maxDiff <= computeSteadyStateThreshold(epsilon, stepProbabilities.size() - step - 1)) {
+            // The values of all remaining steps coincide with the current ones.
+            STORM_LOG_INFO("Detected steady state after " << (step + 1) << " steps.");
+            weight = std::accumulate(stepProbabilities.begin() + step + 1, stepProbabilities.end(), storm::utility::zero<ValueType>());
+            storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+            break;
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -773,6 +1203,11 @@ template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabiliti
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, std::vector<double> const& timePoints);
+
 template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                             storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                             storm::storage::SparseMatrix<double> const& backwardTransitions,
@@ -835,6 +1270,14 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimePoints(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
+
+template std::vector<double> SparseCtmcCslHelper::computeTransientDistributionWithAdaptiveUniformization(
+    Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, std::vector<double> const& exitRates, std::vector<double> values,
+    double timeBound, double epsilon);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -845,6 +1288,15 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBounde
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& timePoints);
+template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& timePoints);
+
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector,
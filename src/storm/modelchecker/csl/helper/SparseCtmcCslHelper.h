@@ -38,6 +38,25 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi U[0, t] psi for each of the given time points t. Instead of performing a separate
+     * uniformization for each time point, the powers of the uniformized matrix are computed once and shared among all time points.
+     *
+     * @param timePoints The (non-negative, finite) time points.
+     * @return For each time point (in the given order), the vector of probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+        std::vector<ValueType> const& exitRates, std::vector<double> const& timePoints);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimePoints(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+        std::vector<ValueType> const& exitRates, std::vector<double> const& timePoints);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -142,6 +161,45 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for each of the given time bounds using a single series of matrix-vector multiplications
+     * (up to the largest right truncation point of the Fox-Glynn computations).
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The time bounds to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points
+     * @return For each time bound (in the given order), the vector of transient probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimePoints(Environment const& env,
+                                                                                          storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                          std::vector<ValueType> const* addVector,
+                                                                                          std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                          std::vector<ValueType> values, ValueType epsilon);
+
+    /*!
+     * Computes the transient distribution after the given time using adaptive uniformization, i.e., the k-th step is uniformized with the maximal
+     * exit rate of the states that are reachable from the initial distribution within k steps (instead of the maximal exit rate of all states).
+     * This saves steps if states with a high exit rate are only reachable after many steps.
+     * @see van Moorsel, Sanders: Adaptive uniformization. Stochastic Models 10(3), 1994.
+     *
+     * @param rateMatrix The rate matrix (whose rows correspond to the source states).
+     * @param exitRates The exit rates of all states.
+     * @param values The initial distribution.
+     * @param timeBound The time bound to use.
+     * @param epsilon The precision used for computing the truncation points.
+     * @return The transient distribution after the given time.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<ValueType> computeTransientDistributionWithAdaptiveUniformization(Environment const& env,
+                                                                                         storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                         std::vector<ValueType> const& exitRates, std::vector<ValueType> values,
+                                                                                         ValueType timeBound, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
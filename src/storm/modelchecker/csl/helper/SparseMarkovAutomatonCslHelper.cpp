@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
@@ -11,6 +13,7 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 #include "storm/solver/LpSolver.h"
@@ -132,19 +135,25 @@ class UnifPlusHelper {
         // The probabilities to go from a probabilistic state to a psi state in one step
         std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
 
-        // Set up a solver for the transitions between probabilistic states (if there are some)
+        // The inner iterations for the upper and the lower bound are independent of each other. If enabled, they are therefore performed concurrently.
+        bool parallel = false;
+#ifdef STORM_HAVE_INTELTBB
+        parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
+
+        // Set up the solvers for the transitions between probabilistic states (if there are some) and allocate auxiliary memory that can be used
+        // during the iterations. Each bound gets its own data such that the bounds can be handled concurrently.
         Environment solverEnv = env;
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
-        auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
-
-        // Allocate auxiliary memory that can be used during the iterations
+        InnerIterationData upperData(markovianMaybeStates.getNumberOfSetBits(), probabilisticToProbabilisticTransitions);
+        InnerIterationData lowerData(markovianMaybeStates.getNumberOfSetBits(), probabilisticToProbabilisticTransitions);
+        upperData.solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        if (parallel) {
+            lowerData.solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        }
         std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
         std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
         std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
-        std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
-        std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
 
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
@@ -161,15 +170,23 @@ class UnifPlusHelper {
             // Scale the weights so they sum to one.
             // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
 
-            // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
-
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
+            // Performs the inner iterations for one of the bounds and returns false iff they have been aborted.
+            auto performInnerIterations = [&](bool computeLowerBound, InnerIterationData& data) {
                 auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
                 ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+
+                // Set up multipliers (they are not shared among the bounds since they might cache data).
+                auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
+                auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+                // The values obtained when moving to a psi state in one step. These are added during the multiplications.
+                auto setOneStepValues = [&targetValue](std::vector<ValueType>& oneStepValues, std::vector<std::pair<uint64_t, ValueType>> const& oneStepProbs) {
+                    for (auto const& oneStepProb : oneStepProbs) {
+                        oneStepValues[oneStepProb.first] = oneStepProb.second * targetValue;
+                    }
+                };
+                setOneStepValues(data.markovianToPsiValues, markovianToPsiProbabilities);
+                setOneStepValues(data.probabilisticToPsiValues, probabilisticToPsiProbabilities);
+
                 storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
                                                                   std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
                 progressSteps.setMaxCount(N);
@@ -200,13 +217,10 @@ class UnifPlusHelper {
                         // Reaching this point means that this is the very first relevant iteration.
                         // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
                         // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                        std::fill(data.nextMarkovianStateValues.begin(), data.nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
                     } else {
-                        // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
-                        for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
-                        }
+                        // Compute the values at Markovian maybe states (including the values obtained when moving to a psi state).
+                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, &data.markovianToPsiValues, data.nextMarkovianStateValues);
                     }
 
                     // Update the value when reaching a psi state.
@@ -214,24 +228,25 @@ class UnifPlusHelper {
                     if (computeLowerBound && static_cast<uint64_t>(k) >= foxGlynnResult.left) {
                         assert(static_cast<uint64_t>(k) <= foxGlynnResult.right);  // has to hold since this iteration is relevant
                         targetValue += foxGlynnResult.weights[k - foxGlynnResult.left];
+                        setOneStepValues(data.markovianToPsiValues, markovianToPsiProbabilities);
+                        setOneStepValues(data.probabilisticToPsiValues, probabilisticToPsiProbabilities);
                     }
 
                     // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
-                    for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
-                    }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                    if (data.solver) {
+                        probabilisticToMarkovianMultiplier->multiply(env, data.nextMarkovianStateValues, &data.probabilisticToPsiValues, data.eqSysRhs);
+                        data.solver->solveEquations(solverEnv, dir, data.nextProbabilisticStateValues, data.eqSysRhs);
                     } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
-                                                                     probabilisticToProbabilisticTransitions.getRowGroupIndices());
+                        // Without transitions between probabilistic states, multiplying, adding the psi values and reducing can be done in a single pass.
+                        probabilisticToMarkovianMultiplier->multiplyAndReduce(env, dir, probabilisticToMarkovianTransitions.getRowGroupIndices(),
+                                                                              data.nextMarkovianStateValues, &data.probabilisticToPsiValues,
+                                                                              data.nextProbabilisticStateValues);
                     }
 
                     // Create the new values for the maybestates
                     // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, data.nextMarkovianStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, data.nextProbabilisticStateValues);
                     if (!computeLowerBound) {
                         // Add the scaled values to the actual result vector
                         uint64_t i = N - 1 - k;
@@ -244,8 +259,7 @@ class UnifPlusHelper {
 
                     progressSteps.updateProgress(N - k);
                     if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
-                        break;
+                        return false;
                     }
                 }
 
@@ -254,24 +268,45 @@ class UnifPlusHelper {
                 } else {
                     storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 }
+                return true;
+            };
 
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
+            // Perform inner iterations first for upper, then for lower bound
+            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
+            if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+                bool upperFinished = true;
+                bool lowerFinished = true;
+                tbb::task_group group;
+                group.run([&]() { upperFinished = performInnerIterations(false, upperData); });
+                group.run([&]() { lowerFinished = performInnerIterations(true, lowerData); });
+                group.wait();
+                abortedInnerIterations = !upperFinished || !lowerFinished;
+                if (!abortedInnerIterations && !storm::utility::resources::isTerminate()) {
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (!converged && relevantMaybeStates) {
+                        storeBestKnownSolution(bestKnownSolution, maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates.get());
+                    }
                 }
+#endif
+            } else {
+                for (bool computeLowerBound : {false, true}) {
+                    // The solver for the probabilistic states can be shared among the bounds if they are handled one after another.
+                    abortedInnerIterations = !performInnerIterations(computeLowerBound, upperData);
+                    if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                        break;
+                    }
 
-                // Check if the lower and upper bound are sufficiently close to each other
-                converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                if (converged) {
-                    break;
-                }
+                    // Check if the lower and upper bound are sufficiently close to each other
+                    converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
+                    if (converged) {
+                        break;
+                    }
 
-                // Store the best solution we have found so far.
-                if (relevantMaybeStates) {
-                    auto currentSolIt = bestKnownSolution.begin();
-                    for (auto state : relevantMaybeStates.get()) {
-                        // We take the average of the lower and upper bounds
-                        *currentSolIt = (maybeStatesValuesLower[state] + maybeStatesValuesUpper[state]) / two;
-                        ++currentSolIt;
+                    // Store the best solution we have found so far.
+                    if (relevantMaybeStates) {
+                        storeBestKnownSolution(bestKnownSolution, maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates.get());
                     }
                 }
             }
@@ -329,6 +364,38 @@ class UnifPlusHelper {
     }
 
    private:
+    /*!
+     * The auxiliary data needed when performing the inner iterations for one of the bounds.
+     */
+    struct InnerIterationData {
+        InnerIterationData(uint64_t numberOfMarkovianMaybeStates, storm::storage::SparseMatrix<ValueType> const& probabilisticToProbabilisticTransitions)
+            : nextMarkovianStateValues(numberOfMarkovianMaybeStates),
+              nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount()),
+              eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount()),
+              markovianToPsiValues(numberOfMarkovianMaybeStates, storm::utility::zero<ValueType>()),
+              probabilisticToPsiValues(probabilisticToProbabilisticTransitions.getRowCount(), storm::utility::zero<ValueType>()) {
+            // Intentionally left empty
+        }
+
+        std::vector<ValueType> nextMarkovianStateValues;
+        std::vector<ValueType> nextProbabilisticStateValues;
+        std::vector<ValueType> eqSysRhs;
+        // The values obtained at Markovian (probabilistic) states when moving to a psi state in one step.
+        std::vector<ValueType> markovianToPsiValues;
+        std::vector<ValueType> probabilisticToPsiValues;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+    };
+
+    void storeBestKnownSolution(std::vector<ValueType>& bestKnownSolution, std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
+                                storm::storage::BitVector const& relevantMaybeStates) {
+        auto currentSolIt = bestKnownSolution.begin();
+        for (auto state : relevantMaybeStates) {
+            // We take the average of the lower and upper bounds
+            *currentSolIt = (lower[state] + upper[state]) / storm::utility::convertNumber<ValueType>(2.0);
+            ++currentSolIt;
+        }
+    }
+
     bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
                           boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
         STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
@@ -16,6 +16,7 @@ ExplorationInformation<StateType, ValueType>::ExplorationInformation(storm::Opti
       localPrecomputation(false),
       numberOfExplorationStepsUntilPrecomputation(100000),
       numberOfSampledPathsUntilPrecomputation(),
+      numberOfConcurrentPaths(1),
       nextStateHeuristic(storm::settings::modules::ExplorationSettings::NextStateHeuristic::DifferenceProbabilitySum) {
     storm::settings::modules::ExplorationSettings const& settings = storm::settings::getModule<storm::settings::modules::ExplorationSettings>();
     localPrecomputation = settings.isLocalPrecomputationSet();
@@ -24,6 +25,8 @@ ExplorationInformation<StateType, ValueType>::ExplorationInformation(storm::Opti
         numberOfSampledPathsUntilPrecomputation = settings.getNumberOfSampledPathsUntilPrecomputation();
     }
 
+    numberOfConcurrentPaths = settings.getNumberOfConcurrentPaths();
+
     nextStateHeuristic = settings.getNextStateHeuristic();
 }
 
@@ -190,6 +193,16 @@ bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiv
     }
 }
 
+template<typename StateType, typename ValueType>
+std::size_t ExplorationInformation<StateType, ValueType>::getNumberOfExplorationStepsUntilPrecomputation() const {
+    return numberOfExplorationStepsUntilPrecomputation;
+}
+
+template<typename StateType, typename ValueType>
+std::size_t ExplorationInformation<StateType, ValueType>::getNumberOfConcurrentPaths() const {
+    return numberOfConcurrentPaths;
+}
+
 template<typename StateType, typename ValueType>
 bool ExplorationInformation<StateType, ValueType>::useLocalPrecomputation() const {
     return localPrecomputation;
@@ -88,6 +88,10 @@ class ExplorationInformation {
 
     bool performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const;
 
+    std::size_t getNumberOfExplorationStepsUntilPrecomputation() const;
+
+    std::size_t getNumberOfConcurrentPaths() const;
+
     bool useLocalPrecomputation() const;
 
     bool useGlobalPrecomputation() const;
@@ -118,6 +122,7 @@ class ExplorationInformation {
     bool localPrecomputation;
     std::size_t numberOfExplorationStepsUntilPrecomputation;
     boost::optional<std::size_t> numberOfSampledPathsUntilPrecomputation;
+    std::size_t numberOfConcurrentPaths;
 
     storm::settings::modules::ExplorationSettings::NextStateHeuristic nextStateHeuristic;
 };
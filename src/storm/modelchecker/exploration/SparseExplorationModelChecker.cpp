@@ -1,5 +1,7 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
@@ -81,6 +83,10 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
 template<typename ModelType, typename StateType>
 std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performExploration(
     StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+    if (explorationInformation.getNumberOfConcurrentPaths() > 1) {
+        return performConcurrentExploration(stateGeneration, explorationInformation);
+    }
+
     // Generate the initial state so we know where to start the simulation.
     stateGeneration.computeInitialStates();
     STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
@@ -136,6 +142,153 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                            bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
+template<typename ModelType, typename StateType>
+std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType>
+SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(
+    StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+    // Generate the initial state so we know where to start the simulation.
+    stateGeneration.computeInitialStates();
+    STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
+                    "Currently only models with one initial state are supported by the exploration engine.");
+    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+
+    // Create a structure that holds the bounds for the states and actions.
+    Bounds<StateType, ValueType> bounds;
+
+    // Every path has its own stack and random generator.
+    std::size_t numberOfPaths = explorationInformation.getNumberOfConcurrentPaths();
+    std::vector<StateActionStack> stacks(numberOfPaths);
+    std::vector<std::default_random_engine> generators;
+    for (std::size_t index = 0; index < numberOfPaths; ++index) {
+        generators.emplace_back(randomGenerator());
+    }
+    std::vector<PathStatus> statuses(numberOfPaths);
+    std::vector<std::size_t> steps(numberOfPaths);
+
+    // A path is interrupted after this number of steps in a round, such that paths that are trapped in an end component eventually trigger a
+    // precomputation.
+    std::size_t maximalStepsPerRound = explorationInformation.getNumberOfExplorationStepsUntilPrecomputation() + 1;
+
+    bool useTbb = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!useTbb, "Storm was built without support for Intel TBB, the paths are sampled sequentially.");
+    useTbb = false;
+#endif
+
+    // The exploration proceeds in rounds. In each round, all paths are first advanced through the explored part of the state space. As this
+    // neither modifies the exploration information nor the bounds, the paths are advanced in parallel. Afterwards, the states at which the paths
+    // stopped are explored and the bounds along the paths that reached a terminal state are updated sequentially.
+    Statistics<StateType, ValueType> stats;
+    bool convergenceCriterionMet = false;
+    while (!convergenceCriterionMet) {
+        auto advance = [&, this](std::size_t index) {
+            if (stacks[index].empty()) {
+                stacks[index].emplace_back(initialStateIndex, 0);
+            }
+            steps[index] = 0;
+            statuses[index] = advancePath(stacks[index], explorationInformation, bounds, generators[index], steps[index], maximalStepsPerRound);
+        };
+        if (useTbb) {
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<std::size_t>(0, numberOfPaths), [&advance](tbb::blocked_range<std::size_t> const& range) {
+                for (std::size_t index = range.begin(); index != range.end(); ++index) {
+                    advance(index);
+                }
+            });
+#endif
+        } else {
+            for (std::size_t index = 0; index < numberOfPaths; ++index) {
+                advance(index);
+            }
+        }
+
+        bool precomputationPerformed = false;
+        for (std::size_t index = 0; index < numberOfPaths; ++index) {
+            StateActionStack& stack = stacks[index];
+            stats.explorationSteps += steps[index];
+            stats.explorationStepsSinceLastPrecomputation += steps[index];
+
+            bool foundTerminalState = statuses[index] == PathStatus::Terminal;
+            if (statuses[index] == PathStatus::Unexplored) {
+                // The state may have been explored for another path in this round already.
+                StateType currentStateId = stack.back().first;
+                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                    storm::generator::CompressedState const& compressedState = unexploredIt->second;
+                    foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
+                    explorationInformation.removeUnexploredState(unexploredIt);
+                } else {
+                    foundTerminalState = explorationInformation.isTerminal(currentStateId);
+                }
+            }
+
+            if (foundTerminalState) {
+                stats.sampledPath();
+                stats.updateMaxPathLength(stack.size());
+                STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+            } else if (explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
+                performPrecomputation(stack, explorationInformation, bounds, stats);
+                precomputationPerformed = true;
+                break;
+            }
+        }
+
+        STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, "
+                                              << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
+        STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
+                                                         << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+        ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+        STORM_LOG_DEBUG("Difference after " << stats.pathsSampled << " paths is " << difference << ".");
+        convergenceCriterionMet = comparator.isZero(difference);
+
+        // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+        if (!convergenceCriterionMet && !precomputationPerformed &&
+            explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+            performPrecomputation(StateActionStack(), explorationInformation, bounds, stats);
+            precomputationPerformed = true;
+        }
+
+        // A precomputation may collapse end components, which invalidates the actions on the stacks, so all paths are restarted.
+        if (precomputationPerformed) {
+            STORM_LOG_TRACE("Aborting all paths after precomputation.");
+            for (auto& stack : stacks) {
+                stack.clear();
+            }
+        }
+    }
+
+    // Show statistics if required.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        stats.printToStream(std::cout, explorationInformation);
+    }
+
+    return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation),
+                           bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+}
+
+template<typename ModelType, typename StateType>
+typename SparseExplorationModelChecker<ModelType, StateType>::PathStatus SparseExplorationModelChecker<ModelType, StateType>::advancePath(
+    StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& generator, std::size_t& steps, std::size_t const& maximalSteps) const {
+    while (steps < maximalSteps) {
+        StateType currentStateId = stack.back().first;
+        if (explorationInformation.findUnexploredState(currentStateId) != explorationInformation.unexploredStatesEnd()) {
+            return PathStatus::Unexplored;
+        }
+
+        ++steps;
+        if (explorationInformation.isTerminal(currentStateId)) {
+            return PathStatus::Terminal;
+        }
+
+        ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, generator);
+        stack.back().second = chosenAction;
+        stack.emplace_back(sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator), 0);
+    }
+    return PathStatus::Interrupted;
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
@@ -177,11 +330,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -314,7 +467,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& generator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -350,13 +504,13 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
     // Now sample from all maximizing actions.
     std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-    return actionValues[distribution(randomGenerator)].first;
+    return actionValues[distribution(generator)].first;
 }
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
     ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -377,11 +531,11 @@ StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFr
 
         // Now sample according to the probabilities.
         std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     } else {
         STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
         std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     }
 }
 
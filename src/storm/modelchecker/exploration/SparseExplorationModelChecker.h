@@ -54,9 +54,19 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                                                                    CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
    private:
+    // The reason for which the advancement of a path stopped.
+    enum class PathStatus { Terminal, Unexplored, Interrupted };
+
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    std::tuple<StateType, ValueType, ValueType> performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                             ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+
+    PathStatus advancePath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation,
+                           Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator, std::size_t& steps,
+                           std::size_t const& maximalSteps) const;
+
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
                                     Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -66,10 +76,10 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
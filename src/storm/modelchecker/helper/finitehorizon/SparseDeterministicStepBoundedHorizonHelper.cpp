@@ -1,4 +1,8 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
+
+#include <algorithm>
+#include <numeric>
+
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 
@@ -9,7 +13,9 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
+#include "storm/solver/helper/AcyclicSolverHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/SparseMatrixView.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -65,14 +71,15 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
 
         // Perform the matrix vector multiplication
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-        if (lowerBound == 0) {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound);
-        } else {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound - lowerBound + 1);
-            submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
-            multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-            b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiply(env, subresult, &b, lowerBound - 1);
+        uint64_t steps = getNumberOfRelevantSteps(submatrix, lowerBound == 0 ? upperBound : upperBound - lowerBound + 1);
+        multiplier->repeatedMultiply(env, subresult, &b, steps);
+        if (lowerBound > 0) {
+            // For the remaining steps, the target states are no longer absorbing. Instead of extracting a second submatrix (while the first one
+            // is still alive), we multiply directly with a view on the original matrix.
+            multiplier.reset();
+            submatrix = storm::storage::SparseMatrix<ValueType>();
+            storm::storage::SparseMatrixView<ValueType> submatrixView(transitionMatrix, true, maybeStates, maybeStates);
+            submatrixView.repeatedMultiply(subresult, nullptr, lowerBound - 1);
         }
 
         // Set the values of the resulting vector accordingly.
@@ -82,6 +89,66 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
     return result;
 }
 
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseDeterministicStepBoundedHorizonHelper<ValueType>::computeForUpperBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<uint64_t> const& upperBounds) {
+    std::vector<std::vector<ValueType>> results(upperBounds.size());
+    if (upperBounds.empty()) {
+        return results;
+    }
+
+    // Process the bounds in ascending order.
+    std::vector<uint64_t> boundOrder(upperBounds.size());
+    std::iota(boundOrder.begin(), boundOrder.end(), 0);
+    std::sort(boundOrder.begin(), boundOrder.end(), [&upperBounds](uint64_t first, uint64_t second) { return upperBounds[first] < upperBounds[second]; });
+    uint64_t const maximalBound = upperBounds[boundOrder.back()];
+
+    // The maybe states w.r.t. the largest bound are a superset of the maybe states of all other bounds.
+    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, maximalBound);
+    maybeStates &= ~psiStates;
+    STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
+
+    std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+    if (maybeStates.empty()) {
+        for (auto& boundResult : results) {
+            boundResult = result;
+        }
+        return results;
+    }
+
+    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
+    std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, psiStates);
+    std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
+    uint64_t const relevantSteps = getNumberOfRelevantSteps(submatrix, maximalBound);
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+
+    // Continue the multiplications of the previous bound.
+    uint64_t performedSteps = 0;
+    for (auto const& boundIndex : boundOrder) {
+        uint64_t steps = std::min(upperBounds[boundIndex], relevantSteps);
+        if (steps > performedSteps) {
+            multiplier->repeatedMultiply(env, subresult, &b, steps - performedSteps);
+            performedSteps = steps;
+        }
+        storm::utility::vector::setVectorValues(result, maybeStates, subresult);
+        results[boundIndex] = result;
+    }
+    return results;
+}
+
+template<typename ValueType>
+uint64_t SparseDeterministicStepBoundedHorizonHelper<ValueType>::getNumberOfRelevantSteps(storm::storage::SparseMatrix<ValueType> const& submatrix,
+                                                                                          uint64_t steps) {
+    // On acyclic models, the values do not change any more once the number of steps exceeds the length of the longest path.
+    if (steps > 1 && !storm::utility::graph::hasCycle(submatrix)) {
+        return std::min(steps, storm::solver::helper::computeLongestPathLength(submatrix));
+    }
+    return steps;
+}
+
 template class SparseDeterministicStepBoundedHorizonHelper<double>;
 template class SparseDeterministicStepBoundedHorizonHelper<storm::RationalNumber>;
 template class SparseDeterministicStepBoundedHorizonHelper<storm::RationalFunction>;
@@ -20,7 +20,26 @@ class SparseDeterministicStepBoundedHorizonHelper {
                                    storm::storage::BitVector const& psiStates, uint64_t lowerBound, uint64_t upperBound,
                                    ModelCheckerHint const& hint = ModelCheckerHint());
 
+    /*!
+     * Computes the probabilities of satisfying phi U<=k psi for each of the given step bounds k in a single pass. The bounds are processed in
+     * ascending order, such that the multiplications for a smaller bound are continued for the next larger one instead of starting from scratch.
+     * Moreover, the maybe states and the corresponding submatrix are only computed once.
+     *
+     * @param upperBounds The step bounds, which may be given in any order.
+     * @return For each of the given bounds, the values of all states.
+     */
+    std::vector<std::vector<ValueType>> computeForUpperBounds(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                              std::vector<uint64_t> const& upperBounds);
+
    private:
+    /*!
+     * Retrieves the number of multiplications with the given maybe-state matrix after which the values do not change any more, when at most the
+     * given number of steps is to be performed.
+     */
+    static uint64_t getNumberOfRelevantSteps(storm::storage::SparseMatrix<ValueType> const& submatrix, uint64_t steps);
 };
 
 }  // namespace helper
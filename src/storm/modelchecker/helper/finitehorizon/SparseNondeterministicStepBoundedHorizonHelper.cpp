@@ -9,7 +9,9 @@
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/helper/AcyclicSolverHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/SparseMatrixView.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -64,14 +66,19 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
         std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-        if (lowerBound == 0) {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound);
-        } else {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1);
-            storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
-            auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-            b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, lowerBound - 1);
+        // On acyclic models, the values do not change any more once the number of steps exceeds the length of the longest path.
+        uint64_t steps = lowerBound == 0 ? upperBound : upperBound - lowerBound + 1;
+        if (steps > 1 && !storm::utility::graph::hasCycle(submatrix)) {
+            steps = std::min(steps, storm::solver::helper::computeLongestPathLength(submatrix));
+        }
+        multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, steps);
+        if (lowerBound > 0) {
+            // For the remaining steps, the target states are no longer absorbing. Instead of extracting a second submatrix (while the first one
+            // is still alive), we multiply directly with a view on the original matrix.
+            multiplier.reset();
+            submatrix = storm::storage::SparseMatrix<ValueType>();
+            storm::storage::SparseMatrixView<ValueType> submatrixView(transitionMatrix, true, maybeStates, maybeStates);
+            submatrixView.repeatedMultiplyAndReduce(goal.direction(), subresult, nullptr, lowerBound - 1);
         }
         // Set the values of the resulting vector accordingly.
         storm::utility::vector::setVectorValues(result, maybeStates, subresult);
@@ -1,6 +1,7 @@
 #include "SparseDeterministicVisitingTimesHelper.h"
 
 #include <algorithm>
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -80,28 +81,46 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
 
 template<typename ValueType>
 void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues) {
-    STORM_LOG_ASSERT(stateValues.size() == _transitionMatrix.getRowCount(), "Dimension missmatch.");
+    std::vector<std::vector<ValueType>> stateValuesBatch;
+    stateValuesBatch.push_back(std::move(stateValues));
+    computeExpectedVisitingTimes(env, stateValuesBatch);
+    stateValues = std::move(stateValuesBatch.front());
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env,
+                                                                                     std::vector<std::vector<ValueType>>& stateValuesBatch) {
+    for (auto const& stateValues : stateValuesBatch) {
+        STORM_LOG_ASSERT(stateValues.size() == _transitionMatrix.getRowCount(), "Dimension missmatch.");
+    }
+    if (stateValuesBatch.empty()) {
+        return;
+    }
     createBackwardTransitions();
     createDecomposition(env);
     auto sccEnv = getEnvironmentForSccSolver(env);
 
-    // Create auxiliary data and lambdas
-    storm::storage::BitVector sccAsBitVector(stateValues.size(), false);
-    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
-    auto isExitState = [this, &isLeavingTransition](uint64_t state) {
-        auto row = this->_transitionMatrix.getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransition);
-    };
-    auto isLeavingTransitionWithNonZeroValue = [&isLeavingTransition, &stateValues](auto const& e) {
-        return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn()]);
-    };
-    auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
-        if (!storm::utility::isZero(stateValues[state])) {
-            return true;
+    if (env.solver().topological().isParallelSccSolvingSet()) {
+        processSccsInParallel(sccEnv, stateValuesBatch);
+    } else {
+        processSccsSequentially(sccEnv, stateValuesBatch);
+    }
+
+    if (isContinuousTime()) {
+        // Divide with the exit rates
+        // Since storm::utility::infinity<storm::RationalNumber>() is just set to some big number, we have to treat the infinity-case explicitly.
+        for (auto& stateValues : stateValuesBatch) {
+            storm::utility::vector::applyPointwise(stateValues, *_exitRates, stateValues, [](ValueType const& xi, ValueType const& yi) -> ValueType {
+                return storm::utility::isInfinity(xi) ? xi : xi / yi;
+            });
         }
-        auto row = this->_backwardTransitions->getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
-    };
+    }
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processSccsSequentially(storm::Environment const& sccEnv,
+                                                                                std::vector<std::vector<ValueType>>& stateValuesBatch) const {
+    storm::storage::BitVector sccAsBitVector(_transitionMatrix.getRowCount(), false);
 
     // We solve each SCC individually in *forward* topological order
     storm::utility::ProgressMeasurement progress("sccs");
@@ -110,40 +129,130 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
     uint64_t sccIndex = 0;
     auto sccItEnd = std::make_reverse_iterator(_sccDecomposition->begin());
     for (auto sccIt = std::make_reverse_iterator(_sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
-        auto const& scc = *sccIt;
-        if (scc.size() == 1) {
-            processSingletonScc(*scc.begin(), stateValues);
-        } else {
-            sccAsBitVector.set(scc.begin(), scc.end(), true);
-            if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isExitState)) {
-                // This is not a BSCC
-                auto sccResult = computeValueForNonTrivialScc(sccEnv, sccAsBitVector, stateValues);
-                storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
-            } else {
-                // This is a BSCC
-                if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                } else {
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
-                }
-            }
-            sccAsBitVector.clear();
-        }
+        processScc(sccEnv, *sccIt, sccAsBitVector, stateValuesBatch);
         ++sccIndex;
         progress.updateProgress(sccIndex);
         if (storm::utility::resources::isTerminate()) {
-            STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << this->_computedSccDecomposition->size() << " SCCs.");
+            STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << this->_sccDecomposition->size() << " SCCs.");
             break;
         }
     }
+}
 
-    if (isContinuousTime()) {
-        // Divide with the exit rates
-        // Since storm::utility::infinity<storm::RationalNumber>() is just set to some big number, we have to treat the infinity-case explicitly.
-        storm::utility::vector::applyPointwise(stateValues, *_exitRates, stateValues, [](ValueType const& xi, ValueType const& yi) -> ValueType {
-            return storm::utility::isInfinity(xi) ? xi : xi / yi;
-        });
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processSccsInParallel(storm::Environment const& sccEnv,
+                                                                              std::vector<std::vector<ValueType>>& stateValuesBatch) const {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Operations on rational functions share a (non thread-safe) cache, so we have to process them sequentially.
+        STORM_LOG_WARN("Processing SCCs in parallel is not supported for rational functions, defaulting to sequential version.");
+        processSccsSequentially(sccEnv, stateValuesBatch);
+    } else {
+        auto const& sccDecomposition = *_sccDecomposition;
+        uint64_t const numberOfSccs = sccDecomposition.size();
+
+        // The value of an SCC only depends on the values of its predecessor SCCs. We therefore assign to each SCC its level, i.e., the length of the
+        // longest chain of predecessor SCCs, and process all SCCs of the same level concurrently. As the decomposition is sorted in reverse
+        // topological order, the levels of all predecessors of an SCC are final once we reach it.
+        std::vector<uint64_t> stateToSccIndex(_transitionMatrix.getRowCount());
+        for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+            for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                stateToSccIndex[state] = sccIndex;
+            }
+        }
+        std::vector<uint64_t> sccLevels(numberOfSccs, 0);
+        uint64_t maxLevel = 0;
+        for (uint64_t sccIndex = numberOfSccs; sccIndex > 0;) {
+            --sccIndex;
+            uint64_t const successorLevel = sccLevels[sccIndex] + 1;
+            maxLevel = std::max(maxLevel, sccLevels[sccIndex]);
+            for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+                for (auto const& entry : _transitionMatrix.getRow(state)) {
+                    uint64_t const successorScc = stateToSccIndex[entry.getColumn()];
+                    if (successorScc != sccIndex) {
+                        sccLevels[successorScc] = std::max(sccLevels[successorScc], successorLevel);
+                    }
+                }
+            }
+        }
+        std::vector<std::vector<uint64_t>> sccsByLevel(numberOfSccs == 0 ? 0 : maxLevel + 1);
+        for (uint64_t sccIndex = numberOfSccs; sccIndex > 0;) {
+            --sccIndex;
+            sccsByLevel[sccLevels[sccIndex]].push_back(sccIndex);
+        }
+
+        // Each thread keeps its own auxiliary bit vector across all the SCCs it processes.
+        tbb::enumerable_thread_specific<storm::storage::BitVector> sccAsBitVectors(
+            [this]() { return storm::storage::BitVector(_transitionMatrix.getRowCount(), false); });
+        uint64_t processedSccCount = 0;
+        storm::utility::ProgressMeasurement progress("sccs");
+        progress.setMaxCount(numberOfSccs);
+        progress.startNewMeasurement(0);
+        for (auto const& sccIndices : sccsByLevel) {
+            // SCCs of the same level write to disjoint states and only read the values of states of smaller levels.
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                storm::storage::BitVector& sccAsBitVector = sccAsBitVectors.local();
+                for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                    processScc(sccEnv, sccDecomposition.getBlock(sccIndices[index]), sccAsBitVector, stateValuesBatch);
+                }
+            });
+            processedSccCount += sccIndices.size();
+            progress.updateProgress(processedSccCount);
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << processedSccCount << "/" << numberOfSccs << " SCCs.");
+                break;
+            }
+        }
     }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    processSccsSequentially(sccEnv, stateValuesBatch);
+#endif
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processScc(storm::Environment const& sccEnv, storm::storage::StronglyConnectedComponent const& scc,
+                                                                   storm::storage::BitVector& sccAsBitVector,
+                                                                   std::vector<std::vector<ValueType>>& stateValuesBatch) const {
+    if (scc.size() == 1) {
+        for (auto& stateValues : stateValuesBatch) {
+            processSingletonScc(*scc.begin(), stateValues);
+        }
+        return;
+    }
+
+    // Create auxiliary lambdas
+    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
+    auto isExitState = [this, &isLeavingTransition](uint64_t state) {
+        auto row = this->_transitionMatrix.getRow(state);
+        return std::any_of(row.begin(), row.end(), isLeavingTransition);
+    };
+
+    sccAsBitVector.set(scc.begin(), scc.end(), true);
+    if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isExitState)) {
+        // This is not a BSCC
+        computeValuesForNonTrivialScc(sccEnv, sccAsBitVector, stateValuesBatch);
+    } else {
+        // This is a BSCC
+        for (auto& stateValues : stateValuesBatch) {
+            auto isLeavingTransitionWithNonZeroValue = [&isLeavingTransition, &stateValues](auto const& e) {
+                return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn()]);
+            };
+            auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
+                if (!storm::utility::isZero(stateValues[state])) {
+                    return true;
+                }
+                auto row = this->_backwardTransitions->getRow(state);
+                return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
+            };
+            if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
+                storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
+            } else {
+                storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
+            }
+        }
+    }
+    sccAsBitVector.clear();
 }
 
 template<typename ValueType>
@@ -222,9 +331,9 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint
 }
 
 template<typename ValueType>
-std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::computeValueForNonTrivialScc(storm::Environment const& env,
-                                                                                                       storm::storage::BitVector const& sccAsBitVector,
-                                                                                                       std::vector<ValueType> const& stateValues) const {
+void SparseDeterministicVisitingTimesHelper<ValueType>::computeValuesForNonTrivialScc(storm::Environment const& env,
+                                                                                      storm::storage::BitVector const& sccAsBitVector,
+                                                                                      std::vector<std::vector<ValueType>>& stateValuesBatch) const {
     // Here we assume that the SCC is not a BSCC
     // Let P be the SCC matrix. We solve the equation system
     //       x * P + b = x
@@ -244,19 +353,7 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
         sccMatrix.convertToEquationSystem();
     }
 
-    // Get the vector for the equation system
-    auto sccVector = storm::utility::vector::filterVector(stateValues, sccAsBitVector);
-    auto valIt = sccVector.begin();
-    for (auto sccState : sccAsBitVector) {
-        for (auto const& entry : _backwardTransitions->getRow(sccState)) {
-            if (!sccAsBitVector.get(entry.getColumn())) {
-                (*valIt) += entry.getValue() * stateValues[entry.getColumn()];
-            }
-        }
-        ++valIt;
-    }
-
-    // Get the solver object and satisfy requirements
+    // Get the solver object and satisfy requirements. The solver is shared by all initial distributions.
     auto solver = linearEquationSolverFactory.create(env, std::move(sccMatrix));
     solver->setLowerBound(storm::utility::zero<ValueType>());
     auto req = solver->getRequirements(env);
@@ -265,9 +362,29 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
     // However, all relevant solvers for this kind of equation system do not require upper bounds.
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    std::vector<ValueType> eqSysValues(sccVector.size());
-    solver->solveEquations(env, eqSysValues, sccVector);
-    return eqSysValues;
+
+    std::vector<ValueType> eqSysValues(sccAsBitVector.getNumberOfSetBits());
+    for (auto& stateValues : stateValuesBatch) {
+        // Get the vector for the equation system
+        auto sccVector = storm::utility::vector::filterVector(stateValues, sccAsBitVector);
+        auto valIt = sccVector.begin();
+        for (auto sccState : sccAsBitVector) {
+            for (auto const& entry : _backwardTransitions->getRow(sccState)) {
+                if (!sccAsBitVector.get(entry.getColumn())) {
+                    (*valIt) += entry.getValue() * stateValues[entry.getColumn()];
+                }
+            }
+            ++valIt;
+        }
+        if (storm::utility::vector::hasNonZeroEntry(sccVector)) {
+            eqSysValues.assign(eqSysValues.size(), storm::utility::zero<ValueType>());
+            solver->solveEquations(env, eqSysValues, sccVector);
+            storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, eqSysValues);
+        } else {
+            // The SCC is not reachable under this initial distribution.
+            storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
+        }
+    }
 }
 
 template class SparseDeterministicVisitingTimesHelper<double>;
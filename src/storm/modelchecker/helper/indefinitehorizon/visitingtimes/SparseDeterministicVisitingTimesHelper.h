@@ -83,6 +83,14 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     void computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues);
 
+    /*!
+     * Computes the expected visiting times for several initial distributions at once. The SCC decomposition, the equation systems and the solvers
+     * for the non-trivial SCCs are only created once for all initial distributions.
+     * @pre each vector of stateValuesBatch contains for each state the initial value (probability) for that state.
+     * @post each vector of stateValuesBatch contains the expected visiting times w.r.t. its initial values
+     */
+    void computeExpectedVisitingTimes(Environment const& env, std::vector<std::vector<ValueType>>& stateValuesBatch);
+
    private:
     /*!
      * @return true iff this is a computation on a continuous time model (i.e. CTMC, MA)
@@ -110,11 +118,29 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
     void processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues) const;
 
     /*!
-     * Solves the equation system for non-trivial SCCs (i.e. non-bottom SCCs with more than 1 state).
-     * @return for each state of the given SCC the expected number of times that state is visited.
+     * Processes the SCCs one after another in forward topological order.
+     */
+    void processSccsSequentially(storm::Environment const& sccEnv, std::vector<std::vector<ValueType>>& stateValuesBatch) const;
+
+    /*!
+     * Processes the SCCs level by level, where all SCCs whose predecessor SCCs have been processed already are handled concurrently.
+     * Falls back to the sequential version if Storm is built without Intel TBB.
+     */
+    void processSccsInParallel(storm::Environment const& sccEnv, std::vector<std::vector<ValueType>>& stateValuesBatch) const;
+
+    /*!
+     * Computes the values of the states of the given SCC, assuming that the values of all predecessor SCCs are final.
+     * @param sccAsBitVector auxiliary bit vector that needs to be empty. It is empty again when this method returns.
+     */
+    void processScc(storm::Environment const& sccEnv, storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccAsBitVector,
+                    std::vector<std::vector<ValueType>>& stateValuesBatch) const;
+
+    /*!
+     * Solves the equation system for non-trivial SCCs (i.e. non-bottom SCCs with more than 1 state) for all given initial distributions.
+     * The resulting values are directly inserted into the vectors of stateValuesBatch.
      */
-    std::vector<ValueType> computeValueForNonTrivialScc(storm::Environment const& env, storm::storage::BitVector const& sccAsBitVector,
-                                                        std::vector<ValueType> const& stateValues) const;
+    void computeValuesForNonTrivialScc(storm::Environment const& env, storm::storage::BitVector const& sccAsBitVector,
+                                       std::vector<std::vector<ValueType>>& stateValuesBatch) const;
 
     storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
     std::vector<ValueType> const* _exitRates;
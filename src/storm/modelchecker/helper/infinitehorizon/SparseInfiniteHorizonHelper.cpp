@@ -1,8 +1,11 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <type_traits>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -24,6 +27,11 @@
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 
 namespace storm {
@@ -130,24 +138,57 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     return computeLongRunAverageValues(env, stateValuesGetter, actionValuesGetter);
 }
 
+template<typename ValueType, bool Nondeterministic>
+std::vector<std::vector<ValueType>> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLongRunAverageRewards(
+    Environment const& env, std::vector<storm::models::sparse::StandardRewardModel<ValueType> const*> const& rewardModels) {
+    std::vector<ValueGetter> stateRewardsGetters, actionRewardsGetters;
+    stateRewardsGetters.reserve(rewardModels.size());
+    actionRewardsGetters.reserve(rewardModels.size());
+    for (auto const* rewardModelPtr : rewardModels) {
+        STORM_LOG_ASSERT(rewardModelPtr != nullptr, "Reward model must not be null.");
+        auto const& rewardModel = *rewardModelPtr;
+        if (rewardModel.hasStateRewards()) {
+            stateRewardsGetters.push_back([&rewardModel](uint64_t stateIndex) { return rewardModel.getStateReward(stateIndex); });
+        } else {
+            stateRewardsGetters.push_back([](uint64_t) { return storm::utility::zero<ValueType>(); });
+        }
+        if (rewardModel.hasTransitionRewards()) {
+            actionRewardsGetters.push_back([&rewardModel, this](uint64_t globalChoiceIndex) {
+                return rewardModel.getStateActionAndTransitionReward(globalChoiceIndex, this->_transitionMatrix);
+            });
+        } else if (rewardModel.hasStateActionRewards()) {
+            actionRewardsGetters.push_back([&rewardModel](uint64_t globalChoiceIndex) { return rewardModel.getStateActionReward(globalChoiceIndex); });
+        } else {
+            actionRewardsGetters.push_back([](uint64_t) { return storm::utility::zero<ValueType>(); });
+        }
+    }
+    return computeLongRunAverageValues(env, stateRewardsGetters, actionRewardsGetters);
+}
+
 template<typename ValueType, bool Nondeterministic>
 std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLongRunAverageValues(Environment const& env,
                                                                                                              ValueGetter const& stateRewardsGetter,
                                                                                                              ValueGetter const& actionRewardsGetter) {
+    return std::move(computeLongRunAverageValues(env, std::vector<ValueGetter>({stateRewardsGetter}), std::vector<ValueGetter>({actionRewardsGetter})).front());
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<std::vector<ValueType>> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLongRunAverageValues(
+    Environment const& env, std::vector<ValueGetter> const& stateRewardsGetters, std::vector<ValueGetter> const& actionRewardsGetters) {
     // We will compute the long run average value for each MEC individually and then set-up an Equation system to compute the value also at non-mec states.
     // For a description of this approach see, e.g., Guck et al.: Modelling and Analysis of Markov Reward Automata (ATVA'14),
     // https://doi.org/10.1007/978-3-319-11936-6_13
+    STORM_LOG_THROW(stateRewardsGetters.size() == actionRewardsGetters.size(), storm::exceptions::InvalidArgumentException,
+                    "The number of state value functions (" << stateRewardsGetters.size() << ") does not match the number of action value functions ("
+                                                            << actionRewardsGetters.size() << ").");
+    STORM_LOG_THROW(stateRewardsGetters.size() <= 1 || !this->isProduceSchedulerSet(), storm::exceptions::NotSupportedException,
+                    "Scheduler production is not supported when computing long run average values for multiple value functions at once.");
+    if (stateRewardsGetters.empty()) {
+        return {};
+    }
 
     // Prepare an environment for the underlying solvers.
-    auto underlyingSolverEnvironment = env;
-    if (env.solver().isForceSoundness()) {
-        // For sound computations, the error in the MECS plus the error in the remaining system should not exceed the user defined precsion.
-        storm::RationalNumber newPrecision = env.solver().lra().getPrecision() / storm::utility::convertNumber<storm::RationalNumber>(2);
-        underlyingSolverEnvironment.solver().minMax().setPrecision(newPrecision);
-        underlyingSolverEnvironment.solver().minMax().setRelativeTerminationCriterion(env.solver().lra().getRelativeTerminationCriterion());
-        underlyingSolverEnvironment.solver().setLinearEquationSolverPrecision(newPrecision, env.solver().lra().getRelativeTerminationCriterion());
-        underlyingSolverEnvironment.solver().lra().setPrecision(newPrecision);
-    }
+    auto underlyingSolverEnvironment = getUnderlyingSolverEnvironment(env);
 
     // If requested, allocate memory for the choices made
     if (Nondeterministic && this->isProduceSchedulerSet()) {
@@ -158,7 +199,7 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     }
     STORM_LOG_ASSERT(Nondeterministic || !this->isProduceSchedulerSet(), "Scheduler production enabled for deterministic model.");
 
-    // Decompose the model to their bottom components (MECS or BSCCS)
+    // Decompose the model to their bottom components (MECS or BSCCS). This is only done if no decomposition was provided or computed before.
     createDecomposition();
 
     // Compute the long-run average for all components in isolation.
@@ -169,16 +210,103 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    // componentLraValues[i][c] is the value of the i-th value function in the c-th component.
+    std::vector<std::vector<ValueType>> componentLraValues(stateRewardsGetters.size(), std::vector<ValueType>(_longRunComponentDecomposition->size()));
+    auto processComponent = [&](uint64_t componentIndex) {
+        auto valuesForComponent = computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetters, actionRewardsGetters,
+                                                         (*_longRunComponentDecomposition)[componentIndex]);
+        STORM_LOG_ASSERT(valuesForComponent.size() == componentLraValues.size(), "Unexpected number of component values.");
+        for (uint64_t i = 0; i < valuesForComponent.size(); ++i) {
+            componentLraValues[i][componentIndex] = std::move(valuesForComponent[i]);
+        }
+    };
+    bool computeComponentsInParallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() &&
+                                       _longRunComponentDecomposition->size() > 1 && isParallelComponentComputationSupported(underlyingSolverEnvironment);
+    if (computeComponentsInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+        // The components are independent of each other. Small components are analyzed concurrently. Large components are analyzed one after another
+        // afterwards such that the (parallel) multipliers and solvers used for a single component can make use of all threads.
+        std::vector<uint64_t> smallComponents, largeComponents;
+        for (uint64_t componentIndex = 0; componentIndex < _longRunComponentDecomposition->size(); ++componentIndex) {
+            if ((*_longRunComponentDecomposition)[componentIndex].size() < LargeComponentSize) {
+                smallComponents.push_back(componentIndex);
+            } else {
+                largeComponents.push_back(componentIndex);
+            }
+        }
+        STORM_LOG_INFO("Analyzing " << smallComponents.size() << " small components in parallel and " << largeComponents.size()
+                                    << " large components with parallel inner solvers.");
+        // Each component only writes the (already allocated) choices of its own states.
+        _analyzingComponentsConcurrently = true;
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, smallComponents.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                processComponent(smallComponents[i]);
+            }
+        });
+        _analyzingComponentsConcurrently = false;
+        progress.updateProgress(smallComponents.size());
+        for (uint64_t i = 0; i < largeComponents.size(); ++i) {
+            processComponent(largeComponents[i]);
+            progress.updateProgress(smallComponents.size() + i + 1);
+        }
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        computeComponentsInParallel = false;
+#endif
+    }
+    if (!computeComponentsInParallel) {
+        for (uint64_t componentIndex = 0; componentIndex < _longRunComponentDecomposition->size(); ++componentIndex) {
+            processComponent(componentIndex);
+            progress.updateProgress(componentIndex + 1);
+        }
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
     STORM_LOG_INFO("Solving stochastic shortest path problem.");
-    return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
+    return buildAndSolveSsps(underlyingSolverEnvironment, componentLraValues);
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLraForComponent(Environment const& env,
+                                                                                                        std::vector<ValueGetter> const& stateValuesGetters,
+                                                                                                        std::vector<ValueGetter> const& actionValuesGetters,
+                                                                                                        LongRunComponentType const& component) {
+    std::vector<ValueType> result;
+    result.reserve(stateValuesGetters.size());
+    for (uint64_t i = 0; i < stateValuesGetters.size(); ++i) {
+        result.push_back(computeLraForComponent(env, stateValuesGetters[i], actionValuesGetters[i], component));
+    }
+    return result;
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<std::vector<ValueType>> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::buildAndSolveSsps(
+    Environment const& env, std::vector<std::vector<ValueType>> const& mecLraValues) {
+    std::vector<std::vector<ValueType>> result;
+    result.reserve(mecLraValues.size());
+    for (auto const& values : mecLraValues) {
+        result.push_back(buildAndSolveSsp(env, values));
+    }
+    return result;
+}
+
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isParallelComponentComputationSupported(Environment const&) const {
+    return std::is_same<ValueType, double>::value;
+}
+
+template<typename ValueType, bool Nondeterministic>
+Environment SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::getUnderlyingSolverEnvironment(Environment const& env) const {
+    auto underlyingSolverEnvironment = env;
+    if (env.solver().isForceSoundness()) {
+        // For sound computations, the error in the MECS plus the error in the remaining system should not exceed the user defined precsion.
+        storm::RationalNumber newPrecision = env.solver().lra().getPrecision() / storm::utility::convertNumber<storm::RationalNumber>(2);
+        underlyingSolverEnvironment.solver().minMax().setPrecision(newPrecision);
+        underlyingSolverEnvironment.solver().minMax().setRelativeTerminationCriterion(env.solver().lra().getRelativeTerminationCriterion());
+        underlyingSolverEnvironment.solver().setLinearEquationSolverPrecision(newPrecision, env.solver().lra().getRelativeTerminationCriterion());
+        underlyingSolverEnvironment.solver().lra().setPrecision(newPrecision);
+    }
+    return underlyingSolverEnvironment;
 }
 
 template<typename ValueType, bool Nondeterministic>
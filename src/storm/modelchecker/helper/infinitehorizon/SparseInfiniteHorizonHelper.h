@@ -97,6 +97,25 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     std::vector<ValueType> computeLongRunAverageValues(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter);
 
+    /*!
+     * Computes the long run average rewards for several reward models at once. The decomposition into long run components is only computed once and the
+     * solvers set up for each component (and for the remaining system) are re-used for all reward models.
+     * @pre If scheduler production is enabled, at most one reward model may be given.
+     * @return for each reward model a vector containing a value for each state
+     */
+    std::vector<std::vector<ValueType>> computeLongRunAverageRewards(
+        Environment const& env, std::vector<storm::models::sparse::StandardRewardModel<ValueType> const*> const& rewardModels);
+
+    /*!
+     * Computes the long run average values for several pairs of state and action based rewards in a single pass through the long run components.
+     * @param stateValuesGetters for each pair, a function returning a value for a given state index
+     * @param actionValuesGetters for each pair, a function returning a value for a given (global) choice index
+     * @pre Both vectors have the same size. If scheduler production is enabled, this size is at most one.
+     * @return for each pair a vector containing a value for each state
+     */
+    std::vector<std::vector<ValueType>> computeLongRunAverageValues(Environment const& env, std::vector<ValueGetter> const& stateValuesGetters,
+                                                                    std::vector<ValueGetter> const& actionValuesGetters);
+
     /*!
      * @param stateValuesGetter a function returning a value for a given state index
      * @param actionValuesGetter a function returning a value for a given (global) choice index
@@ -107,6 +126,15 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
     virtual ValueType computeLraForComponent(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                              LongRunComponentType const& component) = 0;
 
+    /*!
+     * @param stateValuesGetters for each pair, a function returning a value for a given state index
+     * @param actionValuesGetters for each pair, a function returning a value for a given (global) choice index
+     * @return for each pair, the (unique) optimal LRA value for the given component.
+     * @note The default implementation considers each pair individually. Implementations can override this to share work between the pairs.
+     */
+    virtual std::vector<ValueType> computeLraForComponent(Environment const& env, std::vector<ValueGetter> const& stateValuesGetters,
+                                                          std::vector<ValueGetter> const& actionValuesGetters, LongRunComponentType const& component);
+
    protected:
     /*!
      * @return true iff this is a computation on a continuous time model (i.e. CTMC, MA)
@@ -132,6 +160,30 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual std::vector<ValueType> buildAndSolveSsp(Environment const& env, std::vector<ValueType> const& mecLraValues) = 0;
 
+    /*!
+     * As buildAndSolveSsp but for several vectors of component values at once.
+     * @note The default implementation considers each vector individually. Implementations can override this to re-use the SSP and its solver.
+     * @return Lra values for each vector and each state
+     */
+    virtual std::vector<std::vector<ValueType>> buildAndSolveSsps(Environment const& env, std::vector<std::vector<ValueType>> const& mecLraValues);
+
+    /*!
+     * @return true iff computeLraForComponent can be called concurrently for different components using the given environment.
+     * @note The components are only analyzed in parallel if this holds and Intel TBB is enabled. By default, this only holds for floating point
+     * values, since the arithmetic of exact and parametric values is not thread safe.
+     */
+    virtual bool isParallelComponentComputationSupported(Environment const& env) const;
+
+    /*!
+     * @return an environment for the solvers that are called for the components and for the remaining system.
+     */
+    Environment getUnderlyingSolverEnvironment(Environment const& env) const;
+
+    /*!
+     * Components with at least this many states are not analyzed concurrently with other components. Instead, their (parallel) inner solvers use all threads.
+     */
+    static const uint64_t LargeComponentSize = 10000;
+
     storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
     storm::storage::BitVector const* _markovianStates;
     std::vector<ValueType> const* _exitRates;
@@ -142,6 +194,8 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
     std::unique_ptr<storm::storage::Decomposition<LongRunComponentType>> _computedLongRunComponentDecomposition;
 
     boost::optional<std::vector<uint64_t>> _producedOptimalChoices;
+    /// True while the components are analyzed concurrently. The produced choices are then allocated beforehand and must not be resized.
+    bool _analyzingComponentsConcurrently = false;
 };
 
 }  // namespace helper
@@ -81,13 +81,15 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
                                                                                          storm::storage::MaximalEndComponent const& component) {
     // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
 
-    // Allocate memory for the nondeterministic choices.
-    if (this->isProduceSchedulerSet()) {
+    // Allocate memory for the nondeterministic choices. If the components are analyzed concurrently, this has been done before.
+    if (this->isProduceSchedulerSet() && !this->_analyzingComponentsConcurrently) {
         if (!this->_producedOptimalChoices.is_initialized()) {
             this->_producedOptimalChoices.emplace();
         }
         this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
     }
+    STORM_LOG_ASSERT(!this->isProduceSchedulerSet() || this->_producedOptimalChoices->size() == this->_transitionMatrix.getRowGroupCount(),
+                     "Choices are not allocated.");
 
     auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
     if (trivialResult.first) {
@@ -95,6 +97,40 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
+    storm::solver::LraMethod method = getLraMethodForNontrivialMec(env);
+    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
+                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
+    if (method == storm::solver::LraMethod::LinearProgramming) {
+        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else if (method == storm::solver::LraMethod::ValueIteration) {
+        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponent(Environment const& env,
+                                                                                                      std::vector<ValueGetter> const& stateRewardsGetters,
+                                                                                                      std::vector<ValueGetter> const& actionRewardsGetters,
+                                                                                                      storm::storage::MaximalEndComponent const& component) {
+    // Trivial MECs are cheap and the LP method has no set-up that could be shared. Hence, we only treat the VI case differently.
+    if (stateRewardsGetters.size() <= 1 || component.size() == 1 || getLraMethodForNontrivialMec(env) != storm::solver::LraMethod::ValueIteration) {
+        return SparseInfiniteHorizonHelper<ValueType, true>::computeLraForComponent(env, stateRewardsGetters, actionRewardsGetters, component);
+    }
+    STORM_LOG_ASSERT(!this->isProduceSchedulerSet(), "Scheduler production is not supported for multiple value functions.");
+    return computeLraForMecVi(env, stateRewardsGetters, actionRewardsGetters, component);
+}
+
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isParallelComponentComputationSupported(Environment const& env) const {
+    // The LP solvers are not necessarily thread safe.
+    return SparseInfiniteHorizonHelper<ValueType, true>::isParallelComponentComputationSupported(env) &&
+           getLraMethodForNontrivialMec(env) != storm::solver::LraMethod::LinearProgramming;
+}
+
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getLraMethodForNontrivialMec(Environment const& env) const {
     storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
     if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
         method != storm::solver::LraMethod::LinearProgramming) {
@@ -108,15 +144,7 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
             "specify a different LRA method.");
         method = storm::solver::LraMethod::ValueIteration;
     }
-    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
-                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
-    if (method == storm::solver::LraMethod::LinearProgramming) {
-        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else if (method == storm::solver::LraMethod::ValueIteration) {
-        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else {
-        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
-    }
+    return method;
 }
 
 template<typename ValueType>
@@ -192,6 +220,35 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForM
     }
 }
 
+template<typename ValueType>
+std::vector<ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForMecVi(Environment const& env,
+                                                                                                  std::vector<ValueGetter> const& stateRewardsGetters,
+                                                                                                  std::vector<ValueGetter> const& actionRewardsGetters,
+                                                                                                  storm::storage::MaximalEndComponent const& mec) {
+    ValueType aperiodicFactor = storm::utility::convertNumber<ValueType>(env.solver().lra().getAperiodicFactor());
+    std::vector<ValueType> result;
+    result.reserve(stateRewardsGetters.size());
+
+    // The helper (in particular the sub-matrices of the MEC) is built once and then used for all value functions.
+    if (this->isContinuousTime()) {
+        storm::modelchecker::helper::internal::LraViHelper<ValueType, storm::storage::MaximalEndComponent,
+                                                           storm::modelchecker::helper::internal::LraViTransitionsType::DetTsNondetIs>
+            viHelper(mec, this->_transitionMatrix, aperiodicFactor, this->_markovianStates, this->_exitRates);
+        for (uint64_t i = 0; i < stateRewardsGetters.size(); ++i) {
+            result.push_back(viHelper.performValueIteration(env, stateRewardsGetters[i], actionRewardsGetters[i], this->_exitRates,
+                                                            &this->getOptimizationDirection()));
+        }
+    } else {
+        storm::modelchecker::helper::internal::LraViHelper<ValueType, storm::storage::MaximalEndComponent,
+                                                           storm::modelchecker::helper::internal::LraViTransitionsType::NondetTsNoIs>
+            viHelper(mec, this->_transitionMatrix, aperiodicFactor);
+        for (uint64_t i = 0; i < stateRewardsGetters.size(); ++i) {
+            result.push_back(viHelper.performValueIteration(env, stateRewardsGetters[i], actionRewardsGetters[i], nullptr, &this->getOptimizationDirection()));
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForMecLp(Environment const& env, ValueGetter const& stateRewardsGetter,
                                                                                      ValueGetter const& actionRewardsGetter,
@@ -426,6 +483,14 @@ void SparseNondeterministicInfiniteHorizonHelper<ValueType>::constructOptimalCho
 template<typename ValueType>
 std::vector<ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::buildAndSolveSsp(Environment const& env,
                                                                                                 std::vector<ValueType> const& componentLraValues) {
+    return std::move(buildAndSolveSsps(env, std::vector<std::vector<ValueType>>({componentLraValues})).front());
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseNondeterministicInfiniteHorizonHelper<ValueType>::buildAndSolveSsps(
+    Environment const& env, std::vector<std::vector<ValueType>> const& componentLraValues) {
+    STORM_LOG_ASSERT(!componentLraValues.empty(), "No component values given.");
+    STORM_LOG_ASSERT(componentLraValues.size() == 1 || !this->isProduceSchedulerSet(), "Scheduler production is not supported for multiple value functions.");
     STORM_LOG_ASSERT(this->_longRunComponentDecomposition != nullptr, "Decomposition not computed, yet.");
 
     // For fast transition rewriting, we build a mapping from the input state indices to the state indices of a new transition matrix
@@ -461,45 +526,57 @@ std::vector<ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::b
     // corresponding choices in the original model.
     std::vector<std::pair<uint_fast64_t, uint_fast64_t>> sspComponentExitChoicesToOriginalMap;
 
-    // The next step is to create the SSP matrix and the right-hand side of the SSP.
-    auto sspMatrixVector = buildSspMatrixVector(componentLraValues, inputToSspStateMap, statesNotInComponent, numberOfNonComponentStates,
+    // The next step is to create the SSP matrix and the right-hand side of the SSP (for the first vector of component values).
+    auto sspMatrixVector = buildSspMatrixVector(componentLraValues.front(), inputToSspStateMap, statesNotInComponent, numberOfNonComponentStates,
                                                 this->isProduceSchedulerSet() ? &sspComponentExitChoicesToOriginalMap : nullptr);
+    auto const& sspMatrix = sspMatrixVector.first;
+    auto& rhs = sspMatrixVector.second;
 
-    // Set-up a solver
+    // Set-up a solver. It is used for all vectors of component values.
     storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
     storm::solver::MinMaxLinearEquationSolverRequirements requirements =
         minMaxLinearEquationSolverFactory.getRequirements(env, true, true, this->getOptimizationDirection(), false, this->isProduceSchedulerSet());
     requirements.clearBounds();
     STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
                     "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = minMaxLinearEquationSolverFactory.create(env, sspMatrixVector.first);
+    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = minMaxLinearEquationSolverFactory.create(env, sspMatrix);
     solver->setHasUniqueSolution();
     solver->setHasNoEndComponents();
     solver->setTrackScheduler(this->isProduceSchedulerSet());
-    auto lowerUpperBounds = std::minmax_element(componentLraValues.begin(), componentLraValues.end());
-    solver->setLowerBound(*lowerUpperBounds.first);
-    solver->setUpperBound(*lowerUpperBounds.second);
     solver->setRequirementsChecked();
 
-    // Solve the equation system
-    std::vector<ValueType> x(sspMatrixVector.first.getRowGroupCount());
-    solver->solveEquations(env, this->getOptimizationDirection(), x, sspMatrixVector.second);
+    std::vector<std::vector<ValueType>> result;
+    result.reserve(componentLraValues.size());
+    std::vector<ValueType> x(sspMatrix.getRowGroupCount());
+    for (auto const& currentComponentLraValues : componentLraValues) {
+        if (!result.empty()) {
+            // Only the choices of the auxiliary states that stay in their component carry a value. These are the last choices of the auxiliary states.
+            for (uint64_t componentIndex = 0; componentIndex < currentComponentLraValues.size(); ++componentIndex) {
+                rhs[sspMatrix.getRowGroupIndices()[numberOfNonComponentStates + componentIndex + 1] - 1] = currentComponentLraValues[componentIndex];
+            }
+        }
+        auto lowerUpperBounds = std::minmax_element(currentComponentLraValues.begin(), currentComponentLraValues.end());
+        solver->setLowerBound(*lowerUpperBounds.first);
+        solver->setUpperBound(*lowerUpperBounds.second);
+
+        // Solve the equation system
+        std::fill(x.begin(), x.end(), storm::utility::zero<ValueType>());
+        solver->solveEquations(env, this->getOptimizationDirection(), x, rhs);
+
+        // Prepare scheduler (if requested)
+        if (this->isProduceSchedulerSet() && solver->hasScheduler()) {
+            // Translate result for ssp matrix to original model
+            constructOptimalChoices(solver->getSchedulerChoices(), sspMatrix, inputToSspStateMap, statesNotInComponent, numberOfNonComponentStates,
+                                    sspComponentExitChoicesToOriginalMap);
+        } else {
+            STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet(), "Requested to produce a scheduler, but no scheduler was generated.");
+        }
 
-    // Prepare scheduler (if requested)
-    if (this->isProduceSchedulerSet() && solver->hasScheduler()) {
-        // Translate result for ssp matrix to original model
-        constructOptimalChoices(solver->getSchedulerChoices(), sspMatrixVector.first, inputToSspStateMap, statesNotInComponent, numberOfNonComponentStates,
-                                sspComponentExitChoicesToOriginalMap);
-    } else {
-        STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet(), "Requested to produce a scheduler, but no scheduler was generated.");
+        // Prepare result vector.
+        std::vector<ValueType> currentResult(this->_transitionMatrix.getRowGroupCount());
+        storm::utility::vector::selectVectorValues(currentResult, inputToSspStateMap, x);
+        result.push_back(std::move(currentResult));
     }
-
-    // Prepare result vector.
-    // For efficiency reasons, we re-use the memory of our rhs for this!
-    std::vector<ValueType> result = std::move(sspMatrixVector.second);
-    result.resize(this->_transitionMatrix.getRowGroupCount());
-    result.shrink_to_fit();
-    storm::utility::vector::selectVectorValues(result, inputToSspStateMap, x);
     return result;
 }
 
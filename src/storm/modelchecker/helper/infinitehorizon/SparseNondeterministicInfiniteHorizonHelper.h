@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
 
@@ -62,9 +63,23 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
     virtual ValueType computeLraForComponent(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                              storm::storage::MaximalEndComponent const& component) override;
 
+    /*!
+     * As above, but for several pairs of state and action values. If value iteration is used, the same set-up for the MEC is used for all pairs.
+     */
+    virtual std::vector<ValueType> computeLraForComponent(Environment const& env, std::vector<ValueGetter> const& stateValuesGetters,
+                                                          std::vector<ValueGetter> const& actionValuesGetters,
+                                                          storm::storage::MaximalEndComponent const& component) override;
+
    protected:
     virtual void createDecomposition() override;
 
+    /*!
+     * @return the method that is used to solve nontrivial MECs, taking the requested degree of exactness and soundness into account.
+     */
+    storm::solver::LraMethod getLraMethodForNontrivialMec(Environment const& env) const;
+
+    virtual bool isParallelComponentComputationSupported(Environment const& env) const override;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
@@ -74,6 +89,12 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
     ValueType computeLraForMecVi(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                  storm::storage::MaximalEndComponent const& mec);
 
+    /*!
+     * As computeLraForMecVi but for several pairs of state and action values. The value iteration helper is only set-up once for all pairs.
+     */
+    std::vector<ValueType> computeLraForMecVi(Environment const& env, std::vector<ValueGetter> const& stateValuesGetters,
+                                              std::vector<ValueGetter> const& actionValuesGetters, storm::storage::MaximalEndComponent const& mec);
+
     /*!
      * As computeLraForMec but uses linear programming as a solution method (independent of what is set in env)
      * @see Guck et al.: Modelling and Analysis of Markov Reward Automata (ATVA'14), https://doi.org/10.1007/978-3-319-11936-6_13
@@ -101,6 +122,12 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
      * @post if scheduler production is enabled getProducedOptimalChoices() contains choices for all input model states which yield the returned LRA values.
      */
     virtual std::vector<ValueType> buildAndSolveSsp(Environment const& env, std::vector<ValueType> const& mecLraValues) override;
+
+    /*!
+     * As buildAndSolveSsp but for several vectors of MEC values. The SSP matrix and its solver are only set-up once, only the right-hand side changes.
+     */
+    virtual std::vector<std::vector<ValueType>> buildAndSolveSsps(Environment const& env,
+                                                                  std::vector<std::vector<ValueType>> const& mecLraValues) override;
 };
 
 }  // namespace helper
@@ -1,5 +1,7 @@
 #include "SparseLTLHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/automata/DeterministicAutomaton.h"
 #include "storm/automata/LTL2DeterministicAutomaton.h"
 
@@ -10,6 +12,8 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/SolveGoal.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SchedulerChoice.h"
@@ -86,7 +90,10 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
     std::size_t accMECs = 0;
     std::size_t allMECs = 0;
 
-    for (auto const& conjunction : dnf) {
+    // The MECs of the allowed fragments of the different conjunctions are independent of each other and can be computed concurrently
+    std::vector<boost::optional<storm::storage::MaximalEndComponentDecomposition<ValueType>>> mecsOfConjunctions(dnf.size());
+    auto computeMecsOfConjunction = [&](uint64_t conjunctionIndex) {
+        auto const& conjunction = dnf[conjunctionIndex];
         // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
         storm::storage::BitVector allowed(transitionMatrix.getRowGroupCount(), true);
 
@@ -112,13 +119,38 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
             }
         }
 
-        if (allowed.empty()) {
+        if (!allowed.empty()) {
+            // Compute MECs in the allowed fragment
+            mecsOfConjunctions[conjunctionIndex].emplace(transitionMatrix, backwardTransitions, allowed);
+        }
+    };
+    bool computeInParallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && dnf.size() > 1;
+    if (computeInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, dnf.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t conjunctionIndex = range.begin(); conjunctionIndex < range.end(); ++conjunctionIndex) {
+                computeMecsOfConjunction(conjunctionIndex);
+            }
+        });
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        computeInParallel = false;
+#endif
+    }
+    if (!computeInParallel) {
+        for (uint64_t conjunctionIndex = 0; conjunctionIndex < dnf.size(); ++conjunctionIndex) {
+            computeMecsOfConjunction(conjunctionIndex);
+        }
+    }
+
+    // Check the MECs for acceptance in a fixed order such that the saved scheduler choices do not depend on the parallelization
+    for (uint64_t conjunctionIndex = 0; conjunctionIndex < dnf.size(); ++conjunctionIndex) {
+        auto const& conjunction = dnf[conjunctionIndex];
+        if (!mecsOfConjunctions[conjunctionIndex]) {
             // skip
             continue;
         }
-
-        // Compute MECs in the allowed fragment
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
+        auto const& mecs = mecsOfConjunctions[conjunctionIndex].get();
         allMECs += mecs.size();
         for (const auto& mec : mecs) {
             bool accepting = true;
@@ -222,6 +254,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     STORM_LOG_INFO("Building " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " product with deterministic automaton, starting from "
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
+    // Product states in automaton sinks are decided, their successors only need to be explored if a scheduler for the original model is requested
+    productBuilder.setTruncateAtSinks(!this->isProduceSchedulerSet());
 
     auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
 
@@ -316,15 +350,18 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     STORM_LOG_INFO(" in prefix format: " << ltlFormula->toPrefixString());
 
     // Convert LTL formula to a deterministic automaton
-    std::shared_ptr<storm::automata::DeterministicAutomaton> da;
+    // Use the external tool given via ltl2da if set and the internal tool (Spot) otherwise.
+    // For nondeterministic models the acceptance condition is transformed into DNF
+    // Translations of previously checked formulas with the same skeleton are reused
+    boost::optional<std::string> ltl2daTool, cacheDirectory;
     if (env.modelchecker().isLtl2daToolSet()) {
-        // Use the external tool given via ltl2da
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
-    } else {
-        // Use the internal tool (Spot)
-        // For nondeterministic models the acceptance condition is transformed into DNF
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
+        ltl2daTool = env.modelchecker().getLtl2daTool();
+    }
+    if (env.modelchecker().isLtl2daCacheDirectorySet()) {
+        cacheDirectory = env.modelchecker().getLtl2daCacheDirectory();
     }
+    std::shared_ptr<storm::automata::DeterministicAutomaton> da =
+        storm::automata::LTL2DeterministicAutomaton::ltl2daCached(*ltlFormula, Nondeterministic, ltl2daTool, cacheDirectory);
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
                                                                   << " atomic propositions and " << *da->getAcceptance()->getAcceptanceExpression()
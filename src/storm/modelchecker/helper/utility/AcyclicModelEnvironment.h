@@ -0,0 +1,34 @@
+#pragma once
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Retrieves the environment with which the equation systems of the given model are to be solved.
+ * If the model is acyclic (up to the self-loops of sink states) and the solvers were not selected explicitly, the returned environment selects the
+ * acyclic solvers, which solve the equation systems in a single sweep over the states in reverse topological order. Otherwise, the given
+ * environment is returned. As the acyclicity is cached by the model, this check is cheap for all but the first query on the model.
+ */
+template<typename ModelType>
+Environment getEnvironmentForModel(Environment const& env, ModelType const& model) {
+    Environment result = env;
+    if (model.isAcyclic()) {
+        if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
+            result.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Acyclic, true);
+        }
+        if (env.solver().minMax().isMethodSetFromDefault() && !env.solver().minMax().isRaceMethodSet()) {
+            result.solver().minMax().setMethod(storm::solver::MinMaxMethod::Acyclic, true);
+        }
+    }
+    return result;
+}
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
+#include "storm/modelchecker/hints/ExplicitSolutionCache.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/utility/macros.h"
 
@@ -117,6 +119,36 @@ void ExplicitModelCheckerHint<ValueType>::setNoEndComponentsInMaybeStates(bool v
     noEndComponentsInMaybeStates = value;
 }
 
+template<typename ValueType>
+bool ExplicitModelCheckerHint<ValueType>::hasSolutionCache() const {
+    return static_cast<bool>(solutionCache);
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitSolutionCache<ValueType>> const& ExplicitModelCheckerHint<ValueType>::getSolutionCache() const {
+    return solutionCache;
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerHint<ValueType>::setSolutionCache(std::shared_ptr<ExplicitSolutionCache<ValueType>> const& solutionCache) {
+    this->solutionCache = solutionCache;
+}
+
+template<typename ValueType>
+bool ExplicitModelCheckerHint<ValueType>::hasPrecomputationCache() const {
+    return static_cast<bool>(precomputationCache);
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitPrecomputationCache> const& ExplicitModelCheckerHint<ValueType>::getPrecomputationCache() const {
+    return precomputationCache;
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerHint<ValueType>::setPrecomputationCache(std::shared_ptr<ExplicitPrecomputationCache> const& precomputationCache) {
+    this->precomputationCache = precomputationCache;
+}
+
 template class ExplicitModelCheckerHint<double>;
 template class ExplicitModelCheckerHint<storm::RationalNumber>;
 template class ExplicitModelCheckerHint<storm::RationalFunction>;
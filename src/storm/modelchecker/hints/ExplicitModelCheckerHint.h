@@ -2,6 +2,7 @@
 #define STORM_MODELCHECKER_HINTS_EXPLICITMODELCHECKERHINT_H
 
 #include <boost/optional.hpp>
+#include <memory>
 #include <vector>
 
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
@@ -10,6 +11,11 @@
 namespace storm {
 namespace modelchecker {
 
+template<typename ValueType>
+class ExplicitSolutionCache;
+
+class ExplicitPrecomputationCache;
+
 /*!
  * This class contains information that might accelerate the model checking process.
  * @note The model checker has to make sure whether a given hint is actually applicable and thus a hint might be ignored.
@@ -55,13 +61,25 @@ class ExplicitModelCheckerHint : public ModelCheckerHint {
     bool getNoEndComponentsInMaybeStates() const;
     void setNoEndComponentsInMaybeStates(bool value);
 
+    // If set, the model checkers use the solutions of previous computations in the cache as initial guess and add their solutions to the cache.
+    bool hasSolutionCache() const;
+    std::shared_ptr<ExplicitSolutionCache<ValueType>> const& getSolutionCache() const;
+    void setSolutionCache(std::shared_ptr<ExplicitSolutionCache<ValueType>> const& solutionCache);
+
+    // If set, the model checkers reuse the qualitative analyses of previous computations in the cache and add their analyses to the cache.
+    bool hasPrecomputationCache() const;
+    std::shared_ptr<ExplicitPrecomputationCache> const& getPrecomputationCache() const;
+    void setPrecomputationCache(std::shared_ptr<ExplicitPrecomputationCache> const& precomputationCache);
+
    private:
     boost::optional<std::vector<ValueType>> resultHint;
     boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
 
-    bool computeOnlyMaybeStates;
+    bool computeOnlyMaybeStates = false;
     boost::optional<storm::storage::BitVector> maybeStates;
-    bool noEndComponentsInMaybeStates;
+    bool noEndComponentsInMaybeStates = false;
+    std::shared_ptr<ExplicitSolutionCache<ValueType>> solutionCache;
+    std::shared_ptr<ExplicitPrecomputationCache> precomputationCache;
 };
 
 }  // namespace modelchecker
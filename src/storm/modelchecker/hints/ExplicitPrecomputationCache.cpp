@@ -0,0 +1,54 @@
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+
+namespace storm {
+namespace modelchecker {
+
+void ExplicitPrecomputationCache::insert(std::string const& quantity, storm::storage::BitVector const& constraintStates,
+                                         storm::storage::BitVector const& targetStates, boost::optional<storm::OptimizationDirection> const& direction,
+                                         std::pair<storm::storage::BitVector, storm::storage::BitVector> const& statesWithProbability01) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& result : results) {
+        if (result.direction == direction && result.quantity == quantity && result.targetStates == targetStates &&
+            result.constraintStates == constraintStates) {
+            result.statesWithProbability01 = statesWithProbability01;
+            return;
+        }
+    }
+    results.push_back({quantity, constraintStates, targetStates, direction, statesWithProbability01});
+}
+
+boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> ExplicitPrecomputationCache::find(
+    std::string const& quantity, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
+    boost::optional<storm::OptimizationDirection> const& direction) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto const& result : results) {
+        if (result.direction == direction && result.quantity == quantity && result.targetStates == targetStates &&
+            result.constraintStates == constraintStates) {
+            return result.statesWithProbability01;
+        }
+    }
+    return boost::none;
+}
+
+uint64_t ExplicitPrecomputationCache::getNumberOfResults() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return results.size();
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitPrecomputationCache> getPrecomputationCache(ModelCheckerHint const& hint) {
+    if (hint.isExplicitModelCheckerHint()) {
+        return hint.template asExplicitModelCheckerHint<ValueType>().getPrecomputationCache();
+    }
+    return nullptr;
+}
+
+template std::shared_ptr<ExplicitPrecomputationCache> getPrecomputationCache<double>(ModelCheckerHint const& hint);
+template std::shared_ptr<ExplicitPrecomputationCache> getPrecomputationCache<storm::RationalNumber>(ModelCheckerHint const& hint);
+template std::shared_ptr<ExplicitPrecomputationCache> getPrecomputationCache<storm::RationalFunction>(ModelCheckerHint const& hint);
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace modelchecker {
+
+class ModelCheckerHint;
+
+/*!
+ * Stores the results of the qualitative analysis (i.e., the states with probability zero and one) of previously checked properties of a model
+ * such that later properties with the same constraint and target states (and optimization direction) can skip the graph analysis. The
+ * cache is attached to an ExplicitModelCheckerHint, which is then passed to the model checkers. It may be accessed concurrently.
+ */
+class ExplicitPrecomputationCache {
+   public:
+    ExplicitPrecomputationCache() = default;
+
+    /*!
+     * Stores the given result of a qualitative analysis. An existing result for the same analysis is replaced.
+     *
+     * @param quantity An identifier of the analysis, e.g., the kind of property.
+     * @param constraintStates The states that may be visited before reaching a target state.
+     * @param targetStates The target states.
+     * @param direction The optimization direction (if any).
+     * @param statesWithProbability01 The states with probability zero and one, respectively.
+     */
+    void insert(std::string const& quantity, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
+                boost::optional<storm::OptimizationDirection> const& direction,
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> const& statesWithProbability01);
+
+    /*!
+     * Retrieves the stored result of the given qualitative analysis.
+     *
+     * @return The states with probability zero and one, respectively, or none if the analysis has not been stored.
+     */
+    boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> find(std::string const& quantity,
+                                                                                          storm::storage::BitVector const& constraintStates,
+                                                                                          storm::storage::BitVector const& targetStates,
+                                                                                          boost::optional<storm::OptimizationDirection> const& direction) const;
+
+    /*!
+     * Retrieves the number of stored results.
+     */
+    uint64_t getNumberOfResults() const;
+
+   private:
+    struct Result {
+        std::string quantity;
+        storm::storage::BitVector constraintStates;
+        storm::storage::BitVector targetStates;
+        boost::optional<storm::OptimizationDirection> direction;
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+    };
+
+    // The stored results. As there are typically only few different target sets per model, we simply search them linearly.
+    std::vector<Result> results;
+    mutable std::mutex mutex;
+};
+
+/*!
+ * Retrieves the precomputation cache attached to the given hint (or null if there is none).
+ */
+template<typename ValueType>
+std::shared_ptr<ExplicitPrecomputationCache> getPrecomputationCache(ModelCheckerHint const& hint);
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,90 @@
+#include "storm/modelchecker/hints/ExplicitSolutionCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+void ExplicitSolutionCache<ValueType>::insert(std::string const& quantity, storm::storage::BitVector const& constraintStates,
+                                              storm::storage::BitVector const& targetStates, boost::optional<storm::OptimizationDirection> const& direction,
+                                              std::vector<ValueType> const& values, storm::storage::Scheduler<ValueType> const* scheduler) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Solution* solution = nullptr;
+    for (auto& existingSolution : solutions) {
+        if (existingSolution.direction == direction && existingSolution.quantity == quantity && existingSolution.targetStates == targetStates &&
+            existingSolution.constraintStates == constraintStates) {
+            solution = &existingSolution;
+            break;
+        }
+    }
+    if (!solution) {
+        solutions.push_back({quantity, constraintStates, targetStates, direction, {}, boost::none});
+        solution = &solutions.back();
+    }
+    solution->values = values;
+    // Incomplete schedulers are not stored as the model checkers require a choice for every state of a scheduler hint.
+    if (scheduler && !scheduler->isPartialScheduler() && scheduler->isDeterministicScheduler() && scheduler->isMemorylessScheduler()) {
+        solution->scheduler = *scheduler;
+    } else {
+        solution->scheduler = boost::none;
+    }
+}
+
+template<typename ValueType>
+std::unique_ptr<ExplicitModelCheckerHint<ValueType>> ExplicitSolutionCache<ValueType>::createHint(
+    ModelCheckerHint const& hint, std::string const& quantity, storm::storage::BitVector const& constraintStates,
+    storm::storage::BitVector const& targetStates, boost::optional<storm::OptimizationDirection> const& direction) const {
+    STORM_LOG_ASSERT(hint.isExplicitModelCheckerHint(), "Expected an explicit model checker hint.");
+    auto const& explicitHint = hint.template asExplicitModelCheckerHint<ValueType>();
+    if (explicitHint.hasResultHint() || explicitHint.hasSchedulerHint()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    Solution const* bestSolution = nullptr;
+    for (auto const& solution : solutions) {
+        if (solution.quantity == quantity && solution.targetStates == targetStates && solution.constraintStates == constraintStates) {
+            bestSolution = &solution;
+            if (solution.direction == direction) {
+                break;
+            }
+        }
+    }
+    if (!bestSolution) {
+        return nullptr;
+    }
+    STORM_LOG_INFO("Using the solution of a previous property as initial guess.");
+    auto result = std::make_unique<ExplicitModelCheckerHint<ValueType>>(explicitHint);
+    result->setResultHint(bestSolution->values);
+    if (bestSolution->direction == direction && bestSolution->scheduler) {
+        result->setSchedulerHint(bestSolution->scheduler);
+    }
+    return result;
+}
+
+template<typename ValueType>
+uint64_t ExplicitSolutionCache<ValueType>::getNumberOfSolutions() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return solutions.size();
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitSolutionCache<ValueType>> getSolutionCache(ModelCheckerHint const& hint) {
+    if (hint.isExplicitModelCheckerHint()) {
+        return hint.template asExplicitModelCheckerHint<ValueType>().getSolutionCache();
+    }
+    return nullptr;
+}
+
+template class ExplicitSolutionCache<double>;
+template class ExplicitSolutionCache<storm::RationalNumber>;
+template class ExplicitSolutionCache<storm::RationalFunction>;
+
+template std::shared_ptr<ExplicitSolutionCache<double>> getSolutionCache(ModelCheckerHint const& hint);
+template std::shared_ptr<ExplicitSolutionCache<storm::RationalNumber>> getSolutionCache(ModelCheckerHint const& hint);
+template std::shared_ptr<ExplicitSolutionCache<storm::RationalFunction>> getSolutionCache(ModelCheckerHint const& hint);
+
+}  // namespace modelchecker
+}  // namespace storm
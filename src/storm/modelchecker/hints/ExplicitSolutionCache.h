@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
+
+namespace storm {
+namespace modelchecker {
+
+class ModelCheckerHint;
+
+template<typename ValueType>
+class ExplicitModelCheckerHint;
+
+/*!
+ * Stores the solutions of previously checked properties of a model such that later properties that lead to the same computation (i.e., the same
+ * quantity with the same constraint and target states, but possibly a different bound or optimization direction) can use them as initial guess.
+ * The cache is attached to an ExplicitModelCheckerHint, which is then passed to the model checkers. It may be accessed concurrently.
+ */
+template<typename ValueType>
+class ExplicitSolutionCache {
+   public:
+    ExplicitSolutionCache() = default;
+
+    /*!
+     * Stores the given solution. An existing solution for the same computation is replaced.
+     *
+     * @param quantity An identifier of the computed quantity, e.g., the kind of property and the name of the reward model.
+     * @param constraintStates The states that may be visited before reaching a target state.
+     * @param targetStates The target states.
+     * @param direction The optimization direction (if any).
+     * @param values The solution for all states of the model.
+     * @param scheduler If given, the scheduler inducing the solution. It is only stored if it is memoryless, deterministic and fully defined.
+     */
+    void insert(std::string const& quantity, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
+                boost::optional<storm::OptimizationDirection> const& direction, std::vector<ValueType> const& values,
+                storm::storage::Scheduler<ValueType> const* scheduler = nullptr);
+
+    /*!
+     * Creates a copy of the given hint that is extended by a cached solution of the given computation. A solution for the same optimization
+     * direction is preferred and only such a solution contributes a scheduler hint.
+     *
+     * @return The extended hint or null if there is no cached solution or the given hint already contains a result or scheduler hint.
+     */
+    std::unique_ptr<ExplicitModelCheckerHint<ValueType>> createHint(ModelCheckerHint const& hint, std::string const& quantity,
+                                                                    storm::storage::BitVector const& constraintStates,
+                                                                    storm::storage::BitVector const& targetStates,
+                                                                    boost::optional<storm::OptimizationDirection> const& direction) const;
+
+    /*!
+     * Retrieves the number of stored solutions.
+     */
+    uint64_t getNumberOfSolutions() const;
+
+   private:
+    struct Solution {
+        std::string quantity;
+        storm::storage::BitVector constraintStates;
+        storm::storage::BitVector targetStates;
+        boost::optional<storm::OptimizationDirection> direction;
+        std::vector<ValueType> values;
+        boost::optional<storm::storage::Scheduler<ValueType>> scheduler;
+    };
+
+    // The stored solutions. As there are typically only few properties per model, we simply search them linearly.
+    std::vector<Solution> solutions;
+    mutable std::mutex mutex;
+};
+
+/*!
+ * Retrieves the solution cache attached to the given hint (or null if there is none).
+ */
+template<typename ValueType>
+std::shared_ptr<ExplicitSolutionCache<ValueType>> getSolutionCache(ModelCheckerHint const& hint);
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -204,7 +204,7 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
     }
     // get easy access to incoming transitions of a state
     auto incomingChoicesMatrix = model.getTransitionMatrix().transpose();
-    auto incomingStatesMatrix = model.getBackwardTransitions();
+    auto const& incomingStatesMatrix = model.getBackwardTransitions();
     bool changedSomething = true;
     while (changedSomething) {
         // iterate until there is no change
@@ -319,7 +319,7 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
     // iterate over the states
     for (uint currentState = 0; currentState < reachabilityResult.values.size(); currentState++) {
         std::vector<uint> goodActionsForState;
-        uint_fast64_t bestAction = reachabilityResult.scheduler->getChoice(currentState).getDeterministicChoice();
+        uint_fast64_t bestAction = reachabilityResult.scheduler->getDeterministicChoice(currentState);
         // determine the value of the best action
         ValueType bestActionValue(0);
         for (const storm::storage::MatrixEntry<uint_fast64_t, ValueType>& rowEntry : transitionMatrix.getRow(rowGroupIndices[currentState] + bestAction)) {
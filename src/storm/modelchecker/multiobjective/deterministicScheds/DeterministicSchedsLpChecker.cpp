@@ -26,7 +26,7 @@ namespace multiobjective {
 template<typename ModelType, typename GeometryValueType>
 DeterministicSchedsLpChecker<ModelType, GeometryValueType>::DeterministicSchedsLpChecker(
     ModelType const& model, std::vector<DeterministicSchedsObjectiveHelper<ModelType>> const& objectiveHelper)
-    : model(model), objectiveHelper(objectiveHelper), numLpQueries(0) {
+    : model(model), objectiveHelper(objectiveHelper), reuseObjectiveVariables(false), numLpQueries(0) {
     // intentionally left empty
 }
 
@@ -57,16 +57,38 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::setCurrentWeigh
     swAll.start();
     initialize(env);
     STORM_LOG_ASSERT(weightVector.size() == objectiveHelper.size(), "Setting a weight vector with invalid number of entries.");
-    if (!currentWeightVector.empty()) {
-        // Pop information of the current weight vector.
-        lpModel->pop();
-        lpModel->update();
-        currentObjectiveVariables.clear();
+    if (reuseObjectiveVariables) {
+        // Only the objective function changes, so the solver can keep the remaining model.
+        for (uint64_t objIndex = 0; objIndex < currentObjectiveVariables.size(); ++objIndex) {
+            lpModel->setObjectiveFunctionCoefficient(currentObjectiveVariables[objIndex], storm::utility::convertNumber<ValueType>(weightVector[objIndex]));
+        }
+    } else {
+        if (!currentWeightVector.empty()) {
+            // Pop information of the current weight vector.
+            lpModel->pop();
+            lpModel->update();
+            currentObjectiveVariables.clear();
+        }
+        lpModel->push();
+        addObjectiveVariables(weightVector);
     }
-
     currentWeightVector = weightVector;
 
-    lpModel->push();
+    // Start the search from the scheduler found for the previous query.
+    if (!mipStartValues.empty()) {
+        for (uint64_t choice = 0; choice < choiceVariables.size(); ++choice) {
+            if (choiceVariables[choice].isInitialized()) {
+                lpModel->setMipStart(choiceVariables[choice].getBaseExpression().asVariableExpression().getVariable(),
+                                     storm::utility::convertNumber<ValueType>(mipStartValues[choice]));
+            }
+        }
+    }
+    lpModel->update();
+    swAll.stop();
+}
+
+template<typename ModelType, typename GeometryValueType>
+void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::addObjectiveVariables(std::vector<GeometryValueType> const& weightVector) {
     // set up objective function for the given weight vector
     for (uint64_t objIndex = 0; objIndex < initialStateResults.size(); ++objIndex) {
         currentObjectiveVariables.push_back(
@@ -77,8 +99,16 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::setCurrentWeigh
             lpModel->addConstraint("", currentObjectiveVariables.back().getExpression() == initialStateResults[objIndex]);
         }
     }
-    lpModel->update();
-    swAll.stop();
+}
+
+template<typename ModelType, typename GeometryValueType>
+void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::storeMipStart() {
+    mipStartValues.assign(choiceVariables.size(), 0);
+    for (uint64_t choice = 0; choice < choiceVariables.size(); ++choice) {
+        if (choiceVariables[choice].isInitialized()) {
+            mipStartValues[choice] = lpModel->getIntegerValue(choiceVariables[choice].getBaseExpression().asVariableExpression().getVariable());
+        }
+    }
 }
 
 template<typename ModelType, typename GeometryValueType>
@@ -106,6 +136,7 @@ boost::optional<std::vector<GeometryValueType>> DeterministicSchedsLpChecker<Mod
         swValidate.start();
         result = validateCurrentModel(env);
         swValidate.stop();
+        storeMipStart();
     }
     lpModel->pop();
     STORM_LOG_TRACE("\t Done checking a vertex...");
@@ -274,7 +305,7 @@ std::map<uint64_t, storm::expressions::Expression> processEc(storm::storage::Max
 template<typename ModelType, typename GeometryValueType>
 bool DeterministicSchedsLpChecker<ModelType, GeometryValueType>::processEndComponents(std::vector<std::vector<storm::expressions::Expression>>& ecVars) {
     uint64_t ecCounter = 0;
-    auto backwardTransitions = model.getBackwardTransitions();
+    auto const& backwardTransitions = model.getBackwardTransitions();
 
     // Get the choices that do not induce a value (i.e. reward) for all objectives.
     // Only MECS consisting of these choices are relevant
@@ -642,6 +673,11 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::initializeLpMod
             }
         }
     }
+    // If supported, the objective variables become part of the model and each weight vector only changes their objective coefficients.
+    reuseObjectiveVariables = lpModel->supportsObjectiveFunctionCoefficientChanges();
+    if (reuseObjectiveVariables) {
+        addObjectiveVariables(std::vector<GeometryValueType>(objectiveHelper.size(), storm::utility::zero<GeometryValueType>()));
+    }
     lpModel->update();
     STORM_LOG_INFO("Done initializing LP model.");
 }
@@ -693,6 +729,7 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::checkRecursive(
                 swValidate.start();
                 Point newPoint = validateCurrentModel(env);
                 swValidate.stop();
+                storeMipStart();
                 // Check whether this new point yields any progress.
                 // There is no progress if (due to numerical inaccuracies) the downwardclosure (including points that are epsilon close to it) contained in this
                 // polytope. We multiply eps by 0.999 so that points that lie on the boundary of polytope and downw. do not count in the intersection.
@@ -56,6 +56,12 @@ class DeterministicSchedsLpChecker {
     bool processEndComponents(std::vector<std::vector<storm::expressions::Expression>>& ecVars);
     void initializeLpModel(Environment const& env);
 
+    // Adds the variables (and constraints) that yield the values of the objectives at the initial state. The weight vector gives their objective coefficients.
+    void addObjectiveVariables(std::vector<GeometryValueType> const& weightVector);
+
+    // Stores the choices of the most recent LP solution such that the next query can start from it.
+    void storeMipStart();
+
     // Builds the induced markov chain of the current model and checks whether the resulting value coincide with the result of the lp solver.
     Point validateCurrentModel(Environment const& env) const;
 
@@ -72,6 +78,11 @@ class DeterministicSchedsLpChecker {
     std::vector<GeometryValueType> currentWeightVector;
     bool flowEncoding;
 
+    // If set, the objective variables are part of the LP model and only their objective coefficients change between weight vectors.
+    bool reuseObjectiveVariables;
+    // The values of the choice variables in the most recent LP solution (if any).
+    std::vector<int_fast64_t> mipStartValues;
+
     storm::utility::Stopwatch swAll;
     storm::utility::Stopwatch swInit;
     storm::utility::Stopwatch swCheckWeightVectors;
@@ -75,7 +75,7 @@ std::map<uint64_t, typename ModelType::ValueType> const& DeterministicSchedsObje
         if (formula.isProbabilityOperatorFormula() && formula.getSubformula().isUntilFormula()) {
             storm::storage::BitVector phiStates = evaluatePropositionalFormula(model, formula.getSubformula().asUntilFormula().getLeftSubformula());
             storm::storage::BitVector psiStates = evaluatePropositionalFormula(model, formula.getSubformula().asUntilFormula().getRightSubformula());
-            auto backwardTransitions = model.getBackwardTransitions();
+            auto const& backwardTransitions = model.getBackwardTransitions();
             {
                 storm::storage::BitVector prob1States = storm::utility::graph::performProb1A(
                     model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions, phiStates, psiStates);
@@ -78,6 +78,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::check(Environm
 
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+    rewardUnfolding.setPlannedEpochs(epochOrder);
     EpochCheckingData cachedData;
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
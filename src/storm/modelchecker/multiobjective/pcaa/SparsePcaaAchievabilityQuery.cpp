@@ -57,9 +57,16 @@ template<class SparseModelType, typename GeometryValueType>
 bool SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::checkAchievability(Environment const& env) {
     // repeatedly refine the over/ under approximation until the threshold point is either in the under approx. or not in the over approx.
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        WeightVector separatingVector = this->findSeparatingVector(thresholds);
-        this->updateWeightedPrecision(separatingVector);
-        this->performRefinementStep(env, std::move(separatingVector));
+        std::vector<WeightVector> separatingVectors = this->findSeparatingVectors(thresholds, this->getWeightVectorBatchSize(env));
+        // All vectors are checked with the same precision. We take the finest one required for the considered vectors.
+        this->updateWeightedPrecision(separatingVectors.front());
+        typename SparseModelType::ValueType weightedPrecision = this->weightVectorChecker->getWeightedPrecision();
+        for (uint64_t i = 1; i < separatingVectors.size(); ++i) {
+            this->updateWeightedPrecision(separatingVectors[i]);
+            weightedPrecision = std::min(weightedPrecision, this->weightVectorChecker->getWeightedPrecision());
+        }
+        this->weightVectorChecker->setWeightedPrecision(weightedPrecision);
+        this->performRefinementSteps(env, std::move(separatingVectors));
         if (!checkIfThresholdsAreSatisfied(this->overApproximation)) {
             return false;
         }
@@ -64,37 +64,60 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env);) {
+        std::vector<WeightVector> directions;
+        for (uint64_t batchSize = this->getWeightVectorBatchSize(env); directions.size() < batchSize && objIndex < this->objectives.size(); ++objIndex) {
+            directions.emplace_back(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            directions.back()[objIndex] = storm::utility::one<GeometryValueType>();
+        }
+        this->performRefinementSteps(env, std::move(directions));
         if (storm::utility::resources::isTerminate()) {
             break;
         }
     }
 
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
+        std::vector<GeometryValueType> halfspaceDistances(underApproxHalfspaces.size(), storm::utility::zero<GeometryValueType>());
         uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
         GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
             for (auto const& vertex : overApproxVertices) {
                 GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
+                if (distance > halfspaceDistances[halfspaceIndex]) {
+                    halfspaceDistances[halfspaceIndex] = distance;
+                }
                 if (distance > farestDistance) {
                     farestHalfspaceIndex = halfspaceIndex;
                     farestDistance = distance;
                 }
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        GeometryValueType const precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
+        if (farestDistance < precision) {
             // Goal precision reached!
             return;
         }
         STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        std::vector<WeightVector> directions = {underApproxHalfspaces[farestHalfspaceIndex].normalVector()};
+        uint64_t batchSize = this->getWeightVectorBatchSize(env);
+        if (batchSize > 1) {
+            // Further consider the halfspaces that are still too far away from the overApproximation, the farthest ones first.
+            std::vector<uint_fast64_t> halfspaceIndices;
+            for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                if (halfspaceIndex != farestHalfspaceIndex && halfspaceDistances[halfspaceIndex] >= precision) {
+                    halfspaceIndices.push_back(halfspaceIndex);
+                }
+            }
+            std::stable_sort(halfspaceIndices.begin(), halfspaceIndices.end(),
+                             [&halfspaceDistances](uint_fast64_t lhs, uint_fast64_t rhs) { return halfspaceDistances[lhs] > halfspaceDistances[rhs]; });
+            for (uint64_t i = 0; i < halfspaceIndices.size() && directions.size() < batchSize; ++i) {
+                directions.push_back(underApproxHalfspaces[halfspaceIndices[i]].normalVector());
+            }
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
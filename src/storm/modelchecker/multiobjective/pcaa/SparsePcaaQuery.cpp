@@ -1,5 +1,6 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
@@ -29,7 +30,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      preprocessorResult(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -40,15 +44,25 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessi
 template<class SparseModelType, typename GeometryValueType>
 typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVector(
     Point const& pointToBeSeparated) {
+    return std::move(findSeparatingVectors(pointToBeSeparated, 1).front());
+}
+
+template<class SparseModelType, typename GeometryValueType>
+std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector>
+SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors) {
+    STORM_LOG_ASSERT(maxNumberOfVectors > 0, "At least one separating vector has to be requested.");
     STORM_LOG_DEBUG("Searching a weight vector to seperate the point given by "
                     << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(pointToBeSeparated)) << ".");
 
+    std::vector<WeightVector> result;
     if (underApproximation->isEmpty()) {
-        // In this case, every weight vector is separating
-        uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
-        WeightVector result(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
-        result[objIndex] = storm::utility::one<GeometryValueType>();
-        diracWeightVectorsToBeChecked.set(objIndex, false);
+        // In this case, every weight vector is separating. We take Dirac weight vectors for objectives that have not been considered, yet.
+        do {
+            uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
+            result.emplace_back(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
+            result.back()[objIndex] = storm::utility::one<GeometryValueType>();
+            diracWeightVectorsToBeChecked.set(objIndex, false);
+        } while (result.size() < maxNumberOfVectors && !diracWeightVectorsToBeChecked.empty());
         return result;
     }
 
@@ -58,47 +72,123 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
     STORM_LOG_ASSERT(!underApproximation->contains(pointToBeSeparated),
                      "Tried to find a separating point but the point is already contained in the underApproximation");
     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> halfspaces = underApproximation->getHalfspaces();
-    uint_fast64_t farestHalfspaceIndex = halfspaces.size();
-    GeometryValueType farestDistance = -storm::utility::one<GeometryValueType>();
-    bool foundSeparatingDiracVector = false;
+    // The candidates, i.e., the indices of the separating halfspaces together with their distance and whether they are Dirac weight vectors.
+    struct Candidate {
+        uint_fast64_t halfspaceIndex;
+        GeometryValueType distance;
+        bool isSingleObjectiveVector;
+    };
+    std::vector<Candidate> candidates;
     for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
         GeometryValueType distance = halfspaces[halfspaceIndex].euclideanDistance(pointToBeSeparated);
         if (!storm::utility::isZero(distance)) {
             storm::storage::BitVector nonZeroVectorEntries = ~storm::utility::vector::filterZero<GeometryValueType>(halfspaces[halfspaceIndex].normalVector());
             bool isSingleObjectiveVector =
                 nonZeroVectorEntries.getNumberOfSetBits() == 1 && diracWeightVectorsToBeChecked.get(nonZeroVectorEntries.getNextSetIndex(0));
-            // Check if this halfspace is a better candidate than the current one
-            if ((!foundSeparatingDiracVector && isSingleObjectiveVector) ||
-                (foundSeparatingDiracVector == isSingleObjectiveVector && distance > farestDistance)) {
-                foundSeparatingDiracVector = foundSeparatingDiracVector || isSingleObjectiveVector;
-                farestHalfspaceIndex = halfspaceIndex;
-                farestDistance = distance;
+            candidates.push_back({halfspaceIndex, std::move(distance), isSingleObjectiveVector});
+        }
+    }
+    STORM_LOG_THROW(!candidates.empty(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
+    // Prefer Dirac vectors and then far away halfspaces. The stable sort retains the order of the halfspaces among candidates with the same distance.
+    std::stable_sort(candidates.begin(), candidates.end(), [](Candidate const& lhs, Candidate const& rhs) {
+        return lhs.isSingleObjectiveVector != rhs.isSingleObjectiveVector ? lhs.isSingleObjectiveVector : lhs.distance > rhs.distance;
+    });
+    for (auto const& candidate : candidates) {
+        if (result.size() == maxNumberOfVectors) {
+            break;
+        }
+        auto const& normalVector = halfspaces[candidate.halfspaceIndex].normalVector();
+        if (candidate.isSingleObjectiveVector) {
+            diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(normalVector);
+        }
+        STORM_LOG_DEBUG("Found separating weight vector: "
+                        << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(normalVector)) << ".");
+        result.push_back(normalVector);
+    }
+    return result;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+    normalizeDirection(direction);
+    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    addRefinementStep(std::move(direction), *weightVectorChecker);
+
+    updateOverApproximation();
+    updateUnderApproximation();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    STORM_LOG_ASSERT(!directions.empty(), "No direction given.");
+    if (directions.size() == 1) {
+        performRefinementStep(env, std::move(directions.front()));
+        return;
+    }
+    for (auto& direction : directions) {
+        normalizeDirection(direction);
+    }
+
+    bool checkInParallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    if (checkInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+        // Each direction gets its own weight vector checker. The additional checkers are created on demand and re-used in subsequent rounds.
+        std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers = {weightVectorChecker.get()};
+        while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+            additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+        }
+        for (uint64_t i = 0; i + 1 < directions.size(); ++i) {
+            additionalWeightVectorCheckers[i]->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+            checkers.push_back(additionalWeightVectorCheckers[i].get());
+        }
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, directions.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                checkers[i]->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(directions[i]));
             }
+        });
+        for (uint64_t i = 0; i < directions.size(); ++i) {
+            addRefinementStep(std::move(directions[i]), *checkers[i]);
+            updateOverApproximation();
         }
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        checkInParallel = false;
+#endif
     }
-    if (foundSeparatingDiracVector) {
-        diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(halfspaces[farestHalfspaceIndex].normalVector());
+    if (!checkInParallel) {
+        for (auto& direction : directions) {
+            weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+            addRefinementStep(std::move(direction), *weightVectorChecker);
+            updateOverApproximation();
+        }
     }
+    updateUnderApproximation();
+}
 
-    STORM_LOG_THROW(farestHalfspaceIndex < halfspaces.size(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
-    STORM_LOG_DEBUG("Found separating weight vector: "
-                    << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(halfspaces[farestHalfspaceIndex].normalVector()))
-                    << ".");
-    return halfspaces[farestHalfspaceIndex].normalVector();
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getWeightVectorBatchSize(Environment const& env) const {
+    uint64_t result = env.modelchecker().multi().getWeightVectorBatchSize();
+    if (env.modelchecker().multi().isMaxStepsSet()) {
+        uint64_t maxSteps = env.modelchecker().multi().getMaxSteps();
+        result = std::min<uint64_t>(result, maxSteps > refinementSteps.size() ? maxSteps - refinementSteps.size() : 1ull);
+    }
+    return std::max<uint64_t>(result, 1ull);
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-    // Normalize the direction vector so that the entries sum up to one
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::normalizeDirection(WeightVector& direction) const {
     storm::utility::vector::scaleVectorInPlace(
         direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::addRefinementStep(WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType> const& checker) {
     STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                        storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
     RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+    step.weightVector = std::move(direction);
+    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
     // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -107,9 +197,6 @@ void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(
         }
     }
     refinementSteps.push_back(std::move(step));
-
-    updateOverApproximation();
-    updateUnderApproximation();
 }
 
 template<class SparseModelType, typename GeometryValueType>
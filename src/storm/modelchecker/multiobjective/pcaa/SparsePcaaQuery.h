@@ -63,11 +63,40 @@ class SparsePcaaQuery {
      */
     WeightVector findSeparatingVector(Point const& pointToBeSeparated);
 
+    /*
+     * Returns at most maxNumberOfVectors (but at least one) weight vectors that separate the under approximation from the given point, ordered by
+     * preference. The first vector is the one returned by findSeparatingVector.
+     *
+     * @param pointToBeSeparated the point that is to be seperated
+     */
+    std::vector<WeightVector> findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors);
+
     /*
      * Refines the current result w.r.t. the given direction vector.
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. each of the given direction vectors. If Intel TBB is enabled, the direction vectors are checked
+     * concurrently, each with its own weight vector checker. The approximations are only updated once all vectors have been checked.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of weight vectors that are to be checked in the next refinement round, taking the maximum number of refinement steps into account.
+     */
+    uint64_t getWeightVectorBatchSize(Environment const& env) const;
+
+    /*
+     * Normalizes the given direction such that its entries sum up to one.
+     */
+    void normalizeDirection(WeightVector& direction) const;
+
+    /*
+     * Stores the results of the given weight vector checker (which has checked the given direction) as a new refinement step.
+     */
+    void addRefinementStep(WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType> const& checker);
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -95,6 +124,12 @@ class SparsePcaaQuery {
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
 
+    // The result of the preprocessing which is used to create further weight vector checkers when several weight vectors are checked concurrently.
+    // All checkers share the preprocessed model.
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
+    // Weight vector checkers that are used in addition to weightVectorChecker when several weight vectors are checked concurrently.
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
     // Overapproximation of the set of achievable values
@@ -1,9 +1,12 @@
 #include "storm/modelchecker/multiobjective/pcaa/StandardMdpPcaaWeightVectorChecker.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/logic/Formulas.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/TotalRewardStore.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/utility/macros.h"
@@ -28,7 +31,9 @@ StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::StandardMdpPcaaWeightVec
 template<class SparseMdpModelType>
 void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::initializeModelTypeSpecificData(SparseMdpModelType const& model) {
     // set the state action rewards. Also do some sanity checks on the objectives.
-    this->actionRewards.resize(this->objectives.size());
+    std::vector<std::string> rewardModelNames;
+    std::vector<uint64_t> rewardModelIndices;
+    rewardModelIndices.reserve(this->objectives.size());
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         auto const& formula = *this->objectives[objIndex].formula;
         STORM_LOG_THROW(formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().hasRewardModelName(), storm::exceptions::UnexpectedException,
@@ -41,11 +46,18 @@ void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::initializeModelType
             STORM_LOG_THROW(formula.getSubformula().isTotalRewardFormula() || formula.getSubformula().isLongRunAverageRewardFormula(),
                             storm::exceptions::UnexpectedException, "Unexpected type of sub-formula: " << formula.getSubformula());
         }
-        typename SparseMdpModelType::RewardModelType const& rewModel = model.getRewardModel(formula.asRewardOperatorFormula().getRewardModelName());
-        STORM_LOG_THROW(!rewModel.hasTransitionRewards(), storm::exceptions::NotSupportedException,
+        std::string const& rewardModelName = formula.asRewardOperatorFormula().getRewardModelName();
+        STORM_LOG_THROW(!model.getRewardModel(rewardModelName).hasTransitionRewards(), storm::exceptions::NotSupportedException,
                         "Reward model has transition rewards which is not expected.");
-        this->actionRewards[objIndex] = rewModel.getTotalRewardVector(model.getTransitionMatrix());
+        auto nameIt = std::find(rewardModelNames.begin(), rewardModelNames.end(), rewardModelName);
+        rewardModelIndices.push_back(std::distance(rewardModelNames.begin(), nameIt));
+        if (nameIt == rewardModelNames.end()) {
+            rewardModelNames.push_back(rewardModelName);
+        }
     }
+    // Compute the total rewards of all objectives in a single pass over the model.
+    storm::models::sparse::TotalRewardStore<ValueType> rewardStore(model.getTransitionMatrix(), model.getRewardModels(), rewardModelNames);
+    this->actionRewards = rewardStore.getTotalRewardVectors(rewardModelIndices);
 }
 
 template<class SparseMdpModelType>
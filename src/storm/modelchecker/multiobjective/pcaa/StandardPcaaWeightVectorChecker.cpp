@@ -4,6 +4,8 @@
 #include <set>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectiveRewardAnalysis.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -444,21 +446,32 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     if (solver->hasUpperBound()) {
         req.clearUpperBounds();
     }
+    // Consecutive weight vectors are often close to each other. If the EC quotient did not change, we therefore warm-start the solver with the
+    // solution of the previous weight vector. Policy iteration starts with the previously optimal scheduler (which is only done if any scheduler is
+    // valid) and value iteration starts with the previous values. Other methods are not warm-started, e.g., because they require the initial values to be
+    // a lower bound.
+    auto const& minMaxMethod = env.solver().minMax().getMethod();
+    bool const warmStart = ecQuotient->previousSchedulerChoices.is_initialized() && !env.solver().isForceSoundness();
     if (req.validInitialScheduler()) {
         solver->setInitialScheduler(computeValidInitialScheduler(ecQuotient->matrix, ecQuotient->rowsWithSumLessOne));
         req.clearValidInitialScheduler();
+    } else if (warmStart && minMaxMethod == storm::solver::MinMaxMethod::PolicyIteration) {
+        solver->setInitialScheduler(std::vector<uint_fast64_t>(ecQuotient->previousSchedulerChoices.get()));
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     solver->setRequirementsChecked(true);
 
-    // Use the (0...0) vector as initial guess for the solution.
-    std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    if (!warmStart || minMaxMethod != storm::solver::MinMaxMethod::ValueIteration) {
+        // Use the (0...0) vector as initial guess for the solution.
+        std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    }
 
     solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
+    ecQuotient->previousSchedulerChoices = solver->getSchedulerChoices();
     this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
 
-    transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecqStateToOptimalMecMap, this->weightedResult,
+    transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, ecQuotient->previousSchedulerChoices.get(), ecqStateToOptimalMecMap, this->weightedResult,
                                         this->optimalChoices);
 }
 
@@ -170,6 +170,10 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
 
         std::vector<ValueType> auxStateValues;
         std::vector<ValueType> auxChoiceValues;
+
+        // The optimal choices of the most recent weighted solution. If set, auxStateValues contains the corresponding solution.
+        // Both are used to warm-start the computation for the next weight vector.
+        boost::optional<std::vector<uint_fast64_t>> previousSchedulerChoices;
     };
     boost::optional<EcQuotient> ecQuotient;
 
@@ -101,7 +101,7 @@ void SparseMultiObjectivePreprocessor<SparseModelType>::removeIrrelevantStates(s
     storm::storage::BitVector absorbingStates(model->getNumberOfStates(), true);
 
     storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> mc(*model);
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = model->getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = model->getBackwardTransitions();
 
     for (auto const& opFormula : originalFormula.getSubformulas()) {
         // Compute a set of states from which we can make any subset absorbing without affecting this subformula
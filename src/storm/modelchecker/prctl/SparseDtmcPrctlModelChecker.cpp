@@ -7,6 +7,8 @@
 #include "storm/utility/FilteredRewardModel.h"
 #include "storm/utility/macros.h"
 
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitSolutionCache.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -16,6 +18,7 @@
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseDeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
+#include "storm/modelchecker/helper/utility/AcyclicModelEnvironment.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/QuantileHelper.h"
@@ -127,10 +130,22 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
     ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+
+    // If requested, start from the solution of an earlier property with the same constraint and target states.
+    auto solutionCache = checkTask.isQualitativeSet() ? nullptr : storm::modelchecker::getSolutionCache<ValueType>(checkTask.getHint());
+    std::unique_ptr<ModelCheckerHint> cachedHint;
+    if (solutionCache) {
+        cachedHint = solutionCache->createHint(checkTask.getHint(), "P", leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), boost::none);
+    }
+
+    Environment const solverEnv = storm::modelchecker::helper::getEnvironmentForModel(env, this->getModel());
     std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
-        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        solverEnv, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
-        checkTask.getHint());
+        cachedHint ? *cachedHint : checkTask.getHint());
+    if (solutionCache) {
+        solutionCache->insert("P", leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), boost::none, numericResult);
+    }
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
 
@@ -224,9 +239,24 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+
+    // If requested, start from the solution of an earlier property with the same reward model and target states.
+    auto solutionCache = checkTask.isQualitativeSet() ? nullptr : storm::modelchecker::getSolutionCache<ValueType>(checkTask.getHint());
+    std::unique_ptr<ModelCheckerHint> cachedHint;
+    std::string const quantity = "R" + (checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "");
+    storm::storage::BitVector const allStates(this->getModel().getNumberOfStates(), true);
+    if (solutionCache) {
+        cachedHint = solutionCache->createHint(checkTask.getHint(), quantity, allStates, subResult.getTruthValuesVector(), boost::none);
+    }
+
+    Environment const solverEnv = storm::modelchecker::helper::getEnvironmentForModel(env, this->getModel());
     std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(
-        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.getHint());
+        solverEnv, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
+        cachedHint ? *cachedHint : checkTask.getHint());
+    if (solutionCache) {
+        solutionCache->insert(quantity, allStates, subResult.getTruthValuesVector(), boost::none, numericResult);
+    }
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
 
@@ -236,8 +266,9 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     storm::logic::EventuallyFormula const& eventuallyFormula = checkTask.getFormula();
     std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
+    Environment const solverEnv = storm::modelchecker::helper::getEnvironmentForModel(env, this->getModel());
     std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityTimes(
-        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        solverEnv, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.getHint());
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
@@ -6,6 +6,8 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitSolutionCache.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -18,6 +20,7 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
+#include "storm/modelchecker/helper/utility/AcyclicModelEnvironment.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
 #include "storm/modelchecker/lexicographic/lexicographicModelChecking.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -164,10 +167,24 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
     ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+
+    // If requested, start from the solution of an earlier property with the same constraint and target states.
+    auto solutionCache = checkTask.isQualitativeSet() ? nullptr : storm::modelchecker::getSolutionCache<ValueType>(checkTask.getHint());
+    std::unique_ptr<ModelCheckerHint> cachedHint;
+    if (solutionCache) {
+        cachedHint = solutionCache->createHint(checkTask.getHint(), "P", leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(),
+                                               checkTask.getOptimizationDirection());
+    }
+
+    Environment const solverEnv = storm::modelchecker::helper::getEnvironmentForModel(env, this->getModel());
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
-        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        solverEnv, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
-        checkTask.isProduceSchedulersSet(), checkTask.getHint());
+        checkTask.isProduceSchedulersSet() || solutionCache, cachedHint ? *cachedHint : checkTask.getHint());
+    if (solutionCache) {
+        solutionCache->insert("P", leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.getOptimizationDirection(), ret.values,
+                              ret.scheduler.get());
+    }
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
     if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
         result->asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(ret.scheduler));
@@ -318,10 +335,24 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+
+    // If requested, start from the solution of an earlier property with the same reward model and target states.
+    auto solutionCache = checkTask.isQualitativeSet() ? nullptr : storm::modelchecker::getSolutionCache<ValueType>(checkTask.getHint());
+    std::unique_ptr<ModelCheckerHint> cachedHint;
+    std::string const quantity = "R" + (checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "");
+    storm::storage::BitVector const allStates(this->getModel().getNumberOfStates(), true);
+    if (solutionCache) {
+        cachedHint = solutionCache->createHint(checkTask.getHint(), quantity, allStates, subResult.getTruthValuesVector(), checkTask.getOptimizationDirection());
+    }
+
+    Environment const solverEnv = storm::modelchecker::helper::getEnvironmentForModel(env, this->getModel());
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(
-        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        solverEnv, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
-        checkTask.isProduceSchedulersSet(), checkTask.getHint());
+        checkTask.isProduceSchedulersSet() || solutionCache, cachedHint ? *cachedHint : checkTask.getHint());
+    if (solutionCache) {
+        solutionCache->insert(quantity, allStates, subResult.getTruthValuesVector(), checkTask.getOptimizationDirection(), ret.values, ret.scheduler.get());
+    }
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
     if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
         result->asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(ret.scheduler));
@@ -337,8 +368,9 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
                     "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
     std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
+    Environment const solverEnv = storm::modelchecker::helper::getEnvironmentForModel(env, this->getModel());
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeReachabilityTimes(
-        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        solverEnv, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(),
         checkTask.getHint());
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
@@ -5,6 +5,9 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -30,6 +33,96 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+template<typename ValueType>
+inline std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
+                                                       std::vector<ValueType> const& oneStepTargetProbabilities) {
+    DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
+    std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
+    return bounds;
+}
+
+template<>
+inline std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                                     std::vector<storm::RationalFunction> const& rewards,
+                                                                     std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
+}
+
+/*!
+ * Solves the equation system x = A*x + b over the given maybe states one SCC block at a time (in reverse topological order). Only the matrix of the
+ * current block is translated to the explicit representation, the solutions of the previously solved blocks are incorporated into its vector.
+ *
+ * @param subvector The vector b of the equation system (over the row variables).
+ * @param probabilities If set, the solution is known to lie in [0, 1]. Otherwise, it is only known to be non-negative.
+ * @return The solution for the maybe states with respect to the given ODD.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+std::vector<ValueType> solveEquationSystemSccWise(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                  storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& maybeStates,
+                                                  storm::dd::Odd const& odd, storm::dd::Add<DdType, ValueType> const& subvector, bool probabilities) {
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    auto req = linearEquationSolverFactory.getRequirements(env);
+    req.clearLowerBounds();
+    bool computeUpperBounds = !probabilities && req.upperBounds();
+    req.clearUpperBounds();
+    STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                    "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
+    bool convertToEquationSystem =
+        linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+
+    uint64_t minimalBlockSize = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getHybridSccMinimalBlockSize();
+    std::vector<storm::dd::Bdd<DdType>> blocks = storm::utility::graph::computeSccBlocks(model, transitionMatrix.notZero(), maybeStates, minimalBlockSize);
+    STORM_LOG_INFO("Solving the equation system for " << maybeStates.getNonZeroCount() << " states in " << blocks.size() << " blocks.");
+
+    storm::utility::Stopwatch conversionWatch;
+    storm::dd::Add<DdType, ValueType> solvedValues = model.getManager().template getAddZero<ValueType>();
+    for (auto const& block : blocks) {
+        conversionWatch.start();
+        storm::dd::Odd blockOdd = block.createOdd();
+        storm::dd::Add<DdType, ValueType> blockAdd = block.template toAdd<ValueType>();
+        storm::dd::Add<DdType, ValueType> blockRows = transitionMatrix * blockAdd;
+
+        // The transitions leaving the block either lead to states whose values are known or they are already accounted for by the given vector.
+        std::vector<ValueType> b =
+            (subvector * blockAdd + blockRows.multiplyMatrix(solvedValues.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables()))
+                .toVector(blockOdd);
+        boost::optional<std::vector<ValueType>> exitProbabilities;
+        if (computeUpperBounds) {
+            storm::dd::Bdd<DdType> exitStates = (!block && model.getReachableStates()).swapVariables(model.getRowColumnMetaVariablePairs());
+            exitProbabilities = blockRows.multiplyMatrix(exitStates, model.getColumnVariables()).toVector(blockOdd);
+        }
+        storm::storage::SparseMatrix<ValueType> explicitSubmatrix =
+            (blockRows * blockAdd.swapVariables(model.getRowColumnMetaVariablePairs())).toMatrix(blockOdd, blockOdd);
+        conversionWatch.stop();
+
+        boost::optional<std::vector<ValueType>> upperBounds;
+        if (computeUpperBounds) {
+            upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, exitProbabilities.get());
+        }
+        if (convertToEquationSystem) {
+            explicitSubmatrix.convertToEquationSystem();
+        }
+
+        std::vector<ValueType> x(b.size(), storm::utility::convertNumber<ValueType>(0.5));
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+        if (probabilities) {
+            solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+        } else {
+            solver->setLowerBound(storm::utility::zero<ValueType>());
+            if (upperBounds) {
+                solver->setUpperBounds(std::move(upperBounds.get()));
+            }
+        }
+        solver->solveEquations(env, x, b);
+
+        solvedValues += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), x, blockOdd, model.getRowVariables());
+    }
+    STORM_LOG_INFO("Converting symbolic matrices/vectors of the blocks to explicit representation done in " << conversionWatch.getTimeInMilliseconds()
+                                                                                                              << "ms.");
+
+    return solvedValues.toVector(odd);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env,
                                                                                                  storm::models::symbolic::Model<DdType, ValueType> const& model,
@@ -78,6 +171,13 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
             storm::dd::Add<DdType, ValueType> subvector = submatrix * prob1StatesAsColumn;
             subvector = subvector.sumAbstract(model.getColumnVariables());
 
+            if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isHybridSccSet()) {
+                std::vector<ValueType> x = solveEquationSystemSccWise(env, model, transitionMatrix, maybeStates, odd, subvector, true);
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(),
+                    maybeStates, odd, x));
+            }
+
             storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
             auto req = linearEquationSolverFactory.getRequirements(env);
             req.clearLowerBounds();
@@ -263,21 +363,6 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeCu
 }
 
 // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
-template<typename ValueType>
-inline std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                                       std::vector<ValueType> const& oneStepTargetProbabilities) {
-    DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
-    std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
-    return bounds;
-}
-
-template<>
-inline std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
-                                                                     std::vector<storm::RationalFunction> const& rewards,
-                                                                     std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
-}
-
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeReachabilityRewards(
     Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix,
@@ -321,6 +406,15 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
             // Then compute the state reward vector to use in the computation.
             storm::dd::Add<DdType, ValueType> subvector = rewardModel.getTotalRewardVector(maybeStatesAdd, submatrix, model.getColumnVariables());
 
+            if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isHybridSccSet()) {
+                std::vector<ValueType> x = solveEquationSystemSccWise(env, model, transitionMatrix, maybeStates, odd, subvector, false);
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), model.getReachableStates() && !maybeStates,
+                    infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()),
+                                       model.getManager().template getAddZero<ValueType>()),
+                    maybeStates, odd, x));
+            }
+
             // Check the requirements of a linear equation solver
             // We might need to compute upper reward bounds for which the oneStepTargetProbabilities are needed.
             boost::optional<storm::dd::Add<DdType, ValueType>> oneStepTargetProbs;
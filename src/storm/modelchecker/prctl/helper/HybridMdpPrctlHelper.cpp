@@ -65,7 +65,7 @@ std::vector<uint64_t> computeValidInitialSchedulerForUntilProbabilities(storm::s
 
         for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
             if (!targetStates.get(state)) {
-                result[state] = validScheduler.getChoice(state).getDeterministicChoice();
+                result[state] = validScheduler.getDeterministicChoice(state);
             }
         }
     }
@@ -466,7 +466,7 @@ std::vector<uint64_t> computeValidInitialSchedulerForReachabilityRewards(storm::
 
     for (uint64_t state = 0; state < numberOfMaybeStates; ++state) {
         if (!targetStates.get(state)) {
-            result[state] = validScheduler.getChoice(state).getDeterministicChoice();
+            result[state] = validScheduler.getDeterministicChoice(state);
         }
     }
 
@@ -12,9 +12,11 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/SolverWorkspace.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -73,6 +75,10 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
 
     Environment preciseEnv = env;
+    if (!preciseEnv.solver().getWorkspace()) {
+        // The epoch models are solved one after another, so their solvers can recycle each others auxiliary vectors.
+        preciseEnv.solver().setWorkspace(std::make_shared<storm::solver::SolverWorkspace>());
+    }
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
     preciseEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
@@ -88,13 +94,8 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
+    // Processes an epoch whose solution has been computed. Returns false if the computation should be aborted.
+    auto processSolvedEpoch = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -108,8 +109,37 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+        return !storm::utility::resources::isTerminate();
+    };
+
+    // Solutions of epochs are only needed as long as they are required for other epochs in the computation order.
+    rewardUnfolding.setPlannedEpochs(epochOrder);
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        // Analyze independent epochs concurrently. Epoch models are built by the workers, so the building time is included in the checking time.
+        swCheck.start();
+        rewardUnfolding.computeEpochSolutionsInParallel(
+            epochOrder,
+            [&]() {
+                // Each worker uses its own solver and auxiliary vectors.
+                auto workerSolver = std::make_shared<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>>();
+                return [&, workerSolver, workerX = std::vector<ValueType>(), workerB = std::vector<ValueType>()](
+                           rewardbounded::EpochModel<ValueType, true>& epochModel) mutable {
+                    return epochModel.analyzeSingleObjective(preciseEnv, workerX, workerB, *workerSolver, lowerBound, upperBound);
+                };
+            },
+            processSolvedEpoch);
+        swCheck.stop();
+    } else {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            if (!processSolvedEpoch(epoch)) {
+                break;
+            }
         }
     }
 
@@ -138,6 +168,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
+        STORM_PRINT_AND_LOG(" max. stored sol. entries: " << rewardUnfolding.getEpochSolutionStore().getMaximalNumberOfStoredSolutionEntries() << ".\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
     }
 
@@ -175,9 +206,22 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1 (" << maybeStates.getNumberOfSetBits()
                                          << " states remaining).");
     } else {
-        // Get all states that have probability 0 and 1 of satisfying the until-formula.
-        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+        // Get all states that have probability 0 and 1 of satisfying the until-formula. If possible, we reuse the analysis of an earlier property.
+        auto precomputationCache = getPrecomputationCache<ValueType>(hint);
+        boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> cachedStatesWithProbability01;
+        if (precomputationCache) {
+            cachedStatesWithProbability01 = precomputationCache->find("P", phiStates, psiStates, boost::none);
+        }
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+        if (cachedStatesWithProbability01) {
+            STORM_LOG_INFO("Reusing the qualitative analysis of a previous property.");
+            statesWithProbability01 = std::move(*cachedStatesWithProbability01);
+        } else {
+            statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            if (precomputationCache) {
+                precomputationCache->insert("P", phiStates, psiStates, boost::none, statesWithProbability01);
+            }
+        }
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -507,6 +551,9 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             storm::solver::LinearEquationSolverRequirements requirements = linearEquationSolverFactory.getRequirements(env);
             boost::optional<std::vector<ValueType>> upperRewardBounds;
             requirements.clearLowerBounds();
+            if (requirements.acyclic() && !storm::utility::graph::hasCycle(submatrix)) {
+                requirements.clearAcyclic();
+            }
             if (requirements.upperBounds()) {
                 upperRewardBounds = computeUpperRewardBounds(submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
                 requirements.clearUpperBounds();
@@ -3,6 +3,7 @@
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
@@ -22,6 +23,7 @@
 
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverWorkspace.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -38,7 +40,9 @@
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -73,6 +77,10 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
     Environment preciseEnv = env;
+    if (!preciseEnv.solver().getWorkspace()) {
+        // The epoch models are solved one after another, so their solvers can recycle each others auxiliary vectors.
+        preciseEnv.solver().setWorkspace(std::make_shared<storm::solver::SolverWorkspace>());
+    }
     preciseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
 
     // In case of cdf export we store the necessary data.
@@ -82,13 +90,8 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-        swCheck.stop();
+    // Processes an epoch whose solution has been computed. Returns false if the computation should be aborted.
+    auto processSolvedEpoch = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
         if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
             !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
             std::vector<ValueType> cdfEntry;
@@ -102,8 +105,37 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
         }
         ++numCheckedEpochs;
         progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
+        return !storm::utility::resources::isTerminate();
+    };
+
+    // Solutions of epochs are only needed as long as they are required for other epochs in the computation order.
+    rewardUnfolding.setPlannedEpochs(epochOrder);
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        // Analyze independent epochs concurrently. Epoch models are built by the workers, so the building time is included in the checking time.
+        swCheck.start();
+        rewardUnfolding.computeEpochSolutionsInParallel(
+            epochOrder,
+            [&]() {
+                // Each worker uses its own solver and auxiliary vectors.
+                auto workerSolver = std::make_shared<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>>();
+                return [&, workerSolver, workerX = std::vector<ValueType>(), workerB = std::vector<ValueType>()](
+                           rewardbounded::EpochModel<ValueType, true>& epochModel) mutable {
+                    return epochModel.analyzeSingleObjective(preciseEnv, dir, workerX, workerB, *workerSolver, lowerBound, upperBound);
+                };
+            },
+            processSolvedEpoch);
+        swCheck.stop();
+    } else {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            swCheck.stop();
+            if (!processSolvedEpoch(epoch)) {
+                break;
+            }
         }
     }
 
@@ -132,6 +164,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
         STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
+        STORM_PRINT_AND_LOG(" max. stored sol. entries: " << rewardUnfolding.getEpochSolutionStore().getMaximalNumberOfStoredSolutionEntries() << ".\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
     }
 
@@ -173,7 +206,7 @@ std::vector<uint_fast64_t> computeValidSchedulerHint(Environment const& env, Sol
     std::vector<uint_fast64_t> schedulerHint(maybeStates.getNumberOfSetBits());
     auto maybeIt = maybeStates.begin();
     for (auto& choice : schedulerHint) {
-        choice = validScheduler.getChoice(*maybeIt).getDeterministicChoice();
+        choice = validScheduler.getDeterministicChoice(*maybeIt);
         ++maybeIt;
     }
     return schedulerHint;
@@ -274,7 +307,7 @@ void extractValueAndSchedulerHint(SparseMdpHintType<ValueType>& hintStorage, sto
             if (!skipECWithinMaybeStatesCheck) {
                 hintChoices.reserve(maybeStates.size());
                 for (uint_fast64_t state = 0; state < maybeStates.size(); ++state) {
-                    hintChoices.push_back(schedulerHint.getChoice(state).getDeterministicChoice());
+                    hintChoices.push_back(schedulerHint.getDeterministicChoice(state));
                 }
                 hintApplicable =
                     storm::utility::graph::performProb1(transitionMatrix.transposeSelectedRowsFromRowGroups(hintChoices), maybeStates, ~maybeStates).full();
@@ -287,7 +320,7 @@ void extractValueAndSchedulerHint(SparseMdpHintType<ValueType>& hintStorage, sto
                 hintChoices.clear();
                 hintChoices.reserve(maybeStates.getNumberOfSetBits());
                 for (auto state : maybeStates) {
-                    uint_fast64_t hintChoice = schedulerHint.getChoice(state).getDeterministicChoice();
+                    uint_fast64_t hintChoice = schedulerHint.getDeterministicChoice(state);
                     if (selectedChoices) {
                         uint_fast64_t firstChoice = transitionMatrix.getRowGroupIndices()[state];
                         uint_fast64_t lastChoice = firstChoice + hintChoice;
@@ -358,6 +391,11 @@ SparseMdpHintType<ValueType> computeHints(Environment const& env, SolutionType c
             requirements.clearValidInitialScheduler();
         }
 
+        // The acyclic solver can be used if the maybe states do not lie on a cycle.
+        if (requirements.acyclic() && !storm::utility::graph::hasCycle(transitionMatrix, maybeStates)) {
+            requirements.clearAcyclic();
+        }
+
         // Finally, we have information on the bounds depending on the problem type.
         if (type == SolutionType::UntilProbabilities) {
             requirements.clearBounds();
@@ -511,17 +549,30 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
-                                                                                     storm::storage::BitVector const& psiStates) {
+                                                                                     storm::storage::BitVector const& psiStates,
+                                                                                     std::shared_ptr<ExplicitPrecomputationCache> const& precomputationCache) {
     QualitativeStateSetsUntilProbabilities result;
 
-    // Get all states that have probability 0 and 1 of satisfying the until-formula.
+    // Get all states that have probability 0 and 1 of satisfying the until-formula. If possible, we reuse the analysis of an earlier property.
+    boost::optional<std::pair<storm::storage::BitVector, storm::storage::BitVector>> cachedStatesWithProbability01;
+    if (precomputationCache) {
+        cachedStatesWithProbability01 = precomputationCache->find("P", phiStates, psiStates, goal.direction());
+    }
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    if (cachedStatesWithProbability01) {
+        STORM_LOG_INFO("Reusing the qualitative analysis of a previous property.");
+        statesWithProbability01 = std::move(*cachedStatesWithProbability01);
     } else {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        if (goal.minimize()) {
+            statesWithProbability01 =
+                storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        } else {
+            statesWithProbability01 =
+                storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        }
+        if (precomputationCache) {
+            precomputationCache->insert("P", phiStates, psiStates, goal.direction(), statesWithProbability01);
+        }
     }
     result.statesWithProbability0 = std::move(statesWithProbability01.first);
     result.statesWithProbability1 = std::move(statesWithProbability01.second);
@@ -539,7 +590,8 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates,
+                                                             getPrecomputationCache<ValueType>(hint));
     }
 }
 
@@ -1337,6 +1389,67 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     return MDPSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(scheduler));
 }
 
+/*!
+ * Computes the maximal probability of reaching the goal state in the model that is obtained from the original model by the restart transformation
+ * of the conditional probability computation, without building this model. Instead, value iteration is performed on the original matrix, where the
+ * transitions to the goal, stop and fail states as well as the restart transitions are accounted for while multiplying with the matrix. As
+ * the fail state restarts the model, its value is the value of the initial state.
+ *
+ * @return The value of the initial state in the transformed model.
+ */
+template<typename ValueType>
+ValueType computeConditionalProbabilityDirectly(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                storm::storage::sparse::state_type initialState, storm::storage::BitVector const& relevantStates,
+                                                storm::storage::BitVector const& fixedTargetStates, storm::storage::BitVector const& extendedConditionStates,
+                                                storm::storage::BitVector const& pureResetStates, storm::storage::BitVector const& problematicStates,
+                                                std::vector<ValueType> const& conditionProbabilities, std::vector<ValueType> const& targetProbabilities) {
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+    // The states with a fixed value are resolved once, all remaining states are resolved by maximizing over their choices in each iteration.
+    storm::storage::BitVector choiceStates = relevantStates & ~(fixedTargetStates | extendedConditionStates | pureResetStates);
+
+    // Starting from zero, the values approach the least fixed point from below. The values are updated in place (Gauss-Seidel style).
+    std::vector<ValueType> x(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    for (auto state : extendedConditionStates & relevantStates & ~fixedTargetStates) {
+        x[state] = targetProbabilities[state];
+    }
+    uint64_t iterations = 0;
+    bool converged = false;
+    while (!converged && iterations < maxIter && !storm::utility::resources::isTerminate()) {
+        converged = true;
+        auto update = [&](uint64_t state, ValueType const& newValue) {
+            if (converged && !storm::utility::vector::equalModuloPrecision(x[state], newValue, precision, relative)) {
+                converged = false;
+            }
+            x[state] = newValue;
+        };
+        for (auto state : choiceStates) {
+            ValueType best = problematicStates.get(state) ? x[initialState] : storm::utility::zero<ValueType>();
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                ValueType value = transitionMatrix.multiplyRowWithVector(row, x);
+                if (value > best) {
+                    best = value;
+                }
+            }
+            update(state, best);
+        }
+        for (auto state : fixedTargetStates & relevantStates) {
+            update(state, conditionProbabilities[state] + (storm::utility::one<ValueType>() - conditionProbabilities[state]) * x[initialState]);
+        }
+        for (auto state : pureResetStates & relevantStates & ~(fixedTargetStates | extendedConditionStates)) {
+            update(state, x[initialState]);
+        }
+        ++iterations;
+    }
+    STORM_LOG_WARN_COND(converged, "Direct computation of conditional probabilities did not converge after " << iterations << " iterations.");
+    STORM_LOG_INFO("Direct computation of conditional probabilities " << (converged ? "converged" : "stopped") << " after " << iterations
+                                                                      << " iterations.");
+    return x[initialState];
+}
+
 template<typename ValueType>
 std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditionalProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -1419,6 +1532,22 @@ std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditional
     storm::storage::BitVector relevantStates = storm::utility::graph::getReachableStates(transitionMatrix, initialStatesBitVector, allStates,
                                                                                          extendedConditionStates | fixedTargetStates | pureResetStates);
     STORM_LOG_TRACE("Found " << relevantStates.getNumberOfSetBits() << " relevant states for conditional probability computation.");
+
+    // If requested, we solve the equations of the transformed MDP on the original matrix. As this relies on value iteration, exact results
+    // still require the transformed MDP.
+    bool direct = env.modelchecker().isConditionalDirectSet();
+    STORM_LOG_WARN_COND(!direct || (!env.solver().isForceExact() && !storm::NumberTraits<ValueType>::IsExact),
+                        "Direct computation of conditional probabilities is not supported for exact computations. Building the transformed model instead.");
+    if (direct && !env.solver().isForceExact() && !storm::NumberTraits<ValueType>::IsExact) {
+        ValueType value = computeConditionalProbabilityDirectly(env, transitionMatrix, initialState, relevantStates, fixedTargetStates,
+                                                                extendedConditionStates, pureResetStates, problematicStates, conditionProbabilities,
+                                                                targetProbabilities);
+        std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+        STORM_LOG_DEBUG("Computed conditional probabilities directly in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                                                                          << "ms.");
+        return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(
+            initialState, goal.minimize() ? storm::utility::one<ValueType>() - value : value));
+    }
     std::vector<uint_fast64_t> numberOfStatesBeforeRelevantStates = relevantStates.getNumberOfSetBitsBeforeIndices();
     storm::storage::sparse::state_type newGoalState = relevantStates.getNumberOfSetBits();
     storm::storage::sparse::state_type newStopState = newGoalState + 1;
@@ -0,0 +1,85 @@
+#include "storm/modelchecker/prctl/helper/rewardbounded/EpochSolutionStore.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+namespace rewardbounded {
+
+template<typename ValueType, bool SingleObjectiveMode>
+EpochSolutionStore<ValueType, SingleObjectiveMode>::EpochSolutionStore() : numberOfStoredSolutionEntries(0), maximalNumberOfStoredSolutionEntries(0) {
+    // Intentionally left empty
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void EpochSolutionStore<ValueType, SingleObjectiveMode>::insert(Epoch const& epoch, std::vector<SolutionType>&& solutions,
+                                                                std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap,
+                                                                uint64_t referenceCount) {
+    EpochSolution& epochSolution = epochSolutions[epoch];
+    numberOfStoredSolutionEntries -= epochSolution.solutions.size();
+    epochSolution.count = referenceCount;
+    epochSolution.productStateToSolutionVectorMap = productStateToSolutionVectorMap;
+    epochSolution.solutions = std::move(solutions);
+    numberOfStoredSolutionEntries += epochSolution.solutions.size();
+    maximalNumberOfStoredSolutionEntries = std::max(maximalNumberOfStoredSolutionEntries, numberOfStoredSolutionEntries);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+bool EpochSolutionStore<ValueType, SingleObjectiveMode>::contains(Epoch const& epoch) const {
+    return epochSolutions.count(epoch) > 0;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+typename EpochSolutionStore<ValueType, SingleObjectiveMode>::EpochSolution const* EpochSolutionStore<ValueType, SingleObjectiveMode>::find(
+    Epoch const& epoch) const {
+    auto epochSolutionIt = epochSolutions.find(epoch);
+    return epochSolutionIt == epochSolutions.end() ? nullptr : &epochSolutionIt->second;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void EpochSolutionStore<ValueType, SingleObjectiveMode>::release(Epoch const& epoch) {
+    auto epochSolutionIt = epochSolutions.find(epoch);
+    STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Solution for epoch does not exist (anymore).");
+    // Solutions that no epoch depends on are kept.
+    if (epochSolutionIt->second.count > 0) {
+        --epochSolutionIt->second.count;
+        if (epochSolutionIt->second.count == 0) {
+            numberOfStoredSolutionEntries -= epochSolutionIt->second.solutions.size();
+            epochSolutions.erase(epochSolutionIt);
+        }
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void EpochSolutionStore<ValueType, SingleObjectiveMode>::clear() {
+    epochSolutions.clear();
+    numberOfStoredSolutionEntries = 0;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t EpochSolutionStore<ValueType, SingleObjectiveMode>::getNumberOfStoredEpochs() const {
+    return epochSolutions.size();
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t EpochSolutionStore<ValueType, SingleObjectiveMode>::getNumberOfStoredSolutionEntries() const {
+    return numberOfStoredSolutionEntries;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t EpochSolutionStore<ValueType, SingleObjectiveMode>::getMaximalNumberOfStoredSolutionEntries() const {
+    return maximalNumberOfStoredSolutionEntries;
+}
+
+template class EpochSolutionStore<double, true>;
+template class EpochSolutionStore<double, false>;
+template class EpochSolutionStore<storm::RationalNumber, true>;
+template class EpochSolutionStore<storm::RationalNumber, false>;
+}  // namespace rewardbounded
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/modelchecker/prctl/helper/rewardbounded/EpochManager.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+namespace rewardbounded {
+
+/*!
+ * Stores the solutions of analyzed epochs. Each solution has a reference count that reflects the number of epochs that depend on it and are still to be
+ * analyzed. A solution is dropped as soon as its reference count drops to zero. Solutions that are stored with reference count zero are kept until they are
+ * replaced.
+ */
+template<typename ValueType, bool SingleObjectiveMode>
+class EpochSolutionStore {
+   public:
+    typedef typename EpochManager::Epoch Epoch;
+    typedef typename std::conditional<SingleObjectiveMode, ValueType, std::vector<ValueType>>::type SolutionType;
+
+    struct EpochSolution {
+        uint64_t count;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
+        std::vector<SolutionType> solutions;
+    };
+
+    EpochSolutionStore();
+
+    /*!
+     * Stores the given solution. A previously stored solution of the same epoch is replaced.
+     *
+     * @param referenceCount The number of epochs that depend on this solution, each of which releases the solution once it has been analyzed.
+     */
+    void insert(Epoch const& epoch, std::vector<SolutionType>&& solutions,
+                std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, uint64_t referenceCount);
+
+    /*!
+     * Retrieves whether a solution for the given epoch is stored.
+     */
+    bool contains(Epoch const& epoch) const;
+
+    /*!
+     * Retrieves the stored solution for the given epoch or nullptr, if there is none.
+     */
+    EpochSolution const* find(Epoch const& epoch) const;
+
+    /*!
+     * Indicates that an epoch depending on the solution of the given epoch has been analyzed. The solution is dropped if no other epoch depends on it.
+     */
+    void release(Epoch const& epoch);
+
+    /*!
+     * Drops all stored solutions.
+     */
+    void clear();
+
+    /*!
+     * Retrieves the number of epochs for which a solution is stored.
+     */
+    uint64_t getNumberOfStoredEpochs() const;
+
+    /*!
+     * Retrieves the number of currently stored solution entries (i.e., the number of in-states summed up over all stored epochs).
+     */
+    uint64_t getNumberOfStoredSolutionEntries() const;
+
+    /*!
+     * Retrieves the maximal number of solution entries that were stored at the same time.
+     */
+    uint64_t getMaximalNumberOfStoredSolutionEntries() const;
+
+   private:
+    std::unordered_map<Epoch, EpochSolution> epochSolutions;
+    uint64_t numberOfStoredSolutionEntries;
+    uint64_t maximalNumberOfStoredSolutionEntries;
+};
+
+}  // namespace rewardbounded
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
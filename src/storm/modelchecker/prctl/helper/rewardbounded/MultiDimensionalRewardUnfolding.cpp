@@ -1,9 +1,11 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
 #include <functional>
+#include <map>
 #include <set>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
 
@@ -378,7 +380,7 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
     std::set<Epoch, std::function<bool(Epoch const&, Epoch const&)>> collectedEpochs(
         std::bind(&EpochManager::epochClassZigZagOrder, &epochManager, std::placeholders::_1, std::placeholders::_2));
 
-    if (!stopAtComputedEpochs || epochSolutions.count(startEpoch) == 0) {
+    if (!stopAtComputedEpochs || !epochSolutions.contains(startEpoch)) {
         collectedEpochs.insert(startEpoch);
         dfsStack.push_back(startEpoch);
     }
@@ -387,7 +389,7 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
         dfsStack.pop_back();
         for (auto const& step : possibleEpochSteps) {
             Epoch successorEpoch = epochManager.getSuccessorEpoch(currentEpoch, step);
-            if (!stopAtComputedEpochs || epochSolutions.count(successorEpoch) == 0) {
+            if (!stopAtComputedEpochs || !epochSolutions.contains(successorEpoch)) {
                 if (collectedEpochs.insert(successorEpoch).second) {
                     dfsStack.push_back(std::move(successorEpoch));
                 }
@@ -397,13 +399,103 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationLayers(std::vector<Epoch> const& epochOrder) {
+    std::vector<std::vector<Epoch>> layers;
+    std::map<Epoch, uint64_t> epochToLayerMap;
+    for (auto const& epoch : epochOrder) {
+        // The epoch has to be placed after the layers of all its successor epochs.
+        uint64_t layer = 0;
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch) {
+                auto successorLayerIt = epochToLayerMap.find(successorEpoch);
+                if (successorLayerIt != epochToLayerMap.end()) {
+                    layer = std::max(layer, successorLayerIt->second + 1);
+                } else {
+                    STORM_LOG_ASSERT(epochSolutions.contains(successorEpoch), "Invalid epoch computation order: Successor epoch "
+                                                                                   << epochManager.toString(successorEpoch) << " of epoch "
+                                                                                   << epochManager.toString(epoch) << " is not computed before.");
+                }
+            }
+        }
+        epochToLayerMap.emplace(epoch, layer);
+        if (layer == layers.size()) {
+            layers.emplace_back();
+        }
+        layers[layer].push_back(epoch);
+    }
+    return layers;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setPlannedEpochs(std::vector<Epoch> const& epochs) {
+    plannedEpochs = std::set<Epoch>(epochs.begin(), epochs.end());
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::computeEpochSolutionsInParallel(
+    std::vector<Epoch> const& epochOrder, std::function<EpochModelAnalyzer()> const& createAnalyzer, std::function<bool(Epoch const&)> const& epochSolved) {
+#ifdef STORM_HAVE_INTELTBB
+    // Each worker builds and analyzes its own epoch models.
+    struct Worker {
+        EpochModelContext context;
+        EpochModelAnalyzer analyzer;
+    };
+    tbb::enumerable_thread_specific<Worker> workers([this, &createAnalyzer]() {
+        Worker worker;
+        worker.context.epochModel.equationSolverProblemFormat = defaultContext.epochModel.equationSolverProblemFormat;
+        worker.analyzer = createAnalyzer();
+        return worker;
+    });
+
+    for (auto const& layer : getEpochComputationLayers(epochOrder)) {
+        // The epochs of a layer only read solutions of previous layers, so their solutions are stored after the whole layer has been analyzed.
+        std::vector<std::vector<SolutionType>> layerSolutions(layer.size());
+        std::vector<std::shared_ptr<std::vector<uint64_t> const>> layerSolutionMaps(layer.size());
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, layer.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            Worker& worker = workers.local();
+            for (uint64_t epochIndex = range.begin(); epochIndex < range.end(); ++epochIndex) {
+                layerSolutions[epochIndex] = worker.analyzer(setCurrentEpoch(layer[epochIndex], worker.context));
+                layerSolutionMaps[epochIndex] = worker.context.productStateToEpochModelInStateMap;
+            }
+        });
+        for (uint64_t epochIndex = 0; epochIndex < layer.size(); ++epochIndex) {
+            setSolutionForEpoch(layer[epochIndex], std::move(layerSolutions[epochIndex]), layerSolutionMaps[epochIndex]);
+            if (!epochSolved(layer[epochIndex])) {
+                return;
+            }
+        }
+    }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    EpochModelAnalyzer analyzer = createAnalyzer();
+    for (auto const& epoch : epochOrder) {
+        setSolutionForCurrentEpoch(analyzer(setCurrentEpoch(epoch)));
+        if (!epochSolved(epoch)) {
+            return;
+        }
+    }
+#endif
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+    return setCurrentEpoch(epoch, defaultContext);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch,
+                                                                                                                             EpochModelContext& context) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+    auto& epochModel = context.epochModel;
+    auto const& epochModelToProductChoiceMap = context.epochModelToProductChoiceMap;
+    auto& currentEpoch = context.currentEpoch;
 
     // Check if we need to update the current epoch class
     if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
+        setCurrentEpochClass(epoch, context);
         epochModel.epochMatrixChanged = true;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
@@ -425,9 +517,9 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     for (auto const& step : possibleEpochSteps) {
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
         if (successorEpoch != epoch) {
-            auto successorSolIt = epochSolutions.find(successorEpoch);
-            STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-            subSolutions.emplace(successorEpoch, &successorSolIt->second);
+            EpochSolution const* successorSolution = epochSolutions.find(successorEpoch);
+            STORM_LOG_ASSERT(successorSolution != nullptr, "Solution for successor epoch does not exist (anymore).");
+            subSolutions.emplace(successorEpoch, successorSolution);
         }
     }
     epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
@@ -511,7 +603,9 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch, EpochModelContext& context) {
+    auto& epochModel = context.epochModel;
+    auto& epochModelToProductChoiceMap = context.epochModelToProductChoiceMap;
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -655,7 +749,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     for (auto productState : productInStates) {
         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
     }
-    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+    context.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
 
     epochModel.objectiveRewardFilter.clear();
     for (auto const& objRewards : epochModel.objectiveRewards) {
@@ -668,7 +762,7 @@ template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    defaultContext.epochModel.equationSolverProblemFormat = eqSysFormat;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -859,41 +953,47 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    STORM_LOG_ASSERT(defaultContext.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == defaultContext.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    setSolutionForEpoch(defaultContext.currentEpoch.get(), std::move(inStateSolutions), defaultContext.productStateToEpochModelInStateMap);
+}
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(
+    Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap) {
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
+    }
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
+    if (plannedEpochs) {
+        // Predecessors that will not be analyzed do not need this solution.
+        for (auto predecessorIt = predecessorEpochs.begin(); predecessorIt != predecessorEpochs.end();) {
+            if (plannedEpochs->count(*predecessorIt) == 0) {
+                predecessorIt = predecessorEpochs.erase(predecessorIt);
+            } else {
+                ++predecessorIt;
+            }
+        }
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
-        auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
-        STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-        --successorEpochSolutionIt->second.count;
-        if (successorEpochSolutionIt->second.count == 0) {
-            epochSolutions.erase(successorEpochSolutionIt);
-        }
+        epochSolutions.release(successorEpoch);
     }
 
     // add the new solution
-    EpochSolution solution;
-    solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
-    solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions.insert(epoch, std::move(inStateSolutions), productStateToSolutionVectorMap, predecessorEpochs.size());
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
-    auto epochSolutionIt = epochSolutions.find(epoch);
-    STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
-    return getStateSolution(epochSolutionIt->second, productState);
+    EpochSolution const* epochSolution = epochSolutions.find(epoch);
+    STORM_LOG_ASSERT(epochSolution != nullptr, "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
+    return getStateSolution(*epochSolution, productState);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -946,11 +1046,24 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getInitialState
     return result;
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::clearEpochSolutions() {
+    epochSolutions.clear();
+    plannedEpochs = boost::none;
+    // Solvers that are kept by the caller for the current epoch model might have been discarded.
+    defaultContext.currentEpoch = boost::none;
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 EpochManager const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochManager() const {
     return epochManager;
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+EpochSolutionStore<ValueType, SingleObjectiveMode> const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutionStore() const {
+    return epochSolutions;
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 Dimension<ValueType> const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getDimension(uint64_t dim) const {
     return dimensions.at(dim);
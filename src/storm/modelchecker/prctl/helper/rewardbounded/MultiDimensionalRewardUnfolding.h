@@ -1,11 +1,13 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/EpochManager.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/EpochModel.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/EpochSolutionStore.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/ProductModel.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/solver/LinearEquationSolverProblemFormat.h"
@@ -28,6 +30,9 @@ class MultiDimensionalRewardUnfolding {
 
     typedef typename std::conditional<SingleObjectiveMode, ValueType, std::vector<ValueType>>::type SolutionType;
 
+    /// Computes the solutions at the in-states of the given epoch model.
+    typedef std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&)> EpochModelAnalyzer;
+
     /*
      *
      * @param model The (preprocessed) model
@@ -62,6 +67,32 @@ class MultiDimensionalRewardUnfolding {
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
+    /*!
+     * Splits the given epoch computation order into layers such that each epoch only depends on epochs of previous layers (or on epochs that have been
+     * computed before). Epochs within the same layer can thus be analyzed independently of each other. The relative order of the epochs is preserved.
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationLayers(std::vector<Epoch> const& epochOrder);
+
+    /*!
+     * Declares that only the given epochs will be analyzed from now on. The solution of an epoch is then dropped as soon as all its predecessor epochs among
+     * the given ones have been analyzed. Without this declaration, a solution is only dropped after all its predecessor epochs have been analyzed, which
+     * might never happen for epochs at the border of the analyzed region. Solutions of epochs without predecessors among the given ones (e.g., the start
+     * epoch) are kept.
+     */
+    void setPlannedEpochs(std::vector<Epoch> const& epochs);
+
+    /*!
+     * Analyzes the given epochs and stores their solutions. Epochs that do not depend on each other are analyzed concurrently, where each worker thread builds
+     * its own epoch models. This requires storm to be built with support for Intel TBB. Otherwise, the epochs are analyzed sequentially.
+     *
+     * @param epochOrder the epochs to analyze in a valid computation order (as obtained by getEpochComputationOrder).
+     * @param createAnalyzer creates the function that analyzes the epoch models of one worker (e.g., with its own solver). Might be invoked concurrently.
+     * @param epochSolved invoked whenever the solution of an epoch has been stored. Invocations are not concurrent. If false is returned, the remaining epochs
+     * are not analyzed.
+     */
+    void computeEpochSolutionsInParallel(std::vector<Epoch> const& epochOrder, std::function<EpochModelAnalyzer()> const& createAnalyzer,
+                                         std::function<bool(Epoch const&)> const& epochSolved);
+
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
@@ -78,14 +109,34 @@ class MultiDimensionalRewardUnfolding {
     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
 
     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+
+    /*!
+     * Drops the solutions of all analyzed epochs (e.g., because they have been computed with insufficient precision) while keeping the product model.
+     * The next epoch model is then built from scratch.
+     */
+    void clearEpochSolutions();
     SolutionType getInitialStateResult(Epoch const& epoch);  // Assumes that the initial state is unique
     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
 
     EpochManager const& getEpochManager() const;
+    EpochSolutionStore<ValueType, SingleObjectiveMode> const& getEpochSolutionStore() const;
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    /*!
+     * The data that changes when setting a new epoch. Each worker of a parallel epoch computation has its own instance.
+     */
+    struct EpochModelContext {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+        boost::optional<Epoch> currentEpoch;
+    };
+
+    EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch, EpochModelContext& context);
+    void setCurrentEpochClass(Epoch const& epoch, EpochModelContext& context);
+    void setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions,
+                             std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -115,12 +166,8 @@ class MultiDimensionalRewardUnfolding {
     std::string solutionToString(SolutionType const& solution) const;
 
     SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
-    struct EpochSolution {
-        uint64_t count;
-        std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
-        std::vector<SolutionType> solutions;
-    };
-    std::map<Epoch, EpochSolution> epochSolutions;
+    typedef typename EpochSolutionStore<ValueType, SingleObjectiveMode>::EpochSolution EpochSolution;
+    EpochSolutionStore<ValueType, SingleObjectiveMode> epochSolutions;
     EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
     SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
 
@@ -129,12 +176,12 @@ class MultiDimensionalRewardUnfolding {
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
+    // If set, only these epochs are considered as predecessors when deciding whether a solution can be dropped.
+    boost::optional<std::set<Epoch>> plannedEpochs;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-    boost::optional<Epoch> currentEpoch;
+    // The context used when epochs are set from outside.
+    EpochModelContext defaultContext;
 
     EpochManager epochManager;
 
@@ -40,6 +40,13 @@ ProductModel<ValueType>::ProductModel(storm::models::sparse::Model<ValueType> co
     std::vector<MemoryState> memoryStateMap = computeMemoryStateMap(memory);
 
     storm::storage::SparseModelMemoryProduct<ValueType> productBuilder(memory.product(model));
+    std::set<std::string> referencedRewardModels;
+    for (auto const& objective : objectives) {
+        objective.formula->gatherReferencedRewardModels(referencedRewardModels);
+    }
+    if (referencedRewardModels.count("") == 0) {
+        productBuilder.setRewardModelsToBuild(referencedRewardModels);
+    }
 
     setReachableProductStates(productBuilder, originalModelSteps, memoryStateMap);
     product = productBuilder.build();
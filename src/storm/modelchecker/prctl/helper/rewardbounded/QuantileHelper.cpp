@@ -317,9 +317,9 @@ std::pair<CostLimitClosure, std::vector<typename QuantileHelper<ModelType>::Valu
 
     // Loop until the goal precision is reached.
     STORM_LOG_DEBUG("Computing quantile for dimensions: " << consideredDimensions);
+    // The reward unfolding (and thus the product model) is built only once. Epoch solutions are kept across all candidate cost limits.
+    MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, boundedUntilOp, infinityVariables);
     while (true) {
-        // initialize reward unfolding and data that will be needed for each epoch
-        MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, boundedUntilOp, infinityVariables);
         if (computeQuantile(env, consideredDimensions, *boundedUntilOp, lowerBoundedDimensions, satCostLimits, unsatCostLimits, rewardUnfolding)) {
             std::vector<ValueType> scalingFactors;
             for (auto dim : consideredDimensions) {
@@ -332,6 +332,8 @@ std::pair<CostLimitClosure, std::vector<typename QuantileHelper<ModelType>::Valu
         STORM_LOG_WARN("Restarting quantile computation after " << swExploration << " seconds due to insufficient precision.");
         ++numPrecisionRefinements;
         increasePrecision(env);
+        // Solutions computed with the previous precision can not be reused.
+        rewardUnfolding.clearEpochSolutions();
     }
 }
 
@@ -431,19 +433,13 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                     ++costLimitIt;
                 }
                 STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
+                // Epochs solved for previous candidates are not analyzed again.
                 auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
-                    ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swEpochAnalysis.stop();
 
+                // Classifies the cost limits corresponding to a solved epoch. Returns false if the precision is insufficient.
+                bool sufficientPrecision = true;
+                auto processSolvedEpoch = [&](EpochManager::Epoch const& epoch) {
+                    ++numCheckedEpochs;
                     CostLimits epochAsCostLimits;
                     if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
                                                    epochAsCostLimits)) {
@@ -456,7 +452,7 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
                             if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
                                 // unclear result due to insufficient precision.
-                                swExploration.stop();
+                                sufficientPrecision = false;
                                 return false;
                             }
                         } else {
@@ -468,6 +464,49 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                             unsatCostLimits.insert(epochAsCostLimits);
                         }
                     }
+                    return true;
+                };
+
+                swEpochAnalysis.start();
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                    // Analyze independent epochs concurrently, where each worker uses its own solver and auxiliary vectors.
+                    rewardUnfolding.computeEpochSolutionsInParallel(
+                        epochSequence,
+                        [&]() -> typename MultiDimensionalRewardUnfolding<ValueType, true>::EpochModelAnalyzer {
+                            if (model.isNondeterministicModel()) {
+                                auto workerSolver = std::make_shared<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>>();
+                                return [&, workerSolver, workerX = std::vector<ValueType>(), workerB = std::vector<ValueType>()](
+                                           EpochModel<ValueType, true>& epochModel) mutable {
+                                    return epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), workerX, workerB, *workerSolver,
+                                                                             lowerBound, upperBound);
+                                };
+                            } else {
+                                auto workerSolver = std::make_shared<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>>();
+                                return [&, workerSolver, workerX = std::vector<ValueType>(), workerB = std::vector<ValueType>()](
+                                           EpochModel<ValueType, true>& epochModel) mutable {
+                                    return epochModel.analyzeSingleObjective(env, workerX, workerB, *workerSolver, lowerBound, upperBound);
+                                };
+                            }
+                        },
+                        processSolvedEpoch);
+                } else {
+                    for (auto const& epoch : epochSequence) {
+                        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                        if (model.isNondeterministicModel()) {
+                            rewardUnfolding.setSolutionForCurrentEpoch(
+                                epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
+                        } else {
+                            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
+                        }
+                        if (!processSolvedEpoch(epoch)) {
+                            break;
+                        }
+                    }
+                }
+                swEpochAnalysis.stop();
+                if (!sufficientPrecision) {
+                    swExploration.stop();
+                    return false;
                 }
             }
         } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
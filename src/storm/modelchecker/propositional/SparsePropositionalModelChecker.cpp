@@ -10,6 +10,8 @@
 #include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/modelchecker/propositional/StateFormulaCache.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm/logic/FragmentSpecification.h"
@@ -30,6 +32,29 @@ bool SparsePropositionalModelChecker<SparseModelType>::canHandle(CheckTask<storm
     return formula.isInFragment(storm::logic::propositional());
 }
 
+template<typename SparseModelType>
+std::unique_ptr<CheckResult> SparsePropositionalModelChecker<SparseModelType>::checkStateFormula(
+    Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
+    auto const& cache = env.modelchecker().getStateFormulaCache();
+    storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
+    // Labels and literals are cheaper to retrieve than to look up. Results for only the initial states or with schedulers are not reusable.
+    if (!cache || stateFormula.isAtomicLabelFormula() || stateFormula.isBooleanLiteralFormula() || !stateFormula.hasQualitativeResult() ||
+        checkTask.isOnlyInitialStatesRelevantSet() || checkTask.isProduceSchedulersSet()) {
+        return AbstractModelChecker<SparseModelType>::checkStateFormula(env, checkTask);
+    }
+
+    std::string key = stateFormula.toString();
+    if (auto states = cache->find(model, key)) {
+        STORM_LOG_DEBUG("Reusing the result of the state formula '" << key << "'.");
+        return std::make_unique<ExplicitQualitativeCheckResult>(std::move(states.get()));
+    }
+    std::unique_ptr<CheckResult> result = AbstractModelChecker<SparseModelType>::checkStateFormula(env, checkTask);
+    if (result->isExplicitQualitativeCheckResult() && result->isResultForAllStates()) {
+        cache->insert(model, key, result->asExplicitQualitativeCheckResult().getTruthValuesVector());
+    }
+    return result;
+}
+
 template<typename SparseModelType>
 std::unique_ptr<CheckResult> SparsePropositionalModelChecker<SparseModelType>::checkBooleanLiteralFormula(
     Environment const& env, CheckTask<storm::logic::BooleanLiteralFormula, ValueType> const& checkTask) {
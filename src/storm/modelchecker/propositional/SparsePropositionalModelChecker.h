@@ -16,6 +16,12 @@ class SparsePropositionalModelChecker : public AbstractModelChecker<SparseModelT
 
     // The implemented methods of the AbstractModelChecker interface.
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    /*!
+     * Checks the given state formula. If the environment provides a state formula cache, qualitative results for all states are looked up in
+     * and added to the cache, such that sub-formulas shared by several properties are only checked once.
+     */
+    virtual std::unique_ptr<CheckResult> checkStateFormula(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkBooleanLiteralFormula(Environment const& env,
                                                                     CheckTask<storm::logic::BooleanLiteralFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkAtomicLabelFormula(Environment const& env,
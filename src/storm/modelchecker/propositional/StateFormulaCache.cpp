@@ -0,0 +1,32 @@
+#include "storm/modelchecker/propositional/StateFormulaCache.h"
+
+namespace storm {
+namespace modelchecker {
+
+void StateFormulaCache::insert(storm::models::ModelBase const& model, std::string const& formula, storm::storage::BitVector const& states) {
+    std::lock_guard<std::mutex> lock(mutex);
+    results[std::make_pair(&model, formula)] = states;
+}
+
+boost::optional<storm::storage::BitVector> StateFormulaCache::find(storm::models::ModelBase const& model, std::string const& formula) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = results.find(std::make_pair(&model, formula));
+    if (it == results.end()) {
+        return boost::none;
+    }
+    ++numberOfHits;
+    return it->second;
+}
+
+uint64_t StateFormulaCache::getNumberOfResults() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return results.size();
+}
+
+uint64_t StateFormulaCache::getNumberOfHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfHits;
+}
+
+}  // namespace modelchecker
+}  // namespace storm
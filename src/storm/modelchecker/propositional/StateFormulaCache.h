@@ -0,0 +1,61 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace models {
+class ModelBase;
+}
+
+namespace modelchecker {
+
+/*!
+ * Stores the satisfying states of (qualitative) state formulas that were checked on a model, such that other properties containing the same
+ * sub-formula do not need to check it again. The cache is attached to the model checker environment and may be accessed concurrently. As an
+ * environment can be used for several models, the results are stored per model.
+ */
+class StateFormulaCache {
+   public:
+    StateFormulaCache() = default;
+
+    /*!
+     * Stores the satisfying states of the given state formula. An existing result for the same formula is replaced.
+     *
+     * @param model The model on which the formula was checked.
+     * @param formula The formula (as string).
+     * @param states The states of the model satisfying the formula.
+     */
+    void insert(storm::models::ModelBase const& model, std::string const& formula, storm::storage::BitVector const& states);
+
+    /*!
+     * Retrieves the satisfying states of the given state formula.
+     *
+     * @return The satisfying states or none if the formula has not been stored for the given model.
+     */
+    boost::optional<storm::storage::BitVector> find(storm::models::ModelBase const& model, std::string const& formula) const;
+
+    /*!
+     * Retrieves the number of stored results.
+     */
+    uint64_t getNumberOfResults() const;
+
+    /*!
+     * Retrieves the number of successful lookups.
+     */
+    uint64_t getNumberOfHits() const;
+
+   private:
+    std::map<std::pair<storm::models::ModelBase const*, std::string>, storm::storage::BitVector> results;
+    mutable uint64_t numberOfHits = 0;
+    mutable std::mutex mutex;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <type_traits>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -21,6 +22,8 @@
 #include "storm/solver/stateelimination/ConditionalStateEliminator.h"
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 #include "storm/solver/stateelimination/MultiValueStateEliminator.h"
+#include "storm/solver/stateelimination/OperationCache.h"
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 #include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
 
@@ -40,6 +43,24 @@ namespace modelchecker {
 
 using namespace storm::utility::stateelimination;
 
+namespace {
+template<typename ValueType>
+void setArithmeticOptions(storm::solver::stateelimination::StateEliminator<ValueType>& stateEliminator, bool parallelElimination) {
+    auto const& eliminationSettings = storm::settings::getModule<storm::settings::modules::EliminationSettings>();
+    if (eliminationSettings.isOperationCacheSet()) {
+        // Caching floating point operations does not pay off. Moreover, the cache must not be accessed concurrently, so it can only be used if the
+        // states are eliminated sequentially (which is always the case for rational functions).
+        if (std::is_same<ValueType, double>::value || (parallelElimination && !std::is_same<ValueType, storm::RationalFunction>::value)) {
+            STORM_LOG_INFO("The operation cache is only used for the sequential elimination of exact values.");
+        } else {
+            stateEliminator.setOperationCache(
+                std::make_shared<storm::solver::stateelimination::OperationCache<ValueType>>(eliminationSettings.getOperationCacheSize()));
+        }
+    }
+    stateEliminator.setDelayCancellation(eliminationSettings.isDelayCancellationSet());
+}
+}  // namespace
+
 template<typename SparseDtmcModelType>
 SparseDtmcEliminationModelChecker<SparseDtmcModelType>::SparseDtmcEliminationModelChecker(storm::models::sparse::Dtmc<ValueType> const& model)
     : SparsePropositionalModelChecker<SparseDtmcModelType>(model) {
@@ -81,7 +102,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     STORM_LOG_THROW(checkTask.isOnlyInitialStatesRelevantSet(), storm::exceptions::IllegalArgumentException,
                     "Cannot compute long-run probabilities for all states.");
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
     storm::storage::BitVector maybeStates =
         storm::utility::graph::performProbGreater0(backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), psiStates);
 
@@ -152,7 +173,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
         ++index;
     }
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
 
     storm::storage::BitVector allStates(numberOfStates, true);
     maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, maybeStates);
@@ -671,7 +692,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
                     "Cannot compute conditional probabilities for all states.");
     storm::storage::sparse::state_type initialState = *this->getModel().getInitialStates().begin();
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = this->getModel().getBackwardTransitions();
 
     // Compute the 'true' psi states, i.e. those psi states that can be reached without passing through another psi state first.
     psiStates = storm::utility::graph::getReachableStates(this->getModel().getTransitionMatrix(), this->getModel().getInitialStates(), trueStates, psiStates) &
@@ -876,7 +897,18 @@ void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedS
     std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
     storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates,
     bool computeResultsForInitialStatesOnly) {
+    if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isParallelEliminationSet()) {
+        storm::solver::stateelimination::ParallelStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+        setArithmeticOptions(stateEliminator, true);
+        stateEliminator.eliminateAll(computeResultsForInitialStatesOnly ? initialStates : storm::storage::BitVector(values.size(), true));
+#ifdef STORM_DEV
+        STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+#endif
+        return;
+    }
+
     storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+    setArithmeticOptions(stateEliminator, false);
 
     while (priorityQueue->hasNext()) {
         storm::storage::sparse::state_type state = priorityQueue->pop();
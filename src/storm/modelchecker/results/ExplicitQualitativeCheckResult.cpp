@@ -1,6 +1,7 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/io/JsonArrayStreamWriter.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -239,9 +240,9 @@ void ExplicitQualitativeCheckResult::filter(QualitativeCheckResult const& filter
 }
 
 template<typename JsonRationalType>
-void insertJsonEntry(storm::json<JsonRationalType>& json, uint64_t const& id, bool value,
-                     std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
-                     std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) {
+storm::json<JsonRationalType> createJsonEntry(uint64_t const& id, bool value,
+                                              std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
+                                              std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) {
     storm::json<JsonRationalType> entry;
     if (stateValuations) {
         entry["s"] = stateValuations->template toJson<JsonRationalType>(id);
@@ -253,7 +254,7 @@ void insertJsonEntry(storm::json<JsonRationalType>& json, uint64_t const& id, bo
         auto labs = stateLabels->getLabelsOfState(id);
         entry["l"] = labs;
     }
-    json.push_back(std::move(entry));
+    return entry;
 }
 
 template<typename JsonRationalType>
@@ -263,21 +264,44 @@ storm::json<JsonRationalType> ExplicitQualitativeCheckResult::toJson(std::option
     if (this->isResultForAllStates()) {
         vector_type const& valuesAsVector = boost::get<vector_type>(truthValues);
         for (uint64_t state = 0; state < valuesAsVector.size(); ++state) {
-            insertJsonEntry(result, state, valuesAsVector.get(state), stateValuations, stateLabels);
+            result.push_back(createJsonEntry<JsonRationalType>(state, valuesAsVector.get(state), stateValuations, stateLabels));
         }
     } else {
         map_type const& valuesAsMap = boost::get<map_type>(truthValues);
         for (auto const& stateValue : valuesAsMap) {
-            insertJsonEntry(result, stateValue.first, stateValue.second, stateValuations, stateLabels);
+            result.push_back(createJsonEntry<JsonRationalType>(stateValue.first, stateValue.second, stateValuations, stateLabels));
         }
     }
     return result;
 }
 
+template<typename JsonRationalType>
+void ExplicitQualitativeCheckResult::writeJsonToStream(std::ostream& out, std::optional<storm::storage::sparse::StateValuations> const& stateValuations,
+                                                       std::optional<storm::models::sparse::StateLabeling> const& stateLabels) const {
+    storm::exporter::JsonArrayStreamWriter<storm::json<JsonRationalType>> writer(out);
+    if (this->isResultForAllStates()) {
+        vector_type const& valuesAsVector = boost::get<vector_type>(truthValues);
+        for (uint64_t state = 0; state < valuesAsVector.size(); ++state) {
+            writer.add(createJsonEntry<JsonRationalType>(state, valuesAsVector.get(state), stateValuations, stateLabels));
+        }
+    } else {
+        map_type const& valuesAsMap = boost::get<map_type>(truthValues);
+        for (auto const& stateValue : valuesAsMap) {
+            writer.add(createJsonEntry<JsonRationalType>(stateValue.first, stateValue.second, stateValuations, stateLabels));
+        }
+    }
+    writer.finish();
+}
+
 template storm::json<double> ExplicitQualitativeCheckResult::toJson<double>(std::optional<storm::storage::sparse::StateValuations> const&,
                                                                             std::optional<storm::models::sparse::StateLabeling> const&) const;
 template storm::json<storm::RationalNumber> ExplicitQualitativeCheckResult::toJson<storm::RationalNumber>(
     std::optional<storm::storage::sparse::StateValuations> const&, std::optional<storm::models::sparse::StateLabeling> const&) const;
+template void ExplicitQualitativeCheckResult::writeJsonToStream<double>(std::ostream&, std::optional<storm::storage::sparse::StateValuations> const&,
+                                                                        std::optional<storm::models::sparse::StateLabeling> const&) const;
+template void ExplicitQualitativeCheckResult::writeJsonToStream<storm::RationalNumber>(std::ostream&,
+                                                                                       std::optional<storm::storage::sparse::StateValuations> const&,
+                                                                                       std::optional<storm::models::sparse::StateLabeling> const&) const;
 
 }  // namespace modelchecker
 }  // namespace storm
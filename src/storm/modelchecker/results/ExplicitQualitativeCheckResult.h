@@ -69,6 +69,13 @@ class ExplicitQualitativeCheckResult : public QualitativeCheckResult {
     storm::json<JsonRationalType> toJson(std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
                                          std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
 
+    /*!
+     * Writes the same json array as toJson to the given stream. The entries are written one at a time, so the array is never built in memory.
+     */
+    template<typename JsonRationalType = storm::RationalNumber>
+    void writeJsonToStream(std::ostream& out, std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
+                           std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
+
    private:
     static void performLogicalOperation(ExplicitQualitativeCheckResult& first, QualitativeCheckResult const& second, bool logicalAnd);
 
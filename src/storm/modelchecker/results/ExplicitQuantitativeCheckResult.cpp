@@ -4,6 +4,7 @@
 #include "storm/exceptions/InvalidAccessException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/JsonArrayStreamWriter.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
@@ -455,9 +456,9 @@ void ExplicitQuantitativeCheckResult<ValueType>::oneMinus() {
 }
 
 template<typename ValueType>
-void insertJsonEntry(storm::json<ValueType>& json, uint64_t const& id, ValueType const& value,
-                     std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
-                     std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) {
+storm::json<ValueType> createJsonEntry(uint64_t const& id, ValueType const& value,
+                                       std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
+                                       std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) {
     typename storm::json<ValueType> entry;
     if (stateValuations) {
         entry["s"] = stateValuations->template toJson<ValueType>(id);
@@ -469,7 +470,7 @@ void insertJsonEntry(storm::json<ValueType>& json, uint64_t const& id, ValueType
         auto labs = stateLabels->getLabelsOfState(id);
         entry["l"] = labs;
     }
-    json.push_back(std::move(entry));
+    return entry;
 }
 
 template<typename ValueType>
@@ -479,12 +480,12 @@ storm::json<ValueType> ExplicitQuantitativeCheckResult<ValueType>::toJson(std::o
     if (this->isResultForAllStates()) {
         vector_type const& valuesAsVector = boost::get<vector_type>(values);
         for (uint64_t state = 0; state < valuesAsVector.size(); ++state) {
-            insertJsonEntry(result, state, valuesAsVector[state], stateValuations, stateLabels);
+            result.push_back(createJsonEntry(state, valuesAsVector[state], stateValuations, stateLabels));
         }
     } else {
         map_type const& valuesAsMap = boost::get<map_type>(values);
         for (auto const& stateValue : valuesAsMap) {
-            insertJsonEntry(result, stateValue.first, stateValue.second, stateValuations, stateLabels);
+            result.push_back(createJsonEntry(stateValue.first, stateValue.second, stateValuations, stateLabels));
         }
     }
     return result;
@@ -496,6 +497,31 @@ storm::json<storm::RationalFunction> ExplicitQuantitativeCheckResult<storm::Rati
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of Check results is not supported for Rational Functions.");
 }
 
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::writeJsonToStream(std::ostream& out,
+                                                                   std::optional<storm::storage::sparse::StateValuations> const& stateValuations,
+                                                                   std::optional<storm::models::sparse::StateLabeling> const& stateLabels) const {
+    storm::exporter::JsonArrayStreamWriter<storm::json<ValueType>> writer(out);
+    if (this->isResultForAllStates()) {
+        vector_type const& valuesAsVector = boost::get<vector_type>(values);
+        for (uint64_t state = 0; state < valuesAsVector.size(); ++state) {
+            writer.add(createJsonEntry(state, valuesAsVector[state], stateValuations, stateLabels));
+        }
+    } else {
+        map_type const& valuesAsMap = boost::get<map_type>(values);
+        for (auto const& stateValue : valuesAsMap) {
+            writer.add(createJsonEntry(stateValue.first, stateValue.second, stateValuations, stateLabels));
+        }
+    }
+    writer.finish();
+}
+
+template<>
+void ExplicitQuantitativeCheckResult<storm::RationalFunction>::writeJsonToStream(std::ostream&, std::optional<storm::storage::sparse::StateValuations> const&,
+                                                                                 std::optional<storm::models::sparse::StateLabeling> const&) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of Check results is not supported for Rational Functions.");
+}
+
 template class ExplicitQuantitativeCheckResult<double>;
 
 #ifdef STORM_HAVE_CARL
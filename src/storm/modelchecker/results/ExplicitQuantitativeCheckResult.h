@@ -84,6 +84,12 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
     storm::json<ValueType> toJson(std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
                                   std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
 
+    /*!
+     * Writes the same json array as toJson to the given stream. The entries are written one at a time, so the array is never built in memory.
+     */
+    void writeJsonToStream(std::ostream& out, std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
+                           std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
+
    private:
     // The values of the quantitative check result.
     boost::variant<vector_type, map_type> values;
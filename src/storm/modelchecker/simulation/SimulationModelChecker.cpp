@@ -0,0 +1,329 @@
+#include "storm/modelchecker/simulation/SimulationModelChecker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+// The number of paths a single simulator samples in each round at most.
+static const uint64_t maximalNumberOfSamplesPerRound = 100;
+
+template<typename ModelType>
+SimulationModelChecker<ModelType>::SimulationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()) {
+    STORM_LOG_THROW(this->program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The simulation engine only supports DTMCs.");
+    auto const& simulationSettings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+    precision = simulationSettings.getPrecision();
+    confidence = simulationSettings.getConfidence();
+    stoppingCriterion = simulationSettings.getStoppingCriterion();
+    numberOfSimulators = simulationSettings.getNumberOfSimulators();
+    seed = simulationSettings.isSeedSet() ? simulationSettings.getSeed() : std::chrono::system_clock::now().time_since_epoch().count();
+    splittingEffort = simulationSettings.getSplittingEffort();
+
+    useIntelTbb = numberOfSimulators > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!useIntelTbb, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    useIntelTbb = false;
+#endif
+}
+
+template<typename ModelType>
+void SimulationModelChecker<ModelType>::setImportanceFunction(storm::expressions::Expression const& importanceFunction) {
+    STORM_LOG_THROW(importanceFunction.hasNumericalType(), storm::exceptions::InvalidArgumentException, "The importance function must be numerical.");
+    this->importanceFunction = importanceFunction.substitute(program.getConstantsFormulasSubstitution());
+}
+
+template<typename ModelType>
+bool SimulationModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+    fragment.setProbabilityOperatorsAllowed(true);
+    fragment.setBoundedUntilFormulasAllowed(true);
+    fragment.setStepBoundedUntilFormulasAllowed(true);
+    fragment.setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setOperatorAtTopLevelRequired(true);
+    fragment.setNestedOperatorsAllowed(false);
+    return checkTask.getFormula().isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+bool SimulationModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SimulationModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    storm::logic::ProbabilityOperatorFormula const& stateFormula = checkTask.getFormula();
+    if (!checkTask.isBoundSet() || importanceFunction.isInitialized()) {
+        // With importance splitting, the estimate is compared against the bound.
+        return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+    }
+    STORM_LOG_THROW(stateFormula.getSubformula().isBoundedUntilFormula(), storm::exceptions::NotSupportedException,
+                    "The simulation engine only supports step-bounded until formulas.");
+    PathFormula pathFormula = getPathFormula(stateFormula.getSubformula().asBoundedUntilFormula());
+
+    // Wald's sequential probability ratio test for the hypotheses p >= threshold + precision and p <= threshold - precision where both the
+    // error of the first and of the second kind are bounded by one minus the confidence.
+    ValueType threshold = checkTask.getBoundThreshold();
+    double lowerProbability = std::max(threshold - precision, std::numeric_limits<double>::epsilon());
+    double upperProbability = std::min(threshold + precision, 1.0 - std::numeric_limits<double>::epsilon());
+    double error = 1.0 - confidence;
+    double acceptLowerHypothesis = std::log((1.0 - error) / error);
+    double acceptUpperHypothesis = std::log(error / (1.0 - error));
+    double successRatio = std::log(lowerProbability / upperProbability);
+    double failureRatio = std::log((1.0 - lowerProbability) / (1.0 - upperProbability));
+
+    bool upperHypothesisAccepted = false;
+    std::pair<uint64_t, uint64_t> samples = samplePaths(pathFormula, [&](uint64_t successes, uint64_t numberOfSamples) -> uint64_t {
+        double logLikelihoodRatio = successes * successRatio + (numberOfSamples - successes) * failureRatio;
+        if (logLikelihoodRatio >= acceptLowerHypothesis) {
+            return 0;
+        } else if (logLikelihoodRatio <= acceptUpperHypothesis) {
+            upperHypothesisAccepted = true;
+            return 0;
+        }
+        return numberOfSimulators * maximalNumberOfSamplesPerRound;
+    });
+    STORM_LOG_INFO("Sequential probability ratio test decided after " << samples.second << " paths (" << samples.first << " satisfying).");
+
+    bool result = storm::logic::isLowerBound(checkTask.getBoundComparisonType()) ? upperHypothesisAccepted : !upperHypothesisAccepted;
+    return std::make_unique<ExplicitQualitativeCheckResult>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SimulationModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    PathFormula pathFormula = getPathFormula(checkTask.getFormula());
+    if (importanceFunction.isInitialized()) {
+        return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, estimateBySplitting(pathFormula));
+    }
+
+    // The Chernoff-Hoeffding bound yields a number of paths that suffices for every probability.
+    double error = 1.0 - confidence;
+    uint64_t chernoffBound = static_cast<uint64_t>(std::ceil(std::log(2.0 / error) / (2.0 * precision * precision)));
+    std::function<uint64_t(uint64_t, uint64_t)> getNumberOfRemainingSamples;
+    if (stoppingCriterion == storm::settings::modules::SimulationSettings::StoppingCriterion::Chernoff) {
+        getNumberOfRemainingSamples = [&](uint64_t, uint64_t numberOfSamples) { return chernoffBound - numberOfSamples; };
+    } else {
+        // Stop as soon as the Agresti-Coull adjusted Wald interval is small enough. The adjustment prevents stopping early for estimates close to
+        // zero or one. We never sample more paths than required by the Chernoff-Hoeffding bound.
+        double quantile = boost::math::quantile(boost::math::normal(), 1.0 - error / 2.0);
+        double squaredQuantile = quantile * quantile;
+        getNumberOfRemainingSamples = [&, squaredQuantile](uint64_t successes, uint64_t numberOfSamples) -> uint64_t {
+            if (numberOfSamples > 0) {
+                double adjustedNumberOfSamples = numberOfSamples + squaredQuantile;
+                double adjustedEstimate = (successes + squaredQuantile / 2.0) / adjustedNumberOfSamples;
+                if (quantile * std::sqrt(adjustedEstimate * (1.0 - adjustedEstimate) / adjustedNumberOfSamples) <= precision) {
+                    return 0;
+                }
+            }
+            return std::min(chernoffBound - numberOfSamples, numberOfSimulators * maximalNumberOfSamplesPerRound);
+        };
+    }
+
+    std::pair<uint64_t, uint64_t> samples = samplePaths(pathFormula, getNumberOfRemainingSamples);
+    STORM_LOG_INFO("Estimated probability from " << samples.second << " paths (" << samples.first << " satisfying).");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, static_cast<ValueType>(samples.first) / samples.second);
+}
+
+template<typename ModelType>
+typename SimulationModelChecker<ModelType>::PathFormula SimulationModelChecker<ModelType>::getPathFormula(
+    storm::logic::BoundedUntilFormula const& formula) const {
+    STORM_LOG_THROW(!formula.isMultiDimensional() && !formula.getTimeBoundReference().isRewardBound(), storm::exceptions::NotSupportedException,
+                    "The simulation engine only supports (one-dimensional) step bounds.");
+    STORM_LOG_THROW(formula.hasUpperBound() && formula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException,
+                    "Formula needs to have a discrete upper step bound.");
+    STORM_LOG_THROW(!formula.hasLowerBound() || formula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException,
+                    "Formula lower step bound must be discrete/integral.");
+
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+    PathFormula result;
+    result.condition = formula.getLeftSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+    result.target = formula.getRightSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+    result.lowerBound = formula.hasLowerBound() ? formula.template getNonStrictLowerBound<uint64_t>() : 0;
+    result.upperBound = formula.template getNonStrictUpperBound<uint64_t>();
+    return result;
+}
+
+template<typename ModelType>
+std::vector<std::unique_ptr<typename SimulationModelChecker<ModelType>::Simulator>> SimulationModelChecker<ModelType>::createSimulators() const {
+    // Derive independent seeds for all simulators from the given seed.
+    std::seed_seq seedSequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    std::vector<uint32_t> seeds(2 * numberOfSimulators);
+    seedSequence.generate(seeds.begin(), seeds.end());
+
+    // The simulators keep pointers to themselves, so they are not stored in the vector directly.
+    storm::generator::NextStateGeneratorOptions options;
+    std::vector<std::unique_ptr<Simulator>> simulators;
+    for (uint64_t simulatorIndex = 0; simulatorIndex < numberOfSimulators; ++simulatorIndex) {
+        simulators.push_back(std::make_unique<Simulator>(program, options));
+        simulators.back()->setSeed((static_cast<uint64_t>(seeds[2 * simulatorIndex]) << 32) | seeds[2 * simulatorIndex + 1]);
+    }
+    return simulators;
+}
+
+template<typename ModelType>
+void SimulationModelChecker<ModelType>::runSimulators(std::function<void(uint64_t)> const& runSimulator) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (useIntelTbb) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfSimulators), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t simulatorIndex = range.begin(); simulatorIndex != range.end(); ++simulatorIndex) {
+                runSimulator(simulatorIndex);
+            }
+        });
+        return;
+    }
+#endif
+    for (uint64_t simulatorIndex = 0; simulatorIndex < numberOfSimulators; ++simulatorIndex) {
+        runSimulator(simulatorIndex);
+    }
+}
+
+template<typename ModelType>
+std::pair<uint64_t, uint64_t> SimulationModelChecker<ModelType>::samplePaths(
+    PathFormula const& pathFormula, std::function<uint64_t(uint64_t, uint64_t)> const& getNumberOfRemainingSamples) const {
+    std::vector<std::unique_ptr<Simulator>> simulators = createSimulators();
+    uint64_t successes = 0;
+    uint64_t numberOfSamples = 0;
+    std::vector<uint64_t> samplesInRound(numberOfSimulators);
+    std::vector<uint64_t> successesInRound(numberOfSimulators);
+    for (uint64_t remainingSamples = getNumberOfRemainingSamples(successes, numberOfSamples); remainingSamples > 0;
+         remainingSamples = getNumberOfRemainingSamples(successes, numberOfSamples)) {
+        // Distribute the samples of this round evenly among the simulators.
+        uint64_t samplesOfRound = std::min(remainingSamples, numberOfSimulators * maximalNumberOfSamplesPerRound);
+        for (uint64_t simulatorIndex = 0; simulatorIndex < numberOfSimulators; ++simulatorIndex) {
+            samplesInRound[simulatorIndex] = samplesOfRound / numberOfSimulators + (simulatorIndex < samplesOfRound % numberOfSimulators ? 1 : 0);
+            successesInRound[simulatorIndex] = 0;
+        }
+
+        runSimulators([&](uint64_t simulatorIndex) {
+            for (uint64_t sample = 0; sample < samplesInRound[simulatorIndex]; ++sample) {
+                if (samplePath(*simulators[simulatorIndex], pathFormula)) {
+                    ++successesInRound[simulatorIndex];
+                }
+            }
+        });
+
+        for (uint64_t simulatorIndex = 0; simulatorIndex < numberOfSimulators; ++simulatorIndex) {
+            successes += successesInRound[simulatorIndex];
+        }
+        numberOfSamples += samplesOfRound;
+    }
+    return std::make_pair(successes, numberOfSamples);
+}
+
+template<typename ModelType>
+bool SimulationModelChecker<ModelType>::samplePath(Simulator& simulator, PathFormula const& pathFormula) const {
+    simulator.resetToInitial();
+    for (uint64_t step = 0;; ++step) {
+        bool targetSatisfied = simulator.evaluateBooleanExpressionInCurrentState(pathFormula.target);
+        if (targetSatisfied && step >= pathFormula.lowerBound) {
+            return true;
+        }
+        if (step >= pathFormula.upperBound || !simulator.evaluateBooleanExpressionInCurrentState(pathFormula.condition)) {
+            return false;
+        }
+        if (simulator.isSinkState()) {
+            // The path stays in the current state forever, so it satisfies the formula iff the target holds in this state.
+            return targetSatisfied;
+        }
+        simulator.step(0);
+    }
+}
+
+template<typename ModelType>
+typename SimulationModelChecker<ModelType>::ValueType SimulationModelChecker<ModelType>::estimateBySplitting(PathFormula const& pathFormula) const {
+    STORM_LOG_THROW(pathFormula.lowerBound == 0, storm::exceptions::NotSupportedException, "Importance splitting does not support lower step bounds.");
+    std::vector<std::unique_ptr<Simulator>> simulators = createSimulators();
+
+    simulators.front()->resetToInitial();
+    int64_t level = getLevel(*simulators.front());
+    std::vector<SplittingEntry> entries = {SplittingEntry{simulators.front()->getCurrentState(), 0,
+                                                          simulators.front()->evaluateBooleanExpressionInCurrentState(pathFormula.target)}};
+
+    // Each simulator is responsible for a contiguous range of the paths of a level such that the result does not depend on the scheduling.
+    std::vector<boost::optional<SplittingEntry>> reachedEntries(splittingEffort);
+    ValueType estimate = storm::utility::one<ValueType>();
+    uint64_t numberOfLevels = 0;
+    while (!std::all_of(entries.begin(), entries.end(), [](SplittingEntry const& entry) { return entry.targetSatisfied; })) {
+        ++level;
+        ++numberOfLevels;
+        runSimulators([&](uint64_t simulatorIndex) {
+            uint64_t firstPath = splittingEffort * simulatorIndex / numberOfSimulators;
+            uint64_t lastPath = splittingEffort * (simulatorIndex + 1) / numberOfSimulators;
+            for (uint64_t path = firstPath; path < lastPath; ++path) {
+                reachedEntries[path] = sampleSplittingPath(*simulators[simulatorIndex], pathFormula, entries[path % entries.size()], level);
+            }
+        });
+
+        entries.clear();
+        for (auto& reachedEntry : reachedEntries) {
+            if (reachedEntry) {
+                entries.push_back(std::move(reachedEntry.get()));
+            }
+        }
+        STORM_LOG_TRACE("Level " << level << " of the importance splitting was reached by " << entries.size() << " of " << splittingEffort << " paths.");
+        if (entries.empty()) {
+            STORM_LOG_WARN("No path reached level " << level << " of the importance splitting, so the probability is estimated as zero.");
+            return storm::utility::zero<ValueType>();
+        }
+        estimate *= static_cast<ValueType>(entries.size()) / splittingEffort;
+    }
+    STORM_LOG_INFO("Estimated probability by importance splitting with " << numberOfLevels << " levels and " << splittingEffort << " paths per level.");
+    return estimate;
+}
+
+template<typename ModelType>
+boost::optional<typename SimulationModelChecker<ModelType>::SplittingEntry> SimulationModelChecker<ModelType>::sampleSplittingPath(
+    Simulator& simulator, PathFormula const& pathFormula, SplittingEntry const& start, int64_t level) const {
+    if (start.targetSatisfied) {
+        // Target states are above all levels.
+        return start;
+    }
+    simulator.resetToState(start.state);
+    for (uint64_t step = start.step;; ++step) {
+        bool targetSatisfied = simulator.evaluateBooleanExpressionInCurrentState(pathFormula.target);
+        if (targetSatisfied || getLevel(simulator) >= level) {
+            return SplittingEntry{simulator.getCurrentState(), step, targetSatisfied};
+        }
+        if (step >= pathFormula.upperBound || !simulator.evaluateBooleanExpressionInCurrentState(pathFormula.condition) || simulator.isSinkState()) {
+            return boost::none;
+        }
+        simulator.step(0);
+    }
+}
+
+template<typename ModelType>
+int64_t SimulationModelChecker<ModelType>::getLevel(Simulator const& simulator) const {
+    return static_cast<int64_t>(std::floor(simulator.evaluateRationalExpressionInCurrentState(importanceFunction)));
+}
+
+template class SimulationModelChecker<storm::models::sparse::Dtmc<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
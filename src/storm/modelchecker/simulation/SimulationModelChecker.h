@@ -0,0 +1,169 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/settings/modules/SimulationSettings.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace simulator {
+template<typename ValueType>
+class DiscreteTimePrismProgramSimulator;
+}
+
+namespace modelchecker {
+
+/*!
+ * This model checker estimates the probability of step-bounded until formulas on a discrete-time PRISM program by sampling paths (statistical model
+ * checking). The state space is never built; instead, simulators explore the program on the fly.
+ *
+ * Quantitative queries are answered with an estimate that deviates from the actual probability by at most the precision with (at least) the given
+ * confidence. The number of sampled paths is either given by the Chernoff-Hoeffding bound or determined sequentially by a confidence interval.
+ * Probability operators with a bound are decided by Wald's sequential probability ratio test where the precision determines the indifference region
+ * around the threshold.
+ *
+ * Paths are sampled in rounds by multiple independent simulators, each of which has its own random number generator. All generators are seeded from
+ * a single seed such that the result only depends on the seed and the number of simulators.
+ *
+ * For rare events, an importance function can be given. Then, probabilities are estimated by fixed-effort importance splitting: the integral values of
+ * the importance function define levels and in each level, a fixed number of paths is started from the states in which the paths of the previous level
+ * entered the level. The estimate is the product of the fractions of paths that reach the next level (or the target).
+ */
+template<typename ModelType>
+class SimulationModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * Creates a model checker for the given (discrete-time) program. The precision, confidence and the number of simulators are taken from the
+     * simulation settings.
+     *
+     * @param program The program.
+     */
+    explicit SimulationModelChecker(storm::prism::Program const& program);
+
+    /*!
+     * Sets the importance function that is used to estimate probabilities by importance splitting. Paths are assumed to become more likely to
+     * satisfy the formula the higher the importance of their current state is.
+     *
+     * @param importanceFunction A numerical expression over the program variables.
+     */
+    void setImportanceFunction(storm::expressions::Expression const& importanceFunction);
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+
+   private:
+    typedef storm::simulator::DiscreteTimePrismProgramSimulator<ValueType> Simulator;
+
+    /*!
+     * A step-bounded until formula whose subformulas are translated to expressions over the program variables.
+     */
+    struct PathFormula {
+        storm::expressions::Expression condition;
+        storm::expressions::Expression target;
+        uint64_t lowerBound;
+        uint64_t upperBound;
+    };
+
+    /*!
+     * A state in which a path entered a level of the importance splitting.
+     */
+    struct SplittingEntry {
+        storm::generator::CompressedState state;
+        uint64_t step;
+        bool targetSatisfied;
+    };
+
+    PathFormula getPathFormula(storm::logic::BoundedUntilFormula const& formula) const;
+
+    /*!
+     * Creates the simulators whose random number generators are seeded from the seed of this model checker.
+     */
+    std::vector<std::unique_ptr<Simulator>> createSimulators() const;
+
+    /*!
+     * Calls the given function for the indices of all simulators. If Intel TBB is used, the calls are performed in parallel.
+     */
+    void runSimulators(std::function<void(uint64_t)> const& runSimulator) const;
+
+    /*!
+     * Samples paths until the given function reports that no further samples are required.
+     *
+     * @param pathFormula The formula that is evaluated on each path.
+     * @param getNumberOfRemainingSamples Given the number of satisfying paths and the number of sampled paths so far, this function returns the number
+     * of paths that have to be sampled at least before the function is queried again. If it returns zero, the sampling stops.
+     * @return The number of satisfying paths and the number of sampled paths.
+     */
+    std::pair<uint64_t, uint64_t> samplePaths(PathFormula const& pathFormula,
+                                              std::function<uint64_t(uint64_t, uint64_t)> const& getNumberOfRemainingSamples) const;
+
+    /*!
+     * Samples a single path from the initial state and decides whether it satisfies the formula.
+     */
+    bool samplePath(Simulator& simulator, PathFormula const& pathFormula) const;
+
+    /*!
+     * Estimates the probability of the formula by fixed-effort importance splitting.
+     */
+    ValueType estimateBySplitting(PathFormula const& pathFormula) const;
+
+    /*!
+     * Continues a path from the given entry until it reaches the given level or the target or until it violates the formula.
+     *
+     * @return The state in which the path reached the level or the target, if it did so.
+     */
+    boost::optional<SplittingEntry> sampleSplittingPath(Simulator& simulator, PathFormula const& pathFormula, SplittingEntry const& start,
+                                                        int64_t level) const;
+
+    /*!
+     * Retrieves the level of the importance splitting of the current state of the simulator.
+     */
+    int64_t getLevel(Simulator const& simulator) const;
+
+    // The program that is simulated.
+    storm::prism::Program program;
+
+    // The maximal distance between the estimate and the actual probability.
+    double precision;
+
+    // The probability with which the result has to be correct.
+    double confidence;
+
+    // The criterion that determines the number of sampled paths for quantitative queries.
+    storm::settings::modules::SimulationSettings::StoppingCriterion stoppingCriterion;
+
+    // The number of simulators that sample paths independently.
+    uint64_t numberOfSimulators;
+
+    // Whether the simulators run in parallel.
+    bool useIntelTbb;
+
+    // The seed from which the seeds of the simulators are derived.
+    uint64_t seed;
+
+    // If initialized, the importance function that is used for importance splitting.
+    storm::expressions::Expression importanceFunction;
+
+    // The number of paths that are sampled in every level of the importance splitting.
+    uint64_t splittingEffort;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/models/sparse/ItemLabeling.h"
 
+#include <mutex>
+
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
 
@@ -10,7 +12,18 @@
 namespace storm {
 namespace models {
 namespace sparse {
-ItemLabeling::ItemLabeling(uint_fast64_t itemCount) : itemCount(itemCount), nameToLabelingIndexMap(), labelings() {
+
+namespace detail {
+/*!
+ * Guards the creation of decompressed copies of compressed labelings via const access.
+ */
+std::mutex& getDecompressionMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+}  // namespace detail
+
+ItemLabeling::ItemLabeling(uint_fast64_t itemCount) : itemCount(itemCount), nameToLabelingIndexMap(), labelings(), compressedLabelings() {
     // Intentionally left empty.
 }
 
@@ -45,7 +58,7 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
+        if (getLabeling(labelIndexPair.second) != other.getItems(labelIndexPair.first)) {
             return false;
         }
     }
@@ -55,7 +68,16 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
 ItemLabeling ItemLabeling::getSubLabeling(storm::storage::BitVector const& items) const {
     ItemLabeling result(items.getNumberOfSetBits());
     for (auto const& labelIndexPair : nameToLabelingIndexMap) {
-        result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        auto const& compressedLabeling = compressedLabelings[labelIndexPair.second];
+        if (compressedLabeling) {
+            // Keep compressed labelings compressed instead of decompressing them permanently.
+            result.addLabel(labelIndexPair.first, compressedLabeling->toBitVector() % items);
+            uint64_t resultIndex = result.nameToLabelingIndexMap.at(labelIndexPair.first);
+            result.compressedLabelings[resultIndex] = storm::storage::CompressedBitVector(result.labelings[resultIndex]);
+            result.labelings[resultIndex] = storm::storage::BitVector();
+        } else {
+            result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        }
     }
     return result;
 }
@@ -73,6 +95,8 @@ void ItemLabeling::removeLabel(std::string const& label) {
     // Erase label by 'swap and pop'
     std::iter_swap(labelings.begin() + labelIndex, labelings.end() - 1);
     labelings.pop_back();
+    std::iter_swap(compressedLabelings.begin() + labelIndex, compressedLabelings.end() - 1);
+    compressedLabelings.pop_back();
 
     // Update index of labeling we swapped from the end
     for (auto& it : nameToLabelingIndexMap) {
@@ -116,8 +140,14 @@ std::set<std::string> ItemLabeling::getLabelsOfItem(uint64_t item) const {
 void ItemLabeling::permuteItems(std::vector<uint64_t> const& inversePermutation) {
     STORM_LOG_THROW(inversePermutation.size() == itemCount, storm::exceptions::InvalidArgumentException, "Permutation does not match number of items");
     std::vector<storm::storage::BitVector> newLabelings;
-    for (storm::storage::BitVector const& source : this->labelings) {
-        newLabelings.push_back(source.permute(inversePermutation));
+    for (uint64_t labelIndex = 0; labelIndex < labelings.size(); ++labelIndex) {
+        auto& compressedLabeling = compressedLabelings[labelIndex];
+        if (compressedLabeling) {
+            compressedLabeling = storm::storage::CompressedBitVector(compressedLabeling->toBitVector().permute(inversePermutation));
+            newLabelings.emplace_back();
+        } else {
+            newLabelings.push_back(labelings[labelIndex].permute(inversePermutation));
+        }
     }
 
     this->labelings = newLabelings;
@@ -129,6 +159,7 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector const&
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
     labelings.push_back(labeling);
+    compressedLabelings.emplace_back();
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& labeling) {
@@ -137,6 +168,7 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& label
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
     labelings.emplace_back(std::move(labeling));
+    compressedLabelings.emplace_back();
 }
 
 std::string ItemLabeling::addUniqueLabel(std::string const& prefix, storage::BitVector const& labeling) {
@@ -158,20 +190,24 @@ bool ItemLabeling::containsLabel(std::string const& label) const {
 void ItemLabeling::addLabelToItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "Label '" << label << "' unknown.");
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, true);
+    getMutableLabeling(nameToLabelingIndexMap.at(label)).set(item, true);
 }
 
 void ItemLabeling::removeLabelFromItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
     STORM_LOG_THROW(this->getItemHasLabel(label, item), storm::exceptions::InvalidArgumentException,
                     "Item " << item << " does not have label '" << label << "'.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, false);
+    getMutableLabeling(nameToLabelingIndexMap.at(label)).set(item, false);
 }
 
 bool ItemLabeling::getItemHasLabel(std::string const& label, uint64_t item) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label '" << label << "' is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)].get(item);
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    if (compressedLabelings[labelIndex]) {
+        return compressedLabelings[labelIndex]->get(item);
+    }
+    return this->labelings[labelIndex].get(item);
 }
 
 std::size_t ItemLabeling::getNumberOfLabels() const {
@@ -185,27 +221,82 @@ std::size_t ItemLabeling::getNumberOfItems() const {
 storm::storage::BitVector const& ItemLabeling::getItems(std::string const& label) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)];
+    return getLabeling(nameToLabelingIndexMap.at(label));
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector const& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    this->labelings[labelIndex] = labeling;
+    this->compressedLabelings[labelIndex] = boost::none;
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector&& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    this->labelings[labelIndex] = std::move(labeling);
+    this->compressedLabelings[labelIndex] = boost::none;
+}
+
+void ItemLabeling::compress() {
+    for (uint64_t labelIndex = 0; labelIndex < labelings.size(); ++labelIndex) {
+        if (compressedLabelings[labelIndex]) {
+            // Drop a decompressed copy that might have been created in the meantime.
+            labelings[labelIndex] = storm::storage::BitVector();
+            continue;
+        }
+        storm::storage::CompressedBitVector compressedLabeling(labelings[labelIndex]);
+        if (compressedLabeling.getSizeInBytes() < labelings[labelIndex].getSizeInBytes()) {
+            compressedLabelings[labelIndex] = std::move(compressedLabeling);
+            labelings[labelIndex] = storm::storage::BitVector();
+        }
+    }
+}
+
+std::size_t ItemLabeling::getSizeInBytes() const {
+    std::size_t result = 0;
+    for (uint64_t labelIndex = 0; labelIndex < labelings.size(); ++labelIndex) {
+        result += labelings[labelIndex].getSizeInBytes();
+        if (compressedLabelings[labelIndex]) {
+            result += compressedLabelings[labelIndex]->getSizeInBytes();
+        }
+    }
+    return result;
+}
+
+storm::storage::BitVector const& ItemLabeling::getLabeling(uint64_t labelIndex) const {
+    auto const& compressedLabeling = compressedLabelings[labelIndex];
+    if (compressedLabeling) {
+        std::lock_guard<std::mutex> lock(detail::getDecompressionMutex());
+        if (labelings[labelIndex].size() != itemCount) {
+            labelings[labelIndex] = compressedLabeling->toBitVector();
+        }
+    }
+    return labelings[labelIndex];
+}
+
+storm::storage::BitVector& ItemLabeling::getMutableLabeling(uint64_t labelIndex) {
+    auto& compressedLabeling = compressedLabelings[labelIndex];
+    if (compressedLabeling) {
+        if (labelings[labelIndex].size() != itemCount) {
+            labelings[labelIndex] = compressedLabeling->toBitVector();
+        }
+        compressedLabeling = boost::none;
+    }
+    return labelings[labelIndex];
 }
 
 void ItemLabeling::printLabelingInformationToStream(std::ostream& out) const {
     out << this->getNumberOfLabels() << " labels\n";
     for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        out << "   * " << labelIndexPair.first << " -> " << this->labelings[labelIndexPair.second].getNumberOfSetBits() << " item(s)\n";
+        auto const& compressedLabeling = this->compressedLabelings[labelIndexPair.second];
+        uint64_t numberOfItems =
+            compressedLabeling ? compressedLabeling->getNumberOfSetBits() : this->labelings[labelIndexPair.second].getNumberOfSetBits();
+        out << "   * " << labelIndexPair.first << " -> " << numberOfItems << " item(s)\n";
     }
 }
 
@@ -213,7 +304,9 @@ void ItemLabeling::printCompleteLabelingInformationToStream(std::ostream& out) c
     out << "Labels: \t" << this->getNumberOfLabels() << '\n';
     for (auto label : nameToLabelingIndexMap) {
         out << "Label '" << label.first << "': ";
-        for (auto index : this->labelings[label.second]) {
+        auto const& compressedLabeling = compressedLabelings[label.second];
+        storm::storage::BitVector items = compressedLabeling ? compressedLabeling->toBitVector() : labelings[label.second];
+        for (auto index : items) {
             out << index << " ";
         }
         out << '\n';
@@ -5,7 +5,10 @@
 #include <string>
 #include <unordered_map>
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
 #include "storm/utility/OsDetection.h"
 
 namespace storm {
@@ -139,6 +142,23 @@ class ItemLabeling {
 
     void permuteItems(std::vector<uint64_t> const& inversePermutation);
 
+    /*!
+     * Compresses the labelings of all labels for which the compressed representation needs less memory. This pays off for labels that hold
+     * very few or almost all items. A compressed labeling is transparently decompressed as soon as it is retrieved as a bit vector or
+     * modified, whereas checking whether an item has a label works on the compressed labeling directly. Retrieving a compressed labeling
+     * via const access keeps the compressed representation, such that several threads can retrieve labelings concurrently.
+     * Note that this means that retrieving the items of a label may modify the internal representation, so it is not safe to do this
+     * concurrently.
+     */
+    void compress();
+
+    /*!
+     * Retrieves the number of bytes that the labelings occupy in memory.
+     *
+     * @return The size of the labelings in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
     virtual std::size_t hash() const;
 
     /*!
@@ -228,8 +248,23 @@ class ItemLabeling {
     // A mapping from labels to the index of the corresponding bit vector in the vector.
     std::unordered_map<std::string, uint64_t> nameToLabelingIndexMap;
 
-    // A vector that holds the labeling for all known labels.
-    std::vector<storm::storage::BitVector> labelings;
+    /*!
+     * Retrieves the labeling with the given index as a bit vector. If the labeling is compressed, a decompressed copy is created on the first
+     * request, which may happen concurrently.
+     */
+    storm::storage::BitVector const& getLabeling(uint64_t labelIndex) const;
+
+    /*!
+     * Retrieves the labeling with the given index as a bit vector that may be modified. If the labeling is compressed, it is decompressed.
+     */
+    storm::storage::BitVector& getMutableLabeling(uint64_t labelIndex);
+
+    // A vector that holds the labeling for all known labels. The entries of compressed labelings are empty unless a decompressed copy was
+    // requested via const access.
+    mutable std::vector<storm::storage::BitVector> labelings;
+
+    // For every label, the compressed labeling (if the labeling is currently compressed).
+    std::vector<boost::optional<storm::storage::CompressedBitVector>> compressedLabelings;
 
     /*!
      * Generate a unique, previously unused label from the given prefix string.
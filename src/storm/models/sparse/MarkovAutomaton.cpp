@@ -1,3 +1,4 @@
+#include <mutex>
 #include <queue>
 
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -20,6 +21,16 @@ namespace storm {
 namespace models {
 namespace sparse {
 
+namespace detail {
+/*!
+ * Guards the computation of the cached information whether a Markov automaton contains a Zeno cycle.
+ */
+std::mutex& getZenoCycleMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+}  // namespace detail
+
 template<typename ValueType, typename RewardModelType>
 MarkovAutomaton<ValueType, RewardModelType>::MarkovAutomaton(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                              storm::models::sparse::StateLabeling const& stateLabeling,
@@ -73,6 +84,7 @@ bool MarkovAutomaton<ValueType, RewardModelType>::isClosed() const {
 
 template<typename ValueType, typename RewardModelType>
 bool MarkovAutomaton<ValueType, RewardModelType>::containsZenoCycle() const {
+    std::lock_guard<std::mutex> lock(detail::getZenoCycleMutex());
     if (!this->hasZenoCycle.is_initialized()) {
         this->hasZenoCycle = this->checkContainsZenoCycle();
     }
@@ -1,5 +1,7 @@
 #include "storm/models/sparse/Model.h"
 
+#include <mutex>
+
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/split.hpp>
 
@@ -13,6 +15,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/SparseMatrixOperations.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/rationalfunction.h"
 #include "storm/utility/vector.h"
 
@@ -144,9 +147,80 @@ void Model<ValueType, RewardModelType>::assertValidityOfComponents(
     }
 }
 
+namespace detail {
+/*!
+ * Guards the information cached for the transition matrices (backward transitions and acyclicity), which may be requested by several
+ * threads at the same time.
+ */
+std::mutex& getTransitionMatrixCacheMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+}  // namespace detail
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::validateTransitionMatrixCaches() const {
+    if (transitionMatrixPossiblyModified) {
+        std::size_t hash = transitionMatrix.hash();
+        if (!cachedTransitionMatrixHash || cachedTransitionMatrixHash.value() != hash) {
+            invalidateTransitionMatrixCaches();
+        }
+        cachedTransitionMatrixHash = hash;
+        transitionMatrixPossiblyModified = false;
+    } else if (!cachedTransitionMatrixHash) {
+        cachedTransitionMatrixHash = transitionMatrix.hash();
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::invalidateTransitionMatrixCaches() const {
+    if (backwardTransitions) {
+        outdatedBackwardTransitions.push_back(std::move(backwardTransitions));
+        backwardTransitions.reset();
+    }
+    acyclic.reset();
+    cachedTransitionMatrixHash.reset();
+}
+
+template<typename ValueType, typename RewardModelType>
+storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>::getBackwardTransitions() const {
+    std::lock_guard<std::mutex> lock(detail::getTransitionMatrixCacheMutex());
+    validateTransitionMatrixCaches();
+    if (!backwardTransitions) {
+        backwardTransitions = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(this->getTransitionMatrix().transpose(true));
+    }
+    return *backwardTransitions;
+}
+
 template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
-    return this->getTransitionMatrix().transpose(true);
+bool Model<ValueType, RewardModelType>::isAcyclic() const {
+    std::lock_guard<std::mutex> lock(detail::getTransitionMatrixCacheMutex());
+    validateTransitionMatrixCaches();
+    if (!acyclic) {
+        storm::storage::BitVector nonSinkStates(this->getNumberOfStates(), true);
+        for (uint64_t state = 0; state < this->getNumberOfStates(); ++state) {
+            if (isSinkState(state)) {
+                nonSinkStates.set(state, false);
+            }
+        }
+        acyclic = !storm::utility::graph::hasCycle(this->getTransitionMatrix(), nonSinkStates);
+        STORM_LOG_INFO_COND(!acyclic.value(), "The model is acyclic.");
+    }
+    return acyclic.value();
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::prepareForConcurrentAccess() const {
+    this->getTransitionMatrix().getRowGroupIndices();
+    this->getBackwardTransitions().getRowGroupIndices();
+    for (auto const& label : this->getStateLabeling().getLabels()) {
+        this->getStateLabeling().getStates(label);
+    }
+    if (this->hasChoiceLabeling()) {
+        for (auto const& label : this->getChoiceLabeling().getLabels()) {
+            this->getChoiceLabeling().getChoices(label);
+        }
+    }
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -196,6 +270,7 @@ storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+    transitionMatrixPossiblyModified = true;
     return transitionMatrix;
 }
 
@@ -616,11 +691,17 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    std::lock_guard<std::mutex> lock(detail::getTransitionMatrixCacheMutex());
+    invalidateTransitionMatrixCaches();
+    transitionMatrixPossiblyModified = false;
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    std::lock_guard<std::mutex> lock(detail::getTransitionMatrixCacheMutex());
+    invalidateTransitionMatrixCaches();
+    transitionMatrixPossiblyModified = false;
 }
 
 template<typename ValueType, typename RewardModelType>
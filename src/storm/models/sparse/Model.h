@@ -1,6 +1,7 @@
 #ifndef STORM_MODELS_SPARSE_MODEL_H_
 #define STORM_MODELS_SPARSE_MODEL_H_
 
+#include <memory>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -28,7 +29,8 @@ template<typename ValueType>
 class StandardRewardModel;
 
 /*!
- * Base class for all sparse models.
+ * Base class for all sparse models. All const member functions may be called by several threads concurrently (as long as the model is not
+ * modified at the same time), such that a model can be shared read-only, e.g., to check several properties in parallel.
  */
 template<class CValueType, class CRewardModelType = StandardRewardModel<CValueType>>
 class Model : public storm::models::Model<CValueType> {
@@ -54,10 +56,29 @@ class Model : public storm::models::Model<CValueType> {
     /*!
      * Retrieves the backward transition relation of the model, i.e. a set of transitions between states
      * that correspond to the reversed transition relation of this model.
+     * The backward transitions are computed upon the first call and then cached. They are recomputed if the transition
+     * matrix was set anew or actually modified via non-const access in the meantime (which is detected by a hash of the matrix).
+     * The returned reference stays valid for the lifetime of the model, even if the backward transitions are recomputed later.
+     * This function may be called by several threads concurrently.
      *
      * @return A sparse matrix that represents the backward transitions of this model.
      */
-    storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions() const;
+
+    /*!
+     * Retrieves whether the only cycles of the model are the self-loops of sink states, i.e., of states that can not be left.
+     * On such models, the values of the (non-sink) states can be computed in a single sweep over the states in reverse topological order.
+     * The result is computed upon the first call and then cached just like the backward transitions.
+     * This function may be called by several threads concurrently.
+     */
+    bool isAcyclic() const;
+
+    /*!
+     * Computes everything that const member functions otherwise compute lazily (the backward transitions, trivial row groupings and
+     * decompressed labelings). Although these lazy computations are safe to happen concurrently, this avoids that threads reading the
+     * model concurrently, e.g., to check several properties in parallel, wait for each other.
+     */
+    void prepareForConcurrentAccess() const;
 
     /*!
      * Returns an object representing the matrix rows associated with the given state.
@@ -127,6 +148,8 @@ class Model : public storm::models::Model<CValueType> {
 
     /*!
      * Retrieves the matrix representing the transitions of the model.
+     * As the matrix might be modified via the returned reference, the cached backward transitions and acyclicity are checked against a hash of
+     * the matrix the next time they are requested.
      *
      * @return A matrix representing the transitions of the model.
      */
@@ -435,9 +458,32 @@ class Model : public storm::models::Model<CValueType> {
     // Upon construction of a model, this function asserts that the specified components are valid
     void assertValidityOfComponents(storm::storage::sparse::ModelComponents<ValueType, RewardModelType> const& components) const;
 
+    // Checks whether the transition matrix was modified since the cached information was computed and, if so, invalidates it.
+    // The caller has to hold the cache mutex.
+    void validateTransitionMatrixCaches() const;
+
+    // Invalidates the information cached for the transition matrix. The caller has to hold the cache mutex.
+    void invalidateTransitionMatrixCaches() const;
+
     //  A matrix representing transition relation.
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
 
+    // If set, the (cached) backward transitions, i.e., the transposed transition matrix.
+    // This is shared among copies of the model as they initially have the same transition matrix.
+    mutable std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+
+    // Backward transitions that were replaced. They are kept alive as references to them might still be in use.
+    mutable std::vector<std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>> outdatedBackwardTransitions;
+
+    // If set, the hash of the transition matrix for which the cached information was computed.
+    mutable std::optional<std::size_t> cachedTransitionMatrixHash;
+
+    // Whether the transition matrix might have been modified (via non-const access) since the cached information was computed.
+    mutable bool transitionMatrixPossiblyModified = false;
+
+    // If set, the (cached) result of isAcyclic. This is reset whenever the transition matrix might be modified.
+    mutable std::optional<bool> acyclic;
+
     // The labeling of the states.
     storm::models::sparse::StateLabeling stateLabeling;
 
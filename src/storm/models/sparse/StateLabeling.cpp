@@ -33,7 +33,7 @@ bool StateLabeling::operator==(StateLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getStates(labelIndexPair.first)) {
+        if (getLabeling(labelIndexPair.second) != other.getStates(labelIndexPair.first)) {
             return false;
         }
     }
@@ -0,0 +1,129 @@
+#include "storm/models/sparse/TotalRewardStore.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+template<typename ValueType>
+TotalRewardStore<ValueType>::TotalRewardStore(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                              std::unordered_map<std::string, StandardRewardModel<ValueType>> const& rewardModels,
+                                              std::vector<std::string> const& rewardModelNames)
+    : numberOfRows(transitionMatrix.getRowCount()) {
+    std::vector<StandardRewardModel<ValueType> const*> storedModels;
+    storedModels.reserve(rewardModelNames.size());
+    for (auto const& name : rewardModelNames) {
+        auto rewardModelIt = rewardModels.find(name);
+        STORM_LOG_THROW(rewardModelIt != rewardModels.end(), storm::exceptions::IllegalArgumentException, "The reward model '" << name << "' does not exist.");
+        STORM_LOG_THROW(rewardModelToIndex.emplace(name, storedModels.size()).second, storm::exceptions::IllegalArgumentException,
+                        "The reward model '" << name << "' is given more than once.");
+        storedModels.push_back(&rewardModelIt->second);
+    }
+
+    uint64_t const numberOfModels = storedModels.size();
+    values.assign(numberOfRows * numberOfModels, storm::utility::zero<ValueType>());
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            ValueType* rowValues = values.data() + row * numberOfModels;
+            for (uint64_t index = 0; index < numberOfModels; ++index) {
+                auto const& rewardModel = *storedModels[index];
+                if (rewardModel.hasStateRewards()) {
+                    rowValues[index] += rewardModel.getStateReward(state);
+                }
+                if (rewardModel.hasStateActionRewards()) {
+                    rowValues[index] += rewardModel.getStateActionReward(row);
+                }
+                if (rewardModel.hasTransitionRewards()) {
+                    rowValues[index] += transitionMatrix.template getPointwiseProductRowSum<ValueType, ValueType>(rewardModel.getTransitionRewardMatrix(), row);
+                }
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+uint64_t TotalRewardStore<ValueType>::getNumberOfRows() const {
+    return numberOfRows;
+}
+
+template<typename ValueType>
+uint64_t TotalRewardStore<ValueType>::getNumberOfRewardModels() const {
+    return rewardModelToIndex.size();
+}
+
+template<typename ValueType>
+bool TotalRewardStore<ValueType>::hasRewardModel(std::string const& rewardModelName) const {
+    return rewardModelToIndex.count(rewardModelName) > 0;
+}
+
+template<typename ValueType>
+uint64_t TotalRewardStore<ValueType>::getRewardModelIndex(std::string const& rewardModelName) const {
+    auto indexIt = rewardModelToIndex.find(rewardModelName);
+    STORM_LOG_THROW(indexIt != rewardModelToIndex.end(), storm::exceptions::IllegalArgumentException,
+                    "The reward model '" << rewardModelName << "' is not stored.");
+    return indexIt->second;
+}
+
+template<typename ValueType>
+ValueType const& TotalRewardStore<ValueType>::getTotalReward(uint64_t row, uint64_t rewardModelIndex) const {
+    STORM_LOG_ASSERT(row < numberOfRows && rewardModelIndex < getNumberOfRewardModels(), "Invalid position in the reward store.");
+    return values[row * getNumberOfRewardModels() + rewardModelIndex];
+}
+
+template<typename ValueType>
+std::vector<ValueType> TotalRewardStore<ValueType>::getTotalRewards(uint64_t row) const {
+    STORM_LOG_ASSERT(row < numberOfRows, "Invalid row of the reward store.");
+    auto rowBegin = values.begin() + row * getNumberOfRewardModels();
+    return std::vector<ValueType>(rowBegin, rowBegin + getNumberOfRewardModels());
+}
+
+template<typename ValueType>
+std::vector<ValueType> TotalRewardStore<ValueType>::getTotalRewardVector(uint64_t rewardModelIndex) const {
+    return std::move(getTotalRewardVectors({rewardModelIndex}).front());
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> TotalRewardStore<ValueType>::getTotalRewardVectors(std::vector<uint64_t> const& rewardModelIndices) const {
+    uint64_t const numberOfModels = getNumberOfRewardModels();
+    for (auto index : rewardModelIndices) {
+        STORM_LOG_THROW(index < numberOfModels, storm::exceptions::IllegalArgumentException, "Invalid reward model index " << index << ".");
+    }
+    std::vector<std::vector<ValueType>> result(rewardModelIndices.size(), std::vector<ValueType>(numberOfRows));
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        ValueType const* rowValues = values.data() + row * numberOfModels;
+        for (uint64_t resultIndex = 0; resultIndex < rewardModelIndices.size(); ++resultIndex) {
+            result[resultIndex][row] = rowValues[rewardModelIndices[resultIndex]];
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<ValueType> TotalRewardStore<ValueType>::getWeightedTotalRewardVector(std::vector<ValueType> const& weights) const {
+    uint64_t const numberOfModels = getNumberOfRewardModels();
+    STORM_LOG_THROW(weights.size() == numberOfModels, storm::exceptions::IllegalArgumentException,
+                    "Expected " << numberOfModels << " weights but got " << weights.size() << ".");
+    std::vector<ValueType> result(numberOfRows, storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        ValueType const* rowValues = values.data() + row * numberOfModels;
+        for (uint64_t index = 0; index < numberOfModels; ++index) {
+            if (!storm::utility::isZero(weights[index])) {
+                result[row] += weights[index] * rowValues[index];
+            }
+        }
+    }
+    return result;
+}
+
+template class TotalRewardStore<double>;
+template class TotalRewardStore<storm::RationalNumber>;
+template class TotalRewardStore<storm::RationalFunction>;
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
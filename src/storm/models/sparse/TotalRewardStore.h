@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+/*!
+ * Stores the total rewards (i.e., the sums of state, state-action and transition rewards) of several reward models in a single dense matrix
+ * with one row per choice and one column per reward model. The entries of a row are stored next to each other, such that all rewards of a
+ * choice can be read at once. This avoids computing (and allocating) one total reward vector per reward model and query on models with many
+ * reward models.
+ */
+template<typename ValueType>
+class TotalRewardStore {
+   public:
+    /*!
+     * Computes the total rewards of the given reward models in a single pass over the transition matrix.
+     *
+     * @param transitionMatrix The transition matrix of the model.
+     * @param rewardModels The reward models of the model.
+     * @param rewardModelNames The names of the reward models that are to be stored. The column of a reward model is its position in this vector.
+     */
+    TotalRewardStore(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                     std::unordered_map<std::string, StandardRewardModel<ValueType>> const& rewardModels, std::vector<std::string> const& rewardModelNames);
+
+    uint64_t getNumberOfRows() const;
+    uint64_t getNumberOfRewardModels() const;
+
+    /*!
+     * Retrieves whether the reward model with the given name is stored.
+     */
+    bool hasRewardModel(std::string const& rewardModelName) const;
+
+    /*!
+     * Retrieves the column of the reward model with the given name.
+     */
+    uint64_t getRewardModelIndex(std::string const& rewardModelName) const;
+
+    /*!
+     * Retrieves the total reward of the given row (choice) for the reward model with the given column.
+     */
+    ValueType const& getTotalReward(uint64_t row, uint64_t rewardModelIndex) const;
+
+    /*!
+     * Retrieves the total rewards of the given row for all stored reward models.
+     */
+    std::vector<ValueType> getTotalRewards(uint64_t row) const;
+
+    /*!
+     * Retrieves the total reward vector of the reward model with the given column.
+     */
+    std::vector<ValueType> getTotalRewardVector(uint64_t rewardModelIndex) const;
+
+    /*!
+     * Retrieves the total reward vectors of the reward models with the given columns in a single pass over the store.
+     */
+    std::vector<std::vector<ValueType>> getTotalRewardVectors(std::vector<uint64_t> const& rewardModelIndices) const;
+
+    /*!
+     * Retrieves the vector that assigns to each row the weighted sum of its total rewards, where the i-th weight corresponds to the i-th column.
+     */
+    std::vector<ValueType> getWeightedTotalRewardVector(std::vector<ValueType> const& weights) const;
+
+   private:
+    uint64_t numberOfRows;
+    std::unordered_map<std::string, uint64_t> rewardModelToIndex;
+
+    // The total rewards, where the reward of row r for the reward model in column i is stored at position r * numberOfRewardModels + i.
+    std::vector<ValueType> values;
+};
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -37,6 +37,7 @@
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm/settings/modules/OviSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/SimulationSettings.h"
 #include "storm/settings/modules/Smt2SmtSolverSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 #include "storm/settings/modules/TimeBoundedSolverSettings.h"
@@ -117,6 +118,8 @@ void SettingsManager::handleUnknownOption(std::string const& optionName, bool is
 }
 
 void SettingsManager::setFromExplodedString(std::vector<std::string> const& commandLineArguments) {
+    buildOptionTables();
+
     // In order to assign the parsed arguments to an option, we need to keep track of the "active" option's name.
     bool optionActive = false;
     bool activeOptionIsShortName = false;
@@ -186,6 +189,7 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
 }
 
 void SettingsManager::setFromConfigurationFile(std::string const& configFilename) {
+    buildOptionTables();
     std::map<std::string, std::vector<std::string>> configurationFileSettings = parseConfigFile(configFilename);
 
     for (auto const& optionArgumentsPair : configurationFileSettings) {
@@ -214,6 +218,7 @@ void SettingsManager::setFromConfigurationFile(std::string const& configFilename
 }
 
 void SettingsManager::printHelp(std::string const& filter) const {
+    buildOptionTables();
     STORM_PRINT("usage: " << executableName << " [options]\n\n");
 
     if (filter == "frequent" || filter == "all") {
@@ -352,6 +357,7 @@ std::string SettingsManager::getHelpForSelection(std::vector<std::string> const&
 }
 
 std::string SettingsManager::getHelpForModule(std::string const& moduleName, uint_fast64_t maxLength, bool includeAdvanced) const {
+    buildOptionTables();
     auto moduleIterator = moduleOptions.find(moduleName);
     if (moduleIterator == this->moduleOptions.end()) {
         return "";
@@ -401,31 +407,68 @@ uint_fast64_t SettingsManager::getPrintLengthOfLongestOption(std::string const&
     auto moduleIterator = modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Unable to retrieve option length of unknown module '" << moduleName << "'.");
-    return moduleIterator->second->getPrintLengthOfLongestOption(includeAdvanced);
+    return getOrConstructModule(moduleName, moduleIterator->second).getPrintLengthOfLongestOption(includeAdvanced);
 }
 
 void SettingsManager::addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister) {
-    auto moduleIterator = this->modules.find(moduleSettings->getModuleName());
-    STORM_LOG_THROW(moduleIterator == this->modules.end(), storm::exceptions::IllegalFunctionCallException,
-                    "Unable to register module '" << moduleSettings->getModuleName() << "' because a module with the same name already exists.");
-
     // Take over the module settings object.
     std::string moduleName = moduleSettings->getModuleName();
+    ModuleEntry& entry = addModuleEntry(moduleName, doRegister);
+    std::call_once(entry.constructed, [&]() { entry.settings = std::move(moduleSettings); });
+
+    // If the options of the other modules were already registered, the options of this module need to be registered right away.
+    if (optionTablesBuilt) {
+        addOptionsOfModule(moduleName, entry);
+    }
+}
+
+void SettingsManager::addModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister) {
+    ModuleEntry& entry = addModuleEntry(moduleName, doRegister);
+    entry.factory = factory;
+    if (optionTablesBuilt) {
+        addOptionsOfModule(moduleName, entry);
+    }
+}
+
+SettingsManager::ModuleEntry& SettingsManager::addModuleEntry(std::string const& moduleName, bool doRegister) {
+    STORM_LOG_THROW(this->modules.find(moduleName) == this->modules.end(), storm::exceptions::IllegalFunctionCallException,
+                    "Unable to register module '" << moduleName << "' because a module with the same name already exists.");
     this->moduleNames.push_back(moduleName);
-    this->modules.emplace(moduleSettings->getModuleName(), std::move(moduleSettings));
-    auto iterator = this->modules.find(moduleName);
-    std::unique_ptr<modules::ModuleSettings> const& settings = iterator->second;
+    ModuleEntry& entry = this->modules[moduleName];
+    entry.doRegister = doRegister;
+    return entry;
+}
+
+modules::ModuleSettings& SettingsManager::getOrConstructModule(std::string const& moduleName, ModuleEntry& entry) const {
+    std::call_once(entry.constructed, [&]() {
+        entry.settings = entry.factory();
+        STORM_LOG_THROW(entry.settings->getModuleName() == moduleName, storm::exceptions::IllegalFunctionCallException,
+                        "The settings registered for module '" << moduleName << "' belong to module '" << entry.settings->getModuleName() << "'.");
+    });
+    return *entry.settings;
+}
+
+void SettingsManager::buildOptionTables() const {
+    if (!optionTablesBuilt) {
+        for (auto const& moduleName : this->moduleNames) {
+            addOptionsOfModule(moduleName, this->modules.at(moduleName));
+        }
+        optionTablesBuilt = true;
+    }
+}
 
-    if (doRegister) {
+void SettingsManager::addOptionsOfModule(std::string const& moduleName, ModuleEntry& entry) const {
+    modules::ModuleSettings const& settings = getOrConstructModule(moduleName, entry);
+    if (entry.doRegister) {
         this->moduleOptions.emplace(moduleName, std::vector<std::shared_ptr<Option>>());
         // Now register the options of the module.
-        for (auto const& option : settings->getOptions()) {
+        for (auto const& option : settings.getOptions()) {
             this->addOption(option);
         }
     }
 }
 
-void SettingsManager::addOption(std::shared_ptr<Option> const& option) {
+void SettingsManager::addOption(std::shared_ptr<Option> const& option) const {
     // First, we register to which module the given option belongs.
     auto moduleOptionIterator = this->moduleOptions.find(option->getModuleName());
     STORM_LOG_THROW(moduleOptionIterator != this->moduleOptions.end(), storm::exceptions::IllegalFunctionCallException,
@@ -457,25 +500,23 @@ void SettingsManager::addOption(std::shared_ptr<Option> const& option) {
 }
 
 bool SettingsManager::hasModule(std::string const& moduleName, bool checkHidden) const {
-    if (checkHidden) {
-        return this->moduleOptions.find(moduleName) != this->moduleOptions.end();
-    } else {
-        return this->modules.find(moduleName) != this->modules.end();
-    }
+    // The hidden modules are the ones whose options are not registered.
+    auto moduleIterator = this->modules.find(moduleName);
+    return moduleIterator != this->modules.end() && (!checkHidden || moduleIterator->second.doRegister);
 }
 
 modules::ModuleSettings const& SettingsManager::getModule(std::string const& moduleName) const {
     auto moduleIterator = this->modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Cannot retrieve unknown module '" << moduleName << "'.");
-    return *moduleIterator->second;
+    return getOrConstructModule(moduleName, moduleIterator->second);
 }
 
 modules::ModuleSettings& SettingsManager::getModule(std::string const& moduleName) {
     auto moduleIterator = this->modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Cannot retrieve unknown module '" << moduleName << "'.");
-    return *moduleIterator->second;
+    return getOrConstructModule(moduleName, moduleIterator->second);
 }
 
 bool SettingsManager::isCompatible(std::shared_ptr<Option> const& option, std::string const& optionName,
@@ -545,9 +586,10 @@ void SettingsManager::addOptionToMap(std::string const& name, std::shared_ptr<Op
 }
 
 void SettingsManager::finalizeAllModules() {
-    for (auto const& nameModulePair : this->modules) {
-        nameModulePair.second->finalize();
-        nameModulePair.second->check();
+    for (auto& nameModulePair : this->modules) {
+        modules::ModuleSettings& settings = getOrConstructModule(nameModulePair.first, nameModulePair.second);
+        settings.finalize();
+        settings.check();
     }
 }
 
@@ -675,6 +717,11 @@ storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
     return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
 }
 
+storm::settings::modules::ModelCheckerSettings& mutableModelCheckerSettings() {
+    return dynamic_cast<storm::settings::modules::ModelCheckerSettings&>(
+        mutableManager().getModule(storm::settings::modules::ModelCheckerSettings::moduleName));
+}
+
 void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::mutableManager().setName(name, executableName);
 
@@ -701,6 +748,7 @@ void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::addModule<storm::settings::modules::TopologicalEquationSolverSettings>();
     storm::settings::addModule<storm::settings::modules::Smt2SmtSolverSettings>();
     storm::settings::addModule<storm::settings::modules::ExplorationSettings>();
+    storm::settings::addModule<storm::settings::modules::SimulationSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
     storm::settings::addModule<storm::settings::modules::AbstractionSettings>();
     storm::settings::addModule<storm::settings::modules::MultiObjectiveSettings>();
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -15,6 +17,7 @@ namespace modules {
 class BuildSettings;
 class ModuleSettings;
 class AbstractionSettings;
+class ModelCheckerSettings;
 }  // namespace modules
 class Option;
 
@@ -22,6 +25,10 @@ class Option;
  * Provides the central API for the registration of command line options and parsing the options from the
  * command line. Since this class is a singleton, the only instance is accessible via a call to the manager()
  * function.
+ *
+ * Modules that are registered through a factory are only constructed when they are first retrieved. The tables that map the option names
+ * to the options are only built (which constructs all modules) once options are parsed or help is printed, so that tools that never parse
+ * options only pay for the modules they actually query.
  */
 class SettingsManager {
    public:
@@ -109,6 +116,15 @@ class SettingsManager {
      */
     void addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister = true);
 
+    /*!
+     * Adds a new module with the given name whose settings are only constructed (by the given factory) when they are first needed. If the
+     * module could not be successfully added, an exception is thrown.
+     *
+     * @param moduleName The name of the module, which has to coincide with the name of the constructed settings.
+     * @param factory The function that constructs the settings of the module.
+     */
+    void addModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister = true);
+
     /*!
      * Checks whether the module with the given name exists.
      *
@@ -161,28 +177,59 @@ class SettingsManager {
     std::string name;
     std::string executableName;
 
-    // The registered modules.
+    // A registered module, whose settings are constructed on first use.
+    struct ModuleEntry {
+        std::function<std::unique_ptr<modules::ModuleSettings>()> factory;
+        bool doRegister = true;
+        std::once_flag constructed;
+        std::unique_ptr<modules::ModuleSettings> settings;
+    };
+
+    // The registered modules. The entries of the map are stable, so the modules may be constructed concurrently.
     std::vector<std::string> moduleNames;
-    std::unordered_map<std::string, std::unique_ptr<modules::ModuleSettings>> modules;
+    mutable std::unordered_map<std::string, ModuleEntry> modules;
+
+    // Whether the options of all registered modules were added to the tables below.
+    mutable bool optionTablesBuilt = false;
 
     // Mappings from all known option names to the options that match it. All options for one option name need
     // to be compatible in the sense that calling isCompatible(...) pairwise on all options must always return true.
-    std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> longNameToOptions;
-    std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> shortNameToOptions;
+    mutable std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> longNameToOptions;
+    mutable std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> shortNameToOptions;
 
     // A mapping of module names to the corresponding options.
-    std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> moduleOptions;
+    mutable std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> moduleOptions;
 
     // A list of long option names to keep the order in which they were registered. This is, for example, used
     // to match the regular expression given to the help option against the option names.
-    std::vector<std::string> longOptionNames;
+    mutable std::vector<std::string> longOptionNames;
+
+    /*!
+     * Adds an entry for the module with the given name (without constructing its settings).
+     */
+    ModuleEntry& addModuleEntry(std::string const& moduleName, bool doRegister);
+
+    /*!
+     * Retrieves the settings of the given module and constructs them if necessary.
+     */
+    modules::ModuleSettings& getOrConstructModule(std::string const& moduleName, ModuleEntry& entry) const;
+
+    /*!
+     * Builds the option tables (and thereby constructs all modules) if this was not done yet.
+     */
+    void buildOptionTables() const;
+
+    /*!
+     * Adds the options of the given module to the option tables (if the module is to be registered).
+     */
+    void addOptionsOfModule(std::string const& moduleName, ModuleEntry& entry) const;
 
     /*!
      * Adds the given option to the known options.
      *
      * @param option The option to add.
      */
-    void addOption(std::shared_ptr<Option> const& option);
+    void addOption(std::shared_ptr<Option> const& option) const;
 
     /*!
      * Sets the arguments of the given option from the provided strings.
@@ -271,7 +318,8 @@ SettingsManager& mutableManager();
 template<typename SettingsType>
 void addModule(bool doRegister = true) {
     static_assert(std::is_base_of<storm::settings::modules::ModuleSettings, SettingsType>::value, "Template argument must be derived from ModuleSettings");
-    mutableManager().addModule(std::unique_ptr<modules::ModuleSettings>(new SettingsType()), doRegister);
+    mutableManager().addModule(
+        SettingsType::moduleName, []() { return std::unique_ptr<modules::ModuleSettings>(new SettingsType()); }, doRegister);
 }
 
 /*!
@@ -321,6 +369,14 @@ storm::settings::modules::BuildSettings& mutableBuildSettings();
  */
 storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
 
+/*!
+ * Retrieves the model checker settings in a mutable form. This is only meant to be used for debug purposes or very
+ * rare cases where it is necessary.
+ *
+ * @return An object that allows accessing and modifying the model checker settings.
+ */
+storm::settings::modules::ModelCheckerSettings& mutableModelCheckerSettings();
+
 }  // namespace settings
 }  // namespace storm
 
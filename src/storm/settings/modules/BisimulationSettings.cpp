@@ -22,6 +22,9 @@ const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::restrictQuotientOptionName = "restrict-quot";
+const std::string BisimulationSettings::sparseRefinementMethodOptionName = "sparse-refine";
+const std::string BisimulationSettings::compositionalOptionName = "compositional";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -55,6 +58,11 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, exactArithmeticDdOptionName, false, "Sets whether to use exact arithmetic in dd-based bisimulation.")
             .setIsAdvanced()
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, restrictQuotientOptionName, false,
+                                                   "Sets whether the sparse quotient of DD-based bisimulation omits the transitions of states in which all "
+                                                   "properties are already decided. These states are made absorbing.")
+                        .setIsAdvanced()
+                        .build());
 
     std::vector<std::string> signatureModes = {"eager", "lazy"};
     this->addOption(storm::settings::OptionBuilder(moduleName, signatureModeOptionName, false, "Sets the signature computation mode.")
@@ -91,6 +99,22 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementMethods = {"splitter", "signature"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementMethodOptionName, false,
+                                                   "Sets how the partition is refined in sparse bisimulation minimization. The signature method recomputes the "
+                                                   "signatures of all states in parallel in every round.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "The method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementMethods))
+                                         .setDefaultValueString("splitter")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compositionalOptionName, false,
+                                                   "Sets whether PRISM CTMCs whose modules neither synchronize nor share variables are minimized module by "
+                                                   "module while building, so that the unminimized model is never built.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -133,6 +157,10 @@ bool BisimulationSettings::useExactArithmeticInDdBisimulation() const {
     return this->getOption(exactArithmeticDdOptionName).getHasOptionBeenSet();
 }
 
+bool BisimulationSettings::isRestrictQuotientSet() const {
+    return this->getOption(restrictQuotientOptionName).getHasOptionBeenSet();
+}
+
 storm::dd::bisimulation::SignatureMode BisimulationSettings::getSignatureMode() const {
     std::string modeAsString = this->getOption(signatureModeOptionName).getArgumentByName("mode").getValueAsString();
     if (modeAsString == "eager") {
@@ -173,6 +201,18 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+storm::storage::BisimulationRefinementMethod BisimulationSettings::getSparseRefinementMethod() const {
+    std::string methodAsString = this->getOption(sparseRefinementMethodOptionName).getArgumentByName("method").getValueAsString();
+    if (methodAsString == "signature") {
+        return storm::storage::BisimulationRefinementMethod::Signature;
+    }
+    return storm::storage::BisimulationRefinementMethod::Splitter;
+}
+
+bool BisimulationSettings::isCompositionalSet() const {
+    return this->getOption(compositionalOptionName).getHasOptionBeenSet();
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
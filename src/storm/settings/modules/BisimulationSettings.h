@@ -3,6 +3,7 @@
 
 #include "storm/settings/modules/ModuleSettings.h"
 
+#include "storm/storage/bisimulation/BisimulationType.h"
 #include "storm/storage/dd/bisimulation/QuotientFormat.h"
 #include "storm/storage/dd/bisimulation/SignatureMode.h"
 
@@ -76,6 +77,13 @@ class BisimulationSettings : public ModuleSettings {
      */
     bool useExactArithmeticInDdBisimulation() const;
 
+    /*!
+     * Retrieves whether the sparse quotient is to be restricted to the part that is relevant for the properties, i.e. whether states in which all
+     * properties are already decided are to be made absorbing.
+     * NOTE: only applies to DD-based bisimulation.
+     */
+    bool isRestrictQuotientSet() const;
+
     /*!
      * Retrieves the mode to compute signatures.
      */
@@ -96,6 +104,18 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the method used to refine the partition in sparse bisimulation minimization.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    storm::storage::BisimulationRefinementMethod getSparseRefinementMethod() const;
+
+    /*!
+     * Retrieves whether the quotient of PRISM CTMCs with non-interacting modules is to be built compositionally.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    bool isCompositionalSet() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -113,6 +133,9 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
+    static const std::string restrictQuotientOptionName;
+    static const std::string sparseRefinementMethodOptionName;
+    static const std::string compositionalOptionName;
 };
 }  // namespace modules
 }  // namespace settings
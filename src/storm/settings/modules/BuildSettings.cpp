@@ -32,12 +32,23 @@ const std::string applyNoMaxProgAssumptionOptionName = "nomaxprog";
 const std::string buildChoiceLabelOptionName = "buildchoicelab";
 const std::string buildChoiceOriginsOptionName = "buildchoiceorig";
 const std::string buildStateValuationsOptionName = "buildstateval";
+const std::string lazyStateValuationsOptionName = "buildstateval-lazy";
 const std::string buildAllLabelsOptionName = "build-all-labels";
 const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
 const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
 const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
+const std::string parallelExplorationOptionName = "explore-parallel";
+const std::string treeCompressionOptionName = "tree-compression";
+const std::string frontierSpillOptionName = "frontier-spill";
+const std::string partialOrderReductionOptionName = "partial-order-reduction";
+const std::string symmetryReductionOptionName = "symmetry-reduction";
+const std::string compressLabelsOptionName = "compress-labels";
+const std::string nativeExpressionsOptionName = "native-expressions";
+const std::string reorderStatesOptionName = "reorder-states";
+const std::string ddVariableOrderOptionName = "dd-variable-order";
+const std::string ddReachabilityOptionName = "dd-reachability";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -63,6 +74,11 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
             .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, buildStateValuationsOptionName, false, "If set, also build the state valuations").setIsAdvanced().build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, lazyStateValuationsOptionName, false,
+                                                   "If set, also build the state valuations, but only store the compressed states and derive the valuation "
+                                                   "of a state when it is needed. Saves memory if only few valuations are printed.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, buildAllLabelsOptionName, false, "If set, build all labels").setIsAdvanced().build());
     this->addOption(storm::settings::OptionBuilder(moduleName, noBuildOptionName, false, "If set, do not build the model.").setIsAdvanced().build());
 
@@ -110,6 +126,91 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .makeOptional()
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelExplorationOptionName, false,
+                                                   "If set, the explicit state space is explored using multiple threads (requires Intel TBB and bfs order).")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, treeCompressionOptionName, false,
+                                                   "If set, the explored states are stored tree-compressed, which saves memory for models with many variables.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "If set, interleavings of independent PRISM modules are pruned during the explicit exploration of MDPs.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "If set, states that only differ by a permutation of symmetric PRISM modules are merged during the explicit "
+                                                   "exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compressLabelsOptionName, false,
+                                                   "If set, the labels of explicitly built models are stored in compressed form. Saves memory for labels "
+                                                   "that hold very few or almost all states.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, nativeExpressionsOptionName, false,
+                                                   "If set, the guards, updates and rewards of PRISM programs are compiled to native code for the explicit "
+                                                   "exploration. Requires a C++ compiler at runtime.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("compiler", "The command invoking the C++ compiler.")
+                                         .setDefaultValueString("c++")
+                                         .makeOptional()
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "directory",
+                                         "The directory in which the compiled code is cached. If not given, a per-user directory in TMPDIR (or /tmp) is used.")
+                                         .setDefaultValueString("")
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    std::vector<std::string> stateOrderings = {"rcm", "scc", "bisection"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, reorderStatesOptionName, false,
+                                                   "If set, the states of explicitly built models are renumbered after the construction to improve the "
+                                                   "memory locality of the matrix-vector operations.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name", "The name of the ordering. 'rcm' applies reverse Cuthill-McKee, 'scc' orders the SCCs topologically and "
+                                                 "'bisection' recursively bisects the graph.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stateOrderings))
+                                         .setDefaultValueString("rcm")
+                                         .build())
+                        .build());
+    std::vector<std::string> ddVariableOrderingHeuristics = {"declaration", "force", "clustering"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderOptionName, false,
+                                                   "Sets the heuristic that determines the order of the variables when building symbolic models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name", "The name of the heuristic. 'declaration' keeps the order of the input, 'force' minimizes the "
+                                                 "distance between variables that are accessed together and 'clustering' places communicating modules "
+                                                 "next to each other.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderingHeuristics))
+                                         .setDefaultValueString("declaration")
+                                         .build())
+                        .build());
+    std::vector<std::string> ddReachabilityMethods = {"bfs", "chaining", "saturation"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddReachabilityOptionName, false,
+                                                   "Sets the method that computes the reachable states when building symbolic models.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name", "The name of the method. 'bfs' uses the transitions of all actions at once, 'chaining' applies the actions "
+                                                 "one after another and 'saturation' applies every action until it reaches no new states.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddReachabilityMethods))
+                                         .setDefaultValueString("bfs")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, frontierSpillOptionName, false,
+                                                   "If set, states that are yet to be explored are written to temporary files once there are too many of them.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "states", "The maximal number of unexplored states that are kept in memory.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(1))
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "directory", "The directory for the temporary files. If not given, TMPDIR (or /tmp) is used.")
+                                         .setDefaultValueString("")
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -149,7 +250,11 @@ bool BuildSettings::isBuildChoiceOriginsSet() const {
 }
 
 bool BuildSettings::isBuildStateValuationsSet() const {
-    return this->getOption(buildStateValuationsOptionName).getHasOptionBeenSet();
+    return this->getOption(buildStateValuationsOptionName).getHasOptionBeenSet() || isBuildStateValuationsLazilySet();
+}
+
+bool BuildSettings::isBuildStateValuationsLazilySet() const {
+    return this->getOption(lazyStateValuationsOptionName).getHasOptionBeenSet();
 }
 
 bool BuildSettings::isBuildOutOfBoundsStateSet() const {
@@ -174,6 +279,40 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+storm::builder::DdVariableOrderingHeuristic BuildSettings::getDdVariableOrderingHeuristic() const {
+    std::string heuristicAsString = this->getOption(ddVariableOrderOptionName).getArgumentByName("name").getValueAsString();
+    if (heuristicAsString == "declaration") {
+        return storm::builder::DdVariableOrderingHeuristic::Declaration;
+    } else if (heuristicAsString == "force") {
+        return storm::builder::DdVariableOrderingHeuristic::Force;
+    } else if (heuristicAsString == "clustering") {
+        return storm::builder::DdVariableOrderingHeuristic::Clustering;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable ordering heuristic '" << heuristicAsString << "'.");
+}
+
+storm::utility::dd::ReachabilityMethod BuildSettings::getDdReachabilityMethod() const {
+    std::string methodAsString = this->getOption(ddReachabilityOptionName).getArgumentByName("name").getValueAsString();
+    if (methodAsString == "bfs") {
+        return storm::utility::dd::ReachabilityMethod::Bfs;
+    } else if (methodAsString == "chaining") {
+        return storm::utility::dd::ReachabilityMethod::Chaining;
+    } else if (methodAsString == "saturation") {
+        return storm::utility::dd::ReachabilityMethod::Saturation;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown reachability method '" << methodAsString << "'.");
+}
+
+void BuildSettings::setDdReachabilityMethod(storm::utility::dd::ReachabilityMethod const& method) {
+    std::string methodAsString = "bfs";
+    if (method == storm::utility::dd::ReachabilityMethod::Chaining) {
+        methodAsString = "chaining";
+    } else if (method == storm::utility::dd::ReachabilityMethod::Saturation) {
+        methodAsString = "saturation";
+    }
+    this->getOption(ddReachabilityOptionName).getArgumentByName("name").setFromStringValue(methodAsString);
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
@@ -197,6 +336,66 @@ uint64_t BuildSettings::getLocationEliminationLocationHeuristic() const {
 uint64_t BuildSettings::getLocationEliminationEdgesHeuristic() const {
     return this->getOption(performLocationElimination).getArgumentByName("edges-heuristic").getValueAsUnsignedInteger();
 }
+
+bool BuildSettings::isParallelExplorationSet() const {
+    return this->getOption(parallelExplorationOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isTreeCompressionSet() const {
+    return this->getOption(treeCompressionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isFrontierSpillSet() const {
+    return this->getOption(frontierSpillOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BuildSettings::getFrontierSpillStates() const {
+    return this->getOption(frontierSpillOptionName).getArgumentByName("states").getValueAsUnsignedInteger();
+}
+
+std::string BuildSettings::getFrontierSpillDirectory() const {
+    return this->getOption(frontierSpillOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isCompressLabelsSet() const {
+    return this->getOption(compressLabelsOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isNativeExpressionsSet() const {
+    return this->getOption(nativeExpressionsOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getNativeExpressionCompiler() const {
+    return this->getOption(nativeExpressionsOptionName).getArgumentByName("compiler").getValueAsString();
+}
+
+std::string BuildSettings::getNativeExpressionDirectory() const {
+    return this->getOption(nativeExpressionsOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool BuildSettings::isReorderStatesSet() const {
+    return this->getOption(reorderStatesOptionName).getHasOptionBeenSet();
+}
+
+storm::transformer::StateOrdering BuildSettings::getStateOrdering() const {
+    std::string orderingAsString = this->getOption(reorderStatesOptionName).getArgumentByName("name").getValueAsString();
+    if (orderingAsString == "rcm") {
+        return storm::transformer::StateOrdering::ReverseCuthillMcKee;
+    } else if (orderingAsString == "scc") {
+        return storm::transformer::StateOrdering::SccTopological;
+    } else if (orderingAsString == "bisection") {
+        return storm::transformer::StateOrdering::RecursiveBisection;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state ordering '" << orderingAsString << "'.");
+}
 }  // namespace modules
 
 }  // namespace settings
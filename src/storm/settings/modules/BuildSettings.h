@@ -1,8 +1,11 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
+#include "storm/transformer/StateOrdering.h"
+#include "storm/utility/dd.h"
 
 namespace storm {
 namespace settings {
@@ -35,6 +38,27 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the heuristic that determines the order in which the symbolic model builders create the variables.
+     *
+     * @return The chosen heuristic.
+     */
+    storm::builder::DdVariableOrderingHeuristic getDdVariableOrderingHeuristic() const;
+
+    /*!
+     * Retrieves the method with which the symbolic model builders compute the reachable states.
+     *
+     * @return The chosen method.
+     */
+    storm::utility::dd::ReachabilityMethod getDdReachabilityMethod() const;
+
+    /*!
+     * Sets the method with which the symbolic model builders compute the reachable states.
+     *
+     * @param method The method to use.
+     */
+    void setDdReachabilityMethod(storm::utility::dd::ReachabilityMethod const& method);
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
@@ -91,6 +115,11 @@ class BuildSettings : public ModuleSettings {
      */
     bool isBuildStateValuationsSet() const;
 
+    /*!
+     * Retrieves whether the state valuations should only store the compressed states (and derive the valuations on demand)
+     */
+    bool isBuildStateValuationsLazilySet() const;
+
     /*!
      * Retrieves whether out of bounds state should be added
      * @return
@@ -133,6 +162,71 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getLocationEliminationEdgesHeuristic() const;
 
+    /*!
+     * Retrieves whether the explicit state space exploration shall use multiple threads.
+     */
+    bool isParallelExplorationSet() const;
+
+    /*!
+     * Retrieves whether the explored states shall be stored tree-compressed.
+     */
+    bool isTreeCompressionSet() const;
+
+    /*!
+     * Retrieves whether unexplored states shall be written to temporary files if there are too many of them.
+     */
+    bool isFrontierSpillSet() const;
+
+    /*!
+     * Retrieves the maximal number of unexplored states that are kept in memory.
+     */
+    uint64_t getFrontierSpillStates() const;
+
+    /*!
+     * Retrieves the directory for the temporary files holding unexplored states (empty if the default is to be used).
+     */
+    std::string getFrontierSpillDirectory() const;
+
+    /*!
+     * Retrieves whether partial order reduction shall be applied during the explicit state space exploration.
+     */
+    bool isPartialOrderReductionSet() const;
+
+    /*!
+     * Retrieves whether symmetric modules shall be exploited during the explicit state space exploration.
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether the labels of explicitly built models shall be stored in compressed form.
+     */
+    bool isCompressLabelsSet() const;
+
+    /*!
+     * Retrieves whether the expressions of PRISM programs shall be compiled to native code for the explicit exploration.
+     */
+    bool isNativeExpressionsSet() const;
+
+    /*!
+     * Retrieves the command invoking the C++ compiler for the native code.
+     */
+    std::string getNativeExpressionCompiler() const;
+
+    /*!
+     * Retrieves the directory in which the native code is cached (empty if the default is to be used).
+     */
+    std::string getNativeExpressionDirectory() const;
+
+    /*!
+     * Retrieves whether the states of explicitly built models shall be renumbered after the construction.
+     */
+    bool isReorderStatesSet() const;
+
+    /*!
+     * Retrieves the ordering with which the states of explicitly built models are renumbered.
+     */
+    storm::transformer::StateOrdering getStateOrdering() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
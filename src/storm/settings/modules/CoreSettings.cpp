@@ -31,6 +31,7 @@ const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::cudaOptionName = "cuda";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::solverPortfolioOptionName = "solverportfolio";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -88,6 +89,17 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+
+    std::vector<std::string> portfolioModes = {"select", "race"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, solverPortfolioOptionName, false,
+                                                   "Sets whether the solvers of the sparse engine are selected based on features of the model.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "mode", "Whether to only select the solvers or to also race the min-max method against the second-best one.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(portfolioModes))
+                                         .setDefaultValueString("select")
+                                         .build())
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -170,6 +182,14 @@ bool CoreSettings::isUseCudaSet() const {
     return this->getOption(cudaOptionName).getHasOptionBeenSet();
 }
 
+bool CoreSettings::isSolverPortfolioSet() const {
+    return this->getOption(solverPortfolioOptionName).getHasOptionBeenSet();
+}
+
+bool CoreSettings::isSolverPortfolioRaceSet() const {
+    return this->getOption(solverPortfolioOptionName).getArgumentByName("mode").getValueAsString() == "race";
+}
+
 storm::utility::Engine CoreSettings::getEngine() const {
     return engine;
 }
@@ -109,6 +109,20 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseCudaSet() const;
 
+    /*!
+     * Retrieves whether the solvers of the sparse engine are to be selected based on features of the model.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSolverPortfolioSet() const;
+
+    /*!
+     * Retrieves whether the solver portfolio is to race the min-max method against the second-best one.
+     *
+     * @return True iff the race mode was selected.
+     */
+    bool isSolverPortfolioRaceSet() const;
+
     /*!
      * Retrieves the selected engine.
      *
@@ -142,6 +156,7 @@ class CoreSettings : public ModuleSettings {
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
     static const std::string cudaOptionName;
+    static const std::string solverPortfolioOptionName;
 };
 
 }  // namespace modules
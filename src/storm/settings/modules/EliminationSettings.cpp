@@ -18,6 +18,9 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::parallelEliminationOptionName = "parallel";
+const std::string EliminationSettings::operationCacheOptionName = "opcache";
+const std::string EliminationSettings::delayCancellationOptionName = "delay-cancellation";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
@@ -54,6 +57,23 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelEliminationOptionName, true,
+                                                   "Sets whether states that are not adjacent to each other are eliminated in parallel.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, operationCacheOptionName, true,
+                                       "Sets whether the results of the arithmetic operations are cached during the elimination (only for exact values).")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The maximal number of cached results.")
+                             .setDefaultValueUnsignedInteger(1000000)
+                             .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, delayCancellationOptionName, true,
+                                                   "Sets whether intermediate values are only cancelled when they are inverted (and at the end).")
+                        .setIsAdvanced()
+                        .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -101,6 +121,22 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+bool EliminationSettings::isParallelEliminationSet() const {
+    return this->getOption(parallelEliminationOptionName).getHasOptionBeenSet();
+}
+
+bool EliminationSettings::isOperationCacheSet() const {
+    return this->getOption(operationCacheOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t EliminationSettings::getOperationCacheSize() const {
+    return this->getOption(operationCacheOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+bool EliminationSettings::isDelayCancellationSet() const {
+    return this->getOption(delayCancellationOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
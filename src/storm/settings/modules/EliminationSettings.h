@@ -62,6 +62,34 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves whether independent states are to be eliminated in parallel.
+     *
+     * @return True iff the option was set.
+     */
+    bool isParallelEliminationSet() const;
+
+    /*!
+     * Retrieves whether the results of arithmetic operations are to be cached during the elimination.
+     *
+     * @return True iff the option was set.
+     */
+    bool isOperationCacheSet() const;
+
+    /*!
+     * Retrieves the maximal number of results stored in the operation cache.
+     *
+     * @return The maximal number of cached results.
+     */
+    uint_fast64_t getOperationCacheSize() const;
+
+    /*!
+     * Retrieves whether the cancellation of intermediate values is to be delayed.
+     *
+     * @return True iff the option was set.
+     */
+    bool isDelayCancellationSet() const;
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +98,9 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string parallelEliminationOptionName;
+    const static std::string operationCacheOptionName;
+    const static std::string delayCancellationOptionName;
 };
 
 }  // namespace modules
@@ -19,6 +19,7 @@ const std::string ExplorationSettings::precomputationTypeOptionName = "precomp";
 const std::string ExplorationSettings::numberOfExplorationStepsUntilPrecomputationOptionName = "stepsprecomp";
 const std::string ExplorationSettings::numberOfSampledPathsUntilPrecomputationOptionName = "pathsprecomp";
 const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
+const std::string ExplorationSettings::numberOfConcurrentPathsOptionName = "paths";
 const std::string ExplorationSettings::precisionOptionName = "precision";
 const std::string ExplorationSettings::precisionOptionShortName = "eps";
 
@@ -47,6 +48,16 @@ ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfConcurrentPathsOptionName, true,
+                                                   "Sets the number of paths that are sampled concurrently. If Intel TBB is used, the paths are sampled by "
+                                                   "multiple threads.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
     std::vector<std::string> nextStateHeuristics = {"probdiffs", "prob", "unif"};
     this->addOption(storm::settings::OptionBuilder(moduleName, nextStateHeuristicOptionName, true, "Sets the next-state heuristic to use.")
                         .setIsAdvanced()
@@ -105,6 +116,10 @@ uint_fast64_t ExplorationSettings::getNumberOfSampledPathsUntilPrecomputation()
     return this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
 }
 
+uint_fast64_t ExplorationSettings::getNumberOfConcurrentPaths() const {
+    return this->getOption(numberOfConcurrentPathsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 ExplorationSettings::NextStateHeuristic ExplorationSettings::getNextStateHeuristic() const {
     std::string nextStateHeuristicAsString = this->getOption(nextStateHeuristicOptionName).getArgumentByName("name").getValueAsString();
     if (nextStateHeuristicAsString == "probdiffs") {
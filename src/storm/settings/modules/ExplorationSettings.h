@@ -65,6 +65,13 @@ class ExplorationSettings : public ModuleSettings {
      */
     uint_fast64_t getNumberOfSampledPathsUntilPrecomputation() const;
 
+    /*!
+     * Retrieves the number of paths that are sampled concurrently.
+     *
+     * @return The number of paths that are sampled concurrently.
+     */
+    uint_fast64_t getNumberOfConcurrentPaths() const;
+
     /*!
      * Retrieves the selected next-state heuristic.
      *
@@ -90,6 +97,7 @@ class ExplorationSettings : public ModuleSettings {
     static const std::string numberOfExplorationStepsUntilPrecomputationOptionName;
     static const std::string numberOfSampledPathsUntilPrecomputationOptionName;
     static const std::string nextStateHeuristicOptionName;
+    static const std::string numberOfConcurrentPathsOptionName;
     static const std::string precisionOptionName;
     static const std::string precisionOptionShortName;
 };
@@ -19,7 +19,7 @@ const std::string GameSolverSettings::precisionOptionName = "precision";
 const std::string GameSolverSettings::absoluteOptionName = "absolute";
 
 GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration"};
+    std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "ii", "interval-iteration"};
     this->addOption(storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which game solving technique is preferred.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a game solving technique.")
@@ -55,6 +55,8 @@ storm::solver::GameMethod GameSolverSettings::getGameSolvingMethod() const {
         return storm::solver::GameMethod::ValueIteration;
     } else if (gameSolvingTechnique == "policy-iteration" || gameSolvingTechnique == "pi") {
         return storm::solver::GameMethod::PolicyIteration;
+    } else if (gameSolvingTechnique == "interval-iteration" || gameSolvingTechnique == "ii") {
+        return storm::solver::GameMethod::IntervalIteration;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown game solving technique '" << gameSolvingTechnique << "'.");
 }
@@ -1,5 +1,10 @@
 #include "storm/settings/modules/IOSettings.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include <boost/algorithm/string.hpp>
+
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/parser/CSVParser.h"
 #include "storm/settings/Argument.h"
@@ -31,6 +36,9 @@ const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitBinaryOptionName = "explicit-binary";
+const std::string IOSettings::explicitBinaryOptionShortName = "bin";
+const std::string IOSettings::modelCacheOptionName = "model-cache";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -48,12 +56,14 @@ const std::string IOSettings::janiPropertyOptionShortName = "jprop";
 const std::string IOSettings::propertyOptionName = "prop";
 const std::string IOSettings::propertyOptionShortName = "prop";
 const std::string IOSettings::steadyStateDistrOptionName = "steadystate";
+const std::string IOSettings::timePointsOptionName = "timepoints";
 const std::string IOSettings::expectedVisitingTimesOptionName = "expvisittimes";
 
 const std::string IOSettings::qvbsInputOptionName = "qvbs";
 const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
 const std::string IOSettings::qvbsRootOptionName = "qvbsroot";
 const std::string IOSettings::propertiesAsMultiOptionName = "propsasmulti";
+const std::string IOSettings::serverOptionName = "server";
 
 std::string preventDRNPlaceholderOptionName = "no-drn-placeholders";
 
@@ -74,7 +84,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json", "bin"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -103,13 +113,16 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, exportSchedulerOptionName, false,
                                        "Exports the choices of an optimal scheduler to the given file (if supported by engine).")
             .setIsAdvanced()
-            .addArgument(
-                storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build())
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "filename", "The output file. Use file extension '.json' to export in json and '.bin' to export in a binary format.")
+                             .build())
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultOptionName, false,
                                                    "Exports the result to a given file (if supported by engine). The export will be in json.")
                         .setIsAdvanced()
-                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "filename", "The output file. Use file extension '.bin' to export in a binary format instead of json.")
+                                         .build())
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "",
@@ -143,6 +156,19 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, explicitBinaryOptionName, false, "Loads the model given in the binary format (see --exportbuild).")
+            .setShortName(explicitBinaryOptionShortName)
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("binary filename", "The name of the binary file containing the model.")
+                             .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                             .build())
+            .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, modelCacheOptionName, false,
+                                       "Stores sparse models built from symbolic input in the given directory and reuses them in later runs with the same "
+                                       "model, constants, properties and build settings.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory of the cache.").build())
+            .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -224,6 +250,14 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                        "Computes the steady state distribution. Result can be exported using --" + exportCheckResultOptionName + ".")
             .setIsAdvanced()
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, timePointsOptionName, false,
+                                                   "Checks each time-bounded until property P=? [phi U<=t psi] on a CTMC for all given time points t (instead of "
+                                                   "the time bound of the property) within a single uniformization.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "points", "Either a comma separated list of time points or a range of the form 'start:step:end'.")
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, expectedVisitingTimesOptionName, false,
                                                    "Computes the expected number of times each state is visited (DTMC) or the expected time spend in each "
                                                    "state (CTMC). Result can be exported using --" +
@@ -250,6 +284,12 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                         .setIsAdvanced()
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, serverOptionName, false,
+                                                   "If set, Storm runs as a server that keeps models in memory and answers JSON-RPC requests (one per line) "
+                                                   "from standard input on standard output.")
+                        .setIsAdvanced()
+                        .build());
+
 #ifdef STORM_HAVE_QVBS
     std::string qvbsRootDefault = STORM_QVBS_ROOT;
 #else
@@ -366,6 +406,22 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+bool IOSettings::isExplicitBinarySet() const {
+    return this->getOption(explicitBinaryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitBinaryFilename() const {
+    return this->getOption(explicitBinaryOptionName).getArgumentByName("binary filename").getValueAsString();
+}
+
+bool IOSettings::isModelCacheSet() const {
+    return this->getOption(modelCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getModelCacheDirectory() const {
+    return this->getOption(modelCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -459,6 +515,55 @@ bool IOSettings::isComputeSteadyStateDistributionSet() const {
     return this->getOption(steadyStateDistrOptionName).getHasOptionBeenSet();
 }
 
+bool IOSettings::isTimePointsSet() const {
+    return this->getOption(timePointsOptionName).getHasOptionBeenSet();
+}
+
+std::vector<double> IOSettings::getTimePoints() const {
+    std::string const& input = this->getOption(timePointsOptionName).getArgumentByName("points").getValueAsString();
+    auto parseTimePoint = [&input](std::string const& value) {
+        std::size_t processedCharacters = 0;
+        double result = 0.0;
+        try {
+            result = std::stod(value, &processedCharacters);
+        } catch (std::exception const&) {
+            processedCharacters = 0;
+        }
+        STORM_LOG_THROW(processedCharacters > 0 && processedCharacters == value.size(), storm::exceptions::IllegalArgumentValueException,
+                        "Unable to parse time point '" << value << "' in '" << input << "'.");
+        STORM_LOG_THROW(result >= 0.0 && std::isfinite(result), storm::exceptions::IllegalArgumentValueException,
+                        "The time point '" << value << "' is not a non-negative finite number.");
+        return result;
+    };
+
+    std::vector<double> result;
+    if (input.find(':') != std::string::npos) {
+        std::vector<std::string> range;
+        boost::split(range, input, boost::is_any_of(":"));
+        STORM_LOG_THROW(range.size() == 3, storm::exceptions::IllegalArgumentValueException,
+                        "The range of time points '" << input << "' is not of the form 'start:step:end'.");
+        double start = parseTimePoint(range[0]);
+        double step = parseTimePoint(range[1]);
+        double end = parseTimePoint(range[2]);
+        STORM_LOG_THROW(step > 0.0 && start <= end, storm::exceptions::IllegalArgumentValueException,
+                        "The range of time points '" << input << "' needs a positive step and a start that does not exceed the end.");
+        // Tolerate rounding errors such that the end point is included if it is (almost) hit by the steps.
+        uint64_t numberOfSteps = static_cast<uint64_t>(std::floor((end - start) / step + 1e-9));
+        result.reserve(numberOfSteps + 1);
+        for (uint64_t i = 0; i <= numberOfSteps; ++i) {
+            result.push_back(std::min(start + i * step, end));
+        }
+    } else {
+        for (auto const& value : storm::parser::parseCommaSeperatedValues(input)) {
+            result.push_back(parseTimePoint(value));
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+    }
+    STORM_LOG_THROW(!result.empty(), storm::exceptions::IllegalArgumentValueException, "No time points given.");
+    return result;
+}
+
 bool IOSettings::isComputeExpectedVisitingTimesSet() const {
     return this->getOption(expectedVisitingTimesOptionName).getHasOptionBeenSet();
 }
@@ -501,6 +606,10 @@ bool IOSettings::isPropertiesAsMultiSet() const {
     return this->getOption(propertiesAsMultiOptionName).getHasOptionBeenSet();
 }
 
+bool IOSettings::isServerSet() const {
+    return this->getOption(serverOptionName).getHasOptionBeenSet();
+}
+
 void IOSettings::finalize() {
     STORM_LOG_WARN_COND(!isExportDdSet(), "Option '--" << moduleName << ":" << exportDdOptionName << "' is depreciated. Use '--" << moduleName << ":"
                                                        << exportBuildOptionName << "' instead.");
@@ -522,6 +631,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitBinarySet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
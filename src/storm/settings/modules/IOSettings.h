@@ -167,6 +167,34 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExplicitDRNFilename() const;
 
+    /*!
+     * Retrieves whether the explicit option with the binary format was set.
+     *
+     * @return True if the explicit option with the binary format was set.
+     */
+    bool isExplicitBinarySet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary format.
+     *
+     * @return The name of the binary file that contains the model.
+     */
+    std::string getExplicitBinaryFilename() const;
+
+    /*!
+     * Retrieves whether models built from symbolic input are to be cached.
+     *
+     * @return True if the model cache option was set.
+     */
+    bool isModelCacheSet() const;
+
+    /*!
+     * Retrieves the directory in which built models are cached.
+     *
+     * @return The directory of the model cache.
+     */
+    std::string getModelCacheDirectory() const;
+
     /*!
      * Retrieves whether we prevent the usage of placeholders in the explicit DRN format
      * @return
@@ -333,6 +361,16 @@ class IOSettings : public ModuleSettings {
      */
     bool isComputeSteadyStateDistributionSet() const;
 
+    /*!
+     * Retrieves whether time-bounded properties are to be checked for multiple time points.
+     */
+    bool isTimePointsSet() const;
+
+    /*!
+     * Retrieves the (sorted) time points for which time-bounded properties are to be checked.
+     */
+    std::vector<double> getTimePoints() const;
+
     /*!
      * Retrieves whether the expected visiting times are to be computed.
      */
@@ -368,6 +406,11 @@ class IOSettings : public ModuleSettings {
      */
     bool isPropertiesAsMultiSet() const;
 
+    /*!
+     * Retrieves whether Storm is to run as a model checking server.
+     */
+    bool isServerSet() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -390,6 +433,9 @@ class IOSettings : public ModuleSettings {
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string explicitBinaryOptionName;
+    static const std::string explicitBinaryOptionShortName;
+    static const std::string modelCacheOptionName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
@@ -405,11 +451,13 @@ class IOSettings : public ModuleSettings {
     static const std::string propertyOptionName;
     static const std::string propertyOptionShortName;
     static const std::string steadyStateDistrOptionName;
+    static const std::string timePointsOptionName;
     static const std::string expectedVisitingTimesOptionName;
     static const std::string qvbsInputOptionName;
     static const std::string qvbsInputOptionShortName;
     static const std::string qvbsRootOptionName;
     static const std::string propertiesAsMultiOptionName;
+    static const std::string serverOptionName;
 };
 
 }  // namespace modules
@@ -1,5 +1,6 @@
 #include "storm/settings/modules/MinMaxEquationSolverSettings.h"
 
+#include "storm/parser/CSVParser.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
@@ -19,12 +20,52 @@ const std::string MinMaxEquationSolverSettings::precisionOptionName = "precision
 const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string MinMaxEquationSolverSettings::mixedPrecisionOptionName = "mixed-precision";
+const std::string MinMaxEquationSolverSettings::ddQuantizationOptionName = "dd-quantization";
+const std::string MinMaxEquationSolverSettings::policyEvaluationSweepsOptionName = "pi-sweeps";
+const std::string MinMaxEquationSolverSettings::policyImprovementThreadsOptionName = "pi-threads";
+const std::string MinMaxEquationSolverSettings::portfolioOptionName = "portfolio";
+
+namespace detail {
+storm::solver::MinMaxMethod parseMinMaxMethod(std::string const& minMaxEquationSolvingTechnique) {
+    if (minMaxEquationSolvingTechnique == "value-iteration" || minMaxEquationSolvingTechnique == "vi") {
+        return storm::solver::MinMaxMethod::ValueIteration;
+    } else if (minMaxEquationSolvingTechnique == "policy-iteration" || minMaxEquationSolvingTechnique == "pi") {
+        return storm::solver::MinMaxMethod::PolicyIteration;
+    } else if (minMaxEquationSolvingTechnique == "linear-programming" || minMaxEquationSolvingTechnique == "lp") {
+        return storm::solver::MinMaxMethod::LinearProgramming;
+    } else if (minMaxEquationSolvingTechnique == "ratsearch" || minMaxEquationSolvingTechnique == "rs") {
+        return storm::solver::MinMaxMethod::RationalSearch;
+    } else if (minMaxEquationSolvingTechnique == "interval-iteration" || minMaxEquationSolvingTechnique == "ii") {
+        return storm::solver::MinMaxMethod::IntervalIteration;
+    } else if (minMaxEquationSolvingTechnique == "sound-value-iteration" || minMaxEquationSolvingTechnique == "svi") {
+        return storm::solver::MinMaxMethod::SoundValueIteration;
+    } else if (minMaxEquationSolvingTechnique == "optimistic-value-iteration" || minMaxEquationSolvingTechnique == "ovi") {
+        return storm::solver::MinMaxMethod::OptimisticValueIteration;
+    } else if (minMaxEquationSolvingTechnique == "topological") {
+        return storm::solver::MinMaxMethod::Topological;
+    } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
+        return storm::solver::MinMaxMethod::ViToPi;
+    } else if (minMaxEquationSolvingTechnique == "acyclic") {
+        return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "asynchronous-value-iteration" || minMaxEquationSolvingTechnique == "avi") {
+        return storm::solver::MinMaxMethod::AsynchronousValueIteration;
+    } else if (minMaxEquationSolvingTechnique == "prioritized-value-iteration" || minMaxEquationSolvingTechnique == "pvi") {
+        return storm::solver::MinMaxMethod::PrioritizedValueIteration;
+    } else if (minMaxEquationSolvingTechnique == "portfolio") {
+        return storm::solver::MinMaxMethod::Portfolio;
+    }
+
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
+                    "Unknown min/max equation solving technique '" << minMaxEquationSolvingTechnique << "'.");
+}
+}  // namespace detail
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "avi", "asynchronous-value-iteration", "pvi", "prioritized-value-iteration", "portfolio"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -68,34 +109,54 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, value iteration first operates on a single precision copy of the matrix and then refines the result "
+                                                   "using double precision.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddQuantizationOptionName, false,
+                                                   "If set, the dd engine rounds the values computed by value iteration to multiples of 2^-bits, which keeps "
+                                                   "the number of distinct values in the ADDs small. Lower bounds are rounded down and upper bounds up.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bits", "The number of fractional bits (0 = off).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(0, 52))
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, policyEvaluationSweepsOptionName, false,
+                                                   "If set, policy iteration evaluates intermediate policies approximately by the given number of sweeps over "
+                                                   "the original matrix (modified policy iteration). The final policy is still evaluated exactly.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("sweeps", "The number of sweeps (0 = off).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, policyImprovementThreadsOptionName, false,
+                                                   "Sets the number of threads with which policy iteration improves the policies.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, portfolioOptionName, false,
+                                                   "Sets the techniques that the portfolio technique runs concurrently. The first technique that solves the "
+                                                   "equation system wins and the others are cancelled.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "names", "A comma-separated list of at least two min/max linear equation solving techniques.")
+                                         .setDefaultValueString("ii,pi")
+                                         .build())
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
-    std::string minMaxEquationSolvingTechnique = this->getOption(solvingMethodOptionName).getArgumentByName("name").getValueAsString();
-    if (minMaxEquationSolvingTechnique == "value-iteration" || minMaxEquationSolvingTechnique == "vi") {
-        return storm::solver::MinMaxMethod::ValueIteration;
-    } else if (minMaxEquationSolvingTechnique == "policy-iteration" || minMaxEquationSolvingTechnique == "pi") {
-        return storm::solver::MinMaxMethod::PolicyIteration;
-    } else if (minMaxEquationSolvingTechnique == "linear-programming" || minMaxEquationSolvingTechnique == "lp") {
-        return storm::solver::MinMaxMethod::LinearProgramming;
-    } else if (minMaxEquationSolvingTechnique == "ratsearch" || minMaxEquationSolvingTechnique == "rs") {
-        return storm::solver::MinMaxMethod::RationalSearch;
-    } else if (minMaxEquationSolvingTechnique == "interval-iteration" || minMaxEquationSolvingTechnique == "ii") {
-        return storm::solver::MinMaxMethod::IntervalIteration;
-    } else if (minMaxEquationSolvingTechnique == "sound-value-iteration" || minMaxEquationSolvingTechnique == "svi") {
-        return storm::solver::MinMaxMethod::SoundValueIteration;
-    } else if (minMaxEquationSolvingTechnique == "optimistic-value-iteration" || minMaxEquationSolvingTechnique == "ovi") {
-        return storm::solver::MinMaxMethod::OptimisticValueIteration;
-    } else if (minMaxEquationSolvingTechnique == "topological") {
-        return storm::solver::MinMaxMethod::Topological;
-    } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
-        return storm::solver::MinMaxMethod::ViToPi;
-    } else if (minMaxEquationSolvingTechnique == "acyclic") {
-        return storm::solver::MinMaxMethod::Acyclic;
-    }
-
-    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
-                    "Unknown min/max equation solving technique '" << minMaxEquationSolvingTechnique << "'.");
+    return detail::parseMinMaxMethod(this->getOption(solvingMethodOptionName).getArgumentByName("name").getValueAsString());
 }
 
 bool MinMaxEquationSolverSettings::isMinMaxEquationSolvingMethodSetFromDefaultValue() const {
@@ -146,6 +207,35 @@ bool MinMaxEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
+uint64_t MinMaxEquationSolverSettings::getDdQuantizationBits() const {
+    return this->getOption(ddQuantizationOptionName).getArgumentByName("bits").getValueAsUnsignedInteger();
+}
+
+uint64_t MinMaxEquationSolverSettings::getPolicyEvaluationSweeps() const {
+    return this->getOption(policyEvaluationSweepsOptionName).getArgumentByName("sweeps").getValueAsUnsignedInteger();
+}
+
+uint64_t MinMaxEquationSolverSettings::getPolicyImprovementThreads() const {
+    return this->getOption(policyImprovementThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+std::vector<storm::solver::MinMaxMethod> MinMaxEquationSolverSettings::getPortfolioMethods() const {
+    std::string names = this->getOption(portfolioOptionName).getArgumentByName("names").getValueAsString();
+    std::vector<storm::solver::MinMaxMethod> result;
+    for (auto const& name : storm::parser::parseCommaSeperatedValues(names)) {
+        result.push_back(detail::parseMinMaxMethod(name));
+        STORM_LOG_THROW(result.back() != storm::solver::MinMaxMethod::Portfolio, storm::exceptions::IllegalArgumentValueException,
+                        "The portfolio technique can not be part of a portfolio.");
+    }
+    STORM_LOG_THROW(result.size() >= 2, storm::exceptions::IllegalArgumentValueException,
+                    "The portfolio '" << names << "' needs to consist of at least two techniques.");
+    return result;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -95,6 +95,35 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceIntervalIterationSymmetricUpdatesSet() const;
 
+    /*!
+     * Retrieves whether value iteration shall first be performed on a single precision copy of the matrix.
+     */
+    bool isMixedPrecisionSet() const;
+
+    /*!
+     * Retrieves the number of fractional bits to which the dd engine rounds the values computed by value iteration. Zero means that the values
+     * are not rounded.
+     */
+    uint64_t getDdQuantizationBits() const;
+
+    /*!
+     * Retrieves the number of sweeps with which policy iteration evaluates the intermediate policies. Zero means that every policy is evaluated
+     * by solving its equation system.
+     */
+    uint64_t getPolicyEvaluationSweeps() const;
+
+    /*!
+     * Retrieves the number of threads with which policy iteration improves the policies.
+     */
+    uint64_t getPolicyImprovementThreads() const;
+
+    /*!
+     * Retrieves the techniques that are run concurrently by the portfolio technique.
+     *
+     * @return The techniques of the portfolio.
+     */
+    std::vector<storm::solver::MinMaxMethod> getPortfolioMethods() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -106,6 +135,11 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
     static const std::string absoluteOptionName;
     static const std::string valueIterationMultiplicationStyleOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
+    static const std::string mixedPrecisionOptionName;
+    static const std::string ddQuantizationOptionName;
+    static const std::string policyEvaluationSweepsOptionName;
+    static const std::string policyImprovementThreadsOptionName;
+    static const std::string portfolioOptionName;
     static const std::string forceBoundsOptionName;
 };
 
@@ -2,6 +2,7 @@
 
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingMemento.h"
@@ -14,6 +15,14 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltl2daCacheOptionName = "ltl2da-cache";
+const std::string ModelCheckerSettings::reuseSolutionsOptionName = "reuse-solutions";
+const std::string ModelCheckerSettings::reusePrecomputationsOptionName = "reuse-precomputations";
+const std::string ModelCheckerSettings::ddPartitionOptionName = "dd-partition";
+const std::string ModelCheckerSettings::hybridSccOptionName = "hybrid-scc";
+const std::string ModelCheckerSettings::conditionalDirectOptionName = "conditional-direct";
+const std::string ModelCheckerSettings::batchVerificationOptionName = "batch-properties";
+const std::string ModelCheckerSettings::propertyThreadsOptionName = "property-threads";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +36,66 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daCacheOptionName, false,
+                                                   "If set, deterministic automata for LTL formulas are stored in the given directory and reused across runs")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createStringArgument("directory", "An existing directory for the cached automata.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, reuseSolutionsOptionName, false,
+                                                   "If set, the solutions of previously checked properties with the same target (and constraint) states are "
+                                                   "used as initial guesses")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, reusePrecomputationsOptionName, false,
+                                                   "If set, the qualitative analyses of previously checked properties with the same target and constraint "
+                                                   "states are reused")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddPartitionOptionName, false,
+                                                   "If set, the symbolic graph algorithms split the transition relation into parts of bounded size for image "
+                                                   "computations")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("nodes", "The maximal number of nodes of a part.")
+                                         .setDefaultValueUnsignedInteger(10000)
+                                         .makeOptional()
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridSccOptionName, false,
+                                                   "If set, the hybrid engine converts and solves the equation systems of DTMCs one SCC at a time, which "
+                                                   "bounds the size of the explicit matrices by the size of the largest SCC")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "states", "Consecutive SCCs are merged into blocks with at least this number of states.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchVerificationOptionName, false,
+                                                   "If set, the properties of a model are checked as a batch that shares the results of common sub-formulas "
+                                                   "and qualitative analyses (sparse engine only)")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads",
+                                                                                                     "The number of concurrently checked properties.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .makeOptional()
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, propertyThreadsOptionName, false,
+                                                   "Sets the number of threads that check the properties of a model concurrently (sparse engine only)")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, conditionalDirectOptionName, false,
+                                                   "If set, conditional probabilities in MDPs are computed by value iteration on the original model instead "
+                                                   "of building the transformed model that restarts upon violating the condition")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +110,57 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isLtl2daCacheDirectorySet() const {
+    return this->getOption(ltl2daCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getLtl2daCacheDirectory() const {
+    return this->getOption(ltl2daCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool ModelCheckerSettings::isReuseSolutionsSet() const {
+    return this->getOption(reuseSolutionsOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isReusePrecomputationsSet() const {
+    return this->getOption(reusePrecomputationsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getDdPartitionNodeCount() const {
+    if (!this->getOption(ddPartitionOptionName).getHasOptionBeenSet()) {
+        return 0;
+    }
+    return this->getOption(ddPartitionOptionName).getArgumentByName("nodes").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isHybridSccSet() const {
+    return this->getOption(hybridSccOptionName).getHasOptionBeenSet();
+}
+
+std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideHybridSccSet(bool stateToSet) {
+    return this->overrideOption(hybridSccOptionName, stateToSet);
+}
+
+uint64_t ModelCheckerSettings::getHybridSccMinimalBlockSize() const {
+    return this->getOption(hybridSccOptionName).getArgumentByName("states").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isBatchVerificationSet() const {
+    return this->getOption(batchVerificationOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getBatchVerificationThreadCount() const {
+    return this->getOption(batchVerificationOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+}
+
+uint64_t ModelCheckerSettings::getPropertyThreadCount() const {
+    return this->getOption(propertyThreadsOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isConditionalDirectSet() const {
+    return this->getOption(conditionalDirectOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
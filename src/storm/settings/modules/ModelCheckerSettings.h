@@ -35,6 +35,95 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether a directory for persisting LTL-to-DA translations has been set.
+     *
+     * @return True iff the cache directory has been set.
+     */
+    bool isLtl2daCacheDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which LTL-to-DA translations are persisted across runs.
+     *
+     * @return The cache directory.
+     */
+    std::string getLtl2daCacheDirectory() const;
+
+    /*!
+     * Retrieves whether solutions of previously checked properties are to be reused as initial guesses.
+     *
+     * @return True iff solutions are to be reused.
+     */
+    bool isReuseSolutionsSet() const;
+
+    /*!
+     * Retrieves whether the qualitative analyses (i.e., the states with probability zero and one) of previously checked properties are to be
+     * reused.
+     *
+     * @return True iff qualitative analyses are to be reused.
+     */
+    bool isReusePrecomputationsSet() const;
+
+    /*!
+     * Retrieves the maximal number of nodes of the parts into which the transition relation is split for the image computations of the
+     * symbolic graph algorithms.
+     *
+     * @return The maximal number of nodes per part or zero if the transition relation is not to be split.
+     */
+    uint64_t getDdPartitionNodeCount() const;
+
+    /*!
+     * Retrieves whether the hybrid engine is to convert and solve the equation systems one SCC (block) at a time.
+     *
+     * @return True iff the equation systems are to be solved SCC-wise.
+     */
+    bool isHybridSccSet() const;
+
+    /*!
+     * Overrides the option to solve the equation systems of the hybrid engine SCC-wise by setting it to the specified value. As soon as the
+     * returned memento goes out of scope, the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the option.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideHybridSccSet(bool stateToSet);
+
+    /*!
+     * Retrieves the minimal number of states of the blocks into which consecutive SCCs are merged for the SCC-wise solving in the hybrid engine.
+     *
+     * @return The minimal number of states of a block.
+     */
+    uint64_t getHybridSccMinimalBlockSize() const;
+
+    /*!
+     * Retrieves whether all properties of a model are to be checked as one batch that shares sub-formula results and qualitative analyses.
+     *
+     * @return True iff the properties are to be checked as a batch.
+     */
+    bool isBatchVerificationSet() const;
+
+    /*!
+     * Retrieves the number of threads that check the properties of a batch concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getBatchVerificationThreadCount() const;
+
+    /*!
+     * Retrieves the number of threads that check independent properties concurrently (without sharing intermediate results).
+     *
+     * @return The number of threads.
+     */
+    uint64_t getPropertyThreadCount() const;
+
+    /*!
+     * Retrieves whether conditional probabilities in MDPs are to be computed directly on the original model instead of on the transformed model
+     * in which the violation of the condition restarts the model.
+     *
+     * @return True iff conditional probabilities are to be computed directly.
+     */
+    bool isConditionalDirectSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +131,14 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltl2daCacheOptionName;
+    static const std::string reuseSolutionsOptionName;
+    static const std::string reusePrecomputationsOptionName;
+    static const std::string ddPartitionOptionName;
+    static const std::string hybridSccOptionName;
+    static const std::string conditionalDirectOptionName;
+    static const std::string batchVerificationOptionName;
+    static const std::string propertyThreadsOptionName;
 };
 
 }  // namespace modules
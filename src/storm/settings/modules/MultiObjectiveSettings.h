@@ -66,6 +66,11 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     uint_fast64_t getMaxSteps() const;
 
+    /*!
+     * Retrieves the number of weight vectors that are checked per refinement round of the Pareto curve approximation algorithm.
+     */
+    uint_fast64_t getWeightVectorBatchSize() const;
+
     /*!
      * Retrieves whether a scheduler restriction has been set.
      */
@@ -115,6 +120,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string exportPlotOptionName;
     const static std::string precisionOptionName;
     const static std::string maxStepsOptionName;
+    const static std::string weightVectorBatchSizeOptionName;
     const static std::string schedulerRestrictionOptionName;
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
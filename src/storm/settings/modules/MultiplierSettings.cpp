@@ -13,9 +13,12 @@ namespace modules {
 
 const std::string MultiplierSettings::moduleName = "multiplier";
 const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+const std::string MultiplierSettings::soaLayoutOptionName = "soa";
+const std::string MultiplierSettings::parallelGaussSeidelOptionName = "parallel-gs";
+const std::string MultiplierSettings::numaAwareOptionName = "numa-aware";
 
 MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+    std::vector<std::string> multiplierTypes = {"native", "gmmxx", "simd", "cuda"};
     this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.")
@@ -23,6 +26,23 @@ MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("gmmxx")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, soaLayoutOptionName, false,
+                                                   "If set, the native multiplier stores the columns and values of the matrix in separate arrays. This "
+                                                   "requires an additional copy of the matrix but reduces the memory traffic of each multiplication.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelGaussSeidelOptionName, false,
+                                                   "If set, the native multiplier performs Gauss-Seidel style multiplications in parallel. To this end, the "
+                                                   "row groups are colored such that row groups of the same color do not depend on each other. Requires "
+                                                   "Intel TBB.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numaAwareOptionName, false,
+                                                   "If set, parallel multiplications assign the same rows to the same threads in every iteration. This "
+                                                   "keeps the accessed parts of the matrix and the vectors local to the NUMA node of the thread. Requires "
+                                                   "Intel TBB.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -31,6 +51,10 @@ storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
         return storm::solver::MultiplierType::Native;
     } else if (type == "gmmxx") {
         return storm::solver::MultiplierType::Gmmxx;
+    } else if (type == "simd") {
+        return storm::solver::MultiplierType::Simd;
+    } else if (type == "cuda") {
+        return storm::solver::MultiplierType::Cuda;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -40,6 +64,18 @@ bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
     return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
+
+bool MultiplierSettings::isSoaLayoutSet() const {
+    return this->getOption(soaLayoutOptionName).getHasOptionBeenSet();
+}
+
+bool MultiplierSettings::isParallelGaussSeidelSet() const {
+    return this->getOption(parallelGaussSeidelOptionName).getHasOptionBeenSet();
+}
+
+bool MultiplierSettings::isNumaAwareSet() const {
+    return this->getOption(numaAwareOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
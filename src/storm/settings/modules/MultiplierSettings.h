@@ -21,11 +21,29 @@ class MultiplierSettings : public ModuleSettings {
 
     bool isMultiplierTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the native multiplier is supposed to operate on a structure-of-arrays copy of the matrix.
+     */
+    bool isSoaLayoutSet() const;
+
+    /*!
+     * Retrieves whether the native multiplier is supposed to perform Gauss-Seidel style multiplications in parallel.
+     */
+    bool isParallelGaussSeidelSet() const;
+
+    /*!
+     * Retrieves whether parallel multiplications are supposed to assign the same rows to the same threads in every iteration.
+     */
+    bool isNumaAwareSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string multiplierTypeOptionName;
+    static const std::string soaLayoutOptionName;
+    static const std::string parallelGaussSeidelOptionName;
+    static const std::string numaAwareOptionName;
 };
 
 }  // namespace modules
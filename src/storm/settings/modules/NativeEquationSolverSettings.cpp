@@ -18,17 +18,22 @@ namespace modules {
 const std::string NativeEquationSolverSettings::moduleName = "native";
 const std::string NativeEquationSolverSettings::techniqueOptionName = "method";
 const std::string NativeEquationSolverSettings::omegaOptionName = "soromega";
+const std::string NativeEquationSolverSettings::preconditionOptionName = "precond";
+const std::string NativeEquationSolverSettings::restartOptionName = "restart";
 const std::string NativeEquationSolverSettings::maximalIterationsOptionName = "maxiter";
 const std::string NativeEquationSolverSettings::maximalIterationsOptionShortName = "i";
 const std::string NativeEquationSolverSettings::precisionOptionName = "precision";
 const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string NativeEquationSolverSettings::mixedPrecisionOptionName = "mixed-precision";
+const std::string NativeEquationSolverSettings::ddQuantizationOptionName = "dd-quantization";
 
 NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> methods = {"jacobi", "gaussseidel",           "sor", "walkerchae",
-                                        "power",  "sound-value-iteration", "svi", "optimistic-value-iteration",
-                                        "ovi",    "interval-iteration",    "ii",  "ratsearch"};
+    std::vector<std::string> methods = {"jacobi",   "gaussseidel",           "sor", "walkerchae",
+                                        "power",    "sound-value-iteration", "svi", "optimistic-value-iteration",
+                                        "ovi",      "interval-iteration",    "ii",  "ratsearch",
+                                        "bicgstab", "gmres",                 "multigrid"};
     this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true,
                                                    "The method to be used for solving linear equation systems with the native engine.")
                         .setIsAdvanced()
@@ -38,6 +43,25 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                          .build())
                         .build());
 
+    std::vector<std::string> preconditioner = {"ilu", "diagonal", "none"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, preconditionOptionName, false,
+                                                   "The preconditioning technique used by the Krylov methods of the native engine.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the preconditioning method.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(preconditioner))
+                                         .setDefaultValueString("ilu")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, restartOptionName, false,
+                                                   "The number of iteration until restarted methods are actually restarted.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of iterations.")
+                                         .setDefaultValueUnsignedInteger(50)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false,
                                                    "The maximal number of iterations to perform before iterative solving is aborted.")
                         .setIsAdvanced()
@@ -80,6 +104,22 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, power iteration first operates on a single precision copy of the matrix and then refines the result "
+                                                   "using double precision.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddQuantizationOptionName, false,
+                                                   "If set, the dd engine rounds the values computed by power iteration to multiples of 2^-bits, which keeps "
+                                                   "the number of distinct values in the ADDs small. Lower bounds are rounded down and upper bounds up.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bits", "The number of fractional bits (0 = off).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(0, 52))
+                                         .build())
+                        .build());
 }
 
 bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -111,11 +151,34 @@ storm::solver::NativeLinearEquationSolverMethod NativeEquationSolverSettings::ge
         return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
     } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
         return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+    } else if (linearEquationSystemTechniqueAsString == "bicgstab") {
+        return storm::solver::NativeLinearEquationSolverMethod::Bicgstab;
+    } else if (linearEquationSystemTechniqueAsString == "gmres") {
+        return storm::solver::NativeLinearEquationSolverMethod::Gmres;
+    } else if (linearEquationSystemTechniqueAsString == "multigrid") {
+        return storm::solver::NativeLinearEquationSolverMethod::Multigrid;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
                     "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
 }
 
+storm::solver::NativeLinearEquationSolverPreconditioner NativeEquationSolverSettings::getPreconditioningMethod() const {
+    std::string preconditioningMethodAsString = this->getOption(preconditionOptionName).getArgumentByName("name").getValueAsString();
+    if (preconditioningMethodAsString == "ilu") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::Ilu;
+    } else if (preconditioningMethodAsString == "diagonal") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal;
+    } else if (preconditioningMethodAsString == "none") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::None;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
+                    "Unknown preconditioning technique '" << preconditioningMethodAsString << "' selected.");
+}
+
+uint_fast64_t NativeEquationSolverSettings::getRestartIterationCount() const {
+    return this->getOption(restartOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool NativeEquationSolverSettings::isMaximalIterationCountSet() const {
     return this->getOption(maximalIterationsOptionName).getHasOptionBeenSet();
 }
@@ -159,6 +222,14 @@ bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+bool NativeEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
+uint64_t NativeEquationSolverSettings::getDdQuantizationBits() const {
+    return this->getOption(ddQuantizationOptionName).getArgumentByName("bits").getValueAsUnsignedInteger();
+}
+
 bool NativeEquationSolverSettings::check() const {
     return true;
 }
@@ -44,6 +44,20 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::NativeLinearEquationSolverMethod getLinearEquationSystemMethod() const;
 
+    /*!
+     * Retrieves the method that is to be used for preconditioning the Krylov methods.
+     *
+     * @return The method to use.
+     */
+    storm::solver::NativeLinearEquationSolverPreconditioner getPreconditioningMethod() const;
+
+    /*!
+     * Retrieves the number of iterations after which restarted methods are to be restarted.
+     *
+     * @return The number of iterations after which to restart.
+     */
+    uint_fast64_t getRestartIterationCount() const;
+
     /*!
      * Retrieves whether the maximal iteration count has been set.
      *
@@ -98,6 +112,17 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     bool isForceIntervalIterationSymmetricUpdatesSet() const;
 
+    /*!
+     * Retrieves whether power iteration shall first be performed on a single precision copy of the matrix.
+     */
+    bool isMixedPrecisionSet() const;
+
+    /*!
+     * Retrieves the number of fractional bits to which the dd engine rounds the values computed by power iteration. Zero means that the values
+     * are not rounded.
+     */
+    uint64_t getDdQuantizationBits() const;
+
     /*!
      * Retrieves the multiplication style to use in the power method.
      *
@@ -119,11 +144,15 @@ class NativeEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string techniqueOptionName;
     static const std::string omegaOptionName;
+    static const std::string preconditionOptionName;
+    static const std::string restartOptionName;
     static const std::string maximalIterationsOptionName;
     static const std::string maximalIterationsOptionShortName;
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
+    static const std::string mixedPrecisionOptionName;
+    static const std::string ddQuantizationOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
     static const std::string forceBoundsOptionName;
 };
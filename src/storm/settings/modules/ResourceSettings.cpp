@@ -16,6 +16,13 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::printInstrumentationOptionName = "instrumentation";
+const std::string ResourceSettings::exportInstrumentationOptionName = "exportinstrumentation";
+const std::string ResourceSettings::exportConvergenceTraceOptionName = "exportconvergencetrace";
+const std::string ResourceSettings::hugePagesOptionName = "hugepages";
+const std::string ResourceSettings::numaInterleaveOptionName = "numa-interleave";
+const std::string ResourceSettings::largeArrayDirectoryOptionName = "large-array-dir";
+const std::string ResourceSettings::largeArrayThresholdOptionName = "large-array-threshold";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -28,6 +35,22 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.")
                         .setShortName(printTimeAndMemoryOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, printInstrumentationOptionName, false,
+                                                   "Prints the time spent in the individual phases (e.g. parsing, building, solving) and further counters.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, exportInstrumentationOptionName, false, "Exports the instrumentation timers and counters to a JSON file.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which to write.").build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportConvergenceTraceOptionName, false,
+                                                   "Exports the residuals, bounds and times of all iterations of the iterative solvers to a file "
+                                                   "(JSON lines if the file name ends with .json or .jsonl, CSV otherwise).")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to which to write.").build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, signalWaitingTimeOptionName, false,
                                                    "Specifies how much time can pass until termination when receiving a termination signal.")
                         .setIsAdvanced()
@@ -35,6 +58,27 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hugePagesOptionName, false,
+                                                   "Backs large matrices, bit vectors and solver vectors by transparent huge pages (Linux only).")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numaInterleaveOptionName, false,
+                                                   "Interleaves the pages of large matrices, bit vectors and solver vectors across NUMA nodes (Linux only).")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, largeArrayDirectoryOptionName, false,
+                                                   "Maps large bit vectors from temporary files in the given directory, so they can exceed the main memory.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory of the temporary files.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, largeArrayThresholdOptionName, false,
+                                                   "Sets the size from which on arrays are allocated according to the huge page, NUMA and file options.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bytes", "The number of bytes.")
+                                         .setDefaultValueUnsignedInteger(1ull << 24)
+                                         .build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -49,10 +93,54 @@ bool ResourceSettings::isPrintTimeAndMemorySet() const {
     return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
 }
 
+bool ResourceSettings::isPrintInstrumentationSet() const {
+    return this->getOption(printInstrumentationOptionName).getHasOptionBeenSet();
+}
+
+bool ResourceSettings::isExportInstrumentationSet() const {
+    return this->getOption(exportInstrumentationOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getExportInstrumentationFilename() const {
+    return this->getOption(exportInstrumentationOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool ResourceSettings::isInstrumentationSet() const {
+    return isPrintInstrumentationSet() || isExportInstrumentationSet();
+}
+
+bool ResourceSettings::isExportConvergenceTraceSet() const {
+    return this->getOption(exportConvergenceTraceOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getExportConvergenceTraceFilename() const {
+    return this->getOption(exportConvergenceTraceOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isHugePagesSet() const {
+    return this->getOption(hugePagesOptionName).getHasOptionBeenSet();
+}
+
+bool ResourceSettings::isNumaInterleaveSet() const {
+    return this->getOption(numaInterleaveOptionName).getHasOptionBeenSet();
+}
+
+bool ResourceSettings::isLargeArrayDirectorySet() const {
+    return this->getOption(largeArrayDirectoryOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getLargeArrayDirectory() const {
+    return this->getOption(largeArrayDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint_fast64_t ResourceSettings::getLargeArrayThreshold() const {
+    return this->getOption(largeArrayThresholdOptionName).getArgumentByName("bytes").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
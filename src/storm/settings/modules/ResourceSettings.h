@@ -24,6 +24,48 @@ class ResourceSettings : public ModuleSettings {
      */
     bool isPrintTimeAndMemorySet() const;
 
+    /*!
+     * Retrieves whether the instrumentation timers and counters shall be printed at the end of a run.
+     *
+     * @return True iff the option was set.
+     */
+    bool isPrintInstrumentationSet() const;
+
+    /*!
+     * Retrieves whether the instrumentation timers and counters shall be exported at the end of a run.
+     *
+     * @return True iff the option was set.
+     */
+    bool isExportInstrumentationSet() const;
+
+    /*!
+     * Retrieves the name of the JSON file to which the instrumentation timers and counters are exported.
+     *
+     * @return The name of the file.
+     */
+    std::string getExportInstrumentationFilename() const;
+
+    /*!
+     * Retrieves whether instrumentation timers and counters need to be recorded.
+     *
+     * @return True iff the instrumentation is printed or exported.
+     */
+    bool isInstrumentationSet() const;
+
+    /*!
+     * Retrieves whether the convergence data of the iterative solvers shall be exported.
+     *
+     * @return True iff the option was set.
+     */
+    bool isExportConvergenceTraceSet() const;
+
+    /*!
+     * Retrieves the name of the file to which the convergence data of the iterative solvers is exported.
+     *
+     * @return The name of the file.
+     */
+    std::string getExportConvergenceTraceFilename() const;
+
     /*!
      * Retrieves whether the timeout option was set.
      *
@@ -47,6 +89,41 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether large arrays shall be backed by transparent huge pages.
+     *
+     * @return True iff the option was set.
+     */
+    bool isHugePagesSet() const;
+
+    /*!
+     * Retrieves whether the pages of large arrays shall be interleaved across all NUMA nodes.
+     *
+     * @return True iff the option was set.
+     */
+    bool isNumaInterleaveSet() const;
+
+    /*!
+     * Retrieves whether large arrays shall be mapped from temporary files.
+     *
+     * @return True iff the option was set.
+     */
+    bool isLargeArrayDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which the temporary files backing large arrays are created.
+     *
+     * @return The name of the directory.
+     */
+    std::string getLargeArrayDirectory() const;
+
+    /*!
+     * Retrieves the size (in bytes) from which on arrays are considered large.
+     *
+     * @return The number of bytes.
+     */
+    uint_fast64_t getLargeArrayThreshold() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -57,6 +134,13 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string printInstrumentationOptionName;
+    static const std::string exportInstrumentationOptionName;
+    static const std::string exportConvergenceTraceOptionName;
+    static const std::string hugePagesOptionName;
+    static const std::string numaInterleaveOptionName;
+    static const std::string largeArrayDirectoryOptionName;
+    static const std::string largeArrayThresholdOptionName;
 };
 }  // namespace modules
 }  // namespace settings
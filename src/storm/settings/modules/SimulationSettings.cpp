@@ -0,0 +1,140 @@
+#include "storm/settings/modules/SimulationSettings.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string SimulationSettings::moduleName = "simulation";
+const std::string SimulationSettings::precisionOptionName = "precision";
+const std::string SimulationSettings::precisionOptionShortName = "eps";
+const std::string SimulationSettings::confidenceOptionName = "confidence";
+const std::string SimulationSettings::stoppingCriterionOptionName = "stop";
+const std::string SimulationSettings::seedOptionName = "seed";
+const std::string SimulationSettings::numberOfSimulatorsOptionName = "simulators";
+const std::string SimulationSettings::importanceFunctionOptionName = "importance";
+const std::string SimulationSettings::splittingEffortOptionName = "effort";
+
+SimulationSettings::SimulationSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false,
+                                                   "The maximal distance between the estimated and the actual probability. For bounded probability operators, "
+                                                   "this is the half-width of the indifference region around the threshold.")
+                        .setShortName(precisionOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
+                                         .setDefaultValueDouble(1e-02)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, confidenceOptionName, false, "The probability with which the result has to be correct.")
+            .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence to achieve.")
+                             .setDefaultValueDouble(0.95)
+                             .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                             .build())
+            .build());
+
+    std::vector<std::string> stoppingCriteria = {"chernoff", "wald"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, stoppingCriterionOptionName, true,
+                                                   "Sets the criterion that determines the number of sampled paths for quantitative queries.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the criterion. 'chernoff' samples the number of paths given by the Chernoff-Hoeffding bound while "
+                                         "'wald' stops as soon as the (normal approximation) confidence interval is small enough.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stoppingCriteria))
+                                         .setDefaultValueString("chernoff")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "Sets the seed of the random number generators.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfSimulatorsOptionName, true,
+                                                   "Sets the number of simulators that sample paths independently. If Intel TBB is used, the simulators run in "
+                                                   "multiple threads.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of simulators.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, importanceFunctionOptionName, false,
+                                                   "If set, rare events are estimated by fixed-effort importance splitting. Each integral value of the given "
+                                                   "importance function defines a level. Precision and confidence are ignored in this case.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "expression", "The importance function as an expression over the program variables, e.g., 'x+2*y'.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, splittingEffortOptionName, true,
+                                                   "Sets the number of paths that are sampled in every level of the importance splitting.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of paths per level.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+double SimulationSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SimulationSettings::getConfidence() const {
+    return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+SimulationSettings::StoppingCriterion SimulationSettings::getStoppingCriterion() const {
+    std::string criterionAsString = this->getOption(stoppingCriterionOptionName).getArgumentByName("name").getValueAsString();
+    if (criterionAsString == "chernoff") {
+        return SimulationSettings::StoppingCriterion::Chernoff;
+    } else if (criterionAsString == "wald") {
+        return SimulationSettings::StoppingCriterion::Wald;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown stopping criterion '" << criterionAsString << "'.");
+}
+
+bool SimulationSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t SimulationSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint64_t SimulationSettings::getNumberOfSimulators() const {
+    return this->getOption(numberOfSimulatorsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool SimulationSettings::isImportanceFunctionSet() const {
+    return this->getOption(importanceFunctionOptionName).getHasOptionBeenSet();
+}
+
+std::string SimulationSettings::getImportanceFunction() const {
+    return this->getOption(importanceFunctionOptionName).getArgumentByName("expression").getValueAsString();
+}
+
+uint64_t SimulationSettings::getSplittingEffort() const {
+    return this->getOption(splittingEffortOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool SimulationSettings::check() const {
+    bool optionsSet = this->getOption(precisionOptionName).getHasOptionBeenSet() || this->getOption(confidenceOptionName).getHasOptionBeenSet() ||
+                      this->getOption(stoppingCriterionOptionName).getHasOptionBeenSet() || this->getOption(seedOptionName).getHasOptionBeenSet() ||
+                      this->getOption(numberOfSimulatorsOptionName).getHasOptionBeenSet() ||
+                      this->getOption(importanceFunctionOptionName).getHasOptionBeenSet() || this->getOption(splittingEffortOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Simulation || !optionsSet,
+                        "Simulation engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
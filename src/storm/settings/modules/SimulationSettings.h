@@ -0,0 +1,103 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the simulation engine.
+ */
+class SimulationSettings : public ModuleSettings {
+   public:
+    // The available methods to decide when enough paths have been sampled.
+    enum class StoppingCriterion { Chernoff, Wald };
+
+    /*!
+     * Creates a new set of simulation settings.
+     */
+    SimulationSettings();
+
+    /*!
+     * Retrieves the maximal distance between the estimated and the actual probability.
+     *
+     * @return The precision of the estimation.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves the probability with which the estimation has to respect the precision.
+     *
+     * @return The confidence of the estimation.
+     */
+    double getConfidence() const;
+
+    /*!
+     * Retrieves the criterion that determines the number of sampled paths for quantitative queries.
+     *
+     * @return The stopping criterion.
+     */
+    StoppingCriterion getStoppingCriterion() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generators was given.
+     *
+     * @return True iff a seed was given.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generators.
+     *
+     * @return The seed.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves the number of simulators that sample paths independently.
+     *
+     * @return The number of simulators.
+     */
+    uint64_t getNumberOfSimulators() const;
+
+    /*!
+     * Retrieves whether an importance function for importance splitting was given.
+     *
+     * @return True iff an importance function was given.
+     */
+    bool isImportanceFunctionSet() const;
+
+    /*!
+     * Retrieves the importance function (as an expression over the program variables) for importance splitting.
+     *
+     * @return The importance function.
+     */
+    std::string getImportanceFunction() const;
+
+    /*!
+     * Retrieves the number of paths that are sampled for every level of the importance splitting.
+     *
+     * @return The number of paths per level.
+     */
+    uint64_t getSplittingEffort() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string precisionOptionName;
+    static const std::string precisionOptionShortName;
+    static const std::string confidenceOptionName;
+    static const std::string stoppingCriterionOptionName;
+    static const std::string seedOptionName;
+    static const std::string numberOfSimulatorsOptionName;
+    static const std::string importanceFunctionOptionName;
+    static const std::string splittingEffortOptionName;
+};
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
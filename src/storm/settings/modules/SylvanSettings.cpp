@@ -14,6 +14,14 @@ namespace modules {
 const std::string SylvanSettings::moduleName = "sylvan";
 const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
 const std::string SylvanSettings::threadCountOptionName = "threads";
+const std::string SylvanSettings::reorderOptionName = "dynreorder";
+const std::string SylvanSettings::reorderThresholdOptionName = "reorderthreshold";
+const std::string SylvanSettings::reorderGrowthOptionName = "reordergrowth";
+const std::string SylvanSettings::reorderMaxGrowthOptionName = "reordermaxgrowth";
+const std::string SylvanSettings::tableRatioOptionName = "tableratio";
+const std::string SylvanSettings::initialTableRatioOptionName = "initratio";
+const std::string SylvanSettings::tableGrowthOptionName = "growth";
+const std::string SylvanSettings::statisticsOptionName = "stats";
 
 SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.")
@@ -28,6 +36,69 @@ SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                                          "value", "The number of threads available to Sylvan (0 means 'auto-detect').")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, reorderOptionName, false,
+                                                   "Sets whether dynamic reordering (by sifting the DD variables) is allowed.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, reorderThresholdOptionName, true,
+                                                   "Sets the number of nodes in the node table at which the first dynamic reordering is triggered.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of nodes.")
+                                         .setDefaultValueUnsignedInteger(1ull << 20)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, reorderGrowthOptionName, true,
+                                                   "Sets the factor by which the node table needs to grow before the next dynamic reordering is triggered.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The growth factor.")
+                                         .setDefaultValueDouble(2.0)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, reorderMaxGrowthOptionName, true,
+                                                   "Sets the factor by which the DDs may grow while sifting a variable before the direction is abandoned.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The maximal growth factor.")
+                                         .setDefaultValueDouble(1.2)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, tableRatioOptionName, true,
+                                                   "Sets the binary logarithm of the ratio between the sizes of the node table and the operation cache.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument(
+                                         "value", "The logarithm of the ratio (positive values give a larger node table, negative ones a larger cache).")
+                                         .setDefaultValueInteger(0)
+                                         .addValidatorInteger(ArgumentValidatorFactory::createIntegerRangeValidatorExcluding(-11, 11))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, initialTableRatioOptionName, true,
+                                                   "Sets the binary logarithm of the factor by which the tables are initially smaller than their maximal size.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The logarithm of the factor.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(0, 40))
+                                         .build())
+                        .build());
+    std::vector<std::string> growthPolicies = {"aggressive", "normal"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, tableGrowthOptionName, true,
+                                                   "Sets when the tables are grown during garbage collections (only relevant if they start out small).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "policy", "The growth policy ('aggressive' grows in every collection, 'normal' only if the node table is half full).")
+                                         .setDefaultValueString("aggressive")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(growthPolicies))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, statisticsOptionName, false,
+                                                   "If set, statistics about the tables, garbage collections and operations of Sylvan are printed.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "interval", "The minimal number of seconds between two reports (0 means only report at the end).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -42,6 +113,42 @@ uint_fast64_t SylvanSettings::getNumberOfThreads() const {
     return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+bool SylvanSettings::isReorderingEnabled() const {
+    return this->getOption(reorderOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t SylvanSettings::getReorderingThreshold() const {
+    return this->getOption(reorderThresholdOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+double SylvanSettings::getReorderingGrowth() const {
+    return this->getOption(reorderGrowthOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SylvanSettings::getReorderingMaximalGrowth() const {
+    return this->getOption(reorderMaxGrowthOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+int_fast64_t SylvanSettings::getTableRatio() const {
+    return this->getOption(tableRatioOptionName).getArgumentByName("value").getValueAsInteger();
+}
+
+uint_fast64_t SylvanSettings::getInitialTableRatio() const {
+    return this->getOption(initialTableRatioOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+bool SylvanSettings::isAggressiveTableGrowthSet() const {
+    return this->getOption(tableGrowthOptionName).getArgumentByName("policy").getValueAsString() == "aggressive";
+}
+
+bool SylvanSettings::isStatisticsSet() const {
+    return this->getOption(statisticsOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t SylvanSettings::getStatisticsInterval() const {
+    return this->getOption(statisticsOptionName).getArgumentByName("interval").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
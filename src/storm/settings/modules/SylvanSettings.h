@@ -37,6 +37,74 @@ class SylvanSettings : public ModuleSettings {
      */
     bool isNumberOfThreadsSet() const;
 
+    /*!
+     * Retrieves whether the option enabling dynamic reordering is set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isReorderingEnabled() const;
+
+    /*!
+     * Retrieves the number of nodes in the node table at which the first dynamic reordering is triggered.
+     *
+     * @return The number of nodes.
+     */
+    uint_fast64_t getReorderingThreshold() const;
+
+    /*!
+     * Retrieves the factor by which the node table needs to grow after a reordering before the next dynamic reordering is triggered.
+     *
+     * @return The growth factor.
+     */
+    double getReorderingGrowth() const;
+
+    /*!
+     * Retrieves the factor by which the DDs may grow while a variable is moved during sifting before moving it further in the same
+     * direction is given up.
+     *
+     * @return The maximal growth factor.
+     */
+    double getReorderingMaximalGrowth() const;
+
+    /*!
+     * Retrieves the binary logarithm of the ratio between the sizes of the node table and the operation cache. Positive values make the
+     * node table larger than the cache and negative values make the cache larger than the node table.
+     *
+     * @return The logarithm of the ratio.
+     */
+    int_fast64_t getTableRatio() const;
+
+    /*!
+     * Retrieves the binary logarithm of the factor by which the node table and the operation cache are initially smaller than their maximal
+     * size. The tables are grown during garbage collections.
+     *
+     * @return The logarithm of the factor.
+     */
+    uint_fast64_t getInitialTableRatio() const;
+
+    /*!
+     * Retrieves whether the tables are to be grown aggressively, i.e. during every garbage collection until they reach their maximal size,
+     * instead of only when more than half of the node table is in use after the garbage collection.
+     *
+     * @return True iff the tables are to be grown aggressively.
+     */
+    bool isAggressiveTableGrowthSet() const;
+
+    /*!
+     * Retrieves whether statistics about the usage of Sylvan are to be gathered and printed.
+     *
+     * @return True iff the option was set.
+     */
+    bool isStatisticsSet() const;
+
+    /*!
+     * Retrieves the minimal number of seconds between two reports of the statistics while Sylvan is in use. Zero means that the statistics
+     * are only reported when Sylvan is shut down.
+     *
+     * @return The number of seconds.
+     */
+    uint_fast64_t getStatisticsInterval() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -44,6 +112,14 @@ class SylvanSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string maximalMemoryOptionName;
     static const std::string threadCountOptionName;
+    static const std::string reorderOptionName;
+    static const std::string reorderThresholdOptionName;
+    static const std::string reorderGrowthOptionName;
+    static const std::string reorderMaxGrowthOptionName;
+    static const std::string tableRatioOptionName;
+    static const std::string initialTableRatioOptionName;
+    static const std::string tableGrowthOptionName;
+    static const std::string statisticsOptionName;
 };
 
 }  // namespace modules
@@ -16,6 +16,8 @@ const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+const std::string TimeBoundedSolverSettings::adaptiveUniformizationOptionName = "adaptiveunif";
+const std::string TimeBoundedSolverSettings::steadyStateDetectionOptionName = "ssdetection";
 
 TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> maMethods = {"imca", "unifplus"};
@@ -48,6 +50,19 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                              .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                              .build())
             .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveUniformizationOptionName, false,
+                                                   "Sets whether the uniformization rate of transient analysis on CTMCs follows the states that are reachable "
+                                                   "within the current number of steps (instead of the maximal exit rate). Only applied if the relevant states "
+                                                   "are known.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, steadyStateDetectionOptionName, false,
+                                                   "Sets whether transient analysis on CTMCs stops as soon as the values do not change anymore. Results are "
+                                                   "not guaranteed to be sound.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -79,6 +94,14 @@ double TimeBoundedSolverSettings::getUnifPlusKappa() const {
     return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
 }
 
+bool TimeBoundedSolverSettings::isAdaptiveUniformizationSet() const {
+    return this->getOption(adaptiveUniformizationOptionName).getHasOptionBeenSet();
+}
+
+bool TimeBoundedSolverSettings::isSteadyStateDetectionSet() const {
+    return this->getOption(steadyStateDetectionOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
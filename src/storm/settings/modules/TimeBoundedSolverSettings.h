@@ -50,6 +50,16 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     double getUnifPlusKappa() const;
 
+    /*!
+     * Retrieves whether adaptive uniformization is to be used for transient analysis of CTMCs.
+     */
+    bool isAdaptiveUniformizationSet() const;
+
+    /*!
+     * Retrieves whether the series of uniformization steps may be truncated as soon as a steady state is detected.
+     */
+    bool isSteadyStateDetectionSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -58,6 +68,8 @@ class TimeBoundedSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
+    static const std::string adaptiveUniformizationOptionName;
+    static const std::string steadyStateDetectionOptionName;
 };
 
 }  // namespace modules
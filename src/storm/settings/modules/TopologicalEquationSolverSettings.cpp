@@ -23,6 +23,7 @@ namespace modules {
 const std::string TopologicalEquationSolverSettings::moduleName = "topological";
 const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+const std::string TopologicalEquationSolverSettings::parallelOptionName = "parallel";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -36,7 +37,8 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                         .build());
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi", "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",      "ratsearch",
-        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi"};
+        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi", "avi",
+        "asynchronous-value-iteration", "pvi", "prioritized-value-iteration"};
     this->addOption(storm::settings::OptionBuilder(moduleName, underlyingMinMaxMethodOptionName, true,
                                                    "Sets which minmax method is considered for solving the underlying minmax equation systems.")
                         .setIsAdvanced()
@@ -45,6 +47,10 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                                          .setDefaultValueString("value-iteration")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelOptionName, false,
+                                                   "If set, SCCs that do not depend on each other are solved concurrently. Requires Intel TBB.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -97,11 +103,19 @@ storm::solver::MinMaxMethod TopologicalEquationSolverSettings::getUnderlyingMinM
         return storm::solver::MinMaxMethod::OptimisticValueIteration;
     } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
         return storm::solver::MinMaxMethod::ViToPi;
+    } else if (minMaxEquationSolvingTechnique == "asynchronous-value-iteration" || minMaxEquationSolvingTechnique == "avi") {
+        return storm::solver::MinMaxMethod::AsynchronousValueIteration;
+    } else if (minMaxEquationSolvingTechnique == "prioritized-value-iteration" || minMaxEquationSolvingTechnique == "pvi") {
+        return storm::solver::MinMaxMethod::PrioritizedValueIteration;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
 }
 
+bool TopologicalEquationSolverSettings::isParallelSet() const {
+    return this->getOption(parallelOptionName).getHasOptionBeenSet();
+}
+
 bool TopologicalEquationSolverSettings::check() const {
     if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
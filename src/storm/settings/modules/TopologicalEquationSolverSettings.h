@@ -60,6 +60,13 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves whether independent SCCs are supposed to be solved concurrently.
+     *
+     * @return True iff the option was set.
+     */
+    bool isParallelSet() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +76,7 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string parallelOptionName;
 };
 
 }  // namespace modules
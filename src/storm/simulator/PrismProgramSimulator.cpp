@@ -30,6 +30,7 @@ void DiscreteTimePrismProgramSimulator<ValueType>::setSeed(uint64_t newSeed) {
 
 template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::step(uint64_t actionNumber) {
+    expandIfNecessary();
     uint32_t nextState = behavior.getChoices()[actionNumber].sampleFromDistribution(generator.random());
     lastActionRewards = behavior.getChoices()[actionNumber].getRewards();
     STORM_LOG_ASSERT(lastActionRewards.size() == stateGenerator->getNumberOfRewardModels(), "Reward vector should have as many rewards as model.");
@@ -47,6 +48,7 @@ bool DiscreteTimePrismProgramSimulator<ValueType>::explore() {
     // TODO: This low-level code currently expands all actions, while this is not necessary.
     // However, using the next state generator ensures compatibliity with the model generator.
     behavior = stateGenerator->expand(stateToIdCallback);
+    behaviorValid = true;
     STORM_LOG_ASSERT(behavior.getStateRewards().size() == lastActionRewards.size(), "Reward vectors should have same length.");
     for (uint64_t i = 0; i < behavior.getStateRewards().size(); i++) {
         lastActionRewards[i] += behavior.getStateRewards()[i];
@@ -54,8 +56,30 @@ bool DiscreteTimePrismProgramSimulator<ValueType>::explore() {
     return true;
 }
 
+template<typename ValueType>
+bool DiscreteTimePrismProgramSimulator<ValueType>::sampleStep() {
+    if (!stateGenerator->sampleSuccessor(randomCallback, sampledState, &lastActionRewards)) {
+        return false;
+    }
+    std::swap(currentState, sampledState);
+    stateGenerator->load(currentState);
+    stateGenerator->addStateRewardsInCurrentState(lastActionRewards);
+    behaviorValid = false;
+    return true;
+}
+
+template<typename ValueType>
+void DiscreteTimePrismProgramSimulator<ValueType>::expandIfNecessary() const {
+    if (!behaviorValid) {
+        clearStateCaches();
+        behavior = stateGenerator->expand(stateToIdCallback);
+        behaviorValid = true;
+    }
+}
+
 template<typename ValueType>
 bool DiscreteTimePrismProgramSimulator<ValueType>::isSinkState() const {
+    expandIfNecessary();
     if (behavior.empty()) {
         return true;
     }
@@ -85,8 +109,19 @@ std::vector<std::string> DiscreteTimePrismProgramSimulator<ValueType>::getCurren
     return labels;
 }
 
+template<typename ValueType>
+bool DiscreteTimePrismProgramSimulator<ValueType>::evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const {
+    return stateGenerator->evaluateBooleanExpressionInCurrentState(expression);
+}
+
+template<typename ValueType>
+ValueType DiscreteTimePrismProgramSimulator<ValueType>::evaluateRationalExpressionInCurrentState(storm::expressions::Expression const& expression) const {
+    return stateGenerator->evaluateRationalExpressionInCurrentState(expression);
+}
+
 template<typename ValueType>
 std::vector<generator::Choice<ValueType, uint32_t>> const& DiscreteTimePrismProgramSimulator<ValueType>::getChoices() const {
+    expandIfNecessary();
     return behavior.getChoices();
 }
 
@@ -167,7 +202,7 @@ uint32_t DiscreteTimePrismProgramSimulator<ValueType>::getOrAddStateIndex(genera
 }
 
 template<typename ValueType>
-void DiscreteTimePrismProgramSimulator<ValueType>::clearStateCaches() {
+void DiscreteTimePrismProgramSimulator<ValueType>::clearStateCaches() const {
     idToState.clear();
     stateToId = storm::storage::BitVectorHashMap<uint32_t>(stateGenerator->getStateSize());
 }
@@ -3,6 +3,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/prism/Program.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/random.h"
 
 namespace storm {
@@ -18,6 +19,8 @@ namespace simulator {
  * On the other hand, this simulator is convenient for stepping through the model
  * as it potentially allows considering the next states.
  * Thus, while a performant alternative would be great, this simulator has its own merits.
+ * For simulation-heavy applications, sampleStep provides a path that samples the successor directly, and the choices of a state are then
+ * only computed when they are requested.
  *
  * @tparam ValueType
  */
@@ -52,6 +55,16 @@ class DiscreteTimePrismProgramSimulator {
      * @return true, if this action can be taken.
      */
     bool step(uint64_t actionNumber);
+    /**
+     * Make a step in which the successor is sampled directly from the program, i.e., without computing the choices of the current state.
+     * The choice is selected uniformly among the enabled choices (which resolves nondeterminism uniformly) and the update according to its
+     * likelihood. Apart from the first call, this does not allocate memory.
+     * The last rewards are the state-action rewards of the sampled choice plus the state rewards of the successor. For a state of a DTMC with
+     * overlapping guards, step instead yields the average over the choices, which has the same expectation.
+     *
+     * @return false, if the current state is terminal or has no enabled choice. The state is then not changed.
+     */
+    bool sampleStep();
     /**
      * Accessor for the last state action reward and the current state reward, added together.
      * @return A vector with te number of rewards.
@@ -60,6 +73,20 @@ class DiscreteTimePrismProgramSimulator {
     generator::CompressedState const& getCurrentState() const;
     expressions::SimpleValuation getCurrentStateAsValuation() const;
     std::vector<std::string> getCurrentStateLabelling() const;
+    /**
+     * Evaluate an expression over the program variables in the current state.
+     *
+     * @param expression The expression, e.g., obtained from a state formula.
+     * @return true, if the expression holds in the current state.
+     */
+    bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const;
+    /**
+     * Evaluate a numerical expression over the program variables in the current state.
+     *
+     * @param expression The expression.
+     * @return The value of the expression in the current state.
+     */
+    ValueType evaluateRationalExpressionInCurrentState(storm::expressions::Expression const& expression) const;
 
     storm::json<ValueType> getStateAsJson() const;
 
@@ -84,7 +111,11 @@ class DiscreteTimePrismProgramSimulator {
 
    protected:
     bool explore();
-    void clearStateCaches();
+    /**
+     * Computes the choices of the current state if this was not done since the last call to sampleStep.
+     */
+    void expandIfNecessary() const;
+    void clearStateCaches() const;
     /**
      * Helper function for (temp) storing states.
      */
@@ -97,7 +128,11 @@ class DiscreteTimePrismProgramSimulator {
     /// Generator for the next states
     std::shared_ptr<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>> stateGenerator;
     /// Obtained behavior of a state
-    generator::StateBehavior<ValueType> behavior;
+    mutable generator::StateBehavior<ValueType> behavior;
+    /// Whether the behavior belongs to the current state (it is not computed by sampleStep).
+    mutable bool behaviorValid = false;
+    /// Buffer for the successor in sampleStep.
+    generator::CompressedState sampledState;
     /// Helper for last action reward construction
     std::vector<ValueType> zeroRewards;
     /// Stores the action rewards from the last action.
@@ -105,14 +140,16 @@ class DiscreteTimePrismProgramSimulator {
     /// Random number generator
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
     /// Data structure to temp store states.
-    storm::storage::BitVectorHashMap<uint32_t> stateToId;
+    mutable storm::storage::BitVectorHashMap<uint32_t> stateToId;
 
-    std::unordered_map<uint32_t, generator::CompressedState> idToState;
+    mutable std::unordered_map<uint32_t, generator::CompressedState> idToState;
 
    private:
     // Create a callback for the next-state generator to enable it to request the index of states.
     std::function<uint32_t(generator::CompressedState const&)> stateToIdCallback =
         std::bind(&DiscreteTimePrismProgramSimulator<ValueType>::getOrAddStateIndex, this, std::placeholders::_1);
+    // Draws the random numbers with which the next-state generator samples successors.
+    std::function<double()> randomCallback = [this]() { return storm::utility::convertNumber<double>(generator.random()); };
 };
 }  // namespace simulator
 }  // namespace storm
@@ -7,6 +7,8 @@
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -15,10 +17,14 @@ namespace storm {
 namespace solver {
 
 template<typename ValueType>
-AbstractEquationSolver<ValueType>::AbstractEquationSolver() {
+AbstractEquationSolver<ValueType>::AbstractEquationSolver() : convergenceTraceSolve(0) {
     if (storm::settings::getModule<storm::settings::modules::GeneralSettings>().isVerboseSet()) {
         this->progressMeasurement = storm::utility::ProgressMeasurement("iterations");
     }
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resourceSettings.isExportConvergenceTraceSet()) {
+        this->convergenceTrace = ConvergenceTrace::getTraceForFile(resourceSettings.getExportConvergenceTraceFilename());
+    }
 }
 
 template<typename ValueType>
@@ -265,14 +271,14 @@ void AbstractEquationSolver<ValueType>::createUpperBoundsVector(std::vector<Valu
 }
 
 template<typename ValueType>
-void AbstractEquationSolver<ValueType>::createUpperBoundsVector(std::unique_ptr<std::vector<ValueType>>& upperBoundsVector, uint64_t length) const {
+void AbstractEquationSolver<ValueType>::createUpperBoundsVector(SolverWorkspace::VectorPointer<ValueType>& upperBoundsVector, uint64_t length) const {
     STORM_LOG_ASSERT(this->hasUpperBound(), "Expecting upper bound(s).");
     if (!upperBoundsVector) {
         if (this->hasUpperBound(BoundType::Local)) {
             STORM_LOG_ASSERT(length == this->getUpperBounds().size(), "Mismatching sizes.");
-            upperBoundsVector = std::make_unique<std::vector<ValueType>>(this->getUpperBounds());
+            upperBoundsVector.reset(new std::vector<ValueType>(this->getUpperBounds()));
         } else {
-            upperBoundsVector = std::make_unique<std::vector<ValueType>>(length, this->getUpperBound());
+            upperBoundsVector.reset(new std::vector<ValueType>(length, this->getUpperBound()));
         }
     } else {
         createUpperBoundsVector(*upperBoundsVector);
@@ -307,9 +313,56 @@ void AbstractEquationSolver<ValueType>::showProgressIterative(uint64_t iteration
     }
 }
 
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::setConvergenceTrace(std::shared_ptr<ConvergenceTrace> const& trace) {
+    this->convergenceTrace = trace;
+    this->convergenceTraceSolve = 0;
+}
+
+template<typename ValueType>
+bool AbstractEquationSolver<ValueType>::isConvergenceTraceSet() const {
+    return static_cast<bool>(this->convergenceTrace);
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::startConvergenceTrace(std::string const& method) const {
+    if (this->convergenceTrace) {
+        this->convergenceTraceMethod = method;
+        this->convergenceTraceSolve = this->convergenceTrace->startSolve();
+        this->convergenceTraceTime = std::chrono::high_resolution_clock::now();
+    }
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::traceIteration(uint64_t iteration, boost::optional<ValueType> const& residual,
+                                                       boost::optional<ValueType> const& lowerBound, boost::optional<ValueType> const& upperBound,
+                                                       boost::optional<uint64_t> const& schedulerChanges) const {
+    if (!this->convergenceTrace || this->convergenceTraceSolve == 0) {
+        return;
+    }
+    auto now = std::chrono::high_resolution_clock::now();
+    uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(now - this->convergenceTraceTime).count();
+    this->convergenceTraceTime = now;
+
+    ConvergenceTrace::Record record(iteration);
+    if (residual) {
+        record.residual = storm::utility::convertNumber<double>(residual.get());
+    }
+    if (lowerBound) {
+        record.lowerBound = storm::utility::convertNumber<double>(lowerBound.get());
+    }
+    if (upperBound) {
+        record.upperBound = storm::utility::convertNumber<double>(upperBound.get());
+    }
+    record.schedulerChanges = schedulerChanges;
+    this->convergenceTrace->addRecord(this->convergenceTraceSolve, this->convergenceTraceMethod, nanoseconds, record);
+}
+
 template<typename ValueType>
 void AbstractEquationSolver<ValueType>::reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations) const {
     if (iterations) {
+        static storm::utility::Instrumentation::Counter& iterationCounter = storm::utility::Instrumentation::instance().getCounter("solver.iterations");
+        storm::utility::incrementCounter(iterationCounter, iterations.get());
         switch (status) {
             case SolverStatus::Converged:
                 STORM_LOG_TRACE("Iterative solver converged after " << iterations.get() << " iterations.");
@@ -5,8 +5,11 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <string>
 
+#include "storm/solver/ConvergenceTrace.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/SolverWorkspace.h"
 #include "storm/solver/TerminationCondition.h"
 #include "storm/utility/ProgressMeasurement.h"
 
@@ -190,6 +193,18 @@ class AbstractEquationSolver {
      */
     void showProgressIterative(uint64_t iterations, boost::optional<uint64_t> const& bound = boost::none) const;
 
+    /*!
+     * Sets the trace to which the convergence data of this solver is written. By default, the trace given via the settings (if any) is used.
+     *
+     * @param trace The trace or null if no convergence data is to be written.
+     */
+    void setConvergenceTrace(std::shared_ptr<ConvergenceTrace> const& trace);
+
+    /*!
+     * Retrieves whether the convergence data of this solver is written to a trace.
+     */
+    bool isConvergenceTraceSet() const;
+
    protected:
     /*!
      * Retrieves the custom termination condition (if any was set).
@@ -200,7 +215,7 @@ class AbstractEquationSolver {
     std::unique_ptr<TerminationCondition<ValueType>> const& getTerminationConditionPointer() const;
 
     void createUpperBoundsVector(std::vector<ValueType>& upperBoundsVector) const;
-    void createUpperBoundsVector(std::unique_ptr<std::vector<ValueType>>& upperBoundsVector, uint64_t length) const;
+    void createUpperBoundsVector(SolverWorkspace::VectorPointer<ValueType>& upperBoundsVector, uint64_t length) const;
     void createLowerBoundsVector(std::vector<ValueType>& lowerBoundsVector) const;
 
     /*!
@@ -232,6 +247,25 @@ class AbstractEquationSolver {
      */
     SolverStatus updateStatus(SolverStatus status, bool earlyTermination, uint64_t iterations, uint64_t maximalNumberOfIterations) const;
 
+    /*!
+     * Announces a new solve to the convergence trace (if any). The iterations traced afterwards are attributed to this solve.
+     * @param method The name of the solution method.
+     */
+    void startConvergenceTrace(std::string const& method) const;
+
+    /*!
+     * Writes the data of an iteration of the current solve to the convergence trace (if any and if a solve was started). The time of the
+     * iteration is measured since the previously traced iteration (or the start of the solve).
+     * Since computing the data might be expensive, callers should check isConvergenceTraceSet() first.
+     * @param iteration The index of the iteration.
+     * @param residual The maximal difference between the last two iterates or between the lower and upper bound (if known).
+     * @param lowerBound A lower bound on the solution (if known).
+     * @param upperBound An upper bound on the solution (if known).
+     * @param schedulerChanges The number of choices that were changed in this iteration (if applicable).
+     */
+    void traceIteration(uint64_t iteration, boost::optional<ValueType> const& residual, boost::optional<ValueType> const& lowerBound = boost::none,
+                        boost::optional<ValueType> const& upperBound = boost::none, boost::optional<uint64_t> const& schedulerChanges = boost::none) const;
+
     // A termination condition to be used (can be unset).
     std::unique_ptr<TerminationCondition<ValueType>> terminationCondition;
 
@@ -253,6 +287,16 @@ class AbstractEquationSolver {
    private:
     // Indicates the progress of this solver.
     mutable boost::optional<storm::utility::ProgressMeasurement> progressMeasurement;
+
+    // The trace to which the convergence data is written (if any).
+    std::shared_ptr<ConvergenceTrace> convergenceTrace;
+
+    // The method and the index of the traced solve (where zero means that no solve was started).
+    mutable std::string convergenceTraceMethod;
+    mutable uint64_t convergenceTraceSolve;
+
+    // The time at which the previously traced iteration ended.
+    mutable std::chrono::high_resolution_clock::time_point convergenceTraceTime;
 };
 
 }  // namespace solver
@@ -0,0 +1,114 @@
+#include "storm/solver/ConvergenceTrace.h"
+
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "storm/io/file.h"
+
+namespace storm {
+namespace solver {
+
+namespace detail {
+bool endsWith(std::string const& string, std::string const& suffix) {
+    return string.size() >= suffix.size() && string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Writes the given value as a CSV field (which is left empty if the value is unknown or not finite).
+template<typename T>
+void writeCsvField(std::ostream& out, boost::optional<T> const& value) {
+    out << ',';
+    if (value && std::isfinite(static_cast<double>(value.get()))) {
+        out << value.get();
+    }
+}
+
+// Writes the given value as a JSON member (which is omitted if the value is unknown). JSON has no representation of non-finite numbers.
+template<typename T>
+void writeJsonMember(std::ostream& out, std::string const& name, boost::optional<T> const& value) {
+    if (value) {
+        out << ",\"" << name << "\":";
+        if (std::isfinite(static_cast<double>(value.get()))) {
+            out << value.get();
+        } else {
+            out << "null";
+        }
+    }
+}
+}  // namespace detail
+
+ConvergenceTrace::ConvergenceTrace(std::string const& filename)
+    : out(file), format(detail::endsWith(filename, ".json") || detail::endsWith(filename, ".jsonl") ? Format::Json : Format::Csv), numberOfSolves(0) {
+    storm::utility::openFile(filename, file);
+    writeHeader();
+}
+
+ConvergenceTrace::ConvergenceTrace(std::ostream& out, Format format) : out(out), format(format), numberOfSolves(0) {
+    writeHeader();
+}
+
+ConvergenceTrace::~ConvergenceTrace() {
+    if (file.is_open()) {
+        storm::utility::closeFile(file);
+    } else {
+        out.flush();
+    }
+}
+
+std::shared_ptr<ConvergenceTrace> ConvergenceTrace::getTraceForFile(std::string const& filename) {
+    // The traces stay open until the program terminates, such that the solves of all solvers end up in the same file.
+    static std::mutex tracesMutex;
+    static std::map<std::string, std::shared_ptr<ConvergenceTrace>> traces;
+    std::lock_guard<std::mutex> lock(tracesMutex);
+    auto& trace = traces[filename];
+    if (!trace) {
+        trace = std::make_shared<ConvergenceTrace>(filename);
+    }
+    return trace;
+}
+
+uint64_t ConvergenceTrace::startSolve() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ++numberOfSolves;
+}
+
+void ConvergenceTrace::addRecord(uint64_t solve, std::string const& method, uint64_t nanoseconds, Record const& record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (format == Format::Csv) {
+        out << solve << ',' << method << ',' << record.iteration;
+        detail::writeCsvField(out, record.residual);
+        detail::writeCsvField(out, record.lowerBound);
+        detail::writeCsvField(out, record.upperBound);
+        out << ',' << nanoseconds;
+        detail::writeCsvField(out, record.schedulerChanges);
+    } else {
+        out << "{\"solve\":" << solve << ",\"method\":\"" << method << "\",\"iteration\":" << record.iteration;
+        detail::writeJsonMember(out, "residual", record.residual);
+        detail::writeJsonMember(out, "lower", record.lowerBound);
+        detail::writeJsonMember(out, "upper", record.upperBound);
+        out << ",\"time_ns\":" << nanoseconds;
+        detail::writeJsonMember(out, "scheduler_changes", record.schedulerChanges);
+        out << '}';
+    }
+    // Avoid std::endl, which would flush the stream after every record.
+    out << '\n';
+}
+
+void ConvergenceTrace::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    out.flush();
+}
+
+ConvergenceTrace::Format ConvergenceTrace::getFormat() const {
+    return format;
+}
+
+void ConvergenceTrace::writeHeader() {
+    out.precision(std::numeric_limits<double>::max_digits10);
+    if (format == Format::Csv) {
+        out << "solve,method,iteration,residual,lower,upper,time_ns,scheduler_changes\n";
+    }
+}
+
+}  // namespace solver
+}  // namespace storm
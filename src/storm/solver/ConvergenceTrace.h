@@ -0,0 +1,106 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace storm {
+namespace solver {
+
+/*!
+ * A sink for machine-readable convergence data of iterative solvers. Each record describes a single iteration of a solver invocation (a "solve"),
+ * e.g. its residual, the bounds on the solution that are known after the iteration and the time the iteration took.
+ *
+ * The records are written either as CSV (one row per record, with a header) or as JSON lines (one object per line), such that traces of long runs
+ * can be streamed to a file without keeping them in memory. Unknown fields are left empty (CSV) or omitted (JSON).
+ */
+class ConvergenceTrace {
+   public:
+    enum class Format { Csv, Json };
+
+    /*!
+     * The data recorded for a single iteration.
+     */
+    struct Record {
+        Record(uint64_t iteration) : iteration(iteration) {
+            // Intentionally left empty.
+        }
+
+        // The index of the iteration within the solve (starting with one).
+        uint64_t iteration;
+        // The maximal absolute difference between two successive iterates or between the lower and the upper bound.
+        boost::optional<double> residual;
+        // A lower bound on the solution (at the relevant values) known after the iteration.
+        boost::optional<double> lowerBound;
+        // An upper bound on the solution (at the relevant values) known after the iteration.
+        boost::optional<double> upperBound;
+        // The number of states whose choice was changed in the iteration (policy iteration only).
+        boost::optional<uint64_t> schedulerChanges;
+    };
+
+    /*!
+     * Creates a trace that writes to the given file. The format is JSON lines if the file name ends with ".json" or ".jsonl" and CSV otherwise.
+     */
+    ConvergenceTrace(std::string const& filename);
+
+    /*!
+     * Creates a trace that writes to the given stream in the given format. The stream has to outlive the trace.
+     */
+    ConvergenceTrace(std::ostream& out, Format format);
+
+    ~ConvergenceTrace();
+
+    ConvergenceTrace(ConvergenceTrace const&) = delete;
+    ConvergenceTrace& operator=(ConvergenceTrace const&) = delete;
+
+    /*!
+     * Retrieves the trace writing to the given file, which is shared by all solvers that trace to this file.
+     */
+    static std::shared_ptr<ConvergenceTrace> getTraceForFile(std::string const& filename);
+
+    /*!
+     * Announces a new solve.
+     *
+     * @return The index of the solve that is to be used for its records.
+     */
+    uint64_t startSolve();
+
+    /*!
+     * Writes the given record.
+     *
+     * @param solve The index of the solve the record belongs to.
+     * @param method The name of the solution method.
+     * @param nanoseconds The time that the iteration took.
+     */
+    void addRecord(uint64_t solve, std::string const& method, uint64_t nanoseconds, Record const& record);
+
+    /*!
+     * Writes all buffered records.
+     */
+    void flush();
+
+    Format getFormat() const;
+
+   private:
+    void writeHeader();
+
+    mutable std::mutex mutex;
+
+    // The file stream (if the trace writes to a file).
+    std::ofstream file;
+
+    // The stream to which the records are written.
+    std::ostream& out;
+
+    Format format;
+
+    // The number of solves that were started.
+    uint64_t numberOfSolves;
+};
+
+}  // namespace solver
+}  // namespace storm
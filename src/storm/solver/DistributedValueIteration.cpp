@@ -0,0 +1,172 @@
+#include "storm/solver/DistributedValueIteration.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/numerical.h"
+
+namespace storm {
+namespace solver {
+
+DistributedValueIteration::DistributedValueIteration(storm::storage::DistributedSparseMatrix const& matrix)
+    : matrix(matrix), precision(1e-6), relative(true), maximalNumberOfIterations(20000), numberOfIterations(0) {
+    // Intentionally left empty.
+}
+
+void DistributedValueIteration::setPrecision(double precision) {
+    this->precision = precision;
+}
+
+void DistributedValueIteration::setRelative(bool relative) {
+    this->relative = relative;
+}
+
+void DistributedValueIteration::setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations) {
+    this->maximalNumberOfIterations = maximalNumberOfIterations;
+}
+
+std::vector<double> DistributedValueIteration::computeReachabilityProbabilities(storm::storage::BitVector const& localTargetStates,
+                                                                                boost::optional<storm::OptimizationDirection> const& direction) {
+    storm::storage::SparseMatrix<double> const& localMatrix = matrix.getLocalMatrix();
+    uint64_t numberOfLocalStates = matrix.getNumberOfLocalStates();
+    STORM_LOG_THROW(localTargetStates.size() == numberOfLocalStates, storm::exceptions::InvalidArgumentException, "Unexpected size of the target states.");
+    STORM_LOG_THROW(direction || localMatrix.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException,
+                    "An optimization direction is required for nondeterministic models.");
+    auto const& rowGroupIndices = localMatrix.getRowGroupIndices();
+
+    std::vector<double> values(numberOfLocalStates + matrix.getNumberOfHaloStates(), 0.0);
+    for (auto state : localTargetStates) {
+        values[state] = 1.0;
+    }
+
+    bool converged = false;
+    numberOfIterations = 0;
+    while (!converged && numberOfIterations < maximalNumberOfIterations) {
+        matrix.exchangeHalo(values);
+        ++numberOfIterations;
+
+        double maximalDifference = 0.0;
+        for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+            if (localTargetStates.get(state)) {
+                continue;
+            }
+            double best = 0.0;
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                double rowValue = 0.0;
+                for (auto const& entry : localMatrix.getRow(row)) {
+                    rowValue += entry.getValue() * values[entry.getColumn()];
+                }
+                if (row == rowGroupIndices[state] || (direction == storm::OptimizationDirection::Minimize ? rowValue < best : rowValue > best)) {
+                    best = rowValue;
+                }
+            }
+            double difference = std::abs(best - values[state]);
+            if (relative && best != 0.0) {
+                difference /= best;
+            }
+            maximalDifference = std::max(maximalDifference, difference);
+            values[state] = best;
+        }
+        converged = matrix.getCommunicator().allReduceMax(maximalDifference) <= precision;
+    }
+    STORM_LOG_WARN_COND(converged, "Distributed value iteration did not converge within " << numberOfIterations << " iterations.");
+    STORM_LOG_INFO("Distributed value iteration performed " << numberOfIterations << " iterations.");
+
+    values.resize(numberOfLocalStates);
+    return values;
+}
+
+std::vector<double> DistributedValueIteration::computeTimeBoundedReachabilityProbabilities(storm::storage::BitVector const& localTargetStates,
+                                                                                           double timeBound, double epsilon) {
+    storm::storage::SparseMatrix<double> const& rateMatrix = matrix.getLocalMatrix();
+    uint64_t numberOfLocalStates = matrix.getNumberOfLocalStates();
+    STORM_LOG_THROW(localTargetStates.size() == numberOfLocalStates, storm::exceptions::InvalidArgumentException, "Unexpected size of the target states.");
+    STORM_LOG_THROW(rateMatrix.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException, "Expected a continuous-time Markov chain.");
+
+    std::vector<double> values(numberOfLocalStates + matrix.getNumberOfHaloStates(), 0.0);
+    for (auto state : localTargetStates) {
+        values[state] = 1.0;
+    }
+
+    // The target states are made absorbing, so only the exit rates of the other states matter for the uniformization rate.
+    std::vector<double> exitRates(numberOfLocalStates, 0.0);
+    double maximalExitRate = 0.0;
+    for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+        if (!localTargetStates.get(state)) {
+            for (auto const& entry : rateMatrix.getRow(state)) {
+                exitRates[state] += entry.getValue();
+            }
+            maximalExitRate = std::max(maximalExitRate, exitRates[state]);
+        }
+    }
+    double uniformizationRate = 1.02 * matrix.getCommunicator().allReduceMax(maximalExitRate);
+    numberOfIterations = 0;
+    if (uniformizationRate == 0.0 || timeBound == 0.0) {
+        values.resize(numberOfLocalStates);
+        return values;
+    }
+
+    // Compute the uniformized matrix P = I + (R - diag(E)) / q, whose diagonal entries are owned columns.
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfLocalStates, rateMatrix.getColumnCount(), rateMatrix.getEntryCount() + numberOfLocalStates);
+    for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+        if (localTargetStates.get(state)) {
+            builder.addNextValue(state, state, 1.0);
+            continue;
+        }
+        bool diagonalAdded = false;
+        double diagonalValue = 1.0 - exitRates[state] / uniformizationRate;
+        for (auto const& entry : rateMatrix.getRow(state)) {
+            if (!diagonalAdded && entry.getColumn() >= state) {
+                if (entry.getColumn() == state) {
+                    diagonalValue += entry.getValue() / uniformizationRate;
+                    builder.addNextValue(state, state, diagonalValue);
+                    diagonalAdded = true;
+                    continue;
+                }
+                builder.addNextValue(state, state, diagonalValue);
+                diagonalAdded = true;
+            }
+            builder.addNextValue(state, entry.getColumn(), entry.getValue() / uniformizationRate);
+        }
+        if (!diagonalAdded) {
+            builder.addNextValue(state, state, diagonalValue);
+        }
+    }
+    storm::storage::SparseMatrix<double> uniformizedMatrix = builder.build();
+
+    // All members obtain the same truncation points, so they perform the same number of iterations.
+    storm::utility::numerical::FoxGlynnResult<double> foxGlynnResult = storm::utility::numerical::foxGlynn(timeBound * uniformizationRate, epsilon);
+    std::vector<double> result(numberOfLocalStates, 0.0);
+    if (foxGlynnResult.left == 0) {
+        for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+            result[state] = foxGlynnResult.weights.front() * values[state];
+        }
+    }
+    std::vector<double> nextValues(numberOfLocalStates);
+    for (uint64_t index = 1; index <= foxGlynnResult.right; ++index) {
+        matrix.exchangeHalo(values);
+        ++numberOfIterations;
+        uniformizedMatrix.multiplyWithVector(values, nextValues);
+        std::copy(nextValues.begin(), nextValues.end(), values.begin());
+        if (index >= foxGlynnResult.left) {
+            double weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+            for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+                result[state] += weight * values[state];
+            }
+        }
+    }
+    for (auto& value : result) {
+        value /= foxGlynnResult.totalWeight;
+    }
+    STORM_LOG_INFO("Distributed transient analysis performed " << numberOfIterations << " iterations.");
+    return result;
+}
+
+uint64_t DistributedValueIteration::getNumberOfIterations() const {
+    return numberOfIterations;
+}
+
+}  // namespace solver
+}  // namespace storm
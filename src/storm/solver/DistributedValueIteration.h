@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/DistributedSparseMatrix.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * Value iteration on a matrix whose states are distributed across a group of processes. Every member updates the values of its own states
+ * (in place, i.e., Gauss-Seidel style within its part) and then exchanges the values that other members need. Convergence is decided
+ * collectively, such that all members perform the same number of iterations. All methods are collective operations and take and return the
+ * values of the owned states only.
+ *
+ * No qualitative precomputations are performed, i.e., the iterations start from zero and converge to the least fixed point from below.
+ */
+class DistributedValueIteration {
+   public:
+    DistributedValueIteration(storm::storage::DistributedSparseMatrix const& matrix);
+
+    void setPrecision(double precision);
+    void setRelative(bool relative);
+    void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
+
+    /*!
+     * Computes the probabilities to reach the target states in a DTMC (without optimization direction) or the optimal probabilities in an MDP.
+     *
+     * @param localTargetStates The owned target states.
+     * @param direction If given, the values of the choices of a state are minimized or maximized.
+     */
+    std::vector<double> computeReachabilityProbabilities(storm::storage::BitVector const& localTargetStates,
+                                                         boost::optional<storm::OptimizationDirection> const& direction = boost::none);
+
+    /*!
+     * Computes the probabilities to reach the target states within the given time in a CTMC whose matrix contains the rates of the transitions.
+     *
+     * @param localTargetStates The owned target states.
+     * @param timeBound The time bound.
+     * @param epsilon The truncation error of the Poisson distribution.
+     */
+    std::vector<double> computeTimeBoundedReachabilityProbabilities(storm::storage::BitVector const& localTargetStates, double timeBound,
+                                                                    double epsilon = 1e-6);
+
+    /*!
+     * Retrieves the number of iterations (i.e., halo exchanges) of the last computation.
+     */
+    uint64_t getNumberOfIterations() const;
+
+   private:
+    storm::storage::DistributedSparseMatrix const& matrix;
+    double precision;
+    bool relative;
+    uint64_t maximalNumberOfIterations;
+    uint64_t numberOfIterations;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/EliminationSettings.h"
 
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 
@@ -85,13 +86,16 @@ bool EliminationLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     std::shared_ptr<StatePriorityQueue> priorityQueue =
         createStatePriorityQueue<ValueType>(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, b, storm::storage::BitVector(x.size(), true));
 
-    // Create a state eliminator to perform the actual elimination.
-    PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
-
-    // Eliminate all states.
-    while (priorityQueue->hasNext()) {
-        auto state = priorityQueue->pop();
-        eliminator.eliminateState(state, false);
+    // Create a state eliminator to perform the actual elimination and eliminate all states.
+    if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isParallelEliminationSet()) {
+        ParallelStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
+        eliminator.eliminateAll(false);
+    } else {
+        PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
+        while (priorityQueue->hasNext()) {
+            auto state = priorityQueue->pop();
+            eliminator.eliminateState(state, false);
+        }
     }
 
     return true;
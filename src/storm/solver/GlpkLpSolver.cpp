@@ -146,6 +146,23 @@ template<typename ValueType, bool RawMode>
 void GlpkLpSolver<ValueType, RawMode>::addConstraint(std::string const& name, Constraint const& constraint) {
     // Add the row that will represent this constraint.
     int constraintIndex = glp_add_rows(this->lp, 1);
+    setConstraint(constraintIndex, name, constraint);
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    if (constraints.empty()) {
+        return;
+    }
+    // Add all rows at once, which avoids reallocating the rows of the problem for every constraint.
+    int firstConstraintIndex = glp_add_rows(this->lp, constraints.size());
+    for (uint64_t index = 0; index < constraints.size(); ++index) {
+        setConstraint(firstConstraintIndex + index, "", constraints[index]);
+    }
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::setConstraint(int constraintIndex, std::string const& name, Constraint const& constraint) {
     glp_set_row_name(this->lp, constraintIndex, name.c_str());
 
     // Extract constraint data
@@ -528,6 +545,17 @@ ValueType GlpkLpSolver<ValueType, RawMode>::getMILPGap(bool relative) const {
     }
 }
 
+template<typename ValueType, bool RawMode>
+bool GlpkLpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    return true;
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& coefficient) {
+    glp_set_obj_coef(this->lp, variableToIndexMap.at(variable), storm::utility::convertNumber<double>(coefficient));
+    this->currentModelHasBeenOptimized = false;
+}
+
 template class GlpkLpSolver<double, true>;
 template class GlpkLpSolver<double, false>;
 template class GlpkLpSolver<storm::RationalNumber, true>;
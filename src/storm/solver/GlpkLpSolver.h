@@ -70,6 +70,7 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
     // Methods to optimize and retrieve optimality status.
@@ -93,7 +94,15 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
     virtual void setMaximalMILPGap(ValueType const& gap, bool relative) override;
     virtual ValueType getMILPGap(bool relative) const override;
 
+    virtual bool supportsObjectiveFunctionCoefficientChanges() const override;
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& coefficient) override;
+
    private:
+    /*!
+     * Sets the name, the bounds and the coefficients of the given (already added) row to represent the given constraint.
+     */
+    void setConstraint(int constraintIndex, std::string const& name, Constraint const& constraint);
+
     // The glpk LP problem.
     glp_prob* lp;
 
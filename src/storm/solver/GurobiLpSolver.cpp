@@ -261,6 +261,35 @@ void GurobiLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
                     "Could not assert constraint (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    if (constraints.empty()) {
+        return;
+    }
+
+    // Collect the constraints in compressed row format such that they can be passed to Gurobi at once.
+    std::vector<size_t> rowStarts;
+    std::vector<int> variableIndices;
+    std::vector<double> coefficients;
+    std::vector<char> senses;
+    std::vector<double> rightHandSides;
+    rowStarts.reserve(constraints.size());
+    senses.reserve(constraints.size());
+    rightHandSides.reserve(constraints.size());
+    for (auto const& constraint : constraints) {
+        auto grbConstr = createConstraint<ValueType, RawMode>(constraint, this->variableToIndexMap);
+        rowStarts.push_back(variableIndices.size());
+        variableIndices.insert(variableIndices.end(), grbConstr.variableIndices.begin(), grbConstr.variableIndices.end());
+        coefficients.insert(coefficients.end(), grbConstr.coefficients.begin(), grbConstr.coefficients.end());
+        senses.push_back(grbConstr.sense);
+        rightHandSides.push_back(grbConstr.rhs);
+    }
+    int error = GRBXaddconstrs(model, constraints.size(), variableIndices.size(), rowStarts.data(), variableIndices.data(), coefficients.data(), senses.data(),
+                               rightHandSides.data(), nullptr);
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Could not assert constraints (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue,
                                                                 Constraint const& constraint) {
@@ -739,6 +768,44 @@ ValueType GurobiLpSolver<ValueType, RawMode>::getMILPGap(bool relative) const {
     }
 }
 
+template<typename ValueType, bool RawMode>
+int GurobiLpSolver<ValueType, RawMode>::getVariableIndex(Variable const& variable) const {
+    if constexpr (RawMode) {
+        return variable;
+    } else {
+        STORM_LOG_ASSERT(variableToIndexMap.count(variable) != 0, "Accessing unknown variable '" << variable.getName() << "'.");
+        return variableToIndexMap.at(variable);
+    }
+}
+
+template<typename ValueType, bool RawMode>
+bool GurobiLpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    return true;
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& coefficient) {
+    // Gurobi keeps the remaining model (and the most recent solution as a starting point) when only the objective is changed.
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_OBJ, getVariableIndex(variable), storm::utility::convertNumber<double>(coefficient));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi objective coefficient (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+    this->currentModelHasBeenOptimized = false;
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setMipStart(Variable const& variable, ValueType const& value) {
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_START, getVariableIndex(variable), storm::utility::convertNumber<double>(value));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi MIP start (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setPrimalStart(Variable const& variable, ValueType const& value) {
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_PSTART, getVariableIndex(variable), storm::utility::convertNumber<double>(value));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi primal start (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
 #else
 template<typename ValueType, bool RawMode>
 GurobiLpSolver<ValueType, RawMode>::GurobiLpSolver(std::shared_ptr<GurobiEnvironment> const&, std::string const&, OptimizationDirection const&) {
@@ -907,6 +974,36 @@ ValueType GurobiLpSolver<ValueType, RawMode>::getMILPGap(bool) const {
                                                           "requires this support. Please choose a version of storm with Gurobi support.";
 }
 
+template<typename ValueType, bool RawMode>
+bool GurobiLpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setMipStart(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setPrimalStart(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
 #endif
 
 std::string toString(GurobiSolverMethod const& method) {
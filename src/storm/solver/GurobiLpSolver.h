@@ -101,6 +101,7 @@ class GurobiLpSolver : public LpSolver<ValueType, RawMode> {
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
     // Methods to optimize and retrieve optimality status.
@@ -123,6 +124,11 @@ class GurobiLpSolver : public LpSolver<ValueType, RawMode> {
     virtual void setMaximalMILPGap(ValueType const& gap, bool relative) override;
     virtual ValueType getMILPGap(bool relative) const override;
 
+    virtual bool supportsObjectiveFunctionCoefficientChanges() const override;
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& coefficient) override;
+    virtual void setMipStart(Variable const& variable, ValueType const& value) override;
+    virtual void setPrimalStart(Variable const& variable, ValueType const& value) override;
+
     // Methods to retrieve values of sub-optimal solutions found along the way.
     void setMaximalSolutionCount(uint64_t value);  // How many solutions will be stored (at max)
     uint64_t getSolutionCount() const;             // How many solutions have been found
@@ -145,6 +151,9 @@ class GurobiLpSolver : public LpSolver<ValueType, RawMode> {
     // A mapping from variables to their indices.
     std::map<storm::expressions::Variable, int> variableToIndexMap;
 
+    // Retrieves the index of the given variable in the Gurobi model.
+    int getVariableIndex(Variable const& variable) const;
+
     struct IncrementalLevel {
         std::vector<storm::expressions::Variable> variables;
         // Gurobi considers a different set of indices for linear constraints and general constraints.
@@ -1,8 +1,12 @@
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <limits>
+#include <thread>
 
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
@@ -10,6 +14,10 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/helper/AsynchronousValueIterationHelper.h"
+#include "storm/solver/multiplier/MixedPrecisionMultiplier.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
@@ -48,10 +56,12 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
 
     if (isExactMode && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::ViToPi) {
         if (env.solver().minMax().isMethodSetFromDefault()) {
+            // With a unique solution, the values of value iteration can often be rounded to the exact solution, which is cheaper than policy iteration.
+            method = this->hasUniqueSolution() ? MinMaxMethod::ViToPi : MinMaxMethod::PolicyIteration;
             STORM_LOG_INFO(
-                "Selecting 'Policy iteration' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a "
-                "different method.");
-            method = MinMaxMethod::PolicyIteration;
+                "Selecting '"
+                << toString(method)
+                << "' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a different method.");
         } else {
             STORM_LOG_WARN("The selected solution method " << toString(method) << " does not guarantee exact results.");
         }
@@ -69,7 +79,8 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
     }
     STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
                         method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration ||
-                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi,
+                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi ||
+                        method == MinMaxMethod::AsynchronousValueIteration || method == MinMaxMethod::PrioritizedValueIteration,
                     storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
     return method;
 }
@@ -100,6 +111,12 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Envi
         case MinMaxMethod::ViToPi:
             result = solveEquationsViToPi(env, dir, x, b);
             break;
+        case MinMaxMethod::AsynchronousValueIteration:
+            result = solveEquationsAsynchronousValueIteration(env, dir, x, b);
+            break;
+        case MinMaxMethod::PrioritizedValueIteration:
+            result = solveEquationsPrioritizedValueIteration(env, dir, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -107,6 +124,20 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Envi
     return result;
 }
 
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, OptimizationDirection dir,
+                                                                                 std::vector<std::vector<ValueType>>& x,
+                                                                                 std::vector<std::vector<ValueType>> const& b) const {
+    // Value iteration can treat all systems at once as long as it starts from the given vectors and does not need to check a custom
+    // termination condition or to extract a scheduler for each of them.
+    if (x.size() > 1 && this->hasUniqueSolution() && !this->hasInitialScheduler() && !this->hasCustomTerminationCondition() && !this->isTrackSchedulerSet() &&
+        !this->choiceFixedForRowGroup &&
+        getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == MinMaxMethod::ValueIteration) {
+        return solveEquationsValueIterationBatch(env, dir, x, b);
+    }
+    return MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, dir, x, b);
+}
+
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env,
                                                                                 std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
@@ -153,7 +184,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
     std::vector<storm::storage::sparse::state_type> scheduler = std::move(initialPolicy);
     // Get a vector for storing the right-hand side of the inner equation system.
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
     }
     std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
@@ -180,54 +211,47 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
     }
     storm::Environment const& environmentOfSolver = environmentOfSolverStorage ? *environmentOfSolverStorage : env;
 
+    // With modified policy iteration, the intermediate policies are only evaluated approximately. As soon as no approximately evaluated policy
+    // improves any more, we switch to evaluating the policies exactly.
+    uint64_t const sweeps = env.solver().minMax().getPolicyEvaluationSweeps();
+    bool exactEvaluation = sweeps == 0;
+    if (!exactEvaluation) {
+        STORM_LOG_INFO("Evaluating intermediate policies with " << sweeps << " sweeps.");
+    }
+
     SolverStatus status = SolverStatus::InProgress;
     uint64_t iterations = 0;
     this->startMeasureProgress();
+    this->startConvergenceTrace("policy-iteration");
     do {
-        // Solve the equation system for the 'DTMC'.
-        solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+        // Evaluate the policy, starting from the values of the previous one.
+        if (exactEvaluation) {
+            solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+        } else {
+            evaluatePolicyBySweeps(scheduler, x, b, sweeps);
+        }
 
         // Go through the multiplication result and see whether we can improve any of the choices.
-        bool schedulerImproved = false;
-        // Group refers to the state number
-        for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
-            if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                //  Only update when the choice is not fixed
-                uint_fast64_t currentChoice = scheduler[group];
-                for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
-                    // If the choice is the currently selected one, we can skip it.
-                    if (choice - this->A->getRowGroupIndices()[group] == currentChoice) {
-                        continue;
-                    }
-
-                    // Create the value of the choice.
-                    ValueType choiceValue = storm::utility::zero<ValueType>();
-                    for (auto const& entry : this->A->getRow(choice)) {
-                        choiceValue += entry.getValue() * x[entry.getColumn()];
-                    }
-                    choiceValue += b[choice];
+        uint64_t schedulerChanges = 0;
+        bool schedulerImproved = improvePolicy(dir, scheduler, x, b, env.solver().minMax().getPolicyImprovementThreads(), schedulerChanges);
 
-                    // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
-                    // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are
-                    // equal). only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
-                    if (valueImproved(dir, x[group], choiceValue)) {
-                        schedulerImproved = true;
-                        scheduler[group] = choice - this->A->getRowGroupIndices()[group];
-                        x[group] = std::move(choiceValue);
-                    }
-                }
-            }
-        }
-
-        // If the scheduler did not improve, we are done.
+        // If the scheduler did not improve, we are done (unless the policy was only evaluated approximately).
         if (!schedulerImproved) {
-            status = SolverStatus::Converged;
+            if (exactEvaluation) {
+                status = SolverStatus::Converged;
+            } else {
+                exactEvaluation = true;
+            }
         }
 
         // Update environment variables.
         ++iterations;
-        status = this->updateStatus(status, x, dir == storm::OptimizationDirection::Minimize ? SolverGuarantee::GreaterOrEqual : SolverGuarantee::LessOrEqual,
-                                    iterations, env.solver().minMax().getMaximalNumberOfIterations());
+        this->traceIteration(iterations, boost::none, boost::none, boost::none, schedulerChanges);
+        SolverGuarantee guarantee = SolverGuarantee::None;
+        if (exactEvaluation) {
+            guarantee = dir == storm::OptimizationDirection::Minimize ? SolverGuarantee::GreaterOrEqual : SolverGuarantee::LessOrEqual;
+        }
+        status = this->updateStatus(status, x, guarantee, iterations, env.solver().minMax().getMaximalNumberOfIterations());
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
@@ -257,6 +281,99 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::valueImproved(OptimizationD
     }
 }
 
+template<typename ValueType>
+void IterativeMinMaxLinearEquationSolver<ValueType>::evaluatePolicyBySweeps(std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x,
+                                                                            std::vector<ValueType> const& b, uint64_t sweeps) const {
+    auto const& rowGroupIndices = this->A->getRowGroupIndices();
+    for (uint64_t sweep = 0; sweep < sweeps; ++sweep) {
+        for (uint64_t group = 0; group < x.size(); ++group) {
+            uint64_t row = rowGroupIndices[group] + scheduler[group];
+            ValueType value = b[row];
+            for (auto const& entry : this->A->getRow(row)) {
+                value += entry.getValue() * x[entry.getColumn()];
+            }
+            x[group] = std::move(value);
+        }
+    }
+}
+
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::improvePolicy(OptimizationDirection dir, std::vector<uint64_t>& scheduler, std::vector<ValueType>& x,
+                                                                   std::vector<ValueType> const& b, uint64_t numberOfThreads,
+                                                                   uint64_t& schedulerChanges) const {
+    auto const& rowGroupIndices = this->A->getRowGroupIndices();
+    uint64_t const numberOfGroups = this->A->getRowGroupCount();
+    numberOfThreads = std::max<uint64_t>(1, std::min(numberOfThreads, numberOfGroups));
+
+    // Improves the choices of the given groups with respect to the values x and writes the values of improved choices to the given vector.
+    auto improveGroups = [&](uint64_t firstGroup, uint64_t lastGroup, std::vector<ValueType>& improvedX, bool& improved, uint64_t& changes) {
+        // Group refers to the state number
+        for (uint64_t group = firstGroup; group < lastGroup; ++group) {
+            if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+                //  Only update when the choice is not fixed
+                uint64_t currentChoice = scheduler[group];
+                for (uint64_t choice = rowGroupIndices[group]; choice < rowGroupIndices[group + 1]; ++choice) {
+                    // If the choice is the currently selected one, we can skip it.
+                    if (choice - rowGroupIndices[group] == currentChoice) {
+                        continue;
+                    }
+
+                    // Create the value of the choice.
+                    ValueType choiceValue = storm::utility::zero<ValueType>();
+                    for (auto const& entry : this->A->getRow(choice)) {
+                        choiceValue += entry.getValue() * x[entry.getColumn()];
+                    }
+                    choiceValue += b[choice];
+
+                    // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
+                    // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are
+                    // equal). only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
+                    if (valueImproved(dir, improvedX[group], choiceValue)) {
+                        improved = true;
+                        scheduler[group] = choice - rowGroupIndices[group];
+                        improvedX[group] = std::move(choiceValue);
+                    }
+                }
+                if (scheduler[group] != currentChoice) {
+                    ++changes;
+                }
+            }
+        }
+    };
+
+    bool schedulerImproved = false;
+    schedulerChanges = 0;
+    if (numberOfThreads == 1) {
+        improveGroups(0, numberOfGroups, x, schedulerImproved, schedulerChanges);
+        return schedulerImproved;
+    }
+
+    // Every thread treats a contiguous range of groups. As other threads read the values, the improved values are written to a copy.
+    std::vector<ValueType> improvedX = x;
+    std::vector<uint8_t> improved(numberOfThreads, false);
+    std::vector<uint64_t> changes(numberOfThreads, 0);
+    std::vector<std::thread> threads;
+    uint64_t const groupsPerThread = (numberOfGroups + numberOfThreads - 1) / numberOfThreads;
+    auto improveChunk = [&](uint64_t thread) {
+        bool chunkImproved = false;
+        improveGroups(thread * groupsPerThread, std::min(numberOfGroups, (thread + 1) * groupsPerThread), improvedX, chunkImproved, changes[thread]);
+        improved[thread] = chunkImproved;
+    };
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(improveChunk, thread);
+    }
+    improveChunk(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    x = std::move(improvedX);
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        schedulerImproved |= static_cast<bool>(improved[thread]);
+        schedulerChanges += changes[thread];
+    }
+    return schedulerImproved;
+}
+
 template<typename ValueType>
 MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<ValueType>::getRequirements(
     Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
@@ -271,7 +388,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
                                                               ? MinMaxLinearEquationSolverRequirements(this->linearEquationSolverFactory->getRequirements(env))
                                                               : MinMaxLinearEquationSolverRequirements();
 
-    if (method == MinMaxMethod::ValueIteration) {
+    if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::AsynchronousValueIteration || method == MinMaxMethod::PrioritizedValueIteration) {
         if (!this->hasUniqueSolution()) {  // Traditional value iteration has no requirements if the solution is unique.
             // Computing a scheduler is only possible if the solution is unique
             if (this->isTrackSchedulerSet()) {
@@ -327,17 +444,26 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
     return requirements;
 }
 
+template<typename ValueType>
+ValueType computeMaxAbsDiff(std::vector<ValueType> const& allOldValues, std::vector<ValueType> const& allNewValues) {
+    ValueType result = storm::utility::zero<ValueType>();
+    for (uint64_t index = 0; index < allOldValues.size(); ++index) {
+        result = storm::utility::max<ValueType>(result, storm::utility::abs<ValueType>(allNewValues[index] - allOldValues[index]));
+    }
+    return result;
+}
+
 template<typename ValueType>
 typename IterativeMinMaxLinearEquationSolver<ValueType>::ValueIterationResult IterativeMinMaxLinearEquationSolver<ValueType>::performValueIteration(
     Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b,
     ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maximalNumberOfIterations,
-    storm::solver::MultiplicationStyle const& multiplicationStyle) const {
+    storm::solver::MultiplicationStyle const& multiplicationStyle, storm::solver::Multiplier<ValueType> const* customMultiplier) const {
     STORM_LOG_THROW(!this->choiceFixedForRowGroup, storm::exceptions::NotImplementedException,
                     "Fixing the scheduler choices in which choices are fixed is not implemented for value iteration, please pick a different solver");
     STORM_LOG_ASSERT(currentX != newX, "Vectors must not be aliased.");
 
-    // Get handle to multiplier.
-    storm::solver::Multiplier<ValueType> const& multiplier = *this->multiplierA;
+    // Get handle to multiplier. Unless another one is given, we use the one of this solver.
+    storm::solver::Multiplier<ValueType> const& multiplier = customMultiplier ? *customMultiplier : *this->multiplierA;
 
     // Allow aliased multiplications.
     bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
@@ -347,19 +473,23 @@ typename IterativeMinMaxLinearEquationSolver<ValueType>::ValueIterationResult It
 
     SolverStatus status = SolverStatus::InProgress;
     while (status == SolverStatus::InProgress) {
-        // Compute x' = min/max(A*x + b).
+        // Compute x' = min/max(A*x + b) and determine whether the method converged.
+        bool converged;
         if (useGaussSeidelMultiplication) {
             // Copy over the current vector so we can modify it in-place.
             *newX = *currentX;
             multiplier.multiplyAndReduceGaussSeidel(env, dir, *newX, &b);
+            converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative);
         } else {
-            multiplier.multiplyAndReduce(env, dir, *currentX, &b, *newX);
+            // The convergence check is done in the same pass as the multiplication.
+            converged = multiplier.multiplyAndReduceAndCheckConvergence(env, dir, *currentX, &b, *newX, precision, relative);
         }
-
-        // Determine whether the method converged.
-        if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+        if (converged) {
             status = SolverStatus::Converged;
         }
+        if (this->isConvergenceTraceSet()) {
+            this->traceIteration(iterations + 1, computeMaxAbsDiff(*currentX, *newX));
+        }
 
         // Update environment variables.
         std::swap(currentX, newX);
@@ -407,7 +537,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
     }
     if (!optimisticValueIterationHelper) {
         optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(*this->A);
@@ -421,10 +551,17 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
     std::vector<ValueType>* lowerX = &x;
     std::vector<ValueType>* upperX = auxiliaryRowGroupVector.get();
 
+    typename storm::solver::helper::OptimisticValueIterationHelper<ValueType>::VerificationCallback verificationCallback;
+    if (this->isConvergenceTraceSet()) {
+        this->startConvergenceTrace("optimistic-value-iteration");
+        verificationCallback = [this](uint64_t iterations, std::vector<ValueType> const& lowerValues, std::vector<ValueType> const& upperValues) {
+            this->traceBounds(iterations, lowerValues, upperValues);
+        };
+    }
     auto statusIters = helper.solveEquations(env, lowerX, upperX, b, env.solver().minMax().getRelativeTerminationCriterion(),
                                              storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()),
                                              env.solver().minMax().getMaximalNumberOfIterations(), dir, this->getOptionalRelevantValues(),
-                                             this->choiceFixedForRowGroup, this->initialScheduler);
+                                             this->choiceFixedForRowGroup, this->initialScheduler, verificationCallback);
     auto two = storm::utility::convertNumber<ValueType>(2.0);
     storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
         *lowerX, *upperX, x, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
@@ -452,7 +589,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
     }
 
     // By default, we can not provide any guarantee
@@ -486,32 +623,40 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
         // If we were given an initial scheduler and are maximizing (minimizing), our current solution becomes
         // always less-or-equal (greater-or-equal) than the actual solution.
         guarantee = maximize(dir) ? SolverGuarantee::LessOrEqual : SolverGuarantee::GreaterOrEqual;
-    } else if (!this->hasUniqueSolution()) {
-        if (maximize(dir)) {
-            this->createLowerBoundsVector(x);
-            guarantee = SolverGuarantee::LessOrEqual;
-        } else {
-            this->createUpperBoundsVector(x);
-            guarantee = SolverGuarantee::GreaterOrEqual;
-        }
-    } else if (this->hasCustomTerminationCondition()) {
-        if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::LessOrEqual) && this->hasLowerBound()) {
-            this->createLowerBoundsVector(x);
-            guarantee = SolverGuarantee::LessOrEqual;
-        } else if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::GreaterOrEqual) && this->hasUpperBound()) {
-            this->createUpperBoundsVector(x);
-            guarantee = SolverGuarantee::GreaterOrEqual;
-        }
+    } else {
+        guarantee = initializeValueIterationStart(dir, x);
     }
 
     std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
     std::vector<ValueType>* currentX = &x;
 
     this->startMeasureProgress();
-    ValueIterationResult result =
-        performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()),
-                              env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(),
-                              env.solver().minMax().getMultiplicationStyle());
+    this->startConvergenceTrace("value-iteration");
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+    ValueIterationResult result(0, SolverStatus::InProgress);
+    if (env.solver().minMax().isMixedPrecisionSet()) {
+        if (std::is_same<ValueType, double>::value && guarantee == SolverGuarantee::None) {
+            // First iterate on the single precision copy of the matrix. As float only has about seven significant digits, there is no point in
+            // demanding more in this phase. The iterations below then polish the result with the original matrix.
+            if (!mixedPrecisionMultiplierA) {
+                mixedPrecisionMultiplierA = std::make_unique<storm::solver::MixedPrecisionMultiplier<ValueType>>(*this->A);
+            }
+            ValueType singlePrecision = storm::utility::max<ValueType>(precision, storm::utility::convertNumber<ValueType>(1e-6));
+            result = performValueIteration(env, dir, currentX, newX, b, singlePrecision, relative, guarantee, 0, maxIter,
+                                           env.solver().minMax().getMultiplicationStyle(), mixedPrecisionMultiplierA.get());
+            STORM_LOG_INFO("Performed " << result.iterations << " value iterations in single precision.");
+        } else {
+            STORM_LOG_INFO("Mixed precision value iteration is only applied to double precision computations without solution guarantee.");
+        }
+    }
+    if (result.status == SolverStatus::InProgress || result.status == SolverStatus::Converged) {
+        uint64_t previousIterations = result.iterations;
+        result = performValueIteration(env, dir, currentX, newX, b, precision, relative, guarantee, previousIterations, maxIter,
+                                       env.solver().minMax().getMultiplicationStyle());
+        result.iterations += previousIterations;
+    }
 
     // Swap the result into the output x.
     if (currentX == auxiliaryRowGroupVector.get()) {
@@ -521,10 +666,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
     this->reportStatus(result.status, result.iterations);
 
     // If requested, we store the scheduler for retrieval.
-    if (this->isTrackSchedulerSet()) {
-        this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
-        this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
-    }
+    storeSchedulerForValues(env, dir, x, b);
 
     if (!this->isCachingEnabled()) {
         clearCache();
@@ -533,6 +675,127 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
     return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsAsynchronousValueIteration(Environment const& env, OptimizationDirection dir,
+                                                                                              std::vector<ValueType>& x,
+                                                                                              std::vector<ValueType> const& b) const {
+    if constexpr (!std::is_same<ValueType, double>::value) {
+        STORM_LOG_WARN("Asynchronous value iteration is only implemented for double precision, falling back to value iteration.");
+        return solveEquationsValueIteration(env, dir, x, b);
+    } else {
+        STORM_LOG_THROW(!this->choiceFixedForRowGroup, storm::exceptions::NotImplementedException,
+                        "Fixing the scheduler choices is not implemented for asynchronous value iteration, please pick a different solver");
+
+        // Start from the bounds as for value iteration. The asynchronous updates preserve the resulting guarantee.
+        SolverGuarantee guarantee = initializeValueIterationStart(dir, x);
+
+        this->startMeasureProgress();
+        ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+        bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+        uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+        storm::solver::helper::AsynchronousValueIterationHelper<ValueType> helper(*this->A);
+        STORM_LOG_INFO("Performing asynchronous value iteration on " << helper.getNumberOfBlocks() << " blocks.");
+        auto result = helper.solve(dir, x, b, precision, relative, [&](SolverStatus status, std::vector<ValueType> const& currentX, uint64_t iterations) {
+            status = this->updateStatus(status, currentX, guarantee, iterations, maxIter);
+            this->showProgressIterative(iterations);
+            return status;
+        });
+        this->reportStatus(result.second, result.first);
+
+        // If requested, we store the scheduler for retrieval.
+        storeSchedulerForValues(env, dir, x, b);
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return result.second == SolverStatus::Converged || result.second == SolverStatus::TerminatedEarly;
+    }
+}
+
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir,
+                                                                                             std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_THROW(!this->choiceFixedForRowGroup, storm::exceptions::NotImplementedException,
+                    "Fixing the scheduler choices is not implemented for prioritized value iteration, please pick a different solver");
+    if (!prioritizedValueIterationHelper) {
+        prioritizedValueIterationHelper = std::make_unique<storm::solver::helper::PrioritizedValueIterationHelper<ValueType>>(*this->A);
+    }
+
+    // Start from the bounds as for value iteration. The prioritized updates preserve the resulting guarantee.
+    SolverGuarantee guarantee = initializeValueIterationStart(dir, x);
+
+    this->startMeasureProgress();
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+    auto result = prioritizedValueIterationHelper->solve(
+        dir, x, b, precision, relative, [&](SolverStatus status, std::vector<ValueType> const& currentX, uint64_t iterations) {
+            status = this->updateStatus(status, currentX, guarantee, iterations, maxIter);
+            this->showProgressIterative(iterations);
+            return status;
+        });
+    this->reportStatus(result.second, result.first);
+
+    // If requested, we store the scheduler for retrieval.
+    storeSchedulerForValues(env, dir, x, b);
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return result.second == SolverStatus::Converged || result.second == SolverStatus::TerminatedEarly;
+}
+
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIterationBatch(Environment const& env, OptimizationDirection dir,
+                                                                                       std::vector<std::vector<ValueType>>& x,
+                                                                                       std::vector<std::vector<ValueType>> const& b) const {
+    STORM_LOG_INFO_COND(env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular,
+                        "Solving multiple equation systems simultaneously always uses regular multiplications.");
+    if (!this->multiplierA) {
+        this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+    }
+
+    // Store the vectors of all systems such that the values of the same row are consecutive. This way, each matrix entry is only loaded once.
+    uint64_t const batchSize = x.size();
+    std::vector<ValueType> currentX = storm::utility::vector::interleaveVectors(x);
+    std::vector<ValueType> const batchB = storm::utility::vector::interleaveVectors(b);
+    std::vector<ValueType> newX(currentX.size());
+
+    this->startMeasureProgress();
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        this->multiplierA->multiplyAndReduceBatch(env, dir, this->A->getRowGroupIndices(), currentX, &batchB, newX, batchSize);
+
+        // Determine whether all systems converged.
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, newX, precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+
+        std::swap(currentX, newX);
+        ++iterations;
+        status = this->updateStatus(status, false, iterations, maxIter);
+
+        // Potentially show progress.
+        this->showProgressIterative(iterations);
+    }
+
+    storm::utility::vector::deinterleaveVector(currentX, x);
+
+    this->reportStatus(status, iterations);
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
     storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -556,7 +819,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
     }
 
     // Allow aliased multiplications.
@@ -569,7 +832,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
 
     std::vector<ValueType>* tmp = nullptr;
     if (!useGaussSeidelMultiplication) {
-        auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(lowerX->size());
+        auxiliaryRowGroupVector2 = acquireWorkspaceVector<ValueType>(env, lowerX->size());
         tmp = auxiliaryRowGroupVector2.get();
     }
 
@@ -591,6 +854,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
         precision *= storm::utility::convertNumber<ValueType>(2.0);
     }
     this->startMeasureProgress();
+    this->startConvergenceTrace("interval-iteration");
     while (status == SolverStatus::InProgress && iterations < env.solver().minMax().getMaximalNumberOfIterations()) {
         // Remember in which directions we took steps in this iteration.
         bool lowerStep = false;
@@ -682,6 +946,10 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
             }
         }
 
+        if (this->isConvergenceTraceSet()) {
+            this->traceBounds(iterations + 1, *lowerX, *upperX);
+        }
+
         // Update environment variables.
         ++iterations;
         doConvergenceCheck = !doConvergenceCheck;
@@ -729,7 +997,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
     // Prepare the solution vectors and the helper.
     assert(x.size() == this->A->getRowGroupCount());
     if (!this->auxiliaryRowGroupVector) {
-        this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>();
+        this->auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, 0);
     }
     if (!this->soundValueIterationHelper) {
         this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(
@@ -756,6 +1024,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
 
     SolverStatus status = SolverStatus::InProgress;
     this->startMeasureProgress();
+    this->startConvergenceTrace("sound-value-iteration");
     uint64_t iterations = 0;
 
     while (status == SolverStatus::InProgress && iterations < env.solver().minMax().getMaximalNumberOfIterations()) {
@@ -773,6 +1042,15 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
                 this->hasCustomTerminationCondition() && this->soundValueIterationHelper->checkCustomTerminationCondition(this->getTerminationCondition()),
                 iterations, env.solver().minMax().getMaximalNumberOfIterations());
         }
+        if (this->isConvergenceTraceSet()) {
+            boost::optional<ValueType> lowerBound = this->soundValueIterationHelper->getLowerBound();
+            boost::optional<ValueType> upperBound = this->soundValueIterationHelper->getUpperBound();
+            boost::optional<ValueType> residual;
+            if (lowerBound && upperBound) {
+                residual = upperBound.get() - lowerBound.get();
+            }
+            this->traceIteration(iterations, residual, lowerBound, upperBound);
+        }
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
@@ -799,6 +1077,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsViToPi(Enviro
                                                                           std::vector<ValueType> const& b) const {
     // First create an (inprecise) vi solver to get a good initial strategy for the (potentially precise) policy iteration solver.
     std::vector<storm::storage::sparse::state_type> initialSched;
+    std::vector<double> xVi;
     {
         Environment viEnv = env;
         viEnv.solver().minMax().setMethod(MinMaxMethod::ValueIteration);
@@ -811,11 +1090,28 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsViToPi(Enviro
         }
         STORM_LOG_THROW(!impreciseSolver->getRequirements(viEnv, dir).hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
                         "The value-iteration based solver has an unmet requirement.");
-        auto xVi = storm::utility::vector::convertNumericVector<double>(x);
+        xVi = storm::utility::vector::convertNumericVector<double>(x);
         auto bVi = storm::utility::vector::convertNumericVector<double>(b);
         impreciseSolver->solveEquations(viEnv, dir, xVi, bVi);
         initialSched = impreciseSolver->getSchedulerChoices();
     }
+
+    if constexpr (NumberTraits<ValueType>::IsExact) {
+        // Try to round the values of value iteration to rationals with small denominators. As the solution is unique, such values are the exact
+        // solution if they satisfy the equation system, which is checked in a single pass over the matrix.
+        if (!this->choiceFixedForRowGroup) {
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            uint64_t p =
+                storm::utility::convertNumber<uint64_t>(storm::utility::ceil(storm::utility::log10<ValueType>(storm::utility::one<ValueType>() / precision)));
+            std::vector<ValueType> sharpenedX(x.size());
+            if (sharpen(dir, p, *this->A, xVi, b, sharpenedX)) {
+                STORM_LOG_INFO("Rounding the values found by value iteration yields the exact solution. Skipping policy iteration.");
+                x = std::move(sharpenedX);
+                storeSchedulerForValues(env, dir, x, b);
+                return true;
+            }
+        }
+    }
     STORM_LOG_INFO("Found initial policy using Value Iteration. Starting Policy iteration now.");
     return performPolicyIteration(env, dir, x, b, std::move(initialSched));
 }
@@ -825,34 +1121,45 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::isSolution(storm::Optimizat
                                                                 std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
     storm::utility::ConstantsComparator<ValueType> comparator;
 
-    auto valueIt = values.begin();
-    auto bIt = b.begin();
-    for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group, ++valueIt) {
-        ValueType groupValue = *bIt;
-        uint64_t row = matrix.getRowGroupIndices()[group];
-        groupValue += matrix.multiplyRowWithVector(row, values);
-
-        ++row;
-        ++bIt;
-
-        for (auto endRow = matrix.getRowGroupIndices()[group + 1]; row < endRow; ++row, ++bIt) {
-            ValueType newValue = *bIt;
-            newValue += matrix.multiplyRowWithVector(row, values);
-
-            if ((dir == storm::OptimizationDirection::Minimize && newValue < groupValue) ||
-                (dir == storm::OptimizationDirection::Maximize && newValue > groupValue)) {
-                groupValue = newValue;
+    // Checks whether the groups in the given range satisfy the equation system.
+    auto checkGroups = [&](uint64_t firstGroup, uint64_t endGroup) {
+        for (uint64_t group = firstGroup; group < endGroup; ++group) {
+            uint64_t row = matrix.getRowGroupIndices()[group];
+            ValueType groupValue = b[row];
+            groupValue += matrix.multiplyRowWithVector(row, values);
+
+            ++row;
+            for (auto endRow = matrix.getRowGroupIndices()[group + 1]; row < endRow; ++row) {
+                ValueType newValue = b[row];
+                newValue += matrix.multiplyRowWithVector(row, values);
+
+                if ((dir == storm::OptimizationDirection::Minimize && newValue < groupValue) ||
+                    (dir == storm::OptimizationDirection::Maximize && newValue > groupValue)) {
+                    groupValue = newValue;
+                }
             }
-        }
 
-        // If the value does not match the one in the values vector, the given vector is not a solution.
-        if (!comparator.isEqual(groupValue, *valueIt)) {
-            return false;
+            // If the value does not match the one in the values vector, the given vector is not a solution.
+            if (!comparator.isEqual(groupValue, values[group])) {
+                return false;
+            }
         }
+        return true;
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    // Exact arithmetic is expensive, so the groups are checked in parallel if possible.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        std::atomic<bool> solution(true);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, matrix.getRowGroupCount()), [&](tbb::blocked_range<uint64_t> const& range) {
+            if (solution.load(std::memory_order_relaxed) && !checkGroups(range.begin(), range.end())) {
+                solution.store(false, std::memory_order_relaxed);
+            }
+        });
+        return solution.load();
     }
-
-    // Checked all values at this point.
-    return true;
+#endif
+    return checkGroups(0, matrix.getRowGroupCount());
 }
 
 template<typename ValueType>
@@ -887,7 +1194,7 @@ IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelp
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
     }
 
     // Forward the call to the core rational search routine.
@@ -919,7 +1226,7 @@ IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelp
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
     }
 
     // Forward the call to the core rational search routine.
@@ -983,7 +1290,7 @@ IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelp
         STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
 
         if (!auxiliaryRowGroupVector) {
-            auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
         }
 
         // Translate the imprecise value iteration result to the one we are going to use from now on.
@@ -1153,13 +1460,81 @@ void IterativeMinMaxLinearEquationSolver<ValueType>::computeOptimalValueForRowGr
     }
 }
 
+template<typename ValueType>
+SolverGuarantee IterativeMinMaxLinearEquationSolver<ValueType>::initializeValueIterationStart(OptimizationDirection dir, std::vector<ValueType>& x) const {
+    if (!this->hasUniqueSolution()) {
+        if (maximize(dir)) {
+            this->createLowerBoundsVector(x);
+            return SolverGuarantee::LessOrEqual;
+        } else {
+            this->createUpperBoundsVector(x);
+            return SolverGuarantee::GreaterOrEqual;
+        }
+    } else if (this->hasCustomTerminationCondition()) {
+        if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::LessOrEqual) && this->hasLowerBound()) {
+            this->createLowerBoundsVector(x);
+            return SolverGuarantee::LessOrEqual;
+        } else if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::GreaterOrEqual) && this->hasUpperBound()) {
+            this->createUpperBoundsVector(x);
+            return SolverGuarantee::GreaterOrEqual;
+        }
+    }
+    // By default, we can not provide any guarantee
+    return SolverGuarantee::None;
+}
+
+template<typename ValueType>
+void IterativeMinMaxLinearEquationSolver<ValueType>::storeSchedulerForValues(Environment const& env, OptimizationDirection dir,
+                                                                             std::vector<ValueType> const& x, std::vector<ValueType> const& b) const {
+    if (this->isTrackSchedulerSet()) {
+        if (!this->multiplierA) {
+            this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+        }
+        if (!auxiliaryRowGroupVector) {
+            auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
+        }
+        this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+        this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector, &this->schedulerChoices.get());
+    }
+}
+
+template<typename ValueType>
+void IterativeMinMaxLinearEquationSolver<ValueType>::traceBounds(uint64_t iteration, std::vector<ValueType> const& lowerX,
+                                                                  std::vector<ValueType> const& upperX) const {
+    boost::optional<ValueType> lowerBound, upperBound, residual;
+    auto processIndex = [&](uint64_t index) {
+        if (!lowerBound || lowerX[index] < lowerBound.get()) {
+            lowerBound = lowerX[index];
+        }
+        if (!upperBound || upperX[index] > upperBound.get()) {
+            upperBound = upperX[index];
+        }
+        ValueType difference = storm::utility::abs<ValueType>(upperX[index] - lowerX[index]);
+        if (!residual || difference > residual.get()) {
+            residual = std::move(difference);
+        }
+    };
+    if (this->hasRelevantValues()) {
+        for (auto index : this->getRelevantValues()) {
+            processIndex(index);
+        }
+    } else {
+        for (uint64_t index = 0; index < lowerX.size(); ++index) {
+            processIndex(index);
+        }
+    }
+    this->traceIteration(iteration, residual, lowerBound, upperBound);
+}
+
 template<typename ValueType>
 void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     multiplierA.reset();
+    mixedPrecisionMultiplierA.reset();
     auxiliaryRowGroupVector.reset();
     auxiliaryRowGroupVector2.reset();
     soundValueIterationHelper.reset();
     optimisticValueIterationHelper.reset();
+    prioritizedValueIterationHelper.reset();
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -7,10 +7,12 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/SolverWorkspace.h"
 
 namespace storm {
 
@@ -29,6 +31,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     virtual bool internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                         std::vector<ValueType> const& b) const override;
+    virtual bool internalSolveEquationsBatch(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const override;
 
     virtual void clearCache() const override;
 
@@ -47,7 +51,30 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
                                 std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
     bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
+    /*!
+     * Approximately evaluates the given policy by performing the given number of in-place sweeps over the rows that the policy selects in the
+     * original matrix, i.e., without building the matrix induced by the policy.
+     */
+    void evaluatePolicyBySweeps(std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                uint64_t sweeps) const;
+
+    /*!
+     * Improves the given policy with respect to the given values of its evaluation. The values of improved choices are written to x.
+     *
+     * @param numberOfThreads The number of threads among which the row groups are split.
+     * @param schedulerChanges Is set to the number of row groups whose choice changed.
+     * @return True iff the policy was improved.
+     */
+    bool improvePolicy(OptimizationDirection dir, std::vector<uint64_t>& scheduler, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                       uint64_t numberOfThreads, uint64_t& schedulerChanges) const;
+
     bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    bool solveEquationsValueIterationBatch(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x,
+                                           std::vector<std::vector<ValueType>> const& b) const;
+    bool solveEquationsAsynchronousValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                  std::vector<ValueType> const& b) const;
+    bool solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                 std::vector<ValueType> const& b) const;
     bool solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                 std::vector<ValueType> const& b) const;
     bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -77,6 +104,24 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     static bool isSolution(storm::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values,
                            std::vector<ValueType> const& b);
 
+    /*!
+     * Initializes x with the lower (upper) bounds if the solution is not unique or the termination condition requires a guarantee.
+     *
+     * @return The guarantee on x that the monotone value iteration variants preserve.
+     */
+    SolverGuarantee initializeValueIterationStart(OptimizationDirection dir, std::vector<ValueType>& x) const;
+
+    /*!
+     * If schedulers are tracked, stores the scheduler that is optimal with respect to the given values.
+     */
+    void storeSchedulerForValues(Environment const& env, OptimizationDirection dir, std::vector<ValueType> const& x, std::vector<ValueType> const& b) const;
+
+    /*!
+     * Writes an iteration of a method maintaining lower and upper values to the convergence trace. The traced bounds are the smallest lower value
+     * and the largest upper value and the residual is the largest difference between the two (each restricted to the relevant values, if any).
+     */
+    void traceBounds(uint64_t iteration, std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX) const;
+
     void computeOptimalValueForRowGroup(uint_fast64_t group, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b,
                                         uint_fast64_t* choice = nullptr) const;
 
@@ -95,7 +140,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     ValueIterationResult performValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX,
                                                std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative,
                                                SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maximalNumberOfIterations,
-                                               storm::solver::MultiplicationStyle const& multiplicationStyle) const;
+                                               storm::solver::MultiplicationStyle const& multiplicationStyle,
+                                               storm::solver::Multiplier<ValueType> const* customMultiplier = nullptr) const;
 
     void createLinearEquationSolver(Environment const& env) const;
 
@@ -104,10 +150,12 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     // possibly cached data
     mutable std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplierA;
-    mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;   // A.rowGroupCount() entries
-    mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2;  // A.rowGroupCount() entries
+    mutable std::unique_ptr<storm::solver::Multiplier<ValueType>> mixedPrecisionMultiplierA;
+    mutable SolverWorkspace::VectorPointer<ValueType> auxiliaryRowGroupVector;   // A.rowGroupCount() entries
+    mutable SolverWorkspace::VectorPointer<ValueType> auxiliaryRowGroupVector2;  // A.rowGroupCount() entries
     mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
     mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+    mutable std::unique_ptr<storm::solver::helper::PrioritizedValueIterationHelper<ValueType>> prioritizedValueIterationHelper;
 };
 
 }  // namespace solver
@@ -11,10 +11,12 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include "storm/utility/LargeArray.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/utility/macros.h"
@@ -29,9 +31,29 @@ LinearEquationSolver<ValueType>::LinearEquationSolver() : cachingEnabled(false)
 
 template<typename ValueType>
 bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    storm::utility::LargeArray::advise(x);
+    storm::utility::LargeArray::advise(b);
     return this->internalSolveEquations(env, x, b);
 }
 
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                     std::vector<std::vector<ValueType>> const& b) const {
+    STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException,
+                    "The number of solution vectors (" << x.size() << ") does not match the number of right-hand sides (" << b.size() << ").");
+    return this->internalSolveEquationsBatch(env, x, b);
+}
+
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                  std::vector<std::vector<ValueType>> const& b) const {
+    bool result = true;
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        result &= this->internalSolveEquations(env, x[i], b[i]);
+    }
+    return result;
+}
+
 template<typename ValueType>
 LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
     return LinearEquationSolverRequirements();
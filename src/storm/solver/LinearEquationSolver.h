@@ -9,6 +9,7 @@
 #include "storm/solver/LinearEquationSolverRequirements.h"
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverWorkspace.h"
 
 #include "storm/utility/VectorHelper.h"
 
@@ -48,6 +49,19 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+    /*!
+     * Solves the equation system for several right-hand sides, i.e., the i-th solution x[i] is computed with respect to b[i].
+     * Depending on the method, the systems are solved simultaneously such that the matrix only has to be traversed once per
+     * iteration for all of them.
+     *
+     * @param x The solution vectors that have to be computed. There must be one vector for each right-hand side and their lengths
+     * must be equal to the number of rows of A.
+     * @param b The right-hand sides. Their lengths must be equal to the number of rows of A.
+     *
+     * @return true iff all systems were solved.
+     */
+    bool solveEquations(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+
     /*!
      * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
      * system format, it solves Ax = b. If it it expects a fixed point format, it solves Ax + b = x.
@@ -79,8 +93,14 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+    /*!
+     * Solves the equation systems for several right-hand sides. By default, the systems are solved one after another.
+     */
+    virtual bool internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const;
+
     // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
-    mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
+    mutable SolverWorkspace::VectorPointer<ValueType> cachedRowVector;
 
    private:
     /*!
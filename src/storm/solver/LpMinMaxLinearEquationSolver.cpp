@@ -1,10 +1,12 @@
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+#include <optional>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
-#include "storm/storage/expressions/RationalLiteralExpression.h"
-#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/storage/expressions/BinaryRelationType.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -37,43 +39,45 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming, storm::exceptions::InvalidEnvironmentException,
                     "This min max solver does not support the selected technique.");
 
-    // Set up the LP solver
-    std::unique_ptr<storm::solver::LpSolver<ValueType>> solver = lpSolverFactory->create("");
+    // Set up the LP solver. We use the raw interface such that the constraints are passed to the solver without building expressions.
+    std::unique_ptr<storm::solver::LpSolver<ValueType, true>> solver = lpSolverFactory->createRaw("");
     solver->setOptimizationDirection(invert(dir));
-    // Create a variable for each row group
-    std::vector<storm::expressions::Expression> variableExpressions;
-    variableExpressions.reserve(this->A->getRowGroupCount());
+    // Create a variable for each row group. Row groups whose lower and upper bound coincide get a constant value instead.
+    std::vector<std::optional<ValueType>> constantValues(this->A->getRowGroupCount());
+    std::vector<uint64_t> variables(this->A->getRowGroupCount());
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+        std::optional<ValueType> lowerBound, upperBound;
         if (this->hasLowerBound()) {
-            ValueType lowerBound = this->getLowerBound(rowGroup);
-            if (this->hasUpperBound()) {
-                ValueType upperBound = this->getUpperBound(rowGroup);
-                if (lowerBound == upperBound) {
-                    // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
-                    // efficient anyways.
-                    variableExpressions.push_back(solver->getConstant(lowerBound));
-                } else {
-                    STORM_LOG_ASSERT(lowerBound <= upperBound,
-                                     "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
-                    variableExpressions.emplace_back(
-                        solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
-                }
-            } else {
-                variableExpressions.emplace_back(
-                    solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
-            }
+            lowerBound = this->getLowerBound(rowGroup);
+        }
+        if (this->hasUpperBound()) {
+            upperBound = this->getUpperBound(rowGroup);
+        }
+        if (lowerBound && upperBound && *lowerBound == *upperBound) {
+            // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
+            // efficient anyways.
+            constantValues[rowGroup] = *lowerBound;
         } else {
-            if (this->upperBound) {
-                variableExpressions.emplace_back(
-                    solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>()));
-            } else {
-                variableExpressions.emplace_back(solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
-            }
+            STORM_LOG_ASSERT(!lowerBound || !upperBound || *lowerBound <= *upperBound,
+                             "Lower Bound at row group " << rowGroup << " is " << *lowerBound << " which exceeds the upper bound " << *upperBound << ".");
+            variables[rowGroup] = solver->addContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>());
         }
     }
     solver->update();
 
-    // Add a constraint for each row
+    // If the initial values are given (e.g. by a previous value iteration), they are a good start for the simplex method.
+    if (std::any_of(x.begin(), x.end(), [](ValueType const& value) { return !storm::utility::isZero(value); })) {
+        for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+            if (!constantValues[rowGroup]) {
+                solver->setPrimalStart(variables[rowGroup], x[rowGroup]);
+            }
+        }
+    }
+
+    // Add a constraint for each row, i.e., x_rowGroup - sum_j A_row,j * x_j <= b_row (or >= b_row, when maximizing).
+    std::vector<RawLpConstraint<ValueType>> constraints;
+    constraints.reserve(this->A->getRowCount());
+    auto const relationType = minimize(dir) ? storm::expressions::RelationType::LessOrEqual : storm::expressions::RelationType::GreaterOrEqual;
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
         // The rowgroup refers to the state number
         uint64_t rowIndex, rowGroupEnd;
@@ -86,21 +90,29 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         }
         for (; rowIndex < rowGroupEnd; ++rowIndex) {
             auto row = this->A->getRow(rowIndex);
-            std::vector<storm::expressions::Expression> summands;
-            summands.reserve(1 + row.getNumberOfEntries());
-            summands.push_back(solver->getConstant(b[rowIndex]));
+            constraints.emplace_back(relationType, b[rowIndex], row.getNumberOfEntries() + 1);
+            auto& constraint = constraints.back();
+            // The solvers do not necessarily support that a variable occurs twice, so self-loops are merged into the coefficient of the row group.
+            ValueType ownCoefficient = storm::utility::one<ValueType>();
             for (auto const& entry : row) {
-                summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+                if (entry.getColumn() == rowGroup) {
+                    ownCoefficient -= entry.getValue();
+                } else if (constantValues[entry.getColumn()]) {
+                    constraint.rhs += entry.getValue() * constantValues[entry.getColumn()].value();
+                } else {
+                    constraint.addToLhs(variables[entry.getColumn()], -entry.getValue());
+                }
             }
-            storm::expressions::Expression rowConstraint = storm::expressions::sum(summands);
-            if (minimize(dir)) {
-                rowConstraint = variableExpressions[rowGroup] <= rowConstraint;
-            } else {
-                rowConstraint = variableExpressions[rowGroup] >= rowConstraint;
+            if (constantValues[rowGroup]) {
+                constraint.rhs -= ownCoefficient * constantValues[rowGroup].value();
+            } else if (!storm::utility::isZero(ownCoefficient)) {
+                constraint.addToLhs(variables[rowGroup], ownCoefficient);
             }
-            solver->addConstraint("", rowConstraint);
         }
     }
+    solver->addConstraints(constraints);
+    constraints.clear();
+    constraints.shrink_to_fit();
 
     // Invoke optimization
     solver->optimize();
@@ -109,17 +121,9 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
 
     // write the solution into the solution vector
-    STORM_LOG_ASSERT(x.size() == variableExpressions.size(), "Dimension of x-vector does not match number of varibales.");
-    auto xIt = x.begin();
-    auto vIt = variableExpressions.begin();
-    for (; xIt != x.end(); ++xIt, ++vIt) {
-        auto const& vBaseExpr = vIt->getBaseExpression();
-        if (vBaseExpr.isVariable()) {
-            *xIt = solver->getContinuousValue(vBaseExpr.asVariableExpression().getVariable());
-        } else {
-            STORM_LOG_ASSERT(vBaseExpr.isRationalLiteralExpression(), "Variable expression has unexpected type.");
-            *xIt = storm::utility::convertNumber<ValueType>(vBaseExpr.asRationalLiteralExpression().getValue());
-        }
+    STORM_LOG_ASSERT(x.size() == variables.size(), "Dimension of x-vector does not match number of varibales.");
+    for (uint64_t rowGroup = 0; rowGroup < x.size(); ++rowGroup) {
+        x[rowGroup] = constantValues[rowGroup] ? constantValues[rowGroup].value() : solver->getContinuousValue(variables[rowGroup]);
     }
 
     // If requested, we store the scheduler for retrieval.
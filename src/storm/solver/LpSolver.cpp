@@ -2,6 +2,7 @@
 #include "LpSolver.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/macros.h"
@@ -133,6 +134,33 @@ storm::expressions::ExpressionManager const& LpSolver<ValueType, RawMode>::getMa
     return *manager;
 }
 
+template<typename ValueType, bool RawMode>
+bool LpSolver<ValueType, RawMode>::supportsObjectiveFunctionCoefficientChanges() const {
+    return false;
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const&, ValueType const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The selected LP solver does not support changing objective function coefficients.");
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    for (auto const& constraint : constraints) {
+        addConstraint("", constraint);
+    }
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::setMipStart(Variable const&, ValueType const&) {
+    // Intentionally left empty: start values are only a hint.
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::setPrimalStart(Variable const&, ValueType const&) {
+    // Intentionally left empty: start values are only a hint.
+}
+
 template<typename ValueType, bool RawMode>
 storm::expressions::Variable LpSolver<ValueType, RawMode>::declareOrGetExpressionVariable(std::string const& name, VariableType const& type) {
     switch (type) {
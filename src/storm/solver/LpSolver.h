@@ -253,6 +253,14 @@ class LpSolver {
      */
     virtual void addConstraint(std::string const& name, Constraint const& constraint) = 0;
 
+    /*!
+     * Adds the given (unnamed) constraints to the LP problem. Solvers may load all constraints with a single call to the backend, which is
+     * considerably faster than adding them one by one for large problems.
+     *
+     * @param constraints The constraints to add.
+     */
+    virtual void addConstraints(std::vector<Constraint> const& constraints);
+
     /*!
      * Adds the given indicator constraint to the LP problem:
      * "If indicatorVariable == indicatorValue, then constraint"
@@ -384,6 +392,40 @@ class LpSolver {
      */
     virtual ValueType getMILPGap(bool relative) const = 0;
 
+    /*!
+     * Retrieves whether this solver supports changing the objective function coefficient of an existing variable.
+     */
+    virtual bool supportsObjectiveFunctionCoefficientChanges() const;
+
+    /*!
+     * Changes the coefficient with which the given (existing) variable appears in the objective function. All other parts of the model are kept,
+     * which allows solving a sequence of problems that only differ in their objective function without re-encoding them.
+     *
+     * @note Only supported if supportsObjectiveFunctionCoefficientChanges() returns true.
+     *
+     * @param variable The variable whose coefficient is changed.
+     * @param coefficient The new coefficient.
+     */
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& coefficient);
+
+    /*!
+     * Provides a start value for the given (integer or binary) variable that is used to construct an initial solution in the next call to optimize().
+     * This is merely a hint, i.e., solvers that do not support MILP starts ignore it and an infeasible start is discarded by the solver.
+     *
+     * @param variable The variable for which the start value is given.
+     * @param value The start value.
+     */
+    virtual void setMipStart(Variable const& variable, ValueType const& value);
+
+    /*!
+     * Provides a start value for the given (continuous) variable that is used to construct an initial basis for the simplex method in the next call
+     * to optimize(). Like MILP starts, this is merely a hint that is ignored by solvers that do not support it.
+     *
+     * @param variable The variable for which the start value is given.
+     * @param value The start value.
+     */
+    virtual void setPrimalStart(Variable const& variable, ValueType const& value);
+
    protected:
     storm::expressions::Variable declareOrGetExpressionVariable(std::string const& name, VariableType const& type);
 
@@ -6,14 +6,17 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
+#include "storm/solver/RacingMinMaxLinearEquationSolver.h"
 #include "storm/solver/TopologicalCudaMinMaxLinearEquationSolver.h"
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/utility/LargeArray.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -36,6 +39,8 @@ bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& en
     STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
                               "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
                               "as checked (if applicable).");
+    storm::utility::LargeArray::advise(x);
+    storm::utility::LargeArray::advise(b);
     return internalSolveEquations(env, d, x, b);
 }
 
@@ -45,6 +50,27 @@ void MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& en
     solveEquations(env, convert(this->direction), x, b);
 }
 
+template<typename ValueType>
+bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                                                           std::vector<std::vector<ValueType>> const& b) const {
+    STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
+                              "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
+                              "as checked (if applicable).");
+    STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException,
+                    "The number of solution vectors (" << x.size() << ") does not match the number of right-hand sides (" << b.size() << ").");
+    return internalSolveEquationsBatch(env, d, x, b);
+}
+
+template<typename ValueType>
+bool MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                                                                        std::vector<std::vector<ValueType>> const& b) const {
+    bool result = true;
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        result &= internalSolveEquations(env, d, x[i], b[i]);
+    }
+    return result;
+}
+
 template<typename ValueType>
 void MinMaxLinearEquationSolver<ValueType>::setOptimizationDirection(OptimizationDirection d) {
     direction = convert(d);
@@ -219,9 +245,11 @@ template<typename ValueType>
 std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> GeneralMinMaxLinearEquationSolverFactory<ValueType>::create(Environment const& env) const {
     std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> result;
     auto method = env.solver().minMax().getMethod();
-    if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
+    if (method == MinMaxMethod::Portfolio || (env.solver().minMax().isRaceMethodSet() && env.solver().minMax().getRaceMethod() != method)) {
+        result = std::make_unique<RacingMinMaxLinearEquationSolver<ValueType>>();
+    } else if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::AsynchronousValueIteration || method == MinMaxMethod::PrioritizedValueIteration) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType>>(std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>());
     } else if (method == MinMaxMethod::Topological) {
         result = std::make_unique<TopologicalMinMaxLinearEquationSolver<ValueType>>();
@@ -243,9 +271,11 @@ std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMax
     Environment const& env) const {
     std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> result;
     auto method = env.solver().minMax().getMethod();
-    if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
+    if (method == MinMaxMethod::Portfolio || (env.solver().minMax().isRaceMethodSet() && env.solver().minMax().getRaceMethod() != method)) {
+        result = std::make_unique<RacingMinMaxLinearEquationSolver<storm::RationalNumber>>();
+    } else if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::AsynchronousValueIteration || method == MinMaxMethod::PrioritizedValueIteration) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<storm::RationalNumber>>(
             std::make_unique<GeneralLinearEquationSolverFactory<storm::RationalNumber>>());
     } else if (method == MinMaxMethod::LinearProgramming) {
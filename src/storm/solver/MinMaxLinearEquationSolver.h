@@ -61,6 +61,20 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     void solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+    /*!
+     * Solves the equation systems x[i] = min/max(A*x[i] + b[i]) for several vectors b[i]. Depending on the method, the systems
+     * are solved simultaneously such that the matrix only has to be traversed once per iteration for all of them. Note that
+     * schedulers are not tracked for the individual systems.
+     *
+     * @param d The optimization direction.
+     * @param x The solution vectors. There must be one vector per right-hand side.
+     * @param b The vectors to add after matrix-vector multiplication.
+     *
+     * @return true iff all systems were solved.
+     */
+    bool solveEquations(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                        std::vector<std::vector<ValueType>> const& b) const;
+
     /*!
      * Sets an optimization direction to use for calls to methods that do not explicitly provide one.
      */
@@ -180,6 +194,12 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
    protected:
     virtual bool internalSolveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+    /*!
+     * Solves the equation systems for several right-hand sides. By default, the systems are solved one after another.
+     */
+    virtual bool internalSolveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const;
+
     /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
     OptimizationDirectionSetting direction;
 
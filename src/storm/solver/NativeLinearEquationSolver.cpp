@@ -11,6 +11,7 @@
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/multiplier/MixedPrecisionMultiplier.h"
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
@@ -57,7 +58,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const&
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Gauss-Seidel, SOR omega = " << omega << ")");
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, getMatrixRowCount());
     }
 
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
@@ -112,7 +113,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobi(Environment con
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Jacobi)");
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, getMatrixRowCount());
     }
 
     // Get a Jacobi decomposition of the matrix A.
@@ -317,17 +318,18 @@ template<typename ValueType>
 typename NativeLinearEquationSolver<ValueType>::PowerIterationResult NativeLinearEquationSolver<ValueType>::performPowerIteration(
     Environment const& env, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision,
     bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maxIterations,
-    storm::solver::MultiplicationStyle const& multiplicationStyle) const {
+    storm::solver::MultiplicationStyle const& multiplicationStyle, Multiplier<ValueType> const* customMultiplier) const {
     bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
+    Multiplier<ValueType> const& multiplier = customMultiplier ? *customMultiplier : *this->multiplier;
 
     uint64_t iterations = currentIterations;
     SolverStatus status = this->terminateNow(*currentX, guarantee) ? SolverStatus::TerminatedEarly : SolverStatus::InProgress;
     while (status == SolverStatus::InProgress && iterations < maxIterations) {
         if (useGaussSeidelMultiplication) {
             *newX = *currentX;
-            this->multiplier->multiplyGaussSeidel(env, *newX, &b);
+            multiplier.multiplyGaussSeidel(env, *newX, &b);
         } else {
-            this->multiplier->multiply(env, *currentX, &b, *newX);
+            multiplier.multiply(env, *currentX, &b, *newX);
         }
 
         // Check for convergence.
@@ -354,7 +356,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
 
     // Prepare the solution vectors.
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, getMatrixRowCount());
     }
     if (!this->multiplier) {
         this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -375,9 +377,29 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     // Forward call to power iteration implementation.
     this->startMeasureProgress();
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-    PowerIterationResult result =
-        this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, 0,
-                                    env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+    PowerIterationResult result(0, SolverStatus::InProgress);
+    if (env.solver().native().isMixedPrecisionSet()) {
+        if (std::is_same<ValueType, double>::value && guarantee == SolverGuarantee::None) {
+            // First iterate on the single precision copy of the matrix and then polish the result with the original matrix.
+            if (!this->mixedPrecisionMultiplier) {
+                this->mixedPrecisionMultiplier = std::make_unique<storm::solver::MixedPrecisionMultiplier<ValueType>>(*A);
+            }
+            ValueType singlePrecision = storm::utility::max<ValueType>(precision, storm::utility::convertNumber<ValueType>(1e-6));
+            result = this->performPowerIteration(env, currentX, newX, b, singlePrecision, relative, guarantee, 0, maxIter,
+                                                 env.solver().native().getPowerMethodMultiplicationStyle(), this->mixedPrecisionMultiplier.get());
+            STORM_LOG_INFO("Performed " << result.iterations << " power iterations in single precision.");
+        } else {
+            STORM_LOG_INFO("Mixed precision power iteration is only applied to double precision computations without solution guarantee.");
+        }
+    }
+    if (result.status == SolverStatus::InProgress || result.status == SolverStatus::Converged) {
+        uint64_t previousIterations = result.iterations;
+        result = this->performPowerIteration(env, currentX, newX, b, precision, relative, guarantee, previousIterations, maxIter,
+                                             env.solver().native().getPowerMethodMultiplicationStyle());
+        result.iterations += previousIterations;
+    }
 
     // Swap the result in place.
     if (currentX == this->cachedRowVector.get()) {
@@ -393,6 +415,58 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsPowerBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                     std::vector<std::vector<ValueType>> const& b) const {
+    STORM_LOG_INFO("Solving " << x.size() << " linear equation systems (" << getMatrixRowCount()
+                              << " rows) simultaneously with NativeLinearEquationSolver (Power)");
+    STORM_LOG_INFO_COND(env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular,
+                        "Solving multiple equation systems simultaneously always uses regular multiplications.");
+
+    if (!this->multiplier) {
+        this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+    }
+
+    // Store the vectors of all systems such that the values of the same row are consecutive. This way, each matrix entry is only loaded once.
+    uint64_t const batchSize = x.size();
+    std::vector<ValueType> currentX = storm::utility::vector::interleaveVectors(x);
+    std::vector<ValueType> const batchB = storm::utility::vector::interleaveVectors(b);
+    std::vector<ValueType> newX(currentX.size());
+
+    this->startMeasureProgress();
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && iterations < maxIter) {
+        this->multiplier->multiplyBatch(env, currentX, &batchB, newX, batchSize);
+
+        // Check for convergence of all systems.
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, newX, precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+
+        std::swap(currentX, newX);
+        ++iterations;
+
+        status = this->updateStatus(status, false, iterations, maxIter);
+
+        // Potentially show progress.
+        this->showProgressIterative(iterations);
+    }
+
+    storm::utility::vector::deinterleaveVector(currentX, x);
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    this->logIterations(status == SolverStatus::Converged, status == SolverStatus::TerminatedEarly, iterations);
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
     storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -433,7 +507,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     bool useGaussSeidelMultiplication = env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
     std::vector<ValueType>* tmp;
     if (!useGaussSeidelMultiplication) {
-        cachedRowVector2 = std::make_unique<std::vector<ValueType>>(x.size());
+        cachedRowVector2 = acquireWorkspaceVector<ValueType>(env, x.size());
         tmp = cachedRowVector2.get();
     }
 
@@ -593,7 +667,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
     // Prepare the solution vectors and the helper.
     assert(x.size() == this->A->getRowCount());
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>();
+        this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, 0);
     }
     if (!this->soundValueIterationHelper) {
         this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(
@@ -659,7 +733,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
     }
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+        this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowCount());
     }
     if (!optimisticValueIterationHelper) {
         optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(*this->A);
@@ -817,7 +891,7 @@ NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelper(Enviro
     std::vector<storm::RationalNumber> rationalB = storm::utility::vector::convertNumericVector<storm::RationalNumber>(b);
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+        this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowCount());
     }
     if (!this->multiplier) {
         this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -848,7 +922,7 @@ NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelper(Enviro
     // Version for when the overall value type is exact and the same type is to be used for the imprecise part.
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+        this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowCount());
     }
     if (!this->multiplier) {
         this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -911,7 +985,7 @@ typename std::enable_if<!std::is_same<ValueType, ImpreciseType>::value, bool>::t
         STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
 
         if (!this->cachedRowVector) {
-            this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            this->cachedRowVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
         }
         if (!this->multiplier) {
             this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -984,6 +1058,64 @@ void NativeLinearEquationSolver<ValueType>::logIterations(bool converged, bool t
     }
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsKrylov(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                 NativeLinearEquationSolverMethod method) const {
+    if constexpr (!std::is_same<ValueType, double>::value) {
+        STORM_LOG_WARN("The native Krylov methods are only implemented for double precision, falling back to Gauss-Seidel.");
+        return this->solveEquationsSOR(env, x, b, storm::utility::one<ValueType>());
+    } else {
+        if (method == NativeLinearEquationSolverMethod::Multigrid) {
+            // Multigrid is used as preconditioner for GMRES.
+            if (!multigridSolverHelper) {
+                multigridSolverHelper = std::make_unique<storm::solver::helper::MultigridSolverHelper<ValueType>>(*A);
+                auto const* multigrid = multigridSolverHelper.get();
+                krylovSolverHelper = std::make_unique<storm::solver::helper::KrylovSolverHelper<ValueType>>(
+                    env, *A, [multigrid](std::vector<ValueType>& vector) { multigrid->applyCycle(vector); });
+            }
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (GMRES with multigrid preconditioner, "
+                                                              << multigridSolverHelper->getNumberOfLevels() << " levels, coarsest level has "
+                                                              << multigridSolverHelper->getSizeOfLevel(multigridSolverHelper->getNumberOfLevels() - 1)
+                                                              << " rows)");
+        } else {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (" << toString(method)
+                                                              << ", preconditioner " << toString(env.solver().native().getPreconditioner()) << ")");
+            if (!krylovSolverHelper || multigridSolverHelper) {
+                multigridSolverHelper.reset();
+                krylovSolverHelper =
+                    std::make_unique<storm::solver::helper::KrylovSolverHelper<ValueType>>(env, *A, env.solver().native().getPreconditioner());
+            }
+        }
+
+        ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+        uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+        bool relative = env.solver().native().getRelativeTerminationCriterion();
+
+        this->startMeasureProgress();
+        auto updateStatus = [&](SolverStatus status, std::vector<ValueType> const& currentX, uint64_t iterations) {
+            status = this->updateStatus(status, currentX, SolverGuarantee::None, iterations, maxIter);
+            this->showProgressIterative(iterations);
+            return status;
+        };
+        std::pair<uint64_t, SolverStatus> result;
+        if (method == NativeLinearEquationSolverMethod::Bicgstab) {
+            result = krylovSolverHelper->solveBicgstab(env, x, b, precision, relative, updateStatus);
+        } else {
+            STORM_LOG_ASSERT(method == NativeLinearEquationSolverMethod::Gmres || method == NativeLinearEquationSolverMethod::Multigrid,
+                             "Unexpected Krylov method.");
+            result = krylovSolverHelper->solveGmres(env, x, b, precision, relative, env.solver().native().getRestartThreshold(), updateStatus);
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        this->reportStatus(result.second, result.first);
+
+        return result.second == SolverStatus::Converged;
+    }
+}
+
 template<typename ValueType>
 NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMethod(Environment const& env, bool isExactMode) const {
     // Adjust the method if none was specified and we want exact or sound computations
@@ -1015,7 +1147,8 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
 
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    switch (method) {
         case NativeLinearEquationSolverMethod::SOR:
             return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
         case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -1034,11 +1167,26 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
             return this->solveEquationsIntervalIteration(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
             return this->solveEquationsRationalSearch(env, x, b);
+        case NativeLinearEquationSolverMethod::Bicgstab:
+        case NativeLinearEquationSolverMethod::Gmres:
+        case NativeLinearEquationSolverMethod::Multigrid:
+            return this->solveEquationsKrylov(env, x, b, method);
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
     return false;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                        std::vector<std::vector<ValueType>> const& b) const {
+    // Power iteration can treat all systems at once unless a custom termination condition has to be checked for each of them.
+    if (x.size() > 1 && !this->hasCustomTerminationCondition() &&
+        getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) == NativeLinearEquationSolverMethod::Power) {
+        return this->solveEquationsPowerBatch(env, x, b);
+    }
+    return LinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, x, b);
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
     auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
@@ -1071,8 +1219,11 @@ void NativeLinearEquationSolver<ValueType>::clearCache() const {
     cachedRowVector2.reset();
     walkerChaeData.reset();
     multiplier.reset();
+    mixedPrecisionMultiplier.reset();
     soundValueIterationHelper.reset();
     optimisticValueIterationHelper.reset();
+    krylovSolverHelper.reset();
+    multigridSolverHelper.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
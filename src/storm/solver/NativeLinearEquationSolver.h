@@ -7,6 +7,8 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/KrylovSolverHelper.h"
+#include "storm/solver/helper/MultigridSolverHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
@@ -39,6 +41,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
    protected:
     virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+    virtual bool internalSolveEquationsBatch(storm::Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const override;
 
    private:
     struct PowerIterationResult {
@@ -56,7 +60,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     PowerIterationResult performPowerIteration(Environment const& env, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX,
                                                std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee,
                                                uint64_t currentIterations, uint64_t maxIterations,
-                                               storm::solver::MultiplicationStyle const& multiplicationStyle) const;
+                                               storm::solver::MultiplicationStyle const& multiplicationStyle,
+                                               Multiplier<ValueType> const* customMultiplier = nullptr) const;
 
     void logIterations(bool converged, bool terminate, uint64_t iterations) const;
 
@@ -69,10 +74,14 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual bool solveEquationsJacobi(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsWalkerChae(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsPower(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsPowerBatch(storm::Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                          std::vector<std::vector<ValueType>> const& b) const;
     virtual bool solveEquationsSoundValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsKrylov(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                      NativeLinearEquationSolverMethod method) const;
 
     template<typename RationalType, typename ImpreciseType>
     bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver,
@@ -103,11 +112,14 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     // An object to dispatch all multiplication operations.
     mutable std::unique_ptr<Multiplier<ValueType>> multiplier;
+    mutable std::unique_ptr<Multiplier<ValueType>> mixedPrecisionMultiplier;
 
     // cached auxiliary data
-    mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector2;  // A.getRowCount() rows
+    mutable SolverWorkspace::VectorPointer<ValueType> cachedRowVector2;  // A.getRowCount() rows
     mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
     mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+    mutable std::unique_ptr<storm::solver::helper::KrylovSolverHelper<ValueType>> krylovSolverHelper;
+    mutable std::unique_ptr<storm::solver::helper::MultigridSolverHelper<ValueType>> multigridSolverHelper;
 
     struct JacobiDecomposition {
         JacobiDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
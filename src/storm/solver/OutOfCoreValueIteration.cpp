@@ -0,0 +1,78 @@
+#include "storm/solver/OutOfCoreValueIteration.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+OutOfCoreValueIteration::OutOfCoreValueIteration(storm::storage::MappedSparseMatrix const& matrix)
+    : matrix(matrix), precision(1e-6), relative(true), maximalNumberOfIterations(20000), numberOfIterations(0) {
+    // Intentionally left empty.
+}
+
+void OutOfCoreValueIteration::setPrecision(double precision) {
+    this->precision = precision;
+}
+
+void OutOfCoreValueIteration::setRelative(bool relative) {
+    this->relative = relative;
+}
+
+void OutOfCoreValueIteration::setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations) {
+    this->maximalNumberOfIterations = maximalNumberOfIterations;
+}
+
+std::vector<double> OutOfCoreValueIteration::computeReachabilityProbabilities(storm::storage::BitVector const& targetStates,
+                                                                              boost::optional<storm::OptimizationDirection> const& direction) {
+    uint64_t numberOfStates = matrix.getRowGroupCount();
+    STORM_LOG_THROW(targetStates.size() == numberOfStates, storm::exceptions::InvalidArgumentException, "Unexpected size of the target states.");
+    STORM_LOG_THROW(matrix.getColumnCount() == numberOfStates, storm::exceptions::InvalidArgumentException, "Expected a square matrix.");
+    STORM_LOG_THROW(direction || matrix.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException,
+                    "An optimization direction is required for nondeterministic models.");
+
+    std::vector<double> values(numberOfStates, 0.0);
+    for (auto state : targetStates) {
+        values[state] = 1.0;
+    }
+    std::vector<double> newValues(numberOfStates);
+
+    bool converged = false;
+    numberOfIterations = 0;
+    while (!converged && numberOfIterations < maximalNumberOfIterations) {
+        if (direction) {
+            matrix.multiplyAndReduce(direction.get(), values, newValues);
+        } else {
+            matrix.multiplyWithVector(values, newValues);
+        }
+        ++numberOfIterations;
+
+        double maximalDifference = 0.0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (targetStates.get(state)) {
+                newValues[state] = 1.0;
+                continue;
+            }
+            double difference = std::abs(newValues[state] - values[state]);
+            if (relative && newValues[state] != 0.0) {
+                difference /= newValues[state];
+            }
+            maximalDifference = std::max(maximalDifference, difference);
+        }
+        std::swap(values, newValues);
+        converged = maximalDifference <= precision;
+    }
+    STORM_LOG_WARN_COND(converged, "Out-of-core value iteration did not converge within " << numberOfIterations << " iterations.");
+    STORM_LOG_INFO("Out-of-core value iteration performed " << numberOfIterations << " iterations.");
+    return values;
+}
+
+uint64_t OutOfCoreValueIteration::getNumberOfIterations() const {
+    return numberOfIterations;
+}
+
+}  // namespace solver
+}  // namespace storm
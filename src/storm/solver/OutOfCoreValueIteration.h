@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MappedSparseMatrix.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * Value iteration on a matrix that is not held in main memory (e.g., a matrix that is mapped from a binary model file). Every iteration is a
+ * Jacobi step, i.e., a single sequential pass over the entries that reads the previous values and writes the new ones, so at most two vectors
+ * over the states are kept in main memory.
+ *
+ * No qualitative precomputations are performed, i.e., the iterations start from zero and converge to the least fixed point from below.
+ */
+class OutOfCoreValueIteration {
+   public:
+    OutOfCoreValueIteration(storm::storage::MappedSparseMatrix const& matrix);
+
+    void setPrecision(double precision);
+    void setRelative(bool relative);
+    void setMaximalNumberOfIterations(uint64_t maximalNumberOfIterations);
+
+    /*!
+     * Computes the probabilities to reach the target states in a DTMC (without optimization direction) or the optimal probabilities in an MDP.
+     *
+     * @param targetStates The target states.
+     * @param direction If given, the values of the choices of a state are minimized or maximized.
+     */
+    std::vector<double> computeReachabilityProbabilities(storm::storage::BitVector const& targetStates,
+                                                         boost::optional<storm::OptimizationDirection> const& direction = boost::none);
+
+    /*!
+     * Retrieves the number of iterations (i.e., passes over the matrix) of the last computation.
+     */
+    uint64_t getNumberOfIterations() const;
+
+   private:
+    storm::storage::MappedSparseMatrix const& matrix;
+    double precision;
+    bool relative;
+    uint64_t maximalNumberOfIterations;
+    uint64_t numberOfIterations;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,208 @@
+#include "storm/solver/RacingMinMaxLinearEquationSolver.h"
+
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/exceptions/InvalidEnvironmentException.h"
+#include "storm/solver/TerminationCondition.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace detail {
+// Stops a participant of a race once the race is decided (or once the termination condition of the racing solver triggers).
+template<typename ValueType>
+class RaceTerminationCondition : public TerminationCondition<ValueType> {
+   public:
+    RaceTerminationCondition(std::atomic<bool> const& raceDecided, TerminationCondition<ValueType> const* condition)
+        : raceDecided(raceDecided), condition(condition) {
+        // Intentionally left empty.
+    }
+
+    virtual bool terminateNow(std::vector<ValueType> const& currentValues, SolverGuarantee const& guarantee = SolverGuarantee::None) const override {
+        return raceDecided.load(std::memory_order_relaxed) || (condition && condition->terminateNow(currentValues, guarantee));
+    }
+
+    virtual bool terminateNow(std::function<ValueType(uint64_t const&)> const& valueGetter,
+                              SolverGuarantee const& guarantee = SolverGuarantee::None) const override {
+        return raceDecided.load(std::memory_order_relaxed) || (condition && condition->terminateNow(valueGetter, guarantee));
+    }
+
+    virtual bool requiresGuarantee(SolverGuarantee const& guarantee) const override {
+        return condition && condition->requiresGuarantee(guarantee);
+    }
+
+   private:
+    std::atomic<bool> const& raceDecided;
+    TerminationCondition<ValueType> const* condition;
+};
+
+// Adds the given requirement to the given requirements, where the requirement is critical if it is critical in one of them.
+void addRequirement(MinMaxLinearEquationSolverRequirements& requirements, MinMaxLinearEquationSolverRequirements::Element const& element,
+                    SolverRequirement const& requirement) {
+    if (!requirement) {
+        return;
+    }
+    bool critical = requirement.isCritical() || (requirements.get(element) && requirements.get(element).isCritical());
+    switch (element) {
+        case MinMaxLinearEquationSolverRequirements::Element::Acyclic:
+            requirements.requireAcyclic(critical);
+            break;
+        case MinMaxLinearEquationSolverRequirements::Element::UniqueSolution:
+            requirements.requireUniqueSolution(critical);
+            break;
+        case MinMaxLinearEquationSolverRequirements::Element::ValidInitialScheduler:
+            requirements.requireValidInitialScheduler(critical);
+            break;
+        case MinMaxLinearEquationSolverRequirements::Element::LowerBounds:
+            requirements.requireLowerBounds(critical);
+            break;
+        case MinMaxLinearEquationSolverRequirements::Element::UpperBounds:
+            requirements.requireUpperBounds(critical);
+            break;
+    }
+}
+}  // namespace detail
+
+template<typename ValueType>
+RacingMinMaxLinearEquationSolver<ValueType>::RacingMinMaxLinearEquationSolver() {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+RacingMinMaxLinearEquationSolver<ValueType>::RacingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A)
+    : StandardMinMaxLinearEquationSolver<ValueType>(A) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+RacingMinMaxLinearEquationSolver<ValueType>::RacingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A)
+    : StandardMinMaxLinearEquationSolver<ValueType>(std::move(A)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::vector<storm::Environment> RacingMinMaxLinearEquationSolver<ValueType>::getEnvironmentsOfRace(storm::Environment const& env) const {
+    auto const& minMaxEnv = env.solver().minMax();
+    std::vector<storm::Environment> result;
+    if (minMaxEnv.getMethod() == MinMaxMethod::Portfolio) {
+        STORM_LOG_THROW(!minMaxEnv.getPortfolioMethods().empty(), storm::exceptions::InvalidEnvironmentException, "The portfolio is empty.");
+        for (auto method : minMaxEnv.getPortfolioMethods()) {
+            result.push_back(env);
+            result.back().solver().minMax().setMethod(method, minMaxEnv.isMethodSetFromDefault());
+        }
+    } else {
+        STORM_LOG_ASSERT(minMaxEnv.isRaceMethodSet(), "The environment does not specify a race method.");
+        result = {env, env};
+        result.back().solver().minMax().setMethod(minMaxEnv.getRaceMethod(), minMaxEnv.isMethodSetFromDefault());
+    }
+    for (auto& participantEnv : result) {
+        participantEnv.solver().minMax().unsetRaceMethod();
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> RacingMinMaxLinearEquationSolver<ValueType>::createParticipant(storm::Environment const& env) const {
+    std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(env);
+    if (this->A) {
+        solver->setMatrix(*this->A);
+    }
+    solver->setHasUniqueSolution(this->hasUniqueSolution());
+    solver->setHasNoEndComponents(this->hasNoEndComponents());
+    solver->setTrackScheduler(this->isTrackSchedulerSet());
+    solver->setRequirementsChecked(this->isRequirementsCheckedSet());
+    solver->setBoundsFromOtherSolver(*this);
+    if (this->hasRelevantValues()) {
+        solver->setRelevantValues(storm::storage::BitVector(this->getRelevantValues()));
+    }
+    if (this->hasInitialScheduler()) {
+        solver->setInitialScheduler(std::vector<uint_fast64_t>(this->getInitialScheduler()));
+    }
+    if (this->choiceFixedForRowGroup) {
+        solver->setSchedulerFixedForRowGroup(storm::storage::BitVector(this->choiceFixedForRowGroup.get()));
+    }
+    return solver;
+}
+
+template<typename ValueType>
+bool RacingMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                         std::vector<ValueType> const& b) const {
+    std::vector<storm::Environment> environments = getEnvironmentsOfRace(env);
+    uint64_t const numberOfParticipants = environments.size();
+    std::vector<std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>> solvers(numberOfParticipants);
+    // The matrix is shared by all participants, so only the solution vectors are copied.
+    std::vector<std::vector<ValueType>> solutions(numberOfParticipants, x);
+    std::vector<char> results(numberOfParticipants, false);
+    std::vector<std::exception_ptr> exceptions(numberOfParticipants);
+
+    // The first participant that solves the equation system decides the race.
+    std::atomic<bool> raceDecided(false);
+    std::atomic<int64_t> winner(-1);
+    TerminationCondition<ValueType> const* condition = this->hasCustomTerminationCondition() ? &this->getTerminationCondition() : nullptr;
+    for (uint64_t index = 0; index < numberOfParticipants; ++index) {
+        solvers[index] = createParticipant(environments[index]);
+        solvers[index]->setTerminationCondition(std::make_unique<detail::RaceTerminationCondition<ValueType>>(raceDecided, condition));
+    }
+
+    auto participate = [&](uint64_t index) {
+        try {
+            results[index] = solvers[index]->solveEquations(environments[index], dir, solutions[index], b);
+            int64_t expected = -1;
+            if (results[index] && winner.compare_exchange_strong(expected, static_cast<int64_t>(index))) {
+                raceDecided = true;
+            }
+        } catch (...) {
+            exceptions[index] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t index = 1; index < numberOfParticipants; ++index) {
+        threads.emplace_back(participate, index);
+    }
+    participate(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    uint64_t const chosen = winner.load() >= 0 ? static_cast<uint64_t>(winner.load()) : 0;
+    if (winner.load() < 0 && exceptions[0]) {
+        std::rethrow_exception(exceptions[0]);
+    }
+    STORM_LOG_INFO("Method '" << toString(environments[chosen].solver().minMax().getMethod()) << "' "
+                              << (winner.load() >= 0 ? "won the race." : "did not solve the equation system."));
+
+    x = std::move(solutions[chosen]);
+    if (this->isTrackSchedulerSet() && solvers[chosen]->hasScheduler()) {
+        this->schedulerChoices = solvers[chosen]->getSchedulerChoices();
+    }
+    return results[chosen];
+}
+
+template<typename ValueType>
+MinMaxLinearEquationSolverRequirements RacingMinMaxLinearEquationSolver<ValueType>::getRequirements(
+    Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
+    MinMaxLinearEquationSolverRequirements requirements;
+    for (auto const& participantEnv : getEnvironmentsOfRace(env)) {
+        MinMaxLinearEquationSolverRequirements participantRequirements =
+            createParticipant(participantEnv)->getRequirements(participantEnv, direction, hasInitialScheduler);
+        for (auto element : {MinMaxLinearEquationSolverRequirements::Element::Acyclic, MinMaxLinearEquationSolverRequirements::Element::UniqueSolution,
+                             MinMaxLinearEquationSolverRequirements::Element::ValidInitialScheduler,
+                             MinMaxLinearEquationSolverRequirements::Element::LowerBounds, MinMaxLinearEquationSolverRequirements::Element::UpperBounds}) {
+            detail::addRequirement(requirements, element, participantRequirements.get(element));
+        }
+    }
+    return requirements;
+}
+
+template class RacingMinMaxLinearEquationSolver<double>;
+
+#ifdef STORM_HAVE_CARL
+template class RacingMinMaxLinearEquationSolver<storm::RationalNumber>;
+#endif
+}  // namespace solver
+}  // namespace storm
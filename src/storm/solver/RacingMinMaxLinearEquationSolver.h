@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * This solver races several methods against each other: either the methods of the portfolio (if the method of the environment is the portfolio
+ * method) or the method of the environment and its race method (see MinMaxSolverEnvironment). All methods solve the equation system concurrently
+ * on the same matrix and the solution of the one that finishes first is taken. The other methods are stopped at their next check of the
+ * termination condition, i.e., methods that do not check the termination condition (e.g. linear programming) always run to completion.
+ */
+template<typename ValueType>
+class RacingMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<ValueType> {
+   public:
+    RacingMinMaxLinearEquationSolver();
+    RacingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A);
+    RacingMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A);
+
+    virtual ~RacingMinMaxLinearEquationSolver() {}
+
+    /*!
+     * Retrieves the requirements of this solver, which are the requirements of all methods.
+     */
+    virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env,
+                                                                   boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none,
+                                                                   bool const& hasInitialScheduler = false) const override;
+
+   protected:
+    virtual bool internalSolveEquations(storm::Environment const& env, OptimizationDirection d, std::vector<ValueType>& x,
+                                        std::vector<ValueType> const& b) const override;
+
+   private:
+    /*!
+     * Retrieves the environments of the methods of the race.
+     */
+    std::vector<storm::Environment> getEnvironmentsOfRace(storm::Environment const& env) const;
+
+    /*!
+     * Creates a solver for the given environment that has the same properties as this solver.
+     */
+    std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> createParticipant(storm::Environment const& env) const;
+};
+}  // namespace solver
+}  // namespace storm
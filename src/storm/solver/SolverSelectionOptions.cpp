@@ -26,6 +26,12 @@ std::string toString(MinMaxMethod m) {
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
             return "vi-to-pi";
+        case MinMaxMethod::AsynchronousValueIteration:
+            return "asynchronousvalueiteration";
+        case MinMaxMethod::PrioritizedValueIteration:
+            return "prioritizedvalueiteration";
+        case MinMaxMethod::Portfolio:
+            return "portfolio";
     }
     return "invalid";
 }
@@ -36,6 +42,10 @@ std::string toString(MultiplierType t) {
             return "Native";
         case MultiplierType::Gmmxx:
             return "Gmmxx";
+        case MultiplierType::Simd:
+            return "Simd";
+        case MultiplierType::Cuda:
+            return "Cuda";
     }
     return "invalid";
 }
@@ -46,6 +56,8 @@ std::string toString(GameMethod m) {
             return "valueiteration";
         case GameMethod::PolicyIteration:
             return "PolicyIteration";
+        case GameMethod::IntervalIteration:
+            return "intervaliteration";
     }
     return "invalid";
 }
@@ -136,6 +148,24 @@ std::string toString(NativeLinearEquationSolverMethod t) {
             return "IntervalIteration";
         case NativeLinearEquationSolverMethod::RationalSearch:
             return "RationalSearch";
+        case NativeLinearEquationSolverMethod::Bicgstab:
+            return "BiCGSTAB";
+        case NativeLinearEquationSolverMethod::Gmres:
+            return "GMRES";
+        case NativeLinearEquationSolverMethod::Multigrid:
+            return "Multigrid";
+    }
+    return "invalid";
+}
+
+std::string toString(NativeLinearEquationSolverPreconditioner t) {
+    switch (t) {
+        case NativeLinearEquationSolverPreconditioner::Diagonal:
+            return "diagonal";
+        case NativeLinearEquationSolverPreconditioner::Ilu:
+            return "ilu";
+        case NativeLinearEquationSolverPreconditioner::None:
+            return "none";
     }
     return "invalid";
 }
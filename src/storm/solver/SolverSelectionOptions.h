@@ -6,8 +6,10 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic)
-    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx) ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
+                              SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic, AsynchronousValueIteration,
+                              PrioritizedValueIteration, Portfolio)
+    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx, Simd, Cuda)
+        ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration, IntervalIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
 
@@ -16,7 +18,9 @@ ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, Lin
                         ExtendEnumsWithSelectionField(SmtSolverType, Z3, Mathsat)
 
                             ExtendEnumsWithSelectionField(NativeLinearEquationSolverMethod, Jacobi, GaussSeidel, SOR, WalkerChae, Power, SoundValueIteration,
-                                                          OptimisticValueIteration, IntervalIteration, RationalSearch)
+                                                          OptimisticValueIteration, IntervalIteration, RationalSearch, Bicgstab, Gmres,
+                                                          Multigrid)
+                                ExtendEnumsWithSelectionField(NativeLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                 ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverMethod, Bicgstab, Qmr, Gmres)
                                     ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                         ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
@@ -0,0 +1,109 @@
+#include "storm/solver/SolverWorkspace.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace solver {
+
+SolverWorkspace::SolverWorkspace(uint64_t maximalNumberOfVectors)
+    : maximalNumberOfVectors(maximalNumberOfVectors), numberOfAllocations(0), numberOfReuses(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::vector<std::unique_ptr<std::vector<ValueType>>>& SolverWorkspace::getPool() {
+    auto& pool = pools[std::type_index(typeid(ValueType))];
+    if (!pool) {
+        pool = std::make_shared<std::vector<std::unique_ptr<std::vector<ValueType>>>>();
+    }
+    return *std::static_pointer_cast<std::vector<std::unique_ptr<std::vector<ValueType>>>>(pool);
+}
+
+template<typename ValueType>
+SolverWorkspace::VectorPointer<ValueType> SolverWorkspace::acquire(std::shared_ptr<SolverWorkspace> const& workspace, uint64_t size) {
+    std::unique_ptr<std::vector<ValueType>> vector;
+    if (workspace) {
+        std::lock_guard<std::mutex> lock(workspace->mutex);
+        auto& pool = workspace->getPool<ValueType>();
+        // Prefer the smallest vector that is large enough. Otherwise, the largest one is grown.
+        auto isBetter = [size](std::vector<ValueType> const& candidate, std::vector<ValueType> const& current) {
+            bool candidateFits = candidate.capacity() >= size;
+            if (candidateFits != (current.capacity() >= size)) {
+                return candidateFits;
+            }
+            return candidateFits ? candidate.capacity() < current.capacity() : candidate.capacity() > current.capacity();
+        };
+        auto best = pool.begin();
+        for (auto it = pool.begin(); it != pool.end(); ++it) {
+            if (isBetter(**it, **best)) {
+                best = it;
+            }
+        }
+        if (best != pool.end()) {
+            vector = std::move(*best);
+            pool.erase(best);
+        }
+        if (vector && vector->capacity() >= size) {
+            ++workspace->numberOfReuses;
+        } else {
+            ++workspace->numberOfAllocations;
+        }
+    }
+    if (vector) {
+        vector->assign(size, storm::utility::zero<ValueType>());
+    } else {
+        vector = std::make_unique<std::vector<ValueType>>(size, storm::utility::zero<ValueType>());
+    }
+    return VectorPointer<ValueType>(vector.release(), VectorDeleter<ValueType>(workspace));
+}
+
+template<typename ValueType>
+void SolverWorkspace::release(std::vector<ValueType>* vector) {
+    std::unique_ptr<std::vector<ValueType>> owned(vector);
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& pool = getPool<ValueType>();
+    if (pool.size() < maximalNumberOfVectors) {
+        pool.push_back(std::move(owned));
+    }
+}
+
+uint64_t SolverWorkspace::getNumberOfAllocations() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfAllocations;
+}
+
+uint64_t SolverWorkspace::getNumberOfReuses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfReuses;
+}
+
+void SolverWorkspace::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    pools.clear();
+}
+
+template<typename ValueType>
+SolverWorkspace::VectorPointer<ValueType> acquireWorkspaceVector(Environment const& env, uint64_t size) {
+    return SolverWorkspace::acquire<ValueType>(env.solver().getWorkspace(), size);
+}
+
+template SolverWorkspace::VectorPointer<double> SolverWorkspace::acquire<double>(std::shared_ptr<SolverWorkspace> const& workspace, uint64_t size);
+template void SolverWorkspace::release<double>(std::vector<double>* vector);
+template SolverWorkspace::VectorPointer<double> acquireWorkspaceVector<double>(Environment const& env, uint64_t size);
+
+template SolverWorkspace::VectorPointer<storm::RationalNumber> SolverWorkspace::acquire<storm::RationalNumber>(
+    std::shared_ptr<SolverWorkspace> const& workspace, uint64_t size);
+template void SolverWorkspace::release<storm::RationalNumber>(std::vector<storm::RationalNumber>* vector);
+template SolverWorkspace::VectorPointer<storm::RationalNumber> acquireWorkspaceVector<storm::RationalNumber>(Environment const& env,
+                                                                                                          uint64_t size);
+
+template SolverWorkspace::VectorPointer<storm::RationalFunction> SolverWorkspace::acquire<storm::RationalFunction>(
+    std::shared_ptr<SolverWorkspace> const& workspace, uint64_t size);
+template void SolverWorkspace::release<storm::RationalFunction>(std::vector<storm::RationalFunction>* vector);
+template SolverWorkspace::VectorPointer<storm::RationalFunction> acquireWorkspaceVector<storm::RationalFunction>(Environment const& env,
+                                                                                                              uint64_t size);
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * A pool of auxiliary vectors that solvers return upon clearing their caches (or their destruction) and request upon their next solve. Sharing
+ * a workspace via the environment therefore avoids allocating and freeing the same vectors over and over again if many small to medium systems
+ * are solved, e.g., the epoch models of reward-bounded properties. The workspace retains at most a fixed number of vectors per value type.
+ */
+class SolverWorkspace {
+   public:
+    /*!
+     * Returns a vector to the workspace (if any) instead of freeing it.
+     */
+    template<typename ValueType>
+    class VectorDeleter {
+       public:
+        VectorDeleter() = default;
+        VectorDeleter(std::shared_ptr<SolverWorkspace> const& workspace) : workspace(workspace) {
+            // Intentionally left empty.
+        }
+
+        void operator()(std::vector<ValueType>* vector) const {
+            if (workspace) {
+                workspace->release(vector);
+            } else {
+                delete vector;
+            }
+        }
+
+       private:
+        std::shared_ptr<SolverWorkspace> workspace;
+    };
+
+    template<typename ValueType>
+    using VectorPointer = std::unique_ptr<std::vector<ValueType>, VectorDeleter<ValueType>>;
+
+    /*!
+     * Creates a workspace that retains the given number of vectors per value type.
+     */
+    SolverWorkspace(uint64_t maximalNumberOfVectors = 8);
+
+    /*!
+     * Retrieves a vector with the given number of zeros. If the workspace is null, a new vector is allocated.
+     */
+    template<typename ValueType>
+    static VectorPointer<ValueType> acquire(std::shared_ptr<SolverWorkspace> const& workspace, uint64_t size);
+
+    /*!
+     * Retrieves the number of acquired vectors that needed a new allocation (or a reallocation of a retained vector).
+     */
+    uint64_t getNumberOfAllocations() const;
+
+    /*!
+     * Retrieves the number of acquired vectors whose storage could be reused.
+     */
+    uint64_t getNumberOfReuses() const;
+
+    /*!
+     * Frees all retained vectors.
+     */
+    void clear();
+
+   private:
+    template<typename ValueType>
+    void release(std::vector<ValueType>* vector);
+
+    template<typename ValueType>
+    std::vector<std::unique_ptr<std::vector<ValueType>>>& getPool();
+
+    uint64_t maximalNumberOfVectors;
+    uint64_t numberOfAllocations;
+    uint64_t numberOfReuses;
+    mutable std::mutex mutex;
+    std::unordered_map<std::type_index, std::shared_ptr<void>> pools;
+};
+
+/*!
+ * Retrieves a vector with the given number of zeros from the workspace of the given environment.
+ */
+template<typename ValueType>
+SolverWorkspace::VectorPointer<ValueType> acquireWorkspaceVector(Environment const& env, uint64_t size);
+
+}  // namespace solver
+}  // namespace storm
@@ -103,6 +103,29 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
         STORM_LOG_TRACE("Adding constraint " << (name == "" ? std::to_string(nextConstraintIndex) : name) << " to SoplexLpSolver:\n"
                                              << "\t" << constraint);
     }
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        solver.addRowRational(createRow(constraint));
+    } else {
+        solver.addRowReal(createRow(constraint));
+    }
+}
+
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    // Collect the rows such that SoPlex only needs to extend the LP once.
+    TypedLPRowSet rows(constraints.size());
+    for (auto const& constraint : constraints) {
+        rows.add(createRow(constraint));
+    }
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        solver.addRowsRational(rows);
+    } else {
+        solver.addRowsReal(rows);
+    }
+}
+
+template<typename ValueType, bool RawMode>
+typename SoplexLpSolver<ValueType, RawMode>::TypedLPRow SoplexLpSolver<ValueType, RawMode>::createRow(Constraint const& constraint) const {
     using SoplexValueType = std::conditional_t<std::is_same_v<ValueType, storm::RationalNumber>, soplex::Rational, soplex::Real>;
     // Extract constraint data
     SoplexValueType rhs;
@@ -170,11 +193,7 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
         default:
             STORM_LOG_ASSERT(false, "Illegal operator in LP solver constraint.");
     }
-    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
-        solver.addRowRational(LPRowRational(l, row, r));
-    } else {
-        solver.addRowReal(LPRow(l, row, r));
-    }
+    return TypedLPRow(l, row, r);
 }
 
 template<typename ValueType, bool RawMode>
@@ -340,6 +359,12 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const&, Const
                                                           "requires this support. Please choose a version of support with Soplex support.";
 }
 
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Soplex support.";
+}
+
 template<typename ValueType, bool RawMode>
 void SoplexLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const&, Variable, bool, Constraint const&) {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
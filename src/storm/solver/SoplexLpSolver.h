@@ -64,6 +64,7 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
     // Methods to optimize and retrieve optimality status.
@@ -95,6 +96,13 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
 #ifdef STORM_HAVE_SOPLEX
     typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::DVector, soplex::DVectorRational> TypedDVector;
     typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::DSVector, soplex::DSVectorRational> TypedDSVector;
+    typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::LPRow, soplex::LPRowRational> TypedLPRow;
+    typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::LPRowSet, soplex::LPRowSetRational> TypedLPRowSet;
+
+    /*!
+     * Translates the given constraint into a row of the LP.
+     */
+    TypedLPRow createRow(Constraint const& constraint) const;
 
     uint64_t nextVariableIndex = 0;
     uint64_t nextConstraintIndex = 0;
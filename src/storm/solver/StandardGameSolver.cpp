@@ -1,15 +1,20 @@
 #include "storm/solver/StandardGameSolver.h"
 
+#include <atomic>
+
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/GmmxxLinearEquationSolver.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
@@ -92,7 +97,7 @@ GameMethod StandardGameSolver<ValueType>::getMethod(Environment const& env, bool
         } else {
             STORM_LOG_WARN("The selected game method does not guarantee exact results.");
         }
-    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration) {
+    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration && method != GameMethod::IntervalIteration) {
         if (env.solver().game().isMethodSetFromDefault()) {
             method = GameMethod::PolicyIteration;
             STORM_LOG_INFO("Changing game method to policy-iteration to guarantee sound results. If you want to override this, specify another method.");
@@ -114,6 +119,8 @@ bool StandardGameSolver<ValueType>::solveGame(Environment const& env, Optimizati
             return solveGameValueIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         case GameMethod::PolicyIteration:
             return solveGamePolicyIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+        case GameMethod::IntervalIteration:
+            return solveGameIntervalIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -400,6 +407,92 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
     return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
 }
 
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                               std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                               std::vector<uint64_t>* player1Choices, std::vector<uint64_t>* player2Choices) const {
+    // Without a unique solution (i.e. in the presence of end components), the upper iterates do not necessarily converge to the solution.
+    STORM_LOG_THROW(this->hasUniqueSolution(), storm::exceptions::UnmetRequirementException,
+                    "Interval iteration requires the game to have a unique solution. End components need to be eliminated beforehand.");
+    STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Interval iteration requires an upper bound.");
+
+    if (!multiplierPlayer2Matrix) {
+        multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
+    }
+
+    if (!auxiliaryP2RowGroupVector) {
+        auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
+    }
+
+    if (!auxiliaryP1RowGroupVector) {
+        auxiliaryP1RowGroupVector = std::make_unique<std::vector<ValueType>>(this->getNumberOfPlayer1States());
+    }
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+    bool relative = env.solver().game().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+
+    std::vector<ValueType>& reducedPlayer2Result = *auxiliaryP2RowGroupVector;
+
+    // Start the iterations from the bounds such that all lower (upper) iterates are lower (upper) bounds on the solution.
+    this->createLowerBoundsVector(x);
+    std::vector<ValueType> upperX(x.size());
+    this->createUpperBoundsVector(upperX);
+    std::vector<ValueType> newUpperX(x.size());
+
+    std::vector<ValueType>* newLowerX = auxiliaryP1RowGroupVector.get();
+    std::vector<ValueType>* currentLowerX = &x;
+    std::vector<ValueType>* currentUpperX = &upperX;
+    std::vector<ValueType>* newUpperXPointer = &newUpperX;
+
+    // Proceed with the iterations as long as the bounds are not close enough or the maximum number of iterations is reached.
+    uint64_t iterations = 0;
+
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        multiplyAndReduce(env, player1Dir, player2Dir, *currentLowerX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newLowerX);
+        multiplyAndReduce(env, player1Dir, player2Dir, *currentUpperX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newUpperXPointer);
+        std::swap(currentLowerX, newLowerX);
+        std::swap(currentUpperX, newUpperXPointer);
+        ++iterations;
+
+        // Determine whether the method converged.
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentLowerX, *currentUpperX, precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+
+        status = this->updateStatus(status, *currentLowerX, SolverGuarantee::LessOrEqual, iterations, maxIter);
+    }
+
+    this->reportStatus(status, iterations);
+
+    // If we performed an odd number of iterations, the newest lower bound is stored in the auxiliary vector, but x is the output vector.
+    if (currentLowerX == auxiliaryP1RowGroupVector.get()) {
+        std::swap(x, *currentLowerX);
+    }
+
+    // Take the center of the two bounds as the result.
+    ValueType two = storm::utility::convertNumber<ValueType>(2);
+    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+        x, *currentUpperX, x, [&two](ValueType const& lower, ValueType const& upper) -> ValueType { return (lower + upper) / two; });
+
+    // If requested, we store the scheduler for retrieval.
+    if (player1Choices && player2Choices) {
+        extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, *player1Choices, *player2Choices);
+    } else if (this->isTrackSchedulersSet()) {
+        this->player1SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer1States(), 0);
+        this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
+        extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, this->player1SchedulerChoices.get(),
+                       this->player2SchedulerChoices.get());
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
+}
+
 template<typename ValueType>
 void StandardGameSolver<ValueType>::repeatedMultiply(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                      std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
@@ -431,8 +524,8 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
 
     if (this->player1RepresentedByMatrix()) {
         // Player 1 represented by matrix.
-        uint_fast64_t player1State = 0;
-        for (auto& result : player1ReducedResult) {
+        forAllStates(player1ReducedResult.size(), [&](uint64_t player1State) {
+            ValueType& result = player1ReducedResult[player1State];
             storm::storage::SparseMatrix<storm::storage::sparse::state_type>::const_rows relevantRows = this->getPlayer1Matrix().getRowGroup(player1State);
             STORM_LOG_ASSERT(relevantRows.getNumberOfEntries() != 0, "There is a choice of player 1 that does not lead to any player 2 choice");
             auto it = relevantRows.begin();
@@ -452,10 +545,17 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
                     result = std::max(result, player2ReducedResult[it->getColumn()]);
                 }
             }
-            ++player1State;
-        }
+            return false;
+        });
     } else {
         // Player 1 represented by grouping of player 2 states (vector).
+#ifdef STORM_HAVE_INTELTBB
+        if (parallelize()) {
+            storm::utility::vector::reduceVectorMinOrMaxParallel(player1Dir, player2ReducedResult, player1ReducedResult, this->getPlayer1Grouping(),
+                                                                 player1SchedulerChoices);
+            return;
+        }
+#endif
         storm::utility::vector::reduceVectorMinOrMax(player1Dir, player2ReducedResult, player1ReducedResult, this->getPlayer1Grouping(),
                                                      player1SchedulerChoices);
     }
@@ -473,19 +573,20 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
         false);
 
     // get the choices of player 2 and the corresponding values.
-    bool schedulerImproved = false;
-    auto currentValueIt = player2ChoiceValues.begin();
-    for (uint_fast64_t p2Group = 0; p2Group < this->player2Matrix.getRowGroupCount(); ++p2Group, ++currentValueIt) {
-        uint_fast64_t firstRowInGroup = this->player2Matrix.getRowGroupIndices()[p2Group];
-        uint_fast64_t rowGroupSize = this->player2Matrix.getRowGroupIndices()[p2Group + 1] - firstRowInGroup;
+    auto const& player2Grouping = this->player2Matrix.getRowGroupIndices();
+    bool schedulerImproved = forAllStates(this->player2Matrix.getRowGroupCount(), [&](uint64_t p2Group) {
+        bool improved = false;
+        uint_fast64_t firstRowInGroup = player2Grouping[p2Group];
+        uint_fast64_t rowGroupSize = player2Grouping[p2Group + 1] - firstRowInGroup;
 
         // We need to check whether the scheduler improved. Therefore, we first have to evaluate the current choice.
         uint_fast64_t currentP2Choice = player2Choices[p2Group];
-        *currentValueIt = storm::utility::zero<ValueType>();
+        ValueType& currentValue = player2ChoiceValues[p2Group];
+        currentValue = storm::utility::zero<ValueType>();
         for (auto const& entry : this->player2Matrix.getRow(firstRowInGroup + currentP2Choice)) {
-            *currentValueIt += entry.getValue() * x[entry.getColumn()];
+            currentValue += entry.getValue() * x[entry.getColumn()];
         }
-        *currentValueIt += b[firstRowInGroup + currentP2Choice];
+        currentValue += b[firstRowInGroup + currentP2Choice];
 
         // Now check other choices improve the value.
         for (uint_fast64_t p2Choice = 0; p2Choice < rowGroupSize; ++p2Choice) {
@@ -498,18 +599,20 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
             }
             choiceValue += b[firstRowInGroup + p2Choice];
 
-            if (valueImproved(player2Dir, comparator, *currentValueIt, choiceValue)) {
-                schedulerImproved = true;
+            if (valueImproved(player2Dir, comparator, currentValue, choiceValue)) {
+                improved = true;
                 player2Choices[p2Group] = p2Choice;
-                *currentValueIt = std::move(choiceValue);
+                currentValue = std::move(choiceValue);
             }
         }
-    }
+        return improved;
+    });
 
     // Now extract the choices of player 1.
     if (this->player1RepresentedByMatrix()) {
         // Player 1 represented by matrix.
-        for (uint_fast64_t p1Group = 0; p1Group < this->getPlayer1Matrix().getRowGroupCount(); ++p1Group) {
+        schedulerImproved |= forAllStates(this->getPlayer1Matrix().getRowGroupCount(), [&](uint64_t p1Group) {
+            bool improved = false;
             uint_fast64_t firstRowInGroup = this->getPlayer1Matrix().getRowGroupIndices()[p1Group];
             uint_fast64_t rowGroupSize = this->getPlayer1Matrix().getRowGroupIndices()[p1Group + 1] - firstRowInGroup;
             uint_fast64_t currentChoice = player1Choices[p1Group];
@@ -521,15 +624,17 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
                 }
                 ValueType const& choiceValue = player2ChoiceValues[this->getPlayer1Matrix().getRow(firstRowInGroup + p1Choice).begin()->getColumn()];
                 if (valueImproved(player1Dir, comparator, currentValue, choiceValue)) {
-                    schedulerImproved = true;
+                    improved = true;
                     player1Choices[p1Group] = p1Choice;
                     currentValue = choiceValue;
                 }
             }
-        }
+            return improved;
+        });
     } else {
         // Player 1 represented by grouping of player 2 states (vector).
-        for (uint64_t player1State = 0; player1State < this->getPlayer1Grouping().size() - 1; ++player1State) {
+        schedulerImproved |= forAllStates(this->getPlayer1Grouping().size() - 1, [&](uint64_t player1State) {
+            bool improved = false;
             uint64_t currentChoice = player1Choices[player1State];
             ValueType currentValue = player2ChoiceValues[this->getPlayer1Grouping()[player1State] + currentChoice];
             uint64_t numberOfPlayer2Successors = this->getPlayer1Grouping()[player1State + 1] - this->getPlayer1Grouping()[player1State];
@@ -541,12 +646,13 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
 
                 ValueType const& choiceValue = player2ChoiceValues[this->getPlayer1Grouping()[player1State] + player2State];
                 if (valueImproved(player1Dir, comparator, currentValue, choiceValue)) {
-                    schedulerImproved = true;
+                    improved = true;
                     player1Choices[player1State] = player2State;
                     currentValue = choiceValue;
                 }
             }
-        }
+            return improved;
+        });
     }
 
     return schedulerImproved;
@@ -586,6 +692,40 @@ void StandardGameSolver<ValueType>::getInducedMatrixVector(std::vector<ValueType
     storm::utility::vector::selectVectorValues<ValueType>(inducedVector, selectedRows, b);
 }
 
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::parallelize() const {
+#ifdef STORM_HAVE_INTELTBB
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+    return false;
+#endif
+}
+
+template<typename ValueType>
+template<typename Function>
+bool StandardGameSolver<ValueType>::forAllStates(uint64_t numberOfStates, Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize()) {
+        std::atomic<bool> result(false);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&](tbb::blocked_range<uint64_t> const& range) {
+            bool rangeResult = false;
+            for (uint64_t state = range.begin(); state < range.end(); ++state) {
+                rangeResult |= function(state);
+            }
+            if (rangeResult) {
+                result = true;
+            }
+        });
+        return result;
+    }
+#endif
+    bool result = false;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        result |= function(state);
+    }
+    return result;
+}
+
 template<typename ValueType>
 bool StandardGameSolver<ValueType>::player1RepresentedByMatrix() const {
     return player1Matrix != nullptr;
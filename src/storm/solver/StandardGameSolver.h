@@ -43,6 +43,10 @@ class StandardGameSolver : public GameSolver<ValueType> {
     bool solveGameValueIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
                                  std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
                                  std::vector<uint64_t>* player2Choices = nullptr) const;
+    // Iterates a lower and an upper bound on the solution until they are close enough. Requires a unique solution and an upper bound.
+    bool solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                                    std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
+                                    std::vector<uint64_t>* player2Choices = nullptr) const;
 
     // Computes p2Matrix * x + b, reduces the result w.r.t. player 2 choices, and then reduces the result w.r.t. player 1 choices.
     void multiplyAndReduce(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
@@ -64,6 +68,14 @@ class StandardGameSolver : public GameSolver<ValueType> {
     bool valueImproved(OptimizationDirection dir, storm::utility::ConstantsComparator<ValueType> const& comparator, ValueType const& value1,
                        ValueType const& value2) const;
 
+    // Retrieves whether the reductions and the extraction of choices are performed in parallel (using Intel TBB).
+    bool parallelize() const;
+
+    // Calls the given function for all states in [0, numberOfStates) and returns true iff one of the calls returned true. The calls are
+    // distributed among threads if the solver parallelizes.
+    template<typename Function>
+    bool forAllStates(uint64_t numberOfStates, Function const& function) const;
+
     bool player1RepresentedByMatrix() const;
     storm::storage::SparseMatrix<storm::storage::sparse::state_type> const& getPlayer1Matrix() const;
     std::vector<uint64_t> const& getPlayer1Grouping() const;
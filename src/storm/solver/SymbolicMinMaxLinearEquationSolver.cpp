@@ -1,5 +1,7 @@
 #include "storm/solver/SymbolicMinMaxLinearEquationSolver.h"
 
+#include <cmath>
+
 #include "storm/storage/dd/DdManager.h"
 
 #include "storm/storage/dd/Add.h"
@@ -18,6 +20,18 @@
 namespace storm {
 namespace solver {
 
+namespace {
+// Rounds the values to multiples of 2^-bits. Exact values are never rounded.
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> roundToGrid(storm::dd::Add<DdType, ValueType> const& values, uint64_t bits, bool roundUp) {
+    if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+        return values;
+    } else {
+        return storm::utility::dd::quantize(values, bits, roundUp);
+    }
+}
+}  // namespace
+
 template<storm::dd::DdType DdType, typename ValueType>
 SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::SymbolicMinMaxLinearEquationSolver()
     : SymbolicEquationSolver<DdType, ValueType>(), uniqueSolution(false), requirementsChecked(false) {
@@ -98,10 +112,14 @@ typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationRe
 SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir,
                                                                              storm::dd::Add<DdType, ValueType> const& x,
                                                                              storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
-                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                                                             uint64_t quantizationBits, bool roundUp) const {
     // Set up local variables.
     storm::dd::Add<DdType, ValueType> localX = x;
     uint64_t iterations = 0;
+    if (quantizationBits > 0) {
+        localX = roundToGrid(localX, quantizationBits, roundUp);
+    }
 
     // Value iteration loop.
     SolverStatus status = SolverStatus::InProgress;
@@ -117,6 +135,9 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(sto
         } else {
             tmp = tmp.maxAbstract(this->choiceVariables);
         }
+        if (quantizationBits > 0) {
+            tmp = roundToGrid(tmp, quantizationBits, roundUp);
+        }
 
         // Now check if the process already converged within our precision.
         if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
@@ -138,6 +159,52 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(sto
     return SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult(status, iterations, localX);
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult
+SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performIntervalIteration(storm::solver::OptimizationDirection const& dir,
+                                                                                storm::dd::Add<DdType, ValueType> const& lowerX,
+                                                                                storm::dd::Add<DdType, ValueType> const& upperX,
+                                                                                storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
+                                                                                bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                                                                uint64_t quantizationBits) const {
+    storm::dd::Add<DdType, ValueType> localLowerX = lowerX;
+    storm::dd::Add<DdType, ValueType> localUpperX = upperX;
+    if (quantizationBits > 0) {
+        localLowerX = roundToGrid(localLowerX, quantizationBits, false);
+        localUpperX = roundToGrid(localUpperX, quantizationBits, true);
+    }
+    uint64_t iterations = 0;
+
+    // The average of the bounds is within the precision once the bounds differ by at most twice the precision.
+    ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && iterations < maximalIterations) {
+        if (localLowerX.equalModuloPrecision(localUpperX, two * precision, relativeTerminationCriterion)) {
+            status = SolverStatus::Converged;
+            break;
+        }
+
+        localLowerX = multiply(dir, localLowerX, &b);
+        localUpperX = multiply(dir, localUpperX, &b);
+        if (quantizationBits > 0) {
+            localLowerX = roundToGrid(localLowerX, quantizationBits, false);
+            localUpperX = roundToGrid(localUpperX, quantizationBits, true);
+        }
+
+        ++iterations;
+        if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+    }
+
+    if (status == SolverStatus::InProgress) {
+        status = SolverStatus::MaximalIterationsExceeded;
+    }
+
+    storm::dd::Add<DdType, ValueType> result = (localLowerX + localUpperX) / localLowerX.getDdManager().getConstant(two);
+    return SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult(status, iterations, result);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 bool SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::isSolution(OptimizationDirection dir, storm::dd::Add<DdType, ValueType> const& x,
                                                                        storm::dd::Add<DdType, ValueType> const& b) const {
@@ -333,14 +400,38 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
     }
 
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-    ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(),
-                                                          env.solver().minMax().getMaximalNumberOfIterations());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+    uint64_t quantizationBits = storm::NumberTraits<ValueType>::IsExact ? 0 : env.solver().minMax().getDdQuantizationBits();
+
+    if (env.solver().isForceSoundness() && this->hasUniqueSolution() && (this->hasLowerBound() || this->hasLowerBounds()) &&
+        (this->hasUpperBound() || this->hasUpperBounds())) {
+        ValueIterationResult iiResult =
+            performIntervalIteration(dir, this->getLowerBoundsVector(), this->getUpperBoundsVector(), b, precision, relative, maxIter, quantizationBits);
+        if (iiResult.status == SolverStatus::Converged) {
+            STORM_LOG_INFO("Iterative solver (interval iteration) converged in " << iiResult.iterations << " iterations.");
+        } else {
+            STORM_LOG_WARN("Iterative solver (interval iteration) did not converge in " << iiResult.iterations << " iterations.");
+        }
+        return iiResult.values;
+    }
+    STORM_LOG_WARN_COND(!env.solver().isForceSoundness(),
+                        "Sound value iteration requires a unique solution as well as lower and upper bounds. The result is not guaranteed to be sound.");
+
+    // Starting from the solution of the initial scheduler, the iterates approach the solution from above and are thus rounded up.
+    bool roundUp = !this->hasUniqueSolution() && this->hasInitialScheduler();
+    ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, relative, maxIter, quantizationBits, roundUp);
 
     if (viResult.status == SolverStatus::Converged) {
         STORM_LOG_INFO("Iterative solver (value iteration) converged in " << viResult.iterations << " iterations.");
     } else {
         STORM_LOG_WARN("Iterative solver (value iteration) did not converge in " << viResult.iterations << " iterations.");
     }
+    // Each rounding changes the values by less than the grid width and the Bellman operator is non-expansive, so the distance to the
+    // iterates without rounding grows by less than the grid width per iteration.
+    STORM_LOG_INFO_COND(quantizationBits == 0, "Rounding to multiples of 2^-" << quantizationBits << " changed the values by at most "
+                                                                    << std::ldexp(static_cast<double>(viResult.iterations), -static_cast<int>(quantizationBits))
+                                                                    << " compared to value iteration without rounding.");
 
     return viResult.values;
 }
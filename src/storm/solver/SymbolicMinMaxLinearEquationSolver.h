@@ -199,9 +199,26 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
         storm::dd::Add<DdType, ValueType> values;
     };
 
+    /*!
+     * Performs value iteration starting from the given values.
+     *
+     * @param quantizationBits If positive, the values are rounded to multiples of 2^-quantizationBits after each iteration.
+     * @param roundUp If set, the values are rounded up and otherwise down. Rounding down keeps the iterates below the solution if the iteration
+     * starts from a lower bound and rounding up keeps them above if it starts from an upper bound.
+     */
     ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
                                                storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion,
-                                               uint64_t maximalIterations) const;
+                                               uint64_t maximalIterations, uint64_t quantizationBits = 0, bool roundUp = false) const;
+
+    /*!
+     * Performs interval iteration, i.e. iterates the given lower and upper bounds until they are close enough and returns their average. This
+     * requires that the equation system has a unique solution. If quantization is enabled, the lower bounds are rounded down and the upper
+     * bounds up, so the result is still within the precision as rounding can only widen the interval.
+     */
+    ValueIterationResult performIntervalIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& lowerX,
+                                                  storm::dd::Add<DdType, ValueType> const& upperX, storm::dd::Add<DdType, ValueType> const& b,
+                                                  ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                                  uint64_t quantizationBits) const;
 
    protected:
     // The matrix defining the coefficients of the linear equation system.
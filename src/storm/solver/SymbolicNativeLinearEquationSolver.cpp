@@ -1,5 +1,7 @@
 #include "storm/solver/SymbolicNativeLinearEquationSolver.h"
 
+#include <cmath>
+
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
@@ -14,6 +16,18 @@
 namespace storm {
 namespace solver {
 
+namespace {
+// Rounds the values to multiples of 2^-bits. Exact values are never rounded.
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> roundToGrid(storm::dd::Add<DdType, ValueType> const& values, uint64_t bits, bool roundUp) {
+    if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+        return values;
+    } else {
+        return storm::utility::dd::quantize(values, bits, roundUp);
+    }
+}
+}  // namespace
+
 template<storm::dd::DdType DdType, typename ValueType>
 SymbolicNativeLinearEquationSolver<DdType, ValueType>::SymbolicNativeLinearEquationSolver() : SymbolicLinearEquationSolver<DdType, ValueType>() {
     // Intentionally left empty.
@@ -60,7 +74,14 @@ NativeLinearEquationSolverMethod SymbolicNativeLinearEquationSolver<DdType, Valu
             method = NativeLinearEquationSolverMethod::Jacobi;
             STORM_LOG_INFO("The selected solution method is not supported in the dd engine. Falling back to '" + toString(method) + "'.");
         }
-        STORM_LOG_WARN_COND_DEBUG(!env.solver().isForceSoundness(), "Sound computations are not supported in the Dd engine.");
+        if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::Power) {
+            if (env.solver().native().isMethodSetFromDefault()) {
+                method = NativeLinearEquationSolverMethod::Power;
+                STORM_LOG_INFO("Selecting '" + toString(method) + "' as the solution technique as it allows for interval iteration.");
+            } else {
+                STORM_LOG_WARN("Sound computations are only supported for '" << toString(NativeLinearEquationSolverMethod::Power) << "' in the dd engine.");
+            }
+        }
     }
     return method;
 }
@@ -135,15 +156,22 @@ template<storm::dd::DdType DdType, typename ValueType>
 typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult
 SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x,
                                                                              storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
-                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                                                             uint64_t quantizationBits) const {
     // Set up additional environment variables.
     storm::dd::Add<DdType, ValueType> currentX = x;
     uint_fast64_t iterations = 0;
     SolverStatus status = SolverStatus::InProgress;
+    if (quantizationBits > 0) {
+        currentX = roundToGrid(currentX, quantizationBits, false);
+    }
 
     while (status == SolverStatus::InProgress && iterations < maximalIterations) {
         storm::dd::Add<DdType, ValueType> currentXAsColumn = currentX.swapVariables(this->rowColumnMetaVariablePairs);
         storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(currentXAsColumn, this->columnMetaVariables) + b;
+        if (quantizationBits > 0) {
+            tmp = roundToGrid(tmp, quantizationBits, false);
+        }
 
         // Now check if the process already converged within our precision.
         if (tmp.equalModuloPrecision(currentX, precision, relativeTerminationCriterion)) {
@@ -158,20 +186,81 @@ SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(sto
     return PowerIterationResult(status, iterations, currentX);
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult
+SymbolicNativeLinearEquationSolver<DdType, ValueType>::performIntervalIteration(storm::dd::Add<DdType, ValueType> const& lowerX,
+                                                                                storm::dd::Add<DdType, ValueType> const& upperX,
+                                                                                storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
+                                                                                bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                                                                uint64_t quantizationBits) const {
+    storm::dd::Add<DdType, ValueType> currentLowerX = lowerX;
+    storm::dd::Add<DdType, ValueType> currentUpperX = upperX;
+    if (quantizationBits > 0) {
+        currentLowerX = roundToGrid(currentLowerX, quantizationBits, false);
+        currentUpperX = roundToGrid(currentUpperX, quantizationBits, true);
+    }
+    uint_fast64_t iterations = 0;
+
+    // The average of the bounds is within the precision once the bounds differ by at most twice the precision.
+    ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && iterations < maximalIterations) {
+        if (currentLowerX.equalModuloPrecision(currentUpperX, two * precision, relativeTerminationCriterion)) {
+            status = SolverStatus::Converged;
+            break;
+        }
+
+        currentLowerX = this->A.multiplyMatrix(currentLowerX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + b;
+        currentUpperX = this->A.multiplyMatrix(currentUpperX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + b;
+        if (quantizationBits > 0) {
+            currentLowerX = roundToGrid(currentLowerX, quantizationBits, false);
+            currentUpperX = roundToGrid(currentUpperX, quantizationBits, true);
+        }
+
+        ++iterations;
+        if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+    }
+
+    storm::dd::Add<DdType, ValueType> result = (currentLowerX + currentUpperX) / currentLowerX.getDdManager().getConstant(two);
+    return PowerIterationResult(status, iterations, result);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsPower(Environment const& env,
                                                                                                              storm::dd::Add<DdType, ValueType> const& x,
                                                                                                              storm::dd::Add<DdType, ValueType> const& b) const {
-    STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-    PowerIterationResult result =
-        performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+    uint64_t quantizationBits = storm::NumberTraits<ValueType>::IsExact ? 0 : env.solver().native().getDdQuantizationBits();
+
+    if (env.solver().isForceSoundness() && (this->hasLowerBound() || this->hasLowerBounds()) && (this->hasUpperBound() || this->hasUpperBounds())) {
+        STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (interval iteration)");
+        PowerIterationResult result =
+            performIntervalIteration(this->getLowerBoundsVector(), this->getUpperBoundsVector(), b, precision, relative, maxIter, quantizationBits);
+        if (result.status == SolverStatus::Converged) {
+            STORM_LOG_INFO("Iterative solver (interval iteration) converged in " << result.iterations << " iterations.");
+        } else {
+            STORM_LOG_WARN("Iterative solver (interval iteration) did not converge in " << result.iterations << " iterations.");
+        }
+        return result.values;
+    }
+    STORM_LOG_WARN_COND(!env.solver().isForceSoundness(), "Sound power iteration requires lower and upper bounds. The result is not guaranteed to be sound.");
+
+    STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
+    PowerIterationResult result = performPowerIteration(x, b, precision, relative, maxIter, quantizationBits);
 
     if (result.status == SolverStatus::Converged) {
         STORM_LOG_INFO("Iterative solver (power iteration) converged in " << result.iterations << " iterations.");
     } else {
         STORM_LOG_WARN("Iterative solver (power iteration) did not converge in " << result.iterations << " iterations.");
     }
+    // Each rounding changes the values by less than the grid width and multiplying with a substochastic matrix is non-expansive.
+    STORM_LOG_INFO_COND(quantizationBits == 0, "Rounding to multiples of 2^-" << quantizationBits << " changed the values by at most "
+                                                                    << std::ldexp(static_cast<double>(result.iterations), -static_cast<int>(quantizationBits))
+                                                                    << " compared to power iteration without rounding.");
 
     return result.values;
 }
@@ -121,8 +121,23 @@ class SymbolicNativeLinearEquationSolver : public SymbolicLinearEquationSolver<D
         storm::dd::Add<DdType, ValueType> values;
     };
 
+    /*!
+     * Performs power iteration starting from the given values.
+     *
+     * @param quantizationBits If positive, the values are rounded down to multiples of 2^-quantizationBits after each iteration, which keeps the
+     * iterates below the solution if the iteration starts from a lower bound.
+     */
     PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b,
-                                               ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+                                               ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                               uint64_t quantizationBits = 0) const;
+
+    /*!
+     * Performs interval iteration, i.e. iterates the given lower and upper bounds until they are close enough and returns their average. If
+     * quantization is enabled, the lower bounds are rounded down and the upper bounds up, so the result is still within the precision.
+     */
+    PowerIterationResult performIntervalIteration(storm::dd::Add<DdType, ValueType> const& lowerX, storm::dd::Add<DdType, ValueType> const& upperX,
+                                                  storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion,
+                                                  uint64_t maximalIterations, uint64_t quantizationBits) const;
 };
 
 template<storm::dd::DdType DdType, typename ValueType>
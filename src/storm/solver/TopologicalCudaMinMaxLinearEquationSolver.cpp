@@ -3,6 +3,7 @@
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/storage/SoaSparseMatrix.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
@@ -62,7 +63,7 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
 
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
     uint64_t maxIters = env.solver().minMax().getMaximalNumberOfIterations();
-    bool relative = env.solver().minMax().getMaximalNumberOfIterations();
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
 
     // For testing only
     // std::cout << "<<< Using CUDA-DOUBLE Kernels >>>\n";
@@ -74,8 +75,8 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
     // Check if the decomposition is necessary
 #ifdef STORM_HAVE_CUDA
 #define __USE_CUDAFORSTORM_OPT true
-    size_t const gpuSizeOfCompleteSystem = basicValueIteration_mvReduce_uint64_double_calculateMemorySize(
-        static_cast<size_t>(A->getRowCount()), nondeterministicChoiceIndices.size(), static_cast<size_t>(A->getEntryCount()));
+    size_t const gpuSizeOfCompleteSystem = deviceValueIteration_calculateMemorySize(static_cast<size_t>(A->getRowCount()), A->getRowGroupCount(),
+                                                                                    static_cast<size_t>(A->getEntryCount()));
     size_t const cudaFreeMemory = static_cast<size_t>(getFreeCudaMemory() * 0.95);
 #else
 #define __USE_CUDAFORSTORM_OPT false
@@ -90,25 +91,9 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
 #ifdef STORM_HAVE_CUDA
         STORM_LOG_THROW(resetCudaDevice(), storm::exceptions::InvalidStateException, "Could not reset CUDA Device, can not use CUDA Equation Solver.");
 
-        bool result = false;
         size_t globalIterations = 0;
-        if (dir == OptimizationDirection::Minimize) {
-            result = __basicValueIteration_mvReduce_minimize<uint_fast64_t, ValueType>(maxIters, precision, relative, A->rowIndications, A->columnsAndValues, x,
-                                                                                       b, nondeterministicChoiceIndices, globalIterations);
-        } else {
-            result = __basicValueIteration_mvReduce_maximize<uint_fast64_t, ValueType>(maxIters, precision, relative, A->rowIndications, A->columnsAndValues, x,
-                                                                                       b, nondeterministicChoiceIndices, globalIterations);
-        }
-        STORM_LOG_INFO("Executed " << globalIterations << " of max. " << maximalNumberOfIterations << " Iterations on GPU.");
-
-        bool converged = false;
-        if (!result) {
-            converged = false;
-            STORM_LOG_ERROR("An error occurred in the CUDA Plugin. Can not continue.");
-            throw storm::exceptions::InvalidStateException() << "An error occurred in the CUDA Plugin. Can not continue.";
-        } else {
-            converged = true;
-        }
+        bool converged = this->solveOnDevice(dir, *A, x, b, maxIters, precision, relative, globalIterations);
+        STORM_LOG_INFO("Executed " << globalIterations << " of max. " << maxIters << " Iterations on GPU.");
 
         // Check if the solver converged and issue a warning otherwise.
         if (converged) {
@@ -116,6 +101,7 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
         } else {
             STORM_LOG_WARN("Iterative solver did not converged after " << globalIterations << " iterations.");
         }
+        return converged;
 #else
         STORM_LOG_ERROR("The useGpu Flag of a SCC was set, but this version of storm does not support CUDA acceleration. Internal Error!");
         throw storm::exceptions::InvalidStateException()
@@ -202,26 +188,9 @@ bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::internalSolveEquation
                 // sizeof(uint_fast64_t)* sccSubNondeterministicChoiceIndices.size()) << " Bytes."); STORM_LOG_INFO("The CUDA Runtime Version is " <<
                 // getRuntimeCudaVersion());
 
-                bool result = false;
                 localIterations = 0;
-                if (dir == OptimizationDirection::Minimum) {
-                    result = __basicValueIteration_mvReduce_minimize<uint_fast64_t, ValueType>(maxIters, precision, relative, sccSubmatrix.rowIndications,
-                                                                                               sccSubmatrix.columnsAndValues, *currentX, sccSubB,
-                                                                                               sccSubNondeterministicChoiceIndices, localIterations);
-                } else {
-                    result = __basicValueIteration_mvReduce_maximize<uint_fast64_t, ValueType>(maxIters, precision, relative, sccSubmatrix.rowIndications,
-                                                                                               sccSubmatrix.columnsAndValues, *currentX, sccSubB,
-                                                                                               sccSubNondeterministicChoiceIndices, localIterations);
-                }
-                STORM_LOG_INFO("Executed " << localIterations << " of max. " << maximalNumberOfIterations << " Iterations on GPU.");
-
-                if (!result) {
-                    converged = false;
-                    STORM_LOG_ERROR("An error occurred in the CUDA Plugin. Can not continue.");
-                    throw storm::exceptions::InvalidStateException() << "An error occurred in the CUDA Plugin. Can not continue.";
-                } else {
-                    converged = true;
-                }
+                converged = this->solveOnDevice(dir, sccSubmatrix, *currentX, sccSubB, maxIters, precision, relative, localIterations);
+                STORM_LOG_INFO("Executed " << localIterations << " of max. " << maxIters << " Iterations on GPU.");
 
                 // As the "number of iterations" of the full method is the maximum of the local iterations, we need to keep
                 // track of the maximum.
@@ -318,8 +287,8 @@ TopologicalCudaMinMaxLinearEquationSolver<ValueType>::getOptimalGroupingFromTopo
 
     std::vector<uint_fast64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
 
-    size_t const gpuSizeOfCompleteSystem = basicValueIteration_mvReduce_uint64_double_calculateMemorySize(
-        static_cast<size_t>(matrix.getRowCount()), rowGroupIndices.size(), static_cast<size_t>(matrix.getEntryCount()));
+    size_t const gpuSizeOfCompleteSystem = deviceValueIteration_calculateMemorySize(static_cast<size_t>(matrix.getRowCount()), matrix.getRowGroupCount(),
+                                                                                    static_cast<size_t>(matrix.getEntryCount()));
     size_t const gpuSizePerRowGroup = std::max(static_cast<size_t>(gpuSizeOfCompleteSystem / rowGroupIndices.size()), static_cast<size_t>(1));
     size_t const maxRowGroupsPerMemory = cudaFreeMemory / gpuSizePerRowGroup;
 
@@ -338,8 +307,7 @@ TopologicalCudaMinMaxLinearEquationSolver<ValueType>::getOptimalGroupingFromTopo
             entryCount += matrix.getRowGroupEntryCount(*sccIt);
         }
 
-        size_t sccSize =
-            basicValueIteration_mvReduce_uint64_double_calculateMemorySize(static_cast<size_t>(rowCount), scc.size(), static_cast<size_t>(entryCount));
+        size_t sccSize = deviceValueIteration_calculateMemorySize(static_cast<size_t>(rowCount), scc.size(), static_cast<size_t>(entryCount));
 
         if ((currentSize + sccSize) <= cudaFreeMemory) {
             // There is enough space left in the current group
@@ -446,6 +414,31 @@ TopologicalCudaMinMaxLinearEquationSolver<ValueType>::getOptimalGroupingFromTopo
     return result;
 }
 
+template<typename ValueType>
+bool TopologicalCudaMinMaxLinearEquationSolver<ValueType>::solveOnDevice(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                         std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t maxIterationCount,
+                                                                         ValueType const& precision, bool relative, size_t& iterationCount) const {
+#ifdef STORM_HAVE_CUDA
+    if constexpr (std::is_same<ValueType, double>::value) {
+        STORM_LOG_THROW((storm::storage::SoaSparseMatrix<double, uint32_t>::canRepresentColumns(matrix)), storm::exceptions::NotSupportedException,
+                        "The columns of the matrix do not fit into 32-bit indices.");
+        storm::storage::SoaSparseMatrix<double, uint32_t> soaMatrix(matrix);
+        DeviceSparseMatrix* deviceMatrix = deviceValueIteration_createMatrix(matrix.getRowCount(), matrix.getColumnCount(), matrix.getRowGroupCount(),
+                                                                             matrix.getEntryCount(), soaMatrix.getRowIndications().data(),
+                                                                             soaMatrix.getColumns().data(), soaMatrix.getValues().data(),
+                                                                             matrix.getRowGroupIndices().data());
+        STORM_LOG_THROW(deviceMatrix != nullptr, storm::exceptions::InvalidStateException, "Could not upload the matrix to the GPU.");
+        bool converged = false;
+        bool success = deviceValueIteration_solve(deviceMatrix, minimize(dir), maxIterationCount, precision, relative, x.data(), b.data(), iterationCount,
+                                                  converged);
+        deviceValueIteration_destroyMatrix(deviceMatrix);
+        STORM_LOG_THROW(success, storm::exceptions::InvalidStateException, "An error occurred in the CUDA plugin.");
+        return converged;
+    }
+#endif
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Value iteration on the GPU requires CUDA support and double values.");
+}
+
 template<typename ValueType>
 TopologicalCudaMinMaxLinearEquationSolverFactory<ValueType>::TopologicalCudaMinMaxLinearEquationSolverFactory(bool trackScheduler) {
     // Intentionally left empty.
@@ -53,66 +53,16 @@ class TopologicalCudaMinMaxLinearEquationSolver : public MinMaxLinearEquationSol
     std::vector<std::pair<bool, storm::storage::StateBlock>> getOptimalGroupingFromTopologicalSccDecomposition(
         storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition, std::vector<uint_fast64_t> const& topologicalSort,
         storm::storage::SparseMatrix<ValueType> const& matrix) const;
-};
-
-template<typename IndexType, typename ValueType>
-bool __basicValueIteration_mvReduce_minimize(uint_fast64_t const, double const, bool const, std::vector<uint_fast64_t> const&,
-                                             std::vector<storm::storage::MatrixEntry<IndexType, ValueType>> const&, std::vector<ValueType>& x,
-                                             std::vector<ValueType> const&, std::vector<uint_fast64_t> const&, size_t&) {
-    //
-    STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Unsupported template arguments.");
-}
-template<>
-inline bool __basicValueIteration_mvReduce_minimize<uint_fast64_t, double>(
-    uint_fast64_t const maxIterationCount, double const precision, bool const relativePrecisionCheck, std::vector<uint_fast64_t> const& matrixRowIndices,
-    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> const& columnIndicesAndValues, std::vector<double>& x, std::vector<double> const& b,
-    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, size_t& iterationCount) {
-    (void)maxIterationCount;
-    (void)precision;
-    (void)relativePrecisionCheck;
-    (void)matrixRowIndices;
-    (void)columnIndicesAndValues;
-    (void)x;
-    (void)b;
-    (void)nondeterministicChoiceIndices;
-    (void)iterationCount;
-
-#ifdef STORM_HAVE_CUDA
-    return basicValueIteration_mvReduce_uint64_double_minimize(maxIterationCount, precision, relativePrecisionCheck, matrixRowIndices, columnIndicesAndValues,
-                                                               x, b, nondeterministicChoiceIndices, iterationCount);
-#else
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without CUDA support.");
-#endif
-}
-
-template<typename IndexType, typename ValueType>
-bool __basicValueIteration_mvReduce_maximize(uint_fast64_t const, double const, bool const, std::vector<uint_fast64_t> const&,
-                                             std::vector<storm::storage::MatrixEntry<IndexType, ValueType>> const&, std::vector<ValueType>&,
-                                             std::vector<ValueType> const&, std::vector<uint_fast64_t> const&, size_t&) {
-    STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Unsupported template arguments.");
-}
-template<>
-inline bool __basicValueIteration_mvReduce_maximize<uint_fast64_t, double>(
-    uint_fast64_t const maxIterationCount, double const precision, bool const relativePrecisionCheck, std::vector<uint_fast64_t> const& matrixRowIndices,
-    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> const& columnIndicesAndValues, std::vector<double>& x, std::vector<double> const& b,
-    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, size_t& iterationCount) {
-    (void)maxIterationCount;
-    (void)precision;
-    (void)relativePrecisionCheck;
-    (void)matrixRowIndices;
-    (void)columnIndicesAndValues;
-    (void)x;
-    (void)b;
-    (void)nondeterministicChoiceIndices;
-    (void)iterationCount;
 
-#ifdef STORM_HAVE_CUDA
-    return basicValueIteration_mvReduce_uint64_double_maximize(maxIterationCount, precision, relativePrecisionCheck, matrixRowIndices, columnIndicesAndValues,
-                                                               x, b, nondeterministicChoiceIndices, iterationCount);
-#else
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without CUDA support.");
-#endif
-}
+    /*!
+     * Performs value iteration for the given system on the GPU, keeping the matrix and all iterates in device memory.
+     *
+     * @param iterationCount Will contain the number of performed iterations.
+     * @return True iff value iteration converged within the maximal number of iterations.
+     */
+    bool solveOnDevice(OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x,
+                       std::vector<ValueType> const& b, uint64_t maxIterationCount, ValueType const& precision, bool relative, size_t& iterationCount) const;
+};
 
 template<typename ValueType>
 class TopologicalCudaMinMaxLinearEquationSolverFactory : public MinMaxLinearEquationSolverFactory<ValueType> {
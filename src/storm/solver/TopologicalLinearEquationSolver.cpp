@@ -1,7 +1,10 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -65,11 +68,14 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     bool needAdaptPrecision =
         env.solver().isForceSoundness() &&
         env.solver().getPrecisionOfLinearEquationSolver(env.solver().topological().getUnderlyingEquationSolverType()).first.is_initialized();
+    // For solving SCCs in parallel, we need the SCC depths
+    bool const solveInParallel = env.solver().topological().isParallelSccSolvingSet();
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize) ||
+        (solveInParallel && !this->sortedSccDecomposition->hasSccDepth())) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, solveInParallel);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -92,27 +98,10 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
     } else {
         // Solve each SCC individually
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-            } else {
-                sccAsBitVector.clear();
-                for (auto const& state : scc) {
-                    sccAsBitVector.set(state, true);
-                }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
-            }
+        if (solveInParallel) {
+            returnValue = solveSccsInParallel(sccSolverEnvironment, x, b);
+        } else {
+            returnValue = solveSccsSequentially(sccSolverEnvironment, x, b);
         }
     }
 
@@ -124,10 +113,108 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
 }
 
 template<typename ValueType>
-void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsSequentially(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const& b) const {
+    bool returnValue = true;
+    storm::storage::BitVector sccAsBitVector(x.size(), false);
+    uint64_t sccIndex = 0;
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    for (auto const& scc : *this->sortedSccDecomposition) {
+        if (scc.size() == 1) {
+            returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+        } else {
+            sccAsBitVector.clear();
+            for (auto const& state : scc) {
+                sccAsBitVector.set(state, true);
+            }
+            returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, this->sccSolver) && returnValue;
+        }
+        ++sccIndex;
+        progress.updateProgress(sccIndex);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+}
+
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
+                                                                     std::vector<ValueType> const& b) const {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Operations on rational functions share a (non thread-safe) cache, so we have to solve them sequentially.
+        STORM_LOG_WARN("Solving SCCs in parallel is not supported for rational functions, defaulting to sequential version.");
+        return solveSccsSequentially(sccSolverEnvironment, x, b);
+    } else {
+        auto const& sccDecomposition = *this->sortedSccDecomposition;
+
+        // An SCC only depends on SCCs with a smaller depth. Hence, all SCCs with the same depth can be solved concurrently.
+        std::vector<std::vector<uint64_t>> sccsByDepth(sccDecomposition.getMaxSccDepth() + 1);
+        for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+            sccsByDepth[sccDecomposition.getSccDepth(sccIndex)].push_back(sccIndex);
+        }
+
+        // Each thread keeps its own auxiliary data (and SCC solver) across all the SCCs it solves.
+        struct SccAuxiliaryData {
+            storm::storage::BitVector sccAsBitVector;
+            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+        };
+        tbb::enumerable_thread_specific<SccAuxiliaryData> auxiliaryData(
+            [&x]() { return SccAuxiliaryData{storm::storage::BitVector(x.size(), false), nullptr}; });
+
+        std::atomic<bool> returnValue(true);
+        uint64_t solvedSccCount = 0;
+        storm::utility::ProgressMeasurement progress("SCCs");
+        progress.setMaxCount(sccDecomposition.size());
+        progress.startNewMeasurement(0);
+        for (auto const& sccIndices : sccsByDepth) {
+            // The scheduler of TBB takes care of batching small SCCs together.
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                SccAuxiliaryData& data = auxiliaryData.local();
+                for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                    auto const& scc = sccDecomposition.getBlock(sccIndices[index]);
+                    bool sccSolved;
+                    if (scc.size() == 1) {
+                        sccSolved = solveTrivialScc(*scc.begin(), x, b);
+                    } else {
+                        for (auto const& state : scc) {
+                            data.sccAsBitVector.set(state, true);
+                        }
+                        sccSolved = solveScc(sccSolverEnvironment, data.sccAsBitVector, x, b, data.sccSolver);
+                        for (auto const& state : scc) {
+                            data.sccAsBitVector.set(state, false);
+                        }
+                    }
+                    if (!sccSolved) {
+                        returnValue = false;
+                    }
+                }
+            });
+            solvedSccCount += sccIndices.size();
+            progress.updateProgress(solvedSccCount);
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_WARN("Topological solver aborted after analyzing " << solvedSccCount << "/" << sccDecomposition.size() << " SCCs.");
+                break;
+            }
+        }
+        return returnValue;
+    }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return solveSccsSequentially(sccSolverEnvironment, x, b);
+#endif
+}
+
+template<typename ValueType>
+void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, bool needSccDepths) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize ||
+                                                                                                                           needSccDepths));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
@@ -184,20 +271,21 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -217,20 +305,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
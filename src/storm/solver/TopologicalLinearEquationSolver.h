@@ -37,7 +37,12 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needLongestChainSize, bool needSccDepths) const;
+
+    // Solves the SCCs one after another in topological order.
+    bool solveSccsSequentially(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    // Solves SCCs that do not depend on each other (i.e. SCCs with the same depth) concurrently.
+    bool solveSccsInParallel(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -46,7 +51,7 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
     bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+                  std::vector<ValueType> const& globalB, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -1,8 +1,12 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
@@ -56,11 +60,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 
     // For sound computations we need to increase the precision in each SCC
     bool needAdaptPrecision = env.solver().isForceSoundness();
+    // For solving SCCs in parallel, we need the SCC depths
+    bool const solveInParallel = env.solver().topological().isParallelSccSolvingSet();
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize) ||
+        (solveInParallel && !this->sortedSccDecomposition->hasSccDepth())) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, solveInParallel);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -90,46 +97,16 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
-                }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
-            }
+        if (solveInParallel) {
+            returnValue = solveSccsInParallel(sccSolverEnvironment, dir, x, b);
+        } else {
+            returnValue = solveSccsSequentially(sccSolverEnvironment, dir, x, b);
         }
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = acquireWorkspaceVector<ValueType>(env, this->A->getRowGroupCount());
             }
             this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
             this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
@@ -144,10 +121,119 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 }
 
 template<typename ValueType>
-void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsSequentially(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                             std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    bool returnValue = true;
+    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+    uint64_t sccIndex = 0;
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+    for (auto const& scc : *this->sortedSccDecomposition) {
+        if (scc.size() == 1) {
+            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+        } else {
+            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+            sccRowGroupsAsBitVector.clear();
+            sccRowsAsBitVector.clear();
+            setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector, true);
+            returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, this->sccSolver) && returnValue;
+        }
+        ++sccIndex;
+        progress.updateProgress(sccIndex);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                           std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+#ifdef STORM_HAVE_INTELTBB
+    auto const& sccDecomposition = *this->sortedSccDecomposition;
+
+    // An SCC only depends on SCCs with a smaller depth. Hence, all SCCs with the same depth can be solved concurrently.
+    std::vector<std::vector<uint64_t>> sccsByDepth(sccDecomposition.getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+        sccsByDepth[sccDecomposition.getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    // Each thread keeps its own auxiliary data (and SCC solver) across all the SCCs it solves.
+    struct SccAuxiliaryData {
+        storm::storage::BitVector sccRowGroups;
+        storm::storage::BitVector sccRows;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+    };
+    tbb::enumerable_thread_specific<SccAuxiliaryData> auxiliaryData(
+        [&x, &b]() { return SccAuxiliaryData{storm::storage::BitVector(x.size(), false), storm::storage::BitVector(b.size(), false), nullptr}; });
+
+    std::atomic<bool> returnValue(true);
+    uint64_t solvedSccCount = 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(sccDecomposition.size());
+    progress.startNewMeasurement(0);
+    for (auto const& sccIndices : sccsByDepth) {
+        // The scheduler of TBB takes care of batching small SCCs together.
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            SccAuxiliaryData& data = auxiliaryData.local();
+            for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                auto const& scc = sccDecomposition.getBlock(sccIndices[index]);
+                bool sccSolved;
+                if (scc.size() == 1) {
+                    sccSolved = solveTrivialScc(*scc.begin(), dir, x, b);
+                } else {
+                    setSccRowGroupsAndRows(scc, data.sccRowGroups, data.sccRows, true);
+                    sccSolved = solveScc(sccSolverEnvironment, dir, data.sccRowGroups, data.sccRows, x, b, data.sccSolver);
+                    setSccRowGroupsAndRows(scc, data.sccRowGroups, data.sccRows, false);
+                }
+                if (!sccSolved) {
+                    returnValue = false;
+                }
+            }
+        });
+        solvedSccCount += sccIndices.size();
+        progress.updateProgress(solvedSccCount);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << solvedSccCount << "/" << sccDecomposition.size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return solveSccsSequentially(sccSolverEnvironment, dir, x, b);
+#endif
+}
+
+template<typename ValueType>
+void TopologicalMinMaxLinearEquationSolver<ValueType>::setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc,
+                                                                              storm::storage::BitVector& sccRowGroups, storm::storage::BitVector& sccRows,
+                                                                              bool value) const {
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroups.set(group, value);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRows.set(row, value);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRows.set(row, value);
+            STORM_LOG_INFO_COND(value, "Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
+}
+
+template<typename ValueType>
+void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, bool needSccDepths) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize ||
+                                                                                                                           needSccDepths));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
@@ -284,15 +370,16 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveFullyConnectedEquati
 template<typename ValueType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
                                                                 storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows,
-                                                                std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+                                                                std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                                                                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+    sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+    sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -306,7 +393,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -315,11 +402,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -339,18 +426,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -365,14 +452,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    sccSolver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
     }
 
     // Set solution
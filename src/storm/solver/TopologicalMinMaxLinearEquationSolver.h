@@ -3,6 +3,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/SolverWorkspace.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -34,7 +35,17 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needLongestChainSize, bool needSccDepths) const;
+
+    // Solves the SCCs one after another in topological order.
+    bool solveSccsSequentially(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b) const;
+    // Solves SCCs that do not depend on each other (i.e. SCCs with the same depth) concurrently.
+    bool solveSccsInParallel(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
+                             std::vector<ValueType> const& b) const;
+    // Sets the bits of the row groups and the (non-fixed) rows of the given SCC to the given value.
+    void setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups,
+                                storm::storage::BitVector& sccRows, bool value) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -44,13 +55,14 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
     bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
-                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                  std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
-    mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
+    mutable SolverWorkspace::VectorPointer<ValueType> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
 };
 }  // namespace solver
 }  // namespace storm
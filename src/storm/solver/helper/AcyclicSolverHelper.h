@@ -1,3 +1,7 @@
+#pragma once
+
+#include <algorithm>
+
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -71,6 +75,31 @@ boost::optional<std::vector<uint64_t>> computeTopologicalGroupOrdering(storm::st
     }
 }
 
+/*!
+ * Returns the maximal number of transitions of a path within the given acyclic matrix, where each row group counts as one transition, even if it has
+ * no successors. Consequently, iterating x = A*x + b this many times yields the fixpoint, regardless of the initial vector.
+ */
+template<typename ValueType>
+uint64_t computeLongestPathLength(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    auto ordering = computeTopologicalGroupOrdering(matrix);
+    std::vector<uint64_t> pathLengths(matrix.getRowGroupCount(), 0);
+    uint64_t result = 0;
+    // The successors of a group are processed before the group itself.
+    for (uint64_t index = matrix.getRowGroupCount(); index > 0;) {
+        --index;
+        uint64_t group = ordering ? (*ordering)[index] : index;
+        uint64_t& pathLength = pathLengths[group];
+        for (auto const& entry : matrix.getRowGroup(group)) {
+            if (!storm::utility::isZero(entry.getValue())) {
+                pathLength = std::max(pathLength, pathLengths[entry.getColumn()]);
+            }
+        }
+        ++pathLength;
+        result = std::max(result, pathLength);
+    }
+    return result;
+}
+
 /// reorders the row group such that the i'th row of the new matrix corresponds to the order[i]'th row of the source matrix.
 /// Also eliminates selfloops p>0 and inserts 1/p into the bFactors
 template<typename ValueType>
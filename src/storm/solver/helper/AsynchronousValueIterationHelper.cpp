@@ -0,0 +1,181 @@
+#include "storm/solver/helper/AsynchronousValueIterationHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace avidetail {
+
+// The maximal number of sweeps a block performs before the values are collected and the termination conditions are checked.
+uint64_t const sweepsPerRound = 16;
+
+/*!
+ * Updates the values of the given row groups in place. Returns true iff some value changed by more than the precision.
+ */
+template<typename ValueType>
+bool sweepBlock(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t firstGroup, uint64_t endGroup, std::atomic<ValueType>* values,
+                std::vector<ValueType> const& b, bool minimize, ValueType const& precision, bool relative) {
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    auto multiplyRow = [&](uint64_t row) {
+        ValueType result = b[row];
+        for (auto const& entry : matrix.getRow(row)) {
+            result += entry.getValue() * values[entry.getColumn()].load(std::memory_order_relaxed);
+        }
+        return result;
+    };
+
+    bool changed = false;
+    for (uint64_t group = firstGroup; group < endGroup; ++group) {
+        uint64_t row = rowGroupIndices[group];
+        uint64_t const rowEnd = rowGroupIndices[group + 1];
+        if (row == rowEnd) {
+            continue;
+        }
+        ValueType best = multiplyRow(row);
+        for (++row; row < rowEnd; ++row) {
+            ValueType value = multiplyRow(row);
+            if (minimize ? value < best : value > best) {
+                best = value;
+            }
+        }
+        ValueType const oldValue = values[group].load(std::memory_order_relaxed);
+        values[group].store(best, std::memory_order_relaxed);
+        if (!changed && !storm::utility::vector::equalModuloPrecision(oldValue, best, precision, relative)) {
+            changed = true;
+        }
+    }
+    return changed;
+}
+}  // namespace avidetail
+
+template<typename ValueType>
+AsynchronousValueIterationHelper<ValueType>::AsynchronousValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfBlocks)
+    : matrix(matrix) {
+    uint64_t const groupCount = matrix.getRowGroupCount();
+    if (numberOfBlocks == 0) {
+#ifdef STORM_HAVE_INTELTBB
+        numberOfBlocks = std::thread::hardware_concurrency();
+#else
+        numberOfBlocks = 1;
+#endif
+    }
+    numberOfBlocks = std::max<uint64_t>(1, std::min<uint64_t>(numberOfBlocks, groupCount));
+
+    // Split the row groups such that all blocks have about the same number of entries.
+    uint64_t const entriesPerBlock = (matrix.getEntryCount() + numberOfBlocks - 1) / numberOfBlocks;
+    uint64_t entries = 0;
+    blockStarts.push_back(0);
+    for (uint64_t group = 0; group + 1 < groupCount && blockStarts.size() < numberOfBlocks; ++group) {
+        entries += matrix.getRowGroupEntryCount(group);
+        if (entries >= entriesPerBlock * blockStarts.size()) {
+            blockStarts.push_back(group + 1);
+        }
+    }
+    blockStarts.push_back(groupCount);
+}
+
+template<typename ValueType>
+uint64_t AsynchronousValueIterationHelper<ValueType>::getNumberOfBlocks() const {
+    return blockStarts.size() - 1;
+}
+
+template<typename ValueType>
+std::pair<uint64_t, SolverStatus> AsynchronousValueIterationHelper<ValueType>::solve(OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                                     std::vector<ValueType> const& b, ValueType const& precision,
+                                                                                     bool relative, UpdateStatusCallback const& updateStatus) const {
+    STORM_LOG_ASSERT(x.size() == matrix.getRowGroupCount(), "Unexpected size of the value vector.");
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+    uint64_t const numberOfBlocks = getNumberOfBlocks();
+    bool const minimize = storm::solver::minimize(dir);
+
+    // The values are shared between the threads without any synchronization beyond the atomicity of single reads and writes.
+    std::unique_ptr<std::atomic<ValueType>[]> values(new std::atomic<ValueType>[x.size()]);
+    auto publishValues = [&]() {
+        for (uint64_t group = 0; group < x.size(); ++group) {
+            values[group].store(x[group], std::memory_order_relaxed);
+        }
+    };
+    publishValues();
+
+    // The generation is increased whenever a sweep changes a value by more than the precision. A block is clean if its last sweep did not do
+    // that and no other sweep did since that sweep started.
+    uint64_t const noCleanGeneration = std::numeric_limits<uint64_t>::max();
+    std::atomic<uint64_t> generation(0);
+    std::vector<uint64_t> cleanGeneration(numberOfBlocks, noCleanGeneration);
+    std::vector<uint64_t> sweeps(numberOfBlocks, 0);
+    auto sweepUntilClean = [&](uint64_t block) {
+        for (uint64_t sweep = 0; sweep < avidetail::sweepsPerRound; ++sweep) {
+            uint64_t const startGeneration = generation.load();
+            if (cleanGeneration[block] == startGeneration) {
+                break;
+            }
+            if (avidetail::sweepBlock(matrix, blockStarts[block], blockStarts[block + 1], values.get(), b, minimize, precision, relative)) {
+                generation.fetch_add(1);
+                cleanGeneration[block] = noCleanGeneration;
+            } else {
+                cleanGeneration[block] = startGeneration;
+            }
+            ++sweeps[block];
+        }
+    };
+
+    std::vector<ValueType> newX(x.size());
+    uint64_t synchronousIterations = 0;
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBlocks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t block = range.begin(); block != range.end(); ++block) {
+                sweepUntilClean(block);
+            }
+        });
+#else
+        for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+            sweepUntilClean(block);
+        }
+#endif
+        for (uint64_t group = 0; group < x.size(); ++group) {
+            x[group] = values[group].load(std::memory_order_relaxed);
+        }
+
+        // If all blocks are clean, confirm convergence with a synchronous iteration.
+        if (std::all_of(cleanGeneration.begin(), cleanGeneration.end(), [&generation](uint64_t g) { return g == generation.load(); })) {
+            matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, newX, nullptr);
+            ++synchronousIterations;
+            if (storm::utility::vector::equalModuloPrecision<ValueType>(x, newX, precision, relative)) {
+                status = SolverStatus::Converged;
+            }
+            x.swap(newX);
+            publishValues();
+            std::fill(cleanGeneration.begin(), cleanGeneration.end(), noCleanGeneration);
+        }
+
+        uint64_t totalSweeps = 0;
+        for (auto const& blockSweeps : sweeps) {
+            totalSweeps += blockSweeps;
+        }
+        iterations = (totalSweeps + numberOfBlocks - 1) / numberOfBlocks + synchronousIterations;
+        status = updateStatus(status, x, iterations);
+    }
+    return {iterations, status};
+}
+
+template class AsynchronousValueIterationHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
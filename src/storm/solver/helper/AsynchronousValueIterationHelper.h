@@ -0,0 +1,70 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs asynchronous (chaotic) value iteration on a min/max equation system x = min/max (A*x + b).
+ *
+ * The row groups are split into blocks with roughly the same number of matrix entries. The blocks are swept concurrently, each one in place and
+ * without waiting for the others, i.e., a sweep reads whatever values the other blocks have written so far. Since the iteration operator is
+ * monotone, such updates preserve the guarantee that the current values are below (above) the solution if they were before.
+ *
+ * A block stops sweeping once one of its sweeps changed no value by more than the precision and no other block changed a value by more than
+ * the precision since that sweep started. When this holds for all blocks, a single synchronous iteration confirms convergence with respect to
+ * the same criterion as standard value iteration.
+ */
+template<typename ValueType>
+class AsynchronousValueIterationHelper {
+   public:
+    /*!
+     * Called between two rounds of sweeps with the current status, the current values and the number of iterations performed so far. Returns the
+     * status with which to proceed (to account for termination conditions and the maximal number of iterations).
+     */
+    typedef std::function<SolverStatus(SolverStatus, std::vector<ValueType> const&, uint64_t)> UpdateStatusCallback;
+
+    /*!
+     * Prepares asynchronous value iteration on the given matrix.
+     *
+     * @param matrix The matrix A of the equation system.
+     * @param numberOfBlocks The number of blocks that are swept concurrently. If zero, the number of available threads is used.
+     */
+    AsynchronousValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfBlocks = 0);
+
+    /*!
+     * Iterates until the values converged or the given callback stops the iteration.
+     *
+     * @param dir The optimization direction.
+     * @param x The initial values. Will contain the final values when the method returns.
+     * @param b The offset vector.
+     * @param precision The precision used to detect convergence.
+     * @param relative Whether the relative difference is considered.
+     * @param updateStatus The callback that is invoked between two rounds of sweeps.
+     * @return The number of iterations and the final status. An iteration corresponds to one sweep of all blocks.
+     */
+    std::pair<uint64_t, SolverStatus> solve(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                            ValueType const& precision, bool relative, UpdateStatusCallback const& updateStatus) const;
+
+    /*!
+     * Retrieves the number of blocks that are swept concurrently.
+     */
+    uint64_t getNumberOfBlocks() const;
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+
+    // The first row group of each block, followed by the number of row groups.
+    std::vector<uint64_t> blockStarts;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,343 @@
+#include "storm/solver/helper/KrylovSolverHelper.h"
+
+#include <cmath>
+
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace krylovdetail {
+template<typename ValueType>
+ValueType norm(std::vector<ValueType> const& vector) {
+    return storm::utility::sqrt(storm::utility::vector::dotProduct(vector, vector));
+}
+}  // namespace krylovdetail
+
+template<typename ValueType>
+KrylovSolverHelper<ValueType>::KrylovSolverHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                  NativeLinearEquationSolverPreconditioner preconditioner)
+    : matrix(matrix), multiplier(storm::solver::MultiplierFactory<ValueType>().create(env, matrix)), preconditioner(preconditioner) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "Krylov methods require a square matrix.");
+    if (this->preconditioner == NativeLinearEquationSolverPreconditioner::Ilu && !computeIlu()) {
+        STORM_LOG_WARN("The ILU(0) factorization encountered a zero pivot, using the diagonal preconditioner instead.");
+        iluValues.clear();
+        diagonalPositions.clear();
+        this->preconditioner = NativeLinearEquationSolverPreconditioner::Diagonal;
+    }
+    if (this->preconditioner == NativeLinearEquationSolverPreconditioner::Diagonal) {
+        inverseDiagonal.assign(matrix.getRowCount(), storm::utility::zero<ValueType>());
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                if (entry.getColumn() == row) {
+                    inverseDiagonal[row] = entry.getValue();
+                }
+            }
+            if (storm::utility::isZero(inverseDiagonal[row])) {
+                STORM_LOG_WARN("The matrix has a zero diagonal entry, not using a preconditioner.");
+                inverseDiagonal.clear();
+                this->preconditioner = NativeLinearEquationSolverPreconditioner::None;
+                break;
+            }
+            inverseDiagonal[row] = storm::utility::one<ValueType>() / inverseDiagonal[row];
+        }
+    }
+}
+
+template<typename ValueType>
+KrylovSolverHelper<ValueType>::KrylovSolverHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                  CustomPreconditioner const& preconditioner)
+    : matrix(matrix),
+      multiplier(storm::solver::MultiplierFactory<ValueType>().create(env, matrix)),
+      preconditioner(NativeLinearEquationSolverPreconditioner::None),
+      customPreconditioner(preconditioner) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "Krylov methods require a square matrix.");
+}
+
+template<typename ValueType>
+KrylovSolverHelper<ValueType>::~KrylovSolverHelper() = default;
+
+template<typename ValueType>
+NativeLinearEquationSolverPreconditioner KrylovSolverHelper<ValueType>::getPreconditioner() const {
+    return preconditioner;
+}
+
+template<typename ValueType>
+bool KrylovSolverHelper<ValueType>::computeIlu() {
+    uint64_t const rowCount = matrix.getRowCount();
+    auto const firstEntry = matrix.begin();
+    auto column = [&firstEntry](uint64_t position) { return (firstEntry + position)->getColumn(); };
+
+    iluValues.reserve(matrix.getEntryCount());
+    diagonalPositions.resize(rowCount);
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        bool hasDiagonal = false;
+        for (auto entryIt = matrix.begin(row), entryIte = matrix.end(row); entryIt != entryIte; ++entryIt) {
+            if (entryIt->getColumn() == row) {
+                diagonalPositions[row] = entryIt - firstEntry;
+                hasDiagonal = true;
+            }
+            iluValues.push_back(entryIt->getValue());
+        }
+        if (!hasDiagonal) {
+            return false;
+        }
+    }
+
+    // Perform the incomplete factorization in place, ignoring all fill-in. The entries of each row are sorted by column, so the entries before
+    // the diagonal belong to L and the ones after it belong to U.
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        uint64_t const rowEnd = matrix.end(row) - firstEntry;
+        for (uint64_t rowK = matrix.begin(row) - firstEntry; rowK < diagonalPositions[row]; ++rowK) {
+            uint64_t const k = column(rowK);
+            ValueType const& pivot = iluValues[diagonalPositions[k]];
+            if (storm::utility::isZero(pivot)) {
+                return false;
+            }
+            iluValues[rowK] /= pivot;
+
+            // Subtract the multiple of row k from the entries of the current row that are present in both rows.
+            uint64_t const kEnd = matrix.end(k) - firstEntry;
+            uint64_t kJ = diagonalPositions[k] + 1;
+            uint64_t rowJ = rowK + 1;
+            while (kJ < kEnd && rowJ < rowEnd) {
+                if (column(kJ) < column(rowJ)) {
+                    ++kJ;
+                } else if (column(rowJ) < column(kJ)) {
+                    ++rowJ;
+                } else {
+                    iluValues[rowJ] -= iluValues[rowK] * iluValues[kJ];
+                    ++kJ;
+                    ++rowJ;
+                }
+            }
+        }
+        if (storm::utility::isZero(iluValues[diagonalPositions[row]])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::precondition(std::vector<ValueType>& vector) const {
+    if (customPreconditioner) {
+        customPreconditioner(vector);
+    } else if (preconditioner == NativeLinearEquationSolverPreconditioner::Diagonal) {
+        storm::utility::vector::multiplyVectorsPointwise(inverseDiagonal, vector, vector);
+    } else if (preconditioner == NativeLinearEquationSolverPreconditioner::Ilu) {
+        auto const firstEntry = matrix.begin();
+        uint64_t const rowCount = matrix.getRowCount();
+        // Solve L*y = vector, where L has a unit diagonal.
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            for (uint64_t position = matrix.begin(row) - firstEntry; position < diagonalPositions[row]; ++position) {
+                vector[row] -= iluValues[position] * vector[(firstEntry + position)->getColumn()];
+            }
+        }
+        // Solve U*z = y.
+        for (uint64_t row = rowCount; row > 0;) {
+            --row;
+            uint64_t const rowEnd = matrix.end(row) - firstEntry;
+            for (uint64_t position = diagonalPositions[row] + 1; position < rowEnd; ++position) {
+                vector[row] -= iluValues[position] * vector[(firstEntry + position)->getColumn()];
+            }
+            vector[row] /= iluValues[diagonalPositions[row]];
+        }
+    }
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::computeResidual(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+                                                    std::vector<ValueType>& result) const {
+    multiplier->multiply(env, x, nullptr, result);
+    storm::utility::vector::subtractVectors(b, result, result);
+}
+
+template<typename ValueType>
+std::pair<uint64_t, SolverStatus> KrylovSolverHelper<ValueType>::solveBicgstab(Environment const& env, std::vector<ValueType>& x,
+                                                                               std::vector<ValueType> const& b, ValueType const& precision, bool relative,
+                                                                               UpdateStatusCallback const& updateStatus) const {
+    ValueType const bNorm = krylovdetail::norm(b);
+    ValueType const threshold = relative && !storm::utility::isZero(bNorm) ? precision * bNorm : precision;
+
+    std::vector<ValueType> r(x.size());
+    computeResidual(env, x, b, r);
+    SolverStatus status = updateStatus(krylovdetail::norm(r) <= threshold ? SolverStatus::Converged : SolverStatus::InProgress, x, 0);
+
+    std::vector<ValueType> rHat, p(x.size()), v(x.size()), pHat(x.size()), sHat(x.size()), t(x.size());
+    ValueType rho, alpha, omega;
+    auto restart = [&]() {
+        rHat = r;
+        rho = alpha = omega = storm::utility::one<ValueType>();
+        std::fill(p.begin(), p.end(), storm::utility::zero<ValueType>());
+        std::fill(v.begin(), v.end(), storm::utility::zero<ValueType>());
+    };
+    restart();
+
+    uint64_t iterations = 0;
+    while (status == SolverStatus::InProgress) {
+        ++iterations;
+        ValueType rhoNew = storm::utility::vector::dotProduct(rHat, r);
+        if (storm::utility::isZero(rhoNew)) {
+            // The shadow residual became orthogonal to the residual, so we restart with the current residual.
+            restart();
+            rhoNew = storm::utility::vector::dotProduct(rHat, r);
+        }
+        ValueType const beta = (rhoNew / rho) * (alpha / omega);
+        for (uint64_t i = 0; i < x.size(); ++i) {
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+        }
+        pHat = p;
+        precondition(pHat);
+        multiplier->multiply(env, pHat, nullptr, v);
+        ValueType const rHatV = storm::utility::vector::dotProduct(rHat, v);
+        if (storm::utility::isZero(rHatV)) {
+            restart();
+            status = updateStatus(status, x, iterations);
+            continue;
+        }
+        alpha = rhoNew / rHatV;
+        rho = rhoNew;
+
+        // Compute s = r - alpha * v in place of r.
+        storm::utility::vector::addScaledVector(r, v, -alpha);
+        storm::utility::vector::addScaledVector(x, pHat, alpha);
+        if (krylovdetail::norm(r) > threshold) {
+            sHat = r;
+            precondition(sHat);
+            multiplier->multiply(env, sHat, nullptr, t);
+            ValueType const tt = storm::utility::vector::dotProduct(t, t);
+            omega = storm::utility::isZero(tt) ? storm::utility::zero<ValueType>() : storm::utility::vector::dotProduct(t, r) / tt;
+            storm::utility::vector::addScaledVector(x, sHat, omega);
+            storm::utility::vector::addScaledVector(r, t, -omega);
+        }
+
+        // The updated residual drifts away from the true residual, so convergence is confirmed with the latter.
+        if (krylovdetail::norm(r) <= threshold) {
+            computeResidual(env, x, b, r);
+            if (krylovdetail::norm(r) <= threshold) {
+                status = SolverStatus::Converged;
+            } else {
+                restart();
+            }
+        } else if (storm::utility::isZero(omega)) {
+            restart();
+        }
+        status = updateStatus(status, x, iterations);
+    }
+    return {iterations, status};
+}
+
+template<typename ValueType>
+std::pair<uint64_t, SolverStatus> KrylovSolverHelper<ValueType>::solveGmres(Environment const& env, std::vector<ValueType>& x,
+                                                                            std::vector<ValueType> const& b, ValueType const& precision, bool relative,
+                                                                            uint64_t restart, UpdateStatusCallback const& updateStatus) const {
+    STORM_LOG_THROW(restart > 0, storm::exceptions::InvalidArgumentException, "The restart threshold of GMRES must be positive.");
+    ValueType const bNorm = krylovdetail::norm(b);
+    ValueType const threshold = relative && !storm::utility::isZero(bNorm) ? precision * bNorm : precision;
+
+    std::vector<ValueType> r(x.size());
+    computeResidual(env, x, b, r);
+    ValueType residualNorm = krylovdetail::norm(r);
+    SolverStatus status = updateStatus(residualNorm <= threshold ? SolverStatus::Converged : SolverStatus::InProgress, x, 0);
+
+    // The orthonormal basis of the Krylov subspace, the Hessenberg matrix (stored column-wise), the Givens rotations and the rotated residual.
+    std::vector<std::vector<ValueType>> basis;
+    std::vector<std::vector<ValueType>> hessenberg(restart, std::vector<ValueType>(restart + 1));
+    std::vector<ValueType> cosines(restart), sines(restart), g(restart + 1), y(restart), z(x.size());
+
+    uint64_t iterations = 0;
+    while (status == SolverStatus::InProgress) {
+        if (basis.empty()) {
+            basis.resize(restart + 1, std::vector<ValueType>(x.size()));
+        }
+        storm::utility::vector::scaleVectorInPlace(r, storm::utility::one<ValueType>() / residualNorm);
+        basis[0].swap(r);
+        std::fill(g.begin(), g.end(), storm::utility::zero<ValueType>());
+        g[0] = residualNorm;
+
+        uint64_t j = 0;
+        while (j < restart && status == SolverStatus::InProgress) {
+            // Extend the basis by A * M^-1 * v_j using modified Gram-Schmidt.
+            auto& column = hessenberg[j];
+            z = basis[j];
+            precondition(z);
+            std::vector<ValueType>& w = basis[j + 1];
+            multiplier->multiply(env, z, nullptr, w);
+            for (uint64_t i = 0; i <= j; ++i) {
+                column[i] = storm::utility::vector::dotProduct(w, basis[i]);
+                storm::utility::vector::addScaledVector(w, basis[i], -column[i]);
+            }
+            column[j + 1] = krylovdetail::norm(w);
+            bool const breakdown = storm::utility::isZero(column[j + 1]);
+            if (!breakdown) {
+                storm::utility::vector::scaleVectorInPlace(w, storm::utility::one<ValueType>() / column[j + 1]);
+            }
+
+            // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+            for (uint64_t i = 0; i < j; ++i) {
+                ValueType const tmp = cosines[i] * column[i] + sines[i] * column[i + 1];
+                column[i + 1] = -sines[i] * column[i] + cosines[i] * column[i + 1];
+                column[i] = tmp;
+            }
+            ValueType const hypot = storm::utility::sqrt(column[j] * column[j] + column[j + 1] * column[j + 1]);
+            if (storm::utility::isZero(hypot)) {
+                cosines[j] = storm::utility::one<ValueType>();
+                sines[j] = storm::utility::zero<ValueType>();
+            } else {
+                cosines[j] = column[j] / hypot;
+                sines[j] = column[j + 1] / hypot;
+            }
+            column[j] = cosines[j] * column[j] + sines[j] * column[j + 1];
+            column[j + 1] = storm::utility::zero<ValueType>();
+            g[j + 1] = -sines[j] * g[j];
+            g[j] = cosines[j] * g[j];
+
+            ++j;
+            ++iterations;
+            if (breakdown || storm::utility::abs(g[j]) <= threshold) {
+                break;
+            }
+            status = updateStatus(status, x, iterations);
+        }
+
+        // Solve the triangular system H*y = g and update x by M^-1 * V * y.
+        for (uint64_t i = j; i > 0;) {
+            --i;
+            y[i] = g[i];
+            for (uint64_t l = i + 1; l < j; ++l) {
+                y[i] -= hessenberg[l][i] * y[l];
+            }
+            y[i] = storm::utility::isZero(hessenberg[i][i]) ? storm::utility::zero<ValueType>() : y[i] / hessenberg[i][i];
+        }
+        std::fill(z.begin(), z.end(), storm::utility::zero<ValueType>());
+        for (uint64_t i = 0; i < j; ++i) {
+            storm::utility::vector::addScaledVector(z, basis[i], y[i]);
+        }
+        precondition(z);
+        storm::utility::vector::addVectors(x, z, x);
+
+        r.resize(x.size());
+        computeResidual(env, x, b, r);
+        residualNorm = krylovdetail::norm(r);
+        if (residualNorm <= threshold) {
+            status = SolverStatus::Converged;
+        }
+        status = updateStatus(status, x, iterations);
+    }
+    return {iterations, status};
+}
+
+template class KrylovSolverHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
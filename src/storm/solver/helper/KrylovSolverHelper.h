@@ -0,0 +1,125 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+template<typename ValueType>
+class Multiplier;
+
+namespace helper {
+
+/*!
+ * Solves a linear equation system A*x = b with restarted GMRES or BiCGSTAB, using an (optional) right preconditioner.
+ *
+ * All computations operate directly on the given matrix and a multiplier for it, i.e., the matrix is never copied into a different format. The
+ * ILU(0) preconditioner only stores the factorized values; the sparsity pattern is shared with the matrix. Convergence is detected with respect
+ * to the residual: the iteration stops once ||b - A*x||_2 is below the precision (times ||b||_2 if the relative criterion is used).
+ */
+template<typename ValueType>
+class KrylovSolverHelper {
+   public:
+    /*!
+     * Called with the current status, the current values and the number of iterations performed so far. Returns the status with which to
+     * proceed (to account for termination conditions and the maximal number of iterations).
+     */
+    typedef std::function<SolverStatus(SolverStatus, std::vector<ValueType> const&, uint64_t)> UpdateStatusCallback;
+
+    /*!
+     * Replaces the given vector v by M^-1 * v for some (fixed) preconditioning matrix M.
+     */
+    typedef std::function<void(std::vector<ValueType>&)> CustomPreconditioner;
+
+    /*!
+     * Prepares the Krylov methods for the given matrix, which includes computing the preconditioner. If the ILU(0) factorization encounters a zero
+     * pivot, the diagonal preconditioner is used instead (or none, if the diagonal has zero entries as well).
+     *
+     * @param env The environment used to create the multiplier.
+     * @param matrix The (square) matrix A of the equation system.
+     * @param preconditioner The preconditioner to use.
+     */
+    KrylovSolverHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix,
+                       NativeLinearEquationSolverPreconditioner preconditioner);
+
+    /*!
+     * Prepares the Krylov methods for the given matrix using the given preconditioner.
+     *
+     * @param env The environment used to create the multiplier.
+     * @param matrix The (square) matrix A of the equation system.
+     * @param preconditioner The preconditioner to use. It must represent the same linear operator whenever it is invoked.
+     */
+    KrylovSolverHelper(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix, CustomPreconditioner const& preconditioner);
+
+    ~KrylovSolverHelper();
+
+    /*!
+     * Solves the equation system with BiCGSTAB.
+     *
+     * @param env The environment used for the multiplications.
+     * @param x The initial guess. Will contain the final values when the method returns.
+     * @param b The right-hand side.
+     * @param precision The precision used to detect convergence.
+     * @param relative Whether the residual is considered relative to the norm of b.
+     * @param updateStatus The callback that is invoked after every iteration.
+     * @return The number of iterations and the final status.
+     */
+    std::pair<uint64_t, SolverStatus> solveBicgstab(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                    ValueType const& precision, bool relative, UpdateStatusCallback const& updateStatus) const;
+
+    /*!
+     * Solves the equation system with restarted GMRES.
+     *
+     * @param env The environment used for the multiplications.
+     * @param x The initial guess. Will contain the final values when the method returns.
+     * @param b The right-hand side.
+     * @param precision The precision used to detect convergence.
+     * @param relative Whether the residual is considered relative to the norm of b.
+     * @param restart The number of iterations after which the Krylov subspace is discarded.
+     * @param updateStatus The callback that is invoked after every iteration.
+     * @return The number of iterations and the final status.
+     */
+    std::pair<uint64_t, SolverStatus> solveGmres(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                 ValueType const& precision, bool relative, uint64_t restart, UpdateStatusCallback const& updateStatus) const;
+
+    /*!
+     * Retrieves the built-in preconditioner that is actually used. This is None if a custom preconditioner is used.
+     */
+    NativeLinearEquationSolverPreconditioner getPreconditioner() const;
+
+   private:
+    // Applies the preconditioner to the given vector in place.
+    void precondition(std::vector<ValueType>& vector) const;
+
+    // Computes the residual b - A*x.
+    void computeResidual(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result) const;
+
+    // Computes the ILU(0) factorization and returns false if a zero pivot was encountered.
+    bool computeIlu();
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    std::unique_ptr<Multiplier<ValueType>> multiplier;
+    NativeLinearEquationSolverPreconditioner preconditioner;
+    CustomPreconditioner customPreconditioner;
+
+    // For the diagonal preconditioner: the inverted diagonal entries.
+    std::vector<ValueType> inverseDiagonal;
+
+    // For the ILU preconditioner: the values of L (without its unit diagonal) and U, stored at the positions of the matrix entries, and the
+    // position of the diagonal entry of each row.
+    std::vector<ValueType> iluValues;
+    std::vector<uint64_t> diagonalPositions;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,338 @@
+#include "storm/solver/helper/MultigridSolverHelper.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace mgdetail {
+// An entry is strong if its absolute value is at least this fraction of the largest off-diagonal entry in its row.
+double const strengthThreshold = 0.25;
+
+// Coarsening stops if a level has more than this fraction of the unknowns of the previous level.
+double const minimalCoarseningRatio = 0.9;
+
+// The coarsest system is solved with a dense LU decomposition if it has at most this many unknowns and smoothed otherwise.
+uint64_t const maximalDenseSize = 1024;
+uint64_t const coarsestSmoothingSweeps = 10;
+
+uint64_t const noAggregate = std::numeric_limits<uint64_t>::max();
+
+/*!
+ * Aggregates the unknowns of the given matrix. Returns the number of aggregates.
+ */
+template<typename ValueType>
+uint64_t computeAggregates(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t>& aggregateOf) {
+    uint64_t const size = matrix.getRowCount();
+    ValueType const threshold = storm::utility::convertNumber<ValueType>(strengthThreshold);
+
+    // Determine the strong connections of each row.
+    std::vector<ValueType> strongBounds(size, storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < size; ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            if (entry.getColumn() != row) {
+                strongBounds[row] = std::max<ValueType>(strongBounds[row], storm::utility::abs<ValueType>(entry.getValue()));
+            }
+        }
+        strongBounds[row] *= threshold;
+    }
+    auto isStrong = [&](uint64_t row, auto const& entry) {
+        return entry.getColumn() != row && !storm::utility::isZero(entry.getValue()) &&
+               storm::utility::abs<ValueType>(entry.getValue()) >= strongBounds[row];
+    };
+
+    // First, unknowns whose strong neighbors are all unaggregated form a new aggregate together with these neighbors.
+    aggregateOf.assign(size, noAggregate);
+    uint64_t numberOfAggregates = 0;
+    for (uint64_t row = 0; row < size; ++row) {
+        if (aggregateOf[row] != noAggregate) {
+            continue;
+        }
+        bool hasStrongNeighbor = false;
+        bool allNeighborsFree = true;
+        for (auto const& entry : matrix.getRow(row)) {
+            if (isStrong(row, entry)) {
+                hasStrongNeighbor = true;
+                if (aggregateOf[entry.getColumn()] != noAggregate) {
+                    allNeighborsFree = false;
+                    break;
+                }
+            }
+        }
+        if (hasStrongNeighbor && allNeighborsFree) {
+            aggregateOf[row] = numberOfAggregates;
+            for (auto const& entry : matrix.getRow(row)) {
+                if (isStrong(row, entry)) {
+                    aggregateOf[entry.getColumn()] = numberOfAggregates;
+                }
+            }
+            ++numberOfAggregates;
+        }
+    }
+
+    // Then, the remaining unknowns join the aggregate of their strongest aggregated neighbor or form an aggregate on their own.
+    std::vector<uint64_t> joinedAggregate(size, noAggregate);
+    for (uint64_t row = 0; row < size; ++row) {
+        if (aggregateOf[row] != noAggregate) {
+            continue;
+        }
+        ValueType strongest = storm::utility::zero<ValueType>();
+        for (auto const& entry : matrix.getRow(row)) {
+            if (isStrong(row, entry) && aggregateOf[entry.getColumn()] != noAggregate &&
+                storm::utility::abs<ValueType>(entry.getValue()) > strongest) {
+                strongest = storm::utility::abs<ValueType>(entry.getValue());
+                joinedAggregate[row] = aggregateOf[entry.getColumn()];
+            }
+        }
+        if (joinedAggregate[row] == noAggregate) {
+            joinedAggregate[row] = numberOfAggregates++;
+        }
+    }
+    for (uint64_t row = 0; row < size; ++row) {
+        if (aggregateOf[row] == noAggregate) {
+            aggregateOf[row] = joinedAggregate[row];
+        }
+    }
+    return numberOfAggregates;
+}
+
+/*!
+ * Computes the matrix of the next level, i.e., sums up the rows and columns of each aggregate.
+ */
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> computeCoarseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& aggregateOf,
+                                                            uint64_t numberOfAggregates) {
+    // Sort the rows by their aggregate.
+    std::vector<uint64_t> aggregateStarts(numberOfAggregates + 1, 0);
+    for (auto const& aggregate : aggregateOf) {
+        ++aggregateStarts[aggregate + 1];
+    }
+    for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+        aggregateStarts[aggregate + 1] += aggregateStarts[aggregate];
+    }
+    std::vector<uint64_t> rowsOfAggregates(aggregateOf.size());
+    std::vector<uint64_t> nextPosition(aggregateStarts.begin(), aggregateStarts.end() - 1);
+    for (uint64_t row = 0; row < aggregateOf.size(); ++row) {
+        rowsOfAggregates[nextPosition[aggregateOf[row]]++] = row;
+    }
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfAggregates, numberOfAggregates);
+    std::vector<ValueType> accumulator(numberOfAggregates, storm::utility::zero<ValueType>());
+    std::vector<bool> touched(numberOfAggregates, false);
+    std::vector<uint64_t> touchedColumns;
+    for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+        // The diagonal entry is always present (as required by the smoother).
+        touched[aggregate] = true;
+        touchedColumns.push_back(aggregate);
+        for (uint64_t position = aggregateStarts[aggregate]; position < aggregateStarts[aggregate + 1]; ++position) {
+            for (auto const& entry : matrix.getRow(rowsOfAggregates[position])) {
+                uint64_t const column = aggregateOf[entry.getColumn()];
+                if (!touched[column]) {
+                    touched[column] = true;
+                    touchedColumns.push_back(column);
+                }
+                accumulator[column] += entry.getValue();
+            }
+        }
+        std::sort(touchedColumns.begin(), touchedColumns.end());
+        for (auto const& column : touchedColumns) {
+            if (column == aggregate || !storm::utility::isZero(accumulator[column])) {
+                builder.addNextValue(aggregate, column, accumulator[column]);
+            }
+            accumulator[column] = storm::utility::zero<ValueType>();
+            touched[column] = false;
+        }
+        touchedColumns.clear();
+    }
+    return builder.build();
+}
+}  // namespace mgdetail
+
+template<typename ValueType>
+MultigridSolverHelper<ValueType>::MultigridSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t maximalNumberOfLevels,
+                                                        uint64_t coarsestSize)
+    : matrix(matrix) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException, "Multigrid requires a square matrix.");
+    STORM_LOG_THROW(maximalNumberOfLevels > 0, storm::exceptions::InvalidArgumentException, "Multigrid requires at least one level.");
+
+    while (getNumberOfLevels() < maximalNumberOfLevels && getSizeOfLevel(getNumberOfLevels() - 1) > coarsestSize) {
+        auto const& fineMatrix = getMatrix(getNumberOfLevels() - 1);
+        std::vector<uint64_t> aggregateOf;
+        uint64_t numberOfAggregates = mgdetail::computeAggregates(fineMatrix, aggregateOf);
+        if (numberOfAggregates > mgdetail::minimalCoarseningRatio * fineMatrix.getRowCount()) {
+            break;
+        }
+        coarseMatrices.push_back(mgdetail::computeCoarseMatrix(fineMatrix, aggregateOf, numberOfAggregates));
+        aggregates.push_back(std::move(aggregateOf));
+    }
+
+    // Decompose the matrix of the coarsest level if it is small enough.
+    uint64_t const size = getSizeOfLevel(getNumberOfLevels() - 1);
+    if (size <= mgdetail::maximalDenseSize) {
+        coarsestLu.assign(size * size, storm::utility::zero<ValueType>());
+        for (uint64_t row = 0; row < size; ++row) {
+            for (auto const& entry : getMatrix(getNumberOfLevels() - 1).getRow(row)) {
+                coarsestLu[row * size + entry.getColumn()] += entry.getValue();
+            }
+        }
+        coarsestPivots.resize(size);
+        for (uint64_t k = 0; k < size; ++k) {
+            uint64_t pivot = k;
+            for (uint64_t row = k + 1; row < size; ++row) {
+                if (storm::utility::abs<ValueType>(coarsestLu[row * size + k]) > storm::utility::abs<ValueType>(coarsestLu[pivot * size + k])) {
+                    pivot = row;
+                }
+            }
+            coarsestPivots[k] = pivot;
+            if (pivot != k) {
+                std::swap_ranges(coarsestLu.begin() + k * size, coarsestLu.begin() + (k + 1) * size, coarsestLu.begin() + pivot * size);
+            }
+            ValueType const& diagonal = coarsestLu[k * size + k];
+            if (storm::utility::isZero(diagonal)) {
+                continue;
+            }
+            for (uint64_t row = k + 1; row < size; ++row) {
+                ValueType& factor = coarsestLu[row * size + k];
+                if (!storm::utility::isZero(factor)) {
+                    factor /= diagonal;
+                    for (uint64_t column = k + 1; column < size; ++column) {
+                        coarsestLu[row * size + column] -= factor * coarsestLu[k * size + column];
+                    }
+                }
+            }
+        }
+    }
+
+    rightHandSides.resize(getNumberOfLevels());
+    values.resize(getNumberOfLevels());
+    residuals.resize(getNumberOfLevels());
+    for (uint64_t level = 0; level < getNumberOfLevels(); ++level) {
+        rightHandSides[level].resize(getSizeOfLevel(level));
+        values[level].resize(getSizeOfLevel(level));
+        residuals[level].resize(getSizeOfLevel(level));
+    }
+}
+
+template<typename ValueType>
+uint64_t MultigridSolverHelper<ValueType>::getNumberOfLevels() const {
+    return coarseMatrices.size() + 1;
+}
+
+template<typename ValueType>
+uint64_t MultigridSolverHelper<ValueType>::getSizeOfLevel(uint64_t level) const {
+    return getMatrix(level).getRowCount();
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& MultigridSolverHelper<ValueType>::getMatrix(uint64_t level) const {
+    return level == 0 ? matrix : coarseMatrices[level - 1];
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::applyCycle(std::vector<ValueType>& vector) const {
+    STORM_LOG_ASSERT(vector.size() == matrix.getRowCount(), "Unexpected size of the vector.");
+    rightHandSides[0].swap(vector);
+    cycle(0);
+    rightHandSides[0].swap(vector);
+    vector.swap(values[0]);
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::cycle(uint64_t level) const {
+    std::fill(values[level].begin(), values[level].end(), storm::utility::zero<ValueType>());
+    if (level + 1 == getNumberOfLevels()) {
+        solveCoarsest();
+        return;
+    }
+
+    smooth(level, false);
+
+    // Restrict the residual to the next level, solve there and apply the correction.
+    getMatrix(level).multiplyWithVector(values[level], residuals[level]);
+    storm::utility::vector::subtractVectors(rightHandSides[level], residuals[level], residuals[level]);
+    auto const& aggregateOf = aggregates[level];
+    std::fill(rightHandSides[level + 1].begin(), rightHandSides[level + 1].end(), storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < aggregateOf.size(); ++row) {
+        rightHandSides[level + 1][aggregateOf[row]] += residuals[level][row];
+    }
+    cycle(level + 1);
+    for (uint64_t row = 0; row < aggregateOf.size(); ++row) {
+        values[level][row] += values[level + 1][aggregateOf[row]];
+    }
+
+    smooth(level, true);
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::smooth(uint64_t level, bool backward) const {
+    auto const& levelMatrix = getMatrix(level);
+    auto& x = values[level];
+    auto const& b = rightHandSides[level];
+    uint64_t const size = x.size();
+    for (uint64_t i = 0; i < size; ++i) {
+        uint64_t const row = backward ? size - 1 - i : i;
+        ValueType value = b[row];
+        ValueType diagonal = storm::utility::zero<ValueType>();
+        for (auto const& entry : levelMatrix.getRow(row)) {
+            if (entry.getColumn() == row) {
+                diagonal += entry.getValue();
+            } else {
+                value -= entry.getValue() * x[entry.getColumn()];
+            }
+        }
+        // Rows without diagonal entry are left unchanged.
+        if (!storm::utility::isZero(diagonal)) {
+            x[row] = value / diagonal;
+        }
+    }
+}
+
+template<typename ValueType>
+void MultigridSolverHelper<ValueType>::solveCoarsest() const {
+    uint64_t const level = getNumberOfLevels() - 1;
+    if (coarsestLu.empty()) {
+        for (uint64_t sweep = 0; sweep < mgdetail::coarsestSmoothingSweeps; ++sweep) {
+            smooth(level, sweep % 2 == 1);
+        }
+        return;
+    }
+
+    uint64_t const size = getSizeOfLevel(level);
+    auto& x = values[level];
+    x = rightHandSides[level];
+    for (uint64_t k = 0; k < size; ++k) {
+        std::swap(x[k], x[coarsestPivots[k]]);
+    }
+    for (uint64_t row = 1; row < size; ++row) {
+        for (uint64_t column = 0; column < row; ++column) {
+            x[row] -= coarsestLu[row * size + column] * x[column];
+        }
+    }
+    // Unknowns with a zero pivot (only occurring for singular systems) are set to zero.
+    for (uint64_t row = size; row > 0;) {
+        --row;
+        ValueType const& diagonal = coarsestLu[row * size + row];
+        if (storm::utility::isZero(diagonal)) {
+            x[row] = storm::utility::zero<ValueType>();
+            continue;
+        }
+        for (uint64_t column = row + 1; column < size; ++column) {
+            x[row] -= coarsestLu[row * size + column] * x[column];
+        }
+        x[row] /= diagonal;
+    }
+}
+
+template class MultigridSolverHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Provides an aggregation-based algebraic multigrid hierarchy for a linear equation system A*x = b.
+ *
+ * The unknowns of each level are grouped greedily into aggregates of strongly connected unknowns, where j is strongly connected to i if |A(i,j)|
+ * is at least a fixed fraction of the largest off-diagonal entry in row i. The next level is obtained by summing up the rows and columns of each
+ * aggregate (i.e., the Galerkin product with the piecewise constant prolongation). Coarsening stops once the system is small enough, the maximal
+ * number of levels is reached or it does not reduce the number of unknowns significantly. The coarsest system is solved directly if it is
+ * small and smoothed otherwise.
+ *
+ * A V-cycle with symmetric Gauss-Seidel smoothing is a linear operator approximating the inverse of A. It is meant to be used as a
+ * preconditioner for a Krylov method, which makes it robust also for matrices that are not M-matrices.
+ */
+template<typename ValueType>
+class MultigridSolverHelper {
+   public:
+    /*!
+     * Builds the multigrid hierarchy for the given matrix.
+     *
+     * @param matrix The (square) matrix A of the equation system.
+     * @param maximalNumberOfLevels The maximal number of levels, including the finest one.
+     * @param coarsestSize The size below which no further coarsening is performed.
+     */
+    MultigridSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t maximalNumberOfLevels = 20, uint64_t coarsestSize = 256);
+
+    /*!
+     * Performs one V-cycle for the given right-hand side, starting from zero.
+     *
+     * @param vector The right-hand side. Will contain the approximate solution when the method returns.
+     */
+    void applyCycle(std::vector<ValueType>& vector) const;
+
+    /*!
+     * Retrieves the number of levels of the hierarchy.
+     */
+    uint64_t getNumberOfLevels() const;
+
+    /*!
+     * Retrieves the number of unknowns of the given level.
+     */
+    uint64_t getSizeOfLevel(uint64_t level) const;
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& getMatrix(uint64_t level) const;
+
+    // Performs a V-cycle on the given level. The values are assumed to be zero initially.
+    void cycle(uint64_t level) const;
+
+    // Performs one Gauss-Seidel sweep on the given level.
+    void smooth(uint64_t level, bool backward) const;
+
+    // Solves the system of the coarsest level (directly if an LU decomposition is available).
+    void solveCoarsest() const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+
+    // The matrices of all levels but the finest one.
+    std::vector<storm::storage::SparseMatrix<ValueType>> coarseMatrices;
+
+    // For all levels but the coarsest one: the aggregate (i.e., the unknown of the next level) of each unknown.
+    std::vector<std::vector<uint64_t>> aggregates;
+
+    // A dense LU decomposition (with row pivoting) of the matrix of the coarsest level, if it is small enough.
+    std::vector<ValueType> coarsestLu;
+    std::vector<uint64_t> coarsestPivots;
+
+    // Auxiliary vectors for each level.
+    mutable std::vector<std::vector<ValueType>> rightHandSides;
+    mutable std::vector<std::vector<ValueType>> values;
+    mutable std::vector<std::vector<ValueType>> residuals;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -1,6 +1,9 @@
 #include "OptimisticValueIterationHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/vector.h"
@@ -33,6 +36,44 @@ void guessUpperBoundAbsolute(std::vector<ValueType> const& x, std::vector<ValueT
                                                                  [&precision](ValueType const& argument) -> ValueType { return argument + precision; });
 }
 
+/// Updates the maximal difference between two iterations with the difference at a single position.
+template<typename ValueType>
+void updateDiff(ValueType& diff, ValueType const& newXi, ValueType const& oldXi, bool computeRelativeDiff) {
+    if (computeRelativeDiff) {
+        if (storm::utility::isZero(newXi)) {
+            if (!storm::utility::isZero(oldXi)) {
+                diff = std::max(diff, storm::utility::one<ValueType>());
+            }
+        } else {
+            diff = std::max(diff, storm::utility::abs<ValueType>((newXi - oldXi) / newXi));
+        }
+    } else {
+        diff = std::max(diff, storm::utility::abs<ValueType>(newXi - oldXi));
+    }
+}
+
+/// Compares the new upper bound candidate at a single position with the old one and returns the value to store.
+template<typename ValueType>
+ValueType updateUpperBound(ValueType const& newXi, ValueType const& oldXi, bool takeMinOfOldAndNew, bool& alwaysHigherOrEqual, bool& alwaysLowerOrEqual) {
+    if (newXi > oldXi) {
+        alwaysLowerOrEqual = false;
+        return takeMinOfOldAndNew ? oldXi : newXi;
+    } else if (newXi != oldXi) {
+        assert(newXi < oldXi);
+        alwaysHigherOrEqual = false;
+    }
+    return newXi;
+}
+
+template<typename IterateResult>
+IterateResult getIterateResult(bool alwaysHigherOrEqual, bool alwaysLowerOrEqual) {
+    if (alwaysLowerOrEqual) {
+        return alwaysHigherOrEqual ? IterateResult::Equal : IterateResult::AlwaysLowerOrEqual;
+    } else {
+        return alwaysHigherOrEqual ? IterateResult::AlwaysHigherOrEqual : IterateResult::Incomparable;
+    }
+}
+
 template<typename ValueType>
 IterationHelper<ValueType>::IterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) {
     STORM_LOG_THROW(static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) > matrix.getRowCount() + 1, storm::exceptions::NotSupportedException,
@@ -97,20 +138,7 @@ ValueType IterationHelper<ValueType>::singleIterationWithDiffInternal(std::vecto
             newXi = HasRowGroups ? multiplyRowGroup<Dir>(i, b, x) : multiplyRow(i, b[i], x);
         }
         ValueType& oldXi = x[i];
-        if (computeRelativeDiff) {
-            if (storm::utility::isZero(newXi)) {
-                if (storm::utility::isZero(oldXi)) {
-                    // this operation has no effect:
-                    // diff = std::max(diff, storm::utility::zero<ValueType>());
-                } else {
-                    diff = std::max(diff, storm::utility::one<ValueType>());
-                }
-            } else {
-                diff = std::max(diff, storm::utility::abs<ValueType>((newXi - oldXi) / newXi));
-            }
-        } else {
-            diff = std::max(diff, storm::utility::abs<ValueType>(newXi - oldXi));
-        }
+        updateDiff(diff, newXi, oldXi, computeRelativeDiff);
         oldXi = std::move(newXi);
     }
     return diff;
@@ -222,32 +250,99 @@ typename IterationHelper<ValueType>::IterateResult IterationHelper<ValueType>::i
         } else {
             newXi = HasRowGroups ? multiplyRowGroup<Dir>(i, b, x) : multiplyRow(i, b[i], x);
         }
-        ValueType& oldXi = x[i];
-        if (newXi > oldXi) {
-            newUpperBoundAlwaysLowerEqual = false;
-            if (!takeMinOfOldAndNew) {
-                oldXi = newXi;
-            }
-        } else if (newXi != oldXi) {
-            assert(newXi < oldXi);
-            newUpperBoundAlwaysHigherEqual = false;
-            oldXi = newXi;
-        }
+        x[i] = updateUpperBound(newXi, x[i], takeMinOfOldAndNew, newUpperBoundAlwaysHigherEqual, newUpperBoundAlwaysLowerEqual);
     }
-    // Return appropriate result
-    if (newUpperBoundAlwaysLowerEqual) {
-        if (newUpperBoundAlwaysHigherEqual) {
-            return IterateResult::Equal;
-        } else {
-            return IterateResult::AlwaysLowerOrEqual;
-        }
+    return getIterateResult<IterateResult>(newUpperBoundAlwaysHigherEqual, newUpperBoundAlwaysLowerEqual);
+}
+
+template<typename ValueType>
+typename IterationHelper<ValueType>::IterateResult IterationHelper<ValueType>::iterateBoth(storm::solver::OptimizationDirection const& dir,
+                                                                                          std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX,
+                                                                                          std::vector<ValueType> const& b, bool takeMinOfOldAndNew,
+                                                                                          bool computeRelativeDiff, ValueType& lowerDiff, bool parallel) {
+    if (minimize(dir)) {
+        return iterateBothInternal<true, storm::solver::OptimizationDirection::Minimize>(lowerX, upperX, b, takeMinOfOldAndNew, computeRelativeDiff,
+                                                                                         lowerDiff, parallel);
     } else {
-        if (newUpperBoundAlwaysHigherEqual) {
-            return IterateResult::AlwaysHigherOrEqual;
+        return iterateBothInternal<true, storm::solver::OptimizationDirection::Maximize>(lowerX, upperX, b, takeMinOfOldAndNew, computeRelativeDiff,
+                                                                                         lowerDiff, parallel);
+    }
+}
+
+template<typename ValueType>
+typename IterationHelper<ValueType>::IterateResult IterationHelper<ValueType>::iterateBoth(std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX,
+                                                                                          std::vector<ValueType> const& b, bool takeMinOfOldAndNew,
+                                                                                          bool computeRelativeDiff, ValueType& lowerDiff, bool parallel) {
+    return iterateBothInternal<false, storm::solver::OptimizationDirection::Minimize>(lowerX, upperX, b, takeMinOfOldAndNew, computeRelativeDiff, lowerDiff,
+                                                                                      parallel);
+}
+
+template<typename ValueType>
+template<bool HasRowGroups, storm::solver::OptimizationDirection Dir>
+typename IterationHelper<ValueType>::IterateResult IterationHelper<ValueType>::iterateBothInternal(std::vector<ValueType>& lowerX,
+                                                                                                  std::vector<ValueType>& upperX,
+                                                                                                  std::vector<ValueType> const& b, bool takeMinOfOldAndNew,
+                                                                                                  bool computeRelativeDiff, ValueType& lowerDiff,
+                                                                                                  bool parallel) {
+    STORM_LOG_ASSERT(lowerX.size() == upperX.size(), "Dimension missmatch.");
+    auto computeNewValues = [&](IndexType i, ValueType& newLowerXi, ValueType& newUpperXi) {
+        if (HasRowGroups) {
+            multiplyRowGroup2<Dir>(i, b, lowerX, newLowerXi, upperX, newUpperXi);
         } else {
-            return IterateResult::Incomparable;
+            multiplyRow2(i, b[i], lowerX, newLowerXi, upperX, newUpperXi);
         }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        // The new values are written to separate vectors such that the old ones can be read concurrently.
+        auxLowerX.resize(lowerX.size());
+        auxUpperX.resize(upperX.size());
+        struct PartialResult {
+            ValueType diff;
+            bool alwaysHigherOrEqual;
+            bool alwaysLowerOrEqual;
+        };
+        PartialResult result = tbb::parallel_reduce(
+            tbb::blocked_range<IndexType>(0, lowerX.size(), 100), PartialResult{storm::utility::zero<ValueType>(), true, true},
+            [&](tbb::blocked_range<IndexType> const& range, PartialResult partial) {
+                ValueType newLowerXi, newUpperXi;
+                for (IndexType i = range.begin(); i < range.end(); ++i) {
+                    computeNewValues(i, newLowerXi, newUpperXi);
+                    updateDiff(partial.diff, newLowerXi, lowerX[i], computeRelativeDiff);
+                    auxLowerX[i] = std::move(newLowerXi);
+                    auxUpperX[i] = updateUpperBound(newUpperXi, upperX[i], takeMinOfOldAndNew, partial.alwaysHigherOrEqual, partial.alwaysLowerOrEqual);
+                }
+                return partial;
+            },
+            [](PartialResult first, PartialResult const& second) {
+                first.diff = std::max(first.diff, second.diff);
+                first.alwaysHigherOrEqual &= second.alwaysHigherOrEqual;
+                first.alwaysLowerOrEqual &= second.alwaysLowerOrEqual;
+                return first;
+            });
+        lowerX.swap(auxLowerX);
+        upperX.swap(auxUpperX);
+        lowerDiff = std::move(result.diff);
+        return getIterateResult<IterateResult>(result.alwaysHigherOrEqual, result.alwaysLowerOrEqual);
+    }
+#else
+    STORM_LOG_WARN_COND(!parallel, "Parallel iterations require Intel TBB. Iterating sequentially.");
+#endif
+
+    // Do a backwards gauss-seidel style iteration on both vectors
+    bool newUpperBoundAlwaysHigherEqual = true;
+    bool newUpperBoundAlwaysLowerEqual = true;
+    lowerDiff = storm::utility::zero<ValueType>();
+    ValueType newLowerXi, newUpperXi;
+    for (IndexType i = lowerX.size(); i > 0;) {
+        --i;
+        computeNewValues(i, newLowerXi, newUpperXi);
+        updateDiff(lowerDiff, newLowerXi, lowerX[i], computeRelativeDiff);
+        lowerX[i] = std::move(newLowerXi);
+        upperX[i] = updateUpperBound(newUpperXi, upperX[i], takeMinOfOldAndNew, newUpperBoundAlwaysHigherEqual, newUpperBoundAlwaysLowerEqual);
     }
+    return getIterateResult<IterateResult>(newUpperBoundAlwaysHigherEqual, newUpperBoundAlwaysLowerEqual);
 }
 
 template<typename ValueType>
@@ -278,6 +373,39 @@ ValueType IterationHelper<ValueType>::multiplyRowGroup(IndexType const& rowGroup
     }
     return xRes;
 }
+
+template<typename ValueType>
+void IterationHelper<ValueType>::multiplyRow2(IndexType const& rowIndex, ValueType const& bi, std::vector<ValueType> const& x1, ValueType& val1,
+                                              std::vector<ValueType> const& x2, ValueType& val2) {
+    assert(rowIndex < rowIndications.size());
+    val1 = bi;
+    val2 = bi;
+
+    auto entryIt = matrixValues.begin() + rowIndications[rowIndex];
+    auto entryItE = matrixValues.begin() + rowIndications[rowIndex + 1];
+    auto colIt = matrixColumns.begin() + rowIndications[rowIndex];
+    for (; entryIt != entryItE; ++entryIt, ++colIt) {
+        val1 += *entryIt * x1[*colIt];
+        val2 += *entryIt * x2[*colIt];
+    }
+}
+
+template<typename ValueType>
+template<storm::solver::OptimizationDirection Dir>
+void IterationHelper<ValueType>::multiplyRowGroup2(IndexType const& rowGroupIndex, std::vector<ValueType> const& b, std::vector<ValueType> const& x1,
+                                                   ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) {
+    STORM_LOG_ASSERT(rowGroupIndices != nullptr, "No row group indices available.");
+    auto row = (*rowGroupIndices)[rowGroupIndex];
+    auto const& groupEnd = (*rowGroupIndices)[rowGroupIndex + 1];
+    STORM_LOG_ASSERT(row < groupEnd, "Empty row group not expected.");
+    multiplyRow2(row, b[row], x1, val1, x2, val2);
+    ValueType cur1, cur2;
+    for (++row; row < groupEnd; ++row) {
+        multiplyRow2(row, b[row], x1, cur1, x2, cur2);
+        val1 = minimize(Dir) ? std::min(val1, cur1) : std::max(val1, cur1);
+        val2 = minimize(Dir) ? std::min(val2, cur2) : std::max(val2, cur2);
+    }
+}
 }  // namespace oviinternal
 
 template<typename ValueType>
@@ -289,7 +417,8 @@ template<typename ValueType>
 std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::solveEquations(
     Environment const& env, std::vector<ValueType>* lowerX, std::vector<ValueType>* upperX, std::vector<ValueType> const& b, bool relative, ValueType precision,
     uint64_t maxOverallIterations, boost::optional<storm::solver::OptimizationDirection> dir, boost::optional<storm::storage::BitVector> const& relevantValues,
-    boost::optional<storage::BitVector> const& schedulerFixedForRowgroup, boost::optional<std::vector<uint_fast64_t>> const& scheduler) {
+    boost::optional<storage::BitVector> const& schedulerFixedForRowgroup, boost::optional<std::vector<uint_fast64_t>> const& scheduler,
+    VerificationCallback const& verificationCallback) {
     STORM_LOG_ASSERT(lowerX->size() == upperX->size(), "Dimension missmatch.");
 
     // As we will shuffle pointers around, let's store the original positions here.
@@ -313,6 +442,12 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
         (storm::utility::one<ValueType>() + storm::utility::convertNumber<ValueType>(env.solver().ovi().getUpperBoundGuessingFactor()) * precision);
     // Initial precision for the value iteration calls
     ValueType iterationPrecision = precision;
+    // Whether the fused iterations of both bounds are distributed among multiple threads
+#ifdef STORM_HAVE_INTELTBB
+    bool const parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+    bool const parallel = false;
+#endif
 
     SolverStatus status = SolverStatus::InProgress;
 
@@ -343,9 +478,27 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
             ++currentVerificationIterations;
             // Perform value iteration stepwise for lower bound and guessed upper bound
 
-            // Upper bound iteration
-            auto upperBoundIterResult = dir ? iterationHelper.iterateUpper(dir.get(), *upperX, b, !noTerminationGuarantee)
-                                            : iterationHelper.iterateUpper(*upperX, b, !noTerminationGuarantee);
+            // Check whether we tried this guess for too long
+            ValueType scaledIterationCount = storm::utility::convertNumber<ValueType>(currentVerificationIterations) *
+                                             storm::utility::convertNumber<ValueType>(env.solver().ovi().getMaxVerificationIterationFactor());
+            bool const guessTriedTooLong = scaledIterationCount * iterationPrecision >= storm::utility::one<ValueType>();
+
+            // If we already know that the lower bound needs to be iterated as well, both bounds are updated in a single pass over the matrix.
+            boost::optional<ValueType> lowerBoundDiff;
+            typename oviinternal::IterationHelper<ValueType>::IterateResult upperBoundIterResult;
+            if (guessTriedTooLong || intervalIterationNeeded || currentVerificationIterations > upperBoundOnlyIterations) {
+                ValueType diff;
+                upperBoundIterResult = dir ? iterationHelper.iterateBoth(dir.get(), *lowerX, *upperX, b, !noTerminationGuarantee, relative, diff, parallel)
+                                           : iterationHelper.iterateBoth(*lowerX, *upperX, b, !noTerminationGuarantee, relative, diff, parallel);
+                lowerBoundDiff = std::move(diff);
+            } else {
+                // Upper bound iteration
+                upperBoundIterResult = dir ? iterationHelper.iterateUpper(dir.get(), *upperX, b, !noTerminationGuarantee)
+                                           : iterationHelper.iterateUpper(*upperX, b, !noTerminationGuarantee);
+            }
+            if (verificationCallback) {
+                verificationCallback(overallIterations, *lowerX, *upperX);
+            }
 
             if (upperBoundIterResult == oviinternal::IterationHelper<ValueType>::IterateResult::AlwaysHigherOrEqual) {
                 // All values moved up (and did not stay the same)
@@ -383,18 +536,18 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
                 //    break;
             }
 
-            // Check whether we tried this guess for too long
-            ValueType scaledIterationCount = storm::utility::convertNumber<ValueType>(currentVerificationIterations) *
-                                             storm::utility::convertNumber<ValueType>(env.solver().ovi().getMaxVerificationIterationFactor());
-            if (!intervalIterationNeeded && scaledIterationCount * iterationPrecision >= storm::utility::one<ValueType>()) {
+            if (!intervalIterationNeeded && guessTriedTooLong) {
                 cancelGuess = true;
                 // In this case we will make one more iteration on the lower bound (mainly to obtain a new iterationPrecision)
             }
 
-            // Lower bound iteration (only if needed)
+            // Lower bound iteration (only if needed and not already done together with the upper bound)
             if (cancelGuess || intervalIterationNeeded || currentVerificationIterations > upperBoundOnlyIterations) {
-                auto diff = dir ? iterationHelper.singleIterationWithDiff(dir.get(), *lowerX, b, relative)
-                                : iterationHelper.singleIterationWithDiff(*lowerX, b, relative);
+                if (!lowerBoundDiff) {
+                    lowerBoundDiff = dir ? iterationHelper.singleIterationWithDiff(dir.get(), *lowerX, b, relative)
+                                         : iterationHelper.singleIterationWithDiff(*lowerX, b, relative);
+                }
+                ValueType const& diff = lowerBoundDiff.get();
 
                 // Check whether the upper and lower bounds have crossed, i.e., the upper bound is smaller than the lower bound.
                 bool valuesCrossed = false;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 #include <vector>
 
 #include "storm/storage/SparseMatrix.h"
@@ -47,6 +48,14 @@ class IterationHelper {
                                bool takeMinOfOldAndNew, boost::optional<storage::BitVector> const& schedulerFixedForRowgroup = boost::none,
                                boost::optional<std::vector<uint_fast64_t>> const& scheduler = boost::none);
 
+    /// Performs a single iteration for the lower and the upper bound in the same pass over the matrix. Returns the result for the upper bound (as
+    /// iterateUpper) and stores the maximal difference of the lower bound iteration (as singleIterationWithDiff) in lowerDiff. If parallel is set,
+    /// the row groups are distributed among multiple threads and all new values are computed from the old ones (instead of Gauss-Seidel style).
+    IterateResult iterateBoth(std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX, std::vector<ValueType> const& b, bool takeMinOfOldAndNew,
+                              bool computeRelativeDiff, ValueType& lowerDiff, bool parallel);
+    IterateResult iterateBoth(storm::solver::OptimizationDirection const& dir, std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX,
+                              std::vector<ValueType> const& b, bool takeMinOfOldAndNew, bool computeRelativeDiff, ValueType& lowerDiff, bool parallel);
+
    private:
     template<bool HasRowGroups, storm::solver::OptimizationDirection Dir>
     ValueType singleIterationWithDiffInternal(std::vector<ValueType>& x, std::vector<ValueType> const& b, bool computeRelativeDiff,
@@ -60,14 +69,26 @@ class IterationHelper {
     IterateResult iterateUpperInternal(std::vector<ValueType>& x, std::vector<ValueType> const& b, bool takeMinOfOldAndNew,
                                        boost::optional<storage::BitVector> const& schedulerFixedForRowgroup = boost::none,
                                        boost::optional<std::vector<uint_fast64_t>> const& scheduler = boost::none);
+    template<bool HasRowGroups, storm::solver::OptimizationDirection Dir>
+    IterateResult iterateBothInternal(std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX, std::vector<ValueType> const& b,
+                                      bool takeMinOfOldAndNew, bool computeRelativeDiff, ValueType& lowerDiff, bool parallel);
     ValueType multiplyRow(IndexType const& rowIndex, ValueType const& bi, std::vector<ValueType> const& x);
     template<storm::solver::OptimizationDirection Dir>
     ValueType multiplyRowGroup(IndexType const& rowGroupIndex, std::vector<ValueType> const& b, std::vector<ValueType> const& x);
+    void multiplyRow2(IndexType const& rowIndex, ValueType const& bi, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                      ValueType& val2);
+    template<storm::solver::OptimizationDirection Dir>
+    void multiplyRowGroup2(IndexType const& rowGroupIndex, std::vector<ValueType> const& b, std::vector<ValueType> const& x1, ValueType& val1,
+                           std::vector<ValueType> const& x2, ValueType& val2);
 
     std::vector<ValueType> matrixValues;
     std::vector<IndexType> matrixColumns;
     std::vector<IndexType> rowIndications;
     std::vector<uint64_t> const* rowGroupIndices;
+
+    // Receive the new values of parallel iterations.
+    std::vector<ValueType> auxLowerX;
+    std::vector<ValueType> auxUpperX;
 };
 }  // namespace oviinternal
 
@@ -78,6 +99,8 @@ class IterationHelper {
 template<typename ValueType>
 class OptimisticValueIterationHelper {
    public:
+    typedef std::function<void(uint64_t, std::vector<ValueType> const&, std::vector<ValueType> const&)> VerificationCallback;
+
     OptimisticValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
 
     /*!
@@ -87,6 +110,8 @@ class OptimisticValueIterationHelper {
      * @param b the values added to each matrix row (the b in A*x+b)
      * @param dir The optimization direction
      * @param relevantValues If given, we only check the precision at the states with the given indices.
+     * @param verificationCallback If given, this is called with the overall number of iterations and the current lower and upper values after each
+     * verification iteration.
      * @return The status upon termination as well as the number of iterations Also, the maximum (relative/absolute) difference between lowerX and upperX will
      * be 2*epsilon with the provided precision parameters.
      */
@@ -95,7 +120,8 @@ class OptimisticValueIterationHelper {
                                                      boost::optional<storm::solver::OptimizationDirection> dir,
                                                      boost::optional<storm::storage::BitVector> const& relevantValues,
                                                      boost::optional<storage::BitVector> const& schedulerFixedForRowgroup = boost::none,
-                                                     boost::optional<std::vector<uint_fast64_t>> const& scheduler = boost::none);
+                                                     boost::optional<std::vector<uint_fast64_t>> const& scheduler = boost::none,
+                                                     VerificationCallback const& verificationCallback = {});
 
    private:
     oviinternal::IterationHelper<ValueType> iterationHelper;
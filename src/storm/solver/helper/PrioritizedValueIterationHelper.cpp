@@ -0,0 +1,114 @@
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace pvidetail {
+/*!
+ * Orders row groups by the bounds on their residuals (relative to their current values if requested).
+ */
+template<typename ValueType>
+struct ResidualLess {
+    ValueType priority(uint64_t group) const {
+        if (relative && !storm::utility::isZero((*values)[group])) {
+            return (*residualBounds)[group] / storm::utility::abs((*values)[group]);
+        }
+        return (*residualBounds)[group];
+    }
+
+    bool operator()(uint64_t const& a, uint64_t const& b) const {
+        return priority(a) < priority(b);
+    }
+
+    std::vector<ValueType> const* residualBounds;
+    std::vector<ValueType> const* values;
+    bool relative;
+};
+}  // namespace pvidetail
+
+template<typename ValueType>
+PrioritizedValueIterationHelper<ValueType>::PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : matrix(matrix), backwardTransitions(matrix.transpose(true)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::pair<uint64_t, SolverStatus> PrioritizedValueIterationHelper<ValueType>::solve(OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                                    std::vector<ValueType> const& b, ValueType const& precision,
+                                                                                    bool relative, UpdateStatusCallback const& updateStatus) const {
+    STORM_LOG_ASSERT(x.size() == matrix.getRowGroupCount(), "Unexpected size of the value vector.");
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    bool const minimize = storm::solver::minimize(dir);
+    uint64_t const groupCount = x.size();
+
+    // Initially, the residuals are known exactly.
+    std::vector<ValueType> residualBounds(groupCount);
+    matrix.multiplyAndReduce(dir, rowGroupIndices, x, &b, residualBounds, nullptr);
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        residualBounds[group] = storm::utility::abs<ValueType>(residualBounds[group] - x[group]);
+    }
+    pvidetail::ResidualLess<ValueType> residualLess{&residualBounds, &x, relative};
+    storm::storage::ConsecutiveUint64DynamicPriorityQueue<pvidetail::ResidualLess<ValueType>> queue(groupCount, residualLess);
+
+    uint64_t updates = 0;
+    auto getIterations = [&updates, &groupCount]() { return (updates + groupCount - 1) / std::max<uint64_t>(groupCount, 1); };
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        if (queue.empty() || residualLess.priority(queue.top()) <= precision) {
+            status = updateStatus(SolverStatus::Converged, x, getIterations());
+            break;
+        }
+
+        // Update the row group with the largest residual.
+        uint64_t const group = queue.popTop();
+        residualBounds[group] = storm::utility::zero<ValueType>();
+        uint64_t const rowEnd = rowGroupIndices[group + 1];
+        if (rowGroupIndices[group] != rowEnd) {
+            ValueType newValue = b[rowGroupIndices[group]] + matrix.multiplyRowWithVector(rowGroupIndices[group], x);
+            for (uint64_t row = rowGroupIndices[group] + 1; row < rowEnd; ++row) {
+                ValueType rowValue = b[row] + matrix.multiplyRowWithVector(row, x);
+                if (minimize ? rowValue < newValue : rowValue > newValue) {
+                    newValue = std::move(rowValue);
+                }
+            }
+            ValueType const delta = storm::utility::abs<ValueType>(newValue - x[group]);
+            x[group] = std::move(newValue);
+
+            // Increase the residual bounds of the predecessors. The entries of one predecessor are consecutive, one for each of its rows.
+            if (!storm::utility::isZero(delta)) {
+                auto const predecessors = backwardTransitions.getRow(group);
+                for (auto entryIt = predecessors.begin(); entryIt != predecessors.end();) {
+                    uint64_t const predecessor = entryIt->getColumn();
+                    ValueType probability = entryIt->getValue();
+                    for (++entryIt; entryIt != predecessors.end() && entryIt->getColumn() == predecessor; ++entryIt) {
+                        probability = storm::utility::max<ValueType>(probability, entryIt->getValue());
+                    }
+                    residualBounds[predecessor] += probability * delta;
+                    if (queue.contains(predecessor)) {
+                        queue.increase(predecessor);
+                    } else {
+                        queue.push(predecessor);
+                    }
+                }
+            }
+        }
+
+        if (++updates % groupCount == 0) {
+            status = updateStatus(status, x, getIterations());
+        }
+    }
+    return {getIterations(), status};
+}
+
+template class PrioritizedValueIterationHelper<double>;
+template class PrioritizedValueIterationHelper<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
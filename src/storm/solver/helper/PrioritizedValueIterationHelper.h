@@ -0,0 +1,63 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs prioritized (Gauss-Seidel) value iteration on a min/max equation system x = min/max (A*x + b).
+ *
+ * Instead of sweeping over all row groups, the row group with the largest Bellman residual is updated next. For each row group, an upper bound
+ * on its residual is maintained: it is exact initially, reset to zero when the row group is updated and increased by P(p,s)*|delta| for every
+ * predecessor p whenever the value of s changes by delta. Predecessors are found via the backward transitions. The iteration stops as soon as
+ * all bounds are below the precision, which implies the convergence criterion of standard value iteration. As the iteration operator is
+ * monotone, the updates preserve the guarantee that the current values are below (above) the solution if they were before.
+ */
+template<typename ValueType>
+class PrioritizedValueIterationHelper {
+   public:
+    /*!
+     * Called with the current status, the current values and the number of iterations performed so far. Returns the status with which to
+     * proceed (to account for termination conditions and the maximal number of iterations).
+     */
+    typedef std::function<SolverStatus(SolverStatus, std::vector<ValueType> const&, uint64_t)> UpdateStatusCallback;
+
+    /*!
+     * Prepares prioritized value iteration on the given matrix.
+     *
+     * @param matrix The matrix A of the equation system.
+     */
+    PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Iterates until the values converged or the given callback stops the iteration.
+     *
+     * @param dir The optimization direction.
+     * @param x The initial values. Will contain the final values when the method returns.
+     * @param b The offset vector.
+     * @param precision The precision used to detect convergence.
+     * @param relative Whether the residuals are considered relative to the current values. Row groups with value zero always use the absolute
+     * residual.
+     * @param updateStatus The callback that is invoked after every x.size() updates and once the iteration converged.
+     * @return The number of iterations and the final status. An iteration corresponds to x.size() updates of single row groups.
+     */
+    std::pair<uint64_t, SolverStatus> solve(OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                            ValueType const& precision, bool relative, UpdateStatusCallback const& updateStatus) const;
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+
+    // The transposed matrix in which the rows of each row group are joined.
+    storm::storage::SparseMatrix<ValueType> backwardTransitions;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
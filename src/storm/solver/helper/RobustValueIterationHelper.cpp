@@ -0,0 +1,61 @@
+#include "storm/solver/helper/RobustValueIterationHelper.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+RobustValueIterationHelper<ValueType>::RobustValueIterationHelper(storm::storage::SparseMatrix<storm::Interval> const& matrix) : multiplier(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::pair<uint64_t, SolverStatus> RobustValueIterationHelper<ValueType>::solve(Environment const& env, OptimizationDirection dir,
+                                                                               OptimizationDirection natureDir, std::vector<ValueType>& x,
+                                                                               std::vector<ValueType> const& b, std::vector<uint64_t>* choices) const {
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+
+    std::vector<ValueType> newX(x.size());
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        multiplier.multiplyAndReduce(env, dir, natureDir, x, &b, newX);
+        ++iterations;
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(x, newX, precision, relative)) {
+            status = SolverStatus::Converged;
+        } else if (iterations >= maxIter) {
+            status = SolverStatus::MaximalIterationsExceeded;
+        } else if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+        std::swap(x, newX);
+    }
+    STORM_LOG_INFO("Robust value iteration " << (status == SolverStatus::Converged ? "converged" : "did not converge") << " after " << iterations
+                                             << " iterations (" << multiplier.getNumberOfSorts() << " rows sorted).");
+
+    if (choices) {
+        choices->resize(multiplier.getRowGroupCount());
+        multiplier.multiplyAndReduce(env, dir, natureDir, x, &b, newX, choices);
+    }
+    return {iterations, status};
+}
+
+template<typename ValueType>
+RobustMultiplier<ValueType> const& RobustValueIterationHelper<ValueType>::getMultiplier() const {
+    return multiplier;
+}
+
+template class RobustValueIterationHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/multiplier/RobustMultiplier.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs robust value iteration on an interval MDP (or an interval DTMC, i.e. a matrix with trivial row grouping), i.e., it solves the
+ * equation system x = min/max_choices min/max_nature (A*x + b), where nature picks a distribution within the probability intervals of each row.
+ * The iteration stops with respect to the precision, the termination criterion and the maximal number of iterations of the min-max solver
+ * environment.
+ */
+template<typename ValueType>
+class RobustValueIterationHelper {
+   public:
+    RobustValueIterationHelper(storm::storage::SparseMatrix<storm::Interval> const& matrix);
+
+    /*!
+     * Iterates until the values converged or the maximal number of iterations is reached.
+     *
+     * @param dir The optimization direction of the choices. Irrelevant if the row grouping is trivial.
+     * @param natureDir The direction in which nature resolves the uncertainty, e.g. the opposite of dir to obtain robust (pessimistic) values.
+     * @param x The initial values. Will contain the final values when the method returns.
+     * @param b The offset vector.
+     * @param choices If given, the optimal choice of each row group w.r.t. the final values is stored in this vector.
+     * @return The number of iterations and the final status.
+     */
+    std::pair<uint64_t, SolverStatus> solve(Environment const& env, OptimizationDirection dir, OptimizationDirection natureDir, std::vector<ValueType>& x,
+                                            std::vector<ValueType> const& b, std::vector<uint64_t>* choices = nullptr) const;
+
+    RobustMultiplier<ValueType> const& getMultiplier() const;
+
+   private:
+    RobustMultiplier<ValueType> multiplier;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
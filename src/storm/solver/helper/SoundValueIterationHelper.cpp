@@ -99,6 +99,22 @@ void SoundValueIterationHelper<ValueType>::setUpperBound(ValueType const& value)
     upperBound = value;
 }
 
+template<typename ValueType>
+boost::optional<ValueType> SoundValueIterationHelper<ValueType>::getLowerBound() const {
+    if (hasLowerBound) {
+        return lowerBound;
+    }
+    return boost::none;
+}
+
+template<typename ValueType>
+boost::optional<ValueType> SoundValueIterationHelper<ValueType>::getUpperBound() const {
+    if (hasUpperBound) {
+        return upperBound;
+    }
+    return boost::none;
+}
+
 template<typename ValueType>
 void SoundValueIterationHelper<ValueType>::multiplyRow(IndexType const& rowIndex, ValueType const& bi, ValueType& xi, ValueType& yi) {
     assert(rowIndex < numRows);
@@ -41,6 +41,12 @@ class SoundValueIterationHelper {
     void setLowerBound(ValueType const& value);
     void setUpperBound(ValueType const& value);
 
+    /*!
+     * Retrieves the currently known lower / upper bound (over all states), if one was established.
+     */
+    boost::optional<ValueType> getLowerBound() const;
+    boost::optional<ValueType> getUpperBound() const;
+
     void setSolutionVector();
 
     /*!
@@ -0,0 +1,124 @@
+#include "storm/solver/multiplier/CudaMultiplier.h"
+
+#include "storm-config.h"
+
+#include <limits>
+#include <type_traits>
+
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/utility/macros.h"
+
+#ifdef STORM_HAVE_CUDA
+#include "cudaForStorm.h"
+#endif
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType>
+CudaMultiplier<ValueType>::CudaMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : NativeMultiplier<ValueType>(matrix), deviceMatrix(nullptr), deviceMatrixUnavailable(!isCudaSupported()) {
+    STORM_LOG_WARN_COND(isCudaSupported(), "The CUDA multiplier is not available for this value type or storm is compiled without CUDA support. "
+                                           "Falling back to the native multiplier.");
+}
+
+template<typename ValueType>
+CudaMultiplier<ValueType>::~CudaMultiplier() {
+    clearCache();
+}
+
+template<typename ValueType>
+bool CudaMultiplier<ValueType>::isCudaSupported() {
+#ifdef STORM_HAVE_CUDA
+    return std::is_same<ValueType, double>::value;
+#else
+    return false;
+#endif
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::clearCache() const {
+#ifdef STORM_HAVE_CUDA
+    deviceValueIteration_destroyMatrix(deviceMatrix);
+#endif
+    deviceMatrix = nullptr;
+    deviceMatrixUnavailable = !isCudaSupported();
+    NativeMultiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+bool CudaMultiplier<ValueType>::createDeviceMatrix() const {
+#ifdef STORM_HAVE_CUDA
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (!deviceMatrix && !deviceMatrixUnavailable) {
+            if (!storm::storage::SoaSparseMatrix<double, uint32_t>::canRepresentColumns(this->matrix)) {
+                STORM_LOG_WARN("The columns of the matrix do not fit into 32-bit indices. Falling back to the native multiplier.");
+                deviceMatrixUnavailable = true;
+                return false;
+            }
+
+            // The structure-of-arrays copy is only needed while uploading the matrix.
+            storm::storage::SoaSparseMatrix<double, uint32_t> soaMatrix(this->matrix);
+            auto const& rowGroupIndices = this->matrix.getRowGroupIndices();
+            deviceMatrix = deviceValueIteration_createMatrix(this->matrix.getRowCount(), this->matrix.getColumnCount(), this->matrix.getRowGroupCount(),
+                                                             this->matrix.getEntryCount(), soaMatrix.getRowIndications().data(), soaMatrix.getColumns().data(),
+                                                             soaMatrix.getValues().data(), rowGroupIndices.data());
+            STORM_LOG_WARN_COND(deviceMatrix != nullptr, "Could not upload the matrix to the GPU. Falling back to the native multiplier.");
+            deviceMatrixUnavailable = deviceMatrix == nullptr;
+        }
+        return deviceMatrix != nullptr;
+    }
+#endif
+    return false;
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+#ifdef STORM_HAVE_CUDA
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (createDeviceMatrix()) {
+            // The vectors are copied to the device before the result is copied back, so x and result may coincide.
+            STORM_LOG_THROW(deviceValueIteration_multiply(deviceMatrix, x.data(), b ? b->data() : nullptr, result.data()),
+                            storm::exceptions::InvalidStateException, "An error occurred in the CUDA plugin.");
+            return;
+        }
+    }
+#endif
+    NativeMultiplier<ValueType>::multiply(env, x, b, result);
+}
+
+template<typename ValueType>
+void CudaMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+#ifdef STORM_HAVE_CUDA
+    if constexpr (std::is_same<ValueType, double>::value) {
+        static_assert(sizeof(uint_fast64_t) == sizeof(uint64_t), "The CUDA plugin expects 64-bit choice indices.");
+        // The device matrix knows only the row grouping of the matrix.
+        bool const matchingRowGroups = &rowGroupIndices == &this->matrix.getRowGroupIndices() || rowGroupIndices == this->matrix.getRowGroupIndices();
+        if (matchingRowGroups && createDeviceMatrix()) {
+            STORM_LOG_THROW(deviceValueIteration_multiplyAndReduce(deviceMatrix, minimize(dir), x.data(), b ? b->data() : nullptr, result.data(),
+                                                                   choices ? reinterpret_cast<uint64_t*>(choices->data()) : nullptr),
+                            storm::exceptions::InvalidStateException, "An error occurred in the CUDA plugin.");
+            return;
+        }
+    }
+#endif
+    NativeMultiplier<ValueType>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+}
+
+template class CudaMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class CudaMultiplier<storm::RationalNumber>;
+template class CudaMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
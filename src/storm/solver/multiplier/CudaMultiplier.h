@@ -0,0 +1,52 @@
+#pragma once
+
+#include "storm/solver/multiplier/NativeMultiplier.h"
+
+// The matrix as it is stored in device memory (declared by the CUDA plugin).
+struct DeviceSparseMatrix;
+
+namespace storm {
+namespace solver {
+
+/*!
+ * A multiplier that performs the multiplications on a GPU via the CUDA plugin. The matrix is uploaded once (with 32-bit column indices and
+ * separate arrays for columns and values) and stays resident in device memory until the cache is cleared, such that only the vectors are
+ * transferred for each multiplication. Gauss-Seidel style multiplications are inherently sequential and are therefore performed by the native
+ * multiplier. The same holds for all multiplications if storm is compiled without CUDA support, the value type is not double, the columns do
+ * not fit into 32-bit indices or the matrix could not be uploaded to the device.
+ */
+template<typename ValueType>
+class CudaMultiplier : public NativeMultiplier<ValueType> {
+   public:
+    CudaMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~CudaMultiplier();
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void clearCache() const override;
+
+    /*!
+     * Retrieves whether storm is compiled with CUDA support and the value type is supported by the device kernels.
+     */
+    static bool isCudaSupported();
+
+   private:
+    /*!
+     * Uploads the matrix to the device if this has not been tried before.
+     *
+     * @return True iff the matrix is resident in device memory.
+     */
+    bool createDeviceMatrix() const;
+
+    // The matrix in device memory (if it has been uploaded successfully).
+    mutable DeviceSparseMatrix* deviceMatrix;
+
+    // Set if uploading the matrix failed, in which case the native multiplier is used.
+    mutable bool deviceMatrixUnavailable;
+};
+
+}  // namespace solver
+}  // namespace storm
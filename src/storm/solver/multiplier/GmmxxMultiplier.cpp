@@ -46,6 +46,7 @@ template<typename ValueType>
 void GmmxxMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
                                           std::vector<ValueType>& result) const {
     initialize();
+    this->countMultiplication();
     std::vector<ValueType>* target = &result;
     if (&x == &result) {
         if (this->cachedVector) {
@@ -68,6 +69,7 @@ void GmmxxMultiplier<ValueType>::multiply(Environment const& env, std::vector<Va
 template<typename ValueType>
 void GmmxxMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
     initialize();
+    this->countMultiplication();
     STORM_LOG_ASSERT(gmmMatrix.nr == gmmMatrix.nc, "Expecting square matrix.");
     if (backwards) {
         if (b) {
@@ -89,6 +91,7 @@ void GmmxxMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Optim
                                                    std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                    std::vector<uint_fast64_t>* choices) const {
     initialize();
+    this->countMultiplication();
     std::vector<ValueType>* target = &result;
     if (&x == &result) {
         if (this->cachedVector) {
@@ -113,6 +116,7 @@ void GmmxxMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const&
                                                               std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
                                                               std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
     initialize();
+    this->countMultiplication();
     multAddReduceHelper(dir, rowGroupIndices, x, b, x, choices, backwards);
 }
 
@@ -0,0 +1,117 @@
+#include "storm/solver/multiplier/MixedPrecisionMultiplier.h"
+
+#include "storm-config.h"
+
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType>
+MixedPrecisionMultiplier<ValueType>::MixedPrecisionMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : NativeMultiplier<ValueType>(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+MixedPrecisionMultiplier<ValueType>::~MixedPrecisionMultiplier() = default;
+
+template<typename ValueType>
+void MixedPrecisionMultiplier<ValueType>::clearCache() const {
+    compactMatrix.reset();
+    compactMatrixWithCompactColumns.reset();
+    NativeMultiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+template<typename Operation>
+void MixedPrecisionMultiplier<ValueType>::applyToCompactMatrix(Operation const& operation) const {
+    if (!compactMatrix && !compactMatrixWithCompactColumns) {
+        if (storm::storage::SoaSparseMatrix<ValueType, uint32_t, StorageValueType>::canRepresentColumns(this->matrix)) {
+            compactMatrixWithCompactColumns = std::make_unique<storm::storage::SoaSparseMatrix<ValueType, uint32_t, StorageValueType>>(this->matrix);
+        } else {
+            compactMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType, uint64_t, StorageValueType>>(this->matrix);
+        }
+    }
+    if (compactMatrixWithCompactColumns) {
+        operation(*compactMatrixWithCompactColumns);
+    } else {
+        operation(*compactMatrix);
+    }
+}
+
+template<typename ValueType>
+void MixedPrecisionMultiplier<ValueType>::multiply(Environment const&, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                   std::vector<ValueType>& result) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    applyToCompactMatrix([&](auto const& compact) { compact.multiplyWithVector(x, *target, b); });
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void MixedPrecisionMultiplier<ValueType>::multiplyGaussSeidel(Environment const&, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                                              bool backwards) const {
+    applyToCompactMatrix([&](auto const& compact) {
+        if (backwards) {
+            compact.multiplyWithVectorBackward(x, x, b);
+        } else {
+            compact.multiplyWithVectorForward(x, x, b);
+        }
+    });
+}
+
+template<typename ValueType>
+void MixedPrecisionMultiplier<ValueType>::multiplyAndReduce(Environment const&, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                            std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                            std::vector<uint_fast64_t>* choices) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    applyToCompactMatrix([&](auto const& compact) { compact.multiplyAndReduceForward(dir, rowGroupIndices, x, b, *target, choices); });
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void MixedPrecisionMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const&, OptimizationDirection const& dir,
+                                                                       std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    applyToCompactMatrix([&](auto const& compact) {
+        if (backwards) {
+            compact.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+        } else {
+            compact.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+        }
+    });
+}
+
+template class MixedPrecisionMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class MixedPrecisionMultiplier<storm::RationalNumber>;
+template class MixedPrecisionMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "storm/solver/multiplier/NativeMultiplier.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+class SoaSparseMatrix;
+}  // namespace storage
+
+namespace solver {
+
+/*!
+ * A multiplier that operates on a structure-of-arrays copy of the matrix whose values are stored in single precision
+ * (if the value type is double), whereas the products are accumulated in the value type. This roughly halves the
+ * memory traffic per matrix entry at the cost of a perturbation of the matrix values in the order of 1e-7, which is why
+ * the results are typically refined using a multiplier operating on the original matrix afterwards.
+ * For all other value types, the values are stored using the value type.
+ */
+template<typename ValueType>
+class MixedPrecisionMultiplier : public NativeMultiplier<ValueType> {
+   public:
+    typedef typename std::conditional<std::is_same<ValueType, double>::value, float, ValueType>::type StorageValueType;
+
+    MixedPrecisionMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~MixedPrecisionMultiplier();
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void clearCache() const override;
+
+   private:
+    /*!
+     * Applies the given operation to the compact copy of the matrix, which is created if it does not exist yet.
+     */
+    template<typename Operation>
+    void applyToCompactMatrix(Operation const& operation) const;
+
+    // The compact copy of the matrix. At most one of the two is set, depending on whether the columns fit into 32-bit indices.
+    mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType, uint64_t, StorageValueType>> compactMatrix;
+    mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType, uint32_t, StorageValueType>> compactMatrixWithCompactColumns;
+};
+
+}  // namespace solver
+}  // namespace storm
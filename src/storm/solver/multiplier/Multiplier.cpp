@@ -10,11 +10,16 @@
 #include "NativeMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/multiplier/CudaMultiplier.h"
 #include "storm/solver/multiplier/GmmxxMultiplier.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
@@ -29,18 +34,78 @@ void Multiplier<ValueType>::clearCache() const {
     cachedVector.reset();
 }
 
+template<typename ValueType>
+void Multiplier<ValueType>::countMultiplication() const {
+    static storm::utility::Instrumentation::Counter& multiplicationCounter = storm::utility::Instrumentation::instance().getCounter("solver.multiplications");
+    storm::utility::incrementCounter(multiplicationCounter);
+}
+
 template<typename ValueType>
 void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x,
                                               std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
     multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
 }
 
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x,
+                                                                 std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision,
+                                                                 bool relative) const {
+    return multiplyAndReduceAndCheckConvergence(env, dir, this->matrix.getRowGroupIndices(), x, b, result, precision, relative);
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir,
+                                                                 std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                                                 std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision,
+                                                                 bool relative) const {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else {
+        STORM_LOG_ASSERT(&x != &result, "Vectors must not be aliased.");
+        multiplyAndReduce(env, dir, rowGroupIndices, x, b, result);
+        return storm::utility::vector::equalModuloPrecision<ValueType>(x, result, precision, relative);
+    }
+}
+
 template<typename ValueType>
 void Multiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
                                                          std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
     multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
 }
 
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyBatch(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                          std::vector<ValueType>& result, uint64_t batchSize) const {
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(result.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(result.size());
+        }
+        this->matrix.multiplyWithDenseMatrix(x, batchSize, *this->cachedVector, b);
+        std::swap(result, *this->cachedVector);
+    } else {
+        this->matrix.multiplyWithDenseMatrix(x, batchSize, result, b);
+    }
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                   uint64_t batchSize) const {
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(result.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(result.size());
+        }
+        this->matrix.multiplyAndReduceWithDenseMatrix(dir, rowGroupIndices, x, batchSize, b, *this->cachedVector);
+        std::swap(result, *this->cachedVector);
+    } else {
+        this->matrix.multiplyAndReduceWithDenseMatrix(dir, rowGroupIndices, x, batchSize, b, result);
+    }
+}
+
 template<typename ValueType>
 void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
     storm::utility::ProgressMeasurement progress("multiplications");
@@ -102,6 +167,10 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
             return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Simd:
+            return std::make_unique<SimdMultiplier<ValueType>>(matrix);
+        case MultiplierType::Cuda:
+            return std::make_unique<CudaMultiplier<ValueType>>(matrix);
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
@@ -72,6 +72,29 @@ class Multiplier {
                                    std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                    std::vector<uint_fast64_t>* choices = nullptr) const = 0;
 
+    /*!
+     * Performs a matrix-vector multiplication x' = A*x + b, minimizes/maximizes over the row groups and checks whether x' is equal to x
+     * modulo the given precision (in the sense of storm::utility::vector::equalModuloPrecision). Implementations may perform the
+     * convergence check in the same pass as the multiplication, such that the vectors are only traversed once.
+     *
+     * @param dir The direction for the reduction step.
+     * @param rowGroupIndices A vector storing the row groups over which to reduce.
+     * @param x The input vector with which to multiply the matrix. Its length must be equal to the number of columns of A
+     * and to the number of row groups.
+     * @param b If non-null, this vector is added after the multiplication. If given, its length must be equal
+     * to the number of rows of A.
+     * @param result The target vector into which to write the multiplication result. Its length must be equal
+     * to the number of row groups. Must not be the same as the x vector.
+     * @param precision The precision up to which the vectors are considered equal.
+     * @param relative If set, the difference between the vectors is computed relative to the value of x.
+     * @return True iff x' and x are equal modulo the precision.
+     */
+    bool multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x,
+                                              std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision, bool relative) const;
+    virtual bool multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                      std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                      ValueType const& precision, bool relative) const;
+
     /*!
      * Performs a matrix-vector multiplication in gauss-seidel style and then minimizes/maximizes over the row groups
      * so that the resulting vector has the size of number of row groups of A.
@@ -93,6 +116,29 @@ class Multiplier {
                                               std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
                                               bool backwards = true) const = 0;
 
+    /*!
+     * Performs the multiplication X' = A*X + B for several vectors at once, where X consists of the given number of column vectors.
+     * The dense matrices store their rows consecutively, i.e., the value of the j-th vector at position i resides at index
+     * i * batchSize + j. As every matrix entry is used for all vectors, the matrix is only traversed once.
+     *
+     * @param x The input vectors. Its length must be equal to batchSize times the number of columns of A.
+     * @param b If non-null, these vectors are added after the multiplication. If given, its length must be equal to batchSize
+     * times the number of rows of A.
+     * @param result The target into which to write the multiplication result. Its length must be equal to batchSize times the number
+     * of rows of A. Can be the same as x.
+     * @param batchSize The number of vectors.
+     */
+    virtual void multiplyBatch(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                               uint64_t batchSize) const;
+
+    /*!
+     * Same as multiplyBatch, but minimizes/maximizes the result of each vector over the row groups of A so that the
+     * result has batchSize times the number of row groups of A entries.
+     */
+    virtual void multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                        std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                        uint64_t batchSize) const;
+
     /*!
      * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
      * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -142,6 +188,11 @@ class Multiplier {
                               ValueType& val2) const;
 
    protected:
+    /*!
+     * Records a multiplication with the matrix in the instrumentation counters.
+     */
+    void countMultiplication() const;
+
     mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
     storm::storage::SparseMatrix<ValueType> const& matrix;
 };
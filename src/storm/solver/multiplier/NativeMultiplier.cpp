@@ -2,26 +2,115 @@
 
 #include "storm-config.h"
 
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/storage/SoaSparseMatrix.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace detail {
+/*!
+ * Multiplies the rows of the row groups groupBegin, ..., groupEnd - 1 with x, reduces the results and writes them to the result vector. In
+ * the same pass, the new values are compared to the old ones in x such that a separate convergence check becomes unnecessary.
+ *
+ * @return True iff the new values of the considered row groups are equal to the old ones modulo the given precision.
+ */
+template<typename ValueType, typename Compare>
+bool multiplyAndReduceRowGroupsAndCheckConvergence(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& rowGroupIndices,
+                                                   uint64_t groupBegin, uint64_t groupEnd, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                   std::vector<ValueType>& result, ValueType const& precision, bool relative) {
+    Compare compare;
+    // The summands are added in the same order as in SparseMatrix::multiplyAndReduceForward such that the results coincide.
+    auto getRowValue = [&](uint64_t row) {
+        ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+        for (auto const& entry : matrix.getRow(row)) {
+            value += entry.getValue() * x[entry.getColumn()];
+        }
+        return value;
+    };
+
+    bool converged = true;
+    for (uint64_t group = groupBegin; group < groupEnd; ++group) {
+        uint64_t row = rowGroupIndices[group];
+        uint64_t const rowEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (row < rowEnd) {
+            ValueType currentValue = getRowValue(row);
+            for (++row; row < rowEnd; ++row) {
+                ValueType newValue = getRowValue(row);
+                if (compare(newValue, currentValue)) {
+                    currentValue = std::move(newValue);
+                }
+            }
+            result[group] = std::move(currentValue);
+        }
+
+        // Once a difference exceeds the precision, the remaining values need not be compared.
+        if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(x[group], result[group], precision, relative)) {
+            converged = false;
+        }
+    }
+    return converged;
+}
+}  // namespace detail
+
 template<typename ValueType>
 NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
     // Intentionally left empty.
 }
 
+template<typename ValueType>
+NativeMultiplier<ValueType>::~NativeMultiplier() = default;
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::clearCache() const {
+    soaMatrix.reset();
+    compactSoaMatrix.reset();
+    coloredRowGroupIndices.clear();
+    rowGroupsByColor.clear();
+    colorIndications.clear();
+    Multiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+template<typename Operation>
+bool NativeMultiplier<ValueType>::applyToSoaMatrix(Environment const& env, Operation const& operation) const {
+    if (!env.solver().multiplier().isSoaLayoutSet()) {
+        return false;
+    }
+    if (!soaMatrix && !compactSoaMatrix) {
+        if (storm::storage::SoaSparseMatrix<ValueType, uint32_t>::canRepresentColumns(this->matrix)) {
+            compactSoaMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType, uint32_t>>(this->matrix);
+        } else {
+            soaMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType, uint64_t>>(this->matrix);
+        }
+    }
+    if (compactSoaMatrix) {
+        operation(*compactSoaMatrix);
+    } else {
+        operation(*soaMatrix);
+    }
+    return true;
+}
+
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
@@ -34,6 +123,7 @@ bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
                                            std::vector<ValueType>& result) const {
+    this->countMultiplication();
     std::vector<ValueType>* target = &result;
     if (&x == &result) {
         if (this->cachedVector) {
@@ -44,8 +134,8 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddParallel(x, b, *target);
-    } else {
+        multAddParallel(env, x, b, *target);
+    } else if (!applyToSoaMatrix(env, [&](auto const& soa) { soa.multiplyWithVector(x, *target, b); })) {
         multAdd(x, b, *target);
     }
     if (&x == &result) {
@@ -56,6 +146,21 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
                                                       bool backwards) const {
+    this->countMultiplication();
+    if (env.solver().multiplier().isParallelGaussSeidelSet()) {
+        multAddGaussSeidelParallel(x, b, backwards);
+        return;
+    }
+    bool appliedToSoaMatrix = applyToSoaMatrix(env, [&](auto const& soa) {
+        if (backwards) {
+            soa.multiplyWithVectorBackward(x, x, b);
+        } else {
+            soa.multiplyWithVectorForward(x, x, b);
+        }
+    });
+    if (appliedToSoaMatrix) {
+        return;
+    }
     if (backwards) {
         this->matrix.multiplyWithVectorBackward(x, x, b);
     } else {
@@ -67,6 +172,7 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                     std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                     std::vector<uint_fast64_t>* choices) const {
+    this->countMultiplication();
     std::vector<ValueType>* target = &result;
     if (&x == &result) {
         if (this->cachedVector) {
@@ -77,8 +183,8 @@ void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Opti
         target = this->cachedVector.get();
     }
     if (parallelize(env)) {
-        multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
-    } else {
+        multAddReduceParallel(env, dir, rowGroupIndices, x, b, *target, choices);
+    } else if (!applyToSoaMatrix(env, [&](auto const& soa) { soa.multiplyAndReduceForward(dir, rowGroupIndices, x, b, *target, choices); })) {
         multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
     }
     if (&x == &result) {
@@ -90,6 +196,21 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
                                                                std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    this->countMultiplication();
+    if (env.solver().multiplier().isParallelGaussSeidelSet()) {
+        multAddReduceGaussSeidelParallel(dir, rowGroupIndices, x, b, choices, backwards);
+        return;
+    }
+    bool appliedToSoaMatrix = applyToSoaMatrix(env, [&](auto const& soa) {
+        if (backwards) {
+            soa.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+        } else {
+            soa.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+        }
+    });
+    if (appliedToSoaMatrix) {
+        return;
+    }
     if (backwards) {
         this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
     } else {
@@ -97,6 +218,32 @@ void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const
     }
 }
 
+template<typename ValueType>
+bool NativeMultiplier<ValueType>::multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir,
+                                                                       std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                                                       std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                                       ValueType const& precision, bool relative) const {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else {
+        STORM_LOG_ASSERT(&x != &result, "Vectors must not be aliased.");
+        if (env.solver().multiplier().isSoaLayoutSet()) {
+            // The structure-of-arrays kernels do not provide a fused convergence check.
+            return Multiplier<ValueType>::multiplyAndReduceAndCheckConvergence(env, dir, rowGroupIndices, x, b, result, precision, relative);
+        }
+        this->countMultiplication();
+        if (parallelize(env)) {
+            return multAddReduceAndCheckConvergenceParallel(env, dir, rowGroupIndices, x, b, result, precision, relative);
+        } else if (storm::solver::minimize(dir)) {
+            return detail::multiplyAndReduceRowGroupsAndCheckConvergence<ValueType, storm::utility::ElementLess<ValueType>>(
+                this->matrix, rowGroupIndices, 0, rowGroupIndices.size() - 1, x, b, result, precision, relative);
+        } else {
+            return detail::multiplyAndReduceRowGroupsAndCheckConvergence<ValueType, storm::utility::ElementGreater<ValueType>>(
+                this->matrix, rowGroupIndices, 0, rowGroupIndices.size() - 1, x, b, result, precision, relative);
+        }
+    }
+}
+
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
     for (auto const& entry : this->matrix.getRow(rowIndex)) {
@@ -126,9 +273,17 @@ void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirec
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+void NativeMultiplier<ValueType>::multAddParallel(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                  std::vector<ValueType>& result) const {
 #ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyWithVectorParallel(x, result, b);
+    if (env.solver().multiplier().isNumaAwareSet()) {
+        if (!rowPartitioner) {
+            rowPartitioner = std::make_unique<tbb::affinity_partitioner>();
+        }
+        this->matrix.multiplyWithVectorParallel(x, result, b, rowPartitioner.get());
+    } else {
+        this->matrix.multiplyWithVectorParallel(x, result, b);
+    }
 #else
     STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
     multAdd(x, b, result);
@@ -136,17 +291,249 @@ void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const&
 }
 
 template<typename ValueType>
-void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
-                                                        std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
-                                                        std::vector<uint64_t>* choices) const {
+void NativeMultiplier<ValueType>::multAddReduceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir,
+                                                        std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                                        std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
 #ifdef STORM_HAVE_INTELTBB
-    this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    if (env.solver().multiplier().isNumaAwareSet()) {
+        if (!rowGroupPartitioner) {
+            rowGroupPartitioner = std::make_unique<tbb::affinity_partitioner>();
+        }
+        this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices, rowGroupPartitioner.get());
+    } else {
+        this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
+    }
 #else
     STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
     multAddReduce(dir, rowGroupIndices, x, b, result, choices);
 #endif
 }
 
+template<typename ValueType>
+void NativeMultiplier<ValueType>::updateRowGroupColoring(std::vector<uint64_t> const* rowGroupIndices) const {
+    if (!colorIndications.empty() && (rowGroupIndices ? coloredRowGroupIndices == *rowGroupIndices : coloredRowGroupIndices.empty())) {
+        return;
+    }
+    uint64_t const groupCount = rowGroupIndices ? rowGroupIndices->size() - 1 : this->matrix.getRowCount();
+    auto getGroupRows = [&](uint64_t group) {
+        return rowGroupIndices ? this->matrix.getRows((*rowGroupIndices)[group], (*rowGroupIndices)[group + 1]) : this->matrix.getRow(group);
+    };
+    STORM_LOG_ASSERT(this->matrix.getColumnCount() == groupCount, "The number of columns does not match the number of row groups.");
+
+    // Compute for each row group the row groups that read its value.
+    std::vector<uint64_t> dependentIndications(groupCount + 1, 0);
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        for (auto const& entry : getGroupRows(group)) {
+            ++dependentIndications[entry.getColumn() + 1];
+        }
+    }
+    std::partial_sum(dependentIndications.begin(), dependentIndications.end(), dependentIndications.begin());
+    std::vector<uint64_t> dependents(dependentIndications.back());
+    std::vector<uint64_t> insertPositions(dependentIndications.begin(), dependentIndications.end() - 1);
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        for (auto const& entry : getGroupRows(group)) {
+            dependents[insertPositions[entry.getColumn()]++] = group;
+        }
+    }
+
+    // Greedily assign to each row group the smallest color that is neither used by a row group it reads nor by a row group that reads it.
+    uint64_t const noColor = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> colors(groupCount, noColor);
+    // Color i can not be used for the current group iff blockingGroup[i] is the current group.
+    std::vector<uint64_t> blockingGroup;
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        auto block = [&](uint64_t neighbor) {
+            if (neighbor != group && colors[neighbor] != noColor) {
+                blockingGroup[colors[neighbor]] = group;
+            }
+        };
+        for (auto const& entry : getGroupRows(group)) {
+            block(entry.getColumn());
+        }
+        for (uint64_t index = dependentIndications[group]; index < dependentIndications[group + 1]; ++index) {
+            block(dependents[index]);
+        }
+        uint64_t color = 0;
+        while (color < blockingGroup.size() && blockingGroup[color] == group) {
+            ++color;
+        }
+        if (color == blockingGroup.size()) {
+            blockingGroup.push_back(noColor);
+        }
+        colors[group] = color;
+    }
+
+    // Sort the row groups by their color.
+    colorIndications.assign(blockingGroup.size() + 1, 0);
+    for (auto const& color : colors) {
+        ++colorIndications[color + 1];
+    }
+    std::partial_sum(colorIndications.begin(), colorIndications.end(), colorIndications.begin());
+    rowGroupsByColor.resize(groupCount);
+    insertPositions.assign(colorIndications.begin(), colorIndications.end() - 1);
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        rowGroupsByColor[insertPositions[colors[group]]++] = group;
+    }
+    if (rowGroupIndices) {
+        coloredRowGroupIndices = *rowGroupIndices;
+    } else {
+        coloredRowGroupIndices.clear();
+    }
+    STORM_LOG_INFO("Colored " << groupCount << " row groups with " << blockingGroup.size() << " colors for parallel Gauss-Seidel multiplications.");
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddGaussSeidelParallel(std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+#ifdef STORM_HAVE_INTELTBB
+    updateRowGroupColoring(nullptr);
+    uint64_t const colorCount = colorIndications.size() - 1;
+    for (uint64_t colorIndex = 0; colorIndex < colorCount; ++colorIndex) {
+        uint64_t const color = backwards ? colorCount - 1 - colorIndex : colorIndex;
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(colorIndications[color], colorIndications[color + 1], 100),
+                          [&](tbb::blocked_range<uint64_t> const& range) {
+                              for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                                  uint64_t const row = rowGroupsByColor[index];
+                                  ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                                  newValue += this->matrix.multiplyRowWithVector(row, x);
+                                  x[row] = std::move(newValue);
+                              }
+                          });
+    }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    if (backwards) {
+        this->matrix.multiplyWithVectorBackward(x, x, b);
+    } else {
+        this->matrix.multiplyWithVectorForward(x, x, b);
+    }
+#endif
+}
+
+namespace detail {
+/*!
+ * Multiplies the rows of the given row group with x, reduces the results and writes the result to x[group]. The rows are processed and
+ * the choices are tracked in the same way as in SparseMatrix::multiplyAndReduceForward/Backward.
+ */
+template<typename ValueType, typename Compare>
+void multiplyAndReduceRowGroupInPlace(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& rowGroupIndices, uint64_t group,
+                                      std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) {
+    Compare compare;
+    uint64_t const groupStart = rowGroupIndices[group];
+    uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+
+    // Only multiply and reduce if there is at least one row in the group.
+    if (groupSize == 0) {
+        return;
+    }
+
+    auto getRowValue = [&](uint64_t choice) {
+        ValueType value = b ? (*b)[groupStart + choice] : storm::utility::zero<ValueType>();
+        value += matrix.multiplyRowWithVector(groupStart + choice, x);
+        return value;
+    };
+
+    uint64_t selectedChoice = backwards ? groupSize - 1 : 0;
+    ValueType currentValue = getRowValue(selectedChoice);
+
+    // Variables for correctly tracking choices (only update if new choice is strictly better).
+    ValueType oldSelectedChoiceValue;
+    if (choices && (*choices)[group] == selectedChoice) {
+        oldSelectedChoiceValue = currentValue;
+    }
+
+    for (uint64_t i = 1; i < groupSize; ++i) {
+        uint64_t const choice = backwards ? groupSize - 1 - i : i;
+        ValueType newValue = getRowValue(choice);
+        if (choices && (*choices)[group] == choice) {
+            oldSelectedChoiceValue = newValue;
+        }
+        if (compare(newValue, currentValue)) {
+            currentValue = std::move(newValue);
+            selectedChoice = choice;
+        }
+    }
+
+    if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+        (*choices)[group] = selectedChoice;
+    }
+    x[group] = std::move(currentValue);
+}
+}  // namespace detail
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddReduceGaussSeidelParallel(storm::solver::OptimizationDirection const& dir,
+                                                                   std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                   std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else {
+        updateRowGroupColoring(&rowGroupIndices);
+        bool const minimize = storm::solver::minimize(dir);
+        uint64_t const colorCount = colorIndications.size() - 1;
+        for (uint64_t colorIndex = 0; colorIndex < colorCount; ++colorIndex) {
+            uint64_t const color = backwards ? colorCount - 1 - colorIndex : colorIndex;
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(colorIndications[color], colorIndications[color + 1], 100),
+                              [&](tbb::blocked_range<uint64_t> const& range) {
+                                  for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                                      if (minimize) {
+                                          detail::multiplyAndReduceRowGroupInPlace<ValueType, storm::utility::ElementLess<ValueType>>(
+                                              this->matrix, rowGroupIndices, rowGroupsByColor[index], x, b, choices, backwards);
+                                      } else {
+                                          detail::multiplyAndReduceRowGroupInPlace<ValueType, storm::utility::ElementGreater<ValueType>>(
+                                              this->matrix, rowGroupIndices, rowGroupsByColor[index], x, b, choices, backwards);
+                                      }
+                                  }
+                              });
+        }
+    }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    if (backwards) {
+        this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+    } else {
+        this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+    }
+#endif
+}
+
+template<typename ValueType>
+bool NativeMultiplier<ValueType>::multAddReduceAndCheckConvergenceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir,
+                                                                           std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                                                           std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                                           ValueType const& precision, bool relative) const {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else {
+        auto checkRange = [&](tbb::blocked_range<uint64_t> const& range, bool converged) {
+            bool rangeConverged;
+            if (storm::solver::minimize(dir)) {
+                rangeConverged = detail::multiplyAndReduceRowGroupsAndCheckConvergence<ValueType, storm::utility::ElementLess<ValueType>>(
+                    this->matrix, rowGroupIndices, range.begin(), range.end(), x, b, result, precision, relative);
+            } else {
+                rangeConverged = detail::multiplyAndReduceRowGroupsAndCheckConvergence<ValueType, storm::utility::ElementGreater<ValueType>>(
+                    this->matrix, rowGroupIndices, range.begin(), range.end(), x, b, result, precision, relative);
+            }
+            return converged && rangeConverged;
+        };
+        auto combine = [](bool first, bool second) { return first && second; };
+        tbb::blocked_range<uint64_t> const range(0, rowGroupIndices.size() - 1, 100);
+        if (env.solver().multiplier().isNumaAwareSet()) {
+            if (!rowGroupPartitioner) {
+                rowGroupPartitioner = std::make_unique<tbb::affinity_partitioner>();
+            }
+            return tbb::parallel_reduce(range, true, checkRange, combine, *rowGroupPartitioner);
+        } else {
+            return tbb::parallel_reduce(range, true, checkRange, combine);
+        }
+    }
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+    return Multiplier<ValueType>::multiplyAndReduceAndCheckConvergence(env, dir, rowGroupIndices, x, b, result, precision, relative);
+#endif
+}
+
 template class NativeMultiplier<double>;
 #ifdef STORM_HAVE_CARL
 template class NativeMultiplier<storm::RationalNumber>;
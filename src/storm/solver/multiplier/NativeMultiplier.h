@@ -1,14 +1,21 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
 namespace storage {
 template<typename ValueType>
 class SparseMatrix;
-}
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+class SoaSparseMatrix;
+}  // namespace storage
 
 namespace solver {
 
@@ -16,7 +23,7 @@ template<typename ValueType>
 class NativeMultiplier : public Multiplier<ValueType> {
    public:
     NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
-    virtual ~NativeMultiplier() = default;
+    virtual ~NativeMultiplier();
 
     virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
                           std::vector<ValueType>& result) const override;
@@ -27,11 +34,25 @@ class NativeMultiplier : public Multiplier<ValueType> {
     virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                               std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
                                               bool backwards = true) const override;
+    virtual bool multiplyAndReduceAndCheckConvergence(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                      std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                      ValueType const& precision, bool relative) const override;
     virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
     virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                               ValueType& val2) const override;
+    virtual void clearCache() const override;
 
    private:
+    /*!
+     * If the environment requests the structure-of-arrays layout, applies the given operation to the
+     * structure-of-arrays copy of the matrix (which is created if it does not exist yet). The copy uses 32-bit column
+     * indices whenever the number of columns permits it.
+     *
+     * @return true iff the operation was applied.
+     */
+    template<typename Operation>
+    bool applyToSoaMatrix(Environment const& env, Operation const& operation) const;
+
     bool parallelize(Environment const& env) const;
 
     void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
@@ -39,9 +60,45 @@ class NativeMultiplier : public Multiplier<ValueType> {
     void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
                        std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
 
-    void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
-    void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
-                               std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+    void multAddParallel(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+    void multAddReduceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                               std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                               std::vector<uint64_t>* choices = nullptr) const;
+
+    bool multAddReduceAndCheckConvergenceParallel(Environment const& env, storm::solver::OptimizationDirection const& dir,
+                                                  std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                  std::vector<ValueType>& result, ValueType const& precision, bool relative) const;
+
+    void multAddGaussSeidelParallel(std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const;
+    void multAddReduceGaussSeidelParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                          std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const;
+
+    /*!
+     * Colors the given row groups such that no row group reads the value of another row group of the same color.
+     * The coloring is only recomputed if it was computed for different row groups before.
+     *
+     * @param rowGroupIndices The row groups to color. If not given, every row is considered as a separate group.
+     */
+    void updateRowGroupColoring(std::vector<uint64_t> const* rowGroupIndices) const;
+
+    // A copy of the matrix in which columns and values are stored in separate arrays (if requested).
+    // At most one of the two is set, depending on whether the columns fit into 32-bit indices.
+    mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType, uint64_t, ValueType>> soaMatrix;
+    mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType, uint32_t, ValueType>> compactSoaMatrix;
+
+    // The row groups for which the coloring was computed (empty if every row is a separate group).
+    mutable std::vector<uint64_t> coloredRowGroupIndices;
+    // The row groups sorted by their color.
+    mutable std::vector<uint64_t> rowGroupsByColor;
+    // The row groups of color i are rowGroupsByColor[colorIndications[i]], ..., rowGroupsByColor[colorIndications[i + 1] - 1].
+    // Empty if no coloring has been computed.
+    mutable std::vector<uint64_t> colorIndications;
+
+#ifdef STORM_HAVE_INTELTBB
+    // The partitioners that remember which thread processed which rows (row groups) in the last parallel multiplication (if requested).
+    mutable std::unique_ptr<tbb::affinity_partitioner> rowPartitioner;
+    mutable std::unique_ptr<tbb::affinity_partitioner> rowGroupPartitioner;
+#endif
 };
 
 }  // namespace solver
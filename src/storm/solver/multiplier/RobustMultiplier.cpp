@@ -0,0 +1,232 @@
+#include "storm/solver/multiplier/RobustMultiplier.h"
+
+#include "storm-config.h"
+
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace detail {
+// The tolerance when checking whether the intervals of a row contain a distribution, which accounts for rounding errors in the bounds.
+double const distributionTolerance = 1e-12;
+}  // namespace detail
+
+template<typename ValueType>
+RobustMultiplier<ValueType>::RobustMultiplier(storm::storage::SparseMatrix<storm::Interval> const& matrix)
+    : rowGroupIndices(matrix.getRowGroupIndices()), numberOfSorts(0) {
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    columns.reserve(matrix.getEntryCount());
+    lowerBounds.reserve(matrix.getEntryCount());
+    widths.reserve(matrix.getEntryCount());
+    remainingMass.reserve(matrix.getRowCount());
+    order.reserve(matrix.getEntryCount());
+
+    rowIndications.push_back(0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        ValueType lowerSum = storm::utility::zero<ValueType>();
+        ValueType upperSum = storm::utility::zero<ValueType>();
+        for (auto const& entry : matrix.getRow(row)) {
+            order.push_back(columns.size());
+            columns.push_back(entry.getColumn());
+            lowerBounds.push_back(entry.getValue().lower());
+            widths.push_back(entry.getValue().upper() - entry.getValue().lower());
+            lowerSum += entry.getValue().lower();
+            upperSum += entry.getValue().upper();
+        }
+        rowIndications.push_back(columns.size());
+
+        // Empty rows are treated as rows whose entries are all zero.
+        if (rowIndications[row] == rowIndications[row + 1]) {
+            remainingMass.push_back(storm::utility::zero<ValueType>());
+            continue;
+        }
+        STORM_LOG_THROW(lowerSum <= storm::utility::one<ValueType>() + detail::distributionTolerance &&
+                            upperSum >= storm::utility::one<ValueType>() - detail::distributionTolerance,
+                        storm::exceptions::InvalidArgumentException, "The intervals of row " << row << " do not contain a probability distribution.");
+        remainingMass.push_back(std::max(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>() - lowerSum));
+    }
+}
+
+template<typename ValueType>
+bool RobustMultiplier<ValueType>::parallelize(Environment const&) const {
+#ifdef STORM_HAVE_INTELTBB
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+    return false;
+#endif
+}
+
+template<typename ValueType>
+ValueType RobustMultiplier<ValueType>::multiplyRow(uint64_t row, OptimizationDirection natureDir, std::vector<ValueType> const& x) const {
+    uint64_t const rowStart = rowIndications[row];
+    uint64_t const rowEnd = rowIndications[row + 1];
+
+    // Every successor gets at least its lower bound.
+    ValueType result = storm::utility::zero<ValueType>();
+    for (uint64_t entry = rowStart; entry < rowEnd; ++entry) {
+        result += lowerBounds[entry] * x[columns[entry]];
+    }
+
+    ValueType remaining = remainingMass[row];
+    if (storm::utility::isZero(remaining)) {
+        return result;
+    }
+
+    // Restore the order of the successors, if the values changed it since the last multiplication.
+    auto orderStart = order.begin() + rowStart;
+    auto orderEnd = order.begin() + rowEnd;
+    auto lessValue = [&](uint64_t const& first, uint64_t const& second) { return x[columns[first]] < x[columns[second]]; };
+    if (!std::is_sorted(orderStart, orderEnd, lessValue)) {
+        std::sort(orderStart, orderEnd, lessValue);
+        ++numberOfSorts;
+    }
+
+    // Nature distributes the remaining mass among the successors with the largest (smallest) values first.
+    auto distribute = [&](uint64_t const& entry) {
+        ValueType mass = std::min(widths[entry], remaining);
+        result += mass * x[columns[entry]];
+        remaining -= mass;
+        return remaining <= storm::utility::zero<ValueType>();
+    };
+    if (maximize(natureDir)) {
+        for (auto it = orderEnd; it != orderStart;) {
+            if (distribute(*--it)) {
+                break;
+            }
+        }
+    } else {
+        for (auto it = orderStart; it != orderEnd; ++it) {
+            if (distribute(*it)) {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void RobustMultiplier<ValueType>::multiplyRows(OptimizationDirection natureDir, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                               std::vector<ValueType>& result, uint64_t firstRow, uint64_t endRow) const {
+    for (uint64_t row = firstRow; row < endRow; ++row) {
+        result[row] = multiplyRow(row, natureDir, x);
+        if (b) {
+            result[row] += (*b)[row];
+        }
+    }
+}
+
+template<typename ValueType>
+void RobustMultiplier<ValueType>::multiplyAndReduceGroups(OptimizationDirection dir, OptimizationDirection natureDir, std::vector<ValueType> const& x,
+                                                          std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                                          uint64_t firstGroup, uint64_t endGroup) const {
+    for (uint64_t group = firstGroup; group < endGroup; ++group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        if (groupStart == groupEnd) {
+            continue;
+        }
+        ValueType best = storm::utility::zero<ValueType>();
+        uint64_t bestChoice = 0;
+        for (uint64_t row = groupStart; row < groupEnd; ++row) {
+            ValueType value = multiplyRow(row, natureDir, x);
+            if (b) {
+                value += (*b)[row];
+            }
+            if (row == groupStart || (minimize(dir) ? value < best : value > best)) {
+                best = value;
+                bestChoice = row - groupStart;
+            }
+        }
+        result[group] = best;
+        if (choices) {
+            (*choices)[group] = bestChoice;
+        }
+    }
+}
+
+template<typename ValueType>
+void RobustMultiplier<ValueType>::multiply(Environment const& env, OptimizationDirection natureDir, std::vector<ValueType> const& x,
+                                           std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (cachedVector) {
+            cachedVector->resize(getRowCount());
+        } else {
+            cachedVector = std::make_unique<std::vector<ValueType>>(getRowCount());
+        }
+        target = cachedVector.get();
+    }
+
+    if (parallelize(env)) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, getRowCount()), [&](tbb::blocked_range<uint64_t> const& range) {
+            multiplyRows(natureDir, x, b, *target, range.begin(), range.end());
+        });
+#endif
+    } else {
+        multiplyRows(natureDir, x, b, *target, 0, getRowCount());
+    }
+
+    if (&x == &result) {
+        std::swap(result, *cachedVector);
+    }
+}
+
+template<typename ValueType>
+void RobustMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection dir, OptimizationDirection natureDir,
+                                                    std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                    std::vector<uint64_t>* choices) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (cachedVector) {
+            cachedVector->resize(getRowGroupCount());
+        } else {
+            cachedVector = std::make_unique<std::vector<ValueType>>(getRowGroupCount());
+        }
+        target = cachedVector.get();
+    }
+
+    if (parallelize(env)) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, getRowGroupCount()), [&](tbb::blocked_range<uint64_t> const& range) {
+            multiplyAndReduceGroups(dir, natureDir, x, b, *target, choices, range.begin(), range.end());
+        });
+#endif
+    } else {
+        multiplyAndReduceGroups(dir, natureDir, x, b, *target, choices, 0, getRowGroupCount());
+    }
+
+    if (&x == &result) {
+        std::swap(result, *cachedVector);
+    }
+}
+
+template<typename ValueType>
+uint64_t RobustMultiplier<ValueType>::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+template<typename ValueType>
+uint64_t RobustMultiplier<ValueType>::getRowGroupCount() const {
+    return rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType>
+uint64_t RobustMultiplier<ValueType>::getNumberOfSorts() const {
+    return numberOfSorts.load();
+}
+
+template class RobustMultiplier<double>;
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionForward.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace solver {
+
+/*!
+ * Multiplies vectors with a matrix whose entries are probability intervals, i.e., every row describes the set of distributions whose probabilities
+ * lie within the given intervals. The result of a row is the minimal or maximal expected value of the vector over all these distributions (as
+ * chosen by nature).
+ *
+ * For each row, this inner optimization is solved by the greedy algorithm that assigns the lower bounds to all successors and distributes the
+ * remaining probability mass among the successors with the largest (smallest) values first. The successors of each row are sorted by their
+ * values, which takes O(k log k) time for a row with k entries. As the order of the values typically changes only rarely between two iterations,
+ * the order of each row is kept and only sorted again if it is no longer sorted with respect to the current values. The lower bounds
+ * and the widths of the intervals are stored in separate arrays, such that the contribution of the lower bounds is a plain dot product.
+ *
+ * Like the NativeMultiplier, the rows are processed in parallel if Intel TBB is available and its usage is enabled.
+ */
+template<typename ValueType>
+class RobustMultiplier {
+   public:
+    /*!
+     * Creates a multiplier for the given interval matrix. The row grouping of the matrix is used when reducing the results.
+     *
+     * @throws InvalidArgumentException if the intervals of a non-empty row do not contain a probability distribution.
+     */
+    RobustMultiplier(storm::storage::SparseMatrix<storm::Interval> const& matrix);
+
+    /*!
+     * Computes result = A * x + b, where b is optional and nature resolves the uncertainty of each row in the given direction.
+     * x and result may refer to the same vector.
+     */
+    void multiply(Environment const& env, OptimizationDirection natureDir, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                  std::vector<ValueType>& result) const;
+
+    /*!
+     * Computes A * x + b like multiply and then reduces the result of each row group to its minimum or maximum with respect to the given direction.
+     * x and result may refer to the same vector.
+     *
+     * @param choices If given, the (local) optimal choice of each row group is stored in this vector.
+     */
+    void multiplyAndReduce(Environment const& env, OptimizationDirection dir, OptimizationDirection natureDir, std::vector<ValueType> const& x,
+                           std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * Retrieves the value of the given row with respect to x (without offset), where nature resolves the uncertainty in the given direction.
+     */
+    ValueType multiplyRow(uint64_t row, OptimizationDirection natureDir, std::vector<ValueType> const& x) const;
+
+    uint64_t getRowCount() const;
+    uint64_t getRowGroupCount() const;
+
+    /*!
+     * Retrieves how often the successors of a row had to be sorted again, because the cached order was outdated.
+     */
+    uint64_t getNumberOfSorts() const;
+
+   private:
+    bool parallelize(Environment const& env) const;
+
+    void multiplyRows(OptimizationDirection natureDir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                      uint64_t firstRow, uint64_t endRow) const;
+    void multiplyAndReduceGroups(OptimizationDirection dir, OptimizationDirection natureDir, std::vector<ValueType> const& x,
+                                 std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, uint64_t firstGroup,
+                                 uint64_t endGroup) const;
+
+    // The entries of row i are the ones in [rowIndications[i], rowIndications[i + 1]).
+    std::vector<uint64_t> rowIndications;
+    std::vector<uint64_t> columns;
+    std::vector<ValueType> lowerBounds;
+    std::vector<ValueType> widths;
+
+    // For each row, the probability mass that remains after assigning the lower bounds.
+    std::vector<ValueType> remainingMass;
+
+    std::vector<uint64_t> rowGroupIndices;
+
+    // For each row, its entries ordered ascendingly by the values of their columns in the last multiplication.
+    mutable std::vector<uint64_t> order;
+    mutable std::atomic<uint64_t> numberOfSorts;
+
+    // Used if the input and the output vector coincide.
+    mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,395 @@
+#include "storm/solver/multiplier/SimdMultiplier.h"
+
+#include "storm-config.h"
+
+#include <limits>
+
+#include "storm/storage/SoaSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_MULTIPLIER_X86
+#include <immintrin.h>
+#endif
+
+namespace storm {
+namespace solver {
+namespace detail {
+
+enum class SimdInstructionSet { None, Avx2, Avx512 };
+
+SimdInstructionSet detectSimdInstructionSet() {
+#ifdef STORM_SIMD_MULTIPLIER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdInstructionSet::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdInstructionSet::Avx2;
+    }
+#endif
+    return SimdInstructionSet::None;
+}
+
+SimdInstructionSet getSimdInstructionSet() {
+    static SimdInstructionSet const instructionSet = detectSimdInstructionSet();
+    return instructionSet;
+}
+
+#ifdef STORM_SIMD_MULTIPLIER_X86
+template<typename ColumnIndexType>
+__attribute__((target("avx2,fma"))) inline double multiplyRowAvx2(ColumnIndexType const* columns, double const* values, uint64_t entry, uint64_t entryEnd,
+                                                                  double const* x) {
+    __m256d sum = _mm256_setzero_pd();
+    for (; entry + 4 <= entryEnd; entry += 4) {
+        __m256d xValues;
+        if constexpr (sizeof(ColumnIndexType) == 4) {
+            xValues = _mm256_i32gather_pd(x, _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry)), 8);
+        } else {
+            xValues = _mm256_i64gather_pd(x, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry)), 8);
+        }
+        sum = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), xValues, sum);
+    }
+    __m128d halfSum = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    double result = _mm_cvtsd_f64(_mm_add_sd(halfSum, _mm_unpackhi_pd(halfSum, halfSum)));
+    for (; entry < entryEnd; ++entry) {
+        result += values[entry] * x[columns[entry]];
+    }
+    return result;
+}
+
+template<typename ColumnIndexType>
+__attribute__((target("avx2,fma"))) void multiplyRowsAvx2(ColumnIndexType const* columns, double const* values, uint64_t const* rowIndications,
+                                                          uint64_t firstRow, uint64_t endRow, double const* x, double const* b, double* result,
+                                                          bool backwards) {
+    if (backwards) {
+        for (uint64_t row = endRow; row > firstRow;) {
+            --row;
+            result[row - firstRow] = (b ? b[row] : 0.0) + multiplyRowAvx2(columns, values, rowIndications[row], rowIndications[row + 1], x);
+        }
+    } else {
+        for (uint64_t row = firstRow; row < endRow; ++row) {
+            result[row - firstRow] = (b ? b[row] : 0.0) + multiplyRowAvx2(columns, values, rowIndications[row], rowIndications[row + 1], x);
+        }
+    }
+}
+
+template<bool Minimize>
+__attribute__((target("avx2,fma"))) double reduceAvx2(double const* values, uint64_t count) {
+    uint64_t index = 0;
+    double result = values[0];
+    if (count >= 4) {
+        __m256d extremum = _mm256_loadu_pd(values);
+        for (index = 4; index + 4 <= count; index += 4) {
+            extremum = Minimize ? _mm256_min_pd(extremum, _mm256_loadu_pd(values + index)) : _mm256_max_pd(extremum, _mm256_loadu_pd(values + index));
+        }
+        __m128d lower = _mm256_castpd256_pd128(extremum);
+        __m128d upper = _mm256_extractf128_pd(extremum, 1);
+        __m128d half = Minimize ? _mm_min_pd(lower, upper) : _mm_max_pd(lower, upper);
+        __m128d swapped = _mm_unpackhi_pd(half, half);
+        result = _mm_cvtsd_f64(Minimize ? _mm_min_sd(half, swapped) : _mm_max_sd(half, swapped));
+    }
+    for (; index < count; ++index) {
+        result = Minimize ? std::min(result, values[index]) : std::max(result, values[index]);
+    }
+    return result;
+}
+
+template<typename ColumnIndexType>
+__attribute__((target("avx512f"))) inline double multiplyRowAvx512(ColumnIndexType const* columns, double const* values, uint64_t entry, uint64_t entryEnd,
+                                                                   double const* x) {
+    __m512d sum = _mm512_setzero_pd();
+    for (; entry + 8 <= entryEnd; entry += 8) {
+        __m512d xValues;
+        if constexpr (sizeof(ColumnIndexType) == 4) {
+            xValues = _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry)), x, 8);
+        } else {
+            xValues = _mm512_i64gather_pd(_mm512_loadu_si512(columns + entry), x, 8);
+        }
+        sum = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), xValues, sum);
+    }
+    double result = _mm512_reduce_add_pd(sum);
+    for (; entry < entryEnd; ++entry) {
+        result += values[entry] * x[columns[entry]];
+    }
+    return result;
+}
+
+template<typename ColumnIndexType>
+__attribute__((target("avx512f"))) void multiplyRowsAvx512(ColumnIndexType const* columns, double const* values, uint64_t const* rowIndications,
+                                                           uint64_t firstRow, uint64_t endRow, double const* x, double const* b, double* result,
+                                                           bool backwards) {
+    if (backwards) {
+        for (uint64_t row = endRow; row > firstRow;) {
+            --row;
+            result[row - firstRow] = (b ? b[row] : 0.0) + multiplyRowAvx512(columns, values, rowIndications[row], rowIndications[row + 1], x);
+        }
+    } else {
+        for (uint64_t row = firstRow; row < endRow; ++row) {
+            result[row - firstRow] = (b ? b[row] : 0.0) + multiplyRowAvx512(columns, values, rowIndications[row], rowIndications[row + 1], x);
+        }
+    }
+}
+
+template<bool Minimize>
+__attribute__((target("avx512f"))) double reduceAvx512(double const* values, uint64_t count) {
+    uint64_t index = 0;
+    double result = values[0];
+    if (count >= 8) {
+        __m512d extremum = _mm512_loadu_pd(values);
+        for (index = 8; index + 8 <= count; index += 8) {
+            extremum = Minimize ? _mm512_min_pd(extremum, _mm512_loadu_pd(values + index)) : _mm512_max_pd(extremum, _mm512_loadu_pd(values + index));
+        }
+        result = Minimize ? _mm512_reduce_min_pd(extremum) : _mm512_reduce_max_pd(extremum);
+    }
+    for (; index < count; ++index) {
+        result = Minimize ? std::min(result, values[index]) : std::max(result, values[index]);
+    }
+    return result;
+}
+#endif
+
+/*!
+ * Computes the values of the rows firstRow, ..., endRow - 1 (optionally adding the corresponding entries of b) and
+ * writes the value of each row to result[row - firstRow]. Rows are processed in the given order and each value is
+ * written right after it was computed, i.e., if result aliases x, this performs a Gauss-Seidel style multiplication.
+ */
+template<typename ColumnIndexType>
+void multiplyRows(storm::storage::SoaSparseMatrix<double, ColumnIndexType> const& matrix, uint64_t firstRow, uint64_t endRow, double const* x,
+                  double const* b, double* result, bool backwards) {
+#ifdef STORM_SIMD_MULTIPLIER_X86
+    ColumnIndexType const* columns = matrix.getColumns().data();
+    double const* values = matrix.getValues().data();
+    uint64_t const* rowIndications = matrix.getRowIndications().data();
+    switch (getSimdInstructionSet()) {
+        case SimdInstructionSet::Avx512:
+            multiplyRowsAvx512(columns, values, rowIndications, firstRow, endRow, x, b, result, backwards);
+            return;
+        case SimdInstructionSet::Avx2:
+            multiplyRowsAvx2(columns, values, rowIndications, firstRow, endRow, x, b, result, backwards);
+            return;
+        case SimdInstructionSet::None:
+            break;
+    }
+#endif
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Vectorized multiplication is not supported on this CPU.");
+}
+
+/*!
+ * Retrieves the minimum or maximum of the given (non-empty) range of values.
+ */
+double reduce(OptimizationDirection const& dir, double const* values, uint64_t count) {
+#ifdef STORM_SIMD_MULTIPLIER_X86
+    switch (getSimdInstructionSet()) {
+        case SimdInstructionSet::Avx512:
+            return minimize(dir) ? reduceAvx512<true>(values, count) : reduceAvx512<false>(values, count);
+        case SimdInstructionSet::Avx2:
+            return minimize(dir) ? reduceAvx2<true>(values, count) : reduceAvx2<false>(values, count);
+        case SimdInstructionSet::None:
+            break;
+    }
+#endif
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Vectorized reduction is not supported on this CPU.");
+}
+
+}  // namespace detail
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : NativeMultiplier<ValueType>(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::~SimdMultiplier() = default;
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::isVectorizationSupported() {
+    return false;
+}
+
+template<>
+bool SimdMultiplier<double>::isVectorizationSupported() {
+    return detail::getSimdInstructionSet() != detail::SimdInstructionSet::None;
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::clearCache() const {
+    soaMatrix.reset();
+    compactSoaMatrix.reset();
+    NativeMultiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::createSoaMatrix() const {
+    if (!soaMatrix && !compactSoaMatrix) {
+        // The 32-bit gather instructions interpret the indices as signed integers.
+        if (this->matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+            compactSoaMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType, uint32_t>>(this->matrix);
+        } else {
+            soaMatrix = std::make_unique<storm::storage::SoaSparseMatrix<ValueType, uint64_t>>(this->matrix);
+        }
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyVectorized(std::vector<ValueType> const&, std::vector<ValueType> const*, std::vector<ValueType>&, bool) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Vectorized multiplication is only supported for double values.");
+}
+
+template<>
+void SimdMultiplier<double>::multiplyVectorized(std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, bool backwards) const {
+    createSoaMatrix();
+    double const* summand = b ? b->data() : nullptr;
+    uint64_t const rowCount = this->matrix.getRowCount();
+    if (compactSoaMatrix) {
+        detail::multiplyRows(*compactSoaMatrix, 0, rowCount, x.data(), summand, result.data(), backwards);
+    } else {
+        detail::multiplyRows(*soaMatrix, 0, rowCount, x.data(), summand, result.data(), backwards);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduceVectorized(OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<ValueType> const&,
+                                                            std::vector<ValueType> const*, std::vector<ValueType>&, std::vector<uint_fast64_t>*, bool) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Vectorized multiplication is only supported for double values.");
+}
+
+template<>
+void SimdMultiplier<double>::multiplyAndReduceVectorized(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                         std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result,
+                                                         std::vector<uint_fast64_t>* choices, bool backwards) const {
+    createSoaMatrix();
+    double const* summand = b ? b->data() : nullptr;
+    bool const minimizing = minimize(dir);
+
+    auto reduceGroup = [&](uint64_t group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupSize == 0) {
+            return;
+        }
+
+        if (rowGroupValues.size() < groupSize) {
+            rowGroupValues.resize(groupSize);
+        }
+        if (compactSoaMatrix) {
+            detail::multiplyRows(*compactSoaMatrix, groupStart, groupStart + groupSize, x.data(), summand, rowGroupValues.data(), false);
+        } else {
+            detail::multiplyRows(*soaMatrix, groupStart, groupStart + groupSize, x.data(), summand, rowGroupValues.data(), false);
+        }
+
+        if (!choices) {
+            result[group] = detail::reduce(dir, rowGroupValues.data(), groupSize);
+            return;
+        }
+
+        // To track the choices in the same way as SparseMatrix::multiplyAndReduce, the rows are considered in the same order and the
+        // selected choice is only changed if the new choice is strictly better.
+        auto isBetter = [minimizing](double const& first, double const& second) { return minimizing ? first < second : first > second; };
+        uint64_t selectedChoice = backwards ? groupSize - 1 : 0;
+        for (uint64_t i = 1; i < groupSize; ++i) {
+            uint64_t const choice = backwards ? groupSize - 1 - i : i;
+            if (isBetter(rowGroupValues[choice], rowGroupValues[selectedChoice])) {
+                selectedChoice = choice;
+            }
+        }
+        if (isBetter(rowGroupValues[selectedChoice], rowGroupValues[(*choices)[group]])) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = rowGroupValues[selectedChoice];
+    };
+
+    uint64_t const groupCount = rowGroupIndices.size() - 1;
+    if (backwards) {
+        for (uint64_t group = groupCount; group > 0;) {
+            --group;
+            reduceGroup(group);
+        }
+    } else {
+        for (uint64_t group = 0; group < groupCount; ++group) {
+            reduceGroup(group);
+        }
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    if (!isVectorizationSupported()) {
+        NativeMultiplier<ValueType>::multiply(env, x, b, result);
+        return;
+    }
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    multiplyVectorized(x, b, *target, false);
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+    if (!isVectorizationSupported()) {
+        NativeMultiplier<ValueType>::multiplyGaussSeidel(env, x, b, backwards);
+        return;
+    }
+    multiplyVectorized(x, b, x, backwards);
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    if (!isVectorizationSupported()) {
+        NativeMultiplier<ValueType>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+        return;
+    }
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    multiplyAndReduceVectorized(dir, rowGroupIndices, x, b, *target, choices, false);
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    if (!isVectorizationSupported()) {
+        NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices, backwards);
+        return;
+    }
+    multiplyAndReduceVectorized(dir, rowGroupIndices, x, b, x, choices, backwards);
+}
+
+template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class SimdMultiplier<storm::RationalNumber>;
+template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
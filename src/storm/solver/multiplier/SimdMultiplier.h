@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+
+#include "storm/solver/multiplier/NativeMultiplier.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+class SoaSparseMatrix;
+}  // namespace storage
+
+namespace solver {
+
+/*!
+ * A multiplier that uses vectorized (AVX2 or AVX-512) kernels for the double case. The kernels operate on a
+ * structure-of-arrays copy of the matrix and use gathered loads to compute the row products as well as vectorized
+ * minima/maxima to reduce row groups. The instruction set is selected at runtime. If the CPU supports neither of the
+ * instruction sets or the value type is not double, this multiplier behaves like the native multiplier.
+ */
+template<typename ValueType>
+class SimdMultiplier : public NativeMultiplier<ValueType> {
+   public:
+    SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~SimdMultiplier();
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void clearCache() const override;
+
+    /*!
+     * Retrieves whether vectorized kernels are available for the given value type on the current CPU.
+     */
+    static bool isVectorizationSupported();
+
+   private:
+    /*!
+     * Performs the (Gauss-Seidel style if the result is the same as x) multiplication using the vectorized kernels.
+     */
+    void multiplyVectorized(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool backwards) const;
+
+    /*!
+     * Performs the (Gauss-Seidel style if the result is the same as x) multiplication and reduction using the
+     * vectorized kernels.
+     */
+    void multiplyAndReduceVectorized(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                     std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices,
+                                     bool backwards) const;
+
+    // Creates the structure-of-arrays copy of the matrix if it does not exist yet.
+    void createSoaMatrix() const;
+
+    // A copy of the matrix in which columns and values are stored in separate arrays.
+    // At most one of the two is set, depending on whether the columns fit into 32-bit indices.
+    mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType, uint64_t, ValueType>> soaMatrix;
+    mutable std::unique_ptr<storm::storage::SoaSparseMatrix<ValueType, uint32_t, ValueType>> compactSoaMatrix;
+
+    // Holds the values of the rows of the row group that is currently reduced.
+    mutable std::vector<ValueType> rowGroupValues;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -15,7 +15,7 @@ using namespace storm::utility::stateelimination;
 template<typename ValueType, ScalingMode Mode>
 EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix,
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix)
-    : matrix(matrix), transposedMatrix(transposedMatrix) {
+    : matrix(matrix), transposedMatrix(transposedMatrix), delayCancellation(false) {
     // Intentionally left empty.
 }
 
@@ -52,8 +52,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         if (hasEntryInColumn) {
             STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(),
                              "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
-            columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-            columnValue = storm::utility::simplify(columnValue);
+            columnValue = oneDividedByOneMinus(columnValue);
         }
     }
 
@@ -61,7 +60,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Only scale the entries in a different column.
             if (entryIt->getColumn() != column) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(multiply(entryIt->getValue(), columnValue));
             }
         }
         updateValue(row, columnValue);
@@ -72,7 +71,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
 
     // In case we have a constrained elimination, we need to keep track of the rows that keep their value
     // in the column equal to the current row.
-    FlexibleRowType rowsKeepingEntryInColumnEqualRow;
+    FlexibleRowType rowsKeepingEntryInColumnEqualRow(elementsWithEntryInColumnEqualRow.get_allocator());
 
     // For each entry in the row d, we need to build a list of other rows that will contain an element in the
     // column d.
@@ -81,6 +80,10 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
     }
 
+    // The buffer into which the new successors of a predecessor are merged. It is swapped with the row of the predecessor, so the storage
+    // of the old row is recycled for the next predecessor instead of allocating a new row every time.
+    FlexibleRowType newSuccessors(entriesInRow.get_allocator());
+
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
     // the elements of this row unless the elimination is filtered.
     for (auto const& predecessorEntry : elementsWithEntryInColumnEqualRow) {
@@ -123,7 +126,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
+        newSuccessors.clear();
         newSuccessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
 
@@ -150,7 +153,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
-                auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                typename FlexibleRowType::value_type successorEntry(first2->getColumn(), multiply(first2->getValue(), multiplyFactor));
                 *result = successorEntry;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
                 ++first2;
@@ -159,9 +162,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 *result = *first1;
                 ++first1;
             } else {
-                ValueType sprod = multiplyFactor * first2->getValue();
-                ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                auto probability = storm::utility::simplify(sum);
+                ValueType probability = add(first1->getValue(), multiply(multiplyFactor, first2->getValue()));
                 *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
                                                       typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
@@ -172,7 +173,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
-                auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                typename FlexibleRowType::value_type stateProbability(first2->getColumn(), multiply(first2->getValue(), multiplyFactor));
                 *result = stateProbability;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
                 ++successorOffsetInNewBackwardTransitions;
@@ -180,7 +181,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
 
         // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        predecessorForwardTransitions.swap(newSuccessors);
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -189,7 +190,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         updatePriority(predecessor);
     }
 
-    // Finally, we need to add the predecessor to the set of predecessors of every successor.
+    // Finally, we need to add the predecessor to the set of predecessors of every successor. As above, the storage of the old predecessor
+    // lists is recycled.
+    FlexibleRowType newPredecessors(elementsWithEntryInColumnEqualRow.get_allocator());
     uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
     for (auto const& successorEntry : entriesInRow) {
         if (successorEntry.getColumn() == column) {
@@ -217,7 +220,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
+        newPredecessors.clear();
         newPredecessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
 
@@ -258,7 +261,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                          });
         }
         // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        successorBackwardTransitions.swap(newPredecessors);
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -302,8 +305,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         if (hasEntryInColumn) {
             STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(),
                              "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
-            columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-            columnValue = storm::utility::simplify(columnValue);
+            columnValue = oneDividedByOneMinus(columnValue);
         }
     }
 
@@ -311,7 +313,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Scale the entries in a different column, set state transition probability to 0.
             if (entryIt->getColumn() != state) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(multiply(entryIt->getValue(), columnValue));
             } else {
                 entryIt->setValue(storm::utility::zero<ValueType>());
             }
@@ -319,6 +321,45 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
     }
 }
 
+template<typename ValueType, ScalingMode Mode>
+void EliminatorBase<ValueType, Mode>::setOperationCache(std::shared_ptr<OperationCache<ValueType>> const& operationCache) {
+    this->operationCache = operationCache;
+}
+
+template<typename ValueType, ScalingMode Mode>
+void EliminatorBase<ValueType, Mode>::setDelayCancellation(bool delayCancellation) {
+    this->delayCancellation = delayCancellation;
+}
+
+template<typename ValueType, ScalingMode Mode>
+ValueType EliminatorBase<ValueType, Mode>::multiply(ValueType const& first, ValueType const& second) const {
+    if (operationCache) {
+        return operationCache->multiply(first, second);
+    }
+    ValueType result = first * second;
+    return delayCancellation ? result : storm::utility::simplify(result);
+}
+
+template<typename ValueType, ScalingMode Mode>
+ValueType EliminatorBase<ValueType, Mode>::add(ValueType const& first, ValueType const& second) const {
+    if (operationCache) {
+        return operationCache->add(first, second);
+    }
+    ValueType result = first + second;
+    return delayCancellation ? result : storm::utility::simplify(result);
+}
+
+template<typename ValueType, ScalingMode Mode>
+ValueType EliminatorBase<ValueType, Mode>::oneDividedByOneMinus(ValueType const& value) const {
+    // With delayed cancellation, the value is cancelled now as it is about to end up in the denominators.
+    ValueType cancelledValue = delayCancellation ? storm::utility::simplify(value) : value;
+    if (operationCache) {
+        return operationCache->oneDividedByOneMinus(cancelledValue);
+    }
+    ValueType result = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - cancelledValue);
+    return storm::utility::simplify(result);
+}
+
 template<typename ValueType, ScalingMode Mode>
 void EliminatorBase<ValueType, Mode>::updateValue(storm::storage::sparse::state_type const&, ValueType const&) {
     // Intentionally left empty.
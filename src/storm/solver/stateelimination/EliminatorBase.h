@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+
+#include "storm/solver/stateelimination/OperationCache.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/FlexibleSparseMatrix.h"
@@ -23,6 +26,18 @@ class EliminatorBase {
 
     void eliminateLoop(uint64_t row);
 
+    /*!
+     * Sets a cache for the arithmetic operations of the elimination. The cache may be shared among several eliminators, but
+     * must not be used concurrently. A null pointer disables the caching.
+     */
+    void setOperationCache(std::shared_ptr<OperationCache<ValueType>> const& operationCache);
+
+    /*!
+     * Sets whether the cancellation (i.e., simplification) of intermediate products and sums is delayed until a value is
+     * inverted. The caller is then responsible to simplify the final values. Results taken from the operation cache are always simplified.
+     */
+    void setDelayCancellation(bool delayCancellation);
+
     // Provide virtual methods that can be customized by subclasses to govern side-effect of the elimination.
     virtual void updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability);
     virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
@@ -32,8 +47,16 @@ class EliminatorBase {
     virtual bool isFilterPredecessor() const;
 
    protected:
+    // The arithmetic operations of the elimination which make use of the operation cache and the delayed cancellation (if enabled).
+    ValueType multiply(ValueType const& first, ValueType const& second) const;
+    ValueType add(ValueType const& first, ValueType const& second) const;
+    ValueType oneDividedByOneMinus(ValueType const& value) const;
+
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+    std::shared_ptr<OperationCache<ValueType>> operationCache;
+    bool delayCancellation;
 };
 
 }  // namespace stateelimination
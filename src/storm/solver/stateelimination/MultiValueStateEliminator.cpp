@@ -25,21 +25,19 @@ MultiValueStateEliminator<ValueType>::MultiValueStateEliminator(storm::storage::
 
 template<typename ValueType>
 void MultiValueStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) {
-    this->stateValues[state] = storm::utility::simplify((ValueType)(loopProbability * this->stateValues[state]));
+    this->stateValues[state] = this->multiply(loopProbability, this->stateValues[state]);
     for (auto additionalStateValueVectorRef : additionalStateValues) {
-        additionalStateValueVectorRef.get()[state] = storm::utility::simplify((ValueType)(loopProbability * additionalStateValueVectorRef.get()[state]));
+        additionalStateValueVectorRef.get()[state] = this->multiply(loopProbability, additionalStateValueVectorRef.get()[state]);
     }
 }
 
 template<typename ValueType>
 void MultiValueStateEliminator<ValueType>::updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
                                                              storm::storage::sparse::state_type const& state) {
-    this->stateValues[predecessor] =
-        storm::utility::simplify((ValueType)(this->stateValues[predecessor] + storm::utility::simplify((ValueType)(probability * this->stateValues[state]))));
+    this->stateValues[predecessor] = this->add(this->stateValues[predecessor], this->multiply(probability, this->stateValues[state]));
     for (auto additionalStateValueVectorRef : additionalStateValues) {
         additionalStateValueVectorRef.get()[predecessor] =
-            storm::utility::simplify((ValueType)(additionalStateValueVectorRef.get()[predecessor] +
-                                                 storm::utility::simplify((ValueType)(probability * additionalStateValueVectorRef.get()[state]))));
+            this->add(additionalStateValueVectorRef.get()[predecessor], this->multiply(probability, additionalStateValueVectorRef.get()[state]));
     }
 }
 
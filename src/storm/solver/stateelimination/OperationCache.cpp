@@ -0,0 +1,109 @@
+#include "storm/solver/stateelimination/OperationCache.h"
+
+#include <functional>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+template<typename ValueType>
+OperationCache<ValueType>::OperationCache(uint64_t maximalSize) : maximalSize(maximalSize), numberOfHits(0), numberOfMisses(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::multiply(ValueType const& first, ValueType const& second) {
+    if (storm::utility::isZero(first) || storm::utility::isZero(second)) {
+        return storm::utility::zero<ValueType>();
+    } else if (storm::utility::isOne(first)) {
+        return second;
+    } else if (storm::utility::isOne(second)) {
+        return first;
+    }
+    // As the operation is commutative, the operands are ordered to obtain a unique key.
+    std::hash<ValueType> hasher;
+    bool swap = hasher(second) < hasher(first);
+    return lookup(Key{Operation::Multiply, swap ? second : first, swap ? first : second},
+                  [&]() { return storm::utility::simplify((ValueType)(first * second)); });
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::add(ValueType const& first, ValueType const& second) {
+    if (storm::utility::isZero(first)) {
+        return second;
+    } else if (storm::utility::isZero(second)) {
+        return first;
+    }
+    std::hash<ValueType> hasher;
+    bool swap = hasher(second) < hasher(first);
+    return lookup(Key{Operation::Add, swap ? second : first, swap ? first : second},
+                  [&]() { return storm::utility::simplify((ValueType)(first + second)); });
+}
+
+template<typename ValueType>
+ValueType OperationCache<ValueType>::oneDividedByOneMinus(ValueType const& value) {
+    return lookup(Key{Operation::OneDividedByOneMinus, value, storm::utility::zero<ValueType>()}, [&]() {
+        return storm::utility::simplify((ValueType)(storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - value)));
+    });
+}
+
+template<typename ValueType>
+uint64_t OperationCache<ValueType>::getNumberOfHits() const {
+    return numberOfHits;
+}
+
+template<typename ValueType>
+uint64_t OperationCache<ValueType>::getNumberOfMisses() const {
+    return numberOfMisses;
+}
+
+template<typename ValueType>
+void OperationCache<ValueType>::clear() {
+    results.clear();
+}
+
+template<typename ValueType>
+template<typename ComputeFunction>
+ValueType OperationCache<ValueType>::lookup(Key&& key, ComputeFunction const& compute) {
+    auto resultIt = results.find(key);
+    if (resultIt != results.end()) {
+        ++numberOfHits;
+        return resultIt->second;
+    }
+    ++numberOfMisses;
+    ValueType result = compute();
+    if (results.size() >= maximalSize) {
+        results.clear();
+    }
+    results.emplace(std::move(key), result);
+    return result;
+}
+
+template<typename ValueType>
+bool OperationCache<ValueType>::Key::operator==(Key const& other) const {
+    return operation == other.operation && first == other.first && second == other.second;
+}
+
+template<typename ValueType>
+std::size_t OperationCache<ValueType>::KeyHash::operator()(Key const& key) const {
+    std::hash<ValueType> hasher;
+    std::size_t seed = static_cast<std::size_t>(key.operation);
+    boost::hash_combine(seed, hasher(key.first));
+    boost::hash_combine(seed, hasher(key.second));
+    return seed;
+}
+
+template class OperationCache<double>;
+
+#ifdef STORM_HAVE_CARL
+template class OperationCache<storm::RationalNumber>;
+template class OperationCache<storm::RationalFunction>;
+#endif
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+/*!
+ * A computed table for the arithmetic operations performed during state elimination. The results of (simplified) products, sums and the
+ * scaling factors 1/(1-x) are stored under their operands, such that repeated operations on structurally identical values (which are common
+ * in parametric models) are only carried out (and cancelled) once. For rational functions, the operands are hash-consed by the polynomial
+ * cache of carl, so hashing and comparing them is cheap compared to the gcd computations that are saved.
+ *
+ * The cache is not thread-safe.
+ */
+template<typename ValueType>
+class OperationCache {
+   public:
+    /*!
+     * @param maximalSize The maximal number of stored results. Once it is exceeded, the cache is cleared.
+     */
+    OperationCache(uint64_t maximalSize = 1000000);
+
+    /*!
+     * Retrieves the simplified product of the given values.
+     */
+    ValueType multiply(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Retrieves the simplified sum of the given values.
+     */
+    ValueType add(ValueType const& first, ValueType const& second);
+
+    /*!
+     * Retrieves the simplified value of 1/(1-value).
+     */
+    ValueType oneDividedByOneMinus(ValueType const& value);
+
+    /*!
+     * Retrieves the number of operations whose result was found in the cache.
+     */
+    uint64_t getNumberOfHits() const;
+
+    /*!
+     * Retrieves the number of operations that needed to be computed.
+     */
+    uint64_t getNumberOfMisses() const;
+
+    /*!
+     * Removes all stored results.
+     */
+    void clear();
+
+   private:
+    enum class Operation { Multiply, Add, OneDividedByOneMinus };
+
+    struct Key {
+        Operation operation;
+        ValueType first;
+        ValueType second;
+
+        bool operator==(Key const& other) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    /*!
+     * Looks up the given key and computes (and stores) the result with the given function if it is not present.
+     */
+    template<typename ComputeFunction>
+    ValueType lookup(Key&& key, ComputeFunction const& compute);
+
+    uint64_t maximalSize;
+    uint64_t numberOfHits;
+    uint64_t numberOfMisses;
+    std::unordered_map<Key, ValueType, KeyHash> results;
+};
+
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,164 @@
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/solver/stateelimination/StatePriorityQueue.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+template<typename ValueType>
+ParallelStateEliminator<ValueType>::ParallelStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
+                                                            storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
+                                                            PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues,
+                                                            uint64_t maximalBatchSize)
+    : PrioritizedStateEliminator<ValueType>(transitionMatrix, backwardTransitions, priorityQueue, stateValues),
+      maximalBatchSize(std::max<uint64_t>(maximalBatchSize, 1)),
+      deferPriorityUpdates(false),
+      markedStates(std::max(transitionMatrix.getRowCount(), transitionMatrix.getColumnCount())) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void ParallelStateEliminator<ValueType>::updatePriority(storm::storage::sparse::state_type const& state) {
+    // While a batch is eliminated, the priority queue must not be modified concurrently. The updates are therefore performed afterwards.
+    if (!deferPriorityUpdates) {
+        PrioritizedStateEliminator<ValueType>::updatePriority(state);
+    }
+}
+
+template<typename ValueType>
+void ParallelStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
+    eliminateAllInBatches([removeForwardTransitions](storm::storage::sparse::state_type) { return removeForwardTransitions; });
+}
+
+template<typename ValueType>
+void ParallelStateEliminator<ValueType>::eliminateAll(storm::storage::BitVector const& statesToKeep) {
+    eliminateAllInBatches([&statesToKeep](storm::storage::sparse::state_type state) { return !statesToKeep.get(state); });
+}
+
+template<typename ValueType>
+void ParallelStateEliminator<ValueType>::eliminateAllInBatches(std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions) {
+    auto eliminate = [&](storm::storage::sparse::state_type state) {
+        bool removeForwardTransitionsOfState = removeForwardTransitions(state);
+        this->eliminateState(state, removeForwardTransitionsOfState);
+        if (removeForwardTransitionsOfState) {
+            this->clearStateValues(state);
+        }
+    };
+
+    // The neighbourhood of a state can only be determined if its row coincides with the state.
+    if (!this->matrix.hasTrivialRowGrouping()) {
+        while (this->priorityQueue->hasNext()) {
+            eliminate(this->priorityQueue->pop());
+        }
+        return;
+    }
+
+    uint64_t numberOfBatches = 0;
+    while (!pendingStates.empty() || this->priorityQueue->hasNext()) {
+        computeNextBatch();
+        ++numberOfBatches;
+
+        deferPriorityUpdates = true;
+        // Operations on rational functions are not thread-safe, so the batches are processed sequentially in this case.
+#ifdef STORM_HAVE_INTELTBB
+        if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batch.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    eliminate(batch[index]);
+                }
+            });
+        } else {
+            for (auto state : batch) {
+                eliminate(state);
+            }
+        }
+#else
+        for (auto state : batch) {
+            eliminate(state);
+        }
+#endif
+        deferPriorityUpdates = false;
+
+        for (auto predecessor : predecessorsOfBatch) {
+            this->priorityQueue->update(predecessor);
+        }
+    }
+    STORM_LOG_DEBUG("Eliminated states in " << numberOfBatches << " batches.");
+}
+
+template<typename ValueType>
+void ParallelStateEliminator<ValueType>::computeNextBatch() {
+    batch.clear();
+    predecessorsOfBatch.clear();
+    for (auto state : markedStatesList) {
+        markedStates.set(state, false);
+    }
+    markedStatesList.clear();
+
+    // States that were kept back earlier precede the ones still in the queue. The first state considered is always independent, so the
+    // batch is never empty.
+    std::deque<storm::storage::sparse::state_type> remainingPendingStates;
+    for (auto state : pendingStates) {
+        if (!tryAddToBatch(state)) {
+            remainingPendingStates.push_back(state);
+        }
+    }
+    while (batch.size() + remainingPendingStates.size() < maximalBatchSize && this->priorityQueue->hasNext()) {
+        storm::storage::sparse::state_type state = this->priorityQueue->pop();
+        if (!tryAddToBatch(state)) {
+            remainingPendingStates.push_back(state);
+        }
+    }
+    pendingStates = std::move(remainingPendingStates);
+}
+
+template<typename ValueType>
+bool ParallelStateEliminator<ValueType>::tryAddToBatch(storm::storage::sparse::state_type state) {
+    // The elimination of a state reads and writes the forward rows of its predecessors, the backward rows of its successors and the values
+    // of its predecessors.
+    neighbourhood.clear();
+    neighbourhood.push_back(state);
+    for (auto const& entry : this->matrix.getRow(state)) {
+        neighbourhood.push_back(entry.getColumn());
+    }
+    auto const& predecessors = this->transposedMatrix.getRow(state);
+    for (auto const& entry : predecessors) {
+        neighbourhood.push_back(entry.getColumn());
+    }
+
+    bool independent = std::none_of(neighbourhood.begin(), neighbourhood.end(), [this](storm::storage::sparse::state_type s) { return markedStates.get(s); });
+
+    // Also mark the neighbourhood of conflicting states, so that states depending on them do not overtake them.
+    for (auto s : neighbourhood) {
+        if (!markedStates.get(s)) {
+            markedStates.set(s);
+            markedStatesList.push_back(s);
+        }
+    }
+
+    if (independent) {
+        batch.push_back(state);
+        for (auto const& entry : predecessors) {
+            predecessorsOfBatch.push_back(entry.getColumn());
+        }
+    }
+    return independent;
+}
+
+template class ParallelStateEliminator<double>;
+
+#ifdef STORM_HAVE_CARL
+template class ParallelStateEliminator<storm::RationalNumber>;
+template class ParallelStateEliminator<storm::RationalFunction>;
+#endif
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,81 @@
+#ifndef STORM_SOLVER_STATEELIMINATION_PARALLELSTATEELIMINATOR_H_
+#define STORM_SOLVER_STATEELIMINATION_PARALLELSTATEELIMINATOR_H_
+
+#include <deque>
+#include <functional>
+
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+/*!
+ * A prioritized state eliminator that eliminates states in batches. The states of a batch are taken from the priority queue (in order) such
+ * that no two of them are adjacent or have a common neighbour. As the eliminations of such states touch disjoint rows of the matrices and
+ * disjoint state values, they commute and are performed in parallel. States that conflict with the current batch are kept back for the next
+ * batch. The priorities of the predecessors are updated once the batch is completed.
+ */
+template<typename ValueType>
+class ParallelStateEliminator : public PrioritizedStateEliminator<ValueType> {
+   public:
+    typedef typename PrioritizedStateEliminator<ValueType>::PriorityQueuePointer PriorityQueuePointer;
+
+    /*!
+     * Creates an eliminator for the states of the given priority queue.
+     *
+     * @param maximalBatchSize The maximal number of states that are considered for a batch. This also bounds how far the elimination may deviate
+     * from the order given by the priority queue.
+     */
+    ParallelStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
+                            storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, PriorityQueuePointer priorityQueue,
+                            std::vector<ValueType>& stateValues, uint64_t maximalBatchSize = 256);
+
+    virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
+
+    virtual void eliminateAll(bool removeForwardTransitions = true) override;
+
+    /*!
+     * Eliminates all states of the priority queue. The forward transitions (and values) are only kept for the given states.
+     *
+     * @param statesToKeep The states whose forward transitions are not to be removed upon elimination.
+     */
+    void eliminateAll(storm::storage::BitVector const& statesToKeep);
+
+   private:
+    void eliminateAllInBatches(std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions);
+
+    /*!
+     * Fills the current batch with the next states that can be eliminated independently.
+     */
+    void computeNextBatch();
+
+    /*!
+     * Adds the given state to the batch if it is independent of the states considered so far and marks its neighbourhood.
+     *
+     * @return True iff the state was added to the batch.
+     */
+    bool tryAddToBatch(storm::storage::sparse::state_type state);
+
+    uint64_t maximalBatchSize;
+    bool deferPriorityUpdates;
+
+    // The states of the current batch and their predecessors (whose priorities need to be updated after the batch).
+    std::vector<storm::storage::sparse::state_type> batch;
+    std::vector<storm::storage::sparse::state_type> predecessorsOfBatch;
+
+    // The states that were taken from the queue but conflicted with an earlier batch.
+    std::deque<storm::storage::sparse::state_type> pendingStates;
+
+    // The neighbourhoods of the states considered for the current batch.
+    storm::storage::BitVector markedStates;
+    std::vector<storm::storage::sparse::state_type> markedStatesList;
+    std::vector<storm::storage::sparse::state_type> neighbourhood;
+};
+
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
+
+#endif  // STORM_SOLVER_STATEELIMINATION_PARALLELSTATEELIMINATOR_H_
@@ -6,6 +6,7 @@
 
 #include "storm/storage/BoostTypes.h"
 #include "storm/utility/Hash.h"
+#include "storm/utility/LargeArray.h"
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/macros.h"
 
@@ -16,6 +17,18 @@
 namespace storm {
 namespace storage {
 
+namespace detail {
+
+uint64_t* allocateBuckets(uint64_t bucketCount) {
+    return static_cast<uint64_t*>(storm::utility::LargeArray::allocate(bucketCount * sizeof(uint64_t)));
+}
+
+void freeBuckets(uint64_t* buckets, uint64_t bucketCount) {
+    storm::utility::LargeArray::deallocate(buckets, bucketCount * sizeof(uint64_t));
+}
+
+}  // namespace detail
+
 BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit)
     : dataPtr(dataPtr), endIndex(endIndex) {
     if (setOnFirstBit) {
@@ -77,18 +90,16 @@ BitVector::BitVector(uint_fast64_t length, bool init) : bitCount(length), bucket
 
     // Initialize the storage with the required values.
     if (init) {
-        buckets = new uint64_t[bucketCount];
+        buckets = detail::allocateBuckets(bucketCount);
         std::fill_n(buckets, bucketCount, -1ull);
         truncateLastBucket();
     } else {
-        buckets = new uint64_t[bucketCount]();
+        buckets = detail::allocateBuckets(bucketCount);
     }
 }
 
 BitVector::~BitVector() {
-    if (buckets != nullptr) {
-        delete[] buckets;
-    }
+    detail::freeBuckets(buckets, bucketCount());
 }
 
 template<typename InputIterator>
@@ -102,11 +113,11 @@ BitVector::BitVector(uint_fast64_t length, std::vector<uint_fast64_t> setEntries
 
 BitVector::BitVector(uint_fast64_t bucketCount, uint_fast64_t bitCount) : bitCount(bitCount), buckets(nullptr) {
     STORM_LOG_ASSERT((bucketCount << 6) == bitCount, "Bit count does not match number of buckets.");
-    buckets = new uint64_t[bucketCount]();
+    buckets = detail::allocateBuckets(bucketCount);
 }
 
 BitVector::BitVector(BitVector const& other) : bitCount(other.bitCount), buckets(nullptr) {
-    buckets = new uint64_t[other.bucketCount()];
+    buckets = detail::allocateBuckets(other.bucketCount());
     std::copy_n(other.buckets, other.bucketCount(), buckets);
 }
 
@@ -114,12 +125,12 @@ BitVector& BitVector::operator=(BitVector const& other) {
     // Only perform the assignment if the source and target are not identical.
     if (this != &other) {
         if (buckets && bucketCount() != other.bucketCount()) {
-            delete[] buckets;
+            detail::freeBuckets(buckets, bucketCount());
             buckets = nullptr;
         }
         bitCount = other.bitCount;
         if (!buckets) {
-            buckets = new uint64_t[other.bucketCount()];
+            buckets = detail::allocateBuckets(other.bucketCount());
         }
         std::copy_n(other.buckets, other.bucketCount(), buckets);
     }
@@ -155,11 +166,9 @@ BitVector::BitVector(BitVector&& other) : bitCount(other.bitCount), buckets(othe
 BitVector& BitVector::operator=(BitVector&& other) {
     // Only perform the assignment if the source and target are not identical.
     if (this != &other) {
+        detail::freeBuckets(this->buckets, this->bucketCount());
         bitCount = other.bitCount;
         other.bitCount = 0;
-        if (this->buckets) {
-            delete[] this->buckets;
-        }
         this->buckets = other.buckets;
         other.buckets = nullptr;
     }
@@ -218,7 +227,7 @@ void BitVector::resize(uint_fast64_t newLength, bool init) {
         }
 
         if (newBucketCount > this->bucketCount()) {
-            uint64_t* newBuckets = new uint64_t[newBucketCount];
+            uint64_t* newBuckets = detail::allocateBuckets(newBucketCount);
             std::copy_n(buckets, this->bucketCount(), newBuckets);
             if (init) {
                 if (this->bucketCount() > 0) {
@@ -228,9 +237,7 @@ void BitVector::resize(uint_fast64_t newLength, bool init) {
             } else {
                 std::fill_n(newBuckets + this->bucketCount(), newBucketCount - this->bucketCount(), 0);
             }
-            if (buckets != nullptr) {
-                delete[] buckets;
-            }
+            detail::freeBuckets(buckets, this->bucketCount());
             buckets = newBuckets;
             bitCount = newLength;
         } else {
@@ -250,11 +257,9 @@ void BitVector::resize(uint_fast64_t newLength, bool init) {
         // If the number of buckets needs to be reduced, we resize it now. Otherwise, we can just truncate the
         // last bucket.
         if (newBucketCount < this->bucketCount()) {
-            uint64_t* newBuckets = new uint64_t[newBucketCount];
+            uint64_t* newBuckets = detail::allocateBuckets(newBucketCount);
             std::copy_n(buckets, newBucketCount, newBuckets);
-            if (buckets != nullptr) {
-                delete[] buckets;
-            }
+            detail::freeBuckets(buckets, this->bucketCount());
             buckets = newBuckets;
             bitCount = newLength;
         }
@@ -407,34 +412,53 @@ BitVector BitVector::implies(BitVector const& other) const {
     return result;
 }
 
-bool BitVector::isSubsetOf(BitVector const& other) const {
-    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+namespace {
+// Counts the leading zeros of the given (non-zero) bucket, i.e. the position of its first set bit.
+inline uint_fast64_t countLeadingZeros(uint64_t bucket) {
+#if (defined(__GNUG__) || defined(__clang__))
+    return __builtin_clzll(bucket);
+#else
+    uint_fast64_t result = 0;
+    while ((bucket & (1ull << 63)) == 0) {
+        bucket <<= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
 
-    uint64_t const* it1 = buckets;
-    uint64_t const* ite1 = buckets + bucketCount();
-    uint64_t const* it2 = other.buckets;
+// The number of buckets that are combined before checking for an early exit. Checking only once per block keeps the loops free of branches,
+// so that the compiler can vectorize them.
+uint_fast64_t const bucketsPerBlock = 8;
 
-    for (; it1 != ite1; ++it1, ++it2) {
-        if ((*it1 & *it2) != *it1) {
+template<typename Operation>
+bool allBucketsZero(uint64_t const* first, uint64_t const* second, uint_fast64_t bucketCount, Operation const& operation) {
+    uint_fast64_t bucket = 0;
+    for (; bucket + bucketsPerBlock <= bucketCount; bucket += bucketsPerBlock) {
+        uint64_t accumulated = 0;
+        for (uint_fast64_t offset = 0; offset < bucketsPerBlock; ++offset) {
+            accumulated |= operation(first[bucket + offset], second[bucket + offset]);
+        }
+        if (accumulated != 0) {
             return false;
         }
     }
-    return true;
+    uint64_t accumulated = 0;
+    for (; bucket < bucketCount; ++bucket) {
+        accumulated |= operation(first[bucket], second[bucket]);
+    }
+    return accumulated == 0;
 }
+}  // namespace
 
-bool BitVector::isDisjointFrom(BitVector const& other) const {
+bool BitVector::isSubsetOf(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    return allBucketsZero(buckets, other.buckets, bucketCount(), [](uint64_t a, uint64_t b) { return a & ~b; });
+}
 
-    uint64_t const* it1 = buckets;
-    uint64_t const* ite1 = buckets + bucketCount();
-    uint64_t const* it2 = other.buckets;
-
-    for (; it1 != ite1; ++it1, ++it2) {
-        if ((*it1 & *it2) != 0) {
-            return false;
-        }
-    }
-    return true;
+bool BitVector::isDisjointFrom(BitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    return allBucketsZero(buckets, other.buckets, bucketCount(), [](uint64_t a, uint64_t b) { return a & b; });
 }
 
 bool BitVector::matches(uint_fast64_t bitIndex, BitVector const& other) const {
@@ -533,6 +557,10 @@ uint_fast64_t BitVector::getAsInt(uint_fast64_t bitIndex, uint_fast64_t numberOf
     }
 }
 
+uint64_t const* BitVector::getBuckets() const {
+    return buckets;
+}
+
 uint_fast64_t BitVector::getTwoBitsAligned(uint_fast64_t bitIndex) const {
     // Check whether it is aligned.
     STORM_LOG_ASSERT(bitIndex % 64 != 63, "Bits not aligned.");
@@ -712,6 +740,39 @@ uint_fast64_t BitVector::getNextSetIndex(uint_fast64_t startingIndex) const {
     return getNextIndexWithValue(true, buckets, startingIndex, bitCount);
 }
 
+uint_fast64_t BitVector::getNextSetIndices(uint_fast64_t startingIndex, std::vector<uint_fast64_t>& indices, uint_fast64_t maximalNumberOfIndices) const {
+    if (startingIndex >= bitCount || maximalNumberOfIndices == 0) {
+        return std::min<uint_fast64_t>(startingIndex, bitCount);
+    }
+
+    uint64_t const* bucketIt = buckets + (startingIndex >> 6);
+    uint64_t const* bucketIte = buckets + bucketCount();
+    uint_fast64_t bucketStart = startingIndex >> 6 << 6;
+    uint_fast8_t currentBitInBucket = startingIndex & mod64mask;
+    uint64_t remainingInBucket = *bucketIt & (currentBitInBucket == 0 ? -1ull : (1ull << (64 - currentBitInBucket)) - 1ull);
+    while (true) {
+        // Decode all set bits of the current bucket.
+        while (remainingInBucket != 0) {
+            uint_fast64_t bitInBucket = countLeadingZeros(remainingInBucket);
+            if (bucketStart + bitInBucket >= bitCount) {
+                return bitCount;
+            }
+            indices.push_back(bucketStart + bitInBucket);
+            remainingInBucket &= ~(1ull << (63 - bitInBucket));
+            if (--maximalNumberOfIndices == 0) {
+                return bucketStart + bitInBucket + 1;
+            }
+        }
+
+        ++bucketIt;
+        if (bucketIt == bucketIte) {
+            return bitCount;
+        }
+        bucketStart += 64;
+        remainingInBucket = *bucketIt;
+    }
+}
+
 uint_fast64_t BitVector::getNextUnsetIndex(uint_fast64_t startingIndex) const {
 #ifdef ASSERT_BITVECTOR
     STORM_LOG_ASSERT(getNextIndexWithValue(false, buckets, startingIndex, bitCount) == (~(*this)).getNextSetIndex(startingIndex),
@@ -740,10 +801,8 @@ uint_fast64_t BitVector::getNextIndexWithValue(bool value, uint64_t const* dataP
 
             // Check if there is at least one bit in the remainder of the bucket that is set to true.
             if (remainingInBucket != 0) {
-                // As long as the current bit is not set, move the current bit.
-                while ((remainingInBucket & (1ull << (63 - currentBitInByte))) == 0) {
-                    ++currentBitInByte;
-                }
+                // The bits are stored from the most significant one on, so the number of leading zeros is the position of the first set bit.
+                currentBitInByte = countLeadingZeros(remainingInBucket);
 
                 // Only return the index of the set bit if we are still in the valid range.
                 if (startingIndex + currentBitInByte < endIndex) {
@@ -766,10 +825,8 @@ uint_fast64_t BitVector::getNextIndexWithValue(bool value, uint64_t const* dataP
 
             // Check if there is at least one bit in the remainder of the bucket that is set to false.
             if (remainingInBucket != (-1ull & mask)) {
-                // As long as the current bit is not false, move the current bit.
-                while ((remainingInBucket & (1ull << (63 - currentBitInByte))) != 0) {
-                    ++currentBitInByte;
-                }
+                // The position of the first unset bit is the number of leading zeros of the complement (restricted to the remainder).
+                currentBitInByte = countLeadingZeros(~remainingInBucket & mask);
 
                 // Only return the index of the set bit if we are still in the valid range.
                 if (startingIndex + currentBitInByte < endIndex) {
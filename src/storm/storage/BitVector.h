@@ -423,6 +423,14 @@ class BitVector {
      */
     uint_fast64_t getAsInt(uint_fast64_t bitIndex, uint_fast64_t numberOfBits) const;
 
+    /*!
+     * Retrieves the underlying storage of 64-bit buckets. The bit with index i is stored in bucket i / 64, where the bits are stored from the most
+     * significant to the least significant bit.
+     *
+     * @return A pointer to the first bucket.
+     */
+    uint64_t const* getBuckets() const;
+
     /*!
      *
      * @param bitIndex The index of the first of the two bits to get
@@ -521,6 +529,18 @@ class BitVector {
      */
     uint_fast64_t getNextSetIndex(uint_fast64_t startingIndex) const;
 
+    /*!
+     * Retrieves the indices of the next bits that are set to true in the bit vector. This is equivalent to repeated calls to getNextSetIndex,
+     * but every bucket is only decoded once.
+     *
+     * @param startingIndex The index at which to start the search. The bit at this index itself is included in the search range.
+     * @param indices The vector to which the indices of the set bits are appended.
+     * @param maximalNumberOfIndices The maximal number of indices to retrieve.
+     * @return The index at which the search can be continued, i.e. the index after the last retrieved set bit. If there are no more set bits,
+     * this is the size of the bit vector.
+     */
+    uint_fast64_t getNextSetIndices(uint_fast64_t startingIndex, std::vector<uint_fast64_t>& indices, uint_fast64_t maximalNumberOfIndices) const;
+
     /*!
      * Retrieves the index of the bit that is the next bit set to false in the bit vector. If there is none,
      * this function returns the number of bits this vector holds in total. Put differently, if the return
@@ -0,0 +1,194 @@
+#include "storm/storage/CompressedBitVector.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+uint64_t const chunkBits = 16;
+uint64_t const chunkSize = 1ull << chunkBits;
+uint64_t const bitmapWords = chunkSize / 64;
+}  // namespace
+
+CompressedBitVector::CompressedBitVector() : bitCount(0) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(BitVector const& bitVector) : bitCount(bitVector.size()) {
+    // Collect the runs of set bits chunk by chunk. Jumping between set and unset bits makes this fast for long runs.
+    std::vector<std::pair<uint32_t, uint32_t>> chunkRuns;
+    uint64_t currentChunk = 0;
+    uint64_t runStart = bitVector.getNextSetIndex(0);
+    while (runStart < bitCount) {
+        uint64_t runEnd = bitVector.getNextUnsetIndex(runStart);
+        while (runStart < runEnd) {
+            uint64_t chunk = runStart >> chunkBits;
+            if (chunk != currentChunk && !chunkRuns.empty()) {
+                containers.push_back(createContainer(currentChunk, chunkRuns));
+                chunkRuns.clear();
+            }
+            currentChunk = chunk;
+            uint64_t chunkBegin = chunk << chunkBits;
+            uint64_t endInChunk = std::min(runEnd, chunkBegin + chunkSize);
+            chunkRuns.emplace_back(runStart - chunkBegin, endInChunk - chunkBegin);
+            runStart = endInChunk;
+        }
+        runStart = bitVector.getNextSetIndex(runEnd);
+    }
+    if (!chunkRuns.empty()) {
+        containers.push_back(createContainer(currentChunk, chunkRuns));
+    }
+    containers.shrink_to_fit();
+}
+
+CompressedBitVector::Container CompressedBitVector::createContainer(uint64_t chunk, std::vector<std::pair<uint32_t, uint32_t>> const& runs) {
+    Container container;
+    container.chunk = chunk;
+    container.numberOfSetBits = 0;
+    for (auto const& run : runs) {
+        container.numberOfSetBits += run.second - run.first;
+    }
+
+    // Pick the representation that needs the fewest bytes.
+    uint64_t arrayBytes = 2 * container.numberOfSetBits;
+    uint64_t runBytes = 4 * runs.size();
+    uint64_t bitmapBytes = 8 * bitmapWords;
+    if (runBytes <= arrayBytes && runBytes <= bitmapBytes) {
+        container.type = ContainerType::Runs;
+        container.values.reserve(2 * runs.size());
+        for (auto const& run : runs) {
+            container.values.push_back(static_cast<uint16_t>(run.first));
+            container.values.push_back(static_cast<uint16_t>(run.second - run.first - 1));
+        }
+    } else if (arrayBytes <= bitmapBytes) {
+        container.type = ContainerType::Array;
+        container.values.reserve(container.numberOfSetBits);
+        for (auto const& run : runs) {
+            for (uint32_t offset = run.first; offset < run.second; ++offset) {
+                container.values.push_back(static_cast<uint16_t>(offset));
+            }
+        }
+    } else {
+        container.type = ContainerType::Bitmap;
+        container.words.resize(bitmapWords, 0);
+        for (auto const& run : runs) {
+            for (uint32_t offset = run.first; offset < run.second; ++offset) {
+                container.words[offset >> 6] |= 1ull << (offset & 63);
+            }
+        }
+    }
+    return container;
+}
+
+BitVector CompressedBitVector::toBitVector() const {
+    BitVector result(bitCount);
+    for (auto const& container : containers) {
+        uint64_t chunkBegin = container.chunk << chunkBits;
+        switch (container.type) {
+            case ContainerType::Array:
+                for (auto offset : container.values) {
+                    result.set(chunkBegin + offset);
+                }
+                break;
+            case ContainerType::Runs:
+                for (uint64_t runIndex = 0; runIndex < container.values.size(); runIndex += 2) {
+                    uint64_t runBegin = chunkBegin + container.values[runIndex];
+                    uint64_t runEnd = runBegin + container.values[runIndex + 1] + 1;
+                    for (uint64_t index = runBegin; index < runEnd; ++index) {
+                        result.set(index);
+                    }
+                }
+                break;
+            case ContainerType::Bitmap:
+                for (uint64_t wordIndex = 0; wordIndex < bitmapWords; ++wordIndex) {
+                    uint64_t word = container.words[wordIndex];
+                    while (word != 0) {
+                        uint64_t bit = __builtin_ctzll(word);
+                        result.set(chunkBegin + (wordIndex << 6) + bit);
+                        word &= word - 1;
+                    }
+                }
+                break;
+        }
+    }
+    return result;
+}
+
+uint64_t CompressedBitVector::size() const {
+    return bitCount;
+}
+
+bool CompressedBitVector::get(uint64_t index) const {
+    if (index >= bitCount) {
+        return false;
+    }
+    uint64_t chunk = index >> chunkBits;
+    auto containerIt =
+        std::lower_bound(containers.begin(), containers.end(), chunk, [](Container const& container, uint64_t value) { return container.chunk < value; });
+    if (containerIt == containers.end() || containerIt->chunk != chunk) {
+        return false;
+    }
+
+    uint16_t offset = static_cast<uint16_t>(index & (chunkSize - 1));
+    switch (containerIt->type) {
+        case ContainerType::Array:
+            return std::binary_search(containerIt->values.begin(), containerIt->values.end(), offset);
+        case ContainerType::Runs: {
+            // Find the last run that starts at or before the offset.
+            uint64_t low = 0;
+            uint64_t high = containerIt->values.size() / 2;
+            while (low < high) {
+                uint64_t middle = (low + high) / 2;
+                if (containerIt->values[2 * middle] <= offset) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            if (low == 0) {
+                return false;
+            }
+            uint64_t runBegin = containerIt->values[2 * (low - 1)];
+            return offset <= runBegin + containerIt->values[2 * (low - 1) + 1];
+        }
+        case ContainerType::Bitmap:
+            return (containerIt->words[offset >> 6] & (1ull << (offset & 63))) != 0;
+    }
+    STORM_LOG_ASSERT(false, "Unknown container type.");
+    return false;
+}
+
+uint64_t CompressedBitVector::getNumberOfSetBits() const {
+    uint64_t result = 0;
+    for (auto const& container : containers) {
+        result += container.numberOfSetBits;
+    }
+    return result;
+}
+
+std::size_t CompressedBitVector::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + containers.capacity() * sizeof(Container);
+    for (auto const& container : containers) {
+        result += container.values.capacity() * sizeof(uint16_t) + container.words.capacity() * sizeof(uint64_t);
+    }
+    return result;
+}
+
+bool CompressedBitVector::Container::operator==(Container const& other) const {
+    return chunk == other.chunk && type == other.type && numberOfSetBits == other.numberOfSetBits && values == other.values && words == other.words;
+}
+
+bool CompressedBitVector::operator==(CompressedBitVector const& other) const {
+    // As the representation of every chunk is uniquely determined by its set bits, equal bit vectors have equal containers.
+    return bitCount == other.bitCount && containers == other.containers;
+}
+
+bool CompressedBitVector::operator!=(CompressedBitVector const& other) const {
+    return !(*this == other);
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A compressed, immutable representation of a bit vector in the style of Roaring bitmaps. The index space is divided into chunks of 2^16 bits
+ * and every chunk that contains a set bit is stored in a container. Depending on which is smallest, a container holds the sorted offsets of
+ * the set bits, the runs of set bits or a plain bitmap of the chunk. Bit vectors with very few or very many set bits therefore need much less
+ * memory than a BitVector.
+ */
+class CompressedBitVector {
+   public:
+    /*!
+     * Constructs an empty compressed bit vector of size zero.
+     */
+    CompressedBitVector();
+
+    /*!
+     * Constructs the compressed representation of the given bit vector.
+     *
+     * @param bitVector The bit vector to compress.
+     */
+    explicit CompressedBitVector(BitVector const& bitVector);
+
+    /*!
+     * Decompresses the bit vector.
+     *
+     * @return The uncompressed bit vector.
+     */
+    BitVector toBitVector() const;
+
+    /*!
+     * Retrieves the number of bits of the (uncompressed) bit vector.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the truth value of the bit at the given index. Indices beyond the size are considered to be unset.
+     *
+     * @param index The index of the bit to access.
+     * @return True iff the bit at the given index is set.
+     */
+    bool get(uint64_t index) const;
+
+    /*!
+     * Retrieves the number of set bits.
+     */
+    uint64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves the number of bytes that this compressed bit vector occupies in memory.
+     */
+    std::size_t getSizeInBytes() const;
+
+    bool operator==(CompressedBitVector const& other) const;
+    bool operator!=(CompressedBitVector const& other) const;
+
+   private:
+    enum class ContainerType : uint8_t { Array, Runs, Bitmap };
+
+    struct Container {
+        // The index of the chunk, i.e. the index of its first bit divided by 2^16.
+        uint64_t chunk;
+        ContainerType type;
+        uint32_t numberOfSetBits;
+
+        // For arrays, the sorted offsets of the set bits. For runs, the offset of the first bit and the length minus one of every run.
+        std::vector<uint16_t> values;
+
+        // For bitmaps, the bits of the chunk, where the bit with offset i is bit i % 64 of word i / 64.
+        std::vector<uint64_t> words;
+
+        bool operator==(Container const& other) const;
+    };
+
+    /*!
+     * Creates the smallest container for the chunk with the given index whose set bits are given as runs [begin, end) of offsets.
+     */
+    static Container createContainer(uint64_t chunk, std::vector<std::pair<uint32_t, uint32_t>> const& runs);
+
+    // The number of bits of the uncompressed bit vector.
+    uint64_t bitCount;
+
+    // The containers of all chunks with a set bit, sorted by chunk.
+    std::vector<Container> containers;
+};
+
+}  // namespace storage
+}  // namespace storm
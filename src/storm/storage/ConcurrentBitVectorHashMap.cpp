@@ -0,0 +1,136 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+ConcurrentBitVectorHashMap<ValueType>::Segment::Segment(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : map(bucketSize, initialSize, loadFactor) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ConcurrentBitVectorHashMap<ValueType>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor, uint64_t numberOfSegments)
+    : bucketSize(bucketSize), loadFactor(loadFactor), segmentShift(64), numberOfElements(0), nextIndex(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    if (numberOfSegments == 0) {
+        // Use enough segments to make it unlikely that two threads access the same segment at the same time.
+        numberOfSegments = 16 * std::max<uint64_t>(1, std::thread::hardware_concurrency());
+    }
+    uint64_t actualNumberOfSegments = 1;
+    while (actualNumberOfSegments < numberOfSegments) {
+        actualNumberOfSegments <<= 1;
+        --segmentShift;
+    }
+
+    uint64_t initialSegmentSize = std::max<uint64_t>(initialSize / actualNumberOfSegments, 16);
+    segments.reserve(actualNumberOfSegments);
+    for (uint64_t segment = 0; segment < actualNumberOfSegments; ++segment) {
+        segments.push_back(std::make_unique<Segment>(bucketSize, initialSegmentSize, loadFactor));
+    }
+}
+
+template<typename ValueType>
+typename ConcurrentBitVectorHashMap<ValueType>::Segment& ConcurrentBitVectorHashMap<ValueType>::getSegment(storm::storage::BitVector const& key) const {
+    if (segmentShift == 64) {
+        return *segments.front();
+    }
+    // Fibonacci hashing to spread the hash value over the upper bits.
+    uint64_t hash = static_cast<uint64_t>(segmentHasher(key)) * 11400714819323198485ull;
+    return *segments[hash >> segmentShift];
+}
+
+template<typename ValueType>
+ValueType ConcurrentBitVectorHashMap<ValueType>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    Segment& segment = getSegment(key);
+    {
+        std::shared_lock<std::shared_mutex> lock(segment.mutex);
+        if (segment.map.contains(key)) {
+            return segment.map.getValue(key);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(segment.mutex);
+    uint64_t sizeBefore = segment.map.size();
+    ValueType result = segment.map.findOrAdd(key, value);
+    if (segment.map.size() != sizeBefore) {
+        ++numberOfElements;
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType>::findOrAddNextIndex(storm::storage::BitVector const& key) {
+    Segment& segment = getSegment(key);
+    {
+        std::shared_lock<std::shared_mutex> lock(segment.mutex);
+        if (segment.map.contains(key)) {
+            return std::make_pair(segment.map.getValue(key), false);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(segment.mutex);
+    // Another thread might have inserted the key in the meantime.
+    if (segment.map.contains(key)) {
+        return std::make_pair(segment.map.getValue(key), false);
+    }
+    ValueType index = static_cast<ValueType>(nextIndex++);
+    segment.map.findOrAdd(key, index);
+    ++numberOfElements;
+    return std::make_pair(index, true);
+}
+
+template<typename ValueType>
+bool ConcurrentBitVectorHashMap<ValueType>::find(storm::storage::BitVector const& key, ValueType& value) const {
+    Segment& segment = getSegment(key);
+    std::shared_lock<std::shared_mutex> lock(segment.mutex);
+    if (segment.map.contains(key)) {
+        value = segment.map.getValue(key);
+        return true;
+    }
+    return false;
+}
+
+template<typename ValueType>
+bool ConcurrentBitVectorHashMap<ValueType>::contains(storm::storage::BitVector const& key) const {
+    Segment& segment = getSegment(key);
+    std::shared_lock<std::shared_mutex> lock(segment.mutex);
+    return segment.map.contains(key);
+}
+
+template<typename ValueType>
+ValueType ConcurrentBitVectorHashMap<ValueType>::getValue(storm::storage::BitVector const& key) const {
+    Segment& segment = getSegment(key);
+    std::shared_lock<std::shared_mutex> lock(segment.mutex);
+    return segment.map.getValue(key);
+}
+
+template<typename ValueType>
+uint64_t ConcurrentBitVectorHashMap<ValueType>::size() const {
+    return numberOfElements.load();
+}
+
+template<typename ValueType>
+uint64_t ConcurrentBitVectorHashMap<ValueType>::getNumberOfSegments() const {
+    return segments.size();
+}
+
+template<typename ValueType>
+BitVectorHashMap<ValueType> ConcurrentBitVectorHashMap<ValueType>::toBitVectorHashMap() const {
+    BitVectorHashMap<ValueType> result(bucketSize, static_cast<uint64_t>(size() / loadFactor) + 1, loadFactor);
+    for (auto const& segment : segments) {
+        for (auto const& keyValuePair : segment->map) {
+            result.findOrAdd(keyValuePair.first, keyValuePair.second);
+        }
+    }
+    return result;
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
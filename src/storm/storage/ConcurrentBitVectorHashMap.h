@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A hash-map whose keys are bit vectors and that can be queried and extended by multiple threads concurrently. The map is split into segments
+ * (selected by a hash of the key) that are individual BitVectorHashMaps protected by a reader-writer lock. Hence, lookups of different threads do not
+ * block each other and increasing the size of the map only blocks the accesses to one segment instead of the whole map.
+ * As for BitVectorHashMap, the keys must be bit vectors with a length that is a multiple of 64.
+ */
+template<typename ValueType>
+class ConcurrentBitVectorHashMap {
+   public:
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available (in total).
+     * @param loadFactor The load factor that determines at which point the size of the storage of a segment is increased.
+     * @param numberOfSegments The number of segments, which is rounded up to a power of two. Zero selects a default based on the hardware concurrency.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, uint64_t numberOfSegments = 0);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. If multiple threads insert the same key concurrently, exactly one of the values is inserted.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The value the key is mapped to after the call.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is not found, the key is inserted and mapped to the next free index, i.e., the values of the
+     * inserted keys are 0, 1, 2, ... in the order of insertion (across all threads). Keys inserted via findOrAdd do not consume indices.
+     *
+     * @param key The key to search or insert.
+     * @return A pair whose first component is the value the key is mapped to and whose second component indicates whether the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAddNextIndex(storm::storage::BitVector const& key);
+
+    /*!
+     * Searches for the given key in the map.
+     *
+     * @param key The key to search.
+     * @param value If the key is found, this is set to the value associated with the key.
+     * @return True iff the key is contained in the map.
+     */
+    bool find(storm::storage::BitVector const& key, ValueType& value) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of segments of the map.
+     */
+    uint64_t getNumberOfSegments() const;
+
+    /*!
+     * Creates a (sequential) BitVectorHashMap with the same content. This must not be called while other threads modify the map.
+     */
+    BitVectorHashMap<ValueType> toBitVectorHashMap() const;
+
+   private:
+    struct Segment {
+        Segment(uint64_t bucketSize, uint64_t initialSize, double loadFactor);
+
+        // Protects the map of this segment. Lookups acquire it in shared mode, insertions in exclusive mode.
+        mutable std::shared_mutex mutex;
+
+        // The map storing the keys of this segment.
+        BitVectorHashMap<ValueType> map;
+    };
+
+    /*!
+     * Retrieves the segment that is responsible for the given key.
+     */
+    Segment& getSegment(storm::storage::BitVector const& key) const;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The load factor determining when the size of a segment is increased.
+    double loadFactor;
+
+    // The number of segments is 2^(64 - segmentShift).
+    uint64_t segmentShift;
+
+    // The segments of the map.
+    std::vector<std::unique_ptr<Segment>> segments;
+
+    // The number of elements in this map.
+    std::atomic<uint64_t> numberOfElements;
+
+    // The next index handed out by findOrAddNextIndex.
+    std::atomic<uint64_t> nextIndex;
+
+    // The hash function used to select the segment. This is different from the one used within the segments, which would otherwise only see keys
+    // whose hash values agree on some bits.
+    FNV1aBitVectorHash segmentHasher;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <vector>
 
@@ -36,17 +37,7 @@ class ConsecutiveUint64DynamicPriorityQueue {
         if (position >= container.size()) {
             return;
         }
-
-        uint64_t parentPosition = (position - 1) / 2;
-        while (position > 0 && compare(container[parentPosition], container[position])) {
-            std::swap(positions[container[parentPosition]], positions[container[position]]);
-            std::swap(container[parentPosition], container[position]);
-
-            position = parentPosition;
-            parentPosition = (position - 1) / 2;
-        }
-
-        STORM_LOG_ASSERT(std::is_heap(container.begin(), container.end(), compare), "Heap structure lost.");
+        siftUp(position);
     }
 
     bool contains(uint64_t element) const {
@@ -65,12 +56,18 @@ class ConsecutiveUint64DynamicPriorityQueue {
         return container.front();
     }
 
+    /*!
+     * Inserts an element that is currently not contained in the queue.
+     */
     void push(uint64_t const& item) {
+        STORM_LOG_ASSERT(!contains(item), "Element is already contained.");
+        positions[item] = container.size();
         container.emplace_back(item);
-        std::push_heap(container.begin(), container.end(), compare);
+        siftUp(container.size() - 1);
     }
 
     void pop() {
+        uint64_t const removedElement = container.front();
         if (container.size() > 1) {
             // Swap max element to back.
             std::swap(positions[container.front()], positions[container.back()]);
@@ -110,6 +107,8 @@ class ConsecutiveUint64DynamicPriorityQueue {
         } else {
             container.pop_back();
         }
+        // Mark the removed element as not contained.
+        positions[removedElement] = std::numeric_limits<uint64_t>::max();
 
         STORM_LOG_ASSERT(std::is_heap(container.begin(), container.end(), compare), "Heap structure lost.");
     }
@@ -121,6 +120,19 @@ class ConsecutiveUint64DynamicPriorityQueue {
     }
 
    private:
+    void siftUp(uint64_t position) {
+        uint64_t parentPosition = (position - 1) / 2;
+        while (position > 0 && compare(container[parentPosition], container[position])) {
+            std::swap(positions[container[parentPosition]], positions[container[position]]);
+            std::swap(container[parentPosition], container[position]);
+
+            position = parentPosition;
+            parentPosition = (position - 1) / 2;
+        }
+
+        STORM_LOG_ASSERT(std::is_heap(container.begin(), container.end(), compare), "Heap structure lost.");
+    }
+
     bool checkPositions() const {
         uint64_t position = 0;
         for (auto const& e : container) {
@@ -0,0 +1,214 @@
+#include "storm/storage/DistributedSparseMatrix.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+DistributedSparseMatrix::DistributedSparseMatrix(std::shared_ptr<storm::utility::Communicator> const& communicator, std::vector<uint64_t> const& stateOffsets,
+                                                 storm::storage::SparseMatrix<double> const& localRows)
+    : communicator(communicator), stateOffsets(stateOffsets) {
+    uint64_t size = communicator->getSize();
+    uint64_t rank = communicator->getRank();
+    STORM_LOG_THROW(stateOffsets.size() == size + 1 && std::is_sorted(stateOffsets.begin(), stateOffsets.end()), storm::exceptions::InvalidArgumentException,
+                    "Invalid partition of the states.");
+    uint64_t firstState = stateOffsets[rank];
+    uint64_t numberOfLocalStates = stateOffsets[rank + 1] - firstState;
+    STORM_LOG_THROW(localRows.getRowGroupCount() == numberOfLocalStates, storm::exceptions::InvalidArgumentException,
+                    "The local rows have " << localRows.getRowGroupCount() << " row groups, but " << numberOfLocalStates << " states are owned.");
+
+    // Collect the states of other members that occur as columns. As the states are numbered consecutively, sorting them also groups them by owner.
+    for (auto const& entry : localRows) {
+        uint64_t column = entry.getColumn();
+        STORM_LOG_THROW(column < stateOffsets.back(), storm::exceptions::InvalidArgumentException, "Column " << column << " exceeds the number of states.");
+        if (column < firstState || column >= stateOffsets[rank + 1]) {
+            haloStates.push_back(column);
+        }
+    }
+    std::sort(haloStates.begin(), haloStates.end());
+    haloStates.erase(std::unique(haloStates.begin(), haloStates.end()), haloStates.end());
+
+    std::vector<std::vector<uint64_t>> requests(size);
+    haloOffsets.assign(size + 1, 0);
+    for (uint64_t member = 0, position = 0; member < size; ++member) {
+        haloOffsets[member] = position;
+        while (position < haloStates.size() && haloStates[position] < stateOffsets[member + 1]) {
+            requests[member].push_back(haloStates[position]);
+            ++position;
+        }
+    }
+    haloOffsets[size] = haloStates.size();
+
+    // Every member learns which of its states the others need.
+    sendIndices = communicator->allToAll(requests);
+    for (auto& indices : sendIndices) {
+        for (auto& index : indices) {
+            index -= firstState;
+        }
+    }
+
+    bool hasRowGrouping = !localRows.hasTrivialRowGrouping();
+    uint64_t numberOfColumns = numberOfLocalStates + haloStates.size();
+    storm::storage::SparseMatrixBuilder<double> builder(localRows.getRowCount(), numberOfColumns, localRows.getEntryCount(), true, hasRowGrouping,
+                                                        hasRowGrouping ? numberOfLocalStates : 0);
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> rowEntries;
+    for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+        if (hasRowGrouping) {
+            builder.newRowGroup(localRows.getRowGroupIndices()[state]);
+        }
+        for (uint64_t row = localRows.getRowGroupIndices()[state]; row < localRows.getRowGroupIndices()[state + 1]; ++row) {
+            // Renumbering may change the order of the columns (the halo states of lower ranks move behind the owned states).
+            rowEntries.clear();
+            for (auto const& entry : localRows.getRow(row)) {
+                uint64_t column = entry.getColumn();
+                if (column >= firstState && column < stateOffsets[rank + 1]) {
+                    column -= firstState;
+                } else {
+                    column = numberOfLocalStates + (std::lower_bound(haloStates.begin(), haloStates.end(), column) - haloStates.begin());
+                }
+                rowEntries.emplace_back(column, entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(),
+                      [](storm::storage::MatrixEntry<uint_fast64_t, double> const& a, storm::storage::MatrixEntry<uint_fast64_t, double> const& b) {
+                          return a.getColumn() < b.getColumn();
+                      });
+            for (auto const& entry : rowEntries) {
+                builder.addNextValue(row, entry.getColumn(), entry.getValue());
+            }
+        }
+    }
+    localMatrix = builder.build();
+    STORM_LOG_DEBUG("Member " << rank << " owns " << numberOfLocalStates << " states with " << localMatrix.getEntryCount() << " entries and a halo of "
+                              << haloStates.size() << " states.");
+}
+
+DistributedSparseMatrix DistributedSparseMatrix::createFromGlobalMatrix(std::shared_ptr<storm::utility::Communicator> const& communicator,
+                                                                        storm::storage::SparseMatrix<double> const& matrix) {
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<uint64_t> firstEntries(matrix.getRowGroupCount() + 1, 0);
+    for (uint64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+        firstEntries[state + 1] = firstEntries[state] + matrix.getRowGroupEntryCount(state);
+    }
+    std::vector<uint64_t> stateOffsets =
+        computeBalancedStateOffsets(matrix.getRowGroupCount(), communicator->getSize(), [&firstEntries](uint64_t state) { return firstEntries[state]; });
+
+    uint64_t rank = communicator->getRank();
+    uint64_t firstRow = rowGroupIndices[stateOffsets[rank]];
+    uint64_t endRow = rowGroupIndices[stateOffsets[rank + 1]];
+    bool hasRowGrouping = !matrix.hasTrivialRowGrouping();
+    storm::storage::SparseMatrixBuilder<double> builder(endRow - firstRow, matrix.getColumnCount(),
+                                                        firstEntries[stateOffsets[rank + 1]] - firstEntries[stateOffsets[rank]], true, hasRowGrouping,
+                                                        hasRowGrouping ? stateOffsets[rank + 1] - stateOffsets[rank] : 0);
+    for (uint64_t state = stateOffsets[rank]; state < stateOffsets[rank + 1]; ++state) {
+        if (hasRowGrouping) {
+            builder.newRowGroup(rowGroupIndices[state] - firstRow);
+        }
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                builder.addNextValue(row - firstRow, entry.getColumn(), entry.getValue());
+            }
+        }
+    }
+    return DistributedSparseMatrix(communicator, stateOffsets, builder.build());
+}
+
+std::vector<uint64_t> DistributedSparseMatrix::computeBalancedStateOffsets(uint64_t numberOfStates, uint64_t numberOfParts,
+                                                                           std::function<uint64_t(uint64_t)> const& firstEntryOfState) {
+    STORM_LOG_THROW(numberOfParts > 0, storm::exceptions::InvalidArgumentException, "Cannot partition into zero parts.");
+    uint64_t numberOfEntries = firstEntryOfState(numberOfStates);
+    std::vector<uint64_t> result(numberOfParts + 1, 0);
+    for (uint64_t part = 1; part < numberOfParts; ++part) {
+        uint64_t targetEntry = (numberOfEntries / numberOfParts) * part + (numberOfEntries % numberOfParts) * part / numberOfParts;
+        // Find the first state that starts at or after the target entry.
+        uint64_t low = result[part - 1], high = numberOfStates;
+        while (low < high) {
+            uint64_t middle = low + (high - low) / 2;
+            if (firstEntryOfState(middle) < targetEntry) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        result[part] = low;
+    }
+    result[numberOfParts] = numberOfStates;
+    return result;
+}
+
+storm::utility::Communicator& DistributedSparseMatrix::getCommunicator() const {
+    return *communicator;
+}
+
+std::vector<uint64_t> const& DistributedSparseMatrix::getStateOffsets() const {
+    return stateOffsets;
+}
+
+uint64_t DistributedSparseMatrix::getFirstLocalState() const {
+    return stateOffsets[communicator->getRank()];
+}
+
+uint64_t DistributedSparseMatrix::getNumberOfLocalStates() const {
+    return stateOffsets[communicator->getRank() + 1] - stateOffsets[communicator->getRank()];
+}
+
+uint64_t DistributedSparseMatrix::getNumberOfHaloStates() const {
+    return haloStates.size();
+}
+
+uint64_t DistributedSparseMatrix::getNumberOfStates() const {
+    return stateOffsets.back();
+}
+
+storm::storage::SparseMatrix<double> const& DistributedSparseMatrix::getLocalMatrix() const {
+    return localMatrix;
+}
+
+std::vector<uint64_t> const& DistributedSparseMatrix::getHaloStates() const {
+    return haloStates;
+}
+
+void DistributedSparseMatrix::exchangeHalo(std::vector<double>& values) const {
+    uint64_t numberOfLocalStates = getNumberOfLocalStates();
+    STORM_LOG_ASSERT(values.size() == numberOfLocalStates + haloStates.size(), "Unexpected size of vector.");
+    std::vector<std::vector<double>> outgoing(sendIndices.size());
+    for (uint64_t member = 0; member < sendIndices.size(); ++member) {
+        outgoing[member].reserve(sendIndices[member].size());
+        for (auto const& index : sendIndices[member]) {
+            outgoing[member].push_back(values[index]);
+        }
+    }
+    std::vector<std::vector<double>> incoming = communicator->allToAll(outgoing);
+    for (uint64_t member = 0; member < incoming.size(); ++member) {
+        STORM_LOG_ASSERT(incoming[member].size() == haloOffsets[member + 1] - haloOffsets[member], "Unexpected number of halo values.");
+        std::copy(incoming[member].begin(), incoming[member].end(), values.begin() + numberOfLocalStates + haloOffsets[member]);
+    }
+}
+
+storm::storage::BitVector DistributedSparseMatrix::getLocalPart(storm::storage::BitVector const& states) const {
+    STORM_LOG_THROW(states.size() == getNumberOfStates(), storm::exceptions::InvalidArgumentException, "Unexpected size of the set of states.");
+    storm::storage::BitVector result(getNumberOfLocalStates());
+    uint64_t firstState = getFirstLocalState();
+    uint64_t endState = firstState + getNumberOfLocalStates();
+    for (uint64_t state = states.getNextSetIndex(firstState); state < endState; state = states.getNextSetIndex(state + 1)) {
+        result.set(state - firstState);
+    }
+    return result;
+}
+
+std::vector<double> DistributedSparseMatrix::gather(std::vector<double> const& localValues) const {
+    STORM_LOG_ASSERT(localValues.size() >= getNumberOfLocalStates(), "Unexpected size of vector.");
+    std::vector<double> ownValues(localValues.begin(), localValues.begin() + getNumberOfLocalStates());
+    std::vector<std::vector<double>> incoming = communicator->allToAll(std::vector<std::vector<double>>(communicator->getSize(), ownValues));
+    std::vector<double> result;
+    result.reserve(getNumberOfStates());
+    for (auto const& memberValues : incoming) {
+        result.insert(result.end(), memberValues.begin(), memberValues.end());
+    }
+    return result;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Communicator.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * The part of a sparse matrix that is owned by one member of a group of processes. The states (i.e., row groups) are partitioned into
+ * consecutive ranges, one per member. Each member stores the rows of its states, where the columns of its own states are renumbered to
+ * 0, ..., n-1 and the columns of the states owned by other members (the "halo") are renumbered to n, n+1, .... Vectors over the local columns
+ * therefore consist of the values of the own states followed by copies of the values of the halo states, which are updated by exchangeHalo.
+ */
+class DistributedSparseMatrix {
+   public:
+    /*!
+     * Creates the part of the calling member. This is a collective operation.
+     *
+     * @param communicator The group of processes.
+     * @param stateOffsets For each member, the first state that it owns, followed by the overall number of states.
+     * @param localRows The rows of the owned states, where the row grouping is relative to the first owned state and the columns are the global
+     * indices of the states.
+     */
+    DistributedSparseMatrix(std::shared_ptr<storm::utility::Communicator> const& communicator, std::vector<uint64_t> const& stateOffsets,
+                            storm::storage::SparseMatrix<double> const& localRows);
+
+    /*!
+     * Creates the part of the calling member from a matrix that is known to all members. The states are partitioned such that every member
+     * owns roughly the same number of entries. This is a collective operation.
+     */
+    static DistributedSparseMatrix createFromGlobalMatrix(std::shared_ptr<storm::utility::Communicator> const& communicator,
+                                                          storm::storage::SparseMatrix<double> const& matrix);
+
+    /*!
+     * Partitions the states into the given number of consecutive ranges with roughly the same number of entries each.
+     *
+     * @param numberOfStates The overall number of states.
+     * @param numberOfParts The number of ranges.
+     * @param firstEntryOfState Retrieves the index of the first entry of the given state (with state numberOfStates yielding the number of entries).
+     * @return For each range, its first state, followed by the number of states.
+     */
+    static std::vector<uint64_t> computeBalancedStateOffsets(uint64_t numberOfStates, uint64_t numberOfParts,
+                                                             std::function<uint64_t(uint64_t)> const& firstEntryOfState);
+
+    storm::utility::Communicator& getCommunicator() const;
+
+    /*!
+     * Retrieves for each member the first state that it owns, followed by the overall number of states.
+     */
+    std::vector<uint64_t> const& getStateOffsets() const;
+
+    uint64_t getFirstLocalState() const;
+    uint64_t getNumberOfLocalStates() const;
+    uint64_t getNumberOfHaloStates() const;
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Retrieves the rows of the owned states with renumbered columns.
+     */
+    storm::storage::SparseMatrix<double> const& getLocalMatrix() const;
+
+    /*!
+     * Retrieves the global indices of the halo states in the order of their local columns.
+     */
+    std::vector<uint64_t> const& getHaloStates() const;
+
+    /*!
+     * Overwrites the halo part of the given vector (i.e., the entries after the owned states) with the current values of the owning members.
+     * This is a collective operation.
+     */
+    void exchangeHalo(std::vector<double>& values) const;
+
+    /*!
+     * Restricts the given set of (global) states to the owned states.
+     */
+    storm::storage::BitVector getLocalPart(storm::storage::BitVector const& states) const;
+
+    /*!
+     * Collects the values of the owned states of all members into a vector over all states. This is a collective operation that should only be
+     * used if the whole vector fits into the memory of a single process.
+     */
+    std::vector<double> gather(std::vector<double> const& localValues) const;
+
+   private:
+    std::shared_ptr<storm::utility::Communicator> communicator;
+    std::vector<uint64_t> stateOffsets;
+    storm::storage::SparseMatrix<double> localMatrix;
+    std::vector<uint64_t> haloStates;
+
+    // For each member, the position of its first state in the halo.
+    std::vector<uint64_t> haloOffsets;
+
+    // For each member, the (local) indices of the owned states whose values it needs.
+    std::vector<std::vector<uint64_t>> sendIndices;
+};
+
+}  // namespace storage
+}  // namespace storm
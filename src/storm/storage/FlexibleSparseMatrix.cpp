@@ -1,5 +1,8 @@
 #include "storm/storage/FlexibleSparseMatrix.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -10,14 +13,30 @@
 
 namespace storm {
 namespace storage {
+namespace {
+template<typename RowType>
+std::vector<RowType> createPooledRows(std::shared_ptr<MemoryPool> const& pool, uint_fast64_t numberOfRows) {
+    // Note that the rows are constructed from the allocator, as copies of a row would be placed on the system heap.
+    std::vector<RowType> result;
+    result.reserve(numberOfRows);
+    typename RowType::allocator_type allocator(pool);
+    for (uint_fast64_t row = 0; row < numberOfRows; ++row) {
+        result.emplace_back(allocator);
+    }
+    return result;
+}
+}  // namespace
+
 template<typename ValueType>
-FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0) {
+FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows)
+    : pool(std::make_shared<MemoryPool>()), data(createPooledRows<row_type>(pool, rows)), columnCount(0), nonzeroEntryCount(0) {
     // Intentionally left empty.
 }
 
 template<typename ValueType>
 FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, bool setAllValuesToOne, bool revertEquationSystem)
-    : data(matrix.getRowCount()),
+    : pool(std::make_shared<MemoryPool>()),
+      data(createPooledRows<row_type>(pool, matrix.getRowCount())),
       columnCount(matrix.getColumnCount()),
       nonzeroEntryCount(matrix.getNonzeroEntryCount()),
       trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
@@ -29,6 +48,12 @@ FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(storm::storage::SparseMatr
     for (index_type rowIndex = 0; rowIndex < matrix.getRowCount(); ++rowIndex) {
         typename storm::storage::SparseMatrix<ValueType>::const_rows row = matrix.getRow(rowIndex);
         reserveInRow(rowIndex, row.getNumberOfEntries());
+        if (!setAllValuesToOne && !revertEquationSystem) {
+            // Plain copies of the rows only need to skip the zero entries.
+            std::copy_if(row.begin(), row.end(), std::back_inserter(getRow(rowIndex)),
+                         [](storm::storage::MatrixEntry<index_type, ValueType> const& entry) { return !storm::utility::isZero(entry.getValue()); });
+            continue;
+        }
         for (auto const& element : row) {
             // If the probability is zero, we skip this entry.
             if (storm::utility::isZero(element.getValue())) {
@@ -91,6 +116,11 @@ typename FlexibleSparseMatrix<ValueType>::row_type const& FlexibleSparseMatrix<V
     return getRow(rowGroupIndices[rowGroup] + offset);
 }
 
+template<typename ValueType>
+typename FlexibleSparseMatrix<ValueType>::row_allocator_type FlexibleSparseMatrix<ValueType>::getRowAllocator() const {
+    return row_allocator_type(pool);
+}
+
 template<typename ValueType>
 std::vector<typename FlexibleSparseMatrix<ValueType>::index_type> const& FlexibleSparseMatrix<ValueType>::getRowGroupIndices() const {
     return rowGroupIndices;
@@ -167,7 +197,7 @@ void FlexibleSparseMatrix<ValueType>::filterEntries(storm::storage::BitVector co
             row.shrink_to_fit();
             continue;
         }
-        row_type newRow;
+        row_type newRow(row.get_allocator());
         for (auto const& element : row) {
             if (columnConstraint.get(element.getColumn())) {
                 newRow.push_back(element);
@@ -179,35 +209,29 @@ void FlexibleSparseMatrix<ValueType>::filterEntries(storm::storage::BitVector co
 
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> FlexibleSparseMatrix<ValueType>::createSparseMatrix() {
-    uint_fast64_t numEntries = 0;
+    // Assemble the internal representation of the sparse matrix directly instead of adding the entries one by one.
+    std::vector<index_type> rowIndications;
+    rowIndications.reserve(getRowCount() + 1);
+    rowIndications.push_back(0);
     for (auto const& row : this->data) {
-        numEntries += row.size();
+        rowIndications.push_back(rowIndications.back() + row.size());
     }
 
-    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(getRowCount(), getColumnCount(), numEntries, hasTrivialRowGrouping(),
-                                                                 hasTrivialRowGrouping() ? 0 : getRowGroupCount());
-    uint_fast64_t currRowIndex = 0;
-    auto rowGroupIndexIt = getRowGroupIndices().begin();
+    std::vector<storm::storage::MatrixEntry<index_type, ValueType>> columnsAndValues;
+    columnsAndValues.reserve(rowIndications.back());
+    index_type resultColumnCount = getColumnCount();
     for (auto const& row : this->data) {
-        if (!hasTrivialRowGrouping()) {
-            while (currRowIndex >= *rowGroupIndexIt) {
-                matrixBuilder.newRowGroup(currRowIndex);
-                ++rowGroupIndexIt;
-            }
-        }
-        for (auto const& entry : row) {
-            matrixBuilder.addNextValue(currRowIndex, entry.getColumn(), entry.getValue());
+        columnsAndValues.insert(columnsAndValues.end(), row.begin(), row.end());
+        if (!row.empty()) {
+            resultColumnCount = std::max(resultColumnCount, row.back().getColumn() + 1);
         }
-        ++currRowIndex;
     }
-    // The matrix might end with one or more empty row groups
+
+    boost::optional<std::vector<index_type>> resultRowGroupIndices;
     if (!hasTrivialRowGrouping()) {
-        while (currRowIndex >= *rowGroupIndexIt) {
-            matrixBuilder.newRowGroup(currRowIndex);
-            ++rowGroupIndexIt;
-        }
+        resultRowGroupIndices = getRowGroupIndices();
     }
-    return matrixBuilder.build();
+    return storm::storage::SparseMatrix<ValueType>(resultColumnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(resultRowGroupIndices));
 }
 
 template<typename ValueType>
@@ -2,8 +2,10 @@
 #define STORM_STORAGE_FLEXIBLESPARSEMATRIX_H_
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
+#include "storm/storage/MemoryPool.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
 
@@ -15,7 +17,10 @@ class MatrixEntry;
 class BitVector;
 
 /*!
- * The flexible sparse matrix is used during state elimination.
+ * The flexible sparse matrix is used during state elimination. The rows of a matrix are allocated from a memory pool that is shared by all
+ * rows. This avoids the overhead of many small heap allocations and keeps the memory that rows release when they are modified available for
+ * other rows of the same matrix. Rows that are created outside the matrix (e.g. as temporary buffers) may use the system allocator. To keep
+ * them in the pool as well, they can be constructed with the allocator of an existing row (see getRowAllocator).
  */
 template<typename ValueType>
 class FlexibleSparseMatrix {
@@ -25,7 +30,9 @@ class FlexibleSparseMatrix {
 
     typedef uint_fast64_t index_type;
     typedef ValueType value_type;
-    typedef std::vector<storm::storage::MatrixEntry<index_type, value_type>> row_type;
+    typedef storm::storage::MatrixEntry<index_type, value_type> entry_type;
+    typedef PooledAllocator<entry_type> row_allocator_type;
+    typedef std::vector<entry_type, row_allocator_type> row_type;
     typedef typename row_type::iterator iterator;
     typedef typename row_type::const_iterator const_iterator;
 
@@ -88,6 +95,13 @@ class FlexibleSparseMatrix {
      */
     row_type const& getRow(index_type rowGroup, index_type entryInGroup) const;
 
+    /*!
+     * Retrieves the allocator from which the rows of this matrix obtain their memory.
+     *
+     * @return The allocator of the rows.
+     */
+    row_allocator_type getRowAllocator() const;
+
     /*!
      * Returns the grouping of rows of this matrix.
      *
@@ -205,6 +219,10 @@ class FlexibleSparseMatrix {
     friend std::ostream& operator<<(std::ostream& out, FlexibleSparseMatrix<TPrime> const& matrix);
 
    private:
+    // The pool from which the rows obtain their memory. It is shared with the rows (via their allocators), so rows that are moved out of the
+    // matrix stay valid.
+    std::shared_ptr<MemoryPool> pool;
+
     std::vector<row_type> data;
 
     // The number of columns of the matrix.
@@ -0,0 +1,144 @@
+#include "storm/storage/MappedSparseMatrix.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace detail {
+
+// The number of entries whose columns and values are prefetched at once.
+uint64_t const PrefetchEntries = 1ull << 19;
+
+void adviseWillNeed(void const* data, uint64_t bytes) {
+#if defined LINUX || defined MACOS
+    static uint64_t const pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = reinterpret_cast<uintptr_t>(data) / pageSize * pageSize;
+    uintptr_t end = reinterpret_cast<uintptr_t>(data) + bytes;
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+#endif
+}
+
+}  // namespace detail
+
+MappedSparseMatrix::MappedSparseMatrix(std::shared_ptr<void const> const& owner, uint64_t rowCount, uint64_t columnCount, uint64_t rowGroupCount,
+                                       uint64_t const* rowIndications, uint64_t const* columns, double const* values, uint64_t const* rowGroupIndices)
+    : owner(owner),
+      rowCount(rowCount),
+      columnCount(columnCount),
+      rowGroupCount(rowGroupCount),
+      rowIndications(rowIndications),
+      columns(columns),
+      values(values),
+      rowGroupIndices(rowGroupIndices),
+      prefetchingEnabled(true) {
+    STORM_LOG_THROW(rowGroupIndices != nullptr || rowGroupCount == rowCount, storm::exceptions::InvalidArgumentException,
+                    "A trivial row grouping requires as many row groups as rows.");
+}
+
+uint64_t MappedSparseMatrix::getRowCount() const {
+    return rowCount;
+}
+
+uint64_t MappedSparseMatrix::getColumnCount() const {
+    return columnCount;
+}
+
+uint64_t MappedSparseMatrix::getEntryCount() const {
+    return rowIndications[rowCount];
+}
+
+uint64_t MappedSparseMatrix::getRowGroupCount() const {
+    return rowGroupCount;
+}
+
+bool MappedSparseMatrix::hasTrivialRowGrouping() const {
+    return rowGroupIndices == nullptr;
+}
+
+uint64_t MappedSparseMatrix::getFirstRowOfGroup(uint64_t group) const {
+    return rowGroupIndices == nullptr ? group : rowGroupIndices[group];
+}
+
+bool MappedSparseMatrix::isPrefetchingEnabled() const {
+    return prefetchingEnabled;
+}
+
+void MappedSparseMatrix::setPrefetchingEnabled(bool value) {
+    prefetchingEnabled = value;
+}
+
+void MappedSparseMatrix::prefetch(uint64_t entry, uint64_t& prefetchedUntil) const {
+    // Stay one chunk ahead of the entries that are currently consumed.
+    if (!prefetchingEnabled || entry + detail::PrefetchEntries <= prefetchedUntil) {
+        return;
+    }
+    uint64_t first = std::max(entry, prefetchedUntil);
+    uint64_t end = std::min(getEntryCount(), entry + 2 * detail::PrefetchEntries);
+    if (first < end) {
+        detail::adviseWillNeed(columns + first, (end - first) * sizeof(uint64_t));
+        detail::adviseWillNeed(values + first, (end - first) * sizeof(double));
+    }
+    prefetchedUntil = end;
+}
+
+double MappedSparseMatrix::multiplyRowWithVector(uint64_t row, std::vector<double> const& x, double initialValue) const {
+    double result = initialValue;
+    for (uint64_t entry = rowIndications[row], end = rowIndications[row + 1]; entry < end; ++entry) {
+        result += values[entry] * x[columns[entry]];
+    }
+    return result;
+}
+
+void MappedSparseMatrix::multiplyWithVector(std::vector<double> const& x, std::vector<double>& result, std::vector<double> const* b) const {
+    STORM_LOG_THROW(x.size() >= columnCount, storm::exceptions::InvalidArgumentException, "The vector is smaller than the number of columns.");
+    result.resize(rowCount);
+    uint64_t prefetchedUntil = 0;
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        prefetch(rowIndications[row], prefetchedUntil);
+        result[row] = multiplyRowWithVector(row, x, b ? (*b)[row] : 0.0);
+    }
+}
+
+void MappedSparseMatrix::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<double> const& x, std::vector<double>& result,
+                                           std::vector<double> const* b) const {
+    STORM_LOG_THROW(x.size() >= columnCount, storm::exceptions::InvalidArgumentException, "The vector is smaller than the number of columns.");
+    result.resize(rowGroupCount);
+    uint64_t prefetchedUntil = 0;
+    for (uint64_t group = 0; group < rowGroupCount; ++group) {
+        uint64_t firstRow = getFirstRowOfGroup(group);
+        uint64_t endRow = getFirstRowOfGroup(group + 1);
+        prefetch(rowIndications[firstRow], prefetchedUntil);
+        double best = 0.0;
+        for (uint64_t row = firstRow; row < endRow; ++row) {
+            double rowValue = multiplyRowWithVector(row, x, b ? (*b)[row] : 0.0);
+            if (row == firstRow || (dir == storm::solver::OptimizationDirection::Minimize ? rowValue < best : rowValue > best)) {
+                best = rowValue;
+            }
+        }
+        result[group] = best;
+    }
+}
+
+storm::storage::SparseMatrix<double> MappedSparseMatrix::toSparseMatrix() const {
+    storm::storage::SparseMatrixBuilder<double> builder(rowCount, columnCount, getEntryCount(), true, !hasTrivialRowGrouping(),
+                                                        hasTrivialRowGrouping() ? 0 : rowGroupCount);
+    for (uint64_t group = 0; group < rowGroupCount; ++group) {
+        if (!hasTrivialRowGrouping()) {
+            builder.newRowGroup(getFirstRowOfGroup(group));
+        }
+        for (uint64_t row = getFirstRowOfGroup(group); row < getFirstRowOfGroup(group + 1); ++row) {
+            for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                builder.addNextValue(row, columns[entry], values[entry]);
+            }
+        }
+    }
+    return builder.build(rowCount, columnCount, rowGroupCount);
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only sparse matrix in CSR format whose arrays are not owned by the matrix, but typically reside in a memory-mapped file. In contrast to
+ * SparseMatrix, the entries are therefore not copied into main memory, which allows to solve models whose matrix exceeds the main memory as long
+ * as the vectors fit. The multiplications stream over the entries in order and ask the kernel to read ahead chunks of entries.
+ */
+class MappedSparseMatrix {
+   public:
+    /*!
+     * Creates a matrix over the given arrays.
+     *
+     * @param owner Keeps the arrays alive as long as the matrix (or a copy) exists.
+     * @param rowIndications For each row, the index of its first entry, followed by the number of entries.
+     * @param columns The column of each entry.
+     * @param values The value of each entry.
+     * @param rowGroupIndices For each row group, its first row, followed by the number of rows. If null, the row grouping is trivial.
+     */
+    MappedSparseMatrix(std::shared_ptr<void const> const& owner, uint64_t rowCount, uint64_t columnCount, uint64_t rowGroupCount,
+                       uint64_t const* rowIndications, uint64_t const* columns, double const* values, uint64_t const* rowGroupIndices);
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+    uint64_t getRowGroupCount() const;
+    bool hasTrivialRowGrouping() const;
+
+    uint64_t getFirstRowOfGroup(uint64_t group) const;
+
+    /*!
+     * Retrieves whether chunks of entries are prefetched during the multiplications (which is the default).
+     */
+    bool isPrefetchingEnabled() const;
+    void setPrefetchingEnabled(bool value);
+
+    /*!
+     * Computes result = A * x + b, where b is optional.
+     */
+    void multiplyWithVector(std::vector<double> const& x, std::vector<double>& result, std::vector<double> const* b = nullptr) const;
+
+    /*!
+     * Computes the minimal or maximal value of (A * x + b) over the rows of each row group, where b is optional.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<double> const& x, std::vector<double>& result,
+                           std::vector<double> const* b = nullptr) const;
+
+    /*!
+     * Copies the matrix into main memory.
+     */
+    storm::storage::SparseMatrix<double> toSparseMatrix() const;
+
+   private:
+    /*!
+     * Prefetches the entries from the given index on, if the already prefetched ones are about to be consumed.
+     */
+    void prefetch(uint64_t entry, uint64_t& prefetchedUntil) const;
+
+    double multiplyRowWithVector(uint64_t row, std::vector<double> const& x, double initialValue) const;
+
+    std::shared_ptr<void const> owner;
+    uint64_t rowCount;
+    uint64_t columnCount;
+    uint64_t rowGroupCount;
+    uint64_t const* rowIndications;
+    uint64_t const* columns;
+    double const* values;
+    uint64_t const* rowGroupIndices;
+    bool prefetchingEnabled;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,12 +1,13 @@
-#include <list>
+#include <algorithm>
+#include <limits>
 #include <numeric>
-#include <queue>
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/Instrumentation.h"
 
 namespace storm {
 namespace storage {
@@ -74,24 +75,14 @@ MaximalEndComponentDecomposition<ValueType>& MaximalEndComponentDecomposition<Va
 
 template<typename ValueType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> backwardTransitions,
+                                                                                          storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                           storm::storage::BitVector const* states,
                                                                                           storm::storage::BitVector const* choices) {
+    storm::utility::InstrumentationTimer instrumentationTimer("decomposition.mec");
     // Get some data for convenient access.
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
-    // Initialize the maximal end component list to be the full state space.
-    std::list<StateBlock> endComponentStateSets;
-    if (states) {
-        endComponentStateSets.emplace_back(states->begin(), states->end(), true);
-    } else {
-        std::vector<storm::storage::sparse::state_type> allStates;
-        allStates.resize(transitionMatrix.getRowGroupCount());
-        std::iota(allStates.begin(), allStates.end(), 0);
-        endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
-    }
-    storm::storage::BitVector statesToCheck(numberOfStates);
     storm::storage::BitVector includedChoices;
     if (choices) {
         includedChoices = *choices;
@@ -105,106 +96,137 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     } else {
         includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
     }
-    storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
 
-    for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-        StateBlock const& mec = *mecIterator;
+    // The list of MEC candidates. Candidates are processed in the order in which they were created and are replaced by their sub-candidates if
+    // they turn out not to be MECs. Initially, the only candidate is the full subsystem.
+    std::vector<StateBlock> endComponentStateSets;
+    if (states) {
+        endComponentStateSets.emplace_back(states->begin(), states->end(), true);
+    } else {
+        std::vector<storm::storage::sparse::state_type> allStates;
+        allStates.resize(transitionMatrix.getRowGroupCount());
+        std::iota(allStates.begin(), allStates.end(), 0);
+        endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
+    }
+    // Stores whether the corresponding candidate is already known to be a MEC and thus needs no further processing.
+    std::vector<bool> isMec = {false};
+
+    // Stores for every state the index of the SCC that it currently belongs to, which allows for constant-time membership queries.
+    uint_fast64_t const noScc = std::numeric_limits<uint_fast64_t>::max();
+    std::vector<uint_fast64_t> stateToScc(numberOfStates, noScc);
+    uint_fast64_t nextSccIndex = 0;
+
+    storm::storage::BitVector currMecAsBitVector(numberOfStates);
+    std::vector<storm::storage::sparse::state_type> statesToCheck;
+    std::vector<storm::storage::sparse::state_type> remainingStates;
+    std::vector<StateBlock> subCandidates;
+    std::vector<bool> subCandidateIsMec;
+    for (uint_fast64_t candidateIndex = 0; candidateIndex < endComponentStateSets.size(); ++candidateIndex) {
+        if (isMec[candidateIndex]) {
+            continue;
+        }
+
         currMecAsBitVector.clear();
-        currMecAsBitVector.set(mec.begin(), mec.end(), true);
-        // Keep track of whether the MEC changed during this iteration.
-        bool mecChanged = false;
+        currMecAsBitVector.set(endComponentStateSets[candidateIndex].begin(), endComponentStateSets[candidateIndex].end(), true);
+        uint_fast64_t candidateSize = endComponentStateSets[candidateIndex].size();
 
         // Get an SCC decomposition of the current MEC candidate.
-
         StronglyConnectedComponentDecomposition<ValueType> sccs(
             transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
 
         // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
         // the MEC canditate itself.
-        mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
-
-        // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
-        for (auto& scc : sccs) {
-            statesToCheck.set(scc.begin(), scc.end());
+        bool mecChanged = sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < candidateSize);
+
+        // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC. Only the predecessors of
+        // removed states need to be reconsidered.
+        subCandidates.clear();
+        subCandidateIsMec.clear();
+        for (auto const& scc : sccs) {
+            uint_fast64_t sccIndex = nextSccIndex++;
+            for (auto state : scc) {
+                stateToScc[state] = sccIndex;
+            }
 
+            bool statesRemoved = false;
+            bool choicesRemoved = false;
+            statesToCheck.assign(scc.begin(), scc.end());
             while (!statesToCheck.empty()) {
-                storm::storage::BitVector statesToRemove(numberOfStates);
-
-                for (auto state : statesToCheck) {
-                    bool keepStateInMEC = false;
+                auto state = statesToCheck.back();
+                statesToCheck.pop_back();
+                if (stateToScc[state] != sccIndex) {
+                    continue;
+                }
 
-                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        // If the choice is not part of our subsystem, skip it.
-                        if (choices && !choices->get(choice)) {
-                            continue;
-                        }
+                bool keepStateInMEC = false;
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                    // If the choice is not included (any more), skip it.
+                    if (!includedChoices.get(choice)) {
+                        continue;
+                    }
 
-                        // If the choice is not included any more, skip it.
-                        if (!includedChoices.get(choice)) {
+                    bool choiceContainedInMEC = true;
+                    for (auto const& entry : transitionMatrix.getRow(choice)) {
+                        if (storm::utility::isZero(entry.getValue())) {
                             continue;
                         }
 
-                        bool choiceContainedInMEC = true;
-                        for (auto const& entry : transitionMatrix.getRow(choice)) {
-                            if (storm::utility::isZero(entry.getValue())) {
-                                continue;
-                            }
-
-                            if (!scc.containsState(entry.getColumn())) {
-                                includedChoices.set(choice, false);
-                                choiceContainedInMEC = false;
-                                break;
-                            }
+                        if (stateToScc[entry.getColumn()] != sccIndex) {
+                            includedChoices.set(choice, false);
+                            choicesRemoved = true;
+                            choiceContainedInMEC = false;
+                            break;
                         }
-
-                        // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
-                        if (choiceContainedInMEC) {
-                            keepStateInMEC = true;
-                        }
-                    }
-
-                    if (!keepStateInMEC) {
-                        statesToRemove.set(state, true);
                     }
-                }
 
-                // Now erase the states that have no option to stay inside the MEC with all successors.
-                mecChanged |= !statesToRemove.empty();
-                for (uint_fast64_t state : statesToRemove) {
-                    scc.erase(state);
+                    // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
+                    keepStateInMEC |= choiceContainedInMEC;
                 }
 
-                // Now check which states should be reconsidered, because successors of them were removed.
-                statesToCheck.clear();
-                for (auto state : statesToRemove) {
+                if (!keepStateInMEC) {
+                    // Now erase the state and reconsider its predecessors within the SCC.
+                    stateToScc[state] = noScc;
+                    statesRemoved = true;
                     for (auto const& entry : backwardTransitions.getRow(state)) {
-                        if (scc.containsState(entry.getColumn())) {
-                            statesToCheck.set(entry.getColumn());
+                        if (stateToScc[entry.getColumn()] == sccIndex) {
+                            statesToCheck.push_back(entry.getColumn());
                         }
                     }
                 }
             }
-        }
+            mecChanged |= statesRemoved;
 
-        // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-        // the list instead.
-        if (mecChanged) {
-            for (StronglyConnectedComponent& scc : sccs) {
-                if (!scc.empty()) {
-                    endComponentStateSets.push_back(std::move(scc));
+            remainingStates.clear();
+            for (auto state : scc) {
+                if (stateToScc[state] == sccIndex) {
+                    remainingStates.push_back(state);
                 }
             }
+            if (!remainingStates.empty()) {
+                subCandidates.emplace_back(remainingStates.begin(), remainingStates.end(), true);
+                // If neither states nor choices were removed, the SCC is closed under its choices and hence a MEC. Checking it again would
+                // only reproduce the same SCC.
+                subCandidateIsMec.push_back(!statesRemoved && !choicesRemoved);
+            }
+        }
 
-            std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-            ++mecIterator;
-            endComponentStateSets.erase(eraseIterator);
+        // If the MEC changed, we replace it by the possible new MEC candidates. Otherwise, it is a MEC.
+        if (mecChanged) {
+            endComponentStateSets[candidateIndex] = StateBlock();
+            for (uint_fast64_t subCandidateIndex = 0; subCandidateIndex < subCandidates.size(); ++subCandidateIndex) {
+                endComponentStateSets.push_back(std::move(subCandidates[subCandidateIndex]));
+                isMec.push_back(subCandidateIsMec[subCandidateIndex]);
+            }
         } else {
-            // Otherwise, we proceed with the next MEC candidate.
-            ++mecIterator;
+            isMec[candidateIndex] = true;
         }
-
     }  // End of loop over all MEC candidates.
 
+    // Drop the candidates that were replaced by their sub-candidates.
+    endComponentStateSets.erase(
+        std::remove_if(endComponentStateSets.begin(), endComponentStateSets.end(), [](StateBlock const& stateSet) { return stateSet.empty(); }),
+        endComponentStateSets.end());
+
     // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
     // contained in the MEC and store them as actual MECs.
     this->blocks.reserve(endComponentStateSets.size());
@@ -0,0 +1,71 @@
+#include "storm/storage/MemoryPool.h"
+
+#include <algorithm>
+
+namespace storm {
+namespace storage {
+
+MemoryPool::MemoryPool(std::size_t slabSize)
+    : slabSize(std::max(slabSize, minimalBlockSize << (numberOfSizeClasses - 1))), slabPosition(nullptr), slabEnd(nullptr) {
+    freeLists.fill(nullptr);
+}
+
+std::size_t MemoryPool::getSizeClass(std::size_t bytes) {
+    std::size_t sizeClass = 0;
+    std::size_t blockSize = minimalBlockSize;
+    while (blockSize < bytes) {
+        blockSize <<= 1;
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+void* MemoryPool::allocate(std::size_t bytes) {
+    std::size_t sizeClass = getSizeClass(bytes);
+    if (sizeClass >= numberOfSizeClasses) {
+        return ::operator new(bytes);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    FreeBlock*& freeList = freeLists[sizeClass];
+    if (freeList) {
+        FreeBlock* block = freeList;
+        freeList = block->next;
+        return block;
+    }
+
+    // As the slab size and all block sizes are multiples of the minimal block size, every block is suitably aligned.
+    std::size_t blockSize = minimalBlockSize << sizeClass;
+    if (static_cast<std::size_t>(slabEnd - slabPosition) < blockSize) {
+        slabs.emplace_back(new char[slabSize]);
+        slabPosition = slabs.back().get();
+        slabEnd = slabPosition + slabSize;
+    }
+    void* result = slabPosition;
+    slabPosition += blockSize;
+    return result;
+}
+
+void MemoryPool::deallocate(void* pointer, std::size_t bytes) noexcept {
+    if (!pointer) {
+        return;
+    }
+    std::size_t sizeClass = getSizeClass(bytes);
+    if (sizeClass >= numberOfSizeClasses) {
+        ::operator delete(pointer);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    FreeBlock* block = static_cast<FreeBlock*>(pointer);
+    block->next = freeLists[sizeClass];
+    freeLists[sizeClass] = block;
+}
+
+std::size_t MemoryPool::getNumberOfReservedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return slabs.size() * slabSize;
+}
+
+}  // namespace storage
+}  // namespace storm
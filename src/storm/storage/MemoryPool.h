@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A thread-safe memory pool for many small, frequently reallocated objects (like the rows of a flexible sparse matrix). Requests are rounded
+ * up to a power of two and served from large slabs, so they carry no per-allocation overhead of the system allocator. Freed blocks are kept
+ * in one free list per size and reused by later requests of the same size. All memory is returned to the system when the pool is destroyed.
+ * Requests that exceed the largest size class are forwarded to the system allocator.
+ */
+class MemoryPool {
+   public:
+    /*!
+     * Creates a pool that requests memory from the system in slabs of (at least) the given size.
+     *
+     * @param slabSize The size of the slabs in bytes.
+     */
+    MemoryPool(std::size_t slabSize = 1ull << 16);
+
+    MemoryPool(MemoryPool const& other) = delete;
+    MemoryPool& operator=(MemoryPool const& other) = delete;
+
+    /*!
+     * Allocates the given number of bytes. The memory is aligned for all fundamental types.
+     */
+    void* allocate(std::size_t bytes);
+
+    /*!
+     * Returns memory that was obtained from this pool via allocate with the same number of bytes.
+     */
+    void deallocate(void* pointer, std::size_t bytes) noexcept;
+
+    /*!
+     * Retrieves the number of bytes that the pool has requested from the system for its slabs.
+     */
+    std::size_t getNumberOfReservedBytes() const;
+
+   private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr std::size_t minimalBlockSize = 16;
+    static constexpr std::size_t numberOfSizeClasses = 9;
+
+    static std::size_t getSizeClass(std::size_t bytes);
+
+    std::size_t slabSize;
+    std::array<FreeBlock*, numberOfSizeClasses> freeLists;
+    std::vector<std::unique_ptr<char[]>> slabs;
+    char* slabPosition;
+    char* slabEnd;
+    mutable std::mutex mutex;
+};
+
+/*!
+ * A standard-conforming allocator that obtains its memory from a (shared) memory pool. A default-constructed allocator uses the system
+ * allocator instead. Copies of containers are placed on the system heap, so short-lived copies do not keep memory of the pool occupied.
+ */
+template<typename T>
+class PooledAllocator {
+   public:
+    typedef T value_type;
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::false_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+    typedef std::false_type is_always_equal;
+
+    PooledAllocator() noexcept = default;
+
+    explicit PooledAllocator(std::shared_ptr<MemoryPool> const& pool) noexcept : pool(pool) {
+        // Intentionally left empty.
+    }
+
+    template<typename U>
+    PooledAllocator(PooledAllocator<U> const& other) noexcept : pool(other.getPool()) {
+        // Intentionally left empty.
+    }
+
+    T* allocate(std::size_t n) {
+        if (pool) {
+            return static_cast<T*>(pool->allocate(n * sizeof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* pointer, std::size_t n) noexcept {
+        if (pool) {
+            pool->deallocate(pointer, n * sizeof(T));
+        } else {
+            std::allocator<T>().deallocate(pointer, n);
+        }
+    }
+
+    PooledAllocator select_on_container_copy_construction() const {
+        return PooledAllocator();
+    }
+
+    std::shared_ptr<MemoryPool> const& getPool() const {
+        return pool;
+    }
+
+   private:
+    std::shared_ptr<MemoryPool> pool;
+};
+
+template<typename T, typename U>
+bool operator==(PooledAllocator<T> const& first, PooledAllocator<U> const& second) {
+    return first.getPool() == second.getPool();
+}
+
+template<typename T, typename U>
+bool operator!=(PooledAllocator<T> const& first, PooledAllocator<U> const& second) {
+    return !(first == second);
+}
+
+}  // namespace storage
+}  // namespace storm
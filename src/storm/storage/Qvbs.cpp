@@ -105,6 +105,10 @@ QvbsBenchmark::QvbsBenchmark(std::string const& modelName) {
     }
 }
 
+uint64_t QvbsBenchmark::getNumberOfInstances() const {
+    return janiFiles.size();
+}
+
 std::string const& QvbsBenchmark::getJaniFile(uint64_t instanceIndex) const {
     STORM_LOG_THROW(instanceIndex < janiFiles.size(), storm::exceptions::InvalidArgumentException, "Instance index " << instanceIndex << " is too high.");
     return janiFiles[instanceIndex];
@@ -21,6 +21,7 @@ class QvbsBenchmark {
      */
     QvbsBenchmark(std::string const& modelName);
 
+    uint64_t getNumberOfInstances() const;
     std::string const& getJaniFile(uint64_t instanceIndex = 0) const;
     std::string const& getConstantDefinition(uint64_t instanceIndex = 0) const;
 
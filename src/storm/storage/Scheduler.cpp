@@ -3,7 +3,10 @@
 
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/io/JsonArrayStreamWriter.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -15,7 +18,8 @@ template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure> const& memoryStructure)
     : memoryStructure(memoryStructure) {
     uint_fast64_t numOfMemoryStates = memoryStructure ? memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    deterministicChoices = std::vector<std::vector<uint32_t>>(numOfMemoryStates, std::vector<uint32_t>(numberOfModelStates, undefinedChoice));
+    randomizedChoices.resize(numOfMemoryStates);
     dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
@@ -26,49 +30,72 @@ template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure>&& memoryStructure)
     : memoryStructure(std::move(memoryStructure)) {
     uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    deterministicChoices = std::vector<std::vector<uint32_t>>(numOfMemoryStates, std::vector<uint32_t>(numberOfModelStates, undefinedChoice));
+    randomizedChoices.resize(numOfMemoryStates);
     dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
     numOfDontCareStates = 0;
 }
 
+template<typename ValueType>
+void Scheduler<ValueType>::updateChoiceCounts(uint32_t oldChoice, uint32_t newChoice) {
+    if (oldChoice != undefinedChoice && newChoice == undefinedChoice) {
+        ++numOfUndefinedChoices;
+    } else if (oldChoice == undefinedChoice && newChoice != undefinedChoice) {
+        STORM_LOG_ASSERT(numOfUndefinedChoices > 0, "Unexpected number of undefined choices.");
+        --numOfUndefinedChoices;
+    }
+    bool oldDeterministic = oldChoice < randomizedChoice;
+    bool newDeterministic = newChoice < randomizedChoice;
+    if (oldDeterministic && !newDeterministic) {
+        STORM_LOG_ASSERT(numOfDeterministicChoices > 0, "Unexpected number of deterministic choices.");
+        --numOfDeterministicChoices;
+    } else if (!oldDeterministic && newDeterministic) {
+        ++numOfDeterministicChoices;
+    }
+}
+
 template<typename ValueType>
 void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
-
-    auto& schedulerChoice = schedulerChoices[memoryState][modelState];
+    STORM_LOG_ASSERT(modelState < deterministicChoices[memoryState].size(), "Illegal model state index");
 
-    if (schedulerChoice.isDefined()) {
-        if (!choice.isDefined()) {
-            ++numOfUndefinedChoices;
-        }
-    } else {
-        if (choice.isDefined()) {
-            assert(numOfUndefinedChoices > 0);
-            --numOfUndefinedChoices;
-        }
+    if (choice.isDeterministic()) {
+        setChoice(choice.getDeterministicChoice(), modelState, memoryState);
+        return;
     }
-    if (schedulerChoice.isDeterministic()) {
-        if (!choice.isDeterministic()) {
-            assert(numOfDeterministicChoices > 0);
-            --numOfDeterministicChoices;
-        }
+
+    uint32_t& storedChoice = deterministicChoices[memoryState][modelState];
+    uint32_t newChoice = choice.isDefined() ? randomizedChoice : undefinedChoice;
+    updateChoiceCounts(storedChoice, newChoice);
+    storedChoice = newChoice;
+    if (choice.isDefined()) {
+        randomizedChoices[memoryState][modelState] = choice.getChoiceAsDistribution();
     } else {
-        if (choice.isDeterministic()) {
-            ++numOfDeterministicChoices;
-        }
+        randomizedChoices[memoryState].erase(modelState);
     }
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::setChoice(uint_fast64_t deterministicChoice, uint_fast64_t modelState, uint_fast64_t memoryState) {
+    STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+    STORM_LOG_ASSERT(modelState < deterministicChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_THROW(deterministicChoice < randomizedChoice, storm::exceptions::InvalidArgumentException,
+                    "The choice index " << deterministicChoice << " exceeds the maximal choice index supported by schedulers.");
 
-    schedulerChoice = choice;
+    uint32_t& storedChoice = deterministicChoices[memoryState][modelState];
+    if (storedChoice == randomizedChoice) {
+        randomizedChoices[memoryState].erase(modelState);
+    }
+    updateChoiceCounts(storedChoice, static_cast<uint32_t>(deterministicChoice));
+    storedChoice = static_cast<uint32_t>(deterministicChoice);
 }
 
 template<typename ValueType>
 bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uint64_t memoryState) const {
     for (auto selectedState : selectedStates) {
-        auto& schedulerChoice = schedulerChoices[memoryState][selectedState];
-        if (!schedulerChoice.isDefined()) {
+        if (deterministicChoices[memoryState][selectedState] == undefinedChoice) {
             return false;
         }
     }
@@ -78,25 +105,45 @@ bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uin
 template<typename ValueType>
 void Scheduler<ValueType>::clearChoice(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < deterministicChoices[memoryState].size(), "Illegal model state index");
     setChoice(SchedulerChoice<ValueType>(), modelState, memoryState);
 }
 
 template<typename ValueType>
-SchedulerChoice<ValueType> const& Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+SchedulerChoice<ValueType> Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+    STORM_LOG_ASSERT(modelState < deterministicChoices[memoryState].size(), "Illegal model state index");
+    uint32_t storedChoice = deterministicChoices[memoryState][modelState];
+    if (storedChoice == undefinedChoice) {
+        return SchedulerChoice<ValueType>();
+    } else if (storedChoice == randomizedChoice) {
+        return SchedulerChoice<ValueType>(randomizedChoices[memoryState].at(modelState));
+    } else {
+        return SchedulerChoice<ValueType>(static_cast<uint_fast64_t>(storedChoice));
+    }
+}
+
+template<typename ValueType>
+bool Scheduler<ValueType>::isDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
-    return schedulerChoices[memoryState][modelState];
+    STORM_LOG_ASSERT(modelState < deterministicChoices[memoryState].size(), "Illegal model state index");
+    return deterministicChoices[memoryState][modelState] < randomizedChoice;
+}
+
+template<typename ValueType>
+uint_fast64_t Scheduler<ValueType>::getDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    STORM_LOG_THROW(isDeterministicChoice(modelState, memoryState), storm::exceptions::InvalidOperationException,
+                    "Tried to obtain the deterministic choice of a scheduler, but the choice is not deterministic");
+    return deterministicChoices[memoryState][modelState];
 }
 
 template<typename ValueType>
 void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t memoryState, bool setArbitraryChoice) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < deterministicChoices[memoryState].size(), "Illegal model state index");
 
     if (!dontCareStates[memoryState].get(modelState)) {
-        auto& schedulerChoice = schedulerChoices[memoryState][modelState];
-        if (!schedulerChoice.isDefined() && setArbitraryChoice) {
+        if (deterministicChoices[memoryState][modelState] == undefinedChoice && setArbitraryChoice) {
             // Set an arbitrary choice
             this->setChoice(0, modelState, memoryState);
         }
@@ -108,7 +155,7 @@ void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t m
 template<typename ValueType>
 void Scheduler<ValueType>::unSetDontCare(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < deterministicChoices[memoryState].size(), "Illegal model state index");
 
     if (dontCareStates[memoryState].get(modelState)) {
         dontCareStates[memoryState].set(modelState, false);
@@ -126,15 +173,23 @@ storm::storage::BitVector Scheduler<ValueType>::computeActionSupport(std::vector
     auto nrActions = nondeterministicChoiceIndices.back();
     storm::storage::BitVector result(nrActions);
 
-    for (auto const& choicesPerMemoryNode : schedulerChoices) {
+    for (uint64_t memoryState = 0; memoryState < deterministicChoices.size(); ++memoryState) {
+        auto const& choicesPerMemoryNode = deterministicChoices[memoryState];
         STORM_LOG_ASSERT(nondeterministicChoiceIndices.size() - 2 < choicesPerMemoryNode.size(), "Illegal model state index");
         for (uint64_t stateId = 0; stateId < nondeterministicChoiceIndices.size() - 1; ++stateId) {
-            for (auto const& schedChoice : choicesPerMemoryNode[stateId].getChoiceAsDistribution()) {
-                STORM_LOG_ASSERT(schedChoice.first < nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId],
-                                 "Scheduler chooses action indexed " << schedChoice.first << " in state id " << stateId << " but state contains only "
+            auto selectChoice = [&](uint_fast64_t choice) {
+                STORM_LOG_ASSERT(choice < nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId],
+                                 "Scheduler chooses action indexed " << choice << " in state id " << stateId << " but state contains only "
                                                                      << nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId]
                                                                      << " choices .");
-                result.set(nondeterministicChoiceIndices[stateId] + schedChoice.first);
+                result.set(nondeterministicChoiceIndices[stateId] + choice);
+            };
+            if (choicesPerMemoryNode[stateId] < randomizedChoice) {
+                selectChoice(choicesPerMemoryNode[stateId]);
+            } else if (choicesPerMemoryNode[stateId] == randomizedChoice) {
+                for (auto const& schedChoice : randomizedChoices[memoryState].at(stateId)) {
+                    selectChoice(schedChoice.first);
+                }
             }
         }
     }
@@ -148,7 +203,7 @@ bool Scheduler<ValueType>::isPartialScheduler() const {
 
 template<typename ValueType>
 bool Scheduler<ValueType>::isDeterministicScheduler() const {
-    return numOfDeterministicChoices == (schedulerChoices.size() * schedulerChoices.begin()->size()) - numOfUndefinedChoices;
+    return numOfDeterministicChoices == (deterministicChoices.size() * deterministicChoices.begin()->size()) - numOfUndefinedChoices;
 }
 
 template<typename ValueType>
@@ -156,6 +211,11 @@ bool Scheduler<ValueType>::isMemorylessScheduler() const {
     return getNumberOfMemoryStates() == 1;
 }
 
+template<typename ValueType>
+uint_fast64_t Scheduler<ValueType>::getNumberOfModelStates() const {
+    return deterministicChoices.front().size();
+}
+
 template<typename ValueType>
 uint_fast64_t Scheduler<ValueType>::getNumberOfMemoryStates() const {
     return memoryStructure ? memoryStructure->getNumberOfStates() : 1;
@@ -169,15 +229,15 @@ boost::optional<storm::storage::MemoryStructure> const& Scheduler<ValueType>::ge
 template<typename ValueType>
 void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                          bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == getNumberOfModelStates(), storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
 
     bool const stateValuationsGiven = model != nullptr && model->hasStateValuations();
     bool const choiceLabelsGiven = model != nullptr && model->hasChoiceLabeling();
     bool const choiceOriginsGiven = model != nullptr && model->hasChoiceOrigins();
-    uint_fast64_t widthOfStates = std::to_string(schedulerChoices.front().size()).length();
+    uint_fast64_t widthOfStates = std::to_string(getNumberOfModelStates()).length();
     if (stateValuationsGiven) {
-        widthOfStates += model->getStateValuations().getStateInfo(schedulerChoices.front().size() - 1).length() + 5;
+        widthOfStates += model->getStateValuations().getStateInfo(getNumberOfModelStates() - 1).length() + 5;
     }
     widthOfStates = std::max(widthOfStates, (uint_fast64_t)12);
     uint_fast64_t numOfSkippedStatesWithUniqueChoice = 0;
@@ -193,7 +253,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
     out << std::setw(widthOfStates) << "model state:"
         << "    " << (isMemorylessScheduler() ? "" : " memory:     ") << "choice(s)" << (isMemorylessScheduler() ? "" : "     memory updates:     ") << '\n';
-    for (uint_fast64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    for (uint_fast64_t state = 0; state < getNumberOfModelStates(); ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             ++numOfSkippedStatesWithUniqueChoice;
@@ -228,7 +288,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
             }
 
             // Print choice info
-            SchedulerChoice<ValueType> const& choice = schedulerChoices[memoryState][state];
+            SchedulerChoice<ValueType> const choice = getChoice(state, memoryState);
             if (choice.isDefined()) {
                 if (choice.isDeterministic()) {
                     if (choiceOriginsGiven) {
@@ -304,11 +364,12 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
 template<typename ValueType>
 void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                              bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == getNumberOfModelStates(), storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
-    storm::json<storm::RationalNumber> output;
-    for (uint64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    // The entries are written one at a time as the json array of large schedulers would take a lot of memory.
+    storm::exporter::JsonArrayStreamWriter<storm::json<storm::RationalNumber>> writer(out);
+    for (uint64_t state = 0; state < getNumberOfModelStates(); ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             continue;
@@ -331,11 +392,14 @@ void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<
                 stateChoicesJson["m"] = memoryState;
             }
 
-            auto const& choice = schedulerChoices[memoryState][state];
+            auto const choice = getChoice(state, memoryState);
             storm::json<storm::RationalNumber> choicesJson;
             if (choice.isDefined()) {
                 for (auto const& choiceProbPair : choice.getChoiceAsDistribution()) {
-                    uint64_t globalChoiceIndex = model->getTransitionMatrix().getRowGroupIndices()[state] + choiceProbPair.first;
+                    uint64_t globalChoiceIndex = choiceProbPair.first;
+                    if (model) {
+                        globalChoiceIndex += model->getTransitionMatrix().getRowGroupIndices()[state];
+                    }
                     storm::json<storm::RationalNumber> choiceJson;
                     if (model && model->hasChoiceOrigins() &&
                         model->getChoiceOrigins()->getIdentifier(globalChoiceIndex) != model->getChoiceOrigins()->getIdentifierForChoicesWithNoOrigin()) {
@@ -375,10 +439,10 @@ void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<
                 choicesJson = "undefined";
             }
             stateChoicesJson["c"] = std::move(choicesJson);
-            output.push_back(std::move(stateChoicesJson));
+            writer.add(stateChoicesJson);
         }
     }
-    out << output.dump(4);
+    writer.finish();
 }
 
 template class Scheduler<double>;
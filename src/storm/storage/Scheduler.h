@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
+#include <unordered_map>
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
@@ -13,6 +15,9 @@ namespace storage {
  * This class defines which action is chosen in a particular state of a non-deterministic model. More concretely, a scheduler maps a state s to i
  * if the scheduler takes the i-th action available in s (i.e. the choices are relative to the states).
  * A Choice can be undefined, deterministic
+ *
+ * Deterministic choices are stored compactly as one 32-bit index per model and memory state. Only the (typically few) randomized choices are
+ * stored as distributions in a separate sparse map.
  */
 template<typename ValueType>
 class Scheduler {
@@ -35,6 +40,15 @@ class Scheduler {
      */
     void setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState = 0);
 
+    /*!
+     * Sets the given deterministic choice for the given state. In contrast to setting a SchedulerChoice, this does not create a distribution.
+     *
+     * @param deterministicChoice The (local) index of the choice to set for the given state.
+     * @param modelState The state of the model for which to set the choice.
+     * @param memoryState The state of the memoryStructure for which to set the choice.
+     */
+    void setChoice(uint_fast64_t deterministicChoice, uint_fast64_t modelState, uint_fast64_t memoryState = 0);
+
     /*!
      * Is the scheduler defined on the states indicated by the selected-states bitvector?
      */
@@ -54,7 +68,18 @@ class Scheduler {
      * @param state The state for which to get the choice.
      * @param memoryState the memory state which we consider.
      */
-    SchedulerChoice<ValueType> const& getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+    SchedulerChoice<ValueType> getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+    /*!
+     * Retrieves whether the choice for the given model and memory state is defined and deterministic.
+     */
+    bool isDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+    /*!
+     * Retrieves the (local) index of the deterministic choice for the given model and memory state. In contrast to getChoice, this does not
+     * create a distribution. If the choice is not deterministic, an exception is thrown.
+     */
+    uint_fast64_t getDeterministicChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
 
     /*!
      * Set the combination of model state and memoryStructure state to dontCare.
@@ -100,6 +125,11 @@ class Scheduler {
      */
     bool isMemorylessScheduler() const;
 
+    /*!
+     * Retrieves the number of model states this scheduler considers.
+     */
+    uint_fast64_t getNumberOfModelStates() const;
+
     /*!
      * Retrieves the number of memory states this scheduler considers.
      */
@@ -115,11 +145,15 @@ class Scheduler {
      */
     template<typename NewValueType>
     Scheduler<NewValueType> toValueType() const {
-        uint_fast64_t numModelStates = schedulerChoices.front().size();
+        uint_fast64_t numModelStates = getNumberOfModelStates();
         Scheduler<NewValueType> newScheduler(numModelStates, memoryStructure);
         for (uint_fast64_t memState = 0; memState < this->getNumberOfMemoryStates(); ++memState) {
             for (uint_fast64_t modelState = 0; modelState < numModelStates; ++modelState) {
-                newScheduler.setChoice(getChoice(modelState, memState).template toValueType<NewValueType>(), modelState, memState);
+                if (isDeterministicChoice(modelState, memState)) {
+                    newScheduler.setChoice(getDeterministicChoice(modelState, memState), modelState, memState);
+                } else if (deterministicChoices[memState][modelState] == randomizedChoice) {
+                    newScheduler.setChoice(getChoice(modelState, memState).template toValueType<NewValueType>(), modelState, memState);
+                }
             }
         }
         return newScheduler;
@@ -150,8 +184,20 @@ class Scheduler {
                            bool skipDontCareStates = false) const;
 
    private:
+    // The values of the compact choice array that mark undefined and randomized choices, respectively.
+    static constexpr uint32_t undefinedChoice = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t randomizedChoice = std::numeric_limits<uint32_t>::max() - 1;
+
+    /*!
+     * Updates the number of undefined and deterministic choices when the choice marker of a state changes from the old to the new value.
+     */
+    void updateChoiceCounts(uint32_t oldChoice, uint32_t newChoice);
+
     boost::optional<storm::storage::MemoryStructure> memoryStructure;
-    std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
+    // For each memory state, the (local) choice index of each model state or one of the markers for undefined and randomized choices.
+    std::vector<std::vector<uint32_t>> deterministicChoices;
+    // For each memory state, the randomized choices of the model states that are marked as randomized.
+    std::vector<std::unordered_map<uint_fast64_t, storm::storage::Distribution<ValueType, uint_fast64_t>>> randomizedChoices;
     std::vector<storm::storage::BitVector> dontCareStates;
     uint_fast64_t numOfUndefinedChoices;
     uint_fast64_t numOfDeterministicChoices;
@@ -0,0 +1,246 @@
+#include "storm/storage/SoaSparseMatrix.h"
+
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::SoaSparseMatrix(SparseMatrix<ValueType> const& matrix)
+    : columnCount(matrix.getColumnCount()), rowIndications(matrix.rowIndications) {
+    columns.reserve(matrix.getEntryCount());
+    values.reserve(matrix.getEntryCount());
+    STORM_LOG_ASSERT(canRepresentColumns(matrix), "The columns of the matrix can not be represented with the given column index type.");
+    for (auto const& entry : matrix.columnsAndValues) {
+        columns.push_back(static_cast<ColumnIndexType>(entry.getColumn()));
+        values.push_back(static_cast<StorageValueType>(entry.getValue()));
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+bool SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::canRepresentColumns(SparseMatrix<ValueType> const& matrix) {
+    return matrix.getColumnCount() <= static_cast<index_type>(std::numeric_limits<ColumnIndexType>::max());
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+typename SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::index_type SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+typename SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::index_type SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+typename SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::index_type SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::getEntryCount() const {
+    return values.size();
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+std::vector<ColumnIndexType> const& SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::getColumns() const {
+    return columns;
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+std::vector<StorageValueType> const& SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::getValues() const {
+    return values;
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+std::vector<typename SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::index_type> const& SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::getRowIndications() const {
+    return rowIndications;
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+ValueType SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    ColumnIndexType const* columnIt = columns.data() + rowIndications[row];
+    ColumnIndexType const* columnIte = columns.data() + rowIndications[row + 1];
+    StorageValueType const* valueIt = values.data() + rowIndications[row];
+    for (; columnIt != columnIte; ++columnIt, ++valueIt) {
+        result += static_cast<ValueType>(*valueIt) * vector[*columnIt];
+    }
+    return result;
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+void SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                    std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "Vectors are aliased but are not allowed to be.");
+    multiplyWithVectorForward(vector, result, summand);
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+void SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                           std::vector<ValueType> const* summand) const {
+    index_type const rowCount = getRowCount();
+    for (index_type row = 0; row < rowCount; ++row) {
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        newValue += multiplyRowWithVector(row, vector);
+        result[row] = std::move(newValue);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+void SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                            std::vector<ValueType> const* summand) const {
+    for (index_type row = getRowCount(); row > 0;) {
+        --row;
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        newValue += multiplyRowWithVector(row, vector);
+        result[row] = std::move(newValue);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+void SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                          std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                          std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    } else {
+        multiplyAndReduceForward<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+template<typename Compare>
+void SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyAndReduceForward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                          std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                          std::vector<uint64_t>* choices) const {
+    Compare compare;
+    uint64_t const groupCount = rowGroupIndices.size() - 1;
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        ValueType currentValue = multiplyRowWithVector(groupStart, vector);
+        if (summand) {
+            currentValue += (*summand)[groupStart];
+        }
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        ValueType oldSelectedChoiceValue;
+        uint64_t selectedChoice = 0;
+        if (choices && (*choices)[group] == 0) {
+            oldSelectedChoiceValue = currentValue;
+        }
+
+        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+            ValueType newValue = multiplyRowWithVector(row, vector);
+            if (summand) {
+                newValue += (*summand)[row];
+            }
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = row - groupStart;
+            }
+        }
+
+        // Finally write value to target vector.
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = std::move(currentValue);
+    }
+}
+
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+void SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                           std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                           std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    } else {
+        multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType, typename StorageValueType>
+template<typename Compare>
+void SoaSparseMatrix<ValueType, ColumnIndexType, StorageValueType>::multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                           std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                           std::vector<uint64_t>* choices) const {
+    Compare compare;
+    for (uint64_t group = rowGroupIndices.size() - 1; group > 0;) {
+        --group;
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        // As in SparseMatrix::multiplyAndReduceBackward, the rows of a group are considered from the last to the first.
+        uint64_t row = groupEnd - 1;
+        ValueType currentValue = multiplyRowWithVector(row, vector);
+        if (summand) {
+            currentValue += (*summand)[row];
+        }
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        ValueType oldSelectedChoiceValue;
+        uint64_t selectedChoice = row - groupStart;
+        if (choices && (*choices)[group] == selectedChoice) {
+            oldSelectedChoiceValue = currentValue;
+        }
+
+        while (row > groupStart) {
+            --row;
+            ValueType newValue = multiplyRowWithVector(row, vector);
+            if (summand) {
+                newValue += (*summand)[row];
+            }
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = row - groupStart;
+            }
+        }
+
+        // Finally write value to target vector.
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = std::move(currentValue);
+    }
+}
+
+template class SoaSparseMatrix<double, uint64_t>;
+template class SoaSparseMatrix<double, uint32_t>;
+template class SoaSparseMatrix<double, uint64_t, float>;
+template class SoaSparseMatrix<double, uint32_t, float>;
+
+#ifdef STORM_HAVE_CARL
+template class SoaSparseMatrix<storm::RationalNumber, uint64_t>;
+template class SoaSparseMatrix<storm::RationalNumber, uint32_t>;
+template class SoaSparseMatrix<storm::RationalFunction, uint64_t>;
+template class SoaSparseMatrix<storm::RationalFunction, uint32_t>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
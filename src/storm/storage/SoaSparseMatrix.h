@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only copy of a sparse matrix that stores the columns and values of its entries in separate arrays
+ * (structure-of-arrays) instead of interleaving them as MatrixEntry objects (array-of-structures). Kernels that
+ * only stream through the matrix, e.g. matrix-vector multiplications, thereby touch less memory per entry and the
+ * loops over the entries of a row become amenable to vectorization.
+ *
+ * The row indications and the row grouping are identical to the ones of the original matrix. Consequently, row
+ * and row group indices can be used interchangeably.
+ *
+ * The columns are stored using the given column index type. Using a 32-bit type reduces the size of each entry from
+ * 16 to 12 bytes (for double values) and can be used whenever the matrix has less than 2^32 columns.
+ *
+ * The values are stored using the given storage value type, which may be less precise than the value type (e.g.,
+ * float for double matrices). The computations (including the accumulation of row products) are always carried out
+ * using the value type.
+ */
+template<typename ValueType, typename ColumnIndexType = SparseMatrixIndexType, typename StorageValueType = ValueType>
+class SoaSparseMatrix {
+   public:
+    typedef SparseMatrixIndexType index_type;
+    typedef ColumnIndexType column_index_type;
+    typedef ValueType value_type;
+    typedef StorageValueType storage_value_type;
+
+    /*!
+     * Creates a structure-of-arrays copy of the given matrix.
+     *
+     * @param matrix The matrix to copy.
+     */
+    SoaSparseMatrix(SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Retrieves whether the columns of the given matrix can be represented with the given column index type.
+     */
+    static bool canRepresentColumns(SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Retrieves the number of rows of the matrix.
+     */
+    index_type getRowCount() const;
+
+    /*!
+     * Retrieves the number of columns of the matrix.
+     */
+    index_type getColumnCount() const;
+
+    /*!
+     * Retrieves the number of entries of the matrix.
+     */
+    index_type getEntryCount() const;
+
+    /*!
+     * Retrieves the columns of all entries, ordered row by row.
+     */
+    std::vector<column_index_type> const& getColumns() const;
+
+    /*!
+     * Retrieves the values of all entries, ordered row by row.
+     */
+    std::vector<StorageValueType> const& getValues() const;
+
+    /*!
+     * Retrieves the row indications, i.e., the entries of row i are at positions rowIndications[i] (inclusive) to
+     * rowIndications[i + 1] (exclusive) in the column and value arrays.
+     */
+    std::vector<index_type> const& getRowIndications() const;
+
+    /*!
+     * Multiplies the given row with the given vector and returns the result.
+     */
+    ValueType multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const;
+
+    /*!
+     * Multiplies the matrix with the given vector and writes the result to the given result vector.
+     * The result vector may not be the same as the input vector.
+     *
+     * @param vector The vector with which to multiply the matrix.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Same as multiplyWithVector, but processes the rows in forward or backward order and reads the already updated
+     * values (Gauss-Seidel style) if the result vector is the same as the input vector.
+     */
+    void multiplyWithVectorForward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                   std::vector<ValueType> const* summand = nullptr) const;
+    void multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                    std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the matrix with the given vector, reduces it according to the given direction and writes the
+     * result to the given result vector. For the tracking of choices, the same conventions as for
+     * SparseMatrix::multiplyAndReduce apply.
+     *
+     * @param dir The optimization direction for the reduction.
+     * @param rowGroupIndices The row groups for the reduction
+     * @param vector The vector with which to multiply the matrix.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param choices If given, the choices made in the reduction process will be written to this vector.
+     */
+    void multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                  std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                  std::vector<uint64_t>* choices) const;
+    void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                   std::vector<uint64_t>* choices) const;
+
+   private:
+    template<typename Compare>
+    void multiplyAndReduceForward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                  std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+    template<typename Compare>
+    void multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                   std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    // The number of columns of the matrix.
+    index_type columnCount;
+
+    // The columns of all entries.
+    std::vector<column_index_type> columns;
+
+    // The values of all entries.
+    std::vector<StorageValueType> values;
+
+    // The positions at which the rows begin in the column and value arrays.
+    std::vector<index_type> rowIndications;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -6,6 +6,7 @@
 
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/LargeArray.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -93,6 +94,8 @@ SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type
       initialRowGroupCount(rowGroups),
       rowGroupIndices(),
       columnsAndValues(),
+      entriesPerChunk(0),
+      completedChunksEntryCount(0),
       rowIndications(),
       currentEntryCount(0),
       lastRow(0),
@@ -129,6 +132,8 @@ SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(SparseMatrix<ValueType>&& ma
       initialRowGroupCount(0),
       rowGroupIndices(),
       columnsAndValues(std::move(matrix.columnsAndValues)),
+      entriesPerChunk(0),
+      completedChunksEntryCount(0),
       rowIndications(std::move(matrix.rowIndications)),
       currentEntryCount(matrix.entryCount),
       currentRowGroupCount() {
@@ -156,7 +161,7 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
     // Check that we did not move backwards wrt. the row.
     STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException,
                     "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
-    STORM_LOG_ASSERT(columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
+    STORM_LOG_ASSERT(completedChunksEntryCount + columnsAndValues.size() == currentEntryCount, "Unexpected size of columnsAndValues vector.");
 
     // Check if a diagonal entry shall be inserted before
     if (pendingDiagonalEntry) {
@@ -191,6 +196,11 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
             assert(rowIndications.size() == lastRow + 1);
             rowIndications.resize(row + 1, currentEntryCount);
             lastRow = row;
+
+            // As rows are never split among chunks, this is the point to start a new chunk.
+            if (entriesPerChunk > 0 && columnsAndValues.size() >= entriesPerChunk) {
+                sealCurrentChunk();
+            }
         }
 
         lastColumn = column;
@@ -205,12 +215,12 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
             // TODO we fix this row directly after the out-of-order insertion, but the code does not exploit that fact.
             STORM_LOG_TRACE("Fix row " << row << " as column " << column << " is added out-of-order.");
             // First, we sort according to columns.
-            std::sort(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(),
+            std::sort(columnsAndValues.begin() + (rowIndications.back() - completedChunksEntryCount), columnsAndValues.end(),
                       [](storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                           return a.getColumn() < b.getColumn();
                       });
 
-            auto insertIt = columnsAndValues.begin() + rowIndications.back();
+            auto insertIt = columnsAndValues.begin() + (rowIndications.back() - completedChunksEntryCount);
             uint64_t elementsToRemove = 0;
             for (auto it = insertIt + 1; it != columnsAndValues.end(); ++it) {
                 // Iterate over all entries in this last row and detect duplicates.
@@ -223,7 +233,7 @@ void SparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type col
                 }
             }
             // Then, we eliminate those duplicate entries.
-            std::unique(columnsAndValues.begin() + rowIndications.back(), columnsAndValues.end(),
+            std::unique(columnsAndValues.begin() + (rowIndications.back() - completedChunksEntryCount), columnsAndValues.end(),
                         [](storm::storage::MatrixEntry<index_type, ValueType> const& a, storm::storage::MatrixEntry<index_type, ValueType> const& b) {
                             return a.getColumn() == b.getColumn();
                         });
@@ -347,6 +357,22 @@ SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overrid
         }
     }
 
+    // If the entries are stored in chunks, we assemble them in a vector of exactly the required size and release the chunks on the way.
+    if (!completedChunks.empty()) {
+        std::vector<MatrixEntry<index_type, value_type>> allColumnsAndValues;
+        allColumnsAndValues.reserve(entryCount);
+        for (auto& chunk : completedChunks) {
+            allColumnsAndValues.insert(allColumnsAndValues.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+            std::vector<MatrixEntry<index_type, value_type>>().swap(chunk);
+        }
+        allColumnsAndValues.insert(allColumnsAndValues.end(), std::make_move_iterator(columnsAndValues.begin()),
+                                   std::make_move_iterator(columnsAndValues.end()));
+        std::vector<MatrixEntry<index_type, value_type>>().swap(columnsAndValues);
+        completedChunks.clear();
+        completedChunksEntryCount = 0;
+        columnsAndValues = std::move(allColumnsAndValues);
+    }
+
     return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
 }
 
@@ -398,10 +424,23 @@ template<typename ValueType>
 void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
     index_type maxColumn = 0;
 
+    // The chunk containing the current row and the global index of its first entry. As rows are never split among chunks, it suffices to
+    // move to the next chunk whenever a row starts behind the current one.
+    uint64_t chunkIndex = 0;
+    index_type chunkStart = 0;
+    auto getChunk = [&](uint64_t index) -> std::vector<MatrixEntry<index_type, value_type>>& {
+        return index < completedChunks.size() ? completedChunks[index] : columnsAndValues;
+    };
+
     for (index_type row = 0; row < rowIndications.size(); ++row) {
+        while (chunkIndex < completedChunks.size() && rowIndications[row] >= chunkStart + getChunk(chunkIndex).size()) {
+            chunkStart += getChunk(chunkIndex).size();
+            ++chunkIndex;
+        }
+        auto& chunk = getChunk(chunkIndex);
         bool changed = false;
-        auto startRow = std::next(columnsAndValues.begin(), rowIndications[row]);
-        auto endRow = row < rowIndications.size() - 1 ? std::next(columnsAndValues.begin(), rowIndications[row + 1]) : columnsAndValues.end();
+        auto startRow = std::next(chunk.begin(), rowIndications[row] - chunkStart);
+        auto endRow = row < rowIndications.size() - 1 ? std::next(chunk.begin(), rowIndications[row + 1] - chunkStart) : chunk.end();
         for (auto entry = startRow; entry != endRow; ++entry) {
             if (entry->getColumn() >= offset) {
                 // Change column
@@ -424,7 +463,28 @@ void SparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> cons
     }
 
     highestColumn = maxColumn;
-    lastColumn = columnsAndValues.empty() ? 0 : columnsAndValues.back().getColumn();
+    if (!columnsAndValues.empty()) {
+        lastColumn = columnsAndValues.back().getColumn();
+    } else {
+        lastColumn = completedChunks.empty() ? 0 : completedChunks.back().back().getColumn();
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::useChunkedEntryStorage(index_type entriesPerChunk) {
+    this->entriesPerChunk = entriesPerChunk;
+    if (entriesPerChunk > 0 && columnsAndValues.capacity() < entriesPerChunk) {
+        columnsAndValues.reserve(entriesPerChunk);
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixBuilder<ValueType>::sealCurrentChunk() {
+    completedChunksEntryCount += columnsAndValues.size();
+    completedChunks.push_back(std::move(columnsAndValues));
+    columnsAndValues = std::vector<MatrixEntry<index_type, value_type>>();
+    // Reserve a bit more than the chunk size as the last row of the chunk may exceed it.
+    columnsAndValues.reserve(entriesPerChunk + entriesPerChunk / 8);
 }
 
 template<typename ValueType>
@@ -508,7 +568,8 @@ SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType> const& other)
       columnsAndValues(other.columnsAndValues),
       rowIndications(other.rowIndications),
       trivialRowGrouping(other.trivialRowGrouping),
-      rowGroupIndices(other.rowGroupIndices) {
+      rowGroupIndices(other.rowGroupIndices),
+      trivialRowGroupIndices(std::atomic_load(&other.trivialRowGroupIndices)) {
     // Intentionally left empty.
 }
 
@@ -528,7 +589,8 @@ SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType>&& other)
       columnsAndValues(std::move(other.columnsAndValues)),
       rowIndications(std::move(other.rowIndications)),
       trivialRowGrouping(other.trivialRowGrouping),
-      rowGroupIndices(std::move(other.rowGroupIndices)) {
+      rowGroupIndices(std::move(other.rowGroupIndices)),
+      trivialRowGroupIndices(std::move(other.trivialRowGroupIndices)) {
     // Now update the source matrix
     other.rowCount = 0;
     other.columnCount = 0;
@@ -547,6 +609,8 @@ SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_
       rowIndications(rowIndications),
       trivialRowGrouping(!rowGroupIndices),
       rowGroupIndices(rowGroupIndices) {
+    storm::utility::LargeArray::advise(this->columnsAndValues);
+    storm::utility::LargeArray::advise(this->rowIndications);
     this->updateNonzeroEntryCount();
 }
 
@@ -564,6 +628,8 @@ SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_
     this->rowCount = this->rowIndications.size() - 1;
     this->entryCount = this->columnsAndValues.size();
     this->trivialRowGrouping = !this->rowGroupIndices;
+    storm::utility::LargeArray::advise(this->columnsAndValues);
+    storm::utility::LargeArray::advise(this->rowIndications);
     this->updateNonzeroEntryCount();
 }
 
@@ -580,6 +646,7 @@ SparseMatrix<ValueType>& SparseMatrix<ValueType>::operator=(SparseMatrix<ValueTy
         rowIndications = other.rowIndications;
         rowGroupIndices = other.rowGroupIndices;
         trivialRowGrouping = other.trivialRowGrouping;
+        trivialRowGroupIndices = std::atomic_load(&other.trivialRowGroupIndices);
     }
     return *this;
 }
@@ -597,6 +664,7 @@ SparseMatrix<ValueType>& SparseMatrix<ValueType>::operator=(SparseMatrix<ValueTy
         rowIndications = std::move(other.rowIndications);
         rowGroupIndices = std::move(other.rowGroupIndices);
         trivialRowGrouping = other.trivialRowGrouping;
+        trivialRowGroupIndices = std::move(other.trivialRowGroupIndices);
     }
     return *this;
 }
@@ -690,7 +758,7 @@ typename SparseMatrix<ValueType>::index_type SparseMatrix<ValueType>::getNonzero
 }
 
 template<typename ValueType>
-void SparseMatrix<ValueType>::updateNonzeroEntryCount() const {
+void SparseMatrix<ValueType>::updateNonzeroEntryCount() {
     this->nonzeroEntryCount = 0;
     for (auto const& element : *this) {
         if (element.getValue() != storm::utility::zero<ValueType>()) {
@@ -705,7 +773,7 @@ void SparseMatrix<ValueType>::updateNonzeroEntryCount(std::make_signed<index_typ
 }
 
 template<typename ValueType>
-void SparseMatrix<ValueType>::updateDimensions() const {
+void SparseMatrix<ValueType>::updateDimensions() {
     this->nonzeroEntryCount = 0;
     this->columnCount = 0;
     for (auto const& element : *this) {
@@ -764,22 +832,31 @@ typename SparseMatrix<ValueType>::index_type SparseMatrix<ValueType>::getNumRows
 
 template<typename ValueType>
 std::vector<typename SparseMatrix<ValueType>::index_type> const& SparseMatrix<ValueType>::getRowGroupIndices() const {
-    // If there is no current row grouping, we need to create it.
-    if (!this->rowGroupIndices) {
-        STORM_LOG_ASSERT(trivialRowGrouping, "Only trivial row-groupings can be constructed on-the-fly.");
-        this->rowGroupIndices = storm::utility::vector::buildVectorForRange(static_cast<index_type>(0), this->getRowGroupCount() + 1);
+    if (!trivialRowGrouping) {
+        return rowGroupIndices.get();
     }
-    return rowGroupIndices.get();
+
+    // If the trivial row grouping was not requested before, we need to create it. As several threads may do so at the same time, only the
+    // first created grouping is installed.
+    std::shared_ptr<std::vector<index_type> const> indices = std::atomic_load(&trivialRowGroupIndices);
+    if (!indices) {
+        auto newIndices = std::make_shared<std::vector<index_type> const>(
+            storm::utility::vector::buildVectorForRange(static_cast<index_type>(0), this->getRowGroupCount() + 1));
+        if (std::atomic_compare_exchange_strong(&trivialRowGroupIndices, &indices, newIndices)) {
+            indices = newIndices;
+        }
+    }
+    return *indices;
 }
 
 template<typename ValueType>
 boost::integer_range<typename SparseMatrix<ValueType>::index_type> SparseMatrix<ValueType>::getRowGroupIndices(index_type group) const {
     STORM_LOG_ASSERT(group < this->getRowGroupCount(),
                      "Invalid row group index:" << group << ". Only " << this->getRowGroupCount() << " row groups available.");
-    if (this->rowGroupIndices) {
-        return boost::irange(rowGroupIndices.get()[group], rowGroupIndices.get()[group + 1]);
-    } else {
+    if (trivialRowGrouping) {
         return boost::irange(group, group + 1);
+    } else {
+        return boost::irange(rowGroupIndices.get()[group], rowGroupIndices.get()[group + 1]);
     }
 }
 
@@ -797,6 +874,7 @@ template<typename ValueType>
 void SparseMatrix<ValueType>::setRowGroupIndices(std::vector<index_type> const& newRowGroupIndices) {
     trivialRowGrouping = false;
     rowGroupIndices = newRowGroupIndices;
+    trivialRowGroupIndices.reset();
 }
 
 template<typename ValueType>
@@ -806,11 +884,7 @@ bool SparseMatrix<ValueType>::hasTrivialRowGrouping() const {
 
 template<typename ValueType>
 void SparseMatrix<ValueType>::makeRowGroupingTrivial() {
-    if (trivialRowGrouping) {
-        STORM_LOG_ASSERT(
-            !rowGroupIndices || rowGroupIndices.get() == storm::utility::vector::buildVectorForRange(static_cast<index_type>(0), this->getRowGroupCount() + 1),
-            "Row grouping is supposed to be trivial but actually it is not.");
-    } else {
+    if (!trivialRowGrouping) {
         trivialRowGrouping = true;
         rowGroupIndices = boost::none;
     }
@@ -1353,7 +1427,7 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowGroups(std::ve
     }
 
     // Now create the matrix to be returned with the appropriate size.
-    SparseMatrixBuilder<ValueType> matrixBuilder(rowGroupIndices.get().size() - 1, columnCount, subEntries);
+    SparseMatrixBuilder<ValueType> matrixBuilder(this->getRowGroupCount(), columnCount, subEntries);
 
     // Copy over the selected lines from the source matrix.
     for (index_type rowGroupIndex = 0, rowGroupIndexEnd = rowGroupToRowIndexMapping.size(); rowGroupIndex < rowGroupIndexEnd; ++rowGroupIndex) {
@@ -1441,7 +1515,7 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_t
     }
     // Finally create matrix and return result.
     auto result = matrixBuilder.build();
-    if (this->rowGroupIndices) {
+    if (!trivialRowGrouping) {
         result.setRowGroupIndices(this->rowGroupIndices.get());
     }
     return result;
@@ -1455,8 +1529,13 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool
     if (keepZeros) {
         entryCount = this->getEntryCount();
     } else {
-        this->updateNonzeroEntryCount();
-        entryCount = this->getNonzeroEntryCount();
+        // The cached count may be outdated if values were modified through iterators, so we count the entries without modifying the matrix.
+        entryCount = 0;
+        for (auto const& element : *this) {
+            if (element.getValue() != storm::utility::zero<ValueType>()) {
+                ++entryCount;
+            }
+        }
     }
 
     std::vector<index_type> rowIndications(rowCount + 1);
@@ -1803,13 +1882,16 @@ class TbbMultAddFunctor {
 
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
-                                                         std::vector<value_type> const* summand) const {
+                                                         std::vector<value_type> const* summand, tbb::affinity_partitioner* partitioner) const {
     if (&vector == &result) {
         STORM_LOG_WARN(
             "Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
         std::vector<ValueType> tmpVector(this->getRowCount());
-        multiplyWithVectorParallel(vector, tmpVector);
+        multiplyWithVectorParallel(vector, tmpVector, summand, partitioner);
         result = std::move(tmpVector);
+    } else if (partitioner) {
+        tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 100),
+                          TbbMultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand), *partitioner);
     } else {
         tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 100),
                           TbbMultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand));
@@ -2193,18 +2275,28 @@ class TbbMultAddReduceFunctor {
     std::vector<uint64_t>* choices;
 };
 
+template<typename ValueType>
+template<typename Compare>
+void SparseMatrix<ValueType>::multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                        std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                                        tbb::affinity_partitioner* partitioner) const {
+    TbbMultAddReduceFunctor<ValueType, Compare> functor(rowGroupIndices, columnsAndValues, rowIndications, vector, result, summand, choices);
+    if (partitioner) {
+        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100), functor, *partitioner);
+    } else {
+        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100), functor);
+    }
+}
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                         std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
-                                                        std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+                                                        std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                                        tbb::affinity_partitioner* partitioner) const {
     if (dir == storm::OptimizationDirection::Minimize) {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100),
-                          TbbMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector,
-                                                                                                     result, summand, choices));
+        multiplyAndReduceParallel<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices, partitioner);
     } else {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100),
-                          TbbMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications,
-                                                                                                        vector, result, summand, choices));
+        multiplyAndReduceParallel<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices, partitioner);
     }
 }
 
@@ -2213,7 +2305,8 @@ template<>
 void SparseMatrix<storm::RationalFunction>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                                       std::vector<storm::RationalFunction> const& vector,
                                                                       std::vector<storm::RationalFunction> const* summand,
-                                                                      std::vector<storm::RationalFunction>& result, std::vector<uint64_t>* choices) const {
+                                                                      std::vector<storm::RationalFunction>& result, std::vector<uint64_t>* choices,
+                                                                      tbb::affinity_partitioner* partitioner) const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
 }
 #endif
@@ -2241,6 +2334,106 @@ void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir
     }
 }
 
+template<typename ValueType>
+void SparseMatrix<ValueType>::multiplyWithDenseMatrix(std::vector<ValueType> const& denseMatrix, uint64_t numberOfColumns, std::vector<ValueType>& result,
+                                                      std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&denseMatrix != &result, "Matrices must not be aliased.");
+    STORM_LOG_ASSERT(denseMatrix.size() == this->getColumnCount() * numberOfColumns, "Dense matrix has unexpected size.");
+    STORM_LOG_ASSERT(result.size() == this->getRowCount() * numberOfColumns, "Result matrix has unexpected size.");
+
+    auto resultIt = result.begin();
+    typename std::vector<ValueType>::const_iterator summandIt;
+    if (summand) {
+        summandIt = summand->begin();
+    }
+    for (index_type row = 0; row < this->getRowCount(); ++row) {
+        auto const resultRowEnd = resultIt + numberOfColumns;
+        if (summand) {
+            std::copy(summandIt, summandIt + numberOfColumns, resultIt);
+            summandIt += numberOfColumns;
+        } else {
+            std::fill(resultIt, resultRowEnd, storm::utility::zero<ValueType>());
+        }
+        for (auto const& entry : this->getRow(row)) {
+            auto denseIt = denseMatrix.begin() + entry.getColumn() * numberOfColumns;
+            for (auto it = resultIt; it != resultRowEnd; ++it, ++denseIt) {
+                *it += entry.getValue() * *denseIt;
+            }
+        }
+        resultIt = resultRowEnd;
+    }
+}
+
+template<typename ValueType>
+void SparseMatrix<ValueType>::multiplyAndReduceWithDenseMatrix(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                               std::vector<ValueType> const& denseMatrix, uint64_t numberOfColumns,
+                                                               std::vector<ValueType> const* summand, std::vector<ValueType>& result) const {
+    if (dir == OptimizationDirection::Minimize) {
+        multiplyAndReduceWithDenseMatrix<storm::utility::ElementLess<ValueType>>(rowGroupIndices, denseMatrix, numberOfColumns, summand, result);
+    } else {
+        multiplyAndReduceWithDenseMatrix<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, denseMatrix, numberOfColumns, summand, result);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void SparseMatrix<ValueType>::multiplyAndReduceWithDenseMatrix(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& denseMatrix,
+                                                               uint64_t numberOfColumns, std::vector<ValueType> const* summand,
+                                                               std::vector<ValueType>& result) const {
+    STORM_LOG_ASSERT(&denseMatrix != &result, "Matrices must not be aliased.");
+    STORM_LOG_ASSERT(denseMatrix.size() == this->getColumnCount() * numberOfColumns, "Dense matrix has unexpected size.");
+    STORM_LOG_ASSERT(result.size() == (rowGroupIndices.size() - 1) * numberOfColumns, "Result matrix has unexpected size.");
+
+    Compare compare;
+    // Holds the values of the current row if it is not the first one of its group.
+    std::vector<ValueType> rowValues(numberOfColumns);
+    auto multiplyRow = [&](index_type row, typename std::vector<ValueType>::iterator target) {
+        auto const targetEnd = target + numberOfColumns;
+        if (summand) {
+            std::copy(summand->begin() + row * numberOfColumns, summand->begin() + (row + 1) * numberOfColumns, target);
+        } else {
+            std::fill(target, targetEnd, storm::utility::zero<ValueType>());
+        }
+        for (auto const& entry : this->getRow(row)) {
+            auto denseIt = denseMatrix.begin() + entry.getColumn() * numberOfColumns;
+            for (auto it = target; it != targetEnd; ++it, ++denseIt) {
+                *it += entry.getValue() * *denseIt;
+            }
+        }
+    };
+
+    auto resultIt = result.begin();
+    for (auto groupIt = rowGroupIndices.begin(), groupIte = rowGroupIndices.end() - 1; groupIt != groupIte; ++groupIt) {
+        if (*groupIt == *(groupIt + 1)) {
+            // Groups without rows get value zero.
+            std::fill(resultIt, resultIt + numberOfColumns, storm::utility::zero<ValueType>());
+        } else {
+            multiplyRow(*groupIt, resultIt);
+            for (index_type row = *groupIt + 1; row < *(groupIt + 1); ++row) {
+                multiplyRow(row, rowValues.begin());
+                auto it = resultIt;
+                for (auto& value : rowValues) {
+                    if (compare(value, *it)) {
+                        *it = std::move(value);
+                    }
+                    ++it;
+                }
+            }
+        }
+        resultIt += numberOfColumns;
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+void SparseMatrix<storm::RationalFunction>::multiplyAndReduceWithDenseMatrix(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                             std::vector<storm::RationalFunction> const& denseMatrix, uint64_t numberOfColumns,
+                                                                             std::vector<storm::RationalFunction> const* summand,
+                                                                             std::vector<storm::RationalFunction>& result) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+#endif
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyVectorWithMatrix(std::vector<value_type> const& vector, std::vector<value_type>& result) const {
     const_iterator it = this->begin();
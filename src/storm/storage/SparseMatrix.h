@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <iterator>
+#include <memory>
 #include <vector>
 
 #include <boost/functional/hash.hpp>
@@ -38,6 +39,9 @@ namespace storage {
 template<typename T>
 class SparseMatrix;
 
+template<typename T, typename ColumnIndexType, typename StorageValueType>
+class SoaSparseMatrix;
+
 typedef uint64_t SparseMatrixIndexType;
 
 template<typename IndexType, typename ValueType>
@@ -252,7 +256,21 @@ class SparseMatrixBuilder {
      */
     void addDiagonalEntry(index_type row, ValueType const& value);
 
+    /*!
+     * Makes the builder store the entries of completed rows in chunks of (roughly) the given size instead of a single growing vector. The
+     * final matrix is then assembled with exactly the required size. This avoids the reallocations (and the temporarily doubled memory
+     * consumption) caused by the growth of the entry vector, which is helpful if the number of entries is large and not known upfront.
+     *
+     * @param entriesPerChunk The number of entries after which a new chunk is started (at the next row).
+     */
+    void useChunkedEntryStorage(index_type entriesPerChunk);
+
    private:
+    /*!
+     * Moves the entries of the current chunk to the completed chunks and starts a new chunk.
+     */
+    void sealCurrentChunk();
+
     // A flag indicating whether a row count was set upon construction.
     bool initialRowCountSet;
 
@@ -286,9 +304,19 @@ class SparseMatrixBuilder {
     // The vector that stores the row-group indices (if they are non-trivial).
     boost::optional<std::vector<index_type>> rowGroupIndices;
 
-    // The storage for the columns and values of all entries in the matrix.
+    // The storage for the columns and values of all entries in the matrix. If the entries are stored in chunks, this only holds the entries of
+    // the current chunk.
     std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
 
+    // The number of entries after which a new chunk is started (zero if the entries are not stored in chunks).
+    index_type entriesPerChunk;
+
+    // The completed chunks of entries (only used if the entries are stored in chunks). Every row is contained in a single chunk.
+    std::vector<std::vector<MatrixEntry<index_type, value_type>>> completedChunks;
+
+    // The number of entries in the completed chunks.
+    index_type completedChunksEntryCount;
+
     // A vector containing the indices at which each given row begins. This index is to be interpreted as an
     // index in the valueStorage and the columnIndications vectors. Put differently, the values of the entries
     // in row i are valueStorage[rowIndications[i]] to valueStorage[rowIndications[i + 1]] where the last
@@ -330,6 +358,9 @@ class SparseMatrixBuilder {
  *
  * It should be observed that due to the nature of the sparse matrix format, entries can only be inserted in
  * order, i.e. row by row and column by column.
+ *
+ * All const member functions are safe to be called concurrently on the same matrix (as long as no non-const member function is called at
+ * the same time), so a matrix can be shared read-only between threads.
  */
 template<typename ValueType>
 class SparseMatrix {
@@ -340,6 +371,8 @@ class SparseMatrix {
     friend class storm::adapters::StormAdapter;
     friend class storm::solver::TopologicalCudaValueIterationMinMaxLinearEquationSolver<ValueType>;
     friend class SparseMatrixBuilder<ValueType>;
+    template<typename OtherValueType, typename ColumnIndexType, typename StorageValueType>
+    friend class SoaSparseMatrix;
 
     typedef SparseMatrixIndexType index_type;
     typedef ValueType value_type;
@@ -551,12 +584,12 @@ class SparseMatrix {
     /*!
      * Recompute the nonzero entry count
      */
-    void updateNonzeroEntryCount() const;
+    void updateNonzeroEntryCount();
 
     /*!
      * Recomputes the number of columns and the number of non-zero entries.
      */
-    void updateDimensions() const;
+    void updateDimensions();
 
     /*!
      * Change the nonzero entry count by the provided value.
@@ -591,7 +624,8 @@ class SparseMatrix {
     index_type getNumRowsInRowGroups(storm::storage::BitVector const& groupConstraint) const;
 
     /*!
-     * Returns the grouping of rows of this matrix.
+     * Returns the grouping of rows of this matrix. For a trivial row grouping, the indices are created on the first request, which may happen
+     * concurrently.
      *
      * @return The grouping of rows of this matrix.
      */
@@ -909,8 +943,15 @@ class SparseMatrix {
     void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result,
                                     std::vector<value_type> const* summand = nullptr) const;
 #ifdef STORM_HAVE_INTELTBB
-    void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result,
-                                    std::vector<value_type> const* summand = nullptr) const;
+    /*!
+     * Same as multiplyWithVector, but parallelized using Intel TBB.
+     *
+     * @param partitioner If given, this partitioner is used to distribute the rows among the threads. Passing the same partitioner to
+     * repeated multiplications makes the threads process the same rows in each multiplication, which keeps the accessed
+     * memory local to the cache (and NUMA node) of the threads.
+     */
+    void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr,
+                                    tbb::affinity_partitioner* partitioner = nullptr) const;
 #endif
 
     /*!
@@ -944,14 +985,43 @@ class SparseMatrix {
     void multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b,
                                    std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
 #ifdef STORM_HAVE_INTELTBB
+    /*!
+     * Same as multiplyAndReduce, but parallelized using Intel TBB. If given, the partitioner is used to distribute the row groups
+     * among the threads (see multiplyWithVectorParallel).
+     */
     void multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                    std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result,
-                                   std::vector<uint64_t>* choices) const;
+                                   std::vector<uint64_t>* choices, tbb::affinity_partitioner* partitioner = nullptr) const;
     template<typename Compare>
     void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b,
-                                   std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+                                   std::vector<ValueType>& result, std::vector<uint64_t>* choices, tbb::affinity_partitioner* partitioner) const;
 #endif
 
+    /*!
+     * Multiplies the matrix with the given dense matrix and writes the result to the given dense result matrix. Both dense matrices
+     * store their rows consecutively, i.e., the entry in row i and column j resides at position i * numberOfColumns + j. Compared
+     * to multiplying the matrix with each column separately, every entry of the sparse matrix is loaded only once.
+     *
+     * @param denseMatrix The dense matrix with which to multiply. It has getColumnCount() rows.
+     * @param numberOfColumns The number of columns of the dense matrices.
+     * @param result The dense matrix with getRowCount() rows that is supposed to hold the result of the multiplication after the
+     * operation. It must not be the same as the given dense matrix.
+     * @param summand If given, this dense matrix with getRowCount() rows will be added to the result of the multiplication.
+     */
+    void multiplyWithDenseMatrix(std::vector<ValueType> const& denseMatrix, uint64_t numberOfColumns, std::vector<ValueType>& result,
+                                 std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Same as multiplyWithDenseMatrix, but afterwards reduces each column over the given row groups according to the given direction.
+     * The result hence has one row per row group.
+     */
+    void multiplyAndReduceWithDenseMatrix(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                          std::vector<ValueType> const& denseMatrix, uint64_t numberOfColumns, std::vector<ValueType> const* summand,
+                                          std::vector<ValueType>& result) const;
+    template<typename Compare>
+    void multiplyAndReduceWithDenseMatrix(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& denseMatrix, uint64_t numberOfColumns,
+                                          std::vector<ValueType> const* summand, std::vector<ValueType>& result) const;
+
     /*!
      * Multiplies a single row of the matrix with the given vector and returns the result
      *
@@ -1216,29 +1286,42 @@ class SparseMatrix {
     index_type rowCount;
 
     // The number of columns of the matrix.
-    mutable index_type columnCount;
+    index_type columnCount;
 
     // The number of entries in the matrix.
     index_type entryCount;
 
     // The number of nonzero entries in the matrix.
-    mutable index_type nonzeroEntryCount;
+    index_type nonzeroEntryCount;
 
-    // The storage for the columns and values of all entries in the matrix.
+    // The storage for the columns and values of all entries in the matrix. If the entries are stored in chunks, this only holds the entries of
+    // the current chunk.
     std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
 
+    // The number of entries after which a new chunk is started (zero if the entries are not stored in chunks).
+    index_type entriesPerChunk;
+
+    // The completed chunks of entries (only used if the entries are stored in chunks). Every row is contained in a single chunk.
+    std::vector<std::vector<MatrixEntry<index_type, value_type>>> completedChunks;
+
+    // The number of entries in the completed chunks.
+    index_type completedChunksEntryCount;
+
     // A vector containing the indices at which each given row begins. This index is to be interpreted as an
     // index in the valueStorage and the columnIndications vectors. Put differently, the values of the entries
     // in row i are valueStorage[rowIndications[i]] to valueStorage[rowIndications[i + 1]] where the last
     // entry is not included anymore.
     std::vector<index_type> rowIndications;
 
-    // A flag indicating whether the matrix has a trivial row grouping. Note that this may be true and yet
-    // there may be row group indices, because they were requested from the outside.
+    // A flag indicating whether the matrix has a trivial row grouping.
     bool trivialRowGrouping;
 
-    // A vector indicating the row groups of the matrix. This needs to be mutible in case we create it on-the-fly.
-    mutable boost::optional<std::vector<index_type>> rowGroupIndices;
+    // A vector indicating the row groups of the matrix (if they are non-trivial).
+    boost::optional<std::vector<index_type>> rowGroupIndices;
+
+    // The indices of a trivial row grouping. They are only created on request and are then never modified, such that they can be created and
+    // shared by concurrent readers of the matrix.
+    mutable std::shared_ptr<std::vector<index_type> const> trivialRowGroupIndices;
 };
 
 }  // namespace storage
@@ -0,0 +1,251 @@
+#include "storm/storage/SparseMatrixView.h"
+
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+SparseMatrixView<ValueType>::SparseMatrixView(SparseMatrix<ValueType> const& matrix, bool useGroups, storm::storage::BitVector const& rowConstraint,
+                                              storm::storage::BitVector const& columnConstraint, storm::storage::BitVector const& makeZeroColumns)
+    : matrix(matrix), trivialRowGrouping(matrix.hasTrivialRowGrouping()), columnMapping(matrix.getColumnCount(), getInvalidColumn()), columnCount(0) {
+    STORM_LOG_THROW(!rowConstraint.empty() && !columnConstraint.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
+
+    // Renumber the selected columns.
+    for (auto column : columnConstraint) {
+        if (column < columnMapping.size() && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(column))) {
+            columnMapping[column] = columnCount;
+        }
+        ++columnCount;
+    }
+
+    // Collect the selected rows and build the row grouping of the view in the same way as getSubmatrix.
+    rowGroupIndices.push_back(0);
+    if (useGroups) {
+        std::vector<index_type> const& originalRowGroupIndices = matrix.getRowGroupIndices();
+        for (auto group : rowConstraint) {
+            for (index_type row = originalRowGroupIndices[group]; row < originalRowGroupIndices[group + 1]; ++row) {
+                rows.push_back(row);
+            }
+            rowGroupIndices.push_back(rows.size());
+        }
+    } else if (trivialRowGrouping) {
+        for (auto row : rowConstraint) {
+            rows.push_back(row);
+            rowGroupIndices.push_back(rows.size());
+        }
+    } else {
+        // Row groups without a selected row are dropped.
+        std::vector<index_type> const& originalRowGroupIndices = matrix.getRowGroupIndices();
+        for (index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
+            for (index_type row = rowConstraint.getNextSetIndex(originalRowGroupIndices[group]); row < originalRowGroupIndices[group + 1];
+                 row = rowConstraint.getNextSetIndex(row + 1)) {
+                rows.push_back(row);
+            }
+            if (rows.size() > rowGroupIndices.back()) {
+                rowGroupIndices.push_back(rows.size());
+            }
+        }
+    }
+    rows.shrink_to_fit();
+    rowGroupIndices.shrink_to_fit();
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getRowCount() const {
+    return rows.size();
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getRowGroupCount() const {
+    return rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType>
+std::vector<typename SparseMatrixView<ValueType>::index_type> const& SparseMatrixView<ValueType>::getRowGroupIndices() const {
+    return rowGroupIndices;
+}
+
+template<typename ValueType>
+bool SparseMatrixView<ValueType>::hasTrivialRowGrouping() const {
+    return trivialRowGrouping;
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getOriginalRow(index_type row) const {
+    return rows[row];
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getColumn(index_type originalColumn) const {
+    return columnMapping[originalColumn];
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getEntryCount() const {
+    index_type result = 0;
+    for (auto row : rows) {
+        for (auto const& entry : matrix.getRow(row)) {
+            if (columnMapping[entry.getColumn()] != getInvalidColumn()) {
+                ++result;
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType SparseMatrixView<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    for (auto const& entry : matrix.getRow(rows[row])) {
+        index_type column = columnMapping[entry.getColumn()];
+        if (column != getInvalidColumn()) {
+            result += entry.getValue() * vector[column];
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void SparseMatrixView<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                     std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "The input and the result vector must not be the same.");
+    for (index_type row = 0, rowCount = rows.size(); row < rowCount; ++row) {
+        result[row] = multiplyRowWithVector(row, vector);
+        if (summand) {
+            result[row] += (*summand)[row];
+        }
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixView<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& vector,
+                                                    std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                    std::vector<uint64_t>* choices) const {
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    } else if (dir == storm::OptimizationDirection::Minimize) {
+        multiplyAndReduce<storm::utility::ElementLess<ValueType>>(vector, summand, result, choices);
+    } else {
+        multiplyAndReduce<storm::utility::ElementGreater<ValueType>>(vector, summand, result, choices);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void SparseMatrixView<ValueType>::multiplyAndReduce(std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                    std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&vector != &result, "The input and the result vector must not be the same.");
+    Compare compare;
+    uint64_t const groupCount = rowGroupIndices.size() - 1;
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        ValueType currentValue = multiplyRowWithVector(groupStart, vector);
+        if (summand) {
+            currentValue += (*summand)[groupStart];
+        }
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        ValueType oldSelectedChoiceValue;
+        uint64_t selectedChoice = 0;
+        if (choices && (*choices)[group] == 0) {
+            oldSelectedChoiceValue = currentValue;
+        }
+
+        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+            ValueType newValue = multiplyRowWithVector(row, vector);
+            if (summand) {
+                newValue += (*summand)[row];
+            }
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = row - groupStart;
+            }
+        }
+
+        // Finally write value to target vector.
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        result[group] = std::move(currentValue);
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixView<ValueType>::repeatedMultiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
+    std::vector<ValueType> tmp(getRowCount());
+    for (uint64_t i = 0; i < n; ++i) {
+        multiplyWithVector(x, tmp, b);
+        std::swap(x, tmp);
+    }
+}
+
+template<typename ValueType>
+void SparseMatrixView<ValueType>::repeatedMultiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType>& x,
+                                                            std::vector<ValueType> const* b, uint64_t n) const {
+    std::vector<ValueType> tmp(getRowGroupCount());
+    for (uint64_t i = 0; i < n; ++i) {
+        multiplyAndReduce(dir, x, b, tmp);
+        std::swap(x, tmp);
+    }
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrixView<ValueType>::toSparseMatrix() const {
+    SparseMatrixBuilder<ValueType> matrixBuilder(getRowCount(), getColumnCount(), getEntryCount(), true, !trivialRowGrouping);
+    index_type group = 0;
+    for (index_type row = 0, rowCount = rows.size(); row < rowCount; ++row) {
+        if (!trivialRowGrouping) {
+            while (group < getRowGroupCount() && rowGroupIndices[group] == row) {
+                matrixBuilder.newRowGroup(row);
+                ++group;
+            }
+        }
+        for (auto const& entry : matrix.getRow(rows[row])) {
+            index_type column = columnMapping[entry.getColumn()];
+            if (column != getInvalidColumn()) {
+                matrixBuilder.addNextValue(row, column, entry.getValue());
+            }
+        }
+    }
+    // Add the trailing empty row groups.
+    if (!trivialRowGrouping) {
+        for (; group < getRowGroupCount(); ++group) {
+            matrixBuilder.newRowGroup(getRowCount());
+        }
+    }
+    return matrixBuilder.build();
+}
+
+template class SparseMatrixView<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SparseMatrixView<storm::RationalNumber>;
+template class SparseMatrixView<storm::RationalFunction>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
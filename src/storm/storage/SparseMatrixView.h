@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only view on a submatrix of a sparse matrix, i.e., on the matrix that SparseMatrix::getSubmatrix would return. Instead of copying
+ * the selected entries, the view only stores which rows of the original matrix it consists of and how the selected columns are renumbered.
+ * Its memory consumption therefore only depends on the number of rows and columns, but not on the number of entries. This makes it
+ * preferable over an explicit submatrix if the submatrix is only used for few operations (e.g. a bounded number of multiplications) or if a
+ * copy would exceed the available memory.
+ *
+ * The original matrix must not be modified or destroyed while the view is in use.
+ */
+template<typename ValueType>
+class SparseMatrixView {
+   public:
+    typedef SparseMatrixIndexType index_type;
+    typedef ValueType value_type;
+
+    /*!
+     * Creates a view on the submatrix of the given matrix that keeps the rows and columns selected by the given constraints. The rows, columns
+     * and row groups of the view are the same as the ones of getSubmatrix(useGroups, rowConstraint, columnConstraint, false, makeZeroColumns).
+     *
+     * @param matrix The matrix on which to create the view.
+     * @param useGroups If set to true, the row constraint is interpreted as selecting whole row groups.
+     * @param rowConstraint A bit vector indicating which rows (or row groups) to keep.
+     * @param columnConstraint A bit vector indicating which columns to keep.
+     * @param makeZeroColumns If given, the entries in these columns are dropped (but the columns keep their index).
+     */
+    SparseMatrixView(SparseMatrix<ValueType> const& matrix, bool useGroups, storm::storage::BitVector const& rowConstraint,
+                     storm::storage::BitVector const& columnConstraint, storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector());
+
+    /*!
+     * Retrieves the number of rows of the view.
+     */
+    index_type getRowCount() const;
+
+    /*!
+     * Retrieves the number of columns of the view.
+     */
+    index_type getColumnCount() const;
+
+    /*!
+     * Retrieves the number of row groups of the view.
+     */
+    index_type getRowGroupCount() const;
+
+    /*!
+     * Retrieves the row group indices of the view. If the view has a trivial row grouping, every row forms a row group.
+     */
+    std::vector<index_type> const& getRowGroupIndices() const;
+
+    /*!
+     * Retrieves whether the view has a trivial row grouping.
+     */
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * Retrieves the index of the row of the original matrix that corresponds to the given row of the view.
+     */
+    index_type getOriginalRow(index_type row) const;
+
+    /*!
+     * Retrieves the index of the column of the view that corresponds to the given column of the original matrix (or getInvalidColumn() if the
+     * column is not part of the view).
+     */
+    index_type getColumn(index_type originalColumn) const;
+
+    /*!
+     * Retrieves the index that marks columns that are not part of the view.
+     */
+    static constexpr index_type getInvalidColumn() {
+        return std::numeric_limits<index_type>::max();
+    }
+
+    /*!
+     * Retrieves the number of entries of the viewed submatrix. Note that this requires a pass over all selected rows.
+     */
+    index_type getEntryCount() const;
+
+    /*!
+     * Multiplies the given row of the view with the given vector and returns the result.
+     */
+    ValueType multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const;
+
+    /*!
+     * Multiplies the view with the given vector and writes the result to the given result vector. The result vector may not be the same as
+     * the input vector.
+     *
+     * @param vector The vector with which to multiply the view.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the view with the given vector and reduces the result within every row group of the view according to the given direction.
+     * For the tracking of choices, the same conventions as for SparseMatrix::multiplyAndReduce apply.
+     *
+     * @param dir The optimization direction for the reduction.
+     * @param vector The vector with which to multiply the view.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param choices If given, the choices made in the reduction process will be written to this vector.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                           std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * Performs n matrix-vector multiplications x' = A*x + b with the view.
+     *
+     * @param x The input vector with which to multiply the view. Its length must be equal to the number of columns. After the method returns,
+     * this vector holds the result.
+     * @param b If given, this vector is added after each multiplication. Its length must be equal to the number of rows.
+     * @param n The number of times to perform the multiplication.
+     */
+    void repeatedMultiply(std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const;
+
+    /*!
+     * Performs n matrix-vector multiplications x' = A*x + b with the view and reduces the result within every row group after each
+     * multiplication.
+     *
+     * @param dir The optimization direction for the reduction.
+     * @param x The input vector with which to multiply the view. Its length must be equal to the number of columns. After the method returns,
+     * this vector holds the result.
+     * @param b If given, this vector is added after each multiplication. Its length must be equal to the number of rows.
+     * @param n The number of times to perform the multiplication.
+     */
+    void repeatedMultiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                   uint64_t n) const;
+
+    /*!
+     * Materializes the viewed submatrix.
+     *
+     * @return A matrix that is equal to the submatrix that the view represents.
+     */
+    SparseMatrix<ValueType> toSparseMatrix() const;
+
+   private:
+    template<typename Compare>
+    void multiplyAndReduce(std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                           std::vector<uint64_t>* choices) const;
+
+    // The viewed matrix.
+    SparseMatrix<ValueType> const& matrix;
+
+    // For every row of the view, the corresponding row of the original matrix.
+    std::vector<index_type> rows;
+
+    // The row groups of the view.
+    std::vector<index_type> rowGroupIndices;
+
+    // Whether the view has a trivial row grouping.
+    bool trivialRowGrouping;
+
+    // For every column of the original matrix, the corresponding column of the view (or the invalid column if the column is dropped).
+    std::vector<index_type> columnMapping;
+
+    // The number of columns of the view.
+    index_type columnCount;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,8 +1,17 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include <storm/utility/vector.h>
+
+#include <atomic>
+#include <functional>
+#include <limits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
 
@@ -23,7 +32,7 @@ StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDe
 
 template<typename ValueType>
 StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(StronglyConnectedComponentDecomposition const& other)
-    : Decomposition(other) {
+    : Decomposition(other), sccDepths(other.sccDepths) {
     // Intentionally left empty.
 }
 
@@ -31,12 +40,13 @@ template<typename ValueType>
 StronglyConnectedComponentDecomposition<ValueType>& StronglyConnectedComponentDecomposition<ValueType>::operator=(
     StronglyConnectedComponentDecomposition const& other) {
     this->blocks = other.blocks;
+    this->sccDepths = other.sccDepths;
     return *this;
 }
 
 template<typename ValueType>
 StronglyConnectedComponentDecomposition<ValueType>::StronglyConnectedComponentDecomposition(StronglyConnectedComponentDecomposition&& other)
-    : Decomposition(std::move(other)) {
+    : Decomposition(std::move(other)), sccDepths(std::move(other.sccDepths)) {
     // Intentionally left empty.
 }
 
@@ -44,6 +54,7 @@ template<typename ValueType>
 StronglyConnectedComponentDecomposition<ValueType>& StronglyConnectedComponentDecomposition<ValueType>::operator=(
     StronglyConnectedComponentDecomposition&& other) {
     this->blocks = std::move(other.blocks);
+    this->sccDepths = std::move(other.sccDepths);
     return *this;
 }
 
@@ -166,9 +177,278 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Uses the forward-backward algorithm (Fleischer/Hendrickson/Pinar) with an initial trimming step to compute
+ * a mapping of states to their SCCs in parallel. Afterwards, the SCCs are numbered in a topological order
+ * (i.e., an SCC may only reach SCCs with a smaller index) just like by the sequential algorithm.
+ *
+ * @param transitionMatrix The transition matrix of the system to decompose.
+ * @param nonTrivialStates A bit vector where entries for non-trivial states (states that either have a selfloop or whose SCC is not a singleton) will be set to
+ * true
+ * @param subsystem An optional bit vector indicating which subsystem to consider.
+ * @param choices An optional bit vector indicating which choices belong to the subsystem.
+ * @param stateToSccMapping A mapping from states to the SCC indices they belong to. As a side effect of this
+ * function this mapping is filled for all states of the subsystem.
+ * @param sccDepths If not null, the depth of each SCC is stored in this vector.
+ * @return The number of SCCs.
+ */
+template<typename ValueType>
+uint_fast64_t performParallelSccDecompositionFB(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector& nonTrivialStates,
+                                                storm::storage::BitVector const* subsystem, storm::storage::BitVector const* choices,
+                                                std::vector<uint_fast64_t>& stateToSccMapping, std::vector<uint_fast64_t>* sccDepths) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+    auto isConsidered = [subsystem](uint64_t state) { return !subsystem || subsystem->get(state); };
+
+    // Build the state-based graph of the (sub)system in forward and backward direction. Selfloops are not included.
+    std::vector<uint64_t> successorIndications(numberOfStates + 1, 0);
+    std::vector<uint8_t> hasSelfloop(numberOfStates, 0);
+    auto forEachSuccessor = [&](uint64_t state, auto const& action) {
+        for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if (isConsidered(successor.getColumn()) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                    action(successor.getColumn());
+                }
+            }
+        }
+    };
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t state = range.begin(); state != range.end(); ++state) {
+            if (isConsidered(state)) {
+                forEachSuccessor(state, [&](uint64_t successor) {
+                    if (successor == state) {
+                        hasSelfloop[state] = 1;
+                    } else {
+                        ++successorIndications[state + 1];
+                    }
+                });
+            }
+        }
+    });
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        successorIndications[state + 1] += successorIndications[state];
+    }
+    std::vector<uint64_t> successors(successorIndications.back());
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t state = range.begin(); state != range.end(); ++state) {
+            if (isConsidered(state)) {
+                uint64_t position = successorIndications[state];
+                forEachSuccessor(state, [&](uint64_t successor) {
+                    if (successor != state) {
+                        successors[position++] = successor;
+                    }
+                });
+            }
+        }
+    });
+    std::vector<uint64_t> predecessorIndications(numberOfStates + 1, 0);
+    for (auto const& successor : successors) {
+        ++predecessorIndications[successor + 1];
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        predecessorIndications[state + 1] += predecessorIndications[state];
+    }
+    std::vector<uint64_t> predecessors(successors.size());
+    {
+        std::vector<uint64_t> positions(predecessorIndications.begin(), predecessorIndications.end() - 1);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (uint64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+                predecessors[positions[successors[index]]++] = state;
+            }
+        }
+    }
+
+    std::vector<uint64_t> sccIndices(numberOfStates, noScc);
+    std::atomic<uint64_t> sccCount(0);
+
+    // Trimming: states without predecessors or without successors (among the remaining states) form singleton SCCs.
+    // This is done before the actual forward-backward search, because it typically removes a large part of the states.
+    {
+        std::vector<uint64_t> inDegrees(numberOfStates), outDegrees(numberOfStates);
+        std::vector<uint64_t> trimQueue;
+        storm::storage::BitVector isTrimmed(numberOfStates, false);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (isConsidered(state)) {
+                inDegrees[state] = predecessorIndications[state + 1] - predecessorIndications[state];
+                outDegrees[state] = successorIndications[state + 1] - successorIndications[state];
+                if (inDegrees[state] == 0 || outDegrees[state] == 0) {
+                    trimQueue.push_back(state);
+                    isTrimmed.set(state);
+                }
+            }
+        }
+        while (!trimQueue.empty()) {
+            uint64_t state = trimQueue.back();
+            trimQueue.pop_back();
+            sccIndices[state] = sccCount++;
+            for (uint64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+                uint64_t successor = successors[index];
+                if (!isTrimmed.get(successor) && --inDegrees[successor] == 0) {
+                    trimQueue.push_back(successor);
+                    isTrimmed.set(successor);
+                }
+            }
+            for (uint64_t index = predecessorIndications[state]; index < predecessorIndications[state + 1]; ++index) {
+                uint64_t predecessor = predecessors[index];
+                if (!isTrimmed.get(predecessor) && --outDegrees[predecessor] == 0) {
+                    trimQueue.push_back(predecessor);
+                    isTrimmed.set(predecessor);
+                }
+            }
+        }
+    }
+
+    // Forward-backward search. Each task owns a partition of the remaining states. As partitions are disjoint and each partition has a unique label,
+    // tasks only write data of their own states. Labels of states in other partitions might be read concurrently, which is why they are atomic.
+    std::vector<std::atomic<uint64_t>> partitionLabels(numberOfStates);
+    std::vector<uint8_t> reachabilityFlags(numberOfStates, 0);
+    std::atomic<uint64_t> labelCount(0);
+    uint8_t const forwardFlag = 1;
+    uint8_t const backwardFlag = 2;
+    std::vector<uint64_t> initialPartition;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isConsidered(state) && sccIndices[state] == noScc) {
+            partitionLabels[state].store(0, std::memory_order_relaxed);
+            initialPartition.push_back(state);
+        } else {
+            partitionLabels[state].store(noScc, std::memory_order_relaxed);
+        }
+    }
+
+    tbb::task_group taskGroup;
+    std::function<void(std::vector<uint64_t> const&, uint64_t)> forwardBackward = [&](std::vector<uint64_t> const& partition, uint64_t label) {
+        // Mark all states that are forward or backward reachable from the pivot within the partition.
+        auto search = [&](uint64_t pivot, std::vector<uint64_t> const& indications, std::vector<uint64_t> const& neighbours, uint8_t flag) {
+            std::vector<uint64_t> stack = {pivot};
+            reachabilityFlags[pivot] |= flag;
+            while (!stack.empty()) {
+                uint64_t state = stack.back();
+                stack.pop_back();
+                for (uint64_t index = indications[state]; index < indications[state + 1]; ++index) {
+                    uint64_t neighbour = neighbours[index];
+                    if (partitionLabels[neighbour].load(std::memory_order_relaxed) == label && (reachabilityFlags[neighbour] & flag) == 0) {
+                        reachabilityFlags[neighbour] |= flag;
+                        stack.push_back(neighbour);
+                    }
+                }
+            }
+        };
+        // A pseudo-random pivot avoids the quadratic behaviour of always picking, e.g., the first state on long chains of SCCs.
+        uint64_t pivot = partition[((label + 1) * 11400714819323198485ull) % partition.size()];
+        search(pivot, successorIndications, successors, forwardFlag);
+        search(pivot, predecessorIndications, predecessors, backwardFlag);
+
+        // The states reachable in both directions form the SCC of the pivot. The remaining states are split into three independent partitions.
+        uint64_t sccIndex = sccCount++;
+        std::vector<std::vector<uint64_t>> subPartitions(3);
+        for (auto const& state : partition) {
+            uint8_t flags = reachabilityFlags[state];
+            reachabilityFlags[state] = 0;
+            if (flags == (forwardFlag | backwardFlag)) {
+                sccIndices[state] = sccIndex;
+                partitionLabels[state].store(noScc, std::memory_order_relaxed);
+            } else {
+                subPartitions[flags].push_back(state);
+            }
+        }
+        for (auto& subPartition : subPartitions) {
+            if (!subPartition.empty()) {
+                uint64_t subLabel = ++labelCount;
+                for (auto const& state : subPartition) {
+                    partitionLabels[state].store(subLabel, std::memory_order_relaxed);
+                }
+                taskGroup.run([&forwardBackward, subPartition = std::move(subPartition), subLabel]() { forwardBackward(subPartition, subLabel); });
+            }
+        }
+    };
+    if (!initialPartition.empty()) {
+        taskGroup.run([&]() { forwardBackward(initialPartition, 0); });
+    }
+    taskGroup.wait();
+
+    // Compute the SCC sizes to find the non-trivial states.
+    uint64_t const numberOfSccs = sccCount.load();
+    std::vector<uint64_t> sccSizes(numberOfSccs, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isConsidered(state)) {
+            ++sccSizes[sccIndices[state]];
+        }
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isConsidered(state) && (hasSelfloop[state] || sccSizes[sccIndices[state]] > 1)) {
+            nonTrivialStates.set(state, true);
+        }
+    }
+
+    // Number the SCCs in a topological order such that bottom SCCs come first. This also yields the SCC depths.
+    std::vector<uint64_t> sccOutDegrees(numberOfSccs, 0);
+    std::vector<uint64_t> sccPredecessorIndications(numberOfSccs + 1, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (uint64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+            if (sccIndices[successors[index]] != sccIndices[state]) {
+                ++sccOutDegrees[sccIndices[state]];
+                ++sccPredecessorIndications[sccIndices[successors[index]] + 1];
+            }
+        }
+    }
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        sccPredecessorIndications[sccIndex + 1] += sccPredecessorIndications[sccIndex];
+    }
+    std::vector<uint64_t> sccPredecessors(sccPredecessorIndications.back());
+    {
+        std::vector<uint64_t> positions(sccPredecessorIndications.begin(), sccPredecessorIndications.end() - 1);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (uint64_t index = successorIndications[state]; index < successorIndications[state + 1]; ++index) {
+                if (sccIndices[successors[index]] != sccIndices[state]) {
+                    sccPredecessors[positions[sccIndices[successors[index]]]++] = sccIndices[state];
+                }
+            }
+        }
+    }
+    std::vector<uint64_t> sortedSccIndices(numberOfSccs);
+    std::vector<uint64_t> depths(numberOfSccs, 0);
+    std::vector<uint64_t> queue;
+    queue.reserve(numberOfSccs);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (sccOutDegrees[sccIndex] == 0) {
+            queue.push_back(sccIndex);
+        }
+    }
+    for (uint64_t queueIndex = 0; queueIndex < queue.size(); ++queueIndex) {
+        uint64_t sccIndex = queue[queueIndex];
+        sortedSccIndices[sccIndex] = queueIndex;
+        for (uint64_t index = sccPredecessorIndications[sccIndex]; index < sccPredecessorIndications[sccIndex + 1]; ++index) {
+            uint64_t predecessor = sccPredecessors[index];
+            depths[predecessor] = std::max(depths[predecessor], depths[sccIndex] + 1);
+            if (--sccOutDegrees[predecessor] == 0) {
+                queue.push_back(predecessor);
+            }
+        }
+    }
+    STORM_LOG_ASSERT(queue.size() == numberOfSccs, "Unable to sort the SCCs topologically.");
+    if (sccDepths) {
+        sccDepths->resize(numberOfSccs);
+        for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+            (*sccDepths)[sortedSccIndices[sccIndex]] = depths[sccIndex];
+        }
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isConsidered(state)) {
+            stateToSccMapping[state] = sortedSccIndices[sccIndices[state]];
+        }
+    }
+    return numberOfSccs;
+}
+#endif
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
+    storm::utility::InstrumentationTimer instrumentationTimer("decomposition.scc");
     STORM_LOG_ASSERT(!options.choicesPtr || options.subsystemPtr, "Expecting subsystem if choices are given.");
 
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
@@ -179,7 +459,31 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
 
     // Obtain a mapping from states to the SCC it belongs to
     std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-    {
+    // Unless specified otherwise, we only use the parallel algorithm for large systems as it has a larger overhead.
+    uint_fast64_t const minimalNumberOfStatesForParallelDecomposition = 100000;
+    bool useParallelAlgorithm = options.isParallelSet ? options.isParallelSet.get()
+                                                      : numberOfStates >= minimalNumberOfStatesForParallelDecomposition &&
+                                                            storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!useParallelAlgorithm || !options.isParallelSet,
+                        "Storm was built without support for Intel TBB, defaulting to sequential SCC decomposition.");
+    useParallelAlgorithm = false;
+#endif
+
+    // Store scc depths if requested
+    std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
+    sccDepths = boost::none;
+    if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+        sccDepths = std::vector<uint_fast64_t>();
+        sccDepthsPtr = &sccDepths.get();
+    }
+
+    if (useParallelAlgorithm) {
+#ifdef STORM_HAVE_INTELTBB
+        sccCount = performParallelSccDecompositionFB(transitionMatrix, nonTrivialStates, options.subsystemPtr, options.choicesPtr, stateToSccMapping,
+                                                     sccDepthsPtr);
+#endif
+    } else {
         // Set up the environment of the algorithm.
         // Start with the two stacks it maintains.
         // This is to reduce memory (re-)allocations
@@ -195,14 +499,6 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
         storm::storage::BitVector hasPreorderNumber(numberOfStates);
         storm::storage::BitVector stateHasScc(numberOfStates);
 
-        // Store scc depths if requested
-        std::vector<uint_fast64_t>* sccDepthsPtr = nullptr;
-        sccDepths = boost::none;
-        if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
-            sccDepths = std::vector<uint_fast64_t>();
-            sccDepthsPtr = &sccDepths.get();
-        }
-
         // Start the search for SCCs from every state in the block.
         uint_fast64_t currentIndex = 0;
         if (options.subsystemPtr) {
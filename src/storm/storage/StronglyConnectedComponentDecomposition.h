@@ -49,6 +49,12 @@ struct StronglyConnectedComponentDecompositionOptions {
         isComputeSccDepthsSet = value;
         return *this;
     }
+    /// Sets if the parallel (forward-backward) algorithm is used.
+    /// If this is not set, the parallel algorithm is used for large systems iff Intel TBB is enabled.
+    StronglyConnectedComponentDecompositionOptions& parallel(bool value = true) {
+        isParallelSet = value;
+        return *this;
+    }
 
     storm::storage::BitVector const* subsystemPtr = nullptr;
     storm::storage::BitVector const* choicesPtr = nullptr;
@@ -56,6 +62,7 @@ struct StronglyConnectedComponentDecompositionOptions {
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    boost::optional<bool> isParallelSet;
 };
 
 /*!
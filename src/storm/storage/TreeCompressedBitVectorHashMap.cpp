@@ -0,0 +1,290 @@
+#include "storm/storage/TreeCompressedBitVectorHashMap.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/exceptions/InternalException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace detail {
+// The finalizer of Murmur3, which suffices to spread the (often small) child indices.
+inline uint64_t mixNodeContent(uint64_t content) {
+    content ^= content >> 33;
+    content *= 0xff51afd7ed558ccdull;
+    content ^= content >> 33;
+    content *= 0xc4ceb9fe1a85ec53ull;
+    content ^= content >> 33;
+    return content;
+}
+}  // namespace detail
+
+template<typename ValueType>
+TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMapIterator::TreeCompressedBitVectorHashMapIterator(
+    TreeCompressedBitVectorHashMap const& map, uint64_t index)
+    : map(&map), index(index) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMapIterator::operator==(
+    TreeCompressedBitVectorHashMapIterator const& other) const {
+    return map == other.map && index == other.index;
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMapIterator::operator!=(
+    TreeCompressedBitVectorHashMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<typename ValueType>
+typename TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMapIterator&
+TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMapIterator::operator++() {
+    ++index;
+    return *this;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, ValueType> TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMapIterator::operator*() const {
+    return std::make_pair(map->getKey(index), map->values[index]);
+}
+
+template<typename ValueType>
+TreeCompressedBitVectorHashMap<ValueType>::NodeTable::NodeTable(uint64_t initialSize) {
+    uint64_t numberOfSlots = 16;
+    while (numberOfSlots < 2 * initialSize) {
+        numberOfSlots <<= 1;
+    }
+    slots.resize(numberOfSlots, 0);
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::NodeTable::findSlot(uint64_t content) const {
+    uint64_t mask = slots.size() - 1;
+    uint64_t slot = detail::mixNodeContent(content) & mask;
+    while (slots[slot] != 0 && contents[slots[slot] - 1] != content) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template<typename ValueType>
+std::pair<uint32_t, bool> TreeCompressedBitVectorHashMap<ValueType>::NodeTable::findOrAdd(uint64_t content) {
+    uint64_t slot = findSlot(content);
+    if (slots[slot] != 0) {
+        return std::make_pair(slots[slot] - 1, false);
+    }
+    STORM_LOG_THROW(contents.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::InternalException, "Too many nodes in tree table.");
+    contents.push_back(content);
+    slots[slot] = static_cast<uint32_t>(contents.size());
+    if (4 * contents.size() > 3 * slots.size()) {
+        increaseSize();
+    }
+    return std::make_pair(static_cast<uint32_t>(contents.size() - 1), true);
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::NodeTable::find(uint64_t content, uint32_t& index) const {
+    uint64_t slot = findSlot(content);
+    if (slots[slot] == 0) {
+        return false;
+    }
+    index = slots[slot] - 1;
+    return true;
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::NodeTable::get(uint32_t index) const {
+    return contents[index];
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::NodeTable::size() const {
+    return contents.size();
+}
+
+template<typename ValueType>
+void TreeCompressedBitVectorHashMap<ValueType>::NodeTable::increaseSize() {
+    slots = std::vector<uint32_t>(2 * slots.size(), 0);
+    uint64_t mask = slots.size() - 1;
+    for (uint64_t index = 0; index < contents.size(); ++index) {
+        uint64_t slot = detail::mixNodeContent(contents[index]) & mask;
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = static_cast<uint32_t>(index + 1);
+    }
+}
+
+template<typename ValueType>
+TreeCompressedBitVectorHashMap<ValueType>::TreeCompressedBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize) : bucketSize(bucketSize) {
+    uint64_t numberOfChunks = std::max<uint64_t>(1, (bucketSize + 31) / 32);
+    buildTree(0, numberOfChunks);
+
+    // Only the root table has one entry per key, the tables further down are typically much smaller.
+    for (uint64_t node = 0; node + 1 < tree.size(); ++node) {
+        tables.emplace_back(16);
+    }
+    tables.emplace_back(initialSize);
+    values.reserve(initialSize);
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::buildTree(uint64_t firstChunk, uint64_t lastChunk) {
+    TreeNode node;
+    uint64_t numberOfChunks = lastChunk - firstChunk;
+    if (numberOfChunks <= 2) {
+        // If there is only a single chunk, the right child is the (always zero) chunk behind the key.
+        node.left = firstChunk;
+        node.leftIsChunk = true;
+        node.right = firstChunk + 1;
+        node.rightIsChunk = true;
+    } else {
+        uint64_t middleChunk = firstChunk + numberOfChunks / 2;
+        node.leftIsChunk = middleChunk - firstChunk == 1;
+        node.left = node.leftIsChunk ? firstChunk : buildTree(firstChunk, middleChunk);
+        node.rightIsChunk = lastChunk - middleChunk == 1;
+        node.right = node.rightIsChunk ? middleChunk : buildTree(middleChunk, lastChunk);
+    }
+    tree.push_back(node);
+    return tree.size() - 1;
+}
+
+template<typename ValueType>
+uint32_t TreeCompressedBitVectorHashMap<ValueType>::getChunk(storm::storage::BitVector const& key, uint64_t chunk) const {
+    uint64_t firstBit = chunk * 32;
+    if (firstBit >= bucketSize) {
+        return 0;
+    }
+    return static_cast<uint32_t>(key.getAsInt(firstBit, std::min<uint64_t>(32, bucketSize - firstBit)));
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::findIndex(storm::storage::BitVector const& key, uint32_t& index) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Key has unexpected size.");
+    // As the nodes are in post-order, the children of a node are processed before the node itself. The indices of the nodes whose parents have
+    // not been processed yet are kept on a stack, whose depth is bounded by the height of the (balanced) tree.
+    uint32_t stack[64];
+    uint64_t stackSize = 0;
+    for (uint64_t position = 0; position < tree.size(); ++position) {
+        TreeNode const& node = tree[position];
+        uint32_t right = node.rightIsChunk ? getChunk(key, node.right) : stack[--stackSize];
+        uint32_t left = node.leftIsChunk ? getChunk(key, node.left) : stack[--stackSize];
+        if (!tables[position].find((static_cast<uint64_t>(left) << 32) | right, stack[stackSize])) {
+            return false;
+        }
+        ++stackSize;
+    }
+    index = stack[0];
+    return true;
+}
+
+template<typename ValueType>
+std::pair<ValueType, uint64_t> TreeCompressedBitVectorHashMap<ValueType>::findOrAddAndGetBucket(storm::storage::BitVector const& key,
+                                                                                                 ValueType const& value) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Key has unexpected size.");
+    uint32_t stack[64];
+    uint64_t stackSize = 0;
+    bool inserted = false;
+    for (uint64_t position = 0; position < tree.size(); ++position) {
+        TreeNode const& node = tree[position];
+        uint32_t right = node.rightIsChunk ? getChunk(key, node.right) : stack[--stackSize];
+        uint32_t left = node.leftIsChunk ? getChunk(key, node.left) : stack[--stackSize];
+        auto indexInsertedPair = tables[position].findOrAdd((static_cast<uint64_t>(left) << 32) | right);
+        stack[stackSize++] = indexInsertedPair.first;
+        inserted = indexInsertedPair.second;
+    }
+
+    // Whether the key is new is determined by the root.
+    uint32_t index = stack[0];
+    if (inserted) {
+        STORM_LOG_ASSERT(index == values.size(), "Unexpected index of new key.");
+        values.push_back(value);
+    }
+    return std::make_pair(values[index], index);
+}
+
+template<typename ValueType>
+ValueType TreeCompressedBitVectorHashMap<ValueType>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddAndGetBucket(key, value).first;
+}
+
+template<typename ValueType>
+ValueType TreeCompressedBitVectorHashMap<ValueType>::getValue(storm::storage::BitVector const& key) const {
+    uint32_t index;
+    bool found = findIndex(key, index);
+    STORM_LOG_ASSERT(found, "Unknown key.");
+    return values[index];
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorHashMap<ValueType>::contains(storm::storage::BitVector const& key) const {
+    uint32_t index;
+    return findIndex(key, index);
+}
+
+template<typename ValueType>
+void TreeCompressedBitVectorHashMap<ValueType>::writeSubtree(uint64_t node, uint32_t index, storm::storage::BitVector& key) const {
+    uint64_t content = tables[node].get(index);
+    uint32_t left = static_cast<uint32_t>(content >> 32);
+    uint32_t right = static_cast<uint32_t>(content);
+    for (bool isLeft : {true, false}) {
+        bool isChunk = isLeft ? tree[node].leftIsChunk : tree[node].rightIsChunk;
+        uint64_t child = isLeft ? tree[node].left : tree[node].right;
+        uint32_t childValue = isLeft ? left : right;
+        if (isChunk) {
+            uint64_t firstBit = child * 32;
+            if (firstBit < bucketSize) {
+                key.setFromInt(firstBit, std::min<uint64_t>(32, bucketSize - firstBit), childValue);
+            }
+        } else {
+            writeSubtree(child, childValue, key);
+        }
+    }
+}
+
+template<typename ValueType>
+storm::storage::BitVector TreeCompressedBitVectorHashMap<ValueType>::getKey(uint64_t index) const {
+    storm::storage::BitVector result(bucketSize);
+    writeSubtree(tree.size() - 1, static_cast<uint32_t>(index), result);
+    return result;
+}
+
+template<typename ValueType>
+typename TreeCompressedBitVectorHashMap<ValueType>::const_iterator TreeCompressedBitVectorHashMap<ValueType>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<typename ValueType>
+typename TreeCompressedBitVectorHashMap<ValueType>::const_iterator TreeCompressedBitVectorHashMap<ValueType>::end() const {
+    return const_iterator(*this, values.size());
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::size() const {
+    return values.size();
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorHashMap<ValueType>::getNumberOfStoredNodes() const {
+    uint64_t result = 0;
+    for (auto const& table : tables) {
+        result += table.size();
+    }
+    return result;
+}
+
+template<typename ValueType>
+void TreeCompressedBitVectorHashMap<ValueType>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    for (auto& value : values) {
+        value = remapping(value);
+    }
+}
+
+template class TreeCompressedBitVectorHashMap<uint64_t>;
+template class TreeCompressedBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
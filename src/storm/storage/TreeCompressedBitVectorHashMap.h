@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A hash-map whose keys are bit vectors of a fixed length that stores its keys tree-compressed (as in LTSmin). Each key is split into 32-bit chunks,
+ * which form the leaves of a balanced binary tree. Every inner node of the tree has its own table that interns the pairs of indices of its
+ * children. Hence, a key is represented by a single index in the table of the root and subvectors that are shared among keys (which is typical for
+ * the states of models with many variables) are stored only once. Like BitVectorHashMap, only queries and insertions are supported.
+ */
+template<typename ValueType>
+class TreeCompressedBitVectorHashMap {
+   public:
+    class TreeCompressedBitVectorHashMapIterator {
+       public:
+        /*!
+         * Creates an iterator that points to the key with the given index in the given map.
+         */
+        TreeCompressedBitVectorHashMapIterator(TreeCompressedBitVectorHashMap const& map, uint64_t index);
+
+        // Methods to compare two iterators.
+        bool operator==(TreeCompressedBitVectorHashMapIterator const& other) const;
+        bool operator!=(TreeCompressedBitVectorHashMapIterator const& other) const;
+
+        // Methods to move iterator forward.
+        TreeCompressedBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // The map this iterator refers to.
+        TreeCompressedBitVectorHashMap const* map;
+
+        // The index of the key this iterator points to.
+        uint64_t index;
+    };
+
+    typedef TreeCompressedBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map for keys of the given size.
+     *
+     * @param bucketSize The number of bits of the keys.
+     * @param initialSize The number of keys for which space is initially reserved.
+     */
+    TreeCompressedBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component is the index of the key in the map. Keys are indexed in the order of insertion.
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Reconstructs the key with the given index.
+     *
+     * @param index The index of the key (see findOrAddAndGetBucket).
+     * @return The key.
+     */
+    storm::storage::BitVector getKey(uint64_t index) const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Retrieves an iterator that points one past the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the total number of tree nodes that are stored in the map. Without compression, this would be the
+     * number of keys times the number of inner nodes of the tree.
+     */
+    uint64_t getNumberOfStoredNodes() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping.
+     *
+     * @param remapping The remapping to apply.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+   private:
+    /*!
+     * A table that interns 64-bit node contents (the indices of the two children) and assigns consecutive indices to them.
+     */
+    class NodeTable {
+       public:
+        NodeTable(uint64_t initialSize);
+
+        /*!
+         * Retrieves the index of the given content, inserting it if necessary. The second component indicates whether it was inserted.
+         */
+        std::pair<uint32_t, bool> findOrAdd(uint64_t content);
+
+        /*!
+         * Retrieves the index of the given content. Returns false if the content is not contained.
+         */
+        bool find(uint64_t content, uint32_t& index) const;
+
+        /*!
+         * Retrieves the content with the given index.
+         */
+        uint64_t get(uint32_t index) const;
+
+        uint64_t size() const;
+
+       private:
+        uint64_t findSlot(uint64_t content) const;
+        void increaseSize();
+
+        // The contents in the order of insertion, i.e., the content with index i is at position i.
+        std::vector<uint64_t> contents;
+
+        // The open addressing table. Each slot stores the index of a content plus one (zero marks empty slots).
+        std::vector<uint32_t> slots;
+    };
+
+    /*!
+     * An inner node of the tree. Children are either inner nodes (referred to by their position) or chunks of the key.
+     */
+    struct TreeNode {
+        uint64_t left;
+        uint64_t right;
+        bool leftIsChunk;
+        bool rightIsChunk;
+    };
+
+    /*!
+     * Builds the (inner nodes of the) tree over the given chunks and returns the position of the created node.
+     */
+    uint64_t buildTree(uint64_t firstChunk, uint64_t lastChunk);
+
+    /*!
+     * Retrieves the given chunk of the given key.
+     */
+    uint32_t getChunk(storm::storage::BitVector const& key, uint64_t chunk) const;
+
+    /*!
+     * Writes the subtree rooted at the given node with the given index into the given key.
+     */
+    void writeSubtree(uint64_t node, uint32_t index, storm::storage::BitVector& key) const;
+
+    /*!
+     * Searches the index of the key in the root table. Returns false, if the key is not contained.
+     */
+    bool findIndex(storm::storage::BitVector const& key, uint32_t& index) const;
+
+    // The number of bits of the keys.
+    uint64_t bucketSize;
+
+    // The inner nodes of the tree in post-order, i.e., the last node is the root.
+    std::vector<TreeNode> tree;
+
+    // For each inner node, the table holding its contents.
+    std::vector<NodeTable> tables;
+
+    // The value of key i is stored at position i.
+    std::vector<ValueType> values;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,7 +1,10 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
+#include <algorithm>
 #include <chrono>
+#include <type_traits>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -21,8 +24,10 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/storage/DistributionWithReward.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
@@ -60,6 +65,7 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      refinementMethod(BisimulationRefinementMethod::Splitter),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -206,6 +212,7 @@ BisimulationDecomposition<ModelType, BlockDataType>::BisimulationDecomposition(M
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDecomposition() {
+    storm::utility::InstrumentationTimer instrumentationTimer("bisimulation");
     std::chrono::high_resolution_clock::time_point totalStart = std::chrono::high_resolution_clock::now();
 
     std::chrono::high_resolution_clock::time_point initialPartitionStart = std::chrono::high_resolution_clock::now();
@@ -223,7 +230,13 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     this->initialize();
 
     std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-    this->performPartitionRefinement();
+    if (options.refinementMethod == BisimulationRefinementMethod::Signature && options.getType() == BisimulationType::Strong) {
+        this->performSignatureRefinement();
+    } else {
+        STORM_LOG_WARN_COND(options.refinementMethod == BisimulationRefinementMethod::Splitter,
+                            "Signature refinement is only available for strong bisimulation, falling back to splitter-based refinement.");
+        this->performPartitionRefinement();
+    }
     std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
 
     std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -264,9 +277,11 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     });
 
     // Then perform the actual splitting until there are no more splitters.
+    static storm::utility::Instrumentation::Counter& roundsCounter = storm::utility::Instrumentation::instance().getCounter("bisimulation.rounds");
     uint_fast64_t iterations = 0;
     while (!splitterQueue.empty()) {
         ++iterations;
+        storm::utility::incrementCounter(roundsCounter);
 
         // Get and prepare the next splitter.
         // Sort the splitters according to their sizes to prefer small splitters. That is just a heuristic, but
@@ -288,6 +303,98 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+    // Retrieve the row grouping once, because it may be created lazily and is accessed concurrently below.
+    std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    std::vector<ValueType> const* stateActionRewards = nullptr;
+    if (options.getKeepRewards() && model.hasRewardModel() && model.getUniqueRewardModel().hasStateActionRewards()) {
+        stateActionRewards = &model.getUniqueRewardModel().getStateActionRewardVector();
+    }
+
+    // The signature of a state is the ordered set of distributions over the current blocks induced by its choices.
+    std::vector<std::vector<storm::storage::DistributionWithReward<ValueType>>> signatures(model.getNumberOfStates());
+    auto distributionLess = [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                                   storm::storage::DistributionWithReward<ValueType> const& distribution2) {
+        return distribution1.less(distribution2, comparator);
+    };
+    auto distributionEquals = [this](storm::storage::DistributionWithReward<ValueType> const& distribution1,
+                                     storm::storage::DistributionWithReward<ValueType> const& distribution2) {
+        return distribution1.equals(distribution2, comparator);
+    };
+    auto computeSignature = [&](storm::storage::sparse::state_type state) {
+        std::vector<storm::storage::DistributionWithReward<ValueType>>& signature = signatures[state];
+        signature.clear();
+
+        // States of absorbing blocks are never split, so they all get the empty signature.
+        if (partition.getBlock(state).data().absorbing()) {
+            return;
+        }
+
+        for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+            storm::storage::DistributionWithReward<ValueType> distribution;
+            if (stateActionRewards) {
+                distribution.setReward((*stateActionRewards)[choice]);
+            }
+            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                if (!comparator.isZero(entry.getValue())) {
+                    distribution.addProbability(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                }
+            }
+            signature.push_back(std::move(distribution));
+        }
+        std::sort(signature.begin(), signature.end(), distributionLess);
+        signature.erase(std::unique(signature.begin(), signature.end(), distributionEquals), signature.end());
+    };
+
+    uint_fast64_t iterations = 0;
+    bool changed = true;
+    static storm::utility::Instrumentation::Counter& roundsCounter = storm::utility::Instrumentation::instance().getCounter("bisimulation.rounds");
+    while (changed) {
+        ++iterations;
+        storm::utility::incrementCounter(roundsCounter);
+
+#ifdef STORM_HAVE_INTELTBB
+        // Rational functions are not safe to be manipulated concurrently, so their signatures are computed sequentially.
+        if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, model.getNumberOfStates()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                for (uint_fast64_t state = range.begin(); state < range.end(); ++state) {
+                    computeSignature(state);
+                }
+            });
+        } else {
+            for (storm::storage::sparse::state_type state = 0; state < model.getNumberOfStates(); ++state) {
+                computeSignature(state);
+            }
+        }
+#else
+        for (storm::storage::sparse::state_type state = 0; state < model.getNumberOfStates(); ++state) {
+            computeSignature(state);
+        }
+#endif
+
+        // Rehash the blocks by splitting them according to the signatures of their states.
+        changed = partition.split([&](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+            return std::lexicographical_compare(signatures[state1].begin(), signatures[state1].end(), signatures[state2].begin(), signatures[state2].end(),
+                                                distributionLess);
+        });
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " iterations of signature refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_DEBUG("Signature refinement converged after " << iterations << " rounds with " << partition.size() << " blocks.");
+
+    this->updateAfterSignatureRefinement();
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::updateAfterSignatureRefinement() {
+    // Intentionally left empty.
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
@@ -126,6 +126,9 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// The method that is used to refine the initial partition.
+        BisimulationRefinementMethod refinementMethod;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +211,18 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Refines the partition by signatures until it is stable. In every round, the signature of each state (the
+     * set of distributions over the current blocks induced by its choices) is computed in parallel and all blocks
+     * are split according to the signatures of their states. This is only applicable to strong bisimulation.
+     */
+    void performSignatureRefinement();
+
+    /*!
+     * A function that can update auxiliary data structures after the partition was refined by signature refinement.
+     */
+    virtual void updateAfterSignatureRefinement();
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -5,6 +5,7 @@ namespace storage {
 
 enum class BisimulationType { Strong, Weak };
 enum class BisimulationTypeChoice { Strong, Weak, FromSettings };
+enum class BisimulationRefinementMethod { Splitter, Signature };
 
 }  // namespace storage
 }  // namespace storm
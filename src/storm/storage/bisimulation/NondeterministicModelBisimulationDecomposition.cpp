@@ -47,6 +47,13 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::initialize() {
     this->initializeQuotientDistributions();
 }
 
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::updateAfterSignatureRefinement() {
+    // The quotient distributions are not maintained during signature refinement, so we recompute them wrt. the final partition.
+    quotientDistributions = std::vector<storm::storage::DistributionWithReward<ValueType>>(this->model.getNumberOfChoices());
+    this->initializeQuotientDistributions();
+}
+
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToStateMapping() {
     std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -1145,6 +1145,35 @@ void Add<LibraryType, ValueType>::exportToText(std::string const& filename) cons
     internalAdd.exportToText(filename);
 }
 
+template<DdType LibraryType, typename ValueType>
+std::vector<AddNode<ValueType>> Add<LibraryType, ValueType>::getNodes() const {
+    return internalAdd.getNodes();
+}
+
+template<DdType LibraryType, typename ValueType>
+Add<LibraryType, ValueType> Add<LibraryType, ValueType>::fromNodes(DdManager<LibraryType> const& ddManager, std::vector<AddNode<ValueType>> const& nodes,
+                                                                   std::unordered_map<uint64_t, Bdd<LibraryType>> const& ddVariables,
+                                                                   std::set<storm::expressions::Variable> const& metaVariables) {
+    STORM_LOG_THROW(!nodes.empty(), storm::exceptions::InvalidArgumentException, "Can not build an ADD without nodes.");
+    std::vector<Add<LibraryType, ValueType>> adds;
+    adds.reserve(nodes.size());
+    for (auto const& node : nodes) {
+        if (node.isTerminal()) {
+            adds.push_back(ddManager.getConstant(node.value));
+        } else {
+            STORM_LOG_THROW(node.thenNode < adds.size() && node.elseNode < adds.size(), storm::exceptions::InvalidArgumentException,
+                            "Illegal successor of ADD node.");
+            auto ddVariable = ddVariables.find(node.ddVariableIndex);
+            STORM_LOG_THROW(ddVariable != ddVariables.end(), storm::exceptions::InvalidArgumentException,
+                            "Unknown DD variable index " << node.ddVariableIndex << " in ADD node.");
+            adds.push_back(ddVariable->second.ite(adds[node.thenNode], adds[node.elseNode]));
+        }
+    }
+    Add<LibraryType, ValueType> result = adds.back();
+    result.addMetaVariables(metaVariables);
+    return result;
+}
+
 template<DdType LibraryType, typename ValueType>
 AddIterator<LibraryType, ValueType> Add<LibraryType, ValueType>::begin(bool enumerateDontCareMetaVariables) const {
     uint_fast64_t numberOfDdVariables = 0;
@@ -4,6 +4,7 @@
 #include <functional>
 #include <map>
 
+#include "storm/storage/dd/AddNode.h"
 #include "storm/storage/dd/Dd.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/Odd.h"
@@ -743,6 +744,27 @@ class Add : public Dd<LibraryType> {
 
     virtual void exportToText(std::string const& filename) const override;
 
+    /*!
+     * Retrieves the nodes of the ADD such that the children of each node precede the node. The last node is the root. Together with the
+     * meta variables that the DD variables belong to, the ADD can be rebuilt from its nodes (see fromNodes).
+     *
+     * @return The nodes of the ADD.
+     */
+    std::vector<AddNode<ValueType>> getNodes() const;
+
+    /*!
+     * Builds the ADD with the given nodes.
+     *
+     * @param ddManager The manager responsible for the ADD.
+     * @param nodes The nodes of the ADD as retrieved by getNodes.
+     * @param ddVariables The DD variables (of the given manager) that correspond to the DD variable indices used in the nodes.
+     * @param metaVariables The meta variables contained in the ADD.
+     * @return The resulting ADD.
+     */
+    static Add<LibraryType, ValueType> fromNodes(DdManager<LibraryType> const& ddManager, std::vector<AddNode<ValueType>> const& nodes,
+                                                 std::unordered_map<uint64_t, Bdd<LibraryType>> const& ddVariables,
+                                                 std::set<storm::expressions::Variable> const& metaVariables);
+
     /*!
      * Retrieves an iterator that points to the first meta variable assignment with a non-zero function value.
      *
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace storm {
+namespace dd {
+
+/*!
+ * A node of an ADD as retrieved by Add::getNodes. The nodes of an ADD are stored in a list in which the children of each node precede the node, so
+ * the children are referred to by their position in the list.
+ */
+template<typename ValueType>
+struct AddNode {
+    // The index that marks terminal nodes in place of a DD variable index.
+    static constexpr uint64_t TerminalIndex = std::numeric_limits<uint64_t>::max();
+
+    bool isTerminal() const {
+        return ddVariableIndex == TerminalIndex;
+    }
+
+    // The index of the DD variable of an inner node or TerminalIndex.
+    uint64_t ddVariableIndex;
+
+    // The positions of the children of an inner node (where the DD variable is true and false, respectively).
+    uint64_t thenNode;
+    uint64_t elseNode;
+
+    // The value of a terminal node.
+    ValueType value;
+};
+
+}  // namespace dd
+}  // namespace storm
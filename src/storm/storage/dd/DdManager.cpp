@@ -459,6 +459,21 @@ bool DdManager<LibraryType>::isDynamicReorderingAllowed() const {
 template<DdType LibraryType>
 void DdManager<LibraryType>::triggerReordering() {
     internalDdManager.triggerReordering();
+    updateLowestIndices();
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::reorderIfNecessary() {
+    if (internalDdManager.reorderIfNecessary()) {
+        updateLowestIndices();
+    }
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::updateLowestIndices() {
+    for (auto& variable : metaVariableMap) {
+        variable.second.precomputeLowestIndex();
+    }
 }
 
 template<DdType LibraryType>
@@ -282,6 +282,12 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
      */
     void triggerReordering();
 
+    /*!
+     * Triggers a reordering of the DDs managed by this manager if dynamic reordering is allowed, the library does not reorder on its own and the
+     * DDs grew sufficiently since the last reordering. This must only be called while no DD operation is in progress.
+     */
+    void reorderIfNecessary();
+
     /*!
      * Retrieves the meta variable with the given name if it exists.
      *
@@ -345,6 +351,11 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
     void execute(std::function<void()> const& f) const;
 
    private:
+    /*!
+     * Recomputes the lowest DD variable index of all meta variables, which may have changed by reordering.
+     */
+    void updateLowestIndices();
+
     /*!
      * Creates a meta variable with the given number of DD variables and layers.
      *
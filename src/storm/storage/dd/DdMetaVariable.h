@@ -110,6 +110,13 @@ class DdMetaVariable {
      */
     std::vector<std::pair<uint64_t, uint64_t>> getIndicesAndLevels() const;
 
+    /*!
+     * Retrieves the variables used to encode the meta variable (most significant bit first).
+     *
+     * @return A vector of variables used to encode the meta variable.
+     */
+    std::vector<Bdd<LibraryType>> const& getDdVariables() const;
+
    private:
     /*!
      * Creates an integer meta variable with the given name and range bounds.
@@ -136,13 +143,6 @@ class DdMetaVariable {
      */
     void precomputeLowestIndex();
 
-    /*!
-     * Retrieves the variables used to encode the meta variable.
-     *
-     * @return A vector of variables used to encode the meta variable.
-     */
-    std::vector<Bdd<LibraryType>> const& getDdVariables() const;
-
     /*!
      * Creates the cube for this meta variable from the DD variables.
      */
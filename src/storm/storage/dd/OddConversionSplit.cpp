@@ -0,0 +1,36 @@
+#include "storm/storage/dd/OddConversionSplit.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+namespace storm {
+namespace dd {
+
+// Below this number of rows, the conversion is fast enough that the overhead of parallelization does not pay off.
+static const uint64_t MinimalNumberOfRowsForParallelConversion = 1ull << 14;
+
+uint64_t getOddConversionSplitLevel(uint64_t numberOfRows, uint64_t numberOfRowVariables) {
+    // The recursion must not reach the last row variable before the split level.
+    if (numberOfRows < MinimalNumberOfRowsForParallelConversion || numberOfRowVariables < 2) {
+        return 0;
+    }
+#ifdef STORM_HAVE_INTELTBB
+    if (!storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        return 0;
+    }
+    // Use a few buckets per thread such that imbalanced parts of the DD are compensated by the scheduler.
+    uint64_t splitLevel = 3;
+    for (uint64_t threads = std::max(1u, std::thread::hardware_concurrency()); threads > 1; threads >>= 1) {
+        ++splitLevel;
+    }
+    return std::min(splitLevel, numberOfRowVariables - 1);
+#else
+    return 0;
+#endif
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * Collects the independent parts of a recursive, ODD-guided conversion of a DD into an explicit vector or matrix. Instead of descending below
+ * the split level, the recursion records its current arguments (a frame) in the bucket that is determined by the row bits chosen so far. As the
+ * frames of different buckets refer to disjoint ranges of rows, the buckets can be processed concurrently afterwards. Within a bucket, the
+ * frames are kept in the order in which the sequential recursion would visit them, so the entries of each row are still produced in order.
+ */
+template<typename Frame>
+class OddConversionSplit {
+   public:
+    /*!
+     * Creates a split at the given row level.
+     *
+     * @param splitLevel The row level at which the recursion stops descending. There will be 2^splitLevel buckets.
+     */
+    OddConversionSplit(uint64_t splitLevel) : splitLevel(splitLevel), buckets(1ull << splitLevel) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Retrieves the row level at which the recursion stops descending.
+     */
+    uint64_t getSplitLevel() const {
+        return splitLevel;
+    }
+
+    /*!
+     * Retrieves the bucket of the successor of the given bucket when the next row bit is set to the given value.
+     */
+    static uint64_t getSuccessorBucket(uint64_t bucket, bool rowBit) {
+        return (bucket << 1) | (rowBit ? 1 : 0);
+    }
+
+    /*!
+     * Records the given frame in the given bucket.
+     */
+    void add(uint64_t bucket, Frame const& frame) {
+        buckets[bucket].push_back(frame);
+    }
+
+    /*!
+     * Invokes the given function on all recorded frames. Different buckets are processed concurrently (if TBB is available).
+     */
+    template<typename FrameFunction>
+    void process(FrameFunction const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, buckets.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t bucket = range.begin(); bucket < range.end(); ++bucket) {
+                for (auto const& frame : buckets[bucket]) {
+                    function(frame);
+                }
+            }
+        });
+#else
+        for (auto const& bucket : buckets) {
+            for (auto const& frame : bucket) {
+                function(frame);
+            }
+        }
+#endif
+    }
+
+   private:
+    uint64_t splitLevel;
+    std::vector<std::vector<Frame>> buckets;
+};
+
+/*!
+ * Determines the row level at which an ODD-guided conversion should be split into parallel parts.
+ *
+ * @param numberOfRows The number of rows (or entries of the vector) that is produced.
+ * @param numberOfRowVariables The number of DD variables encoding the rows.
+ * @return The split level or zero if the conversion should not be parallelized.
+ */
+uint64_t getOddConversionSplitLevel(uint64_t numberOfRows, uint64_t numberOfRowVariables);
+
+}  // namespace dd
+}  // namespace storm
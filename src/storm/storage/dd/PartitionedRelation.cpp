@@ -0,0 +1,197 @@
+#include "storm/storage/dd/PartitionedRelation.h"
+
+#include <algorithm>
+#include <deque>
+#include <map>
+
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace dd {
+
+template<DdType LibraryType>
+PartitionedRelation<LibraryType>::PartitionedRelation(
+    std::vector<Bdd<LibraryType>> const& parts, Kind const& kind, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs)
+    : parts(parts),
+      kind(kind),
+      rowMetaVariables(rowMetaVariables),
+      columnMetaVariables(columnMetaVariables),
+      rowColumnMetaVariablePairs(rowColumnMetaVariablePairs),
+      extended(false) {
+    STORM_LOG_THROW(!this->parts.empty(), storm::exceptions::InvalidArgumentException, "A partitioned relation needs at least one part.");
+
+    for (auto const& part : this->parts) {
+        for (auto const& metaVariable : part.getContainedMetaVariables()) {
+            if (rowMetaVariables.find(metaVariable) == rowMetaVariables.end() && columnMetaVariables.find(metaVariable) == columnMetaVariables.end()) {
+                extended = true;
+            }
+        }
+    }
+
+    if (kind == Kind::Conjunctive) {
+        preimageSchedule = computeQuantificationSchedule(columnMetaVariables);
+        imageSchedule = computeQuantificationSchedule(rowMetaVariables);
+    }
+}
+
+template<DdType LibraryType>
+PartitionedRelation<LibraryType> PartitionedRelation<LibraryType>::splitDisjunctively(
+    Bdd<LibraryType> const& relation, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, uint64_t maximalNodeCount,
+    uint64_t maximalNumberOfParts) {
+    if (maximalNodeCount == 0 || relation.getNodeCount() <= maximalNodeCount) {
+        return PartitionedRelation<LibraryType>({relation}, Kind::Disjunctive, rowMetaVariables, columnMetaVariables, rowColumnMetaVariablePairs);
+    }
+
+    // Map the indices of the DD variables to the DD variables themselves, so we can cofactor with respect to the top-most variable of a part.
+    DdManager<LibraryType> const& manager = relation.getDdManager();
+    std::map<uint64_t, Bdd<LibraryType>> indexToDdVariable;
+    for (auto const& metaVariable : relation.getContainedMetaVariables()) {
+        for (auto const& ddVariable : manager.getMetaVariable(metaVariable).getDdVariables()) {
+            indexToDdVariable.emplace(ddVariable.getIndex(), ddVariable);
+        }
+    }
+
+    // Every part is kept as the conjunction of a cube (the variable assignments along which it was split off) and the corresponding cofactor.
+    std::vector<Bdd<LibraryType>> parts;
+    std::deque<std::pair<Bdd<LibraryType>, Bdd<LibraryType>>> worklist;
+    worklist.emplace_back(manager.getBddOne(), relation);
+    while (!worklist.empty()) {
+        auto cubeAndCofactor = std::move(worklist.front());
+        worklist.pop_front();
+
+        Bdd<LibraryType> const& cofactor = cubeAndCofactor.second;
+        auto ddVariableIt = indexToDdVariable.end();
+        if (cofactor.getNodeCount() > maximalNodeCount && parts.size() + worklist.size() + 2 <= maximalNumberOfParts) {
+            ddVariableIt = indexToDdVariable.find(cofactor.getIndex());
+        }
+
+        if (ddVariableIt == indexToDdVariable.end()) {
+            parts.push_back(cubeAndCofactor.first && cofactor);
+        } else {
+            Bdd<LibraryType> const& ddVariable = ddVariableIt->second;
+            for (auto const& literal : {ddVariable, !ddVariable}) {
+                Bdd<LibraryType> literalCofactor = cofactor.constrain(literal);
+                if (!literalCofactor.isZero()) {
+                    worklist.emplace_back(cubeAndCofactor.first && literal, literalCofactor);
+                }
+            }
+        }
+    }
+    STORM_LOG_TRACE("Split relation with " << relation.getNodeCount() << " nodes into " << parts.size() << " parts.");
+
+    return PartitionedRelation<LibraryType>(parts, Kind::Disjunctive, rowMetaVariables, columnMetaVariables, rowColumnMetaVariablePairs);
+}
+
+template<DdType LibraryType>
+std::pair<std::set<storm::expressions::Variable>, std::vector<std::set<storm::expressions::Variable>>>
+PartitionedRelation<LibraryType>::computeQuantificationSchedule(std::set<storm::expressions::Variable> const& variables) const {
+    std::pair<std::set<storm::expressions::Variable>, std::vector<std::set<storm::expressions::Variable>>> result;
+    result.second.resize(parts.size());
+
+    // Every variable is quantified right after the last part that contains it. Variables that appear in none of the parts can immediately be
+    // quantified from the states.
+    for (auto const& variable : variables) {
+        auto lastPartIt = std::find_if(parts.rbegin(), parts.rend(), [&variable](Bdd<LibraryType> const& part) { return part.containsMetaVariable(variable); });
+        if (lastPartIt == parts.rend()) {
+            result.first.insert(variable);
+        } else {
+            result.second[std::distance(lastPartIt, parts.rend()) - 1].insert(variable);
+        }
+    }
+    return result;
+}
+
+namespace {
+template<DdType LibraryType>
+Bdd<LibraryType> existsAbstractContained(Bdd<LibraryType> const& bdd, std::set<storm::expressions::Variable> const& metaVariables) {
+    std::set<storm::expressions::Variable> containedMetaVariables;
+    std::set_intersection(metaVariables.begin(), metaVariables.end(), bdd.getContainedMetaVariables().begin(), bdd.getContainedMetaVariables().end(),
+                          std::inserter(containedMetaVariables, containedMetaVariables.begin()));
+    return containedMetaVariables.empty() ? bdd : bdd.existsAbstract(containedMetaVariables);
+}
+}  // namespace
+
+template<DdType LibraryType>
+Bdd<LibraryType> PartitionedRelation<LibraryType>::preimage(Bdd<LibraryType> const& states) const {
+    if (kind == Kind::Disjunctive) {
+        Bdd<LibraryType> result = states.getDdManager().getBddZero();
+        for (auto const& part : parts) {
+            if (extended) {
+                result |= states.inverseRelationalProductWithExtendedRelation(part, rowMetaVariables, columnMetaVariables);
+            } else {
+                result |= states.inverseRelationalProduct(part, rowMetaVariables, columnMetaVariables);
+            }
+        }
+        return result;
+    } else {
+        Bdd<LibraryType> result = existsAbstractContained(states.swapVariables(rowColumnMetaVariablePairs), preimageSchedule.first);
+        for (uint64_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
+            result = result.andExists(parts[partIndex], preimageSchedule.second[partIndex]);
+        }
+        return result;
+    }
+}
+
+template<DdType LibraryType>
+Bdd<LibraryType> PartitionedRelation<LibraryType>::universalPreimage(Bdd<LibraryType> const& states) const {
+    // A state has only transitions into the given states iff it has no transition into the complement.
+    return !preimage(!states);
+}
+
+template<DdType LibraryType>
+Bdd<LibraryType> PartitionedRelation<LibraryType>::image(Bdd<LibraryType> const& states) const {
+    if (kind == Kind::Disjunctive) {
+        Bdd<LibraryType> result = states.getDdManager().getBddZero();
+        for (auto const& part : parts) {
+            if (extended) {
+                result |= states.andExists(part, rowMetaVariables).swapVariables(rowColumnMetaVariablePairs);
+            } else {
+                result |= states.relationalProduct(part, rowMetaVariables, columnMetaVariables);
+            }
+        }
+        return result;
+    } else {
+        Bdd<LibraryType> result = existsAbstractContained(states, imageSchedule.first);
+        for (uint64_t partIndex = 0; partIndex < parts.size(); ++partIndex) {
+            result = result.andExists(parts[partIndex], imageSchedule.second[partIndex]);
+        }
+        return result.swapVariables(rowColumnMetaVariablePairs);
+    }
+}
+
+template<DdType LibraryType>
+std::vector<Bdd<LibraryType>> const& PartitionedRelation<LibraryType>::getParts() const {
+    return parts;
+}
+
+template<DdType LibraryType>
+typename PartitionedRelation<LibraryType>::Kind const& PartitionedRelation<LibraryType>::getKind() const {
+    return kind;
+}
+
+template<DdType LibraryType>
+Bdd<LibraryType> PartitionedRelation<LibraryType>::toBdd() const {
+    Bdd<LibraryType> result = parts.front();
+    for (auto partIt = parts.begin() + 1; partIt != parts.end(); ++partIt) {
+        if (kind == Kind::Disjunctive) {
+            result |= *partIt;
+        } else {
+            result &= *partIt;
+        }
+    }
+    return result;
+}
+
+template class PartitionedRelation<DdType::CUDD>;
+template class PartitionedRelation<DdType::Sylvan>;
+
+}  // namespace dd
+}  // namespace storm
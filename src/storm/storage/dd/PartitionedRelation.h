@@ -0,0 +1,111 @@
+#pragma once
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * A transition relation over row and column meta variables that is stored as a list of parts. The relation is either the disjunction or the
+ * conjunction of its parts. Image and preimage computations operate on the (typically much smaller) parts and never build the monolithic relation.
+ * The parts may contain meta variables other than the row and column variables (e.g. the nondeterminism variables), which are then kept in the
+ * results, as it is done by Bdd::inverseRelationalProductWithExtendedRelation.
+ */
+template<DdType LibraryType>
+class PartitionedRelation {
+   public:
+    enum class Kind { Disjunctive, Conjunctive };
+
+    /*!
+     * Creates a relation from the given parts. For conjunctive relations, the parts are processed in the given order and every column (row)
+     * variable is quantified in a preimage (image) computation as soon as no subsequent part depends on it (early quantification).
+     *
+     * @param parts The non-empty list of parts.
+     * @param kind Whether the relation is the disjunction or the conjunction of the parts.
+     * @param rowMetaVariables The row meta variables of the relation.
+     * @param columnMetaVariables The column meta variables of the relation.
+     * @param rowColumnMetaVariablePairs The pairs of corresponding row and column meta variables.
+     */
+    PartitionedRelation(std::vector<Bdd<LibraryType>> const& parts, Kind const& kind, std::set<storm::expressions::Variable> const& rowMetaVariables,
+                        std::set<storm::expressions::Variable> const& columnMetaVariables,
+                        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+    /*!
+     * Splits the given relation into a disjunctively partitioned relation. Parts that have more than the given number of nodes are recursively
+     * split by cofactoring with respect to their top-most DD variable as long as this does not exceed the given number of parts.
+     *
+     * @param maximalNodeCount The maximal number of nodes of a part. If zero, the relation is kept as a single part.
+     * @param maximalNumberOfParts The number of parts after which no further splits are performed.
+     */
+    static PartitionedRelation<LibraryType> splitDisjunctively(
+        Bdd<LibraryType> const& relation, std::set<storm::expressions::Variable> const& rowMetaVariables,
+        std::set<storm::expressions::Variable> const& columnMetaVariables,
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, uint64_t maximalNodeCount,
+        uint64_t maximalNumberOfParts = 64);
+
+    /*!
+     * Computes the states (over the row variables) that have a transition to the given states (over the row variables).
+     */
+    Bdd<LibraryType> preimage(Bdd<LibraryType> const& states) const;
+
+    /*!
+     * Computes the states (over the row variables) all of whose transitions lead to the given states (over the row variables). This corresponds
+     * to the universal abstraction of the column variables from relation.implies(states') (where states' is obtained by swapping row and column
+     * variables).
+     */
+    Bdd<LibraryType> universalPreimage(Bdd<LibraryType> const& states) const;
+
+    /*!
+     * Computes the states (over the row variables) that are reachable from the given states (over the row variables) in one step.
+     */
+    Bdd<LibraryType> image(Bdd<LibraryType> const& states) const;
+
+    /*!
+     * Retrieves the parts of the relation.
+     */
+    std::vector<Bdd<LibraryType>> const& getParts() const;
+
+    Kind const& getKind() const;
+
+    /*!
+     * Retrieves the relation as a single BDD.
+     */
+    Bdd<LibraryType> toBdd() const;
+
+   private:
+    /*!
+     * Computes the variables that can be quantified after each of the parts when quantifying the given variables from the conjunction of all parts
+     * and the states.
+     *
+     * @return The variables to quantify before the first part and the variables to quantify after each of the parts.
+     */
+    std::pair<std::set<storm::expressions::Variable>, std::vector<std::set<storm::expressions::Variable>>> computeQuantificationSchedule(
+        std::set<storm::expressions::Variable> const& variables) const;
+
+    // The parts of the relation.
+    std::vector<Bdd<LibraryType>> parts;
+
+    // Whether the relation is the disjunction or the conjunction of the parts.
+    Kind kind;
+
+    // The row and column meta variables as well as their pairing.
+    std::set<storm::expressions::Variable> rowMetaVariables;
+    std::set<storm::expressions::Variable> columnMetaVariables;
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+
+    // Whether some part contains meta variables other than the row and column variables.
+    bool extended;
+
+    // The early quantification schedules for preimage and image computations of conjunctive relations.
+    std::pair<std::set<storm::expressions::Variable>, std::vector<std::set<storm::expressions::Variable>>> preimageSchedule;
+    std::pair<std::set<storm::expressions::Variable>, std::vector<std::set<storm::expressions::Variable>>> imageSchedule;
+};
+
+}  // namespace dd
+}  // namespace storm
@@ -1,7 +1,10 @@
 #include "storm/storage/dd/bisimulation/PreservationInformation.h"
 
 #include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
 
+#include "storm/modelchecker/propositional/SymbolicPropositionalModelChecker.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -11,6 +14,54 @@ namespace storm {
 namespace dd {
 namespace bisimulation {
 
+namespace {
+
+/*!
+ * Retrieves the states in which the value of the given formula does not depend on the outgoing transitions of the state. This is only determined for
+ * (bounded) until and eventually formulas with propositional subformulas (and without lower bounds) below a probability, reward or time operator.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+std::optional<storm::dd::Bdd<DdType>> getDecidedStatesOfFormula(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                                  storm::logic::Formula const& formula) {
+    if (!formula.isProbabilityOperatorFormula() && !formula.isRewardOperatorFormula() && !formula.isTimeOperatorFormula()) {
+        return std::nullopt;
+    }
+    storm::logic::Formula const& pathFormula = formula.asOperatorFormula().getSubformula();
+
+    std::shared_ptr<storm::logic::Formula const> constraintFormula;
+    std::shared_ptr<storm::logic::Formula const> targetFormula;
+    if (pathFormula.isEventuallyFormula()) {
+        targetFormula = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+    } else if (formula.isProbabilityOperatorFormula() && pathFormula.isUntilFormula()) {
+        constraintFormula = pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer();
+        targetFormula = pathFormula.asUntilFormula().getRightSubformula().asSharedPointer();
+    } else if (formula.isProbabilityOperatorFormula() && pathFormula.isBoundedUntilFormula()) {
+        // With a lower bound, the outgoing transitions of goal states are still relevant.
+        storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+        if (boundedUntilFormula.isMultiDimensional() || boundedUntilFormula.hasLowerBound()) {
+            return std::nullopt;
+        }
+        constraintFormula = boundedUntilFormula.getLeftSubformula().asSharedPointer();
+        targetFormula = boundedUntilFormula.getRightSubformula().asSharedPointer();
+    } else {
+        return std::nullopt;
+    }
+
+    storm::logic::FragmentSpecification propositional = storm::logic::propositional();
+    if (!targetFormula->isInFragment(propositional) || (constraintFormula && !constraintFormula->isInFragment(propositional))) {
+        return std::nullopt;
+    }
+
+    storm::modelchecker::SymbolicPropositionalModelChecker<storm::models::symbolic::Model<DdType, ValueType>> propositionalChecker(model);
+    storm::dd::Bdd<DdType> result = propositionalChecker.check(*targetFormula)->template asSymbolicQualitativeCheckResult<DdType>().getTruthValuesVector();
+    if (constraintFormula) {
+        result |= !propositionalChecker.check(*constraintFormula)->template asSymbolicQualitativeCheckResult<DdType>().getTruthValuesVector();
+    }
+    return result && model.getReachableStates();
+}
+
+}  // namespace
+
 template<storm::dd::DdType DdType, typename ValueType>
 PreservationInformation<DdType, ValueType>::PreservationInformation(storm::models::symbolic::Model<DdType, ValueType> const& model)
     : PreservationInformation(model, model.getLabels()) {
@@ -47,7 +98,19 @@ PreservationInformation<DdType, ValueType>::PreservationInformation(storm::model
             this->addRewardModel(rewardModel.first);
         }
     } else {
+        bool allFormulasHaveDecidedStates = true;
         for (auto const& formula : formulas) {
+            if (allFormulasHaveDecidedStates) {
+                // The outgoing transitions of a state are only irrelevant if they are irrelevant for all formulas.
+                std::optional<storm::dd::Bdd<DdType>> decidedStatesOfFormula = getDecidedStatesOfFormula(model, *formula);
+                if (decidedStatesOfFormula) {
+                    decidedStates = decidedStates ? decidedStates.value() && decidedStatesOfFormula.value() : decidedStatesOfFormula.value();
+                } else {
+                    allFormulasHaveDecidedStates = false;
+                    decidedStates = std::nullopt;
+                }
+            }
+
             for (auto const& expressionFormula : formula->getAtomicExpressionFormulas()) {
                 this->addExpression(expressionFormula->getExpression());
             }
@@ -104,6 +167,17 @@ std::set<std::string> const& PreservationInformation<DdType, ValueType>::getRewa
     return rewardModelNames;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+bool PreservationInformation<DdType, ValueType>::hasDecidedStates() const {
+    return static_cast<bool>(decidedStates);
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Bdd<DdType> const& PreservationInformation<DdType, ValueType>::getDecidedStates() const {
+    STORM_LOG_ASSERT(decidedStates, "Decided states are not available.");
+    return decidedStates.value();
+}
+
 template class PreservationInformation<storm::dd::DdType::CUDD, double>;
 
 template class PreservationInformation<storm::dd::DdType::Sylvan, double>;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -35,10 +36,24 @@ class PreservationInformation {
     std::set<storm::expressions::Expression> const& getExpressions() const;
     std::set<std::string> const& getRewardModelNames() const;
 
+    /*!
+     * Retrieves whether the states in which the values of all formulas are already fixed are known. This is only the case if the object was
+     * created from a non-empty set of formulas that are all (bounded) reachability probabilities or expected rewards (or times) to reach a set of
+     * states.
+     */
+    bool hasDecidedStates() const;
+
+    /*!
+     * Retrieves the states in which the values of all formulas are already fixed, i.e. the states whose outgoing transitions are irrelevant for
+     * the formulas. For example, these are the goal states and the states violating the constraint of an until formula.
+     */
+    storm::dd::Bdd<DdType> const& getDecidedStates() const;
+
    private:
     std::set<std::string> labels;
     std::set<storm::expressions::Expression> expressions;
     std::set<std::string> rewardModelNames;
+    std::optional<storm::dd::Bdd<DdType>> decidedStates;
 };
 
 }  // namespace bisimulation
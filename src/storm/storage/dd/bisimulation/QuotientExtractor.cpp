@@ -1,5 +1,7 @@
 #include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
 
 #include "storm/storage/dd/DdManager.h"
@@ -24,6 +26,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "storm/storage/BitVector.h"
@@ -245,7 +248,7 @@ class InternalSparseQuotientExtractorBase {
    public:
     InternalSparseQuotientExtractorBase(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& partitionBdd,
                                         storm::expressions::Variable const& blockVariable, uint64_t numberOfBlocks,
-                                        storm::dd::Bdd<DdType> const& representatives)
+                                        storm::dd::Bdd<DdType> const& representatives, boost::optional<storm::dd::Bdd<DdType>> const& absorbingStates)
         : model(model),
           manager(model.getManager()),
           isNondeterministic(false),
@@ -253,7 +256,8 @@ class InternalSparseQuotientExtractorBase {
           numberOfBlocks(numberOfBlocks),
           blockVariable(blockVariable),
           representatives(representatives),
-          matrixEntriesCreated(false) {
+          sourceRepresentatives(representatives),
+          countingMatrixEntries(false) {
         // Create cubes.
         rowVariablesCube = manager.getBddOne();
         for (auto const& variable : model.getRowVariables()) {
@@ -273,10 +277,22 @@ class InternalSparseQuotientExtractorBase {
         allSourceVariablesCube = rowVariablesCube && nondeterminismVariablesCube;
         isNondeterministic = !nondeterminismVariablesCube.isOne();
 
+        // Only the blocks that contain a non-absorbing state need their transitions to be extracted.
+        if (absorbingStates) {
+            this->sourceRepresentatives &= this->getStatesOfBlocksContaining(!absorbingStates.get());
+        }
+
         // Create ODDs.
         this->odd = representatives.createOdd();
         if (this->isNondeterministic) {
-            this->nondeterminismOdd = (model.getQualitativeTransitionMatrix().existsAbstract(model.getColumnVariables()) && this->representatives).createOdd();
+            // The choices available in the representatives are obtained from the illegal mask to avoid abstracting from the full transition relation.
+            auto const& nondeterministicModel = *model.template as<storm::models::symbolic::NondeterministicModel<DdType, ValueType>>();
+            this->nondeterminismOdd = (!nondeterministicModel.getIllegalMask() && this->sourceRepresentatives).createOdd();
+        }
+        if (absorbingStates) {
+            this->absorbingBlocks = (this->representatives && !this->sourceRepresentatives).toVector(this->odd);
+        } else {
+            this->absorbingBlocks = storm::storage::BitVector(this->odd.getTotalOffset());
         }
 
         STORM_LOG_TRACE("Partition has " << partitionBdd.existsAbstract(model.getRowVariables()).getNonZeroCount() << " states in " << this->numberOfBlocks
@@ -286,11 +302,11 @@ class InternalSparseQuotientExtractorBase {
     virtual ~InternalSparseQuotientExtractorBase() = default;
 
     storm::storage::SparseMatrix<ExportValueType> extractTransitionMatrix(storm::dd::Add<DdType, ValueType> const& transitionMatrix) {
-        return extractMatrixInternal(transitionMatrix);
+        return this->extractMatrixInternal(transitionMatrix);
     }
 
     std::vector<ExportValueType> extractStateVector(storm::dd::Add<DdType, ValueType> const& vector) {
-        return extractVectorInternal(vector, this->rowVariablesCube, this->odd);
+        return extractVectorInternal(vector, this->representatives, this->rowVariablesCube, this->odd);
     }
 
     std::vector<ExportValueType> extractStateActionVector(storm::dd::Add<DdType, ValueType> const& vector) {
@@ -298,12 +314,15 @@ class InternalSparseQuotientExtractorBase {
             return extractStateVector(vector);
         } else {
             STORM_LOG_ASSERT(!this->rowPermutation.empty(), "Expected proper row permutation.");
-            std::vector<ExportValueType> valueVector = extractVectorInternal(vector, this->allSourceVariablesCube, this->nondeterminismOdd);
-
-            // Reorder the values according to the known row permutation.
-            std::vector<ExportValueType> reorderedValues(valueVector.size());
-            for (uint64_t pos = 0; pos < valueVector.size(); ++pos) {
-                reorderedValues[pos] = valueVector[rowPermutation[pos]];
+            std::vector<ExportValueType> valueVector =
+                extractVectorInternal(vector, this->sourceRepresentatives, this->allSourceVariablesCube, this->nondeterminismOdd);
+
+            // Reorder the values according to the known row permutation. The rows of absorbing states do not have a counterpart.
+            std::vector<ExportValueType> reorderedValues(rowPermutation.size(), storm::utility::zero<ExportValueType>());
+            for (uint64_t pos = 0; pos < rowPermutation.size(); ++pos) {
+                if (rowPermutation[pos] != NoSourceRow) {
+                    reorderedValues[pos] = valueVector[rowPermutation[pos]];
+                }
             }
             return reorderedValues;
         }
@@ -314,83 +333,134 @@ class InternalSparseQuotientExtractorBase {
     }
 
     storm::storage::BitVector extractSetExists(storm::dd::Bdd<DdType> const& set) {
-        return ((set && partitionBdd).existsAbstract(model.getRowVariables()) && partitionBdd && representatives)
-            .existsAbstract({this->blockVariable})
-            .toVector(this->odd);
+        return (this->getStatesOfBlocksContaining(set) && representatives).toVector(this->odd);
     }
 
    protected:
-    virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<DdType, ValueType> const& matrix) = 0;
+    virtual void extractMatrixEntries(storm::dd::Add<DdType, ValueType> const& matrix) = 0;
 
-    virtual std::vector<ExportValueType> extractVectorInternal(storm::dd::Add<DdType, ValueType> const& vector, storm::dd::Bdd<DdType> const& variablesCube,
-                                                               storm::dd::Odd const& odd) = 0;
+    virtual std::vector<ExportValueType> extractVectorInternal(storm::dd::Add<DdType, ValueType> const& vector, storm::dd::Bdd<DdType> const& representatives,
+                                                               storm::dd::Bdd<DdType> const& variablesCube, storm::dd::Odd const& odd) = 0;
 
-    storm::storage::SparseMatrix<ExportValueType> createMatrixFromEntries() {
-        for (auto& row : matrixEntries) {
-            std::sort(row.begin(), row.end(),
-                      [](storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& a,
-                         storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& b) { return a.getColumn() < b.getColumn(); });
-        }
+    /*!
+     * Retrieves all states whose block contains at least one state of the given set.
+     */
+    storm::dd::Bdd<DdType> getStatesOfBlocksContaining(storm::dd::Bdd<DdType> const& set) const {
+        return ((set && partitionBdd).existsAbstract(model.getRowVariables()) && partitionBdd).existsAbstract({this->blockVariable});
+    }
 
-        rowPermutation = std::vector<uint64_t>(matrixEntries.size());
-        std::iota(rowPermutation.begin(), rowPermutation.end(), 0ull);
+    /*!
+     * Extracts the matrix in two passes over the DD. The first pass only counts the entries of each row, which allows the second one to write the
+     * entries directly to their final position. This way, no intermediate per-row storage is needed and the peak memory is (roughly) that of the
+     * resulting matrix.
+     */
+    storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<DdType, ValueType> const& matrix) {
+        uint64_t numberOfSourceRows = this->isNondeterministic ? nondeterminismOdd.getTotalOffset() : odd.getTotalOffset();
+        rowOffsets = std::vector<uint64_t>(numberOfSourceRows, 0);
         if (this->isNondeterministic) {
-            std::stable_sort(rowPermutation.begin(), rowPermutation.end(),
-                             [this](uint64_t first, uint64_t second) { return this->rowToState[first] < this->rowToState[second]; });
+            rowToState = std::vector<uint64_t>(numberOfSourceRows, 0);
         }
-
-        uint64_t rowCounter = 0;
-        uint64_t lastState = this->isNondeterministic ? rowToState[rowPermutation.front()] : 0;
-        storm::storage::SparseMatrixBuilder<ExportValueType> builder(matrixEntries.size(), this->numberOfBlocks, 0, true, this->isNondeterministic);
+        countingMatrixEntries = true;
+        this->extractMatrixEntries(matrix);
+        countingMatrixEntries = false;
+
+        // Determine the order of the rows in the quotient. Absorbing states get a single row that has no counterpart among the extracted rows.
+        rowPermutation.clear();
+        rowPermutation.reserve(numberOfSourceRows + absorbingBlocks.getNumberOfSetBits());
+        boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
         if (this->isNondeterministic) {
-            builder.newRowGroup(0);
-        }
-        for (auto& rowIdx : rowPermutation) {
-            // For nondeterministic models, open a new row group.
-            if (this->isNondeterministic && rowToState[rowIdx] != lastState) {
-                builder.newRowGroup(rowCounter);
-                lastState = rowToState[rowIdx];
+            std::vector<uint64_t> rowsOfState(numberOfSourceRows);
+            std::iota(rowsOfState.begin(), rowsOfState.end(), 0ull);
+            std::stable_sort(rowsOfState.begin(), rowsOfState.end(),
+                             [this](uint64_t first, uint64_t second) { return this->rowToState[first] < this->rowToState[second]; });
+            rowGroupIndices = std::vector<uint_fast64_t>();
+            rowGroupIndices->reserve(this->numberOfBlocks + 1);
+            auto rowIt = rowsOfState.begin();
+            for (uint64_t state = 0; state < this->numberOfBlocks; ++state) {
+                rowGroupIndices->push_back(rowPermutation.size());
+                if (absorbingBlocks.get(state)) {
+                    rowPermutation.push_back(NoSourceRow);
+                }
+                for (; rowIt != rowsOfState.end() && rowToState[*rowIt] == state; ++rowIt) {
+                    rowPermutation.push_back(*rowIt);
+                }
             }
-
-            auto& row = matrixEntries[rowIdx];
-            for (auto const& entry : row) {
-                builder.addNextValue(rowCounter, entry.getColumn(), entry.getValue());
+            rowGroupIndices->push_back(rowPermutation.size());
+            rowToState.clear();
+            rowToState.shrink_to_fit();
+        } else {
+            for (uint64_t state = 0; state < this->numberOfBlocks; ++state) {
+                rowPermutation.push_back(absorbingBlocks.get(state) ? NoSourceRow : state);
             }
+        }
 
-            // Free storage for row.
-            row.clear();
-            row.shrink_to_fit();
-
-            ++rowCounter;
+        // Turn the entry counts into the offsets at which the entries of each source row are written.
+        std::vector<uint_fast64_t> rowIndications;
+        rowIndications.reserve(rowPermutation.size() + 1);
+        uint64_t numberOfEntries = 0;
+        for (uint64_t row = 0; row < rowPermutation.size(); ++row) {
+            rowIndications.push_back(numberOfEntries);
+            if (rowPermutation[row] == NoSourceRow) {
+                ++numberOfEntries;
+            } else {
+                uint64_t entriesInRow = rowOffsets[rowPermutation[row]];
+                rowOffsets[rowPermutation[row]] = numberOfEntries;
+                numberOfEntries += entriesInRow;
+            }
         }
+        rowIndications.push_back(numberOfEntries);
 
-        rowToState.clear();
-        rowToState.shrink_to_fit();
-        matrixEntries.clear();
-        matrixEntries.shrink_to_fit();
+        matrixEntries = std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>>(
+            numberOfEntries, storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>(0, storm::utility::zero<ExportValueType>()));
+        for (auto state : absorbingBlocks) {
+            uint64_t row = this->isNondeterministic ? rowGroupIndices.get()[state] : state;
+            matrixEntries[rowIndications[row]] = storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>(state, storm::utility::one<ExportValueType>());
+        }
+        this->extractMatrixEntries(matrix);
+        rowOffsets.clear();
+        rowOffsets.shrink_to_fit();
+
+        // Sort the entries of each row and sum up the entries that lead to the same block.
+        uint64_t currentEntry = 0;
+        for (uint64_t row = 0; row < rowPermutation.size(); ++row) {
+            auto rowStart = matrixEntries.begin() + rowIndications[row];
+            auto rowEnd = matrixEntries.begin() + rowIndications[row + 1];
+            std::sort(rowStart, rowEnd,
+                      [](storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& a,
+                         storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& b) { return a.getColumn() < b.getColumn(); });
+            rowIndications[row] = currentEntry;
+            for (auto entryIt = rowStart; entryIt != rowEnd; ++entryIt) {
+                if (currentEntry > rowIndications[row] && matrixEntries[currentEntry - 1].getColumn() == entryIt->getColumn()) {
+                    matrixEntries[currentEntry - 1].setValue(matrixEntries[currentEntry - 1].getValue() + entryIt->getValue());
+                } else {
+                    matrixEntries[currentEntry++] = std::move(*entryIt);
+                }
+            }
+        }
+        rowIndications.back() = currentEntry;
+        matrixEntries.resize(currentEntry);
 
-        return builder.build();
+        return storm::storage::SparseMatrix<ExportValueType>(this->numberOfBlocks, std::move(rowIndications), std::move(matrixEntries),
+                                                             std::move(rowGroupIndices));
     }
 
+    /*!
+     * Is called by the extraction for every entry of the original matrix (restricted to the representatives of the non-absorbing blocks).
+     * Depending on the pass, this either counts the entry or writes it.
+     */
     void addMatrixEntry(uint64_t row, uint64_t column, ExportValueType const& value) {
-        this->matrixEntries[row].emplace_back(column, value);
+        this->matrixEntries[this->rowOffsets[row]++] = storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>(column, value);
     }
 
-    void createMatrixEntryStorage() {
-        if (matrixEntriesCreated) {
-            matrixEntries.clear();
-            if (isNondeterministic) {
-                rowToState.clear();
-            }
-        }
-        matrixEntries.resize(this->isNondeterministic ? nondeterminismOdd.getTotalOffset() : odd.getTotalOffset());
-        if (isNondeterministic) {
-            rowToState.resize(matrixEntries.size());
+    void countMatrixEntry(uint64_t row, uint64_t state) {
+        ++this->rowOffsets[row];
+        if (this->isNondeterministic) {
+            this->rowToState[row] = state;
         }
     }
 
-    void assignRowToState(uint64_t row, uint64_t state) {
-        rowToState[row] = state;
+    bool isCountingMatrixEntries() const {
+        return countingMatrixEntries;
     }
 
     storm::models::symbolic::Model<DdType, ValueType> const& model;
@@ -415,17 +485,27 @@ class InternalSparseQuotientExtractorBase {
     storm::dd::Odd odd;
     storm::dd::Odd nondeterminismOdd;
 
-    // A flag that stores whether the underlying storage for matrix entries has been created.
-    bool matrixEntriesCreated;
+    // The representatives of the blocks whose transitions are extracted and the blocks that are made absorbing instead.
+    storm::dd::Bdd<DdType> sourceRepresentatives;
+    storm::storage::BitVector absorbingBlocks;
+
+    // A flag that stores whether the current pass over the matrix only counts the entries.
+    bool countingMatrixEntries;
 
     // The entries of the quotient matrix that is built.
-    std::vector<std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>>> matrixEntries;
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>> matrixEntries;
+
+    // A vector storing for each extracted row the number of its entries (first pass) or the position of its next entry (second pass).
+    std::vector<uint64_t> rowOffsets;
 
     // A vector storing for each row which state it belongs to.
     std::vector<uint64_t> rowToState;
 
-    // A vector storing the row permutation for nondeterministic models.
+    // A vector storing for each row of the quotient the extracted row it corresponds to.
     std::vector<uint64_t> rowPermutation;
+
+    // Marks the rows of the quotient that do not correspond to an extracted row.
+    static constexpr uint64_t NoSourceRow = std::numeric_limits<uint64_t>::max();
 };
 
 template<typename ValueType>
@@ -433,26 +513,27 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
    public:
     InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::CUDD, ValueType> const& model,
                                     storm::dd::Bdd<storm::dd::DdType::CUDD> const& partitionBdd, storm::expressions::Variable const& blockVariable,
-                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::CUDD> const& representatives)
-        : InternalSparseQuotientExtractorBase<storm::dd::DdType::CUDD, ValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives),
+                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::CUDD> const& representatives,
+                                    boost::optional<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& absorbingStates)
+        : InternalSparseQuotientExtractorBase<storm::dd::DdType::CUDD, ValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives,
+                                                                                  absorbingStates),
           ddman(this->manager.getInternalDdManager().getCuddManager().getManager()) {
         this->createBlockToOffsetMapping();
     }
 
    private:
-    virtual storm::storage::SparseMatrix<ValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::CUDD, ValueType> const& matrix) override {
-        this->createMatrixEntryStorage();
+    virtual void extractMatrixEntries(storm::dd::Add<storm::dd::DdType::CUDD, ValueType> const& matrix) override {
         extractTransitionMatrixRec(matrix.getInternalAdd().getCuddDdNode(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0,
-                                   this->partitionBdd.getInternalBdd().getCuddDdNode(), this->representatives.getInternalBdd().getCuddDdNode(),
+                                   this->partitionBdd.getInternalBdd().getCuddDdNode(), this->sourceRepresentatives.getInternalBdd().getCuddDdNode(),
                                    this->allSourceVariablesCube.getInternalBdd().getCuddDdNode(),
                                    this->nondeterminismVariablesCube.getInternalBdd().getCuddDdNode(), this->isNondeterministic ? &this->odd : nullptr, 0);
-        return this->createMatrixFromEntries();
     }
 
     virtual std::vector<ValueType> extractVectorInternal(storm::dd::Add<storm::dd::DdType::CUDD, ValueType> const& vector,
+                                                         storm::dd::Bdd<storm::dd::DdType::CUDD> const& representatives,
                                                          storm::dd::Bdd<storm::dd::DdType::CUDD> const& variablesCube, storm::dd::Odd const& odd) override {
         std::vector<ValueType> result(odd.getTotalOffset());
-        extractVectorRec(vector.getInternalAdd().getCuddDdNode(), this->representatives.getInternalBdd().getCuddDdNode(),
+        extractVectorRec(vector.getInternalAdd().getCuddDdNode(), representatives.getInternalBdd().getCuddDdNode(),
                          variablesCube.getInternalBdd().getCuddDdNode(), odd, 0, result);
         return result;
     }
@@ -560,9 +641,10 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
         // If we have moved through all source variables, we must have arrived at a target block encoding.
         if (Cudd_IsConstant(variables)) {
             STORM_LOG_ASSERT(Cudd_IsConstant(transitionMatrixNode), "Expected constant node.");
-            this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode), Cudd_V(transitionMatrixNode));
-            if (stateOdd) {
-                this->assignRowToState(sourceOffset, stateOffset);
+            if (this->isCountingMatrixEntries()) {
+                this->countMatrixEntry(sourceOffset, stateOffset);
+            } else {
+                this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode), Cudd_V(transitionMatrixNode));
             }
         } else {
             // Determine whether the next variable is a nondeterminism variable.
@@ -681,28 +763,29 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
    public:
     InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, ValueType> const& model,
                                     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& partitionBdd, storm::expressions::Variable const& blockVariable,
-                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives)
+                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives,
+                                    boost::optional<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& absorbingStates)
         : InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>(model, partitionBdd, blockVariable, numberOfBlocks,
-                                                                                                     representatives) {
+                                                                                                     representatives, absorbingStates) {
         this->createBlockToOffsetMapping();
     }
 
    private:
-    virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
-        this->createMatrixEntryStorage();
+    virtual void extractMatrixEntries(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
         extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0,
-                                   this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(),
+                                   this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(),
+                                   this->sourceRepresentatives.getInternalBdd().getSylvanBdd().GetBDD(),
                                    this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(),
                                    this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr,
                                    0);
-        return this->createMatrixFromEntries();
     }
 
     virtual std::vector<ExportValueType> extractVectorInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& vector,
+                                                               storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives,
                                                                storm::dd::Bdd<storm::dd::DdType::Sylvan> const& variablesCube,
                                                                storm::dd::Odd const& odd) override {
         std::vector<ExportValueType> result(odd.getTotalOffset());
-        extractVectorRec(vector.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(),
+        extractVectorRec(vector.getInternalAdd().getSylvanMtbdd().GetMTBDD(), representatives.getInternalBdd().getSylvanBdd().GetBDD(),
                          variablesCube.getInternalBdd().getSylvanBdd().GetBDD(), odd, 0, result);
         return result;
     }
@@ -793,11 +876,12 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
         // If we have moved through all source variables, we must have arrived at a target block encoding.
         if (sylvan_isconst(variables)) {
             STORM_LOG_ASSERT(mtbdd_isleaf(transitionMatrixNode), "Expected constant node.");
-            this->addMatrixEntry(
-                sourceOffset, blockToOffset.at(targetPartitionNode),
-                storm::utility::convertNumber<ExportValueType>(storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(transitionMatrixNode)));
-            if (stateOdd) {
-                this->assignRowToState(sourceOffset, stateOffset);
+            if (this->isCountingMatrixEntries()) {
+                this->countMatrixEntry(sourceOffset, stateOffset);
+            } else {
+                this->addMatrixEntry(sourceOffset, blockToOffset.at(targetPartitionNode),
+                                     storm::utility::convertNumber<ExportValueType>(
+                                         storm::dd::InternalAdd<storm::dd::DdType::Sylvan, ValueType>::getValue(transitionMatrixNode)));
             }
         } else {
             // Determine whether the next variable is a nondeterminism variable.
@@ -904,6 +988,7 @@ QuotientExtractor<DdType, ValueType, ExportValueType>::QuotientExtractor(storm::
     auto const& settings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
     this->useRepresentatives = settings.isUseRepresentativesSet();
     this->useOriginalVariables = settings.isUseOriginalVariablesSet();
+    this->restrictQuotient = settings.isRestrictQuotientSet();
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
@@ -941,8 +1026,18 @@ std::shared_ptr<storm::models::sparse::Model<ExportValueType>> QuotientExtractor
         "Representatives size does not match that of the partition: " << representatives.getNonZeroCount() << " vs. " << partition.getNumberOfBlocks() << ".");
     STORM_LOG_ASSERT((representatives && partitionAsBdd).existsAbstract(model.getRowVariables()) == partitionAsBdd.existsAbstract(model.getRowVariables()),
                      "Representatives do not cover all blocks.");
+
+    boost::optional<storm::dd::Bdd<DdType>> absorbingStates;
+    if (this->restrictQuotient) {
+        if (preservationInformation.hasDecidedStates() && model.getType() != storm::models::ModelType::MarkovAutomaton) {
+            absorbingStates = preservationInformation.getDecidedStates();
+        } else {
+            STORM_LOG_WARN("Extracting the full quotient as it cannot be restricted to the part that is relevant for the properties.");
+        }
+    }
+
     InternalSparseQuotientExtractor<DdType, ValueType, ExportValueType> sparseExtractor(model, partitionAsBdd, partition.getBlockVariable(),
-                                                                                        partition.getNumberOfBlocks(), representatives);
+                                                                                        partition.getNumberOfBlocks(), representatives, absorbingStates);
     storm::storage::SparseMatrix<ExportValueType> quotientTransitionMatrix = sparseExtractor.extractTransitionMatrix(model.getTransitionMatrix());
     auto end = std::chrono::high_resolution_clock::now();
     STORM_LOG_INFO("Quotient transition matrix extracted in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
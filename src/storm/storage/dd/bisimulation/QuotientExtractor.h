@@ -21,6 +21,12 @@ class QuotientExtractor {
    public:
     QuotientExtractor(storm::dd::bisimulation::QuotientFormat const& quotientFormat);
 
+    /*!
+     * Extracts the quotient of the model with respect to the given partition. If the quotient is extracted in the sparse format, the matrix is
+     * built directly from the partition and the transition matrix without intermediate DDs. If requested via the bisimulation settings, the
+     * states in which all preserved properties are already decided are made absorbing in the sparse quotient, i.e. their transitions are not
+     * extracted.
+     */
     std::shared_ptr<storm::models::Model<ExportValueType>> extract(storm::models::symbolic::Model<DdType, ValueType> const& model,
                                                                    Partition<DdType, ValueType> const& partition,
                                                                    PreservationInformation<DdType, ValueType> const& preservationInformation);
@@ -42,6 +48,7 @@ class QuotientExtractor {
 
     bool useRepresentatives;
     bool useOriginalVariables;
+    bool restrictQuotient;
     storm::dd::bisimulation::QuotientFormat quotientFormat;
 };
 
@@ -1,6 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/OddConversionSplit.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
@@ -416,6 +417,41 @@ void InternalAdd<DdType::CUDD, ValueType>::exportToText(std::string const&) cons
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported");
 }
 
+template<typename ValueType>
+std::vector<AddNode<ValueType>> InternalAdd<DdType::CUDD, ValueType>::getNodes() const {
+    std::unordered_map<DdNode const*, uint64_t> nodeToPositionMap;
+    std::vector<AddNode<ValueType>> nodes;
+    getNodesRec(this->getCuddDdNode(), nodeToPositionMap, nodes);
+    return nodes;
+}
+
+template<typename ValueType>
+uint64_t InternalAdd<DdType::CUDD, ValueType>::getNodesRec(DdNode const* dd, std::unordered_map<DdNode const*, uint64_t>& nodeToPositionMap,
+                                                               std::vector<AddNode<ValueType>>& nodes) {
+    // ADDs do not have complement edges, so the nodes can be identified by their address.
+    auto nodePositionPair = nodeToPositionMap.find(dd);
+    if (nodePositionPair != nodeToPositionMap.end()) {
+        return nodePositionPair->second;
+    }
+
+    AddNode<ValueType> node;
+    DdNode* regularNode = Cudd_Regular(const_cast<DdNode*>(dd));
+    if (Cudd_IsConstant(regularNode)) {
+        node.ddVariableIndex = AddNode<ValueType>::TerminalIndex;
+        node.thenNode = 0;
+        node.elseNode = 0;
+        node.value = storm::utility::convertNumber<ValueType>(Cudd_V(regularNode));
+    } else {
+        node.ddVariableIndex = Cudd_NodeReadIndex(regularNode);
+        node.thenNode = getNodesRec(Cudd_T(regularNode), nodeToPositionMap, nodes);
+        node.elseNode = getNodesRec(Cudd_E(regularNode), nodeToPositionMap, nodes);
+        node.value = storm::utility::zero<ValueType>();
+    }
+    nodes.push_back(node);
+    nodeToPositionMap.emplace(dd, nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
 template<typename ValueType>
 AddIterator<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::begin(DdManager<DdType::CUDD> const& fullDdManager, InternalBdd<DdType::CUDD> const&,
                                                                                  uint_fast64_t, std::set<storm::expressions::Variable> const& metaVariables,
@@ -520,8 +556,8 @@ template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                      std::vector<ValueType>& targetVector,
                                                                      std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
-               [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+    forEachSplit(odd, ddVariableIndices,
+                 [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
 }
 
 template<typename ValueType>
@@ -534,34 +570,60 @@ template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                      std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector,
                                                                      std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
-               [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
-                   ValueType& targetValue = targetVector[offsets[offset]];
-                   targetValue = function(targetValue, value);
-               });
+    forEachSplit(odd, ddVariableIndices, [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
+        ValueType& targetValue = targetVector[offsets[offset]];
+        targetValue = function(targetValue, value);
+    });
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::forEachSplit(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                        std::function<void(uint64_t const&, ValueType const&)> const& function) const {
+    uint64_t splitLevel = getOddConversionSplitLevel(odd.getTotalOffset(), ddVariableIndices.size());
+    if (splitLevel == 0) {
+        forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+        return;
+    }
+
+    OddConversionSplit<VectorConversionFrame> split(splitLevel);
+    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function, &split, 0);
+    split.process([&](VectorConversionFrame const& frame) {
+        forEachRec(frame.dd, frame.currentLevel, ddVariableIndices.size(), frame.currentOffset, *frame.odd, ddVariableIndices, function);
+    });
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::forEachRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset,
                                                       Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
-                                                      std::function<void(uint64_t const&, ValueType const&)> const& function) const {
+                                                      std::function<void(uint64_t const&, ValueType const&)> const& function,
+                                                      OddConversionSplit<VectorConversionFrame>* split, uint64_t bucket) const {
     // For the empty DD, we do not need to add any entries.
     if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
         return;
     }
 
+    // If the traversal is split, the remaining part is recorded to be processed later.
+    if (split && currentLevel == split->getSplitLevel()) {
+        split->add(bucket, {dd, currentLevel, currentOffset, &odd});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentLevel == maxLevel) {
         function(currentOffset, storm::utility::convertNumber<ValueType>(Cudd_V(dd)));
     } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
         // If we skipped a level, we need to enumerate the explicit entries for the case in which the bit is set
         // and for the one in which it is not set.
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function, split,
+                   OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, false));
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function, split,
+                   OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, true));
     } else {
         // Otherwise, we simply recursively call the function for both (different) cases.
-        forEachRec(Cudd_E_const(dd), currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(Cudd_T_const(dd), currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(Cudd_E_const(dd), currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function, split,
+                   OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, false));
+        forEachRec(Cudd_T_const(dd), currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices,
+                   function, split, OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, true));
     }
 }
 
@@ -729,9 +791,23 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_f
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
-                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    uint64_t splitLevel = getOddConversionSplitLevel(rowOdd.getTotalOffset(), ddRowVariableIndices.size());
+    if (splitLevel == 0) {
+        toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // As the parts of the split refer to disjoint sets of rows, they modify disjoint entries of rowIndications and columnsAndValues.
+    OddConversionSplit<MatrixConversionFrame> split(splitLevel);
+    toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                          ddRowVariableIndices, ddColumnVariableIndices, writeValues, &split, 0);
+    split.process([&](MatrixConversionFrame const& frame) {
+        toMatrixComponentsRec(frame.dd, rowGroupIndices, rowIndications, columnsAndValues, *frame.rowOdd, *frame.columnOdd, frame.currentRowLevel,
+                              frame.currentColumnLevel, maxLevel, frame.currentRowOffset, frame.currentColumnOffset, ddRowVariableIndices,
+                              ddColumnVariableIndices, writeValues);
+    });
 }
 
 template<typename ValueType>
@@ -741,12 +817,19 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
                                                                  Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                  uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                  uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                 OddConversionSplit<MatrixConversionFrame>* split, uint64_t bucket) const {
     // For the empty DD, we do not need to add any entries.
     if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
         return;
     }
 
+    // If the traversal is split, the remaining part is recorded to be processed later.
+    if (split && currentRowLevel == split->getSplitLevel()) {
+        split->add(bucket, {dd, &rowOdd, &columnOdd, currentRowLevel, currentColumnLevel, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
@@ -783,22 +866,26 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
             }
         }
 
+        uint64_t elseBucket = OddConversionSplit<MatrixConversionFrame>::getSuccessorBucket(bucket, false);
+        uint64_t thenBucket = OddConversionSplit<MatrixConversionFrame>::getSuccessorBucket(bucket, true);
+
         // Visit else-else.
         toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+                              ddColumnVariableIndices, generateValues, split, elseBucket);
         // Visit else-then.
         toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(),
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, split, elseBucket);
         // Visit then-else.
         toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset,
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, split, thenBucket);
         // Visit then-then.
         toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
                               currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(),
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, split,
+                              thenBucket);
     }
 }
 
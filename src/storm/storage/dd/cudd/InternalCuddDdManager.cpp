@@ -196,6 +196,10 @@ void InternalDdManager<DdType::CUDD>::triggerReordering() {
     this->getCuddManager().ReduceHeap(this->reorderingTechnique, 0);
 }
 
+bool InternalDdManager<DdType::CUDD>::reorderIfNecessary() {
+    return false;
+}
+
 void InternalDdManager<DdType::CUDD>::debugCheck() const {
     this->getCuddManager().CheckKeys();
     this->getCuddManager().DebugCheck();
@@ -127,6 +127,14 @@ class InternalDdManager<DdType::CUDD> {
      */
     void triggerReordering();
 
+    /*!
+     * Triggers a reordering if the manager does not reorder on its own when necessary. As CUDD reorders automatically whenever dynamic reordering
+     * is allowed, this does nothing.
+     *
+     * @return True iff a reordering was performed.
+     */
+    bool reorderIfNecessary();
+
     /*!
      * Performs a debug check if available.
      */
@@ -1,6 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/OddConversionSplit.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 
@@ -878,6 +879,40 @@ void InternalAdd<DdType::Sylvan, ValueType>::exportToText(std::string const& fil
     }
 }
 
+template<typename ValueType>
+std::vector<AddNode<ValueType>> InternalAdd<DdType::Sylvan, ValueType>::getNodes() const {
+    std::unordered_map<MTBDD, uint64_t> nodeToPositionMap;
+    std::vector<AddNode<ValueType>> nodes;
+    getNodesRec(this->getSylvanMtbdd().GetMTBDD(), nodeToPositionMap, nodes);
+    return nodes;
+}
+
+template<typename ValueType>
+uint64_t InternalAdd<DdType::Sylvan, ValueType>::getNodesRec(MTBDD dd, std::unordered_map<MTBDD, uint64_t>& nodeToPositionMap,
+                                                                 std::vector<AddNode<ValueType>>& nodes) {
+    // The complement mark is part of the identity of a node, as the children and leaf values are retrieved with respect to it.
+    auto nodePositionPair = nodeToPositionMap.find(dd);
+    if (nodePositionPair != nodeToPositionMap.end()) {
+        return nodePositionPair->second;
+    }
+
+    AddNode<ValueType> node;
+    if (mtbdd_isleaf(dd)) {
+        node.ddVariableIndex = AddNode<ValueType>::TerminalIndex;
+        node.thenNode = 0;
+        node.elseNode = 0;
+        node.value = getValue(dd);
+    } else {
+        node.ddVariableIndex = mtbdd_getvar(dd);
+        node.thenNode = getNodesRec(mtbdd_gethigh(dd), nodeToPositionMap, nodes);
+        node.elseNode = getNodesRec(mtbdd_getlow(dd), nodeToPositionMap, nodes);
+        node.value = storm::utility::zero<ValueType>();
+    }
+    nodes.push_back(node);
+    nodeToPositionMap.emplace(dd, nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
 template<typename ValueType>
 AddIterator<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::begin(DdManager<DdType::Sylvan> const& fullDdManager,
                                                                                      InternalBdd<DdType::Sylvan> const& variableCube,
@@ -966,19 +1001,18 @@ template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                        std::vector<ValueType>& targetVector,
                                                                        std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
-               [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+    forEachSplit(odd, ddVariableIndices,
+                 [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                        std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector,
                                                                        std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
-               [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
-                   ValueType& targetValue = targetVector[offsets[offset]];
-                   targetValue = function(targetValue, value);
-               });
+    forEachSplit(odd, ddVariableIndices, [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
+        ValueType& targetValue = targetVector[offsets[offset]];
+        targetValue = function(targetValue, value);
+    });
 }
 
 template<typename ValueType>
@@ -987,30 +1021,59 @@ void InternalAdd<DdType::Sylvan, ValueType>::forEach(Odd const& odd, std::vector
     forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
 }
 
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::forEachSplit(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                          std::function<void(uint64_t const&, ValueType const&)> const& function) const {
+    // Rational functions share internal caches and can therefore not be handled concurrently.
+    uint64_t splitLevel =
+        std::is_same<ValueType, storm::RationalFunction>::value ? 0 : getOddConversionSplitLevel(odd.getTotalOffset(), ddVariableIndices.size());
+    if (splitLevel == 0) {
+        forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+        return;
+    }
+
+    OddConversionSplit<VectorConversionFrame> split(splitLevel);
+    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function, &split, 0);
+    split.process([&](VectorConversionFrame const& frame) {
+        forEachRec(frame.dd, frame.currentLevel, ddVariableIndices.size(), frame.currentOffset, *frame.odd, ddVariableIndices, function);
+    });
+}
+
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset,
                                                         Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
-                                                        std::function<void(uint64_t const&, ValueType const&)> const& function) const {
+                                                        std::function<void(uint64_t const&, ValueType const&)> const& function,
+                                                        OddConversionSplit<VectorConversionFrame>* split, uint64_t bucket) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
     }
 
+    // If the traversal is split, the remaining part is recorded to be processed later.
+    if (split && currentLevel == split->getSplitLevel()) {
+        split->add(bucket, {dd, currentLevel, currentOffset, &odd});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentLevel == maxLevel) {
         function(currentOffset, getValue(dd));
     } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
         // If we skipped a level, we need to enumerate the explicit entries for the case in which the bit is set
         // and for the one in which it is not set.
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function, split,
+                   OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, false));
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function, split,
+                   OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, true));
     } else {
         // Otherwise, we simply recursively call the function for both (different) cases.
         MTBDD thenNode = mtbdd_gethigh(dd);
         MTBDD elseNode = mtbdd_getlow(dd);
 
-        forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function, split,
+                   OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, false));
+        forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function, split,
+                   OddConversionSplit<VectorConversionFrame>::getSuccessorBucket(bucket, true));
     }
 }
 
@@ -1231,9 +1294,28 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    MTBDD dd = mtbdd_regular(this->getSylvanMtbdd().GetMTBDD());
+    bool negated = mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD());
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+
+    // Rational functions share internal caches and can therefore not be handled concurrently.
+    uint64_t splitLevel =
+        std::is_same<ValueType, storm::RationalFunction>::value ? 0 : getOddConversionSplitLevel(rowOdd.getTotalOffset(), ddRowVariableIndices.size());
+    if (splitLevel == 0) {
+        toMatrixComponentsRec(dd, negated, rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices,
+                              ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // As the parts of the split refer to disjoint sets of rows, they modify disjoint entries of rowIndications and columnsAndValues.
+    OddConversionSplit<MatrixConversionFrame> split(splitLevel);
+    toMatrixComponentsRec(dd, negated, rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0, ddRowVariableIndices,
+                          ddColumnVariableIndices, writeValues, &split, 0);
+    split.process([&](MatrixConversionFrame const& frame) {
+        toMatrixComponentsRec(frame.dd, frame.negated, rowGroupIndices, rowIndications, columnsAndValues, *frame.rowOdd, *frame.columnOdd,
+                              frame.currentRowLevel, frame.currentColumnLevel, maxLevel, frame.currentRowOffset, frame.currentColumnOffset,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    });
 }
 
 template<typename ValueType>
@@ -1243,12 +1325,19 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
                                                                    Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                    uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                    uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                   OddConversionSplit<MatrixConversionFrame>* split, uint64_t bucket) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
     }
 
+    // If the traversal is split, the remaining part is recorded to be processed later.
+    if (split && currentRowLevel == split->getSplitLevel()) {
+        split->add(bucket, {dd, negated, &rowOdd, &columnOdd, currentRowLevel, currentColumnLevel, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
@@ -1285,23 +1374,28 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
             }
         }
 
+        uint64_t elseBucket = OddConversionSplit<MatrixConversionFrame>::getSuccessorBucket(bucket, false);
+        uint64_t thenBucket = OddConversionSplit<MatrixConversionFrame>::getSuccessorBucket(bucket, true);
+
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, split, elseBucket);
         // Visit else-then.
         toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, split,
+                              elseBucket);
         // Visit then-else.
         toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues,
+                              split, thenBucket);
         // Visit then-then.
         toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
                               rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
                               currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+                              ddColumnVariableIndices, generateValues, split, thenBucket);
     }
 }
 
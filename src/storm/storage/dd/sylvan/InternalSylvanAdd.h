@@ -4,6 +4,7 @@
 #include <set>
 #include <unordered_map>
 
+#include "storm/storage/dd/AddNode.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalAdd.h"
 #include "storm/storage/dd/Odd.h"
@@ -37,6 +38,9 @@ class InternalDdManager;
 template<DdType LibraryType>
 class InternalBdd;
 
+template<typename Frame>
+class OddConversionSplit;
+
 template<DdType LibraryType, typename ValueType>
 class AddIterator;
 
@@ -518,6 +522,13 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      */
     void exportToText(std::string const& filename) const;
 
+    /*!
+     * Retrieves the nodes of the ADD such that the children of each node precede the node. The last node is the root.
+     *
+     * @return The nodes of the ADD.
+     */
+    std::vector<AddNode<ValueType>> getNodes() const;
+
     /*!
      * Retrieves an iterator that points to the first meta variable assignment with a non-zero function value.
      *
@@ -679,6 +690,43 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     std::string getStringId() const;
 
    private:
+    // The arguments of a pending call to forEachRec.
+    struct VectorConversionFrame {
+        MTBDD dd;
+        uint_fast64_t currentLevel;
+        uint_fast64_t currentOffset;
+        Odd const* odd;
+    };
+
+    // The arguments of a pending call to toMatrixComponentsRec.
+    struct MatrixConversionFrame {
+        MTBDD dd;
+        bool negated;
+        Odd const* rowOdd;
+        Odd const* columnOdd;
+        uint_fast64_t currentRowLevel;
+        uint_fast64_t currentColumnLevel;
+        uint_fast64_t currentRowOffset;
+        uint_fast64_t currentColumnOffset;
+    };
+
+    /*!
+     * Applies the given function to all values of the DD, where the traversal is split into independent parts that are processed
+     * concurrently if the vector is large enough (see OddConversionSplit). The function may only modify the entries belonging to the
+     * given offset.
+     */
+    void forEachSplit(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
+                      std::function<void(uint64_t const&, ValueType const&)> const& function) const;
+    /*!
+     * Recursively collects the nodes of the given DD (see getNodes).
+     *
+     * @param dd The DD whose nodes to collect.
+     * @param nodeToPositionMap The positions of the nodes that were already collected.
+     * @param nodes The collected nodes.
+     * @return The position of the given DD in the collected nodes.
+     */
+    static uint64_t getNodesRec(MTBDD dd, std::unordered_map<MTBDD, uint64_t>& nodeToPositionMap, std::vector<AddNode<ValueType>>& nodes);
+
     /*!
      * Recursively builds the ODD from an ADD.
      *
@@ -704,9 +752,12 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
      * @param function The callback invoked for every element. The first argument is the offset and the second
      * is the value.
+     * @param split If given, the recursion stops at the split level and records the pending calls in the split instead.
+     * @param bucket The bucket of the split that is determined by the row bits chosen so far.
      */
     void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd,
-                    std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void(uint64_t const&, ValueType const&)> const& function) const;
+                    std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void(uint64_t const&, ValueType const&)> const& function,
+                    OddConversionSplit<VectorConversionFrame>* split = nullptr, uint64_t bucket = 0) const;
 
     /*!
      * Splits the given matrix DD into the labelings of the gropus using the given group variables.
@@ -806,12 +857,15 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
      * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
      * this flag needs to be false.
+     * @param split If given, the recursion stops at the split level and records the pending calls in the split instead.
+     * @param bucket The bucket of the split that is determined by the row bits chosen so far.
      */
     void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
                                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                                uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues,
+                               OddConversionSplit<MatrixConversionFrame>* split = nullptr, uint64_t bucket = 0) const;
 
     /*!
      * Retrieves the sylvan representation of the given double value.
@@ -1,17 +1,22 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <numeric>
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "storm/adapters/sylvan.h"
+// Only needed for querying the size of the operation cache.
+#include "sylvan_cache.h"
 
 #include "storm-config.h"
 
@@ -34,6 +39,103 @@ VOID_TASK_0(gc_end) {
 }
 #endif
 
+// The statistics about sylvan that are gathered by the garbage collection hooks and the execute function. As sylvan, they are global.
+struct SylvanStatistics {
+    // Whether the statistics are gathered at all.
+    bool enabled = false;
+
+    // The minimal number of seconds between two reports (zero means that only the final report is printed).
+    uint64_t reportInterval = 0;
+
+    uint64_t numberOfGarbageCollections = 0;
+    uint64_t peakNumberOfNodes = 0;
+
+    // Whether the user was already warned about a node table that is almost full and can not grow anymore.
+    bool warnedAboutFullTable = false;
+
+    storm::utility::Stopwatch totalTime;
+    storm::utility::Stopwatch garbageCollectionTime;
+    storm::utility::Stopwatch executionTime;
+    storm::utility::Stopwatch timeSinceLastReport;
+
+    // The nesting depth of calls to execute, used to only measure the outermost call.
+    uint64_t executionDepth = 0;
+};
+
+static SylvanStatistics statistics;
+
+void printSylvanTableStatistics(size_t filledNodes, size_t tableSize) {
+    STORM_PRINT("Sylvan statistics after " << statistics.totalTime << ":\n");
+    STORM_PRINT(" * node table: " << filledNodes << " of " << tableSize << " entries in use (peak " << statistics.peakNumberOfNodes << ")\n");
+    STORM_PRINT(" * operation cache: " << cache_getused() << " of " << cache_getsize() << " entries in use (maximal size " << cache_getmaxsize()
+                                       << ")\n");
+    STORM_PRINT(" * garbage collections: " << statistics.numberOfGarbageCollections << " taking " << statistics.garbageCollectionTime << "\n");
+    STORM_PRINT(" * time in executed DD operations: " << statistics.executionTime << "\n");
+}
+
+#ifdef STORM_HAVE_SYLVAN_STATS
+void printSylvanOperationStatistics(sylvan_stats_t const& snapshot) {
+    std::vector<std::pair<std::string, int>> operations = {{"BDD ite", BDD_ITE},
+                                                           {"BDD and", BDD_AND},
+                                                           {"BDD xor", BDD_XOR},
+                                                           {"BDD exists", BDD_EXISTS},
+                                                           {"BDD and-exists", BDD_AND_EXISTS},
+                                                           {"BDD relnext", BDD_RELNEXT},
+                                                           {"BDD relprev", BDD_RELPREV},
+                                                           {"BDD compose", BDD_COMPOSE},
+                                                           {"MTBDD apply", MTBDD_APPLY},
+                                                           {"MTBDD unary apply", MTBDD_UAPPLY},
+                                                           {"MTBDD abstract", MTBDD_ABSTRACT},
+                                                           {"MTBDD ite", MTBDD_ITE},
+                                                           {"MTBDD and-abstract-plus", MTBDD_AND_ABSTRACT_PLUS},
+                                                           {"MTBDD and-abstract-max", MTBDD_AND_ABSTRACT_MAX},
+                                                           {"MTBDD compose", MTBDD_COMPOSE}};
+    STORM_PRINT(" * nodes: " << snapshot.counters[BDD_NODES_CREATED] << " created, " << snapshot.counters[BDD_NODES_REUSED] << " reused\n");
+    for (auto const& operation : operations) {
+        uint64_t calls = snapshot.counters[operation.second];
+        if (calls == 0) {
+            continue;
+        }
+        // The counters of an operation are followed by the number of results put into the cache and found in the cache.
+        uint64_t cacheHits = snapshot.counters[operation.second + 2];
+        STORM_PRINT(" * " << operation.first << ": " << calls << " calls, cache hit rate " << (100.0 * cacheHits / calls) << "%\n");
+    }
+}
+#endif
+
+VOID_TASK_0(gc_statistics_start) {
+    if (statistics.enabled) {
+        statistics.garbageCollectionTime.start();
+    }
+}
+
+VOID_TASK_0(gc_statistics_end) {
+    // The cache grows along with the node table, so once the cache reached its maximal size, the node table can not grow anymore either.
+    bool tablesAtMaximalSize = cache_getsize() == cache_getmaxsize();
+    if (!statistics.enabled && (!tablesAtMaximalSize || statistics.warnedAboutFullTable)) {
+        return;
+    }
+
+    size_t filledNodes = 0;
+    size_t tableSize = 0;
+    CALL(sylvan_table_usage, &filledNodes, &tableSize);
+    if (tablesAtMaximalSize && !statistics.warnedAboutFullTable && filledNodes * 10 > tableSize * 9) {
+        STORM_LOG_WARN("The sylvan node table is more than 90% full after garbage collection and can not grow anymore. Consider increasing the memory "
+                       "available to sylvan (--" << storm::settings::modules::SylvanSettings::moduleName << ":maxmem).");
+        statistics.warnedAboutFullTable = true;
+    }
+
+    if (statistics.enabled) {
+        statistics.garbageCollectionTime.stop();
+        ++statistics.numberOfGarbageCollections;
+        statistics.peakNumberOfNodes = std::max<uint64_t>(statistics.peakNumberOfNodes, filledNodes);
+        if (statistics.reportInterval > 0 && static_cast<uint64_t>(statistics.timeSinceLastReport.getTimeInSeconds()) >= statistics.reportInterval) {
+            printSylvanTableStatistics(filledNodes, tableSize);
+            statistics.timeSinceLastReport.restart();
+        }
+    }
+}
+
 VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*, e) {
     try {
         (*f)();
@@ -52,6 +154,7 @@ bool InternalDdManager<DdType::Sylvan>::suspended = false;
 // It is important that the variable pairs start at an even offset, because sylvan assumes this to be true for
 // some operations.
 uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
+std::vector<uint64_t> InternalDdManager<DdType::Sylvan>::variableGroupSizes;
 
 uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
     for (uint_fast64_t index = 0; index < 64; ++index) {
@@ -63,8 +166,13 @@ uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
 }
 
 InternalDdManager<DdType::Sylvan>::InternalDdManager() {
+    storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
+    dynamicReorderingAllowed = settings.isReorderingEnabled();
+    nextReorderingThreshold = settings.getReorderingThreshold();
+    reorderingGrowth = settings.getReorderingGrowth();
+    reorderingMaximalGrowth = settings.getReorderingMaximalGrowth();
+
     if (numberOfInstances == 0) {
-        storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
         size_t const task_deque_size = 1024 * 1024;
 
         lace_set_stacksize(1024 * 1024 * 16);  // 16 MiB
@@ -77,8 +185,14 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         }
         lace_start(numThreads, task_deque_size);
 
-        sylvan_set_limits(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024, 0, 0);
+        sylvan_set_limits(settings.getMaximalMemory() * 1024 * 1024, static_cast<int>(settings.getTableRatio()),
+                          static_cast<int>(settings.getInitialTableRatio()));
         sylvan_init_package();
+        if (settings.isAggressiveTableGrowthSet()) {
+            sylvan_gc_hook_main(TASK(sylvan_gc_aggressive_resize));
+        } else {
+            sylvan_gc_hook_main(TASK(sylvan_gc_normal_resize));
+        }
 
         sylvan::Sylvan::initBdd();
         sylvan::Sylvan::initMtbdd();
@@ -88,6 +202,13 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
+        statistics = SylvanStatistics();
+        statistics.enabled = settings.isStatisticsSet();
+        statistics.reportInterval = settings.getStatisticsInterval();
+        statistics.totalTime.start();
+        statistics.timeSinceLastReport.start();
+        sylvan_gc_hook_pregc(TASK(gc_statistics_start));
+        sylvan_gc_hook_postgc(TASK(gc_statistics_end));
         // TODO: uncomment these to disable lace threads whenever they are not used. This requires that *all* DD code is run through execute
         // lace_suspend();
         // suspended = true;
@@ -98,10 +219,20 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
 InternalDdManager<DdType::Sylvan>::~InternalDdManager() {
     --numberOfInstances;
     if (numberOfInstances == 0) {
-        // Enable this to print the sylvan statistics to a file.
-        //                FILE* filePointer = fopen("sylvan.stats", "w");
-        //                sylvan_stats_report(filePointer, 0);
-        //                fclose(filePointer);
+        if (statistics.enabled) {
+            size_t filledNodes = 0;
+            size_t tableSize = 0;
+            sylvan_table_usage(&filledNodes, &tableSize);
+            statistics.peakNumberOfNodes = std::max<uint64_t>(statistics.peakNumberOfNodes, filledNodes);
+            printSylvanTableStatistics(filledNodes, tableSize);
+#ifdef STORM_HAVE_SYLVAN_STATS
+            sylvan_stats_t snapshot;
+            sylvan_stats_snapshot(&snapshot);
+            printSylvanOperationStatistics(snapshot);
+#else
+            STORM_PRINT(" * per-operation statistics are only available if storm is configured with STORM_SYLVAN_STATS\n");
+#endif
+        }
 
         sylvan::Sylvan::quitPackage();
         lace_stop();
@@ -226,6 +357,9 @@ std::vector<InternalBdd<DdType::Sylvan>> InternalDdManager<DdType::Sylvan>::crea
         result.emplace_back(InternalBdd<DdType::Sylvan>(this, sylvan::Bdd::bddVar(nextFreeVariableIndex)));
         ++nextFreeVariableIndex;
     }
+    if (numberOfLayers > 0) {
+        variableGroupSizes.push_back(numberOfLayers);
+    }
 
     return result;
 }
@@ -234,16 +368,136 @@ bool InternalDdManager<DdType::Sylvan>::supportsOrderedInsertion() const {
     return false;
 }
 
-void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool) {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool value) {
+    dynamicReorderingAllowed = value;
 }
 
 bool InternalDdManager<DdType::Sylvan>::isDynamicReorderingAllowed() const {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+    return dynamicReorderingAllowed;
+}
+
+void InternalDdManager<DdType::Sylvan>::swapVariableGroups(uint64_t position) {
+    uint64_t firstIndex = std::accumulate(variableGroupSizes.begin(), variableGroupSizes.begin() + position, 0ull);
+    uint64_t upperSize = variableGroupSizes[position];
+    uint64_t lowerSize = variableGroupSizes[position + 1];
+
+    // The variables of the upper group move below the ones of the lower group. The order within each group is preserved.
+    std::vector<uint32_t> from;
+    std::vector<uint32_t> to;
+    for (uint64_t offset = 0; offset < upperSize; ++offset) {
+        from.push_back(firstIndex + offset);
+        to.push_back(firstIndex + lowerSize + offset);
+    }
+    for (uint64_t offset = 0; offset < lowerSize; ++offset) {
+        from.push_back(firstIndex + upperSize + offset);
+        to.push_back(firstIndex + offset);
+    }
+    mtbdd_permute_protected(from.data(), to.data(), from.size());
+    std::swap(variableGroupSizes[position], variableGroupSizes[position + 1]);
+}
+
+void InternalDdManager<DdType::Sylvan>::siftVariableGroups(uint64_t firstPosition, uint64_t endPosition) {
+    if (endPosition - firstPosition < 2) {
+        return;
+    }
+
+    // Groups are sifted in the order of their positions at the beginning, so we keep track of where each of them currently is.
+    std::vector<uint64_t> currentPositionOfGroup(endPosition - firstPosition);
+    std::iota(currentPositionOfGroup.begin(), currentPositionOfGroup.end(), firstPosition);
+
+    for (uint64_t group = 0; group < currentPositionOfGroup.size(); ++group) {
+        uint64_t position = currentPositionOfGroup[group];
+        uint64_t bestPosition = position;
+        uint64_t bestSize = mtbdd_protected_nodecount();
+        uint64_t startPosition = position;
+
+        auto swapAndTrack = [&](uint64_t swapPosition) {
+            swapVariableGroups(swapPosition);
+            for (auto& otherPosition : currentPositionOfGroup) {
+                if (otherPosition == swapPosition) {
+                    otherPosition = swapPosition + 1;
+                } else if (otherPosition == swapPosition + 1) {
+                    otherPosition = swapPosition;
+                }
+            }
+        };
+
+        // First, move the group downwards.
+        while (position + 1 < endPosition) {
+            swapAndTrack(position);
+            ++position;
+            uint64_t size = mtbdd_protected_nodecount();
+            if (size < bestSize) {
+                bestSize = size;
+                bestPosition = position;
+            } else if (size > reorderingMaximalGrowth * bestSize) {
+                break;
+            }
+        }
+
+        // Then, move it upwards. The sizes until the start position have already been measured.
+        while (position > firstPosition) {
+            swapAndTrack(position - 1);
+            --position;
+            if (position >= startPosition) {
+                continue;
+            }
+            uint64_t size = mtbdd_protected_nodecount();
+            if (size < bestSize) {
+                bestSize = size;
+                bestPosition = position;
+            } else if (size > reorderingMaximalGrowth * bestSize) {
+                break;
+            }
+        }
+
+        // Finally, move it to the best position found.
+        while (position < bestPosition) {
+            swapAndTrack(position);
+            ++position;
+        }
+        while (position > bestPosition) {
+            swapAndTrack(position - 1);
+            --position;
+        }
+    }
 }
 
 void InternalDdManager<DdType::Sylvan>::triggerReordering() {
-    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+    this->execute([this]() {
+        uint64_t nodesBefore = mtbdd_protected_nodecount();
+
+        // Sylvan relies on the variables of a pair to start at an even index (see nextFreeVariableIndex), so only groups of even size may
+        // be moved. Groups of odd size therefore split the order into blocks that are sifted separately.
+        uint64_t blockStart = 0;
+        for (uint64_t position = 0; position <= variableGroupSizes.size(); ++position) {
+            if (position == variableGroupSizes.size() || variableGroupSizes[position] % 2 != 0) {
+                siftVariableGroups(blockStart, position);
+                blockStart = position + 1;
+            }
+        }
+
+        sylvan_gc();
+        size_t filled;
+        size_t total;
+        sylvan_table_usage(&filled, &total);
+        nextReorderingThreshold = std::max<uint64_t>(nextReorderingThreshold, static_cast<uint64_t>(filled * reorderingGrowth));
+        STORM_LOG_INFO("Reordered sylvan variables: " << nodesBefore << " nodes before, " << mtbdd_protected_nodecount() << " nodes after.");
+    });
+}
+
+bool InternalDdManager<DdType::Sylvan>::reorderIfNecessary() {
+    if (!dynamicReorderingAllowed) {
+        return false;
+    }
+    size_t filled = 0;
+    size_t total = 0;
+    this->execute([&filled, &total]() { sylvan_table_usage(&filled, &total); });
+    if (filled < nextReorderingThreshold) {
+        return false;
+    }
+    triggerReordering();
+    return true;
 }
 
 void InternalDdManager<DdType::Sylvan>::debugCheck() const {
@@ -253,6 +507,11 @@ void InternalDdManager<DdType::Sylvan>::debugCheck() const {
 void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f) const {
     // Only wake up the sylvan (i.e. lace) threads when they are suspended.
     std::exception_ptr e = nullptr;  // propagate exception
+    bool measureTime = statistics.enabled && statistics.executionDepth == 0;
+    if (measureTime) {
+        statistics.executionTime.start();
+    }
+    ++statistics.executionDepth;
     if (suspended) {
         lace_resume();
         suspended = false;
@@ -263,6 +522,10 @@ void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f)
         // The sylvan threads are already running, don't suspend afterwards.
         RUN(execute_sylvan, &f, &e);
     }
+    --statistics.executionDepth;
+    if (measureTime) {
+        statistics.executionTime.stop();
+    }
     if (e) {
         std::rethrow_exception(e);
     }
@@ -0,0 +1,83 @@
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace storm {
+namespace expressions {
+
+template<typename RationalType>
+BytecodeExpressionEvaluatorBase<RationalType>::BytecodeExpressionEvaluatorBase(storm::expressions::ExpressionManager const& manager)
+    : ExpressionEvaluatorBase<RationalType>(manager), bytecode(manager) {
+    // Intentionally left empty.
+}
+
+template<typename RationalType>
+bool BytecodeExpressionEvaluatorBase<RationalType>::asBool(Expression const& expression) const {
+    return evaluate(expression) == 1.0;
+}
+
+template<typename RationalType>
+int_fast64_t BytecodeExpressionEvaluatorBase<RationalType>::asInt(Expression const& expression) const {
+    return static_cast<int_fast64_t>(evaluate(expression));
+}
+
+template<typename RationalType>
+void BytecodeExpressionEvaluatorBase<RationalType>::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
+    bytecode.setBooleanValue(variable, value);
+}
+
+template<typename RationalType>
+void BytecodeExpressionEvaluatorBase<RationalType>::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
+    bytecode.setIntegerValue(variable, value);
+}
+
+template<typename RationalType>
+void BytecodeExpressionEvaluatorBase<RationalType>::setRationalValue(storm::expressions::Variable const& variable, double value) {
+    bytecode.setRationalValue(variable, value);
+}
+
+template<typename RationalType>
+uint64_t BytecodeExpressionEvaluatorBase<RationalType>::addBatch(std::vector<Expression> const& expressions) {
+    return bytecode.compileBatch(expressions);
+}
+
+template<typename RationalType>
+storm::storage::BitVector BytecodeExpressionEvaluatorBase<RationalType>::evaluateBatchAsBool(uint64_t batchIndex) const {
+    bytecode.evaluateBatch(batchIndex, batchValues);
+    storm::storage::BitVector result(batchValues.size());
+    for (uint64_t i = 0; i < batchValues.size(); ++i) {
+        if (batchValues[i] == 1.0) {
+            result.set(i);
+        }
+    }
+    return result;
+}
+
+template<typename RationalType>
+void BytecodeExpressionEvaluatorBase<RationalType>::evaluateBatchAsDouble(uint64_t batchIndex, std::vector<double>& values) const {
+    bytecode.evaluateBatch(batchIndex, values);
+}
+
+template<typename RationalType>
+double BytecodeExpressionEvaluatorBase<RationalType>::evaluate(Expression const& expression) const {
+    return bytecode.evaluate(bytecode.compile(expression));
+}
+
+BytecodeExpressionEvaluator::BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager)
+    : BytecodeExpressionEvaluatorBase<double>(manager) {
+    // Intentionally left empty.
+}
+
+double BytecodeExpressionEvaluator::asRational(Expression const& expression) const {
+    return evaluate(expression);
+}
+
+template class BytecodeExpressionEvaluatorBase<double>;
+
+#ifdef STORM_HAVE_CARL
+template class BytecodeExpressionEvaluatorBase<RationalNumber>;
+template class BytecodeExpressionEvaluatorBase<RationalFunction>;
+#endif
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/ExpressionBytecode.h"
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * An evaluator that compiles expressions to a register-based bytecode (see ExpressionBytecode) instead of going through exprtk.
+ * All expressions evaluated by the same evaluator share one bytecode, so common subexpressions are compiled once and evaluated at most once per valuation.
+ */
+template<typename RationalType>
+class BytecodeExpressionEvaluatorBase : public ExpressionEvaluatorBase<RationalType> {
+   public:
+    BytecodeExpressionEvaluatorBase(storm::expressions::ExpressionManager const& manager);
+
+    bool asBool(Expression const& expression) const override;
+    int_fast64_t asInt(Expression const& expression) const override;
+
+    void setBooleanValue(storm::expressions::Variable const& variable, bool value) override;
+    void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
+    void setRationalValue(storm::expressions::Variable const& variable, double value) override;
+
+    /*!
+     * Compiles the given expressions into a batch that is evaluated in a single pass.
+     *
+     * @param expressions The expressions of the batch.
+     * @return The index of the batch.
+     */
+    uint64_t addBatch(std::vector<Expression> const& expressions);
+
+    /*!
+     * Evaluates all (boolean) expressions of the given batch.
+     *
+     * @param batchIndex The index of the batch.
+     * @return The i-th bit is set iff the i-th expression of the batch evaluates to true.
+     */
+    storm::storage::BitVector evaluateBatchAsBool(uint64_t batchIndex) const;
+
+    /*!
+     * Evaluates all expressions of the given batch as doubles.
+     *
+     * @param batchIndex The index of the batch.
+     * @param values The values of the expressions of the batch.
+     */
+    void evaluateBatchAsDouble(uint64_t batchIndex, std::vector<double>& values) const;
+
+   protected:
+    /*!
+     * Evaluates the given expression in the current valuation (compiling it if necessary).
+     */
+    double evaluate(Expression const& expression) const;
+
+    // The bytecode of all expressions evaluated so far.
+    mutable ExpressionBytecode bytecode;
+
+    // Buffer for the values of batches.
+    mutable std::vector<double> batchValues;
+};
+
+class BytecodeExpressionEvaluator : public BytecodeExpressionEvaluatorBase<double> {
+   public:
+    /*!
+     * Creates an expression evaluator that is capable of evaluating expressions managed by the given manager.
+     *
+     * @param manager The manager responsible for the expressions.
+     */
+    BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
+
+    double asRational(Expression const& expression) const override;
+};
+
+}  // namespace expressions
+}  // namespace storm
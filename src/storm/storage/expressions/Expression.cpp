@@ -34,11 +34,12 @@ Expression::~Expression() {
     // Intentionally left empty.
 }
 
-Expression::Expression(std::shared_ptr<BaseExpression const> const& expressionPtr) : expressionPtr(expressionPtr) {
+Expression::Expression(std::shared_ptr<BaseExpression const> const& expressionPtr)
+    : expressionPtr(expressionPtr ? expressionPtr->getManager().getExpressionCache().getUniqueExpression(expressionPtr) : expressionPtr) {
     // Intentionally left empty.
 }
 
-Expression::Expression(Variable const& variable) : expressionPtr(std::shared_ptr<BaseExpression>(new VariableExpression(variable))) {
+Expression::Expression(Variable const& variable) : Expression(std::shared_ptr<BaseExpression const>(new VariableExpression(variable))) {
     // Intentionally left empty.
 }
 
@@ -76,7 +77,7 @@ storm::RationalNumber Expression::evaluateAsRational() const {
 }
 
 Expression Expression::simplify() const {
-    return Expression(this->getBaseExpression().simplify());
+    return Expression(this->getManager().getExpressionCache().getSimplifiedExpression(expressionPtr));
 }
 
 Expression Expression::reduceNesting() const {
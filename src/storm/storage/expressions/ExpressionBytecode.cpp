@@ -0,0 +1,413 @@
+#include "storm/storage/expressions/ExpressionBytecode.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+ExpressionBytecode::ExpressionBytecode(ExpressionManager const& manager)
+    : numberOfBooleanVariables(manager.getNumberOfBooleanVariables()),
+      numberOfIntegerVariables(manager.getNumberOfIntegerVariables()),
+      numberOfRationalVariables(manager.getNumberOfRationalVariables()),
+      currentValuation(1) {
+    uint64_t numberOfVariables = numberOfBooleanVariables + numberOfIntegerVariables + numberOfRationalVariables;
+    registers.resize(numberOfVariables, 0.0);
+    registerToInstruction.resize(numberOfVariables, std::numeric_limits<uint64_t>::max());
+    constantRegisters.resize(numberOfVariables, false);
+}
+
+uint64_t ExpressionBytecode::compile(Expression const& expression) {
+    BaseExpression const* baseExpression = expression.getBaseExpressionPointer().get();
+    auto programIt = expressionToProgram.find(baseExpression);
+    if (programIt != expressionToProgram.end() && !programIt->second.first.expired()) {
+        return programIt->second.second;
+    }
+
+    // Structurally equal subexpressions are shared via the instructions, the expressions themselves are only needed while compiling.
+    expressionToRegister.clear();
+    uint64_t result = compileNode(*baseExpression);
+    expressionToRegister.clear();
+
+    if (programIt != expressionToProgram.end()) {
+        // The previous expression at this address expired, so its program is replaced.
+        programIt->second.first = expression.getBaseExpressionPointer();
+        programs[programIt->second.second] = createProgram({result});
+        return programIt->second.second;
+    }
+    uint64_t programIndex = programs.size();
+    programs.push_back(createProgram({result}));
+    expressionToProgram.emplace(baseExpression, std::make_pair(std::weak_ptr<BaseExpression const>(expression.getBaseExpressionPointer()), programIndex));
+    return programIndex;
+}
+
+uint64_t ExpressionBytecode::compileBatch(std::vector<Expression> const& expressions) {
+    std::vector<uint64_t> results;
+    results.reserve(expressions.size());
+    for (auto const& expression : expressions) {
+        results.push_back(programs[compile(expression)].results.front());
+    }
+    batches.push_back(createProgram(results));
+    return batches.size() - 1;
+}
+
+void ExpressionBytecode::setBooleanValue(Variable const& variable, bool value) {
+    setValue(variable.getOffset(), static_cast<double>(value));
+}
+
+void ExpressionBytecode::setIntegerValue(Variable const& variable, int_fast64_t value) {
+    setValue(numberOfBooleanVariables + variable.getOffset(), static_cast<double>(value));
+}
+
+void ExpressionBytecode::setRationalValue(Variable const& variable, double value) {
+    setValue(numberOfBooleanVariables + numberOfIntegerVariables + variable.getOffset(), value);
+}
+
+double ExpressionBytecode::evaluate(uint64_t expressionIndex) const {
+    Program const& program = programs[expressionIndex];
+    execute(program.instructions);
+    return registers[program.results.front()];
+}
+
+void ExpressionBytecode::evaluateBatch(uint64_t batchIndex, std::vector<double>& values) const {
+    Program const& batch = batches[batchIndex];
+    execute(batch.instructions);
+    values.resize(batch.results.size());
+    for (uint64_t i = 0; i < batch.results.size(); ++i) {
+        values[i] = registers[batch.results[i]];
+    }
+}
+
+uint64_t ExpressionBytecode::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+boost::any ExpressionBytecode::visit(IfThenElseExpression const& expression, boost::any const&) {
+    uint64_t condition = compileNode(*expression.getCondition());
+    if (constantRegisters[condition]) {
+        // Only the chosen branch needs to be compiled.
+        return registers[condition] != 0.0 ? compileNode(*expression.getThenExpression()) : compileNode(*expression.getElseExpression());
+    }
+    return addInstruction(OpCode::IfThenElse, condition, compileNode(*expression.getThenExpression()), compileNode(*expression.getElseExpression()));
+}
+
+boost::any ExpressionBytecode::visit(BinaryBooleanFunctionExpression const& expression, boost::any const&) {
+    uint64_t first = compileNode(*expression.getFirstOperand());
+    uint64_t second = compileNode(*expression.getSecondOperand());
+    switch (expression.getOperatorType()) {
+        case BinaryBooleanFunctionExpression::OperatorType::And:
+            return addInstruction(OpCode::And, first, second);
+        case BinaryBooleanFunctionExpression::OperatorType::Or:
+            return addInstruction(OpCode::Or, first, second);
+        case BinaryBooleanFunctionExpression::OperatorType::Xor:
+            return addInstruction(OpCode::Xor, first, second);
+        case BinaryBooleanFunctionExpression::OperatorType::Implies:
+            return addInstruction(OpCode::Implies, first, second);
+        case BinaryBooleanFunctionExpression::OperatorType::Iff:
+            return addInstruction(OpCode::Equal, first, second);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown boolean operator in expression " << expression << ".");
+}
+
+boost::any ExpressionBytecode::visit(BinaryNumericalFunctionExpression const& expression, boost::any const&) {
+    uint64_t first = compileNode(*expression.getFirstOperand());
+    uint64_t second = compileNode(*expression.getSecondOperand());
+    switch (expression.getOperatorType()) {
+        case BinaryNumericalFunctionExpression::OperatorType::Plus:
+            return addInstruction(OpCode::Plus, first, second);
+        case BinaryNumericalFunctionExpression::OperatorType::Minus:
+            return addInstruction(OpCode::Minus, first, second);
+        case BinaryNumericalFunctionExpression::OperatorType::Times:
+            return addInstruction(OpCode::Times, first, second);
+        case BinaryNumericalFunctionExpression::OperatorType::Divide:
+            return addInstruction(OpCode::Divide, first, second);
+        case BinaryNumericalFunctionExpression::OperatorType::Min:
+            return addInstruction(OpCode::Min, first, second);
+        case BinaryNumericalFunctionExpression::OperatorType::Max:
+            return addInstruction(OpCode::Max, first, second);
+        case BinaryNumericalFunctionExpression::OperatorType::Power:
+            return addInstruction(OpCode::Power, first, second);
+        case BinaryNumericalFunctionExpression::OperatorType::Modulo:
+            return addInstruction(OpCode::Modulo, first, second);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown numerical operator in expression " << expression << ".");
+}
+
+boost::any ExpressionBytecode::visit(BinaryRelationExpression const& expression, boost::any const&) {
+    uint64_t first = compileNode(*expression.getFirstOperand());
+    uint64_t second = compileNode(*expression.getSecondOperand());
+    switch (expression.getRelationType()) {
+        case RelationType::Equal:
+            return addInstruction(OpCode::Equal, first, second);
+        case RelationType::NotEqual:
+            return addInstruction(OpCode::NotEqual, first, second);
+        case RelationType::Less:
+            return addInstruction(OpCode::Less, first, second);
+        case RelationType::LessOrEqual:
+            return addInstruction(OpCode::LessOrEqual, first, second);
+        case RelationType::Greater:
+            return addInstruction(OpCode::Greater, first, second);
+        case RelationType::GreaterOrEqual:
+            return addInstruction(OpCode::GreaterOrEqual, first, second);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown relation in expression " << expression << ".");
+}
+
+boost::any ExpressionBytecode::visit(VariableExpression const& expression, boost::any const&) {
+    Variable const& variable = expression.getVariable();
+    uint64_t offset = variable.getOffset();
+    if (variable.hasBooleanType()) {
+        STORM_LOG_THROW(offset < numberOfBooleanVariables, storm::exceptions::InvalidArgumentException,
+                        "Variable '" << variable.getName() << "' was declared after the creation of the evaluator.");
+        return offset;
+    } else if (variable.hasIntegerType()) {
+        STORM_LOG_THROW(offset < numberOfIntegerVariables, storm::exceptions::InvalidArgumentException,
+                        "Variable '" << variable.getName() << "' was declared after the creation of the evaluator.");
+        return numberOfBooleanVariables + offset;
+    } else if (variable.hasRationalType()) {
+        STORM_LOG_THROW(offset < numberOfRationalVariables, storm::exceptions::InvalidArgumentException,
+                        "Variable '" << variable.getName() << "' was declared after the creation of the evaluator.");
+        return numberOfBooleanVariables + numberOfIntegerVariables + offset;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Variable '" << variable.getName() << "' has unsupported type.");
+}
+
+boost::any ExpressionBytecode::visit(UnaryBooleanFunctionExpression const& expression, boost::any const&) {
+    return addInstruction(OpCode::Not, compileNode(*expression.getOperand()));
+}
+
+boost::any ExpressionBytecode::visit(UnaryNumericalFunctionExpression const& expression, boost::any const&) {
+    uint64_t operand = compileNode(*expression.getOperand());
+    switch (expression.getOperatorType()) {
+        case UnaryNumericalFunctionExpression::OperatorType::Minus:
+            return addInstruction(OpCode::Negate, operand);
+        case UnaryNumericalFunctionExpression::OperatorType::Floor:
+            return addInstruction(OpCode::Floor, operand);
+        case UnaryNumericalFunctionExpression::OperatorType::Ceil:
+            return addInstruction(OpCode::Ceil, operand);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown numerical operator in expression " << expression << ".");
+}
+
+boost::any ExpressionBytecode::visit(BooleanLiteralExpression const& expression, boost::any const&) {
+    return addConstant(expression.getValue() ? 1.0 : 0.0);
+}
+
+boost::any ExpressionBytecode::visit(IntegerLiteralExpression const& expression, boost::any const&) {
+    return addConstant(static_cast<double>(expression.getValue()));
+}
+
+boost::any ExpressionBytecode::visit(RationalLiteralExpression const& expression, boost::any const&) {
+    return addConstant(expression.getValueAsDouble());
+}
+
+boost::any ExpressionBytecode::visit(PredicateExpression const& expression, boost::any const&) {
+    STORM_LOG_THROW(expression.getArity() > 0, storm::exceptions::NotSupportedException, "Predicate expression without operands is not supported.");
+    if (expression.getPredicateType() == PredicateExpression::PredicateType::AtLeastOneOf) {
+        uint64_t result = compileNode(*expression.getOperand(0));
+        for (uint_fast64_t i = 1; i < expression.getArity(); ++i) {
+            result = addInstruction(OpCode::Or, result, compileNode(*expression.getOperand(i)));
+        }
+        return result;
+    }
+
+    // Booleans are represented by 0 and 1, so we can count the operands that are true.
+    uint64_t count = compileNode(*expression.getOperand(0));
+    for (uint_fast64_t i = 1; i < expression.getArity(); ++i) {
+        count = addInstruction(OpCode::Plus, count, compileNode(*expression.getOperand(i)));
+    }
+    if (expression.getPredicateType() == PredicateExpression::PredicateType::AtMostOneOf) {
+        return addInstruction(OpCode::LessOrEqual, count, addConstant(1.0));
+    }
+    return addInstruction(OpCode::Equal, count, addConstant(1.0));
+}
+
+uint64_t ExpressionBytecode::compileNode(BaseExpression const& expression) {
+    auto registerIt = expressionToRegister.find(&expression);
+    if (registerIt != expressionToRegister.end()) {
+        return registerIt->second;
+    }
+    uint64_t result = boost::any_cast<uint64_t>(expression.accept(*this, boost::none));
+    expressionToRegister.emplace(&expression, result);
+    return result;
+}
+
+uint64_t ExpressionBytecode::addConstant(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    auto registerIt = constantToRegister.find(bits);
+    if (registerIt != constantToRegister.end()) {
+        return registerIt->second;
+    }
+    uint64_t reg = registers.size();
+    registers.push_back(value);
+    registerToInstruction.push_back(std::numeric_limits<uint64_t>::max());
+    constantRegisters.push_back(true);
+    constantToRegister.emplace(bits, reg);
+    return reg;
+}
+
+uint64_t ExpressionBytecode::addInstruction(OpCode opCode, uint64_t firstOperand, uint64_t secondOperand, uint64_t thirdOperand) {
+    // Fold instructions whose operands are all constant.
+    if (constantRegisters[firstOperand] && constantRegisters[secondOperand] && constantRegisters[thirdOperand]) {
+        return addConstant(apply(opCode, registers[firstOperand], registers[secondOperand], registers[thirdOperand]));
+    }
+
+    auto key = std::make_tuple(opCode, firstOperand, secondOperand, thirdOperand);
+    auto registerIt = instructionToRegister.find(key);
+    if (registerIt != instructionToRegister.end()) {
+        return registerIt->second;
+    }
+    uint64_t reg = registers.size();
+    registers.push_back(0.0);
+    registerToInstruction.push_back(instructions.size());
+    constantRegisters.push_back(false);
+    instructions.push_back({opCode, reg, {firstOperand, secondOperand, thirdOperand}});
+    instructionValuations.push_back(0);
+    instructionToRegister.emplace(key, reg);
+    return reg;
+}
+
+uint64_t ExpressionBytecode::addInstruction(OpCode opCode, uint64_t firstOperand, uint64_t secondOperand) {
+    // Unused operands refer to the first operand such that they can be read safely.
+    return addInstruction(opCode, firstOperand, secondOperand, firstOperand);
+}
+
+uint64_t ExpressionBytecode::addInstruction(OpCode opCode, uint64_t operand) {
+    return addInstruction(opCode, operand, operand, operand);
+}
+
+ExpressionBytecode::Program ExpressionBytecode::createProgram(std::vector<uint64_t> const& results) const {
+    Program program;
+    program.results = results;
+
+    // Collect all instructions the results depend on.
+    storm::storage::BitVector visited(instructions.size());
+    std::vector<uint64_t> stack;
+    for (uint64_t result : results) {
+        if (registerToInstruction[result] != std::numeric_limits<uint64_t>::max() && !visited.get(registerToInstruction[result])) {
+            visited.set(registerToInstruction[result]);
+            stack.push_back(registerToInstruction[result]);
+        }
+    }
+    while (!stack.empty()) {
+        uint64_t instructionIndex = stack.back();
+        stack.pop_back();
+        Instruction const& instruction = instructions[instructionIndex];
+        for (uint64_t i = 0; i < getNumberOfOperands(instruction.opCode); ++i) {
+            uint64_t operandInstruction = registerToInstruction[instruction.operands[i]];
+            if (operandInstruction != std::numeric_limits<uint64_t>::max() && !visited.get(operandInstruction)) {
+                visited.set(operandInstruction);
+                stack.push_back(operandInstruction);
+            }
+        }
+    }
+
+    // Since instructions only refer to registers of earlier instructions, the order of the indices is a topological order.
+    program.instructions.reserve(visited.getNumberOfSetBits());
+    for (uint64_t instructionIndex : visited) {
+        program.instructions.push_back(instructionIndex);
+    }
+    return program;
+}
+
+void ExpressionBytecode::execute(std::vector<uint64_t> const& instructionIndices) const {
+    for (uint64_t instructionIndex : instructionIndices) {
+        if (instructionValuations[instructionIndex] == currentValuation) {
+            continue;
+        }
+        Instruction const& instruction = instructions[instructionIndex];
+        registers[instruction.target] =
+            apply(instruction.opCode, registers[instruction.operands[0]], registers[instruction.operands[1]], registers[instruction.operands[2]]);
+        instructionValuations[instructionIndex] = currentValuation;
+    }
+}
+
+void ExpressionBytecode::setValue(uint64_t reg, double value) {
+    if (registers[reg] != value) {
+        registers[reg] = value;
+        ++currentValuation;
+    }
+}
+
+uint64_t ExpressionBytecode::getNumberOfOperands(OpCode opCode) {
+    switch (opCode) {
+        case OpCode::Not:
+        case OpCode::Negate:
+        case OpCode::Floor:
+        case OpCode::Ceil:
+            return 1;
+        case OpCode::IfThenElse:
+            return 3;
+        default:
+            return 2;
+    }
+}
+
+double ExpressionBytecode::apply(OpCode opCode, double first, double second, double third) {
+    // The semantics follow the one of the translation to exprtk.
+    switch (opCode) {
+        case OpCode::Not:
+            return first == 0.0 ? 1.0 : 0.0;
+        case OpCode::Negate:
+            return -first;
+        case OpCode::Floor:
+            return std::floor(first);
+        case OpCode::Ceil:
+            return std::ceil(first);
+        case OpCode::And:
+            return (first != 0.0 && second != 0.0) ? 1.0 : 0.0;
+        case OpCode::Or:
+            return (first != 0.0 || second != 0.0) ? 1.0 : 0.0;
+        case OpCode::Xor:
+            return ((first == 0.0) != (second == 0.0)) ? 1.0 : 0.0;
+        case OpCode::Implies:
+            return (first == 0.0 || second != 0.0) ? 1.0 : 0.0;
+        case OpCode::Plus:
+            return first + second;
+        case OpCode::Minus:
+            return first - second;
+        case OpCode::Times:
+            return first * second;
+        case OpCode::Divide:
+            return first / second;
+        case OpCode::Min:
+            return std::min(first, second);
+        case OpCode::Max:
+            return std::max(first, second);
+        case OpCode::Power:
+            return std::pow(first, second);
+        case OpCode::Modulo:
+            return std::fmod(first, second);
+        case OpCode::Equal:
+            return first == second ? 1.0 : 0.0;
+        case OpCode::NotEqual:
+            return first != second ? 1.0 : 0.0;
+        case OpCode::Less:
+            return first < second ? 1.0 : 0.0;
+        case OpCode::LessOrEqual:
+            return first <= second ? 1.0 : 0.0;
+        case OpCode::Greater:
+            return first > second ? 1.0 : 0.0;
+        case OpCode::GreaterOrEqual:
+            return first >= second ? 1.0 : 0.0;
+        case OpCode::IfThenElse:
+            return first != 0.0 ? second : third;
+    }
+    STORM_LOG_ASSERT(false, "Unknown operation.");
+    return 0.0;
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+namespace storm {
+namespace expressions {
+
+class BaseExpression;
+class Expression;
+class ExpressionManager;
+class Variable;
+
+/*!
+ * A register-based bytecode for the expressions of an expression manager.
+ * Like in the exprtk-based evaluation, all values are represented as doubles, i.e., booleans are represented by 0 and 1.
+ *
+ * The first registers hold the values of the boolean, integer and rational variables. They are followed by the constants and the results of the
+ * instructions, where each instruction writes its own register. Hence, the instructions are stored in topological order.
+ * Structurally equal subexpressions are compiled to the same instruction, even if they belong to different expressions, and subexpressions whose
+ * operands are constant are folded during compilation.
+ * For each valuation of the variables, every instruction is executed at most once. Common subexpressions of all compiled expressions (e.g. all guards
+ * and updates of a program) are thus only evaluated once per state.
+ */
+class ExpressionBytecode : private ExpressionVisitor {
+   public:
+    enum class OpCode : uint8_t {
+        Not,
+        Negate,
+        Floor,
+        Ceil,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Min,
+        Max,
+        Power,
+        Modulo,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        IfThenElse
+    };
+
+    /*!
+     * Creates an empty bytecode for the variables of the given manager. Variables that are added to the manager afterwards are not supported.
+     *
+     * @param manager The manager responsible for the expressions.
+     */
+    ExpressionBytecode(ExpressionManager const& manager);
+
+    /*!
+     * Compiles the given expression (if it was not compiled before).
+     *
+     * @param expression The expression to compile.
+     * @return The index of the compiled expression.
+     */
+    uint64_t compile(Expression const& expression);
+
+    /*!
+     * Compiles the given expressions into a batch, i.e., all instructions needed by one of the expressions are merged such that the batch can be
+     * evaluated in a single pass.
+     *
+     * @param expressions The expressions to compile.
+     * @return The index of the batch.
+     */
+    uint64_t compileBatch(std::vector<Expression> const& expressions);
+
+    void setBooleanValue(Variable const& variable, bool value);
+    void setIntegerValue(Variable const& variable, int_fast64_t value);
+    void setRationalValue(Variable const& variable, double value);
+
+    /*!
+     * Evaluates the compiled expression with the given index in the current valuation.
+     */
+    double evaluate(uint64_t expressionIndex) const;
+
+    /*!
+     * Evaluates the batch with the given index in the current valuation.
+     *
+     * @param batchIndex The index of the batch.
+     * @param values The values of the expressions of the batch (in the order in which they were given).
+     */
+    void evaluateBatch(uint64_t batchIndex, std::vector<double>& values) const;
+
+    /*!
+     * Retrieves the number of instructions of all compiled expressions.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+   private:
+    struct Instruction {
+        OpCode opCode;
+        uint64_t target;
+        uint64_t operands[3];
+    };
+
+    struct Program {
+        // The (sorted) indices of the instructions needed to evaluate the program.
+        std::vector<uint64_t> instructions;
+
+        // The registers holding the results.
+        std::vector<uint64_t> results;
+    };
+
+    virtual boost::any visit(IfThenElseExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryRelationExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(VariableExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BooleanLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(IntegerLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(RationalLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(PredicateExpression const& expression, boost::any const& data) override;
+
+    /*!
+     * Compiles the given (sub)expression and returns the register holding its value.
+     */
+    uint64_t compileNode(BaseExpression const& expression);
+
+    /*!
+     * Retrieves the register of the given constant (and adds it if necessary).
+     */
+    uint64_t addConstant(double value);
+
+    /*!
+     * Retrieves the register of the instruction with the given operation and operands (and adds it if necessary).
+     */
+    uint64_t addInstruction(OpCode opCode, uint64_t firstOperand, uint64_t secondOperand, uint64_t thirdOperand);
+    uint64_t addInstruction(OpCode opCode, uint64_t firstOperand, uint64_t secondOperand);
+    uint64_t addInstruction(OpCode opCode, uint64_t operand);
+
+    /*!
+     * Creates a program computing the values of the given registers.
+     */
+    Program createProgram(std::vector<uint64_t> const& results) const;
+
+    /*!
+     * Executes the given instructions unless they were already executed in the current valuation.
+     */
+    void execute(std::vector<uint64_t> const& instructionIndices) const;
+
+    void setValue(uint64_t reg, double value);
+
+    static uint64_t getNumberOfOperands(OpCode opCode);
+    static double apply(OpCode opCode, double first, double second, double third);
+
+    // Number of variables of each type, which determine the registers of the variables.
+    uint64_t numberOfBooleanVariables;
+    uint64_t numberOfIntegerVariables;
+    uint64_t numberOfRationalVariables;
+
+    // The registers holding variables, constants and intermediate results.
+    mutable std::vector<double> registers;
+
+    // The instruction writing the register (or an invalid index for variables and constants).
+    std::vector<uint64_t> registerToInstruction;
+
+    // Whether the register holds a constant.
+    std::vector<bool> constantRegisters;
+
+    std::vector<Instruction> instructions;
+
+    // The valuation in which the instruction was last executed.
+    mutable std::vector<uint64_t> instructionValuations;
+
+    // Incremented whenever the value of a variable changes.
+    uint64_t currentValuation;
+
+    // Lookup tables for constants (by their bit pattern) and instructions.
+    std::unordered_map<uint64_t, uint64_t> constantToRegister;
+    std::map<std::tuple<OpCode, uint64_t, uint64_t, uint64_t>, uint64_t> instructionToRegister;
+
+    // The registers of the subexpressions of the expression that is currently compiled.
+    std::unordered_map<BaseExpression const*, uint64_t> expressionToRegister;
+
+    // The programs of the compiled expressions. The expressions are not kept alive (which would leak temporary expressions), so their addresses
+    // can be reused once they expire.
+    std::unordered_map<BaseExpression const*, std::pair<std::weak_ptr<BaseExpression const>, uint64_t>> expressionToProgram;
+    std::vector<Program> programs;
+
+    std::vector<Program> batches;
+};
+
+}  // namespace expressions
+}  // namespace storm
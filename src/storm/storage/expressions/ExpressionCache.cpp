@@ -0,0 +1,163 @@
+#include "storm/storage/expressions/ExpressionCache.h"
+
+#include <algorithm>
+#include <functional>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/storage/expressions/Expressions.h"
+
+namespace storm {
+namespace expressions {
+
+namespace detail {
+// The kinds of expressions that are not function applications.
+enum class LeafKind : uint8_t { Boolean, Integer, Rational, Variable };
+
+// The minimal number of entries before expired entries are removed.
+uint64_t const minimalRemovalThreshold = 1024;
+}  // namespace detail
+
+ExpressionCache::ExpressionCache() : removalThreshold(detail::minimalRemovalThreshold) {
+    // Intentionally left empty.
+}
+
+ExpressionCache::ExpressionCache(ExpressionCache const&) : ExpressionCache() {
+    // Intentionally left empty.
+}
+
+ExpressionCache& ExpressionCache::operator=(ExpressionCache const&) {
+    std::lock_guard<std::mutex> lock(mutex);
+    uniqueExpressions.clear();
+    simplifiedExpressions.clear();
+    removalThreshold = detail::minimalRemovalThreshold;
+    return *this;
+}
+
+std::shared_ptr<BaseExpression const> ExpressionCache::getUniqueExpression(std::shared_ptr<BaseExpression const> const& expression) {
+    if (!isShared(*expression)) {
+        return expression;
+    }
+    std::size_t hash = hashNode(*expression);
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = uniqueExpressions.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        std::shared_ptr<BaseExpression const> representative = it->second.lock();
+        if (representative && (representative == expression || equalNodes(*representative, *expression))) {
+            return representative;
+        }
+    }
+    uniqueExpressions.emplace(hash, expression);
+    removeExpiredEntriesIfNecessary();
+    return expression;
+}
+
+std::shared_ptr<BaseExpression const> ExpressionCache::getSimplifiedExpression(std::shared_ptr<BaseExpression const> const& expression) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = simplifiedExpressions.find(expression.get());
+        if (it != simplifiedExpressions.end() && it->second.first.lock() == expression) {
+            if (std::shared_ptr<BaseExpression const> result = it->second.second.lock()) {
+                return result;
+            }
+        }
+    }
+
+    // The simplification creates new expressions, so the lock must not be held.
+    std::shared_ptr<BaseExpression const> result = getUniqueExpression(expression->simplify());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    simplifiedExpressions[expression.get()] = std::make_pair(std::weak_ptr<BaseExpression const>(expression), std::weak_ptr<BaseExpression const>(result));
+    // Simplifying the result does not change it any further.
+    if (result != expression) {
+        simplifiedExpressions[result.get()] = std::make_pair(std::weak_ptr<BaseExpression const>(result), std::weak_ptr<BaseExpression const>(result));
+    }
+    removeExpiredEntriesIfNecessary();
+    return result;
+}
+
+uint64_t ExpressionCache::getNumberOfExpressions() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return uniqueExpressions.size();
+}
+
+bool ExpressionCache::isShared(BaseExpression const& expression) {
+    return expression.isIfThenElseExpression() || expression.isBinaryBooleanFunctionExpression() || expression.isBinaryNumericalFunctionExpression() ||
+           expression.isBinaryRelationExpression() || expression.isUnaryBooleanFunctionExpression() || expression.isUnaryNumericalFunctionExpression() ||
+           expression.isPredicateExpression() || expression.isBooleanLiteralExpression() || expression.isIntegerLiteralExpression() ||
+           expression.isRationalLiteralExpression() || expression.isVariableExpression();
+}
+
+std::size_t ExpressionCache::hashNode(BaseExpression const& expression) {
+    std::size_t seed = std::hash<uint64_t>()(expression.getType().getMask());
+    if (expression.isFunctionApplication()) {
+        boost::hash_combine(seed, static_cast<int>(expression.getOperator()));
+        for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            boost::hash_combine(seed, expression.getOperand(operandIndex).get());
+        }
+    } else if (expression.isBooleanLiteralExpression()) {
+        boost::hash_combine(seed, static_cast<int>(detail::LeafKind::Boolean));
+        boost::hash_combine(seed, expression.asBooleanLiteralExpression().getValue());
+    } else if (expression.isIntegerLiteralExpression()) {
+        boost::hash_combine(seed, static_cast<int>(detail::LeafKind::Integer));
+        boost::hash_combine(seed, expression.asIntegerLiteralExpression().getValue());
+    } else if (expression.isRationalLiteralExpression()) {
+        boost::hash_combine(seed, static_cast<int>(detail::LeafKind::Rational));
+        boost::hash_combine(seed, expression.asRationalLiteralExpression().getValueAsDouble());
+    } else if (expression.isVariableExpression()) {
+        boost::hash_combine(seed, static_cast<int>(detail::LeafKind::Variable));
+        boost::hash_combine(seed, expression.asVariableExpression().getVariable().getIndex());
+    }
+    return seed;
+}
+
+bool ExpressionCache::equalNodes(BaseExpression const& first, BaseExpression const& second) {
+    if (!(first.getType() == second.getType())) {
+        return false;
+    }
+    if (first.isFunctionApplication()) {
+        if (!second.isFunctionApplication() || first.getOperator() != second.getOperator() || first.getArity() != second.getArity()) {
+            return false;
+        }
+        for (uint_fast64_t operandIndex = 0; operandIndex < first.getArity(); ++operandIndex) {
+            if (first.getOperand(operandIndex) != second.getOperand(operandIndex)) {
+                return false;
+            }
+        }
+        return true;
+    } else if (first.isBooleanLiteralExpression()) {
+        return second.isBooleanLiteralExpression() && first.asBooleanLiteralExpression().getValue() == second.asBooleanLiteralExpression().getValue();
+    } else if (first.isIntegerLiteralExpression()) {
+        return second.isIntegerLiteralExpression() && first.asIntegerLiteralExpression().getValue() == second.asIntegerLiteralExpression().getValue();
+    } else if (first.isRationalLiteralExpression()) {
+        return second.isRationalLiteralExpression() && first.asRationalLiteralExpression().getValue() == second.asRationalLiteralExpression().getValue();
+    } else if (first.isVariableExpression()) {
+        return second.isVariableExpression() && first.asVariableExpression().getVariable() == second.asVariableExpression().getVariable();
+    }
+    return false;
+}
+
+void ExpressionCache::removeExpiredEntriesIfNecessary() {
+    if (uniqueExpressions.size() + simplifiedExpressions.size() < removalThreshold) {
+        return;
+    }
+    for (auto it = uniqueExpressions.begin(); it != uniqueExpressions.end();) {
+        if (it->second.expired()) {
+            it = uniqueExpressions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = simplifiedExpressions.begin(); it != simplifiedExpressions.end();) {
+        if (it->second.first.expired() || it->second.second.expired()) {
+            it = simplifiedExpressions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // Removing the entries takes linear time, so it is only done after the number of live entries has doubled.
+    removalThreshold = std::max(detail::minimalRemovalThreshold, 2 * (uniqueExpressions.size() + simplifiedExpressions.size()));
+}
+
+}  // namespace expressions
+}  // namespace storm
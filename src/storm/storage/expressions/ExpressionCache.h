@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace storm {
+namespace expressions {
+
+class BaseExpression;
+
+/*!
+ * A cache of the expressions of an expression manager.
+ *
+ * The expressions are hash-consed: whenever an expression is created, the cache is queried for an existing expression with the same operator,
+ * type and (identical) operands, which is then used instead. Hence, structurally equal expressions that were built from the same subexpressions
+ * share their nodes. Moreover, the results of simplifications are memoized.
+ * The cache only holds weak references, i.e., it does not keep any expression alive.
+ */
+class ExpressionCache {
+   public:
+    ExpressionCache();
+
+    /*!
+     * Copying a cache yields an empty cache, since the expressions of the copied cache belong to a different manager.
+     */
+    ExpressionCache(ExpressionCache const& other);
+    ExpressionCache& operator=(ExpressionCache const& other);
+
+    /*!
+     * Retrieves the unique representative of the given expression. The operands of the expression are taken as they are, i.e., they are not
+     * replaced by their representatives.
+     *
+     * @param expression The expression.
+     * @return The representative, which is the given expression itself if no equal expression was known before.
+     */
+    std::shared_ptr<BaseExpression const> getUniqueExpression(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the (unique representative of the) simplification of the given expression.
+     *
+     * @param expression The expression.
+     * @return The simplified expression.
+     */
+    std::shared_ptr<BaseExpression const> getSimplifiedExpression(std::shared_ptr<BaseExpression const> const& expression);
+
+    /*!
+     * Retrieves the number of expressions in the cache (including the ones that have expired but were not yet removed).
+     */
+    uint64_t getNumberOfExpressions() const;
+
+   private:
+    /*!
+     * Checks whether the given expression is of a kind that is shared. Other kinds of expressions (e.g. the array expressions of JANI) are
+     * never replaced by their representatives.
+     */
+    static bool isShared(BaseExpression const& expression);
+
+    /*!
+     * Computes a hash value of the given expression that only depends on its operator, type and the addresses of its operands.
+     */
+    static std::size_t hashNode(BaseExpression const& expression);
+
+    /*!
+     * Checks whether the two expressions have the same operator and type and identical operands.
+     */
+    static bool equalNodes(BaseExpression const& first, BaseExpression const& second);
+
+    /*!
+     * Removes the entries of expressions that no longer exist if the cache has grown sufficiently since the last removal.
+     */
+    void removeExpiredEntriesIfNecessary();
+
+    mutable std::mutex mutex;
+
+    // The representatives of the expressions by their hash value.
+    std::unordered_multimap<std::size_t, std::weak_ptr<BaseExpression const>> uniqueExpressions;
+
+    // The simplified expressions by the original expressions (which are stored to detect reused addresses).
+    std::unordered_map<BaseExpression const*, std::pair<std::weak_ptr<BaseExpression const>, std::weak_ptr<BaseExpression const>>> simplifiedExpressions;
+
+    // The number of entries that triggers the next removal of expired entries.
+    uint64_t removalThreshold;
+};
+
+}  // namespace expressions
+}  // namespace storm
@@ -5,7 +5,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/expressions/Expression.h"
-#include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
 #include "storm/storage/expressions/ToRationalFunctionVisitor.h"
 #include "storm/storage/expressions/ToRationalNumberVisitor.h"
 #include "storm/storage/expressions/Variable.h"
@@ -16,13 +16,13 @@ template<typename RationalType>
 class ExpressionEvaluator;
 
 template<>
-class ExpressionEvaluator<double> : public ExprtkExpressionEvaluator {
+class ExpressionEvaluator<double> : public BytecodeExpressionEvaluator {
    public:
     ExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
 };
 
 template<typename RationalType>
-class ExpressionEvaluatorWithVariableToExpressionMap : public ExprtkExpressionEvaluatorBase<RationalType> {
+class ExpressionEvaluatorWithVariableToExpressionMap : public BytecodeExpressionEvaluatorBase<RationalType> {
    public:
     ExpressionEvaluatorWithVariableToExpressionMap(storm::expressions::ExpressionManager const& manager);
 
@@ -37,7 +37,7 @@ class ExpressionEvaluatorWithVariableToExpressionMap : public ExprtkExpressionEv
 
 #ifdef STORM_HAVE_CARL
 template<>
-class ExpressionEvaluator<RationalNumber> : public ExprtkExpressionEvaluatorBase<RationalNumber> {
+class ExpressionEvaluator<RationalNumber> : public BytecodeExpressionEvaluatorBase<RationalNumber> {
    public:
     ExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
 
@@ -57,7 +57,7 @@ class ExpressionEvaluator<RationalNumber> : public ExprtkExpressionEvaluatorBase
 };
 
 template<>
-class ExpressionEvaluator<RationalFunction> : public ExprtkExpressionEvaluatorBase<RationalFunction> {
+class ExpressionEvaluator<RationalFunction> : public BytecodeExpressionEvaluatorBase<RationalFunction> {
    public:
     ExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
 
@@ -81,6 +81,10 @@ std::shared_ptr<ExpressionManager> ExpressionManager::clone() const {
     return std::shared_ptr<ExpressionManager>(new ExpressionManager(*this));
 }
 
+ExpressionCache& ExpressionManager::getExpressionCache() const {
+    return expressionCache;
+}
+
 Expression ExpressionManager::boolean(bool value) const {
     return Expression(std::make_shared<BooleanLiteralExpression>(*this, value));
 }
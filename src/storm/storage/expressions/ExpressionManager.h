@@ -12,6 +12,7 @@
 
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionCache.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/utility/OsDetection.h"
 
@@ -123,6 +124,11 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
      */
     Expression rational(storm::RationalNumber const& value) const;
 
+    /*!
+     * Retrieves the cache used to share the nodes of structurally equal expressions of this manager.
+     */
+    ExpressionCache& getExpressionCache() const;
+
     /*!
      * Compares the two expression managers for equality, which holds iff they are the very same object.
      */
@@ -487,6 +493,9 @@ class ExpressionManager : public std::enable_shared_from_this<ExpressionManager>
     mutable boost::optional<Type> rationalType;
     mutable std::unordered_set<Type> arrayTypes;
 
+    // The cache of the expressions of this manager.
+    mutable ExpressionCache expressionCache;
+
     // A mask that can be used to query whether a variable is an auxiliary variable.
     static const uint64_t auxiliaryMask = (1ull << 50);
 
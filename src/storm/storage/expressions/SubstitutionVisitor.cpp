@@ -2,6 +2,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expressions.h"
 #include "storm/storage/expressions/SubstitutionVisitor.h"
 
@@ -17,69 +18,72 @@ Expression SubstitutionVisitor<MapType>::substitute(Expression const& expression
     return Expression(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getBaseExpression().accept(*this, boost::none)));
 }
 
+template<typename MapType>
+std::shared_ptr<BaseExpression const> SubstitutionVisitor<MapType>::substituteOperand(std::shared_ptr<BaseExpression const> const& operand,
+                                                                                     boost::any const& data) {
+    auto it = substitutedOperands.find(operand.get());
+    if (it != substitutedOperands.end()) {
+        return it->second.second;
+    }
+    std::shared_ptr<BaseExpression const> result = boost::any_cast<std::shared_ptr<BaseExpression const>>(operand->accept(*this, data));
+    substitutedOperands.emplace(operand.get(), std::make_pair(operand, result));
+    return result;
+}
+
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(IfThenElseExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> conditionExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getCondition()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> thenExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getThenExpression()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> elseExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getElseExpression()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> conditionExpression = substituteOperand(expression.getCondition(), data);
+    std::shared_ptr<BaseExpression const> thenExpression = substituteOperand(expression.getThenExpression(), data);
+    std::shared_ptr<BaseExpression const> elseExpression = substituteOperand(expression.getElseExpression(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (conditionExpression.get() == expression.getCondition().get() && thenExpression.get() == expression.getThenExpression().get() &&
         elseExpression.get() == expression.getElseExpression().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
+        return expression.getManager().getExpressionCache().getUniqueExpression(std::shared_ptr<BaseExpression const>(
             new IfThenElseExpression(expression.getManager(), expression.getType(), conditionExpression, thenExpression, elseExpression)));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(new BinaryBooleanFunctionExpression(
+        return expression.getManager().getExpressionCache().getUniqueExpression(std::shared_ptr<BaseExpression const>(new BinaryBooleanFunctionExpression(
             expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getOperatorType())));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(new BinaryNumericalFunctionExpression(
+        return expression.getManager().getExpressionCache().getUniqueExpression(std::shared_ptr<BaseExpression const>(new BinaryNumericalFunctionExpression(
             expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getOperatorType())));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryRelationExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
+        return expression.getManager().getExpressionCache().getUniqueExpression(std::shared_ptr<BaseExpression const>(
             new BinaryRelationExpression(expression.getManager(), expression.getType(), firstExpression, secondExpression, expression.getRelationType())));
     }
 }
@@ -97,28 +101,26 @@ boost::any SubstitutionVisitor<MapType>::visit(VariableExpression const& express
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
+        return expression.getManager().getExpressionCache().getUniqueExpression(std::shared_ptr<BaseExpression const>(
             new UnaryBooleanFunctionExpression(expression.getManager(), expression.getType(), operandExpression, expression.getOperatorType())));
     }
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
+        return expression.getManager().getExpressionCache().getUniqueExpression(std::shared_ptr<BaseExpression const>(
             new UnaryNumericalFunctionExpression(expression.getManager(), expression.getType(), operandExpression, expression.getOperatorType())));
     }
 }
@@ -128,7 +130,7 @@ boost::any SubstitutionVisitor<MapType>::visit(PredicateExpression const& expres
     bool changed = false;
     std::vector<std::shared_ptr<BaseExpression const>> newExpressions;
     for (uint64_t i = 0; i < expression.getArity(); ++i) {
-        newExpressions.push_back(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand(i)->accept(*this, data)));
+        newExpressions.push_back(substituteOperand(expression.getOperand(i), data));
         if (!changed && newExpressions.back() != expression.getOperand(i)) {
             changed = true;
         }
@@ -138,7 +140,7 @@ boost::any SubstitutionVisitor<MapType>::visit(PredicateExpression const& expres
     if (!changed) {
         return expression.getSharedPointer();
     } else {
-        return std::const_pointer_cast<BaseExpression const>(std::shared_ptr<BaseExpression>(
+        return expression.getManager().getExpressionCache().getUniqueExpression(std::shared_ptr<BaseExpression const>(
             new PredicateExpression(expression.getManager(), expression.getType(), newExpressions, expression.getPredicateType())));
     }
 }
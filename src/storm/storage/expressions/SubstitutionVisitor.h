@@ -1,7 +1,9 @@
 #ifndef STORM_STORAGE_EXPRESSIONS_SUBSTITUTIONVISITOR_H_
 #define STORM_STORAGE_EXPRESSIONS_SUBSTITUTIONVISITOR_H_
 
+#include <memory>
 #include <stack>
+#include <unordered_map>
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionVisitor.h"
@@ -41,8 +43,19 @@ class SubstitutionVisitor : public ExpressionVisitor {
     virtual boost::any visit(PredicateExpression const& expression, boost::any const& data) override;
 
    protected:
+    /*!
+     * Substitutes the identifiers in the given operand. Operands that are shared by several expressions (or that occur in several
+     * expressions substituted by this visitor) are only substituted once.
+     */
+    std::shared_ptr<BaseExpression const> substituteOperand(std::shared_ptr<BaseExpression const> const& operand, boost::any const& data);
+
     // A mapping of variables to expressions with which they shall be replaced.
     MapType const& variableToExpressionMapping;
+
+    // The results of the substitution for all operands that were substituted so far. The operands are kept alive so that their addresses
+    // remain unique.
+    std::unordered_map<BaseExpression const*, std::pair<std::shared_ptr<BaseExpression const>, std::shared_ptr<BaseExpression const>>>
+        substitutedOperands;
 };
 }  // namespace expressions
 }  // namespace storm
@@ -156,6 +156,9 @@ struct ConditionalMetaEdge {
     std::shared_ptr<TemplateEdge> templateEdge;
 };
 
+// For each automaton, the edges labeled with the respective action index.
+typedef std::vector<std::unordered_map<uint64_t, std::vector<std::reference_wrapper<Edge const>>>> EdgesByAction;
+
 storm::expressions::Expression createSynchronizedGuard(std::vector<std::reference_wrapper<Edge const>> const& chosenEdges) {
     STORM_LOG_ASSERT(!chosenEdges.empty(), "Expected non-empty set of edges.");
     auto it = chosenEdges.begin();
@@ -230,19 +233,20 @@ ConditionalMetaEdge createSynchronizedMetaEdge(Automaton& automaton, std::vector
 std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldModel, Model& newModel, Automaton& newAutomaton,
                                                               std::vector<std::set<uint64_t>>& synchronizingActionIndices, SynchronizationVector const& vector,
                                                               std::vector<std::reference_wrapper<Automaton const>> const& composedAutomata,
+                                                              EdgesByAction const& edgesByAction,
                                                               storm::solver::SmtSolver& solver) {
     std::vector<ConditionalMetaEdge> result;
 
     // Gather all participating automata and the corresponding input symbols.
     std::vector<uint64_t> components;
-    std::vector<std::pair<std::reference_wrapper<Automaton const>, uint64_t>> participatingAutomataAndActions;
+    std::vector<std::pair<uint64_t, uint64_t>> participatingAutomataAndActions;
     for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
         std::string const& actionName = vector.getInput(i);
         if (!SynchronizationVector::isNoActionInput(actionName)) {
             components.push_back(i);
             uint64_t actionIndex = oldModel.getActionIndex(actionName);
             // store that automaton occurs in the sync vector.
-            participatingAutomataAndActions.push_back(std::make_pair(composedAutomata[i], actionIndex));
+            participatingAutomataAndActions.push_back(std::make_pair(i, actionIndex));
             // Store for later that this action is one of the possible actions that synchronise
             synchronizingActionIndices[i].insert(actionIndex);
         }
@@ -264,18 +268,13 @@ std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldMo
     std::vector<std::vector<std::reference_wrapper<storm::jani::Edge const>>> possibleEdges;
 
     for (auto const& automatonActionPair : participatingAutomataAndActions) {
-        possibleEdges.emplace_back();
-        for (auto const& edge : automatonActionPair.first.get().getEdges()) {
-            if (edge.getActionIndex() == automatonActionPair.second) {
-                possibleEdges.back().push_back(edge);
-            }
-        }
-
-        // If there were no edges with the participating action index, then there is no synchronization possible.
-        if (possibleEdges.back().empty()) {
+        // If there are no edges with the participating action index, then there is no synchronization possible.
+        auto edgesIt = edgesByAction[automatonActionPair.first].find(automatonActionPair.second);
+        if (edgesIt == edgesByAction[automatonActionPair.first].end()) {
             noCombinations = true;
             break;
         }
+        possibleEdges.push_back(edgesIt->second);
     }
 
     // If there are no valid combinations for the action, we need to skip the generation of synchronizing edges.
@@ -396,45 +395,67 @@ void addEdgesToReachableLocations(std::vector<std::reference_wrapper<Automaton c
         createCombinedLocation(composedAutomata, newAutomaton, location, true);
     }
 
+    // Index the meta edges by the source location of their first participating component such that only the meta edges whose first component
+    // is in the right location need to be considered for each location combination.
+    std::vector<std::vector<std::vector<uint64_t>>> metaEdgesBySourceLocation(composedAutomata.size());
+    for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
+        metaEdgesBySourceLocation[i].resize(composedAutomata[i].get().getNumberOfLocations());
+    }
+    for (uint64_t metaEdgeIndex = 0; metaEdgeIndex < conditionalMetaEdges.size(); ++metaEdgeIndex) {
+        auto const& metaEdge = conditionalMetaEdges[metaEdgeIndex];
+        metaEdgesBySourceLocation[metaEdge.components.front()][metaEdge.condition.front()].push_back(metaEdgeIndex);
+    }
+
     // As long as there are locations to explore, do so.
+    std::vector<uint64_t> applicableMetaEdges;
     while (!locationsToExplore.empty()) {
         std::vector<uint64_t> currentLocations = std::move(locationsToExplore.back());
         locationsToExplore.pop_back();
 
-        for (auto const& metaEdge : conditionalMetaEdges) {
-            bool isApplicable = true;
-            for (uint64_t i = 0; i < metaEdge.components.size(); ++i) {
-                if (currentLocations[metaEdge.components[i]] != metaEdge.condition[i]) {
-                    isApplicable = false;
-                    break;
+        applicableMetaEdges.clear();
+        for (uint64_t component = 0; component < composedAutomata.size(); ++component) {
+            for (auto metaEdgeIndex : metaEdgesBySourceLocation[component][currentLocations[component]]) {
+                auto const& metaEdge = conditionalMetaEdges[metaEdgeIndex];
+                bool isApplicable = true;
+                for (uint64_t i = 1; i < metaEdge.components.size(); ++i) {
+                    if (currentLocations[metaEdge.components[i]] != metaEdge.condition[i]) {
+                        isApplicable = false;
+                        break;
+                    }
+                }
+                if (isApplicable) {
+                    applicableMetaEdges.push_back(metaEdgeIndex);
                 }
             }
-
-            if (isApplicable) {
-                std::vector<uint64_t> newLocations;
-
-                for (auto const& effect : metaEdge.effects) {
-                    std::vector<uint64_t> targetLocationCombination = currentLocations;
-                    for (uint64_t i = 0; i < metaEdge.components.size(); ++i) {
-                        targetLocationCombination[metaEdge.components[i]] = effect[i];
-                    }
-
-                    // Check whether the target combination is new.
-                    auto it = newLocationMapping.find(targetLocationCombination);
-                    if (it != newLocationMapping.end()) {
-                        newLocations.emplace_back(it->second);
-                    } else {
-                        uint64_t id = newLocationMapping.size();
-                        newLocationMapping[targetLocationCombination] = id;
-                        locationsToExplore.emplace_back(std::move(targetLocationCombination));
-                        newLocations.emplace_back(id);
-                        createCombinedLocation(composedAutomata, newAutomaton, newLocations);
-                    }
+        }
+        // Add the edges in the order of the meta edges.
+        std::sort(applicableMetaEdges.begin(), applicableMetaEdges.end());
+        uint64_t sourceLocation = newLocationMapping.at(currentLocations);
+
+        for (auto metaEdgeIndex : applicableMetaEdges) {
+            auto const& metaEdge = conditionalMetaEdges[metaEdgeIndex];
+            std::vector<uint64_t> newLocations;
+
+            for (auto const& effect : metaEdge.effects) {
+                std::vector<uint64_t> targetLocationCombination = currentLocations;
+                for (uint64_t i = 0; i < metaEdge.components.size(); ++i) {
+                    targetLocationCombination[metaEdge.components[i]] = effect[i];
                 }
 
-                newAutomaton.addEdge(Edge(newLocationMapping.at(currentLocations), metaEdge.actionIndex, metaEdge.rate, metaEdge.templateEdge, newLocations,
-                                          metaEdge.probabilities));
+                // Check whether the target combination is new.
+                auto it = newLocationMapping.find(targetLocationCombination);
+                if (it != newLocationMapping.end()) {
+                    newLocations.emplace_back(it->second);
+                } else {
+                    uint64_t id = newLocationMapping.size();
+                    newLocationMapping[targetLocationCombination] = id;
+                    createCombinedLocation(composedAutomata, newAutomaton, targetLocationCombination);
+                    locationsToExplore.emplace_back(std::move(targetLocationCombination));
+                    newLocations.emplace_back(id);
+                }
             }
+
+            newAutomaton.addEdge(Edge(sourceLocation, metaEdge.actionIndex, metaEdge.rate, metaEdge.templateEdge, newLocations, metaEdge.probabilities));
         }
     }
 }
@@ -535,6 +556,14 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
         solver->add(variable.getRangeExpression());
     }
 
+    // Group the edges of the automata by their action such that the edges participating in a synchronization vector are found quickly.
+    EdgesByAction edgesByAction(composedAutomata.size());
+    for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
+        for (auto const& edge : composedAutomata[i].get().getEdges()) {
+            edgesByAction[i][edge.getActionIndex()].push_back(edge);
+        }
+    }
+
     // Perform all necessary synchronizations and keep track which action indices participate in synchronization.
     std::vector<std::set<uint64_t>> synchronizingActionIndices(composedAutomata.size());
     std::vector<ConditionalMetaEdge> conditionalMetaEdges;
@@ -546,7 +575,7 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
 
         // Create all conditional template edges corresponding to this synchronization vector.
         std::vector<ConditionalMetaEdge> newConditionalMetaEdges =
-            createSynchronizingMetaEdges(*this, flattenedModel, newAutomaton, synchronizingActionIndices, vector, composedAutomata, *solver);
+            createSynchronizingMetaEdges(*this, flattenedModel, newAutomaton, synchronizingActionIndices, vector, composedAutomata, edgesByAction, *solver);
         conditionalMetaEdges.insert(conditionalMetaEdges.end(), newConditionalMetaEdges.begin(), newConditionalMetaEdges.end());
     }
 
@@ -461,7 +461,27 @@ class ArrayEliminatorDataCollector : public JaniTraverser {
     bool converged;
 };
 
-/// Eliminates the array accesses in the given expression, for example  ([[1],[2,3]])[i][j]  --> i=0 ? [1][j] : [2,3][j] --> i=0 ? 1 : (j=0 ? 2 : 3)
+/*!
+ * Creates an expression that selects the element whose index is the value of the given index expression.
+ * Instead of comparing the index with each element in turn, the elements are selected by a balanced tree of comparisons, such that evaluating the
+ * expression only takes logarithmically many steps in the number of elements. Indices that are not part of the elements select an arbitrary element.
+ *
+ * @param indexExpr The (non-constant) index expression.
+ * @param elements The elements and their indices, sorted by their indices.
+ * @param begin The first element to consider.
+ * @param end The element after the last element to consider. Has to be larger than begin.
+ */
+storm::expressions::Expression selectByIndex(storm::expressions::Expression const& indexExpr,
+                                             std::vector<std::pair<uint64_t, storm::expressions::Expression>> const& elements, uint64_t begin, uint64_t end) {
+    if (end - begin == 1) {
+        return elements[begin].second;
+    }
+    uint64_t middle = begin + (end - begin) / 2;
+    auto condition = indexExpr < indexExpr.getManager().integer(elements[middle].first);
+    return storm::expressions::ite(condition, selectByIndex(indexExpr, elements, begin, middle), selectByIndex(indexExpr, elements, middle, end));
+}
+
+/// Eliminates the array accesses in the given expression, for example  ([[1],[2,3]])[i][j]  --> i<1 ? [1][j] : [2,3][j] --> i<1 ? 1 : (j<1 ? 2 : 3)
 class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionVisitor, public storm::expressions::JaniExpressionVisitor {
    public:
     using storm::expressions::ExpressionVisitor::visit;
@@ -627,22 +647,20 @@ class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionV
         } else {
             STORM_LOG_ASSERT(!replacement.isVariable(), "Are there too many nested array accesses?");
             auto indexExpr = indices[pos - 1];
-            storm::expressions::Expression result;
             if (indexExpr.containsVariables()) {
+                std::vector<std::pair<uint64_t, storm::expressions::Expression>> children;
                 for (uint64_t index = 0; index < replacement.size(); ++index) {
                     auto child = varElimHelper(replacement.at(index), indices, pos - 1);
                     if (child.isInitialized()) {  // i.e. there is no out-of-bounds situation for the child
-                        if (result.isInitialized()) {
-                            auto currIndexExpr = (indexExpr == indexExpr.getManager().integer(index));
-                            result = storm::expressions::ite(currIndexExpr, child, result);
-                        } else {
-                            result = child;
-                        }
+                        children.emplace_back(index, child);
                     }
                 }
-                // At this point result remains uninitialized iff all childs are uninitialized (i.e. out-of-bounds).
+                // The result remains uninitialized iff all childs are uninitialized (i.e. out-of-bounds).
                 // The underlying assumption here is that indexExpr will never evaluate to an index where the access is out-of-bounds.
-                return result;
+                if (children.empty()) {
+                    return storm::expressions::Expression();
+                }
+                return selectByIndex(indexExpr, children, 0, children.size());
             } else {
                 auto index = static_cast<uint64_t>(indexExpr.evaluateAsInt());
                 if (index < replacement.size()) {
@@ -741,22 +759,17 @@ class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionV
             STORM_LOG_THROW(!expression.size()->containsVariables(), storm::exceptions::NotSupportedException,
                             "Unable to eliminate array expression of unknown size.");
             auto exprSize = static_cast<uint64_t>(expression.size()->evaluateAsInt());
-            storm::expressions::Expression result;
+            std::vector<std::pair<uint64_t, storm::expressions::Expression>> children;
             for (uint64_t index = 0; index < exprSize; ++index) {
                 auto child = boost::any_cast<ResultType>(expression.at(index)->accept(*this, &childIndices));
                 if (!child.isArrayOutOfBounds()) {
-                    if (result.isInitialized()) {
-                        auto currIndexExpr = (indexExpr == indexExpr.getManager().integer(index));
-                        result = storm::expressions::ite(currIndexExpr, child.expr()->toExpression(), result);
-                    } else {
-                        result = child.expr()->toExpression();
-                    }
+                    children.emplace_back(index, child.expr()->toExpression());
                 }
             }
-            if (result.isInitialized()) {
-                return ResultType(result.getBaseExpressionPointer());
-            } else {
+            if (children.empty()) {
                 return ResultType();
+            } else {
+                return ResultType(selectByIndex(indexExpr, children, 0, children.size()).getBaseExpressionPointer());
             }
         } else {
             auto index = indexExpr.evaluateAsInt();
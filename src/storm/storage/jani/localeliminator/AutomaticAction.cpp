@@ -1,6 +1,8 @@
 #include "AutomaticAction.h"
 
+#include <algorithm>
 #include <boost/graph/strong_components.hpp>
+#include <cmath>
 #include "EliminateAutomaticallyAction.h"
 #include "RebuildWithoutUnreachableAction.h"
 #include "UnfoldAction.h"
@@ -78,8 +80,11 @@ void AutomaticAction::processAutomaton(JaniLocalEliminator::Session &session, co
                                                      !isOnlyAutomaton);
         eliminateAction.doAction(session);
 
-        RebuildWithoutUnreachableAction rebuildAfterEliminationAction;
-        rebuildAfterEliminationAction.doAction(session);
+        // If no location was eliminated, the model is unchanged since the last rebuild.
+        if (eliminateAction.getNumberOfEliminatedLocations() > 0) {
+            RebuildWithoutUnreachableAction rebuildAfterEliminationAction;
+            rebuildAfterEliminationAction.doAction(session);
+        }
     }
 }
 
@@ -146,7 +151,9 @@ boost::optional<uint32_t> AutomaticAction::chooseNextUnfold(JaniLocalEliminator:
     std::set<uint32_t> groupsWithoutDependencies = dependencyGraph.getGroupsWithNoDependencies();
 
     STORM_LOG_TRACE("\tAnalysing groups without dependencies:");
-    uint32_t bestValue = 0;
+    Automaton const &automaton = session.getModel().getAutomaton(automatonName);
+    uint64_t edgeCount = std::max<uint64_t>(automaton.getNumberOfEdges(), 1);
+    double bestValue = 0;
     uint32_t bestGroup = 0;
     for (auto groupIndex : groupsWithoutDependencies) {
         bool containsPropertyVariable = false;
@@ -165,14 +172,19 @@ boost::optional<uint32_t> AutomaticAction::chooseNextUnfold(JaniLocalEliminator:
         if (onlyPropertyVariables && !containsPropertyVariable) {
             continue;
         }
-        STORM_LOG_TRACE("\t\t{" + group.getVariablesAsString() + "}: " + std::to_string(totalOccurrences) + " occurrences");
         if (dependencyGraph.variableGroups[groupIndex].domainSize < maxDomainSize) {
-            if (totalOccurrences > bestValue) {
-                bestValue = totalOccurrences;
+            // The occurrences indicate how many locations become eliminable, which is weighed against the predicted growth of the automaton.
+            UnfoldDependencyGraph::UnfoldCost cost = dependencyGraph.estimateUnfoldCost(automaton, groupIndex);
+            double edgeBlowup = static_cast<double>(cost.edgeCount) / edgeCount;
+            double value = totalOccurrences / std::log2(1.0 + std::max(edgeBlowup, 1.0));
+            STORM_LOG_TRACE("\t\t{" + group.getVariablesAsString() + "}: " + std::to_string(totalOccurrences) + " occurrences, predicted " +
+                            std::to_string(cost.locationCount) + " locations and " + std::to_string(cost.edgeCount) + " edges");
+            if (value > bestValue) {
+                bestValue = value;
                 bestGroup = groupIndex;
             }
         } else {
-            STORM_LOG_TRACE("\t\t\tSkipped (domain size too large)");
+            STORM_LOG_TRACE("\t\t{" + group.getVariablesAsString() + "}: Skipped (domain size too large)");
         }
     }
 
@@ -10,6 +10,7 @@
 // locations as possible from the model. There are two main parameters to control this process:
 // * locationLimit: If this number of locations is reached, no further unfolding will be performed
 // * newTransitionLimit: Each candidate location will only be removed if doing so creates at most this many new transitions.
+// The next variable to unfold is chosen by weighing how often it is assigned against the growth of the automaton predicted by the UnfoldDependencyGraph.
 
 namespace storm {
 namespace jani {
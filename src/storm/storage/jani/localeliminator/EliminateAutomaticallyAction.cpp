@@ -1,6 +1,8 @@
 #include "EliminateAutomaticallyAction.h"
 #include "EliminateAction.h"
 
+#include <limits>
+
 #include "storm/exceptions/NotImplementedException.h"
 
 namespace storm {
@@ -11,13 +13,63 @@ EliminateAutomaticallyAction::EliminateAutomaticallyAction(const std::string& au
     : automatonName(automatonName),
       eliminationOrder(order),
       restrictToUnnamedActions(restrictToUnnamedActions),
-      transitionCountThreshold(transitionCountThreshold) {}
+      transitionCountThreshold(transitionCountThreshold),
+      numberOfEliminatedLocations(0) {}
 
 std::string EliminateAutomaticallyAction::getDescription() {
     return "EliminateAutomaticallyAction";
 }
 
+uint64_t EliminateAutomaticallyAction::getNumberOfEliminatedLocations() const {
+    return numberOfEliminatedLocations;
+}
+
+bool EliminateAutomaticallyAction::isSatisfiable(const Edge& edge) {
+    // Eliminated edges are not removed but their guard is set to false.
+    return edge.getGuard().containsVariables() || edge.getGuard().evaluateAsBool();
+}
+
+std::vector<uint64_t> EliminateAutomaticallyAction::computeNewTransitionCounts(const Automaton& automaton) const {
+    // Eliminating a location replaces each incoming edge by one edge per combination of outgoing edges for the destinations leading to the location.
+    // All counts are computed in a single pass over the edges.
+    std::vector<uint64_t> outgoing(automaton.getNumberOfLocations(), 0);
+    for (const auto& edge : automaton.getEdges()) {
+        if (isSatisfiable(edge)) {
+            ++outgoing[edge.getSourceLocationIndex()];
+        }
+    }
+
+    std::vector<uint64_t> incoming(automaton.getNumberOfLocations(), 0);
+    std::map<uint64_t, uint64_t> addedTransitionsByLocation;
+    for (const auto& edge : automaton.getEdges()) {
+        if (!isSatisfiable(edge)) {
+            continue;
+        }
+        addedTransitionsByLocation.clear();
+        for (const auto& dest : edge.getDestinations()) {
+            uint64_t locIndex = dest.getLocationIndex();
+            auto it = addedTransitionsByLocation.emplace(locIndex, 1).first;
+            // Stop once we hit the threshold -- otherwise there is a risk of causing an overflow due to the exponential growth of the added transitions.
+            if (it->second <= transitionCountThreshold) {
+                it->second *= outgoing[locIndex];
+            }
+        }
+        for (auto const& locationAndTransitions : addedTransitionsByLocation) {
+            if (locationAndTransitions.second > 0) {
+                incoming[locationAndTransitions.first] += locationAndTransitions.second - 1;
+            }
+        }
+    }
+
+    std::vector<uint64_t> result(automaton.getNumberOfLocations());
+    for (uint64_t locIndex = 0; locIndex < result.size(); ++locIndex) {
+        result[locIndex] = incoming[locIndex] * outgoing[locIndex];
+    }
+    return result;
+}
+
 void EliminateAutomaticallyAction::doAction(JaniLocalEliminator::Session& session) {
+    numberOfEliminatedLocations = 0;
     Automaton* automaton = &session.getModel().getAutomaton(automatonName);
     switch (eliminationOrder) {
         case EliminationOrder::Arbitrary: {
@@ -29,6 +81,7 @@ void EliminateAutomaticallyAction::doAction(JaniLocalEliminator::Session& sessio
                     STORM_LOG_TRACE("Eliminating location " + loc.getName());
                     EliminateAction action = EliminateAction(automatonName, loc.getName());
                     action.doAction(session);
+                    ++numberOfEliminatedLocations;
                 }
             }
             break;
@@ -76,31 +129,15 @@ void EliminateAutomaticallyAction::doAction(JaniLocalEliminator::Session& sessio
 
             bool done = false;
             while (!done) {
-                uint64_t minNewEdges = 18446744073709551615U;  // max value of uint64
+                std::vector<uint64_t> newTransitionCounts = computeNewTransitionCounts(*automaton);
+                uint64_t minNewEdges = std::numeric_limits<uint64_t>::max();
                 int bestLocIndex = -1;
                 for (const auto& loc : automaton->getLocations()) {
                     if (uneliminable[loc.getName()])
                         continue;
 
                     auto locIndex = automaton->getLocationIndex(loc.getName());
-                    uint64_t outgoing = automaton->getEdgesFromLocation(locIndex).size();
-                    uint64_t incoming = 0;
-                    for (const auto& edge : automaton->getEdges()) {
-                        uint64_t addedTransitions = 1;
-                        for (const auto& dest : edge.getDestinations()) {
-                            if (dest.getLocationIndex() == locIndex) {
-                                addedTransitions *= outgoing;
-                                // Stop once we hit the threshold -- otherwise there is a risk of causing
-                                // an overflow due to the exponential growth of addedTransitions:
-                                if (addedTransitions > transitionCountThreshold) {
-                                    break;
-                                }
-                            }
-                        }
-                        incoming += addedTransitions - 1;
-                    }
-                    uint64_t newEdges = incoming * outgoing;
-
+                    uint64_t newEdges = newTransitionCounts[locIndex];
                     if (newEdges <= minNewEdges) {
                         minNewEdges = newEdges;
                         bestLocIndex = locIndex;
@@ -116,22 +153,38 @@ void EliminateAutomaticallyAction::doAction(JaniLocalEliminator::Session& sessio
                                     " new transitions)");
                 } else {
                     std::string locName = automaton->getLocation(bestLocIndex).getName();
+
+                    // Only the predecessors of the eliminated location obtain new edges, so only they can get new loops or named actions.
+                    std::set<uint64_t> predecessors;
+                    for (const auto& edge : automaton->getEdges()) {
+                        if (!isSatisfiable(edge)) {
+                            continue;
+                        }
+                        for (const auto& dest : edge.getDestinations()) {
+                            if (dest.getLocationIndex() == static_cast<uint64_t>(bestLocIndex)) {
+                                predecessors.insert(edge.getSourceLocationIndex());
+                            }
+                        }
+                    }
+
                     STORM_LOG_TRACE("\tEliminating location " + locName + " (" + std::to_string(minNewEdges) + " new edges)");
                     EliminateAction action = EliminateAction(automatonName, locName);
                     action.doAction(session);
                     automaton = &session.getModel().getAutomaton(automatonName);
                     uneliminable[locName] = true;
+                    ++numberOfEliminatedLocations;
 
                     // Update "uneliminable" to account for potential new loops
-                    for (const auto& loc : automaton->getLocations()) {
-                        if (!uneliminable[loc.getName()]) {
-                            if (session.hasLoops(automatonName, loc.getName())) {
-                                uneliminable[loc.getName()] = true;
-                                STORM_LOG_TRACE("\t" + loc.getName() + " now has a loop");
+                    for (uint64_t predecessor : predecessors) {
+                        std::string const& predecessorName = automaton->getLocation(predecessor).getName();
+                        if (!uneliminable[predecessorName]) {
+                            if (session.hasLoops(automatonName, predecessorName)) {
+                                uneliminable[predecessorName] = true;
+                                STORM_LOG_TRACE("\t" + predecessorName + " now has a loop");
                             }
-                            if (restrictToUnnamedActions && session.hasNamedActions(automatonName, loc.getName())) {
-                                uneliminable[loc.getName()] = true;
-                                STORM_LOG_TRACE("\t" + loc.getName() + " now has a named action");
+                            if (restrictToUnnamedActions && session.hasNamedActions(automatonName, predecessorName)) {
+                                uneliminable[predecessorName] = true;
+                                STORM_LOG_TRACE("\t" + predecessorName + " now has a named action");
                             }
                         }
                     }
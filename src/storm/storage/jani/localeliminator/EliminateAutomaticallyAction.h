@@ -4,7 +4,8 @@
 
 // EliminateAutomaticallyAction determines which locations can be eliminated in the given automaton and automatically eliminates them, until doing so would
 // create too many new transitions. The elimination order can be specified, with NewTransitionCount recommended in most cases, since it produces smaller
-// models (at increased runtime cost).
+// models (at increased runtime cost). The new transition counts and elimination status are updated incrementally after each elimination, i.e., only the
+// predecessors of the eliminated location are revisited.
 
 namespace storm {
 namespace jani {
@@ -17,12 +18,18 @@ class EliminateAutomaticallyAction : public JaniLocalEliminator::Action {
                                           bool restrictToUnnamedActions = false);
     std::string getDescription() override;
     void doAction(JaniLocalEliminator::Session &session) override;
+    uint64_t getNumberOfEliminatedLocations() const;
 
    private:
+    // Computes, for each location, how many new transitions eliminating the location would create.
+    std::vector<uint64_t> computeNewTransitionCounts(const Automaton &automaton) const;
+    static bool isSatisfiable(const Edge &edge);
+
     std::string automatonName;
     EliminationOrder eliminationOrder;
     bool restrictToUnnamedActions;
     uint32_t transitionCountThreshold;
+    uint64_t numberOfEliminatedLocations;
 };
 }  // namespace elimination_actions
 }  // namespace jani
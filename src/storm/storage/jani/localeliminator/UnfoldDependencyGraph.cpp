@@ -1,6 +1,8 @@
 #include "UnfoldDependencyGraph.h"
+#include <algorithm>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/strong_components.hpp>
+#include <limits>
 #include <utility>
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -8,6 +10,20 @@
 namespace storm {
 namespace jani {
 namespace elimination_actions {
+namespace detail {
+// Multiplies the two factors, saturating at the maximal value instead of overflowing.
+uint64_t saturatingMultiply(uint64_t first, uint64_t second) {
+    if (first != 0 && second > std::numeric_limits<uint64_t>::max() / first) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return first * second;
+}
+
+uint64_t saturatingAdd(uint64_t first, uint64_t second) {
+    return first > std::numeric_limits<uint64_t>::max() - second ? std::numeric_limits<uint64_t>::max() : first + second;
+}
+}  // namespace detail
+
 UnfoldDependencyGraph::VariableGroup::VariableGroup() : domainSize(1), allVariablesUnfoldable(true), unfolded(false), allDependenciesUnfolded(false) {}
 
 void UnfoldDependencyGraph::VariableGroup::addVariable(UnfoldDependencyGraph::VariableInfo variable) {
@@ -97,6 +113,44 @@ uint32_t UnfoldDependencyGraph::getTotalBlowup(std::vector<uint32_t> groups) {
     return res;
 }
 
+UnfoldDependencyGraph::UnfoldCost UnfoldDependencyGraph::estimateUnfoldCost(Automaton const &automaton, uint32_t groupIndex) {
+    std::set<std::string> unfoldedVariables;
+    uint64_t blowup = 1;
+    for (uint32_t group : getOrderedDependencies(groupIndex, true)) {
+        blowup = detail::saturatingMultiply(blowup, variableGroups[group].domainSize);
+        for (auto const &variable : variableGroups[group].variables) {
+            unfoldedVariables.insert(variable.expressionVariableName);
+        }
+    }
+
+    UnfoldCost cost;
+    cost.locationCount = detail::saturatingMultiply(automaton.getNumberOfLocations(), blowup);
+    cost.edgeCount = 0;
+    for (auto const &edge : automaton.getEdges()) {
+        if (!edge.getGuard().containsVariables() && !edge.getGuard().evaluateAsBool()) {
+            continue;
+        }
+        uint64_t copies = blowup;
+        for (auto const &destination : edge.getDestinations()) {
+            for (auto const &assignment : destination.getOrderedAssignments()) {
+                if (unfoldedVariables.count(assignment.getExpressionVariable().getName()) == 0) {
+                    continue;
+                }
+                // If the assigned value does not only depend on unfolded variables, the target location is only known in the state space.
+                auto assignedVariables = assignment.getAssignedExpression().getVariables();
+                bool dependsOnStateSpace = std::any_of(assignedVariables.begin(), assignedVariables.end(), [&unfoldedVariables](auto const &variable) {
+                    return unfoldedVariables.count(variable.getName()) == 0;
+                });
+                if (dependsOnStateSpace) {
+                    copies = detail::saturatingMultiply(copies, variableGroups[findGroupIndex(assignment.getExpressionVariable().getName())].domainSize);
+                }
+            }
+        }
+        cost.edgeCount = detail::saturatingAdd(cost.edgeCount, copies);
+    }
+    return cost;
+}
+
 std::set<uint32_t> UnfoldDependencyGraph::getGroupsWithNoDependencies() {
     std::set<uint32_t> res;
     for (uint64_t i = 0; i < variableGroups.size(); i++)
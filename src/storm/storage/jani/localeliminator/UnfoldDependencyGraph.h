@@ -9,6 +9,9 @@
 // Unfolding x is only possible if y and z are already unfolded. This graph models these dependencies. It also supports cyclical dependencies (which have
 // to be unfolded together).
 // The graph is usually construction once in the beginning of the elimination process and then updated whenever a variable is unfolded.
+// It can also estimate how unfolding a group (and its dependencies) affects the number of locations and edges of an automaton: every location and edge is
+// copied once per value of the unfolded variables, and a destination that assigns an unfolded variable an expression over variables that remain in the
+// state space may be split into one edge per value.
 
 namespace storm {
 namespace jani {
@@ -28,6 +31,13 @@ class UnfoldDependencyGraph {
                      int domainSize);
     };
 
+    // The predicted size of an automaton after unfolding a group of variables.
+    class UnfoldCost {
+       public:
+        uint64_t locationCount;
+        uint64_t edgeCount;
+    };
+
     class VariableGroup {
        public:
         std::vector<VariableInfo> variables;
@@ -51,6 +61,7 @@ class UnfoldDependencyGraph {
 
     std::vector<uint32_t> getOrderedDependencies(uint32_t groupIndex, bool includeSelf = false);
     uint32_t getTotalBlowup(std::vector<uint32_t> groups);
+    UnfoldCost estimateUnfoldCost(Automaton const &automaton, uint32_t groupIndex);
     bool areDependenciesUnfoldable(uint32_t groupIndex);
 
     std::set<uint32_t> getGroupsWithNoDependencies();
@@ -2,8 +2,11 @@
 
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/io/file.h"
@@ -54,6 +57,170 @@ ExportJsonType buildExpression(storm::expressions::Expression const& exp, std::v
     return ExpressionToJson::translate(exp, constants, globalVariables, localVariables, auxiliaryVariables);
 }
 
+/*!
+ * Memoizes the translations of the expressions of an automaton. As expressions are hash-consed, expressions that occur several times (e.g. the
+ * same guard or probability in many edges) share their nodes and thus only need to be translated once.
+ */
+class ExpressionJsonCache {
+   public:
+    template<typename TranslationFunction>
+    ExportJsonType translate(storm::expressions::Expression const& expression, TranslationFunction const& translation) {
+        auto const& baseExpression = expression.getBaseExpressionPointer();
+        // Expressions that are not referenced elsewhere can not reoccur.
+        if (!baseExpression.get() || baseExpression.use_count() <= 1) {
+            return translation();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto translationIt = translations.find(baseExpression.get());
+            if (translationIt != translations.end()) {
+                return translationIt->second;
+            }
+        }
+        ExportJsonType result = translation();
+        std::lock_guard<std::mutex> lock(mutex);
+        translations.emplace(baseExpression.get(), result);
+        return result;
+    }
+
+   private:
+    std::mutex mutex;
+    std::unordered_map<storm::expressions::BaseExpression const*, ExportJsonType> translations;
+};
+
+ExportJsonType buildCachedExpression(storm::expressions::Expression const& exp, std::vector<storm::jani::Constant> const& constants,
+                                     VariableSet const& globalVariables, VariableSet const& localVariables, ExpressionJsonCache* cache) {
+    if (cache) {
+        return cache->translate(exp, [&]() { return buildExpression(exp, constants, globalVariables, localVariables); });
+    }
+    return buildExpression(exp, constants, globalVariables, localVariables);
+}
+
+/*!
+ * Writes JSON to a stream piece by piece, so that large parts of the output (e.g. the edges of the automata) never need to be kept in memory
+ * at once. The output coincides with the one obtained by dumping the complete JSON structure.
+ */
+class JsonStreamWriter {
+   public:
+    JsonStreamWriter(std::ostream& stream, bool compact) : stream(stream), compact(compact), afterKey(false) {
+        // Intentionally left empty.
+    }
+
+    void beginObject() {
+        beginValue();
+        stream << '{';
+        scopeIsEmpty.push_back(true);
+    }
+
+    void endObject() {
+        endScope('}');
+    }
+
+    void beginArray() {
+        beginValue();
+        stream << '[';
+        scopeIsEmpty.push_back(true);
+    }
+
+    void endArray() {
+        endScope(']');
+    }
+
+    /*!
+     * Writes the key of the next entry of the current object.
+     */
+    void writeKey(std::string const& key) {
+        beginEntry();
+        stream << ExportJsonType(key).dump() << (compact ? ":" : ": ");
+        afterKey = true;
+    }
+
+    /*!
+     * Writes the given value as the next element of the current array or as the value of the previously written key.
+     */
+    void writeValue(ExportJsonType const& value) {
+        beginValue();
+        if (compact) {
+            stream << value.dump();
+            return;
+        }
+        // Strings are escaped, so every line break of the dumped value is followed by an indentation that needs to be shifted.
+        std::string serialized = value.dump(indentStep);
+        std::string indentation(indentStep * scopeIsEmpty.size(), ' ');
+        std::size_t lineBegin = 0;
+        for (std::size_t lineEnd = serialized.find('\n'); lineEnd != std::string::npos; lineEnd = serialized.find('\n', lineBegin)) {
+            stream.write(serialized.data() + lineBegin, lineEnd + 1 - lineBegin);
+            stream << indentation;
+            lineBegin = lineEnd + 1;
+        }
+        stream.write(serialized.data() + lineBegin, serialized.size() - lineBegin);
+    }
+
+    /*!
+     * Writes the given object, where the value of the given (additional) key is written by the given function.
+     */
+    template<typename WriteFunction>
+    void writeObject(ExportJsonType const& object, std::string const& streamedKey, WriteFunction const& writeStreamedValue) {
+        // The entries are written in the same (lexicographic) order as if the streamed value was part of the object.
+        beginObject();
+        bool streamed = false;
+        for (auto entryIt = object.begin(); entryIt != object.end(); ++entryIt) {
+            if (!streamed && streamedKey < entryIt.key()) {
+                writeKey(streamedKey);
+                writeStreamedValue();
+                streamed = true;
+            }
+            writeKey(entryIt.key());
+            writeValue(entryIt.value());
+        }
+        if (!streamed) {
+            writeKey(streamedKey);
+            writeStreamedValue();
+        }
+        endObject();
+    }
+
+   private:
+    void beginEntry() {
+        if (scopeIsEmpty.back()) {
+            scopeIsEmpty.back() = false;
+        } else {
+            stream << ',';
+        }
+        if (!compact) {
+            stream << '\n' << std::string(indentStep * scopeIsEmpty.size(), ' ');
+        }
+    }
+
+    void beginValue() {
+        if (afterKey) {
+            afterKey = false;
+        } else if (!scopeIsEmpty.empty()) {
+            beginEntry();
+        }
+    }
+
+    void endScope(char closingCharacter) {
+        bool empty = scopeIsEmpty.back();
+        scopeIsEmpty.pop_back();
+        if (!empty && !compact) {
+            stream << '\n' << std::string(indentStep * scopeIsEmpty.size(), ' ');
+        }
+        stream << closingCharacter;
+    }
+
+    static const uint64_t indentStep = 4;
+
+    std::ostream& stream;
+    bool compact;
+
+    // For each currently open object or array, whether nothing was written into it yet.
+    std::vector<bool> scopeIsEmpty;
+
+    // Whether a key was written whose value is still missing.
+    bool afterKey;
+};
+
 class CompositionJsonExporter : public CompositionVisitor {
    public:
     CompositionJsonExporter(bool allowRecursion) : allowRecursion(allowRecursion) {}
@@ -778,36 +945,6 @@ boost::any ExpressionToJson::visit(storm::expressions::FunctionCallExpression co
     return opDecl;
 }
 
-void JsonExporter::toFile(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::string const& filepath, bool checkValid,
-                          bool compact) {
-    std::ofstream stream;
-    storm::utility::openFile(filepath, stream, false, true);
-    toStream(janiModel, formulas, stream, checkValid, compact);
-    storm::utility::closeFile(stream);
-}
-
-void JsonExporter::toStream(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& os, bool checkValid,
-                            bool compact) {
-    if (checkValid) {
-        janiModel.checkValid();
-    }
-    JsonExporter exporter;
-    STORM_LOG_INFO("Started to convert model " << janiModel.getName() << ".");
-    exporter.convertModel(janiModel, !compact);
-    STORM_LOG_INFO("Started to convert properties of model " << janiModel.getName() << ".");
-    exporter.convertProperties(formulas, janiModel);
-    if (compact) {
-        // Dump without line breaks/indents
-        STORM_LOG_INFO("Producing compact json output... " << janiModel.getName() << ".");
-        os << exporter.finalize().dump() << '\n';
-    } else {
-        // Dump with line breaks and indention with 4 spaces
-        STORM_LOG_INFO("Producing json output... " << janiModel.getName() << ".");
-        os << exporter.finalize().dump(4) << '\n';
-    }
-    STORM_LOG_INFO("Conversion completed " << janiModel.getName() << ".");
-}
-
 ExportJsonType buildActionArray(std::vector<storm::jani::Action> const& actions) {
     std::vector<ExportJsonType> actionReprs;
     uint64_t actIndex = 0;
@@ -983,13 +1120,14 @@ ExportJsonType buildLValue(storm::jani::LValue const& lValue, std::vector<storm:
 }
 
 ExportJsonType buildAssignmentArray(storm::jani::OrderedAssignments const& orderedAssignments, std::vector<storm::jani::Constant> const& constants,
-                                    VariableSet const& globalVariables, VariableSet const& localVariables, bool commentExpressions) {
+                                    VariableSet const& globalVariables, VariableSet const& localVariables, bool commentExpressions,
+                                    ExpressionJsonCache* cache = nullptr) {
     ExportJsonType assignmentDeclarations = std::vector<ExportJsonType>();
     bool addIndex = orderedAssignments.hasMultipleLevels();
     for (auto const& assignment : orderedAssignments) {
         ExportJsonType assignmentEntry;
         assignmentEntry["ref"] = buildLValue(assignment.getLValue(), constants, globalVariables, localVariables);
-        assignmentEntry["value"] = buildExpression(assignment.getAssignedExpression(), constants, globalVariables, localVariables);
+        assignmentEntry["value"] = buildCachedExpression(assignment.getAssignedExpression(), constants, globalVariables, localVariables, cache);
         if (addIndex) {
             assignmentEntry["index"] = assignment.getLevel();
         }
@@ -1033,7 +1171,7 @@ ExportJsonType buildInitialLocations(storm::jani::Automaton const& automaton) {
 
 ExportJsonType buildDestinations(std::vector<EdgeDestination> const& destinations, std::map<uint64_t, std::string> const& locationNames,
                                  std::vector<storm::jani::Constant> const& constants, VariableSet const& globalVariables, VariableSet const& localVariables,
-                                 bool commentExpressions) {
+                                 bool commentExpressions, ExpressionJsonCache* cache) {
     assert(destinations.size() > 0);
     ExportJsonType destDeclarations = std::vector<ExportJsonType>();
     for (auto const& destination : destinations) {
@@ -1046,14 +1184,14 @@ ExportJsonType buildDestinations(std::vector<EdgeDestination> const& destination
             }
         }
         if (!prob1) {
-            destEntry["probability"]["exp"] = buildExpression(destination.getProbability(), constants, globalVariables, localVariables);
+            destEntry["probability"]["exp"] = buildCachedExpression(destination.getProbability(), constants, globalVariables, localVariables, cache);
             if (commentExpressions) {
                 destEntry["probability"]["comment"] = destination.getProbability().toString();
             }
         }
         if (!destination.getOrderedAssignments().empty()) {
             destEntry["assignments"] =
-                buildAssignmentArray(destination.getOrderedAssignments(), constants, globalVariables, localVariables, commentExpressions);
+                buildAssignmentArray(destination.getOrderedAssignments(), constants, globalVariables, localVariables, commentExpressions, cache);
         }
         destDeclarations.push_back(std::move(destEntry));
     }
@@ -1062,7 +1200,7 @@ ExportJsonType buildDestinations(std::vector<EdgeDestination> const& destination
 
 ExportJsonType buildEdge(Edge const& edge, std::map<uint64_t, std::string> const& actionNames, std::map<uint64_t, std::string> const& locationNames,
                          std::vector<storm::jani::Constant> const& constants, VariableSet const& globalVariables, VariableSet const& localVariables,
-                         bool commentExpressions) {
+                         bool commentExpressions, ExpressionJsonCache* cache = nullptr) {
     STORM_LOG_THROW(edge.getDestinations().size() > 0, storm::exceptions::InvalidJaniException, "An edge without destinations is not allowed.");
     ExportJsonType edgeEntry;
     edgeEntry["location"] = locationNames.at(edge.getSourceLocationIndex());
@@ -1070,58 +1208,77 @@ ExportJsonType buildEdge(Edge const& edge, std::map<uint64_t, std::string> const
         edgeEntry["action"] = actionNames.at(edge.getActionIndex());
     }
     if (edge.hasRate()) {
-        edgeEntry["rate"]["exp"] = buildExpression(edge.getRate(), constants, globalVariables, localVariables);
+        edgeEntry["rate"]["exp"] = buildCachedExpression(edge.getRate(), constants, globalVariables, localVariables, cache);
         if (commentExpressions) {
             edgeEntry["rate"]["comment"] = edge.getRate().toString();
         }
     }
     if (!edge.getGuard().isTrue()) {
-        edgeEntry["guard"]["exp"] = buildExpression(edge.getGuard(), constants, globalVariables, localVariables);
+        edgeEntry["guard"]["exp"] = buildCachedExpression(edge.getGuard(), constants, globalVariables, localVariables, cache);
         if (commentExpressions) {
             edgeEntry["guard"]["comment"] = edge.getGuard().toString();
         }
     }
-    edgeEntry["destinations"] = buildDestinations(edge.getDestinations(), locationNames, constants, globalVariables, localVariables, commentExpressions);
+    edgeEntry["destinations"] =
+        buildDestinations(edge.getDestinations(), locationNames, constants, globalVariables, localVariables, commentExpressions, cache);
     if (!edge.getAssignments().empty()) {
-        edgeEntry["assignments"] = buildAssignmentArray(edge.getAssignments(), constants, globalVariables, localVariables, commentExpressions);
+        edgeEntry["assignments"] = buildAssignmentArray(edge.getAssignments(), constants, globalVariables, localVariables, commentExpressions, cache);
     }
     return edgeEntry;
 }
 
-ExportJsonType buildEdges(std::vector<Edge> const& edges, std::map<uint64_t, std::string> const& actionNames,
-                          std::map<uint64_t, std::string> const& locationNames, std::vector<storm::jani::Constant> const& constants,
-                          VariableSet const& globalVariables, VariableSet const& localVariables, bool commentExpressions) {
-    ExportJsonType edgeDeclarations = std::vector<ExportJsonType>();
-    for (auto const& edge : edges) {
-        if (edge.getGuard().isFalse()) {
-            continue;
+void writeEdges(JsonStreamWriter& writer, std::vector<Edge> const& edges, std::map<uint64_t, std::string> const& actionNames,
+                std::map<uint64_t, std::string> const& locationNames, std::vector<storm::jani::Constant> const& constants, VariableSet const& globalVariables,
+                VariableSet const& localVariables, bool commentExpressions, bool parallel) {
+    // The edges are converted in chunks that are written before the next chunk is converted. This bounds the memory for the converted edges.
+    uint64_t const chunkSize = 4096;
+    ExpressionJsonCache cache;
+    std::vector<ExportJsonType> edgeDeclarations;
+    auto convertEdges = [&](uint64_t chunkBegin, uint64_t begin, uint64_t end) {
+        for (uint64_t edgeIndex = begin; edgeIndex < end; ++edgeIndex) {
+            if (!edges[edgeIndex].getGuard().isFalse()) {
+                edgeDeclarations[edgeIndex - chunkBegin] =
+                    buildEdge(edges[edgeIndex], actionNames, locationNames, constants, globalVariables, localVariables, commentExpressions, &cache);
+            }
+        }
+    };
+
+    writer.beginArray();
+    for (uint64_t chunkBegin = 0; chunkBegin < edges.size(); chunkBegin += chunkSize) {
+        uint64_t chunkEnd = std::min<uint64_t>(edges.size(), chunkBegin + chunkSize);
+        edgeDeclarations.assign(chunkEnd - chunkBegin, ExportJsonType());
+        if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(chunkBegin, chunkEnd), [&](tbb::blocked_range<uint64_t> const& range) {
+                convertEdges(chunkBegin, range.begin(), range.end());
+            });
+#endif
+        } else {
+            convertEdges(chunkBegin, chunkBegin, chunkEnd);
+        }
+        for (uint64_t edgeIndex = chunkBegin; edgeIndex < chunkEnd; ++edgeIndex) {
+            if (!edges[edgeIndex].getGuard().isFalse()) {
+                writer.writeValue(edgeDeclarations[edgeIndex - chunkBegin]);
+            }
         }
-        edgeDeclarations.push_back(buildEdge(edge, actionNames, locationNames, constants, globalVariables, localVariables, commentExpressions));
     }
-    return edgeDeclarations;
+    writer.endArray();
 }
 
-ExportJsonType buildAutomataArray(std::vector<storm::jani::Automaton> const& automata, std::map<uint64_t, std::string> const& actionNames,
-                                  std::vector<storm::jani::Constant> const& constants, VariableSet const& globalVariables, bool commentExpressions) {
-    ExportJsonType automataDeclarations = std::vector<ExportJsonType>();
-    for (auto const& automaton : automata) {
-        ExportJsonType autoEntry;
-        autoEntry["name"] = automaton.getName();
-        autoEntry["variables"] = buildVariablesArray(automaton.getVariables(), constants, globalVariables, automaton.getVariables());
-        if (!automaton.getFunctionDefinitions().empty()) {
-            autoEntry["functions"] = buildFunctionsArray(automaton.getFunctionDefinitions(), constants, globalVariables, automaton.getVariables());
-        }
-        if (automaton.hasRestrictedInitialStates()) {
-            autoEntry["restrict-initial"]["exp"] =
-                buildExpression(automaton.getInitialStatesRestriction(), constants, globalVariables, automaton.getVariables());
-        }
-        autoEntry["locations"] = buildLocationsArray(automaton.getLocations(), constants, globalVariables, automaton.getVariables(), commentExpressions);
-        autoEntry["initial-locations"] = buildInitialLocations(automaton);
-        autoEntry["edges"] = buildEdges(automaton.getEdges(), actionNames, automaton.buildIdToLocationNameMap(), constants, globalVariables,
-                                        automaton.getVariables(), commentExpressions);
-        automataDeclarations.push_back(std::move(autoEntry));
+ExportJsonType buildAutomatonWithoutEdges(storm::jani::Automaton const& automaton, std::vector<storm::jani::Constant> const& constants,
+                                          VariableSet const& globalVariables, bool commentExpressions) {
+    ExportJsonType autoEntry;
+    autoEntry["name"] = automaton.getName();
+    autoEntry["variables"] = buildVariablesArray(automaton.getVariables(), constants, globalVariables, automaton.getVariables());
+    if (!automaton.getFunctionDefinitions().empty()) {
+        autoEntry["functions"] = buildFunctionsArray(automaton.getFunctionDefinitions(), constants, globalVariables, automaton.getVariables());
     }
-    return automataDeclarations;
+    if (automaton.hasRestrictedInitialStates()) {
+        autoEntry["restrict-initial"]["exp"] = buildExpression(automaton.getInitialStatesRestriction(), constants, globalVariables, automaton.getVariables());
+    }
+    autoEntry["locations"] = buildLocationsArray(automaton.getLocations(), constants, globalVariables, automaton.getVariables(), commentExpressions);
+    autoEntry["initial-locations"] = buildInitialLocations(automaton);
+    return autoEntry;
 }
 
 void JsonExporter::convertModel(storm::jani::Model const& janiModel, bool commentExpressions) {
@@ -1136,11 +1293,54 @@ void JsonExporter::convertModel(storm::jani::Model const& janiModel, bool commen
         jsonStruct["functions"] = buildFunctionsArray(janiModel.getGlobalFunctionDefinitions(), janiModel.getConstants(), janiModel.getGlobalVariables());
     }
     jsonStruct["restrict-initial"]["exp"] = buildExpression(janiModel.getInitialStatesRestriction(), janiModel.getConstants(), janiModel.getGlobalVariables());
-    jsonStruct["automata"] = buildAutomataArray(janiModel.getAutomata(), janiModel.getActionIndexToNameMap(), janiModel.getConstants(),
-                                                janiModel.getGlobalVariables(), commentExpressions);
     jsonStruct["system"] = CompositionJsonExporter::translate(janiModel.getSystemComposition());
 }
 
+void writeAutomata(JsonStreamWriter& writer, storm::jani::Model const& janiModel, bool commentExpressions, bool parallel) {
+    auto actionNames = janiModel.getActionIndexToNameMap();
+    writer.beginArray();
+    for (auto const& automaton : janiModel.getAutomata()) {
+        ExportJsonType autoEntry = buildAutomatonWithoutEdges(automaton, janiModel.getConstants(), janiModel.getGlobalVariables(), commentExpressions);
+        writer.writeObject(autoEntry, "edges", [&]() {
+            writeEdges(writer, automaton.getEdges(), actionNames, automaton.buildIdToLocationNameMap(), janiModel.getConstants(),
+                       janiModel.getGlobalVariables(), automaton.getVariables(), commentExpressions, parallel);
+        });
+    }
+    writer.endArray();
+}
+
+void JsonExporter::toFile(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::string const& filepath, bool checkValid,
+                          bool compact, bool parallel) {
+    std::ofstream stream;
+    storm::utility::openFile(filepath, stream, false, true);
+    toStream(janiModel, formulas, stream, checkValid, compact, parallel);
+    storm::utility::closeFile(stream);
+}
+
+void JsonExporter::toStream(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& os, bool checkValid,
+                            bool compact, bool parallel) {
+    if (checkValid) {
+        janiModel.checkValid();
+    }
+#ifndef STORM_HAVE_INTELTBB
+    if (parallel) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
+        parallel = false;
+    }
+#endif
+    JsonExporter exporter;
+    STORM_LOG_INFO("Started to convert model " << janiModel.getName() << ".");
+    exporter.convertModel(janiModel, !compact);
+    STORM_LOG_INFO("Started to convert properties of model " << janiModel.getName() << ".");
+    exporter.convertProperties(formulas, janiModel);
+    // The automata are converted while they are written (without line breaks/indents if compact, with indention with 4 spaces otherwise).
+    STORM_LOG_INFO("Producing " << (compact ? "compact " : "") << "json output... " << janiModel.getName() << ".");
+    JsonStreamWriter writer(os, compact);
+    writer.writeObject(exporter.finalize(), "automata", [&]() { writeAutomata(writer, janiModel, !compact, parallel); });
+    os << '\n';
+    STORM_LOG_INFO("Conversion completed " << janiModel.getName() << ".");
+}
+
 ExportJsonType JsonExporter::getEdgeAsJson(storm::jani::Model const& janiModel, uint64_t automatonIndex, uint64_t edgeIndex, bool commentExpressions) {
     auto const& automaton = janiModel.getAutomaton(automatonIndex);
     return buildEdge(automaton.getEdge(edgeIndex), janiModel.getActionIndexToNameMap(), automaton.buildIdToLocationNameMap(), janiModel.getConstants(),
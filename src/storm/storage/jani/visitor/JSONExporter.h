@@ -92,10 +92,17 @@ class FormulaToJaniJson : public storm::logic::FormulaVisitor {
 class JsonExporter {
    public:
     JsonExporter() = default;
+
+    /*!
+     * Exports the given model and properties. The automata are converted while they are written, so the JSON structure of the complete model
+     * is never kept in memory.
+     *
+     * @param parallel If set, the edges of the automata are converted in parallel (requires Intel TBB).
+     */
     static void toFile(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::string const& filepath,
-                       bool checkValid = true, bool compact = false);
+                       bool checkValid = true, bool compact = false, bool parallel = false);
     static void toStream(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& ostream,
-                         bool checkValid = false, bool compact = false);
+                         bool checkValid = false, bool compact = false, bool parallel = false);
 
     static ExportJsonType getEdgeAsJson(storm::jani::Model const& janiModel, uint64_t automatonIndex, uint64_t edgeIndex, bool commentExpressions = true);
 
@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -9,6 +10,8 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/memorystructure/MemoryStructureBuilder.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -99,10 +102,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Sparse
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
     if (scheduler) {
         transitionMatrix = buildTransitionMatrixForScheduler();
-    } else if (model.getTransitionMatrix().hasTrivialRowGrouping()) {
-        transitionMatrix = buildDeterministicTransitionMatrix();
     } else {
-        transitionMatrix = buildNondeterministicTransitionMatrix();
+        transitionMatrix = buildTransitionMatrixWithoutScheduler();
     }
     storm::models::sparse::StateLabeling labeling = buildStateLabeling(transitionMatrix);
     std::unordered_map<std::string, RewardModelType> rewardModels = buildRewardModels(transitionMatrix);
@@ -110,6 +111,11 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Sparse
     return buildResult(std::move(transitionMatrix), std::move(labeling), std::move(rewardModels));
 }
 
+template<typename ValueType, typename RewardModelType>
+void SparseModelMemoryProduct<ValueType, RewardModelType>::setRewardModelsToBuild(std::set<std::string> const& rewardModelNames) {
+    rewardModelsToBuild = rewardModelNames;
+}
+
 template<typename ValueType, typename RewardModelType>
 bool SparseModelMemoryProduct<ValueType, RewardModelType>::isStateReachable(uint64_t const& modelState, uint64_t const& memoryState) {
     STORM_LOG_ASSERT(modelState < getOriginalModel().getNumberOfStates(), "Invalid model state: " << modelState << ".");
@@ -195,63 +201,59 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
 }
 
 template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildDeterministicTransitionMatrix() {
-    uint64_t numResStates = reachableStates.getNumberOfSetBits();
-    uint64_t numResTransitions = 0;
-    for (auto stateIndex : reachableStates) {
-        numResTransitions += model.getTransitionMatrix().getRow(stateIndex / memoryStateCount).getNumberOfEntries();
-    }
-
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResStates, numResStates, numResTransitions, true);
-    uint64_t currentRow = 0;
-    for (auto stateIndex : reachableStates) {
+storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildTransitionMatrixWithoutScheduler() {
+    auto const& modelMatrix = model.getTransitionMatrix();
+    auto const& modelRowGroupIndices = modelMatrix.getRowGroupIndices();
+    std::vector<uint64_t> const resultToStateIndex(reachableStates.begin(), reachableStates.end());
+    uint64_t const numResStates = resultToStateIndex.size();
+
+    // Every reachable product state gets the rows of its model state, so the row (group) indications of the result can be computed upfront.
+    std::vector<uint64_t> rowGroupIndices;
+    rowGroupIndices.reserve(numResStates + 1);
+    rowGroupIndices.push_back(0);
+    std::vector<uint64_t> rowIndications;
+    rowIndications.push_back(0);
+    for (auto stateIndex : resultToStateIndex) {
         uint64_t modelState = stateIndex / memoryStateCount;
-        uint64_t memoryState = stateIndex % memoryStateCount;
-        auto const& modelRow = model.getTransitionMatrix().getRow(modelState);
-        for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-            uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-            builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+        for (uint64_t modelRow = modelRowGroupIndices[modelState]; modelRow < modelRowGroupIndices[modelState + 1]; ++modelRow) {
+            rowIndications.push_back(rowIndications.back() + modelMatrix.getRow(modelRow).getNumberOfEntries());
         }
-        ++currentRow;
+        rowGroupIndices.push_back(rowIndications.size() - 1);
     }
 
-    return builder.build();
-}
-
-template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildNondeterministicTransitionMatrix() {
-    uint64_t numResStates = reachableStates.getNumberOfSetBits();
-    uint64_t numResChoices = 0;
-    uint64_t numResTransitions = 0;
-    for (auto stateIndex : reachableStates) {
-        uint64_t modelState = stateIndex / memoryStateCount;
-        for (uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRow < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRow) {
-            ++numResChoices;
-            numResTransitions += model.getTransitionMatrix().getRow(modelRow).getNumberOfEntries();
-        }
-    }
-
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResChoices, numResStates, numResTransitions, true, true, numResStates);
-    uint64_t currentRow = 0;
-    for (auto stateIndex : reachableStates) {
-        uint64_t modelState = stateIndex / memoryStateCount;
-        uint64_t memoryState = stateIndex % memoryStateCount;
-        builder.newRowGroup(currentRow);
-        for (uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRowIndex < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRowIndex) {
-            auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
-            for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-                uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
+    // As the result states are ordered by their model state, the columns within each row are sorted and distinct. Hence, the entries of the
+    // product states can be written independently of each other.
+    typedef storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType> MatrixEntryType;
+    std::vector<MatrixEntryType> columnsAndValues(rowIndications.back());
+    auto fillStates = [&](uint64_t firstResState, uint64_t endResState) {
+        for (uint64_t resState = firstResState; resState < endResState; ++resState) {
+            uint64_t modelState = resultToStateIndex[resState] / memoryStateCount;
+            uint64_t memoryState = resultToStateIndex[resState] % memoryStateCount;
+            auto resultEntryIt = columnsAndValues.begin() + rowIndications[rowGroupIndices[resState]];
+            auto const& rowGroup = modelMatrix.getRowGroup(modelState);
+            for (auto entryIt = rowGroup.begin(); entryIt != rowGroup.end(); ++entryIt, ++resultEntryIt) {
+                uint64_t transitionId = entryIt - modelMatrix.begin();
                 uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+                *resultEntryIt = MatrixEntryType(toResultStateMapping[entryIt->getColumn() * memoryStateCount + successorMemoryState], entryIt->getValue());
             }
-            ++currentRow;
         }
+    };
+#ifdef STORM_HAVE_INTELTBB
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numResStates),
+                          [&](tbb::blocked_range<uint64_t> const& range) { fillStates(range.begin(), range.end()); });
+    } else {
+        fillStates(0, numResStates);
     }
+#else
+    fillStates(0, numResStates);
+#endif
 
-    return builder.build();
+    boost::optional<std::vector<uint64_t>> resultRowGroupIndices;
+    if (!modelMatrix.hasTrivialRowGrouping()) {
+        resultRowGroupIndices = std::move(rowGroupIndices);
+    }
+    return storm::storage::SparseMatrix<ValueType>(numResStates, std::move(rowIndications), std::move(columnsAndValues), std::move(resultRowGroupIndices));
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -406,6 +408,9 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
     uint64_t numResStates = resultTransitionMatrix.getRowGroupCount();
 
     for (auto const& rewardModel : model.getRewardModels()) {
+        if (rewardModelsToBuild && rewardModelsToBuild->count(rewardModel.first) == 0) {
+            continue;
+        }
         std::optional<std::vector<RewardValueType>> stateRewards;
         if (rewardModel.second.hasStateRewards()) {
             stateRewards = std::vector<RewardValueType>(numResStates, storm::utility::zero<RewardValueType>());
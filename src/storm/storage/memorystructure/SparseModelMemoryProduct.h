@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 
@@ -20,6 +21,9 @@ namespace storage {
  * The states of the resulting sparse model will have the original state labels plus the labels of this
  * memory structure.
  * An exception is thrown if the state labelings are not disjoint.
+ *
+ * As the product can be much larger than the model, only the reward models that are requested are translated to the product (all reward models,
+ * if none are requested explicitly). The transition matrix of the product is filled in parallel if the Intel TBB support is enabled.
  */
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
 class SparseModelMemoryProduct {
@@ -39,6 +43,10 @@ class SparseModelMemoryProduct {
     // Enforces that every state is considered reachable. If this is set, the result has size #modelStates * #memoryStates
     void setBuildFullProduct();
 
+    // Restricts the reward models of the product to the reward models of the original model with the given names. Names without a reward
+    // model in the original model are ignored.
+    void setRewardModelsToBuild(std::set<std::string> const& rewardModelNames);
+
     // Returns true iff the given model and memory state is reachable in the product
     bool isStateReachable(uint64_t const& modelState, uint64_t const& memoryState);
 
@@ -64,10 +72,8 @@ class SparseModelMemoryProduct {
     void computeReachableStates(storm::storage::BitVector const& initialStates);
 
     // Methods that build the model components
-    // Matrix for deterministic models
-    storm::storage::SparseMatrix<ValueType> buildDeterministicTransitionMatrix();
-    // Matrix for nondeterministic models
-    storm::storage::SparseMatrix<ValueType> buildNondeterministicTransitionMatrix();
+    // Matrix for models that do not consider a scheduler. The row grouping is trivial iff the row grouping of the model is trivial.
+    storm::storage::SparseMatrix<ValueType> buildTransitionMatrixWithoutScheduler();
     // Matrix for models that consider a scheduler
     storm::storage::SparseMatrix<ValueType> buildTransitionMatrixForScheduler();
     // State labeling.
@@ -92,6 +98,9 @@ class SparseModelMemoryProduct {
     // Indicates which states are considered reachable. (s, m) is reachable if this BitVector is true at (s * memoryStateCount) + m
     storm::storage::BitVector reachableStates;
 
+    // If set, only the reward models with these names are translated to the product.
+    boost::optional<std::set<std::string>> rewardModelsToBuild;
+
     uint64_t const memoryStateCount;
 
     storm::models::sparse::Model<ValueType, RewardModelType> const& model;
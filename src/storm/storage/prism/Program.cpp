@@ -1174,6 +1174,23 @@ Program Program::labelUnlabelledCommands(std::map<uint64_t, std::string> const&
                    this->getObservationLabels(), this->getOptionalInitialConstruct(), this->getOptionalSystemCompositionConstruct(), prismCompatibility);
 }
 
+namespace {
+/*!
+ * Retrieves the contained variables that are not among the legal ones. As opposed to std::set_difference, this only takes time
+ * logarithmic in the number of legal variables, such that checking all expressions of a program stays linear in the size of the program.
+ */
+std::set<storm::expressions::Variable> getIllegalVariables(std::set<storm::expressions::Variable> const& containedVariables,
+                                                           std::set<storm::expressions::Variable> const& legalVariables) {
+    std::set<storm::expressions::Variable> illegalVariables;
+    for (auto const& variable : containedVariables) {
+        if (legalVariables.count(variable) == 0) {
+            illegalVariables.insert(illegalVariables.end(), variable);
+        }
+    }
+    return illegalVariables;
+}
+}  // namespace
+
 void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
     // Start by checking the constant declarations.
     std::set<storm::expressions::Variable> all;
@@ -1184,9 +1201,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
         // Check defining expressions of defined constants.
         if (constant.isDefined()) {
             std::set<storm::expressions::Variable> containedVariables = constant.getExpression().getVariables();
-            std::set<storm::expressions::Variable> illegalVariables;
-            std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                std::inserter(illegalVariables, illegalVariables.begin()));
+            std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
             bool isValid = illegalVariables.empty();
 
             if (!isValid) {
@@ -1217,9 +1232,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
             // Check the initial value of the variable.
             std::set<storm::expressions::Variable> containedVariables = variable.getInitialValueExpression().getVariables();
-            std::set<storm::expressions::Variable> illegalVariables;
-            std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                std::inserter(illegalVariables, illegalVariables.begin()));
+            std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
             bool isValid = illegalVariables.empty();
 
             if (!isValid) {
@@ -1244,9 +1257,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
         // Check that bound expressions of the range.
         if (variable.hasLowerBoundExpression()) {
             std::set<storm::expressions::Variable> containedVariables = variable.getLowerBoundExpression().getVariables();
-            std::set<storm::expressions::Variable> illegalVariables;
-            std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                std::inserter(illegalVariables, illegalVariables.begin()));
+            std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
             bool isValid = illegalVariables.empty();
 
             if (!isValid) {
@@ -1263,9 +1274,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
         if (variable.hasUpperBoundExpression()) {
             std::set<storm::expressions::Variable> containedVariables = variable.getUpperBoundExpression().getVariables();
-            std::set<storm::expressions::Variable> illegalVariables;
-            std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                std::inserter(illegalVariables, illegalVariables.begin()));
+            std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
             bool isValid = illegalVariables.empty();
             if (!isValid) {
                 std::vector<std::string> illegalVariableNames;
@@ -1286,9 +1295,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
             // Check the initial value of the variable.
             std::set<storm::expressions::Variable> containedVariables = variable.getInitialValueExpression().getVariables();
-            std::set<storm::expressions::Variable> illegalVariables;
-            std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                std::inserter(illegalVariables, illegalVariables.begin()));
+            std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
             bool isValid = illegalVariables.empty();
             if (!isValid) {
                 std::vector<std::string> illegalVariableNames;
@@ -1319,9 +1326,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
                 // Check the initial value of the variable.
                 std::set<storm::expressions::Variable> containedVariables = variable.getInitialValueExpression().getVariables();
-                std::set<storm::expressions::Variable> illegalVariables;
-                std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                    std::inserter(illegalVariables, illegalVariables.begin()));
+                std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
                 bool isValid = illegalVariables.empty();
                 if (!isValid) {
                     std::vector<std::string> illegalVariableNames;
@@ -1343,9 +1348,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
             // Check that bound expressions of the range.
             if (variable.hasLowerBoundExpression()) {
                 std::set<storm::expressions::Variable> containedVariables = variable.getLowerBoundExpression().getVariables();
-                std::set<storm::expressions::Variable> illegalVariables;
-                std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                    std::inserter(illegalVariables, illegalVariables.begin()));
+                std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
                 bool isValid = illegalVariables.empty();
                 if (!isValid) {
                     std::vector<std::string> illegalVariableNames;
@@ -1361,11 +1364,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
             if (variable.hasUpperBoundExpression()) {
                 std::set<storm::expressions::Variable> containedVariables = variable.getUpperBoundExpression().getVariables();
-                std::set<storm::expressions::Variable> illegalVariables;
-
-                illegalVariables.clear();
-                std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                    std::inserter(illegalVariables, illegalVariables.begin()));
+                std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
                 bool isValid = illegalVariables.empty();
                 if (!isValid) {
                     std::vector<std::string> illegalVariableNames;
@@ -1386,10 +1385,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
                 // Check the initial value of the variable.
                 std::set<storm::expressions::Variable> containedVariables = variable.getInitialValueExpression().getVariables();
-                std::set<storm::expressions::Variable> illegalVariables;
-                illegalVariables.clear();
-                std::set_difference(containedVariables.begin(), containedVariables.end(), constants.begin(), constants.end(),
-                                    std::inserter(illegalVariables, illegalVariables.begin()));
+                std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, constants);
                 bool isValid = illegalVariables.empty();
                 if (!isValid) {
                     std::vector<std::string> illegalVariableNames;
@@ -1422,7 +1418,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
     // Collect the formula placeholders and check formulas
     for (auto const& formula : this->getFormulas()) {
         std::set<storm::expressions::Variable> containedVariables = formula.getExpression().getVariables();
-        bool isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+        bool isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
         STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                         "Error in " << formula.getFilename() << ", line " << formula.getLineNumber() << ": expression '" << formula.getExpression()
                                     << "'of formula '" << formula.getName() << "' refers to unknown identifiers.");
@@ -1451,9 +1447,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
         if (module.hasInvariant()) {
             std::set<storm::expressions::Variable> containedVariables = module.getInvariant().getVariables();
-            std::set<storm::expressions::Variable> illegalVariables;
-            std::set_difference(containedVariables.begin(), containedVariables.end(), variablesAndConstants.begin(), variablesAndConstants.end(),
-                                std::inserter(illegalVariables, illegalVariables.begin()));
+            std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, variablesAndConstants);
             bool isValid = illegalVariables.empty();
             if (!isValid) {
                 std::vector<std::string> illegalVariableNames;
@@ -1472,9 +1466,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
         for (auto& command : module.getCommands()) {
             // Check the guard.
             std::set<storm::expressions::Variable> containedVariables = command.getGuardExpression().getVariables();
-            std::set<storm::expressions::Variable> illegalVariables;
-            std::set_difference(containedVariables.begin(), containedVariables.end(), variablesAndConstants.begin(), variablesAndConstants.end(),
-                                std::inserter(illegalVariables, illegalVariables.begin()));
+            std::set<storm::expressions::Variable> illegalVariables = getIllegalVariables(containedVariables, variablesAndConstants);
             bool isValid = illegalVariables.empty();
             if (!isValid) {
                 std::vector<std::string> illegalVariableNames;
@@ -1505,9 +1497,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
             // Check all updates.
             for (auto const& update : command.getUpdates()) {
                 containedVariables = update.getLikelihoodExpression().getVariables();
-                illegalVariables.clear();
-                std::set_difference(containedVariables.begin(), containedVariables.end(), variablesAndConstants.begin(), variablesAndConstants.end(),
-                                    std::inserter(illegalVariables, illegalVariables.begin()));
+                illegalVariables = getIllegalVariables(containedVariables, variablesAndConstants);
                 isValid = illegalVariables.empty();
                 if (!isValid) {
                     std::vector<std::string> illegalVariableNames;
@@ -1559,9 +1549,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
                     }
 
                     containedVariables = assignment.getExpression().getVariables();
-                    illegalVariables.clear();
-                    std::set_difference(containedVariables.begin(), containedVariables.end(), variablesAndConstants.begin(), variablesAndConstants.end(),
-                                        std::inserter(illegalVariables, illegalVariables.begin()));
+                    illegalVariables = getIllegalVariables(containedVariables, variablesAndConstants);
                     isValid = illegalVariables.empty();
                     if (!isValid) {
                         std::vector<std::string> illegalVariableNames;
@@ -1603,7 +1591,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
     for (auto const& rewardModel : this->getRewardModels()) {
         for (auto const& stateReward : rewardModel.getStateRewards()) {
             std::set<storm::expressions::Variable> containedVariables = stateReward.getStatePredicateExpression().getVariables();
-            bool isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+            bool isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
             STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                             "Error in " << stateReward.getFilename() << ", line " << stateReward.getLineNumber()
                                         << ": state reward expression refers to unknown identifiers.");
@@ -1612,7 +1600,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
                 "Error in " << stateReward.getFilename() << ", line " << stateReward.getLineNumber() << ": state predicate must evaluate to type 'bool'.");
 
             containedVariables = stateReward.getRewardValueExpression().getVariables();
-            isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+            isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
             STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                             "Error in " << stateReward.getFilename() << ", line " << stateReward.getLineNumber()
                                         << ": state reward value expression refers to unknown identifiers.");
@@ -1623,7 +1611,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
         for (auto const& stateActionReward : rewardModel.getStateActionRewards()) {
             std::set<storm::expressions::Variable> containedVariables = stateActionReward.getStatePredicateExpression().getVariables();
-            bool isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+            bool isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
             STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                             "Error in " << stateActionReward.getFilename() << ", line " << stateActionReward.getLineNumber()
                                         << ": state reward expression refers to unknown identifiers.");
@@ -1632,7 +1620,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
                                         << ": state predicate must evaluate to type 'bool'.");
 
             containedVariables = stateActionReward.getRewardValueExpression().getVariables();
-            isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+            isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
             STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                             "Error in " << stateActionReward.getFilename() << ", line " << stateActionReward.getLineNumber()
                                         << ": state reward value expression refers to unknown identifiers.");
@@ -1643,7 +1631,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
 
         for (auto const& transitionReward : rewardModel.getTransitionRewards()) {
             std::set<storm::expressions::Variable> containedVariables = transitionReward.getSourceStatePredicateExpression().getVariables();
-            bool isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+            bool isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
             STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                             "Error in " << transitionReward.getFilename() << ", line " << transitionReward.getLineNumber()
                                         << ": state reward expression refers to unknown identifiers.");
@@ -1652,7 +1640,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
                                         << ": state predicate must evaluate to type 'bool'.");
 
             containedVariables = transitionReward.getTargetStatePredicateExpression().getVariables();
-            isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+            isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
             STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                             "Error in " << transitionReward.getFilename() << ", line " << transitionReward.getLineNumber()
                                         << ": state reward expression refers to unknown identifiers.");
@@ -1661,7 +1649,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
                                         << ": state predicate must evaluate to type 'bool'.");
 
             containedVariables = transitionReward.getRewardValueExpression().getVariables();
-            isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+            isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
             STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                             "Error in " << transitionReward.getFilename() << ", line " << transitionReward.getLineNumber()
                                         << ": state reward value expression refers to unknown identifiers.");
@@ -1674,7 +1662,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
     // Check the initial states expression.
     if (this->hasInitialConstruct()) {
         std::set<storm::expressions::Variable> containedIdentifiers = this->getInitialConstruct().getInitialStatesExpression().getVariables();
-        bool isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedIdentifiers.begin(), containedIdentifiers.end());
+        bool isValid = getIllegalVariables(containedIdentifiers, variablesAndConstants).empty();
         STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                         "Error in " << this->getInitialConstruct().getFilename() << ", line " << this->getInitialConstruct().getLineNumber()
                                     << ": initial construct refers to unknown identifiers.");
@@ -1689,7 +1677,7 @@ void Program::checkValidity(Program::ValidityCheckLevel lvl) const {
     // Check the labels.
     for (auto const& label : this->getLabels()) {
         std::set<storm::expressions::Variable> containedVariables = label.getStatePredicateExpression().getVariables();
-        bool isValid = std::includes(variablesAndConstants.begin(), variablesAndConstants.end(), containedVariables.begin(), containedVariables.end());
+        bool isValid = getIllegalVariables(containedVariables, variablesAndConstants).empty();
         STORM_LOG_THROW(isValid, storm::exceptions::WrongFormatException,
                         "Error in " << label.getFilename() << ", line " << label.getLineNumber() << ": label expression refers to unknown identifiers.");
         STORM_LOG_THROW(label.getStatePredicateExpression().hasBooleanType(), storm::exceptions::WrongFormatException,
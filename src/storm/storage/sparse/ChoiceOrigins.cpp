@@ -1,5 +1,7 @@
 #include "storm/storage/sparse/ChoiceOrigins.h"
 
+#include <mutex>
+
 #include "storm/adapters/JsonAdapter.h"
 
 #include "storm/storage/sparse/JaniChoiceOrigins.h"
@@ -12,6 +14,16 @@ namespace storm {
 namespace storage {
 namespace sparse {
 
+namespace detail {
+/*!
+ * Guards the computation of the cached identifier infos, which may be requested by several threads at the same time.
+ */
+std::mutex& getIdentifierInfoMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+}  // namespace detail
+
 ChoiceOrigins::ChoiceOrigins(std::vector<uint_fast64_t> const& indexToIdentifierMapping) : indexToIdentifier(indexToIdentifierMapping) {
     // Intentionally left empty
 }
@@ -59,6 +71,7 @@ uint_fast64_t ChoiceOrigins::getIdentifierForChoicesWithNoOrigin() {
 
 std::string const& ChoiceOrigins::getIdentifierInfo(uint_fast64_t identifier) const {
     STORM_LOG_ASSERT(identifier < this->getNumberOfIdentifiers(), "Invalid choice origin identifier: " << identifier);
+    std::lock_guard<std::mutex> lock(detail::getIdentifierInfoMutex());
     if (identifierToInfo.empty()) {
         computeIdentifierInfos();
     }
@@ -71,6 +84,7 @@ std::string const& ChoiceOrigins::getChoiceInfo(uint_fast64_t choiceIndex) const
 
 typename ChoiceOrigins::Json const& ChoiceOrigins::getIdentifierAsJson(uint_fast64_t identifier) const {
     STORM_LOG_ASSERT(identifier < this->getNumberOfIdentifiers(), "Invalid choice origin identifier: " << identifier);
+    std::lock_guard<std::mutex> lock(detail::getIdentifierInfoMutex());
     if (identifierToJson.empty()) {
         computeIdentifierJson();
     }
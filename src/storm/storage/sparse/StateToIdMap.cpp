@@ -0,0 +1,108 @@
+#include "storm/storage/sparse/StateToIdMap.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMapIterator::StateToIdMapIterator(typename BitVectorHashMap<StateType>::const_iterator const& plainIterator)
+    : plainIterator(plainIterator) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMapIterator::StateToIdMapIterator(typename TreeCompressedBitVectorHashMap<StateType>::const_iterator const& treeIterator)
+    : treeIterator(treeIterator) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::StateToIdMapIterator::operator==(StateToIdMapIterator const& other) {
+    if (plainIterator) {
+        return other.plainIterator && plainIterator.get() == other.plainIterator.get();
+    }
+    return other.treeIterator && treeIterator.get() == other.treeIterator.get();
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::StateToIdMapIterator::operator!=(StateToIdMapIterator const& other) {
+    return !(*this == other);
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::StateToIdMapIterator& StateToIdMap<StateType>::StateToIdMapIterator::operator++() {
+    if (plainIterator) {
+        ++plainIterator.get();
+    } else {
+        ++treeIterator.get();
+    }
+    return *this;
+}
+
+template<typename StateType>
+std::pair<storm::storage::BitVector, StateType> StateToIdMap<StateType>::StateToIdMapIterator::operator*() const {
+    return plainIterator ? *plainIterator.get() : *treeIterator.get();
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMap(uint64_t bitsPerState, uint64_t initialSize, bool treeCompression)
+    : plainMap(bitsPerState, treeCompression ? 1 : initialSize) {
+    if (treeCompression) {
+        treeMap = TreeCompressedBitVectorHashMap<StateType>(bitsPerState, initialSize);
+    }
+}
+
+template<typename StateType>
+StateType StateToIdMap<StateType>::findOrAdd(storm::storage::BitVector const& state, StateType const& index) {
+    return treeMap ? treeMap->findOrAdd(state, index) : plainMap.findOrAdd(state, index);
+}
+
+template<typename StateType>
+std::pair<StateType, uint64_t> StateToIdMap<StateType>::findOrAddAndGetBucket(storm::storage::BitVector const& state, StateType const& index) {
+    return treeMap ? treeMap->findOrAddAndGetBucket(state, index) : plainMap.findOrAddAndGetBucket(state, index);
+}
+
+template<typename StateType>
+StateType StateToIdMap<StateType>::getValue(storm::storage::BitVector const& state) const {
+    return treeMap ? treeMap->getValue(state) : plainMap.getValue(state);
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::contains(storm::storage::BitVector const& state) const {
+    return treeMap ? treeMap->contains(state) : plainMap.contains(state);
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::const_iterator StateToIdMap<StateType>::begin() const {
+    return treeMap ? const_iterator(treeMap->begin()) : const_iterator(plainMap.begin());
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::const_iterator StateToIdMap<StateType>::end() const {
+    return treeMap ? const_iterator(treeMap->end()) : const_iterator(plainMap.end());
+}
+
+template<typename StateType>
+uint64_t StateToIdMap<StateType>::size() const {
+    return treeMap ? treeMap->size() : plainMap.size();
+}
+
+template<typename StateType>
+void StateToIdMap<StateType>::remap(std::function<StateType(StateType const&)> const& remapping) {
+    if (treeMap) {
+        treeMap->remap(remapping);
+    } else {
+        plainMap.remap(remapping);
+    }
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::isTreeCompressed() const {
+    return static_cast<bool>(treeMap);
+}
+
+template class StateToIdMap<uint32_t>;
+template class StateToIdMap<uint_fast64_t>;
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <functional>
+
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/TreeCompressedBitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+/*!
+ * The map from (compressed) states to their indices used during state space exploration. Depending on the construction, the states are either
+ * stored as plain bit vectors (see BitVectorHashMap) or tree-compressed (see TreeCompressedBitVectorHashMap).
+ */
+template<typename StateType>
+class StateToIdMap {
+   public:
+    class StateToIdMapIterator {
+       public:
+        StateToIdMapIterator(typename BitVectorHashMap<StateType>::const_iterator const& plainIterator);
+        StateToIdMapIterator(typename TreeCompressedBitVectorHashMap<StateType>::const_iterator const& treeIterator);
+
+        // Methods to compare two iterators.
+        bool operator==(StateToIdMapIterator const& other);
+        bool operator!=(StateToIdMapIterator const& other);
+
+        // Methods to move iterator forward.
+        StateToIdMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to state and its index.
+        std::pair<storm::storage::BitVector, StateType> operator*() const;
+
+       private:
+        // Exactly one of the iterators is set.
+        boost::optional<typename BitVectorHashMap<StateType>::const_iterator> plainIterator;
+        boost::optional<typename TreeCompressedBitVectorHashMap<StateType>::const_iterator> treeIterator;
+    };
+
+    typedef StateToIdMapIterator const_iterator;
+
+    /*!
+     * Creates an empty map for states of the given size.
+     *
+     * @param bitsPerState The number of bits of each state.
+     * @param initialSize The number of states for which space is initially reserved.
+     * @param treeCompression If set, the states are stored tree-compressed.
+     */
+    StateToIdMap(uint64_t bitsPerState, uint64_t initialSize, bool treeCompression = false);
+
+    /*!
+     * Searches for the given state in the map. If it is found, the mapped-to index is returned. Otherwise, the
+     * state is inserted with the given index.
+     */
+    StateType findOrAdd(storm::storage::BitVector const& state, StateType const& index);
+
+    /*!
+     * Like findOrAdd, but additionally returns the bucket (or, for tree compression, the index of the root node) in which the state is stored.
+     */
+    std::pair<StateType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& state, StateType const& index);
+
+    /*!
+     * Retrieves the index associated with the given state. If the state does not exist, the behaviour is undefined.
+     */
+    StateType getValue(storm::storage::BitVector const& state) const;
+
+    /*!
+     * Checks if the given state is contained in the map.
+     */
+    bool contains(storm::storage::BitVector const& state) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the number of stored states.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Performs a remapping of all indices stored by applying the given remapping.
+     */
+    void remap(std::function<StateType(StateType const&)> const& remapping);
+
+    /*!
+     * Retrieves whether the states are stored tree-compressed.
+     */
+    bool isTreeCompressed() const;
+
+   private:
+    // The map used without tree compression.
+    BitVectorHashMap<StateType> plainMap;
+
+    // The map used with tree compression.
+    boost::optional<TreeCompressedBitVectorHashMap<StateType>> treeMap;
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
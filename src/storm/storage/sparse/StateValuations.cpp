@@ -16,6 +16,16 @@ namespace storm {
 namespace storage {
 namespace sparse {
 
+namespace {
+void copyBits(storm::storage::BitVector const& source, uint64_t sourceIndex, storm::storage::BitVector& target, uint64_t targetIndex,
+              uint64_t numberOfBits) {
+    for (uint64_t offset = 0; offset < numberOfBits; offset += 64) {
+        uint64_t chunkSize = std::min<uint64_t>(64, numberOfBits - offset);
+        target.setFromInt(targetIndex + offset, chunkSize, source.getAsInt(sourceIndex + offset, chunkSize));
+    }
+}
+}  // namespace
+
 StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                                 std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues)
     : booleanValues(std::move(booleanValues)),
@@ -25,10 +35,22 @@ StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValue
     // Intentionally left empty
 }
 
-typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
+std::shared_ptr<typename StateValuations::StateValuation const> StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
+    if (isLazy()) {
+        STORM_LOG_ASSERT(stateIndex < storedStates.size(), "Invalid state index.");
+        if (!storedStates.get(stateIndex)) {
+            return std::make_shared<StateValuation const>();
+        }
+        storm::storage::BitVector compressedState(bitsPerState);
+        copyBits(compressedStates, stateIndex * bitsPerState, compressedState, 0, bitsPerState);
+        std::vector<bool> booleanValues;
+        std::vector<int64_t> integerValues;
+        decoder(compressedState, booleanValues, integerValues);
+        return std::make_shared<StateValuation const>(std::move(booleanValues), std::move(integerValues), std::vector<storm::RationalNumber>());
+    }
     STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-    STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-    return valuations[stateIndex];
+    // The valuation is owned by this object, so the returned pointer does not need to share the ownership.
+    return std::shared_ptr<StateValuation const>(std::shared_ptr<StateValuation const>(), &valuations[stateIndex]);
 }
 
 StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -36,7 +58,8 @@ StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm:
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                         typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation)
+                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd,
+                                                        std::shared_ptr<StateValuation const> const& valuation)
     : variableIt(variableIt),
       labelIt(labelIt),
       variableBegin(variableBegin),
@@ -131,7 +154,8 @@ typename StateValuations::StateValueIterator& StateValuations::StateValueIterato
 }
 
 StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap,
-                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation)
+                                                                  std::map<std::string, uint64_t> const& labelMap,
+                                                                  std::shared_ptr<StateValuation const> const& valuation)
     : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
     // Intentionally left empty.
 }
@@ -145,26 +169,31 @@ StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::en
 }
 
 bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    auto valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(assertValuation(*valuation), "Invalid  state valuations");
     STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-    return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+    return valuation->booleanValues[variableToIndexMap.at(booleanVariable)];
 }
 
-int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex,
-                                                storm::expressions::Variable const& integerVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+    auto valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(assertValuation(*valuation), "Invalid  state valuations");
     STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-    return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+    return valuation->integerValues[variableToIndexMap.at(integerVariable)];
 }
 
-storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
-                                                               storm::expressions::Variable const& rationalVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+storm::RationalNumber StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
+                                                        storm::expressions::Variable const& rationalVariable) const {
+    auto valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(assertValuation(*valuation), "Invalid  state valuations");
     STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-    return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+    return valuation->rationalValues[variableToIndexMap.at(rationalVariable)];
 }
 
 bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
+    if (isLazy()) {
+        return !storedStates.get(stateIndex);
+    }
     auto const& valuation = valuations[stateIndex];  // Do not use getValuations, as that is only valid after adding stuff.
     return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
 }
@@ -294,6 +323,17 @@ StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t
     // Intentionally left empty
 }
 
+StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, uint64_t bitsPerState,
+                                 CompressedStateDecoder const& decoder, storm::storage::BitVector&& compressedStates,
+                                 storm::storage::BitVector&& storedStates)
+    : variableToIndexMap(variableToIndexMap),
+      bitsPerState(bitsPerState),
+      decoder(decoder),
+      compressedStates(std::move(compressedStates)),
+      storedStates(std::move(storedStates)) {
+    // Intentionally left empty
+}
+
 std::string StateValuations::getStateInfo(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
     return this->toString(state);
@@ -301,11 +341,15 @@ std::string StateValuations::getStateInfo(state_type const& state) const {
 
 typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-    return StateValueIteratorRange({variableToIndexMap, observationLabels, &(valuations[state])});
+    return StateValueIteratorRange({variableToIndexMap, observationLabels, getValuation(state)});
 }
 
 uint_fast64_t StateValuations::getNumberOfStates() const {
-    return valuations.size();
+    return isLazy() ? storedStates.size() : valuations.size();
+}
+
+bool StateValuations::isLazy() const {
+    return static_cast<bool>(decoder);
 }
 
 std::size_t StateValuations::hash() const {
@@ -313,10 +357,16 @@ std::size_t StateValuations::hash() const {
 }
 
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
+    if (isLazy()) {
+        return selectCompressedStates(std::vector<storm::storage::sparse::state_type>(selectedStates.begin(), selectedStates.end()));
+    }
     return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
 }
 
 StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
+    if (isLazy()) {
+        return selectCompressedStates(selectedStates);
+    }
     std::vector<StateValuation> selectedValuations;
     selectedValuations.reserve(selectedStates.size());
     for (auto const& selectedState : selectedStates) {
@@ -330,6 +380,9 @@ StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse
 }
 
 StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
+    if (isLazy()) {
+        return selectCompressedStates(mapNewToOld);
+    }
     std::vector<StateValuation> newValuations;
     for (auto const& oldState : mapNewToOld) {
         newValuations.push_back(valuations[oldState]);
@@ -337,7 +390,20 @@ StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld
     return StateValuations(variableToIndexMap, std::move(newValuations));
 }
 
-StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
+StateValuations StateValuations::selectCompressedStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
+    storm::storage::BitVector selectedCompressedStates(selectedStates.size() * bitsPerState);
+    storm::storage::BitVector selectedStoredStates(selectedStates.size());
+    for (uint64_t newState = 0; newState < selectedStates.size(); ++newState) {
+        auto const& oldState = selectedStates[newState];
+        if (oldState < storedStates.size() && storedStates.get(oldState)) {
+            copyBits(compressedStates, oldState * bitsPerState, selectedCompressedStates, newState * bitsPerState, bitsPerState);
+            selectedStoredStates.set(newState);
+        }
+    }
+    return StateValuations(variableToIndexMap, bitsPerState, decoder, std::move(selectedCompressedStates), std::move(selectedStoredStates));
+}
+
+StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0), compressedStateCount(0) {
     // Intentionally left empty.
 }
 
@@ -374,6 +440,33 @@ void StateValuationsBuilder::addState(storm::storage::sparse::state_type const&
     }
 }
 
+void StateValuationsBuilder::setCompressedStateDecoder(uint64_t bitsPerState, StateValuations::CompressedStateDecoder const& decoder) {
+    STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to make the state valuations lazy, although a state has already been added before.");
+    STORM_LOG_ASSERT(rationalVarCount == 0 && labelCount == 0, "Lazy state valuations do not support rational variables and observation labels.");
+    currentStateValuations.bitsPerState = bitsPerState;
+    currentStateValuations.decoder = decoder;
+}
+
+bool StateValuationsBuilder::isLazy() const {
+    return currentStateValuations.isLazy();
+}
+
+void StateValuationsBuilder::addCompressedState(storm::storage::sparse::state_type const& state, storm::storage::BitVector const& compressedState) {
+    STORM_LOG_ASSERT(isLazy(), "Tried to add a compressed state to state valuations that are not lazy.");
+    STORM_LOG_ASSERT(compressedState.size() >= currentStateValuations.bitsPerState, "The compressed state is too small.");
+    auto& storedStates = currentStateValuations.storedStates;
+    if (state >= storedStates.size()) {
+        // Bit vectors reallocate on every resize, so we reserve space for more states than needed.
+        uint64_t newSize = std::max<uint64_t>(state + 1, 2 * storedStates.size());
+        storedStates.resize(newSize);
+        currentStateValuations.compressedStates.resize(newSize * currentStateValuations.bitsPerState);
+    }
+    STORM_LOG_ASSERT(!storedStates.get(state), "Adding a valuation to the same state multiple times.");
+    copyBits(compressedState, 0, currentStateValuations.compressedStates, state * currentStateValuations.bitsPerState, currentStateValuations.bitsPerState);
+    storedStates.set(state);
+    compressedStateCount = std::max<uint64_t>(compressedStateCount, state + 1);
+}
+
 uint64_t StateValuationsBuilder::getBooleanVarCount() const {
     return booleanVarCount;
 }
@@ -387,6 +480,11 @@ uint64_t StateValuationsBuilder::getLabelCount() const {
 }
 
 StateValuations StateValuationsBuilder::build(std::size_t totalStateCount) {
+    if (isLazy() && compressedStateCount < currentStateValuations.storedStates.size()) {
+        // Drop the space that was reserved for further states.
+        currentStateValuations.compressedStates.resize(compressedStateCount * currentStateValuations.bitsPerState);
+        currentStateValuations.storedStates.resize(compressedStateCount);
+    }
     return std::move(currentStateValuations);
     booleanVarCount = 0;
     integerVarCount = 0;
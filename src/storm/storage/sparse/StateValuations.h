@@ -2,7 +2,12 @@
 
 #include <boost/optional.hpp>
 #include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "storm/adapters/JsonForward.h"
 #include "storm/adapters/RationalNumberForward.h"
@@ -22,6 +27,13 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
    public:
     friend class StateValuationsBuilder;
 
+    /*!
+     * Decodes the compressed representation of a state into the values of its boolean and integer variables. The values have to be given in the
+     * order in which the variables were added to the builder.
+     */
+    typedef std::function<void(storm::storage::BitVector const& compressedState, std::vector<bool>& booleanValues, std::vector<int64_t>& integerValues)>
+        CompressedStateDecoder;
+
     class StateValuation {
        public:
         friend class StateValuations;
@@ -43,7 +55,7 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                            typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation);
+                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, std::shared_ptr<StateValuation const> const& valuation);
         bool operator==(StateValueIterator const& other);
         bool operator!=(StateValueIterator const& other);
         StateValueIterator& operator++();
@@ -73,20 +85,20 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
         typename std::map<std::string, uint64_t>::const_iterator labelBegin;
         typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-        StateValuation const* const valuation;
+        std::shared_ptr<StateValuation const> valuation;
     };
 
     class StateValueIteratorRange {
        public:
         StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap,
-                                StateValuation const* valuation);
+                                std::shared_ptr<StateValuation const> const& valuation);
         StateValueIterator begin() const;
         StateValueIterator end() const;
 
        private:
         std::map<storm::expressions::Variable, uint64_t> const& variableMap;
         std::map<std::string, uint64_t> const& labelMap;
-        StateValuation const* const valuation;
+        std::shared_ptr<StateValuation const> valuation;
     };
 
     StateValuations() = default;
@@ -95,9 +107,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
 
     bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-    int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
-    storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex,
-                                                  storm::expressions::Variable const& rationalVariable) const;
+    int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+    storm::RationalNumber getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const;
     /// Returns true, if this valuation does not contain any value.
     bool isEmpty(storm::storage::sparse::state_type const& stateIndex) const;
 
@@ -122,6 +133,11 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     // Returns the (current) number of states that this object describes.
     uint_fast64_t getNumberOfStates() const;
 
+    /*!
+     * Retrieves whether only the compressed states are stored, such that the valuation of a state is derived whenever it is queried.
+     */
+    bool isLazy() const;
+
     /*
      * Derive new state valuations from this by selecting the given states.
      */
@@ -139,13 +155,31 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
 
    private:
     StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
+    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, uint64_t bitsPerState,
+                    CompressedStateDecoder const& decoder, storm::storage::BitVector&& compressedStates, storm::storage::BitVector&& storedStates);
     bool assertValuation(StateValuation const& valuation) const;
-    StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+
+    /*!
+     * Retrieves the valuation of the given state. For lazy valuations, the valuation is decoded from the compressed state and owned by the result.
+     */
+    std::shared_ptr<StateValuation const> getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+
+    /*!
+     * Derives the lazy valuations for the given states (where an invalid state yields an empty valuation).
+     */
+    StateValuations selectCompressedStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const;
 
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
     std::map<std::string, uint64_t> observationLabels;
     // A mapping from state indices to their variable valuations.
     std::vector<StateValuation> valuations;
+
+    // For lazy valuations, the compressed states (each consisting of bitsPerState bits, in the order of the state indices) and the function that
+    // derives the valuations from them. The states for which no compressed state was added have an empty valuation.
+    uint64_t bitsPerState = 0;
+    CompressedStateDecoder decoder;
+    storm::storage::BitVector compressedStates;
+    storm::storage::BitVector storedStates;
 };
 
 class StateValuationsBuilder {
@@ -159,6 +193,23 @@ class StateValuationsBuilder {
 
     void addObservationLabel(std::string const& label);
 
+    /*!
+     * Makes the state valuations lazy: Only the compressed states (consisting of the given number of bits) are stored and the valuation of a state is
+     * derived with the given decoder whenever it is queried. All variables need to be added and no observation labels may be added before.
+     * The states then need to be added via addCompressedState.
+     */
+    void setCompressedStateDecoder(uint64_t bitsPerState, StateValuations::CompressedStateDecoder const& decoder);
+
+    /*!
+     * Retrieves whether the state valuations are lazy, see setCompressedStateDecoder.
+     */
+    bool isLazy() const;
+
+    /*!
+     * Adds a new state via its compressed representation. This requires lazy state valuations.
+     */
+    void addCompressedState(storm::storage::sparse::state_type const& state, storm::storage::BitVector const& compressedState);
+
     /*!
      * Adds a new state.
      * The variable values have to be given in the same order as the variables have been added.
@@ -183,6 +234,8 @@ class StateValuationsBuilder {
     uint64_t integerVarCount;
     uint64_t rationalVarCount;
     uint64_t labelCount;
+    // The number of states (including the states without valuation) of lazy state valuations.
+    uint64_t compressedStateCount;
 };
 }  // namespace sparse
 }  // namespace storage
@@ -15,6 +15,23 @@ class DAProductBuilder {
     DAProductBuilder(const storm::automata::DeterministicAutomaton& da, const std::vector<storm::storage::BitVector>& statesForAP)
         : da(da), statesForAP(statesForAP) {}
 
+    /*!
+     * Sets whether the exploration stops at product states whose automaton state is a sink.
+     * Such product states are made absorbing: as the automaton never leaves the sink, the acceptance of all runs through the product state
+     * is already decided and the model states behind it need not be explored.
+     * The resulting product is only suitable for computing acceptance probabilities. In particular, choices of absorbing states do not
+     * correspond to choices of the original model.
+     */
+    void setTruncateAtSinks(bool truncate) {
+        sinks.clear();
+        if (truncate) {
+            sinks.resize(da.getNumberOfStates());
+            for (std::size_t q = 0; q < da.getNumberOfStates(); ++q) {
+                sinks[q] = da.isSink(q);
+            }
+        }
+    }
+
     template<typename Model>
     typename DAProduct<Model>::ptr build(const Model& originalModel, const storm::storage::BitVector& statesOfInterest) const {
         return build<Model>(originalModel.getTransitionMatrix(), statesOfInterest);
@@ -38,9 +55,15 @@ class DAProductBuilder {
         return da.getSuccessor(automatonFrom, getLabelForState(modelTo));
     }
 
+    bool isAbsorbing(storm::storage::sparse::state_type automatonState) const {
+        return !sinks.empty() && sinks[automatonState];
+    }
+
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
+    // Automaton states at which the exploration stops. Empty if the product is not truncated.
+    std::vector<bool> sinks;
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
         storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
@@ -87,6 +87,15 @@ std::shared_ptr<SparseModelType> MemoryIncorporation<SparseModelType>::incorpora
     }
 
     storm::storage::SparseModelMemoryProduct<ValueType> product = memory.product(model);
+    // Only the reward models that are referenced by the formulas need to be translated to the product. If the formulas refer to the unnamed
+    // reward model, all reward models are kept so that the check for a unique reward model is not affected.
+    std::set<std::string> referencedRewardModels;
+    for (auto const& subFormula : formulas) {
+        subFormula->gatherReferencedRewardModels(referencedRewardModels);
+    }
+    if (referencedRewardModels.count("") == 0) {
+        product.setRewardModelsToBuild(referencedRewardModels);
+    }
     return std::dynamic_pointer_cast<SparseModelType>(product.build());
 }
 
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace storm {
+namespace transformer {
+
+// An enum that contains all orderings that can be used to renumber the states of an explicit model for a better memory locality.
+enum class StateOrdering { ReverseCuthillMcKee, SccTopological, RecursiveBisection };
+
+}  // namespace transformer
+}  // namespace storm
@@ -0,0 +1,445 @@
+#include "storm/transformer/StateReorderer.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace transformer {
+
+namespace {
+
+// Parts of the graph with at most this many states are not split any further by the recursive bisection.
+uint64_t const bisectionLeafSize = 256;
+
+/*!
+ * The underlying undirected graph of a transition matrix without self-loops. For every state, the neighbors are stored consecutively.
+ */
+class UndirectedGraph {
+   public:
+    template<typename ValueType>
+    UndirectedGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) : offsets(transitionMatrix.getRowGroupCount() + 1, 0) {
+        uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+
+        // First count the edges (including duplicates), then insert them in both directions.
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                if (entry.getColumn() != state) {
+                    ++offsets[state + 1];
+                    ++offsets[entry.getColumn() + 1];
+                }
+            }
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        neighbors.resize(offsets.back());
+        std::vector<uint64_t> nextPosition(offsets.begin(), offsets.end() - 1);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                if (entry.getColumn() != state) {
+                    neighbors[nextPosition[state]++] = entry.getColumn();
+                    neighbors[nextPosition[entry.getColumn()]++] = state;
+                }
+            }
+        }
+
+        // Remove the duplicates.
+        uint64_t newEnd = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            auto begin = neighbors.begin() + offsets[state];
+            auto end = neighbors.begin() + offsets[state + 1];
+            std::sort(begin, end);
+            end = std::unique(begin, end);
+            offsets[state] = newEnd;
+            newEnd = std::copy(begin, end, neighbors.begin() + newEnd) - neighbors.begin();
+        }
+        offsets[numberOfStates] = newEnd;
+        neighbors.resize(newEnd);
+        neighbors.shrink_to_fit();
+    }
+
+    uint64_t getNumberOfStates() const {
+        return offsets.size() - 1;
+    }
+
+    uint64_t getDegree(uint64_t state) const {
+        return offsets[state + 1] - offsets[state];
+    }
+
+    std::vector<uint64_t>::const_iterator beginNeighbors(uint64_t state) const {
+        return neighbors.begin() + offsets[state];
+    }
+
+    std::vector<uint64_t>::const_iterator endNeighbors(uint64_t state) const {
+        return neighbors.begin() + offsets[state + 1];
+    }
+
+   private:
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> neighbors;
+};
+
+/*!
+ * Performs breadth-first searches on an undirected graph that are optionally restricted to a region of the graph.
+ */
+class BreadthFirstSearch {
+   public:
+    struct Result {
+        // The number of levels of the search.
+        uint64_t numberOfLevels;
+        // The position in the order at which the states of the last level begin.
+        uint64_t lastLevelBegin;
+    };
+
+    BreadthFirstSearch(UndirectedGraph const& graph) : graph(graph), visitedStamps(graph.getNumberOfStates(), 0), currentStamp(0) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Appends the states reachable from the given state to the given order. If a region is given, only states in the same region as the start
+     * state are visited. If requested, the newly discovered neighbors of every state are appended by increasing degree.
+     */
+    Result search(uint64_t start, std::vector<uint64_t> const* region, std::vector<uint64_t>& order, bool sortByDegree) {
+        ++currentStamp;
+        Result result{0, order.size()};
+        visitedStamps[start] = currentStamp;
+        order.push_back(start);
+        uint64_t levelBegin = result.lastLevelBegin;
+        uint64_t levelEnd = order.size();
+        while (levelBegin < levelEnd) {
+            result.lastLevelBegin = levelBegin;
+            ++result.numberOfLevels;
+            for (uint64_t position = levelBegin; position < levelEnd; ++position) {
+                uint64_t state = order[position];
+                uint64_t discoveredBegin = order.size();
+                for (auto it = graph.beginNeighbors(state), ite = graph.endNeighbors(state); it != ite; ++it) {
+                    if (visitedStamps[*it] != currentStamp && (!region || (*region)[*it] == (*region)[start])) {
+                        visitedStamps[*it] = currentStamp;
+                        order.push_back(*it);
+                    }
+                }
+                if (sortByDegree) {
+                    std::stable_sort(order.begin() + discoveredBegin, order.end(),
+                                     [this](uint64_t first, uint64_t second) { return graph.getDegree(first) < graph.getDegree(second); });
+                }
+            }
+            levelBegin = levelEnd;
+            levelEnd = order.size();
+        }
+        return result;
+    }
+
+    /*!
+     * Searches a pseudo-peripheral state, i.e., a state whose breadth-first search has many levels, in the component of the given state
+     * (following George and Liu).
+     */
+    uint64_t findPseudoPeripheralState(uint64_t start, std::vector<uint64_t> const* region) {
+        std::vector<uint64_t> order;
+        Result result = search(start, region, order, false);
+        while (true) {
+            // Continue with a state of minimal degree in the last level as long as the number of levels increases.
+            uint64_t candidate = *std::min_element(order.begin() + result.lastLevelBegin, order.end(), [this](uint64_t first, uint64_t second) {
+                return graph.getDegree(first) < graph.getDegree(second);
+            });
+            order.clear();
+            Result candidateResult = search(candidate, region, order, false);
+            if (candidateResult.numberOfLevels <= result.numberOfLevels) {
+                return candidate;
+            }
+            result = candidateResult;
+        }
+    }
+
+   private:
+    UndirectedGraph const& graph;
+
+    // Marks the states visited by the current search (with the current stamp). This avoids resetting the marks between the searches.
+    std::vector<uint64_t> visitedStamps;
+    uint64_t currentStamp;
+};
+
+std::vector<uint64_t> computeReverseCuthillMcKeeOrdering(UndirectedGraph const& graph) {
+    uint64_t const numberOfStates = graph.getNumberOfStates();
+    std::vector<uint64_t> statesByDegree(numberOfStates);
+    std::iota(statesByDegree.begin(), statesByDegree.end(), 0);
+    std::stable_sort(statesByDegree.begin(), statesByDegree.end(),
+                     [&graph](uint64_t first, uint64_t second) { return graph.getDegree(first) < graph.getDegree(second); });
+
+    // Number the components one after the other, starting each from a pseudo-peripheral state that is found from a state of minimal degree.
+    BreadthFirstSearch bfs(graph);
+    std::vector<uint64_t> result;
+    result.reserve(numberOfStates);
+    storm::storage::BitVector visited(numberOfStates);
+    for (auto state : statesByDegree) {
+        if (visited.get(state)) {
+            continue;
+        }
+        uint64_t componentBegin = result.size();
+        bfs.search(bfs.findPseudoPeripheralState(state, nullptr), nullptr, result, true);
+        for (uint64_t position = componentBegin; position < result.size(); ++position) {
+            visited.set(result[position]);
+        }
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+std::vector<uint64_t> computeRecursiveBisectionOrdering(UndirectedGraph const& graph) {
+    uint64_t const numberOfStates = graph.getNumberOfStates();
+    std::vector<uint64_t> result(numberOfStates);
+    std::iota(result.begin(), result.end(), 0);
+
+    // Every part of the current partition of the graph occupies a range of the result and is identified by a region index.
+    std::vector<uint64_t> region(numberOfStates, 0);
+    uint64_t numberOfRegions = 1;
+    std::vector<std::pair<uint64_t, uint64_t>> rangesToSplit = {{0, numberOfStates}};
+
+    BreadthFirstSearch bfs(graph);
+    storm::storage::BitVector ordered(numberOfStates);
+    std::vector<uint64_t> partOrder;
+    while (!rangesToSplit.empty()) {
+        auto range = rangesToSplit.back();
+        rangesToSplit.pop_back();
+        if (range.second - range.first <= bisectionLeafSize) {
+            continue;
+        }
+
+        // Order the states of the part along breadth-first searches from pseudo-peripheral states (one for every component of the part).
+        partOrder.clear();
+        for (uint64_t position = range.first; position < range.second; ++position) {
+            ordered.set(result[position], false);
+        }
+        for (uint64_t position = range.first; position < range.second; ++position) {
+            uint64_t state = result[position];
+            if (ordered.get(state)) {
+                continue;
+            }
+            uint64_t componentBegin = partOrder.size();
+            bfs.search(bfs.findPseudoPeripheralState(state, &region), &region, partOrder, false);
+            for (uint64_t componentPosition = componentBegin; componentPosition < partOrder.size(); ++componentPosition) {
+                ordered.set(partOrder[componentPosition]);
+            }
+        }
+        STORM_LOG_ASSERT(partOrder.size() == range.second - range.first, "Breadth-first search did not visit all states of the part.");
+        std::copy(partOrder.begin(), partOrder.end(), result.begin() + range.first);
+
+        // Split the part in the middle of the order. The states of the second half form a new region.
+        uint64_t middle = range.first + (range.second - range.first) / 2;
+        for (uint64_t position = middle; position < range.second; ++position) {
+            region[result[position]] = numberOfRegions;
+        }
+        ++numberOfRegions;
+        rangesToSplit.emplace_back(middle, range.second);
+        rangesToSplit.emplace_back(range.first, middle);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> computeSccTopologicalOrdering(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> decomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<uint64_t> result;
+    result.reserve(transitionMatrix.getRowGroupCount());
+    for (auto const& scc : decomposition) {
+        result.insert(result.end(), scc.begin(), scc.end());
+    }
+    return result;
+}
+
+/*!
+ * Builds the matrix whose rows are the given rows of the original matrix and whose columns are renamed according to the given mapping.
+ */
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> permuteMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& newToOldRows,
+                                                      std::vector<uint64_t> const& oldToNewColumns, std::vector<uint64_t> const* newRowGroupIndices) {
+    storm::storage::SparseMatrixBuilder<ValueType> builder(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount(), true,
+                                                           newRowGroupIndices != nullptr, newRowGroupIndices ? newRowGroupIndices->size() - 1 : 0);
+    std::vector<storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>> rowEntries;
+    uint64_t group = 0;
+    for (uint64_t row = 0; row < newToOldRows.size(); ++row) {
+        if (newRowGroupIndices) {
+            while ((*newRowGroupIndices)[group] == row && group + 1 < newRowGroupIndices->size()) {
+                builder.newRowGroup(row);
+                ++group;
+            }
+        }
+        rowEntries.clear();
+        for (auto const& entry : matrix.getRow(newToOldRows[row])) {
+            rowEntries.emplace_back(oldToNewColumns[entry.getColumn()], entry.getValue());
+        }
+        std::sort(rowEntries.begin(), rowEntries.end(), [](auto const& first, auto const& second) { return first.getColumn() < second.getColumn(); });
+        for (auto const& entry : rowEntries) {
+            builder.addNextValue(row, entry.getColumn(), entry.getValue());
+        }
+    }
+    if (newRowGroupIndices) {
+        // Add the trailing empty row groups.
+        for (; group + 1 < newRowGroupIndices->size(); ++group) {
+            builder.newRowGroup(newToOldRows.size());
+        }
+    }
+    return builder.build();
+}
+
+}  // namespace
+
+template<typename ValueType>
+std::vector<uint64_t> computeStateOrdering(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StateOrdering const& ordering) {
+    STORM_LOG_THROW(transitionMatrix.getRowGroupCount() == transitionMatrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "Unable to order the states of a transition matrix that has " << transitionMatrix.getRowGroupCount() << " row groups but "
+                                                                                  << transitionMatrix.getColumnCount() << " columns.");
+    switch (ordering) {
+        case StateOrdering::ReverseCuthillMcKee:
+            return computeReverseCuthillMcKeeOrdering(UndirectedGraph(transitionMatrix));
+        case StateOrdering::SccTopological:
+            return computeSccTopologicalOrdering(transitionMatrix);
+        case StateOrdering::RecursiveBisection:
+            return computeRecursiveBisectionOrdering(UndirectedGraph(transitionMatrix));
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown state ordering.");
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping) {
+    uint64_t const numberOfStates = originalModel.getNumberOfStates();
+    STORM_LOG_THROW(newToOldStateIndexMapping.size() == numberOfStates, storm::exceptions::InvalidArgumentException,
+                    "The state permutation has size " << newToOldStateIndexMapping.size() << " but the model has " << numberOfStates << " states.");
+    std::vector<uint64_t> oldToNewStateIndexMapping(numberOfStates, std::numeric_limits<uint64_t>::max());
+    for (uint64_t newState = 0; newState < numberOfStates; ++newState) {
+        uint64_t oldState = newToOldStateIndexMapping[newState];
+        STORM_LOG_THROW(oldState < numberOfStates && oldToNewStateIndexMapping[oldState] == std::numeric_limits<uint64_t>::max(),
+                        storm::exceptions::InvalidArgumentException, "The given state mapping is not a permutation.");
+        oldToNewStateIndexMapping[oldState] = newState;
+    }
+
+    // The choices of every state keep their order.
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = originalModel.getTransitionMatrix();
+    std::vector<uint64_t> newToOldChoiceIndexMapping;
+    newToOldChoiceIndexMapping.reserve(transitionMatrix.getRowCount());
+    std::vector<uint64_t> newRowGroupIndices = {0};
+    newRowGroupIndices.reserve(numberOfStates + 1);
+    for (auto oldState : newToOldStateIndexMapping) {
+        for (auto choice : transitionMatrix.getRowGroupIndices(oldState)) {
+            newToOldChoiceIndexMapping.push_back(choice);
+        }
+        newRowGroupIndices.push_back(newToOldChoiceIndexMapping.size());
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(permuteMatrix(
+        transitionMatrix, newToOldChoiceIndexMapping, oldToNewStateIndexMapping, transitionMatrix.hasTrivialRowGrouping() ? nullptr : &newRowGroupIndices));
+    components.stateLabeling = originalModel.getStateLabeling();
+    components.stateLabeling.permuteItems(newToOldStateIndexMapping);
+    for (auto const& rewardModel : originalModel.getRewardModels()) {
+        std::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
+        std::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
+        std::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
+        if (rewardModel.second.hasStateRewards()) {
+            stateRewardVector = storm::utility::vector::applyInversePermutation(newToOldStateIndexMapping, rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            stateActionRewardVector =
+                storm::utility::vector::applyInversePermutation(newToOldChoiceIndexMapping, rewardModel.second.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            auto const& rewardMatrix = rewardModel.second.getTransitionRewardMatrix();
+            transitionRewardMatrix = permuteMatrix(rewardMatrix, newToOldChoiceIndexMapping, oldToNewStateIndexMapping,
+                                                   rewardMatrix.hasTrivialRowGrouping() ? nullptr : &newRowGroupIndices);
+        }
+        components.rewardModels.emplace(rewardModel.first,
+                                        RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix)));
+    }
+    if (originalModel.hasChoiceLabeling()) {
+        components.choiceLabeling = originalModel.getChoiceLabeling();
+        components.choiceLabeling->permuteItems(newToOldChoiceIndexMapping);
+    }
+    if (originalModel.hasStateValuations()) {
+        components.stateValuations = originalModel.getStateValuations().selectStates(newToOldStateIndexMapping);
+    }
+    if (originalModel.hasChoiceOrigins()) {
+        components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(newToOldChoiceIndexMapping);
+    }
+
+    switch (originalModel.getType()) {
+        case storm::models::ModelType::Dtmc:
+        case storm::models::ModelType::Mdp:
+            break;
+        case storm::models::ModelType::Ctmc: {
+            auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+            components.exitRates = storm::utility::vector::applyInversePermutation(newToOldStateIndexMapping, ctmc.getExitRateVector());
+            components.rateTransitions = true;
+            break;
+        }
+        case storm::models::ModelType::MarkovAutomaton: {
+            auto const& ma = *originalModel.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+            components.markovianStates = ma.getMarkovianStates().permute(newToOldStateIndexMapping);
+            components.exitRates = storm::utility::vector::applyInversePermutation(newToOldStateIndexMapping, ma.getExitRates());
+            components.rateTransitions = false;  // Note that the transition matrix of a Markov automaton contains probabilities.
+            break;
+        }
+        case storm::models::ModelType::Pomdp: {
+            // As the order of the choices within a state is kept, a canonic POMDP stays canonic.
+            auto const& pomdp = *originalModel.template as<storm::models::sparse::Pomdp<ValueType, RewardModelType>>();
+            components.observabilityClasses = storm::utility::vector::applyInversePermutation(newToOldStateIndexMapping, pomdp.getObservations());
+            if (pomdp.hasObservationValuations()) {
+                components.observationValuations = pomdp.getObservationValuations();
+            }
+            return std::make_shared<storm::models::sparse::Pomdp<ValueType, RewardModelType>>(std::move(components), pomdp.isCanonic());
+        }
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                            "Renumbering the states of a model of type " << originalModel.getType() << " is not supported.");
+    }
+    return storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> reorderStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, StateOrdering const& ordering) {
+    return permuteStates(originalModel, computeStateOrdering(originalModel.getTransitionMatrix(), ordering));
+}
+
+template std::vector<uint64_t> computeStateOrdering(storm::storage::SparseMatrix<double> const& transitionMatrix, StateOrdering const& ordering);
+template std::shared_ptr<storm::models::sparse::Model<double>> permuteStates(storm::models::sparse::Model<double> const& originalModel,
+                                                                             std::vector<uint64_t> const& newToOldStateIndexMapping);
+template std::shared_ptr<storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<storm::Interval>>> permuteStates(
+    storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<storm::Interval>> const& originalModel,
+    std::vector<uint64_t> const& newToOldStateIndexMapping);
+template std::shared_ptr<storm::models::sparse::Model<double>> reorderStates(storm::models::sparse::Model<double> const& originalModel,
+                                                                             StateOrdering const& ordering);
+template std::shared_ptr<storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<storm::Interval>>> reorderStates(
+    storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<storm::Interval>> const& originalModel,
+    StateOrdering const& ordering);
+
+template std::vector<uint64_t> computeStateOrdering(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                    StateOrdering const& ordering);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> permuteStates(
+    storm::models::sparse::Model<storm::RationalNumber> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> reorderStates(
+    storm::models::sparse::Model<storm::RationalNumber> const& originalModel, StateOrdering const& ordering);
+
+template std::vector<uint64_t> computeStateOrdering(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                    StateOrdering const& ordering);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> permuteStates(
+    storm::models::sparse::Model<storm::RationalFunction> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> reorderStates(
+    storm::models::sparse::Model<storm::RationalFunction> const& originalModel, StateOrdering const& ordering);
+
+}  // namespace transformer
+}  // namespace storm
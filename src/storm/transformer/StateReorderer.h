@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/transformer/StateOrdering.h"
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * Computes a renumbering of the states of the given transition matrix that improves the locality of the accesses to the columns.
+ *
+ * - ReverseCuthillMcKee performs the reverse Cuthill-McKee algorithm on the underlying undirected graph, which reduces the bandwidth of the
+ *   matrix, i.e., the distance of the columns of every row to the diagonal.
+ * - SccTopological numbers the strongly connected components in a topological order such that successor components come first. Within an SCC,
+ *   the original order of the states is kept.
+ * - RecursiveBisection recursively splits the underlying undirected graph into two parts along a breadth-first search and numbers the states
+ *   of each part consecutively. Much like a nested dissection, this keeps densely connected regions together.
+ *
+ * @param transitionMatrix The transition matrix of the model. Row groups (if any) are interpreted as the choices of a state.
+ * @param ordering The ordering to compute.
+ * @return For each new state index, the corresponding state index of the original matrix.
+ */
+template<typename ValueType>
+std::vector<uint64_t> computeStateOrdering(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StateOrdering const& ordering);
+
+/*!
+ * Renumbers the states of the given model according to the given permutation. The transition matrix, the labelings, the reward models, the state
+ * valuations, the choice origins and the model-specific components are all permuted consistently. The order of the choices within a state is
+ * kept.
+ *
+ * @param originalModel The model whose states are to be renumbered.
+ * @param newToOldStateIndexMapping For each state of the resulting model, the corresponding state of the original model.
+ * @return The model with renumbered states.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping);
+
+/*!
+ * Renumbers the states of the given model according to the given ordering. See computeStateOrdering and permuteStates for details.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> reorderStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, StateOrdering const& ordering);
+
+}  // namespace transformer
+}  // namespace storm
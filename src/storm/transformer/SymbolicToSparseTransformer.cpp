@@ -1,10 +1,15 @@
 #include "SymbolicToSparseTransformer.h"
 
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/logic/AtomicExpressionFormula.h"
 #include "storm/logic/AtomicLabelFormula.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -35,6 +40,92 @@ struct LabelInformation {
     std::map<std::string, storm::expressions::Expression> expressionLabels;
 };
 
+/*!
+ * Translates the given state sets to bit vectors over the states of the given ODD. Instead of traversing the ODD once per set, blocks of sets are encoded
+ * in a single ADD whose value in a state has the i-th bit set iff the state is contained in the i-th set of the block. The encoding is then translated in a
+ * single traversal and decoded into the bit vectors (concurrently, if Intel TBB is enabled).
+ */
+template<storm::dd::DdType Type>
+std::vector<storm::storage::BitVector> translateStateSets(std::vector<storm::dd::Bdd<Type>> const& stateSets, storm::dd::Odd const& odd) {
+    // Bounds the size of the encoding, which can have a leaf for every combination of sets of the block.
+    uint64_t const setsPerBlock = 16;
+    uint64_t const numberOfStates = odd.getTotalOffset();
+    std::vector<storm::storage::BitVector> result(stateSets.size());
+    for (uint64_t blockStart = 0; blockStart < stateSets.size(); blockStart += setsPerBlock) {
+        uint64_t const blockEnd = std::min<uint64_t>(blockStart + setsPerBlock, stateSets.size());
+        if (blockEnd - blockStart == 1) {
+            result[blockStart] = stateSets[blockStart].toVector(odd);
+            continue;
+        }
+        auto const& manager = stateSets[blockStart].getDdManager();
+        storm::dd::Add<Type, uint_fast64_t> encoding = manager.template getAddZero<uint_fast64_t>();
+        for (uint64_t index = blockStart; index < blockEnd; ++index) {
+            uint_fast64_t const bit = 1ull << (index - blockStart);
+            encoding += stateSets[index].ite(manager.template getConstant<uint_fast64_t>(bit), manager.template getAddZero<uint_fast64_t>());
+        }
+        std::vector<uint_fast64_t> const encodedValues = encoding.toVector(odd);
+
+        auto decode = [&](uint64_t index) {
+            uint_fast64_t const bit = 1ull << (index - blockStart);
+            storm::storage::BitVector& stateSet = result[index];
+            stateSet = storm::storage::BitVector(numberOfStates);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (encodedValues[state] & bit) {
+                    stateSet.set(state);
+                }
+            }
+        };
+#ifdef STORM_HAVE_INTELTBB
+        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            // Each set is decoded into its own bit vector, so no synchronization is needed.
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(blockStart, blockEnd), [&decode](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                    decode(index);
+                }
+            });
+            continue;
+        }
+#endif
+        for (uint64_t index = blockStart; index < blockEnd; ++index) {
+            decode(index);
+        }
+    }
+    return result;
+}
+
+/*!
+ * Translates the labels of the given symbolic model. If formulas are given, only the labels (and expressions) occurring in them are translated.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+storm::models::sparse::StateLabeling translateStateLabeling(storm::models::symbolic::Model<Type, ValueType> const& symbolicModel, storm::dd::Odd const& odd,
+                                                            std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    std::vector<std::string> labels = {"init", "deadlock"};
+    std::vector<storm::dd::Bdd<Type>> stateSets = {symbolicModel.getInitialStates(), symbolicModel.getDeadlockStates()};
+    if (formulas.empty()) {
+        for (auto const& label : symbolicModel.getLabels()) {
+            labels.push_back(label);
+            stateSets.push_back(symbolicModel.getStates(label));
+        }
+    } else {
+        LabelInformation labelInfo(formulas);
+        for (auto const& label : labelInfo.atomicLabels) {
+            labels.push_back(label);
+            stateSets.push_back(symbolicModel.getStates(label));
+        }
+        for (auto const& expressionLabel : labelInfo.expressionLabels) {
+            labels.push_back(expressionLabel.first);
+            stateSets.push_back(symbolicModel.getStates(expressionLabel.second));
+        }
+    }
+
+    storm::models::sparse::StateLabeling labelling(odd.getTotalOffset());
+    std::vector<storm::storage::BitVector> labelledStates = translateStateSets(stateSets, odd);
+    for (uint64_t index = 0; index < labels.size(); ++index) {
+        labelling.addLabel(labels[index], std::move(labelledStates[index]));
+    }
+    return labelling;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
     storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
@@ -57,24 +148,8 @@ std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmc
         rewardModels.emplace(rewardModelNameAndModel.first,
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicDtmc.getInitialStates().toVector(this->odd));
-    labelling.addLabel("deadlock", symbolicDtmc.getDeadlockStates().toVector(this->odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicDtmc.getLabels()) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd));
-        }
-    }
-    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(transitionMatrix, labelling, rewardModels);
+    storm::models::sparse::StateLabeling labelling = translateStateLabeling(symbolicDtmc, this->odd, formulas);
+    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -126,25 +201,9 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicMdp.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMdp.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMdp.getLabels()) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMdp.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateStateLabeling(symbolicMdp, odd, formulas);
 
-    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -169,25 +228,9 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
         rewardModels.emplace(rewardModelNameAndModel.first,
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicCtmc.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicCtmc.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicCtmc.getLabels()) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicCtmc.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateStateLabeling(symbolicCtmc, odd, formulas);
 
-    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -233,23 +276,7 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicMa.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMa.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMa.getLabels()) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMa.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateStateLabeling(symbolicMa, odd, formulas);
     storm::storage::BitVector markovianStates = symbolicMa.getMarkovianStates().toVector(odd);
     storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels), false,
                                                                   std::move(markovianStates));
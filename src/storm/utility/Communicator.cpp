@@ -0,0 +1,196 @@
+#include "storm/utility/Communicator.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#ifdef STORM_HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace detail {
+
+template<typename T>
+std::vector<std::vector<T>> exchangeViaMailboxes(std::vector<std::vector<T>>& mailboxes, std::vector<std::vector<T>> const& values, uint64_t rank,
+                                                 uint64_t size, std::function<void()> const& barrier) {
+    STORM_LOG_THROW(values.size() == size, storm::exceptions::InvalidArgumentException, "Expected one vector of values for each member of the group.");
+    for (uint64_t receiver = 0; receiver < size; ++receiver) {
+        mailboxes[rank * size + receiver] = values[receiver];
+    }
+    barrier();
+    std::vector<std::vector<T>> result(size);
+    for (uint64_t sender = 0; sender < size; ++sender) {
+        result[sender] = std::move(mailboxes[sender * size + rank]);
+    }
+    // Nobody may write to the mailboxes again before all members have emptied them.
+    barrier();
+    return result;
+}
+
+}  // namespace detail
+
+ThreadCommunicator::Group::Group(uint64_t size)
+    : size(size), waiting(0), generation(0), values(size), indexMailboxes(size * size), valueMailboxes(size * size) {
+    // Intentionally left empty.
+}
+
+void ThreadCommunicator::Group::barrier() {
+    std::unique_lock<std::mutex> lock(mutex);
+    uint64_t currentGeneration = generation;
+    if (++waiting == size) {
+        waiting = 0;
+        ++generation;
+        condition.notify_all();
+    } else {
+        condition.wait(lock, [&] { return generation != currentGeneration; });
+    }
+}
+
+ThreadCommunicator::ThreadCommunicator(std::shared_ptr<Group> const& group, uint64_t rank) : group(group), rank(rank) {
+    // Intentionally left empty.
+}
+
+std::vector<std::shared_ptr<Communicator>> ThreadCommunicator::createGroup(uint64_t size) {
+    STORM_LOG_THROW(size > 0, storm::exceptions::InvalidArgumentException, "A group needs at least one member.");
+    auto group = std::make_shared<Group>(size);
+    std::vector<std::shared_ptr<Communicator>> result;
+    for (uint64_t rank = 0; rank < size; ++rank) {
+        result.push_back(std::shared_ptr<Communicator>(new ThreadCommunicator(group, rank)));
+    }
+    return result;
+}
+
+uint64_t ThreadCommunicator::getRank() const {
+    return rank;
+}
+
+uint64_t ThreadCommunicator::getSize() const {
+    return group->size;
+}
+
+double ThreadCommunicator::allReduceMax(double value) {
+    group->values[rank] = value;
+    group->barrier();
+    double result = *std::max_element(group->values.begin(), group->values.end());
+    group->barrier();
+    return result;
+}
+
+double ThreadCommunicator::allReduceSum(double value) {
+    group->values[rank] = value;
+    group->barrier();
+    // All members sum up in the same order, so they obtain the same result.
+    double result = 0;
+    for (auto const& memberValue : group->values) {
+        result += memberValue;
+    }
+    group->barrier();
+    return result;
+}
+
+std::vector<uint64_t> ThreadCommunicator::allGather(uint64_t value) {
+    std::vector<std::vector<uint64_t>> values(group->size, std::vector<uint64_t>({value}));
+    std::vector<uint64_t> result;
+    for (auto const& memberValues : allToAll(values)) {
+        result.push_back(memberValues.front());
+    }
+    return result;
+}
+
+std::vector<std::vector<uint64_t>> ThreadCommunicator::allToAll(std::vector<std::vector<uint64_t>> const& values) {
+    return detail::exchangeViaMailboxes(group->indexMailboxes, values, rank, group->size, [this] { group->barrier(); });
+}
+
+std::vector<std::vector<double>> ThreadCommunicator::allToAll(std::vector<std::vector<double>> const& values) {
+    return detail::exchangeViaMailboxes(group->valueMailboxes, values, rank, group->size, [this] { group->barrier(); });
+}
+
+#ifdef STORM_HAVE_MPI
+namespace detail {
+
+template<typename T>
+std::vector<std::vector<T>> mpiAllToAll(std::vector<std::vector<T>> const& values, uint64_t size, MPI_Datatype datatype) {
+    STORM_LOG_THROW(values.size() == size, storm::exceptions::InvalidArgumentException, "Expected one vector of values for each member of the group.");
+    std::vector<int> sendCounts(size), sendOffsets(size), receiveCounts(size), receiveOffsets(size);
+    std::vector<T> sendBuffer;
+    for (uint64_t receiver = 0; receiver < size; ++receiver) {
+        STORM_LOG_THROW(values[receiver].size() <= static_cast<uint64_t>(std::numeric_limits<int>::max()), storm::exceptions::NotSupportedException,
+                        "Too many values for a single MPI message.");
+        sendCounts[receiver] = static_cast<int>(values[receiver].size());
+        sendOffsets[receiver] = static_cast<int>(sendBuffer.size());
+        sendBuffer.insert(sendBuffer.end(), values[receiver].begin(), values[receiver].end());
+    }
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    uint64_t numberOfReceivedValues = 0;
+    for (uint64_t sender = 0; sender < size; ++sender) {
+        receiveOffsets[sender] = static_cast<int>(numberOfReceivedValues);
+        numberOfReceivedValues += receiveCounts[sender];
+    }
+    std::vector<T> receiveBuffer(numberOfReceivedValues);
+    MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendOffsets.data(), datatype, receiveBuffer.data(), receiveCounts.data(), receiveOffsets.data(),
+                  datatype, MPI_COMM_WORLD);
+    std::vector<std::vector<T>> result(size);
+    for (uint64_t sender = 0; sender < size; ++sender) {
+        auto first = receiveBuffer.begin() + receiveOffsets[sender];
+        result[sender] = std::vector<T>(first, first + receiveCounts[sender]);
+    }
+    return result;
+}
+
+}  // namespace detail
+
+MpiCommunicator::MpiCommunicator() {
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    STORM_LOG_THROW(initialized, storm::exceptions::NotSupportedException, "MPI has not been initialized.");
+    int mpiRank, mpiSize;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    rank = mpiRank;
+    size = mpiSize;
+}
+
+uint64_t MpiCommunicator::getRank() const {
+    return rank;
+}
+
+uint64_t MpiCommunicator::getSize() const {
+    return size;
+}
+
+double MpiCommunicator::allReduceMax(double value) {
+    double result;
+    MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return result;
+}
+
+double MpiCommunicator::allReduceSum(double value) {
+    double result;
+    MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    return result;
+}
+
+std::vector<uint64_t> MpiCommunicator::allGather(uint64_t value) {
+    std::vector<uint64_t> result(size);
+    MPI_Allgather(&value, 1, MPI_UINT64_T, result.data(), 1, MPI_UINT64_T, MPI_COMM_WORLD);
+    return result;
+}
+
+std::vector<std::vector<uint64_t>> MpiCommunicator::allToAll(std::vector<std::vector<uint64_t>> const& values) {
+    return detail::mpiAllToAll(values, size, MPI_UINT64_T);
+}
+
+std::vector<std::vector<double>> MpiCommunicator::allToAll(std::vector<std::vector<double>> const& values) {
+    return detail::mpiAllToAll(values, size, MPI_DOUBLE);
+}
+#endif
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storm-config.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * The collective operations that the distributed solvers need from a group of processes. Every operation is collective, i.e., it has to be
+ * called by all members of the group in the same order.
+ */
+class Communicator {
+   public:
+    virtual ~Communicator() = default;
+
+    /*!
+     * Retrieves the index of the calling member within the group.
+     */
+    virtual uint64_t getRank() const = 0;
+
+    /*!
+     * Retrieves the number of members of the group.
+     */
+    virtual uint64_t getSize() const = 0;
+
+    /*!
+     * Retrieves the maximum of the given values of all members.
+     */
+    virtual double allReduceMax(double value) = 0;
+
+    /*!
+     * Retrieves the sum of the given values of all members.
+     */
+    virtual double allReduceSum(double value) = 0;
+
+    /*!
+     * Retrieves the given values of all members, ordered by rank.
+     */
+    virtual std::vector<uint64_t> allGather(uint64_t value) = 0;
+
+    /*!
+     * Sends the i-th of the given values to member i and retrieves the values that were sent to the calling member, ordered by the rank of the
+     * sender.
+     */
+    virtual std::vector<std::vector<uint64_t>> allToAll(std::vector<std::vector<uint64_t>> const& values) = 0;
+    virtual std::vector<std::vector<double>> allToAll(std::vector<std::vector<double>> const& values) = 0;
+};
+
+/*!
+ * A group whose members are threads of the same process. This allows to run (and test) the distributed solvers without MPI.
+ */
+class ThreadCommunicator : public Communicator {
+   public:
+    /*!
+     * Creates the members of a group of the given size. The i-th member has to be used by exactly one thread.
+     */
+    static std::vector<std::shared_ptr<Communicator>> createGroup(uint64_t size);
+
+    virtual uint64_t getRank() const override;
+    virtual uint64_t getSize() const override;
+    virtual double allReduceMax(double value) override;
+    virtual double allReduceSum(double value) override;
+    virtual std::vector<uint64_t> allGather(uint64_t value) override;
+    virtual std::vector<std::vector<uint64_t>> allToAll(std::vector<std::vector<uint64_t>> const& values) override;
+    virtual std::vector<std::vector<double>> allToAll(std::vector<std::vector<double>> const& values) override;
+
+   private:
+    // The state that is shared by all members of a group.
+    struct Group {
+        Group(uint64_t size);
+
+        void barrier();
+
+        uint64_t size;
+        std::mutex mutex;
+        std::condition_variable condition;
+        uint64_t waiting;
+        uint64_t generation;
+
+        // One slot per member for reductions and one mailbox per pair of sender and receiver.
+        std::vector<double> values;
+        std::vector<std::vector<uint64_t>> indexMailboxes;
+        std::vector<std::vector<double>> valueMailboxes;
+    };
+
+    ThreadCommunicator(std::shared_ptr<Group> const& group, uint64_t rank);
+
+    std::shared_ptr<Group> group;
+    uint64_t rank;
+};
+
+#ifdef STORM_HAVE_MPI
+/*!
+ * A group of MPI processes. MPI has to be initialized before and finalized after the communicator is used.
+ */
+class MpiCommunicator : public Communicator {
+   public:
+    /*!
+     * Creates a communicator for all processes (i.e., MPI_COMM_WORLD).
+     */
+    MpiCommunicator();
+
+    virtual uint64_t getRank() const override;
+    virtual uint64_t getSize() const override;
+    virtual double allReduceMax(double value) override;
+    virtual double allReduceSum(double value) override;
+    virtual std::vector<uint64_t> allGather(uint64_t value) override;
+    virtual std::vector<std::vector<uint64_t>> allToAll(std::vector<std::vector<uint64_t>> const& values) override;
+    virtual std::vector<std::vector<double>> allToAll(std::vector<std::vector<double>> const& values) override;
+
+   private:
+    uint64_t rank;
+    uint64_t size;
+};
+#endif
+
+}  // namespace utility
+}  // namespace storm
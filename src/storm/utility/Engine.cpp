@@ -5,6 +5,7 @@
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/simulation/SimulationModelChecker.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -50,6 +51,8 @@ std::string toString(Engine const& engine) {
             return "expl";
         case Engine::AbstractionRefinement:
             return "abs";
+        case Engine::Simulation:
+            return "sim";
         case Engine::Automatic:
             return "automatic";
         case Engine::Unknown:
@@ -93,6 +96,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
+        case Engine::Simulation:
+            return storm::builder::BuilderType::Explicit;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
             return storm::builder::BuilderType::Explicit;
@@ -155,6 +160,20 @@ bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicMod
                     return false;
             }
             break;
+        case Engine::Simulation:
+            switch (modelType) {
+                case ModelType::DTMC:
+                    return std::is_same<ValueType, double>::value &&
+                           storm::modelchecker::SimulationModelChecker<storm::models::sparse::Dtmc<double>>::canHandleStatic(
+                               checkTask.template convertValueType<double>());
+                case ModelType::MDP:
+                case ModelType::CTMC:
+                case ModelType::MA:
+                case ModelType::POMDP:
+                case ModelType::SMG:
+                    return false;
+            }
+            break;
         default:
             STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
     }
@@ -0,0 +1,154 @@
+#include "storm/utility/Instrumentation.h"
+
+#include <iomanip>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace utility {
+
+std::atomic<bool> Instrumentation::enabled(false);
+
+Instrumentation& Instrumentation::instance() {
+    static Instrumentation registry;
+    return registry;
+}
+
+void Instrumentation::setEnabled(bool value) {
+    enabled.store(value, std::memory_order_relaxed);
+}
+
+Instrumentation::Timer& Instrumentation::getTimer(std::string const& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return timers[name];
+}
+
+Instrumentation::Counter& Instrumentation::getCounter(std::string const& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters.try_emplace(name, 0).first->second;
+}
+
+uint64_t Instrumentation::getTimeInNanoseconds(std::string const& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = timers.find(name);
+    return it == timers.end() ? 0 : it->second.nanoseconds.load();
+}
+
+uint64_t Instrumentation::getNumberOfMeasurements(std::string const& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = timers.find(name);
+    return it == timers.end() ? 0 : it->second.measurements.load();
+}
+
+uint64_t Instrumentation::getCounterValue(std::string const& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = counters.find(name);
+    return it == counters.end() ? 0 : it->second.load();
+}
+
+std::vector<std::string> Instrumentation::getTimerNames() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> result;
+    for (auto const& nameTimerPair : timers) {
+        result.push_back(nameTimerPair.first);
+    }
+    return result;
+}
+
+std::vector<std::string> Instrumentation::getCounterNames() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> result;
+    for (auto const& nameCounterPair : counters) {
+        result.push_back(nameCounterPair.first);
+    }
+    return result;
+}
+
+void Instrumentation::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& nameTimerPair : timers) {
+        nameTimerPair.second.nanoseconds = 0;
+        nameTimerPair.second.measurements = 0;
+    }
+    for (auto& nameCounterPair : counters) {
+        nameCounterPair.second = 0;
+    }
+}
+
+namespace detail {
+// Retrieves the (nested) JSON object that corresponds to the given hierarchical name.
+storm::json<double>& getJsonNode(storm::json<double>& root, std::string const& name) {
+    storm::json<double>* node = &root;
+    std::size_t begin = 0;
+    while (true) {
+        std::size_t end = name.find('.', begin);
+        node = &(*node)[name.substr(begin, end == std::string::npos ? std::string::npos : end - begin)];
+        if (end == std::string::npos) {
+            return *node;
+        }
+        begin = end + 1;
+    }
+}
+}  // namespace detail
+
+storm::json<double> Instrumentation::toJson() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    storm::json<double> result = storm::json<double>::object();
+    for (auto const& nameTimerPair : timers) {
+        if (nameTimerPair.second.measurements > 0) {
+            storm::json<double>& node = detail::getJsonNode(result, nameTimerPair.first);
+            node["time"] = static_cast<double>(nameTimerPair.second.nanoseconds.load()) / 1e9;
+            node["measurements"] = nameTimerPair.second.measurements.load();
+        }
+    }
+    for (auto const& nameCounterPair : counters) {
+        if (nameCounterPair.second > 0) {
+            detail::getJsonNode(result, nameCounterPair.first)["count"] = nameCounterPair.second.load();
+        }
+    }
+    return result;
+}
+
+void Instrumentation::printToStream(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "\nInstrumentation:\n";
+    for (auto const& nameTimerPair : timers) {
+        uint64_t measurements = nameTimerPair.second.measurements;
+        if (measurements > 0) {
+            uint64_t milliseconds = nameTimerPair.second.nanoseconds / 1000000;
+            char oldFillChar = out.fill('0');
+            out << "  * " << nameTimerPair.first << ": " << (milliseconds / 1000) << "." << std::setw(3) << (milliseconds % 1000) << "s";
+            out.fill(oldFillChar);
+            out << " (" << measurements << (measurements == 1 ? " measurement)\n" : " measurements)\n");
+        }
+    }
+    for (auto const& nameCounterPair : counters) {
+        if (nameCounterPair.second > 0) {
+            out << "  * " << nameCounterPair.first << ": " << nameCounterPair.second << '\n';
+        }
+    }
+}
+
+InstrumentationTimer::InstrumentationTimer(Instrumentation::Timer& timer) : timer(Instrumentation::isEnabled() ? &timer : nullptr) {
+    if (this->timer) {
+        start = std::chrono::high_resolution_clock::now();
+    }
+}
+
+InstrumentationTimer::InstrumentationTimer(std::string const& name) : timer(nullptr) {
+    if (Instrumentation::isEnabled()) {
+        timer = &Instrumentation::instance().getTimer(name);
+        start = std::chrono::high_resolution_clock::now();
+    }
+}
+
+InstrumentationTimer::~InstrumentationTimer() {
+    if (timer) {
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+        timer->nanoseconds.fetch_add(duration.count(), std::memory_order_relaxed);
+        timer->measurements.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
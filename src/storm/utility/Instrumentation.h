@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/JsonForward.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * A registry of named timers and counters that can be used to attribute the runtime of a computation to its phases (e.g. parsing, building,
+ * precomputation, solving) without attaching a profiler.
+ *
+ * The names are hierarchical, where the levels are separated by dots, e.g. "modelchecking.precomputation.prob01". Timers accumulate the time of all
+ * their measurements and counters accumulate arbitrary quantities (e.g. the number of iterations of a solver).
+ * The instrumentation is disabled by default. In that case, measuring and counting only amounts to checking an atomic flag. Timers and counters are
+ * looked up once (typically in a static variable) and then updated without locking, so they can be used in hot code.
+ */
+class Instrumentation {
+   public:
+    /*!
+     * A timer accumulating the time of its measurements.
+     */
+    struct Timer {
+        std::atomic<uint64_t> nanoseconds{0};
+        std::atomic<uint64_t> measurements{0};
+    };
+
+    typedef std::atomic<uint64_t> Counter;
+
+    /*!
+     * Retrieves the (unique) registry.
+     */
+    static Instrumentation& instance();
+
+    /*!
+     * Retrieves whether measurements and counts are currently recorded.
+     */
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * Sets whether measurements and counts are recorded.
+     */
+    static void setEnabled(bool value);
+
+    /*!
+     * Retrieves the timer with the given name (and creates it if necessary). The reference stays valid as long as the program runs.
+     */
+    Timer& getTimer(std::string const& name);
+
+    /*!
+     * Retrieves the counter with the given name (and creates it if necessary). The reference stays valid as long as the program runs.
+     */
+    Counter& getCounter(std::string const& name);
+
+    /*!
+     * Retrieves the accumulated time of the timer with the given name (or zero if there is no such timer).
+     */
+    uint64_t getTimeInNanoseconds(std::string const& name) const;
+
+    /*!
+     * Retrieves the number of measurements of the timer with the given name (or zero if there is no such timer).
+     */
+    uint64_t getNumberOfMeasurements(std::string const& name) const;
+
+    /*!
+     * Retrieves the value of the counter with the given name (or zero if there is no such counter).
+     */
+    uint64_t getCounterValue(std::string const& name) const;
+
+    std::vector<std::string> getTimerNames() const;
+    std::vector<std::string> getCounterNames() const;
+
+    /*!
+     * Resets all timers and counters to zero. The timers and counters themselves remain valid.
+     */
+    void reset();
+
+    /*!
+     * Exports all timers and counters that were used as a JSON object, where each level of the names corresponds to a nested object. Timers are
+     * represented by their time (in seconds) and their number of measurements, counters by their count.
+     */
+    storm::json<double> toJson() const;
+
+    /*!
+     * Prints all timers and counters that were used to the given stream.
+     */
+    void printToStream(std::ostream& out) const;
+
+   private:
+    Instrumentation() = default;
+
+    mutable std::mutex mutex;
+    std::map<std::string, Timer> timers;
+    std::map<std::string, Counter> counters;
+
+    static std::atomic<bool> enabled;
+};
+
+/*!
+ * Measures the time between its construction and its destruction with the given timer (if the instrumentation was enabled upon construction).
+ */
+class InstrumentationTimer {
+   public:
+    InstrumentationTimer(Instrumentation::Timer& timer);
+    InstrumentationTimer(std::string const& name);
+    ~InstrumentationTimer();
+
+    InstrumentationTimer(InstrumentationTimer const&) = delete;
+    InstrumentationTimer& operator=(InstrumentationTimer const&) = delete;
+
+   private:
+    // The timer to which the measured time is added (or null if nothing is measured).
+    Instrumentation::Timer* timer;
+
+    std::chrono::high_resolution_clock::time_point start;
+};
+
+/*!
+ * Adds the given amount to the given counter (if the instrumentation is enabled).
+ */
+inline void incrementCounter(Instrumentation::Counter& counter, uint64_t amount = 1) {
+    if (Instrumentation::isEnabled()) {
+        counter.fetch_add(amount, std::memory_order_relaxed);
+    }
+}
+
+/*!
+ * Adds a measurement of the given duration to the given timer (if the instrumentation is enabled). This allows to record phases that were timed
+ * before the instrumentation was enabled, e.g. the startup of a tool.
+ */
+inline void addMeasurement(Instrumentation::Timer& timer, uint64_t nanoseconds) {
+    if (Instrumentation::isEnabled()) {
+        timer.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        timer.measurements.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,225 @@
+#include "storm/utility/LargeArray.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#ifdef LINUX
+#include <sys/syscall.h>
+#endif
+
+namespace storm {
+namespace utility {
+
+namespace detail {
+
+uint64_t const HugePageSize = 1ull << 21;
+
+// Allocations that are mapped explicitly are at least this large, such that smaller ones can be freed without looking them up.
+uint64_t const MinimalMappedBytes = 1ull << 12;
+
+LargeArrayOptions& getMutableOptions() {
+    static LargeArrayOptions options;
+    return options;
+}
+
+/*!
+ * The explicitly mapped allocations, which map the returned pointer to the start and length of the mapping.
+ */
+struct MappedAllocations {
+    std::mutex mutex;
+    std::unordered_map<void*, std::pair<void*, uint64_t>> mappings;
+};
+
+MappedAllocations& getMappedAllocations() {
+    static MappedAllocations allocations;
+    return allocations;
+}
+
+uint64_t getPageSize() {
+#if defined LINUX || defined MACOS
+    static uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+#else
+    return MinimalMappedBytes;
+#endif
+}
+
+uint64_t roundUp(uint64_t value, uint64_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+#ifdef LINUX
+/*!
+ * Retrieves the mask of the online NUMA nodes or an empty mask if there is only a single node.
+ */
+std::vector<unsigned long> const& getInterleaveNodeMask() {
+    static std::vector<unsigned long> const mask = []() {
+        std::vector<unsigned long> result;
+        std::ifstream file("/sys/devices/system/node/online");
+        std::string ranges;
+        if (!(file >> ranges)) {
+            return result;
+        }
+        uint64_t numberOfNodes = 0;
+        std::size_t position = 0;
+        while (position < ranges.size()) {
+            std::size_t end = ranges.find(',', position);
+            std::string range = ranges.substr(position, end == std::string::npos ? std::string::npos : end - position);
+            std::size_t dash = range.find('-');
+            uint64_t first = std::stoull(range.substr(0, dash));
+            uint64_t last = dash == std::string::npos ? first : std::stoull(range.substr(dash + 1));
+            for (uint64_t node = first; node <= last; ++node) {
+                uint64_t bitsPerWord = 8 * sizeof(unsigned long);
+                if (node / bitsPerWord >= result.size()) {
+                    result.resize(node / bitsPerWord + 1, 0);
+                }
+                result[node / bitsPerWord] |= 1ul << (node % bitsPerWord);
+                ++numberOfNodes;
+            }
+            position = end == std::string::npos ? ranges.size() : end + 1;
+        }
+        if (numberOfNodes < 2) {
+            result.clear();
+        }
+        return result;
+    }();
+    return mask;
+}
+#endif
+
+/*!
+ * Applies the huge page and interleaving options to the given page-aligned range. If the memory was already touched, its pages have to be moved
+ * to be interleaved.
+ */
+void adviseRange(void* data, uint64_t bytes, LargeArrayOptions const& options, bool moveExistingPages) {
+#ifdef LINUX
+#ifdef MADV_HUGEPAGE
+    if (options.hugePages && options.backingDirectory.empty()) {
+        STORM_LOG_WARN_COND(madvise(data, bytes, MADV_HUGEPAGE) == 0, "Unable to use transparent huge pages for " << bytes << " bytes.");
+    }
+#endif
+    if (options.interleave) {
+        auto const& mask = getInterleaveNodeMask();
+        if (!mask.empty()) {
+            // The values 3 and 2 are MPOL_INTERLEAVE and MPOL_MF_MOVE, which are not available without the headers of libnuma.
+            long status = syscall(SYS_mbind, data, bytes, 3, mask.data(), mask.size() * 8 * sizeof(unsigned long) + 1, moveExistingPages ? 2 : 0);
+            STORM_LOG_WARN_COND(status == 0, "Unable to interleave " << bytes << " bytes across the NUMA nodes.");
+        }
+    }
+#else
+    STORM_LOG_WARN_COND(!options.hugePages && !options.interleave, "Huge pages and NUMA interleaving are only supported on Linux.");
+#endif
+}
+
+#if defined LINUX || defined MACOS
+/*!
+ * Maps the given number of bytes and returns the returned pointer along with the start and length of the mapping.
+ */
+std::pair<void*, std::pair<void*, uint64_t>> map(uint64_t bytes, LargeArrayOptions const& options) {
+    if (!options.backingDirectory.empty()) {
+        uint64_t length = roundUp(bytes, getPageSize());
+        std::string path = options.backingDirectory + "/storm-XXXXXX";
+        int fileDescriptor = mkstemp(&path[0]);
+        STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::FileIoException, "Unable to create a backing file in '" << options.backingDirectory << "'.");
+        // The file is removed as soon as it is unmapped.
+        unlink(path.c_str());
+        bool resized = ftruncate(fileDescriptor, static_cast<off_t>(length)) == 0;
+        void* data = resized ? mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0) : MAP_FAILED;
+        close(fileDescriptor);
+        STORM_LOG_THROW(data != MAP_FAILED, storm::exceptions::FileIoException,
+                        "Unable to map " << length << " bytes from a backing file in '" << options.backingDirectory << "'.");
+        adviseRange(data, length, options, false);
+        return {data, {data, length}};
+    }
+
+    // Over-allocate, such that the array can start at the boundary of a huge page.
+    uint64_t alignment = options.hugePages ? HugePageSize : getPageSize();
+    uint64_t length = roundUp(bytes, alignment) + alignment - getPageSize();
+    void* mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    void* data = reinterpret_cast<void*>(roundUp(reinterpret_cast<uintptr_t>(mapping), alignment));
+    adviseRange(data, roundUp(bytes, alignment), options, false);
+    return {data, {mapping, length}};
+}
+#endif
+
+}  // namespace detail
+
+bool LargeArrayOptions::isSpecialAllocationSet() const {
+    return hugePages || interleave || !backingDirectory.empty();
+}
+
+LargeArrayOptions const& LargeArray::getOptions() {
+    return detail::getMutableOptions();
+}
+
+void LargeArray::setOptions(LargeArrayOptions const& options) {
+    detail::getMutableOptions() = options;
+}
+
+void* LargeArray::allocate(uint64_t bytes) {
+    LargeArrayOptions const& options = getOptions();
+#if defined LINUX || defined MACOS
+    if (options.isSpecialAllocationSet() && bytes >= std::max(options.threshold, detail::MinimalMappedBytes)) {
+        auto dataAndMapping = detail::map(bytes, options);
+        auto& allocations = detail::getMappedAllocations();
+        std::lock_guard<std::mutex> lock(allocations.mutex);
+        allocations.mappings.emplace(dataAndMapping.first, dataAndMapping.second);
+        return dataAndMapping.first;
+    }
+#endif
+    void* data = std::calloc(std::max<uint64_t>(bytes, 1), 1);
+    if (data == nullptr) {
+        throw std::bad_alloc();
+    }
+    return data;
+}
+
+void LargeArray::deallocate(void* data, uint64_t bytes) {
+    if (data == nullptr) {
+        return;
+    }
+#if defined LINUX || defined MACOS
+    if (bytes >= detail::MinimalMappedBytes) {
+        auto& allocations = detail::getMappedAllocations();
+        std::unique_lock<std::mutex> lock(allocations.mutex);
+        auto it = allocations.mappings.find(data);
+        if (it != allocations.mappings.end()) {
+            auto mapping = it->second;
+            allocations.mappings.erase(it);
+            lock.unlock();
+            munmap(mapping.first, mapping.second);
+            return;
+        }
+    }
+#endif
+    std::free(data);
+}
+
+void LargeArray::advise(void const* data, uint64_t bytes) {
+    LargeArrayOptions const& options = getOptions();
+    if (data == nullptr || (!options.hugePages && !options.interleave) || bytes < std::max(options.threshold, detail::MinimalMappedBytes)) {
+        return;
+    }
+    uintptr_t begin = detail::roundUp(reinterpret_cast<uintptr_t>(data), detail::getPageSize());
+    uintptr_t end = (reinterpret_cast<uintptr_t>(data) + bytes) / detail::getPageSize() * detail::getPageSize();
+    if (begin < end) {
+        // The backing directory does not apply to memory of other allocators.
+        LargeArrayOptions anonymousOptions = options;
+        anonymousOptions.backingDirectory.clear();
+        detail::adviseRange(reinterpret_cast<void*>(begin), end - begin, anonymousOptions, true);
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * The way in which large arrays (e.g. the buckets of bit vectors or the entries of matrices and solver vectors) are backed by memory.
+ */
+struct LargeArrayOptions {
+    // Arrays with fewer bytes are always allocated with the default allocator.
+    uint64_t threshold = 1ull << 24;
+
+    // If set, the kernel is asked to back the arrays with transparent huge pages, which reduces the number of TLB misses.
+    bool hugePages = false;
+
+    // If set, the pages of the arrays are interleaved across all NUMA nodes.
+    bool interleave = false;
+
+    // If non-empty, the arrays are mapped from (unlinked) temporary files in this directory, such that they can exceed the main memory.
+    std::string backingDirectory;
+
+    /*!
+     * Retrieves whether any of the options deviates from the default allocation.
+     */
+    bool isSpecialAllocationSet() const;
+};
+
+/*!
+ * Allocation of large arrays according to the (global) options. By default, the default allocator is used. The options have to be set before
+ * the first array is allocated, typically while processing the command line.
+ */
+class LargeArray {
+   public:
+    static LargeArrayOptions const& getOptions();
+    static void setOptions(LargeArrayOptions const& options);
+
+    /*!
+     * Allocates the given number of zero-initialized bytes.
+     */
+    static void* allocate(uint64_t bytes);
+
+    /*!
+     * Frees memory obtained from allocate. The number of bytes has to match the one of the allocation.
+     */
+    static void deallocate(void* data, uint64_t bytes);
+
+    /*!
+     * Applies the huge page and interleaving options to memory that was obtained from another allocator (e.g. the storage of a std::vector).
+     * Only the pages that are entirely covered by the given range are affected. This is merely a hint and does nothing if the range is smaller
+     * than the threshold.
+     */
+    static void advise(void const* data, uint64_t bytes);
+
+    template<typename T>
+    static void advise(std::vector<T> const& vector) {
+        advise(vector.data(), vector.capacity() * sizeof(T));
+    }
+};
+
+/*!
+ * A standard allocator that obtains its memory from LargeArray.
+ */
+template<typename T>
+class LargeArrayAllocator {
+   public:
+    typedef T value_type;
+
+    LargeArrayAllocator() = default;
+
+    template<typename U>
+    LargeArrayAllocator(LargeArrayAllocator<U> const&) {
+        // Intentionally left empty.
+    }
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(LargeArray::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* data, std::size_t n) {
+        LargeArray::deallocate(data, n * sizeof(T));
+    }
+
+    template<typename U>
+    bool operator==(LargeArrayAllocator<U> const&) const {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(LargeArrayAllocator<U> const&) const {
+        return false;
+    }
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,278 @@
+#include "storm/utility/SparseSolverPortfolio.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace detail {
+// Models with at most this many choices are solved with policy iteration, whose few (but expensive) iterations pay off for small models.
+uint64_t const smallModelChoices = 10000;
+// The SCC decomposition is exploited if the largest SCC contains at most this share of the states.
+double const topologicalLargestSccShare = 0.5;
+// The SIMD multiplier pays off if the rows have at least this many entries on average.
+double const simdEntriesPerRow = 4.0;
+
+template<typename ValueType>
+bool isAbsorbing(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t state) {
+    for (auto const& entry : matrix.getRowGroup(state)) {
+        if (entry.getColumn() != state && !storm::utility::isZero(entry.getValue())) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace detail
+
+SparseSolverPortfolio::Features::Features()
+    : numberOfStates(0),
+      numberOfChoices(0),
+      numberOfTransitions(0),
+      numberOfSccs(0),
+      numberOfNonTrivialSccs(0),
+      largestSccSize(0),
+      acyclic(true),
+      averageEntriesPerRow(0.0),
+      maximalRowGroupSize(0),
+      nondeterministic(false),
+      hasEndComponents(false) {
+    // Intentionally left empty.
+}
+
+std::string SparseSolverPortfolio::Features::toString() const {
+    std::stringstream str;
+    str << std::boolalpha << "states=" << numberOfStates << "\tchoices=" << numberOfChoices << "\ttransitions=" << numberOfTransitions;
+    str << "\tsccs=" << numberOfSccs << "\tnontrivialSccs=" << numberOfNonTrivialSccs << "\tlargestScc=" << largestSccSize;
+    str << "\tacyclic=" << acyclic << "\tavgEntriesPerRow=" << averageEntriesPerRow << "\tmaxRowGroupSize=" << maximalRowGroupSize;
+    str << "\tnondeterminism=" << nondeterministic << "\tendComponents=" << hasEndComponents;
+    return str.str();
+}
+
+SparseSolverPortfolio::SparseSolverPortfolio()
+    : minMaxMethod(storm::solver::MinMaxMethod::ValueIteration),
+      underlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration),
+      multiplicationStyle(storm::solver::MultiplicationStyle::Regular),
+      multiplierType(storm::solver::MultiplierType::Native),
+      equationSolverType(storm::solver::EquationSolverType::Native),
+      underlyingEquationSolverType(storm::solver::EquationSolverType::Native) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SparseSolverPortfolio::Features SparseSolverPortfolio::getFeatures(
+    storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> const& model) {
+    auto const& matrix = model.getTransitionMatrix();
+    Features result;
+    result.numberOfStates = model.getNumberOfStates();
+    result.numberOfChoices = matrix.getRowCount();
+    result.numberOfTransitions = matrix.getNonzeroEntryCount();
+    result.averageEntriesPerRow = result.numberOfChoices == 0 ? 0.0 : static_cast<double>(result.numberOfTransitions) / result.numberOfChoices;
+    for (uint64_t state = 0; state < result.numberOfStates; ++state) {
+        result.maximalRowGroupSize = std::max<uint64_t>(result.maximalRowGroupSize, matrix.getRowGroupSize(state));
+    }
+    result.nondeterministic = model.isNondeterministicModel();
+
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccs(matrix);
+    result.numberOfSccs = sccs.size();
+    for (auto const& scc : sccs) {
+        result.largestSccSize = std::max<uint64_t>(result.largestSccSize, scc.size());
+        if (scc.size() > 1) {
+            ++result.numberOfNonTrivialSccs;
+        } else if (!detail::isAbsorbing(matrix, *scc.begin())) {
+            // A single state is cyclic if it has a self-loop.
+            for (auto const& entry : matrix.getRowGroup(*scc.begin())) {
+                if (entry.getColumn() == *scc.begin() && !storm::utility::isZero(entry.getValue())) {
+                    ++result.numberOfNonTrivialSccs;
+                    break;
+                }
+            }
+        }
+    }
+    result.acyclic = result.numberOfNonTrivialSccs == 0;
+
+    if (result.nondeterministic && !result.acyclic) {
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(matrix, model.getBackwardTransitions());
+        result.hasEndComponents = std::any_of(mecs.begin(), mecs.end(), [&matrix](storm::storage::MaximalEndComponent const& mec) {
+            return mec.size() > 1 || !detail::isAbsorbing(matrix, mec.begin()->first);
+        });
+    }
+    return result;
+}
+
+template<typename ValueType>
+void SparseSolverPortfolio::predict(storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> const& model,
+                                    storm::Environment const& env) {
+    bool exact = storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact();
+    predict(getFeatures(model), exact, env.solver().isForceSoundness());
+}
+
+void SparseSolverPortfolio::predict(Features const& features, bool exact, bool sound) {
+    STORM_LOG_INFO("Solver portfolio using features " << features.toString() << ".");
+    raceMinMaxMethod = boost::none;
+    nativeMethod = boost::none;
+    multiplicationStyle = storm::solver::MultiplicationStyle::Regular;
+
+    // The method used for the (largest) SCC of the model.
+    storm::solver::MinMaxMethod method;
+    if (exact) {
+        method = features.numberOfChoices <= detail::smallModelChoices ? storm::solver::MinMaxMethod::PolicyIteration
+                                                                       : storm::solver::MinMaxMethod::RationalSearch;
+        raceMinMaxMethod = method == storm::solver::MinMaxMethod::PolicyIteration ? storm::solver::MinMaxMethod::RationalSearch
+                                                                                  : storm::solver::MinMaxMethod::PolicyIteration;
+    } else if (sound) {
+        method = storm::solver::MinMaxMethod::OptimisticValueIteration;
+        raceMinMaxMethod = storm::solver::MinMaxMethod::IntervalIteration;
+    } else if (features.numberOfChoices <= detail::smallModelChoices) {
+        method = storm::solver::MinMaxMethod::PolicyIteration;
+        raceMinMaxMethod = storm::solver::MinMaxMethod::ValueIteration;
+    } else {
+        method = storm::solver::MinMaxMethod::ValueIteration;
+        multiplicationStyle = storm::solver::MultiplicationStyle::GaussSeidel;
+        raceMinMaxMethod = storm::solver::MinMaxMethod::PolicyIteration;
+    }
+
+    bool topological = features.numberOfNonTrivialSccs > 1 ||
+                       static_cast<double>(features.largestSccSize) <= detail::topologicalLargestSccShare * features.numberOfStates;
+    underlyingMinMaxMethod = method;
+    if (features.acyclic) {
+        minMaxMethod = storm::solver::MinMaxMethod::Acyclic;
+        raceMinMaxMethod = boost::none;
+    } else if (topological) {
+        // The race is between solving the SCCs one by one and solving the whole system at once.
+        minMaxMethod = storm::solver::MinMaxMethod::Topological;
+        raceMinMaxMethod = method;
+    } else {
+        minMaxMethod = method;
+    }
+
+    // Gauss-Seidel style multiplications are only provided by the native multiplier.
+    if (!exact && multiplicationStyle == storm::solver::MultiplicationStyle::Regular && features.averageEntriesPerRow >= detail::simdEntriesPerRow) {
+        multiplierType = storm::solver::MultiplierType::Simd;
+    } else {
+        multiplierType = storm::solver::MultiplierType::Native;
+    }
+
+    // The linear equation solvers are used for deterministic models and for the policy evaluation within policy iteration.
+    if (features.acyclic) {
+        equationSolverType = storm::solver::EquationSolverType::Acyclic;
+    } else if (topological) {
+        equationSolverType = storm::solver::EquationSolverType::Topological;
+    } else {
+        equationSolverType = storm::solver::EquationSolverType::Native;
+    }
+    underlyingEquationSolverType = storm::solver::EquationSolverType::Native;
+    if (!exact) {
+        nativeMethod = sound ? storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration
+                             : storm::solver::NativeLinearEquationSolverMethod::GaussSeidel;
+    }
+}
+
+void SparseSolverPortfolio::applyTo(storm::Environment& env, bool race) const {
+    auto& solverEnv = env.solver();
+    if (solverEnv.minMax().isMethodSetFromDefault()) {
+        solverEnv.minMax().setMethod(minMaxMethod, true);
+        solverEnv.minMax().setMultiplicationStyle(multiplicationStyle);
+        if (minMaxMethod == storm::solver::MinMaxMethod::Topological) {
+            solverEnv.topological().setUnderlyingMinMaxMethod(underlyingMinMaxMethod);
+        }
+        if (race && raceMinMaxMethod) {
+            solverEnv.minMax().setRaceMethod(raceMinMaxMethod.get());
+        }
+    }
+    if (solverEnv.multiplier().isTypeSetFromDefault()) {
+        solverEnv.multiplier().setType(multiplierType, true);
+    }
+    if (solverEnv.isLinearEquationSolverTypeSetFromDefaultValue()) {
+        solverEnv.setLinearEquationSolverType(equationSolverType, true);
+        if (equationSolverType == storm::solver::EquationSolverType::Topological) {
+            solverEnv.topological().setUnderlyingEquationSolverType(underlyingEquationSolverType);
+        }
+        if (nativeMethod) {
+            solverEnv.native().setMethod(nativeMethod.get());
+        }
+    }
+}
+
+std::string SparseSolverPortfolio::toString() const {
+    std::stringstream str;
+    str << "minmax=" << storm::solver::toString(minMaxMethod);
+    if (minMaxMethod == storm::solver::MinMaxMethod::Topological) {
+        str << " (" << storm::solver::toString(underlyingMinMaxMethod) << ")";
+    }
+    if (raceMinMaxMethod) {
+        str << "\trace=" << storm::solver::toString(raceMinMaxMethod.get());
+    }
+    str << "\tmultiplication=" << (multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel ? "gaussseidel" : "regular");
+    str << "\tmultiplier=" << storm::solver::toString(multiplierType);
+    str << "\tequationsolver=" << storm::solver::toString(equationSolverType);
+    if (equationSolverType == storm::solver::EquationSolverType::Topological) {
+        str << " (" << storm::solver::toString(underlyingEquationSolverType) << ")";
+    }
+    if (nativeMethod) {
+        str << "\tnative=" << storm::solver::toString(nativeMethod.get());
+    }
+    return str.str();
+}
+
+storm::solver::MinMaxMethod SparseSolverPortfolio::getMinMaxMethod() const {
+    return minMaxMethod;
+}
+
+storm::solver::MinMaxMethod SparseSolverPortfolio::getUnderlyingMinMaxMethod() const {
+    return underlyingMinMaxMethod;
+}
+
+boost::optional<storm::solver::MinMaxMethod> const& SparseSolverPortfolio::getRaceMinMaxMethod() const {
+    return raceMinMaxMethod;
+}
+
+storm::solver::MultiplicationStyle SparseSolverPortfolio::getMultiplicationStyle() const {
+    return multiplicationStyle;
+}
+
+storm::solver::MultiplierType SparseSolverPortfolio::getMultiplierType() const {
+    return multiplierType;
+}
+
+storm::solver::EquationSolverType SparseSolverPortfolio::getEquationSolverType() const {
+    return equationSolverType;
+}
+
+storm::solver::EquationSolverType SparseSolverPortfolio::getUnderlyingEquationSolverType() const {
+    return underlyingEquationSolverType;
+}
+
+boost::optional<storm::solver::NativeLinearEquationSolverMethod> const& SparseSolverPortfolio::getNativeMethod() const {
+    return nativeMethod;
+}
+
+template SparseSolverPortfolio::Features SparseSolverPortfolio::getFeatures(
+    storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<double>> const& model);
+template void SparseSolverPortfolio::predict(storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<double>> const& model,
+                                             storm::Environment const& env);
+
+#ifdef STORM_HAVE_CARL
+template SparseSolverPortfolio::Features SparseSolverPortfolio::getFeatures(
+    storm::models::sparse::Model<storm::RationalNumber, storm::models::sparse::StandardRewardModel<storm::RationalNumber>> const& model);
+template void SparseSolverPortfolio::predict(
+    storm::models::sparse::Model<storm::RationalNumber, storm::models::sparse::StandardRewardModel<storm::RationalNumber>> const& model,
+    storm::Environment const& env);
+#endif
+}  // namespace utility
+}  // namespace storm
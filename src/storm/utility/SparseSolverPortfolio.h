@@ -0,0 +1,117 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <string>
+
+#include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+
+class Environment;
+
+namespace models {
+namespace sparse {
+template<typename ValueType>
+class StandardRewardModel;
+template<typename ValueType, typename RewardModelType>
+class Model;
+}  // namespace sparse
+}  // namespace models
+
+namespace utility {
+
+/*!
+ * Selects the (min-max) linear equation solvers for the sparse engine based on structural features of the model, e.g. its SCC decomposition and the
+ * presence of end components. In contrast to AutomaticSettings, which picks an engine before the model is built, the portfolio inspects the built
+ * model.
+ */
+class SparseSolverPortfolio {
+   public:
+    /*!
+     * Structural features of a sparse model.
+     */
+    struct Features {
+        Features();
+
+        std::string toString() const;
+
+        uint64_t numberOfStates;
+        uint64_t numberOfChoices;
+        uint64_t numberOfTransitions;
+        // The number of SCCs (including trivial ones).
+        uint64_t numberOfSccs;
+        // The number of SCCs that contain a cycle other than the self-loop of an absorbing state.
+        uint64_t numberOfNonTrivialSccs;
+        uint64_t largestSccSize;
+        bool acyclic;
+        double averageEntriesPerRow;
+        uint64_t maximalRowGroupSize;
+        bool nondeterministic;
+        // Whether the model has a maximal end component other than an absorbing state (only computed for nondeterministic models).
+        bool hasEndComponents;
+    };
+
+    SparseSolverPortfolio();
+
+    /*!
+     * Computes the features of the given model.
+     */
+    template<typename ValueType>
+    static Features getFeatures(storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> const& model);
+
+    /*!
+     * Predicts "good" solver settings for the given model.
+     *
+     * @param env The environment that determines whether exact or sound results are required.
+     */
+    template<typename ValueType>
+    void predict(storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> const& model,
+                 storm::Environment const& env);
+
+    /*!
+     * Predicts "good" solver settings for a model with the given features.
+     *
+     * @param exact If set, the solvers have to compute exact results.
+     * @param sound If set, the solvers have to compute sound results.
+     */
+    void predict(Features const& features, bool exact, bool sound);
+
+    /*!
+     * Sets the predicted settings in the given environment. Settings that have been set explicitly (i.e., not from their default value) are kept.
+     *
+     * @param race If set, the min-max method is raced against the second-best method (if there is one).
+     */
+    void applyTo(storm::Environment& env, bool race) const;
+
+    /*!
+     * Retrieves a description of the predicted settings.
+     */
+    std::string toString() const;
+
+    /// Retrieve "good" settings after calling predict.
+    storm::solver::MinMaxMethod getMinMaxMethod() const;
+    storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
+    boost::optional<storm::solver::MinMaxMethod> const& getRaceMinMaxMethod() const;
+    storm::solver::MultiplicationStyle getMultiplicationStyle() const;
+    storm::solver::MultiplierType getMultiplierType() const;
+    storm::solver::EquationSolverType getEquationSolverType() const;
+    storm::solver::EquationSolverType getUnderlyingEquationSolverType() const;
+    boost::optional<storm::solver::NativeLinearEquationSolverMethod> const& getNativeMethod() const;
+
+   private:
+    storm::solver::MinMaxMethod minMaxMethod;
+    // The method used within the SCCs if the min-max method is topological.
+    storm::solver::MinMaxMethod underlyingMinMaxMethod;
+    boost::optional<storm::solver::MinMaxMethod> raceMinMaxMethod;
+    storm::solver::MultiplicationStyle multiplicationStyle;
+    storm::solver::MultiplierType multiplierType;
+    storm::solver::EquationSolverType equationSolverType;
+    // The solver used within the SCCs if the equation solver is topological.
+    storm::solver::EquationSolverType underlyingEquationSolverType;
+    boost::optional<storm::solver::NativeLinearEquationSolverMethod> nativeMethod;
+};
+
+}  // namespace utility
+}  // namespace storm
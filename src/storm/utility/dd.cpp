@@ -1,11 +1,16 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -49,6 +54,79 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     return {reachableStates, iteration};
 }
 
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(ReachabilityMethod const& method, storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<storm::dd::Bdd<Type>> const& transitions,
+                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables) {
+    if (method == ReachabilityMethod::Bfs) {
+        storm::dd::Bdd<Type> allTransitions = initialStates.getDdManager().getBddZero();
+        for (auto const& relation : transitions) {
+            allTransitions |= relation;
+        }
+        return computeReachableStates(initialStates, allTransitions, rowMetaVariables, columnMetaVariables);
+    }
+
+    STORM_LOG_TRACE("Computing reachable states with " << (method == ReachabilityMethod::Chaining ? "chaining" : "saturation") << " over "
+                                                        << transitions.size() << " transition relation(s), " << initialStates.getNonZeroCount()
+                                                        << " initial states.");
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Relations without transitions can never contribute.
+    std::vector<storm::dd::Bdd<Type>> relations;
+    for (auto const& relation : transitions) {
+        if (!relation.isZero()) {
+            relations.push_back(relation);
+        }
+    }
+
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+    uint64_t images = 0;
+    if (method == ReachabilityMethod::Chaining) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto const& relation : relations) {
+                storm::dd::Bdd<Type> newReachableStates =
+                    reachableStates.relationalProduct(relation, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                ++images;
+                if (!newReachableStates.isZero()) {
+                    reachableStates |= newReachableStates;
+                    changed = true;
+                }
+            }
+        }
+    } else {
+        // Deeper levels come first, so relations whose top-most variable is further down in the order are treated first.
+        std::stable_sort(relations.begin(), relations.end(),
+                         [](storm::dd::Bdd<Type> const& first, storm::dd::Bdd<Type> const& second) { return first.getLevel() > second.getLevel(); });
+
+        uint64_t index = 0;
+        while (index < relations.size()) {
+            bool changed = false;
+            storm::dd::Bdd<Type> frontier = reachableStates;
+            while (!frontier.isZero()) {
+                frontier = frontier.relationalProduct(relations[index], rowMetaVariables, columnMetaVariables) && !reachableStates;
+                ++images;
+                if (!frontier.isZero()) {
+                    reachableStates |= frontier;
+                    changed = true;
+                }
+            }
+
+            // If new states were found, the relations below the current one need to be saturated again.
+            index = changed && index > 0 ? 0 : index + 1;
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Reachability computation completed after " << images << " images ("
+                                                                << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms), "
+                                                                << reachableStates.getNonZeroCount() << " reachable states found.");
+
+    return {reachableStates, images};
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -94,6 +172,13 @@ storm::dd::Bdd<Type> getRowColumnDiagonal(
     return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Add<Type, ValueType> quantize(storm::dd::Add<Type, ValueType> const& values, uint64_t bits, bool roundUp) {
+    storm::dd::Add<Type, ValueType> scale = values.getDdManager().getConstant(std::ldexp(storm::utility::one<ValueType>(), static_cast<int>(bits)));
+    storm::dd::Add<Type, ValueType> scaledValues = values * scale;
+    return (roundUp ? scaledValues.ceil() : scaledValues.floor()) / scale;
+}
+
 template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                              storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
                                                                                              std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -102,6 +187,15 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeR
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(
+    ReachabilityMethod const& method, storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
+    std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(
+    ReachabilityMethod const& method, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates,
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
@@ -120,6 +214,11 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+template storm::dd::Add<storm::dd::DdType::CUDD, double> quantize(storm::dd::Add<storm::dd::DdType::CUDD, double> const& values, uint64_t bits,
+                                                                  bool roundUp);
+template storm::dd::Add<storm::dd::DdType::Sylvan, double> quantize(storm::dd::Add<storm::dd::DdType::Sylvan, double> const& values, uint64_t bits,
+                                                                    bool roundUp);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
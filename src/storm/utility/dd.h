@@ -24,11 +24,32 @@ class Add;
 namespace utility {
 namespace dd {
 
+// The methods that can be used to compute the reachable states of a transition relation that is given as a union of several relations.
+enum class ReachabilityMethod { Bfs, Chaining, Saturation };
+
 template<storm::dd::DdType Type>
 std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions,
                                                                  std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                  std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes the states that are reachable from the initial states via the union of the given transition relations (e.g. the relations of the
+ * individual actions of a model).
+ *
+ * - Bfs computes the image of the union of the relations in every iteration.
+ * - Chaining adds the image of every relation to the reachable states before the image of the next relation is computed.
+ * - Saturation orders the relations by the level of their top-most variable (bottom-most first) and applies each relation until it does not
+ *   reach new states anymore. Whenever a relation reached new states, the relations below it are applied again. This mimics the saturation
+ *   algorithm by Ciardo et al. on the level of whole DDs rather than individual nodes.
+ *
+ * @return The reachable states and the number of images that were computed.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(ReachabilityMethod const& method, storm::dd::Bdd<Type> const& initialStates,
+                                                                 std::vector<storm::dd::Bdd<Type>> const& transitions,
+                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables);
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -43,6 +64,18 @@ template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager,
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+/*!
+ * Rounds all values of the given ADD to multiples of 2^-bits. As multiplying with powers of two is exact, the only error introduced is the
+ * rounding itself, which is below 2^-bits for every value.
+ *
+ * @param values The ADD whose values to round.
+ * @param bits The number of fractional bits that are kept.
+ * @param roundUp If set, the values are rounded up and otherwise down.
+ * @return The rounded ADD.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Add<Type, ValueType> quantize(storm::dd::Add<Type, ValueType> const& values, uint64_t bits, bool roundUp);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
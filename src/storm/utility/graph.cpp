@@ -1,14 +1,18 @@
 #include "graph.h"
 #include <algorithm>
+#include <atomic>
+#include <limits>
 
 #include "storm-config.h"
 #include "utility/OsDetection.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/PartitionedRelation.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/abstraction/ExplicitGameStrategyPair.h"
@@ -23,6 +27,10 @@
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/utility/Instrumentation.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -32,6 +40,149 @@ namespace storm {
 namespace utility {
 namespace graph {
 
+#ifdef STORM_HAVE_INTELTBB
+namespace detail {
+
+/*!
+ * Retrieves whether the graph searches on a system of the given size are to be performed in parallel.
+ */
+bool useParallelSearch(uint_fast64_t numberOfStates) {
+    // For small systems, the overhead of the parallel search outweighs its benefits.
+    uint_fast64_t const minimalNumberOfStatesForParallelSearch = 100000;
+    return numberOfStates >= minimalNumberOfStatesForParallelSearch &&
+           storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+}
+
+/*!
+ * Performs a parallel, level-synchronous backward search from the initial states through the phi states. A phi state
+ * is added if it has a successor that was added in the previous level and the given predicate holds for it.
+ * Levels with a large frontier are processed bottom-up (i.e. by checking whether the states that were not reached
+ * have a successor in the frontier) if a transition matrix is given. Otherwise, all levels are processed top-down.
+ *
+ * @param backwardTransitions The reversed transition relation.
+ * @param transitionMatrix If not null, the transition matrix which is used to process levels bottom-up.
+ * @param phiStates The states that can be added.
+ * @param initialStates The states to start the search from.
+ * @param canBeAdded A predicate that takes a state and a function that tells whether a state was reached in one of the
+ * previous levels and returns true iff the state can be added.
+ * @param maximalSteps The maximal number of levels to consider.
+ * @return All reached states.
+ */
+template<typename T, typename CanBeAddedPredicate>
+storm::storage::BitVector performParallelBackwardSearch(storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                        storm::storage::SparseMatrix<T> const* transitionMatrix, storm::storage::BitVector const& phiStates,
+                                                        storm::storage::BitVector const& initialStates, CanBeAddedPredicate const& canBeAdded,
+                                                        uint_fast64_t maximalSteps = std::numeric_limits<uint_fast64_t>::max()) {
+    uint_fast64_t const numberOfStates = phiStates.size();
+    // The status of a state is either unreached, reached in a previous level or reached in the current level.
+    uint8_t const unreached = 0;
+    uint8_t const reached = 1;
+    uint8_t const reachedInCurrentLevel = 2;
+    std::vector<std::atomic<uint8_t>> status(numberOfStates);
+    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, numberOfStates), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+        for (uint_fast64_t state = range.begin(); state != range.end(); ++state) {
+            status[state].store(initialStates.get(state) ? reached : unreached, std::memory_order_relaxed);
+        }
+    });
+    auto isReached = [&status](uint_fast64_t state) { return status[state].load(std::memory_order_relaxed) == reached; };
+
+    // Parameters of the direction-optimizing breadth-first search as proposed by Beamer et al.
+    uint_fast64_t const alpha = 14;
+    uint_fast64_t const beta = 24;
+    bool bottomUp = false;
+    // The number of transitions leaving unreached phi states. This is only needed if levels can be processed bottom-up.
+    uint_fast64_t unexploredTransitionCount = 0;
+    if (transitionMatrix) {
+        for (auto state : phiStates) {
+            if (!initialStates.get(state)) {
+                unexploredTransitionCount += transitionMatrix->getRowGroupEntryCount(state);
+            }
+        }
+    }
+
+    std::vector<uint_fast64_t> frontier(initialStates.begin(), initialStates.end());
+    std::vector<uint8_t> isInFrontier;
+    tbb::enumerable_thread_specific<std::vector<uint_fast64_t>> localNextFrontiers;
+    for (uint_fast64_t step = 0; step < maximalSteps && !frontier.empty(); ++step) {
+        if (transitionMatrix) {
+            uint_fast64_t frontierTransitionCount = 0;
+            for (auto const& state : frontier) {
+                frontierTransitionCount += backwardTransitions.getRow(state).getNumberOfEntries();
+            }
+            if (!bottomUp && frontierTransitionCount > unexploredTransitionCount / alpha) {
+                bottomUp = true;
+                isInFrontier.assign(numberOfStates, 0);
+            } else if (bottomUp && frontier.size() < numberOfStates / beta) {
+                bottomUp = false;
+            }
+        }
+
+        if (bottomUp) {
+            for (auto const& state : frontier) {
+                isInFrontier[state] = 1;
+            }
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, numberOfStates), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                auto& localNextFrontier = localNextFrontiers.local();
+                for (uint_fast64_t state = phiStates.getNextSetIndex(range.begin()); state < range.end(); state = phiStates.getNextSetIndex(state + 1)) {
+                    if (status[state].load(std::memory_order_relaxed) == unreached) {
+                        for (auto const& successor : transitionMatrix->getRowGroup(state)) {
+                            if (isInFrontier[successor.getColumn()]) {
+                                if (canBeAdded(state, isReached)) {
+                                    status[state].store(reachedInCurrentLevel, std::memory_order_relaxed);
+                                    localNextFrontier.push_back(state);
+                                }
+                                break;
+                            }
+                        }
+                    }
+                }
+            });
+            for (auto const& state : frontier) {
+                isInFrontier[state] = 0;
+            }
+        } else {
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, frontier.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                auto& localNextFrontier = localNextFrontiers.local();
+                for (uint_fast64_t index = range.begin(); index != range.end(); ++index) {
+                    for (auto const& predecessorEntry : backwardTransitions.getRow(frontier[index])) {
+                        uint_fast64_t predecessor = predecessorEntry.getColumn();
+                        if (phiStates.get(predecessor) && status[predecessor].load(std::memory_order_relaxed) == unreached &&
+                            canBeAdded(predecessor, isReached)) {
+                            uint8_t expected = unreached;
+                            if (status[predecessor].compare_exchange_strong(expected, reachedInCurrentLevel, std::memory_order_relaxed)) {
+                                localNextFrontier.push_back(predecessor);
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        // Collect the next frontier and mark its states as reached.
+        frontier.clear();
+        for (auto& localNextFrontier : localNextFrontiers) {
+            frontier.insert(frontier.end(), localNextFrontier.begin(), localNextFrontier.end());
+            localNextFrontier.clear();
+        }
+        for (auto const& state : frontier) {
+            status[state].store(reached, std::memory_order_relaxed);
+            if (transitionMatrix) {
+                unexploredTransitionCount -= transitionMatrix->getRowGroupEntryCount(state);
+            }
+        }
+    }
+
+    storm::storage::BitVector result(numberOfStates);
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        if (status[state].load(std::memory_order_relaxed) == reached) {
+            result.set(state);
+        }
+    }
+    return result;
+}
+}  // namespace detail
+#endif
+
 template<typename T>
 storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates,
                                              storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates,
@@ -309,6 +460,14 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
 template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+#ifdef STORM_HAVE_INTELTBB
+    if (detail::useParallelSearch(phiStates.size())) {
+        return detail::performParallelBackwardSearch<T>(
+            backwardTransitions, nullptr, phiStates, psiStates, [](uint_fast64_t, auto const&) { return true; },
+            useStepBound ? maximalSteps : std::numeric_limits<uint_fast64_t>::max());
+    }
+#endif
+
     // Prepare the resulting bit vector.
     uint_fast64_t numberOfStates = phiStates.size();
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -388,8 +547,9 @@ template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
+    storm::utility::InstrumentationTimer instrumentationTimer("modelchecking.precomputation");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+    storm::storage::SparseMatrix<T> const& backwardTransitions = model.getBackwardTransitions();
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
     result.first.complement();
@@ -400,6 +560,7 @@ template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
+    storm::utility::InstrumentationTimer instrumentationTimer("modelchecking.precomputation");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
@@ -407,6 +568,19 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
     return result;
 }
 
+namespace detail {
+/*!
+ * Creates the (disjunctively) partitioned relation that is used for the image computations on the given transition BDD of the model.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::PartitionedRelation<Type> createPartitionedRelation(storm::models::symbolic::Model<Type, ValueType> const& model,
+                                                               storm::dd::Bdd<Type> const& transitionMatrix) {
+    return storm::dd::PartitionedRelation<Type>::splitDisjunctively(
+        transitionMatrix, model.getRowVariables(), model.getColumnVariables(), model.getRowColumnMetaVariablePairs(),
+        storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getDdPartitionNodeCount());
+}
+}  // namespace detail
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix,
                                          storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates,
@@ -415,6 +589,7 @@ storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, Va
     storm::dd::DdManager<Type> const& manager = model.getManager();
     storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
     storm::dd::Bdd<Type> statesWithProbabilityGreater0 = psiStates;
+    storm::dd::PartitionedRelation<Type> relation = detail::createPartitionedRelation(model, transitionMatrix);
 
     uint_fast64_t iterations = 0;
     while (lastIterationStates != statesWithProbabilityGreater0) {
@@ -423,8 +598,7 @@ storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, Va
         }
 
         lastIterationStates = statesWithProbabilityGreater0;
-        statesWithProbabilityGreater0 =
-            statesWithProbabilityGreater0.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        statesWithProbabilityGreater0 = relation.preimage(statesWithProbabilityGreater0);
         statesWithProbabilityGreater0 &= phiStates;
         statesWithProbabilityGreater0 |= lastIterationStates;
         ++iterations;
@@ -474,6 +648,77 @@ std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>> performProb01(storm::model
     return result;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<storm::dd::Bdd<Type>> computeSccBlocks(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix,
+                                                   storm::dd::Bdd<Type> const& states, uint64_t minimalBlockSize) {
+    storm::dd::PartitionedRelation<Type> relation = detail::createPartitionedRelation(model, transitionMatrix);
+    storm::dd::Bdd<Type> zero = model.getManager().getBddZero();
+
+    std::vector<storm::dd::Bdd<Type>> result;
+    auto emitBlock = [&result, minimalBlockSize](storm::dd::Bdd<Type> const& block) {
+        if (!result.empty() && result.back().getNonZeroCount() < minimalBlockSize) {
+            result.back() |= block;
+        } else {
+            result.push_back(block);
+        }
+    };
+
+    // Every entry is either a set of states that still needs to be decomposed or a block that is to be emitted (if the flag is set). The entries
+    // are processed such that all states outside of a set that are reachable from the set have already been emitted.
+    std::vector<std::pair<storm::dd::Bdd<Type>, bool>> stack;
+    stack.emplace_back(states, false);
+    while (!stack.empty()) {
+        auto entry = std::move(stack.back());
+        stack.pop_back();
+        if (entry.second) {
+            emitBlock(entry.first);
+            continue;
+        }
+
+        storm::dd::Bdd<Type> remainingStates = entry.first;
+
+        // Remove the states without successors in the remaining states.
+        storm::dd::Bdd<Type> sinkStates = remainingStates && !relation.preimage(remainingStates);
+        while (!sinkStates.isZero()) {
+            emitBlock(sinkStates);
+            remainingStates &= !sinkStates;
+            sinkStates = remainingStates && !relation.preimage(remainingStates);
+        }
+        if (remainingStates.isZero()) {
+            continue;
+        }
+
+        // Determine the component of an arbitrary pivot state as the intersection of its forward and backward reachable states.
+        storm::dd::Bdd<Type> pivot = remainingStates.existsAbstractRepresentative(model.getRowVariables());
+        storm::dd::Bdd<Type> forwardStates = pivot;
+        storm::dd::Bdd<Type> frontier = pivot;
+        while (!frontier.isZero()) {
+            frontier = relation.image(frontier) && remainingStates && !forwardStates;
+            forwardStates |= frontier;
+        }
+        storm::dd::Bdd<Type> component = pivot;
+        frontier = pivot;
+        while (!frontier.isZero()) {
+            frontier = relation.preimage(frontier) && forwardStates && !component;
+            component |= frontier;
+        }
+
+        // The states forward reachable from the component need to be emitted before it and the states that are not forward reachable after it.
+        storm::dd::Bdd<Type> upstreamStates = remainingStates && !forwardStates;
+        if (!upstreamStates.isZero()) {
+            stack.emplace_back(upstreamStates, false);
+        }
+        stack.emplace_back(component, true);
+        storm::dd::Bdd<Type> downstreamStates = forwardStates && !component;
+        if (!downstreamStates.isZero()) {
+            stack.emplace_back(downstreamStates, false);
+        }
+    }
+    STORM_LOG_TRACE("Decomposed " << states.getNonZeroCount() << " states into " << result.size() << " blocks.");
+
+    return result;
+}
+
 template<typename T>
 void computeSchedulerStayingInStates(storm::storage::BitVector const& states, storm::storage::SparseMatrix<T> const& transitionMatrix,
                                      storm::storage::Scheduler<T>& scheduler) {
@@ -680,6 +925,14 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+#ifdef STORM_HAVE_INTELTBB
+    if (detail::useParallelSearch(phiStates.size())) {
+        return detail::performParallelBackwardSearch<T>(
+            backwardTransitions, nullptr, phiStates, psiStates, [](uint_fast64_t, auto const&) { return true; },
+            useStepBound ? maximalSteps : std::numeric_limits<uint_fast64_t>::max());
+    }
+#endif
+
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -752,6 +1005,41 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
 
+#ifdef STORM_HAVE_INTELTBB
+    if (detail::useParallelSearch(numberOfStates)) {
+        storm::storage::BitVector currentStates(numberOfStates, true);
+        while (true) {
+            // A state is added if it has a choice whose successors are all in the current state set and one of the successors was already added.
+            auto canBeAdded = [&](uint_fast64_t state, auto const& isReached) {
+                for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                    if (!choiceConstraint || choiceConstraint.get().get(row)) {
+                        bool allSuccessorsInCurrentStates = true;
+                        bool hasNextStateSuccessor = false;
+                        for (auto const& successor : transitionMatrix.getRow(row)) {
+                            if (!currentStates.get(successor.getColumn())) {
+                                allSuccessorsInCurrentStates = false;
+                                break;
+                            } else if (isReached(successor.getColumn())) {
+                                hasNextStateSuccessor = true;
+                            }
+                        }
+                        if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            };
+            storm::storage::BitVector nextStates =
+                detail::performParallelBackwardSearch(backwardTransitions, &transitionMatrix, phiStates, psiStates, canBeAdded);
+            if (currentStates == nextStates) {
+                return currentStates;
+            }
+            currentStates = std::move(nextStates);
+        }
+    }
+#endif
+
     // Initialize the environment for the iterative algorithm.
     storm::storage::BitVector currentStates(numberOfStates, true);
     std::vector<uint_fast64_t> stack;
@@ -829,6 +1117,7 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::InstrumentationTimer instrumentationTimer("modelchecking.precomputation");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
 
     result.first = performProb0A(backwardTransitions, phiStates, psiStates);
@@ -853,6 +1142,36 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
 
+#ifdef STORM_HAVE_INTELTBB
+    // The step-bounded variant needs to revisit states for which a shorter path was found, so only the unbounded search is done in parallel.
+    if (!useStepBound && detail::useParallelSearch(numberOfStates)) {
+        // A state is added if it has at least one enabled choice and every enabled choice has a successor that was already added.
+        auto canBeAdded = [&](uint_fast64_t state, auto const& isReached) {
+            uint_fast64_t row = nondeterministicChoiceIndices[state];
+            uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[state + 1];
+            if (choiceConstraint && choiceConstraint->getNextSetIndex(row) >= endOfGroup) {
+                return false;
+            }
+            for (; row < endOfGroup; ++row) {
+                if (!choiceConstraint || choiceConstraint->get(row)) {
+                    bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
+                    for (auto const& successor : transitionMatrix.getRow(row)) {
+                        if (isReached(successor.getColumn())) {
+                            hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
+                            break;
+                        }
+                    }
+                    if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        return detail::performParallelBackwardSearch(backwardTransitions, &transitionMatrix, phiStates, psiStates, canBeAdded);
+    }
+#endif
+
     // Prepare resulting bit vector.
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
 
@@ -999,6 +1318,38 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::BitVector const& psiStates) {
     size_t numberOfStates = phiStates.size();
 
+#ifdef STORM_HAVE_INTELTBB
+    if (detail::useParallelSearch(numberOfStates)) {
+        storm::storage::BitVector currentStates(numberOfStates, true);
+        while (true) {
+            // A state is added if for all choices, all successors are in the current state set and one of the successors was already added.
+            auto canBeAdded = [&](uint_fast64_t state, auto const& isReached) {
+                for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                    bool hasAtLeastOneSuccessorWithProbability1 = false;
+                    for (auto const& successor : transitionMatrix.getRow(row)) {
+                        if (!currentStates.get(successor.getColumn())) {
+                            return false;
+                        }
+                        if (isReached(successor.getColumn())) {
+                            hasAtLeastOneSuccessorWithProbability1 = true;
+                        }
+                    }
+                    if (!hasAtLeastOneSuccessorWithProbability1) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            storm::storage::BitVector nextStates =
+                detail::performParallelBackwardSearch(backwardTransitions, &transitionMatrix, phiStates, psiStates, canBeAdded);
+            if (currentStates == nextStates) {
+                return currentStates;
+            }
+            currentStates = std::move(nextStates);
+        }
+    }
+#endif
+
     // Initialize the environment for the iterative algorithm.
     storm::storage::BitVector currentStates(numberOfStates, true);
     std::vector<uint_fast64_t> stack;
@@ -1073,6 +1424,7 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
+    storm::utility::InstrumentationTimer instrumentationTimer("modelchecking.precomputation");
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
     result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
     // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
@@ -1099,11 +1451,11 @@ storm::dd::Bdd<Type> computeSchedulerProbGreater0E(storm::models::symbolic::Nond
     storm::dd::Bdd<Type> statesWithProbabilityGreater0E = manager.getBddZero();
     storm::dd::Bdd<Type> frontier = psiStates;
     storm::dd::Bdd<Type> scheduler = manager.getBddZero();
+    storm::dd::PartitionedRelation<Type> relation = detail::createPartitionedRelation(model, transitionMatrix);
 
     uint_fast64_t iterations = 0;
     while (!frontier.isZero()) {
-        storm::dd::Bdd<Type> statesAndChoicesWithProbabilityGreater0E =
-            frontier.inverseRelationalProductWithExtendedRelation(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        storm::dd::Bdd<Type> statesAndChoicesWithProbabilityGreater0E = relation.preimage(frontier);
         frontier = phiStates && statesAndChoicesWithProbabilityGreater0E.existsAbstract(model.getNondeterminismVariables()) && !statesWithProbabilityGreater0E;
         scheduler = scheduler || (frontier && statesAndChoicesWithProbabilityGreater0E).existsAbstractRepresentative(model.getNondeterminismVariables());
         statesWithProbabilityGreater0E |= frontier;
@@ -1123,11 +1475,11 @@ storm::dd::Bdd<Type> performProbGreater0E(storm::models::symbolic::Nondeterminis
     storm::dd::Bdd<Type> statesWithProbabilityGreater0E = psiStates;
 
     uint_fast64_t iterations = 0;
-    storm::dd::Bdd<Type> abstractedTransitionMatrix = transitionMatrix.existsAbstract(model.getNondeterminismVariables());
+    storm::dd::PartitionedRelation<Type> relation =
+        detail::createPartitionedRelation(model, transitionMatrix.existsAbstract(model.getNondeterminismVariables()));
     while (lastIterationStates != statesWithProbabilityGreater0E) {
         lastIterationStates = statesWithProbabilityGreater0E;
-        statesWithProbabilityGreater0E =
-            statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        statesWithProbabilityGreater0E = relation.preimage(statesWithProbabilityGreater0E);
         statesWithProbabilityGreater0E &= phiStates;
         statesWithProbabilityGreater0E |= lastIterationStates;
         ++iterations;
@@ -1150,12 +1502,12 @@ storm::dd::Bdd<Type> performProbGreater0A(storm::models::symbolic::Nondeterminis
     storm::dd::DdManager<Type> const& manager = model.getManager();
     storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
     storm::dd::Bdd<Type> statesWithProbabilityGreater0A = psiStates;
+    storm::dd::PartitionedRelation<Type> relation = detail::createPartitionedRelation(model, transitionMatrix);
 
     uint_fast64_t iterations = 0;
     while (lastIterationStates != statesWithProbabilityGreater0A) {
         lastIterationStates = statesWithProbabilityGreater0A;
-        statesWithProbabilityGreater0A =
-            statesWithProbabilityGreater0A.inverseRelationalProductWithExtendedRelation(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        statesWithProbabilityGreater0A = relation.preimage(statesWithProbabilityGreater0A);
         statesWithProbabilityGreater0A |= model.getIllegalMask();
         statesWithProbabilityGreater0A = statesWithProbabilityGreater0A.universalAbstract(model.getNondeterminismVariables());
         statesWithProbabilityGreater0A &= phiStates;
@@ -1179,12 +1531,12 @@ storm::dd::Bdd<Type> performProb1A(storm::models::symbolic::NondeterministicMode
     storm::dd::DdManager<Type> const& manager = model.getManager();
     storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
     storm::dd::Bdd<Type> statesWithProbability1A = psiStates || statesWithProbabilityGreater0A;
+    storm::dd::PartitionedRelation<Type> relation = detail::createPartitionedRelation(model, transitionMatrix);
 
     uint_fast64_t iterations = 0;
     while (lastIterationStates != statesWithProbability1A) {
         lastIterationStates = statesWithProbability1A;
-        statesWithProbability1A = statesWithProbability1A.swapVariables(model.getRowColumnMetaVariablePairs());
-        statesWithProbability1A = transitionMatrix.implies(statesWithProbability1A).universalAbstract(model.getColumnVariables());
+        statesWithProbability1A = relation.universalPreimage(statesWithProbability1A);
         statesWithProbability1A |= model.getIllegalMask();
         statesWithProbability1A = statesWithProbability1A.universalAbstract(model.getNondeterminismVariables());
         statesWithProbability1A &= statesWithProbabilityGreater0A;
@@ -1202,6 +1554,7 @@ storm::dd::Bdd<Type> performProb1E(storm::models::symbolic::NondeterministicMode
     // Initialize environment for backward search.
     storm::dd::DdManager<Type> const& manager = model.getManager();
     storm::dd::Bdd<Type> statesWithProbability1E = statesWithProbabilityGreater0E;
+    storm::dd::PartitionedRelation<Type> relation = detail::createPartitionedRelation(model, transitionMatrix);
 
     uint_fast64_t iterations = 0;
     bool outerLoopDone = false;
@@ -1210,11 +1563,8 @@ storm::dd::Bdd<Type> performProb1E(storm::models::symbolic::NondeterministicMode
 
         bool innerLoopDone = false;
         while (!innerLoopDone) {
-            storm::dd::Bdd<Type> temporary = statesWithProbability1E.swapVariables(model.getRowColumnMetaVariablePairs());
-            temporary = transitionMatrix.implies(temporary).universalAbstract(model.getColumnVariables());
-
-            storm::dd::Bdd<Type> temporary2 =
-                innerStates.inverseRelationalProductWithExtendedRelation(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+            storm::dd::Bdd<Type> temporary = relation.universalPreimage(statesWithProbability1E);
+            storm::dd::Bdd<Type> temporary2 = relation.preimage(innerStates);
 
             temporary = temporary.andExists(temporary2, model.getNondeterminismVariables());
             temporary &= phiStates;
@@ -1247,15 +1597,13 @@ storm::dd::Bdd<Type> computeSchedulerProb1E(storm::models::symbolic::Nondetermin
     storm::dd::Bdd<Type> scheduler = manager.getBddZero();
 
     storm::dd::Bdd<Type> innerStates = manager.getBddZero();
+    storm::dd::PartitionedRelation<Type> relation = detail::createPartitionedRelation(model, transitionMatrix);
 
     uint64_t iterations = 0;
     bool innerLoopDone = false;
     while (!innerLoopDone) {
-        storm::dd::Bdd<Type> temporary = statesWithProbability1E.swapVariables(model.getRowColumnMetaVariablePairs());
-        temporary = transitionMatrix.implies(temporary).universalAbstract(model.getColumnVariables());
-
-        storm::dd::Bdd<Type> temporary2 =
-            innerStates.inverseRelationalProductWithExtendedRelation(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+        storm::dd::Bdd<Type> temporary = relation.universalPreimage(statesWithProbability1E);
+        storm::dd::Bdd<Type> temporary2 = relation.preimage(innerStates);
         temporary &= temporary2;
         temporary &= phiStates;
 
@@ -2305,6 +2653,10 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, storm::dd::Bdd<storm
     storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix,
     storm::dd::Bdd<storm::dd::DdType::CUDD> const& phiStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& psiStates);
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> computeSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix,
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> computeSchedulerProbGreater0E(
     storm::models::symbolic::NondeterministicModel<storm::dd::DdType::CUDD, double> const& model,
     storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::CUDD> const& phiStates,
@@ -2404,6 +2756,10 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<sto
     storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix,
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeSchedulerProbGreater0E(
     storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, double> const& model,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
@@ -2502,6 +2858,10 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<sto
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model,
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeSchedulerProbGreater0E(
     storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
@@ -2600,6 +2960,10 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<sto
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates);
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model,
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeSchedulerProbGreater0E(
     storm::models::symbolic::NondeterministicModel<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
@@ -276,6 +276,22 @@ std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>> performProb01(storm::model
                                                                     storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates,
                                                                     storm::dd::Bdd<Type> const& psiStates);
 
+/*!
+ * Decomposes the subgraph induced by the given states into (unions of) strongly connected components using forward-backward searches. States
+ * without successors in the remaining subgraph are removed layer by layer beforehand, so each such layer forms a block of trivial components.
+ * The blocks are returned in reverse topological order, i.e. states of a block only have successors within the block, in preceding blocks or
+ * outside of the given states.
+ *
+ * @param model The (symbolic) model whose meta variables are used.
+ * @param transitionMatrix The transition matrix of the model as a BDD (without nondeterminism variables).
+ * @param states The states to decompose.
+ * @param minimalBlockSize Consecutive blocks are merged until they have at least this number of states.
+ * @return The blocks in reverse topological order.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<storm::dd::Bdd<Type>> computeSccBlocks(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix,
+                                                   storm::dd::Bdd<Type> const& states, uint64_t minimalBlockSize = 1);
+
 /*!
  * Computes a scheduler for the given states that chooses an action that stays completely in the very same set.
  * Note that this assumes that there is a legal choice for each of the states.
@@ -251,10 +251,34 @@ T ShortestPathsGenerator<T>::getEdgeDistance(state_t tailNode, state_t headNode)
 
 template<typename T>
 void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
+    // pending (node, k) pairs; the top one is computed next unless it first requires the next path of its predecessor
+    std::vector<std::pair<state_t, unsigned long>> pending = {{node, k}};
+    // whether the candidates of the corresponding pending pair were already added
+    std::vector<bool> candidatesAdded = {false};
+
+    while (!pending.empty()) {
+        state_t currentNode = pending.back().first;
+        unsigned long currentK = pending.back().second;
+        if (!candidatesAdded.back()) {
+            candidatesAdded.back() = true;
+            boost::optional<std::pair<state_t, unsigned long>> dependency = addCandidates(currentNode, currentK);
+            if (dependency) {
+                pending.push_back(dependency.get());
+                candidatesAdded.push_back(false);
+                continue;
+            }
+        }
+        selectNextPath(currentNode, currentK);
+        pending.pop_back();
+        candidatesAdded.pop_back();
+    }
+}
+
+template<typename T>
+boost::optional<std::pair<state_t, unsigned long>> ShortestPathsGenerator<T>::addCandidates(state_t node, unsigned long k) {
     assert(k >= 2);                                // Dijkstra is used for k=1
     assert(kShortestPaths[node].size() == k - 1);  // if not, the previous SP must not exist
 
-    // TODO: I could extract the candidate generation to make this function more succinct
     if (k == 2) {
         // Step B.1 in J&M paper
 
@@ -264,16 +288,27 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             // add shortest paths to predecessors plus edge to current node
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
                                                  shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
-
             // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
+            if (!(pathToPredecessorPlusEdge == shortestPathToNode)) {
+                candidatePaths[node].insert(pathToPredecessorPlusEdge);
             }
         }
     }
 
+    if (not(k == 2 && isInitialState(node))) {
+        // Steps B.2-5 in J&M paper, requires the one-worse-shortest path to the predecessor on the (k-1)th shortest path
+        Path<T> const& previousShortestPath = kShortestPaths[node][k - 1 - 1];
+        state_t predecessor = previousShortestPath.predecessorNode.get();
+        unsigned long tailK = previousShortestPath.predecessorK;
+        if (kShortestPaths[predecessor].size() < tailK + 1) {
+            return std::make_pair(predecessor, tailK + 1);
+        }
+    }
+    return boost::none;
+}
+
+template<typename T>
+void ShortestPathsGenerator<T>::selectNextPath(state_t node, unsigned long k) {
     if (not(k == 2 && isInitialState(node))) {
         // Steps B.2-5 in J&M paper
 
@@ -287,12 +322,6 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
 
         // i.e. source ~~tailK-shortest path~~> predecessor --> node
 
-        // compute one-worse-shortest path to the predecessor (if it hasn't yet been computed)
-        if (kShortestPaths[predecessor].size() < tailK + 1) {
-            // TODO: investigate recursion depth and possible iterative alternative
-            computeNextPath(predecessor, tailK + 1);
-        }
-
         if (kShortestPaths[predecessor].size() >= tailK + 1) {
             // take that path, add an edge to the current node; that's a candidate
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), tailK + 1,
@@ -302,17 +331,10 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
         // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
     }
 
-    // Step B.6 in J&M paper
+    // Step B.6 in J&M paper: the candidates are ordered by decreasing distance
     if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
-            }
-        }
-
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
+        kShortestPaths[node].push_back(*candidatePaths[node].begin());
+        candidatePaths[node].erase(candidatePaths[node].begin());
     } else {
         // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
         STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
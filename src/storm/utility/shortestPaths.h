@@ -2,6 +2,7 @@
 #define STORM_UTIL_SHORTESTPATHS_H_
 
 #include <boost/optional/optional.hpp>
+#include <set>
 #include <unordered_set>
 #include <vector>
 
@@ -58,6 +59,18 @@ struct Path {
 template<typename T>
 std::ostream& operator<<(std::ostream& out, Path<T> const& p);
 
+// orders candidate paths by decreasing distance (i.e., probability); ties are broken by the arbitrary order of `Path`
+// such that the best candidate is always the first element of a std::set
+template<typename T>
+struct CandidateOrder {
+    bool operator()(const Path<T>& lhs, const Path<T>& rhs) const {
+        if (lhs.distance != rhs.distance) {
+            return lhs.distance > rhs.distance;
+        }
+        return lhs < rhs;
+    }
+};
+
 // when using the raw matrix/vector invocation, this enum parameter
 // forces the caller to declare whether the matrix has the evil I-P
 // format, which requires back-conversion of the entries
@@ -129,8 +142,9 @@ class ShortestPathsGenerator {
     std::vector<OrderedStateList> shortestPathSuccessors;
     std::vector<T> shortestPathDistances;
 
+    // each path is stored implicitly as its last edge plus a reference to a path of the predecessor, i.e., the paths form a (compressed) tree
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    std::vector<std::set<Path<T>, CandidateOrder<T>>> candidatePaths;
 
     /*!
      * Computes list of predecessors for all nodes.
@@ -162,10 +176,23 @@ class ShortestPathsGenerator {
     void initializeShortestPaths();
 
     /*!
-     * Main step of REA algorithm. TODO: Document further.
+     * Main step of REA algorithm: computes the k-shortest path to the given node, assuming that the (k-1) shortest paths are known.
+     * The computation of the next path to a predecessor, which is required for the candidates of the node, is done lazily.
+     * Instead of recursing, the pending nodes are kept on an explicit stack such that long paths do not exhaust the call stack.
      */
     void computeNextPath(state_t node, unsigned long k);
 
+    /*!
+     * Adds the candidates of steps B.1-B.5 for the k-shortest path to the node.
+     * Returns the predecessor whose next shortest path has to be computed first, if any.
+     */
+    boost::optional<std::pair<state_t, unsigned long>> addCandidates(state_t node, unsigned long k);
+
+    /*!
+     * Adds the candidate of steps B.2-B.5 and selects the k-shortest path to the node among the candidates (step B.6).
+     */
+    void selectNextPath(state_t node, unsigned long k);
+
     /*!
      * Computes k-shortest path if not yet computed.
      * @throws std::invalid_argument if no such k-shortest path exists
@@ -185,7 +212,7 @@ class ShortestPathsGenerator {
     // --- tiny helper fcts ---
 
     inline bool isInitialState(state_t node) const {
-        return std::find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
+        return node < initialStates.size() && initialStates.get(node);
     }
 
     inline bool isMetaTargetPredecessor(state_t node) const {
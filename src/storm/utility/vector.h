@@ -86,6 +86,52 @@ void setVectorValues(std::vector<T>& vector, storm::storage::BitVector const& po
     }
 }
 
+/*!
+ * Stores the given vectors in a single vector such that the entries of all vectors at the same position are consecutive, i.e.,
+ * the entry at position i of the j-th vector is placed at position i * vectors.size() + j.
+ *
+ * @param vectors The vectors to interleave. They need to have the same size.
+ * @return The interleaved vector.
+ */
+template<class T>
+std::vector<T> interleaveVectors(std::vector<std::vector<T>> const& vectors) {
+    uint64_t const numberOfVectors = vectors.size();
+    std::vector<T> result;
+    if (numberOfVectors == 0) {
+        return result;
+    }
+    result.resize(vectors.front().size() * numberOfVectors);
+    for (uint64_t j = 0; j < numberOfVectors; ++j) {
+        STORM_LOG_ASSERT(vectors[j].size() == vectors.front().size(), "Vectors to interleave differ in size.");
+        for (uint64_t i = 0; i < vectors[j].size(); ++i) {
+            result[i * numberOfVectors + j] = vectors[j][i];
+        }
+    }
+    return result;
+}
+
+/*!
+ * Reverses interleaveVectors, i.e., writes the entries of the given interleaved vector back to the given vectors.
+ *
+ * @param interleaved The interleaved vector.
+ * @param vectors The target vectors. Their number determines the number of interleaved vectors and they are resized as needed.
+ */
+template<class T>
+void deinterleaveVector(std::vector<T> const& interleaved, std::vector<std::vector<T>>& vectors) {
+    uint64_t const numberOfVectors = vectors.size();
+    if (numberOfVectors == 0) {
+        return;
+    }
+    STORM_LOG_ASSERT(interleaved.size() % numberOfVectors == 0, "Size of interleaved vector does not match the number of vectors.");
+    uint64_t const size = interleaved.size() / numberOfVectors;
+    for (uint64_t j = 0; j < numberOfVectors; ++j) {
+        vectors[j].resize(size);
+        for (uint64_t i = 0; i < size; ++i) {
+            vectors[j][i] = interleaved[i * numberOfVectors + j];
+        }
+    }
+}
+
 template<typename T>
 void setNonzeroIndices(std::vector<T> const& vec, storm::storage::BitVector& bv) {
     STORM_LOG_ASSERT(bv.size() == vec.size(), "Bitvector size should match vector size");
@@ -792,7 +838,7 @@ void reduceVectorMin(std::vector<T> const& source, std::vector<T>& target, std::
 template<class T>
 void reduceVectorMinParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                              std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
 }
 #endif
 
@@ -814,7 +860,7 @@ void reduceVectorMax(std::vector<T> const& source, std::vector<T>& target, std::
 template<class T>
 void reduceVectorMaxParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                              std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
 }
 #endif
 
@@ -3,7 +3,10 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/generator/DftNextStateGenerator.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 namespace {
 
@@ -88,4 +91,122 @@ TEST(DftModelBuildingTest, RelevantEvents) {
     EXPECT_EQ(13ul, model->getNumberOfTransitions());
 }
 
+TEST(DftModelBuildingTest, ConcurrentExploration) {
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    for (std::string file : {STORM_TEST_RESOURCES_DIR "/dft/dont_care.dft", STORM_TEST_RESOURCES_DIR "/dft/pdep.dft", STORM_TEST_RESOURCES_DIR "/dft/spare.dft"}) {
+        std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+        EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+        dft->setRelevantEvents(storm::dft::utility::RelevantEvents({"all"}), false);
+
+        storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+        builder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+
+        storm::dft::builder::ExplicitDFTModelBuilder<double> concurrentBuilder(*dft, symmetries);
+        concurrentBuilder.setNumberOfExplorationThreads(4);
+        concurrentBuilder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> concurrentModel = concurrentBuilder.getModel();
+        EXPECT_EQ(model->getNumberOfStates(), concurrentModel->getNumberOfStates()) << file;
+        EXPECT_EQ(model->getNumberOfTransitions(), concurrentModel->getNumberOfTransitions()) << file;
+        EXPECT_EQ(model->getStates("failed").getNumberOfSetBits(), concurrentModel->getStates("failed").getNumberOfSetBits()) << file;
+    }
+}
+
+
+TEST(DftModelBuildingTest, ReduceDependencyOrders) {
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F<=1 \"failed\"];Pmax=? [F<=1 \"failed\"]"));
+    for (std::string file : {STORM_TEST_RESOURCES_DIR "/dft/fdep_confluent.dft", STORM_TEST_RESOURCES_DIR "/dft/fdep3.dft",
+                             STORM_TEST_RESOURCES_DIR "/dft/spare_dc.dft"}) {
+        std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+            storm::dft::api::prepareForMarkovAnalysis<double>(*storm::dft::api::loadDFTGalileoFile<double>(file));
+        EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+        dft->setRelevantEvents(storm::dft::utility::RelevantEvents{}, false);
+
+        storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+        builder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+
+        storm::dft::builder::ExplicitDFTModelBuilder<double> reducedBuilder(*dft, symmetries);
+        reducedBuilder.setReduceDependencyOrders(true);
+        reducedBuilder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = reducedBuilder.getModel();
+        EXPECT_LE(reducedModel->getNumberOfStates(), model->getNumberOfStates()) << file;
+
+        // The reduction preserves the minimal and maximal failure probabilities
+        for (auto const& formula : formulas) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result(
+                storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true)));
+            std::unique_ptr<storm::modelchecker::CheckResult> reducedResult(
+                storm::api::verifyWithSparseEngine<double>(reducedModel, storm::api::createTask<double>(formula, true)));
+            EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()],
+                        reducedResult->asExplicitQuantitativeCheckResult<double>()[*reducedModel->getInitialStates().begin()], 1e-6)
+                << file;
+        }
+    }
+    // The failure of X triggers both dependencies after the PAND has become failsafe
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/fdep_confluent.dft"));
+    dft->setRelevantEvents(storm::dft::utility::RelevantEvents{}, false);
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+    builder.buildModel(0, 0.0);
+    storm::dft::builder::ExplicitDFTModelBuilder<double> reducedBuilder(*dft, symmetries);
+    reducedBuilder.setReduceDependencyOrders(true);
+    reducedBuilder.buildModel(0, 0.0);
+    EXPECT_LT(reducedBuilder.getModel()->getNumberOfStates(), builder.getModel()->getNumberOfStates());
+}
+
+TEST(DftModelBuildingTest, EliminateVanishingStates) {
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F<=1 \"failed\"];Pmax=? [F<=1 \"failed\"]"));
+    for (std::string file : {STORM_TEST_RESOURCES_DIR "/dft/fdep2.dft", STORM_TEST_RESOURCES_DIR "/dft/fdep4.dft",
+                             STORM_TEST_RESOURCES_DIR "/dft/fdep_confluent.dft", STORM_TEST_RESOURCES_DIR "/dft/pdep2.dft"}) {
+        std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+            storm::dft::api::prepareForMarkovAnalysis<double>(*storm::dft::api::loadDFTGalileoFile<double>(file));
+        EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+        dft->setRelevantEvents(storm::dft::utility::RelevantEvents{}, false);
+
+        storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+        builder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+
+        storm::dft::builder::ExplicitDFTModelBuilder<double> eliminatingBuilder(*dft, symmetries);
+        eliminatingBuilder.setEliminateVanishingStates(true);
+        eliminatingBuilder.buildModel(0, 0.0);
+        std::shared_ptr<storm::models::sparse::Model<double>> eliminatedModel = eliminatingBuilder.getModel();
+        EXPECT_LE(eliminatedModel->getNumberOfStates(), model->getNumberOfStates()) << file;
+
+        // Failure probabilities are preserved
+        for (auto const& formula : formulas) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result(
+                storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true)));
+            std::unique_ptr<storm::modelchecker::CheckResult> eliminatedResult(
+                storm::api::verifyWithSparseEngine<double>(eliminatedModel, storm::api::createTask<double>(formula, true)));
+            EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()],
+                        eliminatedResult->asExplicitQuantitativeCheckResult<double>()[*eliminatedModel->getInitialStates().begin()], 1e-6)
+                << file;
+        }
+    }
+    // The failure of B leads to a vanishing state in which C fails due to the dependency
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/fdep2.dft"));
+    dft->setRelevantEvents(storm::dft::utility::RelevantEvents{}, false);
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+    for (bool eliminate : {false, true}) {
+        storm::dft::generator::DftNextStateGenerator<double> generator(*dft, stateGenerationInfo);
+        generator.setEliminateVanishingStates(eliminate);
+        generator.load(generator.createInitialState());
+        bool vanishingSuccessor = false;
+        generator.expand([&vanishingSuccessor](std::shared_ptr<storm::dft::storage::DFTState<double>> const& state) {
+            vanishingSuccessor |= state->getFailableElements().hasDependencies();
+            return 1u;
+        });
+        EXPECT_EQ(!eliminate, vanishingSuccessor);
+    }
+}
 }  // namespace
@@ -122,6 +122,16 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, AllBirnbaumFactorsAtTimepoints) {
+    std::vector<double> const timepoints{0.5, 1, 2};
+    auto const allFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints)};
+    auto const basicElements{checker->getDFT()->getBasicElements()};
+    ASSERT_EQ(allFactors.size(), basicElements.size());
+    for (size_t i{0}; i < basicElements.size(); ++i) {
+        expectVectorNear(allFactors[i], checker->getBirnbaumFactorsAtTimepoints(basicElements[i]->name(), timepoints));
+    }
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
@@ -287,4 +297,19 @@ TEST(TestBdd, AndOrFormula) {
     EXPECT_EQ(result[7].GetShaHash(), "a4f129fa27c6cd32625b088811d4b12f8059ae0547ee035c083deed9ef9d2c59");
 }
 
+TEST(TestBdd, VariableOrderings) {
+    auto dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/bdd/ImportanceTest.dft");
+    for (auto const ordering : {storm::dft::transformations::BddVariableOrdering::ID, storm::dft::transformations::BddVariableOrdering::DEPTHFIRST,
+                                storm::dft::transformations::BddVariableOrdering::WEIGHTED}) {
+        auto manager{std::make_shared<storm::dft::storage::SylvanBddManager>()};
+        auto transformator{
+            std::make_shared<storm::dft::transformations::SftToBddTransformator<double>>(dft, manager, storm::dft::utility::RelevantEvents{}, ordering)};
+        // Every basic element gets a variable
+        EXPECT_EQ(transformator->getDdVariables().size(), dft->nrBasicElements());
+
+        storm::dft::modelchecker::SFTBDDChecker checker{transformator};
+        EXPECT_NEAR(checker.getProbabilityAtTimebound(1), 0.2655055433, 1e-6);
+    }
+}
+
 }  // namespace
@@ -86,4 +86,18 @@ static std::vector<ModularizerTestData> modularizerTestData{
 };
 INSTANTIATE_TEST_SUITE_P(BddModularizer, BddModularizerTest, testing::ValuesIn(modularizerTestData), [](auto const &info) { return info.param.testname; });
 
+TEST(BddModularizerTest, IsomorphicModules) {
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/bdd/ModuleIsomorphismTest.dft")};
+    storm::dft::modelchecker::DftModularizationChecker<double> checker{dft};
+    // The two isomorphic PANDs are only analyzed once
+    EXPECT_EQ(2ul, checker.getNumberOfAnalyzedModules());
+    double const sequentialResult = checker.getProbabilityAtTimebound(1);
+    EXPECT_NEAR(sequentialResult, 0.3988166132, 1e-6);
+
+    checker.setNumberOfThreads(2);
+    auto const concurrentResults = checker.getProbabilitiesAtTimepoints({0.5, 1});
+    EXPECT_NEAR(concurrentResults[1], sequentialResult, 1e-10);
+    EXPECT_LT(concurrentResults[0], concurrentResults[1]);
+}
+
 }  // namespace
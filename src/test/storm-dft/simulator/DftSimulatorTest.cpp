@@ -3,6 +3,7 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/generator/DftNextStateGenerator.h"
+#include "storm-dft/simulator/DFTMonteCarloSimulator.h"
 #include "storm-dft/simulator/DFTTraceSimulator.h"
 #include "storm-dft/storage/SymmetricUnits.h"
 
@@ -189,4 +190,33 @@ TEST(DftSimulatorTest, HecsUnreliability) {
     EXPECT_NEAR(result, 0.00021997582, 0.001);
 }
 
+
+TEST(DftSimulatorTest, MonteCarloEstimate) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/voting.dft")));
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents<double>(*dft, {}, {});
+    dft->setRelevantEvents(relevantEvents, false);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+
+    for (uint64_t threads : {1ul, 4ul}) {
+        storm::dft::simulator::DFTMonteCarloSimulator<double> simulator(*dft, stateGenerationInfo, 5u, threads);
+        simulator.setBatchSize(500);
+        auto estimate = simulator.estimateUnreliability(1, 0.01);
+        EXPECT_NEAR(estimate.probability, 0.4511883639, 0.02);
+        EXPECT_LE(estimate.lowerBound, estimate.probability);
+        EXPECT_GE(estimate.upperBound, estimate.probability);
+        // Sequential stopping rule
+        EXPECT_LE((estimate.upperBound - estimate.lowerBound) / 2, 0.01);
+        EXPECT_EQ(0ul, estimate.numberOfInvalidTraces);
+
+        // Same seed and number of threads yield the same estimate
+        storm::dft::simulator::DFTMonteCarloSimulator<double> simulator2(*dft, stateGenerationInfo, 5u, threads);
+        simulator2.setBatchSize(500);
+        auto estimate2 = simulator2.estimateUnreliability(1, 0.01);
+        EXPECT_EQ(estimate.numberOfSuccessfulTraces, estimate2.numberOfSuccessfulTraces);
+        EXPECT_EQ(estimate.numberOfTraces, estimate2.numberOfTraces);
+    }
+}
 }  // namespace
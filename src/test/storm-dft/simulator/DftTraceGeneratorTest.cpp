@@ -242,4 +242,31 @@ TYPED_TEST(DftTraceGeneratorTest, Fdep) {
     EXPECT_TRUE(state->hasFailed(dft->getTopLevelIndex()));
 }
 
+TYPED_TEST(DftTraceGeneratorTest, CompactState) {
+    auto pair = this->prepareDFT(STORM_TEST_RESOURCES_DIR "/dft/fdep.dft");
+    auto dft = pair.first;
+
+    boost::mt19937 gen(5u);
+    storm::dft::simulator::DFTTraceSimulator<double> simulator(*dft, pair.second, gen);
+
+    // Let B_Power fail such that the dependency becomes failable
+    auto iterFailable = simulator.getCurrentState()->getFailableElements().begin();
+    ++iterFailable;
+    ++iterFailable;
+    ASSERT_EQ(iterFailable.getFailBE(*dft).first->name(), "B_Power");
+    EXPECT_EQ(simulator.step(iterFailable), storm::dft::simulator::SimulationResult::SUCCESSFUL);
+    auto state = simulator.getCurrentState();
+    ASSERT_TRUE(state->getFailableElements().hasDependencies());
+
+    // Only keep the status and reconstruct the remaining information
+    auto compactState = state->copy();
+    compactState->compact();
+    EXPECT_TRUE(compactState->isPseudoState());
+    EXPECT_EQ(state->status(), compactState->status());
+    EXPECT_FALSE(compactState->getFailableElements().hasBEs());
+    compactState->construct();
+    EXPECT_FALSE(compactState->isPseudoState());
+    EXPECT_EQ(state->getFailableElements().getCurrentlyFailableString(), compactState->getFailableElements().getCurrentlyFailableString());
+}
+
 }  // namespace
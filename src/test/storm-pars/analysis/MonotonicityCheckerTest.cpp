@@ -106,6 +106,15 @@ TEST(MonotonicityCheckerTest, Simple1_small_region) {
     EXPECT_EQ(storm::analysis::MonotonicityChecker<storm::RationalFunction>::Monotonicity::Incr, monChecker->checkLocalMonotonicity(order, 0, *var, region));
     EXPECT_EQ(storm::analysis::MonotonicityChecker<storm::RationalFunction>::Monotonicity::Incr, monChecker->checkLocalMonotonicity(order, 1, *var, region));
     EXPECT_EQ(storm::analysis::MonotonicityChecker<storm::RationalFunction>::Monotonicity::Decr, monChecker->checkLocalMonotonicity(order, 2, *var, region));
+
+    // The results for a subregion are obtained without checking the derivatives again
+    auto numberOfCheckedDerivatives = monChecker->getNumberOfCheckedDerivatives();
+    EXPECT_LT(0ull, numberOfCheckedDerivatives);
+    auto subRegion = storm::api::parseRegion<storm::RationalFunction>("0.6<=p<=0.8", modelParameters);
+    EXPECT_EQ(storm::analysis::MonotonicityChecker<storm::RationalFunction>::Monotonicity::Incr, monChecker->checkLocalMonotonicity(order, 0, *var, subRegion));
+    EXPECT_EQ(storm::analysis::MonotonicityChecker<storm::RationalFunction>::Monotonicity::Incr, monChecker->checkLocalMonotonicity(order, 1, *var, subRegion));
+    EXPECT_EQ(storm::analysis::MonotonicityChecker<storm::RationalFunction>::Monotonicity::Decr, monChecker->checkLocalMonotonicity(order, 2, *var, subRegion));
+    EXPECT_EQ(numberOfCheckedDerivatives, monChecker->getNumberOfCheckedDerivatives());
 }
 
 TEST(MonotonicityCheckerTest, Casestudy1) {
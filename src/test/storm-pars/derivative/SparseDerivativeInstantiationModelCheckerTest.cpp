@@ -155,6 +155,17 @@ void SparseDerivativeInstantiationModelCheckerTest<TestType>::testModel(std::sha
             auto derivative = derivativeModelChecker.check(env(), instantiation, parameter);
             ASSERT_NEAR(storm::utility::convertNumber<double>(derivative->getValueVector()[0]), storm::utility::convertNumber<double>(expectedResult), 1e-6) << instantiation;
         }
+
+        // Compute all derivatives at once.
+        std::vector<VariableType<storm::RationalFunction>> instantiationParameters;
+        for (auto const& position : instantiation) {
+            instantiationParameters.push_back(position.first);
+        }
+        auto batchedDerivatives = derivativeModelChecker.checkMultipleParameters(env(), instantiation, instantiationParameters, boost::none, 2);
+        ASSERT_EQ(instantiationParameters.size(), batchedDerivatives.size());
+        for (auto const& parameter : instantiationParameters) {
+            ASSERT_NEAR(storm::utility::convertNumber<double>(batchedDerivatives.at(parameter)->getValueVector()[0]), storm::utility::convertNumber<double>(testCase.second.at(parameter)), 1e-6) << instantiation;
+        }
     }
 }
 
@@ -128,6 +128,129 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_concurrentRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.5<=pK<=0.95", modelParameters);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+
+        // Without a coverage threshold, both refinements analyze the same regions up to the given depth.
+        auto sequentialChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto sequentialResult = sequentialChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> regionCheckers;
+        for (uint64_t i = 0; i < 4; ++i) {
+            regionCheckers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+        }
+        storm::modelchecker::ConcurrentRegionRefinement<storm::RationalFunction> concurrentRefinement(regionCheckers);
+        auto concurrentResult = concurrentRefinement.performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+
+        ASSERT_EQ(sequentialResult->getRegionResults().size(), concurrentResult->getRegionResults().size());
+        auto getArea = [](storm::modelchecker::RegionRefinementCheckResult<storm::RationalFunction> const& result, storm::modelchecker::RegionResult const& regionResult) {
+            auto area = storm::utility::zero<storm::RationalNumber>();
+            for (auto const& res : result.getRegionResults()) {
+                if (res.second == regionResult) {
+                    area += res.first.area();
+                }
+            }
+            return area;
+        };
+        EXPECT_EQ(getArea(*sequentialResult, storm::modelchecker::RegionResult::AllSat), getArea(*concurrentResult, storm::modelchecker::RegionResult::AllSat));
+        EXPECT_EQ(getArea(*sequentialResult, storm::modelchecker::RegionResult::AllViolated), getArea(*concurrentResult, storm::modelchecker::RegionResult::AllViolated));
+        EXPECT_LT(storm::utility::zero<storm::RationalNumber>(), getArea(*concurrentResult, storm::modelchecker::RegionResult::AllSat));
+    }
+
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_sampledRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.9,0.5<=pK<=0.95", modelParameters);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+
+        // Sampling only skips the analysis of regions that contain satisfying and violating points, so the conclusive results do not change.
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto result = regionChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+        auto samplingRegionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        samplingRegionChecker->setSampling(16, 2);
+        auto samplingResult = samplingRegionChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+
+        ASSERT_EQ(result->getRegionResults().size(), samplingResult->getRegionResults().size());
+        auto getArea = [](storm::modelchecker::RegionRefinementCheckResult<storm::RationalFunction> const& result, storm::modelchecker::RegionResult const& regionResult) {
+            auto area = storm::utility::zero<storm::RationalNumber>();
+            for (auto const& res : result.getRegionResults()) {
+                if (res.second == regionResult) {
+                    area += res.first.area();
+                }
+            }
+            return area;
+        };
+        EXPECT_EQ(getArea(*result, storm::modelchecker::RegionResult::AllSat), getArea(*samplingResult, storm::modelchecker::RegionResult::AllSat));
+        EXPECT_EQ(getArea(*result, storm::modelchecker::RegionResult::AllViolated), getArea(*samplingResult, storm::modelchecker::RegionResult::AllViolated));
+
+        // The initial region contains satisfying and violating points.
+        auto samplingChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        samplingChecker->setSampling(64, 2);
+        EXPECT_EQ(storm::modelchecker::RegionResult::ExistsBoth, samplingChecker->sampleRegion(this->env(), region));
+    }
+
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_siblingRegions) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+
+        // Sibling regions share the bounds of some parameters. The results have to coincide with the results of a fresh region checker.
+        std::vector<std::string> regionStrings = {"0.7<=pL<=0.8,0.75<=pK<=0.95", "0.8<=pL<=0.9,0.75<=pK<=0.95", "0.8<=pL<=0.9,0.85<=pK<=0.95", "0.7<=pL<=0.8,0.75<=pK<=0.95"};
+        for (auto const& regionString : regionStrings) {
+            auto region = storm::api::parseRegion<storm::RationalFunction>(regionString, modelParameters);
+            auto freshRegionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+            for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+                double expected = storm::utility::convertNumber<double>(freshRegionChecker->getBoundAtInitState(this->env(), region, dir));
+                double actual = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), region, dir));
+                EXPECT_NEAR(expected, actual, 1e-5) << regionString;
+            }
+        }
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Rew) {
         typedef typename TestFixture::ValueType ValueType;
         std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
@@ -213,6 +336,37 @@ namespace {
         }
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_selectiveValidation) {
+        typedef typename TestFixture::ValueType ValueType;
+        if (!std::is_same<ValueType, storm::RationalNumber>::value) {
+
+            std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+            std::string formulaAsString = "P<=0.84 [F s=5 ]";
+            std::string constantsAsString = "";
+
+            storm::prism::Program program = storm::api::parseProgram(programFile);
+            program = storm::utility::prism::preprocess(program, constantsAsString);
+            std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+            std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+            // Only results whose value is within 0.01 of the threshold are validated exactly.
+            auto regionChecker = storm::api::initializeValidatingRegionModelChecker<storm::RationalFunction, ValueType, storm::RationalNumber>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true), false, true, storm::utility::convertNumber<ValueType>(0.01));
+
+            auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+            auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+            modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+            //start testing
+            auto allSatRegion=storm::api::parseRegion<storm::RationalFunction>("0.7<=pL<=0.9,0.75<=pK<=0.95", modelParameters);
+            auto exBothRegion=storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.65,0.75<=pK<=0.95", modelParameters);
+            auto allVioRegion=storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.73,0.2<=pK<=0.715", modelParameters);
+
+            EXPECT_EQ(storm::modelchecker::RegionResult::AllSat, regionChecker->analyzeRegion(this->env(), allSatRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+            EXPECT_EQ(storm::modelchecker::RegionResult::ExistsBoth, regionChecker->analyzeRegion(this->env(), exBothRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+            EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+        }
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Rew_exactValidation) {
         typedef typename TestFixture::ValueType ValueType;
         if (!std::is_same<ValueType, storm::RationalNumber>::value) {
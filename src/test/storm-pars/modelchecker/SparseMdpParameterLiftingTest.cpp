@@ -82,6 +82,38 @@ namespace {
         
     }
     
+    TYPED_TEST(SparseMdpParameterLiftingTest, two_dice_Prob_refinementHints) {
+        
+        typedef typename TestFixture::ValueType ValueType;
+        
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/two_dice.nm";
+        std::string formulaFile = "P<=0.17 [ F \"doubles\" ]";
+        
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaFile, program));
+        std::shared_ptr<storm::models::sparse::Mdp<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+        
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.3<=p1<=0.7,0.3<=p2<=0.7", modelParameters);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        
+        // Using the results of the parent regions as hints must not change the results of the refinement.
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto result = regionChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+        auto regionCheckerWithoutHints = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto mdpRegionChecker = std::dynamic_pointer_cast<storm::modelchecker::SparseMdpParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, ValueType>>(regionCheckerWithoutHints);
+        ASSERT_TRUE(mdpRegionChecker != nullptr);
+        mdpRegionChecker->setMaximalNumberOfStoredRegionHints(0);
+        auto resultWithoutHints = regionCheckerWithoutHints->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), 3);
+        
+        ASSERT_EQ(resultWithoutHints->getRegionResults().size(), result->getRegionResults().size());
+        for (uint64_t i = 0; i < result->getRegionResults().size(); ++i) {
+            EXPECT_EQ(resultWithoutHints->getRegionResults()[i].second, result->getRegionResults()[i].second) << result->getRegionResults()[i].first;
+        }
+    }
+    
     TYPED_TEST(SparseMdpParameterLiftingTest, two_dice_Prob_bounded) {
         
         typedef typename TestFixture::ValueType ValueType;
@@ -0,0 +1,73 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledRationalFunction.h"
+#include "storm/utility/constants.h"
+
+namespace {
+    std::vector<storm::RationalFunction> createFunctions(storm::RationalFunctionVariable const& varP, storm::RationalFunctionVariable const& varQ) {
+        std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+        auto p = storm::RationalFunction(storm::Polynomial(storm::RawPolynomial(varP), cache));
+        auto q = storm::RationalFunction(storm::Polynomial(storm::RawPolynomial(varQ), cache));
+        std::vector<storm::RationalFunction> result;
+        result.push_back(storm::RationalFunction(5));
+        result.push_back(p * (storm::RationalFunction(1) - p));
+        result.push_back(p * p * p * q + storm::RationalFunction(2) * q * q - storm::RationalFunction(3) * p + storm::RationalFunction(1));
+        result.push_back((p * q + storm::RationalFunction(1)) / (p * p + q + storm::RationalFunction(2)));
+        result.push_back(storm::RationalFunction(1) - storm::utility::convertNumber<storm::RationalFunction>(0.5) * p * q * q);
+        return result;
+    }
+}
+
+TEST(CompiledRationalFunctionTest, Evaluate) {
+    carl::VariablePool::getInstance().clear();
+    storm::RationalFunctionVariable varP = storm::createRFVariable("p");
+    storm::RationalFunctionVariable varQ = storm::createRFVariable("q");
+
+    for (auto const& function : createFunctions(varP, varQ)) {
+        storm::utility::CompiledRationalFunction<storm::RationalNumber> exactFunction(function);
+        storm::utility::CompiledRationalFunction<double> doubleFunction(function);
+        for (double valueP : {0.0, 0.3, 0.5, 1.0}) {
+            for (double valueQ : {0.1, 0.7, 1.0}) {
+                storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+                valuation.emplace(varP, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueP));
+                valuation.emplace(varQ, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueQ));
+                storm::RationalNumber expected = storm::utility::convertNumber<storm::RationalNumber>(function.evaluate(valuation));
+                EXPECT_EQ(expected, exactFunction.evaluate(valuation)) << function;
+                EXPECT_NEAR(storm::utility::convertNumber<double>(expected), doubleFunction.evaluate(valuation), 1e-12) << function;
+            }
+        }
+    }
+}
+
+TEST(CompiledRationalFunctionTest, EvaluateBatch) {
+    carl::VariablePool::getInstance().clear();
+    storm::RationalFunctionVariable varP = storm::createRFVariable("p");
+    storm::RationalFunctionVariable varQ = storm::createRFVariable("q");
+
+    std::vector<double> valuesP = {0.0, 0.2, 0.4, 0.6, 0.8, 1.0};
+    std::vector<double> valuesQ = {1.0, 0.9, 0.5, 0.3, 0.25, 0.1};
+    for (auto const& function : createFunctions(varP, varQ)) {
+        storm::utility::CompiledRationalFunction<double> compiledFunction(function);
+        std::vector<std::vector<double> const*> variableValues;
+        for (auto const& variable : compiledFunction.getVariables()) {
+            variableValues.push_back(variable == varP ? &valuesP : &valuesQ);
+        }
+        std::vector<double> result(valuesP.size());
+        compiledFunction.evaluate(variableValues, result);
+        for (uint64_t i = 0; i < valuesP.size(); ++i) {
+            std::vector<double> values;
+            for (auto const& variable : compiledFunction.getVariables()) {
+                values.push_back(variable == varP ? valuesP[i] : valuesQ[i]);
+            }
+            EXPECT_DOUBLE_EQ(compiledFunction.evaluate(values), result[i]) << function;
+        }
+    }
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 
 TEST(ModelInstantiatorTest, BrpProb) {
@@ -139,6 +140,54 @@ TEST(ModelInstantiatorTest, BrpProb) {
     }
 }
 
+TEST(ModelInstantiatorTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> batchInstantiator(*dtmc);
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (double valueL : {0.1, 0.5, 0.8, 1.0}) {
+        for (double valueK : {0.3, 0.9, 1.0}) {
+            valuations.emplace_back();
+            valuations.back().insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueL)));
+            valuations.back().insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueK)));
+        }
+    }
+    
+    batchInstantiator.evaluateBatch(valuations);
+    ASSERT_EQ(valuations.size(), batchInstantiator.getBatchSize());
+    // Instantiate in reverse order to make sure that all valuations are kept.
+    for (uint64_t index = valuations.size(); index > 0; --index) {
+        storm::models::sparse::Dtmc<double> const& batchInstantiated = batchInstantiator.instantiateFromBatch(index - 1);
+        storm::models::sparse::Dtmc<double> const& instantiated = modelInstantiator.instantiate(valuations[index - 1]);
+        ASSERT_EQ(instantiated.getTransitionMatrix().getEntryCount(), batchInstantiated.getTransitionMatrix().getEntryCount());
+        auto batchEntry = batchInstantiated.getTransitionMatrix().begin();
+        for (auto const& entry : instantiated.getTransitionMatrix()) {
+            EXPECT_EQ(entry.getColumn(), batchEntry->getColumn());
+            EXPECT_NEAR(entry.getValue(), batchEntry->getValue(), 1e-12);
+            ++batchEntry;
+        }
+    }
+    STORM_SILENT_EXPECT_THROW(batchInstantiator.instantiateFromBatch(valuations.size()), storm::exceptions::InvalidArgumentException);
+}
+
 TEST(ModelInstantiatorTest, Brp_Rew) {
     carl::VariablePool::getInstance().clear();
     
@@ -60,3 +60,31 @@ TEST(SmtPermissiveSchedulerTest, DieSelection) {
 
     //
 }
+
+TEST(SmtPermissiveSchedulerTest, DieSelectionMinimalPenalty) {
+    storm::Environment env;
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    std::string formulaString = "";
+    formulaString += "P<=0.16 [ F \"one\"];\n";
+    formulaString += "P<=0.05 [ F \"one\"];\n";
+    auto formulas = formulaParser.parseFromString(formulaString);
+
+    auto const& formula02b = formulas[0].getRawFormula()->asProbabilityOperatorFormula();
+    auto const& formula001b = formulas[1].getRawFormula()->asProbabilityOperatorFormula();
+
+    storm::generator::NextStateGeneratorOptions options(formula02b);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    boost::optional<storm::ps::SubMDPPermissiveScheduler<>> perms = storm::ps::computePermissiveSchedulerViaSMT<>(*mdp, formula02b, true);
+    EXPECT_TRUE(perms.is_initialized());
+    boost::optional<storm::ps::SubMDPPermissiveScheduler<>> perms2 = storm::ps::computePermissiveSchedulerViaSMT<>(*mdp, formula001b, true);
+    EXPECT_FALSE(perms2.is_initialized());
+
+    auto submdp = perms->apply();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(submdp);
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, formula02b);
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
@@ -9,6 +9,7 @@
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 
 
@@ -83,6 +84,45 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
     }
 }
 
+void portfoliosearch_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path);
+    program = storm::utility::prism::preprocess(program, constants);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    // Run graph algorithm
+    auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(*pomdp, *formula);
+    storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
+    storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
+            formula->asProbabilityOperatorFormula());
+    pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    storm::pomdp::MemlessSearchOptions options;
+    uint64_t lookahead = pomdp->getNumberOfStates();
+    storm::pomdp::PolicySearchPortfolio<double> portfolio(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory,
+                                                          storm::pomdp::PolicySearchPortfolio<double>::createDefaultConfigurations(options, lookahead));
+    if (wr) {
+        portfolio.computeWinningRegion();
+    } else {
+        portfolio.analyzeForInitialStates();
+    }
+    // Target states are always winning
+    for (auto state : targetStates) {
+        uint64_t observation = pomdp->getObservation(state);
+        uint64_t offset = 0;
+        for (uint64_t otherState = 0; otherState < state; ++otherState) {
+            if (pomdp->getObservation(otherState) == observation) {
+                ++offset;
+            }
+        }
+        EXPECT_TRUE(portfolio.getLastWinningRegion().isWinning(observation, offset));
+    }
+}
+
 
 void symbolicbelsup_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
     storm::prism::Program program = storm::parser::PrismParser::parse(path);
@@ -157,6 +197,22 @@ TEST(QualitativeAnalysis, Iterative_Maze) {
     iterativesearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
 }
 
+TEST(QualitativeAnalysis, Portfolio_Simple) {
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
+
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", true);
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", true);
+}
+
+TEST(QualitativeAnalysis, Portfolio_Maze) {
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]", false);
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", false);
+
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]", true);
+    portfoliosearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
+}
+
 TEST(QualitativeAnalysis, SymbolicBelSup_Simple) {
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
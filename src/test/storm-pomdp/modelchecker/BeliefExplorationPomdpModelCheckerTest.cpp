@@ -123,6 +123,51 @@ namespace {
         static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision();}
     };
     
+    class ConcurrentRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.concurrentRefinement = true;}
+    };
+    
+    class ParallelExpansionRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.expansionThreads = 2;}
+    };
+    
+    class HeuristicSearchRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision(); options.heuristicSearchExploration = true;}
+    };
+    
     class DefaultDoubleOVIEnvironment {
     public:
         typedef double ValueType;
@@ -241,6 +286,9 @@ namespace {
             FineDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
+            ConcurrentRefineDoubleVIEnvironment,
+            ParallelExpansionRefineDoubleVIEnvironment,
+            HeuristicSearchRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
             DefaultRationalPIEnvironment,
             PreprocessedDefaultRationalPIEnvironment
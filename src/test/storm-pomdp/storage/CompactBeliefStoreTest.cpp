@@ -0,0 +1,56 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm-pomdp/storage/CompactBeliefStore.h"
+
+TEST(CompactBeliefStore, FindOrAdd) {
+    typedef storm::storage::CompactBeliefStore<uint64_t, double> StoreType;
+    StoreType store;
+    EXPECT_EQ(0ul, store.size());
+
+    StoreType::BeliefType first;
+    first[0] = 0.5;
+    first[3] = 0.5;
+    StoreType::BeliefType second;
+    second[0] = 0.25;
+    second[3] = 0.75;
+    StoreType::BeliefType dirac;
+    dirac[2] = 1.0;
+
+    EXPECT_EQ(store.noId(), store.find(first));
+    EXPECT_EQ(0ul, store.findOrAdd(first));
+    EXPECT_EQ(1ul, store.findOrAdd(second));
+    EXPECT_EQ(2ul, store.findOrAdd(dirac));
+    EXPECT_EQ(0ul, store.findOrAdd(first));
+    EXPECT_EQ(1ul, store.find(second));
+    EXPECT_EQ(3ul, store.size());
+    EXPECT_EQ(5ul, store.getNumberOfEntries());
+
+    auto view = store.getBelief(1);
+    ASSERT_EQ(2ul, view.size());
+    EXPECT_EQ(3ul, (view.begin() + 1)->first);
+    EXPECT_EQ(0.75, (view.begin() + 1)->second);
+    EXPECT_EQ(second, view.toBelief());
+    EXPECT_EQ(dirac, store.getBelief(2).toBelief());
+}
+
+TEST(CompactBeliefStore, ManyBeliefs) {
+    typedef storm::storage::CompactBeliefStore<uint64_t, double> StoreType;
+    StoreType store;
+    // Adds sufficiently many beliefs such that the hash table needs to grow several times.
+    uint64_t const numberOfBeliefs = 10000;
+    for (uint64_t i = 0; i < numberOfBeliefs; ++i) {
+        StoreType::BeliefType belief;
+        belief[i % 100] = 1.0 / (2 + i / 100);
+        belief[100 + i % 7] = 1.0 - belief[i % 100];
+        EXPECT_EQ(i, store.findOrAdd(belief));
+    }
+    EXPECT_EQ(numberOfBeliefs, store.size());
+    EXPECT_GE(store.getMemoryUsage(), store.getNumberOfEntries() * sizeof(StoreType::EntryType));
+    for (uint64_t i = 0; i < numberOfBeliefs; ++i) {
+        StoreType::BeliefType belief;
+        belief[i % 100] = 1.0 / (2 + i / 100);
+        belief[100 + i % 7] = 1.0 - belief[i % 100];
+        EXPECT_EQ(i, store.find(belief));
+        EXPECT_EQ(belief, store.getBelief(i).toBelief());
+    }
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/logic/AtomicLabelFormula.h"
+#include "storm/logic/EventuallyFormula.h"
+
+#include <sys/stat.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+TEST(LTL2DeterministicAutomaton, CachedTranslation) {
+    // A fake external tool which writes a fixed automaton and counts its invocations
+    char directoryTemplate[] = "/tmp/storm-ltl2da-XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(directoryTemplate));
+    std::string directory(directoryTemplate);
+    std::string tool = directory + "/ltl2da.sh";
+    std::string calls = directory + "/calls";
+    {
+        std::ofstream script(tool);
+        script << "#!/bin/sh\n"
+               << "echo call >> " << calls << "\n"
+               << "cat > \"$2\" <<EOF\n"
+               << "HOA: v1\nStates: 2\nStart: 0\nacc-name: Buchi\nAcceptance: 1 Inf(0)\nAP: 1 \"p0\"\n--BODY--\n"
+               << "State: 0\n0\n1\nState: 1 {0}\n1\n1\n--END--\n"
+               << "EOF\n";
+    }
+    ASSERT_EQ(0, chmod(tool.c_str(), S_IRWXU));
+    auto countCalls = [&calls]() {
+        std::ifstream in(calls);
+        std::string line;
+        uint64_t count = 0;
+        while (std::getline(in, line)) {
+            ++count;
+        }
+        return count;
+    };
+
+    storm::logic::EventuallyFormula formula(std::make_shared<storm::logic::AtomicLabelFormula>("p0"));
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+
+    auto da = storm::automata::LTL2DeterministicAutomaton::ltl2daCached(formula, false, tool, directory);
+    EXPECT_EQ(2ul, da->getNumberOfStates());
+    EXPECT_EQ(1ul, countCalls());
+
+    // Reused from memory
+    auto cachedDa = storm::automata::LTL2DeterministicAutomaton::ltl2daCached(formula, false, tool, directory);
+    EXPECT_EQ(da, cachedDa);
+    EXPECT_EQ(1ul, countCalls());
+
+    // Reused from the cache directory
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+    auto persistedDa = storm::automata::LTL2DeterministicAutomaton::ltl2daCached(formula, false, tool, directory);
+    EXPECT_EQ(1ul, countCalls());
+    EXPECT_EQ(2ul, persistedDa->getNumberOfStates());
+    EXPECT_TRUE(persistedDa->isSink(1));
+    EXPECT_FALSE(persistedDa->isSink(0));
+
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+}
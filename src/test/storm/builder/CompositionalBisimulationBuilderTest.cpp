@@ -0,0 +1,45 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/builder/CompositionalBisimulationBuilder.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/jani/Property.h"
+
+TEST(CompositionalBisimulationBuilderTest, CanHandle) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/machines3.sm");
+    EXPECT_TRUE(storm::builder::CompositionalBisimulationBuilder<double>::canHandle(program));
+
+    // The modules of the tandem queue synchronize.
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm");
+    EXPECT_FALSE(storm::builder::CompositionalBisimulationBuilder<double>::canHandle(program));
+}
+
+TEST(CompositionalBisimulationBuilderTest, Machines) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/machines3.sm");
+    std::string formulasAsString = "P=? [ F<=2 \"down1\" ]; P=? [ F<=2 \"down2\" | \"down3\" ]";
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+
+    for (auto const& formula : formulas) {
+        // Compare the compositionally built quotient to the quotient of the full model.
+        std::shared_ptr<storm::models::sparse::Model<double>> fullModel = storm::api::buildSparseModel<double>(program, {formula});
+        EXPECT_EQ(27ul, fullModel->getNumberOfStates());
+        std::shared_ptr<storm::models::sparse::Model<double>> quotient = storm::api::performBisimulationMinimization<double>(fullModel, {formula});
+
+        std::shared_ptr<storm::models::sparse::Ctmc<double>> compositionalQuotient =
+            storm::builder::CompositionalBisimulationBuilder<double>::build(program, {formula});
+        EXPECT_EQ(quotient->getNumberOfStates(), compositionalQuotient->getNumberOfStates());
+        EXPECT_EQ(quotient->getNumberOfTransitions(), compositionalQuotient->getNumberOfTransitions());
+        EXPECT_GT(fullModel->getNumberOfStates(), compositionalQuotient->getNumberOfStates());
+
+        auto fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, storm::api::createTask<double>(formula, true));
+        auto compositionalResult = storm::api::verifyWithSparseEngine<double>(compositionalQuotient, storm::api::createTask<double>(formula, true));
+        EXPECT_NEAR(fullResult->asExplicitQuantitativeCheckResult<double>()[*fullModel->getInitialStates().begin()],
+                    compositionalResult->asExplicitQuantitativeCheckResult<double>()[*compositionalQuotient->getInitialStates().begin()], 1e-6);
+    }
+}
@@ -0,0 +1,91 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ConstantSweepModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace {
+
+std::string const program =
+    "dtmc\n"
+    "const double p;\n"
+    "const int N;\n"
+    "module counter\n"
+    "    s : [0..N] init 0;\n"
+    "    [] s<N -> p : (s'=s+1) + 1-p : (s'=0);\n"
+    "    [] s=N -> 1 : true;\n"
+    "endmodule\n"
+    "rewards \"steps\"\n"
+    "    s<N : 2*p;\n"
+    "endrewards\n";
+
+void expectSameModel(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    ASSERT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+    EXPECT_EQ(expected.getInitialStates(), actual.getInitialStates());
+    for (uint64_t row = 0; row < expected.getTransitionMatrix().getRowCount(); ++row) {
+        auto expectedRow = expected.getTransitionMatrix().getRow(row);
+        auto actualRow = actual.getTransitionMatrix().getRow(row);
+        ASSERT_EQ(expectedRow.getNumberOfEntries(), actualRow.getNumberOfEntries());
+        for (auto expectedIt = expectedRow.begin(), actualIt = actualRow.begin(); expectedIt != expectedRow.end(); ++expectedIt, ++actualIt) {
+            EXPECT_EQ(expectedIt->getColumn(), actualIt->getColumn());
+            EXPECT_NEAR(expectedIt->getValue(), actualIt->getValue(), 1e-12);
+        }
+    }
+    auto const& expectedRewards = expected.getRewardModel("steps").getStateRewardVector();
+    auto const& actualRewards = actual.getRewardModel("steps").getStateRewardVector();
+    ASSERT_EQ(expectedRewards.size(), actualRewards.size());
+    for (uint64_t state = 0; state < expectedRewards.size(); ++state) {
+        EXPECT_NEAR(expectedRewards[state], actualRewards[state], 1e-12);
+    }
+}
+
+}  // namespace
+
+TEST(ConstantSweepModelBuilderTest, ValueConstants) {
+    storm::prism::Program prismProgram = storm::parser::PrismParser::parseFromString(program, "testfile");
+    storm::builder::BuilderOptions options(true, true);
+    storm::builder::ConstantSweepModelBuilder<double> builder(prismProgram, options);
+
+    storm::expressions::Variable p = prismProgram.getConstant("p").getExpressionVariable();
+    storm::expressions::Variable n = prismProgram.getConstant("N").getExpressionVariable();
+    ASSERT_EQ(1ul, builder.getValueConstants().size());
+    EXPECT_EQ(1ul, builder.getValueConstants().count(p));
+
+    auto const& manager = prismProgram.getManager();
+    for (auto const& definition : std::vector<std::pair<double, int64_t>>({{0.3, 3}, {0.6, 3}, {0.25, 5}, {0.9, 3}})) {
+        std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions = {{p, manager.rational(definition.first)},
+                                                                                                      {n, manager.integer(definition.second)}};
+        auto model = builder.build(constantDefinitions);
+        auto expected = storm::builder::ExplicitModelBuilder<double>(prismProgram.defineUndefinedConstants(constantDefinitions), options).build();
+        expectSameModel(*expected, *model);
+    }
+
+    // The state space is only explored once for each value of N.
+    EXPECT_EQ(2ul, builder.getNumberOfExplorations());
+}
+
+TEST(ConstantSweepModelBuilderTest, StructuralConstants) {
+    std::string guardProgram =
+        "dtmc\n"
+        "const double p;\n"
+        "module coin\n"
+        "    s : [0..2] init 0;\n"
+        "    [] s=0 & p>0.5 -> p : (s'=1) + 1-p : (s'=2);\n"
+        "    [] s=0 & p<=0.5 -> 1 : (s'=2);\n"
+        "    [] s>0 -> 1 : true;\n"
+        "endmodule\n";
+    storm::prism::Program prismProgram = storm::parser::PrismParser::parseFromString(guardProgram, "testfile");
+    storm::builder::ConstantSweepModelBuilder<double> builder(prismProgram);
+    EXPECT_TRUE(builder.getValueConstants().empty());
+
+    storm::expressions::Variable p = prismProgram.getConstant("p").getExpressionVariable();
+    auto model = builder.build({{p, prismProgram.getManager().rational(0.7)}});
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    model = builder.build({{p, prismProgram.getManager().rational(0.2)}});
+    EXPECT_EQ(2ul, model->getNumberOfStates());
+    EXPECT_EQ(2ul, builder.getNumberOfExplorations());
+}
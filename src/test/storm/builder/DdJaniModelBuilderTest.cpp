@@ -17,6 +17,7 @@
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 TEST(DdJaniModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -666,3 +667,26 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+TEST(DdJaniModelBuilderTest_Cudd, ReachabilityMethods) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::jani::Model mdpModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::jani::Model dtmcModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double> builder;
+
+    for (auto method : {storm::utility::dd::ReachabilityMethod::Chaining, storm::utility::dd::ReachabilityMethod::Saturation}) {
+        storm::settings::mutableBuildSettings().setDdReachabilityMethod(method);
+
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = builder.build(mdpModel);
+        std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+        EXPECT_EQ(364ul, mdp->getNumberOfStates());
+        EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+
+        model = builder.build(dtmcModel);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    }
+    storm::settings::mutableBuildSettings().setDdReachabilityMethod(storm::utility::dd::ReachabilityMethod::Bfs);
+}
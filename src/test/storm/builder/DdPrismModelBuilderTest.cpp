@@ -336,3 +336,26 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
 }
+
+TEST(DdPrismModelBuilderTest_Sylvan, ReachabilityMethods) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program mdpProgram = modelDescription.preprocess().asPrismProgram();
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program dtmcProgram = modelDescription.preprocess().asPrismProgram();
+
+    for (auto method : {storm::utility::dd::ReachabilityMethod::Chaining, storm::utility::dd::ReachabilityMethod::Saturation}) {
+        storm::settings::mutableBuildSettings().setDdReachabilityMethod(method);
+
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+            storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(mdpProgram);
+        std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+        EXPECT_EQ(364ul, mdp->getNumberOfStates());
+        EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+
+        model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(dtmcProgram);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    }
+    storm::settings::mutableBuildSettings().setDdReachabilityMethod(storm::utility::dd::ReachabilityMethod::Bfs);
+}
@@ -0,0 +1,74 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/prism/Program.h"
+
+TEST(DdVariableOrderingTest, Force) {
+    // Two pairs of interacting variables that are declared in an interleaved manner.
+    storm::builder::DdVariableInteractions interactions(4);
+    interactions.addHyperedge({0, 2});
+    interactions.addHyperedge({1, 3});
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 1, 3}), storm::builder::computeDdVariableOrder(storm::builder::DdVariableOrderingHeuristic::Force, interactions));
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2, 3}),
+              storm::builder::computeDdVariableOrder(storm::builder::DdVariableOrderingHeuristic::Declaration, interactions));
+
+    storm::builder::DdVariableInteractions interactions2(6);
+    interactions2.addHyperedge({0, 3});
+    interactions2.addHyperedge({1, 4});
+    interactions2.addHyperedge({5, 2, 2});
+    EXPECT_EQ(std::vector<uint64_t>({0, 3, 1, 4, 2, 5}),
+              storm::builder::computeDdVariableOrder(storm::builder::DdVariableOrderingHeuristic::Force, interactions2));
+}
+
+TEST(DdVariableOrderingTest, Clustering) {
+    // Three components with two variables each, where the last one communicates with both others but mostly with the first.
+    storm::builder::DdVariableInteractions interactions(6);
+    for (uint64_t variable = 0; variable < 6; ++variable) {
+        interactions.setComponent(variable, variable / 2);
+    }
+    interactions.addHyperedge({0, 4});
+    interactions.addHyperedge({1, 5});
+    interactions.addHyperedge({3, 4});
+    EXPECT_EQ(std::vector<uint64_t>({4, 5, 0, 1, 2, 3}),
+              storm::builder::computeDdVariableOrder(storm::builder::DdVariableOrderingHeuristic::Clustering, interactions));
+}
+
+TEST(DdVariableOrderingTest, PrismProgram) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::vector<storm::expressions::Variable> declarationOrder;
+    for (auto const& module : program.getModules()) {
+        for (auto const& variable : module.getIntegerVariables()) {
+            declarationOrder.push_back(variable.getExpressionVariable());
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            declarationOrder.push_back(variable.getExpressionVariable());
+        }
+    }
+
+    for (auto heuristic : {storm::builder::DdVariableOrderingHeuristic::Declaration, storm::builder::DdVariableOrderingHeuristic::Force,
+                           storm::builder::DdVariableOrderingHeuristic::Clustering}) {
+        std::vector<storm::expressions::Variable> order = storm::builder::orderDdVariables(heuristic, program, declarationOrder);
+        EXPECT_TRUE(std::is_permutation(order.begin(), order.end(), declarationOrder.begin(), declarationOrder.end())) << heuristic;
+    }
+
+    // The clustering keeps the variables of each module together.
+    std::vector<storm::expressions::Variable> order =
+        storm::builder::orderDdVariables(storm::builder::DdVariableOrderingHeuristic::Clustering, program, declarationOrder);
+    for (auto const& module : program.getModules()) {
+        std::vector<uint64_t> positions;
+        for (auto const& variable : module.getIntegerVariables()) {
+            positions.push_back(std::find(order.begin(), order.end(), variable.getExpressionVariable()) - order.begin());
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            positions.push_back(std::find(order.begin(), order.end(), variable.getExpressionVariable()) - order.begin());
+        }
+        auto minMax = std::minmax_element(positions.begin(), positions.end());
+        EXPECT_EQ(positions.size() - 1, *minMax.second - *minMax.first) << module.getName();
+    }
+}
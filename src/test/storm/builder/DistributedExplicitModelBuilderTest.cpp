@@ -0,0 +1,87 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <thread>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DistributedExplicitModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/DistributedValueIteration.h"
+#include "storm/utility/Communicator.h"
+
+namespace {
+
+struct GroupResult {
+    double numberOfStates = 0.0;
+    double numberOfTransitions = 0.0;
+    double initialValue = 0.0;
+};
+
+/*!
+ * Builds the model on every member of a group of threads and computes the probability to reach the given label from the initial state.
+ */
+GroupResult buildOnGroup(std::string const& filename, uint64_t size, uint64_t batchSize, std::string const& targetLabel) {
+    auto group = storm::utility::ThreadCommunicator::createGroup(size);
+    std::vector<GroupResult> results(size);
+    std::vector<std::thread> threads;
+    for (uint64_t rank = 0; rank < size; ++rank) {
+        threads.emplace_back([&, rank]() {
+            // Every member parses the program itself, as the generators must not share an expression manager.
+            storm::prism::Program program = storm::parser::PrismParser::parse(filename);
+            storm::builder::DistributedExplicitModelBuilder builder(program, storm::builder::BuilderOptions(true, true), group[rank], batchSize);
+            auto model = builder.build();
+            auto const& matrix = *model.transitionMatrix;
+            results[rank].numberOfStates = group[rank]->allReduceSum(static_cast<double>(matrix.getNumberOfLocalStates()));
+            results[rank].numberOfTransitions = group[rank]->allReduceSum(static_cast<double>(matrix.getLocalMatrix().getEntryCount()));
+
+            storm::solver::DistributedValueIteration solver(matrix);
+            solver.setPrecision(1e-8);
+            boost::optional<storm::OptimizationDirection> direction;
+            if (model.modelType == storm::models::ModelType::Mdp) {
+                direction = storm::OptimizationDirection::Maximize;
+            }
+            auto values = solver.computeReachabilityProbabilities(model.stateLabeling.getStates(targetLabel), direction);
+            double initialValue = 0.0;
+            for (auto state : model.stateLabeling.getStates("init")) {
+                initialValue += values[state];
+            }
+            results[rank].initialValue = group[rank]->allReduceSum(initialValue);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (uint64_t rank = 1; rank < size; ++rank) {
+        EXPECT_EQ(results.front().numberOfStates, results[rank].numberOfStates);
+        EXPECT_EQ(results.front().initialValue, results[rank].initialValue);
+    }
+    return results.front();
+}
+
+}  // namespace
+
+TEST(DistributedExplicitModelBuilderTest, Dtmc) {
+    for (uint64_t batchSize : {1ul, 65536ul}) {
+        auto result = buildOnGroup(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", 3, batchSize, "one");
+        EXPECT_EQ(13.0, result.numberOfStates);
+        EXPECT_EQ(20.0, result.numberOfTransitions);
+        EXPECT_NEAR(1.0 / 6.0, result.initialValue, 1e-6);
+    }
+}
+
+TEST(DistributedExplicitModelBuilderTest, Mdp) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+
+    auto result = buildOnGroup(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", 4, 16, "three");
+    EXPECT_EQ(static_cast<double>(model->getNumberOfStates()), result.numberOfStates);
+    EXPECT_EQ(static_cast<double>(model->getNumberOfTransitions()), result.numberOfTransitions);
+    EXPECT_NEAR(2.0 / 36.0, result.initialValue, 1e-6);
+}
+
+TEST(DistributedExplicitModelBuilderTest, SingleMember) {
+    auto result = buildOnGroup(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", 1, 4, "two");
+    EXPECT_EQ(13.0, result.numberOfStates);
+    EXPECT_NEAR(1.0 / 6.0, result.initialValue, 1e-6);
+}
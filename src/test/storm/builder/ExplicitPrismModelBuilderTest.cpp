@@ -2,6 +2,7 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/ExplorationQueue.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -218,3 +219,233 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.parallelExploration = true;
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions = parallelOptions;
+    sequentialOptions.parallelExploration = false;
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildChoiceLabels();
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/coin2-2.nm", "/mdp/csma2-2.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        // The parallel exploration has to yield exactly the same state numbering.
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), parallelModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(sequentialModel->getStateLabeling(), parallelModel->getStateLabeling()) << file;
+        EXPECT_EQ(sequentialModel->getChoiceLabeling(), parallelModel->getChoiceLabeling()) << file;
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector()) << file;
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, LazyStateValuations) {
+    storm::generator::NextStateGeneratorOptions eagerOptions;
+    eagerOptions.setBuildAllLabels();
+    eagerOptions.setBuildStateValuations();
+    storm::generator::NextStateGeneratorOptions lazyOptions = eagerOptions;
+    lazyOptions.setBuildStateValuationsLazily();
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.parallelExploration = true;
+
+    for (std::string const& file : {"/dtmc/die.pm", "/mdp/coin2-2.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto eagerModel = storm::builder::ExplicitModelBuilder<double>(program, eagerOptions).build();
+        auto lazyModel = storm::builder::ExplicitModelBuilder<double>(program, lazyOptions).build();
+        auto parallelLazyModel = storm::builder::ExplicitModelBuilder<double>(program, lazyOptions, parallelOptions).build();
+        ASSERT_TRUE(lazyModel->hasStateValuations()) << file;
+        auto const& eagerValuations = eagerModel->getStateValuations();
+        auto const& lazyValuations = lazyModel->getStateValuations();
+        EXPECT_FALSE(eagerValuations.isLazy()) << file;
+        EXPECT_TRUE(lazyValuations.isLazy()) << file;
+        ASSERT_EQ(eagerValuations.getNumberOfStates(), lazyValuations.getNumberOfStates()) << file;
+        for (uint64_t state = 0; state < eagerModel->getNumberOfStates(); ++state) {
+            EXPECT_EQ(eagerValuations.toString(state), lazyValuations.toString(state)) << file;
+        }
+
+        // The parallel exploration numbers the states in BFS order.
+        auto parallelEagerModel = storm::builder::ExplicitModelBuilder<double>(program, eagerOptions, parallelOptions).build();
+        for (uint64_t state = 0; state < parallelEagerModel->getNumberOfStates(); ++state) {
+            EXPECT_EQ(parallelEagerModel->getStateValuations().toString(state), parallelLazyModel->getStateValuations().toString(state)) << file;
+        }
+
+        // Selecting states keeps the valuations lazy.
+        storm::storage::BitVector selectedStates(eagerModel->getNumberOfStates(), false);
+        selectedStates.set(0);
+        selectedStates.set(eagerModel->getNumberOfStates() - 1);
+        auto selectedLazyValuations = lazyValuations.selectStates(selectedStates);
+        auto selectedEagerValuations = eagerValuations.selectStates(selectedStates);
+        EXPECT_TRUE(selectedLazyValuations.isLazy()) << file;
+        ASSERT_EQ(2ul, selectedLazyValuations.getNumberOfStates()) << file;
+        EXPECT_EQ(selectedEagerValuations.toString(1), selectedLazyValuations.toString(1)) << file;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, TreeCompression) {
+    storm::builder::ExplicitModelBuilder<double>::Options compressedOptions;
+    compressedOptions.treeCompression = true;
+    storm::builder::ExplicitModelBuilder<double>::Options plainOptions = compressedOptions;
+    plainOptions.treeCompression = false;
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    for (std::string const& file : {"/dtmc/brp-16-2.pm", "/mdp/csma2-2.nm", "/mdp/coin2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto plainModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, plainOptions).build();
+        auto compressedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, compressedOptions).build();
+        EXPECT_EQ(plainModel->getTransitionMatrix(), compressedModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(plainModel->getStateLabeling(), compressedModel->getStateLabeling()) << file;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ExplorationQueue) {
+    uint64_t const bitsPerState = 100;
+    storm::builder::ExplorationQueue<uint32_t> queue(bitsPerState, 10);
+    auto makeState = [&](uint64_t i) {
+        storm::generator::CompressedState state(bitsPerState);
+        state.setFromInt(0, 64, i * 0x9E3779B97F4A7C15ull);
+        state.setFromInt(64, 36, i % 5);
+        return state;
+    };
+
+    uint32_t nextToPush = 0;
+    uint32_t nextToPop = 0;
+    for (uint64_t round = 0; round < 50; ++round) {
+        for (uint64_t i = 0; i < round % 7 + 3; ++i, ++nextToPush) {
+            queue.emplace_back(makeState(nextToPush), nextToPush);
+        }
+        for (uint64_t i = 0; i < round % 5 + 1 && !queue.empty(); ++i, ++nextToPop) {
+            ASSERT_EQ(nextToPop, queue.front().second);
+            EXPECT_EQ(makeState(nextToPop), queue.front().first);
+            queue.pop_front();
+        }
+        EXPECT_EQ(nextToPush - nextToPop, queue.size());
+    }
+    while (!queue.empty()) {
+        ASSERT_EQ(nextToPop, queue.front().second);
+        EXPECT_EQ(makeState(nextToPop), queue.front().first);
+        queue.pop_front();
+        ++nextToPop;
+    }
+    EXPECT_EQ(nextToPush, nextToPop);
+    EXPECT_LT(0ul, queue.getNumberOfWrittenFiles());
+}
+
+TEST(ExplicitPrismModelBuilderTest, FrontierSpill) {
+    storm::builder::ExplicitModelBuilder<double>::Options plainOptions;
+    storm::builder::ExplicitModelBuilder<double>::Options spillOptions = plainOptions;
+    spillOptions.maxFrontierStatesInMemory = 16;
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    for (std::string const& file : {"/dtmc/brp-16-2.pm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto plainModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, plainOptions).build();
+        auto spillModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, spillOptions).build();
+        EXPECT_EQ(plainModel->getTransitionMatrix(), spillModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(plainModel->getStateLabeling(), spillModel->getStateLabeling()) << file;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    std::string programText =
+        "mdp\n"
+        "module a\n"
+        "    x : [0..3] init 0;\n"
+        "    [] x<3 -> (x'=x+1);\n"
+        "endmodule\n"
+        "module b = a [x=y] endmodule\n"
+        "module c = a [x=z] endmodule\n"
+        "label \"done\" = z=3;\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programText, "testfile");
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.addLabel("done");
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(64ul, fullModel->getNumberOfStates());
+
+    // Modules a and b are invisible and independent, so only one of their interleavings is explored.
+    generatorOptions.setPartialOrderReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(10ul, reducedModel->getNumberOfStates());
+    EXPECT_EQ(10ul, reducedModel->getNumberOfTransitions());
+    EXPECT_EQ(1ul, reducedModel->getStates("done").getNumberOfSetBits());
+
+    // Once x is visible, only the interleavings of module b can be pruned.
+    generatorOptions.addLabel(program.getManager().getVariableExpression("x") == program.getManager().integer(3));
+    auto partiallyReducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(19ul, partiallyReducedModel->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    std::string programText =
+        "mdp\n"
+        "module a\n"
+        "    x : [0..2] init 0;\n"
+        "    [] x<2 -> 0.5:(x'=x+1) + 0.5:(x'=0);\n"
+        "endmodule\n"
+        "module b = a [x=y] endmodule\n"
+        "module c = a [x=z] endmodule\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programText, "testfile");
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(27ul, fullModel->getNumberOfStates());
+
+    // Only the multisets of the values of x, y and z are distinguished.
+    generatorOptions.setSymmetryReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(10ul, reducedModel->getNumberOfStates());
+
+    // A label that singles out one of the modules breaks the symmetry.
+    generatorOptions.addLabel(program.getManager().getVariableExpression("x") == program.getManager().integer(2));
+    auto unreducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(27ul, unreducedModel->getNumberOfStates());
+
+#ifdef STORM_HAVE_Z3
+    // Labels that are invariant under permutations are fine.
+    programText += "label \"done\" = x=2 & y=2 & z=2;\n";
+    program = storm::parser::PrismParser::parseFromString(programText, "testfile");
+    storm::generator::NextStateGeneratorOptions labelOptions;
+    labelOptions.setSymmetryReduction();
+    labelOptions.addLabel("done");
+    auto labeledModel = storm::builder::ExplicitModelBuilder<double>(program, labelOptions).build();
+    EXPECT_EQ(10ul, labeledModel->getNumberOfStates());
+    EXPECT_EQ(1ul, labeledModel->getStates("done").getNumberOfSetBits());
+#endif
+}
+
+TEST(ExplicitPrismModelBuilderTest, NativeExpressions) {
+    storm::generator::NextStateGeneratorOptions interpretedOptions;
+    interpretedOptions.setBuildAllLabels();
+    interpretedOptions.setBuildAllRewardModels();
+    storm::generator::NextStateGeneratorOptions nativeOptions = interpretedOptions;
+    nativeOptions.setNativeExpressionCompilation();
+
+    // If no compiler is available, the expressions are interpreted and the models coincide trivially.
+    for (std::string const& file : {"/dtmc/brp-16-2.pm", "/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ctmc/polling2.sm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        auto interpretedModel = storm::builder::ExplicitModelBuilder<double>(program, interpretedOptions).build();
+        auto nativeModel = storm::builder::ExplicitModelBuilder<double>(program, nativeOptions).build();
+        EXPECT_EQ(interpretedModel->getNumberOfStates(), nativeModel->getNumberOfStates()) << file;
+        EXPECT_EQ(interpretedModel->getNumberOfTransitions(), nativeModel->getNumberOfTransitions()) << file;
+        EXPECT_EQ(interpretedModel->getNumberOfChoices(), nativeModel->getNumberOfChoices()) << file;
+        EXPECT_EQ(interpretedModel->getStateLabeling(), nativeModel->getStateLabeling()) << file;
+    }
+}
@@ -0,0 +1,113 @@
+#include <thread>
+
+#include "storm-config.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+TEST(SparseModelTest, BackwardTransitionsCache) {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 4);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 2, 1.0);
+    storm::models::sparse::StateLabeling labeling(3);
+    storm::models::sparse::Dtmc<double> dtmc(builder.build(), labeling);
+
+    auto const& backward = dtmc.getBackwardTransitions();
+    EXPECT_EQ(dtmc.getTransitionMatrix().transpose(true), backward);
+    // Repeated calls must not recompute the transposed matrix.
+    EXPECT_EQ(&backward, &dtmc.getBackwardTransitions());
+
+    storm::storage::SparseMatrixBuilder<double> otherBuilder(3, 3, 3);
+    otherBuilder.addNextValue(0, 0, 1.0);
+    otherBuilder.addNextValue(1, 0, 1.0);
+    otherBuilder.addNextValue(2, 1, 1.0);
+    dtmc.getTransitionMatrix() = otherBuilder.build();
+    EXPECT_EQ(dtmc.getTransitionMatrix().transpose(true), dtmc.getBackwardTransitions());
+    EXPECT_EQ(2ul, dtmc.getBackwardTransitions().getRow(0).getNumberOfEntries());
+}
+
+TEST(SparseModelTest, AcyclicityCache) {
+    // The self-loops of the sink states 1 and 2 do not count as cycles.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 4);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 2, 1.0);
+    storm::models::sparse::StateLabeling labeling(3);
+    storm::models::sparse::Dtmc<double> dtmc(builder.build(), labeling);
+    EXPECT_TRUE(dtmc.isAcyclic());
+
+    // Modifying the transitions resets the cached result.
+    storm::storage::SparseMatrixBuilder<double> otherBuilder(3, 3, 4);
+    otherBuilder.addNextValue(0, 0, 0.5);
+    otherBuilder.addNextValue(0, 1, 0.5);
+    otherBuilder.addNextValue(1, 1, 1.0);
+    otherBuilder.addNextValue(2, 0, 1.0);
+    dtmc.getTransitionMatrix() = otherBuilder.build();
+    EXPECT_FALSE(dtmc.isAcyclic());
+}
+
+TEST(SparseModelTest, PrepareForConcurrentAccess) {
+    uint64_t numberOfStates = 1000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.addNextValue(state, (state + 1) % numberOfStates, 1.0);
+    }
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init", storm::storage::BitVector(numberOfStates, std::vector<uint_fast64_t>({0})));
+    labeling.addLabel("target", storm::storage::BitVector(numberOfStates, std::vector<uint_fast64_t>({numberOfStates - 1})));
+    labeling.compress();
+    storm::models::sparse::Dtmc<double> dtmc(builder.build(), labeling);
+
+    auto const* backward = &dtmc.getBackwardTransitions();
+    dtmc.prepareForConcurrentAccess();
+    EXPECT_EQ(backward, &dtmc.getBackwardTransitions());
+    EXPECT_EQ(numberOfStates + 1, dtmc.getTransitionMatrix().getRowGroupIndices().size());
+    EXPECT_EQ(1ull, dtmc.getStates("target").getNumberOfSetBits());
+    EXPECT_TRUE(dtmc.getStates("target").get(numberOfStates - 1));
+    EXPECT_TRUE(dtmc.getStateLabeling().getStateHasLabel("init", 0));
+}
+
+TEST(SparseModelTest, ConcurrentReadAccess) {
+    uint64_t numberOfStates = 1000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.addNextValue(state, (state + 1) % numberOfStates, 1.0);
+    }
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("target", storm::storage::BitVector(numberOfStates, std::vector<uint_fast64_t>({numberOfStates - 1})));
+    labeling.compress();
+    storm::models::sparse::Dtmc<double> const dtmc(builder.build(), labeling);
+
+    // All lazily computed data is requested by several threads at the same time without preparing the model.
+    uint64_t const numberOfThreads = 4;
+    std::vector<storm::storage::SparseMatrix<double> const*> backwardTransitions(numberOfThreads);
+    std::vector<std::vector<uint64_t> const*> rowGroupIndices(numberOfThreads);
+    std::vector<storm::storage::BitVector const*> targetStates(numberOfThreads);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            backwardTransitions[thread] = &dtmc.getBackwardTransitions();
+            rowGroupIndices[thread] = &dtmc.getTransitionMatrix().getRowGroupIndices();
+            targetStates[thread] = &dtmc.getStates("target");
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        EXPECT_EQ(backwardTransitions.front(), backwardTransitions[thread]);
+        EXPECT_EQ(rowGroupIndices.front(), rowGroupIndices[thread]);
+        EXPECT_EQ(targetStates.front(), targetStates[thread]);
+    }
+    EXPECT_EQ(numberOfStates + 1, rowGroupIndices.front()->size());
+    EXPECT_EQ(1ull, targetStates.front()->getNumberOfSetBits());
+    EXPECT_TRUE(dtmc.getStateLabeling().getStateHasLabel("target", numberOfStates - 1));
+
+    // Copies of the matrix provide the same trivial row grouping.
+    storm::storage::SparseMatrix<double> copy = dtmc.getTransitionMatrix();
+    EXPECT_EQ(*rowGroupIndices.front(), copy.getRowGroupIndices());
+}
@@ -31,3 +31,34 @@ TEST(StateLabelingTest, RemoveLabel) {
     EXPECT_EQ(1ul, labeling.getNumberOfLabels());
     EXPECT_TRUE(labeling.getStateHasLabel("test2", 5));
 }
+
+TEST(StateLabelingTest, Compress) {
+    storm::models::sparse::StateLabeling labeling(100000);
+    storm::storage::BitVector init(100000);
+    init.set(0);
+    storm::storage::BitVector all(100000, true);
+    labeling.addLabel("init", init);
+    labeling.addLabel("all", all);
+
+    std::size_t uncompressedSize = labeling.getSizeInBytes();
+    storm::models::sparse::StateLabeling uncompressedLabeling = labeling;
+    labeling.compress();
+    EXPECT_LT(labeling.getSizeInBytes(), uncompressedSize);
+    EXPECT_EQ(uncompressedLabeling, labeling);
+
+    EXPECT_TRUE(labeling.getStateHasLabel("init", 0));
+    EXPECT_FALSE(labeling.getStateHasLabel("init", 1));
+    EXPECT_TRUE(labeling.getStateHasLabel("all", 99999));
+
+    // Retrieving or modifying the states decompresses the labeling.
+    EXPECT_EQ(init, labeling.getStates("init"));
+    labeling.removeLabelFromState("all", 5);
+    EXPECT_FALSE(labeling.getStateHasLabel("all", 5));
+    EXPECT_EQ(99999ul, labeling.getStates("all").getNumberOfSetBits());
+
+    storm::models::sparse::StateLabeling subLabeling = labeling.getSubLabeling(storm::storage::BitVector(100000, {0, 5, 6}));
+    storm::storage::BitVector subInit(3);
+    subInit.set(0);
+    EXPECT_EQ(subInit, subLabeling.getStates("init"));
+    EXPECT_EQ(storm::storage::BitVector(3, {0, 2}), subLabeling.getStates("all"));
+}
@@ -0,0 +1,56 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/TotalRewardStore.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(TotalRewardStoreTest, MultipleRewardModels) {
+    // State 0 has two choices, state 1 has one choice.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 2, 4, true, true, 2);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 0, 0.5);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(1, 1, 1.0);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 1, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::SparseMatrixBuilder<double> transitionRewardBuilder(3, 2, 2, true, true, 2);
+    transitionRewardBuilder.newRowGroup(0);
+    transitionRewardBuilder.addNextValue(0, 1, 4.0);
+    transitionRewardBuilder.newRowGroup(2);
+    transitionRewardBuilder.addNextValue(2, 1, 1.0);
+
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("state", storm::models::sparse::StandardRewardModel<double>(std::vector<double>{1.0, 2.0}));
+    rewardModels.emplace("action", storm::models::sparse::StandardRewardModel<double>(std::nullopt, std::vector<double>{3.0, 0.0, 5.0}));
+    rewardModels.emplace("transition", storm::models::sparse::StandardRewardModel<double>(std::nullopt, std::vector<double>{1.0, 1.0, 1.0},
+                                                                                            transitionRewardBuilder.build()));
+
+    storm::models::sparse::TotalRewardStore<double> store(matrix, rewardModels, {"transition", "state", "action"});
+    ASSERT_EQ(3ull, store.getNumberOfRows());
+    ASSERT_EQ(3ull, store.getNumberOfRewardModels());
+    EXPECT_EQ(1ull, store.getRewardModelIndex("state"));
+    EXPECT_FALSE(store.hasRewardModel("other"));
+    EXPECT_THROW(store.getRewardModelIndex("other"), storm::exceptions::IllegalArgumentException);
+
+    // The total rewards coincide with the ones computed by the reward models.
+    for (auto const& rewardModel : rewardModels) {
+        auto expected = rewardModel.second.getTotalRewardVector(matrix);
+        EXPECT_EQ(expected, store.getTotalRewardVector(store.getRewardModelIndex(rewardModel.first)));
+    }
+    EXPECT_EQ(3.0, store.getTotalReward(0, 0));
+    EXPECT_EQ(std::vector<double>({2.0, 2.0, 5.0}), store.getTotalRewards(2));
+
+    auto vectors = store.getTotalRewardVectors({2, 1, 2});
+    ASSERT_EQ(3ull, vectors.size());
+    EXPECT_EQ(std::vector<double>({3.0, 0.0, 5.0}), vectors[0]);
+    EXPECT_EQ(std::vector<double>({1.0, 1.0, 2.0}), vectors[1]);
+    EXPECT_EQ(vectors[0], vectors[2]);
+
+    EXPECT_EQ(std::vector<double>({4.5, 1.0, 4.5}), store.getWeightedTotalRewardVector({1.0, 0.0, 0.5}));
+    EXPECT_THROW(store.getWeightedTotalRewardVector({1.0}), storm::exceptions::IllegalArgumentException);
+    EXPECT_THROW(storm::models::sparse::TotalRewardStore<double>(matrix, rewardModels, {"state", "state"}), storm::exceptions::IllegalArgumentException);
+}
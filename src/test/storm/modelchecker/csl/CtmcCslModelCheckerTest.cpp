@@ -437,6 +437,83 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, BoundedUntilProbabilitiesForTimePoints) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 3.0);
+    matrixBuilder.addNextValue(1, 0, 2.0);
+    matrixBuilder.addNextValue(1, 2, 1.0);
+    matrixBuilder.addNextValue(2, 2, 0.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    std::vector<double> exitRates = {3, 3, 0};
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3);
+    psiStates.set(2);
+    storm::Environment env;
+
+    std::vector<double> timePoints = {0.0, 0.5, 1.0, 2.5, 10.0, 50.0};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimePoints(
+        env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, timePoints);
+    ASSERT_EQ(timePoints.size(), results.size());
+    for (uint64_t i = 0; i < timePoints.size(); ++i) {
+        std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, timePoints[i]);
+        ASSERT_EQ(expected.size(), results[i].size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], results[i][state], 1e-10) << "time point " << timePoints[i] << ", state " << state;
+        }
+    }
+    EXPECT_NEAR(0.0, results[0][0], 1e-10);
+    EXPECT_NEAR(1.0, results[0][2], 1e-10);
+}
+
+TEST(CtmcCslModelCheckerTest, AdaptiveUniformizationAndSteadyStateDetection) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(1, 2, 0.5);
+    matrixBuilder.addNextValue(2, 1, 100.0);
+    matrixBuilder.addNextValue(2, 3, 100.0);
+    matrixBuilder.addNextValue(3, 3, 0.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    std::vector<double> exitRates = {0.5, 0.5, 200, 0};
+    storm::storage::BitVector initialStates(4);
+    initialStates.set(0);
+    storm::storage::BitVector phiStates(4, true);
+    storm::storage::BitVector psiStates(4);
+    psiStates.set(3);
+    storm::Environment env;
+    storm::Environment adaptiveEnv;
+    adaptiveEnv.solver().timeBounded().setAdaptiveUniformization(true);
+    storm::Environment steadyStateEnv;
+    steadyStateEnv.solver().timeBounded().setSteadyStateDetection(true);
+
+    for (double timeBound : {0.5, 2.5, 10.0, 100.0}) {
+        std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+            env, matrix, initialStates, phiStates, psiStates, exitRates, timeBound);
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+            adaptiveEnv, matrix, initialStates, phiStates, psiStates, exitRates, timeBound);
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], result[state], 1e-6) << "time bound " << timeBound << ", state " << state;
+        }
+
+        expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            env, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, timeBound);
+        result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            adaptiveEnv, storm::solver::SolveGoal<double>(storm::solver::OptimizationDirection::Maximize, initialStates), matrix, backwardTransitions,
+            phiStates, psiStates, exitRates, false, 0.0, timeBound);
+        EXPECT_NEAR(expected[0], result[0], 1e-6) << "time bound " << timeBound;
+
+        result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            steadyStateEnv, storm::solver::SolveGoal<double>(), matrix, backwardTransitions, phiStates, psiStates, exitRates, false, 0.0, timeBound);
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], result[state], 1e-6) << "time bound " << timeBound << ", state " << state;
+        }
+    }
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
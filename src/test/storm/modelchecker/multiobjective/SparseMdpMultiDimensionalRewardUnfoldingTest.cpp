@@ -6,6 +6,7 @@
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -100,6 +101,76 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_large
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_parallel_epochs) {
+    storm::Environment env;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ multi( F{\"r\"}<=5 x=N, F{\"l\"}<=10 x=0 )]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalNumber>> mdp =
+        storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+
+    storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<storm::RationalNumber, true> rewardUnfolding(
+        *mdp, std::static_pointer_cast<storm::logic::OperatorFormula const>(formulas[0]));
+    auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
+    auto upperBound = rewardUnfolding.getUpperObjectiveBound();
+    auto initEpoch = rewardUnfolding.getStartEpoch();
+    auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+
+    // With two dimensions, there are epochs that can be analyzed independently.
+    auto layers = rewardUnfolding.getEpochComputationLayers(epochOrder);
+    uint64_t numLayerEpochs = 0;
+    for (auto const& layer : layers) {
+        EXPECT_FALSE(layer.empty());
+        numLayerEpochs += layer.size();
+    }
+    EXPECT_EQ(epochOrder.size(), numLayerEpochs);
+    EXPECT_LT(layers.size(), epochOrder.size());
+    EXPECT_EQ(std::vector<decltype(initEpoch)>({initEpoch}), layers.back());
+
+    rewardUnfolding.setPlannedEpochs(epochOrder);
+    uint64_t numSolvedEpochs = 0;
+    rewardUnfolding.computeEpochSolutionsInParallel(
+        epochOrder,
+        [&]() {
+            auto solver = std::make_shared<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<storm::RationalNumber>>>();
+            return [&, solver, x = std::vector<storm::RationalNumber>(), b = std::vector<storm::RationalNumber>()](
+                       storm::modelchecker::helper::rewardbounded::EpochModel<storm::RationalNumber, true>& epochModel) mutable {
+                return epochModel.analyzeSingleObjective(env, storm::OptimizationDirection::Maximize, x, b, *solver, lowerBound, upperBound);
+            };
+        },
+        [&numSolvedEpochs](auto const&) {
+            ++numSolvedEpochs;
+            return true;
+        });
+    EXPECT_EQ(epochOrder.size(), numSolvedEpochs);
+    storm::RationalNumber expectedResult = storm::utility::pow(storm::utility::convertNumber<storm::RationalNumber>(0.5), 15);
+    EXPECT_EQ(expectedResult, rewardUnfolding.getInitialStateResult(initEpoch));
+    // Only the solution of the start epoch is still needed
+    EXPECT_EQ(1ull, rewardUnfolding.getEpochSolutionStore().getNumberOfStoredEpochs());
+    EXPECT_LT(rewardUnfolding.getEpochSolutionStore().getMaximalNumberOfStoredSolutionEntries(), epochOrder.size() * mdp->getNumberOfStates());
+
+    // After dropping all solutions, the unfolding can be analyzed again from scratch.
+    rewardUnfolding.clearEpochSolutions();
+    EXPECT_EQ(0ull, rewardUnfolding.getEpochSolutionStore().getNumberOfStoredEpochs());
+    EXPECT_EQ(0ull, rewardUnfolding.getEpochSolutionStore().getNumberOfStoredSolutionEntries());
+    EXPECT_EQ(epochOrder.size(), rewardUnfolding.getEpochComputationOrder(initEpoch, true).size());
+    std::vector<storm::RationalNumber> x, b;
+    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<storm::RationalNumber>> solver;
+    for (auto const& epoch : epochOrder) {
+        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+        rewardUnfolding.setSolutionForCurrentEpoch(
+            epochModel.analyzeSingleObjective(env, storm::OptimizationDirection::Maximize, x, b, solver, lowerBound, upperBound));
+    }
+    EXPECT_EQ(expectedResult, rewardUnfolding.getInitialStateResult(initEpoch));
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_tiny_ec) {
     storm::Environment env;
 
@@ -25,7 +25,10 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
@@ -422,6 +425,25 @@ class DdCuddNativeJacobiEnvironment {
     }
 };
 
+class DdCuddNativeQuantizedIntervalIterationEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    static const DtmcEngine engine = DtmcEngine::PrismDd;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setDdQuantizationBits(32);
+        return env;
+    }
+};
+
 class DdSylvanRationalSearchEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -559,7 +581,8 @@ typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIlu
                          SparseNativeSoundValueIterationEnvironment, SparseNativeOptimisticValueIterationEnvironment, SparseNativeIntervalIterationEnvironment,
                          SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, HybridSylvanGmmxxGmresEnvironment,
                          HybridCuddNativeJacobiEnvironment, HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment,
-                         DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment, DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
+                         DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment, DdCuddNativeJacobiEnvironment,
+                         DdCuddNativeQuantizedIntervalIterationEnvironment, DdSylvanRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(DtmcPrctlModelCheckerTest, TestingTypes, );
@@ -640,6 +663,36 @@ TYPED_TEST(DtmcPrctlModelCheckerTest, SynchronousLeader) {
     EXPECT_NEAR(this->parseNumber("25/24"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
 }
 
+TYPED_TEST(DtmcPrctlModelCheckerTest, HybridSccWise) {
+    if (TypeParam::engine != DtmcEngine::Hybrid) {
+        GTEST_SKIP();
+    }
+    std::unique_ptr<storm::settings::SettingMemento> sccWise = storm::settings::mutableModelCheckerSettings().overrideHybridSccSet(true);
+
+    std::string formulasString = "P=? [F observe0>1]";
+    formulasString += "; P=? [F \"observeIGreater1\"]";
+
+    auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-4-3.pm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    auto checker = this->createModelChecker(model);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    result = checker->check(this->env(), tasks[0]);
+    EXPECT_NEAR(this->parseNumber("78686542099694893/1268858272000000000"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+
+    result = checker->check(this->env(), tasks[1]);
+    EXPECT_NEAR(this->parseNumber("40300855878315123/1268858272000000000"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+
+    modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", "R=? [F \"elected\"]");
+    model = std::move(modelFormulas.first);
+    tasks = this->getTasks(modelFormulas.second);
+    checker = this->createModelChecker(model);
+
+    result = checker->check(this->env(), tasks[0]);
+    EXPECT_NEAR(this->parseNumber("25/24"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+}
+
 TEST(DtmcPrctlModelCheckerTest, AllUntilProbabilities) {
     std::string formulasString = "P=? [F \"one\"]";
     formulasString += "; P=? [F \"two\"]";
@@ -6,6 +6,8 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
+#include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -15,6 +17,7 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 TEST(ExplicitDtmcPrctlModelCheckerTest, Die) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
@@ -158,3 +161,107 @@ TEST(ExplicitDtmcPrctlModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979591836789, quantitativeResult3[0], precision);
 }
+
+TEST(ExplicitDtmcPrctlModelCheckerTest, Acyclic) {
+    // State 3 is the target and state 4 is a sink. Both are absorbing, the remaining states form an acyclic graph.
+    storm::storage::SparseMatrixBuilder<double> builder(5, 5, 7);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 3, 0.4);
+    builder.addNextValue(1, 4, 0.6);
+    builder.addNextValue(2, 3, 1.0);
+    builder.addNextValue(3, 3, 1.0);
+    builder.addNextValue(4, 4, 1.0);
+    storm::models::sparse::StateLabeling labeling(5);
+    labeling.addLabel("target", storm::storage::BitVector(5, std::vector<uint_fast64_t>({3})));
+    labeling.addLabel("done", storm::storage::BitVector(5, std::vector<uint_fast64_t>({3, 4})));
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("steps", storm::models::sparse::StandardRewardModel<double>(std::vector<double>({1.0, 1.0, 1.0, 0.0, 0.0})));
+    storm::models::sparse::Dtmc<double> dtmc(builder.build(), labeling, rewardModels);
+    ASSERT_TRUE(dtmc.isAcyclic());
+
+    storm::Environment env;
+    double const precision = 1e-12;
+    auto expManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::parser::FormulaParser formulaParser(expManager);
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+
+    // The acyclic solvers yield the exact values.
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formulaParser.parseSingleFormulaFromString("P=? [F \"target\"]"));
+    EXPECT_NEAR(0.7, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    result = checker.check(env, *formulaParser.parseSingleFormulaFromString("R=? [F \"done\"]"));
+    EXPECT_NEAR(2.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+
+    // Step bounds beyond the longest path do not change the values.
+    result = checker.check(env, *formulaParser.parseSingleFormulaFromString("P=? [F<=1 \"target\"]"));
+    EXPECT_NEAR(0.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    result = checker.check(env, *formulaParser.parseSingleFormulaFromString("P=? [F<=1000000 \"target\"]"));
+    EXPECT_NEAR(0.7, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+}
+
+TEST(ExplicitDtmcPrctlModelCheckerTest, MultipleStepBounds) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::Environment env;
+    double const precision = 1e-12;
+    auto expManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::parser::FormulaParser formulaParser(expManager);
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    // The bounds are computed in one pass, but have to match the results of the single bounds.
+    std::vector<uint64_t> bounds = {7, 2, 4, 0, 4};
+    storm::modelchecker::helper::SparseDeterministicStepBoundedHorizonHelper<double> helper;
+    storm::storage::BitVector allStates(dtmc->getNumberOfStates(), true);
+    auto results = helper.computeForUpperBounds(env, storm::solver::SolveGoal<double>(), dtmc->getTransitionMatrix(), dtmc->getBackwardTransitions(),
+                                                allStates, dtmc->getStates("one"), bounds);
+    ASSERT_EQ(bounds.size(), results.size());
+    for (uint64_t index = 0; index < bounds.size(); ++index) {
+        auto formula = formulaParser.parseSingleFormulaFromString("P=? [F<=" + std::to_string(bounds[index]) + " \"one\"]");
+        auto result = checker.check(env, *formula);
+        auto const& expected = result->asExplicitQuantitativeCheckResult<double>();
+        for (uint64_t state = 0; state < dtmc->getNumberOfStates(); ++state) {
+            EXPECT_NEAR(expected[state], results[index][state], precision);
+        }
+    }
+}
+
+TEST(ExplicitDtmcPrctlModelCheckerTest, BatchedVisitingTimes) {
+    // State 0 moves to the SCC {1, 2}, which is left towards state 3. State 3 moves to the absorbing state 4.
+    storm::storage::SparseMatrixBuilder<double> builder(5, 5, 8);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.addNextValue(1, 3, 0.5);
+    builder.addNextValue(2, 1, 0.5);
+    builder.addNextValue(2, 3, 0.5);
+    builder.addNextValue(3, 4, 1.0);
+    builder.addNextValue(4, 4, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+
+    double const precision = 1e-6;
+    std::vector<std::vector<double>> expected = {{1.0, 1.0, 1.0, 1.0, storm::utility::infinity<double>()},
+                                                 {0.0, 4.0 / 3.0, 2.0 / 3.0, 1.0, storm::utility::infinity<double>()},
+                                                 {0.0, 0.0, 0.0, 0.0, 0.0}};
+    for (bool parallel : {false, true}) {
+        storm::Environment env;
+        env.solver().topological().setParallelSccSolving(parallel);
+        storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<double> helper(matrix);
+        std::vector<std::vector<double>> batch = {{1.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 1.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0, 0.0}};
+        helper.computeExpectedVisitingTimes(env, batch);
+        ASSERT_EQ(expected.size(), batch.size());
+        for (uint64_t index = 0; index < expected.size(); ++index) {
+            for (uint64_t state = 0; state < 4; ++state) {
+                EXPECT_NEAR(expected[index][state], batch[index][state], precision);
+            }
+            EXPECT_EQ(expected[index][4], batch[index][4]);
+        }
+
+        // Single initial states yield the same values as the batched computation.
+        auto single = helper.computeExpectedVisitingTimes(env, 1);
+        for (uint64_t state = 0; state < 4; ++state) {
+            EXPECT_NEAR(expected[1][state], single[state], precision);
+        }
+    }
+}
@@ -98,6 +98,21 @@ class GBNativeWalkerChaeEnvironment {
     }
 };
 
+class GBNativeMultigridEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setDetLraMethod(storm::solver::LraMethod::GainBiasEquations);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Multigrid);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DistrGmmxxDoubleGmresEnvironment {
    public:
     typedef double ValueType;
@@ -143,6 +158,21 @@ class DistrNativeWalkerChaeEnvironment {
     }
 };
 
+class DistrNativeMultigridEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setDetLraMethod(storm::solver::LraMethod::LraDistributionEquations);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Multigrid);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class ValueIterationEnvironment {
    public:
     typedef double ValueType;
@@ -175,8 +205,8 @@ class LraDtmcPrctlModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<GBGmmxxDoubleGmresEnvironment, GBEigenDoubleDGmresEnvironment, GBEigenRationalLUEnvironment, GBNativeSorEnvironment,
-                         GBNativeWalkerChaeEnvironment, DistrGmmxxDoubleGmresEnvironment, DistrEigenRationalLUEnvironment, DistrNativeWalkerChaeEnvironment,
-                         ValueIterationEnvironment>
+                         GBNativeWalkerChaeEnvironment, GBNativeMultigridEnvironment, DistrGmmxxDoubleGmresEnvironment, DistrEigenRationalLUEnvironment,
+                         DistrNativeWalkerChaeEnvironment, DistrNativeMultigridEnvironment, ValueIterationEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LraDtmcPrctlModelCheckerTest, TestingTypes, );
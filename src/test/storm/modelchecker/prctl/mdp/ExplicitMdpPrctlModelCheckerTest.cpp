@@ -2,12 +2,18 @@
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/verification.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitPrecomputationCache.h"
+#include "storm/modelchecker/hints/ExplicitSolutionCache.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/propositional/StateFormulaCache.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm-parsers/parser/AutoParser.h"
@@ -139,6 +145,155 @@ TEST(ExplicitMdpPrctlModelCheckerTest, Dice) {
     EXPECT_NEAR(44.0 / 3.0, quantitativeResult12[0], precision);
 }
 
+TEST(ExplicitMdpPrctlModelCheckerTest, DiceSolutionCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::parser::FormulaParser formulaParser;
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+
+    auto solutionCache = std::make_shared<storm::modelchecker::ExplicitSolutionCache<double>>();
+    auto checkWithCache = [&](std::string const& formulaString) {
+        auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<double>>();
+        hint->setSolutionCache(solutionCache);
+        task.setHint(hint);
+        return checker.check(env, task);
+    };
+    auto valueWithCache = [&](std::string const& formulaString) {
+        return checkWithCache(formulaString)->asExplicitQuantitativeCheckResult<double>()[0];
+    };
+
+    EXPECT_NEAR(3.0 / 36.0, valueWithCache("Pmin=? [F \"four\"]"), precision);
+    EXPECT_NEAR(3.0 / 36.0, valueWithCache("Pmax=? [F \"four\"]"), precision);
+    EXPECT_NEAR(3.0 / 36.0, valueWithCache("Pmin=? [F \"four\"]"), precision);
+    EXPECT_EQ(2ull, solutionCache->getNumberOfSolutions());
+
+    EXPECT_NEAR(22.0 / 3.0, valueWithCache("Rmin=? [F \"done\"]"), precision);
+    EXPECT_NEAR(22.0 / 3.0, valueWithCache("Rmax=? [F \"done\"]"), precision);
+    EXPECT_EQ(4ull, solutionCache->getNumberOfSolutions());
+
+    // Qualitative queries do not contribute solutions.
+    EXPECT_TRUE(checkWithCache("P>0 [F \"four\"]")->isExplicitQualitativeCheckResult());
+    EXPECT_EQ(4ull, solutionCache->getNumberOfSolutions());
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, DicePrecomputationCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::parser::FormulaParser formulaParser;
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+
+    auto precomputationCache = std::make_shared<storm::modelchecker::ExplicitPrecomputationCache>();
+    auto checkWithCache = [&](std::string const& formulaString) {
+        auto formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        auto hint = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<double>>();
+        hint->setPrecomputationCache(precomputationCache);
+        task.setHint(hint);
+        return checker.check(env, task);
+    };
+    auto valueWithCache = [&](std::string const& formulaString) {
+        return checkWithCache(formulaString)->asExplicitQuantitativeCheckResult<double>()[0];
+    };
+
+    EXPECT_NEAR(3.0 / 36.0, valueWithCache("Pmin=? [F \"four\"]"), precision);
+    EXPECT_NEAR(3.0 / 36.0, valueWithCache("Pmax=? [F \"four\"]"), precision);
+    EXPECT_EQ(2ull, precomputationCache->getNumberOfResults());
+
+    // Properties with the same target states and direction reuse the analysis.
+    EXPECT_NEAR(3.0 / 36.0, valueWithCache("Pmin=? [F \"four\"]"), precision);
+    EXPECT_TRUE(checkWithCache("Pmax>0 [F \"four\"]")->isExplicitQualitativeCheckResult());
+    EXPECT_EQ(2ull, precomputationCache->getNumberOfResults());
+
+    EXPECT_NEAR(1.0, valueWithCache("Pmin=? [F \"done\"]"), precision);
+    EXPECT_EQ(3ull, precomputationCache->getNumberOfResults());
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, DiceConditional) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::parser::FormulaParser formulaParser;
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+
+    auto value = [&](std::string const& formulaString, bool direct) {
+        env.modelchecker().setConditionalDirect(direct);
+        return checker.check(env, *formulaParser.parseSingleFormulaFromString(formulaString))->asExplicitQuantitativeCheckResult<double>()[0];
+    };
+
+    // The direct computation on the original model agrees with the computation on the transformed model.
+    EXPECT_NEAR(1.0 / 36.0, value("Pmin=? [F \"two\" || F \"done\"]", true), precision);
+    EXPECT_NEAR(1.0 / 36.0, value("Pmax=? [F \"two\" || F \"done\"]", true), precision);
+    EXPECT_NEAR(1.0 / 3.0, value("Pmax=? [F \"four\" || F (\"four\" | \"seven\")]", true), precision);
+    for (std::string const formulaString : {"Pmin=? [F \"four\" || F (\"four\" | \"seven\")]", "Pmax=? [F \"four\" || F \"seven\"]",
+                                             "Pmin=? [F \"done\" || F \"twelve\"]"}) {
+        EXPECT_NEAR(value(formulaString, false), value(formulaString, true), precision) << formulaString;
+    }
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, DiceBatch) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    double const precision = 1e-6;
+    storm::parser::FormulaParser formulaParser;
+
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (std::string const& formulaString : {"Pmin=? [F (Pmax>=1 [F \"done\"] & \"four\")]", "Pmax=? [F (Pmax>=1 [F \"done\"] & \"four\")]",
+                                             "Pmin=? [F \"done\"]", "Pmax=? [F \"unknown\"]", "Rmin=? [F \"done\"]"}) {
+        tasks.emplace_back(*formulaParser.parseSingleFormulaFromString(formulaString), true);
+    }
+
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        storm::Environment env;
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        auto stateFormulaCache = std::make_shared<storm::modelchecker::StateFormulaCache>();
+        env.modelchecker().setStateFormulaCache(stateFormulaCache);
+
+        std::vector<std::exception_ptr> errors;
+        auto results = storm::api::verifyWithSparseEngine<double>(env, model, tasks, numberOfThreads, &errors);
+        ASSERT_EQ(tasks.size(), results.size());
+        ASSERT_EQ(tasks.size(), errors.size());
+        auto value = [&](uint64_t index) {
+            EXPECT_FALSE(errors[index]);
+            return results[index]->asExplicitQuantitativeCheckResult<double>()[0];
+        };
+        EXPECT_NEAR(3.0 / 36.0, value(0), precision);
+        EXPECT_NEAR(3.0 / 36.0, value(1), precision);
+        EXPECT_NEAR(1.0, value(2), precision);
+        EXPECT_NEAR(22.0 / 3.0, value(4), precision);
+        EXPECT_TRUE(errors[3]);
+        EXPECT_FALSE(results[3]);
+
+        EXPECT_LE(2ull, stateFormulaCache->getNumberOfResults());
+        if (numberOfThreads == 1) {
+            // The common sub-formula is only checked for the first property.
+            EXPECT_LE(1ull, stateFormulaCache->getNumberOfHits());
+        }
+    }
+
+    // Without the error list, the first error is raised.
+    STORM_SILENT_EXPECT_THROW(storm::api::verifyWithSparseEngine<double>(storm::Environment(), model, tasks, 2), storm::exceptions::BaseException);
+}
+
 TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
     storm::Environment env;
     double const precision = 1e-6;
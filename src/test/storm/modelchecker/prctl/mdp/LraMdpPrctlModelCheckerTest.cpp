@@ -12,6 +12,7 @@
 
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -483,4 +484,41 @@ TYPED_TEST(LraMdpPrctlModelCheckerTest, cs_nfail) {
     EXPECT_NEAR(this->parseNumber("0"), result[*mdp->getInitialStates().begin()], this->precision());
 }
 
+TYPED_TEST(LraMdpPrctlModelCheckerTest, cs_nfail_multipleRewards) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string formulasString = "R{\"grants\"}max=? [ MP ];";
+
+    auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/mdp/cs_nfail3.nm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Mdp);
+    auto mdp = model->template as<storm::models::sparse::Mdp<ValueType>>();
+    auto const& rewardModel = mdp->getRewardModel("grants");
+    uint64_t initialState = *mdp->getInitialStates().begin();
+
+    storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper(mdp->getTransitionMatrix());
+    helper.setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
+    auto singleResult = helper.computeLongRunAverageRewards(this->env(), rewardModel);
+    EXPECT_NEAR(this->parseNumber("333/1000"), singleResult[initialState], this->precision());
+
+    // The decomposition computed above is re-used for all reward functions.
+    ValueType const two = storm::utility::convertNumber<ValueType>(2);
+    std::vector<typename decltype(helper)::ValueGetter> stateValuesGetters = {[](uint64_t) { return storm::utility::zero<ValueType>(); },
+                                                                             [](uint64_t) { return storm::utility::one<ValueType>(); }};
+    std::vector<typename decltype(helper)::ValueGetter> actionValuesGetters = {
+        [&rewardModel](uint64_t choice) { return rewardModel.getStateActionReward(choice); },
+        [&rewardModel, &two](uint64_t choice) { return two * rewardModel.getStateActionReward(choice); }};
+    auto results = helper.computeLongRunAverageValues(this->env(), stateValuesGetters, actionValuesGetters);
+    ASSERT_EQ(2ull, results.size());
+    for (uint64_t state = 0; state < mdp->getNumberOfStates(); ++state) {
+        EXPECT_NEAR(singleResult[state], results[0][state], this->precision());
+        EXPECT_NEAR(storm::utility::one<ValueType>() + two * singleResult[state], results[1][state], two * this->precision());
+    }
+
+    auto rewardResults = helper.computeLongRunAverageRewards(this->env(), {&rewardModel, &rewardModel});
+    ASSERT_EQ(2ull, rewardResults.size());
+    EXPECT_NEAR(this->parseNumber("333/1000"), rewardResults[0][initialState], this->precision());
+    EXPECT_NEAR(this->parseNumber("333/1000"), rewardResults[1][initialState], this->precision());
+}
+
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/simulation/SimulationModelChecker.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SimulationSettings.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(SimulationModelCheckerTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    storm::modelchecker::SimulationModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+
+    // The estimate is only correct with the given confidence, so we allow for twice the precision.
+    double tolerance = 2 * storm::settings::getModule<storm::settings::modules::SimulationSettings>().getPrecision();
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F<=3 \"done\"]");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.75, quantitativeResult1[0], tolerance);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F<=100 \"one\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(1.0 / 6.0, quantitativeResult2[0], tolerance);
+
+    formula = formulaParser.parseSingleFormulaFromString("P=? [s<3 U<=2 s=3]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult3 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.25, quantitativeResult3[0], tolerance);
+
+    formula = formulaParser.parseSingleFormulaFromString("P>0.7 [F<=3 \"done\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P<0.7 [F<=3 \"done\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P<=0.2 [F<=100 \"one\"]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
+
+TEST(SimulationModelCheckerTest, ImportanceSplitting) {
+    std::string programAsString = R"(dtmc
+
+module walk
+    x : [0..6] init 1;
+
+    [] x>0 & x<6 -> 0.2 : (x'=x+1) + 0.8 : (x'=x-1);
+    [] x=0 | x=6 -> 1 : true;
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programAsString, "walk");
+
+    storm::parser::FormulaParser formulaParser(program);
+
+    storm::modelchecker::SimulationModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+    checker.setImportanceFunction(program.getManager().getVariableExpression("x"));
+
+    // The probability to reach the upper end of the walk before the lower end is 3/4095.
+    double expected = 3.0 / 4095.0;
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F<=1000 x=6]");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+
+    // The estimate of the importance splitting has no guaranteed precision, so we only check the order of magnitude.
+    EXPECT_NEAR(expected, quantitativeResult1[0], expected / 2);
+
+    formula = formulaParser.parseSingleFormulaFromString("P<0.01 [F<=1000 x=6]");
+
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
@@ -0,0 +1,131 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Model<double>> exportAndLoad(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_binary_encoding_test.bin").string();
+    storm::exporter::binaryExportSparseModel(filename, model);
+    auto result = storm::parser::BinaryEncodingParser<double>::parseModel(filename);
+    std::remove(filename.c_str());
+    return result;
+}
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    ASSERT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    ASSERT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+    EXPECT_EQ(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+    EXPECT_EQ(expected.getStateLabeling(), actual.getStateLabeling());
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BinaryEncodingParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto loaded = exportAndLoad(model);
+    expectEqualModels(*model, *loaded);
+    ASSERT_EQ(4650ul, loaded->getStates("observeIGreater1").getNumberOfSetBits());
+}
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    auto loaded = exportAndLoad(model);
+    expectEqualModels(*model, *loaded);
+    EXPECT_EQ(model->getTransitionMatrix().getRowGroupIndices(), loaded->getTransitionMatrix().getRowGroupIndices());
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto loaded = exportAndLoad(model);
+    expectEqualModels(*model, *loaded);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+              loaded->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(BinaryEncodingParserTest, MarkovAutomatonRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto loaded = exportAndLoad(model);
+    expectEqualModels(*model, *loaded);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto loadedMa = loaded->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), loadedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), loadedMa->getExitRates());
+}
+
+TEST(BinaryEncodingParserTest, MdpPartition) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_binary_encoding_partition_test.bin").string();
+    storm::exporter::binaryExportSparseModel(filename, model);
+
+    // The parts have to cover all choices and labeled states, and their rows have to coincide with the rows of the model.
+    uint64_t numberOfParts = 3;
+    uint64_t numberOfChoices = 0;
+    uint64_t numberOfDoneStates = 0;
+    for (uint64_t rank = 0; rank < numberOfParts; ++rank) {
+        auto partition = storm::parser::parseBinaryModelPartition(filename, rank, numberOfParts);
+        EXPECT_EQ(storm::models::ModelType::Mdp, partition.modelType);
+        ASSERT_EQ(numberOfParts + 1, partition.stateOffsets.size());
+        EXPECT_EQ(model->getNumberOfStates(), partition.stateOffsets.back());
+        uint64_t firstState = partition.stateOffsets[rank];
+        ASSERT_EQ(partition.stateOffsets[rank + 1] - firstState, partition.transitionMatrix.getRowGroupCount());
+        uint64_t firstRow = model->getTransitionMatrix().getRowGroupIndices()[firstState];
+        for (uint64_t row = 0; row < partition.transitionMatrix.getRowCount(); ++row) {
+            auto expectedRow = model->getTransitionMatrix().getRow(firstRow + row);
+            auto actualRow = partition.transitionMatrix.getRow(row);
+            EXPECT_TRUE(std::equal(expectedRow.begin(), expectedRow.end(), actualRow.begin(), actualRow.end()));
+        }
+        numberOfChoices += partition.transitionMatrix.getRowCount();
+        numberOfDoneStates += partition.stateLabels.at("done").getNumberOfSetBits();
+    }
+    std::remove(filename.c_str());
+    EXPECT_EQ(model->getNumberOfChoices(), numberOfChoices);
+    EXPECT_EQ(model->getStates("done").getNumberOfSetBits(), numberOfDoneStates);
+}
+
+TEST(BinaryEncodingParserTest, MdpMapped) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_binary_encoding_mapped_test.bin").string();
+    storm::exporter::binaryExportSparseModel(filename, model);
+    for (bool populate : {false, true}) {
+        auto mapped = storm::parser::parseBinaryMappedModel(filename, populate);
+        EXPECT_EQ(storm::models::ModelType::Mdp, mapped.modelType);
+        EXPECT_EQ(model->getNumberOfStates(), mapped.transitionMatrix.getRowGroupCount());
+        EXPECT_EQ(model->getNumberOfTransitions(), mapped.transitionMatrix.getEntryCount());
+        EXPECT_FALSE(mapped.transitionMatrix.hasTrivialRowGrouping());
+        EXPECT_EQ(model->getTransitionMatrix(), mapped.transitionMatrix.toSparseMatrix());
+        EXPECT_EQ(model->getStates("done"), mapped.stateLabels.at("done"));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(BinaryEncodingParserTest, WrongFormat) {
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"),
+                              storm::exceptions::WrongFormatException);
+}
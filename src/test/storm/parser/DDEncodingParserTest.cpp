@@ -0,0 +1,119 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/parser/DDEncodingParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/DDEncodingExporter.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdManager.h"
+
+namespace {
+
+template<storm::dd::DdType Type>
+std::shared_ptr<storm::models::symbolic::Model<Type, double>> buildModel(std::string const& filename) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(filename);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    return storm::builder::DdPrismModelBuilder<Type, double>().build(program);
+}
+
+template<storm::dd::DdType Type>
+std::shared_ptr<storm::models::symbolic::Model<Type, double>> exportAndLoad(std::shared_ptr<storm::models::symbolic::Model<Type, double>> const& model) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_dd_encoding_test.bin").string();
+    storm::exporter::binaryExportSymbolicModel(filename, model);
+    auto result = storm::parser::DDEncodingParser<Type, double>::parseModel(filename);
+    std::remove(filename.c_str());
+    return result;
+}
+
+// The DDs of the two models live in different managers, so they are compared via their structure and some aggregated values.
+template<storm::dd::DdType Type>
+void expectEqualAdds(storm::dd::Add<Type, double> const& expected, storm::dd::Add<Type, double> const& actual) {
+    EXPECT_EQ(expected.getNodeCount(), actual.getNodeCount());
+    EXPECT_EQ(expected.getNonZeroCount(), actual.getNonZeroCount());
+    EXPECT_EQ(expected.getMin(), actual.getMin());
+    EXPECT_EQ(expected.getMax(), actual.getMax());
+    EXPECT_NEAR(expected.sumAbstract(expected.getContainedMetaVariables()).getValue(), actual.sumAbstract(actual.getContainedMetaVariables()).getValue(),
+                1e-9);
+}
+
+template<storm::dd::DdType Type>
+void expectEqualModels(storm::models::symbolic::Model<Type, double> const& expected, storm::models::symbolic::Model<Type, double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    EXPECT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    EXPECT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    EXPECT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+    EXPECT_EQ(expected.getRowVariables().size(), actual.getRowVariables().size());
+    EXPECT_EQ(expected.getNondeterminismVariables().size(), actual.getNondeterminismVariables().size());
+    expectEqualAdds(expected.getTransitionMatrix(), actual.getTransitionMatrix());
+    EXPECT_EQ(expected.getInitialStates().getNonZeroCount(), actual.getInitialStates().getNonZeroCount());
+    EXPECT_EQ(expected.getDeadlockStates().getNonZeroCount(), actual.getDeadlockStates().getNonZeroCount());
+    for (auto const& label : expected.getLabels()) {
+        ASSERT_TRUE(actual.hasLabel(label));
+        EXPECT_EQ(expected.getStates(label).getNonZeroCount(), actual.getStates(label).getNonZeroCount());
+    }
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            expectEqualAdds(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            expectEqualAdds(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+}
+
+template<storm::dd::DdType Type>
+void checkRoundTrip(std::string const& filename) {
+    auto model = buildModel<Type>(filename);
+    auto loaded = exportAndLoad(model);
+    expectEqualModels(*model, *loaded);
+    EXPECT_EQ(model->getManager().getAllMetaVariableNames(), loaded->getManager().getAllMetaVariableNames());
+}
+
+}  // namespace
+
+TEST(DDEncodingParserTest_Cudd, DtmcRoundTrip) {
+    checkRoundTrip<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+}
+
+TEST(DDEncodingParserTest_Sylvan, DtmcRoundTrip) {
+    checkRoundTrip<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+}
+
+TEST(DDEncodingParserTest_Cudd, CtmcRoundTrip) {
+    checkRoundTrip<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+}
+
+TEST(DDEncodingParserTest_Sylvan, CtmcRoundTrip) {
+    checkRoundTrip<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+}
+
+TEST(DDEncodingParserTest_Cudd, MdpRoundTrip) {
+    checkRoundTrip<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+}
+
+TEST(DDEncodingParserTest_Sylvan, MdpRoundTrip) {
+    checkRoundTrip<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+}
+
+TEST(DDEncodingParserTest, RejectsOtherFiles) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_dd_encoding_test_invalid.bin").string();
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << "This is not a binary DD model file, but it is long enough to contain a header.";
+    }
+    STORM_SILENT_EXPECT_THROW(storm::parser::DDEncodingParser<storm::dd::DdType::CUDD>::parseModel(filename), storm::exceptions::WrongFormatException);
+    std::remove(filename.c_str());
+}
@@ -1,7 +1,18 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -87,3 +98,52 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ExportAndParse) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_direct_encoding_test.drn").string();
+    {
+        std::ofstream stream(filename);
+        stream.precision(std::numeric_limits<double>::max_digits10);
+        storm::exporter::explicitExportSparseModel(stream, modelPtr, {});
+    }
+    std::shared_ptr<storm::models::sparse::Model<double>> exportedPtr = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(modelPtr->getType(), exportedPtr->getType());
+    EXPECT_EQ(modelPtr->getTransitionMatrix(), exportedPtr->getTransitionMatrix());
+    EXPECT_EQ(modelPtr->getStateLabeling(), exportedPtr->getStateLabeling());
+    EXPECT_EQ(modelPtr->as<storm::models::sparse::MarkovAutomaton<double>>()->getExitRates(),
+              exportedPtr->as<storm::models::sparse::MarkovAutomaton<double>>()->getExitRates());
+    ASSERT_TRUE(exportedPtr->hasRewardModel("avg_waiting_time"));
+    EXPECT_EQ(modelPtr->getRewardModel("avg_waiting_time").getStateRewardVector(),
+              exportedPtr->getRewardModel("avg_waiting_time").getStateRewardVector());
+}
+
+#ifdef STORM_HAVE_ZLIB
+TEST(DirectEncodingParserTest, GzipCompressed) {
+    std::ifstream input(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::stringstream content;
+    content << input.rdbuf();
+    std::string data = content.str();
+    // Write the file as two gzip members to test files that consist of several members.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_direct_encoding_test.drn.gz").string();
+    for (uint64_t part = 0; part < 2; ++part) {
+        gzFile file = gzopen(filename.c_str(), part == 0 ? "wb" : "ab");
+        ASSERT_NE(nullptr, file);
+        uint64_t begin = part == 0 ? 0 : data.size() / 2;
+        uint64_t end = part == 0 ? data.size() / 2 : data.size();
+        EXPECT_EQ(static_cast<int>(end - begin), gzwrite(file, data.data() + begin, end - begin));
+        gzclose(file);
+    }
+    std::shared_ptr<storm::models::sparse::Model<double>> compressedPtr = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+    std::remove(filename.c_str());
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+
+    ASSERT_EQ(modelPtr->getType(), compressedPtr->getType());
+    EXPECT_EQ(modelPtr->getTransitionMatrix(), compressedPtr->getTransitionMatrix());
+    EXPECT_EQ(modelPtr->getStateLabeling(), compressedPtr->getStateLabeling());
+}
+#endif
@@ -117,6 +117,37 @@ TEST(PrismParser, UnboundedTest) {
     EXPECT_TRUE(result.hasUnboundedVariables());
 }
 
+TEST(PrismParser, FormulaOrderTest) {
+    std::string testInput =
+        R"(dtmc
+    formula f3 = f2 + f1_2;
+    formula f2 = 2 * f1;
+    formula f1_2 = f1 + 1;
+    formula f1 = x;
+    module main
+        x : [0..5] init 0;
+        [] f3 < 5 -> 1: (x'=x+1);
+    endmodule)";
+
+    storm::prism::Program result;
+    EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
+    ASSERT_EQ(4ul, result.getNumberOfFormulas());
+    EXPECT_EQ("f1", result.getFormulas()[0].getName());
+    EXPECT_EQ("f2", result.getFormulas()[1].getName());
+    EXPECT_EQ("f1_2", result.getFormulas()[2].getName());
+    EXPECT_EQ("f3", result.getFormulas()[3].getName());
+
+    testInput =
+        R"(dtmc
+    formula f1 = f2 + 1;
+    formula f2 = f1;
+    module main
+        x : [0..5] init 0;
+        [] x < 5 -> 1: (x'=x+1);
+    endmodule)";
+    STORM_SILENT_EXPECT_THROW(storm::parser::PrismParser::parseFromString(testInput, "testfile"), storm::exceptions::WrongFormatException);
+}
+
 TEST(PrismParser, POMDPInputTest) {
     std::string testInput =
         R"(pomdp
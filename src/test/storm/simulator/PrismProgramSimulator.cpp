@@ -1,6 +1,7 @@
 #include "storm/simulator/PrismProgramSimulator.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/environment/Environment.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "test/storm_gtest.h"
 
 TEST(PrismProgramSimulatorTest, KnuthYaoDieTest) {
@@ -48,3 +49,61 @@ TEST(PrismProgramSimulatorTest, KnuthYaoDieTest) {
     EXPECT_TRUE(std::count(labels.begin(), labels.end(), "done") == 1);
     EXPECT_TRUE(std::count(labels.begin(), labels.end(), "five") == 1);
 }
+
+TEST(PrismProgramSimulatorTest, SampleStepKnuthYaoDieTest) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+
+    storm::simulator::DiscreteTimePrismProgramSimulator<double> sim(program, options);
+    sim.setSeed(42);
+    storm::expressions::Expression done = program.getLabelExpression("done");
+    storm::expressions::Variable d = program.getManager().getVariable("d");
+    uint64_t const numberOfPaths = 6000;
+    std::vector<uint64_t> outcomes(7, 0);
+    double totalReward = 0.0;
+    for (uint64_t path = 0; path < numberOfPaths; ++path) {
+        sim.resetToInitial();
+        while (!sim.evaluateBooleanExpressionInCurrentState(done)) {
+            ASSERT_TRUE(sim.sampleStep());
+            totalReward += sim.getLastRewards()[0];
+        }
+        ++outcomes[sim.getCurrentStateAsValuation().getIntegerValue(d)];
+    }
+    EXPECT_EQ(0ull, outcomes[0]);
+    for (uint64_t value = 1; value <= 6; ++value) {
+        EXPECT_NEAR(1.0 / 6.0, static_cast<double>(outcomes[value]) / numberOfPaths, 0.03);
+    }
+    // The expected number of coin flips is 11/3.
+    EXPECT_NEAR(11.0 / 3.0, totalReward / numberOfPaths, 0.15);
+
+    // The choices are computed on demand after sampling.
+    EXPECT_EQ(1ul, sim.getChoices().size());
+    EXPECT_TRUE(sim.isSinkState());
+}
+
+TEST(PrismProgramSimulatorTest, SampleStepSynchronizationTest) {
+    std::string input =
+        "dtmc\n"
+        "module a\n"
+        "  x : [0..2] init 0;\n"
+        "  [go] x=0 -> 0.5 : (x'=1) + 0.5 : (x'=2);\n"
+        "endmodule\n"
+        "module b\n"
+        "  y : [0..1] init 0;\n"
+        "  [go] y=0 -> (y'=1);\n"
+        "endmodule\n";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "testfile");
+    storm::simulator::DiscreteTimePrismProgramSimulator<double> sim(program, storm::builder::BuilderOptions());
+    sim.setSeed(42);
+    storm::expressions::Variable x = program.getManager().getVariable("x");
+    storm::expressions::Variable y = program.getManager().getVariable("y");
+    ASSERT_TRUE(sim.sampleStep());
+    auto valuation = sim.getCurrentStateAsValuation();
+    EXPECT_EQ(1, valuation.getIntegerValue(y));
+    EXPECT_NE(0, valuation.getIntegerValue(x));
+
+    // Both commands are disabled now, so the state is a deadlock.
+    EXPECT_FALSE(sim.sampleStep());
+    EXPECT_TRUE(sim.getChoices().empty());
+}
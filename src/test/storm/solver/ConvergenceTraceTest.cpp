@@ -0,0 +1,101 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/ConvergenceTrace.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+std::vector<std::string> getLines(std::string const& text) {
+    std::vector<std::string> result;
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        result.push_back(line);
+    }
+    return result;
+}
+
+storm::storage::SparseMatrix<double> createMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    return builder.build(2);
+}
+
+TEST(ConvergenceTraceTest, Records) {
+    std::stringstream csv;
+    std::stringstream json;
+    {
+        storm::solver::ConvergenceTrace csvTrace(csv, storm::solver::ConvergenceTrace::Format::Csv);
+        storm::solver::ConvergenceTrace jsonTrace(json, storm::solver::ConvergenceTrace::Format::Json);
+        for (auto trace : {&csvTrace, &jsonTrace}) {
+            uint64_t solve = trace->startSolve();
+            EXPECT_EQ(1ull, solve);
+            storm::solver::ConvergenceTrace::Record record(1);
+            record.residual = 0.5;
+            record.upperBound = 2.0;
+            trace->addRecord(solve, "value-iteration", 42, record);
+            record = storm::solver::ConvergenceTrace::Record(2);
+            record.schedulerChanges = 3;
+            trace->addRecord(solve, "policy-iteration", 7, record);
+        }
+    }
+
+    auto csvLines = getLines(csv.str());
+    ASSERT_EQ(3ul, csvLines.size());
+    EXPECT_EQ("solve,method,iteration,residual,lower,upper,time_ns,scheduler_changes", csvLines[0]);
+    EXPECT_EQ("1,value-iteration,1,0.5,,2,42,", csvLines[1]);
+    EXPECT_EQ("1,policy-iteration,2,,,,7,3", csvLines[2]);
+
+    auto jsonLines = getLines(json.str());
+    ASSERT_EQ(2ul, jsonLines.size());
+    EXPECT_EQ("{\"solve\":1,\"method\":\"value-iteration\",\"iteration\":1,\"residual\":0.5,\"upper\":2,\"time_ns\":42}", jsonLines[0]);
+    EXPECT_EQ("{\"solve\":1,\"method\":\"policy-iteration\",\"iteration\":2,\"time_ns\":7,\"scheduler_changes\":3}", jsonLines[1]);
+}
+
+TEST(ConvergenceTraceTest, SolverIterations) {
+    storm::storage::SparseMatrix<double> A = createMatrix();
+    std::vector<double> b = {0.099, 0.5};
+
+    for (auto method : {storm::solver::MinMaxMethod::ValueIteration, storm::solver::MinMaxMethod::IntervalIteration,
+                        storm::solver::MinMaxMethod::SoundValueIteration, storm::solver::MinMaxMethod::PolicyIteration}) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(method);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+
+        std::stringstream stream;
+        auto trace = std::make_shared<storm::solver::ConvergenceTrace>(stream, storm::solver::ConvergenceTrace::Format::Csv);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        solver->setConvergenceTrace(trace);
+        EXPECT_TRUE(solver->isConvergenceTraceSet());
+
+        std::vector<double> x(1);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(0.99, x[0], 1e-5);
+        trace->flush();
+
+        // The header is followed by one record per iteration.
+        auto lines = getLines(stream.str());
+        ASSERT_LE(2ul, lines.size());
+        for (uint64_t index = 1; index < lines.size(); ++index) {
+            EXPECT_EQ(0ul, lines[index].find("1,")) << lines[index];
+        }
+        if (method == storm::solver::MinMaxMethod::PolicyIteration) {
+            // The last iteration does not change the scheduler anymore.
+            EXPECT_EQ(',', lines.back()[lines.back().size() - 2]);
+            EXPECT_EQ('0', lines.back().back());
+        } else {
+            // The records of these methods contain a residual.
+            EXPECT_EQ(std::string::npos, lines.back().find(",,,,"));
+        }
+    }
+}
+}  // namespace
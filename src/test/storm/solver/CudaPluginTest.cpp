@@ -1,5 +1,6 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
+#include "storm/storage/SoaSparseMatrix.h"
 #include "storm/storage/SparseMatrix.h"
 #include "test/storm_gtest.h"
 
@@ -9,6 +10,16 @@
 
 #include "cudaForStorm.h"
 
+namespace {
+// Uploads the given matrix to the device.
+DeviceSparseMatrix* createDeviceMatrix(storm::storage::SparseMatrix<double> const& matrix) {
+    storm::storage::SoaSparseMatrix<double, uint32_t> soaMatrix(matrix);
+    return deviceValueIteration_createMatrix(matrix.getRowCount(), matrix.getColumnCount(), matrix.getRowGroupCount(), matrix.getEntryCount(),
+                                             soaMatrix.getRowIndications().data(), soaMatrix.getColumns().data(), soaMatrix.getValues().data(),
+                                             matrix.getRowGroupIndices().data());
+}
+}  // namespace
+
 TEST(CudaPlugin, SpMV_4x4) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4, 10);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -32,8 +43,10 @@ TEST(CudaPlugin, SpMV_4x4) {
     std::vector<double> x({0, 4, 1, 1});
     std::vector<double> b({0, 0, 0, 0});
 
-    ASSERT_NO_THROW(
-        basicValueIteration_spmv_uint64_double(matrix.getColumnCount(), matrix.__internal_getRowIndications(), matrix.__internal_getColumnsAndValues(), x, b));
+    DeviceSparseMatrix* deviceMatrix = createDeviceMatrix(matrix);
+    ASSERT_NE(nullptr, deviceMatrix);
+    ASSERT_TRUE(deviceValueIteration_multiply(deviceMatrix, x.data(), nullptr, b.data()));
+    deviceValueIteration_destroyMatrix(deviceMatrix);
 
     ASSERT_EQ(b.at(0), 3);
     ASSERT_EQ(b.at(1), 25);
@@ -54,44 +67,21 @@ TEST(CudaPlugin, SpMV_VerySmall) {
     ASSERT_EQ(2, matrix.getEntryCount());
 
     std::vector<double> x({4.0, 8.0});
+    std::vector<double> offsets({1.0, -1.0});
     std::vector<double> b({0.0, 0.0});
 
-    ASSERT_NO_THROW(
-        basicValueIteration_spmv_uint64_double(matrix.getColumnCount(), matrix.__internal_getRowIndications(), matrix.__internal_getColumnsAndValues(), x, b));
+    DeviceSparseMatrix* deviceMatrix = createDeviceMatrix(matrix);
+    ASSERT_NE(nullptr, deviceMatrix);
+    ASSERT_TRUE(deviceValueIteration_multiply(deviceMatrix, x.data(), nullptr, b.data()));
 
     ASSERT_EQ(b.at(0), 4.0);
     ASSERT_EQ(b.at(1), 16.0);
-}
 
-TEST(CudaPlugin, AddVectorsInplace) {
-    std::vector<double> vectorA_1 = {0.0, 42.0, 21.4, 3.1415, 1.0, 7.3490390, 94093053905390.21, -0.000000000023};
-    std::vector<double> vectorA_2 = {0.0, 42.0, 21.4, 3.1415, 1.0, 7.3490390, 94093053905390.21, -0.000000000023};
-    std::vector<double> vectorA_3 = {0.0, 42.0, 21.4, 3.1415, 1.0, 7.3490390, 94093053905390.21, -0.000000000023};
-    std::vector<double> vectorB = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-    std::vector<double> vectorC = {-5000.0, -5000.0, -5000.0, -5000.0, -5000.0, -5000.0, -5000.0, -5000.0};
-
-    ASSERT_EQ(vectorA_1.size(), 8);
-    ASSERT_EQ(vectorA_2.size(), 8);
-    ASSERT_EQ(vectorA_3.size(), 8);
-    ASSERT_EQ(vectorB.size(), 8);
-    ASSERT_EQ(vectorC.size(), 8);
-
-    ASSERT_NO_THROW(basicValueIteration_addVectorsInplace_double(vectorA_1, vectorB));
-    ASSERT_NO_THROW(basicValueIteration_addVectorsInplace_double(vectorA_2, vectorC));
-
-    ASSERT_EQ(vectorA_1.size(), 8);
-    ASSERT_EQ(vectorA_2.size(), 8);
-    ASSERT_EQ(vectorA_3.size(), 8);
-    ASSERT_EQ(vectorB.size(), 8);
-    ASSERT_EQ(vectorC.size(), 8);
-
-    for (size_t i = 0; i < vectorA_3.size(); ++i) {
-        double cpu_result_b = vectorA_3.at(i) + vectorB.at(i);
-        double cpu_result_c = vectorA_3.at(i) + vectorC.at(i);
-
-        ASSERT_EQ(cpu_result_b, vectorA_1.at(i));
-        ASSERT_EQ(cpu_result_c, vectorA_2.at(i));
-    }
+    ASSERT_TRUE(deviceValueIteration_multiply(deviceMatrix, x.data(), offsets.data(), b.data()));
+    deviceValueIteration_destroyMatrix(deviceMatrix);
+
+    ASSERT_EQ(b.at(0), 5.0);
+    ASSERT_EQ(b.at(1), 15.0);
 }
 
 TEST(CudaPlugin, ReduceGroupedVector) {
@@ -112,50 +102,65 @@ TEST(CudaPlugin, ReduceGroupedVector) {
 
     std::vector<double> result_cuda_minimize = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
     std::vector<double> result_cuda_maximize = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    std::vector<uint64_t> choices_cuda_minimize(7, 0);
+    std::vector<double> x(7, 0.0);
+
+    // A matrix without entries, such that the value of each row is the corresponding entry of the grouped vector.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(19, 7, 0, true, true, 7);
+    for (uint64_t group = 0; group < 7; ++group) {
+        ASSERT_NO_THROW(matrixBuilder.newRowGroup(grouping[group]));
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
 
-    ASSERT_NO_THROW(basicValueIteration_reduceGroupedVector_uint64_double_minimize(groupedVector, grouping, result_cuda_minimize));
-    ASSERT_NO_THROW(basicValueIteration_reduceGroupedVector_uint64_double_maximize(groupedVector, grouping, result_cuda_maximize));
+    DeviceSparseMatrix* deviceMatrix = createDeviceMatrix(matrix);
+    ASSERT_NE(nullptr, deviceMatrix);
+    ASSERT_TRUE(deviceValueIteration_multiplyAndReduce(deviceMatrix, true, x.data(), groupedVector.data(), result_cuda_minimize.data(),
+                                                       choices_cuda_minimize.data()));
+    ASSERT_TRUE(deviceValueIteration_multiplyAndReduce(deviceMatrix, false, x.data(), groupedVector.data(), result_cuda_maximize.data(), nullptr));
+    deviceValueIteration_destroyMatrix(deviceMatrix);
 
     for (size_t i = 0; i < result_minimize.size(); ++i) {
         ASSERT_EQ(result_minimize.at(i), result_cuda_minimize.at(i));
         ASSERT_EQ(result_maximize.at(i), result_cuda_maximize.at(i));
+        ASSERT_EQ(result_minimize.at(i), groupedVector.at(grouping[i] + choices_cuda_minimize.at(i)));
     }
 }
 
-TEST(CudaPlugin, equalModuloPrecision) {
-    std::vector<double> x = {123.45, 67.8, 901.23, 456789.012, 3.456789, -4567890.12};
-    std::vector<double> y1 = {0.45, 0.8, 0.23, 0.012, 0.456789, -0.12};
-    std::vector<double> y2 = {0.45, 0.8, 0.23, 456789.012, 0.456789, -4567890.12};
-    std::vector<double> x2;
-    std::vector<double> x3;
-    std::vector<double> y3;
-    std::vector<double> y4;
-    x2.reserve(1000);
-    x3.reserve(1000);
-    y3.reserve(1000);
-    y4.reserve(1000);
-    for (size_t i = 0; i < 1000; ++i) {
-        x2.push_back(static_cast<double>(i));
-        y3.push_back(1.0);
-        x3.push_back(-(1000.0 - static_cast<double>(i)));
-        y4.push_back(1.0);
-    }
-
-    double maxElement1 = 0.0;
-    double maxElement2 = 0.0;
-    double maxElement3 = 0.0;
-    double maxElement4 = 0.0;
-    ASSERT_NO_THROW(basicValueIteration_equalModuloPrecision_double_NonRelative(x, y1, maxElement1));
-    ASSERT_NO_THROW(basicValueIteration_equalModuloPrecision_double_NonRelative(x, y2, maxElement2));
-
-    ASSERT_NO_THROW(basicValueIteration_equalModuloPrecision_double_Relative(x2, y3, maxElement3));
-    ASSERT_NO_THROW(basicValueIteration_equalModuloPrecision_double_Relative(x3, y4, maxElement4));
-
-    ASSERT_DOUBLE_EQ(4567890.0, maxElement1);
-    ASSERT_DOUBLE_EQ(901.0, maxElement2);
+TEST(CudaPlugin, ValueIteration) {
+    // States 0 and 1 can either stay or move to the other state and the target with probability 0.5 each. State 2 is a sink.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 3, 5, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 2, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
 
-    ASSERT_DOUBLE_EQ(998.0, maxElement3);
-    ASSERT_DOUBLE_EQ(1001.0, maxElement4);
+    // The probabilities of moving to the target directly.
+    std::vector<double> b = {0.0, 0.5, 0.5, 0.0, 0.0};
+    std::vector<double> x(3, 0.0);
+    size_t iterationCount = 0;
+    bool converged = false;
+
+    DeviceSparseMatrix* deviceMatrix = createDeviceMatrix(matrix);
+    ASSERT_NE(nullptr, deviceMatrix);
+    ASSERT_TRUE(deviceValueIteration_solve(deviceMatrix, false, 10000, 1e-8, false, x.data(), b.data(), iterationCount, converged));
+    EXPECT_TRUE(converged);
+    EXPECT_NEAR(1.0, x[0], 1e-6);
+    EXPECT_NEAR(1.0, x[1], 1e-6);
+    EXPECT_EQ(0.0, x[2]);
+
+    std::fill(x.begin(), x.end(), 0.0);
+    ASSERT_TRUE(deviceValueIteration_solve(deviceMatrix, true, 10000, 1e-8, false, x.data(), b.data(), iterationCount, converged));
+    deviceValueIteration_destroyMatrix(deviceMatrix);
+    EXPECT_TRUE(converged);
+    EXPECT_EQ(0.0, x[0]);
+    EXPECT_EQ(0.0, x[1]);
 }
 
 #endif
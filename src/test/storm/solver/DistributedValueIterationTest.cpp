@@ -0,0 +1,102 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+#include <functional>
+#include <thread>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/DistributedValueIteration.h"
+#include "storm/storage/DistributedSparseMatrix.h"
+#include "storm/utility/Communicator.h"
+
+namespace {
+
+/*!
+ * Runs the given computation on every member of a group of threads and returns the (gathered) result of the first member.
+ */
+std::vector<double> runOnGroup(uint64_t size, storm::storage::SparseMatrix<double> const& matrix,
+                               std::function<std::vector<double>(storm::storage::DistributedSparseMatrix const&)> const& computation) {
+    auto group = storm::utility::ThreadCommunicator::createGroup(size);
+    std::vector<std::vector<double>> results(size);
+    std::vector<std::thread> threads;
+    for (uint64_t rank = 0; rank < size; ++rank) {
+        threads.emplace_back([&, rank]() {
+            auto distributedMatrix = storm::storage::DistributedSparseMatrix::createFromGlobalMatrix(group[rank], matrix);
+            results[rank] = distributedMatrix.gather(computation(distributedMatrix));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (uint64_t rank = 1; rank < size; ++rank) {
+        EXPECT_EQ(results.front(), results[rank]);
+    }
+    return results.front();
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> buildModel(std::string const& filename) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(filename);
+    return storm::builder::ExplicitModelBuilder<double>(program, storm::builder::BuilderOptions(true, true)).build();
+}
+
+}  // namespace
+
+TEST(DistributedValueIterationTest, Partition) {
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto group = storm::utility::ThreadCommunicator::createGroup(1);
+    auto matrix = storm::storage::DistributedSparseMatrix::createFromGlobalMatrix(group.front(), model->getTransitionMatrix());
+    EXPECT_EQ(0ul, matrix.getNumberOfHaloStates());
+    EXPECT_EQ(model->getTransitionMatrix(), matrix.getLocalMatrix());
+
+    std::vector<uint64_t> entries = {0, 10, 10, 10, 15, 20, 30};
+    auto offsets = storm::storage::DistributedSparseMatrix::computeBalancedStateOffsets(6, 3, [&entries](uint64_t state) { return entries[state]; });
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 5, 6}), offsets);
+}
+
+TEST(DistributedValueIterationTest, DtmcReachability) {
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::storage::BitVector targetStates = model->getStates("one");
+    auto result = runOnGroup(3, model->getTransitionMatrix(), [&targetStates](storm::storage::DistributedSparseMatrix const& matrix) {
+        storm::solver::DistributedValueIteration solver(matrix);
+        solver.setPrecision(1e-8);
+        return solver.computeReachabilityProbabilities(matrix.getLocalPart(targetStates));
+    });
+    EXPECT_NEAR(1.0 / 6.0, result[*model->getInitialStates().begin()], 1e-6);
+}
+
+TEST(DistributedValueIterationTest, MdpReachability) {
+    auto model = buildModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::storage::BitVector targetStates = model->getStates("three");
+    for (auto direction : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto result = runOnGroup(4, model->getTransitionMatrix(), [&targetStates, direction](storm::storage::DistributedSparseMatrix const& matrix) {
+            storm::solver::DistributedValueIteration solver(matrix);
+            solver.setPrecision(1e-8);
+            return solver.computeReachabilityProbabilities(matrix.getLocalPart(targetStates), direction);
+        });
+        EXPECT_NEAR(2.0 / 36.0, result[*model->getInitialStates().begin()], 1e-6);
+    }
+}
+
+TEST(DistributedValueIterationTest, CtmcTimeBoundedReachability) {
+    // State 0 moves to state 1 with rate 2 (and has a self-loop), state 1 moves to the target state 2 with rate 3.
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 4);
+    builder.addNextValue(0, 0, 1.0);
+    builder.addNextValue(0, 1, 2.0);
+    builder.addNextValue(1, 2, 3.0);
+    builder.addNextValue(2, 2, 1.0);
+    storm::storage::SparseMatrix<double> rateMatrix = builder.build();
+    storm::storage::BitVector targetStates(3);
+    targetStates.set(2);
+
+    auto result = runOnGroup(2, rateMatrix, [&targetStates](storm::storage::DistributedSparseMatrix const& matrix) {
+        storm::solver::DistributedValueIteration solver(matrix);
+        return solver.computeTimeBoundedReachabilityProbabilities(matrix.getLocalPart(targetStates), 1.0, 1e-10);
+    });
+    // The time to reach the target from state 0 is the sum of two exponentially distributed delays.
+    EXPECT_NEAR(1.0 - 3.0 * std::exp(-2.0) + 2.0 * std::exp(-3.0), result[0], 1e-8);
+    EXPECT_NEAR(1.0 - std::exp(-3.0), result[1], 1e-8);
+    EXPECT_NEAR(1.0, result[2], 1e-8);
+}
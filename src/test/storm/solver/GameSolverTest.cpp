@@ -7,6 +7,7 @@
 
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/StandardGameSolver.h"
 
 namespace {
@@ -132,4 +133,70 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
     EXPECT_NEAR(this->parseNumber("1"), result[0], this->precision());
 }
 
+TEST(GameSolverTest, IntervalIteration) {
+    // The game of the test above.
+    storm::storage::SparseMatrixBuilder<double> player2MatrixBuilder(0, 0, 0, false, true);
+    player2MatrixBuilder.newRowGroup(0);
+    player2MatrixBuilder.addNextValue(0, 0, 0.4);
+    player2MatrixBuilder.addNextValue(0, 1, 0.6);
+    player2MatrixBuilder.addNextValue(1, 1, 0.2);
+    player2MatrixBuilder.addNextValue(1, 2, 0.8);
+    player2MatrixBuilder.newRowGroup(2);
+    player2MatrixBuilder.addNextValue(2, 2, 0.5);
+    player2MatrixBuilder.addNextValue(2, 3, 0.5);
+    player2MatrixBuilder.newRowGroup(4);
+    player2MatrixBuilder.newRowGroup(5);
+    player2MatrixBuilder.newRowGroup(6);
+    storm::storage::SparseMatrix<double> player2Matrix = player2MatrixBuilder.build();
+
+    storm::storage::SparseMatrixBuilder<storm::storage::sparse::state_type> player1MatrixBuilder(0, 0, 0, false, true);
+    player1MatrixBuilder.newRowGroup(0);
+    player1MatrixBuilder.addNextValue(0, 0, 1);
+    player1MatrixBuilder.addNextValue(1, 1, 1);
+    player1MatrixBuilder.newRowGroup(2);
+    player1MatrixBuilder.addNextValue(2, 2, 1);
+    player1MatrixBuilder.newRowGroup(3);
+    player1MatrixBuilder.addNextValue(3, 3, 1);
+    player1MatrixBuilder.newRowGroup(4);
+    player1MatrixBuilder.addNextValue(4, 4, 1);
+    storm::storage::SparseMatrix<storm::storage::sparse::state_type> player1Matrix = player1MatrixBuilder.build();
+
+    storm::Environment env;
+    env.solver().game().setMethod(storm::solver::GameMethod::IntervalIteration);
+    env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    env.solver().game().setRelativeTerminationCriterion(false);
+    env.solver().setForceSoundness(true);
+
+    storm::solver::GameSolverFactory<double> factory;
+    auto solver = factory.create(env, player1Matrix, player2Matrix);
+    std::vector<double> result(4);
+    std::vector<double> b(7);
+    b[4] = 1.0;
+    b[6] = 1.0;
+
+    // Interval iteration needs to know that the solution is unique and requires an upper bound.
+    solver->setLowerBound(0.0);
+    EXPECT_THROW(solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, result, b),
+                 storm::exceptions::UnmetRequirementException);
+    solver->setHasUniqueSolution(true);
+    EXPECT_THROW(solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, result, b),
+                 storm::exceptions::UnmetRequirementException);
+    solver->setUpperBound(1.0);
+
+    // The result is at most half the precision away from the solution.
+    ASSERT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, result, b));
+    EXPECT_NEAR(0.5, result[0], 5e-7);
+    ASSERT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, result, b));
+    EXPECT_NEAR(0.2, result[0], 5e-7);
+    ASSERT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Maximize, result, b));
+    EXPECT_NEAR(1.0, result[0], 5e-7);
+
+    // The choices are extracted from the result.
+    std::vector<uint64_t> player1Choices(4), player2Choices(5);
+    ASSERT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, result, b, &player1Choices,
+                                  &player2Choices));
+    EXPECT_EQ(0ull, player1Choices[0]);
+    EXPECT_EQ(1ull, player2Choices[0]);
+}
+
 }  // namespace
@@ -23,6 +23,20 @@ class NativeDoublePowerEnvironment {
     }
 };
 
+class NativeDoubleMixedPrecisionPowerEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        env.solver().native().setMixedPrecision(true);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
 class NativeDoubleSoundValueIterationEnvironment {
    public:
     typedef double ValueType;
@@ -121,6 +135,61 @@ class NativeDoubleWalkerChaeEnvironment {
     }
 };
 
+class NativeDoubleGmresIluEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+        return env;
+    }
+};
+
+class NativeDoubleGmresNoneEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::None);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+        return env;
+    }
+};
+
+class NativeDoubleBicgstabDiagonalEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+        return env;
+    }
+};
+
+class NativeDoubleMultigridEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Multigrid);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+        return env;
+    }
+};
+
 class NativeRationalRationalSearchEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -312,9 +381,11 @@ class LinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoubleSoundValueIterationEnvironment, NativeDoubleOptimisticValueIterationEnvironment,
-                         NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment,
-                         NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment, NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment,
+typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoubleMixedPrecisionPowerEnvironment, NativeDoubleSoundValueIterationEnvironment,
+                         NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment,
+                         NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment, NativeDoubleGmresIluEnvironment, NativeDoubleGmresNoneEnvironment,
+                         NativeDoubleBicgstabDiagonalEnvironment, NativeDoubleMultigridEnvironment, NativeRationalRationalSearchEnvironment,
+                         EliminationRationalEnvironment,
                          GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment, GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment,
                          EigenDGmresDiagonalEnvironment, EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment,
                          EigenRationalLUEnvironment, TopologicalEigenRationalLUEnvironment>
@@ -358,4 +429,40 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
-}  // namespace
\ No newline at end of file
+TYPED_TEST(LinearEquationSolverTest, solveEquationSystemBatch) {
+    typedef typename TestFixture::ValueType ValueType;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("1/5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("2/5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("2/5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/50")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("48/50")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1/50")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("4/10")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("3/10")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(3));
+    std::vector<std::vector<ValueType>> b = {{this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")},
+                                             {this->parseNumber("-3"), this->parseNumber("0.01"), this->parseNumber("-12")}};
+
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+    if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        A.convertToEquationSystem();
+    }
+
+    auto solver = factory.create(this->env(), A);
+    solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+    EXPECT_NEAR(x[0][0], this->parseNumber("481/9"), this->precision());
+    EXPECT_NEAR(x[0][1], this->parseNumber("457/9"), this->precision());
+    EXPECT_NEAR(x[0][2], this->parseNumber("875/18"), this->precision());
+    EXPECT_NEAR(x[1][0], this->parseNumber("-481/9"), this->precision());
+    EXPECT_NEAR(x[1][1], this->parseNumber("-457/9"), this->precision());
+    EXPECT_NEAR(x[1][2], this->parseNumber("-875/18"), this->precision());
+}
+
+}  // namespace
@@ -193,6 +193,40 @@ TYPED_TEST(LpSolverTest, LPOptimizeMaxRaw) {
     EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
 }
 
+TYPED_TEST(LpSolverTest, LPOptimizeMaxRawBulk) {
+    typedef typename TestFixture::ValueType ValueType;
+    auto solver = this->factory()->createRaw("");
+    solver->setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(0u, solver->addBoundedContinuousVariable("x", 0, 1, -1));
+    ASSERT_EQ(1u, solver->addLowerBoundedContinuousVariable("y", 0, 2));
+    ASSERT_EQ(2u, solver->addLowerBoundedContinuousVariable("z", 0, 1));
+    ASSERT_NO_THROW(solver->update());
+
+    // The constraints of the test above, added at once.
+    std::vector<storm::solver::RawLpConstraint<ValueType>> constraints;
+    constraints.emplace_back(storm::expressions::RelationType::LessOrEqual, this->parseNumber("12"), 3);
+    constraints.back().addToLhs(0, this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1"));
+    constraints.back().addToLhs(2, this->parseNumber("1"));
+    constraints.emplace_back(storm::expressions::RelationType::Equal, this->parseNumber("5"), 3);
+    constraints.back().addToLhs(0, -this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1/2"));
+    constraints.back().addToLhs(2, this->parseNumber("1"));
+    constraints.emplace_back(storm::expressions::RelationType::LessOrEqual, this->parseNumber("11/2"), 2);
+    constraints.back().addToLhs(0, -this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1"));
+    ASSERT_NO_THROW(solver->addConstraints(constraints));
+    ASSERT_NO_THROW(solver->setPrimalStart(0, this->parseNumber("1")));
+    ASSERT_NO_THROW(solver->update());
+
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_NEAR(this->parseNumber("1"), solver->getContinuousValue(0), this->precision());
+    EXPECT_NEAR(this->parseNumber("13/2"), solver->getContinuousValue(1), this->precision());
+    EXPECT_NEAR(this->parseNumber("11/4"), solver->getContinuousValue(2), this->precision());
+    EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
+}
+
 TYPED_TEST(LpSolverTest, LPOptimizeMin) {
     typedef typename TestFixture::ValueType ValueType;
     auto solver = this->factory()->create("");
@@ -569,4 +603,39 @@ TYPED_TEST(LpSolverTest, Incremental) {
     ASSERT_FALSE(solver->isInfeasible());
 }
 
+TYPED_TEST(LpSolverTest, MILPChangeObjective) {
+    if (!this->supportsInteger()) {
+        GTEST_SKIP();
+    }
+    typedef typename TestFixture::ValueType ValueType;
+    auto solver = this->factory()->create("");
+    if (!solver->supportsObjectiveFunctionCoefficientChanges()) {
+        GTEST_SKIP();
+    }
+    solver->setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    ASSERT_NO_THROW(x = solver->addBoundedIntegerVariable("x", 0, 4, 1));
+    ASSERT_NO_THROW(y = solver->addBoundedIntegerVariable("y", 0, 4));
+    ASSERT_NO_THROW(solver->addConstraint("", x + y <= solver->getConstant(5)));
+    ASSERT_NO_THROW(solver->update());
+    // max x s.t. x+y<=5
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_EQ(4, solver->getIntegerValue(x));
+    EXPECT_NEAR(this->parseNumber("4"), solver->getObjectiveValue(), this->precision());
+
+    ASSERT_NO_THROW(solver->setObjectiveFunctionCoefficient(x, this->parseNumber("1")));
+    ASSERT_NO_THROW(solver->setObjectiveFunctionCoefficient(y, this->parseNumber("2")));
+    ASSERT_NO_THROW(solver->setMipStart(x, this->parseNumber("4")));
+    ASSERT_NO_THROW(solver->setMipStart(y, this->parseNumber("1")));
+    ASSERT_NO_THROW(solver->update());
+    // max x+2y s.t. x+y<=5
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_EQ(1, solver->getIntegerValue(x));
+    EXPECT_EQ(4, solver->getIntegerValue(y));
+    EXPECT_NEAR(this->parseNumber("9"), solver->getObjectiveValue(), this->precision());
+}
+
 }  // namespace
\ No newline at end of file
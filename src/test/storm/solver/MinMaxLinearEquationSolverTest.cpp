@@ -24,6 +24,43 @@ class DoubleViEnvironment {
     }
 };
 
+class DoubleMixedPrecisionViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setMixedPrecision(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
+class DoubleAsynchronousViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::AsynchronousValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
+class DoublePrioritizedViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PrioritizedValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -76,6 +113,20 @@ class DoubleTopologicalViEnvironment {
     }
 };
 
+class DoubleTopologicalParallelViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().topological().setParallelSccSolving(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoubleTopologicalCudaViEnvironment {
    public:
     typedef double ValueType;
@@ -101,6 +152,64 @@ class DoublePIEnvironment {
         return env;
     }
 };
+class DoubleModifiedPIEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().minMax().setPolicyEvaluationSweeps(3);
+        env.solver().minMax().setPolicyImprovementThreads(2);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().setLinearEquationSolverPrecision(env.solver().minMax().getPrecision());
+        return env;
+    }
+};
+class DoubleRaceViPiEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setRaceMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().setLinearEquationSolverPrecision(env.solver().minMax().getPrecision());
+        return env;
+    }
+};
+class DoublePortfolioEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Portfolio);
+        env.solver().minMax().setPortfolioMethods({storm::solver::MinMaxMethod::IntervalIteration, storm::solver::MinMaxMethod::PolicyIteration,
+                                                   storm::solver::MinMaxMethod::OptimisticValueIteration});
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().setLinearEquationSolverPrecision(env.solver().minMax().getPrecision());
+        return env;
+    }
+};
+class RationalPortfolioEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Portfolio);
+        env.solver().minMax().setPortfolioMethods({storm::solver::MinMaxMethod::PolicyIteration, storm::solver::MinMaxMethod::RationalSearch});
+        return env;
+    }
+};
 class RationalPIEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -111,6 +220,18 @@ class RationalPIEnvironment {
         return env;
     }
 };
+class RationalModifiedPIEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        env.solver().minMax().setPolicyEvaluationSweeps(2);
+        env.solver().minMax().setPolicyImprovementThreads(2);
+        return env;
+    }
+};
 class RationalRationalSearchEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -121,6 +242,16 @@ class RationalRationalSearchEnvironment {
         return env;
     }
 };
+class RationalViToPiEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ViToPi);
+        return env;
+    }
+};
 
 template<typename TestType>
 class MinMaxLinearEquationSolverTest : public ::testing::Test {
@@ -141,9 +272,11 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment,
-                         DoubleTopologicalViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleMixedPrecisionViEnvironment, DoubleAsynchronousViEnvironment, DoublePrioritizedViEnvironment,
+                         DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment,
+                         DoubleTopologicalParallelViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, DoubleModifiedPIEnvironment,
+                         DoubleRaceViPiEnvironment, DoublePortfolioEnvironment, RationalPIEnvironment, RationalModifiedPIEnvironment,
+                         RationalRationalSearchEnvironment, RationalViToPiEnvironment, RationalPortfolioEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -175,4 +308,132 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsBatch) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+
+    std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(1));
+    std::vector<std::vector<ValueType>> b = {{this->parseNumber("0.099"), this->parseNumber("0.5")}, {this->parseNumber("0.198"), this->parseNumber("1")}};
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+    auto solver = factory.create(this->env(), A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(this->parseNumber("0"), this->parseNumber("2"));
+    storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(this->env());
+    req.clearBounds();
+    ASSERT_FALSE(req.hasEnabledRequirement());
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(x[0][0], this->parseNumber("0.5"), this->precision());
+    EXPECT_NEAR(x[1][0], this->parseNumber("1"), this->precision());
+
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(x[0][0], this->parseNumber("0.99"), this->precision());
+    EXPECT_NEAR(x[1][0], this->parseNumber("1.98"), this->precision());
+}
+
+TEST(TopologicalMinMaxLinearEquationSolverTest, ParallelSccSolving) {
+    // State 0 depends on the SCCs {1, 2} and {3, 4} which do not depend on each other.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 3, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 2, 0.5);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 1, 0.5);
+    builder.newRowGroup(5);
+    builder.addNextValue(5, 4, 0.8);
+    builder.newRowGroup(6);
+    builder.addNextValue(6, 3, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build(7, 5, 5);
+    std::vector<double> b = {0.0, 0.3, 0.25, 0.5, 0.2, 0.1, 0.0};
+
+    for (bool parallel : {false, true}) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().topological().setParallelSccSolving(parallel);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setTrackScheduler(true);
+        std::vector<double> x(5);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(x[0], 31.0 / 120.0, 1e-6);
+        EXPECT_NEAR(x[1], 0.35, 1e-6);
+        EXPECT_NEAR(x[2], 0.2, 1e-6);
+        EXPECT_NEAR(x[3], 1.0 / 6.0, 1e-6);
+        EXPECT_NEAR(x[4], 1.0 / 12.0, 1e-6);
+        EXPECT_EQ(0ull, solver->getSchedulerChoices()[0]);
+        EXPECT_EQ(1ull, solver->getSchedulerChoices()[2]);
+
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], 5.0 / 12.0, 1e-6);
+        EXPECT_NEAR(x[1], 2.0 / 3.0, 1e-6);
+        EXPECT_NEAR(x[2], 5.0 / 6.0, 1e-6);
+        EXPECT_NEAR(x[3], 1.0 / 6.0, 1e-6);
+        EXPECT_NEAR(x[4], 1.0 / 12.0, 1e-6);
+        EXPECT_EQ(0ull, solver->getSchedulerChoices()[0]);
+        EXPECT_EQ(0ull, solver->getSchedulerChoices()[2]);
+    }
+}
+
+TEST(IterativeMinMaxLinearEquationSolverTest, ModifiedPolicyIteration) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 3, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 2, 0.5);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 1, 0.5);
+    builder.newRowGroup(5);
+    builder.addNextValue(5, 4, 0.8);
+    builder.newRowGroup(6);
+    builder.addNextValue(6, 3, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build(7, 5, 5);
+    std::vector<double> b = {0.0, 0.3, 0.25, 0.5, 0.2, 0.1, 0.0};
+
+    // Policy iteration gives the same results no matter how the intermediate policies are evaluated and improved.
+    for (uint64_t sweeps : {0ull, 1ull, 5ull}) {
+        for (uint64_t threads : {1ull, 3ull}) {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+            env.solver().minMax().setPolicyEvaluationSweeps(sweeps);
+            env.solver().minMax().setPolicyImprovementThreads(threads);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().setLinearEquationSolverPrecision(env.solver().minMax().getPrecision());
+
+            auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+            solver->setHasUniqueSolution(true);
+            solver->setHasNoEndComponents(true);
+            solver->setBounds(0.0, 1.0);
+            solver->setTrackScheduler(true);
+            std::vector<double> x(5);
+            ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+            EXPECT_NEAR(x[0], 31.0 / 120.0, 1e-6);
+            EXPECT_NEAR(x[1], 0.35, 1e-6);
+            EXPECT_NEAR(x[2], 0.2, 1e-6);
+            EXPECT_EQ(1ull, solver->getSchedulerChoices()[2]);
+
+            ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+            EXPECT_NEAR(x[0], 5.0 / 12.0, 1e-6);
+            EXPECT_NEAR(x[1], 2.0 / 3.0, 1e-6);
+            EXPECT_NEAR(x[2], 5.0 / 6.0, 1e-6);
+            EXPECT_EQ(0ull, solver->getSchedulerChoices()[2]);
+        }
+    }
+}
 }  // namespace
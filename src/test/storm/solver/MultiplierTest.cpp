@@ -19,6 +19,40 @@ class NativeEnvironment {
     }
 };
 
+class NativeSoaEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setSoaLayout(true);
+        return env;
+    }
+};
+
+class SimdEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+        return env;
+    }
+};
+
+class CudaEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Cuda);
+        return env;
+    }
+};
+
 class GmmxxEnvironment {
    public:
     typedef double ValueType;
@@ -49,7 +83,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, NativeSoaEnvironment, SimdEnvironment, CudaEnvironment, GmmxxEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -123,4 +157,144 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
+TYPED_TEST(MultiplierTest, multiplyAndReduceAndCheckConvergenceTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+    ValueType const convergencePrecision = this->parseNumber("1e-6");
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        for (bool relative : {false, true}) {
+            std::vector<ValueType> x = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+            std::vector<ValueType> result(3), expected(3);
+            bool converged = false;
+            uint64_t iterations = 0;
+            while (!converged && iterations < 1000) {
+                multiplier->multiplyAndReduce(this->env(), dir, x, nullptr, expected);
+                converged = multiplier->multiplyAndReduceAndCheckConvergence(this->env(), dir, x, nullptr, result, convergencePrecision, relative);
+                EXPECT_EQ(storm::utility::vector::equalModuloPrecision(x, expected, convergencePrecision, relative), converged);
+                for (uint64_t state = 0; state < x.size(); ++state) {
+                    EXPECT_NEAR(expected[state], result[state], this->precision());
+                }
+                std::swap(x, result);
+                ++iterations;
+            }
+            EXPECT_TRUE(converged);
+            EXPECT_GT(iterations, 1ull);
+        }
+    }
+}
+
+TEST(SimdMultiplierTest, longRows) {
+    // Rows with more entries than fit into a single vector register, such that the vectorized kernels are used.
+    uint64_t const groupCount = 50;
+    storm::storage::SparseMatrixBuilder<double> builder(0, groupCount, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < groupCount; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice <= group % 5; ++choice, ++row) {
+            for (uint64_t column = (group + choice) % 3; column < groupCount; column += 1 + (row % 4)) {
+                builder.addNextValue(row, column, static_cast<double>((row * 7 + column * 13) % 11) / 100.0);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    std::vector<double> x(groupCount), b(A.getRowCount());
+    for (uint64_t i = 0; i < groupCount; ++i) {
+        x[i] = static_cast<double>(i % 17) / 16.0;
+    }
+    for (uint64_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<double>(i % 5) / 10.0;
+    }
+
+    storm::Environment env;
+    env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+    auto multiplier = storm::solver::MultiplierFactory<double>().create(env, A);
+
+    std::vector<double> result(A.getRowCount()), expectedResult(A.getRowCount());
+    multiplier->multiply(env, x, &b, result);
+    A.multiplyWithVector(x, expectedResult, &b);
+    for (uint64_t i = 0; i < result.size(); ++i) {
+        EXPECT_NEAR(expectedResult[i], result[i], 1e-12);
+    }
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> reduced(groupCount), expectedReduced(groupCount);
+        std::vector<uint64_t> choices(groupCount, 0), expectedChoices(groupCount, 0);
+        multiplier->multiplyAndReduce(env, dir, A.getRowGroupIndices(), x, &b, reduced, &choices);
+        A.multiplyAndReduce(dir, A.getRowGroupIndices(), x, &b, expectedReduced, &expectedChoices);
+        for (uint64_t i = 0; i < groupCount; ++i) {
+            EXPECT_NEAR(expectedReduced[i], reduced[i], 1e-12);
+            EXPECT_EQ(expectedChoices[i], choices[i]);
+        }
+
+        std::vector<double> y = x, expectedY = x;
+        multiplier->multiplyAndReduceGaussSeidel(env, dir, A.getRowGroupIndices(), y, &b);
+        A.multiplyAndReduceBackward(dir, A.getRowGroupIndices(), expectedY, &b, expectedY, nullptr);
+        for (uint64_t i = 0; i < groupCount; ++i) {
+            EXPECT_NEAR(expectedY[i], y[i], 1e-12);
+        }
+    }
+}
+
+
+TEST(NativeMultiplierTest, parallelGaussSeidel) {
+    // All rows are substochastic such that the fixpoint is unique.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.4);
+    builder.addNextValue(1, 2, 0.9);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.2);
+    builder.addNextValue(2, 3, 0.7);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 1, 0.3);
+    builder.addNextValue(3, 2, 0.3);
+    builder.addNextValue(3, 4, 0.3);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 3, 0.9);
+    builder.addNextValue(5, 4, 0.8);
+    builder.newRowGroup(6);
+    builder.addNextValue(6, 0, 0.5);
+    builder.addNextValue(6, 4, 0.4);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b = {0.0, 0.1, 0.2, 0.0, 0.3, 0.0, 1.0};
+
+    storm::Environment env;
+    env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+    storm::Environment parallelEnv = env;
+    parallelEnv.solver().multiplier().setParallelGaussSeidel(true);
+    auto multiplier = storm::solver::MultiplierFactory<double>().create(env, A);
+    auto parallelMultiplier = storm::solver::MultiplierFactory<double>().create(parallelEnv, A);
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> x(5, 0.0), parallelX(5, 0.0);
+        for (uint64_t iteration = 0; iteration < 1000; ++iteration) {
+            multiplier->multiplyAndReduceGaussSeidel(env, dir, A.getRowGroupIndices(), x, &b);
+            parallelMultiplier->multiplyAndReduceGaussSeidel(parallelEnv, dir, A.getRowGroupIndices(), parallelX, &b);
+        }
+        for (uint64_t state = 0; state < x.size(); ++state) {
+            EXPECT_NEAR(x[state], parallelX[state], 1e-12);
+        }
+    }
+}
+
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <numeric>
+
+#include "storm-parsers/parser/AutoParser.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/solver/stateelimination/OperationCache.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+
+namespace {
+std::vector<double> eliminate(storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& b,
+                              std::shared_ptr<storm::solver::stateelimination::OperationCache<double>> const& operationCache, bool delayCancellation) {
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix, false);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    std::vector<double> x = b;
+
+    std::vector<storm::storage::sparse::state_type> states(matrix.getRowCount());
+    std::iota(states.begin(), states.end(), 0);
+    auto priorityQueue = std::make_shared<storm::solver::stateelimination::StaticStatePriorityQueue>(states);
+    storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
+    eliminator.setOperationCache(operationCache);
+    eliminator.setDelayCancellation(delayCancellation);
+    eliminator.eliminateAll(false);
+    return x;
+}
+}  // namespace
+
+TEST(OperationCacheTest, Operations) {
+    storm::solver::stateelimination::OperationCache<double> cache;
+    EXPECT_EQ(0.5, cache.multiply(0.25, 2.0));
+    EXPECT_EQ(0.5, cache.multiply(2.0, 0.25));
+    EXPECT_EQ(1ull, cache.getNumberOfMisses());
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+
+    EXPECT_EQ(0.75, cache.add(0.25, 0.5));
+    EXPECT_EQ(2.0, cache.oneDividedByOneMinus(0.5));
+    EXPECT_EQ(2.0, cache.oneDividedByOneMinus(0.5));
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+    EXPECT_EQ(2ull, cache.getNumberOfHits());
+
+    // Trivial operations are not stored.
+    EXPECT_EQ(0.0, cache.multiply(0.0, 0.3));
+    EXPECT_EQ(0.3, cache.add(0.0, 0.3));
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+
+    cache.clear();
+    EXPECT_EQ(0.5, cache.multiply(0.25, 2.0));
+    EXPECT_EQ(4ull, cache.getNumberOfMisses());
+}
+
+TEST(OperationCacheTest, Die) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Dtmc);
+
+    storm::storage::BitVector maybeStates = ~model->getStates("done");
+    storm::storage::BitVector targetStates = model->getStates("one");
+    storm::storage::SparseMatrix<double> matrix = model->getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates);
+    std::vector<double> b = model->getTransitionMatrix().getConstrainedRowSumVector(maybeStates, targetStates);
+
+    std::vector<double> result = eliminate(matrix, b, nullptr, false);
+    auto operationCache = std::make_shared<storm::solver::stateelimination::OperationCache<double>>();
+    std::vector<double> cachedResult = eliminate(matrix, b, operationCache, false);
+    std::vector<double> delayedResult = eliminate(matrix, b, nullptr, true);
+
+    // The die has many transitions with the same probabilities.
+    EXPECT_LT(0ull, operationCache->getNumberOfHits());
+    EXPECT_NEAR(1.0 / 6.0, cachedResult[0], 1e-12);
+    ASSERT_EQ(result.size(), cachedResult.size());
+    for (uint64_t state = 0; state < result.size(); ++state) {
+        EXPECT_DOUBLE_EQ(result[state], cachedResult[state]);
+        EXPECT_DOUBLE_EQ(result[state], delayedResult[state]);
+    }
+}
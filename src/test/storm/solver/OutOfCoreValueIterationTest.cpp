@@ -0,0 +1,76 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/OutOfCoreValueIteration.h"
+
+namespace {
+
+storm::parser::BinaryMappedModel exportAndMap(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_out_of_core_test.bin").string();
+    storm::exporter::binaryExportSparseModel(filename, model);
+    auto result = storm::parser::parseBinaryMappedModel(filename);
+    // The mapping stays valid after the file is removed.
+    std::remove(filename.c_str());
+    return result;
+}
+
+}  // namespace
+
+TEST(OutOfCoreValueIterationTest, Multiplication) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    auto mapped = exportAndMap(model);
+    auto const& matrix = model->getTransitionMatrix();
+    std::vector<double> x(matrix.getColumnCount());
+    for (uint64_t state = 0; state < x.size(); ++state) {
+        x[state] = static_cast<double>(state % 7);
+    }
+    std::vector<double> b(matrix.getRowCount(), 0.5);
+
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> actual;
+    matrix.multiplyWithVector(x, expected, &b);
+    mapped.transitionMatrix.multiplyWithVector(x, actual, &b);
+    EXPECT_EQ(expected, actual);
+
+    expected.resize(matrix.getRowGroupCount());
+    matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, expected, nullptr);
+    mapped.transitionMatrix.setPrefetchingEnabled(false);
+    mapped.transitionMatrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, x, actual, &b);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(OutOfCoreValueIterationTest, DtmcReachability) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto mapped = exportAndMap(model);
+
+    storm::solver::OutOfCoreValueIteration solver(mapped.transitionMatrix);
+    solver.setPrecision(1e-8);
+    auto result = solver.computeReachabilityProbabilities(mapped.stateLabels.at("one"));
+    EXPECT_NEAR(1.0 / 6.0, result[*model->getInitialStates().begin()], 1e-6);
+    EXPECT_LT(0ull, solver.getNumberOfIterations());
+}
+
+TEST(OutOfCoreValueIterationTest, MdpReachability) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto mapped = exportAndMap(model);
+
+    storm::solver::OutOfCoreValueIteration solver(mapped.transitionMatrix);
+    solver.setPrecision(1e-8);
+    for (auto direction : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto result = solver.computeReachabilityProbabilities(mapped.stateLabels.at("three"), direction);
+        EXPECT_NEAR(2.0 / 36.0, result[*model->getInitialStates().begin()], 1e-6);
+    }
+    STORM_SILENT_EXPECT_THROW(solver.computeReachabilityProbabilities(mapped.stateLabels.at("three")), storm::exceptions::InvalidArgumentException);
+}
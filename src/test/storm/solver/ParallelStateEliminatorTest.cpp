@@ -0,0 +1,55 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <numeric>
+
+#include "storm-parsers/parser/AutoParser.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/solver/stateelimination/ParallelStateEliminator.h"
+#include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+
+namespace {
+std::vector<double> eliminate(storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& b, bool parallel, uint64_t batchSize = 256) {
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix, false);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    std::vector<double> x = b;
+
+    std::vector<storm::storage::sparse::state_type> states(matrix.getRowCount());
+    std::iota(states.begin(), states.end(), 0);
+    auto priorityQueue = std::make_shared<storm::solver::stateelimination::StaticStatePriorityQueue>(states);
+    if (parallel) {
+        storm::solver::stateelimination::ParallelStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x,
+                                                                                     batchSize);
+        eliminator.eliminateAll(false);
+    } else {
+        storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
+        eliminator.eliminateAll(false);
+    }
+    EXPECT_FALSE(priorityQueue->hasNext());
+    return x;
+}
+}  // namespace
+
+TEST(ParallelStateEliminatorTest, Die) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Dtmc);
+
+    // Set up the equation system for the probability to reach a state labeled "one".
+    storm::storage::BitVector maybeStates = ~model->getStates("done");
+    storm::storage::BitVector targetStates = model->getStates("one");
+    storm::storage::SparseMatrix<double> matrix = model->getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates);
+    std::vector<double> b = model->getTransitionMatrix().getConstrainedRowSumVector(maybeStates, targetStates);
+
+    std::vector<double> sequentialResult = eliminate(matrix, b, false);
+    std::vector<double> parallelResult = eliminate(matrix, b, true);
+    std::vector<double> smallBatchResult = eliminate(matrix, b, true, 2);
+
+    ASSERT_EQ(sequentialResult.size(), parallelResult.size());
+    EXPECT_NEAR(1.0 / 6.0, parallelResult[0], 1e-12);
+    for (uint64_t state = 0; state < sequentialResult.size(); ++state) {
+        EXPECT_NEAR(sequentialResult[state], parallelResult[state], 1e-12);
+        EXPECT_NEAR(sequentialResult[state], smallBatchResult[state], 1e-12);
+    }
+}
@@ -0,0 +1,79 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/solver/helper/RobustValueIterationHelper.h"
+#include "storm/solver/multiplier/RobustMultiplier.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(RobustValueIterationTest, MultiplyRow) {
+    storm::storage::SparseMatrixBuilder<storm::Interval> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, storm::Interval(0.1, 0.6)));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, storm::Interval(0.2, 0.5)));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, storm::Interval(0.3, 0.7)));
+    storm::storage::SparseMatrix<storm::Interval> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+
+    storm::Environment env;
+    storm::solver::RobustMultiplier<double> multiplier(matrix);
+    std::vector<double> x = {1.0, 2.0, 3.0};
+    EXPECT_NEAR(2.6, multiplier.multiplyRow(0, storm::OptimizationDirection::Maximize, x), 1e-12);
+    EXPECT_NEAR(1.8, multiplier.multiplyRow(0, storm::OptimizationDirection::Minimize, x), 1e-12);
+    EXPECT_EQ(0ull, multiplier.getNumberOfSorts());
+
+    // The successors are only sorted again if their order changed.
+    x = {3.0, 2.0, 1.0};
+    std::vector<double> result(1);
+    multiplier.multiply(env, storm::OptimizationDirection::Maximize, x, nullptr, result);
+    EXPECT_NEAR(2.2, result[0], 1e-12);
+    multiplier.multiply(env, storm::OptimizationDirection::Maximize, x, nullptr, result);
+    EXPECT_EQ(1ull, multiplier.getNumberOfSorts());
+
+    // The intervals of a row need to contain a distribution.
+    storm::storage::SparseMatrixBuilder<storm::Interval> infeasibleBuilder;
+    ASSERT_NO_THROW(infeasibleBuilder.addNextValue(0, 0, storm::Interval(0.1, 0.3)));
+    ASSERT_NO_THROW(infeasibleBuilder.addNextValue(0, 1, storm::Interval(0.2, 0.5)));
+    storm::storage::SparseMatrix<storm::Interval> infeasible;
+    ASSERT_NO_THROW(infeasible = infeasibleBuilder.build());
+    EXPECT_THROW(storm::solver::RobustMultiplier<double> infeasibleMultiplier(infeasible), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(RobustValueIterationTest, IntervalMdp) {
+    // State 0 reaches the target state 1 or the sink state 2 with an uncertain or with a fixed probability.
+    storm::storage::SparseMatrixBuilder<storm::Interval> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, storm::Interval(0.3, 0.6)));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, storm::Interval(0.4, 0.7)));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, storm::Interval(0.5, 0.5)));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, storm::Interval(0.5, 0.5)));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    storm::storage::SparseMatrix<storm::Interval> matrix;
+    ASSERT_NO_THROW(matrix = builder.build(4, 3, 3));
+    std::vector<double> b = {0.0, 0.0, 1.0, 0.0};
+
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::solver::helper::RobustValueIterationHelper<double> helper(matrix);
+    std::vector<double> x(3);
+    std::vector<uint64_t> choices;
+
+    // Robust values, i.e., nature acts against the choices.
+    auto result = helper.solve(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, x, b, &choices);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, result.second);
+    EXPECT_NEAR(0.5, x[0], 1e-8);
+    EXPECT_NEAR(1.0, x[1], 1e-8);
+    EXPECT_EQ(1ull, choices[0]);
+
+    x.assign(3, 0.0);
+    helper.solve(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Maximize, x, b, &choices);
+    EXPECT_NEAR(0.6, x[0], 1e-8);
+    EXPECT_EQ(0ull, choices[0]);
+
+    x.assign(3, 0.0);
+    helper.solve(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Minimize, x, b, &choices);
+    EXPECT_NEAR(0.3, x[0], 1e-8);
+    EXPECT_EQ(0ull, choices[0]);
+}
@@ -0,0 +1,71 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverWorkspace.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(SolverWorkspaceTest, AcquireAndRelease) {
+    auto workspace = std::make_shared<storm::solver::SolverWorkspace>(2);
+    {
+        auto first = storm::solver::SolverWorkspace::acquire<double>(workspace, 100);
+        auto second = storm::solver::SolverWorkspace::acquire<double>(workspace, 10);
+        EXPECT_EQ(100ull, first->size());
+        (*first)[3] = 1.0;
+    }
+    EXPECT_EQ(2ull, workspace->getNumberOfAllocations());
+    EXPECT_EQ(0ull, workspace->getNumberOfReuses());
+
+    // The retained vectors are handed out zero-filled again.
+    auto vector = storm::solver::SolverWorkspace::acquire<double>(workspace, 50);
+    EXPECT_EQ(50ull, vector->size());
+    EXPECT_EQ(0.0, (*vector)[3]);
+    EXPECT_EQ(1ull, workspace->getNumberOfReuses());
+
+    // Vectors of other value types are kept apart.
+    auto exact = storm::solver::SolverWorkspace::acquire<storm::RationalNumber>(workspace, 10);
+    EXPECT_EQ(3ull, workspace->getNumberOfAllocations());
+
+    // Without a workspace, the vectors are simply allocated and freed.
+    auto standalone = storm::solver::SolverWorkspace::acquire<double>(nullptr, 5);
+    EXPECT_EQ(5ull, standalone->size());
+    EXPECT_EQ(3ull, workspace->getNumberOfAllocations());
+
+    // Cleared vectors are freed.
+    vector.reset();
+    workspace->clear();
+    auto afterClear = storm::solver::SolverWorkspace::acquire<double>(workspace, 50);
+    EXPECT_EQ(1ull, workspace->getNumberOfReuses());
+}
+
+TEST(SolverWorkspaceTest, SolveRepeatedly) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+    storm::storage::SparseMatrix<double> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+    std::vector<double> b = {0.099, 0.5};
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    auto workspace = std::make_shared<storm::solver::SolverWorkspace>();
+    env.solver().setWorkspace(workspace);
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+    std::vector<double> results;
+    for (uint64_t iteration = 0; iteration < 3; ++iteration) {
+        auto solver = factory.create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        std::vector<double> x(1);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        results.push_back(x[0]);
+    }
+    EXPECT_NEAR(0.5, results.front(), 1e-6);
+    EXPECT_EQ(results.front(), results[1]);
+    EXPECT_EQ(results.front(), results.back());
+    EXPECT_LT(0ull, workspace->getNumberOfReuses());
+}
@@ -1,9 +1,13 @@
 #include "test/storm_gtest.h"
 
 #include <cstdint>
+#include <thread>
+#include <vector>
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/storage/TreeCompressedBitVectorHashMap.h"
 
 TEST(BitVectorHashMapTest, FindOrAdd) {
     storm::storage::BitVectorHashMap<uint64_t> map(64, 3);
@@ -67,3 +71,104 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfKeys = 20011;  // prime, such that each thread visits all keys
+    uint64_t const numberOfThreads = 4;
+    std::vector<storm::storage::BitVector> keys;
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, i * 0x9E3779B97F4A7C15ull);
+        key.setFromInt(64, 64, i);
+        keys.push_back(key);
+    }
+
+    // Start with a small map such that the segments need to grow while the threads are inserting.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16, 0.75, 8);
+    EXPECT_EQ(8ul, map.getNumberOfSegments());
+    std::vector<std::vector<uint64_t>> foundIndices(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            // All threads insert all keys, each one in a different order.
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                uint64_t keyIndex = (i * (2 * thread + 1) + thread * 1000) % numberOfKeys;
+                foundIndices[thread][keyIndex] = map.findOrAddNextIndex(keys[keyIndex]).first;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    storm::storage::BitVector usedIndices(numberOfKeys);
+    for (uint64_t keyIndex = 0; keyIndex < numberOfKeys; ++keyIndex) {
+        uint64_t index = foundIndices[0][keyIndex];
+        ASSERT_LT(index, numberOfKeys);
+        EXPECT_FALSE(usedIndices.get(index));
+        usedIndices.set(index);
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(index, foundIndices[thread][keyIndex]);
+        }
+        EXPECT_EQ(index, map.getValue(keys[keyIndex]));
+    }
+    EXPECT_TRUE(usedIndices.full());
+
+    auto sequentialMap = map.toBitVectorHashMap();
+    EXPECT_EQ(numberOfKeys, sequentialMap.size());
+    for (uint64_t keyIndex = 0; keyIndex < numberOfKeys; ++keyIndex) {
+        EXPECT_EQ(foundIndices[0][keyIndex], sequentialMap.getValue(keys[keyIndex]));
+    }
+
+    storm::storage::BitVector otherKey(128);
+    otherKey.set(3);
+    uint64_t value = 0;
+    EXPECT_FALSE(map.find(otherKey, value));
+    EXPECT_EQ(42ul, map.findOrAdd(otherKey, 42));
+    EXPECT_EQ(42ul, map.findOrAdd(otherKey, 43));
+    EXPECT_TRUE(map.find(otherKey, value));
+    EXPECT_EQ(42ul, value);
+    EXPECT_EQ(numberOfKeys + 1, map.size());
+}
+
+TEST(BitVectorHashMapTest, TreeCompression) {
+    for (uint64_t bitsPerKey : {17ul, 64ul, 96ul, 320ul}) {
+        storm::storage::BitVectorHashMap<uint64_t> plainMap(((bitsPerKey + 63) / 64) * 64, 16);
+        storm::storage::TreeCompressedBitVectorHashMap<uint64_t> treeMap(bitsPerKey, 16);
+
+        // Keys that consist of few different chunks, as typical for states of models.
+        std::vector<storm::storage::BitVector> keys;
+        for (uint64_t i = 0; i < 5000; ++i) {
+            storm::storage::BitVector key(bitsPerKey);
+            for (uint64_t bit = 0; bit < bitsPerKey; bit += 8) {
+                uint64_t width = std::min<uint64_t>(8, bitsPerKey - bit);
+                key.setFromInt(bit, width, ((i * (bit + 7) / 13) % 5) & ((1ul << width) - 1));
+            }
+            keys.push_back(key);
+        }
+
+        for (uint64_t i = 0; i < keys.size(); ++i) {
+            storm::storage::BitVector plainKey(((bitsPerKey + 63) / 64) * 64);
+            plainKey.set(0, keys[i]);
+            uint64_t newIndex = plainMap.size();
+            EXPECT_EQ(plainMap.findOrAdd(plainKey, newIndex), treeMap.findOrAdd(keys[i], newIndex));
+        }
+        EXPECT_EQ(plainMap.size(), treeMap.size());
+
+        for (auto const& keyValuePair : treeMap) {
+            EXPECT_EQ(keyValuePair.first, treeMap.getKey(keyValuePair.second));
+            EXPECT_TRUE(treeMap.contains(keyValuePair.first));
+            EXPECT_EQ(keyValuePair.second, treeMap.getValue(keyValuePair.first));
+        }
+        for (auto const& key : keys) {
+            EXPECT_EQ(key, treeMap.getKey(treeMap.getValue(key)));
+        }
+
+        storm::storage::BitVector otherKey(bitsPerKey, true);
+        EXPECT_FALSE(treeMap.contains(otherKey));
+
+        treeMap.remap([](uint64_t const& value) { return value + 1; });
+        EXPECT_EQ(1ul, treeMap.getValue(keys.front()));
+    }
+}
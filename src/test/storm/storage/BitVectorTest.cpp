@@ -558,6 +558,48 @@ TEST(BitVectorTest, Iterator) {
     }
 }
 
+TEST(BitVectorTest, NextSetIndices) {
+    storm::storage::BitVector vector(700);
+    for (uint_fast64_t i = 0; i < 700; ++i) {
+        vector.set(i, i % 3 == 0 || (i > 500 && i < 600));
+    }
+
+    std::vector<uint_fast64_t> expected(vector.begin(), vector.end());
+    std::vector<uint_fast64_t> indices;
+    uint_fast64_t index = 0;
+    while (index < vector.size()) {
+        uint_fast64_t numberOfIndices = indices.size();
+        index = vector.getNextSetIndices(index, indices, 7);
+        ASSERT_LE(indices.size(), numberOfIndices + 7);
+    }
+    EXPECT_EQ(expected, indices);
+
+    indices.clear();
+    EXPECT_EQ(4ull, vector.getNextSetIndices(1, indices, 1));
+    EXPECT_EQ(std::vector<uint_fast64_t>({3}), indices);
+    EXPECT_EQ(vector.size(), vector.getNextSetIndices(698, indices, 10));
+    EXPECT_EQ(std::vector<uint_fast64_t>({3, 699}), indices);
+}
+
+TEST(BitVectorTest, SubsetAndDisjointLong) {
+    // Use enough buckets to cover several blocks of the vectorized loops.
+    storm::storage::BitVector vector1(1000);
+    storm::storage::BitVector vector2(1000);
+    for (uint_fast64_t i = 0; i < 1000; i += 5) {
+        vector1.set(i);
+        vector2.set(i);
+        vector2.set(i + 1);
+    }
+    EXPECT_TRUE(vector1.isSubsetOf(vector2));
+    EXPECT_FALSE(vector2.isSubsetOf(vector1));
+    EXPECT_FALSE(vector1.isDisjointFrom(vector2));
+    EXPECT_TRUE(vector1.isDisjointFrom(~vector2));
+
+    vector1.set(998);
+    EXPECT_FALSE(vector1.isSubsetOf(vector2));
+    EXPECT_FALSE(vector1.isDisjointFrom(~vector2));
+}
+
 TEST(BitVectorTest, CompareAndSwap) {
     storm::storage::BitVector vector(140);
     vector.setFromInt(0, 64, 2377830234574424100);
@@ -0,0 +1,70 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
+
+TEST(CompressedBitVectorTest, Empty) {
+    storm::storage::CompressedBitVector empty;
+    EXPECT_EQ(0ul, empty.size());
+    EXPECT_EQ(0ul, empty.getNumberOfSetBits());
+    EXPECT_FALSE(empty.get(0));
+    EXPECT_EQ(storm::storage::BitVector(), empty.toBitVector());
+
+    storm::storage::BitVector unset(200000);
+    storm::storage::CompressedBitVector compressed(unset);
+    EXPECT_EQ(200000ul, compressed.size());
+    EXPECT_EQ(0ul, compressed.getNumberOfSetBits());
+    EXPECT_EQ(unset, compressed.toBitVector());
+    EXPECT_LT(compressed.getSizeInBytes(), unset.getSizeInBytes());
+}
+
+TEST(CompressedBitVectorTest, RoundTrip) {
+    uint64_t const size = 300000;
+
+    // Few set bits spread across several chunks.
+    storm::storage::BitVector sparse(size, {0, 17, 65535, 65536, 70000, 200001, size - 1});
+
+    // Long runs that cross chunk boundaries.
+    storm::storage::BitVector runs(size);
+    for (uint64_t index = 1000; index < 131000; ++index) {
+        runs.set(index);
+    }
+    runs.set(131072);
+    for (uint64_t index = 250000; index < size; ++index) {
+        runs.set(index);
+    }
+
+    // An irregular pattern that needs a bitmap.
+    storm::storage::BitVector dense(size);
+    for (uint64_t index = 0; index < size; index += 3) {
+        dense.set(index);
+    }
+
+    for (auto const& bitVector : {sparse, runs, dense}) {
+        storm::storage::CompressedBitVector compressed(bitVector);
+        EXPECT_EQ(bitVector.size(), compressed.size());
+        EXPECT_EQ(bitVector.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+        EXPECT_EQ(bitVector, compressed.toBitVector());
+        for (uint64_t index = 0; index < size; ++index) {
+            ASSERT_EQ(bitVector.get(index), compressed.get(index)) << "Index " << index;
+        }
+        EXPECT_FALSE(compressed.get(size));
+    }
+
+    EXPECT_LT(storm::storage::CompressedBitVector(sparse).getSizeInBytes(), sparse.getSizeInBytes());
+    EXPECT_LT(storm::storage::CompressedBitVector(runs).getSizeInBytes(), runs.getSizeInBytes());
+}
+
+TEST(CompressedBitVectorTest, Equality) {
+    storm::storage::BitVector first(100000, {3, 5, 70000});
+    storm::storage::BitVector second(first);
+    EXPECT_EQ(storm::storage::CompressedBitVector(first), storm::storage::CompressedBitVector(second));
+
+    second.set(70001);
+    EXPECT_NE(storm::storage::CompressedBitVector(first), storm::storage::CompressedBitVector(second));
+
+    first.set(70001);
+    EXPECT_EQ(storm::storage::CompressedBitVector(first), storm::storage::CompressedBitVector(second));
+    EXPECT_NE(storm::storage::CompressedBitVector(first), storm::storage::CompressedBitVector(storm::storage::BitVector(100001, {3, 5, 70000, 70001})));
+}
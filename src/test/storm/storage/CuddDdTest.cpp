@@ -5,6 +5,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/PartitionedRelation.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "test/storm_gtest.h"
@@ -767,3 +768,42 @@ TEST(CuddDd, BddToExpressionTest) {
 
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(CuddDd, PartitionedRelationTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 9);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 3);
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> pairs = {x, y};
+
+    // Every state either moves to its successor or resets to zero.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> xRow = manager->template getIdentity<double>(x.first);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> xColumn = manager->template getIdentity<double>(x.second);
+    storm::dd::Bdd<storm::dd::DdType::CUDD> relation =
+        ((xRow + manager->template getConstant<double>(1)).equals(xColumn) || manager->getEncoding(x.second, 0)) && manager->getRange(x.first) &&
+        manager->getRange(x.second);
+
+    auto disjunctive = storm::dd::PartitionedRelation<storm::dd::DdType::CUDD>::splitDisjunctively(relation, {x.first}, {x.second}, {x}, 1);
+    EXPECT_LT(1ul, disjunctive.getParts().size());
+    EXPECT_TRUE(relation == disjunctive.toBdd());
+
+    storm::dd::Bdd<storm::dd::DdType::CUDD> states = manager->getEncoding(x.first, 5) || manager->getEncoding(x.first, 9);
+    EXPECT_TRUE(disjunctive.preimage(states) == (manager->getEncoding(x.first, 4) || manager->getEncoding(x.first, 8)));
+    EXPECT_TRUE(disjunctive.preimage(states) == states.inverseRelationalProduct(relation, {x.first}, {x.second}));
+    EXPECT_TRUE(disjunctive.image(states) == (manager->getEncoding(x.first, 6) || manager->getEncoding(x.first, 0)));
+
+    states = manager->getRange(x.first) && !manager->getEncoding(x.first, 9);
+    EXPECT_TRUE(disjunctive.universalPreimage(states) == (manager->getRange(x.first) && !manager->getEncoding(x.first, 8)));
+    EXPECT_TRUE(disjunctive.universalPreimage(states) == relation.implies(states.swapVariables({x})).universalAbstract({x.second}));
+
+    // Both variables are updated independently.
+    storm::dd::Bdd<storm::dd::DdType::CUDD> yRelation =
+        manager->template getIdentity<double>(y.first).equals(manager->template getIdentity<double>(y.second)) && manager->getRange(y.first);
+    storm::dd::PartitionedRelation<storm::dd::DdType::CUDD> conjunctive({relation, yRelation},
+                                                                        storm::dd::PartitionedRelation<storm::dd::DdType::CUDD>::Kind::Conjunctive,
+                                                                        {x.first, y.first}, {x.second, y.second}, pairs);
+    states = manager->getEncoding(x.first, 5) && manager->getEncoding(y.first, 2);
+    EXPECT_TRUE(conjunctive.preimage(states) == (manager->getEncoding(x.first, 4) && manager->getEncoding(y.first, 2)));
+    EXPECT_TRUE(conjunctive.preimage(states) == states.inverseRelationalProduct(relation && yRelation, {x.first, y.first}, {x.second, y.second}));
+    EXPECT_TRUE(conjunctive.image(states) ==
+                ((manager->getEncoding(x.first, 6) || manager->getEncoding(x.first, 0)) && manager->getEncoding(y.first, 2)));
+}
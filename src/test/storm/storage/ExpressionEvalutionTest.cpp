@@ -1,7 +1,11 @@
 #include "adapters/RationalNumberAdapter.h"
 #include "storage/expressions/OperatorType.h"
 #include "storm-parsers/parser/ExpressionCreator.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/VariableInformation.h"
 #include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
 #include "storm/storage/expressions/SimpleValuation.h"
@@ -64,6 +68,72 @@ TEST(ExpressionEvaluation, ExprTkEvaluation) {
     }
 }
 
+TEST(ExpressionEvaluation, BytecodeEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareRationalVariable("z");
+    storm::expressions::Expression xe = x.getExpression();
+    storm::expressions::Expression ye = y.getExpression();
+    storm::expressions::Expression ze = z.getExpression();
+
+    storm::expressions::Expression shared = ye * manager->integer(2) + ze;
+    std::vector<storm::expressions::Expression> expressions = {
+        storm::expressions::ite(xe, shared, manager->integer(3) * ze),
+        shared > manager->rational(4.5) && !xe,
+        storm::expressions::minimum(shared, ye) / storm::expressions::maximum(ze, manager->rational(0.5)),
+        storm::expressions::implies(xe, ye % manager->integer(3) == manager->integer(1)),
+        storm::expressions::xclusiveor(storm::expressions::iff(xe, ye >= manager->integer(2)), storm::expressions::floor(ze) != storm::expressions::ceil(ze)),
+        storm::expressions::pow(ye, manager->integer(2)) - (manager->integer(1) + manager->integer(2))};
+
+    storm::expressions::BytecodeExpressionEvaluator evaluator(*manager);
+    uint64_t batch = evaluator.addBatch({expressions[1], expressions[3], expressions[4]});
+    storm::expressions::SimpleValuation valuation(manager);
+    std::vector<double> batchValues;
+    for (int_fast64_t xValue = 0; xValue <= 1; ++xValue) {
+        for (int_fast64_t yValue = -3; yValue <= 5; ++yValue) {
+            for (double zValue : {-1.5, 0.0, 0.25, 2.0, 7.75}) {
+                evaluator.setBooleanValue(x, xValue == 1);
+                evaluator.setIntegerValue(y, yValue);
+                evaluator.setRationalValue(z, zValue);
+                valuation.setBooleanValue(x, xValue == 1);
+                valuation.setIntegerValue(y, yValue);
+                valuation.setRationalValue(z, zValue);
+
+                EXPECT_NEAR(expressions[0].evaluateAsDouble(&valuation), evaluator.asRational(expressions[0]), 1e-6);
+                EXPECT_EQ(expressions[1].evaluateAsBool(&valuation), evaluator.asBool(expressions[1]));
+                EXPECT_NEAR(expressions[2].evaluateAsDouble(&valuation), evaluator.asRational(expressions[2]), 1e-6);
+                EXPECT_EQ(expressions[3].evaluateAsBool(&valuation), evaluator.asBool(expressions[3]));
+                EXPECT_EQ(expressions[4].evaluateAsBool(&valuation), evaluator.asBool(expressions[4]));
+                EXPECT_NEAR(expressions[5].evaluateAsDouble(&valuation), evaluator.asRational(expressions[5]), 1e-6);
+
+                storm::storage::BitVector batchResult = evaluator.evaluateBatchAsBool(batch);
+                EXPECT_EQ(expressions[1].evaluateAsBool(&valuation), batchResult.get(0));
+                EXPECT_EQ(expressions[3].evaluateAsBool(&valuation), batchResult.get(1));
+                EXPECT_EQ(expressions[4].evaluateAsBool(&valuation), batchResult.get(2));
+            }
+        }
+    }
+}
+
+TEST(ExpressionEvaluation, BytecodeSharing) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Expression ye = y.getExpression();
+
+    storm::expressions::ExpressionBytecode bytecode(*manager);
+    bytecode.compile(ye + manager->integer(1) < manager->integer(5));
+    EXPECT_EQ(2ull, bytecode.getNumberOfInstructions());
+    // The sum is shared with the first expression (even though it is a different object).
+    bytecode.compile(ye + manager->integer(1) > manager->integer(0));
+    EXPECT_EQ(3ull, bytecode.getNumberOfInstructions());
+    // Constant subexpressions are folded.
+    uint64_t constant = bytecode.compile(manager->integer(2) * manager->integer(3) + manager->integer(1));
+    EXPECT_EQ(3ull, bytecode.getNumberOfInstructions());
+    EXPECT_EQ(7.0, bytecode.evaluate(constant));
+}
+
 TEST(ExpressionEvaluation, NegativeModulo) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
@@ -93,3 +163,113 @@ TEST(ExpressionEvaluation, NegativeModulo) {
     EXPECT_NEAR(result3, expectedDouble, 1e-6);
     EXPECT_NEAR(result4, expectedDouble, 1e-6);
 }
+
+TEST(ExpressionEvaluation, CompiledStateEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareIntegerVariable("z");
+    storm::expressions::Variable r = manager->declareRationalVariable("r");
+
+    // x is stored in bit 0, y in [-5, 10] in bits 1-4 and z in [0, 7] in bits 5-7.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0, true, true);
+    variableInformation.integerVariables.emplace_back(y, -5, 10, 1, 4);
+    variableInformation.integerVariables.emplace_back(z, 0, 7, 5, 3);
+    variableInformation.totalBitOffset = 8;
+
+    storm::expressions::Expression xe = x.getExpression();
+    storm::expressions::Expression ye = y.getExpression();
+    storm::expressions::Expression ze = z.getExpression();
+    std::vector<storm::expressions::Expression> expressions = {
+        storm::expressions::ite(xe, ye + ze, manager->integer(3) * ze - ye),
+        (ye < ze) || (!xe && ye >= manager->integer(2)),
+        storm::expressions::minimum(ye, ze) * storm::expressions::maximum(ye, -ze) + (ze % manager->integer(3)),
+        storm::expressions::ite(ye == ze, xe, storm::expressions::implies(xe, ye != manager->integer(0))),
+        storm::expressions::xclusiveor(storm::expressions::iff(xe, ze > manager->integer(3)), ye <= manager->integer(-1))};
+
+    storm::generator::StateExpressionCompiler compiler(variableInformation);
+    std::vector<boost::optional<storm::generator::CompiledStateExpression>> compiledExpressions;
+    for (auto const& expression : expressions) {
+        compiledExpressions.push_back(compiler.compile(expression));
+        ASSERT_TRUE(compiledExpressions.back().is_initialized()) << expression;
+    }
+    // Expressions involving rationals or divisions are left to the evaluator.
+    EXPECT_FALSE(compiler.compile(ye < r.getExpression()).is_initialized());
+    EXPECT_FALSE(compiler.compile(ye / ze > manager->integer(1)).is_initialized());
+
+    storm::expressions::SimpleValuation valuation(manager);
+    storm::generator::CompressedState state(8);
+    for (int_fast64_t xValue = 0; xValue <= 1; ++xValue) {
+        for (int_fast64_t yValue = -5; yValue <= 10; ++yValue) {
+            for (int_fast64_t zValue = 0; zValue <= 7; ++zValue) {
+                state.set(0, xValue == 1);
+                state.setFromInt(1, 4, yValue + 5);
+                state.setFromInt(5, 3, zValue);
+                valuation.setBooleanValue(x, xValue == 1);
+                valuation.setIntegerValue(y, yValue);
+                valuation.setIntegerValue(z, zValue);
+                for (uint64_t i = 0; i < expressions.size(); ++i) {
+                    if (expressions[i].hasBooleanType()) {
+                        EXPECT_EQ(expressions[i].evaluateAsBool(&valuation), compiledExpressions[i]->evaluateAsBool(state)) << expressions[i];
+                    } else {
+                        EXPECT_EQ(expressions[i].evaluateAsInt(&valuation), compiledExpressions[i]->evaluateAsInt(state)) << expressions[i];
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(ExpressionEvaluation, GuardIndex) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable s = manager->declareIntegerVariable("s");
+    storm::expressions::Variable t = manager->declareIntegerVariable("t");
+
+    // b is stored in bit 0, s in [0, 5] in bits 1-3 and t in [0, 3] in bits 4-5.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(b, 0, true, true);
+    variableInformation.integerVariables.emplace_back(s, 0, 5, 1, 3);
+    variableInformation.integerVariables.emplace_back(t, 0, 3, 4, 2);
+    variableInformation.totalBitOffset = 6;
+
+    storm::expressions::Expression be = b.getExpression();
+    storm::expressions::Expression se = s.getExpression();
+    storm::expressions::Expression te = t.getExpression();
+    std::vector<std::pair<uint_fast64_t, storm::expressions::Expression>> commands = {{0, se == manager->integer(0) && be},
+                                                                                      {1, te > manager->integer(1)},
+                                                                                      {2, manager->integer(2) == se},
+                                                                                      {3, !be && (te == manager->integer(0) && se == manager->integer(2))},
+                                                                                      {4, se == manager->integer(7)},
+                                                                                      {5, se == manager->integer(0) || te == manager->integer(3)}};
+    storm::generator::GuardIndex guardIndex(commands, variableInformation);
+    EXPECT_TRUE(guardIndex.isIndexed());
+
+    storm::expressions::SimpleValuation valuation(manager);
+    storm::generator::CompressedState state(6);
+    for (int_fast64_t bValue = 0; bValue <= 1; ++bValue) {
+        for (int_fast64_t sValue = 0; sValue <= 5; ++sValue) {
+            for (int_fast64_t tValue = 0; tValue <= 3; ++tValue) {
+                state.set(0, bValue == 1);
+                state.setFromInt(1, 3, sValue);
+                state.setFromInt(4, 2, tValue);
+                valuation.setBooleanValue(b, bValue == 1);
+                valuation.setIntegerValue(s, sValue);
+                valuation.setIntegerValue(t, tValue);
+
+                // All enabled commands need to be candidates and the candidates need to be ordered.
+                std::vector<uint_fast64_t> const& candidates = guardIndex.getCandidates(state);
+                EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+                for (auto const& command : commands) {
+                    if (command.second.evaluateAsBool(&valuation)) {
+                        EXPECT_TRUE(std::find(candidates.begin(), candidates.end(), command.first) != candidates.end()) << command.second;
+                    }
+                }
+                EXPECT_TRUE(std::find(candidates.begin(), candidates.end(), 4) == candidates.end());
+            }
+        }
+    }
+}
@@ -343,6 +343,30 @@ TEST(Expression, SimplificationTest) {
     EXPECT_TRUE(simplifiedExpression.isFalse());
 }
 
+TEST(Expression, HashConsingTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+
+    // Structurally equal expressions share their nodes.
+    storm::expressions::Expression first = x.getExpression() + manager->integer(1) < y.getExpression();
+    storm::expressions::Expression second = x.getExpression() + manager->integer(1) < y.getExpression();
+    EXPECT_TRUE(first.areSame(second));
+    EXPECT_FALSE(first.areSame(x.getExpression() + manager->integer(2) < y.getExpression()));
+    EXPECT_FALSE((x.getExpression() - manager->integer(1)).areSame(-x.getExpression()));
+    EXPECT_FALSE(manager->integer(1).areSame(manager->rational(1)));
+
+    // The same holds for the results of substitutions and simplifications.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution = {std::make_pair(y, x.getExpression() * manager->integer(2))};
+    storm::expressions::Expression substituted = first.substitute(substitution);
+    EXPECT_TRUE(substituted.areSame(x.getExpression() + manager->integer(1) < x.getExpression() * manager->integer(2)));
+    EXPECT_TRUE(second.substitute(substitution).areSame(substituted));
+
+    storm::expressions::Expression simplified = (manager->boolean(true) && first).simplify();
+    EXPECT_TRUE(simplified.areSame(first));
+    EXPECT_TRUE((manager->boolean(true) && second).simplify().areSame(simplified));
+}
+
 TEST(Expression, SimpleEvaluationTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
@@ -0,0 +1,60 @@
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/MemoryPool.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+TEST(MemoryPool, ReuseFreedBlocks) {
+    // The slabs need to hold a block of the largest size class, so they have at least 4096 bytes.
+    storm::storage::MemoryPool pool(1024);
+    void* first = pool.allocate(24);
+    void* second = pool.allocate(32);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(4096ul, pool.getNumberOfReservedBytes());
+
+    // Both requests fall into the same size class, so the freed block is handed out again.
+    pool.deallocate(first, 24);
+    EXPECT_EQ(first, pool.allocate(32));
+
+    // Requests beyond the largest size class do not use the slabs.
+    void* large = pool.allocate(1ul << 20);
+    pool.deallocate(large, 1ul << 20);
+    EXPECT_EQ(4096ul, pool.getNumberOfReservedBytes());
+}
+
+TEST(FlexibleSparseMatrix, ConversionRoundTrip) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4, 6, true, true, 3);
+    matrixBuilder.newRowGroup(0);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 3, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 1.0));
+    matrixBuilder.newRowGroup(2);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 1.0));
+    matrixBuilder.newRowGroup(3);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 0, 0.25));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 3, 0.75));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    EXPECT_EQ(4ul, flexibleMatrix.getRowCount());
+    EXPECT_EQ(3ul, flexibleMatrix.getRowGroupCount());
+    EXPECT_EQ(flexibleMatrix.getRowAllocator(), flexibleMatrix.getRow(2).get_allocator());
+    EXPECT_TRUE(matrix == flexibleMatrix.createSparseMatrix());
+
+    // Modify a row through a temporary buffer that shares the pool of the matrix.
+    storm::storage::FlexibleSparseMatrix<double>::row_type newRow(flexibleMatrix.getRowAllocator());
+    newRow.emplace_back(1, 0.5);
+    newRow.emplace_back(2, 0.5);
+    flexibleMatrix.getRow(2).swap(newRow);
+    EXPECT_EQ(flexibleMatrix.getRowAllocator(), flexibleMatrix.getRow(2).get_allocator());
+
+    storm::storage::SparseMatrix<double> modifiedMatrix = flexibleMatrix.createSparseMatrix();
+    EXPECT_EQ(7ul, modifiedMatrix.getEntryCount());
+    EXPECT_EQ(0.5, modifiedMatrix.getRow(2).begin()->getValue());
+    EXPECT_EQ(matrix.getRowGroupIndices(), modifiedMatrix.getRowGroupIndices());
+
+    // Copies of rows do not use the pool.
+    storm::storage::FlexibleSparseMatrix<double>::row_type copiedRow = flexibleMatrix.getRow(0);
+    EXPECT_NE(flexibleMatrix.getRowAllocator(), copiedRow.get_allocator());
+    EXPECT_EQ(flexibleMatrix.getRow(0), copiedRow);
+}
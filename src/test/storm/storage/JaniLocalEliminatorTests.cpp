@@ -12,9 +12,11 @@
 #include "storm/storage/jani/ModelFeatures.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/storage/jani/localeliminator/EliminateAction.h"
+#include "storm/storage/jani/localeliminator/EliminateAutomaticallyAction.h"
 #include "storm/storage/jani/localeliminator/JaniLocalEliminator.h"
 #include "storm/storage/jani/localeliminator/RebuildWithoutUnreachableAction.h"
 #include "storm/storage/jani/localeliminator/UnfoldAction.h"
+#include "storm/storage/jani/localeliminator/UnfoldDependencyGraph.h"
 #include "test/storm_gtest.h"
 
 typedef storm::models::sparse::Dtmc<double> Dtmc;
@@ -494,3 +496,38 @@ TEST(JaniLocalEliminator, EliminationMultiplicityTest) {
     EXPECT_EQ(2u, result.getAutomaton(0).getNumberOfLocations());
     checkModel(result, {property}, std::map<storm::expressions::Variable, storm::expressions::Expression>(), 2.0 / 15.0);
 }
+
+TEST(JaniLocalEliminator, EliminationAutomaticTest) {
+    auto model =
+        storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/localeliminator/simple_guards.jani", storm::jani::getAllKnownModelFeatures(), boost::none).first;
+    storm::parser::FormulaParser formulaParser(model.getExpressionManager().shared_from_this());
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F c=2]");
+    auto property = storm::jani::Property("prop", formula, std::set<storm::expressions::Variable>());
+
+    auto eliminator = JaniLocalEliminator(model, property, false);
+    eliminator.scheduler.addAction(std::make_unique<UnfoldAction>("main", "c"));
+    eliminator.scheduler.addAction(
+        std::make_unique<EliminateAutomaticallyAction>("main", EliminateAutomaticallyAction::EliminationOrder::NewTransitionCount, 1000));
+    eliminator.scheduler.addAction(std::make_unique<RebuildWithoutUnreachableAction>());
+    eliminator.eliminate();
+    auto result = eliminator.getResult();
+
+    EXPECT_EQ(2u, result.getAutomaton(0).getNumberOfLocations());
+    checkModel(result, {property}, std::map<storm::expressions::Variable, storm::expressions::Expression>(), 1.0);
+}
+
+TEST(JaniLocalEliminator, UnfoldCostEstimation) {
+    auto model =
+        storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/localeliminator/simple_guards.jani", storm::jani::getAllKnownModelFeatures(), boost::none).first;
+    UnfoldDependencyGraph dependencyGraph(model);
+
+    // All assignments to c are constant, so each edge is copied once per value of c.
+    UnfoldDependencyGraph::UnfoldCost cost = dependencyGraph.estimateUnfoldCost(model.getAutomaton("main"), dependencyGraph.findGroupIndex("c"));
+    EXPECT_EQ(3u, cost.locationCount);
+    EXPECT_EQ(9u, cost.edgeCount);
+
+    // The assignment y <- y + 1 only depends on y itself.
+    cost = dependencyGraph.estimateUnfoldCost(model.getAutomaton("main"), dependencyGraph.findGroupIndex("y"));
+    EXPECT_EQ(6u, cost.locationCount);
+    EXPECT_EQ(18u, cost.edgeCount);
+}
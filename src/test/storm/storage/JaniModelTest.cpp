@@ -5,6 +5,7 @@
 #include "storm/utility/solver.h"
 
 #include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/visitor/JSONExporter.h"
 
 #ifdef STORM_HAVE_MSAT
 TEST(JaniModelTest, FlattenComposition) {
@@ -165,3 +166,26 @@ TEST(JaniModelTest, FlattenComposition_Dice_Z3) {
     EXPECT_EQ(16ull, janiModel.getAutomaton(0).getNumberOfEdges());
 }
 #endif
+
+TEST(JaniModelTest, StreamingExport) {
+    storm::prism::Program program;
+    ASSERT_NO_THROW(program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm"));
+    storm::jani::Model janiModel = program.toJani();
+
+    std::stringstream prettyStream, compactStream;
+    ASSERT_NO_THROW(storm::jani::JsonExporter::toStream(janiModel, {}, prettyStream, true, false));
+    ASSERT_NO_THROW(storm::jani::JsonExporter::toStream(janiModel, {}, compactStream, true, true));
+    std::string pretty = prettyStream.str();
+    std::string compact = compactStream.str();
+    storm::jani::ExportJsonType prettyJson = storm::jani::ExportJsonType::parse(pretty);
+    EXPECT_EQ(prettyJson, storm::jani::ExportJsonType::parse(compact));
+
+    // The streamed output is formatted as if the complete structure was dumped at once.
+    EXPECT_EQ(prettyJson.dump(4) + "\n", pretty);
+    EXPECT_EQ(prettyJson.dump() + "\n", compact);
+
+    ASSERT_EQ(janiModel.getNumberOfAutomata(), prettyJson["automata"].size());
+    for (uint64_t automatonIndex = 0; automatonIndex < janiModel.getNumberOfAutomata(); ++automatonIndex) {
+        EXPECT_EQ(janiModel.getAutomaton(automatonIndex).getNumberOfEdges(), prettyJson["automata"][automatonIndex]["edges"].size());
+    }
+}
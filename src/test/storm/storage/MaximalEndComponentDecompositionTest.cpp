@@ -179,3 +179,30 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, LeavingChoiceBreaksScc) {
+    // States 0 and 1 are only strongly connected via a choice of state 0 that may leave to state 2, so only state 0 (with its self-loop)
+    // and state 2 form MECs.
+    storm::storage::SparseMatrixBuilder<double> builder(4, 3, 5, true, true, 3);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 0, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 2, 1.0);
+    storm::storage::SparseMatrix<double> transitionMatrix = builder.build();
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(transitionMatrix, transitionMatrix.transpose(true));
+    ASSERT_EQ(2ull, mecDecomposition.size());
+    for (auto const& mec : mecDecomposition) {
+        ASSERT_EQ(1ull, mec.size());
+        if (mec.containsState(0)) {
+            EXPECT_TRUE(mec.getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{1});
+        } else {
+            ASSERT_TRUE(mec.containsState(2));
+            EXPECT_TRUE(mec.getChoicesForState(2) == storm::storage::MaximalEndComponent::set_type{3});
+        }
+    }
+}
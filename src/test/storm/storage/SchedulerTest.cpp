@@ -1,4 +1,5 @@
 #include "storm-config.h"
+#include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/storage/Scheduler.h"
 #include "test/storm_gtest.h"
@@ -50,3 +51,41 @@ TEST(SchedulerTest, PartialDeterministicMemorylessScheduler) {
     ASSERT_FALSE(scheduler.getChoice(1).isDefined());
     ASSERT_FALSE(scheduler.getChoice(2).isDefined());
 }
+
+TEST(SchedulerTest, RandomizedMemorylessScheduler) {
+    storm::storage::Scheduler<double> scheduler(3);
+
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.25);
+    distribution.addProbability(2, 0.75);
+    ASSERT_NO_THROW(scheduler.setChoice(1, 0));
+    ASSERT_NO_THROW(scheduler.setChoice(storm::storage::SchedulerChoice<double>(distribution), 1));
+
+    ASSERT_TRUE(scheduler.isPartialScheduler());
+    ASSERT_FALSE(scheduler.isDeterministicScheduler());
+    ASSERT_TRUE(scheduler.isDeterministicChoice(0));
+    ASSERT_FALSE(scheduler.isDeterministicChoice(1));
+    ASSERT_FALSE(scheduler.isDeterministicChoice(2));
+    EXPECT_EQ(1ul, scheduler.getDeterministicChoice(0));
+    EXPECT_THROW(scheduler.getDeterministicChoice(1), storm::exceptions::InvalidOperationException);
+    EXPECT_NEAR(0.75, scheduler.getChoice(1).getChoiceAsDistribution().getProbability(2), 1e-12);
+
+    // The action support contains both actions of the randomized choice.
+    storm::storage::BitVector support = scheduler.computeActionSupport({0, 2, 5, 6});
+    EXPECT_EQ(storm::storage::BitVector(6, {1, 2, 4}), support);
+
+    // Overwriting the randomized choice by a deterministic one (and clearing it) restores the deterministic scheduler.
+    ASSERT_NO_THROW(scheduler.setChoice(2, 1));
+    ASSERT_NO_THROW(scheduler.setChoice(0, 2));
+    ASSERT_FALSE(scheduler.isPartialScheduler());
+    ASSERT_TRUE(scheduler.isDeterministicScheduler());
+    EXPECT_EQ(2ul, scheduler.getChoice(1).getDeterministicChoice());
+    ASSERT_NO_THROW(scheduler.clearChoice(1));
+    ASSERT_TRUE(scheduler.isPartialScheduler());
+    ASSERT_FALSE(scheduler.getChoice(1).isDefined());
+
+    storm::storage::Scheduler<storm::RationalNumber> exactScheduler = scheduler.toValueType<storm::RationalNumber>();
+    ASSERT_TRUE(exactScheduler.isPartialScheduler());
+    EXPECT_EQ(1ul, exactScheduler.getDeterministicChoice(0));
+    EXPECT_EQ(0ul, exactScheduler.getDeterministicChoice(2));
+}
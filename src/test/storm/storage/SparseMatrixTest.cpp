@@ -2,6 +2,7 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/SoaSparseMatrix.h"
 #include "storm/storage/SparseMatrix.h"
 #include "test/storm_gtest.h"
 
@@ -95,6 +96,42 @@ TEST(SparseMatrixBuilder, AddNextValue) {
     ASSERT_NO_THROW(matrixBuilder4.addNextValue(3, 1, 0.2));
 }
 
+TEST(SparseMatrixBuilder, ChunkedEntryStorage) {
+    storm::storage::SparseMatrixBuilder<double> plainBuilder(0, 0, 0, false, true);
+    storm::storage::SparseMatrixBuilder<double> chunkedBuilder(0, 0, 0, false, true);
+    chunkedBuilder.useChunkedEntryStorage(7);
+
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < 200; ++group) {
+        plainBuilder.newRowGroup(row);
+        chunkedBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < group % 3 + 1; ++choice, ++row) {
+            if ((group + choice) % 11 == 0) {
+                // Leave some rows empty.
+                continue;
+            }
+            // Add the entries in descending order of columns so that the rows need to be fixed.
+            for (uint64_t entry = group % 4 + 1; entry > 0; --entry) {
+                plainBuilder.addNextValue(row, (group + entry * 17) % 200, 0.1 * entry);
+                chunkedBuilder.addNextValue(row, (group + entry * 17) % 200, 0.1 * entry);
+            }
+        }
+    }
+
+    std::vector<uint64_t> replacements(200);
+    for (uint64_t i = 0; i < replacements.size(); ++i) {
+        replacements[i] = (i * 7) % 200;
+    }
+    plainBuilder.replaceColumns(replacements, 0);
+    chunkedBuilder.replaceColumns(replacements, 0);
+    EXPECT_EQ(plainBuilder.getLastColumn(), chunkedBuilder.getLastColumn());
+
+    storm::storage::SparseMatrix<double> plainMatrix = plainBuilder.build();
+    storm::storage::SparseMatrix<double> chunkedMatrix = chunkedBuilder.build();
+    EXPECT_EQ(plainMatrix, chunkedMatrix);
+    EXPECT_EQ(plainMatrix.getRowGroupIndices(), chunkedMatrix.getRowGroupIndices());
+}
+
 TEST(SparseMatrix, Build) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder1(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder1.addNextValue(0, 1, 1.0));
@@ -712,6 +749,54 @@ TEST(SparseMatrix, MatrixVectorMultiply) {
     }
 }
 
+TEST(SparseMatrix, SoaMultiplyAndReduce) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::SoaSparseMatrix<double, uint64_t> soaMatrix(matrix);
+    storm::storage::SoaSparseMatrix<double, uint32_t> compactSoaMatrix(matrix);
+    ASSERT_TRUE((storm::storage::SoaSparseMatrix<double, uint32_t>::canRepresentColumns(matrix)));
+    ASSERT_EQ(matrix.getEntryCount(), soaMatrix.getEntryCount());
+    ASSERT_EQ(matrix.getEntryCount(), compactSoaMatrix.getEntryCount());
+
+    std::vector<double> x = {1, 0.3, 1.4, 7.1};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5};
+    std::vector<double> expected(matrix.getRowCount()), result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    soaMatrix.multiplyWithVector(x, result, &b);
+    for (std::size_t index = 0; index < expected.size(); ++index) {
+        ASSERT_NEAR(expected[index], result[index], 1e-12);
+    }
+    compactSoaMatrix.multiplyWithVector(x, result, &b);
+    for (std::size_t index = 0; index < expected.size(); ++index) {
+        ASSERT_NEAR(expected[index], result[index], 1e-12);
+    }
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(matrix.getRowGroupCount()), reduced(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0), choices(matrix.getRowGroupCount(), 0);
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expectedReduced, &expectedChoices);
+        compactSoaMatrix.multiplyAndReduceForward(dir, matrix.getRowGroupIndices(), x, &b, reduced, &choices);
+        for (std::size_t index = 0; index < expectedReduced.size(); ++index) {
+            ASSERT_NEAR(expectedReduced[index], reduced[index], 1e-12);
+            ASSERT_EQ(expectedChoices[index], choices[index]);
+        }
+    }
+}
+
 TEST(SparseMatrix, Iteration) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -0,0 +1,86 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseMatrixView.h"
+
+namespace {
+storm::storage::SparseMatrix<double> createGroupedMatrix() {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(7, 4, 12, true, true, 4);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 0, 0.5);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(1, 2, 1.0);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 0.25);
+    matrixBuilder.addNextValue(2, 3, 0.75);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 1, 0.2);
+    matrixBuilder.addNextValue(3, 2, 0.3);
+    matrixBuilder.addNextValue(3, 3, 0.5);
+    matrixBuilder.addNextValue(4, 0, 1.0);
+    matrixBuilder.addNextValue(5, 2, 1.0);
+    matrixBuilder.newRowGroup(6);
+    matrixBuilder.addNextValue(6, 1, 0.6);
+    matrixBuilder.addNextValue(6, 3, 0.4);
+    return matrixBuilder.build();
+}
+}  // namespace
+
+TEST(SparseMatrixViewTest, EqualsSubmatrix) {
+    storm::storage::SparseMatrix<double> matrix = createGroupedMatrix();
+    storm::storage::BitVector groups(4, {0, 2, 3});
+    storm::storage::BitVector rows(7, {1, 3, 4});
+    storm::storage::BitVector zeroColumns(4);
+    zeroColumns.set(3);
+
+    storm::storage::SparseMatrixView<double> groupView(matrix, true, groups, groups);
+    EXPECT_EQ(6ul, groupView.getRowCount());
+    EXPECT_EQ(3ul, groupView.getColumnCount());
+    EXPECT_EQ(3ul, groupView.getRowGroupCount());
+    EXPECT_EQ(storm::storage::SparseMatrixView<double>::getInvalidColumn(), groupView.getColumn(1));
+    EXPECT_EQ(matrix.getSubmatrix(true, groups, groups), groupView.toSparseMatrix());
+
+    storm::storage::SparseMatrixView<double> zeroView(matrix, true, groups, groups, zeroColumns);
+    EXPECT_EQ(matrix.getSubmatrix(true, groups, groups, false, zeroColumns), zeroView.toSparseMatrix());
+
+    // Row groups without selected rows are dropped.
+    storm::storage::SparseMatrixView<double> rowView(matrix, false, rows, groups);
+    EXPECT_EQ(2ul, rowView.getRowGroupCount());
+    EXPECT_EQ(4ul, rowView.getOriginalRow(2));
+    EXPECT_EQ(matrix.getSubmatrix(false, rows, groups), rowView.toSparseMatrix());
+}
+
+TEST(SparseMatrixViewTest, Multiply) {
+    storm::storage::SparseMatrix<double> matrix = createGroupedMatrix();
+    storm::storage::BitVector groups(4, {0, 2, 3});
+    storm::storage::SparseMatrixView<double> view(matrix, true, groups, groups);
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, groups, groups);
+
+    std::vector<double> x = {0.1, 0.7, 0.4};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    std::vector<double> viewResult(6), submatrixResult(6);
+    view.multiplyWithVector(x, viewResult, &b);
+    submatrix.multiplyWithVector(x, submatrixResult, &b);
+    EXPECT_EQ(submatrixResult, viewResult);
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> viewReduced(3), submatrixReduced(3);
+        std::vector<uint64_t> viewChoices(3, 0), submatrixChoices(3, 0);
+        view.multiplyAndReduce(dir, x, &b, viewReduced, &viewChoices);
+        submatrix.multiplyAndReduce(dir, submatrix.getRowGroupIndices(), x, &b, submatrixReduced, &submatrixChoices);
+        EXPECT_EQ(submatrixReduced, viewReduced);
+        EXPECT_EQ(submatrixChoices, viewChoices);
+
+        std::vector<double> viewRepeated = x;
+        std::vector<double> submatrixRepeated = x;
+        view.repeatedMultiplyAndReduce(dir, viewRepeated, nullptr, 3);
+        std::vector<double> tmp(3);
+        for (uint64_t i = 0; i < 3; ++i) {
+            submatrix.multiplyAndReduce(dir, submatrix.getRowGroupIndices(), submatrixRepeated, nullptr, tmp, nullptr);
+            std::swap(tmp, submatrixRepeated);
+        }
+        EXPECT_EQ(submatrixRepeated, viewRepeated);
+    }
+}
@@ -0,0 +1,61 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/memorystructure/MemoryStructureBuilder.h"
+#include "storm/storage/memorystructure/SparseModelMemoryProduct.h"
+
+TEST(SparseModelMemoryProductTest, ReachableProductWithSelectedRewardModels) {
+    // State 0 either moves to state 1 or to the states 0 and 2. State 1 moves back to state 0 and state 2 is absorbing.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 3, 5, true, true, 3);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 1.0);
+    matrixBuilder.addNextValue(1, 0, 0.5);
+    matrixBuilder.addNextValue(1, 2, 0.5);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 1.0);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 2, 1.0);
+    storm::models::sparse::StateLabeling labeling(3);
+    labeling.addLabel("init", storm::storage::BitVector(3, std::vector<uint_fast64_t>{0}));
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("a", storm::models::sparse::StandardRewardModel<double>(std::nullopt, std::vector<double>{1.0, 0.0, 0.0, 0.0}));
+    rewardModels.emplace("b", storm::models::sparse::StandardRewardModel<double>(std::vector<double>{0.0, 0.0, 1.0}));
+    storm::models::sparse::Mdp<double> mdp(matrixBuilder.build(), std::move(labeling), std::move(rewardModels));
+
+    // The memory remembers whether state 1 has been visited.
+    storm::storage::MemoryStructureBuilder<double> memoryBuilder(2, mdp);
+    storm::storage::BitVector visitState(3, std::vector<uint_fast64_t>{1});
+    memoryBuilder.setTransition(0, 0, ~visitState);
+    memoryBuilder.setTransition(0, 1, visitState);
+    memoryBuilder.setTransition(1, 1, storm::storage::BitVector(3, true));
+    storm::storage::MemoryStructure memory = memoryBuilder.build();
+
+    storm::storage::SparseModelMemoryProduct<double> productBuilder = memory.product(mdp);
+    productBuilder.setRewardModelsToBuild({"b"});
+    auto product = productBuilder.build()->as<storm::models::sparse::Mdp<double>>();
+
+    // Model state 1 can not be reached without visiting it.
+    EXPECT_FALSE(productBuilder.isStateReachable(1, 0));
+    ASSERT_EQ(5ull, product->getNumberOfStates());
+    ASSERT_EQ(7ull, product->getNumberOfChoices());
+    auto const& matrix = product->getTransitionMatrix();
+    uint64_t state00 = productBuilder.getResultState(0, 0);
+    uint64_t state11 = productBuilder.getResultState(1, 1);
+    uint64_t state20 = productBuilder.getResultState(2, 0);
+    EXPECT_EQ(1.0, matrix.getRow(state00, 0).begin()->getValue());
+    EXPECT_EQ(state11, matrix.getRow(state00, 0).begin()->getColumn());
+    EXPECT_EQ(2ull, matrix.getRow(state00, 1).getNumberOfEntries());
+    EXPECT_EQ(state20, (matrix.getRow(state00, 1).begin() + 1)->getColumn());
+    EXPECT_EQ(productBuilder.getResultState(0, 1), matrix.getRow(state11, 0).begin()->getColumn());
+
+    // Only the requested reward model is translated.
+    EXPECT_FALSE(product->hasRewardModel("a"));
+    ASSERT_TRUE(product->hasRewardModel("b"));
+    auto const& stateRewards = product->getRewardModel("b").getStateRewardVector();
+    EXPECT_EQ(1.0, stateRewards[state20]);
+    EXPECT_EQ(1.0, stateRewards[productBuilder.getResultState(2, 1)]);
+    EXPECT_EQ(0.0, stateRewards[state00]);
+}
@@ -37,6 +37,51 @@ TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
     ASSERT_EQ(1ul, sccDecomposition.size());
 }
 
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 5, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 0.4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 3, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 4, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 4, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(5, 1, 1.0));
+
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.parallel().computeSccDepths();
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccDecomposition(matrix, options);
+    ASSERT_EQ(4ul, sccDecomposition.size());
+
+    // The SCCs are sorted topologically, i.e., {3, 4}, {1, 2}, {5}, {0}.
+    storm::storage::StateBlock correctScc1 = {3, 4};
+    storm::storage::StateBlock correctScc2 = {1, 2};
+    EXPECT_EQ(correctScc1, sccDecomposition[0]);
+    EXPECT_EQ(correctScc2, sccDecomposition[1]);
+    EXPECT_EQ(storm::storage::StateBlock({5}), sccDecomposition[2]);
+    EXPECT_EQ(storm::storage::StateBlock({0}), sccDecomposition[3]);
+    EXPECT_EQ(0ul, sccDecomposition.getSccDepth(0));
+    EXPECT_EQ(1ul, sccDecomposition.getSccDepth(1));
+    EXPECT_EQ(2ul, sccDecomposition.getSccDepth(2));
+    EXPECT_EQ(3ul, sccDecomposition.getSccDepth(3));
+    EXPECT_TRUE(sccDecomposition[2].isTrivial());
+    EXPECT_FALSE(sccDecomposition[3].isTrivial());
+
+    options.dropNaiveSccs();
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options));
+    ASSERT_EQ(3ul, sccDecomposition.size());
+
+    options.onlyBottomSccs();
+    ASSERT_NO_THROW(sccDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options));
+    ASSERT_EQ(1ul, sccDecomposition.size());
+    EXPECT_EQ(correctScc1, sccDecomposition[0]);
+}
+
 TEST(StronglyConnectedComponentDecomposition, FullSystem1) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
         storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
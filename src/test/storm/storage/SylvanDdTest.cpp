@@ -8,6 +8,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/PartitionedRelation.h"
 
 #include "storm/storage/SparseMatrix.h"
 
@@ -708,6 +709,32 @@ TEST(SylvanDd, SwapTest) {
     EXPECT_TRUE(dd1 == manager->template getIdentity<double>(x.second));
 }
 
+TEST(SylvanDd, ReorderingTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 15);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 15);
+
+    // Comparing two variables whose bits are not interleaved requires many nodes.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> dd1 = manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(y.first));
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd2 = manager->template getIdentity<double>(x.first) + manager->template getIdentity<double>(y.second);
+    uint64_t nodeCountBefore = dd1.getNodeCount();
+
+    ASSERT_NO_THROW(manager->triggerReordering());
+    EXPECT_LT(dd1.getNodeCount(), nodeCountBefore);
+    EXPECT_TRUE(dd1 == manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(y.first)));
+    EXPECT_TRUE(dd2 == manager->template getIdentity<double>(x.first) + manager->template getIdentity<double>(y.second));
+    EXPECT_EQ(255ul, dd2.getNonZeroCount());
+
+    // The row and column variables need to stay adjacent to be swapped.
+    ASSERT_NO_THROW(dd1 = dd1.swapVariables({std::make_pair(x.first, x.second)}));
+    EXPECT_TRUE(dd1 == manager->template getIdentity<double>(x.second).equals(manager->template getIdentity<double>(y.first)));
+
+    std::map<storm::expressions::Variable, int_fast64_t> metaVariableToValueMap;
+    metaVariableToValueMap.emplace(x.first, 3);
+    metaVariableToValueMap.emplace(y.second, 5);
+    EXPECT_EQ(8, dd2.getValue(metaVariableToValueMap));
+}
+
 TEST(SylvanDd, MultiplyMatrixTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -953,3 +980,42 @@ TEST(SylvanDd, BddToExpressionTest) {
 
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, PartitionedRelationTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 9);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 3);
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> pairs = {x, y};
+
+    // Every state either moves to its successor or resets to zero.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> xRow = manager->template getIdentity<double>(x.first);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> xColumn = manager->template getIdentity<double>(x.second);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> relation =
+        ((xRow + manager->template getConstant<double>(1)).equals(xColumn) || manager->getEncoding(x.second, 0)) && manager->getRange(x.first) &&
+        manager->getRange(x.second);
+
+    auto disjunctive = storm::dd::PartitionedRelation<storm::dd::DdType::Sylvan>::splitDisjunctively(relation, {x.first}, {x.second}, {x}, 1);
+    EXPECT_LT(1ul, disjunctive.getParts().size());
+    EXPECT_TRUE(relation == disjunctive.toBdd());
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> states = manager->getEncoding(x.first, 5) || manager->getEncoding(x.first, 9);
+    EXPECT_TRUE(disjunctive.preimage(states) == (manager->getEncoding(x.first, 4) || manager->getEncoding(x.first, 8)));
+    EXPECT_TRUE(disjunctive.preimage(states) == states.inverseRelationalProduct(relation, {x.first}, {x.second}));
+    EXPECT_TRUE(disjunctive.image(states) == (manager->getEncoding(x.first, 6) || manager->getEncoding(x.first, 0)));
+
+    states = manager->getRange(x.first) && !manager->getEncoding(x.first, 9);
+    EXPECT_TRUE(disjunctive.universalPreimage(states) == (manager->getRange(x.first) && !manager->getEncoding(x.first, 8)));
+    EXPECT_TRUE(disjunctive.universalPreimage(states) == relation.implies(states.swapVariables({x})).universalAbstract({x.second}));
+
+    // Both variables are updated independently.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> yRelation =
+        manager->template getIdentity<double>(y.first).equals(manager->template getIdentity<double>(y.second)) && manager->getRange(y.first);
+    storm::dd::PartitionedRelation<storm::dd::DdType::Sylvan> conjunctive({relation, yRelation},
+                                                                          storm::dd::PartitionedRelation<storm::dd::DdType::Sylvan>::Kind::Conjunctive,
+                                                                          {x.first, y.first}, {x.second, y.second}, pairs);
+    states = manager->getEncoding(x.first, 5) && manager->getEncoding(y.first, 2);
+    EXPECT_TRUE(conjunctive.preimage(states) == (manager->getEncoding(x.first, 4) && manager->getEncoding(y.first, 2)));
+    EXPECT_TRUE(conjunctive.preimage(states) == states.inverseRelationalProduct(relation && yRelation, {x.first, y.first}, {x.second, y.second}));
+    EXPECT_TRUE(conjunctive.image(states) ==
+                ((manager->getEncoding(x.first, 6) || manager->getEncoding(x.first, 0)) && manager->getEncoding(y.first, 2)));
+}
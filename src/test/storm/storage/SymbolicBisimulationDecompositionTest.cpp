@@ -495,3 +495,53 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+TEST(SymbolicModelBisimulationDecomposition, DieSparseQuotient_Cudd) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]"));
+
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::CUDD, double> preservationInformation(*model, formulas);
+    ASSERT_TRUE(preservationInformation.hasDecidedStates());
+    EXPECT_EQ(1ul, preservationInformation.getDecidedStates().getNonZeroCount());
+
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::CUDD, double> decomposition(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse);
+
+    EXPECT_EQ(5ul, quotient->getNumberOfStates());
+    EXPECT_EQ(8ul, quotient->getNumberOfTransitions());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, quotient->getType());
+    EXPECT_TRUE(quotient->isSparseModel());
+}
+
+TEST(SymbolicModelBisimulationDecomposition, TwoDiceSparseQuotient_Sylvan) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(program);
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]"));
+
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Sparse);
+
+    EXPECT_EQ(11ul, quotient->getNumberOfStates());
+    EXPECT_EQ(34ul, quotient->getNumberOfTransitions());
+    EXPECT_EQ(storm::models::ModelType::Mdp, quotient->getType());
+    EXPECT_TRUE(quotient->isSparseModel());
+    EXPECT_EQ(19ul, (quotient->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices()));
+
+    // Rewards do not admit decided states.
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("R=? [C<=5]"));
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::Sylvan, double> preservationInformation(*model, formulas);
+    EXPECT_FALSE(preservationInformation.hasDecidedStates());
+}
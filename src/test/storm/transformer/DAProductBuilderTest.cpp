@@ -135,3 +135,62 @@ TEST(DAProductBuilderTest_aWb, Dtmc) {
     scc.insert(12);
     ASSERT_EQ(product->getAcceptance()->isAccepting(scc), false);
 }
+
+TEST(DAProductBuilderTest_Truncated, Dtmc) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto dtmc = std::dynamic_pointer_cast<storm::models::sparse::Dtmc<double>>(model);
+
+    std::string aUb =
+        "HOA: v1\n"
+        "States: 3\n"
+        "Start: 0\n"
+        "acc-name: Rabin 1\n"
+        "Acceptance: 2 (Fin(0) & Inf(1))\n"
+        "AP: 2 \"a\" \"b\""
+        "--BODY--\n"
+        "State: 0 \"a U b\" \n { 0 }\n"
+        "  2  /* !a  & !b */\n"
+        "  0  /*  a  & !b */\n"
+        "  1  /* !a  &  b */\n"
+        "  1  /*  a  &  b */\n"
+        "State: 1 { 1 }\n"
+        "  1 1 1 1       /* four transitions on one line */\n"
+        "State: 2 \"sink state\" { 0 }\n"
+        "  2 2 2 2\n"
+        "--END--\n";
+
+    std::istringstream in = std::istringstream(aUb);
+    storm::automata::DeterministicAutomaton::ptr da;
+    ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
+    EXPECT_FALSE(da->isSink(0));
+    EXPECT_TRUE(da->isSink(1));
+    EXPECT_TRUE(da->isSink(2));
+
+    std::vector<storm::storage::BitVector> apLabels;
+    storm::storage::BitVector apA(dtmc->getNumberOfStates(), true);
+    apA.set(2, false);
+    storm::storage::BitVector apB(dtmc->getNumberOfStates(), false);
+    apB.set(7);
+    apLabels.push_back(apA);
+    apLabels.push_back(apB);
+
+    storm::transformer::DAProductBuilder productBuilder(*da, apLabels);
+    auto product = productBuilder.build(*dtmc, dtmc->getInitialStates());
+    productBuilder.setTruncateAtSinks(true);
+    auto truncatedProduct = productBuilder.build(*dtmc, dtmc->getInitialStates());
+
+    EXPECT_LT(truncatedProduct->getProductModel().getNumberOfStates(), product->getProductModel().getNumberOfStates());
+    auto const& matrix = truncatedProduct->getProductModel().getTransitionMatrix();
+    for (uint64_t state = 0; state < truncatedProduct->getProductModel().getNumberOfStates(); ++state) {
+        if (da->isSink(truncatedProduct->getAutomatonState(state))) {
+            ASSERT_EQ(1ul, matrix.getRow(state).getNumberOfEntries());
+            EXPECT_EQ(state, matrix.getRow(state).begin()->getColumn());
+            // The accepting sink is reached by the self-loop
+            storm::storage::StateBlock scc;
+            scc.insert(state);
+            EXPECT_EQ(truncatedProduct->getAutomatonState(state) == 1, truncatedProduct->getAcceptance()->isAccepting(scc));
+        }
+    }
+}
@@ -0,0 +1,153 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/transformer/StateReorderer.h"
+
+namespace {
+
+// Builds a DTMC on an n x n grid whose states are numbered column by column, but across the columns in a scattered order.
+storm::storage::SparseMatrix<double> buildScatteredGrid(uint64_t n) {
+    std::vector<uint64_t> columnOrder(n);
+    for (uint64_t column = 0; column < n; ++column) {
+        columnOrder[column] = (column * 7) % n;
+    }
+    auto index = [&](uint64_t row, uint64_t column) { return columnOrder[column] * n + row; };
+
+    std::vector<std::vector<uint64_t>> successors(n * n);
+    for (uint64_t row = 0; row < n; ++row) {
+        for (uint64_t column = 0; column < n; ++column) {
+            auto& stateSuccessors = successors[index(row, column)];
+            stateSuccessors.push_back(index(row, (column + 1) % n));
+            stateSuccessors.push_back(index((row + 1) % n, column));
+            std::sort(stateSuccessors.begin(), stateSuccessors.end());
+        }
+    }
+    storm::storage::SparseMatrixBuilder<double> builder(n * n, n * n, 2 * n * n);
+    for (uint64_t state = 0; state < n * n; ++state) {
+        for (auto successor : successors[state]) {
+            builder.addNextValue(state, successor, 0.5);
+        }
+    }
+    return builder.build();
+}
+
+uint64_t getBandwidth(storm::storage::SparseMatrix<double> const& matrix) {
+    uint64_t result = 0;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            result = std::max(result, entry.getColumn() > row ? entry.getColumn() - row : row - entry.getColumn());
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(StateReordererTest, Orderings) {
+    storm::storage::SparseMatrix<double> matrix = buildScatteredGrid(30);
+    for (auto ordering : {storm::transformer::StateOrdering::ReverseCuthillMcKee, storm::transformer::StateOrdering::SccTopological,
+                          storm::transformer::StateOrdering::RecursiveBisection}) {
+        std::vector<uint64_t> newToOld = storm::transformer::computeStateOrdering(matrix, ordering);
+        std::vector<uint64_t> sorted = newToOld;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<uint64_t> identity(matrix.getRowCount());
+        std::iota(identity.begin(), identity.end(), 0);
+        EXPECT_EQ(identity, sorted);
+    }
+
+    // Reverse Cuthill-McKee numbers the grid diagonal by diagonal, which yields a bandwidth that is linear in the side length.
+    storm::models::sparse::StateLabeling labeling(matrix.getRowCount());
+    storm::storage::sparse::ModelComponents<double> components(matrix, labeling);
+    auto model = std::make_shared<storm::models::sparse::Dtmc<double>>(std::move(components));
+    auto reordered = storm::transformer::reorderStates(*model, storm::transformer::StateOrdering::ReverseCuthillMcKee);
+    EXPECT_EQ(matrix.getEntryCount(), reordered->getTransitionMatrix().getEntryCount());
+    EXPECT_GT(getBandwidth(matrix), 600ul);
+    EXPECT_LE(getBandwidth(reordered->getTransitionMatrix()), 120ul);
+}
+
+TEST(StateReordererTest, PermuteMdp) {
+    storm::storage::SparseMatrixBuilder<double> builder(4, 3, 6, true, true, 3);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 0, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 2, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 0.25);
+    builder.addNextValue(3, 1, 0.75);
+
+    storm::models::sparse::StateLabeling stateLabeling(3);
+    stateLabeling.addLabel("init");
+    stateLabeling.addLabelToState("init", 0);
+    stateLabeling.addLabel("goal");
+    stateLabeling.addLabelToState("goal", 2);
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("r", storm::models::sparse::StandardRewardModel<double>(std::vector<double>{1.0, 2.0, 3.0}, std::vector<double>{4.0, 5.0, 6.0, 7.0}));
+    storm::storage::sparse::ModelComponents<double> components(builder.build(), std::move(stateLabeling), std::move(rewardModels));
+    storm::models::sparse::ChoiceLabeling choiceLabeling(4);
+    choiceLabeling.addLabel("a");
+    choiceLabeling.addLabelToChoice("a", 1);
+    components.choiceLabeling = std::move(choiceLabeling);
+    storm::models::sparse::Mdp<double> mdp(std::move(components));
+
+    // The new states 0, 1, 2 are the original states 2, 0, 1.
+    auto permuted = storm::transformer::permuteStates(mdp, {2, 0, 1});
+    ASSERT_TRUE(permuted->isOfType(storm::models::ModelType::Mdp));
+    auto const& matrix = permuted->getTransitionMatrix();
+    EXPECT_EQ((std::vector<uint64_t>{0, 1, 3, 4}), matrix.getRowGroupIndices());
+    EXPECT_EQ(1.0, matrix.getRow(0).begin()->getValue());
+    EXPECT_EQ(0ul, matrix.getRow(0).begin()->getColumn());
+    EXPECT_EQ(0ul, matrix.getRow(1).begin()->getColumn());
+    EXPECT_EQ(2ul, (matrix.getRow(1).begin() + 1)->getColumn());
+    EXPECT_EQ(1ul, matrix.getRow(2).begin()->getColumn());
+    EXPECT_EQ(1ul, matrix.getRow(3).begin()->getColumn());
+    EXPECT_EQ(0.25, matrix.getRow(3).begin()->getValue());
+
+    EXPECT_TRUE(permuted->getStateLabeling().getStateHasLabel("init", 1));
+    EXPECT_TRUE(permuted->getStateLabeling().getStateHasLabel("goal", 0));
+    EXPECT_EQ(1ul, permuted->getInitialStates().getNumberOfSetBits());
+    EXPECT_TRUE(permuted->getChoiceLabeling().getChoiceHasLabel("a", 2));
+    EXPECT_EQ(1ul, permuted->getChoiceLabeling().getChoices("a").getNumberOfSetBits());
+    auto const& rewardModel = permuted->getRewardModel("r");
+    EXPECT_EQ((std::vector<double>{3.0, 1.0, 2.0}), rewardModel.getStateRewardVector());
+    EXPECT_EQ((std::vector<double>{6.0, 4.0, 5.0, 7.0}), rewardModel.getStateActionRewardVector());
+
+    STORM_SILENT_EXPECT_THROW(storm::transformer::permuteStates(mdp, {2, 0, 0}), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(StateReordererTest, Die) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::string formulasString = "P=? [ F \"two\" ];R=? [ F \"done\" ]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    storm::builder::BuilderOptions options(formulas, program);
+    options.setBuildStateValuations();
+    auto model = storm::api::buildSparseModel<double>(program, options);
+
+    for (auto ordering : {storm::transformer::StateOrdering::ReverseCuthillMcKee, storm::transformer::StateOrdering::SccTopological,
+                          storm::transformer::StateOrdering::RecursiveBisection}) {
+        auto reordered = storm::api::reorderSparseModelStates(model, ordering);
+        ASSERT_EQ(model->getNumberOfStates(), reordered->getNumberOfStates());
+        ASSERT_EQ(model->getNumberOfTransitions(), reordered->getNumberOfTransitions());
+        ASSERT_TRUE(reordered->hasStateValuations());
+        uint64_t initialState = *reordered->getInitialStates().begin();
+        EXPECT_EQ(model->getStateValuations().toString(*model->getInitialStates().begin()), reordered->getStateValuations().toString(initialState));
+
+        for (auto const& formula : formulas) {
+            auto result = storm::api::verifyWithSparseEngine(reordered, storm::api::createTask<double>(formula, true));
+            auto expected = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, true));
+            EXPECT_NEAR(expected->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()],
+                        result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        }
+    }
+}
@@ -0,0 +1,32 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/transformer/SymbolicToSparseTransformer.h"
+
+TEST(SymbolicToSparseTransformerTest, DtmcLabeling) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    auto symbolicDtmc =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program)->as<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan>>();
+
+    storm::transformer::SymbolicDtmcToSparseDtmcTransformer<storm::dd::DdType::Sylvan, double> transformer;
+    auto sparseDtmc = transformer.translate(*symbolicDtmc);
+    auto const& odd = transformer.getOdd();
+    ASSERT_EQ(13ull, sparseDtmc->getNumberOfStates());
+    EXPECT_EQ(20ull, sparseDtmc->getNumberOfTransitions());
+
+    // The labels are translated in blocks, but each of them has to match its individual translation.
+    EXPECT_EQ(symbolicDtmc->getInitialStates().toVector(odd), sparseDtmc->getStates("init"));
+    EXPECT_EQ(symbolicDtmc->getDeadlockStates().toVector(odd), sparseDtmc->getStates("deadlock"));
+    for (auto const& label : symbolicDtmc->getLabels()) {
+        ASSERT_TRUE(sparseDtmc->hasLabel(label));
+        EXPECT_EQ(symbolicDtmc->getStates(label).toVector(odd), sparseDtmc->getStates(label));
+    }
+    EXPECT_EQ(1ull, sparseDtmc->getStates("one").getNumberOfSetBits());
+    EXPECT_EQ(6ull, sparseDtmc->getStates("done").getNumberOfSetBits());
+}
@@ -74,6 +74,36 @@ TEST(GraphTest, SymbolicProb01_Sylvan) {
     }
 }
 
+TEST(GraphTest, SymbolicSccBlocks_Sylvan) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+
+    {
+        // This block is necessary, so the BDDs get disposed before the manager (contained in the model).
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> transitionMatrix = model->getTransitionMatrix().notZero();
+        for (uint64_t minimalBlockSize : {1ull, 1000ull}) {
+            std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> blocks;
+            ASSERT_NO_THROW(blocks = storm::utility::graph::computeSccBlocks(*model, transitionMatrix, model->getReachableStates(), minimalBlockSize));
+
+            // The blocks partition the reachable states and are ordered such that every block only has successors in itself and preceding blocks.
+            storm::dd::Bdd<storm::dd::DdType::Sylvan> coveredStates = model->getManager().getBddZero();
+            for (auto const& block : blocks) {
+                EXPECT_TRUE((coveredStates && block).isZero());
+                coveredStates |= block;
+                storm::dd::Bdd<storm::dd::DdType::Sylvan> successors =
+                    block.relationalProduct(transitionMatrix, model->getRowVariables(), model->getColumnVariables());
+                EXPECT_TRUE((successors && !coveredStates).isZero());
+            }
+            EXPECT_TRUE(coveredStates == model->getReachableStates());
+            if (minimalBlockSize > 1) {
+                EXPECT_LT(1ull, blocks.size());
+            }
+        }
+    }
+}
+
 TEST(GraphTest, SymbolicProb01MinMax_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -0,0 +1,48 @@
+#include "storm-config.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/Instrumentation.h"
+#include "test/storm_gtest.h"
+
+TEST(InstrumentationTest, DisabledByDefault) {
+    auto& instrumentation = storm::utility::Instrumentation::instance();
+    ASSERT_FALSE(storm::utility::Instrumentation::isEnabled());
+
+    auto& counter = instrumentation.getCounter("test.disabled.counter");
+    storm::utility::incrementCounter(counter, 5);
+    { storm::utility::InstrumentationTimer timer("test.disabled.timer"); }
+
+    EXPECT_EQ(0ull, instrumentation.getCounterValue("test.disabled.counter"));
+    EXPECT_EQ(0ull, instrumentation.getNumberOfMeasurements("test.disabled.timer"));
+}
+
+TEST(InstrumentationTest, TimersAndCounters) {
+    auto& instrumentation = storm::utility::Instrumentation::instance();
+    storm::utility::Instrumentation::setEnabled(true);
+
+    auto& counter = instrumentation.getCounter("test.enabled.counter");
+    storm::utility::incrementCounter(counter);
+    storm::utility::incrementCounter(counter, 4);
+    for (uint64_t i = 0; i < 3; ++i) {
+        storm::utility::InstrumentationTimer timer("test.enabled.timer");
+    }
+    storm::utility::Instrumentation::setEnabled(false);
+
+    EXPECT_EQ(5ull, instrumentation.getCounterValue("test.enabled.counter"));
+    EXPECT_EQ(3ull, instrumentation.getNumberOfMeasurements("test.enabled.timer"));
+    EXPECT_EQ(0ull, instrumentation.getCounterValue("test.unknown"));
+
+    auto json = instrumentation.toJson();
+    EXPECT_EQ(5ull, json["test"]["enabled"]["counter"]["count"].get<uint64_t>());
+    EXPECT_EQ(3ull, json["test"]["enabled"]["timer"]["measurements"].get<uint64_t>());
+    EXPECT_EQ(0ull, json["test"].count("disabled"));
+
+    instrumentation.reset();
+    EXPECT_EQ(0ull, instrumentation.getCounterValue("test.enabled.counter"));
+    EXPECT_EQ(0ull, instrumentation.getNumberOfMeasurements("test.enabled.timer"));
+    // The counter stays valid after resetting.
+    storm::utility::Instrumentation::setEnabled(true);
+    storm::utility::incrementCounter(counter);
+    storm::utility::Instrumentation::setEnabled(false);
+    EXPECT_EQ(1ull, instrumentation.getCounterValue("test.enabled.counter"));
+    instrumentation.reset();
+}
@@ -105,3 +105,27 @@ TEST(KSPTest, kspPathAsList) {
     //    161, 154, 146, 140, 134, 127, 119, 112, 104, 98, 92, 85, 77, 70, 81, 74, 65, 58, 52, 45, 37, 30, 22, 17, 12, 9, 6, 4, 2, 1, 0}; EXPECT_EQ(reference,
     //    list);
 }
+
+TEST(KSPTest, longPaths) {
+    // A long chain in which each state may restart at the first state.
+    // The second shortest path has to be derived along the entire chain, which used to recurse once per state.
+    const storm::utility::ksp::state_t numberOfStates = 100000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (storm::utility::ksp::state_t state = 0; state + 1 < numberOfStates; ++state) {
+        builder.addNextValue(state, 0, 0.0001);
+        builder.addNextValue(state, state + 1, 0.9999);
+    }
+    builder.addNextValue(numberOfStates - 1, numberOfStates - 1, 1.0);
+    auto matrix = builder.build();
+    storm::storage::BitVector initialStates(numberOfStates);
+    initialStates.set(0);
+    storm::utility::ksp::ShortestPathsGenerator<double>::StateProbMap targetProbabilities = {{numberOfStates - 1, 1.0}};
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(matrix, targetProbabilities, initialStates, storm::utility::ksp::MatrixFormat::straight);
+
+    double dist1 = spg.getDistance(1);
+    EXPECT_NEAR(std::pow(0.9999, numberOfStates - 1), dist1, 1e-12);
+    // The best detour is the self-loop at the first state
+    double dist2 = spg.getDistance(2);
+    EXPECT_NEAR(0.0001 * dist1, dist2, 1e-15);
+    EXPECT_EQ(numberOfStates + 1, spg.getPathAsList(2).size());
+}
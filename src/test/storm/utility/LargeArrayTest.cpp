@@ -0,0 +1,81 @@
+#include "storm-config.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/LargeArray.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+/*!
+ * Sets the given options for the lifetime of the object and restores the previous ones afterwards.
+ */
+class ScopedLargeArrayOptions {
+   public:
+    ScopedLargeArrayOptions(storm::utility::LargeArrayOptions const& options) : previousOptions(storm::utility::LargeArray::getOptions()) {
+        storm::utility::LargeArray::setOptions(options);
+    }
+
+    ~ScopedLargeArrayOptions() {
+        storm::utility::LargeArray::setOptions(previousOptions);
+    }
+
+   private:
+    storm::utility::LargeArrayOptions previousOptions;
+};
+
+void checkVector(storm::utility::LargeArrayOptions const& options) {
+    ScopedLargeArrayOptions scope(options);
+    std::vector<double, storm::utility::LargeArrayAllocator<double>> vector(100000, 0.5);
+    for (uint64_t index = 0; index < vector.size(); index += 1000) {
+        vector[index] = static_cast<double>(index);
+    }
+    EXPECT_EQ(0.0, vector[0]);
+    EXPECT_EQ(0.5, vector[1]);
+    EXPECT_EQ(99000.0, vector[99000]);
+    vector.resize(300000, 1.0);
+    EXPECT_EQ(99000.0, vector[99000]);
+    EXPECT_EQ(1.0, vector.back());
+}
+
+}  // namespace
+
+TEST(LargeArrayTest, DefaultAllocation) {
+    EXPECT_FALSE(storm::utility::LargeArray::getOptions().isSpecialAllocationSet());
+    checkVector(storm::utility::LargeArrayOptions());
+}
+
+TEST(LargeArrayTest, HugePagesAndInterleaving) {
+    storm::utility::LargeArrayOptions options;
+    options.threshold = 1 << 16;
+    options.hugePages = true;
+    options.interleave = true;
+    checkVector(options);
+
+    // Advising memory of other allocators must not change its content.
+    ScopedLargeArrayOptions scope(options);
+    std::vector<uint64_t> vector(1 << 20, 42);
+    storm::utility::LargeArray::advise(vector);
+    EXPECT_EQ(42ull, vector.front());
+    EXPECT_EQ(42ull, vector.back());
+}
+
+TEST(LargeArrayTest, FileBacked) {
+    storm::utility::LargeArrayOptions options;
+    options.threshold = 1 << 16;
+    options.backingDirectory = "/tmp";
+    checkVector(options);
+
+    ScopedLargeArrayOptions scope(options);
+    storm::storage::BitVector bitVector(1 << 22);
+    EXPECT_TRUE(bitVector.empty());
+    bitVector.set(12345);
+    bitVector.resize(1 << 23, true);
+    EXPECT_TRUE(bitVector.get(12345));
+    EXPECT_FALSE(bitVector.get(12346));
+    EXPECT_TRUE(bitVector.get((1 << 23) - 1));
+    EXPECT_EQ(1ull + (1 << 22), bitVector.getNumberOfSetBits());
+
+    storm::storage::BitVector copy = bitVector;
+    EXPECT_EQ(bitVector, copy);
+    bitVector = storm::storage::BitVector(10, true);
+    EXPECT_EQ(10ull, bitVector.getNumberOfSetBits());
+}
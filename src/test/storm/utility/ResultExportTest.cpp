@@ -0,0 +1,156 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryResultExporter.h"
+#include "storm/io/BinaryResultFormat.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/Scheduler.h"
+
+namespace {
+
+std::string getTemporaryFilename() {
+    return (std::filesystem::temp_directory_path() / "storm_result_export_test.bin").string();
+}
+
+// Reads the whole file and removes it afterwards.
+std::string readAndRemoveFile(std::string const& filename) {
+    std::string content;
+    {
+        std::ifstream file(filename, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        content = buffer.str();
+    }
+    std::remove(filename.c_str());
+    return content;
+}
+
+storm::exporter::resultbinary::FileHeader getHeader(std::string const& content) {
+    storm::exporter::resultbinary::FileHeader header;
+    EXPECT_LE(sizeof(header), content.size());
+    std::memcpy(&header, content.data(), sizeof(header));
+    EXPECT_EQ(0, std::memcmp(header.magic, storm::exporter::resultbinary::Magic, sizeof(header.magic)));
+    EXPECT_EQ(storm::exporter::resultbinary::FormatVersion, header.version);
+    EXPECT_EQ(storm::exporter::resultbinary::EndiannessMarker, header.endiannessMarker);
+    return header;
+}
+
+template<typename T>
+std::vector<T> getColumn(std::string const& content, uint64_t offset, uint64_t count) {
+    EXPECT_EQ(0ull, offset % storm::exporter::resultbinary::ColumnAlignment);
+    EXPECT_LE(offset + count * sizeof(T), content.size());
+    std::vector<T> result(count);
+    std::memcpy(result.data(), content.data() + offset, count * sizeof(T));
+    return result;
+}
+
+storm::models::sparse::StateLabeling createLabeling() {
+    storm::models::sparse::StateLabeling labeling(4);
+    storm::storage::BitVector initialStates(4);
+    initialStates.set(0);
+    labeling.addLabel("init", std::move(initialStates));
+    labeling.addLabel("goal", storm::storage::BitVector(4, {2, 3}));
+    return labeling;
+}
+
+}  // namespace
+
+TEST(ResultExportTest, QuantitativeJsonStream) {
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> result(std::vector<double>({0.5, 1.0, 0.25, 0.0}));
+    std::stringstream stream;
+    result.writeJsonToStream(stream, std::nullopt, createLabeling());
+    EXPECT_EQ(result.toJson(std::nullopt, createLabeling()).dump(4), stream.str());
+
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> mapResult(std::map<uint64_t, double>({{1, 0.75}, {3, 0.125}}));
+    std::stringstream mapStream;
+    mapResult.writeJsonToStream(mapStream);
+    EXPECT_EQ(mapResult.toJson().dump(4), mapStream.str());
+}
+
+TEST(ResultExportTest, QualitativeJsonStream) {
+    storm::modelchecker::ExplicitQualitativeCheckResult result(storm::storage::BitVector(4, {1, 2}));
+    std::stringstream stream;
+    result.writeJsonToStream(stream, std::nullopt, createLabeling());
+    EXPECT_EQ(result.toJson(std::nullopt, createLabeling()).dump(4), stream.str());
+}
+
+TEST(ResultExportTest, SchedulerJsonStream) {
+    storm::storage::Scheduler<double> scheduler(3);
+    scheduler.setChoice(1, 0);
+    scheduler.setChoice(0, 2);
+    std::stringstream stream;
+    scheduler.printJsonToStream(stream);
+    auto parsed = storm::json<storm::RationalNumber>::parse(stream.str());
+    ASSERT_TRUE(parsed.is_array());
+    ASSERT_EQ(3ull, parsed.size());
+    EXPECT_EQ("undefined", parsed[1]["c"].get<std::string>());
+}
+
+TEST(ResultExportTest, QuantitativeBinary) {
+    std::string filename = getTemporaryFilename();
+    std::vector<double> values = {0.5, 1.0, 0.25, 0.0};
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> result(values);
+    storm::exporter::binaryExportCheckResult<double>(filename, result);
+    std::string content = readAndRemoveFile(filename);
+    auto header = getHeader(content);
+    EXPECT_EQ(storm::exporter::resultbinary::ContentCode::Values, header.content);
+    EXPECT_EQ(storm::exporter::resultbinary::ValueTypeCode::Double, header.valueType);
+    EXPECT_EQ(4ull, header.numberOfEntries);
+    EXPECT_EQ(0u, header.hasStateIndices);
+    EXPECT_EQ(values, getColumn<double>(content, storm::exporter::resultbinary::ColumnAlignment, 4));
+
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> mapResult(std::map<uint64_t, double>({{1, 0.75}, {3, 0.125}}));
+    storm::exporter::binaryExportCheckResult<double>(filename, mapResult);
+    content = readAndRemoveFile(filename);
+    header = getHeader(content);
+    EXPECT_EQ(2ull, header.numberOfEntries);
+    EXPECT_EQ(1u, header.hasStateIndices);
+    EXPECT_EQ(std::vector<uint64_t>({1, 3}), getColumn<uint64_t>(content, storm::exporter::resultbinary::ColumnAlignment, 2));
+    EXPECT_EQ(std::vector<double>({0.75, 0.125}), getColumn<double>(content, 2 * storm::exporter::resultbinary::ColumnAlignment, 2));
+}
+
+TEST(ResultExportTest, QualitativeBinary) {
+    std::string filename = getTemporaryFilename();
+    storm::storage::BitVector truthValues(70, {0, 2, 69});
+    storm::modelchecker::ExplicitQualitativeCheckResult result(truthValues);
+    storm::exporter::binaryExportCheckResult<double>(filename, result);
+    std::string content = readAndRemoveFile(filename);
+    auto header = getHeader(content);
+    EXPECT_EQ(storm::exporter::resultbinary::ContentCode::TruthValues, header.content);
+    EXPECT_EQ(storm::exporter::resultbinary::ValueTypeCode::Bit, header.valueType);
+    EXPECT_EQ(70ull, header.numberOfEntries);
+    auto words = getColumn<uint64_t>(content, storm::exporter::resultbinary::ColumnAlignment, 2);
+    EXPECT_EQ((1ull << 63) | (1ull << 61), words[0]);
+    EXPECT_EQ(1ull << 58, words[1]);
+}
+
+TEST(ResultExportTest, SchedulerBinary) {
+    std::string filename = getTemporaryFilename();
+    storm::storage::Scheduler<double> scheduler(3);
+    scheduler.setChoice(1, 0);
+    scheduler.setChoice(4, 2);
+    storm::exporter::binaryExportScheduler(filename, scheduler);
+    std::string content = readAndRemoveFile(filename);
+    auto header = getHeader(content);
+    EXPECT_EQ(storm::exporter::resultbinary::ContentCode::SchedulerChoices, header.content);
+    EXPECT_EQ(3ull, header.numberOfEntries);
+    EXPECT_EQ(1ull, header.numberOfMemoryStates);
+    EXPECT_EQ(std::vector<uint64_t>({1, storm::exporter::resultbinary::UndefinedChoice, 4}),
+              getColumn<uint64_t>(content, storm::exporter::resultbinary::ColumnAlignment, 3));
+
+    storm::storage::Scheduler<double> randomizedScheduler(1);
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.5);
+    distribution.addProbability(1, 0.5);
+    randomizedScheduler.setChoice(storm::storage::SchedulerChoice<double>(distribution), 0);
+    STORM_SILENT_EXPECT_THROW(storm::exporter::binaryExportScheduler(filename, randomizedScheduler), storm::exceptions::NotSupportedException);
+}
@@ -0,0 +1,49 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace {
+
+class LazyTestSettings : public storm::settings::modules::ModuleSettings {
+   public:
+    LazyTestSettings() : ModuleSettings(moduleName) {
+        ++numberOfConstructions;
+        this->addOption(storm::settings::OptionBuilder(moduleName, "lazytestoption", false, "An option of the test module.").build());
+    }
+
+    bool isLazyTestOptionSet() const {
+        return this->getOption("lazytestoption").getHasOptionBeenSet();
+    }
+
+    static const std::string moduleName;
+    static uint64_t numberOfConstructions;
+};
+
+const std::string LazyTestSettings::moduleName = "lazytest";
+uint64_t LazyTestSettings::numberOfConstructions = 0;
+
+TEST(SettingsManagerTest, LazyModuleConstruction) {
+    storm::settings::addModule<LazyTestSettings>();
+    EXPECT_TRUE(storm::settings::manager().hasModule(LazyTestSettings::moduleName));
+    EXPECT_TRUE(storm::settings::manager().hasModule(LazyTestSettings::moduleName, true));
+    EXPECT_EQ(0ull, LazyTestSettings::numberOfConstructions);
+
+    // The module is constructed once it is retrieved.
+    EXPECT_FALSE(storm::settings::getModule<LazyTestSettings>().isLazyTestOptionSet());
+    EXPECT_FALSE(storm::settings::getModule<LazyTestSettings>().isLazyTestOptionSet());
+    EXPECT_EQ(1ull, LazyTestSettings::numberOfConstructions);
+
+    // The options of the module are known to the manager.
+    std::string help = storm::settings::manager().getHelpForModule(LazyTestSettings::moduleName);
+    EXPECT_NE(std::string::npos, help.find("lazytestoption"));
+    EXPECT_EQ(1ull, LazyTestSettings::numberOfConstructions);
+
+    // Modules can not be registered twice.
+    STORM_SILENT_EXPECT_THROW(storm::settings::addModule<LazyTestSettings>(), storm::exceptions::IllegalFunctionCallException);
+}
+
+}  // namespace
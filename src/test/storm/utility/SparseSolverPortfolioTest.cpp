@@ -0,0 +1,124 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SparseSolverPortfolio.h"
+
+TEST(SparseSolverPortfolioTest, Features) {
+    storm::storage::SparseMatrixBuilder<double> dtmcBuilder(3, 3, 4);
+    dtmcBuilder.addNextValue(0, 1, 0.5);
+    dtmcBuilder.addNextValue(0, 2, 0.5);
+    dtmcBuilder.addNextValue(1, 1, 1.0);
+    dtmcBuilder.addNextValue(2, 2, 1.0);
+    storm::models::sparse::Dtmc<double> dtmc(dtmcBuilder.build(), storm::models::sparse::StateLabeling(3));
+
+    // The self-loops of absorbing states do not count as cycles.
+    auto features = storm::utility::SparseSolverPortfolio::getFeatures(dtmc);
+    EXPECT_EQ(3ul, features.numberOfStates);
+    EXPECT_EQ(4ul, features.numberOfTransitions);
+    EXPECT_EQ(3ul, features.numberOfSccs);
+    EXPECT_EQ(0ul, features.numberOfNonTrivialSccs);
+    EXPECT_TRUE(features.acyclic);
+    EXPECT_FALSE(features.nondeterministic);
+
+    storm::storage::SparseMatrixBuilder<double> mdpBuilder(4, 3, 5, true, true, 3);
+    mdpBuilder.newRowGroup(0);
+    mdpBuilder.addNextValue(0, 1, 1.0);
+    mdpBuilder.addNextValue(1, 0, 0.5);
+    mdpBuilder.addNextValue(1, 2, 0.5);
+    mdpBuilder.newRowGroup(2);
+    mdpBuilder.addNextValue(2, 0, 1.0);
+    mdpBuilder.newRowGroup(3);
+    mdpBuilder.addNextValue(3, 2, 1.0);
+    storm::models::sparse::Mdp<double> mdp(mdpBuilder.build(), storm::models::sparse::StateLabeling(3));
+
+    features = storm::utility::SparseSolverPortfolio::getFeatures(mdp);
+    EXPECT_EQ(4ul, features.numberOfChoices);
+    EXPECT_EQ(2ul, features.numberOfSccs);
+    EXPECT_EQ(1ul, features.numberOfNonTrivialSccs);
+    EXPECT_EQ(2ul, features.largestSccSize);
+    EXPECT_EQ(2ul, features.maximalRowGroupSize);
+    EXPECT_FALSE(features.acyclic);
+    EXPECT_TRUE(features.nondeterministic);
+    EXPECT_TRUE(features.hasEndComponents);
+}
+
+TEST(SparseSolverPortfolioTest, Predict) {
+    storm::utility::SparseSolverPortfolio portfolio;
+    storm::utility::SparseSolverPortfolio::Features features;
+    features.numberOfStates = 1000000;
+    features.numberOfChoices = 2000000;
+    features.numberOfTransitions = 5000000;
+    features.numberOfSccs = 1;
+    features.numberOfNonTrivialSccs = 1;
+    features.largestSccSize = 1000000;
+    features.acyclic = false;
+    features.averageEntriesPerRow = 2.5;
+    features.nondeterministic = true;
+
+    portfolio.predict(features, false, false);
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, portfolio.getMinMaxMethod());
+    EXPECT_EQ(storm::solver::MultiplicationStyle::GaussSeidel, portfolio.getMultiplicationStyle());
+    EXPECT_EQ(storm::solver::MultiplierType::Native, portfolio.getMultiplierType());
+    ASSERT_TRUE(portfolio.getRaceMinMaxMethod());
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, portfolio.getRaceMinMaxMethod().get());
+
+    portfolio.predict(features, false, true);
+    EXPECT_EQ(storm::solver::MinMaxMethod::OptimisticValueIteration, portfolio.getMinMaxMethod());
+    EXPECT_EQ(storm::solver::EquationSolverType::Native, portfolio.getEquationSolverType());
+    ASSERT_TRUE(portfolio.getNativeMethod());
+    EXPECT_EQ(storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration, portfolio.getNativeMethod().get());
+
+    portfolio.predict(features, true, false);
+    EXPECT_EQ(storm::solver::MinMaxMethod::RationalSearch, portfolio.getMinMaxMethod());
+    EXPECT_FALSE(portfolio.getNativeMethod());
+
+    // Many small SCCs are solved one by one.
+    features.numberOfSccs = 1000;
+    features.numberOfNonTrivialSccs = 1000;
+    features.largestSccSize = 1000;
+    portfolio.predict(features, false, false);
+    EXPECT_EQ(storm::solver::MinMaxMethod::Topological, portfolio.getMinMaxMethod());
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, portfolio.getUnderlyingMinMaxMethod());
+    EXPECT_EQ(storm::solver::EquationSolverType::Topological, portfolio.getEquationSolverType());
+
+    features.numberOfNonTrivialSccs = 0;
+    features.acyclic = true;
+    portfolio.predict(features, false, false);
+    EXPECT_EQ(storm::solver::MinMaxMethod::Acyclic, portfolio.getMinMaxMethod());
+    EXPECT_EQ(storm::solver::EquationSolverType::Acyclic, portfolio.getEquationSolverType());
+    EXPECT_FALSE(portfolio.getRaceMinMaxMethod());
+}
+
+TEST(SparseSolverPortfolioTest, ApplyTo) {
+    storm::utility::SparseSolverPortfolio portfolio;
+    storm::utility::SparseSolverPortfolio::Features features;
+    features.numberOfStates = 100;
+    features.numberOfChoices = 200;
+    features.numberOfSccs = 1;
+    features.numberOfNonTrivialSccs = 1;
+    features.largestSccSize = 100;
+    features.acyclic = false;
+    features.nondeterministic = true;
+    portfolio.predict(features, false, false);
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, portfolio.getMinMaxMethod());
+
+    storm::Environment env;
+    portfolio.applyTo(env, true);
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, env.solver().minMax().getMethod());
+    ASSERT_TRUE(env.solver().minMax().isRaceMethodSet());
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration, env.solver().minMax().getRaceMethod());
+
+    // Explicitly set methods are kept.
+    storm::Environment otherEnv;
+    otherEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+    portfolio.applyTo(otherEnv, false);
+    EXPECT_EQ(storm::solver::MinMaxMethod::IntervalIteration, otherEnv.solver().minMax().getMethod());
+    EXPECT_FALSE(otherEnv.solver().minMax().isRaceMethodSet());
+}
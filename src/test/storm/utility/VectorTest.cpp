@@ -38,4 +38,18 @@ TEST(VectorTest, permute) {
     EXPECT_EQ(aperm[1], a[3]);
     EXPECT_EQ(aperm[2], a[1]);
     EXPECT_EQ(aperm[3], a[2]);
-}
\ No newline at end of file
+}
+#ifdef STORM_HAVE_INTELTBB
+TEST(VectorTest, reduceParallel) {
+    std::vector<double> source = {0.3, 0.1, 0.2, 0.5, 0.4, 0.6, 0.0, 0.9};
+    std::vector<uint_fast64_t> rowGrouping = {0, 3, 4, 6, 8};
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> sequentialResult(4), parallelResult(4);
+        std::vector<uint_fast64_t> sequentialChoices(4, 0), parallelChoices(4, 0);
+        storm::utility::vector::reduceVectorMinOrMax(dir, source, sequentialResult, rowGrouping, &sequentialChoices);
+        storm::utility::vector::reduceVectorMinOrMaxParallel(dir, source, parallelResult, rowGrouping, &parallelChoices);
+        EXPECT_EQ(sequentialResult, parallelResult);
+        EXPECT_EQ(sequentialChoices, parallelChoices);
+    }
+}
+#endif